@@ -20,7 +20,7 @@ REPODIR=$(cd $(dirname $0); pwd)
 LIBCUGRAPH_BUILD_DIR=${LIBCUGRAPH_BUILD_DIR:=${REPODIR}/cpp/build}
 LIBCUGRAPH_ETL_BUILD_DIR=${LIBCUGRAPH_ETL_BUILD_DIR:=${REPODIR}/cpp/libcugraph_etl/build}
 
-VALIDARGS="clean uninstall libcugraph libcugraph_etl cugraph pylibcugraph cpp-mgtests docs -v -g -n --allgpuarch --buildfaiss --show_depr_warn --skip_cpp_tests -h --help"
+VALIDARGS="clean uninstall libcugraph libcugraph_etl cugraph pylibcugraph cpp-mgtests docs -v -g -n --allgpuarch --buildfaiss --show_depr_warn --skip_cpp_tests --cpp_benchmarks -h --help"
 HELP="$0 [<target> ...] [<flag> ...]
  where <target> is:
    clean            - remove all existing build artifacts and configuration (start over)
@@ -39,6 +39,7 @@ HELP="$0 [<target> ...] [<flag> ...]
    --buildfaiss     - build faiss statically into cugraph
    --show_depr_warn - show cmake deprecation warnings
    --skip_cpp_tests - do not build the SG test binaries as part of the libcugraph and libcugraph_etl targets
+   --cpp_benchmarks - build the C++ (google) benchmark binaries as part of the libcugraph target
    -h               - print this text
 
  default action (no args) is to build and install 'libcugraph' then 'libcugraph_etl' then 'pylibcugraph' then 'cugraph' then 'docs' targets
@@ -57,6 +58,7 @@ INSTALL_TARGET=install
 BUILD_DISABLE_DEPRECATION_WARNING=ON
 BUILD_CPP_TESTS=ON
 BUILD_CPP_MG_TESTS=OFF
+BUILD_CPP_BENCHMARKS=OFF
 BUILD_STATIC_FAISS=OFF
 BUILD_ALL_GPU_ARCH=0
 
@@ -115,6 +117,9 @@ fi
 if hasArg cpp-mgtests; then
     BUILD_CPP_MG_TESTS=ON
 fi
+if hasArg --cpp_benchmarks; then
+    BUILD_CPP_BENCHMARKS=ON
+fi
 
 # If clean or uninstall given, run them prior to any other steps
 if hasArg uninstall; then
@@ -187,6 +192,7 @@ if buildAll || hasArg libcugraph; then
           -DBUILD_STATIC_FAISS=${BUILD_STATIC_FAISS} \
           -DBUILD_TESTS=${BUILD_CPP_TESTS} \
           -DBUILD_CUGRAPH_MG_TESTS=${BUILD_CPP_MG_TESTS} \
+          -DBUILD_BENCHMARKS=${BUILD_CPP_BENCHMARKS} \
           ${REPODIR}/cpp
     cmake --build "${LIBCUGRAPH_BUILD_DIR}" -j${PARALLEL_LEVEL} --target ${INSTALL_TARGET} ${VERBOSE_FLAG}
 fi
@@ -0,0 +1,37 @@
+#=============================================================================
+# Copyright (c) 2021, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#=============================================================================
+
+
+function(find_and_configure_dlpack VERSION)
+
+    # dlpack is header-only and only its dlpack.h is used (by the C API), so download the sources
+    # without building or installing the dlpack CMake targets
+    rapids_cpm_find(dlpack ${VERSION}
+      CPM_ARGS
+        GIT_REPOSITORY https://github.com/dmlc/dlpack.git
+        GIT_TAG        v${VERSION}
+        GIT_SHALLOW    TRUE
+        DOWNLOAD_ONLY  TRUE
+    )
+
+    if(NOT TARGET cugraph::dlpack)
+        add_library(cugraph::dlpack IMPORTED INTERFACE GLOBAL)
+        target_include_directories(cugraph::dlpack INTERFACE "${dlpack_SOURCE_DIR}/include")
+    endif()
+
+endfunction()
+
+find_and_configure_dlpack(0.6)
@@ -20,14 +20,25 @@
 #include <cugraph/dendrogram.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/serialization/checkpoint.hpp>
 
 #include <cugraph/internals.hpp>
 #include <cugraph/legacy/graph.hpp>
 
 #include <raft/handle.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <functional>
+#include <vector>
+
 namespace cugraph {
 
+// defined in cugraph/prims/temporal_edge_properties.cuh
+template <typename GraphViewType, typename timestamp_t>
+class temporal_edge_properties_t;
+
 /**
  * @brief     Compute jaccard similarity coefficient for all vertices
  *
@@ -201,6 +212,134 @@ void force_atlas2(raft::handle_t const& handle,
                   bool verbose                                  = false,
                   internals::GraphBasedDimRedCallback* callback = nullptr);
 
+/**
+ * @brief ForceAtlas2 layout on a (multi-GPU) graph view.
+ *
+ * Attraction is computed over the edges and repulsion is approximated by a Barnes-Hut traversal of
+ * a coarse quadtree (at most 10 levels) of the layout's bounding square; the quadtree holds the
+ * per-cell masses and centers of mass only and is replicated in every GPU, so a GPU needs the
+ * positions of its local vertices only. Without starting positions, the initial positions are drawn
+ * per (global) vertex ID and do not depend on the number of GPUs. The mass of a vertex is its
+ * degree + 1. Overlap prevention and the embedding callback of the legacy version are not
+ * supported.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of a symmetric graph (edge weights are used if present).
+ * @param x_pos Pointer to the output x-axis positions (for the vertices local to this process in
+ * multi-GPU).
+ * @param y_pos Pointer to the output y-axis positions (for the vertices local to this process in
+ * multi-GPU).
+ * @param max_iter The number of iterations to run.
+ * @param x_start Optional pointer to the starting x-axis positions (for the vertices local to this
+ * process in multi-GPU), should be set together with @p y_start.
+ * @param y_start Optional pointer to the starting y-axis positions (for the vertices local to this
+ * process in multi-GPU), should be set together with @p x_start.
+ * @param outbound_attraction_distribution Distributes attraction along outbound edges. Hubs attract
+ * less and thus are pushed to the borders.
+ * @param lin_log_mode Switch to the lin-log model (makes clusters tighter).
+ * @param edge_weight_influence How much influence the edge weights have (0 is no influence, 1 is
+ * normal).
+ * @param jitter_tolerance How much swinging is allowed. Above 1 discouraged. Lower gives less speed
+ * and more precision.
+ * @param barnes_hut_theta Tradeoff for speed (larger) vs accuracy (smaller, 0 opens every cell).
+ * @param scaling_ratio How much repulsion (should be positive). More makes a sparser layout.
+ * @param strong_gravity_mode Sets a gravity that attracts the vertices distant from the center
+ * more.
+ * @param gravity Attracts the vertices to the center. Prevents islands from drifting away.
+ * @param verbose Output convergence info at each iteration (by the process of rank 0 in multi-GPU).
+ * @param half_precision_quadtree Store the Barnes-Hut cells' centers of mass in half precision (as
+ * offsets within the cells; the sums are still accumulated in float). Halves the cell records
+ * read by the repulsion traversal at the cost of about 1/2048 cell width of error.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void force_atlas2(raft::handle_t const& handle,
+                  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                  float* x_pos,
+                  float* y_pos,
+                  size_t max_iter                       = 500,
+                  std::optional<float const*> x_start   = std::nullopt,
+                  std::optional<float const*> y_start   = std::nullopt,
+                  bool outbound_attraction_distribution = true,
+                  bool lin_log_mode                     = false,
+                  float edge_weight_influence           = 1.0,
+                  float jitter_tolerance                = 1.0,
+                  float barnes_hut_theta                = 0.5,
+                  float scaling_ratio                   = 2.0,
+                  bool strong_gravity_mode              = false,
+                  float gravity                         = 1.0,
+                  bool verbose                          = false,
+                  bool half_precision_quadtree          = false,
+                  bool do_expensive_check               = false);
+
+/**
+ * @brief Multilevel ForceAtlas2 layout on a (multi-GPU) graph view.
+ *
+ * Coarsens the graph level by level by contracting single-level Louvain clusters (see
+ * coarsen_graph) until a level has few vertices, shrinks by less than 1/4, or @p max_levels levels
+ * are reached. The coarsest level is laid out with @p coarse_max_iter iterations of force_atlas2,
+ * and every finer level starts from the positions of its clusters (with a small jitter) and is
+ * refined with @p refine_max_iter iterations. A good layout needs far fewer full-resolution
+ * iterations than force_atlas2 from random positions.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of a symmetric graph (edge weights are used if present).
+ * @param x_pos Pointer to the output x-axis positions (for the vertices local to this process in
+ * multi-GPU).
+ * @param y_pos Pointer to the output y-axis positions (for the vertices local to this process in
+ * multi-GPU).
+ * @param coarse_max_iter The number of iterations on the coarsest level.
+ * @param refine_max_iter The number of iterations on every finer level (including the input graph).
+ * @param max_levels Maximum number of levels (including the input graph, should be positive).
+ * @param outbound_attraction_distribution See force_atlas2.
+ * @param lin_log_mode See force_atlas2.
+ * @param edge_weight_influence See force_atlas2.
+ * @param jitter_tolerance See force_atlas2.
+ * @param barnes_hut_theta See force_atlas2.
+ * @param scaling_ratio See force_atlas2.
+ * @param strong_gravity_mode See force_atlas2.
+ * @param gravity See force_atlas2.
+ * @param verbose See force_atlas2.
+ * @param half_precision_quadtree See force_atlas2.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void multilevel_force_atlas2(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  float* x_pos,
+  float* y_pos,
+  size_t coarse_max_iter                = 500,
+  size_t refine_max_iter                = 50,
+  size_t max_levels                     = 10,
+  bool outbound_attraction_distribution = true,
+  bool lin_log_mode                     = false,
+  float edge_weight_influence           = 1.0,
+  float jitter_tolerance                = 1.0,
+  float barnes_hut_theta                = 0.5,
+  float scaling_ratio                   = 2.0,
+  bool strong_gravity_mode              = false,
+  float gravity                         = 1.0,
+  bool verbose                          = false,
+  bool half_precision_quadtree          = false,
+  bool do_expensive_check               = false);
+
 /**
  * @brief     Compute betweenness centrality for a graph
  *
@@ -291,6 +430,131 @@ void edge_betweenness_centrality(const raft::handle_t& handle,
                                  vertex_t k               = 0,
                                  vertex_t const* vertices = nullptr);
 
+/**
+ * @brief Compute betweenness centrality from the given sources.
+ *
+ * Brandes' algorithm runs for several sources at once: the breadth-first searches from a batch of
+ * sources share the frontier expansions (one pass over the outgoing edges of the frontier vertices
+ * per level serves every source in the batch) and so do the (reverse level order) dependency
+ * accumulation passes. With k sources out of n vertices, the accumulated dependencies are scaled
+ * by n / k (this gives the exact betweenness centrality if every vertex is a source once). Edge
+ * weights are ignored (shortest paths are the paths with the fewest edges).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of betweenness centrality scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Pointer to the source vertices (local to this process in multi-GPU), the sources
+ * of every process are used.
+ * @param n_sources Number of the source vertices (local to this process in multi-GPU).
+ * @param betweennesses Pointer to the output betweenness centrality score array (for the vertices
+ * local to this process in multi-GPU).
+ * @param normalized If true, the scores are divided by (n - 1)(n - 2). If false, the scores of
+ * symmetric graphs are divided by 2 (each undirected path is counted from both of its end points).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* sources,
+  size_t n_sources,
+  result_t* betweennesses,
+  bool normalized         = true,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Approximate betweenness centrality with adaptively sampled sources.
+ *
+ * Sources are sampled uniformly at random (with replacement) and processed as in the
+ * betweenness_centrality above. Sampling stops once, with the probability of at least 1 - @p delta,
+ * the estimate of every vertex's betweenness centrality divided by n(n - 2) is within @p epsilon of
+ * the exact value (checked with empirical Bernstein bounds as the number of samples doubles), and
+ * at the latest once the (non-adaptive) Hoeffding bound guarantees this.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of betweenness centrality scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param betweennesses Pointer to the output betweenness centrality score array (for the vertices
+ * local to this process in multi-GPU).
+ * @param epsilon Additive error tolerance (in (0.0, 1.0)) of the estimates divided by n(n - 2).
+ * @param delta Failure probability (in (0.0, 1.0)).
+ * @param seed Seed for the random source sampling (should be identical in every process in
+ * multi-GPU).
+ * @param normalized If true, the scores are divided by (n - 1)(n - 2). If false, the scores of
+ * symmetric graphs are divided by 2.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return size_t Number of the sampled sources.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+size_t approximate_betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  result_t* betweennesses,
+  result_t epsilon,
+  result_t delta,
+  uint64_t seed,
+  bool normalized         = true,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute (estimate) closeness and harmonic centralities.
+ *
+ * Runs breadth-first searches from @p num_pivots vertices sampled uniformly at random (without
+ * replacement; every vertex if @p num_pivots is no smaller than the number of vertices) in batches
+ * of 64 sources (see bfs_batch) and extrapolates each vertex's distances from the sampled pivots
+ * to all the vertices. Distances are measured from the pivots to the vertex (i.e. incoming
+ * distances on directed graphs). The harmonic centrality of a vertex v is the sum of 1 / d(u, v)
+ * over the vertices u != v normalized by (n - 1), and the closeness centrality is Wasserman and
+ * Faust's generalization for disconnected graphs, (r - 1)^2 / ((n - 1) * (sum of d(u, v) over the
+ * r - 1 vertices u != v reaching v)) (0 if no other vertex reaches v). The scores are exact if
+ * every vertex is a pivot.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of centrality scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (edge weights are ignored).
+ * @param num_pivots Number of the BFS pivots (should be positive).
+ * @param seed Seed for the pivot sampling (should be identical in every process in multi-GPU).
+ * @param closenesses Optional pointer to the output closeness centrality score array (for the
+ * vertices local to this process in multi-GPU).
+ * @param harmonic_centralities Optional pointer to the output harmonic centrality score array (for
+ * the vertices local to this process in multi-GPU). At least one of @p closenesses and @p
+ * harmonic_centralities should be provided.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void closeness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t num_pivots,
+  uint64_t seed,
+  std::optional<result_t*> closenesses,
+  std::optional<result_t*> harmonic_centralities,
+  bool do_expensive_check = false);
+
 enum class cugraph_cc_t {
   CUGRAPH_WEAK = 0,  ///> Weakly Connected Components
   CUGRAPH_STRONG,    ///> Strongly Connected Components
@@ -470,10 +734,10 @@ std::unique_ptr<legacy::GraphCOO<VT, ET, WT>> get_two_hop_neighbors(
  *
  * @throws     cugraph::logic_error with a custom message when an error occurs.
  *
- * @tparam VT                        Type of vertex identifiers. Supported value : int (signed,
- * 32-bit)
- * @tparam ET                        Type of edge identifiers.  Supported value : int (signed,
- * 32-bit)
+ * @tparam VT                        Type of vertex identifiers. Supported values : int32_t,
+ * int64_t
+ * @tparam ET                        Type of edge identifiers.  Supported values : int32_t,
+ * int64_t (same as VT)
  * @tparam WT                        Type of edge weights. Supported values : float or double.
  *
  * @param[in] graph                  cuGraph graph descriptor, should contain the connectivity
@@ -681,6 +945,72 @@ louvain(raft::handle_t const& handle,
         size_t max_level                              = 100,
         typename graph_view_t::weight_type resolution = typename graph_view_t::weight_type{1});
 
+/**
+ * @brief      Louvain implementation, returning dendrogram, with periodic checkpointing
+ *
+ * Runs Louvain (see above) and checkpoints the dendrogram levels (i.e. the current clusters), the
+ * modularity, and the coarsened graph every @p checkpoint_params.interval levels (see
+ * checkpoint_params_t). If @p checkpoint_params.resume is set and a checkpoint exists, Louvain
+ * resumes from the checkpointed level, and the checkpointed levels count towards @p max_level.
+ *
+ * @throws     cugraph::logic_error when an error occurs (including inconsistent checkpoint files).
+ *
+ * @tparam     graph_view_t          Type of graph
+ *
+ * @param[in]  handle                Library handle (RAFT)
+ * @param[in]  graph_view            Input graph view object (CSR)
+ * @param[in]  checkpoint_params     Checkpoint file path prefix, interval (in levels), and whether
+ *                                   to resume from the last checkpoint.
+ * @param[in]  max_level             (optional) maximum number of levels to run (default 100)
+ * @param[in]  resolution            (optional) The value of the resolution parameter to use.
+ *                                   (default 1)
+ *
+ * @return                           a pair containing:
+ *                                     1) unique pointer to dendrogram
+ *                                     2) modularity of the returned clustering
+ *
+ */
+template <typename graph_view_t>
+std::pair<std::unique_ptr<Dendrogram<typename graph_view_t::vertex_type>>,
+          typename graph_view_t::weight_type>
+louvain(raft::handle_t const& handle,
+        graph_view_t const& graph_view,
+        checkpoint_params_t const& checkpoint_params,
+        size_t max_level                              = 100,
+        typename graph_view_t::weight_type resolution = typename graph_view_t::weight_type{1});
+
+/**
+ * @brief      Louvain implementation for multiple resolutions, returning dendrograms
+ *
+ * Runs Louvain (see above) once per resolution. The setup that does not depend on the resolution
+ * (the total edge weight and the first level's vertex and cluster weights) is computed once and
+ * shared by every run, which makes a resolution sweep cheaper than calling louvain once per
+ * resolution.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam     graph_view_t          Type of graph
+ *
+ * @param[in]  handle                Library handle (RAFT)
+ * @param[in]  graph_view            Input graph view object (CSR)
+ * @param[in]  resolutions           The values of the resolution parameter to run Louvain with.
+ * @param[in]  max_level             (optional) maximum number of levels to run (default 100)
+ *
+ * @return                           a vector (one element per resolution, in the order of
+ *                                   @p resolutions) of pairs containing:
+ *                                     1) unique pointer to dendrogram
+ *                                     2) modularity of the returned clustering
+ *
+ */
+template <typename graph_view_t>
+std::vector<std::pair<std::unique_ptr<Dendrogram<typename graph_view_t::vertex_type>>,
+                      typename graph_view_t::weight_type>>
+louvain_multi_resolution(
+  raft::handle_t const& handle,
+  graph_view_t const& graph_view,
+  std::vector<typename graph_view_t::weight_type> const& resolutions,
+  size_t max_level = 100);
+
 /**
  * @brief      Flatten a Dendrogram at a particular level
  *
@@ -705,6 +1035,33 @@ void flatten_dendrogram(raft::handle_t const& handle,
                         Dendrogram<typename graph_view_t::vertex_type> const& dendrogram,
                         typename graph_view_t::vertex_type* clustering);
 
+/**
+ * @brief      Flatten a Dendrogram at every level at once
+ *
+ * This function stores the clustering at each level of the hierarchical clustering (the
+ * clustering at the last level is identical to the output of flatten_dendrogram). All the levels
+ * are flattened in a single pass over the dendrogram, which is much cheaper than calling
+ * flatten_dendrogram for each level (in single-GPU, the level maps are composed by a single
+ * gather chain).
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam     graph_view_t          Type of graph
+ *
+ * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  graph                 input graph object
+ * @param[in]  dendrogram            input dendrogram object
+ * @param[out] level_clusterings     Pointer to device array (size = dendrogram.num_levels() * #
+ * local vertices) where the clusterings should be stored, the clustering after level l + 1 is
+ * stored in [l * # local vertices, (l + 1) * # local vertices)
+ *
+ */
+template <typename graph_view_t>
+void flatten_dendrogram_levels(raft::handle_t const& handle,
+                               graph_view_t const& graph_view,
+                               Dendrogram<typename graph_view_t::vertex_type> const& dendrogram,
+                               typename graph_view_t::vertex_type* level_clusterings);
+
 /**
  * @brief      Leiden implementation
  *
@@ -746,6 +1103,74 @@ std::pair<size_t, weight_t> leiden(raft::handle_t const& handle,
                                    size_t max_iter     = 100,
                                    weight_t resolution = weight_t{1});
 
+/**
+ * @brief      Leiden implementation
+ *
+ * Compute a clustering of the graph by maximizing modularity using the Leiden improvements
+ * to the Louvain method. Every level refines the clustering from the Louvain local moving phase
+ * (vertices restart from singleton clusters and move only within their Louvain clusters) before
+ * aggregating the graph.
+ *
+ * Computed using the Leiden method described in:
+ *
+ *    Traag, V. A., Waltman, L., & van Eck, N. J. (2019). From Louvain to Leiden:
+ *    guaranteeing well-connected communities. Scientific reports, 9(1), 5233.
+ *    doi: 10.1038/s41598-019-41695-z
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam     graph_view_t          Type of graph
+ *
+ * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  graph_view            input graph view object (CSR)
+ * @param[out] clustering            Pointer to device array where the clustering should be stored
+ * @param[in]  max_level             (optional) maximum number of levels to run (default 100)
+ * @param[in]  resolution            (optional) The value of the resolution parameter to use.
+ *                                   Called gamma in the modularity formula, this changes the size
+ *                                   of the communities.  Higher resolutions lead to more smaller
+ *                                   communities, lower resolutions lead to fewer larger
+ *                                   communities. (default 1)
+ *
+ * @return                           a pair containing:
+ *                                     1) number of levels of the returned clustering
+ *                                     2) modularity of the returned clustering
+ */
+template <typename graph_view_t>
+std::pair<size_t, typename graph_view_t::weight_type> leiden(
+  raft::handle_t const& handle,
+  graph_view_t const& graph_view,
+  typename graph_view_t::vertex_type* clustering,
+  size_t max_level                              = 100,
+  typename graph_view_t::weight_type resolution = typename graph_view_t::weight_type{1});
+
+/**
+ * @brief      Leiden implementation, returning dendrogram
+ *
+ * Compute a clustering of the graph by maximizing modularity using the Leiden improvements
+ * to the Louvain method (see above).
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam     graph_view_t          Type of graph
+ *
+ * @param[in]  handle                Library handle (RAFT)
+ * @param[in]  graph_view            Input graph view object (CSR)
+ * @param[in]  max_level             (optional) maximum number of levels to run (default 100)
+ * @param[in]  resolution            (optional) The value of the resolution parameter to use.
+ *                                   (default 1)
+ *
+ * @return                           a pair containing:
+ *                                     1) unique pointer to dendrogram
+ *                                     2) modularity of the returned clustering
+ */
+template <typename graph_view_t>
+std::pair<std::unique_ptr<Dendrogram<typename graph_view_t::vertex_type>>,
+          typename graph_view_t::weight_type>
+leiden(raft::handle_t const& handle,
+       graph_view_t const& graph_view,
+       size_t max_level                              = 100,
+       typename graph_view_t::weight_type resolution = typename graph_view_t::weight_type{1});
+
 /**
  * @brief Computes the ecg clustering of the given graph.
  *
@@ -778,6 +1203,33 @@ void ecg(raft::handle_t const& handle,
          vertex_t ensemble_size,
          vertex_t* clustering);
 
+/**
+ * @brief Computes the ecg clustering of the given graph.
+ *
+ * ECG runs truncated (single-level) Louvain on an ensemble of random vertex orderings of the input
+ * graph, then uses the ensemble partitions to determine weights for the input graph. The final
+ * result is found by running full Louvain on the input graph using the determined weights. See
+ * https://arxiv.org/abs/1809.05578 for further information. Every ensemble member runs on the
+ * input graph (no graph is created per member).
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam     graph_view_t          Type of graph
+ *
+ * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
+ * the multi-GPU version will be selected.
+ * @param[in]  graph_view            input graph view object (CSR), expected to be symmetric
+ * @param[in]  min_weight            The minimum weight parameter (in [0, 1])
+ * @param[in]  ensemble_size         The ensemble size parameter
+ * @param[out] clustering            Pointer to device array where the clustering should be stored
+ */
+template <typename graph_view_t>
+void ecg(raft::handle_t const& handle,
+         graph_view_t const& graph_view,
+         typename graph_view_t::weight_type min_weight,
+         typename graph_view_t::vertex_type ensemble_size,
+         typename graph_view_t::vertex_type* clustering);
+
 /**
  * @brief Generate edges in a minimum spanning forest of an undirected weighted graph.
  *
@@ -1083,39 +1535,125 @@ weight_t hungarian(raft::handle_t const& handle,
                    vertex_t* assignments,
                    weight_t epsilon);
 
-}  // namespace dense
+/**
+ * @brief      Compute Hungarian algorithm on a batch of dense cost matrices
+ *
+ * Solves @p num_problems independent assignment problems of the same shape.  The cost matrices
+ * are stored back to back (each in row major order) in one device array, and the problems are
+ * solved together, so the per-call overhead of hungarian() is paid once per batch rather than
+ * once per problem.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t                  Type of vertex identifiers. Supported value : int (signed,
+ * 32-bit)
+ * @tparam weight_t                  Type of edge weights. Supported values : float or double.
+ *
+ * @param[in]  handle                Library handle (RAFT).
+ * @param[in]  costs                 pointer to array of num_problems * num_rows * num_cols costs,
+ *                                   problem b starting at offset b * num_rows * num_cols
+ * @param[in]  num_problems          number of cost matrices in the batch
+ * @param[in]  num_rows              number of rows in each dense matrix
+ * @param[in]  num_cols              number of cols in each dense matrix
+ * @param[out] assignments           device pointer to an array of num_problems * num_rows
+ *                                   entries, problem b's assignment starting at offset
+ *                                   b * num_rows (laid out as in hungarian())
+ * @param[out] objective_values      device pointer to an array of num_problems entries to which
+ *                                   the minimum cost of each problem will be written, or nullptr
+ *                                   to skip computing them
+ */
+template <typename vertex_t, typename weight_t>
+void hungarian_batch(raft::handle_t const& handle,
+                     weight_t const* costs,
+                     vertex_t num_problems,
+                     vertex_t num_rows,
+                     vertex_t num_columns,
+                     vertex_t* assignments,
+                     weight_t* objective_values);
 
 /**
- * @brief Run breadth-first search to find the distances (and predecessors) from the source
- * vertex.
+ * @brief      Compute Hungarian algorithm on a batch of dense cost matrices
  *
- * This function computes the distances (minimum number of hops to reach the vertex) from the source
- * vertex. If @p predecessors is not `nullptr`, this function calculates the predecessor of each
- * vertex (parent vertex in the breadth-first search tree) as well.
+ * Solves @p num_problems independent assignment problems of the same shape.  The cost matrices
+ * are stored back to back (each in row major order) in one device array, and the problems are
+ * solved together, so the per-call overhead of hungarian() is paid once per batch rather than
+ * once per problem.
  *
- * @throws cugraph::logic_error on erroneous input arguments.
+ * @throws     cugraph::logic_error when an error occurs.
  *
- * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
- * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
- * @tparam weight_t Type of edge weights. Needs to be a floating point type.
- * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
- * or multi-GPU (true).
- * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
- * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Graph view object.
- * @param distances Pointer to the output distance array.
+ * @tparam vertex_t                  Type of vertex identifiers. Supported value : int (signed,
+ * 32-bit)
+ * @tparam weight_t                  Type of edge weights. Supported values : float or double.
+ *
+ * @param[in]  handle                Library handle (RAFT).
+ * @param[in]  costs                 pointer to array of num_problems * num_rows * num_cols costs,
+ *                                   problem b starting at offset b * num_rows * num_cols
+ * @param[in]  num_problems          number of cost matrices in the batch
+ * @param[in]  num_rows              number of rows in each dense matrix
+ * @param[in]  num_cols              number of cols in each dense matrix
+ * @param[out] assignments           device pointer to an array of num_problems * num_rows
+ *                                   entries, problem b's assignment starting at offset
+ *                                   b * num_rows (laid out as in hungarian())
+ * @param[out] objective_values      device pointer to an array of num_problems entries to which
+ *                                   the minimum cost of each problem will be written, or nullptr
+ *                                   to skip computing them
+ * @param[in]  epsilon               parameter to define precision of comparisons
+ *                                   in reducing weights to zero.
+ */
+template <typename vertex_t, typename weight_t>
+void hungarian_batch(raft::handle_t const& handle,
+                     weight_t const* costs,
+                     vertex_t num_problems,
+                     vertex_t num_rows,
+                     vertex_t num_columns,
+                     vertex_t* assignments,
+                     weight_t* objective_values,
+                     weight_t epsilon);
+
+}  // namespace dense
+
+/*
+ * Stream contract of bfs, bfs_batch, sssp, and sssp_batch: the outputs are computed on
+ * handle.get_stream(), and these functions do not synchronize the stream before returning (their
+ * temporary buffers are freed in the stream order). Synchronize the stream (or keep enqueuing work
+ * on it) before reading the outputs on the host. Independent queries on the same graph view can
+ * run concurrently (e.g. from multiple host threads) on the streams of light handles
+ * (raft::handle_t(handle, i)).
+ */
+
+/**
+ * @brief Run breadth-first search to find the distances (and predecessors) from the source
+ * vertex.
+ *
+ * This function computes the distances (minimum number of hops to reach the vertex) from the source
+ * vertex. If @p predecessors is not `nullptr`, this function calculates the predecessor of each
+ * vertex (parent vertex in the breadth-first search tree) as well.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param distances Pointer to the output distance array.
  * @param predecessors Pointer to the output predecessor array or `nullptr`.
  * @param sources Source vertices to start breadth-first search (root vertex of the breath-first
  * search tree). If more than one source is passed, there must be a single source per component.
  * In a multi-gpu context the source vertices should be local to this GPU.
  * @param n_sources number of sources (one source per component at most).
  * @param direction_optimizing If set to true, this algorithm switches between the push based
- * breadth-first search and pull based breadth-first search depending on the size of the
- * breadth-first search frontier (currently unsupported). This option is valid only for symmetric
- * input graphs.
+ * breadth-first search and pull based breadth-first search depending on the number of edges
+ * incident to the breadth-first search frontier and the number of edges incident to the unvisited
+ * vertices. This option is valid only for symmetric input graphs.
  * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
  * farther than @p depth_limit hops from @p source_vertex will be marked as unreachable.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param compress_frontier_shuffle In multi-GPU, compress the vertex IDs exchanged in the push
+ * based frontier expansion (see shuffle_sorted_vertices). Every process should pass the same value.
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 void bfs(raft::handle_t const& handle,
@@ -1123,10 +1661,282 @@ void bfs(raft::handle_t const& handle,
          vertex_t* distances,
          vertex_t* predecessors,
          vertex_t const* sources,
-         size_t n_sources          = 1,
-         bool direction_optimizing = false,
-         vertex_t depth_limit      = std::numeric_limits<vertex_t>::max(),
-         bool do_expensive_check   = false);
+         size_t n_sources               = 1,
+         bool direction_optimizing      = false,
+         vertex_t depth_limit           = std::numeric_limits<vertex_t>::max(),
+         bool do_expensive_check        = false,
+         bool compress_frontier_shuffle = false);
+
+/**
+ * @brief Run breadth-first search from a batch of source vertices at once.
+ *
+ * This function computes the distances (minimum number of hops to reach the vertex) from each of
+ * the source vertices. The searches share every frontier expansion; each vertex carries a bit mask
+ * of the searches it is in the frontier of, so a vertex reached by several searches at the same
+ * depth is expanded once. Predecessors are not computed.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param distances Pointer to the output distance array of size (the aggregate number of sources
+ * across all the GPUs) * graph_view.get_number_of_local_vertices(). Distances from the i'th source
+ * are stored in [i * graph_view.get_number_of_local_vertices(), (i + 1) *
+ * graph_view.get_number_of_local_vertices()). In a multi-gpu context, sources are ordered by GPU
+ * rank first and then by the position in @p sources.
+ * @param sources Source vertices to start breadth-first search. In a multi-gpu context the source
+ * vertices should be local to this GPU.
+ * @param n_sources Number of (local) sources. The aggregate number of sources across all the GPUs
+ * should be in [1, 64].
+ * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
+ * farther than @p depth_limit hops from a source will be marked as unreachable from that source.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void bfs_batch(raft::handle_t const& handle,
+               graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+               vertex_t* distances,
+               vertex_t const* sources,
+               size_t n_sources,
+               vertex_t depth_limit    = std::numeric_limits<vertex_t>::max(),
+               bool do_expensive_check = false);
+
+/**
+ * @brief Compute the eccentricities of the given vertices.
+ *
+ * The eccentricity of a vertex is the maximum distance (number of hops) from the vertex to the
+ * vertices reachable from the vertex (the vertices unreachable from the vertex are ignored). This
+ * runs breadth-first searches (bfs_batch) from up to 64 vertices at a time.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param vertices Vertices to compute the eccentricities of. In a multi-gpu context the vertices
+ * should be local to this GPU.
+ * @param n_vertices Number of (local) vertices.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return rmm::device_uvector<vertex_t> The eccentricities of @p vertices (in the same order).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* vertices,
+  size_t n_vertices,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute lower and upper bounds on the diameter of an undirected graph.
+ *
+ * This computes the bounds on the diameter (the maximum eccentricity) of the connected component
+ * of @p start_vertex. The lower bound comes from a double sweep (breadth-first searches from
+ * @p start_vertex and then from the farthest vertex found), and the iFUB algorithm (breadth-first
+ * searches from the vertices farthest from the midpoint of the double sweep path, in batches of up
+ * to 64) narrows the bounds until they meet or @p max_traversals breadth-first searches have run.
+ * The bounds typically meet after a few dozen searches on real-world graphs.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object. Should be symmetric.
+ * @param start_vertex Vertex to start the double sweep from (should be identical in every GPU in a
+ * multi-gpu context). If std::nullopt, the maximum degree vertex is used (this usually lies in the
+ * largest connected component).
+ * @param max_traversals Maximum number of breadth-first searches (should be at least 4).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<vertex_t, vertex_t> The lower and upper bounds on the diameter (they are equal
+ * if the diameter is found within @p max_traversals breadth-first searches).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<vertex_t, vertex_t> approximate_diameter(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  std::optional<vertex_t> start_vertex = std::nullopt,
+  size_t max_traversals                = 100,
+  bool do_expensive_check              = false);
+
+/**
+ * @brief Compute a topological ordering of a directed graph.
+ *
+ * This assigns every vertex to a level with the level-synchronous variant of Kahn's algorithm
+ * (vertices without in-edges are in level 0, and a vertex is in level i + 1 if its in-neighbors
+ * with the largest level are in level i). Sorting the vertices by the levels gives a topological
+ * order. This runs in O(V + E) work with one frontier step per level. Vertices on (or reachable
+ * from) a cycle are never assigned to a level.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param levels Pointer to the output level array (size =
+ * graph_view.get_number_of_local_vertices()). Vertices not assigned to a level get invalid_vertex_id<vertex_t>::value.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<vertex_t, bool> The number of levels and a flag indicating whether the graph
+ * is acyclic (every vertex is assigned to a level).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<vertex_t, bool> topological_sort(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* levels,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute single-source shortest (or longest) paths in a directed acyclic graph.
+ *
+ * This relaxes the out-edges of the vertices in a topological order (computed on the fly with the
+ * same level-synchronous Kahn's algorithm as topological_sort), so every edge is relaxed once and
+ * edge weights may be negative. Unweighted graphs use the weight 1 for every edge (the longest
+ * path then counts the edges).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if the graph has a cycle.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object. Should be acyclic.
+ * @param distances Pointer to the output distance array (size =
+ * graph_view.get_number_of_local_vertices()). Vertices unreachable from @p source_vertex get
+ * std::numeric_limits<weight_t>::max().
+ * @param predecessors Pointer to the output predecessor array or `nullptr`.
+ * @param source_vertex Source vertex to start the paths from.
+ * @param longest Compute the longest paths (if set to `true`) instead of the shortest paths.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void dag_shortest_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  weight_t* distances,
+  vertex_t* predecessors,
+  vertex_t source_vertex,
+  bool longest            = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Run breadth-first search on the edges in a time window.
+ *
+ * This computes the hop distances from @p source_vertex using only the edges with the time stamps
+ * in [@p window_first, @p window_last). The frontier vertices visit only their edges in the window
+ * (found by binary searches in the time sorted neighbor lists of @p edge_times), so queries on
+ * different (e.g. sliding) windows share one graph and one time stamp index.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam timestamp_t Type of edge time stamps. Needs to be an arithmetic type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_times Edge time stamps of @p graph_view (see temporal_edge_properties_t).
+ * @param distances Pointer to the output distance array (size =
+ * graph_view.get_number_of_local_vertices()). Unreached vertices get
+ * std::numeric_limits<vertex_t>::max().
+ * @param predecessors Pointer to the output predecessor array or `nullptr`.
+ * @param source_vertex Source vertex to start the search from.
+ * @param window_first Start (inclusive) of the time window.
+ * @param window_last End (exclusive) of the time window.
+ * @param depth_limit Sets the maximum number of breadth-first search iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename timestamp_t,
+          bool multi_gpu>
+void temporal_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>,
+                             timestamp_t> const& edge_times,
+  vertex_t* distances,
+  vertex_t* predecessors,
+  vertex_t source_vertex,
+  timestamp_t window_first,
+  timestamp_t window_last,
+  vertex_t depth_limit    = std::numeric_limits<vertex_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute the earliest arrival times of time-respecting paths.
+ *
+ * A time-respecting path departs from @p source_vertex at @p departure_time and traverses edges
+ * in non-decreasing time stamp order (an edge can be traversed if its time stamp is no earlier
+ * than the arrival time at its source and earlier than @p window_last; the arrival time at its
+ * destination is its time stamp). The frontier vertices visit only the edges with the time stamps
+ * in [arrival time, @p window_last) by binary searches in the time sorted neighbor lists of
+ * @p edge_times.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam timestamp_t Type of edge time stamps. Needs to be an arithmetic type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_times Edge time stamps of @p graph_view (see temporal_edge_properties_t).
+ * @param arrival_times Pointer to the output arrival time array (size =
+ * graph_view.get_number_of_local_vertices()). Unreachable vertices get
+ * std::numeric_limits<timestamp_t>::max().
+ * @param predecessors Pointer to the output predecessor array or `nullptr`.
+ * @param source_vertex Source vertex to depart from.
+ * @param departure_time Departure time at @p source_vertex.
+ * @param window_last End (exclusive) of the time window.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename timestamp_t,
+          bool multi_gpu>
+void earliest_arrival_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>,
+                             timestamp_t> const& edge_times,
+  timestamp_t* arrival_times,
+  vertex_t* predecessors,
+  vertex_t source_vertex,
+  timestamp_t departure_time,
+  timestamp_t window_last = std::numeric_limits<timestamp_t>::max(),
+  bool do_expensive_check = false);
 
 /**
  * @brief Extract paths from breadth-first search output
@@ -1166,6 +1976,43 @@ std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extract_bfs_paths(
   vertex_t const* destinations,
   size_t n_destinations);
 
+/**
+ * @brief Extract paths from breadth-first search output in a compressed (CSR like) format
+ *
+ * This function extracts the same paths as extract_bfs_paths, but the paths are stored back to
+ * back (without padding to the longest path), so the output size is the total path length.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param distances Pointer to the distance array constructed by bfs.
+ * @param predecessors Pointer to the predecessor array constructed by bfs.
+ * @param destinations Destination vertices, extract path from source to each of these destinations
+ * In a multi-gpu context the destination vertex should be local to this GPU.
+ * @param n_destinations number of destinations (one source per component at most).
+ *
+ * @return std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>> pair containing
+ *       the path offsets (size = @p n_destinations + 1) and the path vertices. The path to the i'th
+ *       destination (from the source to the destination) is stored in [offsets[i], offsets[i +
+ *       1]), the path is empty if the destination is unreachable.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>>
+extract_bfs_paths_compressed(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* distances,
+  vertex_t const* predecessors,
+  vertex_t const* destinations,
+  size_t n_destinations);
+
 /**
  * @brief Run single-source shortest-path to compute the minimum distances (and predecessors) from
  * the source vertex.
@@ -1201,6 +2048,106 @@ void sssp(raft::handle_t const& handle,
           weight_t cutoff         = std::numeric_limits<weight_t>::max(),
           bool do_expensive_check = false);
 
+/**
+ * @brief Run shortest-path from multiple sources to compute the minimum distances (and
+ * predecessors) from each of the source vertices.
+ *
+ * This function computes the distances (minimum edge weight sums) from each of the source vertices.
+ * The sources are processed in groups of four sharing every delta-stepping bucket; each vertex
+ * carries the tentative distances of the group's sources, so a vertex is expanded once per bucket
+ * for all the sources of the group. If @p targets is not `nullptr`, each search stops once the
+ * distances to the targets are final, the distances (and predecessors) of the targets are exact
+ * but the other vertices' distances may be over-estimates (or unreachable). Graph edge weights
+ * should be non-negative.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param distances Pointer to the output distance array of size (the aggregate number of sources
+ * across all the GPUs) * graph_view.get_number_of_local_vertices(). Distances from the i'th source
+ * are stored in [i * graph_view.get_number_of_local_vertices(), (i + 1) *
+ * graph_view.get_number_of_local_vertices()). In a multi-gpu context, sources are ordered by GPU
+ * rank first and then by the position in @p sources.
+ * @param predecessors Pointer to the output predecessor array (of the same size and layout as @p
+ * distances) or `nullptr`.
+ * @param sources Source vertices to start shortest-path. In a multi-gpu context the source vertices
+ * should be local to this GPU.
+ * @param n_sources Number of (local) sources. The aggregate number of sources across all the GPUs
+ * should be at least 1.
+ * @param targets Target vertices (shared by every source) to terminate the searches early or
+ * `nullptr` (compute the distances to every vertex). In a multi-gpu context the target vertices
+ * should be local to this GPU.
+ * @param n_targets Number of (local) targets.
+ * @param cutoff Shortest-path terminates if no more vertices are reachable within the distance of
+ * @p cutoff. Any vertex farther than @p cutoff will be marked as unreachable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sssp_batch(raft::handle_t const& handle,
+                graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                weight_t* distances,
+                vertex_t* predecessors,
+                vertex_t const* sources,
+                size_t n_sources,
+                vertex_t const* targets = nullptr,
+                size_t n_targets        = 0,
+                weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+                bool do_expensive_check = false);
+
+/**
+ * @brief Find the vertices within k hops of the seed vertices of each query.
+ *
+ * This function expands the frontier of each query (the vertices tagged with the query index) k
+ * times; the queries share every frontier expansion. Unlike running bfs with a depth limit, the
+ * cost is proportional to the out-edges of the reached vertices (and not to the number of vertices
+ * in the graph).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param seeds Pointer to the seed vertices of the queries. In a multi-gpu context the seed
+ * vertices should be local to this GPU.
+ * @param seed_query_indices Pointer to the query indices (in [0, @p n_queries)) of the seeds.
+ * @param n_seeds Number of (local) seeds.
+ * @param n_queries Number of queries (should be the same in every GPU in a multi-gpu context).
+ * @param k Maximum number of hops from the seeds.
+ * @param hop_limits Optional per-hop limits (size = @p k) on the number of vertices newly reached
+ * (across all the GPUs) by a query in each hop. The vertices with the smaller IDs (and in a
+ * multi-gpu context, on the lower ranks) are kept; the dropped vertices are not expanded.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<vertex_t>> Tuple of the query offsets (size = @p n_queries + 1), the reached
+ * vertices, and their hop counts (0 for the seeds). The (local, in a multi-gpu context) vertices
+ * reached by the i'th query are stored in [offsets[i], offsets[i + 1]) sorted by vertex ID.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>>
+k_hop_nbrs(raft::handle_t const& handle,
+           graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+           vertex_t const* seeds,
+           size_t const* seed_query_indices,
+           size_t n_seeds,
+           size_t n_queries,
+           size_t k,
+           std::optional<std::vector<size_t>> const& hop_limits = std::nullopt,
+           bool do_expensive_check                              = false);
+
 /**
  * @brief Compute PageRank scores.
  *
@@ -1241,6 +2188,21 @@ void sssp(raft::handle_t const& handle,
  * pageranks) is used as initial PageRank values. If false, initial PageRank values are set to 1.0
  * divided by the number of vertices in the graph.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param iteration_capture_interval If positive, single-GPU PageRank without personalization
+ * captures one iteration into a CUDA graph, replays it, and tests the convergence (a host
+ * synchronization) only every @p iteration_capture_interval iterations, so up to @p
+ * iteration_capture_interval - 1 iterations may run past the convergence. This cuts the kernel
+ * launch overhead dominating the iterations on small and medium graphs. The iterations are captured
+ * only if handle.get_stream() is not the legacy default stream and the graph edges are in device
+ * memory without split hubs (see graph_t::set_edge_memory_placement and
+ * graph_t::enable_hub_splitting). 0 (the default) disables the capture.
+ * @param mixed_precision If set to `true` and @p result_t is double, the SpMV inputs (the row
+ * properties, and in multi-GPU the values exchanged to fill them) are stored in float, while the
+ * SpMV accumulates in double and the PageRank values stay in double. Once the changes between two
+ * iterations shrink to the float rounding error (or stop decreasing), the remaining iterations run
+ * with double SpMV inputs, so the results converge to the same tolerance while most iterations
+ * read and exchange half the bytes. This has no effect on float results. Every process should pass
+ * the same value.
  */
 template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
 void pagerank(raft::handle_t const& handle,
@@ -1252,43 +2214,326 @@ void pagerank(raft::handle_t const& handle,
               result_t* pageranks,
               result_t alpha,
               result_t epsilon,
-              size_t max_iterations   = 500,
-              bool has_initial_guess  = false,
-              bool do_expensive_check = false);
+              size_t max_iterations             = 500,
+              bool has_initial_guess            = false,
+              bool do_expensive_check           = false,
+              size_t iteration_capture_interval = 0,
+              bool mixed_precision              = false);
 
 /**
- * @brief Compute HITS scores.
+ * @brief Compute PageRank scores with periodic checkpointing.
  *
- * This function computes HITS scores for the vertices of a graph
+ * This function computes the same scores as the pagerank() above, and in addition checkpoints the
+ * PageRank values and the iteration count every @p checkpoint_params.interval iterations (see
+ * checkpoint_params_t). If @p checkpoint_params.resume is set and a checkpoint exists, the
+ * iterations restart from the checkpointed PageRank values (@p has_initial_guess and the values in
+ * @p pageranks are ignored), and the checkpointed iterations count towards @p max_iterations. A
+ * checkpoint is also written (if due) right before failing at @p max_iterations, so a run can be
+ * resumed with a larger @p max_iterations.
  *
- * @throws cugraph::logic_error on erroneous input arguments
+ * @throws cugraph::logic_error on erroneous input arguments, on inconsistent checkpoint files, or
+ * if fails to converge before @p max_iterations.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph_view Graph view object.
- * @param hubs Pointer to the input/output hub score array.
- * @param authorities Pointer to the output authorities score array.
- * @param epsilon Error tolerance to check convergence. Convergence is assumed if the sum of the
- * differences in hub values between two consecutive iterations is less than @p epsilon
- * @param max_iterations Maximum number of HITS iterations.
- * @param has_initial_guess If set to `true`, values in the hubs output array (pointed by @p
- * hubs) is used as initial hub values. If false, initial hub values are set to 1.0
- * divided by the number of vertices in the graph.
- * @param normalize If set to `true`, final hub and authority scores are normalized (the L1-norm of
- * the returned hub and authority score arrays is 1.0) before returning.
- * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
- * @return std::tuple<weight_t, size_t> A tuple of sum of the differences of hub scores of the last
- * two iterations and the total number of iterations taken to reach the final result
- */
-template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-std::tuple<weight_t, size_t> hits(
-  raft::handle_t const& handle,
-  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+ * @param precomputed_vertex_out_weight_sums Pointer to an array storing sums of out-going edge
+ * weights for the vertices (for re-use) or `std::nullopt`.
+ * @param personalization_vertices Pointer to an array storing personalization vertex identifiers
+ * (compute personalized PageRank) or `std::nullopt` (compute general PageRank).
+ * @param personalization_values Pointer to an array storing personalization values for the vertices
+ * in the personalization set. Relevant only if @p personalization_vertices is not `std::nullopt`.
+ * @param personalization_vector_size Size of the personalization set.
+ * @param pageranks Pointer to the output PageRank score array.
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence.
+ * @param checkpoint_params Checkpoint file path prefix, interval (in iterations), and whether to
+ * resume from the last checkpoint.
+ * @param max_iterations Maximum number of PageRank iterations.
+ * @param has_initial_guess If set to `true`, values in the PageRank output array (pointed by @p
+ * pageranks) is used as initial PageRank values (unless resumed from a checkpoint).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void pagerank(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+              std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+              std::optional<vertex_t const*> personalization_vertices,
+              std::optional<result_t const*> personalization_values,
+              std::optional<vertex_t> personalization_vector_size,
+              result_t* pageranks,
+              result_t alpha,
+              result_t epsilon,
+              checkpoint_params_t const& checkpoint_params,
+              size_t max_iterations   = 500,
+              bool has_initial_guess  = false,
+              bool do_expensive_check = false);
+
+/**
+ * @brief Compute personalized PageRank scores for a batch of personalization vectors.
+ *
+ * This function computes the same scores as calling pagerank() once per personalization vector but
+ * a pass over the edges serves multiple personalization vectors, and the personalization vectors
+ * that have converged drop out of the remaining iterations.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param precomputed_vertex_out_weight_sums Pointer to an array storing sums of out-going edge
+ * weights for the vertices (for re-use) or `std::nullopt`. If `std::nullopt`, these values are
+ * freshly computed.
+ * @param personalization_offsets Pointer to an array of size @p num_personalization_vectors + 1;
+ * the personalization set of the i'th personalization vector is stored in [@p
+ * personalization_offsets[i], @p personalization_offsets[i + 1]) of @p personalization_vertices
+ * and @p personalization_values (in multi-GPU, each GPU stores the part of the personalization
+ * sets local to this GPU). Vertices should be unique within a personalization set.
+ * @param personalization_vertices Pointer to an array storing the personalization vertex
+ * identifiers of the personalization vectors.
+ * @param personalization_values Pointer to an array storing the personalization values for the
+ * vertices in @p personalization_vertices.
+ * @param num_personalization_vectors Number of personalization vectors.
+ * @param pageranks Pointer to the output PageRank score array. The scores of the i'th
+ * personalization vector are stored in [i * V, (i + 1) * V) where V is the number of (local in
+ * multi-GPU) vertices.
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence (per personalization vector).
+ * @param max_iterations Maximum number of PageRank iterations.
+ * @param has_initial_guess If set to `true`, values in the PageRank output array (pointed by @p
+ * pageranks) is used as initial PageRank values. If false, initial PageRank values are set to 1.0
+ * divided by the number of vertices in the graph.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void personalized_pagerank_batch(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  size_t const* personalization_offsets,
+  vertex_t const* personalization_vertices,
+  result_t const* personalization_values,
+  size_t num_personalization_vectors,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations   = 500,
+  bool has_initial_guess  = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute approximate personalized PageRank scores by forward push.
+ *
+ * This function computes personalized PageRank scores by pushing residual values (starting from the
+ * personalization values) to the out-going neighbors (Andersen, Chung, and Lang's forward push).
+ * Only the vertices with residuals larger than @p epsilon times their out-going edge weight sums
+ * push, so the amount of work follows the neighborhood of the personalization vertices reached
+ * instead of the graph size. On return, every vertex's residual is no larger than @p epsilon times
+ * its out-going edge weight sum, the returned scores under-estimate the personalized PageRank
+ * scores (as computed by pagerank()), and the sum of the differences is the sum of the remaining
+ * residuals.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (the push model, i.e. not transposed).
+ * @param precomputed_vertex_out_weight_sums Pointer to an array storing sums of out-going edge
+ * weights for the vertices (for re-use) or `std::nullopt`. If `std::nullopt`, these values are
+ * freshly computed.
+ * @param personalization_vertices Pointer to an array storing the personalization vertex
+ * identifiers (in multi-GPU, the personalization vertices local to this GPU). Vertices should be
+ * unique.
+ * @param personalization_values Pointer to an array storing personalization values for the
+ * vertices in the personalization set.
+ * @param personalization_vector_size Size of the personalization set (local to this GPU in
+ * multi-GPU).
+ * @param pageranks Pointer to the output PageRank score array.
+ * @param alpha PageRank damping factor (should be smaller than 1.0).
+ * @param epsilon Residual threshold (per unit out-going edge weight) to stop pushing.
+ * @param max_iterations Maximum number of push iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void approximate_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  vertex_t const* personalization_vertices,
+  result_t const* personalization_values,
+  vertex_t personalization_vector_size,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations   = std::numeric_limits<size_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @brief Estimate the top-k personalized PageRank scores of source vertices by Monte Carlo random
+ * walks with restart.
+ *
+ * @p num_walks_per_source walks start from every source. At each step, a walk continues with
+ * probability @p alpha to a uniform random out-neighbor (or back to the source if the current
+ * vertex has no out-edges) and stops (restarts) otherwise. If v is visited c times by the walks
+ * from s, (1 - @p alpha) * c / @p num_walks_per_source estimates the personalized PageRank score of
+ * v with the personalization set {s} (as computed by pagerank() for the unweighted graph). The
+ * walks are not materialized; the visits are accumulated per (source, vertex) pair on device, so
+ * the memory footprint follows the set of the visited pairs instead of the total walk length.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (the push model, i.e. not transposed). Edge weights are
+ * ignored.
+ * @param sources Pointer to the source vertices (should be local to this GPU in multi-GPU).
+ * @param num_sources Number of the source vertices.
+ * @param num_walks_per_source Number of the walks from each source (should be positive); the
+ * standard error of an estimate decreases as 1 / sqrt(@p num_walks_per_source).
+ * @param k Maximum number of the vertices returned per source (should be positive).
+ * @param alpha PageRank damping factor (the probability to continue a walk, should be in [0.0,
+ * 1.0)).
+ * @param max_walk_length Maximum number of the vertices (including the source) visited by a walk;
+ * truncating the walks under-estimates the scores by at most @p alpha^@p max_walk_length in total.
+ * @param rng_seed Seed for the walks (the same seed returns the same estimates for the same graph
+ * and GPU configuration).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<result_t>> Tuple of the sources, the visited vertices, and the estimated
+ * personalized PageRank scores. Pairs are grouped by source (in the source order) and are sorted
+ * in descending score order (ties are broken by vertex ID) within a group.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<result_t>>
+monte_carlo_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* sources,
+  size_t num_sources,
+  size_t num_walks_per_source,
+  size_t k,
+  result_t alpha,
+  size_t max_walk_length  = std::numeric_limits<size_t>::max(),
+  uint64_t rng_seed       = 0,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Update PageRank scores after edge insertions, deletions, or weight changes.
+ *
+ * This function starts from the PageRank scores of the graph before the changes and pushes the
+ * corrections (residuals) only from the vertices whose residuals exceed @p epsilon divided by the
+ * number of vertices, starting from the neighborhoods of the sources of the changed edges. The
+ * amount of work follows the part of the graph affected by the changes instead of the graph size.
+ * Only the uniform teleport (non-personalized) PageRank is supported.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph after the changes (the push model, i.e. not
+ * transposed).
+ * @param precomputed_vertex_out_weight_sums Pointer to an array storing sums of out-going edge
+ * weights (of the graph after the changes) for the vertices (for re-use) or `std::nullopt`. If
+ * `std::nullopt`, these values are freshly computed.
+ * @param changed_edge_srcs Pointer to an array storing the source vertex identifiers of the changed
+ * edges (in multi-GPU, the changed edges can be provided to any GPU).
+ * @param changed_edge_dsts Pointer to an array storing the destination vertex identifiers of the
+ * changed edges.
+ * @param changed_edge_weight_deltas Pointer to an array storing the edge weight changes (the new
+ * weight minus the old weight, e.g. the edge weight for an inserted edge and the negated edge
+ * weight for a deleted edge; 1.0 and -1.0 for unweighted graphs).
+ * @param num_changed_edges Number of the changed edges (local to this GPU in multi-GPU).
+ * @param pageranks Pointer to the PageRank score array, should store the PageRank scores of the
+ * graph before the changes on input and stores the updated scores on return.
+ * @param alpha PageRank damping factor (should be smaller than 1.0).
+ * @param epsilon Error tolerance; the push stops when every residual is no larger than @p epsilon
+ * divided by the number of vertices.
+ * @param max_iterations Maximum number of push iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  vertex_t const* changed_edge_srcs,
+  vertex_t const* changed_edge_dsts,
+  weight_t const* changed_edge_weight_deltas,
+  edge_t num_changed_edges,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations   = std::numeric_limits<size_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute HITS scores.
+ *
+ * This function computes HITS scores for the vertices of a graph
+ *
+ * @throws cugraph::logic_error on erroneous input arguments
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param hubs Pointer to the input/output hub score array.
+ * @param authorities Pointer to the output authorities score array.
+ * @param epsilon Error tolerance to check convergence. Convergence is assumed if the sum of the
+ * differences in hub values between two consecutive iterations is less than @p epsilon
+ * @param max_iterations Maximum number of HITS iterations.
+ * @param has_initial_guess If set to `true`, values in the hubs output array (pointed by @p
+ * hubs) is used as initial hub values. If false, initial hub values are set to 1.0
+ * divided by the number of vertices in the graph.
+ * @param normalize If set to `true`, final hub and authority scores are normalized (the L1-norm of
+ * the returned hub and authority score arrays is 1.0) before returning.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<weight_t, size_t> A tuple of sum of the differences of hub scores of the last
+ * two iterations and the total number of iterations taken to reach the final result
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<weight_t, size_t> hits(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
   weight_t* hubs,
   weight_t* authorities,
   weight_t epsilon,
@@ -1298,56 +2543,865 @@ std::tuple<weight_t, size_t> hits(
   bool do_expensive_check);
 
 /**
- * @brief Compute Katz Centrality scores.
+ * @brief Compute personalized HITS scores for several seed vectors in a batch.
+ *
+ * This function computes the hub and authority scores for several seed (personalization) vectors
+ * at once. The authorities are pulled from the hubs and the hubs are pushed back from the
+ * authorities over the single (transposed) graph, and each pass over the edges serves up to four
+ * seed vectors. The hubs start from the (L1 normalized) seed values and, in each iteration, the
+ * new (L1 normalized) hubs are mixed with the seed values with the weight @p teleport_probability
+ * (plain HITS started from the seed values if @p teleport_probability is 0.0). Seed vectors stop
+ * iterating once converged.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param seed_offsets Pointer to an array (of size @p num_seed_vectors + 1, in device memory)
+ * storing the offsets of the seed vectors in @p seed_vertices and @p seed_values.
+ * @param seed_vertices Pointer to an array storing the seed vertex identifiers of every seed vector
+ * (in multi-GPU, the seed vertices local to this GPU). Vertices should be unique in each vector.
+ * @param seed_values Pointer to an array storing the (non-negative) seed values.
+ * @param num_seed_vectors Number of seed vectors.
+ * @param hubs Pointer to the output hub score array (column-major, a column per seed vector with
+ * the number of local vertices as the leading dimension).
+ * @param authorities Pointer to the output authority score array (in the same layout as @p hubs).
+ * @param teleport_probability Weight of the seed values in the hub updates (should be in [0.0,
+ * 1.0]).
+ * @param epsilon Error tolerance to check convergence. Convergence is assumed if the sum of the
+ * differences in hub values between two consecutive iterations is less than @p epsilon
+ * @param max_iterations Maximum number of HITS iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<std::vector<weight_t>, std::vector<size_t>> A tuple of the per seed vector
+ * sums of the differences of hub scores of the last two iterations and the per seed vector numbers
+ * of iterations taken to reach the final results. The hub and authority scores of every seed
+ * vector are L1 normalized.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<std::vector<weight_t>, std::vector<size_t>> personalized_hits_batch(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  size_t const* seed_offsets,
+  vertex_t const* seed_vertices,
+  weight_t const* seed_values,
+  size_t num_seed_vectors,
+  weight_t* hubs,
+  weight_t* authorities,
+  weight_t teleport_probability,
+  weight_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute Katz Centrality scores.
+ *
+ * This function computes Katz Centrality scores.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of Katz Centrality scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param betas Pointer to an array holding the values to be added to each vertex's new Katz
+ * Centrality score in every iteration or `nullptr`. If set to `nullptr`, constant @p beta is used
+ * instead.
+ * @param katz_centralities Pointer to the output Katz Centrality score array.
+ * @param alpha Katz Centrality attenuation factor. This should be smaller than the inverse of the
+ * maximum eigenvalue of the adjacency matrix of @p graph.
+ * @param beta Constant value to be added to each vertex's new Katz Centrality score in every
+ * iteration. Relevant only when @p betas is `nullptr`.
+ * @param epsilon Error tolerance to check convergence. Convergence is assuemd if the sum of the
+ * differences in Katz Centrality values between two consecutive iterations is less than the number
+ * of vertices in the graph multiplied by @p epsilon.
+ * @param max_iterations Maximum number of Katz Centrality iterations.
+ * @param has_initial_guess If set to `true`, values in the Katz Centrality output array (pointed by
+ * @p katz_centralities) is used as initial Katz Centrality values. If false, zeros are used as
+ * initial Katz Centrality values.
+ * @param normalize If set to `true`, final Katz Centrality scores are normalized (the L2-norm of
+ * the returned Katz Centrality score array is 1.0) before returning.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param iteration_capture_interval If positive, single-GPU Katz Centrality captures one iteration
+ * into a CUDA graph and tests the convergence only every @p iteration_capture_interval iterations
+ * (see pagerank). 0 (the default) disables the capture.
+ * @param mixed_precision If set to `true` and @p result_t is double, run the iterations with float
+ * SpMV inputs until the changes shrink to the float rounding error (see pagerank).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void katz_centrality(raft::handle_t const& handle,
+                     graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+                     result_t const* betas,
+                     result_t* katz_centralities,
+                     result_t alpha,
+                     result_t beta,
+                     result_t epsilon,
+                     size_t max_iterations             = 500,
+                     bool has_initial_guess            = false,
+                     bool normalize                    = false,
+                     bool do_expensive_check           = false,
+                     size_t iteration_capture_interval = 0,
+                     bool mixed_precision              = false);
+
+/**
+ * @brief Compute Katz Centrality scores updating only the vertices that have not converged yet.
+ *
+ * This function computes Katz Centrality scores like katz_centrality(), but each iteration updates
+ * only the active vertices (by iterating over their incoming edges only). A vertex drops out of
+ * the active set once its score changes by less than @p epsilon. Once no vertex is active, an
+ * iteration over every vertex re-activates the vertices whose scores still change by @p epsilon or
+ * more; the iteration converges if none does. Unlike katz_centrality(), this function does not
+ * throw if the iteration fails to converge before @p max_iterations and returns the partial results
+ * instead.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of Katz Centrality scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param betas Pointer to an array holding the values to be added to each vertex's new Katz
+ * Centrality score in every iteration or `nullptr`. If set to `nullptr`, constant @p beta is used
+ * instead.
+ * @param katz_centralities Pointer to the output Katz Centrality score array.
+ * @param alpha Katz Centrality attenuation factor. This should be smaller than the inverse of the
+ * maximum eigenvalue of the adjacency matrix of @p graph.
+ * @param beta Constant value to be added to each vertex's new Katz Centrality score in every
+ * iteration. Relevant only when @p betas is `nullptr`.
+ * @param epsilon Per-vertex error tolerance (should be positive); a vertex is converged if its
+ * score changes by less than @p epsilon between two consecutive updates.
+ * @param max_iterations Maximum number of Katz Centrality iterations.
+ * @param has_initial_guess If set to `true`, values in the Katz Centrality output array (pointed by
+ * @p katz_centralities) is used as initial Katz Centrality values. If false, zeros are used as
+ * initial Katz Centrality values.
+ * @param normalize If set to `true`, final Katz Centrality scores are normalized (the L2-norm of
+ * the returned Katz Centrality score array is 1.0) before returning.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<result_t, size_t> A tuple of the residual (the L1 norm of the differences
+ * between the scores and the scores after one more iteration, before normalization) and the total
+ * number of iterations taken. If converged, the residual is the sum of the changes in the last
+ * iteration over every vertex.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<result_t, size_t> adaptive_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  result_t const* betas,
+  result_t* katz_centralities,
+  result_t alpha,
+  result_t beta,
+  result_t epsilon,
+  size_t max_iterations   = 500,
+  bool has_initial_guess  = false,
+  bool normalize          = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute Katz Centrality scores for multiple attenuation factors at once.
+ *
+ * This function computes the Katz Centrality scores of katz_centrality() for every attenuation
+ * factor in @p alphas. The iterations for the different attenuation factors share the passes over
+ * the edges (several score vectors are updated per pass) and each vector stops iterating once it
+ * converges.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of Katz Centrality scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param betas Pointer to an array holding the values to be added to each vertex's new Katz
+ * Centrality score in every iteration (shared by every attenuation factor) or `nullptr`. If set to
+ * `nullptr`, constant @p beta is used instead.
+ * @param katz_centralities Pointer to the output Katz Centrality scores (column-major, # local
+ * vertices by @p alphas.size(), column i holds the scores for @p alphas[i]).
+ * @param alphas Katz Centrality attenuation factors. These should be smaller than the inverse of
+ * the maximum eigenvalue of the adjacency matrix of @p graph.
+ * @param beta Constant value to be added to each vertex's new Katz Centrality score in every
+ * iteration. Relevant only when @p betas is `nullptr`.
+ * @param epsilon Error tolerance to check convergence. A score vector is converged if the sum of
+ * the differences in its values between two consecutive iterations is less than @p epsilon.
+ * @param max_iterations Maximum number of Katz Centrality iterations.
+ * @param has_initial_guess If set to `true`, values in the Katz Centrality output array (pointed by
+ * @p katz_centralities) is used as initial Katz Centrality values. If false, zeros are used as
+ * initial Katz Centrality values.
+ * @param normalize If set to `true`, final Katz Centrality scores are normalized (the L2-norm of
+ * every returned score vector is 1.0) before returning.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::vector<size_t> The number of iterations taken for each attenuation factor.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::vector<size_t> katz_centrality_batch(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  result_t const* betas,
+  result_t* katz_centralities,
+  std::vector<result_t> const& alphas,
+  result_t beta,
+  result_t epsilon,
+  size_t max_iterations   = 500,
+  bool has_initial_guess  = false,
+  bool normalize          = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute Eigenvector Centrality scores.
+ *
+ * This function computes the eigenvector of the adjacency matrix for the largest eigenvalue (the
+ * score of a vertex is proportional to the sum of the scores of its in-neighbors, weighted by the
+ * edge weights) by power iteration. The iteration runs on the adjacency matrix shifted by the
+ * identity matrix (to converge on bipartite graphs as well) and is periodically accelerated with
+ * Aitken's delta-squared extrapolation.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of Eigenvector Centrality scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param centralities Pointer to the output Eigenvector Centrality score array (the L2-norm of
+ * the returned scores is 1.0).
+ * @param epsilon Error tolerance to check convergence. Convergence is assumed if the sum of the
+ * differences in the scores between two consecutive iterations is less than the number of vertices
+ * in the graph multiplied by @p epsilon.
+ * @param max_iterations Maximum number of Eigenvector Centrality iterations.
+ * @param has_initial_guess If set to `true`, values in the output array (pointed by
+ * @p centralities) are used as initial values (should be non-negative with a positive sum). If
+ * false, 1.0 / (# vertices) is used as the initial value of every vertex.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void eigenvector_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  result_t* centralities,
+  result_t epsilon,
+  size_t max_iterations   = 500,
+  bool has_initial_guess  = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief returns induced EgoNet subgraph(s) of neighbors centered at nodes in source_vertex within
+ * a given radius.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms. Must have at least one worker stream.
+ * @param graph_view Graph view object of, we extract induced egonet subgraphs from @p graph_view.
+ * @param source_vertex Pointer to egonet center vertices (size == @p n_subgraphs).
+ * @param n_subgraphs Number of induced EgoNet subgraphs to extract (ie. number of elements in @p
+ * source_vertex). In a multi-gpu context, this can be 0 on some GPUs but the aggregate number
+ * across all the GPUs should be positive.
+ * @param radius  Include all neighbors of distance <= radius from @p source_vertex.
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<weight_t>, rmm::device_uvector<size_t>> Quadraplet of edge source vertices,
+ * edge destination vertices, edge weights, and edge offsets for each induced EgoNet subgraph. In a
+ * multi-gpu context, the source vertices need not be local and each GPU gets the EgoNet subgraphs
+ * of its own @p source_vertex (in the same order); the ego vertices of all the GPUs are searched
+ * together by a batched breadth-first search before a single induced subgraph extraction.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>>
+extract_ego(raft::handle_t const& handle,
+            graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+            vertex_t* source_vertex,
+            vertex_t n_subgraphs,
+            vertex_t radius);
+
+/**
+ * @brief returns random walks (RW) from starting sources, where each path is of given maximum
+ * length. Uniform distribution is assumed for the random engine.
+ *
+ * In the multi-GPU case, each GPU provides its own set of starting vertices (which can be any of
+ * the graph's vertices) and receives the paths starting from them.
+ *
+ * @tparam graph_t Type of graph/view (typically, graph_view_t).
+ * @tparam index_t Type used to store indexing and sizes.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph Graph (view )object to generate RW on.
+ * @param ptr_d_start Device pointer to set of starting vertex indices for the RW.
+ * @param num_paths = number(paths).
+ * @param max_depth maximum length of RWs.
+ * @param use_padding (optional) specifies if return uses padded format (true), or coalesced
+ * (compressed) format; when padding is used the output is a matrix of vertex paths and a matrix of
+ * edges paths (weights); in this case the matrices are stored in row major order; the vertex path
+ * matrix is padded with `num_vertices` values and the weight matrix is padded with `0` values;
+ * @param sampling_strategy pointer for sampling strategy: uniform, biased, etc.; possible
+ * values{0==uniform, 1==biased, 2==node2vec}; defaults to nullptr == uniform; setting
+ * `use_alias_tables_` pre-computes per-vertex alias tables (biased and node2vec only), for O(1)
+ * neighbor selection at each step; `rng_type_` selects the random engine: rng_type_t::PHILOX
+ * evaluates a counter-based generator on the fly, instead of pre-generating the random values of
+ * all the steps in device memory;
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>,
+ * rmm::device_uvector<index_t>> Triplet of either padded or coalesced RW paths; in the coalesced
+ * case (default), the return consists of corresponding vertex and edge weights for each, and
+ * corresponding path sizes. This is meant to minimize the number of DF's to be passed to the Python
+ * layer. The meaning of "coalesced" here is that a 2D array of paths of different sizes is
+ * represented as a 1D contiguous array. In the padded case the return is a matrix of num_paths x
+ * max_depth vertex paths; and num_paths x (max_depth-1) edge (weight) paths, with an empty array of
+ * sizes. Note: if the graph is un-weighted the edge (weight) paths consists of `weight_t{1}`
+ * entries;
+ */
+template <typename graph_t, typename index_t>
+std::tuple<rmm::device_uvector<typename graph_t::vertex_type>,
+           rmm::device_uvector<typename graph_t::weight_type>,
+           rmm::device_uvector<index_t>>
+random_walks(raft::handle_t const& handle,
+             graph_t const& graph,
+             typename graph_t::vertex_type const* ptr_d_start,
+             index_t num_paths,
+             index_t max_depth,
+             bool use_padding                                     = false,
+             std::unique_ptr<sampling_params_t> sampling_strategy = nullptr);
+
+/**
+ * @brief Operator consuming a batch of random walks (see `random_walks_batched()`): invoked with
+ * the index of the 1st path in the batch, the (padded or coalesced) vertex paths, weight paths and
+ * path sizes of the batch, and the stream the batch is ready on.
+ */
+template <typename vertex_t, typename weight_t, typename index_t>
+using random_walks_batch_op_t = std::function<void(index_t,
+                                                   rmm::device_uvector<vertex_t>&&,
+                                                   rmm::device_uvector<weight_t>&&,
+                                                   rmm::device_uvector<index_t>&&,
+                                                   rmm::cuda_stream_view)>;
+
+/**
+ * @brief generates random walks (RW) from starting sources, where each path is of given maximum
+ * length, in batches of (at most) `max_paths_per_batch` paths, each of which is handed over to
+ * `batch_op` as soon as it is done.
+ *
+ * Same as `random_walks()`, except that the GPU memory footprint is bounded by the batch size
+ * rather than by `num_paths`, and that the selector state (cached out-degrees, sums of weights,
+ * alias tables, local out-adjacency in the multi-GPU case) is set up once for all the batches.
+ *
+ * @tparam graph_t Type of graph/view (typically, graph_view_t).
+ * @tparam index_t Type used to store indexing and sizes.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph Graph (view )object to generate RW on.
+ * @param ptr_d_start Device pointer to set of starting vertex indices for the RW.
+ * @param num_paths = number(paths).
+ * @param max_depth maximum length of RWs.
+ * @param use_padding specifies if each batch uses padded format (true), or coalesced format (see
+ * `random_walks()`).
+ * @param sampling_strategy pointer for sampling strategy (see `random_walks()`).
+ * @param max_paths_per_batch maximum number of paths per batch (in the multi-GPU case, per GPU).
+ * @param batch_op Operator invoked (in order) on each batch, which takes ownership of the batch's
+ * device buffers; the 1st path in the batch comes from `ptr_d_start[path_first]`, where
+ * `path_first` is the 1st argument of `batch_op`.
+ * @param overlap_output If true (and `handle` has internal streams), the batches are handed over
+ * on an internal stream, so that the work `batch_op` enqueues there (e.g. device-to-host copies)
+ * overlaps with generating the next batch; the buffers of a batch should then be released once
+ * consumed, to keep the memory footprint bounded.
+ */
+template <typename graph_t, typename index_t>
+void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_t const& graph,
+  typename graph_t::vertex_type const* ptr_d_start,
+  index_t num_paths,
+  index_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  index_t max_paths_per_batch,
+  random_walks_batch_op_t<typename graph_t::vertex_type, typename graph_t::weight_type, index_t>
+    batch_op,
+  bool overlap_output = false);
+
+/**
+ * @brief Sample multi-hop neighborhoods of the seed vertices (e.g. for GNN mini-batch training).
+ *
+ * In each hop, (up to) fanouts[hop] out-neighbors of every frontier vertex are sampled without
+ * replacement, uniformly or (if @p weighted is true) with probability proportional to edge
+ * weights. A frontier vertex with fewer out-edges returns all of them. The first frontier is the
+ * seed set and the next frontier is the set of the destinations sampled in the current hop; the
+ * frontiers are de-duplicated, so a vertex reached from multiple sources in a hop is sampled once
+ * in the next hop.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object to sample from.
+ * @param seeds Pointer to the array of the seed vertex IDs (local to this GPU in multi-GPU).
+ * @param num_seeds Number of seeds in @p seeds.
+ * @param fanouts Maximum number of neighbors to sample per frontier vertex in each hop (the
+ * number of hops is fanouts.size()).
+ * @param weighted Flag to sample proportional to edge weights (requires a weighted graph).
+ * @param rng_seed Seed for the sampling (the same seed returns the same sample for the same
+ * graph and GPU configuration).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::vector<std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>>
+ * Sources and destinations (COO) of the edges sampled in each hop (a sampled edge is returned on
+ * the GPU storing the edge in multi-GPU).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::vector<std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>>
+sample_neighbors(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 vertex_t const* seeds,
+                 size_t num_seeds,
+                 std::vector<size_t> const& fanouts,
+                 bool weighted           = false,
+                 uint64_t rng_seed       = 0,
+                 bool do_expensive_check = false);
+
+enum class subgraph_sampler_t { node = 0, edge, random_walk };
+
+/**
+ * @brief Sample a batch of (vertex induced) subgraphs (e.g. for GNN mini-batch training).
+ *
+ * The vertex set of each subgraph is drawn by @p sampler: subgraph_sampler_t::node draws
+ * vertices uniformly (with replacement), subgraph_sampler_t::edge draws edges uniformly (with
+ * replacement) and takes both endpoints, and subgraph_sampler_t::random_walk takes the vertices of
+ * uniform random walks from uniformly drawn roots. Duplicate vertices are dropped (so a subgraph
+ * can have fewer vertices than drawn), and each subgraph is the subgraph induced by its vertex set
+ * (see `extract_induced_subgraphs()`). The vertex sets of all the subgraphs are drawn and their
+ * edges are extracted together, and the subgraphs are returned as one concatenated CSR (with
+ * subgraph local vertex IDs).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object to sample from.
+ * @param sampler Sampler to draw the vertex sets of the subgraphs.
+ * @param num_subgraphs Number of subgraphs to sample (on this GPU, if multi-GPU).
+ * @param sample_size Number of vertices (subgraph_sampler_t::node), edges
+ * (subgraph_sampler_t::edge), or random walk roots (subgraph_sampler_t::random_walk) to draw per
+ * subgraph.
+ * @param walk_length Maximum number of vertices (including the root) in a random walk (used only
+ * by subgraph_sampler_t::random_walk).
+ * @param rng_seed Seed for the node and edge draws and the random walk roots (the random walks
+ * themselves are seeded by `random_walks()`).
+ * @return std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>,
+ * std::optional<rmm::device_uvector<weight_t>>> Subgraph vertex offsets (size == @p
+ * num_subgraphs + 1), subgraph vertices (the IDs in @p graph_view, sorted within each subgraph;
+ * the local ID of a vertex is its position in its subgraph's range), and the CSR offsets (size ==
+ * #subgraph vertices + 1, over the concatenated subgraph vertices), indices (subgraph local vertex
+ * IDs), and weights (if @p graph_view is weighted) of the subgraphs. The edges of subgraph i are
+ * in [offsets[vertex offsets[i]], offsets[vertex offsets[i + 1]]).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+sample_subgraphs(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 subgraph_sampler_t sampler,
+                 size_t num_subgraphs,
+                 size_t sample_size,
+                 size_t walk_length = 2,
+                 uint64_t rng_seed  = 0);
+
+/**
+ * @brief Finds (weakly-connected-)component IDs of each vertices in the input graph.
+ *
+ * The input graph must be symmetric. Component IDs can be arbitrary integers (they can be
+ * non-consecutive and are not ordered by component size or any other criterion).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param components Pointer to the output component ID array.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* components,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Finds (weakly-connected-)component IDs of each vertices in the input graph, with periodic
+ * checkpointing.
+ *
+ * This function finds the same components as the weakly_connected_components() above and
+ * checkpoints the component IDs found so far (and the graph of the next level of the recursive
+ * frontier expansion) every @p checkpoint_params.interval levels (see checkpoint_params_t). If @p
+ * checkpoint_params.resume is set and a checkpoint exists, the expansion resumes from the
+ * checkpointed level. The component IDs of a resumed run can differ from the IDs of an
+ * uninterrupted run, but the components are the same.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param components Pointer to the output component ID array.
+ * @param checkpoint_params Checkpoint file path prefix, interval (in levels), and whether to resume
+ * from the last checkpoint.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* components,
+  checkpoint_params_t const& checkpoint_params,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Updates (weakly-connected-)component IDs after inserting a batch of new edges.
+ *
+ * Only the new edges and the components they touch are processed (with a union-find over the
+ * affected component IDs), so this is much cheaper than recomputing the components from scratch
+ * when the batch is small. Components merged by the new edges take the smallest of their previous
+ * component IDs; the IDs of the other components are unchanged. Edge deletions are not supported.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (used for the vertex partitioning; the new edges need not
+ * be inserted yet).
+ * @param new_edge_srcs Pointer to the new edge source vertex IDs (the new edges can be stored in
+ * any process in multi-GPU; a single direction per undirected edge suffices).
+ * @param new_edge_dsts Pointer to the new edge destination vertex IDs.
+ * @param num_new_edges Number of the new edges (in this process in multi-GPU).
+ * @param components Pointer to the input/output component ID array. The input should hold the
+ * component IDs before the insertion (e.g. computed by weakly_connected_components).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* new_edge_srcs,
+  vertex_t const* new_edge_dsts,
+  edge_t num_new_edges,
+  vertex_t* components,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Finds strongly-connected-component IDs of each vertices in the input graph.
+ *
+ * Single vertex components are trimmed first, and the remaining vertices are processed with
+ * forward (coloring) and backward frontier expansions; in-edges are traversed using the reversed
+ * graph cached in @p graph_view (see graph_t::add_reversed_graph) if available; otherwise, an
+ * unweighted reversed copy of the graph is created internally (and released on return). Component
+ * IDs are vertex IDs of the component members (they can be non-consecutive and are not ordered by
+ * component size or any other criterion). If the input graph is symmetric, this returns the weakly
+ * connected components.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param components Pointer to the output component ID array.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void strongly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* components,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Find a maximal independent set of an undirected graph.
+ *
+ * This runs Luby's algorithm with random (hash based) vertex priorities: in every round, the
+ * candidate vertices with a higher priority than all their candidate neighbors are selected and
+ * their neighbors are removed from the candidate set.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object. Should be symmetric.
+ * @param seed Seed for the vertex priorities (different seeds result in different sets).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return rmm::device_uvector<vertex_t> The (local) vertices in the maximal independent set.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> maximal_independent_set(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  uint64_t seed           = 0,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Color the vertices of an undirected graph (no two neighbors share a color).
+ *
+ * This runs the Jones-Plassmann algorithm: in every round, the uncolored vertices with a higher
+ * (hash based) priority than all their uncolored neighbors take the smallest color not used by
+ * their neighbors. Self-loops are ignored.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object. Should be symmetric.
+ * @param colors Pointer to the output color array (colors are in [0, number of colors)).
+ * @param seed Seed for the vertex priorities.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return vertex_t Number of colors used.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+vertex_t vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* colors,
+  uint64_t seed           = 0,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute a minimum spanning forest of an undirected weighted graph.
+ *
+ * This runs Boruvka's algorithm (every round each tree picks its minimum weight incident edge and
+ * the trees connected by the picked edges are contracted). Ties in edge weights are broken by the
+ * endpoint IDs, so the returned forest is unique. Unlike the legacy minimum_spanning_tree, this
+ * function supports multi-GPU and 64 bit vertex IDs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph (should be symmetric and weighted).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<weight_t>> Tuple of the forest edge sources, destinations, and weights. Each
+ * forest edge appears once (source < destination) and, in multi-GPU, in only one process.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+minimum_spanning_forest(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute a minimum cost assignment of workers to jobs on a sparse bipartite graph.
+ *
+ * This runs a forward auction with epsilon-scaling directly on the worker -> job edges (edges from
+ * the vertices in @p workers to the vertices not in @p workers) of the graph; the edge weights are
+ * the assignment costs. Unlike the graph overloads of hungarian, the cost matrix is not densified,
+ * so memory is linear in the number of edges, and multi-GPU is supported. The assignment is
+ * epsilon-optimal for the final epsilon (optimal for integer weights with the default final
+ * epsilon). If not every worker can be assigned, the workers outbid on every job they are
+ * connected to are left unassigned (the assignment is not guaranteed to have the maximum
+ * cardinality in that case).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if the auction does not converge
+ * in @p max_iterations rounds.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input (weighted) bipartite graph.
+ * @param workers Pointer to the array of the worker vertex IDs (local to this GPU in multi-GPU).
+ * @param num_workers Number of workers in @p workers.
+ * @param assignments Pointer to the output array (size: @p num_workers) of the job vertex ID
+ * assigned to each worker (or cugraph::invalid_vertex_id<vertex_t>::value if unassigned).
+ * @param epsilon Final epsilon (the assignment cost is within num_workers * epsilon of the
+ * optimum). If std::nullopt, 1 / (number of workers + 1) is used.
+ * @param epsilon_scaling_factor Factor (> 1) to divide epsilon by in each scaling phase (epsilon
+ * starts from the weight range / @p epsilon_scaling_factor).
+ * @param max_iterations Maximum number of bidding rounds (in all the scaling phases).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return weight_t Total cost (sum of the weights of the edges of the assigned worker-job pairs).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+weight_t auction_assignment(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* workers,
+  vertex_t num_workers,
+  vertex_t* assignments,
+  std::optional<weight_t> epsilon = std::nullopt,
+  weight_t epsilon_scaling_factor = weight_t{4.0},
+  size_t max_iterations           = std::numeric_limits<size_t>::max(),
+  bool do_expensive_check         = false);
+
+enum class k_core_degree_type_t { IN, OUT, INOUT };
+
+/**
+ * @brief   Compute core numbers of individual vertices from K-core decomposition.
+ *
+ * The input graph should not have self-loops nor multi-edges. If the input graph is directed and
+ * @p degree_type is OUT or INOUT, in-edges are traversed using the reversed graph cached in
+ * @p graph_view (see graph_t::add_reversed_graph) if available; otherwise, an unweighted reversed
+ * copy of the graph is created internally (and released on return).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param core_numbers Pointer to the output core number array.
+ * @param degree_type Dictate whether to compute the K-core decomposition based on in-degrees,
+ * out-degrees, or in-degrees + out_degrees.
+ * @param k_first Find K-cores from K = k_first. Any vertices that do not belong to k_first-core
+ * will have core numbers of 0.
+ * @param k_last Find K-cores to K = k_last. Any vertices that belong to (k_last)-core will have
+ * their core numbers set to their degrees on k_last-core.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void core_number(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 edge_t* core_numbers,
+                 k_core_degree_type_t degree_type,
+                 size_t k_first          = 0,
+                 size_t k_last           = std::numeric_limits<size_t>::max(),
+                 bool do_expensive_check = false);
+
+/**
+ * @brief   Count the triangles each vertex belongs to.
  *
- * This function computes Katz Centrality scores.
+ * The input graph should be symmetric and should not have multi-edges; self-loops are ignored.
+ * Every undirected edge is oriented from the end point with the smaller (degree, vertex ID) pair to
+ * the other end point, and every triangle is found once by intersecting the (oriented) neighbor
+ * lists of the end points of its lowest edge. In multi-GPU, the neighbor lists of the remote end
+ * points are fetched from their owners in rounds (bounding the memory footprint of a round).
  *
- * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
- * max_iterations.
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param triangle_counts Pointer to the output triangle count array (size =
+ * graph_view.get_number_of_local_vertices()).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void triangle_count(raft::handle_t const& handle,
+                    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                    edge_t* triangle_counts,
+                    bool do_expensive_check = false);
+
+/**
+ * @brief   Count the wedges, 4-cycles, and 4-cliques each vertex belongs to.
+ *
+ * The input graph should be symmetric and should not have multi-edges; self-loops are ignored. A
+ * wedge (a path of length 2) is counted at its center only. 4-cliques are enumerated on the graph
+ * oriented by (degree, vertex ID) (as in triangle_count) by intersecting the oriented neighbor
+ * lists of the third vertices with the common oriented neighbors of the end points of the lowest
+ * edges. 4-cycles are enumerated from the highest ranked vertices by grouping the wedges to the
+ * lower ranked vertices by their end points; the wedges of the local vertices are kept in memory
+ * until grouped. In multi-GPU, the neighbor lists of the remote vertices are fetched from their
+ * owners.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam weight_t Type of edge weights. Needs to be a floating point type.
- * @tparam result_t Type of Katz Centrality scores.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph_view Graph view object.
- * @param betas Pointer to an array holding the values to be added to each vertex's new Katz
- * Centrality score in every iteration or `nullptr`. If set to `nullptr`, constant @p beta is used
- * instead.
- * @param katz_centralities Pointer to the output Katz Centrality score array.
- * @param alpha Katz Centrality attenuation factor. This should be smaller than the inverse of the
- * maximum eigenvalue of the adjacency matrix of @p graph.
- * @param beta Constant value to be added to each vertex's new Katz Centrality score in every
- * iteration. Relevant only when @p betas is `nullptr`.
- * @param epsilon Error tolerance to check convergence. Convergence is assuemd if the sum of the
- * differences in Katz Centrality values between two consecutive iterations is less than the number
- * of vertices in the graph multiplied by @p epsilon.
- * @param max_iterations Maximum number of Katz Centrality iterations.
- * @param has_initial_guess If set to `true`, values in the Katz Centrality output array (pointed by
- * @p katz_centralities) is used as initial Katz Centrality values. If false, zeros are used as
- * initial Katz Centrality values.
- * @param normalize If set to `true`, final Katz Centrality scores are normalized (the L2-norm of
- * the returned Katz Centrality score array is 1.0) before returning.
+ * @param wedge_counts Optional pointer to the output wedge count array (size =
+ * graph_view.get_number_of_local_vertices()), skipped if std::nullopt.
+ * @param four_cycle_counts Optional pointer to the output 4-cycle count array (size =
+ * graph_view.get_number_of_local_vertices()), skipped if std::nullopt.
+ * @param four_clique_counts Optional pointer to the output 4-clique count array (size =
+ * graph_view.get_number_of_local_vertices()), skipped if std::nullopt.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  */
-template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
-void katz_centrality(raft::handle_t const& handle,
-                     graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
-                     result_t const* betas,
-                     result_t* katz_centralities,
-                     result_t alpha,
-                     result_t beta,
-                     result_t epsilon,
-                     size_t max_iterations   = 500,
-                     bool has_initial_guess  = false,
-                     bool normalize          = false,
-                     bool do_expensive_check = false);
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void motif_count(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 std::optional<edge_t*> wedge_counts,
+                 std::optional<edge_t*> four_cycle_counts,
+                 std::optional<edge_t*> four_clique_counts,
+                 bool do_expensive_check = false);
+
 /**
- * @brief returns induced EgoNet subgraph(s) of neighbors centered at nodes in source_vertex within
- * a given radius.
+ * @brief   Extract the K-truss subgraph of a graph.
+ *
+ * The K-truss is the maximal subgraph in which every edge belongs to at least K - 2 triangles (of
+ * the subgraph). The input graph should be symmetric and should not have multi-edges; self-loops
+ * are ignored. Edges are peeled in rounds; every round computes the triangle supports (the number
+ * of the triangles including the edge) of all the remaining edges and removes all the edges with
+ * supports smaller than K - 2 at once, until no edge is removed.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
@@ -1355,72 +3409,165 @@ void katz_centrality(raft::handle_t const& handle,
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
- * handles to various CUDA libraries) to run graph algorithms. Must have at least one worker stream.
- * @param graph_view Graph view object of, we extract induced egonet subgraphs from @p graph_view.
- * @param source_vertex Pointer to egonet center vertices (size == @p n_subgraphs).
- * @param n_subgraphs Number of induced EgoNet subgraphs to extract (ie. number of elements in @p
- * source_vertex).
- * @param radius  Include all neighbors of distance <= radius from @p source_vertex.
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param k The order of the truss (should be at least 2).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> Tuple of the
+ * sources and the destinations of the K-truss edges (both directions of every undirected edge, edge
+ * weights are not returned). In multi-GPU, both directions of an undirected edge are returned by
+ * the GPU owning the end point with the smaller (degree, vertex ID) pair.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> k_truss_subgraph(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t k,
+  bool do_expensive_check = false);
+
+/**
+ * @brief   Find communities with label propagation.
+ *
+ * Every vertex starts with its own vertex ID as its label and repeatedly adopts the label with the
+ * largest total edge weight (or the largest number of edges for unweighted graphs) among its
+ * neighbors; ties are broken in favor of the current label first and the smaller label next. The
+ * input graph should be symmetric and edge weights (if any) should be positive.
+ *
+ * In the synchronous mode, every vertex updates its label based on the labels of the previous
+ * iteration. This can oscillate (e.g. on bipartite subgraphs), so the semi-synchronous mode splits
+ * the vertices into two groups (by hashing the vertex IDs) which update their labels in turn, each
+ * group using the latest labels of the other group.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param labels Pointer to the output label array (size =
+ * graph_view.get_number_of_local_vertices()). Vertices with the same label belong to the same
+ * community.
+ * @param max_iterations The maximum number of iterations.
+ * @param changed_fraction_threshold Label propagation stops once the fraction of the vertices that
+ * changed labels in an iteration drops to (or below) this threshold (0.0 to run until no label
+ * changes).
+ * @param semi_synchronous Flag to select the semi-synchronous (true) or the synchronous (false)
+ * mode.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return size_t The number of iterations run.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* labels,
+  size_t max_iterations             = 100,
+  double changed_fraction_threshold = 0.0,
+  bool semi_synchronous             = true,
+  bool do_expensive_check           = false);
+
+/**
+ * @brief   Find the K most similar vertices of every query vertex in Jaccard similarity.
+ *
+ * The Jaccard similarity of vertices u and v is |intersection(N(u), N(v))| / |union(N(u), N(v))|
+ * (N(x) is the neighbor set of x).
+ *
+ * Candidates are the vertices within two hops of a query vertex (excluding the query vertex
+ * itself); the vertices sharing no neighbor with the query vertex have zero similarity and are
+ * never returned. The input graph should be symmetric and should not have multi-edges; self-loops
+ * are ignored (and are not counted in the degrees). Edge weights are ignored.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights (and the similarity scores). Needs to be a floating point
+ * type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param query_vertices Pointer to the query vertices (should be local to this GPU in multi-GPU).
+ * @param num_query_vertices Number of the query vertices.
+ * @param k Maximum number of the candidates returned per query vertex (should be positive).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
- * rmm::device_uvector<weight_t>, rmm::device_uvector<size_t>> Quadraplet of edge source vertices,
- * edge destination vertices, edge weights, and edge offsets for each induced EgoNet subgraph.
+ * rmm::device_uvector<weight_t>> Tuple of the query vertices, the candidate vertices, and the
+ * similarity scores. Pairs are grouped by query vertex (in the query vertex order) and are sorted
+ * in descending score order (ties are broken by candidate vertex ID) within a group.
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
-           std::optional<rmm::device_uvector<weight_t>>,
-           rmm::device_uvector<size_t>>
-extract_ego(raft::handle_t const& handle,
-            graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
-            vertex_t* source_vertex,
-            vertex_t n_subgraphs,
-            vertex_t radius);
+           rmm::device_uvector<weight_t>>
+jaccard_top_k(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+              vertex_t const* query_vertices,
+              size_t num_query_vertices,
+              size_t k,
+              bool do_expensive_check = false);
 
 /**
- * @brief returns random walks (RW) from starting sources, where each path is of given maximum
- * length. Uniform distribution is assumed for the random engine.
+ * @brief   Find the K most similar vertices of every query vertex in overlap similarity.
  *
- * @tparam graph_t Type of graph/view (typically, graph_view_t).
- * @tparam index_t Type used to store indexing and sizes.
+ * The overlap similarity of vertices u and v is |intersection(N(u), N(v))| / min(|N(u)|, |N(v)|)
+ * (N(x) is the neighbor set of x).
+ *
+ * Candidates are the vertices within two hops of a query vertex (excluding the query vertex
+ * itself); the vertices sharing no neighbor with the query vertex have zero similarity and are
+ * never returned. The input graph should be symmetric and should not have multi-edges; self-loops
+ * are ignored (and are not counted in the degrees). Edge weights are ignored.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights (and the similarity scores). Needs to be a floating point
+ * type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param graph Graph (view )object to generate RW on.
- * @param ptr_d_start Device pointer to set of starting vertex indices for the RW.
- * @param num_paths = number(paths).
- * @param max_depth maximum length of RWs.
- * @param use_padding (optional) specifies if return uses padded format (true), or coalesced
- * (compressed) format; when padding is used the output is a matrix of vertex paths and a matrix of
- * edges paths (weights); in this case the matrices are stored in row major order; the vertex path
- * matrix is padded with `num_vertices` values and the weight matrix is padded with `0` values;
- * @param sampling_strategy pointer for sampling strategy: uniform, biased, etc.; possible
- * values{0==uniform, 1==biased, 2==node2vec}; defaults to nullptr == uniform;
- * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>,
- * rmm::device_uvector<index_t>> Triplet of either padded or coalesced RW paths; in the coalesced
- * case (default), the return consists of corresponding vertex and edge weights for each, and
- * corresponding path sizes. This is meant to minimize the number of DF's to be passed to the Python
- * layer. The meaning of "coalesced" here is that a 2D array of paths of different sizes is
- * represented as a 1D contiguous array. In the padded case the return is a matrix of num_paths x
- * max_depth vertex paths; and num_paths x (max_depth-1) edge (weight) paths, with an empty array of
- * sizes. Note: if the graph is un-weighted the edge (weight) paths consists of `weight_t{1}`
- * entries;
+ * @param graph_view Graph view object.
+ * @param query_vertices Pointer to the query vertices (should be local to this GPU in multi-GPU).
+ * @param num_query_vertices Number of the query vertices.
+ * @param k Maximum number of the candidates returned per query vertex (should be positive).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<weight_t>> Tuple of the query vertices, the candidate vertices, and the
+ * similarity scores. Pairs are grouped by query vertex (in the query vertex order) and are sorted
+ * in descending score order (ties are broken by candidate vertex ID) within a group.
  */
-template <typename graph_t, typename index_t>
-std::tuple<rmm::device_uvector<typename graph_t::vertex_type>,
-           rmm::device_uvector<typename graph_t::weight_type>,
-           rmm::device_uvector<index_t>>
-random_walks(raft::handle_t const& handle,
-             graph_t const& graph,
-             typename graph_t::vertex_type const* ptr_d_start,
-             index_t num_paths,
-             index_t max_depth,
-             bool use_padding                                     = false,
-             std::unique_ptr<sampling_params_t> sampling_strategy = nullptr);
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+overlap_top_k(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+              vertex_t const* query_vertices,
+              size_t num_query_vertices,
+              size_t k,
+              bool do_expensive_check = false);
 
 /**
- * @brief Finds (weakly-connected-)component IDs of each vertices in the input graph.
+ * @brief Operator consuming a batch of 2-hop neighbor pairs (see
+ * `get_two_hop_neighbors_batched()`): invoked with the start vertices and the 2-hop neighbors of
+ * the pairs in the batch.
+ */
+template <typename vertex_t>
+using two_hop_neighbors_batch_op_t =
+  std::function<void(rmm::device_uvector<vertex_t>&&, rmm::device_uvector<vertex_t>&&)>;
+
+/**
+ * @brief   Enumerate the 2-hop neighbors of a set of start vertices in memory-bounded batches.
  *
- * The input graph must be symmetric. Component IDs can be arbitrary integers (they can be
- * non-consecutive and are not ordered by component size or any other criterion).
+ * Finds the (start vertex, v) pairs where v != start vertex is reachable from the start vertex by
+ * a path of two (outgoing) edges, and hands the pairs over to `batch_op` one batch at a time. Start
+ * vertices are processed in consecutive groups holding (in total) at most as many 2-hop paths as
+ * fit in `batch_memory_budget` (a start vertex with more paths forms a group by itself), so the
+ * peak memory for the pairs does not grow with the total number of the 2-hop pairs. Pairs are
+ * deduplicated (a pair is reported once regardless of the number of the 2-hop paths between its
+ * end points) and are reported in the start vertex order and then in the 2-hop neighbor order.
+ * Self-loops are ignored.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
@@ -1430,23 +3577,87 @@ random_walks(raft::handle_t const& handle,
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph_view Graph view object.
- * @param components Pointer to the output component ID array.
+ * @param start_vertices Pointer to the start vertices (should be local to this GPU in multi-GPU).
+ * Duplicate start vertices produce duplicate pairs.
+ * @param num_start_vertices Number of the start vertices.
+ * @param batch_memory_budget Memory budget (in bytes) for the 2-hop paths of a batch.
+ * @param batch_op Operator invoked (in order) on each batch, which takes ownership of the batch's
+ * device buffers. In multi-GPU, every GPU invokes `batch_op` the same number of times (batches can
+ * be empty).
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-void weakly_connected_components(
+void get_two_hop_neighbors_batched(
   raft::handle_t const& handle,
   graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
-  vertex_t* components,
+  vertex_t const* start_vertices,
+  size_t num_start_vertices,
+  size_t batch_memory_budget,
+  two_hop_neighbors_batch_op_t<vertex_t> batch_op,
   bool do_expensive_check = false);
 
-enum class k_core_degree_type_t { IN, OUT, INOUT };
+/**
+ * @brief Operator consuming a batch of bipartite projection edges (see
+ * `bipartite_projection_batched()`): invoked with the sources, destinations, and weights of the
+ * projected edges in the batch.
+ */
+template <typename vertex_t, typename weight_t>
+using bipartite_projection_batch_op_t = std::function<void(rmm::device_uvector<vertex_t>&&,
+                                                         rmm::device_uvector<vertex_t>&&,
+                                                         rmm::device_uvector<weight_t>&&)>;
 
 /**
- * @brief   Compute core numbers of individual vertices from K-core decomposition.
+ * @brief   Compute the (weighted) one-mode projection of a bipartite graph in memory-bounded
+ * batches.
+ *
+ * For every projection vertex a, finds the vertices b != a sharing at least one neighbor u with a
+ * (following the outgoing edges a->u->b, so the graph should be symmetric for an undirected
+ * bipartite graph) and computes the projected edge weight sum_u w(a, u) * w(u, b) (the number of
+ * the common neighbors if the graph is unweighted). The paths are enumerated per projection vertex
+ * and accumulated by (a, b) pair; the projection vertices are processed in consecutive groups
+ * holding (in total) at most as many 2-hop paths as fit in `batch_memory_budget` (a projection
+ * vertex with more paths forms a group by itself), and the projected edges of every group are
+ * handed over to `batch_op`, so the peak memory does not grow with the size of the projection.
+ * Projected edges are reported in the projection vertex order and then in the destination order
+ * (or in the descending weight order, ties broken by destination, if `k` is set). Self-loops and
+ * the edges masked out by the graph view's edge mask are ignored.
  *
- * The input graph should not have self-loops nor multi-edges. Currently, only undirected graphs are
- * supported.
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (of a bipartite graph).
+ * @param projection_vertices Pointer to the vertices to project (e.g. the item vertices of a
+ * user-item graph, should be local to this GPU in multi-GPU). Duplicate projection vertices
+ * produce duplicate edges.
+ * @param num_projection_vertices Number of the projection vertices.
+ * @param k If set, only the (up to) @p k highest weight projected edges of every projection vertex
+ * are kept.
+ * @param batch_memory_budget Memory budget (in bytes) for the 2-hop paths of a batch.
+ * @param batch_op Operator invoked (in order) on each batch, which takes ownership of the batch's
+ * device buffers. In multi-GPU, every GPU invokes `batch_op` the same number of times (batches can
+ * be empty).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void bipartite_projection_batched(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* projection_vertices,
+  size_t num_projection_vertices,
+  std::optional<size_t> k,
+  size_t batch_memory_budget,
+  bipartite_projection_batch_op_t<vertex_t, weight_t> batch_op,
+  bool do_expensive_check = false);
+
+/**
+ * @brief   Compute the (weighted) one-mode projection of a bipartite graph.
+ *
+ * Same as `bipartite_projection_batched()`, but returns the projected edges of all the batches
+ * at once.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
@@ -1455,23 +3666,117 @@ enum class k_core_degree_type_t { IN, OUT, INOUT };
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Graph view object.
- * @param core_numbers Pointer to the output core number array.
- * @param degree_type Dictate whether to compute the K-core decomposition based on in-degrees,
- * out-degrees, or in-degrees + out_degrees.
- * @param k_first Find K-cores from K = k_first. Any vertices that do not belong to k_first-core
- * will have core numbers of 0.
- * @param k_last Find K-cores to K = k_last. Any vertices that belong to (k_last)-core will have
- * their core numbers set to their degrees on k_last-core.
+ * @param graph_view Graph view object (of a bipartite graph).
+ * @param projection_vertices Pointer to the vertices to project (should be local to this GPU in
+ * multi-GPU).
+ * @param num_projection_vertices Number of the projection vertices.
+ * @param k If set, only the (up to) @p k highest weight projected edges of every projection vertex
+ * are kept.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the sources, destinations, and weights of the projected edges (the sources are
+ * the projection vertices local to this GPU).
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-void core_number(raft::handle_t const& handle,
-                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
-                 edge_t* core_numbers,
-                 k_core_degree_type_t degree_type,
-                 size_t k_first          = 0,
-                 size_t k_last           = std::numeric_limits<size_t>::max(),
-                 bool do_expensive_check = false);
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+bipartite_projection(raft::handle_t const& handle,
+                     graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                     vertex_t const* projection_vertices,
+                     size_t num_projection_vertices,
+                     std::optional<size_t> k = std::nullopt,
+                     bool do_expensive_check = false);
+
+/**
+ * @brief   Spectral balanced cut clustering.
+ *
+ * Computes the num_eigenvectors smallest eigenvectors of the normalized Laplacian
+ * I - D^(-1/2) A D^(-1/2) with a block eigensolver (LOBPCG) multiplying several vectors per pass
+ * over the edges, and clusters the vertices by k-means on the (row-normalized) spectral embedding.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of an undirected (symmetric) graph.
+ * @param num_clusters Number of the clusters.
+ * @param num_eigenvectors Number of the eigenvectors used in the spectral embedding.
+ * @param evs_tolerance Relative residual norm tolerance of the eigensolver.
+ * @param evs_max_iterations Maximum number of the eigensolver iterations.
+ * @param kmeans_tolerance Relative cost decrease below which k-means stops.
+ * @param kmeans_max_iterations Maximum number of the k-means iterations.
+ * @param clustering Pointer to the output cluster IDs (in [0, num_clusters)) of the (local)
+ * vertices.
+ * @param eigenvalues Optional (can be nullptr) pointer to the output normalized Laplacian
+ * eigenvalues (num_eigenvectors values in ascending order).
+ * @param eigenvectors Optional (can be nullptr) pointer to the output eigenvectors
+ * (column-major, # local vertices by num_eigenvectors).
+ * @param seed Seed for the initial eigenvector estimates and the k-means initialization.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void spectral_balanced_cut_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  weight_t evs_tolerance,
+  size_t evs_max_iterations,
+  weight_t kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  vertex_t* clustering,
+  weight_t* eigenvalues   = nullptr,
+  weight_t* eigenvectors  = nullptr,
+  uint64_t seed           = 0,
+  bool do_expensive_check = false);
+
+/**
+ * @brief   Spectral modularity maximization.
+ *
+ * Computes the num_eigenvectors largest eigenvectors of the modularity matrix A - d d^T / 2m (d is
+ * the vector of the weighted degrees and m is the total edge weight) with a block eigensolver
+ * (LOBPCG) and clusters the vertices by k-means on the spectral embedding.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of an undirected (symmetric) graph.
+ * @param num_clusters Number of the clusters.
+ * @param num_eigenvectors Number of the eigenvectors used in the spectral embedding.
+ * @param evs_tolerance Relative residual norm tolerance of the eigensolver.
+ * @param evs_max_iterations Maximum number of the eigensolver iterations.
+ * @param kmeans_tolerance Relative cost decrease below which k-means stops.
+ * @param kmeans_max_iterations Maximum number of the k-means iterations.
+ * @param clustering Pointer to the output cluster IDs (in [0, num_clusters)) of the (local)
+ * vertices.
+ * @param eigenvalues Optional (can be nullptr) pointer to the output modularity matrix
+ * eigenvalues (num_eigenvectors values in descending order).
+ * @param eigenvectors Optional (can be nullptr) pointer to the output eigenvectors
+ * (column-major, # local vertices by num_eigenvectors).
+ * @param seed Seed for the initial eigenvector estimates and the k-means initialization.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void spectral_modularity_maximization(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  weight_t evs_tolerance,
+  size_t evs_max_iterations,
+  weight_t kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  vertex_t* clustering,
+  weight_t* eigenvalues   = nullptr,
+  weight_t* eigenvectors  = nullptr,
+  uint64_t seed           = 0,
+  bool do_expensive_check = false);
 
 }  // namespace cugraph
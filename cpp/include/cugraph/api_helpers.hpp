@@ -25,14 +25,27 @@ namespace cugraph {
 
 enum class sampling_strategy_t : int { UNIFORM = 0, BIASED, NODE2VEC };
 
+// random engine for the random walks:
+// DEFAULT: the random values of all the steps are pre-generated in device memory;
+// PHILOX: counter-based (Philox4x32-10), evaluated on the fly, where needed;
+//
+enum class rng_type_t : int { DEFAULT = 0, PHILOX };
+
 struct sampling_params_t {
   sampling_params_t(void) {}
 
-  sampling_params_t(int sampling_type, double p = 1.0, double q = 1.0, bool use_alpha_cache = false)
+  sampling_params_t(int sampling_type,
+                    double p              = 1.0,
+                    double q              = 1.0,
+                    bool use_alpha_cache  = false,
+                    bool use_alias_tables = false,
+                    int rng_type          = 0)
     : sampling_type_(static_cast<sampling_strategy_t>(sampling_type)),
       p_(p),
       q_(q),
-      use_alpha_cache_(use_alpha_cache)
+      use_alpha_cache_(use_alpha_cache),
+      use_alias_tables_(use_alias_tables),
+      rng_type_(static_cast<rng_type_t>(rng_type))
   {
   }
 
@@ -43,5 +56,12 @@ struct sampling_params_t {
   double p_;
   double q_;
   bool use_alpha_cache_{false};
+
+  // biased and node2vec specific: pre-compute per-vertex alias tables for O(1) neighbor selection
+  // (node2vec then draws the next vertex by rejection sampling);
+  //
+  bool use_alias_tables_{false};
+
+  rng_type_t rng_type_{rng_type_t::DEFAULT};
 };
 }  // namespace cugraph
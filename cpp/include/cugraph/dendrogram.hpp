@@ -15,35 +15,72 @@
  */
 #pragma once
 
+#include <raft/cudart_utils.h>
 #include <rmm/device_uvector.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 namespace cugraph {
 
+// The levels are stored back to back in a single device buffer (the level sizes shrink, so the
+// total size is typically bounded by a small multiple of the first level size); the buffer grows
+// geometrically if add_level() exceeds the reserved capacity. Pointers to the levels are
+// invalidated by add_level() (unless the capacity is reserved in advance) and should be
+// re-acquired afterwards.
 template <typename vertex_t>
 class Dendrogram {
  public:
+  // reserves the buffer capacity for levels with up to total_size vertices in total
+  void reserve(size_t total_size,
+               rmm::cuda_stream_view stream_view,
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+  {
+    if (!levels_) {
+      levels_ = std::make_unique<rmm::device_uvector<vertex_t>>(0, stream_view, mr);
+    }
+    levels_->reserve(total_size, stream_view);
+  }
+
+  // releases the unused buffer capacity (e.g. once the last level is added)
+  void shrink_to_fit(rmm::cuda_stream_view stream_view)
+  {
+    if (levels_) { levels_->shrink_to_fit(stream_view); }
+  }
+
   void add_level(vertex_t first_index,
                  vertex_t num_verts,
                  rmm::cuda_stream_view stream_view,
                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
   {
-    level_ptr_.push_back(
-      std::make_unique<rmm::device_uvector<vertex_t>>(num_verts, stream_view, mr));
+    if (!levels_) {
+      levels_ = std::make_unique<rmm::device_uvector<vertex_t>>(0, stream_view, mr);
+    }
+    auto new_size = level_offsets_.back() + static_cast<size_t>(num_verts);
+    if (new_size > levels_->capacity()) {
+      levels_->reserve(std::max(new_size, levels_->capacity() * 2), stream_view);
+    }
+    levels_->resize(new_size, stream_view);
+    level_offsets_.push_back(new_size);
     level_first_index_.push_back(first_index);
   }
 
-  size_t current_level() const { return level_ptr_.size() - 1; }
+  size_t current_level() const { return level_first_index_.size() - 1; }
 
-  size_t num_levels() const { return level_ptr_.size(); }
+  size_t num_levels() const { return level_first_index_.size(); }
 
-  vertex_t const* get_level_ptr_nocheck(size_t level) const { return level_ptr_[level]->data(); }
+  vertex_t const* get_level_ptr_nocheck(size_t level) const
+  {
+    return levels_->data() + level_offsets_[level];
+  }
 
-  vertex_t* get_level_ptr_nocheck(size_t level) { return level_ptr_[level]->data(); }
+  vertex_t* get_level_ptr_nocheck(size_t level) { return levels_->data() + level_offsets_[level]; }
 
-  size_t get_level_size_nocheck(size_t level) const { return level_ptr_[level]->size(); }
+  size_t get_level_size_nocheck(size_t level) const
+  {
+    return level_offsets_[level + 1] - level_offsets_[level];
+  }
 
   vertex_t get_level_first_index_nocheck(size_t level) const { return level_first_index_[level]; }
 
@@ -62,9 +99,28 @@ class Dendrogram {
     return get_level_first_index_nocheck(current_level());
   }
 
+  // all the levels (back to back, level l is in [level_offsets[l], level_offsets[l + 1]))
+  vertex_t const* data() const { return levels_ ? levels_->data() : nullptr; }
+
+  size_t size() const { return level_offsets_.back(); }
+
+  std::vector<size_t> const& get_level_offsets() const { return level_offsets_; }
+
+  // copies every level to the host in a single transfer (in the data() layout)
+  std::vector<vertex_t> to_host(rmm::cuda_stream_view stream_view) const
+  {
+    std::vector<vertex_t> h_levels(size());
+    if (size() > 0) {
+      raft::update_host(h_levels.data(), levels_->data(), size(), stream_view.value());
+      stream_view.synchronize();
+    }
+    return h_levels;
+  }
+
  private:
-  std::vector<vertex_t> level_first_index_;
-  std::vector<std::unique_ptr<rmm::device_uvector<vertex_t>>> level_ptr_;
+  std::vector<vertex_t> level_first_index_{};
+  std::vector<size_t> level_offsets_{size_t{0}};  // size = num_levels() + 1
+  std::unique_ptr<rmm::device_uvector<vertex_t>> levels_{};
 };
 
 }  // namespace cugraph
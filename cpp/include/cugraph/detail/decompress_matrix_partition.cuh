@@ -25,7 +25,10 @@
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/optional.h>
+#include <thrust/remove.h>
+#include <thrust/tuple.h>
 
 #include <optional>
 #include <tuple>
@@ -54,7 +57,7 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
     auto major_offset = major_start_offset + idx;
     auto major =
       matrix_partition.get_major_from_major_offset_nocheck(static_cast<vertex_t>(major_offset));
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
@@ -80,7 +83,7 @@ __global__ void for_all_major_for_all_nbr_high_degree(
     auto major_offset = major_start_offset + idx;
     auto major =
       matrix_partition.get_major_from_major_offset_nocheck(static_cast<vertex_t>(major_offset));
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) =
@@ -194,8 +197,8 @@ void decompress_matrix_partition_to_edgelist(
   decompress_matrix_partition_to_fill_edgelist_majors(
     handle, matrix_partition, edgelist_majors, segment_offsets);
   thrust::copy(handle.get_thrust_policy(),
-               matrix_partition.get_indices(),
-               matrix_partition.get_indices() + number_of_edges,
+               matrix_partition.get_minors(),
+               matrix_partition.get_minors() + number_of_edges,
                edgelist_minors);
   if (edgelist_weights) {
     thrust::copy(handle.get_thrust_policy(),
@@ -205,5 +208,61 @@ void decompress_matrix_partition_to_edgelist(
   }
 }
 
+// remove the edges masked out by the matrix_partition edge mask from [edge_first, edge_first +
+// matrix_partition.get_number_of_edges()) (every edge of matrix_partition in the edge storage
+// order, e.g. decompress_matrix_partition_to_edgelist outputs), returns the number of remaining
+// edges
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu,
+          typename EdgeIterator>
+size_t remove_masked_out_edges(
+  raft::handle_t const& handle,
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> const matrix_partition,
+  EdgeIterator edge_first /* [INOUT] */)
+{
+  auto number_of_edges = static_cast<size_t>(matrix_partition.get_number_of_edges());
+  if (!matrix_partition.get_edge_mask()) { return number_of_edges; }
+
+  return static_cast<size_t>(thrust::distance(
+    edge_first,
+    thrust::remove_if(handle.get_thrust_policy(),
+                      edge_first,
+                      edge_first + number_of_edges,
+                      thrust::make_counting_iterator(edge_t{0}),
+                      [matrix_partition] __device__(auto i) {
+                        return !matrix_partition.is_valid_edge(i);
+                      })));
+}
+
+// decompress the edges of matrix_partition not masked out by the matrix_partition edge mask to
+// [edgelist_majors, edgelist_majors + returned count) (and edgelist_minors, edgelist_weights), the
+// output buffers should be large enough to hold every edge of matrix_partition
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t decompress_matrix_partition_to_unmasked_edgelist(
+  raft::handle_t const& handle,
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> const matrix_partition,
+  vertex_t* edgelist_majors /* [OUT] */,
+  vertex_t* edgelist_minors /* [OUT] */,
+  std::optional<weight_t*> edgelist_weights /* [OUT] */,
+  std::optional<std::vector<vertex_t>> const& segment_offsets)
+{
+  decompress_matrix_partition_to_edgelist(
+    handle, matrix_partition, edgelist_majors, edgelist_minors, edgelist_weights, segment_offsets);
+  if (edgelist_weights) {
+    return remove_masked_out_edges(
+      handle,
+      matrix_partition,
+      thrust::make_zip_iterator(
+        thrust::make_tuple(edgelist_majors, edgelist_minors, *edgelist_weights)));
+  } else {
+    return remove_masked_out_edges(
+      handle,
+      matrix_partition,
+      thrust::make_zip_iterator(thrust::make_tuple(edgelist_majors, edgelist_minors)));
+  }
+}
+
 }  // namespace detail
 }  // namespace cugraph
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/matrix_partition_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Helpers for processing the edges of a matrix partition in tiles when the edges are not in device
+// memory (see graph_t::set_edge_memory_placement). With the edges in managed memory, a full sweep
+// over a graph larger than the device memory thrashes the page migration if every edge is touched
+// at once; processing the majors in tiles of a bounded number of edges while the next tile is
+// prefetched keeps the working set resident and overlaps the migration with the computation.
+
+namespace cugraph {
+namespace detail {
+
+// returns the boundaries (major indices and the matching edge offsets, size = # tiles + 1) of the
+// tiles of the majors [major_idx_first, major_idx_last) of a matrix partition (major index ==
+// major offset except in the hypersparse segment), a tile has at most tile_size edges unless it
+// consists of a single major with more edges
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<std::vector<vertex_t>, std::vector<edge_t>> compute_edge_tile_boundaries(
+  raft::handle_t const& handle,
+  matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu> const& matrix_partition_view,
+  vertex_t major_idx_first,
+  vertex_t major_idx_last,
+  edge_t tile_size)
+{
+  CUGRAPH_EXPECTS(tile_size > 0, "Invalid input argument: tile_size should be positive.");
+
+  auto offsets = matrix_partition_view.get_offsets();
+  edge_t edge_first{0};
+  edge_t edge_last{0};
+  raft::update_host(&edge_first, offsets + major_idx_first, size_t{1}, handle.get_stream());
+  raft::update_host(&edge_last, offsets + major_idx_last, size_t{1}, handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  auto num_tiles = std::max((edge_last - edge_first + tile_size - 1) / tile_size, edge_t{1});
+  rmm::device_uvector<vertex_t> d_boundaries(num_tiles + 1, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(edge_t{0}),
+    thrust::make_counting_iterator(num_tiles + 1),
+    d_boundaries.begin(),
+    [offsets, major_idx_first, major_idx_last, edge_first, tile_size, num_tiles] __device__(
+      auto t) {
+      if (t == 0) { return major_idx_first; }
+      if (t == num_tiles) { return major_idx_last; }
+      // the major holding the first edge of the tile
+      auto it = thrust::upper_bound(thrust::seq,
+                                    offsets + major_idx_first,
+                                    offsets + (major_idx_last + 1),
+                                    edge_first + t * tile_size);
+      return static_cast<vertex_t>(thrust::distance(offsets, it) - 1);
+    });
+  d_boundaries.resize(
+    thrust::distance(
+      d_boundaries.begin(),
+      thrust::unique(handle.get_thrust_policy(), d_boundaries.begin(), d_boundaries.end())),
+    handle.get_stream());
+  rmm::device_uvector<edge_t> d_edge_boundaries(d_boundaries.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 d_boundaries.begin(),
+                 d_boundaries.end(),
+                 offsets,
+                 d_edge_boundaries.begin());
+
+  std::vector<vertex_t> boundaries(d_boundaries.size());
+  std::vector<edge_t> edge_boundaries(boundaries.size());
+  raft::update_host(
+    boundaries.data(), d_boundaries.data(), d_boundaries.size(), handle.get_stream());
+  raft::update_host(edge_boundaries.data(),
+                    d_edge_boundaries.data(),
+                    d_edge_boundaries.size(),
+                    handle.get_stream());
+  handle.get_stream_view().synchronize();
+  if (boundaries.size() == 1) {  // major_idx_first == major_idx_last
+    boundaries.push_back(boundaries.back());
+    edge_boundaries.push_back(edge_boundaries.back());
+  }
+
+  return std::make_tuple(std::move(boundaries), std::move(edge_boundaries));
+}
+
+// prefetches the edges of the tiles of a matrix partition (in managed memory) to the current
+// device on a separate stream, the stream processing a tile waits for the tile's prefetch
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+class edge_tile_prefetcher_t {
+ public:
+  edge_tile_prefetcher_t(
+    matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu> const& matrix_partition_view,
+    std::vector<vertex_t> const& tile_boundaries,
+    std::vector<edge_t> const& tile_edge_boundaries)
+    : matrix_partition_view_(matrix_partition_view),
+      tile_boundaries_(tile_boundaries),
+      tile_edge_boundaries_(tile_edge_boundaries),
+      events_(tile_boundaries.size() - 1, nullptr)
+  {
+    CUDA_TRY(cudaGetDevice(&device_));
+    for (auto& event : events_) {
+      CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    }
+  }
+
+  edge_tile_prefetcher_t(edge_tile_prefetcher_t const&) = delete;
+  edge_tile_prefetcher_t& operator=(edge_tile_prefetcher_t const&) = delete;
+
+  ~edge_tile_prefetcher_t()
+  {
+    for (auto event : events_) {
+      cudaEventDestroy(event);
+    }
+  }
+
+  size_t get_num_tiles() const { return events_.size(); }
+
+  // should be called once per tile in the tile order
+  void prefetch(size_t tile_idx)
+  {
+    auto major_first = tile_boundaries_[tile_idx];
+    auto major_last  = tile_boundaries_[tile_idx + 1];
+    auto edge_first  = tile_edge_boundaries_[tile_idx];
+    auto edge_last   = tile_edge_boundaries_[tile_idx + 1];
+    prefetch_range(
+      matrix_partition_view_.get_offsets() + major_first, (major_last - major_first) + 1);
+    if (edge_last > edge_first) {
+      auto compressed_indices = matrix_partition_view_.get_compressed_indices();
+      if (compressed_indices) {
+        prefetch_range(*compressed_indices + edge_first, edge_last - edge_first);
+      } else {
+        prefetch_range(matrix_partition_view_.get_indices() + edge_first, edge_last - edge_first);
+      }
+      auto weights = matrix_partition_view_.get_weights();
+      if (weights) { prefetch_range(*weights + edge_first, edge_last - edge_first); }
+    }
+    CUDA_TRY(cudaEventRecord(events_[tile_idx], prefetch_stream_.value()));
+  }
+
+  void wait(size_t tile_idx, rmm::cuda_stream_view stream_view)
+  {
+    CUDA_TRY(cudaStreamWaitEvent(stream_view.value(), events_[tile_idx], 0));
+  }
+
+ private:
+  template <typename T>
+  void prefetch_range(T const* ptr, size_t size)
+  {
+    CUDA_TRY(cudaMemPrefetchAsync(ptr, size * sizeof(T), device_, prefetch_stream_.value()));
+  }
+
+  matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu> matrix_partition_view_;
+  std::vector<vertex_t> tile_boundaries_{};
+  std::vector<edge_t> tile_edge_boundaries_{};
+
+  int device_{0};
+  rmm::cuda_stream prefetch_stream_{};
+  std::vector<cudaEvent_t> events_{};
+};
+
+}  // namespace detail
+}  // namespace cugraph
@@ -24,6 +24,9 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
 #include <thrust/sort.h>
 #include <thrust/tabulate.h>
 #include <thrust/transform.h>
@@ -47,6 +50,21 @@ struct compute_gpu_id_from_vertex_t {
   }
 };
 
+// maps a (renumbered) internal vertex ID to the GPU that owns its vertex partition
+template <typename vertex_t>
+struct compute_gpu_id_from_int_vertex_t {
+  vertex_t const* vertex_partition_lasts{nullptr};
+  int comm_size{0};
+
+  __device__ int operator()(vertex_t v) const
+  {
+    return static_cast<int>(thrust::distance(
+      vertex_partition_lasts,
+      thrust::upper_bound(
+        thrust::seq, vertex_partition_lasts, vertex_partition_lasts + comm_size, v)));
+  }
+};
+
 template <typename vertex_t>
 struct compute_gpu_id_from_edge_t {
   int comm_size{0};
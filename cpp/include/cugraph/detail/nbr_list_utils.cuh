@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// Utilities for the algorithms that need the (full) neighbor lists of arbitrary vertices: a GPU
+// stores the edges with its local vertices as majors in a local CSR (edges sorted by (major,
+// minor)), and the neighbor lists of the vertices owned by the other GPUs are fetched from their
+// owners.
+
+// maps a tuple with a renumbered vertex ID as the first element to the GPU owning the vertex
+template <typename vertex_t>
+struct renumbered_vertex_to_gpu_id_t {
+  vertex_t const* vertex_partition_lasts{nullptr};
+  int comm_size{0};
+
+  template <typename tuple_t>
+  __device__ int operator()(tuple_t t) const
+  {
+    return static_cast<int>(thrust::distance(vertex_partition_lasts,
+                                             thrust::upper_bound(thrust::seq,
+                                                                 vertex_partition_lasts,
+                                                                 vertex_partition_lasts + comm_size,
+                                                                 thrust::get<0>(t))));
+  }
+};
+
+// returns the CSR offsets of the (sorted) edges with majors in [major_first, major_first +
+// num_majors)
+template <typename vertex_t, typename edge_t>
+rmm::device_uvector<edge_t> compute_sorted_edge_offsets(raft::handle_t const& handle,
+                                                        rmm::device_uvector<vertex_t> const& majors,
+                                                        vertex_t major_first,
+                                                        vertex_t num_majors)
+{
+  rmm::device_uvector<edge_t> offsets(num_majors + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      majors.begin(),
+                      majors.end(),
+                      thrust::make_counting_iterator(major_first),
+                      thrust::make_counting_iterator(major_first + num_majors + 1),
+                      offsets.begin());
+  return offsets;
+}
+
+// fetches the neighbor lists (minors & offsets as returned by extract_local_major_edgelist &
+// compute_sorted_edge_offsets or their subsets) of the (sorted, unique) vertices from their owners
+// and returns (offsets, indices[, the positions of the fetched edges in the owners' local edge
+// lists])
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<edge_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<edge_t>>>
+fetch_nbr_lists(raft::handle_t const& handle,
+                vertex_t const* vertices,
+                size_t num_vertices,
+                rmm::device_uvector<vertex_t> const& minors,
+                rmm::device_uvector<edge_t> const& offsets,
+                vertex_t local_vertex_first,
+                rmm::device_uvector<vertex_t> const& d_vertex_partition_lasts,
+                bool with_edge_indices)
+{
+  auto& comm = handle.get_comms();
+
+  // 1. send the vertices to their owners
+
+  rmm::device_uvector<size_t> d_tx_counts(d_vertex_partition_lasts.size(), handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      vertices,
+                      vertices + num_vertices,
+                      d_vertex_partition_lasts.begin(),
+                      d_vertex_partition_lasts.end(),
+                      d_tx_counts.begin());
+  thrust::adjacent_difference(
+    handle.get_thrust_policy(), d_tx_counts.begin(), d_tx_counts.end(), d_tx_counts.begin());
+  std::vector<size_t> h_tx_counts(d_tx_counts.size());
+  raft::update_host(
+    h_tx_counts.data(), d_tx_counts.data(), d_tx_counts.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  auto [rx_vertices, rx_counts] = shuffle_values(comm, vertices, h_tx_counts, handle.get_stream());
+
+  // 2. the owners send back the neighbor lists
+
+  rmm::device_uvector<edge_t> rx_degrees(rx_vertices.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    rx_vertices.begin(),
+                    rx_vertices.end(),
+                    rx_degrees.begin(),
+                    [offsets = offsets.data(), local_vertex_first] __device__(auto v) {
+                      return offsets[v - local_vertex_first + 1] - offsets[v - local_vertex_first];
+                    });
+  rmm::device_uvector<edge_t> rx_nbr_offsets(rx_vertices.size() + 1, handle.get_stream());
+  rx_nbr_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::inclusive_scan(
+    handle.get_thrust_policy(), rx_degrees.begin(), rx_degrees.end(), rx_nbr_offsets.begin() + 1);
+  rmm::device_uvector<vertex_t> rx_nbrs(rx_nbr_offsets.back_element(handle.get_stream()),
+                                        handle.get_stream());
+  auto rx_nbr_edge_indices =
+    with_edge_indices
+      ? std::make_optional<rmm::device_uvector<edge_t>>(rx_nbrs.size(), handle.get_stream())
+      : std::nullopt;
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(rx_vertices.size()),
+    [rx_vertices         = rx_vertices.data(),
+     rx_nbr_offsets      = rx_nbr_offsets.data(),
+     rx_nbrs             = rx_nbrs.data(),
+     rx_nbr_edge_indices = rx_nbr_edge_indices ? (*rx_nbr_edge_indices).data() : nullptr,
+     offsets             = offsets.data(),
+     minors              = minors.data(),
+     local_vertex_first] __device__(auto i) {
+      auto offset = rx_vertices[i] - local_vertex_first;
+      thrust::copy(thrust::seq,
+                   minors + offsets[offset],
+                   minors + offsets[offset + 1],
+                   rx_nbrs + rx_nbr_offsets[i]);
+      if (rx_nbr_edge_indices != nullptr) {
+        thrust::sequence(thrust::seq,
+                         rx_nbr_edge_indices + rx_nbr_offsets[i],
+                         rx_nbr_edge_indices + rx_nbr_offsets[i + 1],
+                         offsets[offset]);
+      }
+    });
+
+  std::vector<size_t> h_rx_displacements(rx_counts.size() + 1, size_t{0});
+  std::partial_sum(rx_counts.begin(), rx_counts.end(), h_rx_displacements.begin() + 1);
+  rmm::device_uvector<size_t> d_rx_displacements(h_rx_displacements.size(), handle.get_stream());
+  raft::update_device(d_rx_displacements.data(),
+                      h_rx_displacements.data(),
+                      h_rx_displacements.size(),
+                      handle.get_stream());
+  rmm::device_uvector<edge_t> d_rx_nbr_displacements(d_rx_displacements.size(),
+                                                     handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 d_rx_displacements.begin(),
+                 d_rx_displacements.end(),
+                 rx_nbr_offsets.begin(),
+                 d_rx_nbr_displacements.begin());
+  std::vector<edge_t> h_rx_nbr_displacements(d_rx_nbr_displacements.size());
+  raft::update_host(h_rx_nbr_displacements.data(),
+                    d_rx_nbr_displacements.data(),
+                    d_rx_nbr_displacements.size(),
+                    handle.get_stream());
+  handle.get_stream_view().synchronize();
+  std::vector<size_t> h_rx_nbr_counts(rx_counts.size());
+  for (size_t i = 0; i < rx_counts.size(); ++i) {
+    h_rx_nbr_counts[i] =
+      static_cast<size_t>(h_rx_nbr_displacements[i + 1] - h_rx_nbr_displacements[i]);
+  }
+  rx_vertices.resize(0, handle.get_stream());
+  rx_vertices.shrink_to_fit(handle.get_stream());
+  rx_nbr_offsets.resize(0, handle.get_stream());
+  rx_nbr_offsets.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<edge_t> degrees(0, handle.get_stream());
+  std::tie(degrees, std::ignore) =
+    shuffle_values(comm, rx_degrees.begin(), rx_counts, handle.get_stream());
+  rx_degrees.resize(0, handle.get_stream());
+  rx_degrees.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<vertex_t> nbr_indices(0, handle.get_stream());
+  std::tie(nbr_indices, std::ignore) =
+    shuffle_values(comm, rx_nbrs.begin(), h_rx_nbr_counts, handle.get_stream());
+  rx_nbrs.resize(0, handle.get_stream());
+  rx_nbrs.shrink_to_fit(handle.get_stream());
+
+  auto nbr_edge_indices =
+    with_edge_indices
+      ? std::make_optional<rmm::device_uvector<edge_t>>(size_t{0}, handle.get_stream())
+      : std::nullopt;
+  if (with_edge_indices) {
+    std::tie(*nbr_edge_indices, std::ignore) =
+      shuffle_values(comm, (*rx_nbr_edge_indices).begin(), h_rx_nbr_counts, handle.get_stream());
+  }
+
+  rmm::device_uvector<edge_t> nbr_offsets(degrees.size() + 1, handle.get_stream());
+  nbr_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::inclusive_scan(
+    handle.get_thrust_policy(), degrees.begin(), degrees.end(), nbr_offsets.begin() + 1);
+
+  return std::make_tuple(
+    std::move(nbr_offsets), std::move(nbr_indices), std::move(nbr_edge_indices));
+}
+
+// sorts the keys and sums the values with the same key (keys & values are replaced by the unique
+// keys & the sums)
+template <typename key_t, typename value_t>
+void reduce_by_sorted_key(raft::handle_t const& handle,
+                          rmm::device_uvector<key_t>& keys,
+                          rmm::device_uvector<value_t>& values)
+{
+  thrust::sort_by_key(handle.get_thrust_policy(), keys.begin(), keys.end(), values.begin());
+  rmm::device_uvector<key_t> unique_keys(keys.size(), handle.get_stream());
+  rmm::device_uvector<value_t> sums(unique_keys.size(), handle.get_stream());
+  auto num_unique_keys = static_cast<size_t>(
+    thrust::distance(unique_keys.begin(),
+                     thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                                          keys.begin(),
+                                                          keys.end(),
+                                                          values.begin(),
+                                                          unique_keys.begin(),
+                                                          sums.begin()))));
+  unique_keys.resize(num_unique_keys, handle.get_stream());
+  sums.resize(num_unique_keys, handle.get_stream());
+  keys   = std::move(unique_keys);
+  values = std::move(sums);
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename key_t, typename value_t>
+struct add_reduced_values_t {
+  key_t const* keys{nullptr};  // unique
+  value_t const* values{nullptr};
+  value_t* output{nullptr};
+  key_t key_first{0};
+
+  __device__ void operator()(size_t i) const { output[keys[i] - key_first] += values[i]; }
+};
+
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_self_loop_t {
+  template <typename edge_tuple_t>
+  __device__ bool operator()(edge_tuple_t e) const
+  {
+    return thrust::get<0>(e) == thrust::get<1>(e);
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+extract_local_major_edgelist_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  bool with_weights,
+  bool skip_masked_out_edges,
+  bool skip_self_loops)
+{
+  std::vector<size_t> edge_counts(graph_view.get_number_of_local_adj_matrix_partitions());
+  for (size_t i = 0; i < edge_counts.size(); ++i) {
+    edge_counts[i] =
+      static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_edges(i));
+  }
+
+  rmm::device_uvector<vertex_t> majors(std::reduce(edge_counts.begin(), edge_counts.end()),
+                                       handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(majors.size(), handle.get_stream());
+  auto weights = with_weights && graph_view.is_weighted()
+                   ? std::make_optional<rmm::device_uvector<weight_t>>(majors.size(),
+                                                                       handle.get_stream())
+                   : std::nullopt;
+  size_t cur_size{0};
+  for (size_t i = 0; i < edge_counts.size(); ++i) {
+    auto matrix_partition = matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+      graph_view.get_matrix_partition_view(i));
+    auto partition_weights = weights ? std::optional<weight_t*>{(*weights).data() + cur_size}
+                                     : std::optional<weight_t*>{std::nullopt};
+    if (skip_masked_out_edges) {
+      cur_size += decompress_matrix_partition_to_unmasked_edgelist(
+        handle,
+        matrix_partition,
+        majors.data() + cur_size,
+        minors.data() + cur_size,
+        partition_weights,
+        graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+    } else {
+      decompress_matrix_partition_to_edgelist(
+        handle,
+        matrix_partition,
+        majors.data() + cur_size,
+        minors.data() + cur_size,
+        partition_weights,
+        graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+      cur_size += edge_counts[i];
+    }
+  }
+
+  auto num_edges = cur_size;
+  if (skip_self_loops) {
+    if (weights) {
+      auto edge_first = thrust::make_zip_iterator(
+        thrust::make_tuple(majors.begin(), minors.begin(), (*weights).begin()));
+      num_edges = static_cast<size_t>(
+        thrust::distance(edge_first,
+                         thrust::remove_if(handle.get_thrust_policy(),
+                                           edge_first,
+                                           edge_first + cur_size,
+                                           is_self_loop_t<vertex_t>{})));
+    } else {
+      auto edge_first =
+        thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+      num_edges = static_cast<size_t>(
+        thrust::distance(edge_first,
+                         thrust::remove_if(handle.get_thrust_policy(),
+                                           edge_first,
+                                           edge_first + cur_size,
+                                           is_self_loop_t<vertex_t>{})));
+    }
+  }
+  majors.resize(num_edges, handle.get_stream());
+  minors.resize(num_edges, handle.get_stream());
+  majors.shrink_to_fit(handle.get_stream());
+  minors.shrink_to_fit(handle.get_stream());
+  if (weights) {
+    (*weights).resize(num_edges, handle.get_stream());
+    (*weights).shrink_to_fit(handle.get_stream());
+  }
+
+  if constexpr (multi_gpu) {
+    auto& comm                  = handle.get_comms();
+    auto vertex_partition_lasts = graph_view.get_vertex_partition_lasts();
+    rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                           handle.get_stream());
+    raft::update_device(d_vertex_partition_lasts.data(),
+                        vertex_partition_lasts.data(),
+                        vertex_partition_lasts.size(),
+                        handle.get_stream());
+    if (weights) {
+      auto edge_first = thrust::make_zip_iterator(
+        thrust::make_tuple(majors.begin(), minors.begin(), (*weights).begin()));
+      std::forward_as_tuple(std::tie(majors, minors, *weights), std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          comm,
+          edge_first,
+          edge_first + majors.size(),
+          renumbered_vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(),
+                                                  comm.get_size()},
+          handle.get_stream());
+    } else {
+      auto edge_first =
+        thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+      std::forward_as_tuple(std::tie(majors, minors), std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          comm,
+          edge_first,
+          edge_first + majors.size(),
+          renumbered_vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(),
+                                                  comm.get_size()},
+          handle.get_stream());
+    }
+  }
+
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+  if (weights) {
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), edge_first, edge_first + majors.size(), (*weights).begin());
+  } else {
+    thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + majors.size());
+  }
+
+  return std::make_tuple(std::move(majors), std::move(minors), std::move(weights));
+}
+
+// returns the edges (excluding the self-loops if skip_self_loops is true and the edges masked out
+// by the graph_view edge mask if skip_masked_out_edges is true) of graph_view; the returned edges
+// are stored on the GPUs owning the majors (in multi-GPU) and sorted by (major, minor)
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+extract_local_major_edgelist(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  bool skip_masked_out_edges = false,
+  bool skip_self_loops       = true)
+{
+  auto [majors, minors, weights] = extract_local_major_edgelist_impl(
+    handle, graph_view, false, skip_masked_out_edges, skip_self_loops);
+  return std::make_tuple(std::move(majors), std::move(minors));
+}
+
+// same as extract_local_major_edgelist, but returns the edge weights as well (if graph_view is
+// weighted, std::nullopt otherwise; the weights of the edges with the same (major, minor) pair are
+// in no particular order)
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+extract_local_major_weighted_edgelist(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  bool skip_masked_out_edges = false,
+  bool skip_self_loops       = true)
+{
+  return extract_local_major_edgelist_impl(
+    handle, graph_view, true, skip_masked_out_edges, skip_self_loops);
+}
+
+// fetches the weights of the neighbor lists fetched by fetch_nbr_lists (with with_edge_indices
+// set to true) from the owners' local edge weights (as returned by
+// extract_local_major_weighted_edgelist); returns the weights aligned with the fetched neighbors
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<weight_t> fetch_nbr_list_weights(
+  raft::handle_t const& handle,
+  vertex_t const* vertices,
+  size_t num_vertices,
+  rmm::device_uvector<edge_t> const& nbr_offsets,
+  rmm::device_uvector<edge_t> const& nbr_edge_indices,
+  rmm::device_uvector<weight_t> const& weights,
+  rmm::device_uvector<vertex_t> const& d_vertex_partition_lasts)
+{
+  auto& comm = handle.get_comms();
+
+  // the fetched neighbor lists are grouped by owner (vertices are sorted), so the edge indices are
+  // sent back to the owners as is
+
+  rmm::device_uvector<size_t> d_vertex_lasts(d_vertex_partition_lasts.size(), handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      vertices,
+                      vertices + num_vertices,
+                      d_vertex_partition_lasts.begin(),
+                      d_vertex_partition_lasts.end(),
+                      d_vertex_lasts.begin());
+  rmm::device_uvector<edge_t> d_nbr_lasts(d_vertex_lasts.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 d_vertex_lasts.begin(),
+                 d_vertex_lasts.end(),
+                 nbr_offsets.begin(),
+                 d_nbr_lasts.begin());
+  std::vector<edge_t> h_nbr_lasts(d_nbr_lasts.size());
+  raft::update_host(
+    h_nbr_lasts.data(), d_nbr_lasts.data(), d_nbr_lasts.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+  std::vector<size_t> h_tx_counts(h_nbr_lasts.size());
+  std::adjacent_difference(h_nbr_lasts.begin(), h_nbr_lasts.end(), h_tx_counts.begin());
+
+  auto [rx_edge_indices, rx_counts] =
+    shuffle_values(comm, nbr_edge_indices.begin(), h_tx_counts, handle.get_stream());
+
+  rmm::device_uvector<weight_t> rx_weights(rx_edge_indices.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 rx_edge_indices.begin(),
+                 rx_edge_indices.end(),
+                 weights.begin(),
+                 rx_weights.begin());
+  rx_edge_indices.resize(0, handle.get_stream());
+  rx_edge_indices.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<weight_t> nbr_weights(0, handle.get_stream());
+  std::tie(nbr_weights, std::ignore) =
+    shuffle_values(comm, rx_weights.begin(), rx_counts, handle.get_stream());
+
+  return nbr_weights;
+}
+
+}  // namespace detail
+}  // namespace cugraph
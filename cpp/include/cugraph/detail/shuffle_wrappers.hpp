@@ -18,6 +18,8 @@
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <optional>
+
 namespace cugraph {
 namespace detail {
 
@@ -34,6 +36,12 @@ namespace detail {
  * @param[in] d_edgelist_minors Vertex IDs for columns (if the graph adjacency matrix is stored as
  * is) or rows (if the graph adjacency matrix is stored transposed)
  * @param[in] d_edgelist_weights Optional edge weights
+ * @param[in] memory_budget Optional (approximate) upper bound, in bytes, on the temporary memory
+ * used to group and exchange the edges. If provided, the edges are grouped and exchanged in chunks
+ * and grouping the next chunk (on the first internal stream of @p handle if available) overlaps
+ * with exchanging the current chunk; the peak memory usage drops to about the input and output
+ * edge lists plus @p memory_budget. If std::nullopt, the edge list is grouped and exchanged at
+ * once. This should be either set or unset in every GPU.
  *
  * @return Tuple of shuffled major vertices, minor vertices and optional weights
  */
@@ -44,7 +52,8 @@ std::tuple<rmm::device_uvector<vertex_t>,
 shuffle_edgelist_by_gpu_id(raft::handle_t const& handle,
                            rmm::device_uvector<vertex_t>&& d_edgelist_majors,
                            rmm::device_uvector<vertex_t>&& d_edgelist_minors,
-                           std::optional<rmm::device_uvector<weight_t>>&& d_edgelist_weights);
+                           std::optional<rmm::device_uvector<weight_t>>&& d_edgelist_weights,
+                           std::optional<size_t> memory_budget = std::nullopt);
 
 /**
  * @brief Shuffle vertices using the vertex key function which returns the target GPU ID.
@@ -25,7 +25,9 @@ namespace cugraph {
 /**
  * @brief    Convert COO to CSR
  *
- * Takes a list of edges in COOrdinate format and generates a CSR format.
+ * Takes a list of edges in COOrdinate format and generates a CSR format. The edges need not be
+ * sorted (a counting sort by source builds the CSR, the neighbor lists are sorted by destination
+ * and parallel edges keep their input order), and the input is not modified.
  *
  * @throws                    cugraph::logic_error when an error occurs.
  *
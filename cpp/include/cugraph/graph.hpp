@@ -22,6 +22,8 @@
 #include <rmm/device_uvector.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -54,6 +56,10 @@ struct graph_meta_t<vertex_t, edge_t, multi_gpu, std::enable_if_t<multi_gpu>> {
 
   vertex_t num_local_unique_edge_rows{};
   vertex_t num_local_unique_edge_cols{};
+
+  // parallel edges are collapsed (after sorting the neighbor lists) if not none,
+  // number_of_edges should count the edges before collapsing
+  multi_edge_reduction_t multi_edge_reduction{multi_edge_reduction_t::none};
 };
 
 // single-GPU version
@@ -62,8 +68,44 @@ struct graph_meta_t<vertex_t, edge_t, multi_gpu, std::enable_if_t<!multi_gpu>> {
   vertex_t number_of_vertices{};
   graph_properties_t properties{};
 
-  // segment offsets based on vertex degree, relevant only if vertex IDs are renumbered
+  // segment offsets based on vertex degree, relevant only if vertex IDs are renumbered, may include
+  // the hypersparse segment (as in multi-GPU) to store the segment in the DCSR (or DCSC) format
   std::optional<std::vector<vertex_t>> segment_offsets{std::nullopt};
+
+  // if true, store the offsets only for the vertices with non-zero (major) degrees in the
+  // hypersparse segment (the zero degree vertices if segment_offsets is valid, every vertex
+  // otherwise), this helps if most vertices are isolated, relevant only when constructing from an
+  // edge list
+  bool use_dcs{false};
+
+  // parallel edges are collapsed (after sorting the neighbor lists) if not none
+  multi_edge_reduction_t multi_edge_reduction{multi_edge_reduction_t::none};
+};
+
+// Breakdown (in bytes) of the memory owned by a graph_t object (see graph_t::get_memory_footprint),
+// all but host_metadata are device memory.
+struct graph_memory_footprint_t {
+  size_t offsets{0};
+  size_t indices{0};  // including the 32 bit compressed indices or the bit-packed minors (if used)
+  size_t weights{0};
+  size_t dcs_nzd_vertices{0};
+  size_t edge_row_col_keys{0};  // the sorted unique edge rows & cols (if used)
+  size_t edge_mask{0};
+  size_t degree_cache{0};
+  size_t hub_split{0};
+  size_t reversed_graph{0};  // device memory of the cached reversed graph
+  size_t host_metadata{0};   // segment offsets, DCS vertex counts, ...
+
+  // device memory for storing the graph adjacency matrix (matches graph_t::get_memory_size())
+  size_t adjacency_total() const
+  {
+    return offsets + indices + weights + dcs_nzd_vertices + edge_row_col_keys;
+  }
+
+  size_t device_total() const
+  {
+    return adjacency_total() + edge_mask + degree_cache + hub_split + reversed_graph;
+  }
 };
 
 // graph_t is an owning graph class (note that graph_view_t is a non-owning graph class)
@@ -147,6 +189,232 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
                     rmm::device_uvector<vertex_t>&& renumber_map,
                     bool destroy = false);
 
+  /**
+   * @brief Delete a batch of edges without rebuilding the graph.
+   *
+   * The deleted edges are masked out (see graph_view_t::attach_edge_mask), so this takes time
+   * proportional to the batch size (times the logarithm of the neighbor list sizes); the edge
+   * storage is reclaimed by the next insert_edges or compact_edges call. Every stored edge matching
+   * an input (row, column) pair is deleted (so all the parallel edges in a multigraph); input pairs
+   * without a matching edge are ignored. Views obtained from this object before this call may not
+   * see the deletions (obtain a new view), and the cached reversed graph (if any) is released. Edge
+   * counts (e.g. get_number_of_edges()) still include the deleted edges until the storage is
+   * reclaimed. If this graph is symmetric, the caller should delete both directions of an edge.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param edgelist_rows Pointer to the rows (sources) of the edges to delete (renumbered vertex
+   * IDs, the edges can be on any GPU).
+   * @param edgelist_cols Pointer to the columns (destinations) of the edges to delete.
+   * @param num_edges Number of the edges (on this GPU) to delete.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void delete_edges(raft::handle_t const& handle,
+                    vertex_t const* edgelist_rows,
+                    vertex_t const* edgelist_cols,
+                    size_t num_edges,
+                    bool do_expensive_check = false);
+
+  /**
+   * @brief Insert a batch of edges.
+   *
+   * The batch is merged with the (non-deleted) edges of this graph into a new adjacency matrix
+   * without renumbering: vertex IDs (and the renumber map), the vertex partitioning and the degree
+   * segment offsets (computed at the construction time, these affect only performance) are
+   * preserved, and deleted edges are reclaimed. Batching more edge updates per call amortizes the
+   * merge cost. The cached reversed graph (if any) is released. The degree cache, the launch
+   * tuning, the hub splitting (recomputed with the same chunk size), the edge memory placement
+   * (and the managed memory tile size), and the minor bit-packing (single-GPU) are re-applied to
+   * the merged graph, the cached degrees and launch configurations restart empty. If this graph is
+   * not a multigraph, the caller should not insert an edge already in this graph; if this graph is
+   * symmetric, the caller should insert both directions of an edge.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param edgelist_rows Pointer to the rows (sources) of the edges to insert (renumbered vertex
+   * IDs, the edges can be on any GPU).
+   * @param edgelist_cols Pointer to the columns (destinations) of the edges to insert.
+   * @param edgelist_weights Pointer to the weights of the edges to insert (should be valid if and
+   * only if this graph is weighted).
+   * @param num_edges Number of the edges (on this GPU) to insert.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void insert_edges(raft::handle_t const& handle,
+                    vertex_t const* edgelist_rows,
+                    vertex_t const* edgelist_cols,
+                    std::optional<weight_t const*> edgelist_weights,
+                    size_t num_edges,
+                    bool do_expensive_check = false);
+
+  /**
+   * @brief Reclaim the storage of the edges deleted by delete_edges (a no-op if there is none).
+   */
+  void compact_edges(raft::handle_t const& handle)
+  {
+    if (edge_mask_) {
+      insert_edges(handle,
+                   nullptr,
+                   nullptr,
+                   is_weighted() ? std::optional<weight_t const*>{nullptr} : std::nullopt,
+                   size_t{0});
+    }
+  }
+
+  bool has_deleted_edges() const { return edge_mask_.has_value(); }
+
+  /**
+   * @brief Create and cache a reversed copy of this graph (every edge reversed, vertex IDs and
+   * vertex partitioning unchanged).
+   *
+   * Once cached, views obtained from this object provide the reversed graph through
+   * graph_view_t::get_reversed_view(), so algorithms that need to traverse edges in both
+   * directions do not have to create (and discard) a reversed graph on every call. This is a no-op
+   * if the graph is symmetric (a symmetric graph is its own reverse) or if the reversed graph is
+   * already cached. Edge weights are copied if this graph is weighted. The cached graph is released
+   * by remove_reversed_graph() or by any member function replacing this graph's edges (e.g.
+   * symmetrize or transpose). Views obtained from this object before this call do not see the
+   * reversed graph.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   */
+  void add_reversed_graph(raft::handle_t const& handle);
+
+  /**
+   * @brief Release the cached reversed graph (if any). Views obtained from this object while the
+   * reversed graph was cached should not call get_reversed_view() afterwards.
+   */
+  void remove_reversed_graph() { reversed_graph_.reset(); }
+
+  bool has_reversed_graph() const { return reversed_graph_ != nullptr; }
+
+  /**
+   * @brief Enable caching the vertex in/out-degrees, in/out-weight sums and maximum in/out-degrees
+   * of this graph.
+   *
+   * Views obtained from this object after this call share the cache: the first
+   * graph_view_t::get_cached_* call computes the values and later calls (and algorithms using the
+   * cached values, e.g. PageRank, BFS and core number) reuse them instead of recomputing on every
+   * call. This is a no-op if the cache is already enabled. The cache is released by
+   * disable_degree_cache() or by any member function replacing this graph's edges (e.g. symmetrize
+   * or transpose).
+   */
+  void enable_degree_cache()
+  {
+    if (!degree_cache_) {
+      degree_cache_ = std::make_shared<detail::degree_cache_t<edge_t, weight_t>>();
+    }
+  }
+
+  /**
+   * @brief Release the degree cache (if any). Views obtained from this object while the cache was
+   * enabled keep the cached values alive.
+   */
+  void disable_degree_cache() { degree_cache_.reset(); }
+
+  bool has_degree_cache() const { return degree_cache_ != nullptr; }
+
+  /**
+   * @brief Enable tuning the kernel launch configurations of the graph traversal prims (currently,
+   * copy_v_transform_reduce_in_nbr & copy_v_transform_reduce_out_nbr) for this graph.
+   *
+   * Views obtained from this object after this call share a launch configuration cache: on the
+   * first call of a prim (per edge operator type), the prim benchmarks the candidate work
+   * granularities (a thread, a warp, or a block per vertex) and block sizes for each degree segment
+   * on the current GPU and caches the fastest choice; later calls reuse the cached choice. This
+   * is a no-op if the tuning is already enabled.
+   */
+  void enable_launch_tuning()
+  {
+    if (!launch_tuning_cache_) {
+      launch_tuning_cache_ = std::make_shared<detail::launch_tuning_cache_t>();
+    }
+  }
+
+  void disable_launch_tuning() { launch_tuning_cache_.reset(); }
+
+  bool has_launch_tuning() const { return launch_tuning_cache_ != nullptr; }
+
+  /**
+   * @brief Split the local adjacency lists of the very high degree vertices (hubs) into chunks of
+   * @p chunk_size edges for the graph traversal prims (currently, copy_v_transform_reduce_in_nbr &
+   * copy_v_transform_reduce_out_nbr).
+   *
+   * In 2D partitioning, the edges of a vertex are already spread over the GPUs in the column
+   * communicator, but the local edges of a vertex are still processed by a single thread block, so
+   * a few hubs with millions of local edges can dominate the execution time of a GPU. Views
+   * obtained from this object after this call share the chunks: the prims process the local edges
+   * of a vertex with more than @p chunk_size local edges with one thread block per chunk and
+   * reduce the partial results. This requires the degree segments (i.e. the graph should be
+   * renumbered); this is a no-op otherwise. The chunks are released by disable_hub_splitting() or
+   * by any member function replacing this graph's edges (e.g. symmetrize or transpose) other than
+   * insert_edges (which recomputes them).
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param chunk_size Number of local edges per chunk (should be positive).
+   */
+  void enable_hub_splitting(raft::handle_t const& handle, edge_t chunk_size = edge_t{1} << 14);
+
+  void disable_hub_splitting() { hub_split_.reset(); }
+
+  bool has_hub_splitting() const { return hub_split_ != nullptr; }
+
+  /**
+   * @brief Move the edges (offsets, indices, weights, and the DCS vertices) of this graph (and of
+   * the cached reversed graph, if any) to the device, managed, or host pinned memory.
+   *
+   * This is for graphs not fitting in the device memory. Managed memory can be oversubscribed (the
+   * edges are advised read-mostly, so the pages migrated to the device are duplicated and evicted
+   * without writing back), and the prims sweeping over every edge (copy_v_transform_reduce_in_nbr
+   * & copy_v_transform_reduce_out_nbr) process the edges in tiles of at most @p tile_size edges
+   * prefetching the next tile while processing the current one; the other prims rely on the
+   * demand paging. Host pinned memory is accessed over the interconnect without migrating. The
+   * vertex properties, the caches, and the algorithms' working memory stay in the device memory.
+   * This requires a GPU supporting concurrent managed access for the managed memory. Views
+   * obtained from this object before this call are invalidated; member functions replacing this
+   * graph's edges (e.g. symmetrize or transpose, but not insert_edges) move the edges back to the
+   * device memory.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param placement Memory to place the edges in.
+   * @param tile_size Maximum number of edges per tile (should be positive, relevant only for the
+   * managed memory).
+   */
+  void set_edge_memory_placement(raft::handle_t const& handle,
+                                 edge_memory_placement_t placement,
+                                 edge_t tile_size = edge_t{1} << 24);
+
+  edge_memory_placement_t get_edge_memory_placement() const { return edge_memory_placement_; }
+
+  /**
+   * @brief Return the size (in bytes) of the device memory owned by this object for storing the
+   * graph adjacency matrix (excluding the cached reversed graph, if any).
+   */
+  size_t get_memory_size() const;
+
+  /**
+   * @brief Return the breakdown of the memory owned by this object, including the caches shared
+   * with the views (degree cache, hub chunks), the edge mask, and the cached reversed graph.
+   *
+   * device_total() of the returned object is the device memory released by destroying this object
+   * (if no view outlives it holding the shared caches). Use the estimate_*_memory_size functions in
+   * memory_estimates.hpp for the working memory of the algorithms.
+   */
+  graph_memory_footprint_t get_memory_footprint() const;
+
+  /**
+   * @brief Return the size (in bytes) of the device memory used by the cached reversed graph (0 if
+   * not cached).
+   */
+  size_t get_reversed_graph_memory_size() const
+  {
+    return reversed_graph_ ? reversed_graph_->get_memory_size() : size_t{0};
+  }
+
   bool is_weighted() const { return adj_matrix_partition_weights_.has_value(); }
 
   graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> view() const
@@ -166,6 +434,10 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
         ? std::make_optional<std::vector<vertex_t>>(
             (*adj_matrix_partition_dcs_nzd_vertex_counts_).size(), vertex_t{0})
         : std::nullopt;
+    auto compressed_indices = adj_matrix_partition_compressed_indices_
+                                ? std::make_optional<std::vector<uint32_t const*>>(
+                                    (*adj_matrix_partition_compressed_indices_).size(), nullptr)
+                                : std::nullopt;
     for (size_t i = 0; i < offsets.size(); ++i) {
       offsets[i] = adj_matrix_partition_offsets_[i].data();
       indices[i] = adj_matrix_partition_indices_[i].data();
@@ -174,9 +446,12 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
         (*dcs_nzd_vertices)[i]      = (*adj_matrix_partition_dcs_nzd_vertices_)[i].data();
         (*dcs_nzd_vertex_counts)[i] = (*adj_matrix_partition_dcs_nzd_vertex_counts_)[i];
       }
+      if (compressed_indices) {
+        (*compressed_indices)[i] = (*adj_matrix_partition_compressed_indices_)[i].data();
+      }
     }
 
-    return graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> graph_view(
       *(this->get_handle_ptr()),
       offsets,
       indices,
@@ -205,7 +480,26 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
                                            (*local_sorted_unique_edge_cols_).size()}
           : std::nullopt,
         local_sorted_unique_edge_col_offsets_,
+        compressed_indices,
       });
+    if (reversed_graph_) {
+      graph_view.reversed_view_ =
+        std::make_shared<decltype(graph_view) const>(reversed_graph_->view());
+    }
+    graph_view.degree_cache_          = degree_cache_;
+    graph_view.launch_tuning_cache_   = launch_tuning_cache_;
+    graph_view.hub_split_             = hub_split_;
+    graph_view.edge_memory_placement_ = edge_memory_placement_;
+    graph_view.edge_tile_size_        = edge_tile_size_;
+    if (edge_mask_) {
+      std::vector<uint32_t const*> edge_mask((*edge_mask_).size(), nullptr);
+      for (size_t i = 0; i < edge_mask.size(); ++i) {
+        edge_mask[i] = (*edge_mask_)[i].data();
+      }
+      graph_view.attach_edge_mask(edge_mask);
+    }
+
+    return graph_view;
   }
 
   std::tuple<rmm::device_uvector<vertex_t>,
@@ -216,6 +510,47 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
                          bool destroy = false);
 
  private:
+  friend class cugraph::serializer::serializer_t;
+
+  // cnstr. to be used _only_ for un/serialization purposes:
+  //
+  graph_t(
+    raft::handle_t const& handle,
+    vertex_t number_of_vertices,
+    edge_t number_of_edges,
+    graph_properties_t properties,
+    partition_t<vertex_t> const& partition,
+    std::vector<rmm::device_uvector<edge_t>>&& adj_matrix_partition_offsets,
+    std::vector<rmm::device_uvector<vertex_t>>&& adj_matrix_partition_indices,
+    std::optional<std::vector<rmm::device_uvector<weight_t>>>&& adj_matrix_partition_weights,
+    std::optional<std::vector<rmm::device_uvector<vertex_t>>>&&
+      adj_matrix_partition_dcs_nzd_vertices,
+    std::optional<std::vector<vertex_t>>&& adj_matrix_partition_dcs_nzd_vertex_counts,
+    std::optional<std::vector<vertex_t>>&& adj_matrix_partition_segment_offsets,
+    std::optional<rmm::device_uvector<vertex_t>>&& local_sorted_unique_edge_rows,
+    std::optional<rmm::device_uvector<vertex_t>>&& local_sorted_unique_edge_cols,
+    std::optional<std::vector<vertex_t>>&& local_sorted_unique_edge_row_offsets,
+    std::optional<std::vector<vertex_t>>&& local_sorted_unique_edge_col_offsets,
+    std::optional<std::vector<rmm::device_uvector<uint32_t>>>&&
+      adj_matrix_partition_compressed_indices)
+    : detail::graph_base_t<vertex_t, edge_t, weight_t>(
+        handle, number_of_vertices, number_of_edges, properties),
+      adj_matrix_partition_offsets_(std::move(adj_matrix_partition_offsets)),
+      adj_matrix_partition_indices_(std::move(adj_matrix_partition_indices)),
+      adj_matrix_partition_weights_(std::move(adj_matrix_partition_weights)),
+      adj_matrix_partition_dcs_nzd_vertices_(std::move(adj_matrix_partition_dcs_nzd_vertices)),
+      adj_matrix_partition_dcs_nzd_vertex_counts_(
+        std::move(adj_matrix_partition_dcs_nzd_vertex_counts)),
+      partition_(partition),
+      adj_matrix_partition_segment_offsets_(std::move(adj_matrix_partition_segment_offsets)),
+      local_sorted_unique_edge_rows_(std::move(local_sorted_unique_edge_rows)),
+      local_sorted_unique_edge_cols_(std::move(local_sorted_unique_edge_cols)),
+      local_sorted_unique_edge_row_offsets_(std::move(local_sorted_unique_edge_row_offsets)),
+      local_sorted_unique_edge_col_offsets_(std::move(local_sorted_unique_edge_col_offsets)),
+      adj_matrix_partition_compressed_indices_(std::move(adj_matrix_partition_compressed_indices))
+  {
+  }
+
   std::vector<rmm::device_uvector<edge_t>> adj_matrix_partition_offsets_{};
   std::vector<rmm::device_uvector<vertex_t>> adj_matrix_partition_indices_{};
   std::optional<std::vector<rmm::device_uvector<weight_t>>> adj_matrix_partition_weights_{
@@ -237,6 +572,31 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
   std::optional<rmm::device_uvector<vertex_t>> local_sorted_unique_edge_cols_{std::nullopt};
   std::optional<std::vector<vertex_t>> local_sorted_unique_edge_row_offsets_{std::nullopt};
   std::optional<std::vector<vertex_t>> local_sorted_unique_edge_col_offsets_{std::nullopt};
+
+  // if valid, minors are stored as 32 bit offsets from the matrix partition minor first (and
+  // adj_matrix_partition_indices_ are empty), relevant only if sizeof(vertex_t) > 4
+  std::optional<std::vector<rmm::device_uvector<uint32_t>>>
+    adj_matrix_partition_compressed_indices_{std::nullopt};
+
+  // if valid, the cached reversed graph (see add_reversed_graph)
+  std::unique_ptr<graph_t> reversed_graph_{nullptr};
+
+  // if valid, the vertex degree cache shared with the views (see enable_degree_cache)
+  std::shared_ptr<detail::degree_cache_t<edge_t, weight_t>> degree_cache_{nullptr};
+
+  // if valid, the launch configuration cache shared with the views (see enable_launch_tuning)
+  std::shared_ptr<detail::launch_tuning_cache_t> launch_tuning_cache_{nullptr};
+
+  // if valid, the edge chunks of the hubs shared with the views (see enable_hub_splitting)
+  std::shared_ptr<detail::hub_split_t<vertex_t, edge_t>> hub_split_{nullptr};
+
+  // see set_edge_memory_placement
+  edge_memory_placement_t edge_memory_placement_{edge_memory_placement_t::device};
+  std::optional<edge_t> edge_tile_size_{std::nullopt};
+
+  // if valid, the edges with the unset bits are deleted (see delete_edges), one mask per local
+  // adjacency matrix partition
+  std::optional<std::vector<rmm::device_uvector<uint32_t>>> edge_mask_{std::nullopt};
 };
 
 // single-GPU version
@@ -264,9 +624,40 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
           graph_meta_t<vertex_t, edge_t, multi_gpu> meta,
           bool do_expensive_check = false);
 
+  /**
+   * @brief Construct a graph from compressed sparse (CSR if @p store_transposed is false, CSC
+   * otherwise) arrays.
+   *
+   * Neighbor lists need not be sorted; this constructor sorts each neighbor list (the compressed
+   * sparse arrays are moved into the graph object and sorted in-place, so no additional copy of the
+   * edges is made). Sorting is skipped if every neighbor list is already sorted (this is checked in
+   * a linear pass). If @p meta.segment_offsets is std::nullopt and the vertex degrees are already
+   * in non-increasing order (e.g. the vertices are renumbered by degree upstream), the degree based
+   * segment offsets are computed as well.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param offsets Offsets (size = meta.number_of_vertices + 1) to the neighbor lists.
+   * @param indices Neighbor vertex IDs (size = # edges).
+   * @param weights Optional edge weights (size = # edges).
+   * @param meta Graph meta data.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`). Note that the symmetry and parallel edge (against @p meta.properties) are not checked.
+   */
+  graph_t(raft::handle_t const& handle,
+          rmm::device_uvector<edge_t>&& offsets,
+          rmm::device_uvector<vertex_t>&& indices,
+          std::optional<rmm::device_uvector<weight_t>>&& weights,
+          graph_meta_t<vertex_t, edge_t, multi_gpu> meta,
+          bool do_expensive_check = false);
+
   /**
    * @brief Symmetrize this graph.
    *
+   * If this graph is not a multigraph, this function merges each vertex's (sorted) out-neighbor
+   * and in-neighbor lists instead of sorting the edge list of both directions of every edge, so
+   * the peak memory footprint is a few times smaller.
+   *
    * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
    * handles to various CUDA libraries) to run graph algorithms.
    * @param renumber_map Optional renumber map to recover the original vertex IDs from the
@@ -319,11 +710,101 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
                     std::optional<rmm::device_uvector<vertex_t>>&& renumber_map,
                     bool destroy = false);
 
+  // see the multi-GPU version for the documentation of the dynamic update related functions
+  void delete_edges(raft::handle_t const& handle,
+                    vertex_t const* edgelist_rows,
+                    vertex_t const* edgelist_cols,
+                    size_t num_edges,
+                    bool do_expensive_check = false);
+  void insert_edges(raft::handle_t const& handle,
+                    vertex_t const* edgelist_rows,
+                    vertex_t const* edgelist_cols,
+                    std::optional<weight_t const*> edgelist_weights,
+                    size_t num_edges,
+                    bool do_expensive_check = false);
+  void compact_edges(raft::handle_t const& handle)
+  {
+    if (edge_mask_) {
+      insert_edges(handle,
+                   nullptr,
+                   nullptr,
+                   is_weighted() ? std::optional<weight_t const*>{nullptr} : std::nullopt,
+                   size_t{0});
+    }
+  }
+  bool has_deleted_edges() const { return edge_mask_.has_value(); }
+
+  // see the multi-GPU version for the documentation of the reversed graph related functions
+  void add_reversed_graph(raft::handle_t const& handle);
+  void remove_reversed_graph() { reversed_graph_.reset(); }
+  bool has_reversed_graph() const { return reversed_graph_ != nullptr; }
+
+  // see the multi-GPU version for the documentation of the degree cache related functions
+  void enable_degree_cache()
+  {
+    if (!degree_cache_) {
+      degree_cache_ = std::make_shared<detail::degree_cache_t<edge_t, weight_t>>();
+    }
+  }
+  void disable_degree_cache() { degree_cache_.reset(); }
+  bool has_degree_cache() const { return degree_cache_ != nullptr; }
+
+  // see the multi-GPU version for the documentation of the launch tuning related functions
+  void enable_launch_tuning()
+  {
+    if (!launch_tuning_cache_) {
+      launch_tuning_cache_ = std::make_shared<detail::launch_tuning_cache_t>();
+    }
+  }
+  void disable_launch_tuning() { launch_tuning_cache_.reset(); }
+  bool has_launch_tuning() const { return launch_tuning_cache_ != nullptr; }
+
+  // see the multi-GPU version for the documentation of the hub splitting related functions
+  void enable_hub_splitting(raft::handle_t const& handle, edge_t chunk_size = edge_t{1} << 14);
+  void disable_hub_splitting() { hub_split_.reset(); }
+  bool has_hub_splitting() const { return hub_split_ != nullptr; }
+
+  // see the multi-GPU version for the documentation of the edge memory placement
+  void set_edge_memory_placement(raft::handle_t const& handle,
+                                 edge_memory_placement_t placement,
+                                 edge_t tile_size = edge_t{1} << 24);
+  edge_memory_placement_t get_edge_memory_placement() const { return edge_memory_placement_; }
+
+  /**
+   * @brief Bit-pack the minors (neighbor vertex IDs) of the edges to reduce the memory footprint
+   * and the memory traffic of the graph algorithms.
+   *
+   * The minors are packed in blocks of 32 edges (in the edge storage order), a block stores the
+   * differences from its smallest minor in the fewest bits covering its range (e.g. 12 bits per
+   * edge if the minors of a block are within 4096 consecutive vertex IDs, sorted neighbor lists of
+   * locality preserving vertex IDs have small ranges). The minors are decoded on the fly by the
+   * prims (matrix_partition_device_view_t::get_minors() and get_local_edges()), the views'
+   * matrix_partition_view_t::get_indices() returns nullptr while the minors are bit-packed. The
+   * graphs rebuilt by symmetrize, transpose, and transpose_storage store unpacked minors
+   * (insert_edges packs the merged graph's minors again). This requires the edges in the device
+   * memory (see set_edge_memory_placement) and the minors of every block to span less than 2^32
+   * vertex IDs.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   */
+  void pack_minors(raft::handle_t const& handle);
+  // restores the unpacked (vertex ID) minors
+  void unpack_minors(raft::handle_t const& handle);
+  bool has_packed_minors() const { return packed_minors_.has_value(); }
+
+  size_t get_memory_size() const;
+  graph_memory_footprint_t get_memory_footprint() const;
+  size_t get_reversed_graph_memory_size() const
+  {
+    return reversed_graph_ ? reversed_graph_->get_memory_size() : size_t{0};
+  }
+
   bool is_weighted() const { return weights_.has_value(); }
 
   graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> view() const
   {
-    return graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> graph_view(
       *(this->get_handle_ptr()),
       offsets_.data(),
       indices_.data(),
@@ -332,8 +813,34 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
                                                      this->get_number_of_edges(),
                                                      this->get_graph_properties(),
                                                      segment_offsets_});
+    if (reversed_graph_) {
+      graph_view.reversed_view_ =
+        std::make_shared<decltype(graph_view) const>(reversed_graph_->view());
+    }
+    graph_view.degree_cache_          = degree_cache_;
+    graph_view.launch_tuning_cache_   = launch_tuning_cache_;
+    graph_view.hub_split_             = hub_split_;
+    graph_view.edge_memory_placement_ = edge_memory_placement_;
+    graph_view.edge_tile_size_        = edge_tile_size_;
+    if (dcs_nzd_vertices_) {
+      graph_view.dcs_nzd_vertices_     = (*dcs_nzd_vertices_).data();
+      graph_view.dcs_nzd_vertex_count_ = static_cast<vertex_t>((*dcs_nzd_vertices_).size());
+    }
+    if (packed_minors_) { graph_view.packed_minors_ = (*packed_minors_).view(); }
+    if (edge_mask_) {
+      std::vector<uint32_t const*> edge_mask((*edge_mask_).size(), nullptr);
+      for (size_t i = 0; i < edge_mask.size(); ++i) {
+        edge_mask[i] = (*edge_mask_)[i].data();
+      }
+      graph_view.attach_edge_mask(edge_mask);
+    }
+
+    return graph_view;
   }
 
+  // true if the vertices in the hypersparse segment are stored in the DCSR (or DCSC) format
+  bool use_dcs() const { return dcs_nzd_vertices_.has_value(); }
+
   // FIXME: possibley to be added later;
   // for now it's unnecessary;
   // (commented out, per reviewer request)
@@ -390,8 +897,36 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
   rmm::device_uvector<vertex_t> indices_;
   std::optional<rmm::device_uvector<weight_t>> weights_{std::nullopt};
 
-  // segment offsets based on vertex degree, relevant only if sorted_by_global_degree is true
+  // if valid, the offsets cover the vertices before the hypersparse segment and the non-zero
+  // (major) degree vertices (stored here) in the hypersparse segment, see graph_meta_t::use_dcs
+  std::optional<rmm::device_uvector<vertex_t>> dcs_nzd_vertices_{std::nullopt};
+
+  // if valid, the minors are bit-packed and indices_ is empty (see pack_minors)
+  std::optional<detail::packed_minors_t<vertex_t, edge_t>> packed_minors_{std::nullopt};
+
+  // segment offsets based on vertex degree, relevant only if sorted_by_global_degree is true (or
+  // if dcs_nzd_vertices_ is valid)
   std::optional<std::vector<vertex_t>> segment_offsets_{};
+
+  // if valid, the cached reversed graph (see add_reversed_graph)
+  std::unique_ptr<graph_t> reversed_graph_{nullptr};
+
+  // if valid, the vertex degree cache shared with the views (see enable_degree_cache)
+  std::shared_ptr<detail::degree_cache_t<edge_t, weight_t>> degree_cache_{nullptr};
+
+  // if valid, the launch configuration cache shared with the views (see enable_launch_tuning)
+  std::shared_ptr<detail::launch_tuning_cache_t> launch_tuning_cache_{nullptr};
+
+  // if valid, the edge chunks of the hubs shared with the views (see enable_hub_splitting)
+  std::shared_ptr<detail::hub_split_t<vertex_t, edge_t>> hub_split_{nullptr};
+
+  // see set_edge_memory_placement
+  edge_memory_placement_t edge_memory_placement_{edge_memory_placement_t::device};
+  std::optional<edge_t> edge_tile_size_{std::nullopt};
+
+  // if valid, the edges with the unset bits are deleted (see delete_edges), one mask per local
+  // adjacency matrix partition
+  std::optional<std::vector<rmm::device_uvector<uint32_t>>> edge_mask_{std::nullopt};
 };
 
 template <typename T, typename Enable = void>
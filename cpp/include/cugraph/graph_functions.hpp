@@ -47,6 +47,20 @@ struct renumber_meta_t<vertex_t, edge_t, multi_gpu, std::enable_if_t<!multi_gpu>
   std::vector<vertex_t> segment_offsets{};
 };
 
+/**
+ * @brief Orders of the vertices inside each vertex degree segment of a renumbered vertex partition.
+ *
+ * renumber_edgelist groups the vertices into segments by degree (the segment_offsets in
+ * renumber_meta_t) and assigns consecutive internal IDs to the vertices in each segment. degree
+ * orders the vertices in a segment by decreasing degree. label keeps the vertices in a segment in
+ * the increasing order of their input (external) IDs; this preserves the locality of an input that
+ * is already ordered (e.g. by reverse Cuthill-McKee or a graph partitioner). vertex_key orders the
+ * vertices in a segment by caller provided keys (ties are broken by the input IDs), e.g. BFS levels
+ * or Louvain community IDs from a prior run, so that neighbors in the key space get nearby
+ * internal IDs.
+ */
+enum class renumber_order_t { degree, label, vertex_key };
+
 /**
  * @brief renumber edgelist (multi-GPU)
  *
@@ -85,6 +99,11 @@ struct renumber_meta_t<vertex_t, edge_t, multi_gpu, std::enable_if_t<!multi_gpu>
  * graph adjacency matrix partition; a local partition can be further segmented by applying the
  * compute_gpu_id_from_vertex_t function to edge minor vertex IDs. This optinoal information is used
  * for further memory footprint optimization if provided.
+ * @param order Order of the vertices inside each vertex degree segment (see renumber_order_t).
+ * @param local_vertex_order_keys Keys (one key per element of @p local_vertices) to order the
+ * vertices inside each vertex degree segment. Should be valid if and only if @p order is
+ * renumber_order_t::vertex_key. Vertices missing in @p local_vertices are placed after the vertices
+ * with keys in their segments.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  * @return std::tuple<rmm::device_uvector<vertex_t>, renumber_meta_t<vertex_t, edge_t, multi_gpu>>
  * Tuple of labels (vertex IDs before renumbering) for the entire set of vertices (assigned to this
@@ -105,7 +124,9 @@ renumber_edgelist(
   std::vector<vertex_t*> const& edgelist_minors /* [INOUT] */,
   std::vector<edge_t> const& edgelist_edge_counts,
   std::optional<std::vector<std::vector<edge_t>>> const& edgelist_intra_partition_segment_offsets,
-  bool do_expensive_check = false);
+  renumber_order_t order                                 = renumber_order_t::degree,
+  std::optional<vertex_t const*> local_vertex_order_keys = std::nullopt,
+  bool do_expensive_check                                = false);
 
 /**
  * @brief renumber edgelist (single-GPU)
@@ -125,6 +146,11 @@ renumber_edgelist(
  * is) or edge source vertex IDs (if the transposed graph adjacency matrix is stored). Vertex IDs
  * are updated in-place ([INOUT] parameter).
  * @param num_edgelist_edges Number of edges in the edgelist.
+ * @param order Order of the vertices inside each vertex degree segment (see renumber_order_t).
+ * @param vertex_order_keys Keys (one key per element of @p vertices) to order the vertices inside
+ * each vertex degree segment. Should be valid if and only if @p order is
+ * renumber_order_t::vertex_key. Vertices missing in @p vertices are placed after the vertices with
+ * keys in their segments.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  * @return std::tuple<rmm::device_uvector<vertex_t>, renumber_meta_t<vertex_t, edge_t, multi_gpu>>
  * Tuple of labels (vertex IDs before renumbering) for the entire set of vertices and meta-data
@@ -141,7 +167,9 @@ renumber_edgelist(raft::handle_t const& handle,
                   vertex_t* edgelist_majors /* [INOUT] */,
                   vertex_t* edgelist_minors /* [INOUT] */,
                   edge_t num_edgelist_edges,
-                  bool do_expensive_check = false);
+                  renumber_order_t order                           = renumber_order_t::degree,
+                  std::optional<vertex_t const*> vertex_order_keys = std::nullopt,
+                  bool do_expensive_check                          = false);
 
 /**
  * @brief Renumber external vertices to internal vertices based on the provoided @p
@@ -418,8 +446,10 @@ void relabel(raft::handle_t const& handle,
  * @param subgraph_offsets Pointer to subgraph vertex offsets (size == @p num_subgraphs + 1).
  * @param subgraph_vertices Pointer to subgraph vertices (size == @p subgraph_offsets[@p
  * num_subgraphs]). The elements of @p subgraph_vertices for each subgraph should be sorted in
- * ascending order and unique.
- * @param num_subgraphs Number of induced subgraphs to extract.
+ * ascending order and unique. If multi-GPU, each GPU provides its own set of subgraphs (and gets
+ * back their edges), and the subgraph vertices need not be local (all the subgraphs of all the GPUs
+ * are extracted together, with a fixed number of collective operations).
+ * @param num_subgraphs Number of induced subgraphs to extract (on this GPU, if multi-GPU).
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
  * rmm::device_uvector<weight_t>, rmm::device_uvector<size_t>> Quadraplet of edge major (destination
@@ -449,6 +479,11 @@ extract_induced_subgraphs(
 /**
  * @brief create a graph from (the optional vertex list and) the given edge list.
  *
+ * This function takes ownership of the edge list. In single-GPU, if the edge list is already sorted
+ * by the major (row if @p store_transposed is false, column otherwise) vertex IDs (after
+ * renumbering if @p renumber is true), the edge list buffers are moved into the graph object as the
+ * compressed sparse indices and weights (so the peak memory footprint is not doubled).
+ *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam weight_t Type of edge weights. Needs to be a floating point type.
@@ -470,6 +505,10 @@ extract_induced_subgraphs(
  * @param graph_properties Properties of the graph represented by the input (optional vertex list
  * and) edge list.
  * @param renumber Flag indicating whether to renumber vertices or not.
+ * @param multi_edge_reduction If not multi_edge_reduction_t::none, each group of parallel edges is
+ * collapsed to a single edge (with the sum, minimum, or maximum of the group's edge weights) while
+ * sorting the neighbor lists during construction (this avoids a separate sort of the input edge
+ * list to remove the parallel edges). The returned graph is not a multigraph in this case.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  * @return std::tuple<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed,
  * multi_gpu>, rmm::device_uvector<vertex_t>> Pair of the generated graph and the renumber map (if
@@ -482,13 +521,208 @@ template <typename vertex_t,
           bool multi_gpu>
 std::tuple<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
            std::optional<rmm::device_uvector<vertex_t>>>
-create_graph_from_edgelist(raft::handle_t const& handle,
-                           std::optional<rmm::device_uvector<vertex_t>>&& vertices,
-                           rmm::device_uvector<vertex_t>&& edgelist_rows,
-                           rmm::device_uvector<vertex_t>&& edgelist_cols,
-                           std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
-                           graph_properties_t graph_properties,
-                           bool renumber,
-                           bool do_expensive_check = false);
+create_graph_from_edgelist(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<vertex_t>>&& vertices,
+  rmm::device_uvector<vertex_t>&& edgelist_rows,
+  rmm::device_uvector<vertex_t>&& edgelist_cols,
+  std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+  graph_properties_t graph_properties,
+  bool renumber,
+  multi_edge_reduction_t multi_edge_reduction = multi_edge_reduction_t::none,
+  bool do_expensive_check                     = false);
+
+/**
+ * @brief create a single-GPU graph from (the optional vertex list and) an edge list residing in
+ * host memory in one or more chunks.
+ *
+ * Unlike create_graph_from_edgelist, this function does not require the entire edge list to be
+ * device-resident. The edge list is streamed to the device in blocks (of at most @p
+ * edges_per_block edges) through host pinned staging buffers (copying the next block to the
+ * device overlaps with processing the current block) twice; the first pass builds the (sorted)
+ * vertex list and the vertex degrees incrementally, and the second pass renumbers the edges (if
+ * @p renumber is true) and places them in their final locations in the compressed sparse format.
+ * The peak device memory footprint is the size of the resulting graph + O(V) + O(@p
+ * edges_per_block).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to store the graph adjacency matrix as is or as
+ * transposed.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param vertices  If valid, part of the entire set of vertices in the graph to be renumbered.
+ * This parameter can be used to include isolated vertices.
+ * @param edgelist_row_chunks Host pointers to the edge row (source) vertex ID chunks.
+ * @param edgelist_col_chunks Host pointers to the edge column (destination) vertex ID chunks.
+ * @param edgelist_weight_chunks Optional host pointers to the edge weight chunks.
+ * @param edgelist_chunk_sizes Number of edges in each chunk.
+ * @param graph_properties Properties of the graph represented by the input (optional vertex list
+ * and) edge list.
+ * @param renumber Flag indicating whether to renumber vertices or not.
+ * @param edges_per_block Maximum number of edges to copy to the device at a time; this
+ * determines the size of the host pinned and device staging buffers.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>,
+ * rmm::device_uvector<vertex_t>> Pair of the generated graph and the renumber map (if @p renumber
+ * is true) or std::nullopt (if @p renumber is false).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+std::tuple<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>,
+           std::optional<rmm::device_uvector<vertex_t>>>
+create_graph_from_edgelist_chunks(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<vertex_t>>&& vertices,
+  std::vector<vertex_t const*> const& edgelist_row_chunks,
+  std::vector<vertex_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<weight_t const*>> const& edgelist_weight_chunks,
+  std::vector<edge_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block  = size_t{1} << 26,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Create a graph with every edge of the input graph reversed.
+ *
+ * Unlike graph_t::transpose, this function does not renumber vertices, and (if multi-GPU) the
+ * returned graph uses the same vertex partitioning as @p graph_view. Vertex property arrays and
+ * adjacency matrix row/column property buffers of @p graph_view can be used with the returned
+ * graph's view as is. Use graph_t::add_reversed_graph instead to cache the reversed graph with the
+ * graph it is derived from.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to store the graph adjacency matrix as is or as
+ * transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph to be reversed.
+ * @param with_weights Flag indicating whether to copy edge weights (if @p graph_view is weighted)
+ * to the reversed graph (if set to `true`) or to create an unweighted graph (if set to `false`).
+ * @return graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> The reversed graph.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  bool with_weights = true);
+
+/**
+ * @brief Re-partition the vertices of a multi-GPU graph to balance edges (instead of vertices)
+ * across GPUs.
+ *
+ * renumber_edgelist assigns (about) the same number of vertices to each GPU; on graphs with skewed
+ * degree distributions, the number of local edges (and the communication & computation volume of
+ * each bulk synchronous step) can differ by several times between GPUs. This function picks the
+ * vertex partition boundaries to balance (1 - @p edge_balance_ratio) * (number of local vertices)
+ * * (average degree) + @p edge_balance_ratio * (number of local edges), re-assigns the internal
+ * vertex IDs (the vertices remain sorted by degree inside each vertex partition and keep their
+ * relative order inside each degree segment), and moves the edges to their new owners.
+ *
+ * This function is valid only in multi-GPU. Typically called right after create_graph_from_edgelist
+ * (or graph_t construction with renumber_edgelist output); @p renumber_map_labels is updated to
+ * the new internal vertex IDs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to store the graph adjacency matrix as is or as
+ * transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true). Should be true.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph to be re-partitioned.
+ * @param renumber_map_labels Renumber map (external vertex IDs of the local vertices) of @p
+ * graph_view.
+ * @param edge_balance_ratio Weight of the edge count in [0.0, 1.0]; 0.0 balances vertices (the
+ * partitioning of renumber_edgelist) and 1.0 balances edges.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
+ * rmm::device_uvector<vertex_t>> Tuple of the re-partitioned graph and its renumber map.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
+           rmm::device_uvector<vertex_t>>
+balance_vertex_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  rmm::device_uvector<vertex_t>&& renumber_map_labels,
+  double edge_balance_ratio = 1.0,
+  bool do_expensive_check   = false);
+
+/**
+ * @brief Basic statistics of a graph (see graph_summary).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct graph_summary_t {
+  vertex_t number_of_vertices{0};
+  edge_t number_of_edges{0};
+  edge_t number_of_self_loops{0};
+  edge_t number_of_multi_edges{0};  // same as graph_view_t::count_multi_edges()
+
+  double mean_degree{0.0};  // number_of_edges / number_of_vertices (same for in & out-degrees)
+  edge_t min_out_degree{0};
+  edge_t max_out_degree{0};
+  edge_t min_in_degree{0};
+  edge_t max_in_degree{0};
+
+  // log2 binned degree histograms, element 0 counts the vertices with degree 0 and element i (i >
+  // 0) counts the vertices with degree in [2^(i - 1), 2^i), trailing empty bins are dropped
+  std::vector<vertex_t> out_degree_histogram{};
+  std::vector<vertex_t> in_degree_histogram{};
+
+  // std::nullopt if the graph is unweighted, 0.0 if the graph has no edges
+  std::optional<weight_t> min_weight{std::nullopt};
+  std::optional<weight_t> max_weight{std::nullopt};
+  std::optional<weight_t> weight_sum{std::nullopt};
+};
+
+/**
+ * @brief Compute the basic statistics of a graph in one pass over the edges.
+ *
+ * This function computes the self-loop and multi-edge counts, the in-degrees, and the edge weight
+ * statistics in a single (fused) kernel pass over the edges; the out-degrees (in-degrees if
+ * @p store_transposed is true) come from the edge offsets. This is cheaper than calling
+ * count_self_loops, count_multi_edges, compute_in_degrees, and compute_out_degrees one by one.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to store the graph adjacency matrix as is or as
+ * transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph (edge masks are not supported yet).
+ * @return graph_summary_t<vertex_t, edge_t, weight_t> The statistics (identical in all the GPUs
+ * in multi-GPU).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_summary_t<vertex_t, edge_t, weight_t> graph_summary(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view);
 
 }  // namespace cugraph
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <optional>
 #include <tuple>
+#include <vector>
 
 namespace cugraph {
 
@@ -76,6 +77,56 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> generat
   uint64_t seed      = 0,
   bool clip_and_flip = false);
 
+/**
+ * @brief generate, in a multi-GPU context, this GPU's part of an R-mat edge list, with the edges
+ * already placed on the GPUs that own them in the 2D partitioning.
+ *
+ * Every GPU draws the same (aggregate) sequence of @p num_edges R-mat edges as
+ * generate_rmat_edgelist with the same @p seed, optionally scrambles the vertex IDs (with the
+ * Graph 500 scrambling, in-kernel) and keeps only the edges that belong to this GPU (as
+ * cugraph::detail::shuffle_edgelist_by_gpu_id places them). The union of the returned edge lists is
+ * therefore independent of the number of GPUs and no inter-GPU communication is required to
+ * pre-shuffle the edges for graph creation. Each GPU spends O(@p num_edges) time but stores only
+ * its own edges.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms. The 2D partitioning sub-communicators
+ * should be initialized.
+ * @param scale Scale factor to set the number of verties in the graph. Vertex IDs have values in
+ * [0, V), where V = 1 << @p scale.
+ * @param num_edges Aggregate number of edges to generate (over all the GPUs, before
+ * symmetrization).
+ * @param a a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator.
+ * @param b a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator.
+ * @param c a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator.
+ * @param seed Seed value for the random number generator (should be the same in all the GPUs).
+ * @param clip_and_flip Flag controlling whether to generate edges only in the lower triangular part
+ * (including the diagonal) of the graph adjacency matrix (if set to `true`) or not (if set to
+ * `false`).
+ * @param scramble_vertex_ids Flag controlling whether to scramble the vertex IDs.
+ * @param symmetrize Flag controlling whether to also emit the reversed off-diagonal edges
+ * (requires @p clip_and_flip to be `true`); the result is then the edge list of an undirected
+ * graph as symmetrize_edgelist_from_triangular creates.
+ * @param store_transposed Flag indicating whether the graph adjacency matrix will be stored
+ * transposed (this decides the edge placement).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> A tuple of
+ * rmm::device_uvector objects for edge source vertex IDs and edge destination vertex IDs.
+ */
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+generate_partitioned_rmat_edgelist(raft::handle_t const& handle,
+                                   size_t scale,
+                                   size_t num_edges,
+                                   double a                 = 0.57,
+                                   double b                 = 0.19,
+                                   double c                 = 0.19,
+                                   uint64_t seed            = 0,
+                                   bool clip_and_flip       = false,
+                                   bool scramble_vertex_ids = false,
+                                   bool symmetrize          = false,
+                                   bool store_transposed    = false);
+
 enum class generator_distribution_t { POWER_LAW = 0, UNIFORM };
 
 /**
@@ -231,11 +282,13 @@ generate_complete_graph_edgelist(
 /**
  * @brief generate an edge lists for an Erdos-Renyi graph
  *
- * This API supports the G(n,p) model which requires O(n^2) work.
+ * This API supports the G(n,p) model: each of the n^2 (directed, self-loops included) vertex pairs
+ * is an edge with probability p. Edges are sampled by geometric skipping, so the work is
+ * proportional to the number of edges generated (O(p * n^2)) rather than O(n^2).
  *
  * If executed in a multi-gpu context (handle comms has been initialized)
- * each GPU will generate Erdos-Renyi edges for its portion of the 2D
- * partitioning of the adjacency matrix.
+ * each GPU will generate Erdos-Renyi edges for its (contiguous) range of rows of the adjacency
+ * matrix. The aggregate edge list does not depend on the number of GPUs for a given @p seed.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
@@ -258,16 +311,17 @@ generate_erdos_renyi_graph_edgelist_gnp(raft::handle_t const& handle,
 /**
  * @brief generate an edge lists for an Erdos-Renyi graph
  *
- * This API supports the G(n,m) model
+ * This API supports the G(n,m) model: m distinct edges are drawn uniformly from the n^2 (directed,
+ * self-loops included) vertex pairs, in O(m) expected work.
  *
  * If executed in a multi-gpu context (handle comms has been initialized)
- * each GPU will generate Erdos-Renyi edges for its portion of the 2D
- * partitioning of the adjacency matrix.
+ * each GPU will generate Erdos-Renyi edges for its (contiguous) range of rows of the adjacency
+ * matrix; the m edges are split over the GPUs in proportion to the number of rows.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param num_vertices Number of vertices to use in each complete graph
+ * @param num_vertices Number of vertices to use in the generated graph
  * @param m Number of edges to generate
  * @param base_vertex_id Starting vertex id for the generated graph
  * @param seed Seed value for the random number generator.
@@ -282,6 +336,84 @@ generate_erdos_renyi_graph_edgelist_gnm(raft::handle_t const& handle,
                                         vertex_t base_vertex_id,
                                         uint64_t seed = 0);
 
+/**
+ * @brief generate an edge list for a stochastic block model (SBM) graph
+ *
+ * The vertices are split into blocks of consecutive vertex IDs (block i has @p block_sizes[i]
+ * vertices starting at the sum of the preceding block sizes), and each vertex pair (u, v), u in
+ * block i and v in block j, is an edge with probability @p block_edge_probabilities[i * B + j]
+ * (B = @p block_sizes.size()); blocks work as planted communities if the diagonal probabilities
+ * dominate. Self-loops are not generated. The vertex pairs of each block pair are sampled by
+ * geometric skipping, so the work is proportional to the number of edges generated.
+ *
+ * If executed in a multi-gpu context (handle comms has been initialized), each GPU samples a
+ * disjoint share of the vertex pairs and the edges are then shuffled to the GPUs that own them in
+ * the 2D partitioning (as cugraph::detail::shuffle_edgelist_by_gpu_id places them), so the
+ * returned edge lists can be passed to create_graph_from_edgelist as is. The aggregate edge list
+ * does not depend on the number of GPUs for a given @p seed.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms. The 2D partitioning sub-communicators
+ * should be initialized in multi-GPU.
+ * @param block_sizes Number of vertices in each block.
+ * @param block_edge_probabilities Edge probabilities of the block pairs (row-major, B x B). Should
+ * be symmetric if @p directed is false.
+ * @param directed If false, each unordered vertex pair is sampled once and both (u, v) and (v, u)
+ * are returned for every sampled pair.
+ * @param seed Seed value for the random number generator (should be the same in all the GPUs).
+ * @param store_transposed Flag indicating whether the graph adjacency matrix will be stored
+ * transposed (this decides the edge placement in multi-GPU).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> A tuple of
+ * rmm::device_uvector objects for edge source vertex IDs and edge destination vertex IDs.
+ */
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+generate_stochastic_block_model_edgelist(raft::handle_t const& handle,
+                                         std::vector<vertex_t> const& block_sizes,
+                                         std::vector<double> const& block_edge_probabilities,
+                                         bool directed         = false,
+                                         uint64_t seed         = 0,
+                                         bool store_transposed = false);
+
+/**
+ * @brief generate an edge list for a Barabasi-Albert (preferential attachment) graph
+ *
+ * Vertex v attaches @p edges_per_vertex edges (v, u) with u <= v chosen with probability
+ * proportional to the current degree of u (in the Batagelj-Brandes formulation, which may create
+ * self-loops and parallel edges; see multi_edge_reduction_t to collapse the parallel edges while
+ * creating a graph). Every edge is computed independently from a hash based random stream (P.
+ * Sanders and C. Schulz, "Scalable generation of scale-free graphs," 2016), so the work is O(1)
+ * expected per edge and the edges are generated in parallel.
+ *
+ * If executed in a multi-gpu context (handle comms has been initialized), each GPU generates a
+ * contiguous range of the edges and the edges are then shuffled to the GPUs that own them in the 2D
+ * partitioning (as cugraph::detail::shuffle_edgelist_by_gpu_id places them). The aggregate edge
+ * list does not depend on the number of GPUs for a given @p seed.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms. The 2D partitioning sub-communicators
+ * should be initialized in multi-GPU.
+ * @param num_vertices Number of vertices in the generated graph.
+ * @param edges_per_vertex Number of edges each vertex attaches.
+ * @param seed Seed value for the random number generator (should be the same in all the GPUs).
+ * @param symmetrize Flag controlling whether to also emit the reversed off-diagonal edges (for an
+ * undirected graph).
+ * @param store_transposed Flag indicating whether the graph adjacency matrix will be stored
+ * transposed (this decides the edge placement in multi-GPU).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> A tuple of
+ * rmm::device_uvector objects for edge source vertex IDs and edge destination vertex IDs.
+ */
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+generate_barabasi_albert_edgelist(raft::handle_t const& handle,
+                                  vertex_t num_vertices,
+                                  size_t edges_per_vertex,
+                                  uint64_t seed         = 0,
+                                  bool symmetrize       = false,
+                                  bool store_transposed = false);
+
 /**
  * @brief symmetrize an edgelist from the edges in the lower (or upper but not both) triangular part
  * of a graph adjacency matrix
@@ -316,7 +448,9 @@ symmetrize_edgelist_from_triangular(
  * This translation is done in place.
  *
  * The scramble code here follows the algorithm in the Graph 500 reference
- * implementation version 3.0.0.
+ * implementation version 3.0.0. Vertex IDs are permuted within [0, 2^lgN) where lgN is the
+ * number of bits of the largest input vertex ID (the scale for R-mat graphs), so the scrambled
+ * vertex IDs of an R-mat graph stay in [0, 2^scale).
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <tuple>
+
+namespace cugraph {
+
+/**
+ * @brief read an edge list from a Matrix Market file.
+ *
+ * The data section of the file is read in chunks of (about) @p chunk_size bytes and the entries
+ * are tokenized and parsed on the GPU, so the host only parses the header (the banner, the
+ * comments and the size line). Only coordinate format files with pattern, integer, or real values
+ * and general or symmetric symmetry are supported. The 1-based Matrix Market indices are converted
+ * to 0-based vertex IDs. If the file is symmetric, the symmetric complement of every off-diagonal
+ * entry is added (so the returned edge list is the edge list of an undirected graph).
+ *
+ * For multi-GPU reading with `P` GPUs, GPU `r` parses the entries whose first byte is in the `r`th
+ * of `P` (about) equal sized byte ranges of the data section, so the file is read only once over
+ * all the GPUs. The returned edges are not shuffled; call
+ * cugraph::detail::shuffle_edgelist_by_gpu_id before passing them to create_graph_from_edgelist.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether the file is read by multiple GPUs (true) or not
+ * (false).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path to the Matrix Market file.
+ * @param read_weights Flag controlling whether to return edge weights (set to 1.0 if the file is a
+ * pattern file) or not.
+ * @param chunk_size Number of bytes to read (and copy to the GPU) at a time.
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * std::optional<rmm::device_uvector<weight_t>>, vertex_t, bool> A tuple of edge source vertex IDs,
+ * edge destination vertex IDs, (optional) edge weights, the number of vertices (the larger of the
+ * number of rows and the number of columns in the size line), and a flag indicating whether the
+ * file is symmetric.
+ */
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           vertex_t,
+           bool>
+read_matrix_market_edgelist(raft::handle_t const& handle,
+                            std::string const& file_path,
+                            bool read_weights,
+                            size_t chunk_size = size_t{1} << 26);
+
+/**
+ * @brief read an edge list from a delimited (e.g. CSV, TSV, or space separated) text file.
+ *
+ * Each line of the file (after the first @p num_header_lines lines) holds an edge as a source
+ * vertex ID, a destination vertex ID, and (if @p read_weights is true) a weight. Additional
+ * columns are ignored, and blank lines and lines starting with '#' or '%' are skipped. Vertex IDs
+ * are read as is (0-based). The file is read in chunks and parsed on the GPU as in
+ * read_matrix_market_edgelist, and multi-GPU reading splits the file in the same way (the returned
+ * edges are not shuffled).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether the file is read by multiple GPUs (true) or not
+ * (false).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path to the edge list file.
+ * @param read_weights Flag controlling whether to read edge weights from the third column or not.
+ * @param delimiter Column delimiter (in addition to spaces and tabs).
+ * @param num_header_lines Number of lines to skip at the beginning of the file.
+ * @param chunk_size Number of bytes to read (and copy to the GPU) at a time.
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * std::optional<rmm::device_uvector<weight_t>>, vertex_t> A tuple of edge source vertex IDs, edge
+ * destination vertex IDs, (optional) edge weights, and the number of vertices (the largest vertex
+ * ID + 1 over all the GPUs).
+ */
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           vertex_t>
+read_delimited_edgelist(raft::handle_t const& handle,
+                        std::string const& file_path,
+                        bool read_weights,
+                        char delimiter          = ',',
+                        size_t num_header_lines = 0,
+                        size_t chunk_size       = size_t{1} << 26);
+
+}  // namespace cugraph
@@ -29,9 +29,13 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace cugraph {
@@ -225,6 +229,16 @@ struct graph_properties_t {
   bool is_multigraph{false};
 };
 
+// how to handle parallel edges (edges with the same source & destination) while constructing a
+// graph_t object; none keeps the parallel edges as is, sum, min, and max collapse each group of
+// parallel edges to a single edge with the sum, minimum, or maximum of their weights (or with no
+// weight if unweighted)
+enum class multi_edge_reduction_t { none = 0, sum, min, max };
+
+// memory holding the edges (offsets, indices & weights) of a graph_t object (see
+// graph_t::set_edge_memory_placement)
+enum class edge_memory_placement_t { device = 0, managed, pinned_host };
+
 namespace detail {
 
 using namespace cugraph::visitors;
@@ -242,6 +256,119 @@ size_t constexpr low_degree_threshold{raft::warp_size()};
 size_t constexpr mid_degree_threshold{1024};
 size_t constexpr num_sparse_segments_per_vertex_partition{3};
 
+// Lazily filled per-vertex quantities of a graph_t object, shared by all the views obtained from
+// the object (see graph_t::enable_degree_cache)
+template <typename edge_t, typename weight_t>
+struct degree_cache_t {
+  template <typename value_t, typename compute_t>
+  value_t const& get(raft::handle_t const& handle,
+                     std::optional<value_t>& cached,
+                     compute_t compute)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!cached) {
+      cached = compute();
+      // views obtained from the same graph_t object may be used on other streams
+      handle.get_stream_view().synchronize();
+    }
+    return *cached;
+  }
+
+  // the size (in bytes) of the device memory used by the cached quantities
+  size_t get_memory_size()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t ret{0};
+    if (in_degrees_) { ret += (*in_degrees_).size() * sizeof(edge_t); }
+    if (out_degrees_) { ret += (*out_degrees_).size() * sizeof(edge_t); }
+    if (in_weight_sums_) { ret += (*in_weight_sums_).size() * sizeof(weight_t); }
+    if (out_weight_sums_) { ret += (*out_weight_sums_).size() * sizeof(weight_t); }
+    return ret;
+  }
+
+  std::mutex mutex_{};
+
+  std::optional<rmm::device_uvector<edge_t>> in_degrees_{std::nullopt};
+  std::optional<rmm::device_uvector<edge_t>> out_degrees_{std::nullopt};
+  std::optional<rmm::device_uvector<weight_t>> in_weight_sums_{std::nullopt};
+  std::optional<rmm::device_uvector<weight_t>> out_weight_sums_{std::nullopt};
+  std::optional<edge_t> max_in_degree_{std::nullopt};
+  std::optional<edge_t> max_out_degree_{std::nullopt};
+};
+
+// Launch configuration for the vertices of a degree segment in a graph traversal prim
+struct launch_config_t {
+  int32_t granularity{0};  // 0: a thread per vertex, 1: a warp per vertex, 2: a block per vertex
+  int32_t block_size{0};
+};
+
+// Per-segment launch configurations chosen by benchmarking the candidates on the first call of a
+// prim (see graph_t::enable_launch_tuning), shared by all the views obtained from a graph_t object;
+// a key identifies a prim, an edge operator type, a local adjacency matrix partition, and the
+// segment sizes.
+struct launch_tuning_cache_t {
+  std::optional<std::vector<launch_config_t>> find(std::string const& key)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = configs_.find(key);
+    return it != configs_.end() ? std::make_optional(it->second) : std::nullopt;
+  }
+
+  void insert(std::string const& key, std::vector<launch_config_t> const& configs)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    configs_.insert_or_assign(key, configs);
+  }
+
+  std::mutex mutex_{};
+
+  std::unordered_map<std::string, std::vector<launch_config_t>> configs_{};
+};
+
+// Edge chunks of the very high degree majors of each local adjacency matrix partition (see
+// graph_t::enable_hub_splitting); a major with more than chunk_size local edges is processed by
+// one thread block per chunk (instead of a single thread block) and the partial results are
+// reduced afterwards. The chunks of a partition are sorted by their major offsets.
+template <typename vertex_t, typename edge_t>
+struct hub_split_t {
+  edge_t chunk_size{0};
+
+  std::vector<rmm::device_uvector<vertex_t>> chunk_major_offsets{};
+  // offsets of the first edges of the chunks in the local edges of their majors
+  std::vector<rmm::device_uvector<edge_t>> chunk_edge_offsets{};
+
+  size_t get_memory_size() const
+  {
+    size_t ret{0};
+    for (size_t i = 0; i < chunk_major_offsets.size(); ++i) {
+      ret += chunk_major_offsets[i].size() * sizeof(vertex_t) +
+             chunk_edge_offsets[i].size() * sizeof(edge_t);
+    }
+    return ret;
+  }
+};
+
+// Bit-packed minors of a local adjacency matrix partition (see graph_t::pack_minors and
+// packed_minors_view_t for the format)
+template <typename vertex_t, typename edge_t>
+struct packed_minors_t {
+  rmm::device_uvector<uint32_t> words;
+  rmm::device_uvector<edge_t> block_word_offsets;
+  rmm::device_uvector<vertex_t> block_bases;
+
+  packed_minors_view_t<vertex_t, edge_t> view() const
+  {
+    return packed_minors_view_t<vertex_t, edge_t>{
+      words.data(), block_word_offsets.data(), block_bases.data()};
+  }
+
+  size_t get_memory_size() const
+  {
+    return words.size() * sizeof(uint32_t) + block_word_offsets.size() * sizeof(edge_t) +
+           block_bases.size() * sizeof(vertex_t);
+  }
+};
+
 // Common for both graph_view_t & graph_t and both single-GPU & multi-GPU versions
 template <typename vertex_t, typename edge_t, typename weight_t>
 class graph_base_t : public graph_envelope_t::base_graph_t /*<- visitor logic*/ {
@@ -286,6 +413,10 @@ class graph_base_t : public graph_envelope_t::base_graph_t /*<- visitor logic*/
   raft::handle_t const* get_handle_ptr() const { return handle_ptr_; };
   graph_properties_t get_graph_properties() const { return properties_; }
 
+  // used if parallel edges are collapsed while constructing a graph_t object
+  void set_number_of_edges(edge_t number_of_edges) { number_of_edges_ = number_of_edges; }
+  void set_graph_properties(graph_properties_t properties) { properties_ = properties; }
+
  private:
   raft::handle_t const* handle_ptr_{nullptr};
 
@@ -318,6 +449,11 @@ struct graph_view_meta_t<vertex_t, edge_t, multi_gpu, std::enable_if_t<multi_gpu
   std::optional<vertex_t const*> local_sorted_unique_edge_col_first{std::nullopt};
   std::optional<vertex_t const*> local_sorted_unique_edge_col_last{std::nullopt};
   std::optional<std::vector<vertex_t>> local_sorted_unique_edge_col_offsets{std::nullopt};
+
+  // if valid, minors are stored as 32 bit offsets from the local adjacency matrix partition minor
+  // first (and adj_matrix_partition_indices are nullptr)
+  std::optional<std::vector<uint32_t const*>> adj_matrix_partition_compressed_indices{
+    std::nullopt};
 };
 
 // single-GPU version
@@ -331,6 +467,15 @@ struct graph_view_meta_t<vertex_t, edge_t, multi_gpu, std::enable_if_t<!multi_gp
   std::optional<std::vector<vertex_t>> segment_offsets{std::nullopt};
 };
 
+// graph_t is an owning graph class (defined in graph.hpp)
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu,
+          typename Enable>
+class graph_t;
+
 // graph_view_t is a non-owning graph class (note that graph_t is an owning graph class)
 template <typename vertex_t,
           typename edge_t,
@@ -584,7 +729,13 @@ class graph_view_t<vertex_t,
                        : this->get_local_adj_matrix_partition_col_last(adj_matrix_partition_idx),
       store_transposed
         ? this->get_local_adj_matrix_partition_col_value_start_offset(adj_matrix_partition_idx)
-        : this->get_local_adj_matrix_partition_row_value_start_offset(adj_matrix_partition_idx));
+        : this->get_local_adj_matrix_partition_row_value_start_offset(adj_matrix_partition_idx),
+      adj_matrix_partition_compressed_indices_
+        ? std::optional<uint32_t const*>{(
+            *adj_matrix_partition_compressed_indices_)[adj_matrix_partition_idx]}
+        : std::nullopt,
+      edge_mask_ ? std::optional<uint32_t const*>{(*edge_mask_)[adj_matrix_partition_idx]}
+                 : std::nullopt);
   }
 
   rmm::device_uvector<edge_t> compute_in_degrees(raft::handle_t const& handle) const;
@@ -599,6 +750,69 @@ class graph_view_t<vertex_t,
   weight_t compute_max_in_weight_sum(raft::handle_t const& handle) const;
   weight_t compute_max_out_weight_sum(raft::handle_t const& handle) const;
 
+  /**
+   * @brief Get the in-degrees of the local vertices from the degree cache of the graph_t object
+   * this view is obtained from.
+   *
+   * The values are computed on the first call (by any view of the same graph_t object) and reused
+   * afterwards. Returns std::nullopt if the graph_t object does not have the degree cache enabled
+   * (see graph_t::enable_degree_cache), use compute_in_degrees() then. The returned values are
+   * valid while the graph_t object is not modified. In multi-GPU, the first call needs to be made
+   * by every process.
+   */
+  std::optional<edge_t const*> get_cached_in_degrees(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_
+      ->get(handle, degree_cache_->in_degrees_, [&]() { return compute_in_degrees(handle); })
+      .data();
+  }
+
+  // same as get_cached_in_degrees() for the out-degrees
+  std::optional<edge_t const*> get_cached_out_degrees(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_
+      ->get(handle, degree_cache_->out_degrees_, [&]() { return compute_out_degrees(handle); })
+      .data();
+  }
+
+  // same as get_cached_in_degrees() for the sums of the incoming edge weights
+  std::optional<weight_t const*> get_cached_in_weight_sums(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_
+      ->get(
+        handle, degree_cache_->in_weight_sums_, [&]() { return compute_in_weight_sums(handle); })
+      .data();
+  }
+
+  // same as get_cached_in_degrees() for the sums of the outgoing edge weights
+  std::optional<weight_t const*> get_cached_out_weight_sums(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_
+      ->get(
+        handle, degree_cache_->out_weight_sums_, [&]() { return compute_out_weight_sums(handle); })
+      .data();
+  }
+
+  // same as get_cached_in_degrees() for the maximum in-degree
+  std::optional<edge_t> get_cached_max_in_degree(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_->get(
+      handle, degree_cache_->max_in_degree_, [&]() { return compute_max_in_degree(handle); });
+  }
+
+  // same as get_cached_in_degrees() for the maximum out-degree
+  std::optional<edge_t> get_cached_max_out_degree(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_->get(
+      handle, degree_cache_->max_out_degree_, [&]() { return compute_max_out_degree(handle); });
+  }
+
   edge_t count_self_loops(raft::handle_t const& handle) const;
   edge_t count_multi_edges(raft::handle_t const& handle) const;
 
@@ -632,7 +846,111 @@ class graph_view_t<vertex_t,
     return local_sorted_unique_edge_col_offsets_;
   }
 
+  /**
+   * @brief Check whether a view of the reversed graph (every edge reversed, vertex IDs and vertex
+   * partitioning unchanged) is available without creating a new graph.
+   *
+   * A symmetric graph is its own reverse. Otherwise, a reversed view is available only if this view
+   * is obtained from a graph_t object holding a cached reversed graph (see
+   * graph_t::add_reversed_graph).
+   */
+  bool has_reversed_view() const
+  {
+    return this->is_symmetric() || (!edge_mask_ && (reversed_view_ != nullptr));
+  }
+
+  /**
+   * @brief Get a view of the reversed graph (see has_reversed_view()).
+   *
+   * Vertex property arrays and adjacency matrix row/column property buffers of this view can be
+   * used with the returned view as is. The returned view is valid only while the graph_t object
+   * this view is obtained from holds the cached reversed graph.
+   */
+  graph_view_t get_reversed_view() const
+  {
+    CUGRAPH_EXPECTS(has_reversed_view(),
+                    "Invalid input argument: reversed view is unavailable, call "
+                    "graph_t::add_reversed_graph first.");
+    return this->is_symmetric() ? *this : *reversed_view_;
+  }
+
+  /**
+   * @brief Attach an edge mask to this view (the graph_t object and its other views are not
+   * affected).
+   *
+   * Masked out edges are skipped by the prims (include/cugraph/prims/) and by the degree and weight
+   * sum computations, so algorithms run on the subgraph of the valid edges without copying the
+   * graph. Edge counts (e.g. get_number_of_edges()) still include the masked out edges. The degree
+   * cache and a cached reversed graph (which stores the edges in a different order) are not used
+   * while a mask is attached. The mask of a symmetric graph should keep or drop both directions of
+   * an edge. See edge_mask_t (include/cugraph/prims/edge_mask.cuh) to create a mask.
+   *
+   * @param edge_mask Pointers to the masks of the local adjacency matrix partitions: one bit per
+   * edge in the edge storage order (bit i % 32 of word i / 32 is set if the i'th edge is valid),
+   * ceil(# partition edges / 32) words per partition. The masks should remain valid while this
+   * view (or its copies) is in use.
+   */
+  void attach_edge_mask(std::vector<uint32_t const*> const& edge_mask)
+  {
+    CUGRAPH_EXPECTS(edge_mask.size() == this->get_number_of_local_adj_matrix_partitions(),
+                    "Invalid input argument: edge_mask.size() does not match the number of local "
+                    "adjacency matrix partitions.");
+    edge_mask_ = edge_mask;
+  }
+
+  void clear_edge_mask() { edge_mask_ = std::nullopt; }
+
+  bool has_edge_mask() const { return edge_mask_.has_value(); }
+
+  std::optional<std::vector<uint32_t const*>> get_edge_mask() const { return edge_mask_; }
+
+  /**
+   * @brief Return the launch tuning cache shared with the graph_t object this view is obtained
+   * from (nullptr if the launch tuning is disabled, see graph_t::enable_launch_tuning).
+   */
+  detail::launch_tuning_cache_t* get_launch_tuning_cache() const
+  {
+    return launch_tuning_cache_.get();
+  }
+
+  /**
+   * @brief Return the edge chunks of the very high degree majors shared with the graph_t object
+   * this view is obtained from (nullptr if the hub splitting is disabled, see
+   * graph_t::enable_hub_splitting).
+   */
+  detail::hub_split_t<vertex_t, edge_t> const* get_hub_split() const { return hub_split_.get(); }
+
+  edge_memory_placement_t get_edge_memory_placement() const { return edge_memory_placement_; }
+
+  /**
+   * @brief Return the maximum number of edges per tile if the prims sweeping over every edge
+   * should process the edges in tiles prefetching the next tile (if the edges are in managed
+   * memory, see graph_t::set_edge_memory_placement), std::nullopt otherwise.
+   */
+  std::optional<edge_t> get_edge_tile_size() const { return edge_tile_size_; }
+
  private:
+  template <typename, typename, typename, bool, bool, typename>
+  friend class graph_t;
+
+  // valid only if this view is obtained from a graph_t object holding a cached reversed graph
+  std::shared_ptr<graph_view_t const> reversed_view_{nullptr};
+
+  // valid only if this view is obtained from a graph_t object with the degree cache enabled
+  std::shared_ptr<detail::degree_cache_t<edge_t, weight_t>> degree_cache_{nullptr};
+
+  // valid only if this view is obtained from a graph_t object with the launch tuning enabled
+  std::shared_ptr<detail::launch_tuning_cache_t> launch_tuning_cache_{nullptr};
+
+  // valid only if this view is obtained from a graph_t object with the hub splitting enabled
+  std::shared_ptr<detail::hub_split_t<vertex_t, edge_t> const> hub_split_{nullptr};
+
+  edge_memory_placement_t edge_memory_placement_{edge_memory_placement_t::device};
+  std::optional<edge_t> edge_tile_size_{std::nullopt};
+
+  // if valid, edges with the unset bits are invisible to the prims (see attach_edge_mask())
+  std::optional<std::vector<uint32_t const*>> edge_mask_{std::nullopt};
+
   std::vector<edge_t const*> adj_matrix_partition_offsets_{};
   std::vector<vertex_t const*> adj_matrix_partition_indices_{};
   std::optional<std::vector<weight_t const*>> adj_matrix_partition_weights_{};
@@ -656,6 +974,11 @@ class graph_view_t<vertex_t,
   std::optional<vertex_t const*> local_sorted_unique_edge_col_first_{std::nullopt};
   std::optional<vertex_t const*> local_sorted_unique_edge_col_last_{std::nullopt};
   std::optional<std::vector<vertex_t>> local_sorted_unique_edge_col_offsets_{std::nullopt};
+
+  // if valid, minors are stored as 32 bit offsets from the local adjacency matrix partition minor
+  // first
+  std::optional<std::vector<uint32_t const*>> adj_matrix_partition_compressed_indices_{
+    std::nullopt};
 };
 
 // single-GPU version
@@ -821,7 +1144,15 @@ class graph_view_t<vertex_t,
   {
     assert(adj_matrix_partition_idx == 0);  // there is only one matrix partition in single-GPU
     return matrix_partition_view_t<vertex_t, edge_t, weight_t, false>(
-      offsets_, indices_, weights_, this->get_number_of_vertices(), this->get_number_of_edges());
+      offsets_,
+      indices_,
+      weights_,
+      this->get_number_of_vertices(),
+      this->get_number_of_edges(),
+      edge_mask_ ? std::optional<uint32_t const*>{(*edge_mask_)[0]} : std::nullopt,
+      dcs_nzd_vertices_,
+      dcs_nzd_vertex_count_,
+      packed_minors_);
   }
 
   rmm::device_uvector<edge_t> compute_in_degrees(raft::handle_t const& handle) const;
@@ -836,6 +1167,55 @@ class graph_view_t<vertex_t,
   weight_t compute_max_in_weight_sum(raft::handle_t const& handle) const;
   weight_t compute_max_out_weight_sum(raft::handle_t const& handle) const;
 
+  // see the multi-GPU version for the documentation of the degree cache related functions
+  std::optional<edge_t const*> get_cached_in_degrees(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_
+      ->get(handle, degree_cache_->in_degrees_, [&]() { return compute_in_degrees(handle); })
+      .data();
+  }
+
+  std::optional<edge_t const*> get_cached_out_degrees(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_
+      ->get(handle, degree_cache_->out_degrees_, [&]() { return compute_out_degrees(handle); })
+      .data();
+  }
+
+  std::optional<weight_t const*> get_cached_in_weight_sums(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_
+      ->get(
+        handle, degree_cache_->in_weight_sums_, [&]() { return compute_in_weight_sums(handle); })
+      .data();
+  }
+
+  std::optional<weight_t const*> get_cached_out_weight_sums(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_
+      ->get(
+        handle, degree_cache_->out_weight_sums_, [&]() { return compute_out_weight_sums(handle); })
+      .data();
+  }
+
+  std::optional<edge_t> get_cached_max_in_degree(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_->get(
+      handle, degree_cache_->max_in_degree_, [&]() { return compute_max_in_degree(handle); });
+  }
+
+  std::optional<edge_t> get_cached_max_out_degree(raft::handle_t const& handle) const
+  {
+    if (!degree_cache_ || edge_mask_) { return std::nullopt; }
+    return degree_cache_->get(
+      handle, degree_cache_->max_out_degree_, [&]() { return compute_max_out_degree(handle); });
+  }
+
   edge_t count_self_loops(raft::handle_t const& handle) const;
   edge_t count_multi_edges(raft::handle_t const& handle) const;
 
@@ -859,12 +1239,81 @@ class graph_view_t<vertex_t,
     return std::nullopt;
   }
 
+  // see the multi-GPU version for the documentation of the reversed view related functions
+  bool has_reversed_view() const
+  {
+    return this->is_symmetric() || (!edge_mask_ && (reversed_view_ != nullptr));
+  }
+
+  graph_view_t get_reversed_view() const
+  {
+    CUGRAPH_EXPECTS(has_reversed_view(),
+                    "Invalid input argument: reversed view is unavailable, call "
+                    "graph_t::add_reversed_graph first.");
+    return this->is_symmetric() ? *this : *reversed_view_;
+  }
+
+  // see the multi-GPU version for the documentation of the edge mask related functions
+  void attach_edge_mask(std::vector<uint32_t const*> const& edge_mask)
+  {
+    CUGRAPH_EXPECTS(edge_mask.size() == this->get_number_of_local_adj_matrix_partitions(),
+                    "Invalid input argument: edge_mask.size() does not match the number of local "
+                    "adjacency matrix partitions.");
+    edge_mask_ = edge_mask;
+  }
+
+  void clear_edge_mask() { edge_mask_ = std::nullopt; }
+
+  bool has_edge_mask() const { return edge_mask_.has_value(); }
+
+  std::optional<std::vector<uint32_t const*>> get_edge_mask() const { return edge_mask_; }
+
+  detail::launch_tuning_cache_t* get_launch_tuning_cache() const
+  {
+    return launch_tuning_cache_.get();
+  }
+
+  detail::hub_split_t<vertex_t, edge_t> const* get_hub_split() const { return hub_split_.get(); }
+
+  edge_memory_placement_t get_edge_memory_placement() const { return edge_memory_placement_; }
+
+  std::optional<edge_t> get_edge_tile_size() const { return edge_tile_size_; }
+
  private:
+  template <typename, typename, typename, bool, bool, typename>
+  friend class graph_t;
+
+  // valid only if this view is obtained from a graph_t object holding a cached reversed graph
+  std::shared_ptr<graph_view_t const> reversed_view_{nullptr};
+
+  // valid only if this view is obtained from a graph_t object with the degree cache enabled
+  std::shared_ptr<detail::degree_cache_t<edge_t, weight_t>> degree_cache_{nullptr};
+
+  // valid only if this view is obtained from a graph_t object with the launch tuning enabled
+  std::shared_ptr<detail::launch_tuning_cache_t> launch_tuning_cache_{nullptr};
+
+  // valid only if this view is obtained from a graph_t object with the hub splitting enabled
+  std::shared_ptr<detail::hub_split_t<vertex_t, edge_t> const> hub_split_{nullptr};
+
+  edge_memory_placement_t edge_memory_placement_{edge_memory_placement_t::device};
+  std::optional<edge_t> edge_tile_size_{std::nullopt};
+
+  // if valid, edges with the unset bits are invisible to the prims (see attach_edge_mask())
+  std::optional<std::vector<uint32_t const*>> edge_mask_{std::nullopt};
+
   edge_t const* offsets_{nullptr};
   vertex_t const* indices_{nullptr};
   std::optional<weight_t const*> weights_{std::nullopt};
 
-  // segment offsets based on vertex degree, relevant only if vertex IDs are renumbered
+  // relevant only if we use the CSR + DCSR (or CSC + DCSC) hybrid format (set by graph_t)
+  std::optional<vertex_t const*> dcs_nzd_vertices_{std::nullopt};
+  std::optional<vertex_t> dcs_nzd_vertex_count_{std::nullopt};
+
+  // if valid, the minors are bit-packed and indices_ is nullptr (set by graph_t)
+  std::optional<detail::packed_minors_view_t<vertex_t, edge_t>> packed_minors_{std::nullopt};
+
+  // segment offsets based on vertex degree, relevant only if vertex IDs are renumbered (or the
+  // graph uses the hypersparse format)
   std::optional<std::vector<vertex_t>> segment_offsets_{std::nullopt};
 };
 
@@ -21,10 +21,13 @@
 
 #include <thrust/binary_search.h>
 #include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/optional.h>
 #include <thrust/tuple.h>
 
 #include <cassert>
+#include <cstdint>
 #include <optional>
 #include <type_traits>
 
@@ -32,33 +35,124 @@ namespace cugraph {
 
 namespace detail {
 
+// returns the minor vertex ID of the i'th edge, minors are stored as vertex IDs (indices), as 32
+// bit offsets from minor_first (compressed_indices), or bit-packed in blocks of 32 edges
+// (packed_minors, see packed_minors_view_t); the edges of a block are decoded independently, so
+// consecutive threads reading consecutive edges read the same (few) words
+template <typename vertex_t, typename edge_t>
+struct minor_decoder_t {
+  vertex_t const* indices{nullptr};
+  uint32_t const* compressed_indices{nullptr};
+  vertex_t minor_first{0};
+  packed_minors_view_t<vertex_t, edge_t> packed_minors{};
+
+  __device__ vertex_t operator()(edge_t i) const
+  {
+    if (packed_minors.words != nullptr) {
+      auto block      = i / edge_t{32};
+      auto word_first = *(packed_minors.block_word_offsets + block);
+      auto width =
+        static_cast<uint32_t>(*(packed_minors.block_word_offsets + (block + 1)) - word_first);
+      auto base = *(packed_minors.block_bases + block);
+      if (width == 0) { return base; }
+      auto bit   = static_cast<uint32_t>(i % edge_t{32}) * width;
+      auto word  = packed_minors.words + (word_first + static_cast<edge_t>(bit / 32));
+      auto shift = bit % 32;
+      auto bits  = static_cast<uint64_t>(*word) >> shift;
+      if (shift + width > 32) { bits |= static_cast<uint64_t>(*(word + 1)) << (32 - shift); }
+      return base + static_cast<vertex_t>(bits & ((uint64_t{1} << width) - 1));
+    } else if (compressed_indices != nullptr) {
+      return minor_first + static_cast<vertex_t>(*(compressed_indices + i));
+    } else {
+      return *(indices + i);
+    }
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+using minor_iterator_t =
+  thrust::transform_iterator<minor_decoder_t<vertex_t, edge_t>, thrust::counting_iterator<edge_t>>;
+
+// the weight of the i'th local edge (1.0 if unweighted), has_weights is a compile time constant so
+// the kernels for unweighted graphs skip the weight loads and branches
+template <bool has_weights, typename weight_t, typename edge_t>
+__device__ weight_t get_edge_weight(thrust::optional<weight_t const*> weights, edge_t i)
+{
+  if constexpr (has_weights) {
+    return (*weights)[i];
+  } else {
+    return weight_t{1.0};
+  }
+}
+
+// invokes f with std::true_type if has_weights is true and std::false_type otherwise
+template <typename F>
+void dispatch_has_weights(bool has_weights, F&& f)
+{
+  if (has_weights) {
+    f(std::true_type{});
+  } else {
+    f(std::false_type{});
+  }
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 class matrix_partition_device_view_base_t {
  public:
   matrix_partition_device_view_base_t(edge_t const* offsets,
                                       vertex_t const* indices,
                                       std::optional<weight_t const*> weights,
-                                      edge_t number_of_edges)
+                                      edge_t number_of_edges,
+                                      std::optional<uint32_t const*> compressed_indices,
+                                      vertex_t minor_first,
+                                      std::optional<uint32_t const*> edge_mask,
+                                      std::optional<packed_minors_view_t<vertex_t, edge_t>>
+                                        packed_minors = std::nullopt)
     : offsets_(offsets),
-      indices_(indices),
       weights_(weights ? thrust::optional<weight_t const*>(*weights) : thrust::nullopt),
-      number_of_edges_(number_of_edges)
+      number_of_edges_(number_of_edges),
+      minor_decoder_{indices,
+                     compressed_indices ? *compressed_indices : nullptr,
+                     minor_first,
+                     packed_minors ? *packed_minors : packed_minors_view_t<vertex_t, edge_t>{}},
+      edge_mask_(edge_mask ? thrust::optional<uint32_t const*>(*edge_mask) : thrust::nullopt)
   {
   }
 
   __host__ __device__ edge_t get_number_of_edges() const { return number_of_edges_; }
 
   __host__ __device__ edge_t const* get_offsets() const { return offsets_; }
-  __host__ __device__ vertex_t const* get_indices() const { return indices_; }
+  // nullptr if minors are stored in the compressed (32 bit offset) or the bit-packed format, use
+  // get_minors() to access minors in any format
+  __host__ __device__ vertex_t const* get_indices() const { return minor_decoder_.indices; }
   __host__ __device__ thrust::optional<weight_t const*> get_weights() const { return weights_; }
+  __host__ __device__ thrust::optional<uint32_t const*> get_edge_mask() const { return edge_mask_; }
+
+  // edge_offset: offset of the edge in the edge storage order (get_local_offset(major_idx) + i for
+  // the i'th edge of a major), masked out edges should be skipped by the prims
+  __device__ bool is_valid_edge(edge_t edge_offset) const noexcept
+  {
+    if (!edge_mask_) { return true; }
+    auto word = *(*edge_mask_ + edge_offset / edge_t{32});
+    return ((word >> static_cast<uint32_t>(edge_offset % edge_t{32})) & uint32_t{1}) != 0;
+  }
+
+  // minors of every edge in this matrix partition (in the edge storage order)
+  __host__ __device__ minor_iterator_t<vertex_t, edge_t> get_minors() const
+  {
+    return thrust::make_transform_iterator(thrust::make_counting_iterator(edge_t{0}),
+                                           minor_decoder_);
+  }
 
   // major_idx == major offset if CSR/CSC, major_offset != major_idx if DCSR/DCSC
-  __device__ thrust::tuple<vertex_t const*, thrust::optional<weight_t const*>, edge_t>
-  get_local_edges(vertex_t major_idx) const noexcept
+  __device__ thrust::
+    tuple<minor_iterator_t<vertex_t, edge_t>, thrust::optional<weight_t const*>, edge_t>
+    get_local_edges(vertex_t major_idx) const noexcept
   {
     auto edge_offset  = *(offsets_ + major_idx);
     auto local_degree = *(offsets_ + (major_idx + 1)) - edge_offset;
-    auto indices      = indices_ + edge_offset;
+    auto indices =
+      thrust::make_transform_iterator(thrust::make_counting_iterator(edge_offset), minor_decoder_);
     auto weights =
       weights_ ? thrust::optional<weight_t const*>{*weights_ + edge_offset} : thrust::nullopt;
     return thrust::make_tuple(indices, weights, local_degree);
@@ -79,9 +173,10 @@ class matrix_partition_device_view_base_t {
  private:
   // should be trivially copyable to device
   edge_t const* offsets_{nullptr};
-  vertex_t const* indices_{nullptr};
   thrust::optional<weight_t const*> weights_{thrust::nullopt};
   edge_t number_of_edges_{0};
+  minor_decoder_t<vertex_t, edge_t> minor_decoder_{};
+  thrust::optional<uint32_t const*> edge_mask_{thrust::nullopt};
 };
 
 }  // namespace detail
@@ -105,7 +200,13 @@ class matrix_partition_device_view_t<vertex_t,
   matrix_partition_device_view_t(
     matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu> view)
     : detail::matrix_partition_device_view_base_t<vertex_t, edge_t, weight_t>(
-        view.get_offsets(), view.get_indices(), view.get_weights(), view.get_number_of_edges()),
+        view.get_offsets(),
+        view.get_indices(),
+        view.get_weights(),
+        view.get_number_of_edges(),
+        view.get_compressed_indices(),
+        view.get_minor_first(),
+        view.get_edge_mask()),
       dcs_nzd_vertices_(view.get_dcs_nzd_vertices()
                           ? thrust::optional<vertex_t const*>{*(view.get_dcs_nzd_vertices())}
                           : thrust::nullopt),
@@ -228,7 +329,20 @@ class matrix_partition_device_view_t<vertex_t,
   matrix_partition_device_view_t(
     matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu> view)
     : detail::matrix_partition_device_view_base_t<vertex_t, edge_t, weight_t>(
-        view.get_offsets(), view.get_indices(), view.get_weights(), view.get_number_of_edges()),
+        view.get_offsets(),
+        view.get_indices(),
+        view.get_weights(),
+        view.get_number_of_edges(),
+        std::nullopt,
+        vertex_t{0},
+        view.get_edge_mask(),
+        view.get_packed_minors()),
+      dcs_nzd_vertices_(view.get_dcs_nzd_vertices()
+                          ? thrust::optional<vertex_t const*>{*(view.get_dcs_nzd_vertices())}
+                          : thrust::nullopt),
+      dcs_nzd_vertex_count_(view.get_dcs_nzd_vertex_count()
+                              ? thrust::optional<vertex_t>{*(view.get_dcs_nzd_vertex_count())}
+                              : thrust::nullopt),
       number_of_vertices_(view.get_major_last())
   {
   }
@@ -267,16 +381,26 @@ class matrix_partition_device_view_t<vertex_t,
   __host__ __device__ thrust::optional<vertex_t> get_major_hypersparse_idx_from_major_nocheck(
     vertex_t major) const noexcept
   {
-    assert(false);
-    return thrust::nullopt;
+    if (dcs_nzd_vertices_) {
+      auto it = thrust::lower_bound(
+        thrust::seq, *dcs_nzd_vertices_, *dcs_nzd_vertices_ + *dcs_nzd_vertex_count_, major);
+      return it != *dcs_nzd_vertices_ + *dcs_nzd_vertex_count_
+               ? (*it == major ? thrust::optional<vertex_t>{static_cast<vertex_t>(
+                                   thrust::distance(*dcs_nzd_vertices_, it))}
+                               : thrust::nullopt)
+               : thrust::nullopt;
+    } else {
+      return thrust::nullopt;
+    }
   }
 
   // major_hypersparse_idx: index within the hypersparse segment
   __host__ __device__ thrust::optional<vertex_t> get_major_from_major_hypersparse_idx_nocheck(
     vertex_t major_hypersparse_idx) const noexcept
   {
-    assert(false);
-    return thrust::nullopt;
+    return dcs_nzd_vertices_
+             ? thrust::optional<vertex_t>{(*dcs_nzd_vertices_)[major_hypersparse_idx]}
+             : thrust::nullopt;
   }
 
   __host__ __device__ vertex_t
@@ -287,15 +411,20 @@ class matrix_partition_device_view_t<vertex_t,
 
   __host__ __device__ thrust::optional<vertex_t const*> get_dcs_nzd_vertices() const
   {
-    return thrust::nullopt;
+    return dcs_nzd_vertices_;
   }
 
   __host__ __device__ thrust::optional<vertex_t> get_dcs_nzd_vertex_count() const
   {
-    return thrust::nullopt;
+    return dcs_nzd_vertex_count_;
   }
 
  private:
+  // should be trivially copyable to device
+
+  thrust::optional<vertex_t const*> dcs_nzd_vertices_{thrust::nullopt};
+  thrust::optional<vertex_t> dcs_nzd_vertex_count_{thrust::nullopt};
+
   vertex_t number_of_vertices_;
 };
 
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <type_traits>
 
@@ -22,14 +23,29 @@ namespace cugraph {
 
 namespace detail {
 
+// minors bit-packed in blocks of 32 edges (in the edge storage order), the j'th edge of block b
+// stores minor - block_bases[b] in w = block_word_offsets[b + 1] - block_word_offsets[b] bits (32
+// edges x w bits fill w words) from bit j * w of the w words starting at block_word_offsets[b]
+template <typename vertex_t, typename edge_t>
+struct packed_minors_view_t {
+  uint32_t const* words{nullptr};
+  edge_t const* block_word_offsets{nullptr};  // size = # blocks + 1
+  vertex_t const* block_bases{nullptr};
+};
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 class matrix_partition_view_base_t {
  public:
   matrix_partition_view_base_t(edge_t const* offsets,
                                vertex_t const* indices,
                                std::optional<weight_t const*> weights,
-                               edge_t number_of_edges)
-    : offsets_(offsets), indices_(indices), weights_(weights), number_of_edges_(number_of_edges)
+                               edge_t number_of_edges,
+                               std::optional<uint32_t const*> edge_mask)
+    : offsets_(offsets),
+      indices_(indices),
+      weights_(weights),
+      number_of_edges_(number_of_edges),
+      edge_mask_(edge_mask)
   {
   }
 
@@ -39,11 +55,16 @@ class matrix_partition_view_base_t {
   vertex_t const* get_indices() const { return indices_; }
   std::optional<weight_t const*> get_weights() const { return weights_; }
 
+  // one bit per edge (in the edge storage order, bit i % 32 of word i / 32 for the i'th edge), an
+  // edge is valid (visible to the prims) if the bit is set, all edges are valid if not set
+  std::optional<uint32_t const*> get_edge_mask() const { return edge_mask_; }
+
  private:
   edge_t const* offsets_{nullptr};
   vertex_t const* indices_{nullptr};
   std::optional<weight_t const*> weights_{std::nullopt};
   edge_t number_of_edges_{0};
+  std::optional<uint32_t const*> edge_mask_{std::nullopt};
 };
 
 }  // namespace detail
@@ -70,9 +91,12 @@ class matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu, std::enable
                           vertex_t major_last,
                           vertex_t minor_first,
                           vertex_t minor_last,
-                          vertex_t major_value_start_offset)
+                          vertex_t major_value_start_offset,
+                          std::optional<uint32_t const*> compressed_indices = std::nullopt,
+                          std::optional<uint32_t const*> edge_mask          = std::nullopt)
     : detail::matrix_partition_view_base_t<vertex_t, edge_t, weight_t>(
-        offsets, indices, weights, number_of_matrix_partition_edges),
+        offsets, indices, weights, number_of_matrix_partition_edges, edge_mask),
+      compressed_indices_(compressed_indices),
       dcs_nzd_vertices_(dcs_nzd_vertices),
       dcs_nzd_vertex_count_(dcs_nzd_vertex_count),
       major_first_(major_first),
@@ -83,6 +107,13 @@ class matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu, std::enable
   {
   }
 
+  // minor - minor_first in 32 bit (in place of indices) if set
+  std::optional<uint32_t const*> get_compressed_indices() const { return compressed_indices_; }
+  std::optional<detail::packed_minors_view_t<vertex_t, edge_t>> get_packed_minors() const
+  {
+    return std::nullopt;
+  }
+
   std::optional<vertex_t const*> get_dcs_nzd_vertices() const { return dcs_nzd_vertices_; }
   std::optional<vertex_t> get_dcs_nzd_vertex_count() const { return dcs_nzd_vertex_count_; }
 
@@ -94,6 +125,8 @@ class matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu, std::enable
   vertex_t get_major_value_start_offset() const { return major_value_start_offset_; }
 
  private:
+  std::optional<uint32_t const*> compressed_indices_{std::nullopt};
+
   // relevant only if we use the CSR + DCSR (or CSC + DCSC) hybrid format
   std::optional<vertex_t const*> dcs_nzd_vertices_{};
   std::optional<vertex_t> dcs_nzd_vertex_count_{};
@@ -115,15 +148,30 @@ class matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu, std::enable
                           vertex_t const* indices,
                           std::optional<weight_t const*> weights,
                           vertex_t number_of_vertices,
-                          edge_t number_of_edges)
+                          edge_t number_of_edges,
+                          std::optional<uint32_t const*> edge_mask        = std::nullopt,
+                          std::optional<vertex_t const*> dcs_nzd_vertices = std::nullopt,
+                          std::optional<vertex_t> dcs_nzd_vertex_count    = std::nullopt,
+                          std::optional<detail::packed_minors_view_t<vertex_t, edge_t>>
+                            packed_minors = std::nullopt)
     : detail::matrix_partition_view_base_t<vertex_t, edge_t, weight_t>(
-        offsets, indices, weights, number_of_edges),
+        offsets, indices, weights, number_of_edges, edge_mask),
+      dcs_nzd_vertices_(dcs_nzd_vertices),
+      dcs_nzd_vertex_count_(dcs_nzd_vertex_count),
+      packed_minors_(packed_minors),
       number_of_vertices_(number_of_vertices)
   {
   }
 
-  std::optional<vertex_t const*> get_dcs_nzd_vertices() const { return std::nullopt; }
-  std::optional<vertex_t> get_dcs_nzd_vertex_count() const { return std::nullopt; }
+  std::optional<uint32_t const*> get_compressed_indices() const { return std::nullopt; }
+  // bit-packed minors (in place of indices) if set (see graph_t::pack_minors)
+  std::optional<detail::packed_minors_view_t<vertex_t, edge_t>> get_packed_minors() const
+  {
+    return packed_minors_;
+  }
+
+  std::optional<vertex_t const*> get_dcs_nzd_vertices() const { return dcs_nzd_vertices_; }
+  std::optional<vertex_t> get_dcs_nzd_vertex_count() const { return dcs_nzd_vertex_count_; }
 
   vertex_t get_major_first() const { return vertex_t{0}; }
   vertex_t get_major_last() const { return number_of_vertices_; }
@@ -131,6 +179,13 @@ class matrix_partition_view_t<vertex_t, edge_t, weight_t, multi_gpu, std::enable
   vertex_t get_minor_last() const { return number_of_vertices_; }
 
  private:
+  // relevant only if we use the CSR + DCSR (or CSC + DCSC) hybrid format (see
+  // graph_meta_t::use_dcs)
+  std::optional<vertex_t const*> dcs_nzd_vertices_{};
+  std::optional<vertex_t> dcs_nzd_vertex_count_{};
+
+  std::optional<detail::packed_minors_view_t<vertex_t, edge_t>> packed_minors_{std::nullopt};
+
   vertex_t number_of_vertices_{0};
 };
 
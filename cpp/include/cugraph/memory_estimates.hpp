@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file memory_estimates.hpp
+ * @brief Analytical estimates of the device memory used by graph objects and by the working sets
+ * of the graph algorithms, to pack jobs on a GPU or to pick the number of GPUs of a multi-GPU job
+ * before allocating anything.
+ *
+ * The algorithm estimates are the peak (per GPU in multi-GPU) of the dominant temporary
+ * allocations of a call, excluding the input graph and the output arrays allocated by the caller.
+ * The data dependent buffers (e.g. the BFS frontier) are sized for the worst case, so the
+ * estimates are upper-bound oriented; they do not account for the memory allocator's fragmentation
+ * and the small (O(# GPUs) or O(# segments)) buffers. Use graph_t::get_memory_footprint() for the
+ * memory of an existing graph object.
+ */
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename GraphViewType>
+size_t get_number_of_local_edges(GraphViewType const& graph_view)
+{
+  size_t ret{0};
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    ret += static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_edges(i));
+  }
+  return ret;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Estimate the per-GPU device memory (in bytes) of a graph_t object with the given global
+ * sizes (before creating it, the DCS and the 32 bit compressed index savings are ignored).
+ *
+ * @tparam vertex_t Type of vertex identifiers.
+ * @tparam edge_t Type of edge identifiers.
+ * @tparam weight_t Type of edge weights.
+ * @param num_vertices Number of vertices in the graph.
+ * @param num_edges Number of edges in the graph.
+ * @param is_weighted Flag indicating whether the graph has edge weights.
+ * @param comm_size Number of GPUs (1 for single-GPU).
+ * @param row_comm_size Size of the row communicator of the 2D partitioning (should divide @p
+ * comm_size).
+ * @return size_t Estimated device memory per GPU.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+size_t estimate_graph_memory_size(vertex_t num_vertices,
+                                  edge_t num_edges,
+                                  bool is_weighted,
+                                  int comm_size     = 1,
+                                  int row_comm_size = 1)
+{
+  CUGRAPH_EXPECTS((comm_size > 0) && (row_comm_size > 0) && (comm_size % row_comm_size == 0),
+                  "Invalid input argument: row_comm_size should divide comm_size.");
+
+  auto const col_comm_size = static_cast<size_t>(comm_size / row_comm_size);
+  // a GPU stores col_comm_size matrix partitions covering V / row_comm_size majors in total
+  auto const num_local_majors =
+    (static_cast<size_t>(num_vertices) + row_comm_size - 1) / static_cast<size_t>(row_comm_size);
+  auto const num_local_edges =
+    (static_cast<size_t>(num_edges) + comm_size - 1) / static_cast<size_t>(comm_size);
+
+  return (num_local_majors + col_comm_size) * sizeof(edge_t) +
+         num_local_edges * (sizeof(vertex_t) + (is_weighted ? sizeof(weight_t) : size_t{0}));
+}
+
+/**
+ * @brief Estimate the per-GPU peak device memory (in bytes) of creating a graph_t object from an
+ * edge list with the given global sizes (create_graph_from_edgelist), including the edge list
+ * (owned by the caller) and the created graph.
+ *
+ * The edge list is shuffled (in multi-GPU) and then compressed to the graph, each step holds the
+ * input and the output at the same time.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+size_t estimate_graph_construction_memory_size(vertex_t num_vertices,
+                                               edge_t num_edges,
+                                               bool is_weighted,
+                                               int comm_size     = 1,
+                                               int row_comm_size = 1)
+{
+  auto const num_local_edges =
+    (static_cast<size_t>(num_edges) + comm_size - 1) / static_cast<size_t>(comm_size);
+  auto const edgelist_size =
+    num_local_edges * (2 * sizeof(vertex_t) + (is_weighted ? sizeof(weight_t) : size_t{0}));
+  auto const graph_size = estimate_graph_memory_size<vertex_t, edge_t, weight_t>(
+    num_vertices, num_edges, is_weighted, comm_size, row_comm_size);
+
+  return edgelist_size + std::max(comm_size > 1 ? edgelist_size : size_t{0}, graph_size);
+}
+
+/**
+ * @brief Estimate the peak working memory (in bytes, per GPU in multi-GPU) of pagerank (excluding
+ * the input graph and the output PageRank values).
+ *
+ * @tparam result_t Type of PageRank values.
+ * @param graph_view Graph view object of the input graph (should store the transposed adjacency
+ * matrix).
+ * @param has_precomputed_vertex_out_weight_sums Flag indicating whether the caller passes the
+ * vertex out weight sums (or the graph caches them, see graph_t::enable_degree_cache).
+ * @param has_personalization Flag indicating whether the personalized PageRank is computed.
+ * @return size_t Estimated peak working memory.
+ */
+template <typename result_t, typename GraphViewType>
+size_t estimate_pagerank_memory_size(GraphViewType const& graph_view,
+                                     bool has_precomputed_vertex_out_weight_sums = false,
+                                     bool has_personalization                    = false)
+{
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const num_local_vertices = static_cast<size_t>(graph_view.get_number_of_local_vertices());
+  auto const num_rows =
+    static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_rows());
+
+  // tmp_pageranks & scaled_pageranks, and the PageRank values of the adjacency matrix rows
+  size_t ret = 2 * num_local_vertices * sizeof(result_t) + num_rows * sizeof(result_t);
+  if (!has_precomputed_vertex_out_weight_sums) {
+    ret += num_local_vertices * sizeof(weight_t);
+  }
+  if (has_personalization) { ret += num_local_vertices * sizeof(result_t); }
+  if (GraphViewType::is_multi_gpu) {
+    // the per-partition in-neighbor reduction buffer reduced over the column communicator
+    auto const num_cols =
+      static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_cols());
+    auto const num_partitions = graph_view.get_number_of_local_adj_matrix_partitions();
+    ret += ((num_cols + num_partitions - 1) / num_partitions) * sizeof(result_t);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Estimate the peak working memory (in bytes, per GPU in multi-GPU) of bfs (excluding the
+ * input graph and the output distances & predecessors).
+ *
+ * The frontier expansion buffers are sized for the case where every local edge reaches an
+ * unvisited vertex in a single iteration.
+ *
+ * @param graph_view Graph view object of the input graph (should not store the transposed
+ * adjacency matrix).
+ * @param direction_optimizing Flag indicating whether the direction optimizing BFS is used.
+ * @return size_t Estimated peak working memory.
+ */
+template <typename GraphViewType>
+size_t estimate_bfs_memory_size(GraphViewType const& graph_view, bool direction_optimizing = false)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  auto const num_local_vertices = static_cast<size_t>(graph_view.get_number_of_local_vertices());
+  auto const num_rows =
+    static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_rows());
+  auto const num_cols =
+    static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_cols());
+  auto const num_local_edges = detail::get_number_of_local_edges(graph_view);
+
+  // the two frontier buckets and the visited flags of the adjacency matrix columns
+  size_t ret = 2 * num_local_vertices * sizeof(vertex_t) + num_cols * sizeof(uint8_t);
+  // the (vertex, predecessor) pairs pushed by a frontier expansion (and their shuffled copies)
+  ret += num_local_edges * 2 * sizeof(vertex_t) * (GraphViewType::is_multi_gpu ? 2 : 1);
+  if (direction_optimizing) {
+    // out-degrees (if not cached), the bottom-up step's frontier flags, parents, and row/column
+    // flags
+    ret += num_local_vertices * (sizeof(edge_t) + sizeof(uint8_t) + sizeof(vertex_t)) +
+           (num_rows + num_cols) * sizeof(uint8_t);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Estimate the peak working memory (in bytes, per GPU in multi-GPU) of louvain (excluding
+ * the input graph and the output clustering).
+ *
+ * The first level dominates (the number of vertices and edges never increases), the peak is the
+ * larger of the local moving phase and the graph coarsening phase.
+ *
+ * @param graph_view Graph view object of the input graph (should be symmetric and should not store
+ * the transposed adjacency matrix).
+ * @return size_t Estimated peak working memory.
+ */
+template <typename GraphViewType>
+size_t estimate_louvain_memory_size(GraphViewType const& graph_view)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const num_local_vertices = static_cast<size_t>(graph_view.get_number_of_local_vertices());
+  auto const num_rows =
+    static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_rows());
+  auto const num_cols =
+    static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_cols());
+  auto const num_local_edges = detail::get_number_of_local_edges(graph_view);
+
+  // dendrogram (the levels sum to less than twice the first level), cluster keys & weights, vertex
+  // weights, next & previous clusters, old cluster sums & subtracts, vertex cluster weights, and
+  // the active vertex flags
+  size_t persistent =
+    num_local_vertices * (5 * sizeof(vertex_t) + 4 * sizeof(weight_t) + sizeof(uint8_t));
+  if (GraphViewType::is_multi_gpu) {
+    // row & column caches of the above
+    persistent += num_rows * (sizeof(vertex_t) + 4 * sizeof(weight_t) + sizeof(uint8_t)) +
+                  num_cols * sizeof(vertex_t);
+  }
+
+  // (major, cluster, weight) triplets of the per-edge neighbor cluster aggregation and the sorted
+  // copies
+  auto const local_moving = 2 * num_local_edges * (2 * sizeof(vertex_t) + sizeof(weight_t));
+  // decompressed & relabeled edge list and the coarsened graph (at most as large as the input)
+  auto const coarsening =
+    num_local_edges * (3 * sizeof(vertex_t) + 2 * sizeof(weight_t)) +
+    (num_rows + graph_view.get_number_of_local_adj_matrix_partitions()) * sizeof(edge_t);
+
+  return persistent + std::max(local_moving, coarsening);
+}
+
+}  // namespace cugraph
@@ -16,12 +16,24 @@
 
 #pragma once
 
+#include <cugraph/utilities/error.hpp>
+
 #include <raft/comms/comms.hpp>
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <unistd.h>
 
+#include <algorithm>
 #include <cassert>
+#include <climits>
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -54,6 +66,65 @@ struct key_naming_t {
 using pair_comms_t =
   std::pair<std::shared_ptr<raft::comms::comms_t>, std::shared_ptr<raft::comms::comms_t>>;
 
+// the sub-communicator to be kept within a node (an NVLink/NVSwitch domain), the other
+// sub-communicator crosses the nodes
+enum class intra_node_subcomm_t { none, row, col };
+
+namespace detail {
+
+// returns the node ID of every rank (ranks with the same host name are assumed to be connected by
+// NVLink/NVSwitch)
+inline std::vector<int64_t> detect_node_ids(raft::comms::comms_t const& communicator,
+                                            cudaStream_t stream)
+{
+  char host_name[HOST_NAME_MAX + 1]{};
+  CUGRAPH_EXPECTS(gethostname(host_name, sizeof(host_name) - 1) == 0, "gethostname() failure.");
+  auto node_id = static_cast<int64_t>(std::hash<std::string>{}(std::string(host_name)));
+
+  auto const comm_size = communicator.get_size();
+  auto const comm_rank = communicator.get_rank();
+  rmm::device_uvector<int64_t> d_node_ids(comm_size, stream);
+  raft::update_device(d_node_ids.data() + comm_rank, &node_id, 1, stream);
+  communicator.allgather(d_node_ids.data() + comm_rank, d_node_ids.data(), 1, stream);
+  std::vector<int64_t> node_ids(comm_size);
+  raft::update_host(node_ids.data(), d_node_ids.data(), comm_size, stream);
+  auto status = communicator.sync_stream(stream);
+  CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+
+  return node_ids;
+}
+
+// returns the new rank of every rank, ranks in the same node are placed in the same row
+// sub-communicator (new rank / row_size) or the same column sub-communicator (new rank % row_size)
+// if possible; a node straddles sub-communicators if its number of ranks is not a multiple of the
+// sub-communicator size
+template <typename node_id_t>
+std::vector<int> compute_topology_aware_ranks(std::vector<node_id_t> const& node_ids,
+                                              int row_size,
+                                              intra_node_subcomm_t intra_node_subcomm)
+{
+  auto const comm_size = static_cast<int>(node_ids.size());
+  auto const col_size  = comm_size / row_size;
+
+  // the ranks grouped by node (in the rank order within a node)
+  std::vector<int> old_ranks(comm_size);
+  std::iota(old_ranks.begin(), old_ranks.end(), int{0});
+  std::stable_sort(old_ranks.begin(), old_ranks.end(), [&node_ids](auto lhs, auto rhs) {
+    return node_ids[lhs] < node_ids[rhs];
+  });
+
+  std::vector<int> new_ranks(comm_size);
+  for (int i = 0; i < comm_size; ++i) {
+    new_ranks[old_ranks[i]] = intra_node_subcomm == intra_node_subcomm_t::col
+                                ? (i % col_size) * row_size + i / col_size
+                                : i;
+  }
+
+  return new_ranks;
+}
+
+}  // namespace detail
+
 // FIXME: This class is a misnomer since the python layer is currently
 // responsible for creating and managing partitioning. Consider renaming it or
 // refactoring it away.
@@ -65,12 +136,24 @@ using pair_comms_t =
 // naming policy defaults to simplified naming:
 // one key per row subcomms, one per column subcomms;
 //
+// if intra_node_subcomm is not none, the ranks are re-numbered (the handle's communicator is
+// replaced with a re-ranked one, so this should precede creating any distributed data) to keep the
+// selected sub-communicator (the one with the heavier traffic for the target algorithms) within a
+// node and have the other one cross the nodes; node_ids (the node ID of every rank) is detected
+// from the host names if not provided;
+//
 template <typename name_policy_t = key_naming_t, typename size_type = int>
 class subcomm_factory_t {
  public:
-  subcomm_factory_t(raft::handle_t& handle, size_type row_size)
+  subcomm_factory_t(raft::handle_t& handle,
+                    size_type row_size,
+                    intra_node_subcomm_t intra_node_subcomm = intra_node_subcomm_t::none,
+                    std::optional<std::vector<int64_t>> node_ids = std::nullopt)
     : handle_(handle), row_size_(row_size)
   {
+    if (intra_node_subcomm != intra_node_subcomm_t::none) {
+      rerank_by_topology(intra_node_subcomm, std::move(node_ids));
+    }
     init_row_col_comms();
   }
   virtual ~subcomm_factory_t(void) {}
@@ -99,6 +182,32 @@ class subcomm_factory_t {
     row_col_subcomms_.second = col_comm;
   }
 
+  void rerank_by_topology(intra_node_subcomm_t intra_node_subcomm,
+                          std::optional<std::vector<int64_t>> node_ids)
+  {
+    raft::comms::comms_t const& communicator = handle_.get_comms();
+
+    auto const comm_size = communicator.get_size();
+    CUGRAPH_EXPECTS(comm_size % row_size_ == 0,
+                    "Invalid input argument: row_size should divide the number of ranks.");
+    if (node_ids) {
+      CUGRAPH_EXPECTS(node_ids->size() == static_cast<size_t>(comm_size),
+                      "Invalid input argument: node_ids should have one ID per rank.");
+    } else {
+      node_ids = detail::detect_node_ids(communicator, handle_.get_stream());
+    }
+
+    auto new_ranks = detail::compute_topology_aware_ranks(
+      *node_ids, static_cast<int>(row_size_), intra_node_subcomm);
+    std::vector<int> identity(comm_size);
+    std::iota(identity.begin(), identity.end(), int{0});
+    if (new_ranks != identity) {
+      auto reranked_comm = std::make_shared<raft::comms::comms_t>(
+        communicator.comm_split(0, new_ranks[communicator.get_rank()]));
+      handle_.set_comms(reranked_comm);
+    }
+  }
+
  private:
   raft::handle_t& handle_;
   size_type row_size_;
@@ -23,22 +23,29 @@
 #include <cugraph/utilities/device_comm.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 #include <cugraph/utilities/thrust_tuple_utils.cuh>
 #include <cugraph/vertex_partition_device_view.cuh>
 
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
+#include <thrust/transform.h>
 
 #include <algorithm>
 #include <numeric>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace cugraph {
 
@@ -433,6 +440,142 @@ void copy_to_matrix_minor(raft::handle_t const& handle,
   }
 }
 
+// packs num_flags flags (values convertible to bool) 32 per word
+template <typename FlagIterator>
+void pack_bools(raft::handle_t const& handle,
+                FlagIterator flag_first,
+                size_t num_flags,
+                uint32_t* word_first)
+{
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(packed_bool_size(num_flags)),
+                    word_first,
+                    [flag_first, num_flags] __device__(size_t w) {
+                      auto first = w * packed_bools_per_word;
+                      auto last  = thrust::min(first + packed_bools_per_word, num_flags);
+                      uint32_t word{0};
+                      for (auto i = first; i < last; ++i) {
+                        if (static_cast<bool>(*(flag_first + i))) {
+                          word |= uint32_t{1} << (i - first);
+                        }
+                      }
+                      return word;
+                    });
+}
+
+// gathers the packed flags of every rank in comm (rx_counts[i] flags from rank i) back to back,
+// only the packed words are communicated
+template <typename FlagIterator>
+void allgather_packed_bools(raft::handle_t const& handle,
+                            raft::comms::comms_t const& comm,
+                            FlagIterator flag_first,
+                            std::vector<size_t> const& rx_counts,
+                            uint32_t* output_word_first)
+{
+  auto const comm_rank = comm.get_rank();
+  auto const comm_size = comm.get_size();
+
+  std::vector<size_t> rx_word_counts(comm_size, size_t{0});
+  std::vector<size_t> rx_word_displacements(comm_size, size_t{0});
+  std::vector<size_t> rx_displacements(comm_size, size_t{0});
+  bool word_aligned{true};
+  for (int i = 0; i < comm_size; ++i) {
+    rx_word_counts[i] = packed_bool_size(rx_counts[i]);
+    if (i > 0) {
+      rx_word_displacements[i] = rx_word_displacements[i - 1] + rx_word_counts[i - 1];
+      rx_displacements[i]      = rx_displacements[i - 1] + rx_counts[i - 1];
+    }
+    if ((i < comm_size - 1) && (rx_counts[i] % packed_bools_per_word != 0)) {
+      word_aligned = false;
+    }
+  }
+  auto num_flags = rx_displacements.back() + rx_counts.back();
+
+  rmm::device_uvector<uint32_t> tx_words(rx_word_counts[comm_rank], handle.get_stream());
+  pack_bools(handle, flag_first, rx_counts[comm_rank], tx_words.data());
+
+  if (word_aligned) {  // the packed words of the ranks are already back to back
+    device_allgatherv(comm,
+                      tx_words.begin(),
+                      output_word_first,
+                      rx_word_counts,
+                      rx_word_displacements,
+                      handle.get_stream());
+    return;
+  }
+
+  rmm::device_uvector<uint32_t> rx_words(rx_word_displacements.back() + rx_word_counts.back(),
+                                         handle.get_stream());
+  device_allgatherv(comm,
+                    tx_words.begin(),
+                    rx_words.begin(),
+                    rx_word_counts,
+                    rx_word_displacements,
+                    handle.get_stream());
+
+  rmm::device_uvector<size_t> d_rx_displacements(comm_size, handle.get_stream());
+  rmm::device_uvector<size_t> d_rx_word_displacements(comm_size, handle.get_stream());
+  raft::update_device(
+    d_rx_displacements.data(), rx_displacements.data(), comm_size, handle.get_stream());
+  raft::update_device(
+    d_rx_word_displacements.data(), rx_word_displacements.data(), comm_size, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(packed_bool_size(num_flags)),
+    output_word_first,
+    [rx_words              = rx_words.data(),
+     rx_displacements      = d_rx_displacements.data(),
+     rx_word_displacements = d_rx_word_displacements.data(),
+     comm_size,
+     num_flags] __device__(size_t w) {
+      auto first = w * packed_bools_per_word;
+      auto last  = thrust::min(first + packed_bools_per_word, num_flags);
+      uint32_t word{0};
+      for (auto i = first; i < last; ++i) {
+        auto it =
+          thrust::upper_bound(thrust::seq, rx_displacements, rx_displacements + comm_size, i);
+        auto r   = thrust::distance(rx_displacements, it) - 1;
+        auto bit = i - rx_displacements[r];
+        if ((rx_words[rx_word_displacements[r] + bit / packed_bools_per_word] >>
+             (bit % packed_bools_per_word)) &
+            uint32_t{1}) {
+          word |= uint32_t{1} << (i - first);
+        }
+      }
+      return word;
+    });
+}
+
+template <bool major, typename GraphViewType, typename VertexValueInputIterator>
+void copy_to_matrix_packed_bools(raft::handle_t const& handle,
+                                 GraphViewType const& graph_view,
+                                 VertexValueInputIterator vertex_value_input_first,
+                                 uint32_t* output_word_first)
+{
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto const row_comm_rank = row_comm.get_rank();
+    auto const row_comm_size = row_comm.get_size();
+    auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    auto const col_comm_rank = col_comm.get_rank();
+
+    auto& comm = major ? col_comm : row_comm;
+    std::vector<size_t> rx_counts(comm.get_size(), size_t{0});
+    for (int i = 0; i < comm.get_size(); ++i) {
+      rx_counts[i] = graph_view.get_vertex_partition_size(
+        major ? i * row_comm_size + row_comm_rank : col_comm_rank * row_comm_size + i);
+    }
+    allgather_packed_bools(handle, comm, vertex_value_input_first, rx_counts, output_word_first);
+  } else {
+    pack_bools(handle,
+               vertex_value_input_first,
+               static_cast<size_t>(graph_view.get_number_of_local_vertices()),
+               output_word_first);
+  }
+}
+
 }  // namespace detail
 
 /**
@@ -461,6 +604,8 @@ void copy_to_adj_matrix_row(
                    typename std::iterator_traits<VertexValueInputIterator>::value_type>&
     adj_matrix_row_value_output)
 {
+  nvtx_range_t range("copy_to_adj_matrix_row");
+
   if constexpr (GraphViewType::is_adj_matrix_transposed) {
     copy_to_matrix_minor(handle, graph_view, vertex_value_input_first, adj_matrix_row_value_output);
   } else {
@@ -503,6 +648,8 @@ void copy_to_adj_matrix_row(
                    typename std::iterator_traits<VertexValueInputIterator>::value_type>&
     adj_matrix_row_value_output)
 {
+  nvtx_range_t range("copy_to_adj_matrix_row");
+
   if constexpr (GraphViewType::is_adj_matrix_transposed) {
     copy_to_matrix_minor(handle,
                          graph_view,
@@ -546,6 +693,8 @@ void copy_to_adj_matrix_col(
                    typename std::iterator_traits<VertexValueInputIterator>::value_type>&
     adj_matrix_col_value_output)
 {
+  nvtx_range_t range("copy_to_adj_matrix_col");
+
   if constexpr (GraphViewType::is_adj_matrix_transposed) {
     copy_to_matrix_major(handle, graph_view, vertex_value_input_first, adj_matrix_col_value_output);
   } else {
@@ -588,6 +737,8 @@ void copy_to_adj_matrix_col(
                    typename std::iterator_traits<VertexValueInputIterator>::value_type>&
     adj_matrix_col_value_output)
 {
+  nvtx_range_t range("copy_to_adj_matrix_col");
+
   if constexpr (GraphViewType::is_adj_matrix_transposed) {
     copy_to_matrix_major(handle,
                          graph_view,
@@ -605,4 +756,196 @@ void copy_to_adj_matrix_col(
   }
 }
 
+/**
+ * @brief Copy vertex boolean flags to the corresponding packed graph adjacency matrix row property
+ * variables.
+ *
+ * This version fills the entire set of graph adjacency matrix row property values; only the
+ * packed bits (a bit per vertex) are communicated in multi-GPU.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for vertex flags (convertible to bool).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_input_first Iterator pointing to the vertex flags for the first (inclusive)
+ * vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive) is deduced
+ * as @p vertex_value_input_first + @p graph_view.get_number_of_local_vertices().
+ * @param adj_matrix_row_value_output Wrapper used to access data storage to copy row flags (for the
+ * rows assigned to this process in multi-GPU).
+ */
+template <typename GraphViewType, typename VertexValueInputIterator>
+void copy_to_adj_matrix_row(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexValueInputIterator vertex_value_input_first,
+  row_packed_bool_properties_t<GraphViewType>& adj_matrix_row_value_output)
+{
+  nvtx_range_t range("copy_to_adj_matrix_row");
+
+  detail::copy_to_matrix_packed_bools<!GraphViewType::is_adj_matrix_transposed>(
+    handle, graph_view, vertex_value_input_first, adj_matrix_row_value_output.value_data());
+}
+
+/**
+ * @brief Copy vertex boolean flags to the corresponding packed graph adjacency matrix column
+ * property variables.
+ *
+ * This version fills the entire set of graph adjacency matrix column property values; only the
+ * packed bits (a bit per vertex) are communicated in multi-GPU.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for vertex flags (convertible to bool).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_input_first Iterator pointing to the vertex flags for the first (inclusive)
+ * vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive) is deduced
+ * as @p vertex_value_input_first + @p graph_view.get_number_of_local_vertices().
+ * @param adj_matrix_col_value_output Wrapper used to access data storage to copy column flags (for
+ * the columns assigned to this process in multi-GPU).
+ */
+template <typename GraphViewType, typename VertexValueInputIterator>
+void copy_to_adj_matrix_col(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexValueInputIterator vertex_value_input_first,
+  col_packed_bool_properties_t<GraphViewType>& adj_matrix_col_value_output)
+{
+  nvtx_range_t range("copy_to_adj_matrix_col");
+
+  detail::copy_to_matrix_packed_bools<GraphViewType::is_adj_matrix_transposed>(
+    handle, graph_view, vertex_value_input_first, adj_matrix_col_value_output.value_data());
+}
+
+namespace detail {
+
+template <typename GraphViewType, typename T, bool row>
+class incremental_properties_t {
+ public:
+  using properties_type = std::conditional_t<row,
+                                             row_properties_t<GraphViewType, T>,
+                                             col_properties_t<GraphViewType, T>>;
+  using value_type      = T;
+
+  incremental_properties_t()
+    : last_synced_values_(allocate_dataframe_buffer<T>(0, rmm::cuda_stream_view{}))
+  {
+  }
+
+  incremental_properties_t(raft::handle_t const& handle, GraphViewType const& graph_view)
+    : properties_(handle, graph_view),
+      last_synced_values_(allocate_dataframe_buffer<T>(0, handle.get_stream()))
+  {
+  }
+
+  template <typename VertexValueInputIterator>
+  void sync(raft::handle_t const& handle,
+            GraphViewType const& graph_view,
+            VertexValueInputIterator vertex_value_input_first)
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+
+    auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+    rmm::device_uvector<vertex_t> changed_vertices(0, handle.get_stream());
+    auto dense = !synced_;
+    if (synced_) {
+      changed_vertices.resize(num_local_vertices, handle.get_stream());
+      changed_vertices.resize(
+        thrust::distance(
+          changed_vertices.begin(),
+          thrust::copy_if(
+            handle.get_thrust_policy(),
+            thrust::make_counting_iterator(graph_view.get_local_vertex_first()),
+            thrust::make_counting_iterator(graph_view.get_local_vertex_last()),
+            changed_vertices.begin(),
+            [vertex_value_input_first,
+             last_synced_value_first = get_dataframe_buffer_cbegin(last_synced_values_),
+             local_vertex_first      = graph_view.get_local_vertex_first()] __device__(auto v) {
+              auto offset = v - local_vertex_first;
+              return *(vertex_value_input_first + offset) != *(last_synced_value_first + offset);
+            })),
+        handle.get_stream());
+      auto num_changed = changed_vertices.size();
+      if constexpr (GraphViewType::is_multi_gpu) {
+        num_changed = host_scalar_allreduce(
+          handle.get_comms(), num_changed, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (num_changed == 0) { return; }
+      // a sparse copy sends the vertex IDs as well
+      dense = num_changed * (sizeof(vertex_t) + sizeof(T)) >=
+              static_cast<size_t>(graph_view.get_number_of_vertices()) * sizeof(T);
+    }
+
+    if (dense) {
+      if constexpr (row) {
+        copy_to_adj_matrix_row(handle, graph_view, vertex_value_input_first, properties_);
+      } else {
+        copy_to_adj_matrix_col(handle, graph_view, vertex_value_input_first, properties_);
+      }
+    } else {
+      if constexpr (row) {
+        copy_to_adj_matrix_row(handle,
+                               graph_view,
+                               changed_vertices.begin(),
+                               changed_vertices.end(),
+                               vertex_value_input_first,
+                               properties_);
+      } else {
+        copy_to_adj_matrix_col(handle,
+                               graph_view,
+                               changed_vertices.begin(),
+                               changed_vertices.end(),
+                               vertex_value_input_first,
+                               properties_);
+      }
+    }
+
+    resize_dataframe_buffer(last_synced_values_, num_local_vertices, handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 vertex_value_input_first,
+                 vertex_value_input_first + num_local_vertices,
+                 get_dataframe_buffer_begin(last_synced_values_));
+    synced_ = true;
+  }
+
+  void invalidate() { synced_ = false; }
+
+  auto device_view() const { return properties_.device_view(); }
+
+ private:
+  properties_type properties_{};
+
+  decltype(allocate_dataframe_buffer<T>(0, rmm::cuda_stream_view{})) last_synced_values_;
+  bool synced_{false};
+};
+
+}  // namespace detail
+
+/**
+ * @brief Graph adjacency matrix row property cache that tracks the vertex property values it was
+ * last synchronized with.
+ *
+ * sync() copies only the vertex property values that changed since the last sync (with the vertex
+ * list version of copy_to_adj_matrix_row) and falls back to the full copy if the sparse copy would
+ * send more data (a sparse copy sends the vertex IDs as well), or on the first sync. This costs a
+ * local copy of the vertex property values.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam T Type of the property values.
+ */
+template <typename GraphViewType, typename T>
+using incremental_row_properties_t = detail::incremental_properties_t<GraphViewType, T, true>;
+
+/**
+ * @brief Graph adjacency matrix column property cache that tracks the vertex property values it
+ * was last synchronized with (see incremental_row_properties_t).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam T Type of the property values.
+ */
+template <typename GraphViewType, typename T>
+using incremental_col_properties_t = detail::incremental_properties_t<GraphViewType, T, false>;
+
 }  // namespace cugraph
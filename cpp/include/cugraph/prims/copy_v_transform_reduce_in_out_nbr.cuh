@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cugraph/detail/edge_tiles.cuh>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/matrix_partition_device_view.cuh>
 #include <cugraph/prims/property_op_utils.cuh>
@@ -23,6 +24,8 @@
 #include <cugraph/utilities/dataframe_buffer.cuh>
 #include <cugraph/utilities/device_comm.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 
 #include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
@@ -30,13 +33,21 @@
 
 #include <thrust/distance.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 #include <thrust/type_traits/integer_sequence.h>
 #include <cub/cub.cuh>
 
+#include <limits>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
+#include <vector>
 
 namespace cugraph {
 
@@ -44,7 +55,94 @@ namespace detail {
 
 int32_t constexpr copy_v_transform_reduce_nbr_for_all_block_size = 512;
 
+// default launch configurations (before tuning) for the high, mid, low degree segments and the
+// hypersparse segment (if exists)
+inline std::vector<launch_config_t> default_segment_launch_configs(size_t num_segments)
+{
+  std::vector<launch_config_t> configs{
+    launch_config_t{2, copy_v_transform_reduce_nbr_for_all_block_size},
+    launch_config_t{1, copy_v_transform_reduce_nbr_for_all_block_size},
+    launch_config_t{0, copy_v_transform_reduce_nbr_for_all_block_size},
+    launch_config_t{0, copy_v_transform_reduce_nbr_for_all_block_size}};
+  configs.resize(num_segments);
+  return configs;
+}
+
+// candidate launch configurations to benchmark for the segment_idx'th segment; every candidate
+// block size should be a multiple of the warp size and should not exceed
+// copy_v_transform_reduce_nbr_for_all_block_size (the size of the shared memory arrays)
+inline std::vector<launch_config_t> segment_launch_config_candidates(size_t segment_idx)
+{
+  static_assert(copy_v_transform_reduce_nbr_for_all_block_size == 512);
+  std::vector<launch_config_t> candidates{};
+  if (segment_idx == num_sparse_segments_per_vertex_partition) {  // hypersparse
+    candidates = {launch_config_t{0, 128}, launch_config_t{0, 256}, launch_config_t{0, 512}};
+  } else if (segment_idx == 0) {  // high degree
+    candidates = {launch_config_t{2, copy_v_transform_reduce_nbr_for_all_block_size},
+                  launch_config_t{1, 256},
+                  launch_config_t{1, 512}};
+  } else if (segment_idx == 1) {  // mid degree
+    candidates = {launch_config_t{2, copy_v_transform_reduce_nbr_for_all_block_size},
+                  launch_config_t{1, 128},
+                  launch_config_t{1, 256},
+                  launch_config_t{1, 512}};
+  } else {  // low degree
+    candidates = {launch_config_t{1, 256},
+                  launch_config_t{0, 128},
+                  launch_config_t{0, 256},
+                  launch_config_t{0, 512}};
+  }
+  return candidates;
+}
+
+template <typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename vertex_t>
+std::string launch_tuning_key(std::string const& prim_name,
+                              size_t partition_idx,
+                              std::vector<vertex_t> const& segment_offsets)
+{
+  auto key = prim_name + ":" + typeid(AdjMatrixRowValueInputWrapper).name() + ":" +
+             typeid(AdjMatrixColValueInputWrapper).name() + ":" + typeid(EdgeOp).name() + ":" +
+             typeid(T).name() + ":" + std::to_string(partition_idx);
+  for (auto offset : segment_offsets) {
+    key += ":" + std::to_string(offset);
+  }
+  return key;
+}
+
+// returns the execution time (in ms) of the second call of launch (the first call is a warm-up)
+template <typename LaunchFunc>
+float measure_launch_time(rmm::cuda_stream_view stream, LaunchFunc launch)
+{
+  cudaEvent_t start{};
+  cudaEvent_t stop{};
+  CUDA_TRY(cudaEventCreate(&start));
+  CUDA_TRY(cudaEventCreate(&stop));
+  launch();
+  CUDA_TRY(cudaEventRecord(start, stream.value()));
+  launch();
+  CUDA_TRY(cudaEventRecord(stop, stream.value()));
+  CUDA_TRY(cudaEventSynchronize(stop));
+  float elapsed_time{0.0};
+  CUDA_TRY(cudaEventElapsedTime(&elapsed_time, start, stop));
+  CUDA_TRY(cudaEventDestroy(start));
+  CUDA_TRY(cudaEventDestroy(stop));
+  return elapsed_time;
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename T>
+struct add_init_t {
+  T init{};
+
+  __device__ T operator()(T val) const { return property_op<T, thrust::plus>{}(init, val); }
+};
+
 template <bool update_major,
+          bool has_weights,
           typename GraphViewType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
@@ -84,21 +182,24 @@ __global__ void for_all_major_for_all_nbr_hypersparse(
       *(matrix_partition.get_major_from_major_hypersparse_idx_nocheck(static_cast<vertex_t>(idx)));
     auto major_idx =
       major_start_offset + idx;  // major_offset != major_idx in the hypersparse region
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) =
       matrix_partition.get_local_edges(static_cast<vertex_t>(major_idx));
+    auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(major_idx));
     auto transform_op = [&matrix_partition,
                          &adj_matrix_row_value_input,
                          &adj_matrix_col_value_input,
                          &e_op,
                          major,
                          indices,
-                         weights] __device__(auto i) {
+                         weights,
+                         local_offset] __device__(auto i) -> T {
+      if (!matrix_partition.is_valid_edge(local_offset + i)) { return T{}; }  // masked out
       auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
       auto minor        = indices[i];
-      auto weight       = weights ? (*weights)[i] : weight_t{1.0};
+      auto weight       = get_edge_weight<has_weights>(weights, i);
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
       auto row          = GraphViewType::is_adj_matrix_transposed ? minor : major;
       auto col          = GraphViewType::is_adj_matrix_transposed ? major : minor;
@@ -160,6 +261,7 @@ __global__ void for_all_major_for_all_nbr_hypersparse(
 }
 
 template <bool update_major,
+          bool has_weights,
           typename GraphViewType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
@@ -194,20 +296,23 @@ __global__ void for_all_major_for_all_nbr_low_degree(
     edge_property_add{};  // relevant only if update_major == true
   while (idx < static_cast<size_t>(major_last - major_first)) {
     auto major_offset = major_start_offset + idx;
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) =
       matrix_partition.get_local_edges(static_cast<vertex_t>(major_offset));
+    auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(major_offset));
     auto transform_op = [&matrix_partition,
                          &adj_matrix_row_value_input,
                          &adj_matrix_col_value_input,
                          &e_op,
                          major_offset,
                          indices,
-                         weights] __device__(auto i) {
+                         weights,
+                         local_offset] __device__(auto i) -> T {
+      if (!matrix_partition.is_valid_edge(local_offset + i)) { return T{}; }  // masked out
       auto minor        = indices[i];
-      auto weight       = weights ? (*weights)[i] : weight_t{1.0};
+      auto weight       = get_edge_weight<has_weights>(weights, i);
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
       auto row          = GraphViewType::is_adj_matrix_transposed
                             ? minor
@@ -273,6 +378,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
 }
 
 template <bool update_major,
+          bool has_weights,
           typename GraphViewType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
@@ -315,15 +421,17 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
     edge_property_add{};  // relevant only if update_major == true
   while (idx < static_cast<size_t>(major_last - major_first)) {
     auto major_offset = major_start_offset + idx;
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+    auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(major_offset));
     [[maybe_unused]] auto e_op_result_sum =
       lane_id == 0 ? init : e_op_result_t{};  // relevent only if update_major == true
     for (edge_t i = lane_id; i < local_degree; i += raft::warp_size()) {
+      if (!matrix_partition.is_valid_edge(local_offset + i)) { continue; }
       auto minor        = indices[i];
-      auto weight       = weights ? (*weights)[i] : weight_t{1.0};
+      auto weight       = get_edge_weight<has_weights>(weights, i);
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
       auto row          = GraphViewType::is_adj_matrix_transposed
                             ? minor
@@ -369,6 +477,7 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
 }
 
 template <bool update_major,
+          bool has_weights,
           typename GraphViewType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
@@ -389,7 +498,10 @@ __global__ void for_all_major_for_all_nbr_high_degree(
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
   ResultValueOutputIteratorOrWrapper result_value_output,
   EdgeOp e_op,
-  T init /* relevent only if update_major == true */)
+  T init /* relevent only if update_major == true */,
+  typename GraphViewType::edge_type
+    max_local_degree /* majors with more local edges are skipped (see
+                        for_all_hub_chunk_for_all_nbr) */)
 {
   using vertex_t      = typename GraphViewType::vertex_type;
   using edge_t        = typename GraphViewType::edge_type;
@@ -408,15 +520,21 @@ __global__ void for_all_major_for_all_nbr_high_degree(
     edge_property_add{};  // relevant only if update_major == true
   while (idx < static_cast<size_t>(major_last - major_first)) {
     auto major_offset = major_start_offset + idx;
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+    if (local_degree > max_local_degree) {
+      idx += gridDim.x;
+      continue;
+    }
+    auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(major_offset));
     [[maybe_unused]] auto e_op_result_sum =
       threadIdx.x == 0 ? init : e_op_result_t{};  // relevent only if update_major == true
     for (edge_t i = threadIdx.x; i < local_degree; i += blockDim.x) {
+      if (!matrix_partition.is_valid_edge(local_offset + i)) { continue; }
       auto minor        = indices[i];
-      auto weight       = weights ? (*weights)[i] : weight_t{1.0};
+      auto weight       = get_edge_weight<has_weights>(weights, i);
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
       auto row          = GraphViewType::is_adj_matrix_transposed
                             ? minor
@@ -460,7 +578,201 @@ __global__ void for_all_major_for_all_nbr_high_degree(
   }
 }
 
+// one block per edge chunk of the very high degree majors (see graph_t::enable_hub_splitting), if
+// update_major == true, the partial results are stored per chunk and should be reduced by major
+template <bool update_major,
+          bool has_weights,
+          typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename ResultValueOutputIteratorOrWrapper /* iterator (for the chunks) if update_major,
+                                                         wrapper if GraphViewType::is_multi_gpu,
+                                                         iterator otherwise */
+          ,
+          typename EdgeOp,
+          typename T>
+__global__ void for_all_hub_chunk_for_all_nbr(
+  matrix_partition_device_view_t<typename GraphViewType::vertex_type,
+                                 typename GraphViewType::edge_type,
+                                 typename GraphViewType::weight_type,
+                                 GraphViewType::is_multi_gpu> matrix_partition,
+  typename GraphViewType::vertex_type const* chunk_major_offsets,
+  typename GraphViewType::edge_type const* chunk_edge_offsets,
+  typename GraphViewType::edge_type num_chunks,
+  typename GraphViewType::edge_type chunk_size,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  ResultValueOutputIteratorOrWrapper result_value_output,
+  EdgeOp e_op,
+  T /* type tag for the edge operator results */)
+{
+  using vertex_t      = typename GraphViewType::vertex_type;
+  using edge_t        = typename GraphViewType::edge_type;
+  using weight_t      = typename GraphViewType::weight_type;
+  using e_op_result_t = T;
+
+  auto idx = static_cast<size_t>(blockIdx.x);
+
+  using BlockReduce =
+    cub::BlockReduce<e_op_result_t, copy_v_transform_reduce_nbr_for_all_block_size>;
+  [[maybe_unused]] __shared__
+    typename BlockReduce::TempStorage temp_storage;  // relevant only if update_major == true
+
+  [[maybe_unused]] property_op<e_op_result_t, thrust::plus>
+    edge_property_add{};  // relevant only if update_major == true
+  while (idx < static_cast<size_t>(num_chunks)) {
+    auto major_offset = chunk_major_offsets[idx];
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
+    thrust::optional<weight_t const*> weights{thrust::nullopt};
+    edge_t local_degree{};
+    thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+    auto local_offset = matrix_partition.get_local_offset(major_offset);
+    auto chunk_last   = chunk_edge_offsets[idx] + chunk_size < local_degree
+                          ? chunk_edge_offsets[idx] + chunk_size
+                          : local_degree;
+    [[maybe_unused]] auto e_op_result_sum =
+      e_op_result_t{};  // relevent only if update_major == true
+    for (edge_t i = chunk_edge_offsets[idx] + threadIdx.x; i < chunk_last; i += blockDim.x) {
+      if (!matrix_partition.is_valid_edge(local_offset + i)) { continue; }
+      auto minor        = indices[i];
+      auto weight       = get_edge_weight<has_weights>(weights, i);
+      auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
+      auto row          = GraphViewType::is_adj_matrix_transposed
+                            ? minor
+                            : matrix_partition.get_major_from_major_offset_nocheck(major_offset);
+      auto col          = GraphViewType::is_adj_matrix_transposed
+                            ? matrix_partition.get_major_from_major_offset_nocheck(major_offset)
+                            : minor;
+      auto row_offset   = GraphViewType::is_adj_matrix_transposed ? minor_offset : major_offset;
+      auto col_offset   = GraphViewType::is_adj_matrix_transposed ? major_offset : minor_offset;
+      auto e_op_result  = evaluate_edge_op<GraphViewType,
+                                          vertex_t,
+                                          AdjMatrixRowValueInputWrapper,
+                                          AdjMatrixColValueInputWrapper,
+                                          EdgeOp>()
+                           .compute(row,
+                                    col,
+                                    weight,
+                                    adj_matrix_row_value_input.get(row_offset),
+                                    adj_matrix_col_value_input.get(col_offset),
+                                    e_op);
+      if constexpr (update_major) {
+        e_op_result_sum = edge_property_add(e_op_result_sum, e_op_result);
+      } else {
+        if constexpr (GraphViewType::is_multi_gpu) {
+          atomic_accumulate_edge_op_result(result_value_output.get_iter(minor_offset), e_op_result);
+        } else {
+          atomic_accumulate_edge_op_result(result_value_output + minor_offset, e_op_result);
+        }
+      }
+    }
+    if constexpr (update_major) {
+      e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, edge_property_add);
+      if (threadIdx.x == 0) { *(result_value_output + idx) = e_op_result_sum; }
+    }
+
+    idx += gridDim.x;
+  }
+}
+
+// one warp per major in the [major_first, major_last) list, the reduced values are stored in the
+// list order
+template <typename GraphViewType,
+          bool has_weights,
+          typename MajorIterator,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename ResultValueOutputIterator,
+          typename EdgeOp,
+          typename T>
+__global__ void for_all_major_in_list_for_all_nbr(
+  matrix_partition_device_view_t<typename GraphViewType::vertex_type,
+                                 typename GraphViewType::edge_type,
+                                 typename GraphViewType::weight_type,
+                                 GraphViewType::is_multi_gpu> matrix_partition,
+  MajorIterator major_first,
+  MajorIterator major_last,
+  thrust::optional<typename GraphViewType::vertex_type> major_hypersparse_first,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  ResultValueOutputIterator result_value_output,
+  EdgeOp e_op,
+  T init)
+{
+  using vertex_t      = typename GraphViewType::vertex_type;
+  using edge_t        = typename GraphViewType::edge_type;
+  using weight_t      = typename GraphViewType::weight_type;
+  using e_op_result_t = T;
+
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  static_assert(copy_v_transform_reduce_nbr_for_all_block_size % raft::warp_size() == 0);
+  auto const lane_id = tid % raft::warp_size();
+  auto idx           = static_cast<size_t>(tid / raft::warp_size());
+
+  using WarpReduce = cub::WarpReduce<e_op_result_t>;
+  __shared__ typename WarpReduce::TempStorage
+    temp_storage[copy_v_transform_reduce_nbr_for_all_block_size / raft::warp_size()];
+
+  property_op<e_op_result_t, thrust::plus> edge_property_add{};
+  while (idx < static_cast<size_t>(thrust::distance(major_first, major_last))) {
+    auto major        = *(major_first + idx);
+    auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
+    auto major_idx    = thrust::optional<vertex_t>{major_offset};
+    if (major_hypersparse_first && (major >= *major_hypersparse_first)) {
+      auto major_hypersparse_idx =
+        matrix_partition.get_major_hypersparse_idx_from_major_nocheck(major);
+      auto major_hypersparse_start_offset =
+        matrix_partition.get_major_offset_from_major_nocheck(*major_hypersparse_first);
+      major_idx = major_hypersparse_idx  // major_offset != major_idx in the hypersparse region
+                    ? thrust::optional<vertex_t>{major_hypersparse_start_offset +
+                                                 *major_hypersparse_idx}
+                    : thrust::nullopt;  // no edges
+    }
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
+    thrust::optional<weight_t const*> weights{thrust::nullopt};
+    edge_t local_degree{0};
+    edge_t local_offset{0};
+    if (major_idx) {
+      thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(*major_idx);
+      local_offset = matrix_partition.get_local_offset(*major_idx);
+    }
+    auto e_op_result_sum = lane_id == 0 ? init : e_op_result_t{};
+    for (edge_t i = lane_id; i < local_degree; i += raft::warp_size()) {
+      if (!matrix_partition.is_valid_edge(local_offset + i)) { continue; }
+      auto minor        = indices[i];
+      auto weight       = get_edge_weight<has_weights>(weights, i);
+      auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
+      auto row          = GraphViewType::is_adj_matrix_transposed ? minor : major;
+      auto col          = GraphViewType::is_adj_matrix_transposed ? major : minor;
+      auto row_offset   = GraphViewType::is_adj_matrix_transposed
+                            ? minor_offset
+                            : static_cast<vertex_t>(major_offset);
+      auto col_offset   = GraphViewType::is_adj_matrix_transposed
+                            ? static_cast<vertex_t>(major_offset)
+                            : minor_offset;
+      auto e_op_result  = evaluate_edge_op<GraphViewType,
+                                          vertex_t,
+                                          AdjMatrixRowValueInputWrapper,
+                                          AdjMatrixColValueInputWrapper,
+                                          EdgeOp>()
+                           .compute(row,
+                                    col,
+                                    weight,
+                                    adj_matrix_row_value_input.get(row_offset),
+                                    adj_matrix_col_value_input.get(col_offset),
+                                    e_op);
+      e_op_result_sum = edge_property_add(e_op_result_sum, e_op_result);
+    }
+    e_op_result_sum = WarpReduce(temp_storage[threadIdx.x / raft::warp_size()])
+                        .Reduce(e_op_result_sum, edge_property_add);
+    if (lane_id == 0) { *(result_value_output + idx) = e_op_result_sum; }
+
+    idx += gridDim.x * (blockDim.x / raft::warp_size());
+  }
+}
+
 template <bool in,  // iterate over incoming edges (in == true) or outgoing edges (in == false)
+          bool has_weights,
           typename GraphViewType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
@@ -559,92 +871,338 @@ void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
       output_buffer = vertex_value_output_first;
     }
     auto segment_offsets = graph_view.get_local_adj_matrix_partition_segment_offsets(i);
-    if (segment_offsets) {
-      // FIXME: we may further improve performance by 1) concurrently running kernels on different
-      // segments; 2) individually tuning block sizes for different segments; and 3) adding one more
-      // segment for very high degree vertices and running segmented reduction
+    auto edge_tile_size  = graph_view.get_edge_tile_size();
+    if (edge_tile_size) {
+      // the edges are in managed memory (see graph_t::set_edge_memory_placement), the majors are
+      // processed in tiles of a bounded number of edges while the next tile is prefetched
       static_assert(detail::num_sparse_segments_per_vertex_partition == 3);
-      if ((*segment_offsets)[1] > 0) {
-        raft::grid_1d_block_t update_grid((*segment_offsets)[1],
-                                          detail::copy_v_transform_reduce_nbr_for_all_block_size,
-                                          handle.get_device_properties().maxGridSize[0]);
-        detail::for_all_major_for_all_nbr_high_degree<update_major, GraphViewType>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
-            matrix_partition,
-            matrix_partition.get_major_first(),
-            matrix_partition.get_major_first() + (*segment_offsets)[1],
-            matrix_partition_row_value_input,
-            matrix_partition_col_value_input,
-            output_buffer,
-            e_op,
-            major_init);
-      }
-      if ((*segment_offsets)[2] - (*segment_offsets)[1] > 0) {
-        raft::grid_1d_warp_t update_grid((*segment_offsets)[2] - (*segment_offsets)[1],
-                                         detail::copy_v_transform_reduce_nbr_for_all_block_size,
-                                         handle.get_device_properties().maxGridSize[0]);
-        auto segment_output_buffer = output_buffer;
-        if constexpr (update_major) { segment_output_buffer += (*segment_offsets)[1]; }
-        detail::for_all_major_for_all_nbr_mid_degree<update_major, GraphViewType>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
-            matrix_partition,
-            matrix_partition.get_major_first() + (*segment_offsets)[1],
-            matrix_partition.get_major_first() + (*segment_offsets)[2],
-            matrix_partition_row_value_input,
-            matrix_partition_col_value_input,
-            segment_output_buffer,
-            e_op,
-            major_init);
-      }
-      if ((*segment_offsets)[3] - (*segment_offsets)[2] > 0) {
-        raft::grid_1d_thread_t update_grid((*segment_offsets)[3] - (*segment_offsets)[2],
+      auto matrix_partition_view = graph_view.get_matrix_partition_view(i);
+      // the hypersparse segment (if any) is processed after the tiles
+      auto dense_size =
+        (segment_offsets && matrix_partition.get_dcs_nzd_vertex_count())
+          ? (*segment_offsets)[detail::num_sparse_segments_per_vertex_partition]
+          : matrix_partition.get_major_size();
+      auto [tile_boundaries, tile_edge_boundaries] = detail::compute_edge_tile_boundaries(
+        handle, matrix_partition_view, vertex_t{0}, dense_size, *edge_tile_size);
+      detail::edge_tile_prefetcher_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>
+        prefetcher(matrix_partition_view, tile_boundaries, tile_edge_boundaries);
+
+      // j: 0 (high degree), 1 (mid degree), 2 (low degree), a thread block, a warp, and a thread
+      // per major, respectively
+      auto launch_range = [&](size_t j, vertex_t major_offset_first, vertex_t major_offset_last) {
+        auto range_output_buffer = output_buffer;
+        if constexpr (update_major) { range_output_buffer += major_offset_first; }
+        auto range_major_first = matrix_partition.get_major_first() + major_offset_first;
+        auto range_major_last  = matrix_partition.get_major_first() + major_offset_last;
+        auto range_size        = major_offset_last - major_offset_first;
+        if (j == 0) {
+          raft::grid_1d_block_t update_grid(range_size,
+                                            detail::copy_v_transform_reduce_nbr_for_all_block_size,
+                                            handle.get_device_properties().maxGridSize[0]);
+          detail::for_all_major_for_all_nbr_high_degree<update_major, has_weights, GraphViewType>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+              matrix_partition,
+              range_major_first,
+              range_major_last,
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              range_output_buffer,
+              e_op,
+              major_init,
+              std::numeric_limits<edge_t>::max());
+        } else if (j == 1) {
+          raft::grid_1d_warp_t update_grid(range_size,
                                            detail::copy_v_transform_reduce_nbr_for_all_block_size,
                                            handle.get_device_properties().maxGridSize[0]);
-        auto segment_output_buffer = output_buffer;
-        if constexpr (update_major) { segment_output_buffer += (*segment_offsets)[2]; }
-        detail::for_all_major_for_all_nbr_low_degree<update_major, GraphViewType>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
-            matrix_partition,
-            matrix_partition.get_major_first() + (*segment_offsets)[2],
-            matrix_partition.get_major_first() + (*segment_offsets)[3],
-            matrix_partition_row_value_input,
-            matrix_partition_col_value_input,
-            segment_output_buffer,
-            e_op,
-            major_init);
+          detail::for_all_major_for_all_nbr_mid_degree<update_major, has_weights, GraphViewType>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+              matrix_partition,
+              range_major_first,
+              range_major_last,
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              range_output_buffer,
+              e_op,
+              major_init);
+        } else {
+          raft::grid_1d_thread_t update_grid(range_size,
+                                             detail::copy_v_transform_reduce_nbr_for_all_block_size,
+                                             handle.get_device_properties().maxGridSize[0]);
+          detail::for_all_major_for_all_nbr_low_degree<update_major, has_weights, GraphViewType>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+              matrix_partition,
+              range_major_first,
+              range_major_last,
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              range_output_buffer,
+              e_op,
+              major_init);
+        }
+      };
+
+      prefetcher.prefetch(0);
+      for (size_t t = 0; t < prefetcher.get_num_tiles(); ++t) {
+        if (t + 1 < prefetcher.get_num_tiles()) { prefetcher.prefetch(t + 1); }
+        prefetcher.wait(t, handle.get_stream_view());
+        if (segment_offsets) {
+          for (size_t j = 0; j < detail::num_sparse_segments_per_vertex_partition; ++j) {
+            auto first = std::max(tile_boundaries[t], (*segment_offsets)[j]);
+            auto last  = std::min(tile_boundaries[t + 1], (*segment_offsets)[j + 1]);
+            if (first < last) { launch_range(j, first, last); }
+          }
+        } else if (tile_boundaries[t] < tile_boundaries[t + 1]) {
+          launch_range(2, tile_boundaries[t], tile_boundaries[t + 1]);
+        }
       }
-      if (matrix_partition.get_dcs_nzd_vertex_count()) {
-        if constexpr (update_major) {  // this is necessary as we don't visit every vertex in the
-                                       // hypersparse segment in
-                                       // for_all_major_for_all_nbr_hypersparse
+
+      if (segment_offsets && matrix_partition.get_dcs_nzd_vertex_count()) {
+        auto j                     = detail::num_sparse_segments_per_vertex_partition;
+        auto segment_output_buffer = output_buffer;
+        if constexpr (update_major) {  // the hypersparse kernel does not visit every major
           thrust::fill(handle.get_thrust_policy(),
-                       output_buffer + (*segment_offsets)[3],
-                       output_buffer + (*segment_offsets)[4],
+                       output_buffer + (*segment_offsets)[j],
+                       output_buffer + (*segment_offsets)[j + 1],
                        major_init);
+          segment_output_buffer += (*segment_offsets)[j];
         }
-        if (*(matrix_partition.get_dcs_nzd_vertex_count()) > 0) {
-          raft::grid_1d_thread_t update_grid(*(matrix_partition.get_dcs_nzd_vertex_count()),
+        auto dcs_nzd_vertex_count = *(matrix_partition.get_dcs_nzd_vertex_count());
+        if (dcs_nzd_vertex_count > 0) {
+          auto [hypersparse_boundaries, hypersparse_edge_boundaries] =
+            detail::compute_edge_tile_boundaries(handle,
+                                                 matrix_partition_view,
+                                                 dense_size,
+                                                 dense_size + dcs_nzd_vertex_count,
+                                                 std::numeric_limits<edge_t>::max());
+          detail::edge_tile_prefetcher_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>
+            hypersparse_prefetcher(
+              matrix_partition_view, hypersparse_boundaries, hypersparse_edge_boundaries);
+          hypersparse_prefetcher.prefetch(0);
+          hypersparse_prefetcher.wait(0, handle.get_stream_view());
+          raft::grid_1d_thread_t update_grid(dcs_nzd_vertex_count,
                                              detail::copy_v_transform_reduce_nbr_for_all_block_size,
                                              handle.get_device_properties().maxGridSize[0]);
-          auto segment_output_buffer = output_buffer;
-          if constexpr (update_major) { segment_output_buffer += (*segment_offsets)[3]; }
-          detail::for_all_major_for_all_nbr_hypersparse<update_major, GraphViewType>
+          detail::for_all_major_for_all_nbr_hypersparse<update_major, has_weights, GraphViewType>
             <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
               matrix_partition,
-              matrix_partition.get_major_first() + (*segment_offsets)[3],
+              matrix_partition.get_major_first() + (*segment_offsets)[j],
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              segment_output_buffer,
+              e_op,
+              major_init);
+        }
+      }
+    } else if (segment_offsets) {
+      static_assert(detail::num_sparse_segments_per_vertex_partition == 3);
+      auto const num_segments = (*segment_offsets).size() - 1;
+      auto launch_configs     = default_segment_launch_configs(num_segments);
+
+      // the very high degree majors (if split, see graph_t::enable_hub_splitting) are in the high
+      // degree segment, their chunks are processed after the other majors in the segment
+      auto hub_split      = graph_view.get_hub_split();
+      auto num_hub_chunks =
+        hub_split ? static_cast<edge_t>(hub_split->chunk_major_offsets[i].size()) : edge_t{0};
+      auto launch_hub_chunks = [&](rmm::cuda_stream_view stream) {
+        auto const& chunk_major_offsets = hub_split->chunk_major_offsets[i];
+        auto const& chunk_edge_offsets  = hub_split->chunk_edge_offsets[i];
+        raft::grid_1d_block_t update_grid(num_hub_chunks,
+                                          detail::copy_v_transform_reduce_nbr_for_all_block_size,
+                                          handle.get_device_properties().maxGridSize[0]);
+        if constexpr (update_major) {
+          auto chunk_buffer = allocate_dataframe_buffer<T>(num_hub_chunks, stream);
+          detail::for_all_hub_chunk_for_all_nbr<update_major, has_weights, GraphViewType>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, stream>>>(
+              matrix_partition,
+              chunk_major_offsets.data(),
+              chunk_edge_offsets.data(),
+              num_hub_chunks,
+              hub_split->chunk_size,
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              get_dataframe_buffer_begin(chunk_buffer),
+              e_op,
+              T{});
+          rmm::device_uvector<vertex_t> hub_major_offsets(num_hub_chunks, stream);
+          auto hub_buffer = allocate_dataframe_buffer<T>(num_hub_chunks, stream);
+          auto num_hubs   = static_cast<size_t>(thrust::distance(
+            hub_major_offsets.begin(),
+            thrust::get<0>(thrust::reduce_by_key(rmm::exec_policy(stream),
+                                                 chunk_major_offsets.begin(),
+                                                 chunk_major_offsets.end(),
+                                                 get_dataframe_buffer_begin(chunk_buffer),
+                                                 hub_major_offsets.begin(),
+                                                 get_dataframe_buffer_begin(hub_buffer),
+                                                 thrust::equal_to<vertex_t>{},
+                                                 property_op<T, thrust::plus>{}))));
+          auto hub_value_first = thrust::make_transform_iterator(
+            get_dataframe_buffer_begin(hub_buffer), detail::add_init_t<T>{major_init});
+          thrust::scatter(rmm::exec_policy(stream),
+                          hub_value_first,
+                          hub_value_first + num_hubs,
+                          hub_major_offsets.begin(),
+                          output_buffer);
+        } else {
+          detail::for_all_hub_chunk_for_all_nbr<update_major, has_weights, GraphViewType>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, stream>>>(
+              matrix_partition,
+              chunk_major_offsets.data(),
+              chunk_edge_offsets.data(),
+              num_hub_chunks,
+              hub_split->chunk_size,
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              output_buffer,
+              e_op,
+              T{});
+        }
+      };
+
+      // launch_config.granularity is ignored in the hypersparse segment (a thread per vertex) and
+      // launch_config.block_size is ignored if launch_config.granularity is 2 (a block per vertex,
+      // the block size is fixed at compile time)
+      auto launch_segment = [&](size_t j, launch_config_t config, rmm::cuda_stream_view stream) {
+        auto segment_output_buffer = output_buffer;
+        if constexpr (update_major) { segment_output_buffer += (*segment_offsets)[j]; }
+        if (j == detail::num_sparse_segments_per_vertex_partition) {
+          raft::grid_1d_thread_t update_grid(*(matrix_partition.get_dcs_nzd_vertex_count()),
+                                             config.block_size,
+                                             handle.get_device_properties().maxGridSize[0]);
+          detail::for_all_major_for_all_nbr_hypersparse<update_major, has_weights, GraphViewType>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, stream>>>(
+              matrix_partition,
+              matrix_partition.get_major_first() + (*segment_offsets)[j],
               matrix_partition_row_value_input,
               matrix_partition_col_value_input,
               segment_output_buffer,
               e_op,
               major_init);
+          return;
+        }
+        auto segment_major_first = matrix_partition.get_major_first() + (*segment_offsets)[j];
+        auto segment_major_last  = matrix_partition.get_major_first() + (*segment_offsets)[j + 1];
+        auto segment_size        = (*segment_offsets)[j + 1] - (*segment_offsets)[j];
+        // the hubs are processed by a thread block per chunk regardless of config
+        auto split_hubs = (j == 0) && (num_hub_chunks > 0);
+        if ((config.granularity == 2) || split_hubs) {
+          raft::grid_1d_block_t update_grid(segment_size,
+                                            detail::copy_v_transform_reduce_nbr_for_all_block_size,
+                                            handle.get_device_properties().maxGridSize[0]);
+          detail::for_all_major_for_all_nbr_high_degree<update_major, has_weights, GraphViewType>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, stream>>>(
+              matrix_partition,
+              segment_major_first,
+              segment_major_last,
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              segment_output_buffer,
+              e_op,
+              major_init,
+              split_hubs ? hub_split->chunk_size : std::numeric_limits<edge_t>::max());
+          if (split_hubs) { launch_hub_chunks(stream); }
+        } else if (config.granularity == 1) {
+          raft::grid_1d_warp_t update_grid(segment_size,
+                                           config.block_size,
+                                           handle.get_device_properties().maxGridSize[0]);
+          detail::for_all_major_for_all_nbr_mid_degree<update_major, has_weights, GraphViewType>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, stream>>>(
+              matrix_partition,
+              segment_major_first,
+              segment_major_last,
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              segment_output_buffer,
+              e_op,
+              major_init);
+        } else {
+          raft::grid_1d_thread_t update_grid(segment_size,
+                                             config.block_size,
+                                             handle.get_device_properties().maxGridSize[0]);
+          detail::for_all_major_for_all_nbr_low_degree<update_major, has_weights, GraphViewType>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, stream>>>(
+              matrix_partition,
+              segment_major_first,
+              segment_major_last,
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              segment_output_buffer,
+              e_op,
+              major_init);
+        }
+      };
+      auto segment_size = [&](size_t j) {
+        return j == detail::num_sparse_segments_per_vertex_partition
+                 ? *(matrix_partition.get_dcs_nzd_vertex_count())
+                 : (*segment_offsets)[j + 1] - (*segment_offsets)[j];
+      };
+
+      // the kernels overwrite (instead of accumulating to) the major outputs, so the candidate
+      // configurations can be benchmarked on the actual outputs
+      if constexpr (update_major) {
+        auto launch_tuning_cache = graph_view.get_launch_tuning_cache();
+        if (launch_tuning_cache) {
+          auto key = launch_tuning_key<AdjMatrixRowValueInputWrapper,
+                                       AdjMatrixColValueInputWrapper,
+                                       EdgeOp,
+                                       T>(in ? "copy_v_transform_reduce_in_nbr"
+                                             : "copy_v_transform_reduce_out_nbr",
+                                          i,
+                                          *segment_offsets);
+          auto cached_configs = launch_tuning_cache->find(key);
+          if (cached_configs) {
+            launch_configs = *cached_configs;
+          } else {
+            for (size_t j = 0; j < num_segments; ++j) {
+              if ((segment_size(j) == 0) || ((j == 0) && (num_hub_chunks > 0))) { continue; }
+              auto best_time = std::numeric_limits<float>::max();
+              for (auto candidate : segment_launch_config_candidates(j)) {
+                auto elapsed_time = measure_launch_time(handle.get_stream_view(), [&]() {
+                  launch_segment(j, candidate, handle.get_stream_view());
+                });
+                if (elapsed_time < best_time) {
+                  best_time         = elapsed_time;
+                  launch_configs[j] = candidate;
+                }
+              }
+            }
+            launch_tuning_cache->insert(key, launch_configs);
+          }
+        }
+      }
+
+      // run the kernels on different segments concurrently if the handle has enough internal
+      // streams (kernels on the low degree segments alone often under-fill the GPU)
+      std::vector<rmm::cuda_stream_view> segment_streams(num_segments, handle.get_stream_view());
+      auto concurrent_segments =
+        static_cast<size_t>(handle.get_num_internal_streams()) >= num_segments;
+      if (concurrent_segments) {
+        handle.wait_on_user_stream();
+        for (size_t j = 0; j < num_segments; ++j) {
+          segment_streams[j] = handle.get_internal_stream_view(j);
+        }
+      }
+      for (size_t j = 0; j < detail::num_sparse_segments_per_vertex_partition; ++j) {
+        if (segment_size(j) > 0) { launch_segment(j, launch_configs[j], segment_streams[j]); }
+      }
+      if (matrix_partition.get_dcs_nzd_vertex_count()) {
+        auto j = detail::num_sparse_segments_per_vertex_partition;
+        if constexpr (update_major) {  // this is necessary as we don't visit every vertex in the
+                                       // hypersparse segment in
+                                       // for_all_major_for_all_nbr_hypersparse
+          thrust::fill(rmm::exec_policy(segment_streams[j]),
+                       output_buffer + (*segment_offsets)[j],
+                       output_buffer + (*segment_offsets)[j + 1],
+                       major_init);
         }
+        if (segment_size(j) > 0) { launch_segment(j, launch_configs[j], segment_streams[j]); }
       }
+      if (concurrent_segments) { handle.wait_on_internal_streams(); }
     } else {
       if (matrix_partition.get_major_size() > 0) {
         raft::grid_1d_thread_t update_grid(matrix_partition.get_major_size(),
                                            detail::copy_v_transform_reduce_nbr_for_all_block_size,
                                            handle.get_device_properties().maxGridSize[0]);
-        detail::for_all_major_for_all_nbr_low_degree<update_major, GraphViewType>
+        detail::for_all_major_for_all_nbr_low_degree<update_major, has_weights, GraphViewType>
           <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
             matrix_partition,
             matrix_partition.get_major_first(),
@@ -740,6 +1298,136 @@ void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
   }
 }
 
+template <bool in,  // iterate over incoming edges (in == true) or outgoing edges (in == false)
+          bool has_weights,
+          typename GraphViewType,
+          typename VertexIterator,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_nbr_of_vertices(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexIterator vertex_first,
+  VertexIterator vertex_last,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeOp e_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
+  static_assert(in == GraphViewType::is_adj_matrix_transposed,
+                "the listed vertices should be the adjacency matrix majors (use the pull model to "
+                "iterate over incoming edges and the push model to iterate over outgoing edges).");
+
+  auto local_list_size = static_cast<size_t>(thrust::distance(vertex_first, vertex_last));
+  std::vector<size_t> list_sizes{};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    list_sizes     = host_scalar_allgather(col_comm, local_list_size, handle.get_stream());
+  } else {
+    list_sizes = std::vector<size_t>{local_list_size};
+  }
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto matrix_partition =
+      matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+        graph_view.get_matrix_partition_view(i));
+
+    rmm::device_uvector<vertex_t> matrix_partition_vertices(
+      GraphViewType::is_multi_gpu ? list_sizes[i] : size_t{0}, handle.get_stream());
+    auto major_init = init;
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+      auto const col_comm_rank = col_comm.get_rank();
+      device_bcast(col_comm,
+                   vertex_first,
+                   matrix_partition_vertices.begin(),
+                   list_sizes[i],
+                   i,
+                   handle.get_stream());
+      major_init = (col_comm_rank == 0) ? init : T{};
+    }
+    if (list_sizes[i] == 0) { continue; }
+
+    auto matrix_partition_row_value_input = adj_matrix_row_value_input;
+    auto matrix_partition_col_value_input = adj_matrix_col_value_input;
+    if constexpr (GraphViewType::is_adj_matrix_transposed) {
+      matrix_partition_col_value_input.set_local_adj_matrix_partition_idx(i);
+    } else {
+      matrix_partition_row_value_input.set_local_adj_matrix_partition_idx(i);
+    }
+
+    auto segment_offsets = graph_view.get_local_adj_matrix_partition_segment_offsets(i);
+    auto major_hypersparse_first =
+      (segment_offsets && matrix_partition.get_dcs_nzd_vertex_count())
+        ? thrust::optional<vertex_t>{matrix_partition.get_major_first() + (*segment_offsets)[3]}
+        : thrust::nullopt;
+
+    auto output_buffer = allocate_dataframe_buffer<T>(list_sizes[i], handle.get_stream());
+    raft::grid_1d_warp_t update_grid(list_sizes[i],
+                                     detail::copy_v_transform_reduce_nbr_for_all_block_size,
+                                     handle.get_device_properties().maxGridSize[0]);
+    if constexpr (GraphViewType::is_multi_gpu) {
+      detail::for_all_major_in_list_for_all_nbr<GraphViewType, has_weights>
+        <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+          matrix_partition,
+          matrix_partition_vertices.begin(),
+          matrix_partition_vertices.end(),
+          major_hypersparse_first,
+          matrix_partition_row_value_input,
+          matrix_partition_col_value_input,
+          get_dataframe_buffer_begin(output_buffer),
+          e_op,
+          major_init);
+
+      auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+      auto const col_comm_rank = col_comm.get_rank();
+      device_reduce(col_comm,
+                    get_dataframe_buffer_begin(output_buffer),
+                    get_dataframe_buffer_begin(output_buffer),
+                    list_sizes[i],
+                    raft::comms::op_t::SUM,
+                    i,
+                    handle.get_stream());
+      if (static_cast<size_t>(col_comm_rank) == i) {
+        thrust::scatter(handle.get_thrust_policy(),
+                        get_dataframe_buffer_begin(output_buffer),
+                        get_dataframe_buffer_end(output_buffer),
+                        thrust::make_transform_iterator(
+                          vertex_first,
+                          [vertex_first = graph_view.get_local_vertex_first()] __device__(
+                            auto v) { return v - vertex_first; }),
+                        vertex_value_output_first);
+      }
+    } else {
+      detail::for_all_major_in_list_for_all_nbr<GraphViewType, has_weights>
+        <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+          matrix_partition,
+          vertex_first,
+          vertex_last,
+          major_hypersparse_first,
+          matrix_partition_row_value_input,
+          matrix_partition_col_value_input,
+          get_dataframe_buffer_begin(output_buffer),
+          e_op,
+          major_init);
+      thrust::scatter(handle.get_thrust_policy(),
+                      get_dataframe_buffer_begin(output_buffer),
+                      get_dataframe_buffer_end(output_buffer),
+                      vertex_first,
+                      vertex_value_output_first);
+    }
+  }
+}
+
 }  // namespace detail
 
 /**
@@ -792,13 +1480,87 @@ void copy_v_transform_reduce_in_nbr(raft::handle_t const& handle,
                                     T init,
                                     VertexValueOutputIterator vertex_value_output_first)
 {
-  detail::copy_v_transform_reduce_nbr<true>(handle,
-                                            graph_view,
-                                            adj_matrix_row_value_input,
-                                            adj_matrix_col_value_input,
-                                            e_op,
-                                            init,
-                                            vertex_value_output_first);
+  nvtx_range_t range("copy_v_transform_reduce_in_nbr");
+
+  detail::dispatch_has_weights(graph_view.is_weighted(), [&](auto has_weights) {
+    detail::copy_v_transform_reduce_nbr<true, decltype(has_weights)::value>(
+      handle,
+      graph_view,
+      adj_matrix_row_value_input,
+      adj_matrix_col_value_input,
+      e_op,
+      init,
+      vertex_value_output_first);
+  });
+}
+
+/**
+ * @brief Iterate over the incoming edges of the vertices in the input vertex list to update their
+ * properties.
+ *
+ * This function is identical to the copy_v_transform_reduce_in_nbr above except that only the
+ * vertices in [@p vertex_first, @p vertex_last) are updated (the properties of the other vertices
+ * are left untouched). The amount of work is proportional to the number of incoming edges of the
+ * listed vertices. Supports only the pull model (i.e. the adjacency matrix is stored as
+ * transposed).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexIterator Type of the iterator for the vertex list.
+ * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
+ * properties.
+ * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
+ * properties.
+ * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @tparam T Type of the initial value for reduction over the incoming edges.
+ * @tparam VertexValueOutputIterator Type of the iterator for vertex output property variables.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_first Iterator pointing to the first (inclusive) vertex in the list of the vertices
+ * to update (local to this process in multi-GPU). Vertices should be unique.
+ * @param vertex_last Iterator pointing to the last (exclusive) vertex in the list.
+ * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
+ * (for the rows assigned to this process in multi-GPU).
+ * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
+ * (for the columns assigned to this process in multi-GPU).
+ * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
+ * weight), properties for the row (i.e. source), and properties for the column  (i.e. destination)
+ * and returns a value to be reduced.
+ * @param init Initial value to be added to the reduced @p e_op return values for each vertex.
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU).
+ */
+template <typename GraphViewType,
+          typename VertexIterator,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_in_nbr(raft::handle_t const& handle,
+                                    GraphViewType const& graph_view,
+                                    VertexIterator vertex_first,
+                                    VertexIterator vertex_last,
+                                    AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                                    AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                                    EdgeOp e_op,
+                                    T init,
+                                    VertexValueOutputIterator vertex_value_output_first)
+{
+  nvtx_range_t range("copy_v_transform_reduce_in_nbr");
+
+  detail::dispatch_has_weights(graph_view.is_weighted(), [&](auto has_weights) {
+    detail::copy_v_transform_reduce_nbr_of_vertices<true, decltype(has_weights)::value>(
+      handle,
+      graph_view,
+      vertex_first,
+      vertex_last,
+      adj_matrix_row_value_input,
+      adj_matrix_col_value_input,
+      e_op,
+      init,
+      vertex_value_output_first);
+  });
 }
 
 /**
@@ -852,13 +1614,87 @@ void copy_v_transform_reduce_out_nbr(raft::handle_t const& handle,
                                      T init,
                                      VertexValueOutputIterator vertex_value_output_first)
 {
-  detail::copy_v_transform_reduce_nbr<false>(handle,
-                                             graph_view,
-                                             adj_matrix_row_value_input,
-                                             adj_matrix_col_value_input,
-                                             e_op,
-                                             init,
-                                             vertex_value_output_first);
+  nvtx_range_t range("copy_v_transform_reduce_out_nbr");
+
+  detail::dispatch_has_weights(graph_view.is_weighted(), [&](auto has_weights) {
+    detail::copy_v_transform_reduce_nbr<false, decltype(has_weights)::value>(
+      handle,
+      graph_view,
+      adj_matrix_row_value_input,
+      adj_matrix_col_value_input,
+      e_op,
+      init,
+      vertex_value_output_first);
+  });
+}
+
+/**
+ * @brief Iterate over the outgoing edges of the vertices in the input vertex list to update their
+ * properties.
+ *
+ * This function is identical to the copy_v_transform_reduce_out_nbr above except that only the
+ * vertices in [@p vertex_first, @p vertex_last) are updated (the properties of the other vertices
+ * are left untouched). The amount of work is proportional to the number of outgoing edges of the
+ * listed vertices. Supports only the push model (i.e. the adjacency matrix is not stored as
+ * transposed).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexIterator Type of the iterator for the vertex list.
+ * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
+ * properties.
+ * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
+ * properties.
+ * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @tparam T Type of the initial value for reduction over the outgoing edges.
+ * @tparam VertexValueOutputIterator Type of the iterator for vertex output property variables.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_first Iterator pointing to the first (inclusive) vertex in the list of the vertices
+ * to update (local to this process in multi-GPU). Vertices should be unique.
+ * @param vertex_last Iterator pointing to the last (exclusive) vertex in the list.
+ * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
+ * (for the rows assigned to this process in multi-GPU).
+ * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
+ * (for the columns assigned to this process in multi-GPU).
+ * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
+ * weight), properties for the row (i.e. source), and properties for the column  (i.e. destination)
+ * and returns a value to be reduced.
+ * @param init Initial value to be added to the reduced @p e_op return values for each vertex.
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU).
+ */
+template <typename GraphViewType,
+          typename VertexIterator,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_out_nbr(raft::handle_t const& handle,
+                                     GraphViewType const& graph_view,
+                                     VertexIterator vertex_first,
+                                     VertexIterator vertex_last,
+                                     AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                                     AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                                     EdgeOp e_op,
+                                     T init,
+                                     VertexValueOutputIterator vertex_value_output_first)
+{
+  nvtx_range_t range("copy_v_transform_reduce_out_nbr");
+
+  detail::dispatch_has_weights(graph_view.is_weighted(), [&](auto has_weights) {
+    detail::copy_v_transform_reduce_nbr_of_vertices<false, decltype(has_weights)::value>(
+      handle,
+      graph_view,
+      vertex_first,
+      vertex_last,
+      adj_matrix_row_value_input,
+      adj_matrix_col_value_input,
+      e_op,
+      init,
+      vertex_value_output_first);
+  });
 }
 
 }  // namespace cugraph
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/prims/copy_v_transform_reduce_key_aggregated_out_nbr.cuh>
+
+#include <raft/handle.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+namespace cugraph {
+
+/**
+ * @brief Iterate over every vertex's key-aggregated incoming edges to update vertex properties.
+ *
+ * This function is the pull-model (transposed graph) counterpart of
+ * copy_v_transform_reduce_key_aggregated_out_nbr. Incoming edges are aggregated by the keys of
+ * their sources, and the aggregated (destination, key, weight) triplets are transformed and
+ * reduced for every destination vertex.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
+ * properties.
+ * @tparam AdjMatrixRowKeyInputWrapper Type of the wrapper for graph adjacency matrix row keys.
+ * @tparam VertexIterator Type of the iterator for graph adjacency matrix row key values for
+ * aggregation (key type should coincide with vertex type).
+ * @tparam ValueIterator Type of the iterator for values in (key, value) pairs.
+ * @tparam KeyAggregatedEdgeOp Type of the quinary key-aggregated edge operator.
+ * @tparam ReduceOp Type of the binary reduction operator.
+ * @tparam T Type of the initial value for reduction over the key-aggregated incoming edges.
+ * @tparam VertexValueOutputIterator Type of the iterator for vertex output property variables.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
+ * (for the columns assigned to this process in multi-GPU). Use either
+ * cugraph::col_properties_t::device_view() (if @p e_op needs to access column properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access column properties). Use
+ * copy_to_adj_matrix_col to fill the wrapper.
+ * @param adj_matrix_row_key_input Device-copyable wrapper used to access row keys (for the rows
+ * assigned to this process in multi-GPU). Use cugraph::row_properties_t::device_view(). Use
+ * copy_to_adj_matrix_row to fill the wrapper.
+ * @param map_unique_key_first Iterator pointing to the first (inclusive) key in (key, value) pairs
+ * (assigned to this process in multi-GPU, `cugraph::detail::compute_gpu_id_from_vertex_t` is used
+ * to map keys to processes).
+ * @param map_unique_key_last Iterator pointing to the last (exclusive) key in (key, value) pairs
+ * (assigned to this process in multi-GPU).
+ * @param map_value_first Iterator pointing to the first (inclusive) value in (key, value) pairs
+ * (assigned to this process in multi-GPU). `map_value_last` (exclusive) is deduced as @p
+ * map_value_first + thrust::distance(@p map_unique_key_first, @p map_unique_key_last).
+ * @param key_aggregated_e_op Quinary operator takes edge destination, key, aggregated edge weight,
+ * column property value for the destination, and value for the key stored in the input (key,
+ * value) pairs (aggregated over the entire set of processes in multi-GPU).
+ * @param reduce_op Binary operator takes two input arguments and reduce the two variables to one.
+ * @param init Initial value to be added to the reduced @p reduce_op return values for each vertex.
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the
+ * first (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_output_last`
+ * (exclusive) is deduced as @p vertex_value_output_first + @p
+ * graph_view.get_number_of_local_vertices().
+ */
+template <typename GraphViewType,
+          typename AdjMatrixColValueInputWrapper,
+          typename AdjMatrixRowKeyInputWrapper,
+          typename VertexIterator,
+          typename ValueIterator,
+          typename KeyAggregatedEdgeOp,
+          typename ReduceOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_key_aggregated_in_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  AdjMatrixRowKeyInputWrapper adj_matrix_row_key_input,
+  VertexIterator map_unique_key_first,
+  VertexIterator map_unique_key_last,
+  ValueIterator map_value_first,
+  KeyAggregatedEdgeOp key_aggregated_e_op,
+  ReduceOp reduce_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first)
+{
+  nvtx_range_t range("copy_v_transform_reduce_key_aggregated_in_nbr");
+
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  key_aggregated_kv_map_t<typename GraphViewType::vertex_type,
+                          typename std::iterator_traits<ValueIterator>::value_type,
+                          GraphViewType::is_multi_gpu>
+    kv_map(handle, map_unique_key_first, map_unique_key_last, map_value_first);
+
+  detail::copy_v_transform_reduce_key_aggregated_nbr_impl(
+    handle,
+    graph_view,
+    adj_matrix_col_value_input,
+    detail::all_adj_matrix_majors_t<typename GraphViewType::vertex_type>{},
+    adj_matrix_row_key_input,
+    kv_map.device_view(),
+    key_aggregated_e_op,
+    reduce_op,
+    init,
+    vertex_value_output_first);
+}
+
+/**
+ * @brief Iterate over every vertex's key-aggregated incoming edges to update vertex properties
+ * (with a prebuilt (key, value) map).
+ *
+ * This function is identical to the above except that the (key, value) pairs are provided by a
+ * key_aggregated_kv_map_t object built in advance (and reusable over multiple calls while the
+ * pairs do not change).
+ *
+ * @tparam value_t Type of values in (key, value) pairs.
+ * @param kv_map (key, value) map built from the (key, value) pairs (assigned to this process in
+ * multi-GPU).
+ *
+ * See the above function for the remaining template and function parameters.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixColValueInputWrapper,
+          typename AdjMatrixRowKeyInputWrapper,
+          typename value_t,
+          typename KeyAggregatedEdgeOp,
+          typename ReduceOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_key_aggregated_in_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  AdjMatrixRowKeyInputWrapper adj_matrix_row_key_input,
+  key_aggregated_kv_map_t<typename GraphViewType::vertex_type,
+                          value_t,
+                          GraphViewType::is_multi_gpu> const& kv_map,
+  KeyAggregatedEdgeOp key_aggregated_e_op,
+  ReduceOp reduce_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first)
+{
+  nvtx_range_t range("copy_v_transform_reduce_key_aggregated_in_nbr");
+
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  detail::copy_v_transform_reduce_key_aggregated_nbr_impl(
+    handle,
+    graph_view,
+    adj_matrix_col_value_input,
+    detail::all_adj_matrix_majors_t<typename GraphViewType::vertex_type>{},
+    adj_matrix_row_key_input,
+    kv_map.device_view(),
+    key_aggregated_e_op,
+    reduce_op,
+    init,
+    vertex_value_output_first);
+}
+
+}  // namespace cugraph
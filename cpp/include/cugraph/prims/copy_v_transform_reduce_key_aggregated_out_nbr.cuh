@@ -23,6 +23,8 @@
 #include <cugraph/utilities/dataframe_buffer.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/prims_workspace.hpp>
+#include <cugraph/utilities/profiler.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 #include <cugraph/vertex_partition_device_view.cuh>
 
@@ -31,21 +33,24 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/mr/device/polymorphic_allocator.hpp>
 
+#include <iterator>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace cugraph {
 
 namespace detail {
 
 // a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
-template <typename AdjMatrixColKeyInputWrapper>
+template <typename AdjMatrixMinorKeyInputWrapper>
 struct minor_to_key_t {
-  using vertex_t = typename AdjMatrixColKeyInputWrapper::value_type;
-  AdjMatrixColKeyInputWrapper adj_matrix_col_key_input{};
+  using vertex_t = typename AdjMatrixMinorKeyInputWrapper::value_type;
+  AdjMatrixMinorKeyInputWrapper adj_matrix_minor_key_input{};
   vertex_t minor_first{};
   __device__ vertex_t operator()(vertex_t minor) const
   {
-    return adj_matrix_col_key_input.get(minor - minor_first);
+    return adj_matrix_minor_key_input.get(minor - minor_first);
   }
 };
 
@@ -64,28 +69,25 @@ struct minor_key_to_col_rank_t {
 // a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
 template <typename vertex_t,
           typename weight_t,
-          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixMajorValueInputWrapper,
           typename KeyAggregatedEdgeOp,
           typename MatrixPartitionDeviceView,
           typename StaticMapDeviceView>
 struct call_key_aggregated_e_op_t {
-  AdjMatrixRowValueInputWrapper matrix_partition_row_value_input{};
+  AdjMatrixMajorValueInputWrapper matrix_partition_major_value_input{};
   KeyAggregatedEdgeOp key_aggregated_e_op{};
   MatrixPartitionDeviceView matrix_partition{};
   StaticMapDeviceView kv_map{};
   __device__ auto operator()(
     thrust::tuple<vertex_t, vertex_t, weight_t> val /* major, minor key, weight */) const
   {
-    auto major     = thrust::get<0>(val);
-    auto key       = thrust::get<1>(val);
-    auto w         = thrust::get<2>(val);
-    auto row_value = matrix_partition_row_value_input.get(
-      matrix_partition.get_major_offset_from_major_nocheck(major));
-    auto key_val = kv_map.find(key)->second.load(cuda::std::memory_order_relaxed);
+    auto major = thrust::get<0>(val);
+    auto key   = thrust::get<1>(val);
+    auto w     = thrust::get<2>(val);
     return key_aggregated_e_op(major,
                                key,
                                w,
-                               matrix_partition_row_value_input.get(
+                               matrix_partition_major_value_input.get(
                                  matrix_partition.get_major_offset_from_major_nocheck(major)),
                                kv_map.find(key)->second.load(cuda::std::memory_order_relaxed));
   }
@@ -137,196 +139,83 @@ struct reduce_with_init_t {
   __device__ T operator()(T val) const { return reduce_op(val, init); }
 };
 
-}  // namespace detail
+// mask selecting every adjacency matrix major (row if not transposed, column if transposed)
+template <typename vertex_t>
+struct all_adj_matrix_majors_t {
+  void set_local_adj_matrix_partition_idx(size_t adj_matrix_partition_idx) {}
+  __device__ bool get(vertex_t offset) const { return true; }
+};
 
-/**
- * @brief Iterate over every vertex's key-aggregated outgoing edges to update vertex properties.
- *
- * This function is inspired by thrust::transfrom_reduce() (iteration over the outgoing edges
- * part) and thrust::copy() (update vertex properties part, take transform_reduce output as copy
- * input).
- * Unlike copy_v_transform_reduce_out_nbr, this function first aggregates outgoing edges by key to
- * support two level reduction for every vertex.
- *
- * @tparam GraphViewType Type of the passed non-owning graph object.
- * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
- * properties.
- * @tparam AdjMatrixColKeyInputWrapper Type of the wrapper for graph adjacency matrix column keys.
- * @tparam VertexIterator Type of the iterator for graph adjacency matrix column key values for
- * aggregation (key type should coincide with vertex type).
- * @tparam ValueIterator Type of the iterator for values in (key, value) pairs.
- * @tparam KeyAggregatedEdgeOp Type of the quinary key-aggregated edge operator.
- * @tparam ReduceOp Type of the binary reduction operator.
- * @tparam T Type of the initial value for reduction over the key-aggregated outgoing edges.
- * @tparam VertexValueOutputIterator Type of the iterator for vertex output property variables.
- * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
- * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Non-owning graph object.
- * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
- * (for the rows assigned to this process in multi-GPU). Use either
- * cugraph::row_properties_t::device_view() (if @p e_op needs to access row properties) or
- * cugraph::dummy_properties_t::device_view() (if @p e_op does not access row properties). Use
- * copy_to_adj_matrix_row to fill the wrapper.
- * @param adj_matrix_col_key_input Device-copyable wrapper used to access column keys (for the
- * columns assigned to this process in multi-GPU). Use either
- * cugraph::col_properties_t::device_view(). Use copy_to_adj_matrix_col to fill the wrapper.
- * @param map_unique_key_first Iterator pointing to the first (inclusive) key in (key, value) pairs
- * (assigned to this process in multi-GPU, `cugraph::detail::compute_gpu_id_from_vertex_t` is used
- * to map keys to processes). (Key, value) pairs may be provided by
- * transform_reduce_by_adj_matrix_row_key_e() or transform_reduce_by_adj_matrix_col_key_e().
- * @param map_unique_key_last Iterator pointing to the last (exclusive) key in (key, value) pairs
- * (assigned to this process in multi-GPU).
- * @param map_value_first Iterator pointing to the first (inclusive) value in (key, value) pairs
- * (assigned to this process in multi-GPU). `map_value_last` (exclusive) is deduced as @p
- * map_value_first + thrust::distance(@p map_unique_key_first, @p map_unique_key_last).
- * @param key_aggregated_e_op Quinary operator takes edge source, key, aggregated edge weight, *(@p
- * adj_matrix_row_value_input_first + i), and value for the key stored in the input (key, value)
- * pairs provided by @p map_unique_key_first, @p map_unique_key_last, and @p map_value_first
- * (aggregated over the entire set of processes in multi-GPU).
- * @param reduce_op Binary operator takes two input arguments and reduce the two variables to one.
- * @param init Initial value to be added to the reduced @p reduce_op return values for each vertex.
- * @param vertex_value_output_first Iterator pointing to the vertex property variables for the
- * first (inclusive) vertex (assigned to tihs process in multi-GPU). `vertex_value_output_last`
- * (exclusive) is deduced as @p vertex_value_output_first + @p
- * graph_view.get_number_of_local_vertices().
- */
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename AdjMatrixMajorMaskInputWrapper, typename MatrixPartitionDeviceView>
+struct is_unselected_major_t {
+  AdjMatrixMajorMaskInputWrapper matrix_partition_major_mask_input{};
+  MatrixPartitionDeviceView matrix_partition{};
+  template <typename EdgeTuple>
+  __device__ bool operator()(EdgeTuple e /* major, minor key[, weight] */) const
+  {
+    return !matrix_partition_major_mask_input.get(
+      matrix_partition.get_major_offset_from_major_nocheck(thrust::get<0>(e)));
+  }
+};
+
+// works on the matrix partition majors & minors, so this serves both the out-neighbor (major: row,
+// minor: column) and the in-neighbor (major: column, minor: row) variants
 template <typename GraphViewType,
-          typename AdjMatrixRowValueInputWrapper,
-          typename AdjMatrixColKeyInputWrapper,
-          typename VertexIterator,
-          typename ValueIterator,
+          typename AdjMatrixMajorValueInputWrapper,
+          typename AdjMatrixMajorMaskInputWrapper,
+          typename AdjMatrixMinorKeyInputWrapper,
+          typename StaticMapDeviceView,
           typename KeyAggregatedEdgeOp,
           typename ReduceOp,
           typename T,
           typename VertexValueOutputIterator>
-void copy_v_transform_reduce_key_aggregated_out_nbr(
+void copy_v_transform_reduce_key_aggregated_nbr_impl(
   raft::handle_t const& handle,
   GraphViewType const& graph_view,
-  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
-  AdjMatrixColKeyInputWrapper adj_matrix_col_key_input,
-  VertexIterator map_unique_key_first,
-  VertexIterator map_unique_key_last,
-  ValueIterator map_value_first,
+  AdjMatrixMajorValueInputWrapper adj_matrix_major_value_input,
+  AdjMatrixMajorMaskInputWrapper adj_matrix_major_mask_input,
+  AdjMatrixMinorKeyInputWrapper adj_matrix_minor_key_input,
+  StaticMapDeviceView kv_map_device_view,
   KeyAggregatedEdgeOp key_aggregated_e_op,
   ReduceOp reduce_op,
   T init,
   VertexValueOutputIterator vertex_value_output_first)
 {
-  static_assert(!GraphViewType::is_adj_matrix_transposed,
-                "GraphViewType should support the push model.");
-  static_assert(std::is_same<typename std::iterator_traits<VertexIterator>::value_type,
-                             typename GraphViewType::vertex_type>::value);
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
 
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
   using weight_t = typename GraphViewType::weight_type;
-  using value_t  = typename std::iterator_traits<ValueIterator>::value_type;
-
-  double constexpr load_factor = 0.7;
-
-  // 1. build a cuco::static_map object for the k, v pairs.
-
-  auto poly_alloc = rmm::mr::polymorphic_allocator<char>(rmm::mr::get_current_device_resource());
-  auto stream_adapter = rmm::mr::make_stream_allocator_adaptor(poly_alloc, cudaStream_t{nullptr});
-  auto kv_map_ptr     = std::make_unique<
-    cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, decltype(stream_adapter)>>(
-    size_t{0},
-    invalid_vertex_id<vertex_t>::value,
-    invalid_vertex_id<vertex_t>::value,
-    stream_adapter);
-  if (GraphViewType::is_multi_gpu) {
-    auto& comm               = handle.get_comms();
-    auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
-    auto const row_comm_rank = row_comm.get_rank();
-    auto const row_comm_size = row_comm.get_size();
-
-    auto map_counts = host_scalar_allgather(
-      row_comm,
-      static_cast<size_t>(thrust::distance(map_unique_key_first, map_unique_key_last)),
-      handle.get_stream());
-    std::vector<size_t> map_displacements(row_comm_size, size_t{0});
-    std::partial_sum(map_counts.begin(), map_counts.end() - 1, map_displacements.begin() + 1);
-    rmm::device_uvector<vertex_t> map_keys(map_displacements.back() + map_counts.back(),
-                                           handle.get_stream());
-    auto map_value_buffer =
-      allocate_dataframe_buffer<value_t>(map_keys.size(), handle.get_stream());
-    for (int i = 0; i < row_comm_size; ++i) {
-      device_bcast(row_comm,
-                   map_unique_key_first,
-                   map_keys.begin() + map_displacements[i],
-                   map_counts[i],
-                   i,
-                   handle.get_stream());
-      device_bcast(row_comm,
-                   map_value_first,
-                   get_dataframe_buffer_begin(map_value_buffer) + map_displacements[i],
-                   map_counts[i],
-                   i,
-                   handle.get_stream());
-    }
 
-    handle.get_stream_view().synchronize();  // cuco::static_map currently does not take stream
-
-    kv_map_ptr.reset();
-
-    kv_map_ptr = std::make_unique<
-      cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, decltype(stream_adapter)>>(
-      // cuco::static_map requires at least one empty slot
-      std::max(
-        static_cast<size_t>(static_cast<double>(map_keys.size()) / load_factor),
-        static_cast<size_t>(thrust::distance(map_unique_key_first, map_unique_key_last)) + 1),
-      invalid_vertex_id<vertex_t>::value,
-      invalid_vertex_id<vertex_t>::value,
-      stream_adapter);
-
-    auto pair_first = thrust::make_zip_iterator(
-      thrust::make_tuple(map_keys.begin(), get_dataframe_buffer_begin(map_value_buffer)));
-    kv_map_ptr->insert(pair_first, pair_first + map_keys.size());
-  } else {
-    handle.get_stream_view().synchronize();  // cuco::static_map currently does not take stream
-
-    kv_map_ptr.reset();
-
-    kv_map_ptr = std::make_unique<
-      cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, decltype(stream_adapter)>>(
-      // cuco::static_map requires at least one empty slot
-      std::max(
-        static_cast<size_t>(
-          static_cast<double>(thrust::distance(map_unique_key_first, map_unique_key_last)) /
-          load_factor),
-        static_cast<size_t>(thrust::distance(map_unique_key_first, map_unique_key_last)) + 1),
-      invalid_vertex_id<vertex_t>::value,
-      invalid_vertex_id<vertex_t>::value,
-      stream_adapter);
-
-    auto pair_first =
-      thrust::make_zip_iterator(thrust::make_tuple(map_unique_key_first, map_value_first));
-    kv_map_ptr->insert(pair_first,
-                       pair_first + thrust::distance(map_unique_key_first, map_unique_key_last));
-  }
+  // 1. aggregate each vertex's edges (out-going if not transposed, in-coming if transposed) based
+  // on keys and transform-reduce.
 
-  // 2. aggregate each vertex out-going edges based on keys and transform-reduce.
+  // the temporary buffers are kept across the calls by the prims workspace (if any)
+  auto workspace_mr = get_prims_workspace_resource();
 
-  rmm::device_uvector<vertex_t> major_vertices(0, handle.get_stream());
-  auto e_op_result_buffer = allocate_dataframe_buffer<T>(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> major_vertices(0, handle.get_stream(), workspace_mr);
+  auto e_op_result_buffer = allocate_dataframe_buffer<T>(0, handle.get_stream(), workspace_mr);
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     auto matrix_partition =
       matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
         graph_view.get_matrix_partition_view(i));
 
-    rmm::device_uvector<vertex_t> tmp_major_vertices(matrix_partition.get_number_of_edges(),
-                                                     handle.get_stream());
-    rmm::device_uvector<vertex_t> tmp_minor_keys(tmp_major_vertices.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> tmp_major_vertices(
+      matrix_partition.get_number_of_edges(), handle.get_stream(), workspace_mr);
+    rmm::device_uvector<vertex_t> tmp_minor_keys(
+      tmp_major_vertices.size(), handle.get_stream(), workspace_mr);
     rmm::device_uvector<weight_t> tmp_key_aggregated_edge_weights(
-      graph_view.is_weighted() ? tmp_major_vertices.size() : size_t{0}, handle.get_stream());
+      graph_view.is_weighted() ? tmp_major_vertices.size() : size_t{0},
+      handle.get_stream(),
+      workspace_mr);
 
     if (matrix_partition.get_major_size() > 0) {
       auto minor_key_first = thrust::make_transform_iterator(
-        matrix_partition.get_indices(),
-        detail::minor_to_key_t<AdjMatrixColKeyInputWrapper>{adj_matrix_col_key_input,
-                                                            matrix_partition.get_minor_first()});
-      auto execution_policy = handle.get_thrust_policy();
+        matrix_partition.get_minors(),
+        minor_to_key_t<AdjMatrixMinorKeyInputWrapper>{adj_matrix_minor_key_input,
+                                                      matrix_partition.get_minor_first()});
+      auto execution_policy = get_prims_workspace_thrust_policy(handle);
       thrust::copy(execution_policy,
                    minor_key_first,
                    minor_key_first + matrix_partition.get_number_of_edges(),
@@ -337,17 +226,71 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
                      *(matrix_partition.get_weights()) + matrix_partition.get_number_of_edges(),
                      tmp_key_aggregated_edge_weights.begin());
       }
-      detail::decompress_matrix_partition_to_fill_edgelist_majors(
+      decompress_matrix_partition_to_fill_edgelist_majors(
         handle,
         matrix_partition,
         tmp_major_vertices.data(),
         graph_view.get_local_adj_matrix_partition_segment_offsets(i));
-      rmm::device_uvector<vertex_t> reduced_major_vertices(tmp_major_vertices.size(),
-                                                           handle.get_stream());
-      rmm::device_uvector<vertex_t> reduced_minor_keys(reduced_major_vertices.size(),
-                                                       handle.get_stream());
+      if (matrix_partition.get_edge_mask()) {
+        size_t num_valid_edges{};
+        if (graph_view.is_weighted()) {
+          auto edge_first =
+            thrust::make_zip_iterator(thrust::make_tuple(tmp_major_vertices.begin(),
+                                                         tmp_minor_keys.begin(),
+                                                         tmp_key_aggregated_edge_weights.begin()));
+          num_valid_edges = remove_masked_out_edges(handle, matrix_partition, edge_first);
+        } else {
+          auto edge_first = thrust::make_zip_iterator(
+            thrust::make_tuple(tmp_major_vertices.begin(), tmp_minor_keys.begin()));
+          num_valid_edges = remove_masked_out_edges(handle, matrix_partition, edge_first);
+        }
+        tmp_major_vertices.resize(num_valid_edges, handle.get_stream());
+        tmp_minor_keys.resize(tmp_major_vertices.size(), handle.get_stream());
+        if (graph_view.is_weighted()) {
+          tmp_key_aggregated_edge_weights.resize(tmp_major_vertices.size(), handle.get_stream());
+        }
+      }
+      if constexpr (!std::is_same_v<AdjMatrixMajorMaskInputWrapper,
+                                    all_adj_matrix_majors_t<vertex_t>>) {
+        // drop the edges of the unselected majors before the (dominant) sort & reduce_by_key
+        auto matrix_partition_major_mask_input = adj_matrix_major_mask_input;
+        matrix_partition_major_mask_input.set_local_adj_matrix_partition_idx(i);
+        is_unselected_major_t<AdjMatrixMajorMaskInputWrapper, decltype(matrix_partition)>
+          is_unselected_op{matrix_partition_major_mask_input, matrix_partition};
+        size_t num_selected_edges{};
+        if (graph_view.is_weighted()) {
+          auto edge_first =
+            thrust::make_zip_iterator(thrust::make_tuple(tmp_major_vertices.begin(),
+                                                         tmp_minor_keys.begin(),
+                                                         tmp_key_aggregated_edge_weights.begin()));
+          num_selected_edges = thrust::distance(
+            edge_first,
+            thrust::remove_if(execution_policy,
+                              edge_first,
+                              edge_first + tmp_major_vertices.size(),
+                              is_unselected_op));
+        } else {
+          auto edge_first = thrust::make_zip_iterator(
+            thrust::make_tuple(tmp_major_vertices.begin(), tmp_minor_keys.begin()));
+          num_selected_edges = thrust::distance(
+            edge_first,
+            thrust::remove_if(execution_policy,
+                              edge_first,
+                              edge_first + tmp_major_vertices.size(),
+                              is_unselected_op));
+        }
+        tmp_major_vertices.resize(num_selected_edges, handle.get_stream());
+        tmp_minor_keys.resize(tmp_major_vertices.size(), handle.get_stream());
+        if (graph_view.is_weighted()) {
+          tmp_key_aggregated_edge_weights.resize(tmp_major_vertices.size(), handle.get_stream());
+        }
+      }
+      rmm::device_uvector<vertex_t> reduced_major_vertices(
+        tmp_major_vertices.size(), handle.get_stream(), workspace_mr);
+      rmm::device_uvector<vertex_t> reduced_minor_keys(
+        reduced_major_vertices.size(), handle.get_stream(), workspace_mr);
       rmm::device_uvector<weight_t> reduced_key_aggregated_edge_weights(
-        reduced_major_vertices.size(), handle.get_stream());
+        reduced_major_vertices.size(), handle.get_stream(), workspace_mr);
       size_t reduced_size{};
       // FIXME: cub segmented sort may be more efficient as this is already sorted by major
       auto input_key_first = thrust::make_zip_iterator(
@@ -413,13 +356,13 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
           col_comm,
           triplet_first,
           triplet_first + tmp_major_vertices.size(),
-          detail::minor_key_to_col_rank_t<vertex_t, weight_t>{
-            detail::compute_gpu_id_from_vertex_t<vertex_t>{comm_size}, row_comm_size},
+          minor_key_to_col_rank_t<vertex_t, weight_t>{
+            compute_gpu_id_from_vertex_t<vertex_t>{comm_size}, row_comm_size},
           handle.get_stream());
 
       auto pair_first = thrust::make_zip_iterator(
         thrust::make_tuple(rx_major_vertices.begin(), rx_minor_keys.begin()));
-      auto execution_policy = handle.get_thrust_policy();
+      auto execution_policy = get_prims_workspace_thrust_policy(handle);
       thrust::sort_by_key(execution_policy,
                           pair_first,
                           pair_first + rx_major_vertices.size(),
@@ -445,11 +388,11 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
     }
 
     auto tmp_e_op_result_buffer =
-      allocate_dataframe_buffer<T>(tmp_major_vertices.size(), handle.get_stream());
+      allocate_dataframe_buffer<T>(tmp_major_vertices.size(), handle.get_stream(), workspace_mr);
     auto tmp_e_op_result_buffer_first = get_dataframe_buffer_begin(tmp_e_op_result_buffer);
 
-    auto matrix_partition_row_value_input = adj_matrix_row_value_input;
-    matrix_partition_row_value_input.set_local_adj_matrix_partition_idx(i);
+    auto matrix_partition_major_value_input = adj_matrix_major_value_input;
+    matrix_partition_major_value_input.set_local_adj_matrix_partition_idx(i);
 
     auto triplet_first = thrust::make_zip_iterator(thrust::make_tuple(
       tmp_major_vertices.begin(), tmp_minor_keys.begin(), tmp_key_aggregated_edge_weights.begin()));
@@ -457,16 +400,16 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
                       triplet_first,
                       triplet_first + tmp_major_vertices.size(),
                       tmp_e_op_result_buffer_first,
-                      detail::call_key_aggregated_e_op_t<vertex_t,
-                                                         weight_t,
-                                                         AdjMatrixRowValueInputWrapper,
-                                                         KeyAggregatedEdgeOp,
-                                                         decltype(matrix_partition),
-                                                         decltype(kv_map_ptr->get_device_view())>{
-                        matrix_partition_row_value_input,
+                      call_key_aggregated_e_op_t<vertex_t,
+                                                 weight_t,
+                                                 AdjMatrixMajorValueInputWrapper,
+                                                 KeyAggregatedEdgeOp,
+                                                 decltype(matrix_partition),
+                                                 StaticMapDeviceView>{
+                        matrix_partition_major_value_input,
                         key_aggregated_e_op,
                         matrix_partition,
-                        kv_map_ptr->get_device_view()});
+                        kv_map_device_view});
     tmp_minor_keys.resize(0, handle.get_stream());
     tmp_key_aggregated_edge_weights.resize(0, handle.get_stream());
     tmp_minor_keys.shrink_to_fit(handle.get_stream());
@@ -483,14 +426,14 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
       auto rx_sizes =
         host_scalar_gather(col_comm, tmp_major_vertices.size(), i, handle.get_stream());
       std::vector<size_t> rx_displs{};
-      rmm::device_uvector<vertex_t> rx_major_vertices(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> rx_major_vertices(0, handle.get_stream(), workspace_mr);
       if (static_cast<size_t>(col_comm_rank) == i) {
         rx_displs.assign(col_comm_size, size_t{0});
         std::partial_sum(rx_sizes.begin(), rx_sizes.end() - 1, rx_displs.begin() + 1);
         rx_major_vertices.resize(rx_displs.back() + rx_sizes.back(), handle.get_stream());
       }
       auto rx_tmp_e_op_result_buffer =
-        allocate_dataframe_buffer<T>(rx_major_vertices.size(), handle.get_stream());
+        allocate_dataframe_buffer<T>(rx_major_vertices.size(), handle.get_stream(), workspace_mr);
 
       device_gatherv(col_comm,
                      tmp_major_vertices.data(),
@@ -519,7 +462,9 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
     }
   }
 
-  auto execution_policy = handle.get_thrust_policy();
+  // 2. reduce the transformed values (majors are local vertices after the gather in multi-GPU)
+
+  auto execution_policy = get_prims_workspace_thrust_policy(handle);
   thrust::fill(execution_policy,
                vertex_value_output_first,
                vertex_value_output_first + graph_view.get_number_of_local_vertices(),
@@ -532,17 +477,18 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
   auto num_uniques = thrust::count_if(execution_policy,
                                       thrust::make_counting_iterator(size_t{0}),
                                       thrust::make_counting_iterator(major_vertices.size()),
-                                      detail::is_first_in_run_t<vertex_t>{major_vertices.data()});
-  rmm::device_uvector<vertex_t> unique_major_vertices(num_uniques, handle.get_stream());
+                                      is_first_in_run_t<vertex_t>{major_vertices.data()});
+  rmm::device_uvector<vertex_t> unique_major_vertices(
+    num_uniques, handle.get_stream(), workspace_mr);
 
   auto major_vertex_first = thrust::make_transform_iterator(
     thrust::make_counting_iterator(size_t{0}),
-    detail::invalidate_if_not_first_in_run_t<vertex_t>{major_vertices.data()});
+    invalidate_if_not_first_in_run_t<vertex_t>{major_vertices.data()});
   thrust::copy_if(execution_policy,
                   major_vertex_first,
                   major_vertex_first + major_vertices.size(),
                   unique_major_vertices.begin(),
-                  detail::is_valid_vertex_t<vertex_t>{});
+                  is_valid_vertex_t<vertex_t>{});
   thrust::reduce_by_key(execution_policy,
                         major_vertices.begin(),
                         major_vertices.end(),
@@ -552,7 +498,7 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
                           vertex_value_output_first,
                           thrust::make_transform_iterator(
                             unique_major_vertices.begin(),
-                            detail::vertex_local_offset_t<vertex_t, GraphViewType::is_multi_gpu>{
+                            vertex_local_offset_t<vertex_t, GraphViewType::is_multi_gpu>{
                               graph_view.get_vertex_partition_view()})),
                         thrust::equal_to<vertex_t>{},
                         reduce_op);
@@ -561,7 +507,384 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
                     vertex_value_output_first,
                     vertex_value_output_first + graph_view.get_number_of_local_vertices(),
                     vertex_value_output_first,
-                    detail::reduce_with_init_t<ReduceOp, T>{reduce_op, init});
+                    reduce_with_init_t<ReduceOp, T>{reduce_op, init});
+}
+
+}  // namespace detail
+
+/**
+ * @brief (key, value) map for the key-aggregated edge prims.
+ *
+ * copy_v_transform_reduce_key_aggregated_out_nbr and copy_v_transform_reduce_key_aggregated_in_nbr
+ * look up the value for every aggregated key in a hash map built from the input (key, value)
+ * pairs. Building the map (and, in multi-GPU, broadcasting the pairs within the row communicator)
+ * every call is wasted work if the pairs do not change between calls; build this object once and
+ * pass it to the overloads taking a prebuilt map instead.
+ *
+ * @tparam vertex_t Type of vertex identifiers (and keys). Needs to be an integral type.
+ * @tparam value_t Type of values in (key, value) pairs.
+ * @tparam multi_gpu Flag indicating whether the map will be used with single-GPU (false) or
+ * multi-GPU (true) graphs.
+ */
+template <typename vertex_t, typename value_t, bool multi_gpu>
+class key_aggregated_kv_map_t {
+ public:
+  using allocator_type = rmm::mr::stream_allocator_adaptor<rmm::mr::polymorphic_allocator<char>>;
+  using map_type = cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, allocator_type>;
+
+  /**
+   * @brief Build the map.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param map_unique_key_first Iterator pointing to the first (inclusive) key in (key, value)
+   * pairs (assigned to this process in multi-GPU, `cugraph::detail::compute_gpu_id_from_vertex_t`
+   * is used to map keys to processes).
+   * @param map_unique_key_last Iterator pointing to the last (exclusive) key in (key, value) pairs
+   * (assigned to this process in multi-GPU).
+   * @param map_value_first Iterator pointing to the first (inclusive) value in (key, value) pairs
+   * (assigned to this process in multi-GPU).
+   */
+  template <typename VertexIterator, typename ValueIterator>
+  key_aggregated_kv_map_t(raft::handle_t const& handle,
+                          VertexIterator map_unique_key_first,
+                          VertexIterator map_unique_key_last,
+                          ValueIterator map_value_first)
+  {
+    static_assert(
+      std::is_same_v<typename std::iterator_traits<VertexIterator>::value_type, vertex_t>);
+    static_assert(
+      std::is_same_v<typename std::iterator_traits<ValueIterator>::value_type, value_t>);
+
+    double constexpr load_factor = 0.7;
+
+    auto poly_alloc =
+      rmm::mr::polymorphic_allocator<char>(rmm::mr::get_current_device_resource());
+    auto stream_adapter = rmm::mr::make_stream_allocator_adaptor(poly_alloc, cudaStream_t{nullptr});
+    auto num_local_keys =
+      static_cast<size_t>(thrust::distance(map_unique_key_first, map_unique_key_last));
+    if constexpr (multi_gpu) {
+      auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+      auto const row_comm_size = row_comm.get_size();
+
+      auto map_counts = host_scalar_allgather(row_comm, num_local_keys, handle.get_stream());
+      std::vector<size_t> map_displacements(row_comm_size, size_t{0});
+      std::partial_sum(map_counts.begin(), map_counts.end() - 1, map_displacements.begin() + 1);
+      rmm::device_uvector<vertex_t> map_keys(map_displacements.back() + map_counts.back(),
+                                             handle.get_stream());
+      auto map_value_buffer =
+        allocate_dataframe_buffer<value_t>(map_keys.size(), handle.get_stream());
+      for (int i = 0; i < row_comm_size; ++i) {
+        device_bcast(row_comm,
+                     map_unique_key_first,
+                     map_keys.begin() + map_displacements[i],
+                     map_counts[i],
+                     i,
+                     handle.get_stream());
+        device_bcast(row_comm,
+                     map_value_first,
+                     get_dataframe_buffer_begin(map_value_buffer) + map_displacements[i],
+                     map_counts[i],
+                     i,
+                     handle.get_stream());
+      }
+
+      handle.get_stream_view().synchronize();  // cuco::static_map currently does not take stream
+
+      kv_map_ptr_ = std::make_unique<map_type>(
+        // cuco::static_map requires at least one empty slot
+        std::max(static_cast<size_t>(static_cast<double>(map_keys.size()) / load_factor),
+                 num_local_keys + 1),
+        invalid_vertex_id<vertex_t>::value,
+        invalid_vertex_id<vertex_t>::value,
+        stream_adapter);
+
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(map_keys.begin(), get_dataframe_buffer_begin(map_value_buffer)));
+      kv_map_ptr_->insert(pair_first, pair_first + map_keys.size());
+    } else {
+      handle.get_stream_view().synchronize();  // cuco::static_map currently does not take stream
+
+      kv_map_ptr_ = std::make_unique<map_type>(
+        // cuco::static_map requires at least one empty slot
+        std::max(static_cast<size_t>(static_cast<double>(num_local_keys) / load_factor),
+                 num_local_keys + 1),
+        invalid_vertex_id<vertex_t>::value,
+        invalid_vertex_id<vertex_t>::value,
+        stream_adapter);
+
+      auto pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(map_unique_key_first, map_value_first));
+      kv_map_ptr_->insert(pair_first, pair_first + num_local_keys);
+    }
+  }
+
+  auto device_view() const { return kv_map_ptr_->get_device_view(); }
+
+ private:
+  std::unique_ptr<map_type> kv_map_ptr_{};
+};
+
+/**
+ * @brief Iterate over every vertex's key-aggregated outgoing edges to update vertex properties.
+ *
+ * This function is inspired by thrust::transfrom_reduce() (iteration over the outgoing edges
+ * part) and thrust::copy() (update vertex properties part, take transform_reduce output as copy
+ * input).
+ * Unlike copy_v_transform_reduce_out_nbr, this function first aggregates outgoing edges by key to
+ * support two level reduction for every vertex.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
+ * properties.
+ * @tparam AdjMatrixColKeyInputWrapper Type of the wrapper for graph adjacency matrix column keys.
+ * @tparam VertexIterator Type of the iterator for graph adjacency matrix column key values for
+ * aggregation (key type should coincide with vertex type).
+ * @tparam ValueIterator Type of the iterator for values in (key, value) pairs.
+ * @tparam KeyAggregatedEdgeOp Type of the quinary key-aggregated edge operator.
+ * @tparam ReduceOp Type of the binary reduction operator.
+ * @tparam T Type of the initial value for reduction over the key-aggregated outgoing edges.
+ * @tparam VertexValueOutputIterator Type of the iterator for vertex output property variables.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
+ * (for the rows assigned to this process in multi-GPU). Use either
+ * cugraph::row_properties_t::device_view() (if @p e_op needs to access row properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access row properties). Use
+ * copy_to_adj_matrix_row to fill the wrapper.
+ * @param adj_matrix_col_key_input Device-copyable wrapper used to access column keys (for the
+ * columns assigned to this process in multi-GPU). Use either
+ * cugraph::col_properties_t::device_view(). Use copy_to_adj_matrix_col to fill the wrapper.
+ * @param map_unique_key_first Iterator pointing to the first (inclusive) key in (key, value) pairs
+ * (assigned to this process in multi-GPU, `cugraph::detail::compute_gpu_id_from_vertex_t` is used
+ * to map keys to processes). (Key, value) pairs may be provided by
+ * transform_reduce_by_adj_matrix_row_key_e() or transform_reduce_by_adj_matrix_col_key_e().
+ * @param map_unique_key_last Iterator pointing to the last (exclusive) key in (key, value) pairs
+ * (assigned to this process in multi-GPU).
+ * @param map_value_first Iterator pointing to the first (inclusive) value in (key, value) pairs
+ * (assigned to this process in multi-GPU). `map_value_last` (exclusive) is deduced as @p
+ * map_value_first + thrust::distance(@p map_unique_key_first, @p map_unique_key_last).
+ * @param key_aggregated_e_op Quinary operator takes edge source, key, aggregated edge weight, *(@p
+ * adj_matrix_row_value_input_first + i), and value for the key stored in the input (key, value)
+ * pairs provided by @p map_unique_key_first, @p map_unique_key_last, and @p map_value_first
+ * (aggregated over the entire set of processes in multi-GPU).
+ * @param reduce_op Binary operator takes two input arguments and reduce the two variables to one.
+ * @param init Initial value to be added to the reduced @p reduce_op return values for each vertex.
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the
+ * first (inclusive) vertex (assigned to tihs process in multi-GPU). `vertex_value_output_last`
+ * (exclusive) is deduced as @p vertex_value_output_first + @p
+ * graph_view.get_number_of_local_vertices().
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColKeyInputWrapper,
+          typename VertexIterator,
+          typename ValueIterator,
+          typename KeyAggregatedEdgeOp,
+          typename ReduceOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_key_aggregated_out_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColKeyInputWrapper adj_matrix_col_key_input,
+  VertexIterator map_unique_key_first,
+  VertexIterator map_unique_key_last,
+  ValueIterator map_value_first,
+  KeyAggregatedEdgeOp key_aggregated_e_op,
+  ReduceOp reduce_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first)
+{
+  nvtx_range_t range("copy_v_transform_reduce_key_aggregated_out_nbr");
+
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  key_aggregated_kv_map_t<typename GraphViewType::vertex_type,
+                          typename std::iterator_traits<ValueIterator>::value_type,
+                          GraphViewType::is_multi_gpu>
+    kv_map(handle, map_unique_key_first, map_unique_key_last, map_value_first);
+
+  detail::copy_v_transform_reduce_key_aggregated_nbr_impl(
+    handle,
+    graph_view,
+    adj_matrix_row_value_input,
+    detail::all_adj_matrix_majors_t<typename GraphViewType::vertex_type>{},
+    adj_matrix_col_key_input,
+    kv_map.device_view(),
+    key_aggregated_e_op,
+    reduce_op,
+    init,
+    vertex_value_output_first);
+}
+
+/**
+ * @brief Iterate over the key-aggregated outgoing edges of the vertices selected by a row mask to
+ * update vertex properties.
+ *
+ * This function is identical to the above except that only the outgoing edges of the vertices
+ * with non-zero @p adj_matrix_row_mask_input values are aggregated and transformed. The edges of
+ * the unselected vertices are dropped before aggregation, so the cost of the sort & reduction
+ * (dominating the cost of this function) is proportional to the number of the selected vertices'
+ * edges. Unselected vertices (and selected vertices without outgoing edges) are set to
+ * reduce_op(T{}, @p init).
+ *
+ * @tparam AdjMatrixRowMaskInputWrapper Type of the wrapper for graph adjacency matrix row masks.
+ * @param adj_matrix_row_mask_input Device-copyable wrapper used to access row masks (for the rows
+ * assigned to this process in multi-GPU). Use cugraph::row_properties_t::device_view() (with an
+ * integral value type, non-zero to select). Use copy_to_adj_matrix_row to fill the wrapper.
+ *
+ * See the above function for the remaining template and function parameters.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixRowMaskInputWrapper,
+          typename AdjMatrixColKeyInputWrapper,
+          typename VertexIterator,
+          typename ValueIterator,
+          typename KeyAggregatedEdgeOp,
+          typename ReduceOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_key_aggregated_out_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixRowMaskInputWrapper adj_matrix_row_mask_input,
+  AdjMatrixColKeyInputWrapper adj_matrix_col_key_input,
+  VertexIterator map_unique_key_first,
+  VertexIterator map_unique_key_last,
+  ValueIterator map_value_first,
+  KeyAggregatedEdgeOp key_aggregated_e_op,
+  ReduceOp reduce_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first)
+{
+  nvtx_range_t range("copy_v_transform_reduce_key_aggregated_out_nbr");
+
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  key_aggregated_kv_map_t<typename GraphViewType::vertex_type,
+                          typename std::iterator_traits<ValueIterator>::value_type,
+                          GraphViewType::is_multi_gpu>
+    kv_map(handle, map_unique_key_first, map_unique_key_last, map_value_first);
+
+  detail::copy_v_transform_reduce_key_aggregated_nbr_impl(handle,
+                                                          graph_view,
+                                                          adj_matrix_row_value_input,
+                                                          adj_matrix_row_mask_input,
+                                                          adj_matrix_col_key_input,
+                                                          kv_map.device_view(),
+                                                          key_aggregated_e_op,
+                                                          reduce_op,
+                                                          init,
+                                                          vertex_value_output_first);
+}
+
+/**
+ * @brief Iterate over every vertex's key-aggregated outgoing edges to update vertex properties
+ * (with a prebuilt (key, value) map).
+ *
+ * This function is identical to the first overload above except that the (key, value) pairs are
+ * provided by a key_aggregated_kv_map_t object built in advance (and reusable over multiple calls
+ * while the pairs do not change).
+ *
+ * @tparam value_t Type of values in (key, value) pairs.
+ * @param kv_map (key, value) map built from the (key, value) pairs (assigned to this process in
+ * multi-GPU).
+ *
+ * See the first overload above for the remaining template and function parameters.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColKeyInputWrapper,
+          typename value_t,
+          typename KeyAggregatedEdgeOp,
+          typename ReduceOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_key_aggregated_out_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColKeyInputWrapper adj_matrix_col_key_input,
+  key_aggregated_kv_map_t<typename GraphViewType::vertex_type,
+                          value_t,
+                          GraphViewType::is_multi_gpu> const& kv_map,
+  KeyAggregatedEdgeOp key_aggregated_e_op,
+  ReduceOp reduce_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first)
+{
+  nvtx_range_t range("copy_v_transform_reduce_key_aggregated_out_nbr");
+
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  detail::copy_v_transform_reduce_key_aggregated_nbr_impl(
+    handle,
+    graph_view,
+    adj_matrix_row_value_input,
+    detail::all_adj_matrix_majors_t<typename GraphViewType::vertex_type>{},
+    adj_matrix_col_key_input,
+    kv_map.device_view(),
+    key_aggregated_e_op,
+    reduce_op,
+    init,
+    vertex_value_output_first);
+}
+
+/**
+ * @brief Iterate over the key-aggregated outgoing edges of the vertices selected by a row mask to
+ * update vertex properties (with a prebuilt (key, value) map).
+ *
+ * This function is identical to the row-masked overload above except that the (key, value) pairs
+ * are provided by a key_aggregated_kv_map_t object built in advance.
+ *
+ * See the above functions for the template and function parameters.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixRowMaskInputWrapper,
+          typename AdjMatrixColKeyInputWrapper,
+          typename value_t,
+          typename KeyAggregatedEdgeOp,
+          typename ReduceOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_key_aggregated_out_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixRowMaskInputWrapper adj_matrix_row_mask_input,
+  AdjMatrixColKeyInputWrapper adj_matrix_col_key_input,
+  key_aggregated_kv_map_t<typename GraphViewType::vertex_type,
+                          value_t,
+                          GraphViewType::is_multi_gpu> const& kv_map,
+  KeyAggregatedEdgeOp key_aggregated_e_op,
+  ReduceOp reduce_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first)
+{
+  nvtx_range_t range("copy_v_transform_reduce_key_aggregated_out_nbr");
+
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  detail::copy_v_transform_reduce_key_aggregated_nbr_impl(handle,
+                                                          graph_view,
+                                                          adj_matrix_row_value_input,
+                                                          adj_matrix_row_mask_input,
+                                                          adj_matrix_col_key_input,
+                                                          kv_map.device_view(),
+                                                          key_aggregated_e_op,
+                                                          reduce_op,
+                                                          init,
+                                                          vertex_value_output_first);
 }
 
 }  // namespace cugraph
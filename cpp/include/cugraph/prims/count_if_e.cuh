@@ -18,6 +18,8 @@
 #include <cugraph/graph_view.hpp>
 #include <cugraph/prims/property_op_utils.cuh>
 #include <cugraph/prims/transform_reduce_e.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/profiler.hpp>
 
 #include <raft/handle.hpp>
 
@@ -65,11 +67,63 @@ typename GraphViewType::edge_type count_if_e(
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
   EdgeOp e_op)
 {
+  nvtx_range_t range("count_if_e");
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  return transform_reduce_e(handle,
+                            graph_view,
+                            adj_matrix_row_value_input,
+                            adj_matrix_col_value_input,
+                            cast_edge_op_bool_to_integer<GraphViewType,
+                                                         vertex_t,
+                                                         AdjMatrixRowValueInputWrapper,
+                                                         AdjMatrixColValueInputWrapper,
+                                                         EdgeOp,
+                                                         edge_t>{e_op},
+                            edge_t{0});
+}
+
+/**
+ * @brief Count the number of edges of the given vertices that satisfies the given predicate.
+ *
+ * This function is identical to count_if_e() above except that only the edges whose major end
+ * points (sources if GraphViewType::is_adj_matrix_transposed is false, destinations otherwise) are
+ * in [@p local_vertex_first, @p local_vertex_last) are visited. The work is proportional to the
+ * number of the visited edges.
+ *
+ * @tparam VertexIterator Type of the iterator for the vertices.
+ * @param local_vertex_first Iterator pointing to the first (inclusive) vertex of the vertices
+ * (assigned to this process in multi-GPU). The vertices should be sorted and unique.
+ * @param local_vertex_last Iterator pointing to the last (exclusive) vertex of the vertices
+ * (assigned to this process in multi-GPU).
+ *
+ * See count_if_e() above for the remaining template and function parameters.
+ */
+template <typename GraphViewType,
+          typename VertexIterator,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp>
+typename GraphViewType::edge_type count_if_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexIterator local_vertex_first,
+  VertexIterator local_vertex_last,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeOp e_op)
+{
+  nvtx_range_t range("count_if_e");
+
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
 
   return transform_reduce_e(handle,
                             graph_view,
+                            local_vertex_first,
+                            local_vertex_last,
                             adj_matrix_row_value_input,
                             adj_matrix_col_value_input,
                             cast_edge_op_bool_to_integer<GraphViewType,
@@ -81,4 +135,39 @@ typename GraphViewType::edge_type count_if_e(
                             edge_t{0});
 }
 
+/**
+ * @brief Count the number of edges of the vertices in a vertex frontier bucket that satisfies the
+ * given predicate.
+ *
+ * This function is identical to the above except that the vertices are provided by a
+ * SortedUniqueKeyBucket object (e.g. VertexFrontier::get_bucket()).
+ *
+ * @param bucket SortedUniqueKeyBucket object holding the vertices (assigned to this process in
+ * multi-GPU).
+ *
+ * See the above function for the remaining template and function parameters.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp>
+typename GraphViewType::edge_type count_if_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  SortedUniqueKeyBucket<typename GraphViewType::vertex_type,
+                        void,
+                        GraphViewType::is_multi_gpu> const& bucket,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeOp e_op)
+{
+  return count_if_e(handle,
+                    graph_view,
+                    bucket.begin(),
+                    bucket.end(),
+                    adj_matrix_row_value_input,
+                    adj_matrix_col_value_input,
+                    e_op);
+}
+
 }  // namespace cugraph
@@ -18,6 +18,7 @@
 #include <cugraph/graph_view.hpp>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 
 #include <raft/handle.hpp>
 #include <rmm/exec_policy.hpp>
@@ -53,6 +54,8 @@ typename GraphViewType::vertex_type count_if_v(raft::handle_t const& handle,
                                                VertexValueInputIterator vertex_value_input_first,
                                                VertexOp v_op)
 {
+  nvtx_range_t range("count_if_v");
+
   auto count =
     thrust::count_if(handle.get_thrust_policy(),
                      vertex_value_input_first,
@@ -65,6 +68,41 @@ typename GraphViewType::vertex_type count_if_v(raft::handle_t const& handle,
   return count;
 }
 
+/**
+ * @brief Count the number of vertices that satisfies the given predicate, deferring the inter-GPU
+ * reduction.
+ *
+ * This function is identical to count_if_v() above except that the count of this GPU is added to
+ * @p deferred instead of being all-reduced right away (see deferred_host_scalar_allreduce_t).
+ *
+ * @param deferred Object collecting the scalars to be all-reduced together (the reduction operation
+ * should be raft::comms::op_t::SUM).
+ * @return size_t Slot of the count in @p deferred (valid after @p deferred.resolve()).
+ *
+ * See count_if_v() above for the remaining template and function parameters.
+ */
+template <typename GraphViewType, typename VertexValueInputIterator, typename VertexOp>
+size_t count_if_v(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexValueInputIterator vertex_value_input_first,
+  VertexOp v_op,
+  deferred_host_scalar_allreduce_t<typename GraphViewType::vertex_type,
+                                   GraphViewType::is_multi_gpu>& deferred)
+{
+  nvtx_range_t range("count_if_v");
+
+  CUGRAPH_EXPECTS(deferred.get_op() == raft::comms::op_t::SUM,
+                  "Invalid input argument: deferred should reduce by raft::comms::op_t::SUM.");
+
+  typename GraphViewType::vertex_type count =
+    thrust::count_if(handle.get_thrust_policy(),
+                     vertex_value_input_first,
+                     vertex_value_input_first + graph_view.get_number_of_local_vertices(),
+                     v_op);
+  return deferred.add(count);
+}
+
 /**
  * @brief Count the number of vertices that satisfies the given predicate.
  *
@@ -93,6 +131,8 @@ typename GraphViewType::vertex_type count_if_v(raft::handle_t const& handle,
                                                InputIterator input_last,
                                                VertexOp v_op)
 {
+  nvtx_range_t range("count_if_v");
+
   auto count = thrust::count_if(handle.get_thrust_policy(), input_first, input_last, v_op);
   if (GraphViewType::is_multi_gpu) {
     count =
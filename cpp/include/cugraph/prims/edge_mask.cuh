@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/prims/property_op_utils.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/tabulate.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp>
+struct compute_edge_mask_word_t {
+  matrix_partition_device_view_t<typename GraphViewType::vertex_type,
+                                 typename GraphViewType::edge_type,
+                                 typename GraphViewType::weight_type,
+                                 GraphViewType::is_multi_gpu>
+    matrix_partition{};
+  typename GraphViewType::vertex_type const* majors{nullptr};
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input{};
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input{};
+  EdgeValueInputWrapper edge_value_input{};
+  EdgeOp e_op{};
+
+  __device__ uint32_t operator()(typename GraphViewType::edge_type word_idx) const
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+    using edge_t   = typename GraphViewType::edge_type;
+    using weight_t = typename GraphViewType::weight_type;
+
+    auto minors  = matrix_partition.get_minors();
+    auto weights = matrix_partition.get_weights();
+
+    uint32_t word{0};
+    auto edge_first = word_idx * edge_t{32};
+    auto edge_last  = thrust::min(edge_first + edge_t{32}, matrix_partition.get_number_of_edges());
+    for (auto e = edge_first; e < edge_last; ++e) {
+      auto major        = majors[e];
+      auto minor        = minors[e];
+      auto weight       = weights ? (*weights)[e] : weight_t{1.0};
+      auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
+      auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
+      auto row          = GraphViewType::is_adj_matrix_transposed ? minor : major;
+      auto col          = GraphViewType::is_adj_matrix_transposed ? major : minor;
+      auto row_offset   = GraphViewType::is_adj_matrix_transposed ? minor_offset : major_offset;
+      auto col_offset   = GraphViewType::is_adj_matrix_transposed ? major_offset : minor_offset;
+      auto e_op_result  = evaluate_edge_op<GraphViewType,
+                                          vertex_t,
+                                          AdjMatrixRowValueInputWrapper,
+                                          AdjMatrixColValueInputWrapper,
+                                          EdgeOp>()
+                           .compute(row,
+                                    col,
+                                    weight,
+                                    adj_matrix_row_value_input.get(row_offset),
+                                    adj_matrix_col_value_input.get(col_offset),
+                                    edge_value_input.get(e),
+                                    e_op);
+      if (e_op_result) { word |= uint32_t{1} << static_cast<uint32_t>(e - edge_first); }
+    }
+    return word;
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Owning container of edge masks (one bit per edge) aligned with the edge storage order of
+ * every local matrix partition of a graph.
+ *
+ * Attach the masks to a graph view (graph_view_t::attach_edge_mask(get_edge_mask_firsts())) to
+ * run the primitives and the algorithms built on them on the subgraph of the valid edges. This
+ * takes ceil(# edges / 32) 32 bit words per local matrix partition and requires no graph
+ * reconstruction. Like edge_properties_t, an edge_mask_t object is tied to the graph (view) it is
+ * created from and becomes invalid if the graph is modified.
+ *
+ * @tparam GraphViewType Type of the graph view the masks are aligned with.
+ */
+template <typename GraphViewType>
+class edge_mask_t {
+ public:
+  using edge_type = typename GraphViewType::edge_type;
+
+  edge_mask_t() = default;
+
+  // every edge is valid after construction
+  edge_mask_t(raft::handle_t const& handle, GraphViewType const& graph_view)
+  {
+    masks_.reserve(graph_view.get_number_of_local_adj_matrix_partitions());
+    edge_counts_.reserve(masks_.capacity());
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      auto num_edges = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+      masks_.emplace_back((static_cast<size_t>(num_edges) + 31) / 32, handle.get_stream());
+      edge_counts_.push_back(num_edges);
+    }
+    fill(true, handle.get_stream());
+  }
+
+  // set every edge valid (true) or masked out (false)
+  void fill(bool valid, rmm::cuda_stream_view stream)
+  {
+    for (auto& mask : masks_) {
+      thrust::fill(rmm::exec_policy(stream),
+                   mask.begin(),
+                   mask.end(),
+                   valid ? ~uint32_t{0} : uint32_t{0});
+    }
+  }
+
+  size_t get_number_of_local_adj_matrix_partitions() const { return masks_.size(); }
+
+  // number of edges (not words) in the adj_matrix_partition_idx'th local matrix partition
+  edge_type get_number_of_local_edges(size_t adj_matrix_partition_idx) const
+  {
+    return edge_counts_[adj_matrix_partition_idx];
+  }
+
+  uint32_t* mask_data(size_t adj_matrix_partition_idx)
+  {
+    return masks_[adj_matrix_partition_idx].data();
+  }
+
+  // to pass to graph_view_t::attach_edge_mask()
+  std::vector<uint32_t const*> get_edge_mask_firsts() const
+  {
+    std::vector<uint32_t const*> firsts(masks_.size());
+    for (size_t i = 0; i < masks_.size(); ++i) {
+      firsts[i] = masks_[i].data();
+    }
+    return firsts;
+  }
+
+ private:
+  std::vector<rmm::device_uvector<uint32_t>> masks_{};
+  std::vector<edge_type> edge_counts_{};
+};
+
+/**
+ * @brief Iterate over the entire set of edges and mark the edges with @p e_op evaluated to be true
+ * valid (and the others masked out) in @p edge_mask.
+ *
+ * An edge mask attached to @p graph_view is ignored (every edge is evaluated).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
+ * properties.
+ * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
+ * properties.
+ * @tparam EdgeValueInputWrapper Type of the wrapper for edge input properties.
+ * @tparam EdgeOp Type of the quinary (or senary) edge operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
+ * (for the rows assigned to this process in multi-GPU). Use either
+ * cugraph::row_properties_t::device_view() (if @p e_op needs to access row properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access row properties).
+ * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
+ * (for the columns assigned to this process in multi-GPU). Use either
+ * cugraph::col_properties_t::device_view() (if @p e_op needs to access column properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access column properties).
+ * @param edge_value_input Device-copyable wrapper used to access edge input properties. Use either
+ * cugraph::edge_properties_t::device_view() (if @p e_op needs to access edge properties) or
+ * cugraph::dummy_edge_properties_t::device_view() (if @p e_op does not access edge properties).
+ * @param e_op Quinary (or senary) operator takes edge source, edge destination, (optional edge
+ * weight), properties for the row (i.e. source), properties for the column (i.e. destination),
+ * and properties for the edge (omitted if @p edge_value_input is a dummy) and returns a boolean
+ * value (true if the edge is valid).
+ * @param edge_mask edge_mask_t object (created from @p graph_view) to update.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp>
+void set_edge_mask_if_e(raft::handle_t const& handle,
+                        GraphViewType const& graph_view,
+                        AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                        AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                        EdgeValueInputWrapper edge_value_input,
+                        EdgeOp e_op,
+                        edge_mask_t<GraphViewType>& edge_mask)
+{
+  nvtx_range_t range("set_edge_mask_if_e");
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  CUGRAPH_EXPECTS(edge_mask.get_number_of_local_adj_matrix_partitions() ==
+                    graph_view.get_number_of_local_adj_matrix_partitions(),
+                  "Invalid input argument: edge_mask is not created from graph_view.");
+
+  auto unmasked_graph_view = graph_view;
+  unmasked_graph_view.clear_edge_mask();
+
+  for (size_t i = 0; i < unmasked_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto matrix_partition =
+      matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+        unmasked_graph_view.get_matrix_partition_view(i));
+    auto num_edges = matrix_partition.get_number_of_edges();
+    CUGRAPH_EXPECTS(num_edges == edge_mask.get_number_of_local_edges(i),
+                    "Invalid input argument: edge_mask is not created from graph_view.");
+    if (num_edges == 0) { continue; }
+
+    auto matrix_partition_row_value_input  = adj_matrix_row_value_input;
+    auto matrix_partition_col_value_input  = adj_matrix_col_value_input;
+    auto matrix_partition_edge_value_input = edge_value_input;
+    matrix_partition_edge_value_input.set_local_adj_matrix_partition_idx(i);
+    if constexpr (GraphViewType::is_adj_matrix_transposed) {
+      matrix_partition_col_value_input.set_local_adj_matrix_partition_idx(i);
+    } else {
+      matrix_partition_row_value_input.set_local_adj_matrix_partition_idx(i);
+    }
+
+    // FIXME: we may avoid materializing the majors by running one thread block per major (as in
+    // transform_reduce_e) at the expense of atomic mask word updates
+    rmm::device_uvector<vertex_t> majors(num_edges, handle.get_stream());
+    detail::decompress_matrix_partition_to_fill_edgelist_majors(
+      handle,
+      matrix_partition,
+      majors.data(),
+      unmasked_graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+
+    auto num_words = (static_cast<size_t>(num_edges) + 31) / 32;
+    thrust::tabulate(handle.get_thrust_policy(),
+                     edge_mask.mask_data(i),
+                     edge_mask.mask_data(i) + num_words,
+                     detail::compute_edge_mask_word_t<GraphViewType,
+                                                      AdjMatrixRowValueInputWrapper,
+                                                      AdjMatrixColValueInputWrapper,
+                                                      EdgeValueInputWrapper,
+                                                      EdgeOp>{matrix_partition,
+                                                              majors.data(),
+                                                              matrix_partition_row_value_input,
+                                                              matrix_partition_col_value_input,
+                                                              matrix_partition_edge_value_input,
+                                                              e_op});
+  }
+}
+
+}  // namespace cugraph
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/utilities/dataframe_buffer.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/thrust_tuple_utils.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename edge_t, typename ValueIterator>
+class edge_properties_device_view_t {
+ public:
+  using value_type = typename thrust::iterator_traits<ValueIterator>::value_type;
+
+  edge_properties_device_view_t() = default;
+
+  edge_properties_device_view_t(ValueIterator const* matrix_partition_value_firsts)
+    : matrix_partition_value_firsts_(matrix_partition_value_firsts)
+  {
+    if (matrix_partition_value_firsts_ != nullptr) {
+      set_local_adj_matrix_partition_idx(size_t{0});
+    }
+  }
+
+  void set_local_adj_matrix_partition_idx(size_t adj_matrix_partition_idx)
+  {
+    matrix_partition_value_first_ = matrix_partition_value_firsts_[adj_matrix_partition_idx];
+  }
+
+  // offset is the position of the edge in the current matrix partition's edge storage (i.e.
+  // matrix_partition_device_view_t::get_local_offset(major_idx) + the neighbor index)
+  __device__ ValueIterator get_iter(edge_t offset) const
+  {
+    return matrix_partition_value_first_ + offset;
+  }
+
+  __device__ value_type get(edge_t offset) const { return *get_iter(offset); }
+
+ private:
+  ValueIterator const* matrix_partition_value_firsts_{nullptr};  // host data
+
+  ValueIterator matrix_partition_value_first_{};
+};
+
+// an edge value input wrapper may restrict the edges the traversal primitives visit per row (e.g.
+// to the edges in a time window) by providing get_visit_range(major_offset, local_offset,
+// local_degree), returning a [first, last) range in its own visit order, and
+// get_visited_edge_idx(local_offset, j), mapping the j'th edge in the visit order to the index of
+// the edge in the row's edge storage order; the other wrappers visit every edge in storage order
+template <typename EdgeValueInputWrapper, typename = void>
+struct has_edge_visit_range : std::false_type {
+};
+
+template <typename EdgeValueInputWrapper>
+struct has_edge_visit_range<EdgeValueInputWrapper,
+                            std::void_t<decltype(&EdgeValueInputWrapper::get_visit_range)>>
+  : std::true_type {
+};
+
+template <typename EdgeValueInputWrapper, typename vertex_t, typename edge_t>
+__device__ thrust::tuple<edge_t, edge_t> get_edge_visit_range(
+  EdgeValueInputWrapper const& edge_value_input,
+  vertex_t major_offset,
+  edge_t local_offset,
+  edge_t local_degree)
+{
+  if constexpr (has_edge_visit_range<EdgeValueInputWrapper>::value) {
+    return edge_value_input.get_visit_range(major_offset, local_offset, local_degree);
+  } else {
+    return thrust::make_tuple(edge_t{0}, local_degree);
+  }
+}
+
+template <typename EdgeValueInputWrapper, typename edge_t>
+__device__ edge_t get_visited_edge_idx(EdgeValueInputWrapper const& edge_value_input,
+                                       edge_t local_offset,
+                                       edge_t j)
+{
+  if constexpr (has_edge_visit_range<EdgeValueInputWrapper>::value) {
+    return edge_value_input.get_visited_edge_idx(local_offset, j);
+  } else {
+    return j;
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Owning container of per-edge properties aligned with the edge storage order of every
+ * local matrix partition of a graph.
+ *
+ * The graph stores at most one weight per edge; edge_properties_t holds any other per-edge data
+ * (e.g. edge types or time stamps) in the same order as matrix_partition_view_t::get_indices() (and
+ * get_weights()), one buffer per local adjacency matrix partition. Like row_properties_t and
+ * col_properties_t, an edge_properties_t object is tied to the graph (view) it is created from and
+ * becomes invalid if the graph is modified (e.g. symmetrized or transposed).
+ *
+ * Pass device_view() to the primitives taking an edge value input wrapper (transform_reduce_e,
+ * update_frontier_v_push_if_out_nbr) to read the properties inside the edge operator.
+ *
+ * @tparam GraphViewType Type of the graph view the properties are aligned with.
+ * @tparam T Type of the per-edge property. Needs to be an arithmetic type or a thrust::tuple of
+ * arithmetic types.
+ */
+template <typename GraphViewType, typename T>
+class edge_properties_t {
+ public:
+  using value_type = T;
+  using edge_type  = typename GraphViewType::edge_type;
+
+  static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
+
+  edge_properties_t() = default;
+
+  edge_properties_t(raft::handle_t const& handle, GraphViewType const& graph_view)
+  {
+    buffers_.reserve(graph_view.get_number_of_local_adj_matrix_partitions());
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      buffers_.push_back(allocate_dataframe_buffer<T>(
+        graph_view.get_matrix_partition_view(i).get_number_of_edges(), handle.get_stream()));
+    }
+    update_value_firsts();
+  }
+
+  edge_properties_t(edge_properties_t&& other) noexcept : buffers_(std::move(other.buffers_))
+  {
+    update_value_firsts();
+  }
+
+  edge_properties_t& operator=(edge_properties_t&& other) noexcept
+  {
+    buffers_ = std::move(other.buffers_);
+    update_value_firsts();
+    return *this;
+  }
+
+  void fill(T value, rmm::cuda_stream_view stream)
+  {
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      thrust::fill(rmm::exec_policy(stream),
+                   value_data(i),
+                   value_data(i) + size_dataframe_buffer(buffers_[i]),
+                   value);
+    }
+  }
+
+  size_t get_number_of_local_adj_matrix_partitions() const { return buffers_.size(); }
+
+  // number of edges in the adj_matrix_partition_idx'th local matrix partition
+  size_t get_number_of_local_edges(size_t adj_matrix_partition_idx) const
+  {
+    return size_dataframe_buffer(buffers_[adj_matrix_partition_idx]);
+  }
+
+  auto value_data(size_t adj_matrix_partition_idx)
+  {
+    return get_dataframe_buffer_begin(buffers_[adj_matrix_partition_idx]);
+  }
+
+  auto device_view() const
+  {
+    return detail::edge_properties_device_view_t<edge_type, const_value_iterator_t>(
+      value_cfirsts_.data());
+  }
+
+  auto mutable_device_view()
+  {
+    return detail::edge_properties_device_view_t<edge_type, value_iterator_t>(
+      value_firsts_.data());
+  }
+
+ private:
+  using buffer_t         = decltype(allocate_dataframe_buffer<T>(0, rmm::cuda_stream_view{}));
+  using value_iterator_t = decltype(get_dataframe_buffer_begin(std::declval<buffer_t&>()));
+  using const_value_iterator_t = decltype(get_dataframe_buffer_cbegin(std::declval<buffer_t&>()));
+
+  void update_value_firsts()
+  {
+    value_firsts_.resize(buffers_.size());
+    value_cfirsts_.resize(buffers_.size());
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      value_firsts_[i]  = get_dataframe_buffer_begin(buffers_[i]);
+      value_cfirsts_[i] = get_dataframe_buffer_cbegin(buffers_[i]);
+    }
+  }
+
+  std::vector<buffer_t> buffers_{};
+
+  // per-partition value iterators, host data pointed to by the device views
+  std::vector<value_iterator_t> value_firsts_{};
+  std::vector<const_value_iterator_t> value_cfirsts_{};
+};
+
+template <typename edge_t>
+class dummy_edge_properties_device_view_t {
+ public:
+  using value_type = thrust::nullopt_t;
+
+  void set_local_adj_matrix_partition_idx(size_t adj_matrix_partition_idx) {}  // no-op
+
+  __device__ auto get(edge_t offset) const { return thrust::nullopt; }
+};
+
+template <typename edge_t>
+class dummy_edge_properties_t {
+ public:
+  using value_type = thrust::nullopt_t;
+
+  auto device_view() const { return dummy_edge_properties_device_view_t<edge_t>{}; }
+};
+
+/**
+ * @brief Fill edge properties from (major, minor, value) triplets.
+ *
+ * Each edge of the graph is matched with the triplet having the same (major, minor) pair (major =
+ * source and minor = destination if the graph is not transposed, the other way otherwise). This
+ * is the way to carry per-edge data given alongside the input edge list (which graph construction
+ * reorders) over to the edge storage order.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam ValueIterator Type of the iterator for the input per-edge values.
+ * @tparam T Type of the per-edge property.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param edgelist_majors Pointer to the majors of the input triplets (in multi-GPU, the triplets
+ * should be pre-shuffled to the GPUs owning the corresponding edges, as the graph construction
+ * input).
+ * @param edgelist_minors Pointer to the minors of the input triplets.
+ * @param edgelist_value_first Iterator pointing to the values of the input triplets.
+ * @param num_edgelist_edges Number of input triplets.
+ * @param edge_properties edge_properties_t object to fill. If there are multiple triplets with
+ * the same (major, minor) pair, an arbitrary one is used for the (parallel) edges.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`,
+ * throws if a graph edge has no matching triplet).
+ */
+template <typename GraphViewType, typename ValueIterator, typename T>
+void copy_edge_properties_from_edgelist(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  typename GraphViewType::vertex_type const* edgelist_majors,
+  typename GraphViewType::vertex_type const* edgelist_minors,
+  ValueIterator edgelist_value_first,
+  size_t num_edgelist_edges,
+  edge_properties_t<GraphViewType, T>& edge_properties,
+  bool do_expensive_check = false)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  CUGRAPH_EXPECTS(edge_properties.get_number_of_local_adj_matrix_partitions() ==
+                    graph_view.get_number_of_local_adj_matrix_partitions(),
+                  "Invalid input argument: edge_properties is not created from graph_view.");
+
+  // 1. sort the input (major, minor) pairs (keep the permutation to locate the values)
+
+  rmm::device_uvector<vertex_t> sorted_majors(num_edgelist_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> sorted_minors(num_edgelist_edges, handle.get_stream());
+  rmm::device_uvector<size_t> sorted_indices(num_edgelist_edges, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               edgelist_majors,
+               edgelist_majors + num_edgelist_edges,
+               sorted_majors.begin());
+  thrust::copy(handle.get_thrust_policy(),
+               edgelist_minors,
+               edgelist_minors + num_edgelist_edges,
+               sorted_minors.begin());
+  thrust::sequence(handle.get_thrust_policy(), sorted_indices.begin(), sorted_indices.end());
+  auto sorted_pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(sorted_majors.begin(), sorted_minors.begin()));
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      sorted_pair_first,
+                      sorted_pair_first + num_edgelist_edges,
+                      sorted_indices.begin());
+
+  // 2. look up the value of every edge in each local matrix partition
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto matrix_partition =
+      matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+        graph_view.get_matrix_partition_view(i));
+    auto num_edges = static_cast<size_t>(matrix_partition.get_number_of_edges());
+
+    rmm::device_uvector<vertex_t> majors(num_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> minors(num_edges, handle.get_stream());
+    detail::decompress_matrix_partition_to_edgelist(
+      handle,
+      matrix_partition,
+      majors.data(),
+      minors.data(),
+      std::optional<weight_t*>{std::nullopt},
+      graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+
+    rmm::device_uvector<size_t> positions(num_edges, handle.get_stream());
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        sorted_pair_first,
+                        sorted_pair_first + num_edgelist_edges,
+                        pair_first,
+                        pair_first + num_edges,
+                        positions.begin());
+
+    if (do_expensive_check) {
+      auto num_missing = thrust::count_if(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(num_edges),
+        [sorted_pair_first,
+         pair_first,
+         positions = positions.data(),
+         num_edgelist_edges] __device__(auto i) {
+          if (positions[i] == num_edgelist_edges) { return true; }
+          thrust::tuple<vertex_t, vertex_t> sorted_pair = sorted_pair_first[positions[i]];
+          thrust::tuple<vertex_t, vertex_t> pair        = pair_first[i];
+          return (thrust::get<0>(sorted_pair) != thrust::get<0>(pair)) ||
+                 (thrust::get<1>(sorted_pair) != thrust::get<1>(pair));
+        });
+      CUGRAPH_EXPECTS(num_missing == 0,
+                      "Invalid input argument: the input triplets do not cover every graph edge.");
+    }
+
+    // clamp (only matters for graph edges without a matching triplet, see do_expensive_check)
+    thrust::transform(handle.get_thrust_policy(),
+                      positions.begin(),
+                      positions.end(),
+                      positions.begin(),
+                      [sorted_indices = sorted_indices.data(), num_edgelist_edges] __device__(
+                        auto p) {
+                        return p < num_edgelist_edges ? sorted_indices[p] : size_t{0};
+                      });
+    thrust::gather(handle.get_thrust_policy(),
+                   positions.begin(),
+                   positions.end(),
+                   edgelist_value_first,
+                   edge_properties.value_data(i));
+  }
+}
+
+}  // namespace cugraph
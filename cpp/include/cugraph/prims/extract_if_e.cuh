@@ -16,20 +16,34 @@
 #pragma once
 
 #include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/graph.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/partition_manager.hpp>
 #include <cugraph/prims/extract_if_e.cuh>
 #include <cugraph/prims/property_op_utils.cuh>
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/utilities/dataframe_buffer.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 
 #include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/inner_product.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
 #include <cstdint>
 #include <optional>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 namespace cugraph {
 
@@ -81,54 +95,22 @@ struct call_e_op_t {
   }
 };
 
-}  // namespace detail
-
-/**
- * @brief Iterate over the entire set of edges and return an edge list with the edges with @p
- * edge_op evaluated to be true.
- *
- * This function is inspired by thrust::copy_if & thrust::remove_if().
- *
- * @tparam GraphViewType Type of the passed non-owning graph object.
- * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
- * properties.
- * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
- * properties.
- * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
- * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
- * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Non-owning graph object.
- * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
- * (for the rows assigned to this process in multi-GPU). Use either
- * cugraph::row_properties_t::device_view() (if @p e_op needs to access row properties) or
- * cugraph::dummy_properties_t::device_view() (if @p e_op does not access row properties). Use
- * copy_to_adj_matrix_row to fill the wrapper.
- * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
- * (for the columns assigned to this process in multi-GPU). Use either
- * cugraph::col_properties_t::device_view() (if @p e_op needs to access column properties) or
- * cugraph::dummy_properties_t::device_view() (if @p e_op does not access column properties). Use
- * copy_to_adj_matrix_col to fill the wrapper.
- * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
- * weight), properties for the row (i.e. source), and properties for the column  (i.e. destination)
- * and returns a boolean value to designate whether to include this edge in the returned edge list
- * (if true is returned) or not (if false is returned).
- * @return std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
- * rmm::device_uvector<typename GraphViewType::vertex_type>,
- * std::optional<rmm::device_uvector<typename GraphViewType::weight_type>>> Tuple storing an
- * extracted edge list (sources, destinations, and optional weights).
- */
+// returns the local edges (majors, minors, and optional weights, in the order of the local
+// adjacency matrix partitions and sorted by (major, minor) within a partition) with e_op evaluated
+// to be true and the number of the returned edges of each local adjacency matrix partition
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
           typename EdgeOp>
 std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
            rmm::device_uvector<typename GraphViewType::vertex_type>,
-           std::optional<rmm::device_uvector<typename GraphViewType::weight_type>>>
-extract_if_e(raft::handle_t const& handle,
-             GraphViewType const& graph_view,
-             AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
-             AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
-             EdgeOp e_op)
+           std::optional<rmm::device_uvector<typename GraphViewType::weight_type>>,
+           std::vector<size_t>>
+extract_if_e_local_edges(raft::handle_t const& handle,
+                         GraphViewType const& graph_view,
+                         AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                         AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                         EdgeOp e_op)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
@@ -150,8 +132,10 @@ extract_if_e(raft::handle_t const& handle,
                                 edgelist_majors.size(), handle.get_stream())
                             : std::nullopt;
 
+  std::vector<size_t> extracted_edge_counts(edgelist_edge_counts.size(), size_t{0});
   size_t cur_size{0};
   for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
+    auto partition_first = cur_size;
     auto matrix_partition =
       matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
         graph_view.get_matrix_partition_view(i));
@@ -166,12 +150,14 @@ extract_if_e(raft::handle_t const& handle,
     if (edgelist_weights) {
       auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(
         edgelist_majors.begin(), edgelist_minors.begin(), (*edgelist_weights).begin()));
+      auto num_valid_edges =
+        detail::remove_masked_out_edges(handle, matrix_partition, edge_first + cur_size);
       cur_size += static_cast<size_t>(thrust::distance(
         edge_first + cur_size,
         thrust::remove_if(
           handle.get_thrust_policy(),
           edge_first + cur_size,
-          edge_first + cur_size + edgelist_edge_counts[i],
+          edge_first + cur_size + num_valid_edges,
           detail::call_e_op_t<GraphViewType,
                               AdjMatrixRowValueInputWrapper,
                               AdjMatrixColValueInputWrapper,
@@ -180,18 +166,21 @@ extract_if_e(raft::handle_t const& handle,
     } else {
       auto edge_first = thrust::make_zip_iterator(
         thrust::make_tuple(edgelist_majors.begin(), edgelist_minors.begin()));
+      auto num_valid_edges =
+        detail::remove_masked_out_edges(handle, matrix_partition, edge_first + cur_size);
       cur_size += static_cast<size_t>(thrust::distance(
         edge_first + cur_size,
         thrust::remove_if(
           handle.get_thrust_policy(),
           edge_first + cur_size,
-          edge_first + cur_size + edgelist_edge_counts[i],
+          edge_first + cur_size + num_valid_edges,
           detail::call_e_op_t<GraphViewType,
                               AdjMatrixRowValueInputWrapper,
                               AdjMatrixColValueInputWrapper,
                               EdgeOp>{
             matrix_partition, adj_matrix_row_value_input, adj_matrix_col_value_input, e_op})));
     }
+    extracted_edge_counts[i] = cur_size - partition_first;
   }
 
   edgelist_majors.resize(cur_size, handle.get_stream());
@@ -203,10 +192,239 @@ extract_if_e(raft::handle_t const& handle,
     (*edgelist_weights).shrink_to_fit(handle.get_stream());
   }
 
+  return std::make_tuple(std::move(edgelist_majors),
+                         std::move(edgelist_minors),
+                         std::move(edgelist_weights),
+                         std::move(extracted_edge_counts));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Iterate over the entire set of edges and return an edge list with the edges with @p
+ * edge_op evaluated to be true.
+ *
+ * This function is inspired by thrust::copy_if & thrust::remove_if().
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
+ * properties.
+ * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
+ * properties.
+ * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
+ * (for the rows assigned to this process in multi-GPU). Use either
+ * cugraph::row_properties_t::device_view() (if @p e_op needs to access row properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access row properties). Use
+ * copy_to_adj_matrix_row to fill the wrapper.
+ * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
+ * (for the columns assigned to this process in multi-GPU). Use either
+ * cugraph::col_properties_t::device_view() (if @p e_op needs to access column properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access column properties). Use
+ * copy_to_adj_matrix_col to fill the wrapper.
+ * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
+ * weight), properties for the row (i.e. source), and properties for the column  (i.e. destination)
+ * and returns a boolean value to designate whether to include this edge in the returned edge list
+ * (if true is returned) or not (if false is returned).
+ * @return std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+ * rmm::device_uvector<typename GraphViewType::vertex_type>,
+ * std::optional<rmm::device_uvector<typename GraphViewType::weight_type>>> Tuple storing an
+ * extracted edge list (sources, destinations, and optional weights).
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           std::optional<rmm::device_uvector<typename GraphViewType::weight_type>>>
+extract_if_e(raft::handle_t const& handle,
+             GraphViewType const& graph_view,
+             AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+             AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+             EdgeOp e_op)
+{
+  nvtx_range_t range("extract_if_e");
+
+  auto [edgelist_majors, edgelist_minors, edgelist_weights, edgelist_edge_counts] =
+    detail::extract_if_e_local_edges(
+      handle, graph_view, adj_matrix_row_value_input, adj_matrix_col_value_input, e_op);
+
   return std::make_tuple(
     std::move(GraphViewType::is_adj_matrix_transposed ? edgelist_minors : edgelist_majors),
     std::move(GraphViewType::is_adj_matrix_transposed ? edgelist_majors : edgelist_minors),
     std::move(edgelist_weights));
 }
 
+/**
+ * @brief Iterate over the entire set of edges and return a graph with the edges with @p edge_op
+ * evaluated to be true.
+ *
+ * The returned graph keeps the vertex IDs (and the vertex partitioning in multi-GPU) of @p
+ * graph_view, so the vertex property arrays of @p graph_view remain valid for the returned graph.
+ * The extracted edges are already in the (sorted) compressed sparse order, so the graph is built
+ * without renumbering or sorting the edges (in single-GPU, the offsets are recomputed from the
+ * compacted edges and moved into the graph with the compacted edges). The degree based segment
+ * offsets of @p graph_view are not carried over as the degrees change.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
+ * properties.
+ * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
+ * properties.
+ * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
+ * (for the rows assigned to this process in multi-GPU). See extract_if_e.
+ * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
+ * (for the columns assigned to this process in multi-GPU). See extract_if_e.
+ * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
+ * weight), properties for the row (i.e. source), and properties for the column  (i.e. destination)
+ * and returns a boolean value to designate whether to include this edge in the returned graph (if
+ * true is returned) or not (if false is returned).
+ * @param e_op_is_symmetric If true, @p e_op returns the same value for both directions of an edge,
+ * and the returned graph is symmetric if @p graph_view is symmetric.
+ * @return graph_t<typename GraphViewType::vertex_type, typename GraphViewType::edge_type, typename
+ * GraphViewType::weight_type, GraphViewType::is_adj_matrix_transposed,
+ * GraphViewType::is_multi_gpu> The graph with the extracted edges.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp>
+graph_t<typename GraphViewType::vertex_type,
+        typename GraphViewType::edge_type,
+        typename GraphViewType::weight_type,
+        GraphViewType::is_adj_matrix_transposed,
+        GraphViewType::is_multi_gpu>
+extract_if_e_to_graph(raft::handle_t const& handle,
+                      GraphViewType const& graph_view,
+                      AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                      AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                      EdgeOp e_op,
+                      bool e_op_is_symmetric = false)
+{
+  nvtx_range_t range("extract_if_e_to_graph");
+
+  using vertex_t   = typename GraphViewType::vertex_type;
+  using edge_t     = typename GraphViewType::edge_type;
+  using weight_t   = typename GraphViewType::weight_type;
+  using graph_type = graph_t<vertex_t,
+                             edge_t,
+                             weight_t,
+                             GraphViewType::is_adj_matrix_transposed,
+                             GraphViewType::is_multi_gpu>;
+
+  auto [edgelist_majors, edgelist_minors, edgelist_weights, edgelist_edge_counts] =
+    detail::extract_if_e_local_edges(
+      handle, graph_view, adj_matrix_row_value_input, adj_matrix_col_value_input, e_op);
+
+  // removing edges does not create multi-edges
+  graph_properties_t properties{graph_view.is_symmetric() && e_op_is_symmetric,
+                                graph_view.is_multigraph()};
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+    auto vertex_partition_lasts = graph_view.get_vertex_partition_lasts();
+    std::vector<vertex_t> vertex_partition_offsets(vertex_partition_lasts.size() + 1, vertex_t{0});
+    std::copy(vertex_partition_lasts.begin(),
+              vertex_partition_lasts.end(),
+              vertex_partition_offsets.begin() + 1);
+    partition_t<vertex_t> partition(vertex_partition_offsets,
+                                    row_comm.get_size(),
+                                    col_comm.get_size(),
+                                    row_comm.get_rank(),
+                                    col_comm.get_rank());
+
+    std::vector<edgelist_t<vertex_t, edge_t, weight_t>> edgelists(edgelist_edge_counts.size());
+    size_t offset{0};
+    for (size_t i = 0; i < edgelists.size(); ++i) {
+      auto majors                 = edgelist_majors.data() + offset;
+      auto minors                 = edgelist_minors.data() + offset;
+      edgelists[i].p_src_vertices = GraphViewType::is_adj_matrix_transposed ? minors : majors;
+      edgelists[i].p_dst_vertices = GraphViewType::is_adj_matrix_transposed ? majors : minors;
+      edgelists[i].p_edge_weights =
+        edgelist_weights ? std::optional<weight_t const*>{(*edgelist_weights).data() + offset}
+                         : std::nullopt;
+      edgelists[i].number_of_edges = static_cast<edge_t>(edgelist_edge_counts[i]);
+      offset += edgelist_edge_counts[i];
+    }
+
+    // the major ranges of the local adjacency matrix partitions are disjoint
+    vertex_t num_local_unique_edge_majors{0};
+    offset = 0;
+    for (size_t i = 0; i < edgelists.size(); ++i) {
+      if (edgelist_edge_counts[i] > 0) {
+        num_local_unique_edge_majors +=
+          thrust::inner_product(handle.get_thrust_policy(),
+                                edgelist_majors.begin() + offset + 1,
+                                edgelist_majors.begin() + offset + edgelist_edge_counts[i],
+                                edgelist_majors.begin() + offset,
+                                vertex_t{1},
+                                thrust::plus<vertex_t>{},
+                                thrust::not_equal_to<vertex_t>{});
+      }
+      offset += edgelist_edge_counts[i];
+    }
+    vertex_t num_local_unique_edge_minors{0};
+    if (edgelist_minors.size() > 0) {
+      rmm::device_uvector<vertex_t> minors(edgelist_minors.size(), handle.get_stream());
+      thrust::copy(
+        handle.get_thrust_policy(), edgelist_minors.begin(), edgelist_minors.end(), minors.begin());
+      thrust::sort(handle.get_thrust_policy(), minors.begin(), minors.end());
+      num_local_unique_edge_minors = thrust::inner_product(handle.get_thrust_policy(),
+                                                           minors.begin() + 1,
+                                                           minors.end(),
+                                                           minors.begin(),
+                                                           vertex_t{1},
+                                                           thrust::plus<vertex_t>{},
+                                                           thrust::not_equal_to<vertex_t>{});
+    }
+
+    auto number_of_edges = static_cast<edge_t>(host_scalar_allreduce(handle.get_comms(),
+                                                                     edgelist_majors.size(),
+                                                                     raft::comms::op_t::SUM,
+                                                                     handle.get_stream()));
+
+    return graph_type(
+      handle,
+      edgelists,
+      graph_meta_t<vertex_t, edge_t, GraphViewType::is_multi_gpu>{
+        graph_view.get_number_of_vertices(),
+        number_of_edges,
+        properties,
+        partition,
+        std::nullopt,
+        GraphViewType::is_adj_matrix_transposed ? num_local_unique_edge_minors
+                                                : num_local_unique_edge_majors,
+        GraphViewType::is_adj_matrix_transposed ? num_local_unique_edge_majors
+                                                : num_local_unique_edge_minors});
+  } else {
+    rmm::device_uvector<edge_t> offsets(graph_view.get_number_of_vertices() + 1,
+                                        handle.get_stream());
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        edgelist_majors.begin(),
+                        edgelist_majors.end(),
+                        thrust::make_counting_iterator(vertex_t{0}),
+                        thrust::make_counting_iterator(graph_view.get_number_of_vertices() + 1),
+                        offsets.begin());
+    edgelist_majors.resize(0, handle.get_stream());
+    edgelist_majors.shrink_to_fit(handle.get_stream());
+
+    return graph_type(handle,
+                      std::move(offsets),
+                      std::move(edgelist_minors),
+                      std::move(edgelist_weights),
+                      graph_meta_t<vertex_t, edge_t, GraphViewType::is_multi_gpu>{
+                        graph_view.get_number_of_vertices(), properties, std::nullopt});
+  }
+}
+
 }  // namespace cugraph
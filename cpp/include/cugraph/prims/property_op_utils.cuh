@@ -22,6 +22,7 @@
 
 #include <thrust/detail/type_traits/iterator/is_discard_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/optional.h>
 #include <thrust/tuple.h>
 #include <cub/cub.cuh>
 
@@ -79,6 +80,26 @@ struct evaluate_edge_op {
   {
     return e(r, c, rv, cv);
   }
+
+  // with an edge property value (ev is thrust::nullopt if the edge value input wrapper is a dummy,
+  // then e takes no edge property argument)
+  template <typename EV,
+            typename K = key_t,
+            typename V = vertex_type,
+            typename W = weight_type,
+            typename R = row_value_type,
+            typename C = col_value_type,
+            typename E = EdgeOp>
+  __device__ auto compute(K r, V c, W w, R rv, C cv, EV ev, E e)
+  {
+    if constexpr (std::is_same_v<EV, thrust::nullopt_t>) {
+      return compute(r, c, w, rv, cv, e);
+    } else if constexpr (std::is_invocable_v<E, K, V, W, R, C, EV>) {
+      return e(r, c, w, rv, cv, ev);
+    } else {
+      return e(r, c, rv, cv, ev);
+    }
+  }
 };
 
 template <typename GraphViewType,
@@ -134,14 +155,14 @@ struct property_op<thrust::tuple<Args...>, Op>
 
  private:
   template <typename T, std::size_t... Is>
-  __host__ __device__ constexpr auto sum_impl(T& t1, T& t2, std::index_sequence<Is...>)
+  __host__ __device__ constexpr auto sum_impl(T& t1, T& t2, std::index_sequence<Is...>) const
   {
     return thrust::make_tuple((Op<typename thrust::tuple_element<Is, Type>::type>()(
       thrust::get<Is>(t1), thrust::get<Is>(t2)))...);
   }
 
  public:
-  __host__ __device__ constexpr auto operator()(const Type& t1, const Type& t2)
+  __host__ __device__ constexpr auto operator()(const Type& t1, const Type& t2) const
   {
     return sum_impl(t1, t2, std::make_index_sequence<thrust::tuple_size<Type>::value>());
   }
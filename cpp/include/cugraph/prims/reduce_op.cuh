@@ -18,6 +18,15 @@
 
 #include <cugraph/prims/property_op_utils.cuh>
 
+#include <raft/comms/comms.hpp>
+
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 namespace cugraph {
 namespace reduce_op {
 
@@ -51,12 +60,34 @@ struct min {
   // has side-effects.
   static constexpr bool pure_function = true;  // this can be called in any process
 
+  static constexpr raft::comms::op_t compatible_raft_comms_op = raft::comms::op_t::MIN;
+
+  __host__ __device__ T identity_element() const { return std::numeric_limits<T>::max(); }
+
   __host__ __device__ T operator()(T const& lhs, T const& rhs) const
   {
     return lhs < rhs ? lhs : rhs;
   }
 };
 
+// reducing N elements (operator < should be defined between any two elements), the maximum element
+// should be selected.
+template <typename T>
+struct maximum {
+  using type = T;
+
+  static constexpr bool pure_function = true;  // this can be called in any process
+
+  static constexpr raft::comms::op_t compatible_raft_comms_op = raft::comms::op_t::MAX;
+
+  __host__ __device__ T identity_element() const { return std::numeric_limits<T>::lowest(); }
+
+  __host__ __device__ T operator()(T const& lhs, T const& rhs) const
+  {
+    return lhs < rhs ? rhs : lhs;
+  }
+};
+
 // FIXME: thrust::plus can replace this.
 // reducing N elements (operator < should be defined between any two elements), the minimum element
 // should be selected.
@@ -68,10 +99,63 @@ struct plus {
   // and discards the values outside the valid range; this does not work if the reduction operation
   // has side-effects.
   static constexpr bool pure_function = true;  // this can be called in any process
+
+  static constexpr raft::comms::op_t compatible_raft_comms_op = raft::comms::op_t::SUM;
   property_op<T, thrust::plus> op{};
 
+  __host__ __device__ T identity_element() const { return T{}; }
+
   __host__ __device__ T operator()(T const& lhs, T const& rhs) const { return op(lhs, rhs); }
 };
 
+// reducing N elements by bitwise OR (T should be an unsigned integral type), useful to reduce bit
+// masks.
+template <typename T>
+struct bitwise_or {
+  using type = T;
+  static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>);
+  static constexpr bool pure_function = true;  // this can be called in any process
+
+  __host__ __device__ T operator()(T const& lhs, T const& rhs) const { return lhs | rhs; }
+};
+
+// reducing N thrust::tuple elements, the I'th tuple element is reduced by the I'th reduction
+// operation in Ops (which should be one of plus, min, and maximum); this allows to compute
+// multiple reductions (e.g. a sum and a maximum) in a single pass over the input.
+template <typename... Ops>
+struct elementwise {
+  using type     = thrust::tuple<typename Ops::type...>;
+  using op_types = std::tuple<Ops...>;
+
+  static constexpr bool pure_function = (... && Ops::pure_function);
+
+  __host__ __device__ type identity_element() const
+  {
+    return thrust::make_tuple(Ops{}.identity_element()...);
+  }
+
+  __host__ __device__ type operator()(type const& lhs, type const& rhs) const
+  {
+    return reduce_impl(lhs, rhs, std::index_sequence_for<Ops...>{});
+  }
+
+ private:
+  template <std::size_t... Is>
+  __host__ __device__ type reduce_impl(type const& lhs,
+                                       type const& rhs,
+                                       std::index_sequence<Is...>) const
+  {
+    return thrust::make_tuple(Ops{}(thrust::get<Is>(lhs), thrust::get<Is>(rhs))...);
+  }
+};
+
+template <typename ReduceOp>
+struct is_elementwise : std::false_type {
+};
+
+template <typename... Ops>
+struct is_elementwise<elementwise<Ops...>> : std::true_type {
+};
+
 }  // namespace reduce_op
 }  // namespace cugraph
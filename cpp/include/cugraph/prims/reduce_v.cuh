@@ -19,6 +19,7 @@
 #include <cugraph/prims/property_op_utils.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 
 #include <raft/handle.hpp>
 
@@ -52,6 +53,8 @@ T reduce_v(raft::handle_t const& handle,
            T init,
            raft::comms::op_t op = raft::comms::op_t::SUM)
 {
+  nvtx_range_t range("reduce_v");
+
   auto id = identity_element<T>(op);
   auto ret =
     op_dispatch<T>(op, [&handle, &graph_view, vertex_value_input_first, id, init](auto op) {
@@ -68,6 +71,41 @@ T reduce_v(raft::handle_t const& handle,
   return ret;
 }
 
+/**
+ * @brief Reduce the vertex properties, deferring the inter-GPU reduction.
+ *
+ * This function is identical to reduce_v() above except that the reduction operation is @p
+ * deferred.get_op() and the result of this GPU is added to @p deferred instead of being all-reduced
+ * right away (see deferred_host_scalar_allreduce_t).
+ *
+ * @param deferred Object collecting the scalars to be all-reduced together.
+ * @return size_t Slot of the result in @p deferred (valid after @p deferred.resolve()).
+ *
+ * See reduce_v() above for the remaining template and function parameters.
+ */
+template <typename GraphViewType, typename VertexValueInputIterator, typename T>
+size_t reduce_v(raft::handle_t const& handle,
+                GraphViewType const& graph_view,
+                VertexValueInputIterator vertex_value_input_first,
+                T init,
+                deferred_host_scalar_allreduce_t<T, GraphViewType::is_multi_gpu>& deferred)
+{
+  nvtx_range_t range("reduce_v");
+
+  auto op = deferred.get_op();
+  auto id = identity_element<T>(op);
+  auto ret =
+    op_dispatch<T>(op, [&handle, &graph_view, vertex_value_input_first, id, init](auto op) {
+      return thrust::reduce(
+        handle.get_thrust_policy(),
+        vertex_value_input_first,
+        vertex_value_input_first + graph_view.get_number_of_local_vertices(),
+        ((GraphViewType::is_multi_gpu) && (handle.get_comms().get_rank() != 0)) ? id : init,
+        op);
+    });
+  return deferred.add(ret);
+}
+
 /**
  * @brief Reduce the vertex properties.
  *
@@ -94,6 +132,8 @@ T reduce_v(raft::handle_t const& handle,
            T init               = T{},
            raft::comms::op_t op = raft::comms::op_t::SUM)
 {
+  nvtx_range_t range("reduce_v");
+
   auto ret = op_dispatch<T>(op, [&handle, &graph_view, input_first, input_last, init](auto op) {
     return thrust::reduce(
       handle.get_thrust_policy(),
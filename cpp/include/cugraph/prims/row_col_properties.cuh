@@ -17,9 +17,11 @@
 #pragma once
 
 #include <cugraph/utilities/dataframe_buffer.cuh>
+#include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/thrust_tuple_utils.cuh>
 
 #include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
@@ -27,10 +29,13 @@
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/fill.h>
 #include <thrust/optional.h>
 
+#include <cstdint>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 namespace cugraph {
 
@@ -349,6 +354,109 @@ class minor_properties_t {
   decltype(allocate_dataframe_buffer<T>(0, rmm::cuda_stream_view{})) buffer_;
 };
 
+size_t constexpr packed_bools_per_word = 32;
+
+inline size_t packed_bool_size(size_t num_bools)
+{
+  return (num_bools + packed_bools_per_word - 1) / packed_bools_per_word;
+}
+
+// boolean properties packed 32 per (uint32_t) word, bit i of word w holds the property of offset
+// 32 * w + i, works as both a major and a minor property view
+template <typename vertex_t>
+class packed_bool_properties_device_view_t {
+ public:
+  using value_type = bool;
+
+  packed_bool_properties_device_view_t() = default;
+
+  packed_bool_properties_device_view_t(uint32_t const* word_first) : word_first_(word_first) {}
+
+  packed_bool_properties_device_view_t(uint32_t const* word_first,
+                                       vertex_t const* matrix_partition_major_value_start_offsets)
+    : word_first_(word_first),
+      matrix_partition_major_value_start_offsets_(matrix_partition_major_value_start_offsets)
+  {
+    set_local_adj_matrix_partition_idx(size_t{0});
+  }
+
+  void set_local_adj_matrix_partition_idx(size_t adj_matrix_partition_idx)
+  {
+    if (matrix_partition_major_value_start_offsets_) {
+      matrix_partition_value_start_offset_ =
+        (*matrix_partition_major_value_start_offsets_)[adj_matrix_partition_idx];
+    } else {
+      assert(adj_matrix_partition_idx == 0);
+    }
+  }
+
+  uint32_t const* value_data() const { return word_first_; }
+
+  __device__ bool get(vertex_t offset) const
+  {
+    auto bit = static_cast<size_t>(matrix_partition_value_start_offset_ + offset);
+    return (*(word_first_ + bit / packed_bools_per_word) >> (bit % packed_bools_per_word)) &
+           uint32_t{1};
+  }
+
+ private:
+  uint32_t const* word_first_{nullptr};
+
+  thrust::optional<vertex_t const*> matrix_partition_major_value_start_offsets_{
+    thrust::nullopt};  // host data
+
+  vertex_t matrix_partition_value_start_offset_{0};
+};
+
+template <typename vertex_t>
+class packed_bool_properties_t {
+ public:
+  packed_bool_properties_t() : words_(0, rmm::cuda_stream_view{}) {}
+
+  packed_bool_properties_t(raft::handle_t const& handle, vertex_t size)
+    : size_(size), words_(packed_bool_size(size), handle.get_stream())
+  {
+  }
+
+  packed_bool_properties_t(raft::handle_t const& handle,
+                           vertex_t size,
+                           std::vector<vertex_t>&& matrix_partition_major_value_start_offsets)
+    : size_(size),
+      words_(packed_bool_size(size), handle.get_stream()),
+      matrix_partition_major_value_start_offsets_(
+        std::move(matrix_partition_major_value_start_offsets))
+  {
+  }
+
+  void fill(bool value, rmm::cuda_stream_view stream)
+  {
+    thrust::fill(rmm::exec_policy(stream),
+                 words_.begin(),
+                 words_.end(),
+                 value ? ~uint32_t{0} : uint32_t{0});
+  }
+
+  vertex_t size() const { return size_; }
+
+  uint32_t* value_data() { return words_.data(); }
+
+  auto device_view() const
+  {
+    if (matrix_partition_major_value_start_offsets_) {
+      return packed_bool_properties_device_view_t<vertex_t>(
+        words_.data(), (*matrix_partition_major_value_start_offsets_).data());
+    } else {
+      return packed_bool_properties_device_view_t<vertex_t>(words_.data());
+    }
+  }
+
+ private:
+  vertex_t size_{0};
+  rmm::device_uvector<uint32_t> words_;
+
+  std::optional<std::vector<vertex_t>> matrix_partition_major_value_start_offsets_{std::nullopt};
+};
+
 template <typename Iterator,
           typename std::enable_if_t<std::is_arithmetic<
             typename std::iterator_traits<Iterator>::value_type>::value>* = nullptr>
@@ -527,6 +635,95 @@ class col_properties_t {
     properties_{};
 };
 
+// row_properties_t<GraphViewType, bool> storing a bit (instead of a byte) per row, this cuts the
+// memory footprint and the copy_to_adj_matrix_row communication volume by 8x for boolean flags,
+// the sorted unique edge row (key) lists are not supported
+template <typename GraphViewType>
+class row_packed_bool_properties_t {
+ public:
+  using value_type = bool;
+
+  row_packed_bool_properties_t() = default;
+
+  row_packed_bool_properties_t(raft::handle_t const& handle, GraphViewType const& graph_view)
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+
+    CUGRAPH_EXPECTS(!graph_view.get_local_sorted_unique_edge_row_begin(),
+                    "Invalid input argument: packed boolean properties do not support the sorted "
+                    "unique edge row lists.");
+
+    if constexpr (GraphViewType::is_multi_gpu && !GraphViewType::is_adj_matrix_transposed) {
+      std::vector<vertex_t> matrix_partition_major_value_start_offsets(
+        graph_view.get_number_of_local_adj_matrix_partitions());
+      for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+        matrix_partition_major_value_start_offsets[i] =
+          graph_view.get_local_adj_matrix_partition_row_value_start_offset(i);
+      }
+      properties_ = detail::packed_bool_properties_t<vertex_t>(
+        handle,
+        graph_view.get_number_of_local_adj_matrix_partition_rows(),
+        std::move(matrix_partition_major_value_start_offsets));
+    } else {
+      properties_ = detail::packed_bool_properties_t<vertex_t>(
+        handle, graph_view.get_number_of_local_adj_matrix_partition_rows());
+    }
+  }
+
+  void fill(bool value, rmm::cuda_stream_view stream) { properties_.fill(value, stream); }
+
+  auto value_data() { return properties_.value_data(); }
+
+  auto device_view() const { return properties_.device_view(); }
+
+ private:
+  detail::packed_bool_properties_t<typename GraphViewType::vertex_type> properties_{};
+};
+
+// col_properties_t<GraphViewType, bool> storing a bit (instead of a byte) per column, the sorted
+// unique edge column (key) lists are not supported
+template <typename GraphViewType>
+class col_packed_bool_properties_t {
+ public:
+  using value_type = bool;
+
+  col_packed_bool_properties_t() = default;
+
+  col_packed_bool_properties_t(raft::handle_t const& handle, GraphViewType const& graph_view)
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+
+    CUGRAPH_EXPECTS(!graph_view.get_local_sorted_unique_edge_col_begin(),
+                    "Invalid input argument: packed boolean properties do not support the sorted "
+                    "unique edge column lists.");
+
+    if constexpr (GraphViewType::is_multi_gpu && GraphViewType::is_adj_matrix_transposed) {
+      std::vector<vertex_t> matrix_partition_major_value_start_offsets(
+        graph_view.get_number_of_local_adj_matrix_partitions());
+      for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+        matrix_partition_major_value_start_offsets[i] =
+          graph_view.get_local_adj_matrix_partition_col_value_start_offset(i);
+      }
+      properties_ = detail::packed_bool_properties_t<vertex_t>(
+        handle,
+        graph_view.get_number_of_local_adj_matrix_partition_cols(),
+        std::move(matrix_partition_major_value_start_offsets));
+    } else {
+      properties_ = detail::packed_bool_properties_t<vertex_t>(
+        handle, graph_view.get_number_of_local_adj_matrix_partition_cols());
+    }
+  }
+
+  void fill(bool value, rmm::cuda_stream_view stream) { properties_.fill(value, stream); }
+
+  auto value_data() { return properties_.value_data(); }
+
+  auto device_view() const { return properties_.device_view(); }
+
+ private:
+  detail::packed_bool_properties_t<typename GraphViewType::vertex_type> properties_{};
+};
+
 template <typename vertex_t>
 class dummy_properties_device_view_t {
  public:
@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// returns a pseudo-random number in (0, 1] computed by hashing (SplitMix64 finalizer) the inputs,
+// so the sampling is reproducible for a given seed and needs no random number generator state
+__device__ inline double sample_key_uniform(uint64_t rng_seed,
+                                            uint64_t major,
+                                            uint64_t minor,
+                                            uint64_t pos)
+{
+  uint64_t x = rng_seed ^ (major * uint64_t{0x9e3779b97f4a7c15}) ^
+               (minor * uint64_t{0xbf58476d1ce4e5b9}) ^ (pos * uint64_t{0x94d049bb133111eb});
+  x ^= x >> 30;
+  x *= uint64_t{0xbf58476d1ce4e5b9};
+  x ^= x >> 27;
+  x *= uint64_t{0x94d049bb133111eb};
+  x ^= x >> 31;
+  return (static_cast<double>(x >> 11) + 1.0) * (1.0 / 9007199254740992.0 /* 2^53 */);
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+struct major_local_edge_range_t {
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> matrix_partition{};
+  thrust::optional<vertex_t> major_hypersparse_first{thrust::nullopt};
+
+  __device__ thrust::tuple<edge_t, edge_t> operator()(vertex_t major) const
+  {
+    auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
+    thrust::optional<vertex_t> major_idx{major_offset};
+    if (major_hypersparse_first && (major >= *major_hypersparse_first)) {
+      // major_offset != major_idx in the hypersparse region
+      auto major_hypersparse_idx =
+        matrix_partition.get_major_hypersparse_idx_from_major_nocheck(major);
+      major_idx =
+        major_hypersparse_idx
+          ? thrust::optional<vertex_t>{matrix_partition.get_major_offset_from_major_nocheck(
+                                         *major_hypersparse_first) +
+                                       *major_hypersparse_idx}
+          : thrust::nullopt;
+    }
+    return major_idx ? thrust::make_tuple(matrix_partition.get_local_offset(*major_idx),
+                                          matrix_partition.get_local_degree(*major_idx))
+                     : thrust::make_tuple(edge_t{0}, edge_t{0});
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+struct sample_key_op_t {
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> matrix_partition{};
+  vertex_t const* majors{nullptr};
+  edge_t const* local_edge_starts{nullptr};
+  edge_t const* list_edge_offsets{nullptr};  // size = num_majors + 1
+  size_t num_majors{0};
+  bool weighted{false};
+  uint64_t rng_seed{0};
+
+  // returns (index in the major list, minor, key), smaller keys are sampled first
+  __device__ thrust::tuple<vertex_t, vertex_t, double> operator()(edge_t i) const
+  {
+    auto offset_first = list_edge_offsets + 1;
+    auto offset_last  = list_edge_offsets + num_majors + 1;
+    auto idx          = static_cast<size_t>(thrust::distance(
+      offset_first, thrust::upper_bound(thrust::seq, offset_first, offset_last, i)));
+    auto pos          = i - list_edge_offsets[idx];
+    auto edge_offset  = local_edge_starts[idx] + pos;
+    auto minor        = *(matrix_partition.get_minors() + edge_offset);
+    auto key          = std::numeric_limits<double>::max();
+    if (matrix_partition.is_valid_edge(edge_offset)) {
+      auto u = sample_key_uniform(rng_seed,
+                                  static_cast<uint64_t>(majors[idx]),
+                                  static_cast<uint64_t>(minor),
+                                  static_cast<uint64_t>(pos));
+      // Efraimidis-Spirakis: the k smallest -log(u) / w values are a weighted sample without
+      // replacement, with w = 1 this is equivalent to sampling on u
+      auto w = (weighted && matrix_partition.get_weights())
+                 ? static_cast<double>((*(matrix_partition.get_weights()))[edge_offset])
+                 : 1.0;
+      if (w > 0.0) { key = -log(u) / w; }
+    }
+    return thrust::make_tuple(static_cast<vertex_t>(idx), minor, key);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct sample_rank_less_than_t {
+  vertex_t const* sorted_idx_first{nullptr};
+  size_t num_candidates{0};
+  size_t fanout{0};
+
+  __device__ bool operator()(size_t i) const
+  {
+    auto first = thrust::lower_bound(
+      thrust::seq, sorted_idx_first, sorted_idx_first + num_candidates, sorted_idx_first[i]);
+    return static_cast<size_t>(thrust::distance(first, sorted_idx_first + i)) < fanout;
+  }
+};
+
+// keeps the (up to) fanout smallest keys for each major list index, returns the new size
+template <typename vertex_t>
+size_t keep_smallest_sample_keys(raft::handle_t const& handle,
+                                 rmm::device_uvector<vertex_t>& idx,
+                                 rmm::device_uvector<vertex_t>& minors,
+                                 rmm::device_uvector<double>& keys,
+                                 size_t fanout)
+{
+  auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(idx.begin(), keys.begin()));
+  thrust::sort_by_key(
+    handle.get_thrust_policy(), pair_first, pair_first + idx.size(), minors.begin());
+
+  rmm::device_uvector<vertex_t> tmp_idx(idx.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> tmp_minors(minors.size(), handle.get_stream());
+  rmm::device_uvector<double> tmp_keys(keys.size(), handle.get_stream());
+  auto input_first =
+    thrust::make_zip_iterator(thrust::make_tuple(idx.begin(), minors.begin(), keys.begin()));
+  auto output_first = thrust::make_zip_iterator(
+    thrust::make_tuple(tmp_idx.begin(), tmp_minors.begin(), tmp_keys.begin()));
+  auto output_last = thrust::copy_if(
+    handle.get_thrust_policy(),
+    input_first,
+    input_first + idx.size(),
+    thrust::make_counting_iterator(size_t{0}),
+    output_first,
+    sample_rank_less_than_t<vertex_t>{idx.data(), idx.size(), fanout});
+  auto new_size = static_cast<size_t>(thrust::distance(output_first, output_last));
+
+  idx    = std::move(tmp_idx);
+  minors = std::move(tmp_minors);
+  keys   = std::move(tmp_keys);
+  idx.resize(new_size, handle.get_stream());
+  minors.resize(new_size, handle.get_stream());
+  keys.resize(new_size, handle.get_stream());
+  idx.shrink_to_fit(handle.get_stream());
+  minors.shrink_to_fit(handle.get_stream());
+  keys.shrink_to_fit(handle.get_stream());
+
+  return new_size;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Sample (up to) @p fanout out-neighbors of each vertex in the given frontier without
+ * replacement.
+ *
+ * Every out-edge of a frontier vertex gets a key derived from a hash of (@p rng_seed, source,
+ * destination, position). If @p weighted is false, the @p fanout edges with the smallest uniform
+ * keys are selected; if @p weighted is true, keys are -log(u) / weight (Efraimidis-Spirakis), so
+ * an edge is selected with probability proportional to its weight (edges with non-positive
+ * weights are never selected). Vertices with fewer than @p fanout (valid) out-edges return all of
+ * them. Masked out edges are ignored. In multi-GPU, the edges of a frontier vertex are spread over
+ * the column communicator; every GPU selects its local candidates and the candidate keys are
+ * gathered over the column communicator to find the global @p fanout smallest keys.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexIterator Type of the iterator for local frontier vertices.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param local_frontier_first Iterator pointing to the first (inclusive) frontier vertex (assigned
+ * to this process in multi-GPU). Frontier vertices should be unique.
+ * @param local_frontier_last Iterator pointing to the last (exclusive) frontier vertex (assigned
+ * to this process in multi-GPU).
+ * @param fanout Maximum number of neighbors to sample per frontier vertex.
+ * @param weighted Flag to sample proportional to edge weights (requires a weighted graph).
+ * @param rng_seed Seed for the key hash.
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> Sources and
+ * destinations of the sampled edges (a sampled edge is returned on the GPU storing the edge in
+ * multi-GPU).
+ */
+template <typename GraphViewType, typename VertexIterator>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>>
+sample_out_nbr(raft::handle_t const& handle,
+               GraphViewType const& graph_view,
+               VertexIterator local_frontier_first,
+               VertexIterator local_frontier_last,
+               size_t fanout,
+               bool weighted,
+               uint64_t rng_seed)
+{
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(
+    std::is_same_v<typename std::iterator_traits<VertexIterator>::value_type, vertex_t>);
+
+  nvtx_range_t range("sample_out_nbr");
+
+  CUGRAPH_EXPECTS(!weighted || graph_view.is_weighted(),
+                  "Invalid input argument: weighted sampling requires a weighted graph.");
+
+  auto local_frontier_size =
+    static_cast<size_t>(thrust::distance(local_frontier_first, local_frontier_last));
+  std::vector<size_t> local_frontier_sizes{};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    local_frontier_sizes =
+      host_scalar_allgather(col_comm, local_frontier_size, handle.get_stream());
+  } else {
+    local_frontier_sizes = std::vector<size_t>{local_frontier_size};
+  }
+
+  rmm::device_uvector<vertex_t> local_frontier(local_frontier_size, handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), local_frontier_first, local_frontier_last, local_frontier.begin());
+
+  rmm::device_uvector<vertex_t> srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(0, handle.get_stream());
+  if (fanout == 0) { return std::make_tuple(std::move(srcs), std::move(dsts)); }
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto matrix_partition =
+      matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+        graph_view.get_matrix_partition_view(i));
+
+    // the vertices in the major range of the i'th matrix partition are the vertices of the i'th
+    // rank in the column communicator
+
+    rmm::device_uvector<vertex_t> majors(0, handle.get_stream());
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+      majors.resize(local_frontier_sizes[i], handle.get_stream());
+      device_bcast(col_comm,
+                   local_frontier.data(),
+                   majors.data(),
+                   local_frontier_sizes[i],
+                   static_cast<int>(i),
+                   handle.get_stream());
+    } else {
+      majors.resize(local_frontier.size(), handle.get_stream());
+      thrust::copy(
+        handle.get_thrust_policy(), local_frontier.begin(), local_frontier.end(), majors.begin());
+    }
+
+    thrust::optional<vertex_t> major_hypersparse_first{thrust::nullopt};
+    auto segment_offsets = graph_view.get_local_adj_matrix_partition_segment_offsets(i);
+    if (segment_offsets &&
+        ((*segment_offsets).size() > (detail::num_sparse_segments_per_vertex_partition + 1))) {
+      major_hypersparse_first =
+        matrix_partition.get_major_first() +
+        (*segment_offsets)[detail::num_sparse_segments_per_vertex_partition];
+    }
+
+    // 1. enumerate the local out-edges of the frontier vertices and compute their keys
+
+    rmm::device_uvector<edge_t> local_edge_starts(majors.size(), handle.get_stream());
+    rmm::device_uvector<edge_t> local_degrees(majors.size(), handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      majors.begin(),
+      majors.end(),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(local_edge_starts.begin(), local_degrees.begin())),
+      detail::major_local_edge_range_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>{
+        matrix_partition, major_hypersparse_first});
+
+    rmm::device_uvector<edge_t> list_edge_offsets(majors.size() + 1, handle.get_stream());
+    list_edge_offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::inclusive_scan(handle.get_thrust_policy(),
+                           local_degrees.begin(),
+                           local_degrees.end(),
+                           list_edge_offsets.begin() + 1);
+    local_degrees.resize(0, handle.get_stream());
+    local_degrees.shrink_to_fit(handle.get_stream());
+    auto num_list_edges = static_cast<size_t>(list_edge_offsets.back_element(handle.get_stream()));
+
+    rmm::device_uvector<vertex_t> candidate_idx(num_list_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> candidate_minors(num_list_edges, handle.get_stream());
+    rmm::device_uvector<double> candidate_keys(num_list_edges, handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(static_cast<edge_t>(num_list_edges)),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        candidate_idx.begin(), candidate_minors.begin(), candidate_keys.begin())),
+      detail::sample_key_op_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>{
+        matrix_partition,
+        majors.data(),
+        local_edge_starts.data(),
+        list_edge_offsets.data(),
+        majors.size(),
+        weighted,
+        rng_seed});
+    local_edge_starts.resize(0, handle.get_stream());
+    local_edge_starts.shrink_to_fit(handle.get_stream());
+    list_edge_offsets.resize(0, handle.get_stream());
+    list_edge_offsets.shrink_to_fit(handle.get_stream());
+
+    // 2. keep the (up to) fanout smallest local keys per frontier vertex (unselectable edges have
+    // the maximum key and are sorted last)
+
+    auto num_candidates = detail::keep_smallest_sample_keys(
+      handle, candidate_idx, candidate_minors, candidate_keys, fanout);
+
+    // 3. in multi-GPU, the global fanout smallest keys of a frontier vertex are among the union of
+    // the local candidates in the column communicator, a local candidate is selected if its key
+    // is not larger than the fanout'th smallest key of the union
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto& col_comm      = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+      auto rx_counts      = host_scalar_allgather(col_comm, num_candidates, handle.get_stream());
+      std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+      std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+      auto num_rx_candidates = displacements.back() + rx_counts.back();
+
+      rmm::device_uvector<vertex_t> rx_idx(num_rx_candidates, handle.get_stream());
+      rmm::device_uvector<double> rx_keys(num_rx_candidates, handle.get_stream());
+      device_allgatherv(
+        col_comm,
+        thrust::make_zip_iterator(
+          thrust::make_tuple(candidate_idx.begin(), candidate_keys.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(rx_idx.begin(), rx_keys.begin())),
+        rx_counts,
+        displacements,
+        handle.get_stream());
+      auto rx_pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(rx_idx.begin(), rx_keys.begin()));
+      thrust::sort(handle.get_thrust_policy(), rx_pair_first, rx_pair_first + rx_idx.size());
+
+      rmm::device_uvector<double> thresholds(majors.size(), handle.get_stream());
+      thrust::fill(handle.get_thrust_policy(),
+                   thresholds.begin(),
+                   thresholds.end(),
+                   std::numeric_limits<double>::max());
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(rx_idx.size()),
+        [rx_idx     = rx_idx.data(),
+         rx_keys    = rx_keys.data(),
+         num_rx     = rx_idx.size(),
+         thresholds = thresholds.data(),
+         fanout] __device__(auto j) {
+          auto first = thrust::lower_bound(thrust::seq, rx_idx, rx_idx + num_rx, rx_idx[j]);
+          if (static_cast<size_t>(thrust::distance(first, rx_idx + j)) == fanout - 1) {
+            thresholds[rx_idx[j]] = rx_keys[j];
+          }
+        });
+      rx_idx.resize(0, handle.get_stream());
+      rx_idx.shrink_to_fit(handle.get_stream());
+      rx_keys.resize(0, handle.get_stream());
+      rx_keys.shrink_to_fit(handle.get_stream());
+
+      auto triplet_first = thrust::make_zip_iterator(thrust::make_tuple(
+        candidate_idx.begin(), candidate_minors.begin(), candidate_keys.begin()));
+      num_candidates = static_cast<size_t>(thrust::distance(
+        triplet_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          triplet_first,
+                          triplet_first + num_candidates,
+                          [thresholds = thresholds.data()] __device__(auto t) {
+                            return thrust::get<2>(t) > thresholds[thrust::get<0>(t)];
+                          })));
+    }
+
+    // 4. drop the unselectable edges (masked out or non-positive weights) and append the result
+
+    auto triplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(candidate_idx.begin(), candidate_minors.begin(), candidate_keys.begin()));
+    num_candidates = static_cast<size_t>(thrust::distance(
+      triplet_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        triplet_first,
+                        triplet_first + num_candidates,
+                        [] __device__(auto t) {
+                          return thrust::get<2>(t) == std::numeric_limits<double>::max();
+                        })));
+
+    auto old_size = srcs.size();
+    srcs.resize(old_size + num_candidates, handle.get_stream());
+    dsts.resize(old_size + num_candidates, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      candidate_idx.begin(),
+                      candidate_idx.begin() + num_candidates,
+                      srcs.begin() + old_size,
+                      [majors = majors.data()] __device__(auto idx) { return majors[idx]; });
+    thrust::copy(handle.get_thrust_policy(),
+                 candidate_minors.begin(),
+                 candidate_minors.begin() + num_candidates,
+                 dsts.begin() + old_size);
+  }
+
+  return std::make_tuple(std::move(srcs), std::move(dsts));
+}
+
+}  // namespace cugraph
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/prims/edge_properties.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename vertex_t, typename edge_t, typename timestamp_t, typename RowTimeInputWrapper>
+class temporal_edge_properties_device_view_t {
+ public:
+  using value_type = timestamp_t;
+
+  temporal_edge_properties_device_view_t(timestamp_t const* const* matrix_partition_times,
+                                         timestamp_t const* const* matrix_partition_sorted_times,
+                                         edge_t const* const* matrix_partition_sorted_positions,
+                                         timestamp_t window_first,
+                                         timestamp_t window_last,
+                                         RowTimeInputWrapper row_time_input)
+    : matrix_partition_times_(matrix_partition_times),
+      matrix_partition_sorted_times_(matrix_partition_sorted_times),
+      matrix_partition_sorted_positions_(matrix_partition_sorted_positions),
+      window_first_(window_first),
+      window_last_(window_last),
+      row_time_input_(row_time_input)
+  {
+    set_local_adj_matrix_partition_idx(size_t{0});
+  }
+
+  void set_local_adj_matrix_partition_idx(size_t adj_matrix_partition_idx)
+  {
+    times_            = matrix_partition_times_[adj_matrix_partition_idx];
+    sorted_times_     = matrix_partition_sorted_times_[adj_matrix_partition_idx];
+    sorted_positions_ = matrix_partition_sorted_positions_[adj_matrix_partition_idx];
+    row_time_input_.set_local_adj_matrix_partition_idx(adj_matrix_partition_idx);
+  }
+
+  // offset is the position of the edge in the current matrix partition's edge storage
+  __device__ value_type get(edge_t offset) const { return *(times_ + offset); }
+
+  // the edges of a row with the time stamps in [max(window_first, row time), window_last), found
+  // by binary searches in the row's time sorted segment
+  __device__ thrust::tuple<edge_t, edge_t> get_visit_range(vertex_t major_offset,
+                                                           edge_t local_offset,
+                                                           edge_t local_degree) const
+  {
+    auto time_first = window_first_;
+    if constexpr (!std::is_same_v<typename RowTimeInputWrapper::value_type, thrust::nullopt_t>) {
+      auto row_time = static_cast<timestamp_t>(row_time_input_.get(major_offset));
+      time_first    = row_time > time_first ? row_time : time_first;
+    }
+    auto segment_first = sorted_times_ + local_offset;
+    auto segment_last  = segment_first + local_degree;
+    auto first = thrust::lower_bound(thrust::seq, segment_first, segment_last, time_first);
+    auto last  = thrust::lower_bound(thrust::seq, first, segment_last, window_last_);
+    return thrust::make_tuple(static_cast<edge_t>(thrust::distance(segment_first, first)),
+                              static_cast<edge_t>(thrust::distance(segment_first, last)));
+  }
+
+  __device__ edge_t get_visited_edge_idx(edge_t local_offset, edge_t j) const
+  {
+    return *(sorted_positions_ + (local_offset + j)) - local_offset;
+  }
+
+ private:
+  // host data
+  timestamp_t const* const* matrix_partition_times_{nullptr};
+  timestamp_t const* const* matrix_partition_sorted_times_{nullptr};
+  edge_t const* const* matrix_partition_sorted_positions_{nullptr};
+
+  timestamp_t const* times_{nullptr};
+  timestamp_t const* sorted_times_{nullptr};
+  edge_t const* sorted_positions_{nullptr};
+  timestamp_t window_first_{};
+  timestamp_t window_last_{};
+  RowTimeInputWrapper row_time_input_{};
+};
+
+}  // namespace detail
+
+/**
+ * @brief Owning container of per-edge time stamps with a time sorted index of every neighbor list.
+ *
+ * The time stamps are kept in the edge storage order (like edge_properties_t), and the edges of
+ * every row (i.e. source) are additionally indexed in the time stamp order. The device views
+ * restrict the edges the traversal primitives (update_frontier_v_push_if_out_nbr) visit to the
+ * edges with the time stamps in a window [window_first, window_last) (and optionally no earlier
+ * than a per-row time, e.g. the arrival time at the source vertex) by binary searches in the time
+ * sorted neighbor lists; the edges outside the window are skipped without reading them. The index
+ * is built once and shared by any number of windowed queries, so sliding window analytics do not
+ * need to build a filtered graph per window. The edge operator receives the time stamp of the
+ * edge as its last argument.
+ *
+ * Like edge_properties_t, a temporal_edge_properties_t object is tied to the graph (view) it is
+ * created from and becomes invalid if the graph is modified.
+ *
+ * @tparam GraphViewType Type of the graph view the time stamps are aligned with.
+ * @tparam timestamp_t Type of the time stamps. Needs to be an arithmetic type.
+ */
+template <typename GraphViewType, typename timestamp_t>
+class temporal_edge_properties_t {
+ public:
+  using value_type = timestamp_t;
+  using edge_type  = typename GraphViewType::edge_type;
+
+  static_assert(std::is_arithmetic_v<timestamp_t>);
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  temporal_edge_properties_t() = default;
+
+  /**
+   * @brief Build the time sorted neighbor list index.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param graph_view Non-owning graph object.
+   * @param edge_times Time stamps of the edges of @p graph_view (e.g. filled with
+   * copy_edge_properties_from_edgelist), moved into this object.
+   */
+  temporal_edge_properties_t(raft::handle_t const& handle,
+                             GraphViewType const& graph_view,
+                             edge_properties_t<GraphViewType, timestamp_t>&& edge_times)
+    : edge_times_(std::move(edge_times))
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+    using edge_t   = typename GraphViewType::edge_type;
+    using weight_t = typename GraphViewType::weight_type;
+
+    CUGRAPH_EXPECTS(edge_times_.get_number_of_local_adj_matrix_partitions() ==
+                      graph_view.get_number_of_local_adj_matrix_partitions(),
+                    "Invalid input argument: edge_times is not created from graph_view.");
+
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      auto matrix_partition =
+        matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+          graph_view.get_matrix_partition_view(i));
+      auto num_edges = static_cast<size_t>(matrix_partition.get_number_of_edges());
+
+      // the edges are stored in the major order, sorting by (major, time) keeps every neighbor
+      // list in place and sorts the neighbor list by time
+
+      rmm::device_uvector<vertex_t> majors(num_edges, handle.get_stream());
+      detail::decompress_matrix_partition_to_fill_edgelist_majors(
+        handle,
+        matrix_partition,
+        majors.data(),
+        graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+
+      rmm::device_uvector<timestamp_t> sorted_times(num_edges, handle.get_stream());
+      rmm::device_uvector<edge_t> sorted_positions(num_edges, handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   edge_times_.value_data(i),
+                   edge_times_.value_data(i) + num_edges,
+                   sorted_times.begin());
+      thrust::sequence(
+        handle.get_thrust_policy(), sorted_positions.begin(), sorted_positions.end(), edge_t{0});
+      auto key_first =
+        thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), sorted_times.begin()));
+      thrust::sort_by_key(
+        handle.get_thrust_policy(), key_first, key_first + num_edges, sorted_positions.begin());
+
+      sorted_times_.push_back(std::move(sorted_times));
+      sorted_positions_.push_back(std::move(sorted_positions));
+    }
+
+    for (size_t i = 0; i < sorted_times_.size(); ++i) {
+      time_ptrs_.push_back(edge_times_.value_data(i));
+      sorted_time_ptrs_.push_back(sorted_times_[i].data());
+      sorted_position_ptrs_.push_back(sorted_positions_[i].data());
+    }
+  }
+
+  edge_properties_t<GraphViewType, timestamp_t> const& edge_times() const { return edge_times_; }
+
+  // visits the edges with the time stamps in [window_first, window_last)
+  auto device_view(timestamp_t window_first = std::numeric_limits<timestamp_t>::lowest(),
+                   timestamp_t window_last  = std::numeric_limits<timestamp_t>::max()) const
+  {
+    return device_view(window_first,
+                       window_last,
+                       dummy_properties_t<typename GraphViewType::vertex_type>{}.device_view());
+  }
+
+  // visits the edges with the time stamps in [max(window_first, row time), window_last), the row
+  // times are read from @p row_time_input (a row_properties_t device view or a
+  // detail::major_properties_device_view_t in single-GPU)
+  template <typename RowTimeInputWrapper>
+  auto device_view(timestamp_t window_first,
+                   timestamp_t window_last,
+                   RowTimeInputWrapper row_time_input) const
+  {
+    return detail::temporal_edge_properties_device_view_t<typename GraphViewType::vertex_type,
+                                                          edge_type,
+                                                          timestamp_t,
+                                                          RowTimeInputWrapper>(
+      time_ptrs_.data(),
+      sorted_time_ptrs_.data(),
+      sorted_position_ptrs_.data(),
+      window_first,
+      window_last,
+      row_time_input);
+  }
+
+ private:
+  edge_properties_t<GraphViewType, timestamp_t> edge_times_{};
+
+  // time sorted neighbor lists and the edge storage order positions of the sorted edges, per
+  // local matrix partition
+  std::vector<rmm::device_uvector<timestamp_t>> sorted_times_{};
+  std::vector<rmm::device_uvector<edge_type>> sorted_positions_{};
+
+  // host data pointed to by the device views
+  std::vector<timestamp_t const*> time_ptrs_{};
+  std::vector<timestamp_t const*> sorted_time_ptrs_{};
+  std::vector<edge_type const*> sorted_position_ptrs_{};
+};
+
+}  // namespace cugraph
@@ -21,10 +21,15 @@
 #include <cugraph/prims/property_op_utils.cuh>
 #include <cugraph/utilities/dataframe_buffer.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/profiler.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <raft/handle.hpp>
 
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/tuple.h>
+
 #include <type_traits>
 
 namespace cugraph {
@@ -53,11 +58,17 @@ __device__ void update_buffer_element(
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
   AdjMatrixRowColKeyInputWrapper adj_matrix_row_col_key_input,
   EdgeOp e_op,
+  typename GraphViewType::edge_type edge_offset,
   typename GraphViewType::vertex_type* key,
   T* value)
 {
   using vertex_t = typename GraphViewType::vertex_type;
 
+  if (!matrix_partition.is_valid_edge(edge_offset)) {  // masked out, removed before the reduction
+    *key = invalid_vertex_id<vertex_t>::value;
+    return;
+  }
+
   auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
   auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
   auto row          = GraphViewType::is_adj_matrix_transposed ? minor : major;
@@ -116,7 +127,7 @@ __global__ void for_all_major_for_all_nbr_hypersparse(
       *(matrix_partition.get_major_from_major_hypersparse_idx_nocheck(static_cast<vertex_t>(idx)));
     auto major_idx =
       major_start_offset + idx;  // major_offset != major_idx in the hypersparse region
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) =
@@ -132,6 +143,7 @@ __global__ void for_all_major_for_all_nbr_hypersparse(
         adj_matrix_col_value_input,
         adj_matrix_row_col_key_input,
         e_op,
+        local_offset + i,
         keys + local_offset + i,
         values + local_offset + i);
     }
@@ -173,7 +185,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
     auto major_offset = major_start_offset + idx;
     auto major =
       matrix_partition.get_major_from_major_offset_nocheck(static_cast<vertex_t>(major_offset));
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) =
@@ -189,6 +201,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
         adj_matrix_col_value_input,
         adj_matrix_row_col_key_input,
         e_op,
+        local_offset + i,
         keys + local_offset + i,
         values + local_offset + i);
     }
@@ -233,7 +246,7 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
     auto major_offset = major_start_offset + idx;
     auto major =
       matrix_partition.get_major_from_major_offset_nocheck(static_cast<vertex_t>(major_offset));
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) =
@@ -249,6 +262,7 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
         adj_matrix_col_value_input,
         adj_matrix_row_col_key_input,
         e_op,
+        local_offset + i,
         keys + local_offset + i,
         values + local_offset + i);
     }
@@ -289,7 +303,7 @@ __global__ void for_all_major_for_all_nbr_high_degree(
     auto major_offset = major_start_offset + idx;
     auto major =
       matrix_partition.get_major_from_major_offset_nocheck(static_cast<vertex_t>(major_offset));
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) =
@@ -305,6 +319,7 @@ __global__ void for_all_major_for_all_nbr_high_degree(
         adj_matrix_col_value_input,
         adj_matrix_row_col_key_input,
         e_op,
+        local_offset + i,
         keys + local_offset + i,
         values + local_offset + i);
     }
@@ -495,6 +510,20 @@ transform_reduce_by_adj_matrix_row_col_key_e(
             get_dataframe_buffer_begin(tmp_value_buffer));
       }
     }
+    if (matrix_partition.get_edge_mask()) {
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(tmp_keys.begin(), get_dataframe_buffer_begin(tmp_value_buffer)));
+      auto num_valid_edges = static_cast<size_t>(thrust::distance(
+        pair_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          pair_first,
+                          pair_first + tmp_keys.size(),
+                          [] __device__(auto pair) {
+                            return thrust::get<0>(pair) == invalid_vertex_id<vertex_t>::value;
+                          })));
+      tmp_keys.resize(num_valid_edges, handle.get_stream());
+      resize_dataframe_buffer(tmp_value_buffer, num_valid_edges, handle.get_stream());
+    }
     std::tie(tmp_keys, tmp_value_buffer) = reduce_to_unique_kv_pairs<vertex_t, T>(
       std::move(tmp_keys), std::move(tmp_value_buffer), handle.get_stream());
 
@@ -606,6 +635,8 @@ auto transform_reduce_by_adj_matrix_row_key_e(
   EdgeOp e_op,
   T init)
 {
+  nvtx_range_t range("transform_reduce_by_adj_matrix_row_key_e");
+
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
   static_assert(std::is_same<typename AdjMatrixRowKeyInputWrapper::value_type,
                              typename GraphViewType::vertex_type>::value);
@@ -675,6 +706,8 @@ auto transform_reduce_by_adj_matrix_col_key_e(
   EdgeOp e_op,
   T init)
 {
+  nvtx_range_t range("transform_reduce_by_adj_matrix_col_key_e");
+
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
   static_assert(std::is_same<typename AdjMatrixColKeyInputWrapper::value_type,
                              typename GraphViewType::vertex_type>::value);
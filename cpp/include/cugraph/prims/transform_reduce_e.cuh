@@ -17,18 +17,29 @@
 
 #include <cugraph/graph_view.hpp>
 #include <cugraph/matrix_partition_view.hpp>
+#include <cugraph/prims/edge_properties.cuh>
 #include <cugraph/prims/property_op_utils.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/device_comm.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 
 #include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/tuple.h>
 
 #include <cstdint>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cugraph {
 
@@ -37,11 +48,76 @@ namespace detail {
 // FIXME: block size requires tuning
 int32_t constexpr transform_reduce_e_for_all_block_size = 128;
 
+template <typename Iterator, typename T, typename ReduceOp>
+__device__ void atomic_reduce_edge_op_result(Iterator iter, T const& value, ReduceOp reduce_op);
+
+template <typename Iterator, typename T, typename ReduceOp, std::size_t... Is>
+__device__ void atomic_reduce_edge_op_result_elementwise_impl(Iterator iter,
+                                                              T const& value,
+                                                              std::index_sequence<Is...>)
+{
+  (atomic_reduce_edge_op_result(
+     thrust::get<Is>(iter.get_iterator_tuple()),
+     thrust::get<Is>(value),
+     std::tuple_element_t<Is, typename ReduceOp::op_types>{}),
+   ...);
+}
+
+template <typename Iterator, typename T, typename ReduceOp>
+__device__ void atomic_reduce_edge_op_result(Iterator iter, T const& value, ReduceOp reduce_op)
+{
+  if constexpr (reduce_op::is_elementwise<ReduceOp>::value) {
+    atomic_reduce_edge_op_result_elementwise_impl<Iterator, T, ReduceOp>(
+      iter, value, std::make_index_sequence<thrust::tuple_size<T>::value>());
+  } else if constexpr (ReduceOp::compatible_raft_comms_op == raft::comms::op_t::SUM) {
+    atomic_accumulate_edge_op_result(iter, value);
+  } else if constexpr (ReduceOp::compatible_raft_comms_op == raft::comms::op_t::MIN) {
+    atomicMin(&(thrust::raw_reference_cast(*iter)), value);
+  } else {
+    static_assert(ReduceOp::compatible_raft_comms_op == raft::comms::op_t::MAX);
+    atomicMax(&(thrust::raw_reference_cast(*iter)), value);
+  }
+}
+
+// the tuple elements are reduced one by one (in the same order in every GPU) as the elements may
+// be reduced by different reduction operations
+template <typename T, typename ReduceOp, std::size_t... Is>
+T host_scalar_allreduce_elementwise_impl(raft::comms::comms_t const& comm,
+                                         T input,
+                                         cudaStream_t stream,
+                                         std::index_sequence<Is...>)
+{
+  T ret{};
+  ((thrust::get<Is>(ret) = host_scalar_allreduce(
+      comm,
+      thrust::get<Is>(input),
+      std::tuple_element_t<Is, typename ReduceOp::op_types>::compatible_raft_comms_op,
+      stream)),
+   ...);
+  return ret;
+}
+
+template <typename T, typename ReduceOp>
+T host_scalar_allreduce_by_reduce_op(raft::comms::comms_t const& comm,
+                                     T input,
+                                     ReduceOp reduce_op,
+                                     cudaStream_t stream)
+{
+  if constexpr (reduce_op::is_elementwise<ReduceOp>::value) {
+    return host_scalar_allreduce_elementwise_impl<T, ReduceOp>(
+      comm, input, stream, std::make_index_sequence<thrust::tuple_size<T>::value>());
+  } else {
+    return host_scalar_allreduce(comm, input, ReduceOp::compatible_raft_comms_op, stream);
+  }
+}
+
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename ResultIterator,
-          typename EdgeOp>
+          typename EdgeOp,
+          typename ReduceOp>
 __global__ void for_all_major_for_all_nbr_hypersparse(
   matrix_partition_device_view_t<typename GraphViewType::vertex_type,
                                  typename GraphViewType::edge_type,
@@ -50,8 +126,10 @@ __global__ void for_all_major_for_all_nbr_hypersparse(
   typename GraphViewType::vertex_type major_hypersparse_first,
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
   ResultIterator result_iter /* size 1 */,
-  EdgeOp e_op)
+  EdgeOp e_op,
+  ReduceOp reduce_op)
 {
   using vertex_t      = typename GraphViewType::vertex_type;
   using edge_t        = typename GraphViewType::edge_type;
@@ -68,17 +146,17 @@ __global__ void for_all_major_for_all_nbr_hypersparse(
   using BlockReduce = cub::BlockReduce<e_op_result_t, transform_reduce_e_for_all_block_size>;
   __shared__ typename BlockReduce::TempStorage temp_storage;
 
-  property_op<e_op_result_t, thrust::plus> edge_property_add{};
-  e_op_result_t e_op_result_sum{};
+  e_op_result_t e_op_result_sum = reduce_op.identity_element();
   while (idx < static_cast<size_t>(dcs_nzd_vertex_count)) {
     auto major =
       *(matrix_partition.get_major_from_major_hypersparse_idx_nocheck(static_cast<vertex_t>(idx)));
     auto major_idx =
       major_start_offset + idx;  // major_offset != major_idx in the hypersparse region
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_idx);
+    auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(major_idx));
     auto sum                                    = thrust::transform_reduce(
       thrust::seq,
       thrust::make_counting_iterator(edge_t{0}),
@@ -86,10 +164,16 @@ __global__ void for_all_major_for_all_nbr_hypersparse(
       [&matrix_partition,
        &adj_matrix_row_value_input,
        &adj_matrix_col_value_input,
+       &edge_value_input,
        &e_op,
+       reduce_op,
        major,
        indices,
-       weights] __device__(auto i) {
+       weights,
+       local_offset] __device__(auto i) -> e_op_result_t {
+        if (!matrix_partition.is_valid_edge(local_offset + i)) {
+          return reduce_op.identity_element();
+        }
         auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
         auto minor        = indices[i];
         auto weight       = weights ? (*weights)[i] : weight_t{1.0};
@@ -112,56 +196,64 @@ __global__ void for_all_major_for_all_nbr_hypersparse(
                    weight,
                    adj_matrix_row_value_input.get(row_offset),
                    adj_matrix_col_value_input.get(col_offset),
+                   edge_value_input.get(local_offset + i),
                    e_op);
       },
-      e_op_result_t{},
-      edge_property_add);
+      reduce_op.identity_element(),
+      reduce_op);
 
-    e_op_result_sum = edge_property_add(e_op_result_sum, sum);
+    e_op_result_sum = reduce_op(e_op_result_sum, sum);
     idx += gridDim.x * blockDim.x;
   }
 
-  e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, edge_property_add);
-  if (threadIdx.x == 0) { atomic_accumulate_edge_op_result(result_iter, e_op_result_sum); }
+  e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, reduce_op);
+  if (threadIdx.x == 0) {
+    atomic_reduce_edge_op_result(result_iter, e_op_result_sum, reduce_op);
+  }
 }
 
 template <typename GraphViewType,
+          typename MajorIterator,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename ResultIterator,
-          typename EdgeOp>
+          typename EdgeOp,
+          typename ReduceOp>
 __global__ void for_all_major_for_all_nbr_low_degree(
   matrix_partition_device_view_t<typename GraphViewType::vertex_type,
                                  typename GraphViewType::edge_type,
                                  typename GraphViewType::weight_type,
                                  GraphViewType::is_multi_gpu> matrix_partition,
-  typename GraphViewType::vertex_type major_first,
-  typename GraphViewType::vertex_type major_last,
+  MajorIterator major_first,
+  MajorIterator major_last,
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
   ResultIterator result_iter /* size 1 */,
-  EdgeOp e_op)
+  EdgeOp e_op,
+  ReduceOp reduce_op)
 {
   using vertex_t      = typename GraphViewType::vertex_type;
   using edge_t        = typename GraphViewType::edge_type;
   using weight_t      = typename GraphViewType::weight_type;
   using e_op_result_t = typename std::iterator_traits<ResultIterator>::value_type;
 
-  auto const tid          = threadIdx.x + blockIdx.x * blockDim.x;
-  auto major_start_offset = static_cast<size_t>(major_first - matrix_partition.get_major_first());
-  size_t idx              = static_cast<size_t>(tid);
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  size_t idx     = static_cast<size_t>(tid);
 
   using BlockReduce = cub::BlockReduce<e_op_result_t, transform_reduce_e_for_all_block_size>;
   __shared__ typename BlockReduce::TempStorage temp_storage;
 
-  property_op<e_op_result_t, thrust::plus> edge_property_add{};
-  e_op_result_t e_op_result_sum{};
-  while (idx < static_cast<size_t>(major_last - major_first)) {
-    auto major_offset = major_start_offset + idx;
-    vertex_t const* indices{nullptr};
+  e_op_result_t e_op_result_sum = reduce_op.identity_element();
+  while (idx < static_cast<size_t>(thrust::distance(major_first, major_last))) {
+    auto major_offset = static_cast<size_t>(
+      matrix_partition.get_major_offset_from_major_nocheck(*(major_first + idx)));
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+    auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(major_offset));
     auto sum                                    = thrust::transform_reduce(
       thrust::seq,
       thrust::make_counting_iterator(edge_t{0}),
@@ -169,10 +261,16 @@ __global__ void for_all_major_for_all_nbr_low_degree(
       [&matrix_partition,
        &adj_matrix_row_value_input,
        &adj_matrix_col_value_input,
+       &edge_value_input,
        &e_op,
+       reduce_op,
        major_offset,
        indices,
-       weights] __device__(auto i) {
+       weights,
+       local_offset] __device__(auto i) -> e_op_result_t {
+        if (!matrix_partition.is_valid_edge(local_offset + i)) {
+          return reduce_op.identity_element();
+        }
         auto minor        = indices[i];
         auto weight       = weights ? (*weights)[i] : weight_t{1.0};
         auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -198,35 +296,43 @@ __global__ void for_all_major_for_all_nbr_low_degree(
                    weight,
                    adj_matrix_row_value_input.get(row_offset),
                    adj_matrix_col_value_input.get(col_offset),
+                   edge_value_input.get(local_offset + i),
                    e_op);
       },
-      e_op_result_t{},
-      edge_property_add);
+      reduce_op.identity_element(),
+      reduce_op);
 
-    e_op_result_sum = edge_property_add(e_op_result_sum, sum);
+    e_op_result_sum = reduce_op(e_op_result_sum, sum);
     idx += gridDim.x * blockDim.x;
   }
 
-  e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, edge_property_add);
-  if (threadIdx.x == 0) { atomic_accumulate_edge_op_result(result_iter, e_op_result_sum); }
+  e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, reduce_op);
+  if (threadIdx.x == 0) {
+    atomic_reduce_edge_op_result(result_iter, e_op_result_sum, reduce_op);
+  }
 }
 
 template <typename GraphViewType,
+          typename MajorIterator,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename ResultIterator,
-          typename EdgeOp>
+          typename EdgeOp,
+          typename ReduceOp>
 __global__ void for_all_major_for_all_nbr_mid_degree(
   matrix_partition_device_view_t<typename GraphViewType::vertex_type,
                                  typename GraphViewType::edge_type,
                                  typename GraphViewType::weight_type,
                                  GraphViewType::is_multi_gpu> matrix_partition,
-  typename GraphViewType::vertex_type major_first,
-  typename GraphViewType::vertex_type major_last,
+  MajorIterator major_first,
+  MajorIterator major_last,
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
   ResultIterator result_iter /* size 1 */,
-  EdgeOp e_op)
+  EdgeOp e_op,
+  ReduceOp reduce_op)
 {
   using vertex_t      = typename GraphViewType::vertex_type;
   using edge_t        = typename GraphViewType::edge_type;
@@ -235,21 +341,22 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
 
   auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
   static_assert(transform_reduce_e_for_all_block_size % raft::warp_size() == 0);
-  auto const lane_id      = tid % raft::warp_size();
-  auto major_start_offset = static_cast<size_t>(major_first - matrix_partition.get_major_first());
-  size_t idx              = static_cast<size_t>(tid / raft::warp_size());
+  auto const lane_id = tid % raft::warp_size();
+  size_t idx         = static_cast<size_t>(tid / raft::warp_size());
 
   using BlockReduce = cub::BlockReduce<e_op_result_t, transform_reduce_e_for_all_block_size>;
   __shared__ typename BlockReduce::TempStorage temp_storage;
-  property_op<e_op_result_t, thrust::plus> edge_property_add{};
-  e_op_result_t e_op_result_sum{};
-  while (idx < static_cast<size_t>(major_last - major_first)) {
-    auto major_offset = major_start_offset + idx;
-    vertex_t const* indices{nullptr};
+  e_op_result_t e_op_result_sum = reduce_op.identity_element();
+  while (idx < static_cast<size_t>(thrust::distance(major_first, major_last))) {
+    auto major_offset = static_cast<size_t>(
+      matrix_partition.get_major_offset_from_major_nocheck(*(major_first + idx)));
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+    auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(major_offset));
     for (edge_t i = lane_id; i < local_degree; i += raft::warp_size()) {
+      if (!matrix_partition.is_valid_edge(local_offset + i)) { continue; }
       auto minor        = indices[i];
       auto weight       = weights ? (*weights)[i] : weight_t{1.0};
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -275,52 +382,61 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
                                     weight,
                                     adj_matrix_row_value_input.get(row_offset),
                                     adj_matrix_col_value_input.get(col_offset),
+                                    edge_value_input.get(local_offset + i),
                                     e_op);
-      e_op_result_sum = edge_property_add(e_op_result_sum, e_op_result);
+      e_op_result_sum = reduce_op(e_op_result_sum, e_op_result);
     }
     idx += gridDim.x * (blockDim.x / raft::warp_size());
   }
 
-  e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, edge_property_add);
-  if (threadIdx.x == 0) { atomic_accumulate_edge_op_result(result_iter, e_op_result_sum); }
+  e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, reduce_op);
+  if (threadIdx.x == 0) {
+    atomic_reduce_edge_op_result(result_iter, e_op_result_sum, reduce_op);
+  }
 }
 
 template <typename GraphViewType,
+          typename MajorIterator,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename ResultIterator,
-          typename EdgeOp>
+          typename EdgeOp,
+          typename ReduceOp>
 __global__ void for_all_major_for_all_nbr_high_degree(
   matrix_partition_device_view_t<typename GraphViewType::vertex_type,
                                  typename GraphViewType::edge_type,
                                  typename GraphViewType::weight_type,
                                  GraphViewType::is_multi_gpu> matrix_partition,
-  typename GraphViewType::vertex_type major_first,
-  typename GraphViewType::vertex_type major_last,
+  MajorIterator major_first,
+  MajorIterator major_last,
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
   ResultIterator result_iter /* size 1 */,
-  EdgeOp e_op)
+  EdgeOp e_op,
+  ReduceOp reduce_op)
 {
   using vertex_t      = typename GraphViewType::vertex_type;
   using edge_t        = typename GraphViewType::edge_type;
   using weight_t      = typename GraphViewType::weight_type;
   using e_op_result_t = typename std::iterator_traits<ResultIterator>::value_type;
 
-  auto major_start_offset = static_cast<size_t>(major_first - matrix_partition.get_major_first());
-  size_t idx              = static_cast<size_t>(blockIdx.x);
+  size_t idx = static_cast<size_t>(blockIdx.x);
 
   using BlockReduce = cub::BlockReduce<e_op_result_t, transform_reduce_e_for_all_block_size>;
   __shared__ typename BlockReduce::TempStorage temp_storage;
-  property_op<e_op_result_t, thrust::plus> edge_property_add{};
-  e_op_result_t e_op_result_sum{};
-  while (idx < static_cast<size_t>(major_last - major_first)) {
-    auto major_offset = major_start_offset + idx;
-    vertex_t const* indices{nullptr};
+  e_op_result_t e_op_result_sum = reduce_op.identity_element();
+  while (idx < static_cast<size_t>(thrust::distance(major_first, major_last))) {
+    auto major_offset = static_cast<size_t>(
+      matrix_partition.get_major_offset_from_major_nocheck(*(major_first + idx)));
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+    auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(major_offset));
     for (edge_t i = threadIdx.x; i < local_degree; i += blockDim.x) {
+      if (!matrix_partition.is_valid_edge(local_offset + i)) { continue; }
       auto minor        = indices[i];
       auto weight       = weights ? (*weights)[i] : weight_t{1.0};
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -346,60 +462,118 @@ __global__ void for_all_major_for_all_nbr_high_degree(
                                     weight,
                                     adj_matrix_row_value_input.get(row_offset),
                                     adj_matrix_col_value_input.get(col_offset),
+                                    edge_value_input.get(local_offset + i),
                                     e_op);
-      e_op_result_sum = edge_property_add(e_op_result_sum, e_op_result);
+      e_op_result_sum = reduce_op(e_op_result_sum, e_op_result);
     }
     idx += gridDim.x;
   }
 
-  e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, edge_property_add);
-  if (threadIdx.x == 0) { atomic_accumulate_edge_op_result(result_iter, e_op_result_sum); }
+  e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, reduce_op);
+  if (threadIdx.x == 0) {
+    atomic_reduce_edge_op_result(result_iter, e_op_result_sum, reduce_op);
+  }
 }
 
-}  // namespace detail
+template <typename GraphViewType,
+          typename MajorIterator,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename ResultIterator,
+          typename EdgeOp,
+          typename ReduceOp>
+__global__ void for_all_major_in_list_for_all_nbr_hypersparse(
+  matrix_partition_device_view_t<typename GraphViewType::vertex_type,
+                                 typename GraphViewType::edge_type,
+                                 typename GraphViewType::weight_type,
+                                 GraphViewType::is_multi_gpu> matrix_partition,
+  typename GraphViewType::vertex_type major_hypersparse_first,
+  MajorIterator major_first,
+  MajorIterator major_last,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
+  ResultIterator result_iter /* size 1 */,
+  EdgeOp e_op,
+  ReduceOp reduce_op)
+{
+  using vertex_t      = typename GraphViewType::vertex_type;
+  using edge_t        = typename GraphViewType::edge_type;
+  using weight_t      = typename GraphViewType::weight_type;
+  using e_op_result_t = typename std::iterator_traits<ResultIterator>::value_type;
+
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  auto major_start_offset =
+    static_cast<size_t>(major_hypersparse_first - matrix_partition.get_major_first());
+  size_t idx = static_cast<size_t>(tid);
+
+  using BlockReduce = cub::BlockReduce<e_op_result_t, transform_reduce_e_for_all_block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+
+  e_op_result_t e_op_result_sum = reduce_op.identity_element();
+  while (idx < static_cast<size_t>(thrust::distance(major_first, major_last))) {
+    auto major = *(major_first + idx);
+    auto major_hypersparse_idx =
+      matrix_partition.get_major_hypersparse_idx_from_major_nocheck(major);
+    if (major_hypersparse_idx) {
+      auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
+      // major_offset != major_idx in the hypersparse region
+      auto major_idx = major_start_offset + *major_hypersparse_idx;
+      detail::minor_iterator_t<vertex_t, edge_t> indices{};
+      thrust::optional<weight_t const*> weights{thrust::nullopt};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_idx);
+      auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(major_idx));
+      for (edge_t i = 0; i < local_degree; ++i) {
+        if (!matrix_partition.is_valid_edge(local_offset + i)) { continue; }
+        auto minor        = indices[i];
+        auto weight       = weights ? (*weights)[i] : weight_t{1.0};
+        auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
+        auto row          = GraphViewType::is_adj_matrix_transposed ? minor : major;
+        auto col          = GraphViewType::is_adj_matrix_transposed ? major : minor;
+        auto row_offset   = GraphViewType::is_adj_matrix_transposed ? minor_offset : major_offset;
+        auto col_offset   = GraphViewType::is_adj_matrix_transposed ? major_offset : minor_offset;
+        auto e_op_result  = evaluate_edge_op<GraphViewType,
+                                            vertex_t,
+                                            AdjMatrixRowValueInputWrapper,
+                                            AdjMatrixColValueInputWrapper,
+                                            EdgeOp>()
+                             .compute(row,
+                                      col,
+                                      weight,
+                                      adj_matrix_row_value_input.get(row_offset),
+                                      adj_matrix_col_value_input.get(col_offset),
+                                      edge_value_input.get(local_offset + i),
+                                      e_op);
+        e_op_result_sum = reduce_op(e_op_result_sum, e_op_result);
+      }
+    }
+    idx += gridDim.x * blockDim.x;
+  }
+
+  e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, reduce_op);
+  if (threadIdx.x == 0) {
+    atomic_reduce_edge_op_result(result_iter, e_op_result_sum, reduce_op);
+  }
+}
 
-/**
- * @brief Iterate over the entire set of edges and reduce @p edge_op outputs.
- *
- * This function is inspired by thrust::transform_reduce().
- *
- * @tparam GraphViewType Type of the passed non-owning graph object.
- * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
- * properties.
- * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
- * properties.
- * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
- * @tparam T Type of the initial value.
- * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
- * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Non-owning graph object.
- * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
- * (for the rows assigned to this process in multi-GPU). Use either
- * cugraph::row_properties_t::device_view() (if @p e_op needs to access row properties) or
- * cugraph::dummy_properties_t::device_view() (if @p e_op does not access row properties). Use
- * copy_to_adj_matrix_row to fill the wrapper.
- * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
- * (for the columns assigned to this process in multi-GPU). Use either
- * cugraph::col_properties_t::device_view() (if @p e_op needs to access column properties) or
- * cugraph::dummy_properties_t::device_view() (if @p e_op does not access column properties). Use
- * copy_to_adj_matrix_col to fill the wrapper.
- * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
- * weight), properties for the row (i.e. source), and properties for the column  (i.e. destination)
- * and returns a value to be reduced.
- * @param init Initial value to be added to the transform-reduced input vertex properties.
- * @return T Reduction of the @p edge_op outputs.
- */
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename EdgeOp,
-          typename T>
-T transform_reduce_e(raft::handle_t const& handle,
-                     GraphViewType const& graph_view,
-                     AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
-                     AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
-                     EdgeOp e_op,
-                     T init)
+          typename T,
+          typename ReduceOp>
+T transform_reduce_e_impl(raft::handle_t const& handle,
+                          GraphViewType const& graph_view,
+                          AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                          AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                          EdgeValueInputWrapper edge_value_input,
+                          EdgeOp e_op,
+                          T init,
+                          ReduceOp reduce_op,
+                          bool allreduce = true)  // false to return the result of this GPU
 {
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
 
@@ -407,21 +581,21 @@ T transform_reduce_e(raft::handle_t const& handle,
   using edge_t   = typename GraphViewType::edge_type;
   using weight_t = typename GraphViewType::weight_type;
 
-  property_op<T, thrust::plus> edge_property_add{};
-
   auto result_buffer = allocate_dataframe_buffer<T>(1, handle.get_stream());
   thrust::fill(handle.get_thrust_policy(),
                get_dataframe_buffer_begin(result_buffer),
                get_dataframe_buffer_begin(result_buffer) + 1,
-               T{});
+               reduce_op.identity_element());
 
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     auto matrix_partition =
       matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
         graph_view.get_matrix_partition_view(i));
 
-    auto matrix_partition_row_value_input = adj_matrix_row_value_input;
-    auto matrix_partition_col_value_input = adj_matrix_col_value_input;
+    auto matrix_partition_row_value_input  = adj_matrix_row_value_input;
+    auto matrix_partition_col_value_input  = adj_matrix_col_value_input;
+    auto matrix_partition_edge_value_input = edge_value_input;
+    matrix_partition_edge_value_input.set_local_adj_matrix_partition_idx(i);
     if constexpr (GraphViewType::is_adj_matrix_transposed) {
       matrix_partition_col_value_input.set_local_adj_matrix_partition_idx(i);
     } else {
@@ -441,12 +615,15 @@ T transform_reduce_e(raft::handle_t const& handle,
         detail::for_all_major_for_all_nbr_high_degree<GraphViewType>
           <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
             matrix_partition,
-            matrix_partition.get_major_first(),
-            matrix_partition.get_major_first() + (*segment_offsets)[1],
+            thrust::make_counting_iterator(matrix_partition.get_major_first()),
+            thrust::make_counting_iterator(matrix_partition.get_major_first() +
+                                           (*segment_offsets)[1]),
             matrix_partition_row_value_input,
             matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
             get_dataframe_buffer_begin(result_buffer),
-            e_op);
+            e_op,
+            reduce_op);
       }
       if ((*segment_offsets)[2] - (*segment_offsets)[1] > 0) {
         raft::grid_1d_warp_t update_grid((*segment_offsets)[2] - (*segment_offsets)[1],
@@ -455,12 +632,16 @@ T transform_reduce_e(raft::handle_t const& handle,
         detail::for_all_major_for_all_nbr_mid_degree<GraphViewType>
           <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
             matrix_partition,
-            matrix_partition.get_major_first() + (*segment_offsets)[1],
-            matrix_partition.get_major_first() + (*segment_offsets)[2],
+            thrust::make_counting_iterator(matrix_partition.get_major_first() +
+                                           (*segment_offsets)[1]),
+            thrust::make_counting_iterator(matrix_partition.get_major_first() +
+                                           (*segment_offsets)[2]),
             matrix_partition_row_value_input,
             matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
             get_dataframe_buffer_begin(result_buffer),
-            e_op);
+            e_op,
+            reduce_op);
       }
       if ((*segment_offsets)[3] - (*segment_offsets)[2] > 0) {
         raft::grid_1d_thread_t update_grid((*segment_offsets)[3] - (*segment_offsets)[2],
@@ -469,12 +650,16 @@ T transform_reduce_e(raft::handle_t const& handle,
         detail::for_all_major_for_all_nbr_low_degree<GraphViewType>
           <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
             matrix_partition,
-            matrix_partition.get_major_first() + (*segment_offsets)[2],
-            matrix_partition.get_major_first() + (*segment_offsets)[3],
+            thrust::make_counting_iterator(matrix_partition.get_major_first() +
+                                           (*segment_offsets)[2]),
+            thrust::make_counting_iterator(matrix_partition.get_major_first() +
+                                           (*segment_offsets)[3]),
             matrix_partition_row_value_input,
             matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
             get_dataframe_buffer_begin(result_buffer),
-            e_op);
+            e_op,
+            reduce_op);
       }
       if (matrix_partition.get_dcs_nzd_vertex_count() &&
           (*(matrix_partition.get_dcs_nzd_vertex_count()) > 0)) {
@@ -487,8 +672,10 @@ T transform_reduce_e(raft::handle_t const& handle,
             matrix_partition.get_major_first() + (*segment_offsets)[3],
             matrix_partition_row_value_input,
             matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
             get_dataframe_buffer_begin(result_buffer),
-            e_op);
+            e_op,
+            reduce_op);
       }
     } else {
       if (matrix_partition.get_major_size() > 0) {
@@ -499,12 +686,14 @@ T transform_reduce_e(raft::handle_t const& handle,
         detail::for_all_major_for_all_nbr_low_degree<GraphViewType>
           <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
             matrix_partition,
-            matrix_partition.get_major_first(),
-            matrix_partition.get_major_last(),
+            thrust::make_counting_iterator(matrix_partition.get_major_first()),
+            thrust::make_counting_iterator(matrix_partition.get_major_last()),
             matrix_partition_row_value_input,
             matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
             get_dataframe_buffer_begin(result_buffer),
-            e_op);
+            e_op,
+            reduce_op);
       }
     }
   }
@@ -513,15 +702,598 @@ T transform_reduce_e(raft::handle_t const& handle,
     handle.get_thrust_policy(),
     get_dataframe_buffer_begin(result_buffer),
     get_dataframe_buffer_begin(result_buffer) + 1,
-    ((GraphViewType::is_multi_gpu) && (handle.get_comms().get_rank() != 0)) ? T{} : init,
-    edge_property_add);
+    ((GraphViewType::is_multi_gpu) && (handle.get_comms().get_rank() != 0))
+      ? reduce_op.identity_element()
+      : init,
+    reduce_op);
 
   if constexpr (GraphViewType::is_multi_gpu) {
-    result = host_scalar_allreduce(
-      handle.get_comms(), result, raft::comms::op_t::SUM, handle.get_stream());
+    if (allreduce) {
+      result = host_scalar_allreduce_by_reduce_op(
+        handle.get_comms(), result, reduce_op, handle.get_stream());
+    }
   }
 
   return result;
 }
 
+template <typename GraphViewType,
+          typename VertexIterator,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename ReduceOp>
+T transform_reduce_e_impl(raft::handle_t const& handle,
+                          GraphViewType const& graph_view,
+                          VertexIterator local_vertex_first,
+                          VertexIterator local_vertex_last,
+                          AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                          AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                          EdgeValueInputWrapper edge_value_input,
+                          EdgeOp e_op,
+                          T init,
+                          ReduceOp reduce_op)
+{
+  static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(
+    std::is_same_v<typename std::iterator_traits<VertexIterator>::value_type, vertex_t>);
+
+  auto result_buffer = allocate_dataframe_buffer<T>(1, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               get_dataframe_buffer_begin(result_buffer),
+               get_dataframe_buffer_begin(result_buffer) + 1,
+               reduce_op.identity_element());
+
+  auto local_vertex_count =
+    static_cast<size_t>(thrust::distance(local_vertex_first, local_vertex_last));
+  std::vector<size_t> local_vertex_counts{};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    local_vertex_counts = host_scalar_allgather(col_comm, local_vertex_count, handle.get_stream());
+  } else {
+    local_vertex_counts = std::vector<size_t>{local_vertex_count};
+  }
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto matrix_partition =
+      matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+        graph_view.get_matrix_partition_view(i));
+
+    // the vertices in the major range of the i'th matrix partition are the vertices of the i'th
+    // rank in the column communicator
+
+    rmm::device_uvector<vertex_t> matrix_partition_vertices(0, handle.get_stream());
+    vertex_t const* matrix_partition_vertex_first{nullptr};
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+      matrix_partition_vertices.resize(local_vertex_counts[i], handle.get_stream());
+      device_bcast(col_comm,
+                   local_vertex_first,
+                   matrix_partition_vertices.data(),
+                   local_vertex_counts[i],
+                   static_cast<int>(i),
+                   handle.get_stream());
+      matrix_partition_vertex_first = matrix_partition_vertices.data();
+    } else {
+      if constexpr (std::is_pointer_v<VertexIterator>) {
+        matrix_partition_vertex_first = local_vertex_first;
+      } else {
+        matrix_partition_vertices.resize(local_vertex_count, handle.get_stream());
+        thrust::copy(handle.get_thrust_policy(),
+                          local_vertex_first,
+                          local_vertex_last,
+                          matrix_partition_vertices.begin());
+        matrix_partition_vertex_first = matrix_partition_vertices.data();
+      }
+    }
+    auto matrix_partition_vertex_last = matrix_partition_vertex_first + local_vertex_counts[i];
+
+    auto matrix_partition_row_value_input  = adj_matrix_row_value_input;
+    auto matrix_partition_col_value_input  = adj_matrix_col_value_input;
+    auto matrix_partition_edge_value_input = edge_value_input;
+    matrix_partition_edge_value_input.set_local_adj_matrix_partition_idx(i);
+    if constexpr (GraphViewType::is_adj_matrix_transposed) {
+      matrix_partition_col_value_input.set_local_adj_matrix_partition_idx(i);
+    } else {
+      matrix_partition_row_value_input.set_local_adj_matrix_partition_idx(i);
+    }
+
+    auto segment_offsets = graph_view.get_local_adj_matrix_partition_segment_offsets(i);
+    if (segment_offsets) {
+      static_assert(detail::num_sparse_segments_per_vertex_partition == 3);
+      auto use_dcs =
+        (*segment_offsets).size() > (detail::num_sparse_segments_per_vertex_partition + 1);
+      std::vector<vertex_t> h_thresholds(detail::num_sparse_segments_per_vertex_partition +
+                                         (use_dcs ? 1 : 0) - 1);
+      h_thresholds[0] = matrix_partition.get_major_first() + (*segment_offsets)[1];
+      h_thresholds[1] = matrix_partition.get_major_first() + (*segment_offsets)[2];
+      if (use_dcs) { h_thresholds[2] = matrix_partition.get_major_first() + (*segment_offsets)[3]; }
+      rmm::device_uvector<vertex_t> d_thresholds(h_thresholds.size(), handle.get_stream());
+      raft::update_device(
+        d_thresholds.data(), h_thresholds.data(), h_thresholds.size(), handle.get_stream());
+      rmm::device_uvector<vertex_t> d_offsets(d_thresholds.size(), handle.get_stream());
+      thrust::lower_bound(handle.get_thrust_policy(),
+                          matrix_partition_vertex_first,
+                          matrix_partition_vertex_last,
+                          d_thresholds.begin(),
+                          d_thresholds.end(),
+                          d_offsets.begin());
+      std::vector<vertex_t> h_offsets(d_offsets.size());
+      raft::update_host(h_offsets.data(), d_offsets.data(), d_offsets.size(), handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+      h_offsets.push_back(static_cast<vertex_t>(local_vertex_counts[i]));
+
+      if (h_offsets[0] > 0) {
+        raft::grid_1d_block_t update_grid(h_offsets[0],
+                                          detail::transform_reduce_e_for_all_block_size,
+                                          handle.get_device_properties().maxGridSize[0]);
+        detail::for_all_major_for_all_nbr_high_degree<GraphViewType>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+            matrix_partition,
+            matrix_partition_vertex_first,
+            matrix_partition_vertex_first + h_offsets[0],
+            matrix_partition_row_value_input,
+            matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
+            get_dataframe_buffer_begin(result_buffer),
+            e_op,
+            reduce_op);
+      }
+      if (h_offsets[1] - h_offsets[0] > 0) {
+        raft::grid_1d_warp_t update_grid(h_offsets[1] - h_offsets[0],
+                                         detail::transform_reduce_e_for_all_block_size,
+                                         handle.get_device_properties().maxGridSize[0]);
+        detail::for_all_major_for_all_nbr_mid_degree<GraphViewType>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+            matrix_partition,
+            matrix_partition_vertex_first + h_offsets[0],
+            matrix_partition_vertex_first + h_offsets[1],
+            matrix_partition_row_value_input,
+            matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
+            get_dataframe_buffer_begin(result_buffer),
+            e_op,
+            reduce_op);
+      }
+      if (h_offsets[2] - h_offsets[1] > 0) {
+        raft::grid_1d_thread_t update_grid(h_offsets[2] - h_offsets[1],
+                                           detail::transform_reduce_e_for_all_block_size,
+                                           handle.get_device_properties().maxGridSize[0]);
+        detail::for_all_major_for_all_nbr_low_degree<GraphViewType>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+            matrix_partition,
+            matrix_partition_vertex_first + h_offsets[1],
+            matrix_partition_vertex_first + h_offsets[2],
+            matrix_partition_row_value_input,
+            matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
+            get_dataframe_buffer_begin(result_buffer),
+            e_op,
+            reduce_op);
+      }
+      if (use_dcs && (h_offsets[3] - h_offsets[2] > 0)) {
+        raft::grid_1d_thread_t update_grid(h_offsets[3] - h_offsets[2],
+                                           detail::transform_reduce_e_for_all_block_size,
+                                           handle.get_device_properties().maxGridSize[0]);
+        detail::for_all_major_in_list_for_all_nbr_hypersparse<GraphViewType>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+            matrix_partition,
+            matrix_partition.get_major_first() + (*segment_offsets)[3],
+            matrix_partition_vertex_first + h_offsets[2],
+            matrix_partition_vertex_first + h_offsets[3],
+            matrix_partition_row_value_input,
+            matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
+            get_dataframe_buffer_begin(result_buffer),
+            e_op,
+            reduce_op);
+      }
+    } else {
+      if (local_vertex_counts[i] > 0) {
+        raft::grid_1d_thread_t update_grid(local_vertex_counts[i],
+                                           detail::transform_reduce_e_for_all_block_size,
+                                           handle.get_device_properties().maxGridSize[0]);
+
+        detail::for_all_major_for_all_nbr_low_degree<GraphViewType>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+            matrix_partition,
+            matrix_partition_vertex_first,
+            matrix_partition_vertex_last,
+            matrix_partition_row_value_input,
+            matrix_partition_col_value_input,
+            matrix_partition_edge_value_input,
+            get_dataframe_buffer_begin(result_buffer),
+            e_op,
+            reduce_op);
+      }
+    }
+  }
+
+  auto result = thrust::reduce(
+    handle.get_thrust_policy(),
+    get_dataframe_buffer_begin(result_buffer),
+    get_dataframe_buffer_begin(result_buffer) + 1,
+    ((GraphViewType::is_multi_gpu) && (handle.get_comms().get_rank() != 0))
+      ? reduce_op.identity_element()
+      : init,
+    reduce_op);
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    result = host_scalar_allreduce_by_reduce_op(
+      handle.get_comms(), result, reduce_op, handle.get_stream());
+  }
+
+  return result;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Iterate over the entire set of edges and reduce @p edge_op outputs.
+ *
+ * This function is inspired by thrust::transform_reduce().
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
+ * properties.
+ * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
+ * properties.
+ * @tparam EdgeValueInputWrapper Type of the wrapper for edge input properties.
+ * @tparam EdgeOp Type of the quinary (or senary) edge operator.
+ * @tparam T Type of the initial value.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
+ * (for the rows assigned to this process in multi-GPU). Use either
+ * cugraph::row_properties_t::device_view() (if @p e_op needs to access row properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access row properties). Use
+ * copy_to_adj_matrix_row to fill the wrapper.
+ * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
+ * (for the columns assigned to this process in multi-GPU). Use either
+ * cugraph::col_properties_t::device_view() (if @p e_op needs to access column properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access column properties). Use
+ * copy_to_adj_matrix_col to fill the wrapper.
+ * @param edge_value_input Device-copyable wrapper used to access edge input properties. Use either
+ * cugraph::edge_properties_t::device_view() (if @p e_op needs to access edge properties) or
+ * cugraph::dummy_edge_properties_t::device_view() (if @p e_op does not access edge properties).
+ * @param e_op Quinary (or senary) operator takes edge source, edge destination, (optional edge
+ * weight), properties for the row (i.e. source), properties for the column  (i.e. destination),
+ * and properties for the edge and returns a value to be reduced.
+ * @param init Initial value to be added to the transform-reduced input vertex properties.
+ * @return T Reduction of the @p edge_op outputs.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp,
+          typename T>
+T transform_reduce_e(raft::handle_t const& handle,
+                     GraphViewType const& graph_view,
+                     AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                     AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                     EdgeValueInputWrapper edge_value_input,
+                     EdgeOp e_op,
+                     T init)
+{
+  nvtx_range_t range("transform_reduce_e");
+
+  return detail::transform_reduce_e_impl(handle,
+                                         graph_view,
+                                         adj_matrix_row_value_input,
+                                         adj_matrix_col_value_input,
+                                         edge_value_input,
+                                         e_op,
+                                         init,
+                                         reduce_op::plus<T>{});
+}
+
+/**
+ * @brief Iterate over the entire set of edges and reduce @p edge_op outputs.
+ *
+ * This function is inspired by thrust::transform_reduce().
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
+ * properties.
+ * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
+ * properties.
+ * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @tparam T Type of the initial value.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
+ * (for the rows assigned to this process in multi-GPU). Use either
+ * cugraph::row_properties_t::device_view() (if @p e_op needs to access row properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access row properties). Use
+ * copy_to_adj_matrix_row to fill the wrapper.
+ * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
+ * (for the columns assigned to this process in multi-GPU). Use either
+ * cugraph::col_properties_t::device_view() (if @p e_op needs to access column properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access column properties). Use
+ * copy_to_adj_matrix_col to fill the wrapper.
+ * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
+ * weight), properties for the row (i.e. source), and properties for the column  (i.e. destination)
+ * and returns a value to be reduced.
+ * @param init Initial value to be added to the transform-reduced input vertex properties.
+ * @return T Reduction of the @p edge_op outputs.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename T>
+T transform_reduce_e(raft::handle_t const& handle,
+                     GraphViewType const& graph_view,
+                     AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                     AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                     EdgeOp e_op,
+                     T init)
+{
+  return transform_reduce_e(
+    handle,
+    graph_view,
+    adj_matrix_row_value_input,
+    adj_matrix_col_value_input,
+    dummy_edge_properties_t<typename GraphViewType::edge_type>{}.device_view(),
+    e_op,
+    init);
+}
+
+/**
+ * @brief Iterate over the entire set of edges and reduce @p edge_op outputs, deferring the
+ * inter-GPU reduction.
+ *
+ * This function is identical to the above except that the result of this GPU is added to @p
+ * deferred instead of being all-reduced right away (see deferred_host_scalar_allreduce_t).
+ *
+ * @param deferred Object collecting the scalars to be all-reduced together (the reduction operation
+ * should be raft::comms::op_t::SUM).
+ * @return size_t Slot of the result in @p deferred (valid after @p deferred.resolve()).
+ *
+ * See the above function for the remaining template and function parameters.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename T>
+size_t transform_reduce_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeOp e_op,
+  T init,
+  deferred_host_scalar_allreduce_t<T, GraphViewType::is_multi_gpu>& deferred)
+{
+  nvtx_range_t range("transform_reduce_e");
+
+  CUGRAPH_EXPECTS(deferred.get_op() == raft::comms::op_t::SUM,
+                  "Invalid input argument: deferred should reduce by raft::comms::op_t::SUM.");
+
+  return deferred.add(detail::transform_reduce_e_impl(
+    handle,
+    graph_view,
+    adj_matrix_row_value_input,
+    adj_matrix_col_value_input,
+    dummy_edge_properties_t<typename GraphViewType::edge_type>{}.device_view(),
+    e_op,
+    init,
+    reduce_op::plus<T>{},
+    false));
+}
+
+/**
+ * @brief Iterate over the edges of the given vertices and reduce @p edge_op outputs.
+ *
+ * This function is identical to transform_reduce_e() above except that only the edges whose major
+ * end points (sources if GraphViewType::is_adj_matrix_transposed is false, destinations otherwise)
+ * are in [@p local_vertex_first, @p local_vertex_last) are visited (i.e. out-going edges of the
+ * vertices in the push model and in-coming edges in the pull model). The work is proportional to
+ * the number of the visited edges (instead of the number of all the local edges), and the vertices
+ * are processed with the same degree-segment based load balancing as
+ * update_frontier_v_push_if_out_nbr.
+ *
+ * @tparam VertexIterator Type of the iterator for the vertices.
+ * @param local_vertex_first Iterator pointing to the first (inclusive) vertex of the vertices
+ * (assigned to this process in multi-GPU). The vertices should be sorted and unique.
+ * @param local_vertex_last Iterator pointing to the last (exclusive) vertex of the vertices
+ * (assigned to this process in multi-GPU).
+ *
+ * See transform_reduce_e() above for the remaining template and function parameters.
+ */
+template <typename GraphViewType,
+          typename VertexIterator,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp,
+          typename T>
+T transform_reduce_e(raft::handle_t const& handle,
+                     GraphViewType const& graph_view,
+                     VertexIterator local_vertex_first,
+                     VertexIterator local_vertex_last,
+                     AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                     AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                     EdgeValueInputWrapper edge_value_input,
+                     EdgeOp e_op,
+                     T init)
+{
+  nvtx_range_t range("transform_reduce_e");
+
+  return detail::transform_reduce_e_impl(handle,
+                                         graph_view,
+                                         local_vertex_first,
+                                         local_vertex_last,
+                                         adj_matrix_row_value_input,
+                                         adj_matrix_col_value_input,
+                                         edge_value_input,
+                                         e_op,
+                                         init,
+                                         reduce_op::plus<T>{});
+}
+
+/**
+ * @brief Iterate over the edges of the given vertices and reduce @p edge_op outputs.
+ *
+ * This function is identical to the above except that edge properties are not used.
+ *
+ * See the above function for the template and function parameters.
+ */
+template <typename GraphViewType,
+          typename VertexIterator,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename T>
+T transform_reduce_e(raft::handle_t const& handle,
+                     GraphViewType const& graph_view,
+                     VertexIterator local_vertex_first,
+                     VertexIterator local_vertex_last,
+                     AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                     AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                     EdgeOp e_op,
+                     T init)
+{
+  return transform_reduce_e(
+    handle,
+    graph_view,
+    local_vertex_first,
+    local_vertex_last,
+    adj_matrix_row_value_input,
+    adj_matrix_col_value_input,
+    dummy_edge_properties_t<typename GraphViewType::edge_type>{}.device_view(),
+    e_op,
+    init);
+}
+
+/**
+ * @brief Iterate over the edges of the vertices in a vertex frontier bucket and reduce @p edge_op
+ * outputs.
+ *
+ * This function is identical to the above except that the vertices are provided by a
+ * SortedUniqueKeyBucket object (e.g. VertexFrontier::get_bucket()).
+ *
+ * @param bucket SortedUniqueKeyBucket object holding the vertices (assigned to this process in
+ * multi-GPU).
+ *
+ * See the above function for the remaining template and function parameters.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename T>
+T transform_reduce_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  SortedUniqueKeyBucket<typename GraphViewType::vertex_type,
+                        void,
+                        GraphViewType::is_multi_gpu> const& bucket,
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeOp e_op,
+  T init)
+{
+  return transform_reduce_e(handle,
+                            graph_view,
+                            bucket.begin(),
+                            bucket.end(),
+                            adj_matrix_row_value_input,
+                            adj_matrix_col_value_input,
+                            e_op,
+                            init);
+}
+
+/**
+ * @brief Iterate over the entire set of edges and reduce @p edge_op outputs with the given
+ * reduction operation.
+ *
+ * This function is identical to transform_reduce_e() except that the reduction operation is
+ * specified by @p reduce_op. If @p reduce_op is reduce_op::elementwise, @p e_op returns a
+ * thrust::tuple and the I'th tuple element is reduced by the I'th reduction operation of
+ * reduce_op::elementwise; this computes multiple reductions (e.g. a sum and a maximum) with a
+ * single pass over the edges, instead of streaming the edges once per reduction.
+ *
+ * @tparam ReduceOp Type of the reduction operation (reduce_op::plus, reduce_op::min,
+ * reduce_op::maximum, or reduce_op::elementwise of the three).
+ * @param init Initial value to be reduced with the transform-reduced edge values.
+ * @param reduce_op Reduction operation.
+ * @return T Reduction of the @p edge_op outputs.
+ *
+ * See transform_reduce_e() for the remaining template and function parameters.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename ReduceOp>
+T transform_multi_reduce_e(raft::handle_t const& handle,
+                           GraphViewType const& graph_view,
+                           AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                           AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                           EdgeValueInputWrapper edge_value_input,
+                           EdgeOp e_op,
+                           T init,
+                           ReduceOp reduce_op)
+{
+  nvtx_range_t range("transform_multi_reduce_e");
+
+  static_assert(std::is_same_v<T, typename ReduceOp::type>);
+
+  return detail::transform_reduce_e_impl(handle,
+                                         graph_view,
+                                         adj_matrix_row_value_input,
+                                         adj_matrix_col_value_input,
+                                         edge_value_input,
+                                         e_op,
+                                         init,
+                                         reduce_op);
+}
+
+/**
+ * @brief Iterate over the entire set of edges and reduce @p edge_op outputs with the given
+ * reduction operation.
+ *
+ * This function is identical to the above except that edge properties are not used.
+ *
+ * See the above function for the template and function parameters.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename ReduceOp>
+T transform_multi_reduce_e(raft::handle_t const& handle,
+                           GraphViewType const& graph_view,
+                           AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+                           AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+                           EdgeOp e_op,
+                           T init,
+                           ReduceOp reduce_op)
+{
+  return transform_multi_reduce_e(
+    handle,
+    graph_view,
+    adj_matrix_row_value_input,
+    adj_matrix_col_value_input,
+    dummy_edge_properties_t<typename GraphViewType::edge_type>{}.device_view(),
+    e_op,
+    init,
+    reduce_op);
+}
+
 }  // namespace cugraph
@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/swap.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace detail {
+
+// binary search the shorter neighbor list elements in the longer neighbor list (O(s log l)) if the
+// longer list is at least this many times longer, merge the two lists (O(s + l)) otherwise
+int32_t constexpr nbr_intersection_binary_search_length_ratio = 16;
+
+size_t constexpr default_nbr_intersection_batch_size = size_t{1} << 22;
+
+// returns the size of the intersection of two sorted (and unique) neighbor lists
+template <typename vertex_t, typename edge_t>
+__device__ edge_t compute_nbr_intersection_size(vertex_t const* lhs_first,
+                                                edge_t lhs_size,
+                                                vertex_t const* rhs_first,
+                                                edge_t rhs_size)
+{
+  if (lhs_size > rhs_size) {
+    thrust::swap(lhs_first, rhs_first);
+    thrust::swap(lhs_size, rhs_size);
+  }
+  if (lhs_size == 0) { return edge_t{0}; }
+
+  edge_t count{0};
+  if (rhs_size / lhs_size >= nbr_intersection_binary_search_length_ratio) {
+    auto rhs_last = rhs_first + rhs_size;
+    for (edge_t i = 0; (i < lhs_size) && (rhs_first != rhs_last); ++i) {
+      rhs_first = thrust::lower_bound(thrust::seq, rhs_first, rhs_last, lhs_first[i]);
+      if ((rhs_first != rhs_last) && (*rhs_first == lhs_first[i])) {
+        ++count;
+        ++rhs_first;
+      }
+    }
+  } else {
+    edge_t i{0};
+    edge_t j{0};
+    while ((i < lhs_size) && (j < rhs_size)) {
+      auto lhs = lhs_first[i];
+      auto rhs = rhs_first[j];
+      if (lhs < rhs) {
+        ++i;
+      } else if (rhs < lhs) {
+        ++j;
+      } else {
+        ++count;
+        ++i;
+        ++j;
+      }
+    }
+  }
+
+  return count;
+}
+
+// the neighbor lists of the local vertices are in (local_offsets, local_indices), the neighbor
+// lists of the remote vertices (multi-GPU only) are in (fetched_offsets, fetched_indices) in the
+// order of fetched_vertices (sorted)
+template <typename vertex_t, typename edge_t, typename VertexPairIterator, typename IntersectionOp>
+struct intersect_nbr_lists_of_vertex_pairs_t {
+  VertexPairIterator vertex_pair_first{};
+  edge_t const* local_offsets{nullptr};
+  vertex_t const* local_indices{nullptr};
+  vertex_t local_vertex_first{};
+  vertex_t local_vertex_last{};
+  vertex_t const* fetched_vertices{nullptr};
+  size_t num_fetched_vertices{0};
+  edge_t const* fetched_offsets{nullptr};
+  vertex_t const* fetched_indices{nullptr};
+  IntersectionOp intersection_op{};
+
+  __device__ thrust::tuple<vertex_t const*, edge_t> get_nbr_list(vertex_t v) const
+  {
+    if ((v >= local_vertex_first) && (v < local_vertex_last)) {
+      auto offset = v - local_vertex_first;
+      return thrust::make_tuple(local_indices + local_offsets[offset],
+                                local_offsets[offset + 1] - local_offsets[offset]);
+    } else {
+      auto idx = thrust::distance(
+        fetched_vertices,
+        thrust::lower_bound(
+          thrust::seq, fetched_vertices, fetched_vertices + num_fetched_vertices, v));
+      return thrust::make_tuple(fetched_indices + fetched_offsets[idx],
+                                fetched_offsets[idx + 1] - fetched_offsets[idx]);
+    }
+  }
+
+  __device__ auto operator()(size_t i) const
+  {
+    auto pair  = *(vertex_pair_first + i);
+    auto u     = thrust::get<0>(pair);
+    auto v     = thrust::get<1>(pair);
+    auto u_nbr = get_nbr_list(u);
+    auto v_nbr = get_nbr_list(v);
+    return intersection_op(u,
+                           v,
+                           thrust::get<1>(u_nbr),
+                           thrust::get<1>(v_nbr),
+                           compute_nbr_intersection_size(thrust::get<0>(u_nbr),
+                                                         thrust::get<1>(u_nbr),
+                                                         thrust::get<0>(v_nbr),
+                                                         thrust::get<1>(v_nbr)));
+  }
+};
+
+template <typename vertex_t, size_t I>
+struct vertex_pair_element_t {
+  template <typename VertexPair>
+  __device__ vertex_t operator()(VertexPair pair) const
+  {
+    return thrust::get<I>(pair);
+  }
+};
+
+template <typename vertex_t>
+struct is_local_vertex_t {
+  vertex_t local_vertex_first{};
+  vertex_t local_vertex_last{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return (v >= local_vertex_first) && (v < local_vertex_last);
+  }
+};
+
+// offsets & minors: the local CSR returned by extract_local_major_edgelist &
+// compute_sorted_edge_offsets
+template <typename GraphViewType,
+          typename VertexPairIterator,
+          typename IntersectionOp,
+          typename OutputIterator>
+void transform_nbr_intersection_of_vertex_pairs_impl(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::edge_type> const& offsets,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const& minors,
+  VertexPairIterator vertex_pair_first,
+  VertexPairIterator vertex_pair_last,
+  IntersectionOp intersection_op,
+  OutputIterator output_first,
+  size_t batch_size)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using functor_t =
+    intersect_nbr_lists_of_vertex_pairs_t<vertex_t, edge_t, VertexPairIterator, IntersectionOp>;
+
+  auto num_pairs = static_cast<size_t>(thrust::distance(vertex_pair_first, vertex_pair_last));
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    auto vertex_partition_lasts = graph_view.get_vertex_partition_lasts();
+    rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                           handle.get_stream());
+    raft::update_device(d_vertex_partition_lasts.data(),
+                        vertex_partition_lasts.data(),
+                        vertex_partition_lasts.size(),
+                        handle.get_stream());
+
+    // fetching the remote neighbor lists is collective, every GPU should run the same number of
+    // batches
+    auto num_batches = host_scalar_allreduce(comm,
+                                             (num_pairs + (batch_size - 1)) / batch_size,
+                                             raft::comms::op_t::MAX,
+                                             handle.get_stream());
+
+    for (size_t i = 0; i < num_batches; ++i) {
+      auto batch_first = std::min(i * batch_size, num_pairs);
+      auto batch_last  = std::min(batch_first + batch_size, num_pairs);
+
+      rmm::device_uvector<vertex_t> remote_vertices(2 * (batch_last - batch_first),
+                                                    handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        vertex_pair_first + batch_first,
+                        vertex_pair_first + batch_last,
+                        remote_vertices.begin(),
+                        vertex_pair_element_t<vertex_t, 0>{});
+      thrust::transform(handle.get_thrust_policy(),
+                        vertex_pair_first + batch_first,
+                        vertex_pair_first + batch_last,
+                        remote_vertices.begin() + (batch_last - batch_first),
+                        vertex_pair_element_t<vertex_t, 1>{});
+      remote_vertices.resize(
+        thrust::distance(remote_vertices.begin(),
+                         thrust::remove_if(handle.get_thrust_policy(),
+                                           remote_vertices.begin(),
+                                           remote_vertices.end(),
+                                           is_local_vertex_t<vertex_t>{
+                                             graph_view.get_local_vertex_first(),
+                                             graph_view.get_local_vertex_last()})),
+        handle.get_stream());
+      thrust::sort(handle.get_thrust_policy(), remote_vertices.begin(), remote_vertices.end());
+      remote_vertices.resize(thrust::distance(remote_vertices.begin(),
+                                              thrust::unique(handle.get_thrust_policy(),
+                                                             remote_vertices.begin(),
+                                                             remote_vertices.end())),
+                             handle.get_stream());
+
+      auto [fetched_offsets, fetched_indices, fetched_edge_indices] =
+        fetch_nbr_lists(handle,
+                        remote_vertices.data(),
+                        remote_vertices.size(),
+                        minors,
+                        offsets,
+                        graph_view.get_local_vertex_first(),
+                        d_vertex_partition_lasts,
+                        false);
+
+      thrust::transform(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(batch_first),
+                        thrust::make_counting_iterator(batch_last),
+                        output_first + batch_first,
+                        functor_t{vertex_pair_first,
+                                  offsets.data(),
+                                  minors.data(),
+                                  graph_view.get_local_vertex_first(),
+                                  graph_view.get_local_vertex_last(),
+                                  remote_vertices.data(),
+                                  remote_vertices.size(),
+                                  fetched_offsets.data(),
+                                  fetched_indices.data(),
+                                  intersection_op});
+    }
+  } else {
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_pairs),
+                      output_first,
+                      functor_t{vertex_pair_first,
+                                offsets.data(),
+                                minors.data(),
+                                graph_view.get_local_vertex_first(),
+                                graph_view.get_local_vertex_last(),
+                                static_cast<vertex_t const*>(nullptr),
+                                size_t{0},
+                                static_cast<edge_t const*>(nullptr),
+                                static_cast<vertex_t const*>(nullptr),
+                                intersection_op});
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Iterate over the input vertex pairs and apply @p intersection_op to the size of the
+ * intersection of the neighbor lists of the two vertices.
+ *
+ * Neighbor lists are the (outgoing) neighbor lists excluding self-loops and the edges masked out by
+ * the graph_view edge mask. The sorted neighbor lists are intersected by merging or, if one list is
+ * much shorter than the other, by binary searching the elements of the shorter list in the longer
+ * list. In multi-GPU, the neighbor lists of the remote vertices are fetched from their owners in
+ * batches of @p batch_size pairs.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexPairIterator Type of the iterator for the input vertex pairs (thrust::tuple of two
+ * vertices).
+ * @tparam IntersectionOp Type of the quinary intersection operator.
+ * @tparam OutputIterator Type of the iterator for the output values.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object (should not be a multigraph).
+ * @param vertex_pair_first Iterator pointing to the first (inclusive) input vertex pair. Vertices
+ * can be any (including remote in multi-GPU) vertices of @p graph_view.
+ * @param vertex_pair_last Iterator pointing to the last (exclusive) input vertex pair.
+ * @param intersection_op Quinary operator takes the two vertices, their degrees (the sizes of the
+ * neighbor lists), and the intersection size and returns a value to be stored in the output.
+ * @param output_first Iterator pointing to the output value for the first input vertex pair.
+ * @param batch_size Number of vertex pairs to process at a time in multi-GPU.
+ */
+template <typename GraphViewType,
+          typename VertexPairIterator,
+          typename IntersectionOp,
+          typename OutputIterator>
+void transform_nbr_intersection_of_vertex_pairs(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexPairIterator vertex_pair_first,
+  VertexPairIterator vertex_pair_last,
+  IntersectionOp intersection_op,
+  OutputIterator output_first,
+  size_t batch_size = detail::default_nbr_intersection_batch_size)
+{
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  nvtx_range_t range("transform_nbr_intersection_of_vertex_pairs");
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  CUGRAPH_EXPECTS(!graph_view.is_multigraph(),
+                  "Invalid input argument: graph_view should not be a multigraph.");
+  CUGRAPH_EXPECTS(batch_size > 0, "Invalid input argument: batch_size should be positive.");
+
+  auto [majors, minors] = detail::extract_local_major_edgelist(handle, graph_view, true);
+  auto offsets          = detail::compute_sorted_edge_offsets<vertex_t, edge_t>(
+    handle,
+    majors,
+    graph_view.get_local_vertex_first(),
+    graph_view.get_number_of_local_vertices());
+  majors.resize(0, handle.get_stream());
+  majors.shrink_to_fit(handle.get_stream());
+
+  detail::transform_nbr_intersection_of_vertex_pairs_impl(handle,
+                                                          graph_view,
+                                                          offsets,
+                                                          minors,
+                                                          vertex_pair_first,
+                                                          vertex_pair_last,
+                                                          intersection_op,
+                                                          output_first,
+                                                          batch_size);
+}
+
+/**
+ * @brief Iterate over the entire set of edges and reduce @p intersection_op outputs on the sizes
+ * of the intersections of the neighbor lists of the edge end points.
+ *
+ * Neighbor lists and edges exclude self-loops and the edges masked out by the graph_view edge mask
+ * (see transform_nbr_intersection_of_vertex_pairs). e.g. the sum of the intersection sizes over the
+ * edges of a symmetric graph is six times the number of triangles.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam IntersectionOp Type of the quinary intersection operator.
+ * @tparam T Type of the initial value.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object (should not be a multigraph).
+ * @param intersection_op Quinary operator takes edge source, edge destination, their degrees (the
+ * sizes of the neighbor lists), and the intersection size and returns a value to be reduced.
+ * @param init Initial value to be added to the transform-reduced values.
+ * @param batch_size Number of edges to process at a time in multi-GPU.
+ * @return T Reduction of the @p intersection_op outputs.
+ */
+template <typename GraphViewType, typename IntersectionOp, typename T>
+T transform_reduce_e_with_nbr_intersection(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  IntersectionOp intersection_op,
+  T init,
+  size_t batch_size = detail::default_nbr_intersection_batch_size)
+{
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+  static_assert(std::is_arithmetic_v<T>, "T should be an arithmetic type.");
+
+  nvtx_range_t range("transform_reduce_e_with_nbr_intersection");
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  CUGRAPH_EXPECTS(!graph_view.is_multigraph(),
+                  "Invalid input argument: graph_view should not be a multigraph.");
+  CUGRAPH_EXPECTS(batch_size > 0, "Invalid input argument: batch_size should be positive.");
+
+  auto [majors, minors] = detail::extract_local_major_edgelist(handle, graph_view, true);
+  auto offsets          = detail::compute_sorted_edge_offsets<vertex_t, edge_t>(
+    handle,
+    majors,
+    graph_view.get_local_vertex_first(),
+    graph_view.get_number_of_local_vertices());
+
+  rmm::device_uvector<T> values(majors.size(), handle.get_stream());
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+  detail::transform_nbr_intersection_of_vertex_pairs_impl(handle,
+                                                          graph_view,
+                                                          offsets,
+                                                          minors,
+                                                          edge_first,
+                                                          edge_first + majors.size(),
+                                                          intersection_op,
+                                                          values.begin(),
+                                                          batch_size);
+
+  auto result =
+    thrust::reduce(handle.get_thrust_policy(),
+                   values.begin(),
+                   values.end(),
+                   ((GraphViewType::is_multi_gpu) && (handle.get_comms().get_rank() != 0)) ? T{0}
+                                                                                            : init);
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    result = host_scalar_allreduce(
+      handle.get_comms(), result, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  return result;
+}
+
+}  // namespace cugraph
@@ -18,12 +18,16 @@
 #include <cugraph/graph_view.hpp>
 #include <cugraph/matrix_partition_device_view.cuh>
 #include <cugraph/partition_manager.hpp>
+#include <cugraph/prims/edge_properties.cuh>
 #include <cugraph/prims/property_op_utils.cuh>
 #include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
 #include <cugraph/utilities/dataframe_buffer.cuh>
 #include <cugraph/utilities/device_comm.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/prims_workspace.hpp>
+#include <cugraph/utilities/profiler.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 #include <cugraph/utilities/thrust_tuple_utils.cuh>
 #include <cugraph/vertex_partition_device_view.cuh>
@@ -34,9 +38,12 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/distance.h>
+#include <thrust/fill.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
@@ -81,15 +88,19 @@ struct optional_payload_buffer_value_type_t<
 // function-in-constexpr-if-fun)
 #if 1
 template <typename payload_t, std::enable_if_t<std::is_same_v<payload_t, void>>* = nullptr>
-std::byte allocate_optional_payload_buffer(size_t size, cudaStream_t stream)
+std::byte allocate_optional_payload_buffer(size_t size,
+                                           cudaStream_t stream,
+                                           rmm::mr::device_memory_resource* mr)
 {
   return std::byte{0};  // dummy
 }
 
 template <typename payload_t, std::enable_if_t<!std::is_same_v<payload_t, void>>* = nullptr>
-auto allocate_optional_payload_buffer(size_t size, cudaStream_t stream)
+auto allocate_optional_payload_buffer(size_t size,
+                                      cudaStream_t stream,
+                                      rmm::mr::device_memory_resource* mr)
 {
-  return allocate_dataframe_buffer<payload_t>(size, stream);
+  return allocate_dataframe_buffer<payload_t>(size, stream, mr);
 }
 
 template <typename payload_t, std::enable_if_t<std::is_same_v<payload_t, void>>* = nullptr>
@@ -183,6 +194,7 @@ struct check_invalid_bucket_idx_t {
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename BufferKeyOutputIterator,
           typename BufferPayloadOutputIterator,
           typename EdgeOp>
@@ -197,9 +209,12 @@ __device__ void push_if_buffer_element(
   typename GraphViewType::weight_type weight,
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
+  typename GraphViewType::edge_type edge_offset,
   BufferKeyOutputIterator buffer_key_output_first,
   BufferPayloadOutputIterator buffer_payload_output_first,
   size_t* buffer_idx_ptr,
+  uint32_t* buffer_key_dedupe_bitmap,
   EdgeOp e_op)
 {
   using vertex_t = typename GraphViewType::vertex_type;
@@ -207,6 +222,8 @@ __device__ void push_if_buffer_element(
   using payload_t =
     typename optional_payload_buffer_value_type_t<BufferPayloadOutputIterator>::value;
 
+  if (!matrix_partition.is_valid_edge(edge_offset)) { return; }  // masked out
+
   auto col_offset  = matrix_partition.get_minor_offset_from_minor_nocheck(col);
   auto e_op_result = evaluate_edge_op<GraphViewType,
                                       key_t,
@@ -218,8 +235,15 @@ __device__ void push_if_buffer_element(
                                 weight,
                                 adj_matrix_row_value_input.get(row_offset),
                                 adj_matrix_col_value_input.get(col_offset),
+                                edge_value_input.get(edge_offset),
                                 e_op);
   if (e_op_result) {
+    if constexpr (std::is_same_v<key_t, vertex_t>) {
+      if (buffer_key_dedupe_bitmap != nullptr) {  // push only once per destination
+        auto mask = uint32_t{1} << (col_offset % 32);
+        if ((atomicOr(buffer_key_dedupe_bitmap + col_offset / 32, mask) & mask) != 0) { return; }
+      }
+    }
     static_assert(sizeof(unsigned long long int) == sizeof(size_t));
     auto buffer_idx = atomicAdd(reinterpret_cast<unsigned long long int*>(buffer_idx_ptr),
                                 static_cast<unsigned long long int>(1));
@@ -239,9 +263,11 @@ __device__ void push_if_buffer_element(
 }
 
 template <typename GraphViewType,
+          bool has_weights,
           typename KeyIterator,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename BufferKeyOutputIterator,
           typename BufferPayloadOutputIterator,
           typename EdgeOp>
@@ -255,9 +281,11 @@ __global__ void for_all_frontier_row_for_all_nbr_hypersparse(
   KeyIterator key_last,
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
   BufferKeyOutputIterator buffer_key_output_first,
   BufferPayloadOutputIterator buffer_payload_output_first,
   size_t* buffer_idx_ptr,
+  uint32_t* buffer_key_dedupe_bitmap,
   EdgeOp e_op)
 {
   using vertex_t = typename GraphViewType::vertex_type;
@@ -292,21 +320,30 @@ __global__ void for_all_frontier_row_for_all_nbr_hypersparse(
     if (row_hypersparse_idx) {
       auto row_offset = matrix_partition.get_major_offset_from_major_nocheck(row);
       auto row_idx    = row_start_offset + *row_hypersparse_idx;
-      vertex_t const* indices{nullptr};
+      detail::minor_iterator_t<vertex_t, edge_t> indices{};
       thrust::optional<weight_t const*> weights{thrust::nullopt};
       edge_t local_out_degree{};
       thrust::tie(indices, weights, local_out_degree) = matrix_partition.get_local_edges(row_idx);
-      for (edge_t i = 0; i < local_out_degree; ++i) {
+      auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(row_idx));
+      edge_t visit_first{0};
+      edge_t visit_last{local_out_degree};
+      thrust::tie(visit_first, visit_last) =
+        get_edge_visit_range(edge_value_input, row_offset, local_offset, local_out_degree);
+      for (edge_t j = visit_first; j < visit_last; ++j) {
+        auto i = get_visited_edge_idx(edge_value_input, local_offset, j);
         push_if_buffer_element<GraphViewType>(matrix_partition,
                                               key,
                                               row_offset,
                                               indices[i],
-                                              weights ? (*weights)[i] : weight_t{1.0},
+                                              get_edge_weight<has_weights>(weights, i),
                                               adj_matrix_row_value_input,
                                               adj_matrix_col_value_input,
+                                              edge_value_input,
+                                              local_offset + i,
                                               buffer_key_output_first,
                                               buffer_payload_output_first,
                                               buffer_idx_ptr,
+                                              buffer_key_dedupe_bitmap,
                                               e_op);
       }
     }
@@ -315,9 +352,11 @@ __global__ void for_all_frontier_row_for_all_nbr_hypersparse(
 }
 
 template <typename GraphViewType,
+          bool has_weights,
           typename KeyIterator,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename BufferKeyOutputIterator,
           typename BufferPayloadOutputIterator,
           typename EdgeOp>
@@ -330,9 +369,11 @@ __global__ void for_all_frontier_row_for_all_nbr_low_degree(
   KeyIterator key_last,
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
   BufferKeyOutputIterator buffer_key_output_first,
   BufferPayloadOutputIterator buffer_payload_output_first,
   size_t* buffer_idx_ptr,
+  uint32_t* buffer_key_dedupe_bitmap,
   EdgeOp e_op)
 {
   using vertex_t = typename GraphViewType::vertex_type;
@@ -359,21 +400,30 @@ __global__ void for_all_frontier_row_for_all_nbr_low_degree(
       row = thrust::get<0>(key);
     }
     auto row_offset = matrix_partition.get_major_offset_from_major_nocheck(row);
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_out_degree{};
     thrust::tie(indices, weights, local_out_degree) = matrix_partition.get_local_edges(row_offset);
-    for (edge_t i = 0; i < local_out_degree; ++i) {
+    auto local_offset = matrix_partition.get_local_offset(row_offset);
+    edge_t visit_first{0};
+    edge_t visit_last{local_out_degree};
+    thrust::tie(visit_first, visit_last) =
+      get_edge_visit_range(edge_value_input, row_offset, local_offset, local_out_degree);
+    for (edge_t j = visit_first; j < visit_last; ++j) {
+      auto i = get_visited_edge_idx(edge_value_input, local_offset, j);
       push_if_buffer_element<GraphViewType>(matrix_partition,
                                             key,
                                             row_offset,
                                             indices[i],
-                                            weights ? (*weights)[i] : weight_t{1.0},
+                                            get_edge_weight<has_weights>(weights, i),
                                             adj_matrix_row_value_input,
                                             adj_matrix_col_value_input,
+                                            edge_value_input,
+                                            local_offset + i,
                                             buffer_key_output_first,
                                             buffer_payload_output_first,
                                             buffer_idx_ptr,
+                                            buffer_key_dedupe_bitmap,
                                             e_op);
     }
     idx += gridDim.x * blockDim.x;
@@ -381,9 +431,11 @@ __global__ void for_all_frontier_row_for_all_nbr_low_degree(
 }
 
 template <typename GraphViewType,
+          bool has_weights,
           typename KeyIterator,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename BufferKeyOutputIterator,
           typename BufferPayloadOutputIterator,
           typename EdgeOp>
@@ -396,9 +448,11 @@ __global__ void for_all_frontier_row_for_all_nbr_mid_degree(
   KeyIterator key_last,
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
   BufferKeyOutputIterator buffer_key_output_first,
   BufferPayloadOutputIterator buffer_payload_output_first,
   size_t* buffer_idx_ptr,
+  uint32_t* buffer_key_dedupe_bitmap,
   EdgeOp e_op)
 {
   using vertex_t = typename GraphViewType::vertex_type;
@@ -427,21 +481,31 @@ __global__ void for_all_frontier_row_for_all_nbr_mid_degree(
       row = thrust::get<0>(key);
     }
     auto row_offset = matrix_partition.get_major_offset_from_major_nocheck(row);
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_out_degree{};
     thrust::tie(indices, weights, local_out_degree) = matrix_partition.get_local_edges(row_offset);
-    for (edge_t i = lane_id; i < local_out_degree; i += raft::warp_size()) {
+    auto local_offset = matrix_partition.get_local_offset(row_offset);
+    edge_t visit_first{0};
+    edge_t visit_last{local_out_degree};
+    thrust::tie(visit_first, visit_last) =
+      get_edge_visit_range(edge_value_input, row_offset, local_offset, local_out_degree);
+    for (edge_t j = visit_first + static_cast<edge_t>(lane_id); j < visit_last;
+         j += raft::warp_size()) {
+      auto i = get_visited_edge_idx(edge_value_input, local_offset, j);
       push_if_buffer_element<GraphViewType>(matrix_partition,
                                             key,
                                             row_offset,
                                             indices[i],
-                                            weights ? (*weights)[i] : weight_t{1.0},
+                                            get_edge_weight<has_weights>(weights, i),
                                             adj_matrix_row_value_input,
                                             adj_matrix_col_value_input,
+                                            edge_value_input,
+                                            local_offset + i,
                                             buffer_key_output_first,
                                             buffer_payload_output_first,
                                             buffer_idx_ptr,
+                                            buffer_key_dedupe_bitmap,
                                             e_op);
     }
 
@@ -450,9 +514,11 @@ __global__ void for_all_frontier_row_for_all_nbr_mid_degree(
 }
 
 template <typename GraphViewType,
+          bool has_weights,
           typename KeyIterator,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename BufferKeyOutputIterator,
           typename BufferPayloadOutputIterator,
           typename EdgeOp>
@@ -465,9 +531,11 @@ __global__ void for_all_frontier_row_for_all_nbr_high_degree(
   KeyIterator key_last,
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
   BufferKeyOutputIterator buffer_key_output_first,
   BufferPayloadOutputIterator buffer_payload_output_first,
   size_t* buffer_idx_ptr,
+  uint32_t* buffer_key_dedupe_bitmap,
   EdgeOp e_op)
 {
   using vertex_t = typename GraphViewType::vertex_type;
@@ -493,21 +561,31 @@ __global__ void for_all_frontier_row_for_all_nbr_high_degree(
       row = thrust::get<0>(key);
     }
     auto row_offset = matrix_partition.get_major_offset_from_major_nocheck(row);
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_out_degree{};
     thrust::tie(indices, weights, local_out_degree) = matrix_partition.get_local_edges(row_offset);
-    for (edge_t i = threadIdx.x; i < local_out_degree; i += blockDim.x) {
+    auto local_offset = matrix_partition.get_local_offset(row_offset);
+    edge_t visit_first{0};
+    edge_t visit_last{local_out_degree};
+    thrust::tie(visit_first, visit_last) =
+      get_edge_visit_range(edge_value_input, row_offset, local_offset, local_out_degree);
+    for (edge_t j = visit_first + static_cast<edge_t>(threadIdx.x); j < visit_last;
+         j += blockDim.x) {
+      auto i = get_visited_edge_idx(edge_value_input, local_offset, j);
       push_if_buffer_element<GraphViewType>(matrix_partition,
                                             key,
                                             row_offset,
                                             indices[i],
-                                            weights ? (*weights)[i] : weight_t{1.0},
+                                            get_edge_weight<has_weights>(weights, i),
                                             adj_matrix_row_value_input,
                                             adj_matrix_col_value_input,
+                                            edge_value_input,
+                                            local_offset + i,
                                             buffer_key_output_first,
                                             buffer_payload_output_first,
                                             buffer_idx_ptr,
+                                            buffer_key_dedupe_bitmap,
                                             e_op);
     }
 
@@ -526,7 +604,7 @@ size_t sort_and_reduce_buffer_elements(raft::handle_t const& handle,
   using payload_t =
     typename optional_payload_buffer_value_type_t<BufferPayloadOutputIterator>::value;
 
-  auto execution_policy = handle.get_thrust_policy();
+  auto execution_policy = get_prims_workspace_thrust_policy(handle);
   if constexpr (std::is_same_v<payload_t, void>) {
     thrust::sort(
       execution_policy, buffer_key_output_first, buffer_key_output_first + num_buffer_elements);
@@ -562,9 +640,10 @@ size_t sort_and_reduce_buffer_elements(raft::handle_t const& handle,
     // FIXME: actually, we can find how many unique keys are here by now.
     // FIXME: if GraphViewType::is_multi_gpu is true, this should be executed on the GPU holding
     // the vertex unless reduce_op is a pure function.
-    rmm::device_uvector<key_t> keys(num_buffer_elements, handle.get_stream());
-    auto value_buffer =
-      allocate_dataframe_buffer<payload_t>(num_buffer_elements, handle.get_stream());
+    rmm::device_uvector<key_t> keys(
+      num_buffer_elements, handle.get_stream(), get_prims_workspace_resource());
+    auto value_buffer = allocate_dataframe_buffer<payload_t>(
+      num_buffer_elements, handle.get_stream(), get_prims_workspace_resource());
     auto it = thrust::reduce_by_key(execution_policy,
                                     buffer_key_output_first,
                                     buffer_key_output_first + num_buffer_elements,
@@ -589,6 +668,98 @@ size_t sort_and_reduce_buffer_elements(raft::handle_t const& handle,
   return num_reduced_buffer_elements;
 }
 
+// keep only the first occurrence of each key (in [key_range_first, key_range_first +
+// 32 * (bitmap size))) using atomic flags, this is valid if ReduceOp is reduce_op::any (or there is
+// no payload) and avoids sorting every pushed element; the remaining elements are not sorted and
+// bitmap is set for the remaining keys on return
+template <typename BufferKeyOutputIterator, typename BufferPayloadOutputIterator>
+size_t remove_duplicate_buffer_elements(
+  raft::handle_t const& handle,
+  BufferKeyOutputIterator buffer_key_output_first,
+  BufferPayloadOutputIterator buffer_payload_output_first,
+  size_t num_buffer_elements,
+  uint32_t* bitmap /* [INOUT] */,
+  typename std::iterator_traits<BufferKeyOutputIterator>::value_type key_range_first)
+{
+  using payload_t =
+    typename optional_payload_buffer_value_type_t<BufferPayloadOutputIterator>::value;
+
+  rmm::device_uvector<uint8_t> is_first(
+    num_buffer_elements, handle.get_stream(), get_prims_workspace_resource());
+  thrust::transform(handle.get_thrust_policy(),
+                    buffer_key_output_first,
+                    buffer_key_output_first + num_buffer_elements,
+                    is_first.begin(),
+                    [bitmap, key_range_first] __device__(auto key) {
+                      auto offset = static_cast<size_t>(key - key_range_first);
+                      auto mask   = uint32_t{1} << (offset % 32);
+                      return static_cast<uint8_t>((atomicOr(bitmap + offset / 32, mask) & mask) ==
+                                                  0);
+                    });
+
+  size_t num_unique_buffer_elements{};
+  if constexpr (std::is_same_v<payload_t, void>) {
+    num_unique_buffer_elements = static_cast<size_t>(
+      thrust::distance(buffer_key_output_first,
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         buffer_key_output_first,
+                                         buffer_key_output_first + num_buffer_elements,
+                                         is_first.begin(),
+                                         [] __device__(auto flag) { return flag == 0; })));
+  } else {
+    auto pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(buffer_key_output_first, buffer_payload_output_first));
+    num_unique_buffer_elements = static_cast<size_t>(
+      thrust::distance(pair_first,
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         pair_first,
+                                         pair_first + num_buffer_elements,
+                                         is_first.begin(),
+                                         [] __device__(auto flag) { return flag == 0; })));
+  }
+
+  return num_unique_buffer_elements;
+}
+
+// sort the buffer elements with unique keys, bitmap should have the bits for the keys in the buffer
+// (and only those) set; if there is no payload and the keys are dense in the key range, this scans
+// the bitmap instead of sorting
+template <typename BufferKeyOutputIterator, typename BufferPayloadOutputIterator>
+void sort_unique_buffer_elements(
+  raft::handle_t const& handle,
+  BufferKeyOutputIterator buffer_key_output_first,
+  BufferPayloadOutputIterator buffer_payload_output_first,
+  size_t num_buffer_elements,
+  uint32_t const* bitmap,
+  typename std::iterator_traits<BufferKeyOutputIterator>::value_type key_range_first,
+  typename std::iterator_traits<BufferKeyOutputIterator>::value_type key_range_last)
+{
+  using payload_t =
+    typename optional_payload_buffer_value_type_t<BufferPayloadOutputIterator>::value;
+
+  if constexpr (std::is_same_v<payload_t, void>) {
+    if (use_frontier_bitmap(num_buffer_elements, key_range_last - key_range_first)) {
+      thrust::copy_if(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(key_range_first),
+                      thrust::make_counting_iterator(key_range_last),
+                      buffer_key_output_first,
+                      [bitmap, key_range_first] __device__(auto key) {
+                        auto offset = static_cast<size_t>(key - key_range_first);
+                        return (*(bitmap + offset / 32) & (uint32_t{1} << (offset % 32))) != 0;
+                      });
+    } else {
+      thrust::sort(get_prims_workspace_thrust_policy(handle),
+                   buffer_key_output_first,
+                   buffer_key_output_first + num_buffer_elements);
+    }
+  } else {
+    thrust::sort_by_key(get_prims_workspace_thrust_policy(handle),
+                        buffer_key_output_first,
+                        buffer_key_output_first + num_buffer_elements,
+                        buffer_payload_output_first);
+  }
+}
+
 }  // namespace detail
 
 template <typename GraphViewType, typename VertexFrontierType>
@@ -598,6 +769,8 @@ typename GraphViewType::edge_type compute_num_out_nbrs_from_frontier(
   VertexFrontierType const& frontier,
   size_t cur_frontier_bucket_idx)
 {
+  nvtx_range_t range("compute_num_out_nbrs_from_frontier");
+
   static_assert(!GraphViewType::is_adj_matrix_transposed,
                 "GraphViewType should support the push model.");
 
@@ -719,7 +892,8 @@ typename GraphViewType::edge_type compute_num_out_nbrs_from_frontier(
  * properties.
  * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
  * properties.
- * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @tparam EdgeValueInputWrapper Type of the wrapper for edge input properties.
+ * @tparam EdgeOp Type of the quinary (or senary) edge operator.
  * @tparam ReduceOp Type of the binary reduction operator.
  * @tparam VertexValueInputIterator Type of the iterator for vertex properties.
  * @tparam VertexValueOutputIterator Type of the iterator for vertex property variables.
@@ -743,9 +917,14 @@ typename GraphViewType::edge_type compute_num_out_nbrs_from_frontier(
  * cugraph::col_properties_t::device_view() (if @p e_op needs to access column properties) or
  * cugraph::dummy_properties_t::device_view() (if @p e_op does not access column properties). Use
  * copy_to_adj_matrix_col to fill the wrapper.
- * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
- * weight), properties for the row (i.e. source), and properties for the column  (i.e. destination)
- * and returns a value to be reduced the @p reduce_op.
+ * @param edge_value_input Device-copyable wrapper used to access edge input properties. Use either
+ * cugraph::edge_properties_t::device_view() (if @p e_op needs to access edge properties, e.g. to
+ * skip edges by type) or cugraph::dummy_edge_properties_t::device_view() (if @p e_op does not
+ * access edge properties). cugraph::temporal_edge_properties_t::device_view() additionally limits
+ * the visited edges to a time window (skipping the other edges by binary searches).
+ * @param e_op Quinary (or senary) operator takes edge source, edge destination, (optional edge
+ * weight), properties for the row (i.e. source), properties for the column  (i.e. destination),
+ * and properties for the edge and returns a value to be reduced the @p reduce_op.
  * @param reduce_op Binary operator takes two input arguments and reduce the two variables to one.
  * @param vertex_value_input_first Iterator pointing to the vertex properties for the first
  * (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive)
@@ -759,11 +938,15 @@ typename GraphViewType::edge_type compute_num_out_nbrs_from_frontier(
  * for this vertex and returns the target bucket index (for frontier update) and new verrtex
  * property values (to update *(@p vertex_value_output_first + i)). The target bucket index should
  * either be VertexFrontierType::kInvalidBucketIdx or an index in @p next_frontier_bucket_indices.
+ * @param compress_vertex_shuffle In multi-GPU, exchange the pushed (untagged) vertices with
+ * shuffle_sorted_vertices (sending compressed vertex IDs) instead of shuffle_values. Every process
+ * should pass the same value.
  */
 template <typename GraphViewType,
           typename VertexFrontierType,
           typename AdjMatrixRowValueInputWrapper,
           typename AdjMatrixColValueInputWrapper,
+          typename EdgeValueInputWrapper,
           typename EdgeOp,
           typename ReduceOp,
           typename VertexValueInputIterator,
@@ -780,6 +963,7 @@ void update_frontier_v_push_if_out_nbr(
   // purpose)
   AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
   AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeValueInputWrapper edge_value_input,
   EdgeOp e_op,
   ReduceOp reduce_op,
   // FIXME: if vertices in the frontier are tagged, we should have an option to access with (vertex,
@@ -795,8 +979,11 @@ void update_frontier_v_push_if_out_nbr(
   VertexValueOutputIterator vertex_value_output_first,
   // FIXME: this takes (tagged-)vertex ID in addition, think about consistency with the other
   // primitives.
-  VertexOp v_op)
+  VertexOp v_op,
+  bool compress_vertex_shuffle = false)
 {
+  nvtx_range_t range("update_frontier_v_push_if_out_nbr");
+
   static_assert(!GraphViewType::is_adj_matrix_transposed,
                 "GraphViewType should support the push model.");
 
@@ -809,11 +996,32 @@ void update_frontier_v_push_if_out_nbr(
   auto frontier_key_first = frontier.get_bucket(cur_frontier_bucket_idx).begin();
   auto frontier_key_last  = frontier.get_bucket(cur_frontier_bucket_idx).end();
 
+  // if (untagged) vertices are pushed and any pushed payload (or no payload) is as good as any
+  // other, we push only once per destination vertex (flagged in buffer_key_dedupe_bitmap). This
+  // limits the buffer size to the number of local adjacency matrix columns and replaces sort &
+  // unique with a sort (or a bitmap scan) on the unique pushes.
+  constexpr bool dedupe_on_push =
+    std::is_same_v<key_t, vertex_t> &&
+    (std::is_same_v<payload_t, void> ||
+     std::is_same_v<ReduceOp, reduce_op::any<typename ReduceOp::type>>);
+  rmm::device_uvector<uint32_t> buffer_key_dedupe_bitmap(
+    0, handle.get_stream(), detail::get_prims_workspace_resource());
+  if constexpr (dedupe_on_push) {
+    buffer_key_dedupe_bitmap.resize(
+      detail::frontier_bitmap_size(graph_view.get_number_of_local_adj_matrix_partition_cols()),
+      handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(),
+                 buffer_key_dedupe_bitmap.begin(),
+                 buffer_key_dedupe_bitmap.end(),
+                 uint32_t{0});
+  }
+
   // 1. fill the buffer
 
-  auto key_buffer = allocate_dataframe_buffer<key_t>(size_t{0}, handle.get_stream());
-  auto payload_buffer =
-    detail::allocate_optional_payload_buffer<payload_t>(size_t{0}, handle.get_stream());
+  auto key_buffer = allocate_dataframe_buffer<key_t>(
+    size_t{0}, handle.get_stream(), detail::get_prims_workspace_resource());
+  auto payload_buffer = detail::allocate_optional_payload_buffer<payload_t>(
+    size_t{0}, handle.get_stream(), detail::get_prims_workspace_resource());
   rmm::device_scalar<size_t> buffer_idx(size_t{0}, handle.get_stream());
   std::vector<size_t> local_frontier_sizes{};
   if (GraphViewType::is_multi_gpu) {
@@ -831,22 +1039,64 @@ void update_frontier_v_push_if_out_nbr(
       matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
         graph_view.get_matrix_partition_view(i));
 
-    auto matrix_partition_frontier_key_buffer =
-      allocate_dataframe_buffer<key_t>(size_t{0}, handle.get_stream());
+    auto matrix_partition_frontier_key_buffer = allocate_dataframe_buffer<key_t>(
+      size_t{0}, handle.get_stream(), detail::get_prims_workspace_resource());
     vertex_t matrix_partition_frontier_size = static_cast<vertex_t>(local_frontier_sizes[i]);
     if (GraphViewType::is_multi_gpu) {
       auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
       auto const col_comm_rank = col_comm.get_rank();
 
-      resize_dataframe_buffer(
-        matrix_partition_frontier_key_buffer, matrix_partition_frontier_size, handle.get_stream());
+      // broadcast a bitmap in place of the vertex list if the frontier is dense in the vertex
+      // partition (of the root), every rank in col_comm reaches the same decision from
+      // local_frontier_sizes[i]
+      bool bcast_bitmap{false};
+      if constexpr (std::is_same_v<key_t, vertex_t>) {
+        bcast_bitmap = detail::use_frontier_bitmap(local_frontier_sizes[i],
+                                                   matrix_partition.get_major_size());
+      }
 
-      device_bcast(col_comm,
-                   frontier_key_first,
-                   get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer),
-                   matrix_partition_frontier_size,
-                   i,
-                   handle.get_stream());
+      if (bcast_bitmap) {
+        if constexpr (std::is_same_v<key_t, vertex_t>) {
+          rmm::device_uvector<uint32_t> bitmap(
+            detail::frontier_bitmap_size(matrix_partition.get_major_size()), handle.get_stream());
+          auto const& cur_frontier_bucket = frontier.get_bucket(cur_frontier_bucket_idx);
+          if (static_cast<size_t>(col_comm_rank) == i) {
+            auto bucket_bitmap = cur_frontier_bucket.bitmap();
+            if (bucket_bitmap) {
+              thrust::copy(handle.get_thrust_policy(),
+                           *bucket_bitmap,
+                           *bucket_bitmap + bitmap.size(),
+                           bitmap.begin());
+            } else {
+              thrust::fill(handle.get_thrust_policy(), bitmap.begin(), bitmap.end(), uint32_t{0});
+              detail::set_frontier_bitmap_bits(handle,
+                                               frontier_key_first,
+                                               frontier_key_last,
+                                               bitmap.data(),
+                                               matrix_partition.get_major_first());
+            }
+          }
+          device_bcast(
+            col_comm, bitmap.data(), bitmap.data(), bitmap.size(), i, handle.get_stream());
+          matrix_partition_frontier_key_buffer =
+            detail::frontier_bitmap_to_vertices(handle,
+                                                bitmap.data(),
+                                                matrix_partition.get_major_first(),
+                                                matrix_partition.get_major_last(),
+                                                std::make_optional(local_frontier_sizes[i]));
+        }
+      } else {
+        resize_dataframe_buffer(matrix_partition_frontier_key_buffer,
+                                matrix_partition_frontier_size,
+                                handle.get_stream());
+
+        device_bcast(col_comm,
+                     frontier_key_first,
+                     get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer),
+                     matrix_partition_frontier_size,
+                     i,
+                     handle.get_stream());
+      }
     } else {
       resize_dataframe_buffer(
         matrix_partition_frontier_key_buffer, matrix_partition_frontier_size, handle.get_stream());
@@ -920,23 +1170,29 @@ void update_frontier_v_push_if_out_nbr(
     // reallocation;
     // https://devblogs.nvidia.com/introducing-low-level-gpu-virtual-memory-management/), we can
     // start with a smaller buffer size (especially when the frontier size is large).
-    // for special cases when we can assure that there is no more than one push per destination
-    // (e.g. if cugraph::reduce_op::any is used), we can limit the buffer size to
-    // std::min(max_pushes, matrix_partition.get_minor_size()).
+    // If dedupe_on_push is true, there is no more than one push per destination, so the buffer size
+    // is limited to the number of local adjacency matrix columns.
     // For Volta+, we can limit the buffer size to std::min(max_pushes,
     // matrix_partition.get_minor_size()) if the reduction operation is a pure function if we use
     // locking.
     // FIXME: if i != 0, this will require costly reallocation if we don't use the new CUDA feature
     // to reserve address space.
     auto new_buffer_size = buffer_idx.value(handle.get_stream()) + max_pushes;
+    if constexpr (dedupe_on_push) {
+      new_buffer_size = std::min(
+        new_buffer_size,
+        static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_cols()));
+    }
     resize_dataframe_buffer(key_buffer, new_buffer_size, handle.get_stream());
     if constexpr (!std::is_same_v<payload_t, void>) {
       resize_dataframe_buffer(payload_buffer, new_buffer_size, handle.get_stream());
     }
 
-    auto matrix_partition_row_value_input = adj_matrix_row_value_input;
-    auto matrix_partition_col_value_input = adj_matrix_col_value_input;
+    auto matrix_partition_row_value_input  = adj_matrix_row_value_input;
+    auto matrix_partition_col_value_input  = adj_matrix_col_value_input;
+    auto matrix_partition_edge_value_input = edge_value_input;
     matrix_partition_row_value_input.set_local_adj_matrix_partition_idx(i);
+    matrix_partition_edge_value_input.set_local_adj_matrix_partition_idx(i);
 
     if (segment_offsets) {
       static_assert(detail::num_sparse_segments_per_vertex_partition == 3);
@@ -959,78 +1215,111 @@ void update_frontier_v_push_if_out_nbr(
       raft::update_host(h_offsets.data(), d_offsets.data(), d_offsets.size(), handle.get_stream());
       CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
       h_offsets.push_back(matrix_partition_frontier_size);
-      // FIXME: we may further improve performance by 1) concurrently running kernels on different
-      // segments; 2) individually tuning block sizes for different segments; and 3) adding one more
-      // segment for very high degree vertices and running segmented reduction
+      // run the kernels on different segments concurrently if the handle has enough internal
+      // streams (kernels on the low degree segments alone often under-fill the GPU)
+      auto const num_segments = h_offsets.size();
+      std::vector<rmm::cuda_stream_view> segment_streams(num_segments, handle.get_stream_view());
+      auto concurrent_segments =
+        static_cast<size_t>(handle.get_num_internal_streams()) >= num_segments;
+      if (concurrent_segments) {
+        handle.wait_on_user_stream();
+        for (size_t j = 0; j < num_segments; ++j) {
+          segment_streams[j] = handle.get_internal_stream_view(j);
+        }
+      }
+      // FIXME: we may further improve performance by 1) individually tuning block sizes for
+      // different segments; and 2) adding one more segment for very high degree vertices and
+      // running segmented reduction
       if (h_offsets[0] > 0) {
         raft::grid_1d_block_t update_grid(
           h_offsets[0],
           detail::update_frontier_v_push_if_out_nbr_for_all_block_size,
           handle.get_device_properties().maxGridSize[0]);
-        detail::for_all_frontier_row_for_all_nbr_high_degree<GraphViewType>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
-            matrix_partition,
-            get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer),
-            get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[0],
-            matrix_partition_row_value_input,
-            matrix_partition_col_value_input,
-            get_dataframe_buffer_begin(key_buffer),
-            detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
-            buffer_idx.data(),
-            e_op);
+        detail::dispatch_has_weights(graph_view.is_weighted(), [&](auto has_weights) {
+          constexpr bool weighted = decltype(has_weights)::value;
+          detail::for_all_frontier_row_for_all_nbr_high_degree<GraphViewType, weighted>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, segment_streams[0]>>>(
+              matrix_partition,
+              get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer),
+              get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[0],
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              matrix_partition_edge_value_input,
+              get_dataframe_buffer_begin(key_buffer),
+              detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+              buffer_idx.data(),
+              dedupe_on_push ? buffer_key_dedupe_bitmap.data() : static_cast<uint32_t*>(nullptr),
+              e_op);
+        });
       }
       if (h_offsets[1] - h_offsets[0] > 0) {
         raft::grid_1d_warp_t update_grid(
           h_offsets[1] - h_offsets[0],
           detail::update_frontier_v_push_if_out_nbr_for_all_block_size,
           handle.get_device_properties().maxGridSize[0]);
-        detail::for_all_frontier_row_for_all_nbr_mid_degree<GraphViewType>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
-            matrix_partition,
-            get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[0],
-            get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[1],
-            matrix_partition_row_value_input,
-            matrix_partition_col_value_input,
-            get_dataframe_buffer_begin(key_buffer),
-            detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
-            buffer_idx.data(),
-            e_op);
+        detail::dispatch_has_weights(graph_view.is_weighted(), [&](auto has_weights) {
+          constexpr bool weighted = decltype(has_weights)::value;
+          detail::for_all_frontier_row_for_all_nbr_mid_degree<GraphViewType, weighted>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, segment_streams[1]>>>(
+              matrix_partition,
+              get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[0],
+              get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[1],
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              matrix_partition_edge_value_input,
+              get_dataframe_buffer_begin(key_buffer),
+              detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+              buffer_idx.data(),
+              dedupe_on_push ? buffer_key_dedupe_bitmap.data() : static_cast<uint32_t*>(nullptr),
+              e_op);
+        });
       }
       if (h_offsets[2] - h_offsets[1] > 0) {
         raft::grid_1d_thread_t update_grid(
           h_offsets[2] - h_offsets[1],
           detail::update_frontier_v_push_if_out_nbr_for_all_block_size,
           handle.get_device_properties().maxGridSize[0]);
-        detail::for_all_frontier_row_for_all_nbr_low_degree<GraphViewType>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
-            matrix_partition,
-            get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[1],
-            get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[2],
-            matrix_partition_row_value_input,
-            matrix_partition_col_value_input,
-            get_dataframe_buffer_begin(key_buffer),
-            detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
-            buffer_idx.data(),
-            e_op);
+        detail::dispatch_has_weights(graph_view.is_weighted(), [&](auto has_weights) {
+          constexpr bool weighted = decltype(has_weights)::value;
+          detail::for_all_frontier_row_for_all_nbr_low_degree<GraphViewType, weighted>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, segment_streams[2]>>>(
+              matrix_partition,
+              get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[1],
+              get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[2],
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              matrix_partition_edge_value_input,
+              get_dataframe_buffer_begin(key_buffer),
+              detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+              buffer_idx.data(),
+              dedupe_on_push ? buffer_key_dedupe_bitmap.data() : static_cast<uint32_t*>(nullptr),
+              e_op);
+        });
       }
       if (matrix_partition.get_dcs_nzd_vertex_count() && (h_offsets[3] - h_offsets[2] > 0)) {
         raft::grid_1d_thread_t update_grid(
           h_offsets[3] - h_offsets[2],
           detail::update_frontier_v_push_if_out_nbr_for_all_block_size,
           handle.get_device_properties().maxGridSize[0]);
-        detail::for_all_frontier_row_for_all_nbr_hypersparse<GraphViewType>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
-            matrix_partition,
-            matrix_partition.get_major_first() + (*segment_offsets)[3],
-            get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[2],
-            get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[3],
-            matrix_partition_row_value_input,
-            matrix_partition_col_value_input,
-            get_dataframe_buffer_begin(key_buffer),
-            detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
-            buffer_idx.data(),
-            e_op);
+        detail::dispatch_has_weights(graph_view.is_weighted(), [&](auto has_weights) {
+          constexpr bool weighted = decltype(has_weights)::value;
+          detail::for_all_frontier_row_for_all_nbr_hypersparse<GraphViewType, weighted>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, segment_streams[3]>>>(
+              matrix_partition,
+              matrix_partition.get_major_first() + (*segment_offsets)[3],
+              get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[2],
+              get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer) + h_offsets[3],
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              matrix_partition_edge_value_input,
+              get_dataframe_buffer_begin(key_buffer),
+              detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+              buffer_idx.data(),
+              dedupe_on_push ? buffer_key_dedupe_bitmap.data() : static_cast<uint32_t*>(nullptr),
+              e_op);
+        });
       }
+      if (concurrent_segments) { handle.wait_on_internal_streams(); }
     } else {
       if (matrix_partition_frontier_size > 0) {
         raft::grid_1d_thread_t update_grid(
@@ -1038,29 +1327,49 @@ void update_frontier_v_push_if_out_nbr(
           detail::update_frontier_v_push_if_out_nbr_for_all_block_size,
           handle.get_device_properties().maxGridSize[0]);
 
-        detail::for_all_frontier_row_for_all_nbr_low_degree<GraphViewType>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
-            matrix_partition,
-            get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer),
-            get_dataframe_buffer_end(matrix_partition_frontier_key_buffer),
-            matrix_partition_row_value_input,
-            matrix_partition_col_value_input,
-            get_dataframe_buffer_begin(key_buffer),
-            detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
-            buffer_idx.data(),
-            e_op);
+        detail::dispatch_has_weights(graph_view.is_weighted(), [&](auto has_weights) {
+          constexpr bool weighted = decltype(has_weights)::value;
+          detail::for_all_frontier_row_for_all_nbr_low_degree<GraphViewType, weighted>
+            <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+              matrix_partition,
+              get_dataframe_buffer_begin(matrix_partition_frontier_key_buffer),
+              get_dataframe_buffer_end(matrix_partition_frontier_key_buffer),
+              matrix_partition_row_value_input,
+              matrix_partition_col_value_input,
+              matrix_partition_edge_value_input,
+              get_dataframe_buffer_begin(key_buffer),
+              detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+              buffer_idx.data(),
+              dedupe_on_push ? buffer_key_dedupe_bitmap.data() : static_cast<uint32_t*>(nullptr),
+              e_op);
+        });
       }
     }
   }
 
   // 2. reduce the buffer
 
-  auto num_buffer_elements = detail::sort_and_reduce_buffer_elements(
-    handle,
-    get_dataframe_buffer_begin(key_buffer),
-    detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
-    buffer_idx.value(handle.get_stream()),
-    reduce_op);
+  size_t num_buffer_elements{0};
+  if constexpr (dedupe_on_push) {
+    num_buffer_elements = buffer_idx.value(handle.get_stream());
+    detail::sort_unique_buffer_elements(
+      handle,
+      get_dataframe_buffer_begin(key_buffer),
+      detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+      num_buffer_elements,
+      buffer_key_dedupe_bitmap.data(),
+      graph_view.get_local_adj_matrix_partition_col_first(),
+      graph_view.get_local_adj_matrix_partition_col_last());
+    buffer_key_dedupe_bitmap.resize(0, handle.get_stream());
+    buffer_key_dedupe_bitmap.shrink_to_fit(handle.get_stream());
+  } else {
+    num_buffer_elements = detail::sort_and_reduce_buffer_elements(
+      handle,
+      get_dataframe_buffer_begin(key_buffer),
+      detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+      buffer_idx.value(handle.get_stream()),
+      reduce_op);
+  }
   if (GraphViewType::is_multi_gpu) {
     // FIXME: this step is unnecessary if row_comm_size== 1
     auto& comm               = handle.get_comms();
@@ -1102,8 +1411,19 @@ void update_frontier_v_push_if_out_nbr(
       h_tx_buffer_last_boundaries.begin(), h_tx_buffer_last_boundaries.end(), tx_counts.begin());
 
     auto rx_key_buffer = allocate_dataframe_buffer<key_t>(size_t{0}, handle.get_stream());
-    std::tie(rx_key_buffer, std::ignore) = shuffle_values(
-      row_comm, get_dataframe_buffer_begin(key_buffer), tx_counts, handle.get_stream());
+    if constexpr (std::is_same_v<key_t, vertex_t>) {
+      // the keys are sorted (and unique if dedupe_on_push), an ideal target for compression
+      if (compress_vertex_shuffle) {
+        std::tie(rx_key_buffer, std::ignore) = shuffle_sorted_vertices(
+          row_comm, get_dataframe_buffer_begin(key_buffer), tx_counts, handle.get_stream());
+      } else {
+        std::tie(rx_key_buffer, std::ignore) = shuffle_values(
+          row_comm, get_dataframe_buffer_begin(key_buffer), tx_counts, handle.get_stream());
+      }
+    } else {
+      std::tie(rx_key_buffer, std::ignore) = shuffle_values(
+        row_comm, get_dataframe_buffer_begin(key_buffer), tx_counts, handle.get_stream());
+    }
     key_buffer = std::move(rx_key_buffer);
 
     if constexpr (!std::is_same_v<payload_t, void>) {
@@ -1113,19 +1433,42 @@ void update_frontier_v_push_if_out_nbr(
       payload_buffer = std::move(rx_payload_buffer);
     }
 
-    num_buffer_elements = detail::sort_and_reduce_buffer_elements(
-      handle,
-      get_dataframe_buffer_begin(key_buffer),
-      detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
-      size_dataframe_buffer(key_buffer),
-      reduce_op);
+    if constexpr (dedupe_on_push) {
+      rmm::device_uvector<uint32_t> bitmap(
+        detail::frontier_bitmap_size(graph_view.get_number_of_local_vertices()),
+        handle.get_stream());
+      thrust::fill(handle.get_thrust_policy(), bitmap.begin(), bitmap.end(), uint32_t{0});
+      num_buffer_elements = detail::remove_duplicate_buffer_elements(
+        handle,
+        get_dataframe_buffer_begin(key_buffer),
+        detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+        size_dataframe_buffer(key_buffer),
+        bitmap.data(),
+        graph_view.get_local_vertex_first());
+      detail::sort_unique_buffer_elements(
+        handle,
+        get_dataframe_buffer_begin(key_buffer),
+        detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+        num_buffer_elements,
+        bitmap.data(),
+        graph_view.get_local_vertex_first(),
+        graph_view.get_local_vertex_last());
+    } else {
+      num_buffer_elements = detail::sort_and_reduce_buffer_elements(
+        handle,
+        get_dataframe_buffer_begin(key_buffer),
+        detail::get_optional_payload_buffer_begin<payload_t>(payload_buffer),
+        size_dataframe_buffer(key_buffer),
+        reduce_op);
+    }
   }
 
   // 3. update vertex properties and frontier
 
   if (num_buffer_elements > 0) {
     static_assert(VertexFrontierType::kNumBuckets <= std::numeric_limits<uint8_t>::max());
-    rmm::device_uvector<uint8_t> bucket_indices(num_buffer_elements, handle.get_stream());
+    rmm::device_uvector<uint8_t> bucket_indices(
+      num_buffer_elements, handle.get_stream(), detail::get_prims_workspace_resource());
 
     auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
       graph_view.get_vertex_partition_view());
@@ -1203,4 +1546,114 @@ void update_frontier_v_push_if_out_nbr(
   }
 }
 
+/**
+ * @brief Update (tagged-)vertex frontier and (tagged-)vertex property values iterating over the
+ * outgoing edges from the frontier.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexFrontierType Type of the vertex frontier class which abstracts vertex frontier
+ * managements.
+ * @tparam AdjMatrixRowValueInputWrapper Type of the wrapper for graph adjacency matrix row input
+ * properties.
+ * @tparam AdjMatrixColValueInputWrapper Type of the wrapper for graph adjacency matrix column input
+ * properties.
+ * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @tparam ReduceOp Type of the binary reduction operator.
+ * @tparam VertexValueInputIterator Type of the iterator for vertex properties.
+ * @tparam VertexValueOutputIterator Type of the iterator for vertex property variables.
+ * @tparam VertexOp Type of the binary vertex operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param frontier VertexFrontier class object for vertex frontier managements. This object includes
+ * multiple bucket objects.
+ * @param cur_frontier_bucket_idx Index of the VertexFrontier bucket holding vertices for the
+ * current iteration.
+ * @param next_frontier_bucket_indices Indices of the VertexFrontier buckets to store new frontier
+ * vertices for the next iteration.
+ * @param adj_matrix_row_value_input Device-copyable wrapper used to access row input properties
+ * (for the rows assigned to this process in multi-GPU). Use either
+ * cugraph::row_properties_t::device_view() (if @p e_op needs to access row properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access row properties). Use
+ * copy_to_adj_matrix_row to fill the wrapper.
+ * @param adj_matrix_col_value_input Device-copyable wrapper used to access column input properties
+ * (for the columns assigned to this process in multi-GPU). Use either
+ * cugraph::col_properties_t::device_view() (if @p e_op needs to access column properties) or
+ * cugraph::dummy_properties_t::device_view() (if @p e_op does not access column properties). Use
+ * copy_to_adj_matrix_col to fill the wrapper.
+ * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
+ * weight), properties for the row (i.e. source), and properties for the column  (i.e. destination)
+ * and returns a value to be reduced the @p reduce_op.
+ * @param reduce_op Binary operator takes two input arguments and reduce the two variables to one.
+ * @param vertex_value_input_first Iterator pointing to the vertex properties for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive)
+ * is deduced as @p vertex_value_input_first + @p graph_view.get_number_of_local_vertices().
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the first
+ * (inclusive) vertex (assigned to tihs process in multi-GPU). `vertex_value_output_last`
+ * (exclusive) is deduced as @p vertex_value_output_first + @p
+ * graph_view.get_number_of_local_vertices().
+ * @param v_op Ternary operator takes (tagged-)vertex ID, *(@p vertex_value_input_first + i) (where
+ * i is [0, @p graph_view.get_number_of_local_vertices())) and reduced value of the @p e_op outputs
+ * for this vertex and returns the target bucket index (for frontier update) and new verrtex
+ * property values (to update *(@p vertex_value_output_first + i)). The target bucket index should
+ * either be VertexFrontierType::kInvalidBucketIdx or an index in @p next_frontier_bucket_indices.
+ * @param compress_vertex_shuffle In multi-GPU, exchange the pushed (untagged) vertices with
+ * shuffle_sorted_vertices (sending compressed vertex IDs) instead of shuffle_values. Every process
+ * should pass the same value.
+ */
+template <typename GraphViewType,
+          typename VertexFrontierType,
+          typename AdjMatrixRowValueInputWrapper,
+          typename AdjMatrixColValueInputWrapper,
+          typename EdgeOp,
+          typename ReduceOp,
+          typename VertexValueInputIterator,
+          typename VertexValueOutputIterator,
+          typename VertexOp>
+void update_frontier_v_push_if_out_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexFrontierType& frontier,
+  size_t cur_frontier_bucket_idx,
+  std::vector<size_t> const& next_frontier_bucket_indices,
+  // FIXME: if vertices in the frontier are tagged, we should have an option to access with (vertex,
+  // tag) pair (currently we can access only with vertex, we may use cuco::static_map for this
+  // purpose)
+  AdjMatrixRowValueInputWrapper adj_matrix_row_value_input,
+  AdjMatrixColValueInputWrapper adj_matrix_col_value_input,
+  EdgeOp e_op,
+  ReduceOp reduce_op,
+  // FIXME: if vertices in the frontier are tagged, we should have an option to access with (vertex,
+  // tag) pair (currently we can access only with vertex, we may use cuco::static_map for this
+  // purpose)
+  VertexValueInputIterator vertex_value_input_first,
+  // FIXME: if vertices in the frontier are tagged, we should have an option to access with (vertex,
+  // tag) pair (currently we can access only with vertex, we may use cuco::static_map for this
+  // purpose)
+  // FIXME: currently, it is undefined behavior if vertices in the frontier are tagged and the same
+  // vertex property is updated by multiple v_op invocations with the same vertex but with different
+  // tags.
+  VertexValueOutputIterator vertex_value_output_first,
+  // FIXME: this takes (tagged-)vertex ID in addition, think about consistency with the other
+  // primitives.
+  VertexOp v_op,
+  bool compress_vertex_shuffle = false)
+{
+  update_frontier_v_push_if_out_nbr(
+    handle,
+    graph_view,
+    frontier,
+    cur_frontier_bucket_idx,
+    next_frontier_bucket_indices,
+    adj_matrix_row_value_input,
+    adj_matrix_col_value_input,
+    dummy_edge_properties_t<typename GraphViewType::edge_type>{}.device_view(),
+    e_op,
+    reduce_op,
+    vertex_value_input_first,
+    vertex_value_output_first,
+    v_op,
+    compress_vertex_shuffle);
+}
+
 }  // namespace cugraph
@@ -24,8 +24,14 @@
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
 #include <cinttypes>
@@ -37,6 +43,75 @@
 
 namespace cugraph {
 
+namespace detail {
+
+// a frontier bitmap over the vertex range [vertex_range_first, vertex_range_last) sets bit
+// (v - vertex_range_first) % 32 of word (v - vertex_range_first) / 32 if v is in the frontier.
+
+template <typename vertex_t>
+size_t frontier_bitmap_size(vertex_t vertex_range_size)
+{
+  return (static_cast<size_t>(vertex_range_size) + size_t{31}) / size_t{32};
+}
+
+// the bitmap form is used if it is no larger than the list form (we pay the bitmap scan cost
+// which is proportional to the bitmap size but save the sort & unique cost on insertion)
+template <typename vertex_t>
+bool use_frontier_bitmap(size_t num_vertices, vertex_t vertex_range_size)
+{
+  return (num_vertices > 0) && (num_vertices * sizeof(vertex_t) >=
+                                frontier_bitmap_size(vertex_range_size) * sizeof(uint32_t));
+}
+
+template <typename VertexIterator>
+void set_frontier_bitmap_bits(
+  raft::handle_t const& handle,
+  VertexIterator vertex_first,
+  VertexIterator vertex_last,
+  uint32_t* bitmap,
+  typename std::iterator_traits<VertexIterator>::value_type vertex_range_first)
+{
+  thrust::for_each(handle.get_thrust_policy(),
+                   vertex_first,
+                   vertex_last,
+                   [bitmap, vertex_range_first] __device__(auto v) {
+                     auto offset = static_cast<size_t>(v - vertex_range_first);
+                     atomicOr(bitmap + offset / 32, uint32_t{1} << (offset % 32));
+                   });
+}
+
+// returns the sorted (non-descending) unique list of the vertices in the bitmap
+template <typename vertex_t>
+rmm::device_uvector<vertex_t> frontier_bitmap_to_vertices(raft::handle_t const& handle,
+                                                          uint32_t const* bitmap,
+                                                          vertex_t vertex_range_first,
+                                                          vertex_t vertex_range_last,
+                                                          std::optional<size_t> num_vertices)
+{
+  auto bitmap_size = frontier_bitmap_size(vertex_range_last - vertex_range_first);
+  if (!num_vertices) {
+    num_vertices = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      bitmap,
+      bitmap + bitmap_size,
+      [] __device__(auto word) { return static_cast<size_t>(__popc(word)); },
+      size_t{0},
+      thrust::plus<size_t>());
+  }
+  rmm::device_uvector<vertex_t> vertices(*num_vertices, handle.get_stream());
+  thrust::copy_if(handle.get_thrust_policy(),
+                  thrust::make_counting_iterator(vertex_range_first),
+                  thrust::make_counting_iterator(vertex_range_last),
+                  vertices.begin(),
+                  [bitmap, vertex_range_first] __device__(auto v) {
+                    auto offset = static_cast<size_t>(v - vertex_range_first);
+                    return (*(bitmap + offset / 32) & (uint32_t{1} << (offset % 32))) != 0;
+                  });
+  return vertices;
+}
+
+}  // namespace detail
+
 // stores unique key objects in the sorted (non-descending) order; key type is either vertex_t
 // (tag_t == void) or thrust::tuple<vertex_t, tag_t> (tag_t != void)
 template <typename vertex_t, typename tag_t = void, bool is_multi_gpu = false>
@@ -59,6 +134,25 @@ class SortedUniqueKeyBucket {
   {
   }
 
+  /**
+   * @brief Construct a bucket which switches to the bitmap form (in addition to the sorted unique
+   * vertex list) while the bucket is dense in [vertex_range_first, vertex_range_last).
+   *
+   * Insertion to a bucket in the bitmap form sets bits and re-scans the bitmap instead of merging
+   * & unique-ing vertex lists, so the inserted vertices need not be sorted or unique. Every vertex
+   * inserted to this bucket should be in [vertex_range_first, vertex_range_last).
+   */
+  template <typename tag_type = tag_t, std::enable_if_t<std::is_same_v<tag_type, void>>* = nullptr>
+  SortedUniqueKeyBucket(raft::handle_t const& handle,
+                        vertex_t vertex_range_first,
+                        vertex_t vertex_range_last)
+    : handle_ptr_(&handle),
+      vertices_(0, handle.get_stream()),
+      tags_(std::byte{0}),
+      vertex_range_(std::make_tuple(vertex_range_first, vertex_range_last))
+  {
+  }
+
   /**
    * @ brief insert a vertex to the bucket
    *
@@ -116,6 +210,28 @@ class SortedUniqueKeyBucket {
     static_assert(
       std::is_same_v<typename std::iterator_traits<VertexIterator>::value_type, vertex_t>);
 
+    if (vertex_range_) {
+      auto [range_first, range_last] = *vertex_range_;
+      if (!bitmap_ && (vertices_.size() > 0) &&  // no merge is necessary if vertices_ is empty
+          detail::use_frontier_bitmap(
+            vertices_.size() + static_cast<size_t>(thrust::distance(vertex_first, vertex_last)),
+            range_last - range_first)) {
+        bitmap_ = rmm::device_uvector<uint32_t>(
+          detail::frontier_bitmap_size(range_last - range_first), handle_ptr_->get_stream());
+        thrust::fill(
+          handle_ptr_->get_thrust_policy(), (*bitmap_).begin(), (*bitmap_).end(), uint32_t{0});
+        detail::set_frontier_bitmap_bits(
+          *handle_ptr_, vertices_.begin(), vertices_.end(), (*bitmap_).data(), range_first);
+      }
+      if (bitmap_) {
+        detail::set_frontier_bitmap_bits(
+          *handle_ptr_, vertex_first, vertex_last, (*bitmap_).data(), range_first);
+        vertices_ = detail::frontier_bitmap_to_vertices(
+          *handle_ptr_, (*bitmap_).data(), range_first, range_last, std::nullopt);
+        return;
+      }
+    }
+
     if (vertices_.size() > 0) {
       rmm::device_uvector<vertex_t> merged_vertices(
         vertices_.size() + thrust::distance(vertex_first, vertex_last), handle_ptr_->get_stream());
@@ -206,8 +322,28 @@ class SortedUniqueKeyBucket {
     return vertices_.size();
   }
 
+  /**
+   * @brief Return the bitmap (one bit per vertex in bitmap_vertex_range(), see
+   * detail::frontier_bitmap_size) if this bucket is currently in the bitmap form, std::nullopt
+   * otherwise.
+   *
+   * The bitmap is valid only till the bucket is resized or modified through begin().
+   */
+  std::optional<uint32_t const*> bitmap() const
+  {
+    return bitmap_ ? std::optional<uint32_t const*>{(*bitmap_).data()} : std::nullopt;
+  }
+
+  std::optional<std::tuple<vertex_t, vertex_t>> bitmap_vertex_range() const
+  {
+    return vertex_range_;
+  }
+
+  // resizing clears the bitmap form (the caller may have modified the vertex list through
+  // begin() before resizing); the bucket will re-decide the form on the next insertion.
   void resize(size_t size)
   {
+    bitmap_ = std::nullopt;
     vertices_.resize(size, handle_ptr_->get_stream());
     if constexpr (!std::is_same_v<tag_t, void>) { tags_.resize(size, handle_ptr_->get_stream()); }
   }
@@ -275,6 +411,8 @@ class SortedUniqueKeyBucket {
   raft::handle_t const* handle_ptr_{nullptr};
   rmm::device_uvector<vertex_t> vertices_;
   optional_buffer_type tags_;
+  std::optional<std::tuple<vertex_t, vertex_t>> vertex_range_{std::nullopt};
+  std::optional<rmm::device_uvector<uint32_t>> bitmap_{std::nullopt};
 };
 
 template <typename vertex_t,
@@ -297,6 +435,19 @@ class VertexFrontier {
     }
   }
 
+  // buckets switch between the sorted unique vertex list form and the bitmap form over the local
+  // vertex partition range [local_vertex_first, local_vertex_last) depending on their density
+  template <typename tag_type = tag_t, std::enable_if_t<std::is_same_v<tag_type, void>>* = nullptr>
+  VertexFrontier(raft::handle_t const& handle,
+                 vertex_t local_vertex_first,
+                 vertex_t local_vertex_last)
+    : handle_ptr_(&handle)
+  {
+    for (size_t i = 0; i < num_buckets; ++i) {
+      buckets_.emplace_back(handle, local_vertex_first, local_vertex_last);
+    }
+  }
+
   SortedUniqueKeyBucket<vertex_t, tag_t, is_multi_gpu>& get_bucket(size_t bucket_idx)
   {
     return buckets_[bucket_idx];
@@ -435,6 +586,9 @@ class VertexFrontier {
         h_counts.data(), d_counts.data(), d_counts.size(), handle_ptr_->get_stream());
       handle_ptr_->get_stream_view().synchronize();
 
+      insert_bucket_indices.resize(h_indices.size());
+      insert_offsets.resize(h_indices.size());
+      insert_sizes.resize(h_indices.size());
       size_t offset{0};
       for (size_t i = 0; i < h_indices.size(); ++i) {
         insert_bucket_indices[i] = static_cast<size_t>(h_indices[i]);
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/tuple.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace detail {
+
+// a superstep runs in the pull direction (every edge is visited once, no frontier expansion) if
+// more than this fraction of the vertices are active
+double constexpr vertex_program_pull_active_vertex_ratio = 0.05;
+
+// the push direction edge operator: only the edges from the active vertices are visited
+template <typename vertex_t, typename ScatterOp>
+struct vertex_program_push_e_op_t {
+  ScatterOp scatter_op{};
+
+  template <typename weight_t, typename RowValue, typename ColValue>
+  __device__ auto operator()(
+    vertex_t src, vertex_t dst, weight_t w, RowValue src_val, ColValue) const
+  {
+    return scatter_op(src, dst, w, src_val);
+  }
+};
+
+template <typename vertex_t, typename value_t, typename ApplyOp>
+struct vertex_program_push_v_op_t {
+  size_t next_bucket_idx{};
+  ApplyOp apply_op{};
+
+  template <typename Message>
+  __device__ thrust::optional<thrust::tuple<size_t, value_t>> operator()(vertex_t v,
+                                                                         value_t v_val,
+                                                                         Message msg) const
+  {
+    auto new_val = apply_op(v, v_val, msg);
+    return new_val ? thrust::optional<thrust::tuple<size_t, value_t>>{thrust::make_tuple(
+                       next_bucket_idx, static_cast<value_t>(*new_val))}
+                   : thrust::nullopt;
+  }
+};
+
+// the pull direction edge operator: every edge is visited, the (summed) message count tells
+// whether a vertex received any message
+template <typename vertex_t, typename msg_t, typename ScatterOp>
+struct vertex_program_pull_e_op_t {
+  ScatterOp scatter_op{};
+
+  template <typename weight_t, typename RowValue, typename ColValue>
+  __device__ thrust::tuple<msg_t, int32_t> operator()(
+    vertex_t src, vertex_t dst, weight_t w, RowValue src_val, ColValue) const
+  {
+    if (thrust::get<1>(src_val) != uint8_t{0}) {
+      auto msg = scatter_op(src, dst, w, thrust::get<0>(src_val));
+      if (msg) { return thrust::make_tuple(static_cast<msg_t>(*msg), int32_t{1}); }
+    }
+    return thrust::make_tuple(msg_t{0}, int32_t{0});
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Run a vertex program in bulk synchronous supersteps (Pregel-style).
+ *
+ * In every superstep, the active vertices scatter messages along their outgoing edges, the
+ * messages to a vertex are gathered with @p reduce_op, and @p apply_op updates the value of every
+ * vertex that received a message; the vertices whose values are updated are active in the next
+ * superstep. The program ends if there is no active vertex or after @p max_supersteps supersteps.
+ *
+ * The frontier management, the row property caching, and the communication in multi-GPU are
+ * handled by the underlying primitives (update_frontier_v_push_if_out_nbr in the push direction
+ * and copy_v_transform_reduce_in_nbr in the pull direction). A superstep switches to the pull
+ * direction if many vertices are active (see detail::vertex_program_pull_active_vertex_ratio),
+ * this requires @p reduce_op to be reduce_op::plus and the vertex values and the messages to be
+ * arithmetic.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueIterator Type of the iterator for the vertex values.
+ * @tparam VertexIterator Type of the iterator for the initially active vertices.
+ * @tparam ScatterOp Type of the quaternary scatter operator.
+ * @tparam ReduceOp Type of the binary reduction operator.
+ * @tparam ApplyOp Type of the ternary apply operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_first Iterator pointing to the value of the first (inclusive) vertex
+ * (assigned to this process in multi-GPU). The values are updated in place.
+ * @param active_vertex_first Iterator pointing to the first (inclusive) initially active vertex
+ * (assigned to this process in multi-GPU).
+ * @param active_vertex_last Iterator pointing to the last (exclusive) initially active vertex.
+ * @param scatter_op Quaternary operator takes edge source, edge destination, edge weight (1.0 if
+ * @p graph_view is unweighted), and the source vertex value and returns a thrust::optional message
+ * to the destination (thrust::nullopt to send no message).
+ * @param reduce_op Binary operator reduces the messages to a vertex (see reduce_op.cuh).
+ * @param apply_op Ternary operator takes a vertex, its value, and the reduced message and returns
+ * a thrust::optional new value (thrust::nullopt to keep the value and not to activate the vertex).
+ * @param max_supersteps Maximum number of supersteps.
+ * @param allow_pull Flag to allow the pull direction.
+ * @return size_t Number of supersteps run.
+ */
+template <typename GraphViewType,
+          typename VertexValueIterator,
+          typename VertexIterator,
+          typename ScatterOp,
+          typename ReduceOp,
+          typename ApplyOp>
+size_t run_vertex_program(raft::handle_t const& handle,
+                          GraphViewType const& graph_view,
+                          VertexValueIterator vertex_value_first,
+                          VertexIterator active_vertex_first,
+                          VertexIterator active_vertex_last,
+                          ScatterOp scatter_op,
+                          ReduceOp reduce_op,
+                          ApplyOp apply_op,
+                          size_t max_supersteps = std::numeric_limits<size_t>::max(),
+                          bool allow_pull       = true)
+{
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  nvtx_range_t range("run_vertex_program");
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using value_t  = typename thrust::iterator_traits<VertexValueIterator>::value_type;
+  using msg_t    = typename ReduceOp::type;
+
+  auto constexpr pullable = std::is_same_v<ReduceOp, reduce_op::plus<msg_t>> &&
+                            std::is_arithmetic_v<value_t> && std::is_arithmetic_v<msg_t>;
+
+  size_t constexpr cur_bucket_idx  = 0;
+  size_t constexpr next_bucket_idx = 1;
+  VertexFrontier<vertex_t, void, GraphViewType::is_multi_gpu, 2> vertex_frontier(
+    handle, graph_view.get_local_vertex_first(), graph_view.get_local_vertex_last());
+  vertex_frontier.get_bucket(cur_bucket_idx).insert(active_vertex_first, active_vertex_last);
+
+  auto adj_matrix_row_values = GraphViewType::is_multi_gpu
+                                 ? row_properties_t<GraphViewType, value_t>(handle, graph_view)
+                                 : row_properties_t<GraphViewType, value_t>{};
+
+  size_t superstep{0};
+  while (superstep < max_supersteps) {
+    auto num_active_vertices = vertex_frontier.get_bucket(cur_bucket_idx).aggregate_size();
+    if (num_active_vertices == 0) { break; }
+
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration");
+
+    auto pull = allow_pull && (static_cast<double>(num_active_vertices) >
+                               static_cast<double>(graph_view.get_number_of_vertices()) *
+                                 detail::vertex_program_pull_active_vertex_ratio);
+
+    if constexpr (pullable) {
+      if (pull) {
+        rmm::device_uvector<uint8_t> active_flags(graph_view.get_number_of_local_vertices(),
+                                                  handle.get_stream());
+        thrust::fill(
+          handle.get_thrust_policy(), active_flags.begin(), active_flags.end(), uint8_t{0});
+        thrust::for_each(handle.get_thrust_policy(),
+                         vertex_frontier.get_bucket(cur_bucket_idx).begin(),
+                         vertex_frontier.get_bucket(cur_bucket_idx).end(),
+                         [active_flags       = active_flags.data(),
+                          local_vertex_first = graph_view.get_local_vertex_first()] __device__(
+                           auto v) { active_flags[v - local_vertex_first] = uint8_t{1}; });
+        auto row_value_first =
+          thrust::make_zip_iterator(thrust::make_tuple(vertex_value_first, active_flags.begin()));
+
+        rmm::device_uvector<msg_t> msgs(graph_view.get_number_of_local_vertices(),
+                                        handle.get_stream());
+        rmm::device_uvector<int32_t> msg_counts(msgs.size(), handle.get_stream());
+        auto e_op = detail::vertex_program_pull_e_op_t<vertex_t, msg_t, ScatterOp>{scatter_op};
+        auto msg_first =
+          thrust::make_zip_iterator(thrust::make_tuple(msgs.begin(), msg_counts.begin()));
+        if constexpr (GraphViewType::is_multi_gpu) {
+          row_properties_t<GraphViewType, thrust::tuple<value_t, uint8_t>> adj_matrix_row_states(
+            handle, graph_view);
+          copy_to_adj_matrix_row(handle, graph_view, row_value_first, adj_matrix_row_states);
+          copy_v_transform_reduce_in_nbr(handle,
+                                         graph_view,
+                                         adj_matrix_row_states.device_view(),
+                                         dummy_properties_t<vertex_t>{}.device_view(),
+                                         e_op,
+                                         thrust::make_tuple(msg_t{0}, int32_t{0}),
+                                         msg_first);
+        } else {
+          copy_v_transform_reduce_in_nbr(
+            handle,
+            graph_view,
+            detail::major_properties_device_view_t<vertex_t, decltype(row_value_first)>(
+              row_value_first),
+            dummy_properties_t<vertex_t>{}.device_view(),
+            e_op,
+            thrust::make_tuple(msg_t{0}, int32_t{0}),
+            msg_first);
+        }
+
+        // reuse active_flags for the vertices active in the next superstep
+        thrust::for_each(
+          handle.get_thrust_policy(),
+          thrust::make_counting_iterator(vertex_t{0}),
+          thrust::make_counting_iterator(graph_view.get_number_of_local_vertices()),
+          [vertex_value_first,
+           active_flags       = active_flags.data(),
+           msg_first,
+           local_vertex_first = graph_view.get_local_vertex_first(),
+           apply_op] __device__(auto i) {
+            active_flags[i] = uint8_t{0};
+            auto msg        = *(msg_first + i);
+            if (thrust::get<1>(msg) > 0) {
+              auto new_val = apply_op(
+                local_vertex_first + i, *(vertex_value_first + i), thrust::get<0>(msg));
+              if (new_val) {
+                *(vertex_value_first + i) = static_cast<value_t>(*new_val);
+                active_flags[i]           = uint8_t{1};
+              }
+            }
+          });
+        rmm::device_uvector<vertex_t> next_active_vertices(active_flags.size(),
+                                                           handle.get_stream());
+        next_active_vertices.resize(
+          thrust::distance(
+            next_active_vertices.begin(),
+            thrust::copy_if(handle.get_thrust_policy(),
+                            thrust::make_counting_iterator(graph_view.get_local_vertex_first()),
+                            thrust::make_counting_iterator(graph_view.get_local_vertex_last()),
+                            active_flags.begin(),
+                            next_active_vertices.begin(),
+                            [] __device__(auto flag) { return flag != uint8_t{0}; })),
+          handle.get_stream());
+        vertex_frontier.get_bucket(next_bucket_idx)
+          .insert(next_active_vertices.begin(), next_active_vertices.end());
+      }
+    } else {
+      pull = false;
+    }
+
+    if (!pull) {
+      auto push = [&](auto adj_matrix_row_value_input) {
+        update_frontier_v_push_if_out_nbr(
+          handle,
+          graph_view,
+          vertex_frontier,
+          cur_bucket_idx,
+          std::vector<size_t>{next_bucket_idx},
+          adj_matrix_row_value_input,
+          dummy_properties_t<vertex_t>{}.device_view(),
+          detail::vertex_program_push_e_op_t<vertex_t, ScatterOp>{scatter_op},
+          reduce_op,
+          vertex_value_first,
+          vertex_value_first,
+          detail::vertex_program_push_v_op_t<vertex_t, value_t, ApplyOp>{next_bucket_idx,
+                                                                         apply_op});
+      };
+
+      if constexpr (GraphViewType::is_multi_gpu) {
+        copy_to_adj_matrix_row(handle,
+                               graph_view,
+                               vertex_frontier.get_bucket(cur_bucket_idx).begin(),
+                               vertex_frontier.get_bucket(cur_bucket_idx).end(),
+                               vertex_value_first,
+                               adj_matrix_row_values);
+        push(adj_matrix_row_values.device_view());
+      } else {
+        push(detail::major_properties_device_view_t<vertex_t, VertexValueIterator>(
+          vertex_value_first));
+      }
+    }
+
+    vertex_frontier.get_bucket(cur_bucket_idx).clear();
+    vertex_frontier.get_bucket(cur_bucket_idx).shrink_to_fit();
+    vertex_frontier.swap_buckets(cur_bucket_idx, next_bucket_idx);
+
+    ++superstep;
+  }
+
+  return superstep;
+}
+
+}  // namespace cugraph
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <tuple>
+
+namespace cugraph {
+
+/**
+ * @brief Owning, reusable table of (old label, new label) pairs for relabeling multiple label
+ * arrays against the same mapping.
+ *
+ * relabel() rebuilds (and in multi-GPU re-shuffles) the mapping on every call. relabel_table_t
+ * builds it once and reuses it for every subsequent label array. Like renumber_index_t, the table
+ * stores the pairs sorted by the old labels and looks up with binary search (stream-ordered, no
+ * cuco::static_map); in multi-GPU, the pairs are distributed by hashing the old labels
+ * (detail::compute_gpu_id_from_vertex_t) and each label array is routed to the owning GPUs with a
+ * single round trip.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ */
+template <typename vertex_t, bool multi_gpu>
+class relabel_table_t {
+ public:
+  using vertex_type                  = vertex_t;
+  static constexpr bool is_multi_gpu = multi_gpu;
+
+  /**
+   * @brief Construct a relabel table.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param old_new_label_pairs Pairs of an old label and the corresponding new label (each process
+   * holds only part of the entire old labels and the corresponding new labels; partitioning can be
+   * arbitrary). The pairs are copied, so the input can be released after construction.
+   * @param num_label_pairs Number of (old, new) label pairs.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  relabel_table_t(raft::handle_t const& handle,
+                  std::tuple<vertex_t const*, vertex_t const*> old_new_label_pairs,
+                  vertex_t num_label_pairs,
+                  bool do_expensive_check = false);
+
+  /**
+   * @brief Relabel old labels to new labels in-place.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param labels Pointer to the (device accessible) labels to be relabeled.
+   * @param num_labels Number of labels to be relabeled.
+   * @param skip_missing_labels Flag dictating the behavior on missing labels (@p labels contains
+   * old labels missing in the table). If set to true, missing elements are skipped (not
+   * relabeled). If set to false, missing elements are set to cugraph::invalid_vertex_id<vertex_t>
+   * (if @p do_expensive_check is set to true, this function will throw an exception).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void relabel(raft::handle_t const& handle,
+               vertex_t* labels /* [INOUT] */,
+               size_t num_labels,
+               bool skip_missing_labels,
+               bool do_expensive_check = false) const;
+
+  /**
+   * @brief Relabel old labels to new labels in-place, streaming the labels through device memory
+   * in chunks.
+   *
+   * Use this for label arrays that do not fit in device memory (e.g. in host memory). At most
+   * @p chunk_size labels are staged in device memory at a time. In multi-GPU, every process
+   * should call this function (the processes run the same number of chunk iterations, a process
+   * with fewer labels participates with empty chunks).
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param labels Pointer to the labels to be relabeled (host or device memory, copied with
+   * cudaMemcpyDefault; pinned host memory is recommended).
+   * @param num_labels Number of labels to be relabeled.
+   * @param chunk_size Maximum number of labels to relabel at once.
+   * @param skip_missing_labels Same as relabel().
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void relabel_chunked(raft::handle_t const& handle,
+                       vertex_t* labels /* [INOUT] */,
+                       size_t num_labels,
+                       size_t chunk_size,
+                       bool skip_missing_labels,
+                       bool do_expensive_check = false) const;
+
+  // number of (old label, new label) pairs stored in this process
+  size_t get_number_of_local_label_pairs() const { return sorted_old_labels_.size(); }
+
+ private:
+  // (old label, new label) pairs sorted by the old labels (in multi-GPU, the pairs with the old
+  // labels hashed to this GPU)
+  rmm::device_uvector<vertex_t> sorted_old_labels_;
+  rmm::device_uvector<vertex_t> new_labels_;
+};
+
+}  // namespace cugraph
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @brief Owning, reusable index over a renumber map for batched translation between external and
+ * internal vertex IDs.
+ *
+ * renumber_ext_vertices & unrenumber_int_vertices rebuild a lookup table from the renumber map on
+ * every call. renumber_index_t builds the table once (typically next to the graph_t object the
+ * renumber map came with) and reuses it for every subsequent batch; re-building the graph with the
+ * same renumber map does not invalidate the index. The index stores the (external ID, internal ID)
+ * pairs sorted by the external IDs and looks up with binary search, so construction and lookups
+ * are stream-ordered on the handle's stream (no cuco::static_map, no stream synchronization in
+ * single-GPU). In multi-GPU, the pairs are distributed by hashing the external IDs
+ * (detail::compute_gpu_id_from_vertex_t) and each lookup batch is routed to the owning GPUs with a
+ * single round trip (one shuffle to the owners and one shuffle back).
+ *
+ * Note cugraph::invalid_id<vertex_t>::value remains unchanged in both directions.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ */
+template <typename vertex_t, bool multi_gpu>
+class renumber_index_t {
+ public:
+  using vertex_type                  = vertex_t;
+  static constexpr bool is_multi_gpu = multi_gpu;
+
+  /**
+   * @brief Construct a renumber index.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param renumber_map_labels Pointer to the external vertices corresponding to the internal
+   * vertices in the range assigned to this process. The labels are copied, so the input can be
+   * released after construction.
+   * @param vertex_partition_lasts Last local internal vertices (exclusive, assigned to each process
+   * in multi-GPU).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  renumber_index_t(raft::handle_t const& handle,
+                   vertex_t const* renumber_map_labels,
+                   std::vector<vertex_t> const& vertex_partition_lasts,
+                   bool do_expensive_check = false);
+
+  /**
+   * @brief Renumber external vertices to internal vertices in-place.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param vertices Pointer to the external vertices to be renumbered.
+   * @param num_vertices Number of vertices to be renumbered.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void renumber(raft::handle_t const& handle,
+                vertex_t* vertices /* [INOUT] */,
+                size_t num_vertices,
+                bool do_expensive_check = false) const;
+
+  /**
+   * @brief Unrenumber (possibly non-local) internal vertices to external vertices in-place.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param vertices Pointer to the internal vertices to be unrenumbered.
+   * @param num_vertices Number of vertices to be unrenumbered.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void unrenumber(raft::handle_t const& handle,
+                  vertex_t* vertices /* [INOUT] */,
+                  size_t num_vertices,
+                  bool do_expensive_check = false) const;
+
+  vertex_t get_number_of_vertices() const { return vertex_partition_lasts_.back(); }
+
+  vertex_t get_local_vertex_first() const { return local_vertex_first_; }
+
+  vertex_t get_local_vertex_last() const
+  {
+    return local_vertex_first_ + static_cast<vertex_t>(labels_.size());
+  }
+
+  std::vector<vertex_t> const& get_vertex_partition_lasts() const
+  {
+    return vertex_partition_lasts_;
+  }
+
+  vertex_t const* get_renumber_map_labels() const { return labels_.data(); }
+
+ private:
+  std::vector<vertex_t> vertex_partition_lasts_{};
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts_;
+  vertex_t local_vertex_first_{0};
+
+  // internal ID to external ID for the local internal vertices
+  rmm::device_uvector<vertex_t> labels_;
+
+  // (external ID, internal ID) pairs sorted by the external IDs (in multi-GPU, the pairs with the
+  // external IDs hashed to this GPU)
+  rmm::device_uvector<vertex_t> sorted_ext_vertices_;
+  rmm::device_uvector<vertex_t> int_vertices_;
+};
+
+}  // namespace cugraph
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace cugraph {
+
+/**
+ * @brief Periodic checkpointing parameters of the long-running iterative algorithms (PageRank,
+ * Louvain, and weakly connected components).
+ *
+ * The algorithm state is serialized (with serializer::serializer_t) every @p interval iterations
+ * (PageRank) or levels (Louvain and weakly connected components), each rank writing its local state
+ * to its own file. If @p resume is set, the algorithm restarts from the last complete checkpoint
+ * (and starts from scratch if there is no checkpoint). In multi-GPU, a new checkpoint replaces the
+ * previous one only after every rank has finished writing its file, so a failure at any point
+ * leaves a consistent checkpoint to restart from. Restart with the same input graph, the same
+ * algorithm parameters, and (in multi-GPU) the same number of ranks and 2D partitioning.
+ */
+struct checkpoint_params_t {
+  std::string path_prefix{};  // rank r's file is "<path_prefix>.<r>" (".0" suffix in SG)
+  size_t interval{1};         // checkpoint every interval iterations (or levels)
+  bool resume{false};         // restart from the last checkpoint (if exists)
+};
+
+}  // namespace cugraph
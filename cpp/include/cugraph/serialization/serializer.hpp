@@ -25,11 +25,29 @@
 #include <raft/handle.hpp>
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
 #include <vector>
 
 namespace cugraph {
 namespace serializer {
 
+// binary graph file; the layout mirrors the serializer_t byte stream (graph metadata followed by
+// offsets, indices, and optional weights) so graphs that are already built can be reloaded without
+// re-parsing text inputs:
+//
+// [file header: magic, version, sizeof(vertex_t), sizeof(edge_t), sizeof(weight_t),
+//  number of vertices, number of edges, is_symmetric, is_multigraph, is_weighted,
+//  number of segment offsets]
+// [segment offsets]
+// [offsets][indices][weights (optional)]
+//
+// each array section starts at a graph_file_alignment byte boundary (so the sections can also be
+// read with direct I/O).
+//
+constexpr size_t graph_file_alignment{4096};
+
 class serializer_t {
  public:
   using byte_t = uint8_t;
@@ -57,10 +75,97 @@ class serializer_t {
   template <typename graph_t, typename Enable = void>
   struct graph_meta_t;
 
+  // multi-GPU version: metadata of the local (this rank's) portion of the graph; a graph is
+  // un/serialized per rank, and unserialization expects the same rank layout (row_comm_size,
+  // col_comm_size, and this rank's row_comm & col_comm ranks) as serialization, so each rank can
+  // reload its own partition in parallel without any shuffling;
+  //
   template <typename graph_t>
   struct graph_meta_t<graph_t, std::enable_if_t<graph_t::is_multi_gpu>> {
-    // purposely empty, for now;
-    // FIXME: provide implementation for multi-gpu version
+    using vertex_t   = typename graph_t::vertex_type;
+    using edge_t     = typename graph_t::edge_type;
+    using bool_ser_t = uint8_t;
+    using int_ser_t  = int32_t;
+
+    graph_meta_t(void) {}
+
+    explicit graph_meta_t(graph_t const& graph)
+      : num_vertices_(graph.get_number_of_vertices()),
+        num_edges_(graph.get_number_of_edges()),
+        properties_(graph.get_graph_properties()),
+        is_weighted_(graph.is_weighted()),
+        vertex_partition_offsets_(graph.partition_.get_vertex_partition_offsets()),
+        row_comm_size_(graph.partition_.get_row_size()),
+        col_comm_size_(graph.partition_.get_col_size()),
+        row_comm_rank_(graph.partition_.get_comm_rank() % graph.partition_.get_row_size()),
+        col_comm_rank_(graph.partition_.get_comm_rank() / graph.partition_.get_row_size()),
+        offsets_sizes_(graph.adj_matrix_partition_offsets_.size()),
+        edge_counts_(graph.adj_matrix_partition_offsets_.size()),
+        dcs_nzd_vertex_counts_(graph.adj_matrix_partition_dcs_nzd_vertex_counts_),
+        segment_offsets_(graph.adj_matrix_partition_segment_offsets_),
+        use_compressed_indices_(graph.adj_matrix_partition_compressed_indices_.has_value()),
+        local_sorted_unique_edge_row_offsets_(graph.local_sorted_unique_edge_row_offsets_),
+        local_sorted_unique_edge_col_offsets_(graph.local_sorted_unique_edge_col_offsets_)
+    {
+      auto graph_view = graph.view();
+      for (size_t i = 0; i < offsets_sizes_.size(); ++i) {
+        offsets_sizes_[i] = graph.adj_matrix_partition_offsets_[i].size();
+        edge_counts_[i]   = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+      }
+      if (graph.local_sorted_unique_edge_rows_) {
+        num_local_sorted_unique_edge_rows_ = (*(graph.local_sorted_unique_edge_rows_)).size();
+      }
+      if (graph.local_sorted_unique_edge_cols_) {
+        num_local_sorted_unique_edge_cols_ = (*(graph.local_sorted_unique_edge_cols_)).size();
+      }
+    }
+
+    size_t num_vertices_{};
+    size_t num_edges_{};
+    graph_properties_t properties_{};
+    bool is_weighted_{};
+
+    // partition_t
+    std::vector<vertex_t> vertex_partition_offsets_{};
+    int row_comm_size_{};
+    int col_comm_size_{};
+    int row_comm_rank_{};
+    int col_comm_rank_{};
+
+    // per (local) adjacency matrix partition
+    std::vector<size_t> offsets_sizes_{};
+    std::vector<size_t> edge_counts_{};
+    std::optional<std::vector<vertex_t>> dcs_nzd_vertex_counts_{};
+
+    std::optional<std::vector<vertex_t>> segment_offsets_{};
+    bool use_compressed_indices_{};
+
+    std::optional<size_t> num_local_sorted_unique_edge_rows_{};
+    std::optional<size_t> num_local_sorted_unique_edge_cols_{};
+    std::optional<std::vector<vertex_t>> local_sorted_unique_edge_row_offsets_{};
+    std::optional<std::vector<vertex_t>> local_sorted_unique_edge_col_offsets_{};
+
+    // size of the serialized metadata (serialized in the following order: 7 size_t values (number
+    // of vertices & edges, and the sizes of segment_offsets_, the local sorted unique edge rows,
+    // their offsets, the local sorted unique edge columns, and their offsets; 0 if not used), 7
+    // boolean flags, 4 ints (sub-communicator sizes & ranks), then vertex_partition_offsets_, per
+    // partition offsets sizes & edge counts, DCS non-zero degree vertex counts (if used), segment
+    // offsets, and local sorted unique edge row & column offsets (if used))
+    size_t get_device_sz_bytes(void) const
+    {
+      auto num_partitions = static_cast<size_t>(col_comm_size_);
+      return 7 * sizeof(size_t) + 7 * sizeof(bool_ser_t) + 4 * sizeof(int_ser_t) +
+             vertex_partition_offsets_.size() * sizeof(vertex_t) +
+             2 * num_partitions * sizeof(size_t) +
+             (dcs_nzd_vertex_counts_ ? num_partitions * sizeof(vertex_t) : size_t{0}) +
+             (segment_offsets_ ? (*segment_offsets_).size() * sizeof(vertex_t) : size_t{0}) +
+             (local_sorted_unique_edge_row_offsets_
+                ? (*local_sorted_unique_edge_row_offsets_).size() * sizeof(vertex_t)
+                : size_t{0}) +
+             (local_sorted_unique_edge_col_offsets_
+                ? (*local_sorted_unique_edge_col_offsets_).size() * sizeof(vertex_t)
+                : size_t{0});
+    }
   };
 
   template <typename graph_t>
@@ -135,6 +240,30 @@ class serializer_t {
   template <typename graph_t>
   void serialize(graph_t const& graph, graph_meta_t<graph_t>& gmeta);  // serialization target
 
+  // graph serialization to host memory (stream-ordered),
+  // without staging the serialized graph in device memory; writes the same byte sequence as
+  // serialize() above (graph metadata first) to h_storage (which should be able to hold
+  // get_device_graph_sz_bytes() first + second bytes, and pinned for the device to host copies to
+  // run asynchronously); h_storage is valid only after the handle's stream is synchronized:
+  //
+  template <typename graph_t>
+  static void serialize_to_host(raft::handle_t const& handle,
+                                graph_t const& graph,
+                                byte_t* h_storage,
+                                graph_meta_t<graph_t>& gmeta);
+
+  // graph serialization to a file descriptor (blocks until all the bytes are written),
+  // without staging the serialized graph in device memory; writes the same byte sequence as
+  // serialize() above, in chunk_sz_bytes chunks through two pinned host buffers (so the device to
+  // host copy of one chunk overlaps the write of the previous one):
+  //
+  template <typename graph_t>
+  static void serialize_to_fd(raft::handle_t const& handle,
+                              graph_t const& graph,
+                              int fd,
+                              graph_meta_t<graph_t>& gmeta,
+                              size_t chunk_sz_bytes = size_t{1} << 26);
+
   // graph unserialization,
   // with device storage and host metadata:
   // (associated with target; e.g., num_vertices, etc.)
@@ -166,9 +295,27 @@ class serializer_t {
         host_ser_sz);  // FIXME: remove when host_bcast() becomes available for host vectors
 
     } else {
-      CUGRAPH_FAIL("Unsupported graph type for un/serialization.");
+      size_t device_ser_sz{0};
+      for (size_t i = 0; i < graph_meta.offsets_sizes_.size(); ++i) {
+        auto num_edges = graph_meta.edge_counts_[i];
+        device_ser_sz += graph_meta.offsets_sizes_[i] * sizeof(edge_t);
+        device_ser_sz +=
+          num_edges * (graph_meta.use_compressed_indices_ ? sizeof(uint32_t) : sizeof(vertex_t));
+        device_ser_sz += graph_meta.is_weighted_ ? num_edges * sizeof(weight_t) : size_t{0};
+        device_ser_sz += graph_meta.dcs_nzd_vertex_counts_
+                           ? (*(graph_meta.dcs_nzd_vertex_counts_))[i] * sizeof(vertex_t)
+                           : size_t{0};
+      }
+      device_ser_sz += graph_meta.num_local_sorted_unique_edge_rows_
+                         ? *(graph_meta.num_local_sorted_unique_edge_rows_) * sizeof(vertex_t)
+                         : size_t{0};
+      device_ser_sz += graph_meta.num_local_sorted_unique_edge_cols_
+                         ? *(graph_meta.num_local_sorted_unique_edge_cols_) * sizeof(vertex_t)
+                         : size_t{0};
 
-      return std::pair<size_t, size_t>{};
+      size_t host_ser_sz = graph_meta.get_device_sz_bytes();
+
+      return std::make_pair(device_ser_sz, host_ser_sz);
     }
   }
 
@@ -179,15 +326,143 @@ class serializer_t {
     return get_device_graph_sz_bytes(gmeta);
   }
 
+  /**
+   * @brief Write a single-GPU graph to a binary graph file.
+   *
+   * @tparam graph_t Type of the graph object (single-GPU only).
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator,
+   * and handles to various CUDA libraries) to run graph algorithms.
+   * @param graph Graph object to write.
+   * @param file_path Path to the output file (overwritten if exists).
+   */
+  template <typename graph_t>
+  static void write_graph_to_file(raft::handle_t const& handle,
+                                  graph_t const& graph,
+                                  std::string const& file_path);
+
+  /**
+   * @brief Read a single-GPU graph from a binary graph file written by write_graph_to_file().
+   *
+   * The file is memory-mapped and each array section is copied straight from the mapping into
+   * device memory (in bounded size blocks staged through pinned host memory), so no text parsing or
+   * graph (re-)construction is necessary.
+   *
+   * @tparam graph_t Type of the graph object (single-GPU only, vertex_t, edge_t, and weight_t
+   * should match the types used to write the file).
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator,
+   * and handles to various CUDA libraries) to run graph algorithms.
+   * @param file_path Path to the input file.
+   * @return graph_t Graph object read from the file.
+   */
+  template <typename graph_t>
+  static graph_t read_graph_from_file(raft::handle_t const& handle, std::string const& file_path);
+
+  /**
+   * @brief Broadcast a single-GPU graph from the root rank to every rank of handle.get_comms().
+   *
+   * The serialized graph (metadata followed by the device arrays in the serialize() order) is
+   * broadcast in chunks of at most @p chunk_sz_bytes bytes. The root sends straight from its own
+   * graph arrays and the other ranks receive straight into the arrays of the graph being
+   * constructed, so no rank stages the whole serialized graph in a separate device buffer.
+   *
+   * @tparam graph_t Type of the graph object (single-GPU only).
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator,
+   * and handles to various CUDA libraries) to run graph algorithms.
+   * @param graph_ptr Pointer to the graph to broadcast: not `nullptr` on the root, `nullptr`
+   * (ignored) on the other ranks.
+   * @param root Rank broadcasting the graph.
+   * @param chunk_sz_bytes Maximum number of bytes to broadcast at once.
+   * @return graph_t The broadcast graph (moved from @p graph_ptr on the root).
+   */
+  template <typename graph_t>
+  static graph_t broadcast(raft::handle_t const& handle,
+                           graph_t* graph_ptr,
+                           int root              = 0,
+                           size_t chunk_sz_bytes = size_t{1} << 26);
+
+  /**
+   * @brief Write an algorithm checkpoint (a serializer_t byte stream of the algorithm state) to a
+   * file.
+   *
+   * The file holds a checkpoint header (magic, version, @p algorithm_tag, @p sequence_number, and
+   * the payload size) followed by the payload. A file that is truncated (e.g. by a failure while
+   * writing) is rejected by read_checkpoint(), but write to a temporary file and rename it to
+   * replace an existing checkpoint, so a failure while writing does not lose the previous one.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator,
+   * and handles to various CUDA libraries) to run graph algorithms.
+   * @param file_path Path to the output file (overwritten if exists).
+   * @param algorithm_tag Tag identifying the algorithm (and the payload layout).
+   * @param sequence_number Progress (e.g. iteration or level count) of the checkpointed state.
+   * @param d_payload Pointer to the serialized algorithm state (in device memory).
+   * @param payload_sz_bytes Size (in bytes) of the serialized algorithm state.
+   */
+  static void write_checkpoint(raft::handle_t const& handle,
+                               std::string const& file_path,
+                               uint64_t algorithm_tag,
+                               uint64_t sequence_number,
+                               byte_t const* d_payload,
+                               size_t payload_sz_bytes);
+
+  /**
+   * @brief Read the sequence number of a checkpoint file written by write_checkpoint().
+   *
+   * Only the checkpoint header is read.
+   *
+   * @param file_path Path to the checkpoint file.
+   * @param algorithm_tag Tag identifying the algorithm (and the payload layout).
+   * @return std::optional<uint64_t> The sequence number, or std::nullopt if @p file_path does not
+   * exist or is not a complete checkpoint of @p algorithm_tag.
+   */
+  static std::optional<uint64_t> read_checkpoint_sequence_number(std::string const& file_path,
+                                                                 uint64_t algorithm_tag);
+
+  /**
+   * @brief Read a checkpoint file written by write_checkpoint().
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator,
+   * and handles to various CUDA libraries) to run graph algorithms.
+   * @param file_path Path to the checkpoint file.
+   * @param algorithm_tag Tag identifying the algorithm (and the payload layout).
+   * @return std::optional<std::tuple<uint64_t, rmm::device_uvector<byte_t>>> The sequence number
+   * and the payload (in device memory, to unserialize with serializer_t(handle, payload.data())),
+   * or std::nullopt if @p file_path does not exist or is not a complete checkpoint of
+   * @p algorithm_tag.
+   */
+  static std::optional<std::tuple<uint64_t, rmm::device_uvector<byte_t>>> read_checkpoint(
+    raft::handle_t const& handle, std::string const& file_path, uint64_t algorithm_tag);
+
   byte_t const* get_storage(void) const { return d_storage_.begin(); }
   byte_t* get_storage(void) { return d_storage_.begin(); }
 
  private:
+  // host vector serialization (via device orchestration):
+  //
+  template <typename value_t>
+  void serialize_host_vector(std::vector<value_t> const& vec);
+
+  // host vector unserialization (via device orchestration):
+  //
+  template <typename value_t>
+  std::vector<value_t> unserialize_host_vector(size_t size);
+
   // serialization of graph metadata, via device orchestration:
   //
   template <typename graph_t>
   void serialize(graph_meta_t<graph_t> const& graph_meta);
 
+  // graph metadata serialized into a dedicated device buffer:
+  //
+  template <typename graph_t>
+  static rmm::device_uvector<byte_t> serialize_graph_meta(raft::handle_t const& handle,
+                                                          graph_meta_t<graph_t> const& graph_meta);
+
+  // graph device arrays (pointer, size in bytes) in the serialization order:
+  //
+  template <typename graph_t>
+  static std::vector<std::tuple<byte_t const*, size_t>> get_device_graph_segments(
+    graph_t const& graph);
+
   // unserialization of graph metadata, via device orchestration:
   //
   template <typename graph_t>
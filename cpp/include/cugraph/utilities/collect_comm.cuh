@@ -27,14 +27,101 @@
 #include <rmm/mr/device/polymorphic_allocator.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace cugraph {
 
+/**
+ * @brief Strategies to look up the values for the keys in collect_values_for_keys and
+ * collect_values_for_unique_keys.
+ *
+ * hash builds cuco::static_map objects for the map (key, value) pairs and for the collected unique
+ * (key, value) pairs. binary_search searches the sorted map keys (sorting a copy of the map pairs
+ * only if the map keys are not already sorted) and the sorted collected unique keys; this avoids
+ * building a hash map over the whole map when only a few keys are collected. automatic picks
+ * binary_search if the map keys are already sorted and the number of keys to collect is smaller
+ * than the number of map keys, and hash otherwise.
+ */
+enum class collect_values_policy_t { automatic, hash, binary_search };
+
+namespace detail {
+
+template <typename vertex_t, typename value_t, typename VertexIterator, typename ValueIterator>
+struct binary_search_find_t {
+  VertexIterator sorted_key_first{};
+  VertexIterator sorted_key_last{};
+  ValueIterator value_first{};
+
+  __device__ value_t operator()(vertex_t key) const
+  {
+    auto it = thrust::lower_bound(thrust::seq, sorted_key_first, sorted_key_last, key);
+    // the same value as cuco::static_map::find returns for a missing key
+    return ((it != sorted_key_last) && (*it == key))
+             ? static_cast<value_t>(*(value_first + thrust::distance(sorted_key_first, it)))
+             : static_cast<value_t>(invalid_vertex_id<vertex_t>::value);
+  }
+};
+
+template <typename VertexIterator0,
+          typename ValueIterator,
+          typename VertexIterator1,
+          typename OutputIterator>
+void find_values_with_binary_search(VertexIterator0 sorted_map_key_first,
+                                    VertexIterator0 sorted_map_key_last,
+                                    ValueIterator map_value_first,
+                                    VertexIterator1 key_first,
+                                    VertexIterator1 key_last,
+                                    OutputIterator value_first,
+                                    rmm::cuda_stream_view stream_view)
+{
+  using vertex_t = typename std::iterator_traits<VertexIterator0>::value_type;
+  using value_t  = typename std::iterator_traits<OutputIterator>::value_type;
+
+  thrust::transform(
+    rmm::exec_policy(stream_view),
+    key_first,
+    key_last,
+    value_first,
+    binary_search_find_t<vertex_t, value_t, VertexIterator0, ValueIterator>{
+      sorted_map_key_first, sorted_map_key_last, map_value_first});
+}
+
+template <typename vertex_t,
+          typename value_t,
+          typename VertexIterator,
+          typename ValueIterator,
+          typename StreamAdapter>
+auto build_kv_map(VertexIterator key_first,
+                  ValueIterator value_first,
+                  size_t num_keys,
+                  StreamAdapter stream_adapter)
+{
+  double constexpr load_factor = 0.7;
+
+  auto kv_map_ptr = std::make_unique<
+    cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, StreamAdapter>>(
+    // cuco::static_map requires at least one empty slot
+    std::max(static_cast<size_t>(static_cast<double>(num_keys) / load_factor), num_keys + 1),
+    invalid_vertex_id<vertex_t>::value,
+    invalid_vertex_id<vertex_t>::value,
+    stream_adapter);
+  auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(key_first, value_first));
+  kv_map_ptr->insert(pair_first, pair_first + num_keys);
+
+  return kv_map_ptr;
+}
+
 // for key = [map_key_first, map_key_last), key_to_gpu_id_op(key) should be coincide with
 // comm.get_rank()
 template <typename VertexIterator0,
@@ -49,7 +136,9 @@ collect_values_for_keys(raft::comms::comms_t const& comm,
                         ValueIterator map_value_first,
                         VertexIterator1 collect_key_first,
                         VertexIterator1 collect_key_last,
+                        bool collect_keys_unique,
                         KeyToGPUIdOp key_to_gpu_id_op,
+                        collect_values_policy_t policy,
                         rmm::cuda_stream_view stream_view)
 {
   using vertex_t = typename std::iterator_traits<VertexIterator0>::value_type;
@@ -57,42 +146,60 @@ collect_values_for_keys(raft::comms::comms_t const& comm,
     std::is_same<typename std::iterator_traits<VertexIterator1>::value_type, vertex_t>::value);
   using value_t = typename std::iterator_traits<ValueIterator>::value_type;
 
-  double constexpr load_factor = 0.7;
+  auto const num_map_keys = static_cast<size_t>(thrust::distance(map_key_first, map_key_last));
+  auto const num_collect_keys =
+    static_cast<size_t>(thrust::distance(collect_key_first, collect_key_last));
 
-  // FIXME: we may compare the performance & memory footprint of this hash based approach vs binary
-  // search based approach (especially when thrust::distance(collect_key_first, collect_key_last) <<
-  // thrust::distance(map_key_first, map_key_last)
+  // 1. choose the strategy, and build a cuco::static_map object for the map k, v pairs (hash) or
+  // sort the map k, v pairs if not already sorted (binary search).
 
-  // 1. build a cuco::static_map object for the map k, v pairs.
+  auto map_keys_sorted =
+    (policy != collect_values_policy_t::hash) &&
+    thrust::is_sorted(rmm::exec_policy(stream_view), map_key_first, map_key_last);
+  auto use_binary_search =
+    (policy == collect_values_policy_t::binary_search) ||
+    ((policy == collect_values_policy_t::automatic) && map_keys_sorted &&
+     (num_collect_keys < num_map_keys));
 
   auto poly_alloc = rmm::mr::polymorphic_allocator<char>(rmm::mr::get_current_device_resource());
   auto stream_adapter = rmm::mr::make_stream_allocator_adaptor(poly_alloc, stream_view);
-  auto kv_map_ptr     = std::make_unique<
-    cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, decltype(stream_adapter)>>(
-    // cuco::static_map requires at least one empty slot
-    std::max(static_cast<size_t>(
-               static_cast<double>(thrust::distance(map_key_first, map_key_last)) / load_factor),
-             static_cast<size_t>(thrust::distance(map_key_first, map_key_last)) + 1),
-    invalid_vertex_id<vertex_t>::value,
-    invalid_vertex_id<vertex_t>::value,
-    stream_adapter);
-  {
-    auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(map_key_first, map_value_first));
-    kv_map_ptr->insert(pair_first, pair_first + thrust::distance(map_key_first, map_key_last));
+
+  std::unique_ptr<
+    cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, decltype(stream_adapter)>>
+    kv_map_ptr{};
+  rmm::device_uvector<vertex_t> sorted_map_keys(0, stream_view);
+  rmm::device_uvector<value_t> sorted_map_values(0, stream_view);
+  if (!use_binary_search) {
+    kv_map_ptr =
+      build_kv_map<vertex_t, value_t>(map_key_first, map_value_first, num_map_keys, stream_adapter);
+  } else if (!map_keys_sorted) {
+    sorted_map_keys.resize(num_map_keys, stream_view);
+    sorted_map_values.resize(num_map_keys, stream_view);
+    thrust::copy(
+      rmm::exec_policy(stream_view), map_key_first, map_key_last, sorted_map_keys.begin());
+    thrust::copy(rmm::exec_policy(stream_view),
+                 map_value_first,
+                 map_value_first + num_map_keys,
+                 sorted_map_values.begin());
+    thrust::sort_by_key(rmm::exec_policy(stream_view),
+                        sorted_map_keys.begin(),
+                        sorted_map_keys.end(),
+                        sorted_map_values.begin());
   }
 
   // 2. collect values for the unique keys in [collect_key_first, collect_key_last)
 
-  rmm::device_uvector<vertex_t> unique_keys(thrust::distance(collect_key_first, collect_key_last),
-                                            stream_view);
+  rmm::device_uvector<vertex_t> unique_keys(num_collect_keys, stream_view);
   thrust::copy(
     rmm::exec_policy(stream_view), collect_key_first, collect_key_last, unique_keys.begin());
-  thrust::sort(rmm::exec_policy(stream_view), unique_keys.begin(), unique_keys.end());
-  unique_keys.resize(
-    thrust::distance(
-      unique_keys.begin(),
-      thrust::unique(rmm::exec_policy(stream_view), unique_keys.begin(), unique_keys.end())),
-    stream_view);
+  if (!collect_keys_unique) {
+    thrust::sort(rmm::exec_policy(stream_view), unique_keys.begin(), unique_keys.end());
+    unique_keys.resize(
+      thrust::distance(
+        unique_keys.begin(),
+        thrust::unique(rmm::exec_policy(stream_view), unique_keys.begin(), unique_keys.end())),
+      stream_view);
+  }
 
   rmm::device_uvector<value_t> values_for_unique_keys(0, stream_view);
   {
@@ -107,10 +214,30 @@ collect_values_for_keys(raft::comms::comms_t const& comm,
 
     rmm::device_uvector<value_t> values_for_rx_unique_keys(rx_unique_keys.size(), stream_view);
 
-    stream_view.synchronize();  // cuco::static_map currently does not take stream
-
-    kv_map_ptr->find(
-      rx_unique_keys.begin(), rx_unique_keys.end(), values_for_rx_unique_keys.begin());
+    if (use_binary_search) {
+      if (map_keys_sorted) {
+        find_values_with_binary_search(map_key_first,
+                                       map_key_last,
+                                       map_value_first,
+                                       rx_unique_keys.begin(),
+                                       rx_unique_keys.end(),
+                                       values_for_rx_unique_keys.begin(),
+                                       stream_view);
+      } else {
+        find_values_with_binary_search(sorted_map_keys.begin(),
+                                       sorted_map_keys.end(),
+                                       sorted_map_values.begin(),
+                                       rx_unique_keys.begin(),
+                                       rx_unique_keys.end(),
+                                       values_for_rx_unique_keys.begin(),
+                                       stream_view);
+      }
+    } else {
+      stream_view.synchronize();  // cuco::static_map currently does not take stream
+
+      kv_map_ptr->find(
+        rx_unique_keys.begin(), rx_unique_keys.end(), values_for_rx_unique_keys.begin());
+    }
 
     rmm::device_uvector<value_t> rx_values_for_unique_keys(0, stream_view);
     std::tie(rx_values_for_unique_keys, std::ignore) =
@@ -119,36 +246,79 @@ collect_values_for_keys(raft::comms::comms_t const& comm,
     values_for_unique_keys = std::move(rx_values_for_unique_keys);
   }
 
-  // 3. re-build a cuco::static_map object for the k, v pairs in unique_keys,
-  // values_for_unique_keys.
-
-  stream_view.synchronize();  // cuco::static_map currently does not take stream
+  // 3. re-build a cuco::static_map object (hash) or sort (binary search) the k, v pairs in
+  // unique_keys, values_for_unique_keys.
+
+  sorted_map_keys.resize(0, stream_view);
+  sorted_map_values.resize(0, stream_view);
+  sorted_map_keys.shrink_to_fit(stream_view);
+  sorted_map_values.shrink_to_fit(stream_view);
+
+  if (use_binary_search) {
+    // the shuffle above grouped unique_keys by GPU
+    thrust::sort_by_key(rmm::exec_policy(stream_view),
+                        unique_keys.begin(),
+                        unique_keys.end(),
+                        values_for_unique_keys.begin());
+  } else {
+    stream_view.synchronize();  // cuco::static_map currently does not take stream
 
-  kv_map_ptr.reset();
+    kv_map_ptr.reset();
 
-  kv_map_ptr = std::make_unique<
-    cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, decltype(stream_adapter)>>(
-    // cuco::static_map requires at least one empty slot
-    std::max(static_cast<size_t>(static_cast<double>(unique_keys.size()) / load_factor),
-             unique_keys.size() + 1),
-    invalid_vertex_id<vertex_t>::value,
-    invalid_vertex_id<vertex_t>::value,
-    stream_adapter);
-  {
-    auto pair_first = thrust::make_zip_iterator(
-      thrust::make_tuple(unique_keys.begin(), values_for_unique_keys.begin()));
-    kv_map_ptr->insert(pair_first, pair_first + unique_keys.size());
+    kv_map_ptr = build_kv_map<vertex_t, value_t>(
+      unique_keys.begin(), values_for_unique_keys.begin(), unique_keys.size(), stream_adapter);
   }
 
   // 4. find values for [collect_key_first, collect_key_last)
 
-  auto value_buffer = allocate_dataframe_buffer<value_t>(
-    thrust::distance(collect_key_first, collect_key_last), stream_view);
-  kv_map_ptr->find(collect_key_first, collect_key_last, get_dataframe_buffer_begin(value_buffer));
+  auto value_buffer = allocate_dataframe_buffer<value_t>(num_collect_keys, stream_view);
+  if (use_binary_search) {
+    find_values_with_binary_search(unique_keys.begin(),
+                                   unique_keys.end(),
+                                   values_for_unique_keys.begin(),
+                                   collect_key_first,
+                                   collect_key_last,
+                                   get_dataframe_buffer_begin(value_buffer),
+                                   stream_view);
+  } else {
+    kv_map_ptr->find(collect_key_first, collect_key_last, get_dataframe_buffer_begin(value_buffer));
+  }
 
   return value_buffer;
 }
 
+}  // namespace detail
+
+// for key = [map_key_first, map_key_last), key_to_gpu_id_op(key) should be coincide with
+// comm.get_rank()
+template <typename VertexIterator0,
+          typename VertexIterator1,
+          typename ValueIterator,
+          typename KeyToGPUIdOp>
+decltype(allocate_dataframe_buffer<typename std::iterator_traits<ValueIterator>::value_type>(
+  0, cudaStream_t{nullptr}))
+collect_values_for_keys(raft::comms::comms_t const& comm,
+                        VertexIterator0 map_key_first,
+                        VertexIterator0 map_key_last,
+                        ValueIterator map_value_first,
+                        VertexIterator1 collect_key_first,
+                        VertexIterator1 collect_key_last,
+                        KeyToGPUIdOp key_to_gpu_id_op,
+                        rmm::cuda_stream_view stream_view,
+                        collect_values_policy_t policy = collect_values_policy_t::automatic)
+{
+  return detail::collect_values_for_keys(comm,
+                                         map_key_first,
+                                         map_key_last,
+                                         map_value_first,
+                                         collect_key_first,
+                                         collect_key_last,
+                                         false,
+                                         key_to_gpu_id_op,
+                                         policy,
+                                         stream_view);
+}
+
 // for key = [map_key_first, map_key_last), key_to_gpu_id_op(key) should be coincide with
 // comm.get_rank()
 template <typename VertexIterator0,
@@ -164,100 +334,19 @@ collect_values_for_unique_keys(raft::comms::comms_t const& comm,
                                VertexIterator1 collect_unique_key_first,
                                VertexIterator1 collect_unique_key_last,
                                KeyToGPUIdOp key_to_gpu_id_op,
-                               rmm::cuda_stream_view stream_view)
+                               rmm::cuda_stream_view stream_view,
+                               collect_values_policy_t policy = collect_values_policy_t::automatic)
 {
-  using vertex_t = typename std::iterator_traits<VertexIterator0>::value_type;
-  static_assert(
-    std::is_same<typename std::iterator_traits<VertexIterator1>::value_type, vertex_t>::value);
-  using value_t = typename std::iterator_traits<ValueIterator>::value_type;
-
-  double constexpr load_factor = 0.7;
-
-  // FIXME: we may compare the performance & memory footprint of this hash based approach vs binary
-  // search based approach (especially when thrust::distance(collect_unique_key_first,
-  // collect_unique_key_last) << thrust::distance(map_key_first, map_key_last)
-
-  // 1. build a cuco::static_map object for the map k, v pairs.
-
-  auto poly_alloc = rmm::mr::polymorphic_allocator<char>(rmm::mr::get_current_device_resource());
-  auto stream_adapter = rmm::mr::make_stream_allocator_adaptor(poly_alloc, stream_view);
-  auto kv_map_ptr     = std::make_unique<
-    cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, decltype(stream_adapter)>>(
-    // cuco::static_map requires at least one empty slot
-    std::max(static_cast<size_t>(
-               static_cast<double>(thrust::distance(map_key_first, map_key_last)) / load_factor),
-             static_cast<size_t>(thrust::distance(map_key_first, map_key_last)) + 1),
-    invalid_vertex_id<vertex_t>::value,
-    invalid_vertex_id<vertex_t>::value,
-    stream_adapter);
-  {
-    auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(map_key_first, map_value_first));
-    kv_map_ptr->insert(pair_first, pair_first + thrust::distance(map_key_first, map_key_last));
-  }
-
-  // 2. collect values for the unique keys in [collect_unique_key_first, collect_unique_key_last)
-
-  rmm::device_uvector<vertex_t> unique_keys(
-    thrust::distance(collect_unique_key_first, collect_unique_key_last), stream_view);
-  thrust::copy(rmm::exec_policy(stream_view),
-               collect_unique_key_first,
-               collect_unique_key_last,
-               unique_keys.begin());
-
-  rmm::device_uvector<value_t> values_for_unique_keys(0, stream_view);
-  {
-    rmm::device_uvector<vertex_t> rx_unique_keys(0, stream_view);
-    std::vector<size_t> rx_value_counts{};
-    std::tie(rx_unique_keys, rx_value_counts) = groupby_gpuid_and_shuffle_values(
-      comm,
-      unique_keys.begin(),
-      unique_keys.end(),
-      [key_to_gpu_id_op] __device__(auto val) { return key_to_gpu_id_op(val); },
-      stream_view);
-
-    rmm::device_uvector<value_t> values_for_rx_unique_keys(rx_unique_keys.size(), stream_view);
-
-    stream_view.synchronize();  // cuco::static_map currently does not take stream
-
-    kv_map_ptr->find(
-      rx_unique_keys.begin(), rx_unique_keys.end(), values_for_rx_unique_keys.begin());
-
-    rmm::device_uvector<value_t> rx_values_for_unique_keys(0, stream_view);
-    std::tie(rx_values_for_unique_keys, std::ignore) =
-      shuffle_values(comm, values_for_rx_unique_keys.begin(), rx_value_counts, stream_view);
-
-    values_for_unique_keys = std::move(rx_values_for_unique_keys);
-  }
-
-  // 3. re-build a cuco::static_map object for the k, v pairs in unique_keys,
-  // values_for_unique_keys.
-
-  stream_view.synchronize();  // cuco::static_map currently does not take stream
-
-  kv_map_ptr.reset();
-
-  kv_map_ptr = std::make_unique<
-    cuco::static_map<vertex_t, value_t, cuda::thread_scope_device, decltype(stream_adapter)>>(
-    // cuco::static_map requires at least one empty slot
-    std::max(static_cast<size_t>(static_cast<double>(unique_keys.size()) / load_factor),
-             unique_keys.size() + 1),
-    invalid_vertex_id<vertex_t>::value,
-    invalid_vertex_id<vertex_t>::value,
-    stream_adapter);
-  {
-    auto pair_first = thrust::make_zip_iterator(
-      thrust::make_tuple(unique_keys.begin(), values_for_unique_keys.begin()));
-    kv_map_ptr->insert(pair_first, pair_first + unique_keys.size());
-  }
-
-  // 4. find values for [collect_unique_key_first, collect_unique_key_last)
-
-  auto value_buffer = allocate_dataframe_buffer<value_t>(
-    thrust::distance(collect_unique_key_first, collect_unique_key_last), stream_view);
-  kv_map_ptr->find(
-    collect_unique_key_first, collect_unique_key_last, get_dataframe_buffer_begin(value_buffer));
-
-  return value_buffer;
+  return detail::collect_values_for_keys(comm,
+                                         map_key_first,
+                                         map_key_last,
+                                         map_value_first,
+                                         collect_unique_key_first,
+                                         collect_unique_key_last,
+                                         true,
+                                         key_to_gpu_id_op,
+                                         policy,
+                                         stream_view);
 }
 
 template <typename vertex_t, typename ValueIterator>
@@ -24,6 +24,10 @@
 
 #include <rmm/device_uvector.hpp>
 
+#include <map>
+#include <memory>
+#include <typeindex>
+
 namespace cugraph {
 namespace cython {
 
@@ -78,12 +82,15 @@ struct graph_container_t {
   graph_container_t() : graph_ptr_union{nullptr}, graph_type{graphTypeEnum::null} {}
   ~graph_container_t() {}
 
-  // The expected usage of a graph_container_t is for it to be created as part
-  // of a cython wrapper simply for passing a templated instantiation of a
-  // particular graph class from one call to another, and not to exist outside
-  // of the individual wrapper function (deleted when the instance goes out of
-  // scope once the wrapper function returns). Therefore, copys and assignments
-  // to an instance are not supported and these methods are deleted.
+  // A graph_container_t is created as part of a cython wrapper for passing a
+  // templated instantiation of a particular graph class from one call to
+  // another. If the container has a persistent graph handle (see
+  // set_graph_container_handle), the graph_t instances built from the
+  // primitive data are cached in the container (one per template
+  // instantiation), so a container kept alive (e.g. held by a Python object)
+  // across several wrapper calls builds each graph_t only once. Copys and
+  // assignments to an instance are not supported and these methods are
+  // deleted.
   graph_container_t(const graph_container_t&) = delete;
   graph_container_t& operator=(const graph_container_t&) = delete;
 
@@ -113,6 +120,26 @@ struct graph_container_t {
   int row_comm_rank;
   int col_comm_rank;
   graph_properties_t graph_props;
+
+  // handle the cached graph_t instances are built with (a graph_t keeps a pointer to the handle it
+  // was built with), owned by the container so it outlives the cached graph_t instances; graph_t
+  // instances are built for each wrapper call (with the wrapper's handle) and not cached if unset
+  std::shared_ptr<raft::handle_t const> graph_handle{};
+
+  // version of the primitive data set by the caller, bump it whenever the primitive data change
+  // (buffers reassigned, or updated in place) to rebuild the cached graph_t instances (buffer
+  // addresses are not compared, a pooled allocator may hand a freed buffer's address to new data);
+  // populate_graph_container releases the cached graph_t instances
+  size_t data_version{0};
+
+  struct cached_graph_t {
+    std::shared_ptr<void> graph{};
+    size_t data_version{0};  // data_version of the primitive data the graph_t was built from
+  };
+
+  // graph_t instances built from the primitive data above, keyed by the graph_t type; the
+  // shared_ptr keeps a graph_t alive for a running wrapper call even if the cache is released
+  mutable std::map<std::type_index, cached_graph_t> graph_cache{};
 };
 
 /**
@@ -436,6 +463,28 @@ void populate_graph_container(graph_container_t& graph_container,
                               bool transposed,
                               bool multi_gpu);
 
+// Releases the graph_t instances cached in a graph_container_t by earlier
+// wrapper calls (e.g. to free the device memory while keeping the container).
+//
+// graph_container_t& graph_container
+//   Reference to the graph_container_t instance to release the cached graph_t
+//   instances of.
+void release_graph_container_cache(graph_container_t& graph_container);
+
+// Sets the persistent handle the graph_t instances cached in a
+// graph_container_t are built with (and releases the graph_t instances
+// cached so far). The handle should be on the same device, and have the same
+// communicators in multi-GPU, as the handles passed to the wrapper calls; a
+// nullptr handle disables caching.
+//
+// graph_container_t& graph_container
+//   Reference to the graph_container_t instance to set the handle of.
+//
+// std::shared_ptr<raft::handle_t const> handle
+//   The persistent handle, kept alive by the container.
+void set_graph_container_handle(graph_container_t& graph_container,
+                                std::shared_ptr<raft::handle_t const> handle);
+
 // FIXME: comment this function
 // FIXME: Should local_* values be void* as well?
 void populate_graph_container_legacy(graph_container_t& graph_container,
@@ -20,6 +20,7 @@
 #include <raft/handle.hpp>
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/tuple.h>
@@ -33,10 +34,11 @@ namespace detail {
 template <typename TupleType, size_t... Is>
 auto allocate_dataframe_buffer_tuple_impl(std::index_sequence<Is...>,
                                           size_t buffer_size,
-                                          rmm::cuda_stream_view stream_view)
+                                          rmm::cuda_stream_view stream_view,
+                                          rmm::mr::device_memory_resource* mr)
 {
   return std::make_tuple(rmm::device_uvector<typename thrust::tuple_element<Is, TupleType>::type>(
-    buffer_size, stream_view)...);
+    buffer_size, stream_view, mr)...);
 }
 
 template <typename TupleType, std::size_t... I>
@@ -92,17 +94,23 @@ template <typename DataframeType>
 using dataframe_element_t = typename dataframe_element<DataframeType>::type;
 
 template <typename T, typename std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
-auto allocate_dataframe_buffer(size_t buffer_size, rmm::cuda_stream_view stream_view)
+auto allocate_dataframe_buffer(
+  size_t buffer_size,
+  rmm::cuda_stream_view stream_view,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return rmm::device_uvector<T>(buffer_size, stream_view);
+  return rmm::device_uvector<T>(buffer_size, stream_view, mr);
 }
 
 template <typename T, typename std::enable_if_t<is_thrust_tuple_of_arithmetic<T>::value>* = nullptr>
-auto allocate_dataframe_buffer(size_t buffer_size, rmm::cuda_stream_view stream_view)
+auto allocate_dataframe_buffer(
+  size_t buffer_size,
+  rmm::cuda_stream_view stream_view,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   size_t constexpr tuple_size = thrust::tuple_size<T>::value;
   return detail::allocate_dataframe_buffer_tuple_impl<T>(
-    std::make_index_sequence<tuple_size>(), buffer_size, stream_view);
+    std::make_index_sequence<tuple_size>(), buffer_size, stream_view, mr);
 }
 
 template <typename Type>
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cugraph/utilities/profiler.hpp>
 #include <cugraph/utilities/thrust_tuple_utils.cuh>
 
 #include <raft/handle.hpp>
@@ -25,6 +26,7 @@
 #include <thrust/device_ptr.h>
 #include <thrust/iterator/detail/normal_iterator.h>
 
+#include <numeric>
 #include <type_traits>
 
 namespace cugraph {
@@ -72,6 +74,7 @@ std::enable_if_t<std::is_arithmetic<OutputValueType>::value, void> device_isend_
 {
   static_assert(
     std::is_same<typename std::iterator_traits<InputIterator>::value_type, OutputValueType>::value);
+  profiler_add_counter("comm_bytes_sent", count * sizeof(OutputValueType));
   comm.isend(iter_to_raw_ptr(input_first), count, dst, tag, request);
 }
 
@@ -196,6 +199,7 @@ device_sendrecv_impl(raft::comms::comms_t const& comm,
   using value_type = typename std::iterator_traits<InputIterator>::value_type;
   static_assert(
     std::is_same<typename std::iterator_traits<OutputIterator>::value_type, value_type>::value);
+  profiler_add_counter("comm_bytes_sent", tx_count * sizeof(value_type));
   comm.device_sendrecv(iter_to_raw_ptr(input_first),
                        tx_count,
                        dst,
@@ -282,6 +286,9 @@ device_multicast_sendrecv_impl(raft::comms::comms_t const& comm,
   using value_type = typename std::iterator_traits<InputIterator>::value_type;
   static_assert(
     std::is_same<typename std::iterator_traits<OutputIterator>::value_type, value_type>::value);
+  profiler_add_counter(
+    "comm_bytes_sent",
+    std::accumulate(tx_counts.begin(), tx_counts.end(), size_t{0}) * sizeof(value_type));
   comm.device_multicast_sendrecv(iter_to_raw_ptr(input_first),
                                  tx_counts,
                                  tx_offsets,
@@ -376,6 +383,11 @@ device_bcast_impl(raft::comms::comms_t const& comm,
 {
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
+  if (comm.get_rank() == root) {
+    profiler_add_counter(
+      "comm_bytes_sent",
+      count * sizeof(typename std::iterator_traits<InputIterator>::value_type));
+  }
   comm.bcast(
     iter_to_raw_ptr(input_first), iter_to_raw_ptr(output_first), count, root, stream_view.value());
 }
@@ -437,6 +449,8 @@ device_allreduce_impl(raft::comms::comms_t const& comm,
 {
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
+  profiler_add_counter("comm_bytes_sent",
+                       count * sizeof(typename std::iterator_traits<InputIterator>::value_type));
   comm.allreduce(
     iter_to_raw_ptr(input_first), iter_to_raw_ptr(output_first), count, op, stream_view.value());
 }
@@ -500,6 +514,8 @@ device_reduce_impl(raft::comms::comms_t const& comm,
 {
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
+  profiler_add_counter("comm_bytes_sent",
+                       count * sizeof(typename std::iterator_traits<InputIterator>::value_type));
   comm.reduce(iter_to_raw_ptr(input_first),
               iter_to_raw_ptr(output_first),
               count,
@@ -568,6 +584,8 @@ device_allgatherv_impl(raft::comms::comms_t const& comm,
 {
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
+  using value_type = typename std::iterator_traits<InputIterator>::value_type;
+  profiler_add_counter("comm_bytes_sent", recvcounts[comm.get_rank()] * sizeof(value_type));
   comm.allgatherv(iter_to_raw_ptr(input_first),
                   iter_to_raw_ptr(output_first),
                   recvcounts.data(),
@@ -636,6 +654,8 @@ device_gatherv_impl(raft::comms::comms_t const& comm,
 {
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
+  profiler_add_counter("comm_bytes_sent",
+                       sendcount * sizeof(typename std::iterator_traits<InputIterator>::value_type));
   comm.gatherv(iter_to_raw_ptr(input_first),
                iter_to_raw_ptr(output_first),
                sendcount,
@@ -696,6 +716,8 @@ device_isend(raft::comms::comms_t const& comm,
              int base_tag /* actual tag = base tag */,
              raft::comms::request_t* requests)
 {
+  nvtx_range_t range("device_isend");
+
   detail::device_isend_impl<InputIterator,
                             typename std::iterator_traits<OutputIterator>::value_type>(
     comm, input_first, count, dst, base_tag, requests);
@@ -713,6 +735,8 @@ device_isend(raft::comms::comms_t const& comm,
              int base_tag /* actual tag = base_tag + tuple index */,
              raft::comms::request_t* requests)
 {
+  nvtx_range_t range("device_isend");
+
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -736,6 +760,8 @@ device_irecv(raft::comms::comms_t const& comm,
              int base_tag /* actual tag = base tag */,
              raft::comms::request_t* requests)
 {
+  nvtx_range_t range("device_irecv");
+
   detail::device_irecv_impl<typename std::iterator_traits<InputIterator>::value_type,
                             OutputIterator>(comm, output_first, count, src, base_tag, requests);
 }
@@ -752,6 +778,8 @@ device_irecv(raft::comms::comms_t const& comm,
              int base_tag /* actual tag = base_tag + tuple index */,
              raft::comms::request_t* requests)
 {
+  nvtx_range_t range("device_irecv");
+
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -777,6 +805,8 @@ device_sendrecv(raft::comms::comms_t const& comm,
                 int src,
                 rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_sendrecv", stream_view);
+
   detail::device_sendrecv_impl<InputIterator, OutputIterator>(
     comm, input_first, tx_count, dst, output_first, rx_count, src, stream_view);
 }
@@ -795,6 +825,8 @@ device_sendrecv(raft::comms::comms_t const& comm,
                 int src,
                 rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_sendrecv", stream_view);
+
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -827,6 +859,8 @@ device_multicast_sendrecv(raft::comms::comms_t const& comm,
                           std::vector<int> const& rx_src_ranks,
                           rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_multicast_sendrecv", stream_view);
+
   detail::device_multicast_sendrecv_impl<InputIterator, OutputIterator>(comm,
                                                                         input_first,
                                                                         tx_counts,
@@ -855,6 +889,8 @@ device_multicast_sendrecv(raft::comms::comms_t const& comm,
                           std::vector<int> const& rx_src_ranks,
                           rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_multicast_sendrecv", stream_view);
+
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -892,6 +928,8 @@ device_bcast(raft::comms::comms_t const& comm,
              int root,
              rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_bcast", stream_view);
+
   detail::device_bcast_impl(comm, input_first, output_first, count, root, stream_view);
 }
 
@@ -907,6 +945,8 @@ device_bcast(raft::comms::comms_t const& comm,
              int root,
              rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_bcast", stream_view);
+
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -930,6 +970,8 @@ device_allreduce(raft::comms::comms_t const& comm,
                  raft::comms::op_t op,
                  rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_allreduce", stream_view);
+
   detail::device_allreduce_impl(comm, input_first, output_first, count, op, stream_view);
 }
 
@@ -945,6 +987,8 @@ device_allreduce(raft::comms::comms_t const& comm,
                  raft::comms::op_t op,
                  rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_allreduce", stream_view);
+
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -971,6 +1015,8 @@ device_reduce(raft::comms::comms_t const& comm,
               int root,
               rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_reduce", stream_view);
+
   detail::device_reduce_impl(comm, input_first, output_first, count, op, root, stream_view);
 }
 
@@ -987,6 +1033,8 @@ device_reduce(raft::comms::comms_t const& comm,
               int root,
               rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_reduce", stream_view);
+
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -1012,6 +1060,8 @@ device_allgatherv(raft::comms::comms_t const& comm,
                   std::vector<size_t> const& displacements,
                   rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_allgatherv", stream_view);
+
   detail::device_allgatherv_impl(
     comm, input_first, output_first, recvcounts, displacements, stream_view);
 }
@@ -1028,6 +1078,8 @@ device_allgatherv(raft::comms::comms_t const& comm,
                   std::vector<size_t> const& displacements,
                   rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_allgatherv", stream_view);
+
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -1055,6 +1107,8 @@ device_gatherv(raft::comms::comms_t const& comm,
                int root,
                rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_gatherv", stream_view);
+
   detail::device_gatherv_impl(
     comm, input_first, output_first, sendcount, recvcounts, displacements, root, stream_view);
 }
@@ -1073,6 +1127,8 @@ device_gatherv(raft::comms::comms_t const& comm,
                int root,
                rmm::cuda_stream_view stream_view)
 {
+  scoped_phase_t phase("device_gatherv", stream_view);
+
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <tuple>
 #include <type_traits>
 
 namespace cugraph {
@@ -56,4 +58,61 @@ struct is_candidate {
     is_vertex_edge_combo<vertex_t, edge_t>::value && is_one_of<weight_t, float, double>::value;
 };
 
+// meta-function that constrains
+// the candidates explicitly instantiated in the library,
+// combinations can be excluded at build time (see CUGRAPH_INSTANTIATE_TYPES in CMakeLists.txt):
+//
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct is_instantiated {
+  static constexpr bool value = is_candidate<vertex_t, edge_t, weight_t>::value
+#ifdef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+                                && !std::is_same<std::tuple<vertex_t, edge_t, weight_t>,
+                                                 std::tuple<int32_t, int32_t, float>>::value
+#endif
+#ifdef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+                                && !std::is_same<std::tuple<vertex_t, edge_t, weight_t>,
+                                                 std::tuple<int32_t, int32_t, double>>::value
+#endif
+#ifdef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+                                && !std::is_same<std::tuple<vertex_t, edge_t, weight_t>,
+                                                 std::tuple<int32_t, int64_t, float>>::value
+#endif
+#ifdef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+                                && !std::is_same<std::tuple<vertex_t, edge_t, weight_t>,
+                                                 std::tuple<int32_t, int64_t, double>>::value
+#endif
+#ifdef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+                                && !std::is_same<std::tuple<vertex_t, edge_t, weight_t>,
+                                                 std::tuple<int64_t, int64_t, float>>::value
+#endif
+#ifdef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+                                && !std::is_same<std::tuple<vertex_t, edge_t, weight_t>,
+                                                 std::tuple<int64_t, int64_t, double>>::value
+#endif
+    ;
+};
+
+// meta-function that constrains
+// the candidates instantiated by the runtime type dispatchers,
+// combinations can be excluded at build time (see the DISPATCH_* CMake options):
+//
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+struct is_dispatch_candidate {
+  static constexpr bool value = is_instantiated<vertex_t, edge_t, weight_t>::value
+#ifdef CUGRAPH_DISPATCH_EXCLUDE_INT64_VERTEX
+                                && !std::is_same<vertex_t, int64_t>::value
+#endif
+#ifdef CUGRAPH_DISPATCH_EXCLUDE_INT32_VERTEX_INT64_EDGE
+                                && !(std::is_same<vertex_t, int32_t>::value &&
+                                     std::is_same<edge_t, int64_t>::value)
+#endif
+#ifdef CUGRAPH_DISPATCH_EXCLUDE_FLOAT64_WEIGHT
+                                && !std::is_same<weight_t, double>::value
+#endif
+#ifdef CUGRAPH_DISPATCH_EXCLUDE_MULTI_GPU
+                                && !multi_gpu
+#endif
+    ;
+};
+
 }  // namespace cugraph
@@ -21,8 +21,11 @@
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <algorithm>
 #include <numeric>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cugraph {
 
@@ -118,6 +121,33 @@ struct host_reduce_tuple_scalar_element_impl<TupleType, I, I> {
   }
 };
 
+template <typename TupleType, std::size_t... Is>
+constexpr bool is_thrust_tuple_of_identical_types(std::index_sequence<Is...>)
+{
+  using first_element_t = typename thrust::tuple_element<0, TupleType>::type;
+  return (... &&
+          std::is_same_v<first_element_t, typename thrust::tuple_element<Is, TupleType>::type>);
+}
+
+// the tuple elements of the same type are all-reduced with a single collective call
+template <typename TupleType, std::size_t... Is>
+TupleType host_scalar_allreduce_identical_elements_impl(raft::comms::comms_t const& comm,
+                                                        TupleType input,
+                                                        raft::comms::op_t op,
+                                                        cudaStream_t stream,
+                                                        std::index_sequence<Is...>)
+{
+  using element_t = typename thrust::tuple_element<0, TupleType>::type;
+  std::vector<element_t> h_elements{thrust::get<Is>(input)...};
+  rmm::device_uvector<element_t> d_elements(h_elements.size(), stream);
+  raft::update_device(d_elements.data(), h_elements.data(), h_elements.size(), stream);
+  comm.allreduce(d_elements.data(), d_elements.data(), d_elements.size(), op, stream);
+  raft::update_host(h_elements.data(), d_elements.data(), h_elements.size(), stream);
+  auto status = comm.sync_stream(stream);
+  CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+  return TupleType(h_elements[Is]...);
+}
+
 }  // namespace detail
 
 template <typename T>
@@ -139,6 +169,12 @@ std::enable_if_t<cugraph::is_thrust_tuple_of_arithmetic<T>::value, T> host_scala
   raft::comms::comms_t const& comm, T input, raft::comms::op_t op, cudaStream_t stream)
 {
   size_t constexpr tuple_size = thrust::tuple_size<T>::value;
+  if constexpr (detail::is_thrust_tuple_of_identical_types<T>(
+                  std::make_index_sequence<tuple_size>())) {
+    return detail::host_scalar_allreduce_identical_elements_impl(
+      comm, input, op, stream, std::make_index_sequence<tuple_size>());
+  }
+
   std::vector<int64_t> h_tuple_scalar_elements(tuple_size);
   rmm::device_uvector<int64_t> d_tuple_scalar_elements(tuple_size, stream);
   T ret{};
@@ -391,4 +427,131 @@ host_scalar_gather(raft::comms::comms_t const& comm, T input, int root, cudaStre
   return ret;
 }
 
+// inputs is valid only in root (inputs[i] is the value returned in rank i)
+template <typename T>
+std::enable_if_t<std::is_arithmetic<T>::value, T> host_scalar_scatter(
+  raft::comms::comms_t const& comm, T const* inputs, int root, cudaStream_t stream)
+{
+  rmm::device_uvector<T> d_inputs(comm.get_size(), stream);
+  if (comm.get_rank() == root) {
+    raft::update_device(d_inputs.data(), inputs, comm.get_size(), stream);
+  }
+  comm.bcast(d_inputs.data(), d_inputs.size(), root, stream);
+  T h_output{};
+  raft::update_host(&h_output, d_inputs.data() + comm.get_rank(), 1, stream);
+  auto status = comm.sync_stream(stream);
+  CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+  return h_output;
+}
+
+// inputs.size() should be identical in every rank, returns the concatenation of the inputs (in
+// the rank order)
+template <typename T>
+std::enable_if_t<std::is_arithmetic<T>::value, std::vector<T>> host_allgather(
+  raft::comms::comms_t const& comm, std::vector<T> const& inputs, cudaStream_t stream)
+{
+  rmm::device_uvector<T> d_outputs(comm.get_size() * inputs.size(), stream);
+  raft::update_device(
+    d_outputs.data() + comm.get_rank() * inputs.size(), inputs.data(), inputs.size(), stream);
+  comm.allgather(
+    d_outputs.data() + comm.get_rank() * inputs.size(), d_outputs.data(), inputs.size(), stream);
+  std::vector<T> h_outputs(d_outputs.size());
+  raft::update_host(h_outputs.data(), d_outputs.data(), d_outputs.size(), stream);
+  auto status = comm.sync_stream(stream);
+  CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+  return h_outputs;
+}
+
+// count should be identical in every rank, values are overwritten with the root's values in the
+// other ranks
+template <typename T>
+std::enable_if_t<std::is_arithmetic<T>::value, void> host_bcast(
+  raft::comms::comms_t const& comm, T* values, size_t count, int root, cudaStream_t stream)
+{
+  rmm::device_uvector<T> d_values(count, stream);
+  if (comm.get_rank() == root) { raft::update_device(d_values.data(), values, count, stream); }
+  comm.bcast(d_values.data(), count, root, stream);
+  if (comm.get_rank() != root) { raft::update_host(values, d_values.data(), count, stream); }
+  auto status = comm.sync_stream(stream);
+  CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+}
+
+// values.size() should be identical in every rank, values are element-wise all-reduced with a
+// single collective call
+template <typename T>
+std::enable_if_t<std::is_arithmetic<T>::value, void> host_allreduce(
+  raft::comms::comms_t const& comm,
+  std::vector<T>& values,
+  raft::comms::op_t op,
+  cudaStream_t stream)
+{
+  rmm::device_uvector<T> d_values(values.size(), stream);
+  raft::update_device(d_values.data(), values.data(), values.size(), stream);
+  comm.allreduce(d_values.data(), d_values.data(), d_values.size(), op, stream);
+  raft::update_host(values.data(), d_values.data(), d_values.size(), stream);
+  auto status = comm.sync_stream(stream);
+  CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+}
+
+/**
+ * @brief Collects scalar reduction results to be all-reduced across the GPUs and resolves them
+ * with a single collective call.
+ *
+ * Multi-GPU algorithms often compute several scalar reductions per iteration (e.g. a residual and
+ * a norm), and at scale the latency of one collective call per scalar dominates. The deferred
+ * overloads of reduce_v, transform_reduce_v, count_if_v, and transform_reduce_e add the local
+ * (this GPU's) result to this object and return a slot; resolve() all-reduces every pending slot
+ * at once and get() returns the global result of a slot. Every GPU should add the slots in the
+ * same order. In single-GPU, resolve() is a no-op.
+ *
+ * @tparam T Type of the scalars (arithmetic).
+ * @tparam multi_gpu Flag indicating whether the results are reduced across the GPUs.
+ */
+template <typename T, bool multi_gpu>
+class deferred_host_scalar_allreduce_t {
+ public:
+  static_assert(std::is_arithmetic<T>::value);
+
+  deferred_host_scalar_allreduce_t(raft::comms::op_t op = raft::comms::op_t::SUM) : op_(op) {}
+
+  raft::comms::op_t get_op() const { return op_; }
+
+  // returns the slot of the local result
+  size_t add(T local_value)
+  {
+    values_.push_back(local_value);
+    return values_.size() - 1;
+  }
+
+  void resolve(raft::handle_t const& handle)
+  {
+    if constexpr (multi_gpu) {
+      if (num_resolved_ < values_.size()) {
+        std::vector<T> pending(values_.begin() + num_resolved_, values_.end());
+        host_allreduce(handle.get_comms(), pending, op_, handle.get_stream());
+        std::copy(pending.begin(), pending.end(), values_.begin() + num_resolved_);
+      }
+    }
+    num_resolved_ = values_.size();
+  }
+
+  T get(size_t slot) const
+  {
+    CUGRAPH_EXPECTS(slot < num_resolved_, "Invalid input argument: slot is not resolved.");
+    return values_[slot];
+  }
+
+  // drops every slot (to re-use this object in the next iteration)
+  void clear()
+  {
+    values_.clear();
+    num_resolved_ = 0;
+  }
+
+ private:
+  raft::comms::op_t op_{raft::comms::op_t::SUM};
+  std::vector<T> values_{};
+  size_t num_resolved_{0};
+};
+
 }  // namespace cugraph
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/handle.hpp>
+
+#include <nccl.h>
+
+#include <exception>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @brief Single-process multi-GPU execution on the GPUs of this node.
+ *
+ * This class creates one raft::handle_t per GPU with NCCL communicators initialized in this process
+ * (no MPI or Dask) and the 2D partitioning sub-communicators (see
+ * partition_2d::subcomm_factory_t), and runs functions on every GPU from one host thread per GPU.
+ * The handles can be used with the multi-GPU (multi_gpu = true) graph objects and algorithms.
+ *
+ * The function passed to run() is executed on every GPU concurrently and should issue the same
+ * sequence of collective operations on every GPU (as the processes of an MPI program would). An
+ * exception thrown on a subset of the GPUs while the other GPUs are in a collective operation
+ * leaves the other GPUs blocked.
+ */
+class local_multi_gpu_t {
+ public:
+  /**
+   * @brief Construct a local_multi_gpu_t object.
+   *
+   * @param devices IDs of the GPUs to use (every visible GPU if std::nullopt), the position of a
+   * GPU in @p devices is its rank.
+   * @param row_comm_size Size of the row sub-communicators (the largest divisor of the number of
+   * GPUs not larger than its square root if std::nullopt).
+   */
+  local_multi_gpu_t(std::optional<std::vector<int>> devices = std::nullopt,
+                    std::optional<int> row_comm_size        = std::nullopt);
+
+  local_multi_gpu_t(local_multi_gpu_t const&) = delete;
+  local_multi_gpu_t& operator=(local_multi_gpu_t const&) = delete;
+
+  ~local_multi_gpu_t();
+
+  int get_size() const { return static_cast<int>(devices_.size()); }
+
+  int get_device(int rank) const { return devices_[rank]; }
+
+  raft::handle_t& get_handle(int rank) { return *(handles_[rank]); }
+
+  /**
+   * @brief Run @p f on every GPU concurrently, one host thread per GPU.
+   *
+   * @p f is called as f(handle) (or f(handle, rank) if @p f takes two arguments) with the current
+   * device set to the GPU of the handle. Returns after every call returns; the first exception
+   * (in the rank order) thrown by @p f is re-thrown.
+   */
+  template <typename F>
+  void run(F f)
+  {
+    std::vector<std::exception_ptr> exceptions(devices_.size(), nullptr);
+    std::vector<std::thread> threads{};
+    threads.reserve(devices_.size());
+    for (size_t i = 0; i < devices_.size(); ++i) {
+      threads.emplace_back([this, &f, &exceptions, i]() {
+        try {
+          set_device(static_cast<int>(i));
+          if constexpr (std::is_invocable_v<F, raft::handle_t&, int>) {
+            f(*(handles_[i]), static_cast<int>(i));
+          } else {
+            f(*(handles_[i]));
+          }
+        } catch (...) {
+          exceptions[i] = std::current_exception();
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (auto& exception : exceptions) {
+      if (exception) { std::rethrow_exception(exception); }
+    }
+  }
+
+ private:
+  void set_device(int rank) const;
+
+  std::vector<int> devices_{};
+  std::vector<ncclComm_t> nccl_comms_{};
+  std::vector<std::unique_ptr<raft::handle_t>> handles_{};
+  std::vector<std::unique_ptr<partition_2d::subcomm_factory_t<partition_2d::key_naming_t, int>>>
+    subcomm_factories_{};
+};
+
+}  // namespace cugraph
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/handle.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/pool_memory_resource.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace cugraph {
+
+namespace detail {
+
+inline rmm::mr::device_memory_resource*& get_prims_workspace_state()
+{
+  thread_local rmm::mr::device_memory_resource* workspace{nullptr};
+  return workspace;
+}
+
+// the memory resource for the temporary buffers of the primitives (freed before the primitives
+// return), the workspace of this thread (if any) or the current device resource
+inline rmm::mr::device_memory_resource* get_prims_workspace_resource()
+{
+  auto workspace = get_prims_workspace_state();
+  return workspace != nullptr ? workspace : rmm::mr::get_current_device_resource();
+}
+
+// a thrust execution policy allocating the temporary storage from get_prims_workspace_resource()
+inline auto get_prims_workspace_thrust_policy(raft::handle_t const& handle)
+{
+  return rmm::exec_policy(handle.get_stream(), get_prims_workspace_resource());
+}
+
+}  // namespace detail
+
+/**
+ * @brief Keep the temporary buffers of the primitives across the primitive calls of this thread.
+ *
+ * While this object is alive, the primitives (e.g. update_frontier_v_push_if_out_nbr and
+ * copy_v_transform_reduce_key_aggregated_out_nbr) called by the constructing thread allocate their
+ * temporary buffers from a stream-ordered pool that holds the freed memory (up to the high-water
+ * mark) for the next calls instead of returning it to the current device resource, so iterative
+ * algorithms (BFS, SSSP, Louvain...) don't run cudaMalloc/cudaFree in their inner loops.
+ *
+ * The algorithms never create a workspace themselves: the caller owns it and should keep it alive
+ * across many algorithm calls (e.g. one per query thread). Releasing the pool on destruction frees
+ * its memory with cudaFree, which synchronizes the device, so a workspace created and destroyed
+ * around every call would serialize concurrent queries on different streams.
+ *
+ * This is a no-op if the current device resource is not rmm::mr::cuda_memory_resource (e.g. the
+ * user set a pool resource, which already serves the same purpose) or if a workspace of this
+ * thread is already alive (the outermost workspace is used). A workspace should be destroyed by the
+ * constructing thread in the reverse order of the creation.
+ */
+class scoped_prims_workspace_t {
+ public:
+  scoped_prims_workspace_t()
+  {
+    auto upstream = rmm::mr::get_current_device_resource();
+    if ((detail::get_prims_workspace_state() == nullptr) &&
+        (dynamic_cast<rmm::mr::cuda_memory_resource*>(upstream) != nullptr)) {
+      pool_ = std::make_unique<rmm::mr::pool_memory_resource<rmm::mr::device_memory_resource>>(
+        upstream, size_t{0});
+      detail::get_prims_workspace_state() = pool_.get();
+    }
+  }
+
+  scoped_prims_workspace_t(scoped_prims_workspace_t const&) = delete;
+  scoped_prims_workspace_t& operator=(scoped_prims_workspace_t const&) = delete;
+
+  ~scoped_prims_workspace_t()
+  {
+    if (pool_) { detail::get_prims_workspace_state() = nullptr; }
+  }
+
+  bool is_active() const { return pool_ != nullptr; }
+
+  // the size of the memory held by the workspace (in bytes)
+  size_t get_pool_size() const { return pool_ ? pool_->pool_size() : size_t{0}; }
+
+ private:
+  std::unique_ptr<rmm::mr::pool_memory_resource<rmm::mr::device_memory_resource>> pool_{};
+};
+
+}  // namespace cugraph
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace cugraph {
+
+/**
+ * @brief Runtime-enabled instrumentation of the graph algorithms.
+ *
+ * When enabled (by `profiler_t::get().enable(true)` or by setting the `CUGRAPH_PROFILE`
+ * environment variable to a non-zero value before the first use), algorithm phases are timed with
+ * CUDA events on the stream they run on (without synchronizing the stream) and counters (e.g.
+ * iteration counts and bytes sent by the device communication wrappers) are accumulated.
+ *
+ * NVTX ranges (in the "cugraph" domain) for the algorithm phases & iterations, the primitives,
+ * and the communication steps are emitted if the profiler is enabled or if NVTX is enabled alone
+ * (by `profiler_t::get().enable_nvtx(true)` or by setting the `CUGRAPH_NVTX` environment variable
+ * to a non-zero value), the latter skips the CUDA event timing.
+ *
+ * Phases nest; a phase (and a counter updated inside a phase) is keyed by the '/' separated names
+ * of the enclosing phases of the calling thread (e.g. "louvain/update_clustering"). When disabled,
+ * instrumentation costs a relaxed atomic load per call site.
+ *
+ * The stream ordered device communication wrappers (device_sendrecv, device_allreduce, ...) are
+ * timed as phases named after the wrapper (e.g. "bfs/device_allreduce"), so the communication time
+ * of an algorithm is the sum of its "device_" prefixed sub-phases (this includes the time waiting
+ * for the peers).
+ *
+ * In multi-GPU, every process has its own profiler (no inter-GPU aggregation).
+ */
+class profiler_t {
+ public:
+  struct phase_stats_t {
+    size_t num_calls{0};
+    double total_elapsed_ms{0.0};
+  };
+
+  static profiler_t& get();
+
+  void enable(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+  bool is_enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  void enable_nvtx(bool enabled) { nvtx_enabled_.store(enabled, std::memory_order_relaxed); }
+
+  bool is_nvtx_enabled() const
+  {
+    return nvtx_enabled_.load(std::memory_order_relaxed) || is_enabled();
+  }
+
+  // clears the recorded phases & counters
+  void reset();
+
+  // returns the per-phase statistics, blocks till the pending phases complete on the GPU
+  std::map<std::string, phase_stats_t> get_phase_stats();
+
+  std::map<std::string, int64_t> get_counters();
+
+  void add_counter(std::string const& name, int64_t delta);
+
+  // writes the phase statistics & the counters in a human readable form
+  void report(std::ostream& os);
+
+  // scoped_phase_t is the preferred interface for timing phases
+  void start_phase(std::string const& name, rmm::cuda_stream_view stream_view);
+  void stop_phase(rmm::cuda_stream_view stream_view);
+
+  // nvtx_range_t is the preferred interface for NVTX ranges
+  void push_nvtx_range(char const* name);
+  void pop_nvtx_range();
+
+ private:
+  profiler_t();
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<bool> nvtx_enabled_{false};
+};
+
+/**
+ * @brief RAII helper emitting an NVTX range (a no-op if NVTX is disabled when constructed).
+ */
+class nvtx_range_t {
+ public:
+  explicit nvtx_range_t(char const* name) : active_(profiler_t::get().is_nvtx_enabled())
+  {
+    if (active_) { profiler_t::get().push_nvtx_range(name); }
+  }
+
+  // the range is named "name index" (e.g. "level 3")
+  nvtx_range_t(char const* name, int64_t index) : active_(profiler_t::get().is_nvtx_enabled())
+  {
+    if (active_) {
+      profiler_t::get().push_nvtx_range((std::string(name) + " " + std::to_string(index)).c_str());
+    }
+  }
+
+  nvtx_range_t(nvtx_range_t const&) = delete;
+  nvtx_range_t& operator=(nvtx_range_t const&) = delete;
+
+  ~nvtx_range_t()
+  {
+    if (active_) { profiler_t::get().pop_nvtx_range(); }
+  }
+
+ private:
+  bool active_{false};
+};
+
+/**
+ * @brief RAII helper timing a phase (a no-op if the profiler is disabled when constructed, this
+ * emits only an NVTX range if NVTX is enabled without the profiler).
+ */
+class scoped_phase_t {
+ public:
+  scoped_phase_t(char const* name, rmm::cuda_stream_view stream_view)
+    : stream_view_(stream_view),
+      timed_(profiler_t::get().is_enabled()),
+      nvtx_only_(!timed_ && profiler_t::get().is_nvtx_enabled())
+  {
+    if (timed_) {
+      profiler_t::get().start_phase(name, stream_view_);
+    } else if (nvtx_only_) {
+      profiler_t::get().push_nvtx_range(name);
+    }
+  }
+
+  scoped_phase_t(scoped_phase_t const&) = delete;
+  scoped_phase_t& operator=(scoped_phase_t const&) = delete;
+
+  ~scoped_phase_t()
+  {
+    if (timed_) {
+      profiler_t::get().stop_phase(stream_view_);
+    } else if (nvtx_only_) {
+      profiler_t::get().pop_nvtx_range();
+    }
+  }
+
+ private:
+  rmm::cuda_stream_view stream_view_{};
+  bool timed_{false};
+  bool nvtx_only_{false};
+};
+
+/**
+ * @brief Adds delta to the counter name (in the current phase) if the profiler is enabled.
+ */
+inline void profiler_add_counter(char const* name, int64_t delta)
+{
+  if (profiler_t::get().is_enabled()) { profiler_t::get().add_counter(name, delta); }
+}
+
+}  // namespace cugraph
@@ -17,19 +17,34 @@
 
 #include <cugraph/utilities/dataframe_buffer.cuh>
 #include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/utilities/shuffle_config.hpp>
+#include <cugraph/utilities/thrust_tuple_utils.cuh>
 
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/distance.h>
+#include <thrust/execution_policy.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/reduce.h>
+#include <thrust/scan.h>
 #include <thrust/scatter.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace cugraph {
@@ -45,13 +60,11 @@ inline std::tuple<std::vector<size_t>,
                   std::vector<int>>
 compute_tx_rx_counts_offsets_ranks(raft::comms::comms_t const& comm,
                                    rmm::device_uvector<size_t> const& d_tx_value_counts,
-                                   rmm::cuda_stream_view stream_view)
+                                   rmm::cuda_stream_view stream_view,
+                                   shuffle_algorithm_t algorithm)
 {
   auto const comm_size = comm.get_size();
 
-  rmm::device_uvector<size_t> d_rx_value_counts(comm_size, stream_view);
-
-  // FIXME: this needs to be replaced with AlltoAll once NCCL 2.8 is released.
   std::vector<size_t> tx_counts(comm_size, size_t{1});
   std::vector<size_t> tx_offsets(comm_size);
   std::iota(tx_offsets.begin(), tx_offsets.end(), size_t{0});
@@ -62,21 +75,50 @@ compute_tx_rx_counts_offsets_ranks(raft::comms::comms_t const& comm,
   std::iota(rx_offsets.begin(), rx_offsets.end(), size_t{0});
   std::vector<int> rx_src_ranks(comm_size);
   std::iota(rx_src_ranks.begin(), rx_src_ranks.end(), int{0});
-  device_multicast_sendrecv(comm,
-                            d_tx_value_counts.data(),
-                            tx_counts,
-                            tx_offsets,
-                            tx_dst_ranks,
-                            d_rx_value_counts.data(),
-                            rx_counts,
-                            rx_offsets,
-                            rx_src_ranks,
-                            stream_view);
+  if (algorithm == shuffle_algorithm_t::alltoallv) {
+    // a single collective gathers the entire count matrix (row i: the counts sent by rank i)
+    rmm::device_uvector<size_t> d_count_matrix(
+      static_cast<size_t>(comm_size) * static_cast<size_t>(comm_size), stream_view);
+    std::vector<size_t> rx_row_counts(comm_size, static_cast<size_t>(comm_size));
+    std::vector<size_t> rx_row_displacements(comm_size);
+    for (int i = 0; i < comm_size; ++i) {
+      rx_row_displacements[i] = static_cast<size_t>(i) * static_cast<size_t>(comm_size);
+    }
+    device_allgatherv(comm,
+                      d_tx_value_counts.data(),
+                      d_count_matrix.data(),
+                      rx_row_counts,
+                      rx_row_displacements,
+                      stream_view);
+    std::vector<size_t> h_count_matrix(d_count_matrix.size());
+    raft::update_host(
+      h_count_matrix.data(), d_count_matrix.data(), d_count_matrix.size(), stream_view.value());
 
-  raft::update_host(tx_counts.data(), d_tx_value_counts.data(), comm_size, stream_view.value());
-  raft::update_host(rx_counts.data(), d_rx_value_counts.data(), comm_size, stream_view.value());
+    stream_view.synchronize();
 
-  stream_view.synchronize();
+    auto const comm_rank = comm.get_rank();
+    for (int i = 0; i < comm_size; ++i) {
+      tx_counts[i] = h_count_matrix[static_cast<size_t>(comm_rank) * comm_size + i];
+      rx_counts[i] = h_count_matrix[static_cast<size_t>(i) * comm_size + comm_rank];
+    }
+  } else {
+    rmm::device_uvector<size_t> d_rx_value_counts(comm_size, stream_view);
+    device_multicast_sendrecv(comm,
+                              d_tx_value_counts.data(),
+                              tx_counts,
+                              tx_offsets,
+                              tx_dst_ranks,
+                              d_rx_value_counts.data(),
+                              rx_counts,
+                              rx_offsets,
+                              rx_src_ranks,
+                              stream_view);
+
+    raft::update_host(tx_counts.data(), d_tx_value_counts.data(), comm_size, stream_view.value());
+    raft::update_host(rx_counts.data(), d_rx_value_counts.data(), comm_size, stream_view.value());
+
+    stream_view.synchronize();
+  }
 
   std::partial_sum(tx_counts.begin(), tx_counts.end() - 1, tx_offsets.begin() + 1);
   std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, rx_offsets.begin() + 1);
@@ -107,6 +149,261 @@ compute_tx_rx_counts_offsets_ranks(raft::comms::comms_t const& comm,
   return std::make_tuple(tx_counts, tx_offsets, tx_dst_ranks, rx_counts, rx_offsets, rx_src_ranks);
 }
 
+// alignment (in bytes) of every value array in the packed buffers
+size_t constexpr shuffle_packed_array_alignment{16};
+
+template <typename ValueIterator>
+std::vector<size_t> compute_value_array_element_sizes()
+{
+  using value_t = typename std::iterator_traits<ValueIterator>::value_type;
+  if constexpr (is_thrust_tuple_of_arithmetic<value_t>::value) {
+    auto sizes = compute_thrust_tuple_element_sizes<value_t>()();
+    return std::vector<size_t>(sizes.begin(), sizes.end());
+  } else {
+    static_assert(std::is_arithmetic<value_t>::value);
+    return std::vector<size_t>{sizeof(value_t)};
+  }
+}
+
+// returns the byte offsets of every (value array, peer) pair in the packed buffer (value array
+// major) and the byte counts & offsets of every peer
+inline std::tuple<std::vector<size_t>, std::vector<size_t>, std::vector<size_t>>
+compute_packed_buffer_layout(std::vector<size_t> const& value_counts,
+                             std::vector<size_t> const& element_sizes)
+{
+  std::vector<size_t> array_byte_offsets(element_sizes.size() * value_counts.size());
+  std::vector<size_t> byte_counts(value_counts.size());
+  std::vector<size_t> byte_offsets(value_counts.size());
+  size_t offset{0};
+  for (size_t i = 0; i < value_counts.size(); ++i) {
+    byte_offsets[i] = offset;
+    for (size_t j = 0; j < element_sizes.size(); ++j) {
+      array_byte_offsets[j * value_counts.size() + i] = offset;
+      offset += ((value_counts[i] * element_sizes[j] + shuffle_packed_array_alignment - 1) /
+                 shuffle_packed_array_alignment) *
+                shuffle_packed_array_alignment;
+    }
+    byte_counts[i] = offset - byte_offsets[i];
+  }
+  return std::make_tuple(
+    std::move(array_byte_offsets), std::move(byte_counts), std::move(byte_offsets));
+}
+
+template <typename T>
+struct pack_value_array_t {
+  size_t const* value_offsets{nullptr};  // size = num_peers + 1
+  size_t const* array_byte_offsets{nullptr};
+  size_t num_peers{};
+  T const* input{nullptr};
+  uint8_t* packed{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto peer = static_cast<size_t>(thrust::distance(
+      value_offsets + 1,
+      thrust::upper_bound(thrust::seq, value_offsets + 1, value_offsets + (num_peers + 1), i)));
+    reinterpret_cast<T*>(packed + array_byte_offsets[peer])[i - value_offsets[peer]] = input[i];
+  }
+};
+
+template <typename T>
+struct unpack_value_array_t {
+  size_t const* value_offsets{nullptr};  // size = num_peers + 1
+  size_t const* array_byte_offsets{nullptr};
+  size_t num_peers{};
+  uint8_t const* packed{nullptr};
+  T* output{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto peer = static_cast<size_t>(thrust::distance(
+      value_offsets + 1,
+      thrust::upper_bound(thrust::seq, value_offsets + 1, value_offsets + (num_peers + 1), i)));
+    output[i] =
+      reinterpret_cast<T const*>(packed + array_byte_offsets[peer])[i - value_offsets[peer]];
+  }
+};
+
+template <bool pack, typename ValueIterator>
+void pack_or_unpack_value_array(ValueIterator value_first,
+                                size_t num_values,
+                                size_t const* value_offsets,
+                                size_t const* array_byte_offsets,
+                                size_t num_peers,
+                                uint8_t* packed,
+                                rmm::cuda_stream_view stream_view)
+{
+  using value_t = typename std::iterator_traits<ValueIterator>::value_type;
+  if constexpr (pack) {
+    thrust::for_each(rmm::exec_policy(stream_view),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_values),
+                     pack_value_array_t<value_t>{value_offsets,
+                                                 array_byte_offsets,
+                                                 num_peers,
+                                                 iter_to_raw_ptr(value_first),
+                                                 packed});
+  } else {
+    thrust::for_each(rmm::exec_policy(stream_view),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_values),
+                     unpack_value_array_t<value_t>{value_offsets,
+                                                   array_byte_offsets,
+                                                   num_peers,
+                                                   packed,
+                                                   iter_to_raw_ptr(value_first)});
+  }
+}
+
+template <bool pack, typename ValueIterator, size_t... Is>
+void pack_or_unpack_tuple_value_arrays(ValueIterator value_first,
+                                       size_t num_values,
+                                       size_t const* value_offsets,
+                                       size_t const* array_byte_offsets,
+                                       size_t num_peers,
+                                       uint8_t* packed,
+                                       rmm::cuda_stream_view stream_view,
+                                       std::index_sequence<Is...>)
+{
+  (pack_or_unpack_value_array<pack>(thrust::get<Is>(value_first.get_iterator_tuple()),
+                                    num_values,
+                                    value_offsets,
+                                    array_byte_offsets + Is * num_peers,
+                                    num_peers,
+                                    packed,
+                                    stream_view),
+   ...);
+}
+
+// packs (or unpacks) the value arrays of value_first (one array per tuple element if value_first
+// is a zip iterator) using the byte offsets starting from array_byte_offsets
+template <bool pack, typename ValueIterator>
+void pack_or_unpack_value_arrays(ValueIterator value_first,
+                                 size_t num_values,
+                                 size_t const* value_offsets,
+                                 size_t const* array_byte_offsets,
+                                 size_t num_peers,
+                                 uint8_t* packed,
+                                 rmm::cuda_stream_view stream_view)
+{
+  using value_t = typename std::iterator_traits<ValueIterator>::value_type;
+  if constexpr (is_thrust_tuple_of_arithmetic<value_t>::value) {
+    pack_or_unpack_tuple_value_arrays<pack>(
+      value_first,
+      num_values,
+      value_offsets,
+      array_byte_offsets,
+      num_peers,
+      packed,
+      stream_view,
+      std::make_index_sequence<thrust::tuple_size<value_t>::value>{});
+  } else {
+    pack_or_unpack_value_array<pack>(value_first,
+                                     num_values,
+                                     value_offsets,
+                                     array_byte_offsets,
+                                     num_peers,
+                                     packed,
+                                     stream_view);
+  }
+}
+
+template <bool pack, typename... ValueIterators>
+void pack_or_unpack_all_value_arrays(std::tuple<ValueIterators...> value_firsts,
+                                     std::vector<size_t> const& counts,
+                                     std::vector<size_t> const& offsets,
+                                     std::vector<size_t> const& array_byte_offsets,
+                                     uint8_t* packed,
+                                     rmm::cuda_stream_view stream_view)
+{
+  auto num_peers  = counts.size();
+  auto num_values = num_peers > 0 ? offsets.back() + counts.back() : size_t{0};
+
+  std::vector<size_t> h_value_offsets(num_peers + 1, size_t{0});
+  std::copy(offsets.begin(), offsets.end(), h_value_offsets.begin());
+  h_value_offsets.back() = num_values;
+  rmm::device_uvector<size_t> d_value_offsets(h_value_offsets.size(), stream_view);
+  rmm::device_uvector<size_t> d_array_byte_offsets(array_byte_offsets.size(), stream_view);
+  raft::update_device(d_value_offsets.data(),
+                      h_value_offsets.data(),
+                      h_value_offsets.size(),
+                      stream_view.value());
+  raft::update_device(d_array_byte_offsets.data(),
+                      array_byte_offsets.data(),
+                      array_byte_offsets.size(),
+                      stream_view.value());
+
+  size_t array_idx{0};
+  std::apply(
+    [&](auto... value_first) {
+      ((pack_or_unpack_value_arrays<pack>(value_first,
+                                          num_values,
+                                          d_value_offsets.data(),
+                                          d_array_byte_offsets.data() + array_idx * num_peers,
+                                          num_peers,
+                                          packed,
+                                          stream_view),
+        array_idx += thrust_tuple_size_or_one<
+          typename std::iterator_traits<decltype(value_first)>::value_type>::value),
+       ...);
+    },
+    value_firsts);
+}
+
+// exchanges every value array of tx_value_firsts (the keys and the values, one array per tuple
+// element) in a single all-to-all-v of a packed buffer
+template <typename... TxValueIterators, typename... RxValueIterators>
+void device_packed_multicast_sendrecv(raft::comms::comms_t const& comm,
+                                      std::tuple<TxValueIterators...> tx_value_firsts,
+                                      std::vector<size_t> const& tx_counts,
+                                      std::vector<size_t> const& tx_offsets,
+                                      std::vector<int> const& tx_dst_ranks,
+                                      std::tuple<RxValueIterators...> rx_value_firsts,
+                                      std::vector<size_t> const& rx_counts,
+                                      std::vector<size_t> const& rx_offsets,
+                                      std::vector<int> const& rx_src_ranks,
+                                      rmm::cuda_stream_view stream_view)
+{
+  static_assert(sizeof...(TxValueIterators) == sizeof...(RxValueIterators));
+
+  std::vector<size_t> element_sizes{};
+  (
+    [&element_sizes]() {
+      auto sizes = compute_value_array_element_sizes<TxValueIterators>();
+      element_sizes.insert(element_sizes.end(), sizes.begin(), sizes.end());
+    }(),
+    ...);
+
+  auto [tx_array_byte_offsets, tx_byte_counts, tx_byte_offsets] =
+    compute_packed_buffer_layout(tx_counts, element_sizes);
+  auto [rx_array_byte_offsets, rx_byte_counts, rx_byte_offsets] =
+    compute_packed_buffer_layout(rx_counts, element_sizes);
+
+  rmm::device_uvector<uint8_t> tx_buffer(
+    tx_byte_counts.size() > 0 ? tx_byte_offsets.back() + tx_byte_counts.back() : size_t{0},
+    stream_view);
+  rmm::device_uvector<uint8_t> rx_buffer(
+    rx_byte_counts.size() > 0 ? rx_byte_offsets.back() + rx_byte_counts.back() : size_t{0},
+    stream_view);
+
+  pack_or_unpack_all_value_arrays<true>(
+    tx_value_firsts, tx_counts, tx_offsets, tx_array_byte_offsets, tx_buffer.data(), stream_view);
+
+  device_multicast_sendrecv(comm,
+                            tx_buffer.data(),
+                            tx_byte_counts,
+                            tx_byte_offsets,
+                            tx_dst_ranks,
+                            rx_buffer.data(),
+                            rx_byte_counts,
+                            rx_byte_offsets,
+                            rx_src_ranks,
+                            stream_view);
+
+  pack_or_unpack_all_value_arrays<false>(
+    rx_value_firsts, rx_counts, rx_offsets, rx_array_byte_offsets, rx_buffer.data(), stream_view);
+}
+
 }  // namespace detail
 
 template <typename ValueIterator, typename ValueToGPUIdOp>
@@ -193,8 +490,11 @@ template <typename TxValueIterator>
 auto shuffle_values(raft::comms::comms_t const& comm,
                     TxValueIterator tx_value_first,
                     std::vector<size_t> const& tx_value_counts,
-                    rmm::cuda_stream_view stream_view)
+                    rmm::cuda_stream_view stream_view,
+                    shuffle_algorithm_t algorithm = shuffle_algorithm_t::sendrecv)
 {
+  nvtx_range_t range("shuffle_values");
+
   auto const comm_size = comm.get_size();
 
   rmm::device_uvector<size_t> d_tx_value_counts(comm_size, stream_view);
@@ -208,24 +508,38 @@ auto shuffle_values(raft::comms::comms_t const& comm,
   std::vector<size_t> rx_offsets{};
   std::vector<int> rx_src_ranks{};
   std::tie(tx_counts, tx_offsets, tx_dst_ranks, rx_counts, rx_offsets, rx_src_ranks) =
-    detail::compute_tx_rx_counts_offsets_ranks(comm, d_tx_value_counts, stream_view);
+    detail::compute_tx_rx_counts_offsets_ranks(comm, d_tx_value_counts, stream_view, algorithm);
 
   auto rx_value_buffer =
     allocate_dataframe_buffer<typename std::iterator_traits<TxValueIterator>::value_type>(
       rx_offsets.size() > 0 ? rx_offsets.back() + rx_counts.back() : size_t{0}, stream_view);
 
-  // FIXME: this needs to be replaced with AlltoAll once NCCL 2.8 is released
-  // (if num_tx_dst_ranks == num_rx_src_ranks == comm_size).
-  device_multicast_sendrecv(comm,
-                            tx_value_first,
-                            tx_counts,
-                            tx_offsets,
-                            tx_dst_ranks,
-                            get_dataframe_buffer_begin(rx_value_buffer),
-                            rx_counts,
-                            rx_offsets,
-                            rx_src_ranks,
-                            stream_view);
+  if ((algorithm == shuffle_algorithm_t::alltoallv) &&
+      (thrust_tuple_size_or_one<
+         typename std::iterator_traits<TxValueIterator>::value_type>::value > 1)) {
+    detail::device_packed_multicast_sendrecv(
+      comm,
+      std::make_tuple(tx_value_first),
+      tx_counts,
+      tx_offsets,
+      tx_dst_ranks,
+      std::make_tuple(get_dataframe_buffer_begin(rx_value_buffer)),
+      rx_counts,
+      rx_offsets,
+      rx_src_ranks,
+      stream_view);
+  } else {
+    device_multicast_sendrecv(comm,
+                              tx_value_first,
+                              tx_counts,
+                              tx_offsets,
+                              tx_dst_ranks,
+                              get_dataframe_buffer_begin(rx_value_buffer),
+                              rx_counts,
+                              rx_offsets,
+                              rx_src_ranks,
+                              stream_view);
+  }
 
   if (rx_counts.size() < static_cast<size_t>(comm_size)) {
     std::vector<size_t> tmp_rx_counts(comm_size, size_t{0});
@@ -239,13 +553,448 @@ auto shuffle_values(raft::comms::comms_t const& comm,
   return std::make_tuple(std::move(rx_value_buffer), rx_counts);
 }
 
+namespace detail {
+
+// encodings of the sorted vertex IDs to a destination in shuffle_sorted_vertices
+uint64_t constexpr vertex_segment_delta_bitpack{0};  // the deltas in bit_width bits each
+uint64_t constexpr vertex_segment_bitmap{1};  // a bit per vertex ID in [base, base + 64 * words)
+
+// (encoding, bit width, vertex count, base vertex, word count) of the vertices to a destination
+size_t constexpr vertex_segment_header_size{5};
+
+__device__ inline size_t find_segment(size_t const* segment_offsets, size_t num_segments, size_t i)
+{
+  return static_cast<size_t>(thrust::distance(
+    segment_offsets + 1,
+    thrust::upper_bound(thrust::seq, segment_offsets + 1, segment_offsets + num_segments + 1, i)));
+}
+
+// records the first & last vertex IDs, and the maximum & minimum deltas between consecutive
+// vertex IDs of every segment
+template <typename VertexIterator>
+struct update_vertex_segment_stats_t {
+  VertexIterator vertex_first{};
+  size_t const* segment_offsets{nullptr};
+  size_t num_segments{0};
+  uint64_t* firsts{nullptr};
+  uint64_t* lasts{nullptr};
+  uint64_t* max_deltas{nullptr};
+  uint64_t* min_deltas{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto segment = find_segment(segment_offsets, num_segments, i);
+    auto v       = static_cast<uint64_t>(*(vertex_first + i));
+    if (i == segment_offsets[segment]) {
+      firsts[segment] = v;
+    } else {
+      auto delta = static_cast<unsigned long long int>(
+        v - static_cast<uint64_t>(*(vertex_first + (i - 1))));
+      atomicMax(reinterpret_cast<unsigned long long int*>(max_deltas + segment), delta);
+      atomicMin(reinterpret_cast<unsigned long long int*>(min_deltas + segment), delta);
+    }
+    if (i + 1 == segment_offsets[segment + 1]) { lasts[segment] = v; }
+  }
+};
+
+template <typename VertexIterator>
+struct encode_vertex_t {
+  VertexIterator vertex_first{};
+  size_t const* segment_offsets{nullptr};
+  size_t num_segments{0};
+  uint64_t const* headers{nullptr};
+  size_t const* word_offsets{nullptr};
+  uint64_t* words{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto segment       = find_segment(segment_offsets, num_segments, i);
+    auto header        = headers + segment * vertex_segment_header_size;
+    auto segment_words = reinterpret_cast<unsigned long long int*>(words + word_offsets[segment]);
+    auto v             = static_cast<uint64_t>(*(vertex_first + i));
+    if (header[0] == vertex_segment_bitmap) {
+      auto bit = v - header[3];
+      atomicOr(segment_words + bit / 64, static_cast<unsigned long long int>(1) << (bit % 64));
+    } else if (i > segment_offsets[segment]) {
+      auto bit_width = header[1];
+      auto delta     = static_cast<unsigned long long int>(
+        v - static_cast<uint64_t>(*(vertex_first + (i - 1))));
+      auto pos    = (i - segment_offsets[segment] - 1) * bit_width;
+      auto offset = pos % 64;
+      atomicOr(segment_words + pos / 64, delta << offset);
+      if (offset + bit_width > 64) {
+        atomicOr(segment_words + pos / 64 + 1, delta >> (64 - offset));
+      }
+    }
+  }
+};
+
+struct bitmap_word_popcount_t {
+  size_t const* word_offsets{nullptr};
+  size_t num_segments{0};
+  uint64_t const* headers{nullptr};
+  uint64_t const* words{nullptr};
+
+  __device__ size_t operator()(size_t w) const
+  {
+    auto segment = find_segment(word_offsets, num_segments, w);
+    return headers[segment * vertex_segment_header_size] == vertex_segment_bitmap
+             ? static_cast<size_t>(__popcll(static_cast<unsigned long long int>(words[w])))
+             : size_t{0};
+  }
+};
+
+// writes the vertex IDs of the set bits in the bitmap segments
+template <typename vertex_t>
+struct decode_bitmap_word_t {
+  size_t const* word_offsets{nullptr};
+  size_t const* value_offsets{nullptr};
+  size_t num_segments{0};
+  uint64_t const* headers{nullptr};
+  uint64_t const* words{nullptr};
+  size_t const* word_ranks{nullptr};  // exclusive sum of bitmap_word_popcount_t
+  vertex_t* vertices{nullptr};
+
+  __device__ void operator()(size_t w) const
+  {
+    auto segment = find_segment(word_offsets, num_segments, w);
+    auto header  = headers + segment * vertex_segment_header_size;
+    if (header[0] != vertex_segment_bitmap) { return; }
+    auto word = static_cast<unsigned long long int>(words[w]);
+    auto idx  = value_offsets[segment] + (word_ranks[w] - word_ranks[word_offsets[segment]]);
+    auto base = header[3] + (w - word_offsets[segment]) * 64;
+    while (word != 0) {
+      auto bit        = __ffsll(static_cast<long long int>(word)) - 1;
+      vertices[idx++] = static_cast<vertex_t>(base + bit);
+      word &= word - 1;
+    }
+  }
+};
+
+// writes the base vertex ID (for the first vertex) or the delta from the previous vertex ID (for
+// the others) in the delta bit-packed segments
+template <typename vertex_t>
+struct decode_delta_t {
+  size_t const* word_offsets{nullptr};
+  size_t const* value_offsets{nullptr};
+  size_t num_segments{0};
+  uint64_t const* headers{nullptr};
+  uint64_t const* words{nullptr};
+  vertex_t* vertices{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto segment = find_segment(value_offsets, num_segments, i);
+    auto header  = headers + segment * vertex_segment_header_size;
+    if (header[0] != vertex_segment_delta_bitpack) { return; }
+    auto j = i - value_offsets[segment];
+    if (j == 0) {
+      vertices[i] = static_cast<vertex_t>(header[3]);
+    } else {
+      auto bit_width     = header[1];
+      auto segment_words = words + word_offsets[segment];
+      auto pos           = (j - 1) * bit_width;
+      auto offset        = pos % 64;
+      uint64_t delta{0};
+      if (bit_width > 0) {
+        delta = segment_words[pos / 64] >> offset;
+        if (offset + bit_width > 64) { delta |= segment_words[pos / 64 + 1] << (64 - offset); }
+        if (bit_width < 64) { delta &= (uint64_t{1} << bit_width) - 1; }
+      }
+      vertices[i] = static_cast<vertex_t>(delta);
+    }
+  }
+};
+
+// delta bit-packed segments share a key (the segment) so the inclusive scan restores the vertex
+// IDs, and every vertex in the bitmap segments gets a distinct key to be left as is
+struct vertex_decode_scan_key_t {
+  size_t const* value_offsets{nullptr};
+  size_t num_segments{0};
+  uint64_t const* headers{nullptr};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    auto segment = find_segment(value_offsets, num_segments, i);
+    return headers[segment * vertex_segment_header_size] == vertex_segment_delta_bitpack
+             ? segment
+             : num_segments + i;
+  }
+};
+
+// drops the (source or destination) ranks with no data to exchange
+inline void remove_zero_count_ranks(std::vector<size_t>& counts,
+                                    std::vector<size_t>& offsets,
+                                    std::vector<int>& ranks)
+{
+  size_t num_ranks{0};
+  for (size_t i = 0; i < counts.size(); ++i) {
+    if (counts[i] != 0) {
+      counts[num_ranks]  = counts[i];
+      offsets[num_ranks] = offsets[i];
+      ranks[num_ranks]   = ranks[i];
+      ++num_ranks;
+    }
+  }
+  counts.resize(num_ranks);
+  offsets.resize(num_ranks);
+  ranks.resize(num_ranks);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Shuffle vertex IDs that are sorted (in non-descending order) per destination, compressing
+ * them on the wire.
+ *
+ * The vertex IDs to each destination are sent either as deltas between consecutive vertex IDs
+ * bit-packed in the bit width of the largest delta, or (if the vertex IDs are unique and dense
+ * enough for this to be smaller) as a bitmap over [first vertex ID, last vertex ID]. A small
+ * per-destination header carrying the encoding is exchanged first. The received vertex IDs are in
+ * the same order as in shuffle_values, so other arrays shuffled with shuffle_values using the same
+ * @p tx_value_counts stay aligned.
+ *
+ * @tparam VertexIterator Type of the iterator for the (non-negative) vertex IDs to send.
+ * @param comm Communicator.
+ * @param tx_vertex_first Iterator pointing to the first vertex ID to send.
+ * @param tx_value_counts The number of vertex IDs to send to each GPU (the vertex IDs to a GPU
+ * should be consecutive and sorted).
+ * @param stream_view Stream to run the kernels and communication on.
+ * @return Tuple of the received vertex IDs and the number of vertex IDs received from each GPU.
+ */
+template <typename VertexIterator>
+auto shuffle_sorted_vertices(raft::comms::comms_t const& comm,
+                             VertexIterator tx_vertex_first,
+                             std::vector<size_t> const& tx_value_counts,
+                             rmm::cuda_stream_view stream_view)
+{
+  nvtx_range_t range("shuffle_sorted_vertices");
+
+  using vertex_t = typename std::iterator_traits<VertexIterator>::value_type;
+  static_assert(std::is_integral<vertex_t>::value);
+
+  auto const comm_size    = comm.get_size();
+  auto const num_segments = static_cast<size_t>(comm_size);
+
+  // 1. choose the encoding of the vertex IDs to each destination
+
+  std::vector<size_t> h_tx_value_offsets(num_segments + 1, size_t{0});
+  std::partial_sum(
+    tx_value_counts.begin(), tx_value_counts.end(), h_tx_value_offsets.begin() + 1);
+  rmm::device_uvector<size_t> d_tx_value_offsets(h_tx_value_offsets.size(), stream_view);
+  raft::update_device(d_tx_value_offsets.data(),
+                      h_tx_value_offsets.data(),
+                      h_tx_value_offsets.size(),
+                      stream_view.value());
+
+  // firsts, lasts, max_deltas, and min_deltas
+  rmm::device_uvector<uint64_t> d_stats(num_segments * 4, stream_view);
+  thrust::fill(rmm::exec_policy(stream_view),
+               d_stats.begin(),
+               d_stats.begin() + num_segments * 3,
+               uint64_t{0});
+  thrust::fill(rmm::exec_policy(stream_view),
+               d_stats.begin() + num_segments * 3,
+               d_stats.end(),
+               std::numeric_limits<uint64_t>::max());
+  thrust::for_each(rmm::exec_policy(stream_view),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(h_tx_value_offsets.back()),
+                   detail::update_vertex_segment_stats_t<VertexIterator>{
+                     tx_vertex_first,
+                     d_tx_value_offsets.data(),
+                     num_segments,
+                     d_stats.data(),
+                     d_stats.data() + num_segments,
+                     d_stats.data() + num_segments * 2,
+                     d_stats.data() + num_segments * 3});
+  std::vector<uint64_t> h_stats(d_stats.size());
+  raft::update_host(h_stats.data(), d_stats.data(), d_stats.size(), stream_view.value());
+  stream_view.synchronize();
+
+  std::vector<uint64_t> h_tx_headers(num_segments * detail::vertex_segment_header_size);
+  std::vector<size_t> h_tx_word_offsets(num_segments + 1, size_t{0});
+  for (size_t i = 0; i < num_segments; ++i) {
+    auto count     = static_cast<uint64_t>(tx_value_counts[i]);
+    auto first     = h_stats[i];
+    auto last      = h_stats[num_segments + i];
+    auto max_delta = h_stats[num_segments * 2 + i];
+    auto min_delta = h_stats[num_segments * 3 + i];
+
+    uint64_t bit_width{0};
+    for (auto delta = max_delta; delta != 0; delta >>= 1) {
+      ++bit_width;
+    }
+    auto bitpack_words = count > 1 ? ((count - 1) * bit_width + 63) / 64 : uint64_t{0};
+    auto bitmap_words  = (last - first) / 64 + 1;
+    // a bitmap cannot represent duplicate vertex IDs
+    auto use_bitmap = (count > 1) && (min_delta > 0) && (bitmap_words < bitpack_words);
+
+    auto header = h_tx_headers.data() + i * detail::vertex_segment_header_size;
+    header[0]   = use_bitmap ? detail::vertex_segment_bitmap : detail::vertex_segment_delta_bitpack;
+    header[1]   = bit_width;
+    header[2]   = count;
+    header[3]   = first;
+    header[4]   = use_bitmap ? bitmap_words : bitpack_words;
+    h_tx_word_offsets[i + 1] = h_tx_word_offsets[i] + header[4];
+  }
+
+  // 2. encode
+
+  rmm::device_uvector<uint64_t> d_tx_headers(h_tx_headers.size(), stream_view);
+  raft::update_device(
+    d_tx_headers.data(), h_tx_headers.data(), h_tx_headers.size(), stream_view.value());
+  rmm::device_uvector<size_t> d_tx_word_offsets(h_tx_word_offsets.size(), stream_view);
+  raft::update_device(d_tx_word_offsets.data(),
+                      h_tx_word_offsets.data(),
+                      h_tx_word_offsets.size(),
+                      stream_view.value());
+  rmm::device_uvector<uint64_t> d_tx_words(h_tx_word_offsets.back(), stream_view);
+  thrust::fill(rmm::exec_policy(stream_view), d_tx_words.begin(), d_tx_words.end(), uint64_t{0});
+  thrust::for_each(rmm::exec_policy(stream_view),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(h_tx_value_offsets.back()),
+                   detail::encode_vertex_t<VertexIterator>{tx_vertex_first,
+                                                           d_tx_value_offsets.data(),
+                                                           num_segments,
+                                                           d_tx_headers.data(),
+                                                           d_tx_word_offsets.data(),
+                                                           d_tx_words.data()});
+
+  // 3. exchange the headers and then the encoded words
+
+  std::vector<size_t> header_counts(num_segments, detail::vertex_segment_header_size);
+  std::vector<size_t> header_offsets(num_segments);
+  std::vector<int> ranks(num_segments);
+  for (size_t i = 0; i < num_segments; ++i) {
+    header_offsets[i] = i * detail::vertex_segment_header_size;
+  }
+  std::iota(ranks.begin(), ranks.end(), int{0});
+  rmm::device_uvector<uint64_t> d_rx_headers(h_tx_headers.size(), stream_view);
+  device_multicast_sendrecv(comm,
+                            d_tx_headers.data(),
+                            header_counts,
+                            header_offsets,
+                            ranks,
+                            d_rx_headers.data(),
+                            header_counts,
+                            header_offsets,
+                            ranks,
+                            stream_view);
+  std::vector<uint64_t> h_rx_headers(d_rx_headers.size());
+  raft::update_host(
+    h_rx_headers.data(), d_rx_headers.data(), d_rx_headers.size(), stream_view.value());
+  stream_view.synchronize();
+
+  std::vector<size_t> rx_counts(num_segments);
+  std::vector<size_t> h_rx_value_offsets(num_segments + 1, size_t{0});
+  std::vector<size_t> h_rx_word_offsets(num_segments + 1, size_t{0});
+  for (size_t i = 0; i < num_segments; ++i) {
+    rx_counts[i]              = h_rx_headers[i * detail::vertex_segment_header_size + 2];
+    h_rx_value_offsets[i + 1] = h_rx_value_offsets[i] + rx_counts[i];
+    h_rx_word_offsets[i + 1] =
+      h_rx_word_offsets[i] + h_rx_headers[i * detail::vertex_segment_header_size + 4];
+  }
+
+  std::vector<size_t> tx_word_counts(num_segments);
+  std::vector<size_t> tx_word_offsets(h_tx_word_offsets.begin(), h_tx_word_offsets.end() - 1);
+  std::vector<int> tx_dst_ranks(ranks);
+  std::vector<size_t> rx_word_counts(num_segments);
+  std::vector<size_t> rx_word_offsets(h_rx_word_offsets.begin(), h_rx_word_offsets.end() - 1);
+  std::vector<int> rx_src_ranks(ranks);
+  std::adjacent_difference(
+    h_tx_word_offsets.begin() + 1, h_tx_word_offsets.end(), tx_word_counts.begin());
+  tx_word_counts[0] = h_tx_word_offsets[1];
+  std::adjacent_difference(
+    h_rx_word_offsets.begin() + 1, h_rx_word_offsets.end(), rx_word_counts.begin());
+  rx_word_counts[0] = h_rx_word_offsets[1];
+  detail::remove_zero_count_ranks(tx_word_counts, tx_word_offsets, tx_dst_ranks);
+  detail::remove_zero_count_ranks(rx_word_counts, rx_word_offsets, rx_src_ranks);
+
+  rmm::device_uvector<uint64_t> d_rx_words(h_rx_word_offsets.back(), stream_view);
+  device_multicast_sendrecv(comm,
+                            d_tx_words.data(),
+                            tx_word_counts,
+                            tx_word_offsets,
+                            tx_dst_ranks,
+                            d_rx_words.data(),
+                            rx_word_counts,
+                            rx_word_offsets,
+                            rx_src_ranks,
+                            stream_view);
+  d_tx_words.resize(0, stream_view);
+  d_tx_words.shrink_to_fit(stream_view);
+
+  // 4. decode
+
+  rmm::device_uvector<size_t> d_rx_value_offsets(h_rx_value_offsets.size(), stream_view);
+  raft::update_device(d_rx_value_offsets.data(),
+                      h_rx_value_offsets.data(),
+                      h_rx_value_offsets.size(),
+                      stream_view.value());
+  rmm::device_uvector<size_t> d_rx_word_offsets(h_rx_word_offsets.size(), stream_view);
+  raft::update_device(d_rx_word_offsets.data(),
+                      h_rx_word_offsets.data(),
+                      h_rx_word_offsets.size(),
+                      stream_view.value());
+
+  rmm::device_uvector<vertex_t> rx_vertices(h_rx_value_offsets.back(), stream_view);
+
+  rmm::device_uvector<size_t> d_rx_word_ranks(d_rx_words.size(), stream_view);
+  thrust::transform(rmm::exec_policy(stream_view),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(d_rx_words.size()),
+                    d_rx_word_ranks.begin(),
+                    detail::bitmap_word_popcount_t{d_rx_word_offsets.data(),
+                                                   num_segments,
+                                                   d_rx_headers.data(),
+                                                   d_rx_words.data()});
+  thrust::exclusive_scan(rmm::exec_policy(stream_view),
+                         d_rx_word_ranks.begin(),
+                         d_rx_word_ranks.end(),
+                         d_rx_word_ranks.begin());
+  thrust::for_each(rmm::exec_policy(stream_view),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(d_rx_words.size()),
+                   detail::decode_bitmap_word_t<vertex_t>{d_rx_word_offsets.data(),
+                                                          d_rx_value_offsets.data(),
+                                                          num_segments,
+                                                          d_rx_headers.data(),
+                                                          d_rx_words.data(),
+                                                          d_rx_word_ranks.data(),
+                                                          rx_vertices.data()});
+  thrust::for_each(rmm::exec_policy(stream_view),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(rx_vertices.size()),
+                   detail::decode_delta_t<vertex_t>{d_rx_word_offsets.data(),
+                                                    d_rx_value_offsets.data(),
+                                                    num_segments,
+                                                    d_rx_headers.data(),
+                                                    d_rx_words.data(),
+                                                    rx_vertices.data()});
+  auto scan_key_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(size_t{0}),
+    detail::vertex_decode_scan_key_t{
+      d_rx_value_offsets.data(), num_segments, d_rx_headers.data()});
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream_view),
+                                scan_key_first,
+                                scan_key_first + rx_vertices.size(),
+                                rx_vertices.begin(),
+                                rx_vertices.begin());
+
+  return std::make_tuple(std::move(rx_vertices), rx_counts);
+}
+
 template <typename ValueIterator, typename ValueToGPUIdOp>
 auto groupby_gpuid_and_shuffle_values(raft::comms::comms_t const& comm,
                                       ValueIterator tx_value_first /* [INOUT */,
                                       ValueIterator tx_value_last /* [INOUT */,
                                       ValueToGPUIdOp value_to_gpu_id_op,
-                                      rmm::cuda_stream_view stream_view)
+                                      rmm::cuda_stream_view stream_view,
+                                      shuffle_algorithm_t algorithm = shuffle_algorithm_t::sendrecv)
 {
+  nvtx_range_t range("groupby_gpuid_and_shuffle_values");
+
   auto const comm_size = comm.get_size();
 
   auto d_tx_value_counts = groupby_and_count(
@@ -258,24 +1007,38 @@ auto groupby_gpuid_and_shuffle_values(raft::comms::comms_t const& comm,
   std::vector<size_t> rx_offsets{};
   std::vector<int> rx_src_ranks{};
   std::tie(tx_counts, tx_offsets, tx_dst_ranks, rx_counts, rx_offsets, rx_src_ranks) =
-    detail::compute_tx_rx_counts_offsets_ranks(comm, d_tx_value_counts, stream_view);
+    detail::compute_tx_rx_counts_offsets_ranks(comm, d_tx_value_counts, stream_view, algorithm);
 
   auto rx_value_buffer =
     allocate_dataframe_buffer<typename std::iterator_traits<ValueIterator>::value_type>(
       rx_offsets.size() > 0 ? rx_offsets.back() + rx_counts.back() : size_t{0}, stream_view);
 
-  // FIXME: this needs to be replaced with AlltoAll once NCCL 2.8 is released
-  // (if num_tx_dst_ranks == num_rx_src_ranks == comm_size).
-  device_multicast_sendrecv(comm,
-                            tx_value_first,
-                            tx_counts,
-                            tx_offsets,
-                            tx_dst_ranks,
-                            get_dataframe_buffer_begin(rx_value_buffer),
-                            rx_counts,
-                            rx_offsets,
-                            rx_src_ranks,
-                            stream_view);
+  if ((algorithm == shuffle_algorithm_t::alltoallv) &&
+      (thrust_tuple_size_or_one<
+         typename std::iterator_traits<ValueIterator>::value_type>::value > 1)) {
+    detail::device_packed_multicast_sendrecv(
+      comm,
+      std::make_tuple(tx_value_first),
+      tx_counts,
+      tx_offsets,
+      tx_dst_ranks,
+      std::make_tuple(get_dataframe_buffer_begin(rx_value_buffer)),
+      rx_counts,
+      rx_offsets,
+      rx_src_ranks,
+      stream_view);
+  } else {
+    device_multicast_sendrecv(comm,
+                              tx_value_first,
+                              tx_counts,
+                              tx_offsets,
+                              tx_dst_ranks,
+                              get_dataframe_buffer_begin(rx_value_buffer),
+                              rx_counts,
+                              rx_offsets,
+                              rx_src_ranks,
+                              stream_view);
+  }
 
   if (rx_counts.size() < static_cast<size_t>(comm_size)) {
     std::vector<size_t> tmp_rx_counts(comm_size, size_t{0});
@@ -289,13 +1052,17 @@ auto groupby_gpuid_and_shuffle_values(raft::comms::comms_t const& comm,
 }
 
 template <typename VertexIterator, typename ValueIterator, typename KeyToGPUIdOp>
-auto groupby_gpuid_and_shuffle_kv_pairs(raft::comms::comms_t const& comm,
-                                        VertexIterator tx_key_first /* [INOUT */,
-                                        VertexIterator tx_key_last /* [INOUT */,
-                                        ValueIterator tx_value_first /* [INOUT */,
-                                        KeyToGPUIdOp key_to_gpu_id_op,
-                                        rmm::cuda_stream_view stream_view)
+auto groupby_gpuid_and_shuffle_kv_pairs(
+  raft::comms::comms_t const& comm,
+  VertexIterator tx_key_first /* [INOUT */,
+  VertexIterator tx_key_last /* [INOUT */,
+  ValueIterator tx_value_first /* [INOUT */,
+  KeyToGPUIdOp key_to_gpu_id_op,
+  rmm::cuda_stream_view stream_view,
+  shuffle_algorithm_t algorithm = shuffle_algorithm_t::sendrecv)
 {
+  nvtx_range_t range("groupby_gpuid_and_shuffle_kv_pairs");
+
   auto const comm_size = comm.get_size();
 
   auto d_tx_value_counts = groupby_and_count(
@@ -308,7 +1075,7 @@ auto groupby_gpuid_and_shuffle_kv_pairs(raft::comms::comms_t const& comm,
   std::vector<size_t> rx_offsets{};
   std::vector<int> rx_src_ranks{};
   std::tie(tx_counts, tx_offsets, tx_dst_ranks, rx_counts, rx_offsets, rx_src_ranks) =
-    detail::compute_tx_rx_counts_offsets_ranks(comm, d_tx_value_counts, stream_view);
+    detail::compute_tx_rx_counts_offsets_ranks(comm, d_tx_value_counts, stream_view, algorithm);
 
   rmm::device_uvector<typename std::iterator_traits<VertexIterator>::value_type> rx_keys(
     rx_offsets.size() > 0 ? rx_offsets.back() + rx_counts.back() : size_t{0}, stream_view);
@@ -316,31 +1083,40 @@ auto groupby_gpuid_and_shuffle_kv_pairs(raft::comms::comms_t const& comm,
     allocate_dataframe_buffer<typename std::iterator_traits<ValueIterator>::value_type>(
       rx_keys.size(), stream_view);
 
-  // FIXME: this needs to be replaced with AlltoAll once NCCL 2.8 is released
-  // (if num_tx_dst_ranks == num_rx_src_ranks == comm_size).
-  device_multicast_sendrecv(comm,
-                            tx_key_first,
-                            tx_counts,
-                            tx_offsets,
-                            tx_dst_ranks,
-                            rx_keys.begin(),
-                            rx_counts,
-                            rx_offsets,
-                            rx_src_ranks,
-                            stream_view);
-
-  // FIXME: this needs to be replaced with AlltoAll once NCCL 2.8 is released
-  // (if num_tx_dst_ranks == num_rx_src_ranks == comm_size).
-  device_multicast_sendrecv(comm,
-                            tx_value_first,
-                            tx_counts,
-                            tx_offsets,
-                            tx_dst_ranks,
-                            get_dataframe_buffer_begin(rx_value_buffer),
-                            rx_counts,
-                            rx_offsets,
-                            rx_src_ranks,
-                            stream_view);
+  if (algorithm == shuffle_algorithm_t::alltoallv) {
+    detail::device_packed_multicast_sendrecv(
+      comm,
+      std::make_tuple(tx_key_first, tx_value_first),
+      tx_counts,
+      tx_offsets,
+      tx_dst_ranks,
+      std::make_tuple(rx_keys.begin(), get_dataframe_buffer_begin(rx_value_buffer)),
+      rx_counts,
+      rx_offsets,
+      rx_src_ranks,
+      stream_view);
+  } else {
+    device_multicast_sendrecv(comm,
+                              tx_key_first,
+                              tx_counts,
+                              tx_offsets,
+                              tx_dst_ranks,
+                              rx_keys.begin(),
+                              rx_counts,
+                              rx_offsets,
+                              rx_src_ranks,
+                              stream_view);
+    device_multicast_sendrecv(comm,
+                              tx_value_first,
+                              tx_counts,
+                              tx_offsets,
+                              tx_dst_ranks,
+                              get_dataframe_buffer_begin(rx_value_buffer),
+                              rx_counts,
+                              rx_offsets,
+                              rx_src_ranks,
+                              stream_view);
+  }
 
   if (rx_counts.size() < static_cast<size_t>(comm_size)) {
     std::vector<size_t> tmp_rx_counts(comm_size, size_t{0});
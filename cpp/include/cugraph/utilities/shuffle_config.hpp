@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+namespace cugraph {
+
+/**
+ * @brief Algorithms to exchange values in shuffle_values, groupby_gpuid_and_shuffle_values, and
+ * groupby_gpuid_and_shuffle_kv_pairs (passed as their last argument, sendrecv by default).
+ *
+ * sendrecv exchanges the per-destination value counts with a multicast send/receive and then runs
+ * a multicast send/receive per value array (i.e. per key array and per tuple element). alltoallv
+ * exchanges the counts with a single count matrix allgather and packs the value arrays into one
+ * buffer for a single all-to-all-v exchange; this trades a pack and an unpack copy for fewer
+ * communication calls and suits latency bound (small) shuffles with many peers. Every process
+ * should pass the same algorithm to the same shuffle.
+ */
+enum class shuffle_algorithm_t { sendrecv, alltoallv };
+
+}  // namespace cugraph
@@ -46,7 +46,8 @@ template <typename vertex_t,
           typename weight_t,
           bool tr,
           bool mg,
-          std::enable_if_t<!is_candidate<vertex_t, edge_t, weight_t>::value, void*> = nullptr>
+          std::enable_if_t<!is_dispatch_candidate<vertex_t, edge_t, weight_t, mg>::value, void*> =
+            nullptr>
 constexpr pair_uniques_t graph_dispatcher(GTypes graph_type, erased_pack_t& ep)
 {
   /// return nullptr;
@@ -60,7 +61,8 @@ template <typename vertex_t,
           typename weight_t,
           bool tr,
           bool mg,
-          std::enable_if_t<is_candidate<vertex_t, edge_t, weight_t>::value, void*> = nullptr>
+          std::enable_if_t<is_dispatch_candidate<vertex_t, edge_t, weight_t, mg>::value, void*> =
+            nullptr>
 constexpr pair_uniques_t graph_dispatcher(GTypes graph_type, erased_pack_t& ep)
 {
   switch (graph_type) {
@@ -33,10 +33,42 @@
 namespace cugraph {
 namespace dispatch {
 
+template <typename functor_t, typename = void>
+struct has_unsupported : std::false_type {
+};
+
+template <typename functor_t>
+struct has_unsupported<functor_t, std::void_t<decltype(std::declval<functor_t&>().unsupported())>>
+  : std::true_type {
+};
+
+// final step of cascading:
+// calls functor for dispatch candidates,
+// the other combinations are never instantiated, they are reported
+// through functor.unsupported() if the functor provides it (or by throwing)
+//
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu,
+          typename functor_t>
+constexpr decltype(auto) functor_dispatcher(functor_t& functor)
+{
+  if constexpr (is_dispatch_candidate<vertex_t, edge_t, weight_t, multi_gpu>::value) {
+    return functor.template operator()<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>();
+  } else if constexpr (has_unsupported<functor_t>::value) {
+    functor.unsupported();
+  } else {
+    throw std::runtime_error("ERROR: type combination not supported by the dispatcher");
+  }
+}
+
 // multi_gpu bool dispatcher:
 // resolves bool `multi_gpu`
 // and using template arguments vertex_t, edge_t, weight_t, store_transpose
-// Calls functor
+// cascades into next level
+// functor_dispatcher()
 //
 template <typename vertex_t,
           typename edge_t,
@@ -46,9 +78,9 @@ template <typename vertex_t,
 constexpr decltype(auto) multi_gpu_dispatcher(bool multi_gpu, functor_t& functor)
 {
   if (multi_gpu) {
-    return functor.template operator()<vertex_t, edge_t, weight_t, store_transposed, true>();
+    return functor_dispatcher<vertex_t, edge_t, weight_t, store_transposed, true>(functor);
   } else {
-    return functor.template operator()<vertex_t, edge_t, weight_t, store_transposed, false>();
+    return functor_dispatcher<vertex_t, edge_t, weight_t, store_transposed, false>(functor);
   }
 }
 
@@ -24,6 +24,37 @@
 extern "C" {
 #endif
 
+/**
+ * @brief     How an algorithm returns the vertex id array of its result
+ */
+typedef enum cugraph_vertex_ids_mode_ {
+  CUGRAPH_VERTEX_IDS_COPY = 0, /* copy the graph's vertex ids into the result (default) */
+  CUGRAPH_VERTEX_IDS_VIEW,     /* view over the graph's vertex ids, valid until the graph is freed
+                                  or its storage is transposed by another algorithm */
+  CUGRAPH_VERTEX_IDS_SKIP      /* no vertex ids, the result's vertex array is NULL */
+} cugraph_vertex_ids_mode_t;
+
+/**
+ * @brief     Result options (initialize with cugraph_result_options_init)
+ *
+ * If an output array is provided, the algorithm writes into it directly and the corresponding
+ * array of the result is a view over it (the caller keeps ownership, and the array should outlive
+ * the result).  The array should have one element per vertex and the type of the result values.
+ */
+typedef struct cugraph_result_options_ {
+  cugraph_vertex_ids_mode_t vertex_ids_mode;
+  cugraph_type_erased_device_array_t* values;       /* distances or pageranks, NULL to allocate */
+  cugraph_type_erased_device_array_t* predecessors; /* BFS predecessors, NULL to allocate */
+} cugraph_result_options_t;
+
+/**
+ * @brief     Initialize result options with the default values (copy vertex ids, allocate the
+ *            output arrays)
+ *
+ * @param [out] options     The options to initialize
+ */
+void cugraph_result_options_init(cugraph_result_options_t* options);
+
 /**
  * @brief     Opaque pagerank result type
  */
@@ -35,7 +66,7 @@ typedef struct {
  * @brief     Get the vertex ids from the pagerank result
  *
  * @param [in]   result   The result from pagerank
- * @return type erased array of vertex ids
+ * @return type erased array of vertex ids, NULL if skipped (CUGRAPH_VERTEX_IDS_SKIP)
  */
 cugraph_type_erased_device_array_t* cugraph_pagerank_result_get_vertices(
   cugraph_pagerank_result_t* result);
@@ -92,6 +123,27 @@ cugraph_error_code_t cugraph_pagerank(
   cugraph_pagerank_result_t** result,
   cugraph_error_t** error);
 
+/**
+ * @brief     Compute pagerank with result options
+ *
+ * Same as cugraph_pagerank.  If @p options->values is provided and @p has_initial_guess is
+ * set, the values in @p options->values are used as the initial PageRank values.
+ *
+ * @param [in]  options     Result options, NULL for the defaults
+ */
+cugraph_error_code_t cugraph_pagerank_with_options(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_t* precomputed_vertex_out_weight_sums,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool_t has_initial_guess,
+  bool_t do_expensive_check,
+  const cugraph_result_options_t* options,
+  cugraph_pagerank_result_t** result,
+  cugraph_error_t** error);
+
 /**
  * @brief     Compute personalized pagerank
  *
@@ -137,6 +189,63 @@ cugraph_error_code_t cugraph_personalized_pagerank(
   cugraph_pagerank_result_t** result,
   cugraph_error_t** error);
 
+/**
+ * @brief     Compute personalized pagerank with result options
+ *
+ * Same as cugraph_personalized_pagerank.  If @p options->values is provided and
+ * @p has_initial_guess is set, the values in @p options->values are used as the initial PageRank
+ * values.
+ *
+ * @param [in]  options     Result options, NULL for the defaults
+ */
+cugraph_error_code_t cugraph_personalized_pagerank_with_options(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_t* precomputed_vertex_out_weight_sums,
+  cugraph_type_erased_device_array_t* personalization_vertices,
+  const cugraph_type_erased_device_array_t* personalization_values,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool_t has_initial_guess,
+  bool_t do_expensive_check,
+  const cugraph_result_options_t* options,
+  cugraph_pagerank_result_t** result,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Compute pagerank asynchronously
+ *
+ * Same as cugraph_pagerank_with_options, but returns once the call is enqueued on a worker
+ * thread (see cugraph_completion_t).  @p *result is set once cugraph_completion_is_ready
+ * returns TRUE.
+ *
+ * @param [in]  options     Result options, NULL for the defaults (copied)
+ * @param [in]  callback    Optional completion callback, NULL for none
+ * @param [in]  user_data   Passed to @p callback
+ * @param [out] result      Pointer to the result location, should stay valid until completion
+ * @param [out] completion  Opaque pointer to the completion handle
+ * @param [out] error       Pointer to an error object storing details of any error launching the
+ *                          call.  Errors of the call itself are reported by
+ *                          cugraph_completion_wait
+ * @return error code
+ */
+cugraph_error_code_t cugraph_pagerank_async(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_t* precomputed_vertex_out_weight_sums,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool_t has_initial_guess,
+  bool_t do_expensive_check,
+  const cugraph_result_options_t* options,
+  cugraph_completion_callback_t callback,
+  void* user_data,
+  cugraph_pagerank_result_t** result,
+  cugraph_completion_t** completion,
+  cugraph_error_t** error);
+
 /**
  * @brief     Opaque paths result type
  *
@@ -151,7 +260,7 @@ typedef struct {
  * @brief     Get the vertex ids from the paths result
  *
  * @param [in]   result   The result from bfs or sssp
- * @return type erased array of vertex ids
+ * @return type erased array of vertex ids, NULL if skipped (CUGRAPH_VERTEX_IDS_SKIP)
  */
 cugraph_type_erased_device_array_t* cugraph_paths_result_get_vertices(
   cugraph_paths_result_t* result);
@@ -219,6 +328,139 @@ cugraph_error_code_t cugraph_bfs(
   cugraph_paths_result_t** result,
   cugraph_error_t** error);
 
+/**
+ * @brief     Perform a breadth first search with result options
+ *
+ * Same as cugraph_bfs.  @p options->values receives the distances and @p options->predecessors
+ * the predecessors (ignored if @p compute_predecessors is FALSE).
+ *
+ * @param [in]  options      Result options, NULL for the defaults
+ */
+cugraph_error_code_t cugraph_bfs_with_options(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  // FIXME:  Make this const, copy it if I need to temporarily modify internally
+  cugraph_type_erased_device_array_t* sources,
+  bool_t direction_optimizing,
+  size_t depth_limit,
+  bool_t do_expensive_check,
+  bool_t compute_predecessors,
+  const cugraph_result_options_t* options,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Perform a breadth first search asynchronously
+ *
+ * Same as cugraph_bfs_with_options, but returns once the call is enqueued on a worker thread (see
+ * cugraph_completion_t and cugraph_pagerank_async).
+ */
+cugraph_error_code_t cugraph_bfs_async(const cugraph_resource_handle_t* handle,
+                                       cugraph_graph_t* graph,
+                                       cugraph_type_erased_device_array_t* sources,
+                                       bool_t direction_optimizing,
+                                       size_t depth_limit,
+                                       bool_t do_expensive_check,
+                                       bool_t compute_predecessors,
+                                       const cugraph_result_options_t* options,
+                                       cugraph_completion_callback_t callback,
+                                       void* user_data,
+                                       cugraph_paths_result_t** result,
+                                       cugraph_completion_t** completion,
+                                       cugraph_error_t** error);
+
+/**
+ * @brief     Perform a breadth first search from each of a batch of seed vertices.
+ *
+ * This function runs one search per source (the searches share every frontier expansion, up to
+ * 64 at a time).  The distances of the result store one row of distances per source (row i,
+ * [i * num_vertices, (i + 1) * num_vertices), holds the distances from sources[i], in the order
+ * of the result's vertex ids).  Predecessors are not computed (the predecessors of the result are
+ * empty).  Single-GPU only.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                           needs to be transposed
+ * @param [in]  sources      Array of source vertices (not modified)
+ * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
+ * farther than @p depth_limit hops from a source will be marked as unreachable from that source.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param [out] result       Opaque pointer to paths results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_bfs_batch(const cugraph_resource_handle_t* handle,
+                                       cugraph_graph_t* graph,
+                                       const cugraph_type_erased_device_array_t* sources,
+                                       size_t depth_limit,
+                                       bool_t do_expensive_check,
+                                       cugraph_paths_result_t** result,
+                                       cugraph_error_t** error);
+
+/**
+ * @brief     Run single-source shortest-path from a seed vertex.
+ *
+ * This function computes the distances (sum of the edge weights along the shortest path) from
+ * the source vertex, and the predecessors if @p compute_predecessors is TRUE (the predecessors of
+ * the result are empty otherwise).  Single-GPU only.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                           needs to be transposed
+ * @param [in]  source       Source vertex id
+ * @param [in]  cutoff       Any vertex farther than @p cutoff will be marked as unreachable
+ * @param [in]  compute_predecessors If TRUE, compute the predecessors
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param [out] result       Opaque pointer to paths results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_sssp(const cugraph_resource_handle_t* handle,
+                                  cugraph_graph_t* graph,
+                                  size_t source,
+                                  double cutoff,
+                                  bool_t compute_predecessors,
+                                  bool_t do_expensive_check,
+                                  cugraph_paths_result_t** result,
+                                  cugraph_error_t** error);
+
+/**
+ * @brief     Run single-source shortest-path from each of a batch of seed vertices.
+ *
+ * Same as cugraph_sssp, for every source in one call.  The distances (and predecessors) of the
+ * result store one row per source, laid out like in cugraph_bfs_batch.
+ *
+ * @param [in]  sources      Array of source vertices (not modified)
+ */
+cugraph_error_code_t cugraph_sssp_batch(const cugraph_resource_handle_t* handle,
+                                        cugraph_graph_t* graph,
+                                        const cugraph_type_erased_device_array_t* sources,
+                                        double cutoff,
+                                        bool_t compute_predecessors,
+                                        bool_t do_expensive_check,
+                                        cugraph_paths_result_t** result,
+                                        cugraph_error_t** error);
+
+/**
+ * @brief     Run single-source shortest-path from a batch of seed vertices asynchronously
+ *
+ * Same as cugraph_sssp_batch, but returns once the call is enqueued on a worker thread (see
+ * cugraph_completion_t and cugraph_pagerank_async).
+ */
+cugraph_error_code_t cugraph_sssp_batch_async(const cugraph_resource_handle_t* handle,
+                                              cugraph_graph_t* graph,
+                                              const cugraph_type_erased_device_array_t* sources,
+                                              double cutoff,
+                                              bool_t compute_predecessors,
+                                              bool_t do_expensive_check,
+                                              cugraph_completion_callback_t callback,
+                                              void* user_data,
+                                              cugraph_paths_result_t** result,
+                                              cugraph_completion_t** completion,
+                                              cugraph_error_t** error);
+
 /**
  * @brief     Opaque extract_paths result type
  */
@@ -277,6 +519,342 @@ cugraph_type_erased_device_array_t* cugraph_extract_paths_result_get_paths(
  */
 void cugraph_extract_paths_result_free(cugraph_extract_paths_result_t* result);
 
+/**
+ * @brief     Opaque labeling result type
+ */
+typedef struct {
+  int align_;
+} cugraph_labeling_result_t;
+
+/**
+ * @brief     Get the vertex ids from the labeling result
+ *
+ * @param [in]   result   The result from a labeling algorithm
+ * @return type erased array of vertex ids
+ */
+cugraph_type_erased_device_array_t* cugraph_labeling_result_get_vertices(
+  cugraph_labeling_result_t* result);
+
+/**
+ * @brief     Get the labels from the labeling result
+ *
+ * @param [in]   result   The result from a labeling algorithm
+ * @return type erased array of labels (of the vertex type)
+ */
+cugraph_type_erased_device_array_t* cugraph_labeling_result_get_labels(
+  cugraph_labeling_result_t* result);
+
+/**
+ * @brief     Free labeling result
+ *
+ * @param [in]   result   The result from a labeling algorithm
+ */
+void cugraph_labeling_result_free(cugraph_labeling_result_t* result);
+
+/**
+ * @brief     Compute weakly connected components
+ *
+ * The graph should be symmetric.  Vertices in the same component get the same label.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                           needs to be transposed
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param [out] result       Opaque pointer to labeling results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_weakly_connected_components(const cugraph_resource_handle_t* handle,
+                                                         cugraph_graph_t* graph,
+                                                         bool_t do_expensive_check,
+                                                         cugraph_labeling_result_t** result,
+                                                         cugraph_error_t** error);
+
+/**
+ * @brief     Opaque hierarchical clustering result type
+ */
+typedef struct {
+  int align_;
+} cugraph_hierarchical_clustering_result_t;
+
+/**
+ * @brief     Get the vertex ids from the hierarchical clustering result
+ *
+ * @param [in]   result   The result from a clustering algorithm
+ * @return type erased array of vertex ids
+ */
+cugraph_type_erased_device_array_t* cugraph_hierarchical_clustering_result_get_vertices(
+  cugraph_hierarchical_clustering_result_t* result);
+
+/**
+ * @brief     Get the clusters (of the finest level) from the hierarchical clustering result
+ *
+ * @param [in]   result   The result from a clustering algorithm
+ * @return type erased array of cluster ids (of the vertex type)
+ */
+cugraph_type_erased_device_array_t* cugraph_hierarchical_clustering_result_get_clusters(
+  cugraph_hierarchical_clustering_result_t* result);
+
+/**
+ * @brief     Get the modularity of the clustering
+ *
+ * @param [in]   result   The result from a clustering algorithm
+ * @return modularity
+ */
+double cugraph_hierarchical_clustering_result_get_modularity(
+  cugraph_hierarchical_clustering_result_t* result);
+
+/**
+ * @brief     Get the number of levels of the clustering
+ *
+ * @param [in]   result   The result from a clustering algorithm
+ * @return number of levels
+ */
+size_t cugraph_hierarchical_clustering_result_get_number_of_levels(
+  cugraph_hierarchical_clustering_result_t* result);
+
+/**
+ * @brief     Free hierarchical clustering result
+ *
+ * @param [in]   result   The result from a clustering algorithm
+ */
+void cugraph_hierarchical_clustering_result_free(cugraph_hierarchical_clustering_result_t* result);
+
+/**
+ * @brief     Compute a clustering of the graph by maximizing modularity (Louvain method)
+ *
+ * The graph should be symmetric and weighted.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                           needs to be transposed
+ * @param [in]  max_level    Maximum number of levels to run
+ * @param [in]  resolution   Resolution parameter (gamma in the modularity formula), higher values
+ *                           lead to more, smaller communities
+ * @param [out] result       Opaque pointer to hierarchical clustering results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_louvain(const cugraph_resource_handle_t* handle,
+                                     cugraph_graph_t* graph,
+                                     size_t max_level,
+                                     double resolution,
+                                     cugraph_hierarchical_clustering_result_t** result,
+                                     cugraph_error_t** error);
+
+/**
+ * @brief     Degree type used by the K-core algorithms
+ */
+typedef enum cugraph_k_core_degree_type_ {
+  CUGRAPH_K_CORE_DEGREE_TYPE_IN = 0,
+  CUGRAPH_K_CORE_DEGREE_TYPE_OUT,
+  CUGRAPH_K_CORE_DEGREE_TYPE_INOUT
+} cugraph_k_core_degree_type_t;
+
+/**
+ * @brief     Opaque core result type
+ */
+typedef struct {
+  int align_;
+} cugraph_core_result_t;
+
+/**
+ * @brief     Get the vertex ids from the core result
+ *
+ * @param [in]   result   The result from core number
+ * @return type erased array of vertex ids
+ */
+cugraph_type_erased_device_array_t* cugraph_core_result_get_vertices(cugraph_core_result_t* result);
+
+/**
+ * @brief     Get the core numbers from the core result
+ *
+ * @param [in]   result   The result from core number
+ * @return type erased array of core numbers (of the edge type)
+ */
+cugraph_type_erased_device_array_t* cugraph_core_result_get_core_numbers(
+  cugraph_core_result_t* result);
+
+/**
+ * @brief     Free core result
+ *
+ * @param [in]   result   The result from core number
+ */
+void cugraph_core_result_free(cugraph_core_result_t* result);
+
+/**
+ * @brief     Compute the core numbers of the vertices (K-core decomposition)
+ *
+ * The graph should be symmetric and should not have self-loops.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                           needs to be transposed
+ * @param [in]  degree_type  Use in-degrees, out-degrees, or in-degrees + out-degrees
+ * @param [in]  k_first      Find K-cores from K = k_first (vertices not in the k_first-core get
+ *                           core number 0)
+ * @param [in]  k_last       Find K-cores to K = k_last (SIZE_MAX for no limit)
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param [out] result       Opaque pointer to core results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_core_number(const cugraph_resource_handle_t* handle,
+                                         cugraph_graph_t* graph,
+                                         cugraph_k_core_degree_type_t degree_type,
+                                         size_t k_first,
+                                         size_t k_last,
+                                         bool_t do_expensive_check,
+                                         cugraph_core_result_t** result,
+                                         cugraph_error_t** error);
+
+/**
+ * @brief     Opaque centrality result type
+ */
+typedef struct {
+  int align_;
+} cugraph_centrality_result_t;
+
+/**
+ * @brief     Get the vertex ids from the centrality result
+ *
+ * @param [in]   result   The result from a centrality algorithm
+ * @return type erased array of vertex ids
+ */
+cugraph_type_erased_device_array_t* cugraph_centrality_result_get_vertices(
+  cugraph_centrality_result_t* result);
+
+/**
+ * @brief     Get the centrality values from the centrality result
+ *
+ * @param [in]   result   The result from a centrality algorithm
+ * @return type erased array of centrality values (of the weight type)
+ */
+cugraph_type_erased_device_array_t* cugraph_centrality_result_get_values(
+  cugraph_centrality_result_t* result);
+
+/**
+ * @brief     Free centrality result
+ *
+ * @param [in]   result   The result from a centrality algorithm
+ */
+void cugraph_centrality_result_free(cugraph_centrality_result_t* result);
+
+/**
+ * @brief     Compute Katz centrality
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                           needs to be transposed
+ * @param [in]  betas        Optional per vertex beta values (in the order of the result's vertex
+ *                           ids), NULL to use @p beta for every vertex
+ * @param [in]  alpha        Katz centrality attenuation factor, should be smaller than the
+ *                           inverse of the maximum eigenvalue of the adjacency matrix
+ * @param [in]  beta         Constant added to the Katz centrality of every vertex (if @p betas
+ *                           is NULL)
+ * @param [in]  epsilon      Error tolerance to check convergence
+ * @param [in]  max_iterations Maximum number of Katz centrality iterations
+ * @param [in]  normalize    If TRUE, normalize the scores (L2-norm 1.0)
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param [out] result       Opaque pointer to centrality results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_katz_centrality(const cugraph_resource_handle_t* handle,
+                                             cugraph_graph_t* graph,
+                                             const cugraph_type_erased_device_array_t* betas,
+                                             double alpha,
+                                             double beta,
+                                             double epsilon,
+                                             size_t max_iterations,
+                                             bool_t normalize,
+                                             bool_t do_expensive_check,
+                                             cugraph_centrality_result_t** result,
+                                             cugraph_error_t** error);
+
+/**
+ * @brief     Opaque hits result type
+ */
+typedef struct {
+  int align_;
+} cugraph_hits_result_t;
+
+/**
+ * @brief     Get the vertex ids from the hits result
+ *
+ * @param [in]   result   The result from hits
+ * @return type erased array of vertex ids
+ */
+cugraph_type_erased_device_array_t* cugraph_hits_result_get_vertices(cugraph_hits_result_t* result);
+
+/**
+ * @brief     Get the hub scores from the hits result
+ *
+ * @param [in]   result   The result from hits
+ * @return type erased array of hub scores (of the weight type)
+ */
+cugraph_type_erased_device_array_t* cugraph_hits_result_get_hubs(cugraph_hits_result_t* result);
+
+/**
+ * @brief     Get the authority scores from the hits result
+ *
+ * @param [in]   result   The result from hits
+ * @return type erased array of authority scores (of the weight type)
+ */
+cugraph_type_erased_device_array_t* cugraph_hits_result_get_authorities(
+  cugraph_hits_result_t* result);
+
+/**
+ * @brief     Get the sum of the differences of the hub scores of the last two iterations
+ *
+ * @param [in]   result   The result from hits
+ * @return hub score differences
+ */
+double cugraph_hits_result_get_hub_score_differences(cugraph_hits_result_t* result);
+
+/**
+ * @brief     Get the number of iterations taken
+ *
+ * @param [in]   result   The result from hits
+ * @return number of iterations
+ */
+size_t cugraph_hits_result_get_number_of_iterations(cugraph_hits_result_t* result);
+
+/**
+ * @brief     Free hits result
+ *
+ * @param [in]   result   The result from hits
+ */
+void cugraph_hits_result_free(cugraph_hits_result_t* result);
+
+/**
+ * @brief     Compute hub and authority scores (HITS)
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                           needs to be transposed
+ * @param [in]  epsilon      Error tolerance to check convergence
+ * @param [in]  max_iterations Maximum number of HITS iterations
+ * @param [in]  normalize    If TRUE, normalize the scores (L1-norm 1.0)
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param [out] result       Opaque pointer to hits results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_hits(const cugraph_resource_handle_t* handle,
+                                  cugraph_graph_t* graph,
+                                  double epsilon,
+                                  size_t max_iterations,
+                                  bool_t normalize,
+                                  bool_t do_expensive_check,
+                                  cugraph_hits_result_t** result,
+                                  cugraph_error_t** error);
+
 #ifdef __cplusplus
 }
 #endif
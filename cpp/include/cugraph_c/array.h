@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cugraph_c/arrow_device_abi.h>
 #include <cugraph_c/cugraph_api.h>
 
 #ifdef __cplusplus
@@ -30,6 +31,9 @@ typedef struct {
   int align_;
 } cugraph_type_erased_host_array_t;
 
+/* DLPack managed tensor (dlpack/dlpack.h), only used through pointers by this API */
+struct DLManagedTensor;
+
 /**
  * @brief     Create a type erased device array
  *
@@ -159,6 +163,99 @@ cugraph_error_code_t cugraph_type_erased_device_array_copy_to_host(
   const cugraph_type_erased_device_array_t* src,
   cugraph_error_t** error);
 
+/**
+ * @brief    Create a type erased device array over the memory of a DLPack tensor (no copy)
+ *
+ * The tensor should be a one dimensional, contiguous tensor of int32, int64, float32 or float64
+ * values in CUDA device (or managed) memory of the handle's device, and the producer should have
+ * completed any pending work on the tensor.  On success the array takes ownership of @p tensor,
+ * the tensor's deleter is called once the array (and anything exported from it) is freed.  On
+ * failure the ownership of @p tensor stays with the caller.
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  tensor      The DLPack tensor
+ * @param [out] array       Pointer to the location to store the pointer to the device array
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_device_array_from_dlpack(
+  const cugraph_resource_handle_t* handle,
+  struct DLManagedTensor* tensor,
+  cugraph_type_erased_device_array_t** array,
+  cugraph_error_t** error);
+
+/**
+ * @brief    Export a type erased device array as a DLPack tensor (no copy)
+ *
+ * The tensor shares the array's memory, the memory is kept alive until both the array is freed
+ * and the tensor's deleter is called, so either can be released first.  If the array is a
+ * non-owning view (e.g. the vertex ids of a result created with CUGRAPH_VERTEX_IDS_VIEW) the
+ * tensor is a non-owning view as well and is valid only as long as the viewed memory.  The
+ * handle's stream is synchronized before returning.
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  array       The device array
+ * @param [out] tensor      Pointer to the location to store the pointer to the DLPack tensor,
+ *                          the consumer should call the tensor's deleter once done with it
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_device_array_to_dlpack(
+  const cugraph_resource_handle_t* handle,
+  cugraph_type_erased_device_array_t* array,
+  struct DLManagedTensor** tensor,
+  cugraph_error_t** error);
+
+/**
+ * @brief    Create a type erased device array over the memory of an Arrow device array (no copy)
+ *
+ * The Arrow array should be a primitive int32 ("i"), int64 ("l"), float32 ("f") or float64 ("g")
+ * array without nulls, in CUDA device (or managed) memory of the handle's device.  If
+ * @p device_array has a sync event (a pointer to a cudaEvent_t) the handle's stream waits on it.
+ * On success the array takes ownership of the Arrow array by moving it (@p device_array's release
+ * callback is set to NULL as required by the Arrow move semantics), the schema is only read and
+ * stays owned by the caller.  On failure the ownership of the Arrow array stays with the caller.
+ *
+ * @param [in]  handle        Handle for accessing resources
+ * @param [in]  schema        The Arrow schema describing @p device_array
+ * @param [in]  device_array  The Arrow device array
+ * @param [out] array         Pointer to the location to store the pointer to the device array
+ * @param [out] error         Pointer to an error object storing details of any error.  Will
+ *                            be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_device_array_from_arrow(
+  const cugraph_resource_handle_t* handle,
+  const struct ArrowSchema* schema,
+  struct ArrowDeviceArray* device_array,
+  cugraph_type_erased_device_array_t** array,
+  cugraph_error_t** error);
+
+/**
+ * @brief    Export a type erased device array as an Arrow device array (no copy)
+ *
+ * Same memory sharing rules as cugraph_type_erased_device_array_to_dlpack.  The exported array
+ * has no sync event, the handle's stream is synchronized before returning.
+ *
+ * @param [in]  handle        Handle for accessing resources
+ * @param [in]  array         The device array
+ * @param [out] schema        The Arrow schema to populate, the consumer should call its release
+ *                            callback once done with it
+ * @param [out] device_array  The Arrow device array to populate, the consumer should call the
+ *                            release callback of its array once done with it
+ * @param [out] error         Pointer to an error object storing details of any error.  Will
+ *                            be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_device_array_to_arrow(
+  const cugraph_resource_handle_t* handle,
+  cugraph_type_erased_device_array_t* array,
+  struct ArrowSchema* schema,
+  struct ArrowDeviceArray* device_array,
+  cugraph_error_t** error);
+
 #ifdef __cplusplus
 }
 #endif
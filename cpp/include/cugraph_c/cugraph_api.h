@@ -163,9 +163,121 @@ cugraph_error_code_t cugraph_update_host_buffer(const cugraph_resource_handle_t*
 /* raft::handle_t allocator (for now; possibly a more encompassing handle in the future)*/
 cugraph_resource_handle_t* cugraph_create_resource_handle(void);
 
+/* memory resource of a resource handle */
+typedef enum cugraph_memory_resource_type_ {
+  CUGRAPH_MEMORY_RESOURCE_CURRENT = 0, /* use the device's current RMM memory resource */
+  CUGRAPH_MEMORY_RESOURCE_POOL,        /* rmm::mr::pool_memory_resource */
+  CUGRAPH_MEMORY_RESOURCE_ARENA        /* rmm::mr::arena_memory_resource */
+} cugraph_memory_resource_type_t;
+
+/* resource handle configuration (initialize with cugraph_resource_handle_config_init) */
+typedef struct cugraph_resource_handle_config_ {
+  int device_id;            /* device to use, -1 (default) to use the current device */
+  cudaStream_t stream;      /* stream to run on, NULL (default) for the default stream */
+  int num_internal_streams; /* size of the internal stream pool, 0 (default) for no pool */
+  cugraph_memory_resource_type_t memory_resource_type; /* default: CURRENT */
+  size_t initial_pool_size; /* pool/arena initial size in bytes, 0 (default) for RMM's default */
+  size_t maximum_pool_size; /* pool/arena maximum size in bytes, 0 (default) for RMM's default */
+} cugraph_resource_handle_config_t;
+
+/**
+ * @brief     Initialize a resource handle configuration with the default values
+ *
+ * @param [out] config      The configuration to initialize
+ */
+void cugraph_resource_handle_config_init(cugraph_resource_handle_config_t* config);
+
+/**
+ * @brief     Create a resource handle from a configuration
+ *
+ * The handle runs on config->stream (the caller keeps ownership of the stream, and it should
+ * outlive the handle) and on config->device_id; the calling thread's current device is left
+ * unchanged, and every call on the handle switches to the handle's device and back. If config->memory_resource_type is POOL or ARENA, a new memory resource is
+ * created for the handle and serves only the device allocations of the calls on this handle
+ * (other handles and the allocations made outside of the C API calls use the device's current
+ * RMM memory resource). Device memory allocated from it (e.g. result arrays and graphs) stays
+ * valid after the handle is freed, the memory resource is destroyed once the handle and every
+ * allocation made from it are freed. To run concurrent queries on separate streams sharing one
+ * pool, set an RMM pool as the device's current memory resource and create CURRENT handles with
+ * different streams.
+ *
+ * @param [in]  config      The configuration
+ * @param [out] handle      Opaque pointer to the created resource handle
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_create_resource_handle_from_config(
+  const cugraph_resource_handle_config_t* config,
+  cugraph_resource_handle_t** handle,
+  cugraph_error_t** error);
+
 /* raft::handle_t deallocator*/
 void cugraph_free_resource_handle(cugraph_resource_handle_t* p_handle);
 
+/**
+ * @brief     Opaque completion handle of an asynchronous call (cugraph_*_async)
+ *
+ * An asynchronous call returns immediately; the call runs on a worker thread (the host side loops
+ * of the algorithm, e.g. convergence checks, still synchronize that thread with the device) and
+ * enqueues its device work on the resource handle's stream.  The inputs should stay alive, and
+ * the resource handle should not be used by another call, until the call completes.  Use
+ * separate resource handles (with separate streams) to overlap calls.
+ *
+ * Asynchronous calls are not stream-asynchronous: the worker thread blocks wherever the
+ * synchronous call synchronizes its stream, only the calling thread is freed.  Each pending
+ * completion holds one worker thread until the host side of the call returns, so bound the number
+ * of calls in flight.
+ */
+typedef struct cugraph_completion_ {
+  int align_;
+} cugraph_completion_t;
+
+/* called on the worker thread once the host side of an asynchronous call returns */
+typedef void (*cugraph_completion_callback_t)(cugraph_error_code_t error_code, void* user_data);
+
+/**
+ * @brief     Check whether the host side of an asynchronous call has returned (non-blocking)
+ *
+ * Once this returns TRUE, the result is set and cugraph_completion_get_event returns an event
+ * that is recorded after the device work of the call.
+ *
+ * @param [in]  completion  The completion handle
+ * @return TRUE if the host side of the call has returned
+ */
+bool_t cugraph_completion_is_ready(const cugraph_completion_t* completion);
+
+/**
+ * @brief     Get the event recorded on the resource handle's stream after the call's device work
+ *
+ * Use cudaStreamWaitEvent to order other streams after the call without blocking the host.
+ * Returns NULL until cugraph_completion_is_ready returns TRUE (or if the call failed).  The event
+ * is owned by the completion handle.
+ *
+ * @param [in]  completion  The completion handle
+ * @return the completion event
+ */
+cudaEvent_t cugraph_completion_get_event(const cugraph_completion_t* completion);
+
+/**
+ * @brief     Wait for an asynchronous call (host and device work) to complete
+ *
+ * @param [in]  completion  The completion handle
+ * @param [out] error       Pointer to an error object storing details of any error of the call.
+ *                          Will be populated if error code is not CUGRAPH_SUCCESS (only by the
+ *                          first wait)
+ * @return error code of the call
+ */
+cugraph_error_code_t cugraph_completion_wait(cugraph_completion_t* completion,
+                                             cugraph_error_t** error);
+
+/**
+ * @brief     Wait for an asynchronous call to complete and free the completion handle
+ *
+ * @param [in]  completion  The completion handle
+ */
+void cugraph_completion_free(cugraph_completion_t* completion);
+
 #ifdef __cplusplus
 }
 #endif
@@ -118,6 +118,63 @@ cugraph_error_code_t cugraph_mg_graph_create(
 //         but didn't want to confuse with original cugraph_free_graph
 void cugraph_mg_graph_free(cugraph_graph_t* graph);
 
+/**
+ * @brief     Register a graph in the process-wide graph registry
+ *
+ * The registry takes ownership of @p graph and keeps a single device copy of it, which can then
+ * be opened read-only from any number of handles and threads with cugraph_graph_registry_open.
+ * Data derived from the graph (the storage transposed copy and the out-weight sums) is created
+ * by the first algorithm that needs it and reused by every graph opened from the same entry.
+ *
+ * The entry keeps the internal state of the resource handle @p graph was created on alive (the
+ * derived data is built with it as well), so that resource handle may be freed before the entry.
+ * A stream set with cugraph_resource_handle_config_t::stream is not owned by the handle and must
+ * outlive the entry.
+ *
+ * On success @p graph must no longer be used or freed by the caller.
+ *
+ * @param [in]  name   Name to register the graph with, must not be registered already
+ * @param [in]  graph  A pointer to the graph object to register (not opened from the registry)
+ * @param [out] error  Pointer to an error object storing details of any error.  Will
+ *                     be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_graph_registry_register(const char* name,
+                                                     cugraph_graph_t* graph,
+                                                     cugraph_error_t** error);
+
+/**
+ * @brief     Open a graph from the graph registry
+ *
+ * The returned graph shares the registered device copy, it can be passed to any algorithm and
+ * used concurrently with other graphs opened from the same entry (on handles of the device the
+ * graph was created on, the resource handle the graph was created on need not be alive any
+ * more).  Free it with cugraph_sg_graph_free (or cugraph_mg_graph_free), this
+ * drops the reference to the shared copy.
+ *
+ * @param [in]  name   Name the graph was registered with
+ * @param [out] graph  A pointer to the opened graph object
+ * @param [out] error  Pointer to an error object storing details of any error.  Will
+ *                     be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_graph_registry_open(const char* name,
+                                                 cugraph_graph_t** graph,
+                                                 cugraph_error_t** error);
+
+/**
+ * @brief     Remove a graph from the graph registry
+ *
+ * The name can be registered again right away.  The device copy is freed once the last graph
+ * opened from this entry is freed.
+ *
+ * @param [in]  name   Name the graph was registered with
+ * @param [out] error  Pointer to an error object storing details of any error.  Will
+ *                     be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_graph_registry_unregister(const char* name, cugraph_error_t** error);
+
 #ifdef __cplusplus
 }
 #endif
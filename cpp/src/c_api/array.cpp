@@ -16,9 +16,16 @@
 
 #include <c_api/array.hpp>
 #include <c_api/error.hpp>
+#include <c_api/resource_handle.hpp>
 
+#include <dlpack/dlpack.h>
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
 
+#include <cstring>
+#include <memory>
+#include <optional>
+
 namespace cugraph {
 namespace c_api {
 
@@ -27,6 +34,70 @@ cugraph::visitors::DTypes dtypes_mapping[] = {cugraph::visitors::DTypes::INT32,
                                               cugraph::visitors::DTypes::FLOAT32,
                                               cugraph::visitors::DTypes::FLOAT64};
 
+namespace {
+
+int get_device_id(::cugraph_resource_handle_t const* handle)
+{
+  return reinterpret_cast<cugraph_resource_handle_t const*>(handle)->device_id_;
+}
+
+std::optional<data_type_id_t> dlpack_to_data_type_id(DLDataType dtype)
+{
+  if (dtype.lanes != 1) { return std::nullopt; }
+  if ((dtype.code == kDLInt) && (dtype.bits == 32)) { return INT32; }
+  if ((dtype.code == kDLInt) && (dtype.bits == 64)) { return INT64; }
+  if ((dtype.code == kDLFloat) && (dtype.bits == 32)) { return FLOAT32; }
+  if ((dtype.code == kDLFloat) && (dtype.bits == 64)) { return FLOAT64; }
+  return std::nullopt;
+}
+
+DLDataType data_type_id_to_dlpack(data_type_id_t type)
+{
+  auto is_float = (type == FLOAT32) || (type == FLOAT64);
+  return DLDataType{static_cast<uint8_t>(is_float ? kDLFloat : kDLInt),
+                    static_cast<uint8_t>(::data_type_sz[type] * 8),
+                    uint16_t{1}};
+}
+
+// Arrow format strings of the supported primitive types
+std::optional<data_type_id_t> arrow_to_data_type_id(char const* format)
+{
+  if (std::strcmp(format, "i") == 0) { return INT32; }
+  if (std::strcmp(format, "l") == 0) { return INT64; }
+  if (std::strcmp(format, "f") == 0) { return FLOAT32; }
+  if (std::strcmp(format, "g") == 0) { return FLOAT64; }
+  return std::nullopt;
+}
+
+char const* data_type_id_to_arrow(data_type_id_t type)
+{
+  char const* formats[] = {"i", "l", "f", "g"};
+  return formats[type];
+}
+
+// manager_ctx of the exported DLPack tensors, the tensor lives in its own context
+struct dlpack_export_context_t {
+  DLManagedTensor tensor_{};
+  int64_t shape_[1]{0};
+  std::shared_ptr<void> owner_{};
+};
+
+// private_data of the exported Arrow arrays
+struct arrow_export_context_t {
+  void const* buffers_[2]{nullptr, nullptr};
+  std::shared_ptr<void> owner_{};
+};
+
+void release_exported_arrow_schema(ArrowSchema* schema) { schema->release = nullptr; }
+
+void release_exported_arrow_array(ArrowArray* array)
+{
+  delete static_cast<arrow_export_context_t*>(array->private_data);
+  array->release = nullptr;
+}
+
+}  // namespace
+
 }  // namespace c_api
 }  // namespace cugraph
 
@@ -41,7 +112,9 @@ extern "C" cugraph_error_code_t cugraph_type_erased_device_array_create(
   *error = nullptr;
 
   try {
-    raft::handle_t const* raft_handle = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* raft_handle = cugraph::c_api::get_raft_handle(handle);
 
     if (!raft_handle) {
       *error = reinterpret_cast<cugraph_error_t*>(
@@ -88,7 +161,7 @@ extern "C" const void* cugraph_type_erased_device_array_pointer(
 {
   auto internal_pointer =
     reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(p);
-  return internal_pointer->data_.data();
+  return internal_pointer->data();
 }
 
 extern "C" cugraph_error_code_t cugraph_type_erased_host_array_create(
@@ -102,7 +175,9 @@ extern "C" cugraph_error_code_t cugraph_type_erased_host_array_create(
   *error = nullptr;
 
   try {
-    raft::handle_t const* raft_handle = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* raft_handle = cugraph::c_api::get_raft_handle(handle);
 
     if (!raft_handle) {
       *error = reinterpret_cast<cugraph_error_t*>(
@@ -163,7 +238,9 @@ extern "C" cugraph_error_code_t cugraph_type_erased_device_array_copy_from_host(
   *error = nullptr;
 
   try {
-    raft::handle_t const* raft_handle = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* raft_handle = cugraph::c_api::get_raft_handle(handle);
     auto internal_pointer =
       reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t*>(dst);
 
@@ -173,9 +250,9 @@ extern "C" cugraph_error_code_t cugraph_type_erased_device_array_copy_from_host(
       return CUGRAPH_INVALID_HANDLE;
     }
 
-    raft::update_device(reinterpret_cast<byte_t*>(internal_pointer->data_.data()),
+    raft::update_device(reinterpret_cast<byte_t*>(internal_pointer->data()),
                         h_src,
-                        internal_pointer->data_.size(),
+                        internal_pointer->nbytes(),
                         raft_handle->get_stream());
 
     return CUGRAPH_SUCCESS;
@@ -195,7 +272,9 @@ extern "C" cugraph_error_code_t cugraph_type_erased_device_array_copy_to_host(
   *error = nullptr;
 
   try {
-    raft::handle_t const* raft_handle = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* raft_handle = cugraph::c_api::get_raft_handle(handle);
     auto internal_pointer =
       reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(src);
 
@@ -206,8 +285,8 @@ extern "C" cugraph_error_code_t cugraph_type_erased_device_array_copy_to_host(
     }
 
     raft::update_host(h_dst,
-                      reinterpret_cast<byte_t const*>(internal_pointer->data_.data()),
-                      internal_pointer->data_.size(),
+                      reinterpret_cast<byte_t const*>(internal_pointer->data()),
+                      internal_pointer->nbytes(),
                       raft_handle->get_stream());
 
     return CUGRAPH_SUCCESS;
@@ -217,3 +296,274 @@ extern "C" cugraph_error_code_t cugraph_type_erased_device_array_copy_to_host(
     return CUGRAPH_UNKNOWN_ERROR;
   }
 }
+
+extern "C" cugraph_error_code_t cugraph_type_erased_device_array_from_dlpack(
+  const cugraph_resource_handle_t* handle,
+  DLManagedTensor* tensor,
+  cugraph_type_erased_device_array_t** array,
+  cugraph_error_t** error)
+{
+  *array = nullptr;
+  *error = nullptr;
+
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* raft_handle = cugraph::c_api::get_raft_handle(handle);
+
+    if (!raft_handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    CAPI_EXPECTS(tensor != nullptr,
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: tensor is null.",
+                 *error);
+
+    auto const& dl_tensor = tensor->dl_tensor;
+    auto dtype            = cugraph::c_api::dlpack_to_data_type_id(dl_tensor.dtype);
+
+    CAPI_EXPECTS(((dl_tensor.device.device_type == kDLCUDA) ||
+                  (dl_tensor.device.device_type == kDLCUDAManaged)) &&
+                   (dl_tensor.device.device_id == cugraph::c_api::get_device_id(handle)),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: tensor should be in CUDA memory of the handle's device.",
+                 *error);
+    CAPI_EXPECTS(dtype.has_value(),
+                 CUGRAPH_UNSUPPORTED_TYPE_COMBINATION,
+                 "Invalid input arguments: tensor type should be int32, int64, float32 or float64.",
+                 *error);
+    CAPI_EXPECTS((dl_tensor.ndim == 1) && (dl_tensor.shape[0] >= 0) &&
+                   ((dl_tensor.strides == nullptr) || (dl_tensor.strides[0] == 1) ||
+                    (dl_tensor.shape[0] <= 1)),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: tensor should be one dimensional and contiguous.",
+                 *error);
+
+    auto owner = std::shared_ptr<void>(tensor, [](void* p) {
+      auto managed_tensor = static_cast<DLManagedTensor*>(p);
+      if (managed_tensor->deleter != nullptr) { managed_tensor->deleter(managed_tensor); }
+    });
+
+    auto ret_value = new cugraph::c_api::cugraph_type_erased_device_array_t(
+      static_cast<byte_t*>(dl_tensor.data) + dl_tensor.byte_offset,
+      static_cast<size_t>(dl_tensor.shape[0]),
+      *dtype,
+      std::move(owner));
+
+    *array = reinterpret_cast<cugraph_type_erased_device_array_t*>(ret_value);
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_type_erased_device_array_to_dlpack(
+  const cugraph_resource_handle_t* handle,
+  cugraph_type_erased_device_array_t* array,
+  DLManagedTensor** tensor,
+  cugraph_error_t** error)
+{
+  *tensor = nullptr;
+  *error  = nullptr;
+
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* raft_handle = cugraph::c_api::get_raft_handle(handle);
+    auto internal_pointer =
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t*>(array);
+
+    if (!raft_handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    CAPI_EXPECTS(internal_pointer != nullptr,
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: array is null.",
+                 *error);
+
+    auto context       = std::make_unique<cugraph::c_api::dlpack_export_context_t>();
+    context->owner_    = internal_pointer->share_ownership();
+    context->shape_[0] = static_cast<int64_t>(internal_pointer->size_);
+
+    auto& dl_tensor       = context->tensor_.dl_tensor;
+    dl_tensor.data        = internal_pointer->data();
+    dl_tensor.device      = DLDevice{kDLCUDA, cugraph::c_api::get_device_id(handle)};
+    dl_tensor.ndim        = 1;
+    dl_tensor.dtype       = cugraph::c_api::data_type_id_to_dlpack(internal_pointer->type_);
+    dl_tensor.shape       = context->shape_;
+    dl_tensor.strides     = nullptr;
+    dl_tensor.byte_offset = 0;
+
+    context->tensor_.manager_ctx = context.get();
+    context->tensor_.deleter     = [](DLManagedTensor* p) {
+      delete static_cast<cugraph::c_api::dlpack_export_context_t*>(p->manager_ctx);
+    };
+
+    // DLPack consumers expect the data to be ready
+    raft_handle->get_stream_view().synchronize();
+
+    *tensor = &(context.release()->tensor_);
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_type_erased_device_array_from_arrow(
+  const cugraph_resource_handle_t* handle,
+  const ArrowSchema* schema,
+  ArrowDeviceArray* device_array,
+  cugraph_type_erased_device_array_t** array,
+  cugraph_error_t** error)
+{
+  *array = nullptr;
+  *error = nullptr;
+
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* raft_handle = cugraph::c_api::get_raft_handle(handle);
+
+    if (!raft_handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    CAPI_EXPECTS((schema != nullptr) && (device_array != nullptr),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: schema or device_array is null.",
+                 *error);
+    CAPI_EXPECTS(device_array->array.release != nullptr,
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: device_array is already released.",
+                 *error);
+
+    auto const& arrow_array = device_array->array;
+    auto dtype              = cugraph::c_api::arrow_to_data_type_id(schema->format);
+
+    CAPI_EXPECTS(((device_array->device_type == ARROW_DEVICE_CUDA) ||
+                  (device_array->device_type == ARROW_DEVICE_CUDA_MANAGED)) &&
+                   (device_array->device_id == cugraph::c_api::get_device_id(handle)),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: array should be in CUDA memory of the handle's device.",
+                 *error);
+    CAPI_EXPECTS(dtype.has_value() && (schema->n_children == 0) && (schema->dictionary == nullptr),
+                 CUGRAPH_UNSUPPORTED_TYPE_COMBINATION,
+                 "Invalid input arguments: array type should be int32, int64, float32 or float64.",
+                 *error);
+    CAPI_EXPECTS((arrow_array.n_buffers == 2) && (arrow_array.length >= 0) &&
+                   (arrow_array.offset >= 0),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: array should be a primitive array.",
+                 *error);
+    CAPI_EXPECTS((arrow_array.null_count == 0) ||
+                   ((arrow_array.null_count == -1) && (arrow_array.buffers[0] == nullptr)),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: array should not have nulls.",
+                 *error);
+
+    if (device_array->sync_event != nullptr) {
+      CUDA_TRY(cudaStreamWaitEvent(
+        raft_handle->get_stream(), *static_cast<cudaEvent_t*>(device_array->sync_event), 0));
+    }
+
+    auto data = const_cast<byte_t*>(static_cast<byte_t const*>(arrow_array.buffers[1])) +
+                arrow_array.offset * ::data_type_sz[*dtype];
+    auto size = static_cast<size_t>(arrow_array.length);
+
+    // move the Arrow array, the consumer of a moved array marks the source released
+    auto moved_array            = new ArrowArray(arrow_array);
+    device_array->array.release = nullptr;
+    auto owner = std::shared_ptr<void>(moved_array, [](void* p) {
+      auto moved = static_cast<ArrowArray*>(p);
+      if (moved->release != nullptr) { moved->release(moved); }
+      delete moved;
+    });
+
+    auto ret_value = new cugraph::c_api::cugraph_type_erased_device_array_t(
+      data, size, *dtype, std::move(owner));
+
+    *array = reinterpret_cast<cugraph_type_erased_device_array_t*>(ret_value);
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_type_erased_device_array_to_arrow(
+  const cugraph_resource_handle_t* handle,
+  cugraph_type_erased_device_array_t* array,
+  ArrowSchema* schema,
+  ArrowDeviceArray* device_array,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* raft_handle = cugraph::c_api::get_raft_handle(handle);
+    auto internal_pointer =
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t*>(array);
+
+    if (!raft_handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    CAPI_EXPECTS((internal_pointer != nullptr) && (schema != nullptr) && (device_array != nullptr),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: array, schema or device_array is null.",
+                 *error);
+
+    auto context         = std::make_unique<cugraph::c_api::arrow_export_context_t>();
+    context->owner_      = internal_pointer->share_ownership();
+    context->buffers_[1] = internal_pointer->data();
+
+    // Arrow consumers expect the data to be ready when there is no sync event
+    raft_handle->get_stream_view().synchronize();
+
+    *schema = ArrowSchema{cugraph::c_api::data_type_id_to_arrow(internal_pointer->type_),
+                          "",
+                          nullptr,
+                          int64_t{0},
+                          int64_t{0},
+                          nullptr,
+                          nullptr,
+                          cugraph::c_api::release_exported_arrow_schema,
+                          nullptr};
+
+    *device_array = ArrowDeviceArray{};
+    device_array->array =
+      ArrowArray{static_cast<int64_t>(internal_pointer->size_),
+                 int64_t{0},
+                 int64_t{0},
+                 int64_t{2},
+                 int64_t{0},
+                 context->buffers_,
+                 nullptr,
+                 nullptr,
+                 cugraph::c_api::release_exported_arrow_array,
+                 context.get()};
+    device_array->device_id   = cugraph::c_api::get_device_id(handle);
+    device_array->device_type = ARROW_DEVICE_CUDA;
+    device_array->sync_event  = nullptr;
+
+    context.release();
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
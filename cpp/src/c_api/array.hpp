@@ -22,6 +22,8 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <memory>
+
 namespace cugraph {
 namespace c_api {
 
@@ -46,17 +48,57 @@ struct cugraph_type_erased_device_array_t {
   {
   }
 
+  // non-owning view over device memory owned by someone else (data_ stays empty), the memory
+  // should outlive the view
+  cugraph_type_erased_device_array_t(void* view_data, size_t size, data_type_id_t type)
+    : size_(size), type_(type), view_data_(view_data)
+  {
+  }
+
+  // view over device memory kept alive by @p owner (e.g. memory imported through DLPack or Arrow,
+  // released by the producer once the last owner goes away)
+  cugraph_type_erased_device_array_t(void* view_data,
+                                     size_t size,
+                                     data_type_id_t type,
+                                     std::shared_ptr<void> owner)
+    : size_(size), type_(type), view_data_(view_data), owner_(std::move(owner))
+  {
+  }
+
+  // Return an owner keeping the array's memory alive (nullptr for a non-owning view).  An array
+  // owning data_ moves it to a shared buffer first and becomes a view kept alive by that buffer.
+  std::shared_ptr<void> share_ownership()
+  {
+    if (!is_view() && (data_.size() > 0)) {
+      auto buffer = std::make_shared<rmm::device_buffer>(std::move(data_));
+      view_data_  = buffer->data();
+      owner_      = buffer;
+    }
+    return owner_;
+  }
+
+  bool is_view() const { return view_data_ != nullptr; }
+
+  void* data() { return is_view() ? view_data_ : data_.data(); }
+
+  void const* data() const { return is_view() ? view_data_ : data_.data(); }
+
+  size_t nbytes() const { return size_ * ::data_type_sz[type_]; }
+
   template <typename T>
   T* as_type()
   {
-    return reinterpret_cast<T*>(data_.data());
+    return reinterpret_cast<T*>(data());
   }
 
   template <typename T>
   T const* as_type() const
   {
-    return reinterpret_cast<T const*>(data_.data());
+    return reinterpret_cast<T const*>(data());
   }
+
+  void* view_data_{nullptr};
+  std::shared_ptr<void> owner_{};
 };
 
 struct cugraph_type_erased_host_array_t {
@@ -17,7 +17,11 @@
 #include <cugraph_c/algorithms.h>
 
 #include <c_api/abstract_functor.hpp>
+#include <c_api/completion.hpp>
 #include <c_api/graph.hpp>
+#include <c_api/paths_result.hpp>
+#include <c_api/resource_handle.hpp>
+#include <c_api/result_options.hpp>
 
 #include <cugraph/algorithms.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
@@ -26,15 +30,11 @@
 
 #include <raft/handle.hpp>
 
+#include <algorithm>
+
 namespace cugraph {
 namespace c_api {
 
-struct cugraph_paths_result_t {
-  cugraph_type_erased_device_array_t* vertex_ids_;
-  cugraph_type_erased_device_array_t* distances_;
-  cugraph_type_erased_device_array_t* predecessors_;
-};
-
 struct bfs_functor : public abstract_functor {
   raft::handle_t const& handle_;
   cugraph_graph_t* graph_;
@@ -43,6 +43,9 @@ struct bfs_functor : public abstract_functor {
   size_t depth_limit_;
   bool do_expensive_check_;
   bool compute_predecessors_;
+  cugraph_vertex_ids_mode_t vertex_ids_mode_;
+  cugraph_type_erased_device_array_t* distances_output_;
+  cugraph_type_erased_device_array_t* predecessors_output_;
   cugraph_paths_result_t* result_{};
 
   bfs_functor(raft::handle_t const& handle,
@@ -51,7 +54,8 @@ struct bfs_functor : public abstract_functor {
               bool direction_optimizing,
               size_t depth_limit,
               bool do_expensive_check,
-              bool compute_predecessors)
+              bool compute_predecessors,
+              cugraph_result_options_t const& options)
     : abstract_functor(),
       handle_(handle),
       graph_(graph),
@@ -59,7 +63,11 @@ struct bfs_functor : public abstract_functor {
       direction_optimizing_(direction_optimizing),
       depth_limit_(depth_limit),
       do_expensive_check_(do_expensive_check),
-      compute_predecessors_(compute_predecessors)
+      compute_predecessors_(compute_predecessors),
+      vertex_ids_mode_(options.vertex_ids_mode),
+      distances_output_(reinterpret_cast<cugraph_type_erased_device_array_t*>(options.values)),
+      predecessors_output_(
+        reinterpret_cast<cugraph_type_erased_device_array_t*>(options.predecessors))
   {
   }
 
@@ -90,16 +98,26 @@ struct bfs_functor : public abstract_functor {
 
       auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
 
-      rmm::device_uvector<vertex_t> vertex_ids(graph->get_number_of_vertices(),
-                                               handle_.get_stream());
-      rmm::device_uvector<vertex_t> distances(graph->get_number_of_vertices(),
-                                              handle_.get_stream());
-      rmm::device_uvector<vertex_t> predecessors(0, handle_.get_stream());
+      size_t num_vertices = graph->get_number_of_vertices();
 
-      if (compute_predecessors_) {
-        predecessors.resize(graph->get_number_of_vertices(), handle_.get_stream());
+      if (!is_valid_output(distances_output_, num_vertices, graph_->vertex_type_) ||
+          (compute_predecessors_ &&
+           !is_valid_output(predecessors_output_, num_vertices, graph_->vertex_type_))) {
+        error_code_            = CUGRAPH_INVALID_INPUT;
+        error_->error_message_ = "output arrays should have one vertex_t element per vertex";
+        return;
       }
 
+      // write into the caller-provided output arrays if there are any
+      rmm::device_uvector<vertex_t> distances(0, handle_.get_stream());
+      rmm::device_uvector<vertex_t> predecessors(0, handle_.get_stream());
+
+      auto distances_data = output_data(handle_, distances_output_, num_vertices, distances);
+      auto predecessors_data =
+        compute_predecessors_
+          ? output_data(handle_, predecessors_output_, num_vertices, predecessors)
+          : static_cast<vertex_t*>(nullptr);
+
       //
       // Need to renumber sources
       //
@@ -114,31 +132,127 @@ struct bfs_functor : public abstract_functor {
       cugraph::bfs<vertex_t, edge_t, weight_t, multi_gpu>(
         handle_,
         graph_view,
-        distances.data(),
-        compute_predecessors_ ? predecessors.data() : nullptr,
+        distances_data,
+        predecessors_data,
         sources_->as_type<vertex_t>(),
         sources_->size_,
         direction_optimizing_,
         static_cast<vertex_t>(depth_limit_),
         do_expensive_check_);
 
-      raft::copy(vertex_ids.data(), number_map->data(), vertex_ids.size(), handle_.get_stream());
-
       if (compute_predecessors_) {
         std::vector<vertex_t> vertex_partition_lasts = graph_view.get_vertex_partition_lasts();
 
         unrenumber_int_vertices<vertex_t, multi_gpu>(handle_,
-                                                     predecessors.data(),
-                                                     predecessors.size(),
+                                                     predecessors_data,
+                                                     num_vertices,
                                                      number_map->data(),
                                                      vertex_partition_lasts,
                                                      do_expensive_check_);
       }
 
       result_ = new cugraph_paths_result_t{
-        new cugraph_type_erased_device_array_t(std::move(vertex_ids), graph_->vertex_type_),
-        new cugraph_type_erased_device_array_t(std::move(distances), graph_->weight_type_),
-        new cugraph_type_erased_device_array_t(std::move(predecessors), graph_->weight_type_)};
+        make_vertex_ids_array(
+          handle_, *number_map, num_vertices, graph_->vertex_type_, vertex_ids_mode_),
+        make_result_array(distances_output_, std::move(distances), graph_->vertex_type_),
+        compute_predecessors_
+          ? make_result_array(predecessors_output_, std::move(predecessors), graph_->vertex_type_)
+          : new cugraph_type_erased_device_array_t(std::move(predecessors), graph_->vertex_type_)};
+    }
+  }
+};
+
+struct bfs_batch_functor : public abstract_functor {
+  // bfs_batch runs at most this many searches at once, more sources are processed in chunks
+  static constexpr size_t max_batch_size{64};
+
+  raft::handle_t const& handle_;
+  cugraph_graph_t* graph_;
+  cugraph_type_erased_device_array_t const* sources_;
+  size_t depth_limit_;
+  bool do_expensive_check_;
+  cugraph_paths_result_t* result_{};
+
+  bfs_batch_functor(raft::handle_t const& handle,
+                    cugraph_graph_t* graph,
+                    cugraph_type_erased_device_array_t const* sources,
+                    size_t depth_limit,
+                    bool do_expensive_check)
+    : abstract_functor(),
+      handle_(handle),
+      graph_(graph),
+      sources_(sources),
+      depth_limit_(depth_limit),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else if constexpr (multi_gpu) {
+      // FIXME: the multi-GPU bfs_batch orders the sources by GPU rank, chunking needs to agree on
+      // the number of sources per GPU
+      error_code_            = CUGRAPH_NOT_IMPLEMENTED;
+      error_->error_message_ = "batched BFS is not supported for multi-GPU graphs";
+    } else {
+      // BFS expects store_transposed == false
+      if constexpr (store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph =
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, false, multi_gpu>*>(
+          graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      size_t num_vertices = graph->get_number_of_vertices();
+      size_t num_sources  = sources_->size_;
+
+      // renumber a copy of the sources (the caller's array is left untouched)
+      rmm::device_uvector<vertex_t> sources(num_sources, handle_.get_stream());
+      raft::copy(
+        sources.data(), sources_->as_type<vertex_t>(), num_sources, handle_.get_stream());
+
+      renumber_ext_vertices<vertex_t, multi_gpu>(handle_,
+                                                 sources.data(),
+                                                 sources.size(),
+                                                 number_map->data(),
+                                                 graph_view.get_local_vertex_first(),
+                                                 graph_view.get_local_vertex_last(),
+                                                 do_expensive_check_);
+
+      rmm::device_uvector<vertex_t> distances(num_sources * num_vertices, handle_.get_stream());
+
+      for (size_t i = 0; i < num_sources; i += max_batch_size) {
+        cugraph::bfs_batch<vertex_t, edge_t, weight_t, multi_gpu>(
+          handle_,
+          graph_view,
+          distances.data() + i * num_vertices,
+          sources.data() + i,
+          std::min(max_batch_size, num_sources - i),
+          static_cast<vertex_t>(depth_limit_),
+          do_expensive_check_);
+      }
+
+      result_ = new cugraph_paths_result_t{
+        make_vertex_ids_array(
+          handle_, *number_map, num_vertices, graph_->vertex_type_, CUGRAPH_VERTEX_IDS_COPY),
+        new cugraph_type_erased_device_array_t(std::move(distances), graph_->vertex_type_),
+        new cugraph_type_erased_device_array_t(
+          rmm::device_uvector<vertex_t>(0, handle_.get_stream()), graph_->vertex_type_)};
     }
   }
 };
@@ -185,22 +299,50 @@ extern "C" cugraph_error_code_t cugraph_bfs(const cugraph_resource_handle_t* han
                                             bool_t compute_predecessors,
                                             cugraph_paths_result_t** result,
                                             cugraph_error_t** error)
+{
+  return cugraph_bfs_with_options(handle,
+                                  graph,
+                                  sources,
+                                  direction_optimizing,
+                                  depth_limit,
+                                  do_expensive_check,
+                                  compute_predecessors,
+                                  nullptr,
+                                  result,
+                                  error);
+}
+
+extern "C" cugraph_error_code_t cugraph_bfs_with_options(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  cugraph_type_erased_device_array_t* sources,
+  bool_t direction_optimizing,
+  size_t depth_limit,
+  bool_t do_expensive_check,
+  bool_t compute_predecessors,
+  const cugraph_result_options_t* options,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error)
 {
   *result = nullptr;
   *error  = nullptr;
 
   try {
-    auto p_handle  = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    auto p_handle  = cugraph::c_api::get_raft_handle(handle);
     auto p_graph   = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
     auto p_sources = reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t*>(sources);
 
-    cugraph::c_api::bfs_functor functor(*p_handle,
-                                        p_graph,
-                                        p_sources,
-                                        direction_optimizing,
-                                        depth_limit,
-                                        do_expensive_check,
-                                        compute_predecessors);
+    cugraph::c_api::bfs_functor functor(
+      *p_handle,
+      p_graph,
+      p_sources,
+      direction_optimizing,
+      depth_limit,
+      do_expensive_check,
+      compute_predecessors,
+      options != nullptr ? *options : cugraph::c_api::default_result_options());
 
     // FIXME:  This seems like a recurring pattern.  Can I encapsulate
     //    The vertex_dispatcher and error handling calls into a reusable function?
@@ -225,3 +367,90 @@ extern "C" cugraph_error_code_t cugraph_bfs(const cugraph_resource_handle_t* han
 
   return CUGRAPH_SUCCESS;
 }
+
+extern "C" cugraph_error_code_t cugraph_bfs_batch(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_t* sources,
+  size_t depth_limit,
+  bool_t do_expensive_check,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error)
+{
+  *result = nullptr;
+  *error  = nullptr;
+
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    auto p_handle = cugraph::c_api::get_raft_handle(handle);
+    auto p_graph  = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
+    auto p_sources =
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(sources);
+
+    CAPI_EXPECTS(p_sources->type_ == p_graph->vertex_type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "vertex type of graph and sources must match",
+                 *error);
+
+    cugraph::c_api::bfs_batch_functor functor(
+      *p_handle, p_graph, p_sources, depth_limit, do_expensive_check);
+
+    cugraph::dispatch::vertex_dispatcher(cugraph::c_api::dtypes_mapping[p_graph->vertex_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->edge_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->weight_type_],
+                                         p_graph->store_transposed_,
+                                         p_graph->multi_gpu_,
+                                         functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+
+    *result = reinterpret_cast<cugraph_paths_result_t*>(functor.result_);
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
+extern "C" cugraph_error_code_t cugraph_bfs_async(const cugraph_resource_handle_t* handle,
+                                                  cugraph_graph_t* graph,
+                                                  cugraph_type_erased_device_array_t* sources,
+                                                  bool_t direction_optimizing,
+                                                  size_t depth_limit,
+                                                  bool_t do_expensive_check,
+                                                  bool_t compute_predecessors,
+                                                  const cugraph_result_options_t* options,
+                                                  cugraph_completion_callback_t callback,
+                                                  void* user_data,
+                                                  cugraph_paths_result_t** result,
+                                                  cugraph_completion_t** completion,
+                                                  cugraph_error_t** error)
+{
+  *result = nullptr;
+
+  auto options_copy = options != nullptr ? *options : cugraph::c_api::default_result_options();
+
+  return cugraph::c_api::launch_async(
+    handle,
+    [=](cugraph_error_t** call_error) {
+      return cugraph_bfs_with_options(handle,
+                                      graph,
+                                      sources,
+                                      direction_optimizing,
+                                      depth_limit,
+                                      do_expensive_check,
+                                      compute_predecessors,
+                                      &options_copy,
+                                      result,
+                                      call_error);
+    },
+    callback,
+    user_data,
+    completion,
+    error);
+}
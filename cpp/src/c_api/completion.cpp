@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <c_api/completion.hpp>
+
+extern "C" bool_t cugraph_completion_is_ready(const cugraph_completion_t* completion)
+{
+  auto internal_pointer =
+    reinterpret_cast<cugraph::c_api::cugraph_completion_t const*>(completion);
+  return internal_pointer->ready_.load(std::memory_order_acquire) ? TRUE : FALSE;
+}
+
+extern "C" cudaEvent_t cugraph_completion_get_event(const cugraph_completion_t* completion)
+{
+  auto internal_pointer =
+    reinterpret_cast<cugraph::c_api::cugraph_completion_t const*>(completion);
+  return internal_pointer->ready_.load(std::memory_order_acquire) ? internal_pointer->event_
+                                                                   : nullptr;
+}
+
+extern "C" cugraph_error_code_t cugraph_completion_wait(cugraph_completion_t* completion,
+                                                        cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_completion_t*>(completion);
+
+  if (internal_pointer->future_.valid()) { internal_pointer->future_.get(); }
+
+  if (internal_pointer->error_code_ != CUGRAPH_SUCCESS) {
+    *error                   = internal_pointer->error_;
+    internal_pointer->error_ = nullptr;
+    return internal_pointer->error_code_;
+  }
+
+  if (cudaEventSynchronize(internal_pointer->event_) != cudaSuccess) {
+    *error = reinterpret_cast<cugraph_error_t*>(
+      new cugraph::c_api::cugraph_error_t{"failed to synchronize the completion event"});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
+extern "C" void cugraph_completion_free(cugraph_completion_t* completion)
+{
+  delete reinterpret_cast<cugraph::c_api::cugraph_completion_t*>(completion);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph_c/cugraph_api.h>
+
+#include <c_api/error.hpp>
+#include <c_api/resource_handle.hpp>
+
+#include <raft/handle.hpp>
+
+#include <atomic>
+#include <future>
+#include <memory>
+
+namespace cugraph {
+namespace c_api {
+
+struct cugraph_completion_t {
+  std::future<void> future_{};
+  std::atomic<bool> ready_{false};  // set once the host side of the call has returned
+  cugraph_error_code_t error_code_{CUGRAPH_SUCCESS};
+  ::cugraph_error_t* error_{nullptr};  // handed over to the caller by the first wait
+  cudaEvent_t event_{nullptr};
+
+  ~cugraph_completion_t()
+  {
+    if (future_.valid()) { future_.wait(); }
+    if (event_ != nullptr) { cudaEventDestroy(event_); }
+    delete reinterpret_cast<cugraph_error_t*>(error_);
+  }
+};
+
+/**
+ * Run @p call (a callable taking a ::cugraph_error_t** and returning a cugraph_error_code_t, e.g. a
+ * synchronous cugraph_* call) on a worker thread. The call enqueues its device work on @p
+ * handle's stream; an event is recorded on the stream once the call returns.
+ *
+ * This only moves the host side of the call off the calling thread, it is not stream-asynchronous:
+ * the call still synchronizes its stream wherever the synchronous call does. Each pending
+ * completion holds a dedicated thread (std::async with std::launch::async) until the call returns.
+ */
+template <typename call_t>
+cugraph_error_code_t launch_async(::cugraph_resource_handle_t const* handle,
+                                  call_t call,
+                                  cugraph_completion_callback_t callback,
+                                  void* user_data,
+                                  ::cugraph_completion_t** completion,
+                                  ::cugraph_error_t** error)
+{
+  *completion = nullptr;
+  *error      = nullptr;
+
+  auto p_handle = reinterpret_cast<cugraph_resource_handle_t const*>(handle);
+  if ((p_handle == nullptr) || !(p_handle->handle_)) {
+    *error = reinterpret_cast<::cugraph_error_t*>(new cugraph_error_t{"invalid resource handle"});
+    return CUGRAPH_INVALID_HANDLE;
+  }
+
+  // with the (per-thread) default stream, the worker thread's work would not be ordered with
+  // the caller's stream
+  auto stream_view = p_handle->handle_->get_stream_view();
+  if (stream_view.is_default() || stream_view.is_per_thread_default()) {
+    *error = reinterpret_cast<::cugraph_error_t*>(
+      new cugraph_error_t{"asynchronous calls need a resource handle with a non-default stream"});
+    return CUGRAPH_INVALID_HANDLE;
+  }
+
+  try {
+    auto p_completion = std::make_unique<cugraph_completion_t>();
+    auto raw          = p_completion.get();
+
+    auto stream = stream_view.value();
+    auto device = p_handle->device_id_;
+
+    raw->future_ = std::async(std::launch::async, [=]() {
+      if (cudaSetDevice(device) != cudaSuccess) {
+        raw->error_code_ = CUGRAPH_UNKNOWN_ERROR;
+        raw->error_      = reinterpret_cast<::cugraph_error_t*>(
+          new cugraph_error_t{"failed to set the device of the worker thread"});
+      } else {
+        raw->error_code_ = call(&(raw->error_));
+      }
+      if (raw->error_code_ == CUGRAPH_SUCCESS) {
+        cudaEvent_t event{};
+        if ((cudaEventCreateWithFlags(&event, cudaEventDisableTiming) == cudaSuccess) &&
+            (cudaEventRecord(event, stream) == cudaSuccess)) {
+          raw->event_ = event;
+        } else {
+          raw->error_code_ = CUGRAPH_UNKNOWN_ERROR;
+          raw->error_      = reinterpret_cast<::cugraph_error_t*>(
+            new cugraph_error_t{"failed to record the completion event"});
+        }
+      }
+      raw->ready_.store(true, std::memory_order_release);
+      if (callback != nullptr) { callback(raw->error_code_, user_data); }
+    });
+
+    *completion = reinterpret_cast<::cugraph_completion_t*>(p_completion.release());
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<::cugraph_error_t*>(new cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+}  // namespace c_api
+}  // namespace cugraph
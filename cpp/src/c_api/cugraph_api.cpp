@@ -15,18 +15,359 @@
  */
 
 #include <cugraph_c/cugraph_api.h>
+
+#include <c_api/error.hpp>
+#include <c_api/resource_handle.hpp>
 #include <cugraph/api_helpers.hpp>
+#include <cugraph/utilities/error.hpp>
 
 #include <cugraph/visitors/rw_visitor.hpp>
 
 #include <cugraph/visitors/erased_api.hpp>
 
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
 
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/arena_memory_resource.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/pool_memory_resource.hpp>
+
+#include <thrust/optional.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+namespace c_api {
+
+namespace {
+
+// [first_, last_) address range of a device memory block a handle's memory resource allocated from
+// its upstream resource
+struct address_range_t {
+  std::uintptr_t first_{};
+  std::uintptr_t last_{};
+  handle_memory_resource_t* owner_{};
+};
+
+// Address ranges of the upstream blocks of every handle's memory resource. The sorted range list
+// is copied and republished on every (rare) update, when a pool or an arena grows or is destroyed,
+// so finding the owner of a pointer takes no lock. Replaced lists are kept (a concurrent find may
+// still be reading them), their number grows only with the number of upstream blocks allocated.
+class address_range_registry_t {
+ public:
+  address_range_registry_t() { publish(std::make_unique<std::vector<address_range_t>>()); }
+
+  void insert(address_range_t range)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto ranges = std::make_unique<std::vector<address_range_t>>(*(ranges_.load()));
+    ranges->insert(std::upper_bound(ranges->begin(),
+                                    ranges->end(),
+                                    range.first_,
+                                    [](auto first, auto const& r) { return first < r.first_; }),
+                   range);
+    publish(std::move(ranges));
+  }
+
+  void erase(std::uintptr_t first)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto ranges = std::make_unique<std::vector<address_range_t>>(*(ranges_.load()));
+    ranges->erase(std::remove_if(ranges->begin(),
+                                 ranges->end(),
+                                 [first](auto const& r) { return r.first_ == first; }),
+                  ranges->end());
+    publish(std::move(ranges));
+  }
+
+  handle_memory_resource_t* find(void const* ptr) const
+  {
+    auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    auto ranges  = ranges_.load(std::memory_order_acquire);
+    auto it      = std::upper_bound(ranges->begin(),
+                               ranges->end(),
+                               address,
+                               [](auto a, auto const& r) { return a < r.first_; });
+    if (it == ranges->begin()) { return nullptr; }
+    --it;
+    return address < it->last_ ? it->owner_ : nullptr;
+  }
+
+ private:
+  void publish(std::unique_ptr<std::vector<address_range_t>> ranges)
+  {
+    ranges_.store(ranges.get(), std::memory_order_release);
+    published_.push_back(std::move(ranges));
+  }
+
+  std::mutex mutex_{};
+  std::vector<std::unique_ptr<std::vector<address_range_t>>> published_{};
+  std::atomic<std::vector<address_range_t> const*> ranges_{nullptr};
+};
+
+address_range_registry_t& get_address_range_registry()
+{
+  // never freed, device buffers may be freed by static destructors
+  static auto registry = new address_range_registry_t{};
+  return *registry;
+}
+
+// CUDA memory resource registering the address ranges it allocates as owned by a handle's memory
+// resource (the upstream resource of the handle's pool or arena), see memory_resource_router_t
+class tracked_upstream_t final : public rmm::mr::device_memory_resource {
+ public:
+  explicit tracked_upstream_t(handle_memory_resource_t* owner) : owner_(owner) {}
+
+  bool supports_streams() const noexcept override { return false; }
+
+  bool supports_get_mem_info() const noexcept override { return true; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    auto ptr   = upstream_.allocate(bytes, stream);
+    auto first = reinterpret_cast<std::uintptr_t>(ptr);
+    try {
+      get_address_range_registry().insert(address_range_t{first, first + bytes, owner_});
+    } catch (...) {
+      upstream_.deallocate(ptr, bytes, stream);
+      throw;
+    }
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    // unregister first, the address range may be reused as soon as it is freed
+    get_address_range_registry().erase(reinterpret_cast<std::uintptr_t>(ptr));
+    upstream_.deallocate(ptr, bytes, stream);
+  }
+
+  bool do_is_equal(rmm::mr::device_memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override
+  {
+    return upstream_.get_mem_info(stream);
+  }
+
+  rmm::mr::cuda_memory_resource upstream_{};
+  handle_memory_resource_t* owner_{};
+};
+
+}  // namespace
+
+// Memory resource (a pool or an arena) of a resource handle, reference counted by the handle and
+// by every outstanding allocation; destroyed once the handle is freed and its last allocation is
+// deallocated.
+class handle_memory_resource_t {
+ public:
+  explicit handle_memory_resource_t(cugraph_resource_handle_config_t const& config)
+    : upstream_(this)
+  {
+    if (config.memory_resource_type == CUGRAPH_MEMORY_RESOURCE_POOL) {
+      memory_resource_ = std::make_unique<rmm::mr::pool_memory_resource<tracked_upstream_t>>(
+        &upstream_,
+        config.initial_pool_size > 0 ? thrust::optional<size_t>{config.initial_pool_size}
+                                     : thrust::nullopt,
+        config.maximum_pool_size > 0 ? thrust::optional<size_t>{config.maximum_pool_size}
+                                     : thrust::nullopt);
+    } else {
+      CUGRAPH_EXPECTS(config.memory_resource_type == CUGRAPH_MEMORY_RESOURCE_ARENA,
+                      "invalid memory_resource_type");
+      using arena_t = rmm::mr::arena_memory_resource<tracked_upstream_t>;
+      if (config.initial_pool_size == 0) {
+        memory_resource_ = std::make_unique<arena_t>(&upstream_);
+      } else if (config.maximum_pool_size == 0) {
+        memory_resource_ = std::make_unique<arena_t>(&upstream_, config.initial_pool_size);
+      } else {
+        memory_resource_ = std::make_unique<arena_t>(
+          &upstream_, config.initial_pool_size, config.maximum_pool_size);
+      }
+    }
+  }
+
+  handle_memory_resource_t(handle_memory_resource_t const&) = delete;
+  handle_memory_resource_t& operator=(handle_memory_resource_t const&) = delete;
+
+  // called only from a C API call on the owning handle, so the handle holds a reference
+  void* allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+  {
+    auto ptr = memory_resource_->allocate(bytes, stream);
+    if (ptr != nullptr) { reference_count_.fetch_add(1, std::memory_order_relaxed); }
+    return ptr;
+  }
+
+  void deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream)
+  {
+    memory_resource_->deallocate(ptr, bytes, stream);
+    release();  // may destroy a freed handle's memory resource
+  }
+
+  void release()
+  {
+    if (reference_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) { delete this; }
+  }
+
+ private:
+  ~handle_memory_resource_t() = default;
+
+  // declared before memory_resource_ to outlive it
+  tracked_upstream_t upstream_;
+  std::unique_ptr<rmm::mr::device_memory_resource> memory_resource_{};
+  std::atomic<std::size_t> reference_count_{1};
+};
+
+namespace {
+
+// memory resource the calling thread's allocations are routed to (see memory_resource_scope_t)
+struct thread_memory_resource_t {
+  int device_id_{-1};
+  handle_memory_resource_t* memory_resource_{nullptr};
+};
+
+thread_memory_resource_t& get_thread_memory_resource()
+{
+  thread_local thread_memory_resource_t thread_memory_resource{};
+  return thread_memory_resource;
+}
+
+// Device-wide memory resource routing each allocation to the calling thread's memory resource
+// (the memory resource of the resource handle of the C API call running on this thread, if any)
+// or to the device's previous resource (otherwise). Deallocations find the handle's memory
+// resource owning a pointer by the address ranges of its upstream blocks (a lock-free lookup, so
+// freeing memory not allocated through the C API stays cheap). Every routed allocation keeps its
+// memory resource alive until it is deallocated, so buffers can outlive the resource handle they
+// were allocated through, and resource handles can be freed in any order.
+class memory_resource_router_t final : public rmm::mr::device_memory_resource {
+ public:
+  memory_resource_router_t(int device_id, rmm::mr::device_memory_resource* previous_resource)
+    : device_id_(device_id), previous_resource_(previous_resource)
+  {
+  }
+
+  bool supports_streams() const noexcept override { return true; }
+
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    auto const& thread_memory_resource = get_thread_memory_resource();
+    if ((thread_memory_resource.memory_resource_ == nullptr) ||
+        (thread_memory_resource.device_id_ != device_id_)) {
+      return previous_resource_->allocate(bytes, stream);
+    }
+    return thread_memory_resource.memory_resource_->allocate(bytes, stream);
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    if (ptr == nullptr) { return; }
+    auto memory_resource = get_address_range_registry().find(ptr);
+    if (memory_resource != nullptr) {
+      memory_resource->deallocate(ptr, bytes, stream);
+    } else {
+      previous_resource_->deallocate(ptr, bytes, stream);
+    }
+  }
+
+  bool do_is_equal(rmm::mr::device_memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view) const override
+  {
+    return std::make_pair(std::size_t{0}, std::size_t{0});
+  }
+
+  int device_id_{};
+  rmm::mr::device_memory_resource* previous_resource_{};
+};
+
+// restores the calling thread's current device on scope exit
+class device_restorer_t {
+ public:
+  device_restorer_t() { CUDA_TRY(cudaGetDevice(&device_id_)); }
+  ~device_restorer_t() { cudaSetDevice(device_id_); }
+
+  device_restorer_t(device_restorer_t const&) = delete;
+  device_restorer_t& operator=(device_restorer_t const&) = delete;
+
+ private:
+  int device_id_{};
+};
+
+}  // namespace
+
+cugraph_resource_handle_t::~cugraph_resource_handle_t()
+{
+  if (memory_resource_ != nullptr) { memory_resource_->release(); }
+}
+
+void install_memory_resource_router(int device_id)
+{
+  static std::mutex mutex{};
+  // never freed, device buffers keep a pointer to the resource they were allocated from and may
+  // be freed at any time (including after the application replaced the device's resource)
+  static std::map<int, memory_resource_router_t*> routers{};
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto current = rmm::mr::get_per_device_resource(rmm::cuda_device_id{device_id});
+  auto it      = routers.find(device_id);
+  if ((it != routers.end()) && (it->second == current)) { return; }
+  auto router = new memory_resource_router_t(device_id, current);
+  rmm::mr::set_per_device_resource(rmm::cuda_device_id{device_id}, router);
+  routers[device_id] = router;
+}
+
+memory_resource_scope_t::memory_resource_scope_t(::cugraph_resource_handle_t const* handle)
+{
+  auto p_handle = reinterpret_cast<cugraph_resource_handle_t const*>(handle);
+
+  CUDA_TRY(cudaGetDevice(&previous_device_id_));
+  if ((p_handle != nullptr) && (p_handle->device_id_ != previous_device_id_)) {
+    CUDA_TRY(cudaSetDevice(p_handle->device_id_));
+  }
+
+  auto& thread_memory_resource = get_thread_memory_resource();
+  previous_routed_device_id_   = thread_memory_resource.device_id_;
+  previous_memory_resource_    = thread_memory_resource.memory_resource_;
+
+  if (p_handle != nullptr) {
+    thread_memory_resource.device_id_       = p_handle->device_id_;
+    thread_memory_resource.memory_resource_ = p_handle->memory_resource_;
+  }
+}
+
+memory_resource_scope_t::~memory_resource_scope_t()
+{
+  auto& thread_memory_resource            = get_thread_memory_resource();
+  thread_memory_resource.device_id_       = previous_routed_device_id_;
+  thread_memory_resource.memory_resource_ = previous_memory_resource_;
+
+  int device_id{};
+  if ((cudaGetDevice(&device_id) == cudaSuccess) && (device_id != previous_device_id_)) {
+    cudaSetDevice(previous_device_id_);
+  }
+}
+
+}  // namespace c_api
+}  // namespace cugraph
 
 namespace helpers {
 void* raw_device_ptr(cugraph_device_buffer_t* ptr_buf)
@@ -159,7 +500,9 @@ extern "C" cugraph_error_code_t cugraph_random_walks(const cugraph_resource_hand
     graph_envelope_t& graph_envelope =
       const_cast<graph_envelope_t&>(helpers::extract_graph_envelope(ptr_graph_envelope));
 
-    raft::handle_t const* p_raft_handle = reinterpret_cast<raft::handle_t const*>(ptr_handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(ptr_handle);
+
+    raft::handle_t const* p_raft_handle = cugraph::c_api::get_raft_handle(ptr_handle);
 
     if (!p_raft_handle) return CUGRAPH_ALLOC_ERROR;
 
@@ -222,7 +565,9 @@ extern "C" cugraph_graph_envelope_t* cugraph_make_sg_graph(
   using namespace cugraph::visitors;
 
   try {
-    raft::handle_t const* p_raft_handle = reinterpret_cast<raft::handle_t const*>(p_handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(p_handle);
+
+    raft::handle_t const* p_raft_handle = cugraph::c_api::get_raft_handle(p_handle);
 
     if (!p_raft_handle || !p_src || !p_dst || !p_weights) return nullptr;
 
@@ -285,7 +630,9 @@ extern "C" cugraph_error_code_t cugraph_make_device_buffer(const cugraph_resourc
 {
   cugraph_error_code_t status = CUGRAPH_SUCCESS;
   try {
-    raft::handle_t const* p_raft_handle = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* p_raft_handle = cugraph::c_api::get_raft_handle(handle);
 
     if (!p_raft_handle) return CUGRAPH_ALLOC_ERROR;
 
@@ -314,7 +661,9 @@ extern "C" cugraph_error_code_t cugraph_update_device_buffer(
   cugraph_error_code_t status = CUGRAPH_SUCCESS;
 
   try {
-    raft::handle_t const* ptr_raft_handle = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* ptr_raft_handle = cugraph::c_api::get_raft_handle(handle);
 
     if (!ptr_raft_handle) return CUGRAPH_ALLOC_ERROR;
 
@@ -335,7 +684,9 @@ extern "C" cugraph_error_code_t cugraph_update_host_buffer(const cugraph_resourc
   cugraph_error_code_t status = CUGRAPH_SUCCESS;
 
   try {
-    raft::handle_t const* ptr_raft_handle = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    raft::handle_t const* ptr_raft_handle = cugraph::c_api::get_raft_handle(handle);
 
     if (!ptr_raft_handle) return CUGRAPH_ALLOC_ERROR;
 
@@ -353,14 +704,78 @@ extern "C" cugraph_error_code_t cugraph_update_host_buffer(const cugraph_resourc
 extern "C" cugraph_resource_handle_t* cugraph_create_resource_handle(void)
 {
   try {
-    return reinterpret_cast<cugraph_resource_handle_t*>(new raft::handle_t{});
+    auto p_handle     = new cugraph::c_api::cugraph_resource_handle_t{};
+    p_handle->handle_ = std::make_shared<raft::handle_t>();
+    CUDA_TRY(cudaGetDevice(&(p_handle->device_id_)));
+    return reinterpret_cast<cugraph_resource_handle_t*>(p_handle);
   } catch (...) {
     return nullptr;
   }
 }
 
+extern "C" void cugraph_resource_handle_config_init(cugraph_resource_handle_config_t* config)
+{
+  config->device_id            = -1;
+  config->stream               = nullptr;
+  config->num_internal_streams = 0;
+  config->memory_resource_type = CUGRAPH_MEMORY_RESOURCE_CURRENT;
+  config->initial_pool_size    = 0;
+  config->maximum_pool_size    = 0;
+}
+
+extern "C" cugraph_error_code_t cugraph_create_resource_handle_from_config(
+  const cugraph_resource_handle_config_t* config,
+  cugraph_resource_handle_t** handle,
+  cugraph_error_t** error)
+{
+  *handle = nullptr;
+  *error  = nullptr;
+
+  CAPI_EXPECTS(config != nullptr, CUGRAPH_INVALID_INPUT, "invalid config", *error);
+  CAPI_EXPECTS(config->num_internal_streams >= 0,
+               CUGRAPH_INVALID_INPUT,
+               "num_internal_streams should be non-negative",
+               *error);
+  CAPI_EXPECTS((config->memory_resource_type != CUGRAPH_MEMORY_RESOURCE_ARENA) ||
+                 (config->maximum_pool_size == 0) || (config->initial_pool_size > 0),
+               CUGRAPH_INVALID_INPUT,
+               "initial_pool_size should be set if maximum_pool_size is set for an arena",
+               *error);
+  CAPI_EXPECTS((config->memory_resource_type == CUGRAPH_MEMORY_RESOURCE_CURRENT) ||
+                 (config->memory_resource_type == CUGRAPH_MEMORY_RESOURCE_POOL) ||
+                 (config->memory_resource_type == CUGRAPH_MEMORY_RESOURCE_ARENA),
+               CUGRAPH_INVALID_INPUT,
+               "invalid memory_resource_type",
+               *error);
+
+  try {
+    // the handle's resources are created on the handle's device, the caller's device is restored
+    // (declared first to restore the device after a partially created handle is destroyed)
+    cugraph::c_api::device_restorer_t device_restorer{};
+    auto p_handle = std::make_unique<cugraph::c_api::cugraph_resource_handle_t>();
+
+    if (config->device_id >= 0) { CUDA_TRY(cudaSetDevice(config->device_id)); }
+    CUDA_TRY(cudaGetDevice(&(p_handle->device_id_)));
+
+    // the handle's memory resource serves only the calls on this handle (RMM memory resources are
+    // per device, the calls go through a device-wide router, see memory_resource_scope_t)
+    if (config->memory_resource_type != CUGRAPH_MEMORY_RESOURCE_CURRENT) {
+      p_handle->memory_resource_ = new cugraph::c_api::handle_memory_resource_t(*config);
+      cugraph::c_api::install_memory_resource_router(p_handle->device_id_);
+    }
+
+    p_handle->handle_ = std::make_shared<raft::handle_t>(config->num_internal_streams);
+    if (config->stream != nullptr) { p_handle->handle_->set_stream(config->stream); }
+
+    *handle = reinterpret_cast<cugraph_resource_handle_t*>(p_handle.release());
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
 extern "C" void cugraph_free_resource_handle(cugraph_resource_handle_t* p_handle)
 {
-  raft::handle_t* p_raft_handle = reinterpret_cast<raft::handle_t*>(p_handle);
-  delete p_raft_handle;
+  delete reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t*>(p_handle);
 }
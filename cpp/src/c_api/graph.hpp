@@ -21,11 +21,37 @@
 
 #include <cugraph/graph.hpp>
 
+#include <array>
 #include <memory>
+#include <mutex>
 
 namespace cugraph {
 namespace c_api {
 
+// Storage of a graph in the graph registry, shared read-only by all the graphs opened from the
+// registry. The storage transposed copy and the out-weight sums are created on first use and
+// cached for every other user of the same entry.
+struct shared_graph_t {
+  struct layout_t {
+    void* graph_{nullptr};            // graph_t<...>*
+    void* number_map_{nullptr};       // rmm::device_uvector<vertex_t>*
+    void* out_weight_sums_{nullptr};  // rmm::device_uvector<weight_t>*
+  };
+
+  data_type_id_t vertex_type_;
+  data_type_id_t edge_type_;
+  data_type_id_t weight_type_;
+  bool multi_gpu_;
+
+  // handle every graph_t of this entry is built with, kept alive until the entry is freed
+  std::shared_ptr<raft::handle_t const> handle_{};
+
+  std::array<layout_t, 2> layouts_{};  // indexed by store_transposed
+  std::mutex mutex_;
+
+  ~shared_graph_t();
+};
+
 struct cugraph_graph_t {
   data_type_id_t vertex_type_;
   data_type_id_t edge_type_;
@@ -35,8 +61,30 @@ struct cugraph_graph_t {
 
   void* graph_;       // graph_t<...>*
   void* number_map_;  // rmm::device_uvector<vertex_t>*
+
+  // set if this graph was opened from the graph registry, graph_ and number_map_ then point to
+  // the storage of the shared entry and must not be modified or freed through this object
+  std::shared_ptr<shared_graph_t> shared_{};
+
+  // handle of the resource handle the graph was created on, graph_ keeps a pointer to it (and
+  // transposed copies are built with it) so it is kept alive as long as this object
+  std::shared_ptr<raft::handle_t const> handle_{};
 };
 
+/**
+ * @brief Return the handle the graph_t objects of @p graph are built with.
+ *
+ * The handle is synchronized with @p handle (the handle of the call) if they differ, the caller
+ * should synchronize the returned handle's stream before the results are used on @p handle.
+ */
+inline raft::handle_t const& get_graph_handle(raft::handle_t const& handle,
+                                              cugraph_graph_t const* graph)
+{
+  if (!graph->handle_ || (graph->handle_.get() == &handle)) { return handle; }
+  handle.get_stream_view().synchronize();
+  return *(graph->handle_);
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -47,6 +95,49 @@ cugraph_error_code_t transpose_storage(raft::handle_t const& handle,
                                        cugraph_error_t* error)
 {
   if (store_transposed == graph->store_transposed_) {
+    auto const& graph_handle = get_graph_handle(handle, graph);
+
+    if (graph->shared_) {
+      // never transpose the shared storage in place, point this graph to the cached copy instead
+      auto& shared = *(graph->shared_);
+      std::lock_guard<std::mutex> lock(shared.mutex_);
+
+      auto& from = shared.layouts_[store_transposed];
+      auto& to   = shared.layouts_[!store_transposed];
+      if (to.graph_ == nullptr) {
+        auto p_graph = reinterpret_cast<
+          cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>*>(from.graph_);
+
+        rmm::device_uvector<vertex_t> number_map(
+          *reinterpret_cast<rmm::device_uvector<vertex_t>*>(from.number_map_),
+          graph_handle.get_stream());
+
+        auto graph_transposed = std::make_unique<
+          cugraph::graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>>(
+          graph_handle);
+
+        std::optional<rmm::device_uvector<vertex_t>> new_number_map;
+
+        std::tie(*graph_transposed, new_number_map) =
+          p_graph->transpose_storage(graph_handle, std::move(number_map), false);
+
+        auto new_number_map_ptr =
+          new rmm::device_uvector<vertex_t>(std::move(new_number_map.value()));
+
+        // graphs opened from the same entry may run on other streams
+        graph_handle.get_stream_view().synchronize();
+
+        to.graph_      = graph_transposed.release();
+        to.number_map_ = new_number_map_ptr;
+      }
+
+      graph->graph_            = to.graph_;
+      graph->number_map_       = to.number_map_;
+      graph->store_transposed_ = !store_transposed;
+
+      return CUGRAPH_SUCCESS;
+    }
+
     auto p_graph =
       reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>*>(
         graph->graph_);
@@ -54,17 +145,19 @@ cugraph_error_code_t transpose_storage(raft::handle_t const& handle,
     auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph->number_map_);
 
     auto graph_transposed =
-      new cugraph::graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>(handle);
+      new cugraph::graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>(graph_handle);
 
     std::optional<rmm::device_uvector<vertex_t>> new_number_map;
 
     std::tie(*graph_transposed, new_number_map) =
-      p_graph->transpose_storage(handle, std::move(*number_map), true);
+      p_graph->transpose_storage(graph_handle, std::move(*number_map), true);
 
     *number_map = std::move(new_number_map.value());
 
     delete p_graph;
 
+    if (&graph_handle != &handle) { graph_handle.get_stream_view().synchronize(); }
+
     graph->graph_            = graph_transposed;
     graph->store_transposed_ = !store_transposed;
 
@@ -75,5 +168,42 @@ cugraph_error_code_t transpose_storage(raft::handle_t const& handle,
   }
 }
 
+/**
+ * @brief Return the out-weight sums of a graph opened from the graph registry.
+ *
+ * The sums are computed on first use for each storage layout of the shared entry and reused by
+ * every later caller. Returns nullptr if @p graph is not shared.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+weight_t const* cached_out_weight_sums(raft::handle_t const& handle, cugraph_graph_t const* graph)
+{
+  if (!graph->shared_) return nullptr;
+
+  auto& shared = *(graph->shared_);
+  std::lock_guard<std::mutex> lock(shared.mutex_);
+
+  auto& layout = shared.layouts_[store_transposed];
+  if (layout.out_weight_sums_ == nullptr) {
+    auto p_graph =
+      reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>*>(
+        layout.graph_);
+
+    auto const& graph_handle = get_graph_handle(handle, graph);
+
+    auto out_weight_sums = new rmm::device_uvector<weight_t>(
+      p_graph->view().compute_out_weight_sums(graph_handle));
+
+    graph_handle.get_stream_view().synchronize();
+
+    layout.out_weight_sums_ = out_weight_sums;
+  }
+
+  return reinterpret_cast<rmm::device_uvector<weight_t> const*>(layout.out_weight_sums_)->data();
+}
+
 }  // namespace c_api
 }  // namespace cugraph
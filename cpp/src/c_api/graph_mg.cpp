@@ -15,6 +15,7 @@
  */
 
 #include <cugraph_c/graph.h>
+#include <c_api/graph.hpp>
 
 extern "C" cugraph_error_code_t cugraph_mg_graph_create(
   const cugraph_resource_handle_t* handle,
@@ -35,4 +36,9 @@ extern "C" cugraph_error_code_t cugraph_mg_graph_create(
   return CUGRAPH_NOT_IMPLEMENTED;
 }
 
-extern "C" void cugraph_mg_graph_free(cugraph_graph_t* ptr_graph) {}
+extern "C" void cugraph_mg_graph_free(cugraph_graph_t* ptr_graph)
+{
+  // only graphs opened from the registry can exist here for now
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(ptr_graph);
+  if (internal_pointer && internal_pointer->shared_) { delete internal_pointer; }
+}
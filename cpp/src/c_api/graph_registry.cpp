@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph_c/graph.h>
+#include <c_api/abstract_functor.hpp>
+#include <c_api/error.hpp>
+#include <c_api/graph.hpp>
+
+#include <cugraph/visitors/generic_cascaded_dispatch.hpp>
+
+#include <map>
+#include <string>
+
+namespace cugraph {
+namespace c_api {
+
+struct destroy_shared_layout_functor : public abstract_functor {
+  shared_graph_t::layout_t& layout_;
+
+  destroy_shared_layout_functor(shared_graph_t::layout_t& layout)
+    : abstract_functor(), layout_(layout)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    delete reinterpret_cast<
+      cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>*>(layout_.graph_);
+    delete reinterpret_cast<rmm::device_uvector<vertex_t>*>(layout_.number_map_);
+    delete reinterpret_cast<rmm::device_uvector<weight_t>*>(layout_.out_weight_sums_);
+  }
+};
+
+shared_graph_t::~shared_graph_t()
+{
+  for (size_t i = 0; i < layouts_.size(); ++i) {
+    if (layouts_[i].graph_ == nullptr) continue;
+
+    destroy_shared_layout_functor functor(layouts_[i]);
+
+    cugraph::dispatch::vertex_dispatcher(dtypes_mapping[vertex_type_],
+                                         dtypes_mapping[edge_type_],
+                                         dtypes_mapping[weight_type_],
+                                         i == 1,
+                                         multi_gpu_,
+                                         functor);
+  }
+}
+
+namespace {
+
+struct graph_registry_t {
+  std::mutex mutex_;
+  std::map<std::string, std::shared_ptr<shared_graph_t>> entries_;
+};
+
+graph_registry_t& get_graph_registry()
+{
+  static graph_registry_t registry{};
+  return registry;
+}
+
+}  // namespace
+
+}  // namespace c_api
+}  // namespace cugraph
+
+extern "C" cugraph_error_code_t cugraph_graph_registry_register(const char* name,
+                                                                cugraph_graph_t* graph,
+                                                                cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  auto p_graph = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
+
+  CAPI_EXPECTS(
+    name != nullptr, CUGRAPH_INVALID_INPUT, "Invalid input arguments: name is null.", *error);
+  CAPI_EXPECTS(p_graph != nullptr,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: graph is null.",
+               *error);
+  CAPI_EXPECTS(!p_graph->shared_,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: graph was opened from the registry.",
+               *error);
+
+  try {
+    auto& registry = cugraph::c_api::get_graph_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+
+    CAPI_EXPECTS(registry.entries_.find(name) == registry.entries_.end(),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: a graph is already registered with this name.",
+                 *error);
+
+    auto shared          = std::make_shared<cugraph::c_api::shared_graph_t>();
+    shared->vertex_type_ = p_graph->vertex_type_;
+    shared->edge_type_   = p_graph->edge_type_;
+    shared->weight_type_ = p_graph->weight_type_;
+    shared->multi_gpu_   = p_graph->multi_gpu_;
+    shared->handle_      = p_graph->handle_;
+
+    auto& layout       = shared->layouts_[p_graph->store_transposed_ ? 1 : 0];
+    layout.graph_      = p_graph->graph_;
+    layout.number_map_ = p_graph->number_map_;
+
+    registry.entries_.emplace(name, std::move(shared));
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  // the storage now belongs to the registry
+  delete p_graph;
+
+  return CUGRAPH_SUCCESS;
+}
+
+extern "C" cugraph_error_code_t cugraph_graph_registry_open(const char* name,
+                                                            cugraph_graph_t** graph,
+                                                            cugraph_error_t** error)
+{
+  *graph = nullptr;
+  *error = nullptr;
+
+  CAPI_EXPECTS(
+    name != nullptr, CUGRAPH_INVALID_INPUT, "Invalid input arguments: name is null.", *error);
+
+  try {
+    auto& registry = cugraph::c_api::get_graph_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+
+    auto it = registry.entries_.find(name);
+    CAPI_EXPECTS(it != registry.entries_.end(),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: no graph is registered with this name.",
+                 *error);
+
+    auto& shared = it->second;
+    std::lock_guard<std::mutex> shared_lock(shared->mutex_);
+
+    // open in the layout the graph was registered with (it is the only layout which is always
+    // present)
+    bool store_transposed = shared->layouts_[0].graph_ == nullptr;
+    auto& layout          = shared->layouts_[store_transposed ? 1 : 0];
+
+    *graph = reinterpret_cast<cugraph_graph_t*>(new cugraph::c_api::cugraph_graph_t{
+      shared->vertex_type_,
+      shared->edge_type_,
+      shared->weight_type_,
+      store_transposed,
+      shared->multi_gpu_,
+      layout.graph_,
+      layout.number_map_,
+      shared,
+      shared->handle_});
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
+extern "C" cugraph_error_code_t cugraph_graph_registry_unregister(const char* name,
+                                                                  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  CAPI_EXPECTS(
+    name != nullptr, CUGRAPH_INVALID_INPUT, "Invalid input arguments: name is null.", *error);
+
+  std::shared_ptr<cugraph::c_api::shared_graph_t> shared{};
+  try {
+    auto& registry = cugraph::c_api::get_graph_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+
+    auto it = registry.entries_.find(name);
+    CAPI_EXPECTS(it != registry.entries_.end(),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: no graph is registered with this name.",
+                 *error);
+
+    // release the storage (if this was the last reference) outside the registry lock
+    shared = std::move(it->second);
+    registry.entries_.erase(it);
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
@@ -19,6 +19,7 @@
 #include <c_api/array.hpp>
 #include <c_api/error.hpp>
 #include <c_api/graph.hpp>
+#include <c_api/resource_handle.hpp>
 
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
@@ -111,6 +112,7 @@ struct create_graph_functor : public abstract_functor {
           std::move(edgelist_weights),
           graph_properties_t{properties_->is_symmetric, properties_->is_multigraph},
           renumber_,
+          multi_edge_reduction_t::none,
           check_);
 
       if (renumber_) {
@@ -188,44 +190,48 @@ extern "C" cugraph_error_code_t cugraph_sg_graph_create(
   *graph = nullptr;
   *error = nullptr;
 
-  auto p_handle = reinterpret_cast<raft::handle_t const*>(handle);
-  auto p_src    = reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(src);
-  auto p_dst    = reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(dst);
-  auto p_weights =
-    reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(weights);
-
-  CAPI_EXPECTS(p_src->size_ == p_dst->size_,
-               CUGRAPH_INVALID_INPUT,
-               "Invalid input arguments: src size != dst size.",
-               *error);
-  CAPI_EXPECTS(p_src->type_ == p_dst->type_,
-               CUGRAPH_INVALID_INPUT,
-               "Invalid input arguments: src type != dst type.",
-               *error);
-  CAPI_EXPECTS(!weights || (p_weights->size_ == p_src->size_),
-               CUGRAPH_INVALID_INPUT,
-               "Invalid input arguments: src size != weights size.",
-               *error);
-
-  data_type_id_t edge_type;
-  data_type_id_t weight_type;
-
-  if (p_src->size_ < int32_threshold) {
-    edge_type = data_type_id_t::INT32;
-  } else {
-    edge_type = data_type_id_t::INT64;
-  }
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    auto p_handle = cugraph::c_api::get_raft_handle(handle);
+    auto p_src =
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(src);
+    auto p_dst =
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(dst);
+    auto p_weights =
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(weights);
+
+    CAPI_EXPECTS(p_src->size_ == p_dst->size_,
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: src size != dst size.",
+                 *error);
+    CAPI_EXPECTS(p_src->type_ == p_dst->type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: src type != dst type.",
+                 *error);
+    CAPI_EXPECTS(!weights || (p_weights->size_ == p_src->size_),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: src size != weights size.",
+                 *error);
+
+    data_type_id_t edge_type;
+    data_type_id_t weight_type;
+
+    if (p_src->size_ < int32_threshold) {
+      edge_type = data_type_id_t::INT32;
+    } else {
+      edge_type = data_type_id_t::INT64;
+    }
 
-  if (!weights) {
-    weight_type = p_weights->type_;
-  } else {
-    weight_type = data_type_id_t::FLOAT32;
-  }
+    if (!weights) {
+      weight_type = p_weights->type_;
+    } else {
+      weight_type = data_type_id_t::FLOAT32;
+    }
 
-  cugraph::c_api::create_graph_functor functor(
-    *p_handle, properties, p_src, p_dst, p_weights, renumber, check, edge_type);
+    cugraph::c_api::create_graph_functor functor(
+      *p_handle, properties, p_src, p_dst, p_weights, renumber, check, edge_type);
 
-  try {
     cugraph::dispatch::vertex_dispatcher(cugraph::c_api::dtypes_mapping[p_src->type_],
                                          cugraph::c_api::dtypes_mapping[edge_type],
                                          cugraph::c_api::dtypes_mapping[weight_type],
@@ -238,6 +244,8 @@ extern "C" cugraph_error_code_t cugraph_sg_graph_create(
       return functor.error_code_;
     }
 
+    functor.result_->handle_ = cugraph::c_api::get_shared_raft_handle(handle);
+
     *graph = reinterpret_cast<cugraph_graph_t*>(functor.result_);
   } catch (std::exception const& ex) {
     *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
@@ -251,6 +259,12 @@ extern "C" void cugraph_sg_graph_free(cugraph_graph_t* ptr_graph)
 {
   auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(ptr_graph);
 
+  // graphs opened from the registry only drop their reference to the shared storage
+  if (internal_pointer->shared_) {
+    delete internal_pointer;
+    return;
+  }
+
   cugraph::c_api::destroy_graph_functor functor(internal_pointer->graph_,
                                                 internal_pointer->number_map_);
 
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cugraph_c/algorithms.h>
+
+#include <c_api/abstract_functor.hpp>
+#include <c_api/graph.hpp>
+#include <c_api/resource_handle.hpp>
+#include <c_api/result_options.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/visitors/generic_cascaded_dispatch.hpp>
+
+#include <raft/handle.hpp>
+
+namespace cugraph {
+namespace c_api {
+
+struct cugraph_hits_result_t {
+  cugraph_type_erased_device_array_t* vertex_ids_;
+  cugraph_type_erased_device_array_t* hubs_;
+  cugraph_type_erased_device_array_t* authorities_;
+  double hub_score_differences_;
+  size_t number_of_iterations_;
+};
+
+struct hits_functor : public abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph_graph_t* graph_;
+  double epsilon_;
+  size_t max_iterations_;
+  bool normalize_;
+  bool do_expensive_check_;
+  cugraph_hits_result_t* result_{};
+
+  hits_functor(raft::handle_t const& handle,
+               cugraph_graph_t* graph,
+               double epsilon,
+               size_t max_iterations,
+               bool normalize,
+               bool do_expensive_check)
+    : abstract_functor(),
+      handle_(handle),
+      graph_(graph),
+      epsilon_(epsilon),
+      max_iterations_(max_iterations),
+      normalize_(normalize),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      // HITS expects store_transposed == true
+      if constexpr (!store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph = reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, true, multi_gpu>*>(
+        graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      size_t num_vertices = graph_view.get_number_of_local_vertices();
+
+      rmm::device_uvector<weight_t> hubs(num_vertices, handle_.get_stream());
+      rmm::device_uvector<weight_t> authorities(num_vertices, handle_.get_stream());
+
+      auto [hub_score_differences, number_of_iterations] =
+        cugraph::hits<vertex_t, edge_t, weight_t, multi_gpu>(handle_,
+                                                             graph_view,
+                                                             hubs.data(),
+                                                             authorities.data(),
+                                                             static_cast<weight_t>(epsilon_),
+                                                             max_iterations_,
+                                                             false,
+                                                             normalize_,
+                                                             do_expensive_check_);
+
+      result_ = new cugraph_hits_result_t{
+        make_vertex_ids_array(
+          handle_, *number_map, num_vertices, graph_->vertex_type_, CUGRAPH_VERTEX_IDS_COPY),
+        new cugraph_type_erased_device_array_t(std::move(hubs), graph_->weight_type_),
+        new cugraph_type_erased_device_array_t(std::move(authorities), graph_->weight_type_),
+        static_cast<double>(hub_score_differences),
+        number_of_iterations};
+    }
+  }
+};
+
+}  // namespace c_api
+}  // namespace cugraph
+
+extern "C" cugraph_type_erased_device_array_t* cugraph_hits_result_get_vertices(
+  cugraph_hits_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_hits_result_t*>(result);
+  return reinterpret_cast<cugraph_type_erased_device_array_t*>(internal_pointer->vertex_ids_);
+}
+
+extern "C" cugraph_type_erased_device_array_t* cugraph_hits_result_get_hubs(
+  cugraph_hits_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_hits_result_t*>(result);
+  return reinterpret_cast<cugraph_type_erased_device_array_t*>(internal_pointer->hubs_);
+}
+
+extern "C" cugraph_type_erased_device_array_t* cugraph_hits_result_get_authorities(
+  cugraph_hits_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_hits_result_t*>(result);
+  return reinterpret_cast<cugraph_type_erased_device_array_t*>(internal_pointer->authorities_);
+}
+
+extern "C" double cugraph_hits_result_get_hub_score_differences(cugraph_hits_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_hits_result_t*>(result);
+  return internal_pointer->hub_score_differences_;
+}
+
+extern "C" size_t cugraph_hits_result_get_number_of_iterations(cugraph_hits_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_hits_result_t*>(result);
+  return internal_pointer->number_of_iterations_;
+}
+
+extern "C" void cugraph_hits_result_free(cugraph_hits_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_hits_result_t*>(result);
+  delete internal_pointer->vertex_ids_;
+  delete internal_pointer->hubs_;
+  delete internal_pointer->authorities_;
+  delete internal_pointer;
+}
+
+extern "C" cugraph_error_code_t cugraph_hits(const cugraph_resource_handle_t* handle,
+                                             cugraph_graph_t* graph,
+                                             double epsilon,
+                                             size_t max_iterations,
+                                             bool_t normalize,
+                                             bool_t do_expensive_check,
+                                             cugraph_hits_result_t** result,
+                                             cugraph_error_t** error)
+{
+  *result = nullptr;
+  *error  = nullptr;
+
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    auto p_handle = cugraph::c_api::get_raft_handle(handle);
+    auto p_graph  = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
+
+    cugraph::c_api::hits_functor functor(
+      *p_handle, p_graph, epsilon, max_iterations, normalize, do_expensive_check);
+
+    cugraph::dispatch::vertex_dispatcher(cugraph::c_api::dtypes_mapping[p_graph->vertex_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->edge_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->weight_type_],
+                                         p_graph->store_transposed_,
+                                         p_graph->multi_gpu_,
+                                         functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+
+    *result = reinterpret_cast<cugraph_hits_result_t*>(functor.result_);
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
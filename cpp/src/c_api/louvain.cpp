@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cugraph_c/algorithms.h>
+
+#include <c_api/abstract_functor.hpp>
+#include <c_api/graph.hpp>
+#include <c_api/resource_handle.hpp>
+#include <c_api/result_options.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/visitors/generic_cascaded_dispatch.hpp>
+
+#include <raft/handle.hpp>
+
+namespace cugraph {
+namespace c_api {
+
+struct cugraph_hierarchical_clustering_result_t {
+  double modularity_;
+  size_t num_levels_;
+  cugraph_type_erased_device_array_t* vertex_ids_;
+  cugraph_type_erased_device_array_t* clusters_;
+};
+
+struct louvain_functor : public abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph_graph_t* graph_;
+  size_t max_level_;
+  double resolution_;
+  cugraph_hierarchical_clustering_result_t* result_{};
+
+  louvain_functor(raft::handle_t const& handle,
+                  cugraph_graph_t* graph,
+                  size_t max_level,
+                  double resolution)
+    : abstract_functor(),
+      handle_(handle),
+      graph_(graph),
+      max_level_(max_level),
+      resolution_(resolution)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      // Louvain expects store_transposed == false
+      if constexpr (store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph =
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, false, multi_gpu>*>(
+          graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      rmm::device_uvector<vertex_t> clusters(graph_view.get_number_of_local_vertices(),
+                                             handle_.get_stream());
+
+      auto [num_levels, modularity] = cugraph::louvain(
+        handle_, graph_view, clusters.data(), max_level_, static_cast<weight_t>(resolution_));
+
+      result_ = new cugraph_hierarchical_clustering_result_t{
+        static_cast<double>(modularity),
+        num_levels,
+        make_vertex_ids_array(
+          handle_, *number_map, clusters.size(), graph_->vertex_type_, CUGRAPH_VERTEX_IDS_COPY),
+        new cugraph_type_erased_device_array_t(std::move(clusters), graph_->vertex_type_)};
+    }
+  }
+};
+
+}  // namespace c_api
+}  // namespace cugraph
+
+extern "C" cugraph_type_erased_device_array_t* cugraph_hierarchical_clustering_result_get_vertices(
+  cugraph_hierarchical_clustering_result_t* result)
+{
+  auto internal_pointer =
+    reinterpret_cast<cugraph::c_api::cugraph_hierarchical_clustering_result_t*>(result);
+  return reinterpret_cast<cugraph_type_erased_device_array_t*>(internal_pointer->vertex_ids_);
+}
+
+extern "C" cugraph_type_erased_device_array_t* cugraph_hierarchical_clustering_result_get_clusters(
+  cugraph_hierarchical_clustering_result_t* result)
+{
+  auto internal_pointer =
+    reinterpret_cast<cugraph::c_api::cugraph_hierarchical_clustering_result_t*>(result);
+  return reinterpret_cast<cugraph_type_erased_device_array_t*>(internal_pointer->clusters_);
+}
+
+extern "C" double cugraph_hierarchical_clustering_result_get_modularity(
+  cugraph_hierarchical_clustering_result_t* result)
+{
+  auto internal_pointer =
+    reinterpret_cast<cugraph::c_api::cugraph_hierarchical_clustering_result_t*>(result);
+  return internal_pointer->modularity_;
+}
+
+extern "C" size_t cugraph_hierarchical_clustering_result_get_number_of_levels(
+  cugraph_hierarchical_clustering_result_t* result)
+{
+  auto internal_pointer =
+    reinterpret_cast<cugraph::c_api::cugraph_hierarchical_clustering_result_t*>(result);
+  return internal_pointer->num_levels_;
+}
+
+extern "C" void cugraph_hierarchical_clustering_result_free(
+  cugraph_hierarchical_clustering_result_t* result)
+{
+  auto internal_pointer =
+    reinterpret_cast<cugraph::c_api::cugraph_hierarchical_clustering_result_t*>(result);
+  delete internal_pointer->vertex_ids_;
+  delete internal_pointer->clusters_;
+  delete internal_pointer;
+}
+
+extern "C" cugraph_error_code_t cugraph_louvain(const cugraph_resource_handle_t* handle,
+                                                cugraph_graph_t* graph,
+                                                size_t max_level,
+                                                double resolution,
+                                                cugraph_hierarchical_clustering_result_t** result,
+                                                cugraph_error_t** error)
+{
+  *result = nullptr;
+  *error  = nullptr;
+
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    auto p_handle = cugraph::c_api::get_raft_handle(handle);
+    auto p_graph  = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
+
+    cugraph::c_api::louvain_functor functor(*p_handle, p_graph, max_level, resolution);
+
+    cugraph::dispatch::vertex_dispatcher(cugraph::c_api::dtypes_mapping[p_graph->vertex_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->edge_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->weight_type_],
+                                         p_graph->store_transposed_,
+                                         p_graph->multi_gpu_,
+                                         functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+
+    *result = reinterpret_cast<cugraph_hierarchical_clustering_result_t*>(functor.result_);
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
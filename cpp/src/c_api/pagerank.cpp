@@ -17,7 +17,10 @@
 #include <cugraph_c/algorithms.h>
 
 #include <c_api/abstract_functor.hpp>
+#include <c_api/completion.hpp>
 #include <c_api/graph.hpp>
+#include <c_api/resource_handle.hpp>
+#include <c_api/result_options.hpp>
 
 #include <cugraph/algorithms.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
@@ -47,6 +50,8 @@ struct pagerank_functor : public abstract_functor {
   size_t max_iterations_;
   bool has_initial_guess_;
   bool do_expensive_check_;
+  cugraph_vertex_ids_mode_t vertex_ids_mode_;
+  cugraph_type_erased_device_array_t* pageranks_output_;
   cugraph_pagerank_result_t* result_{};
 
   pagerank_functor(raft::handle_t const& handle,
@@ -58,7 +63,8 @@ struct pagerank_functor : public abstract_functor {
                    double epsilon,
                    size_t max_iterations,
                    bool has_initial_guess,
-                   bool do_expensive_check)
+                   bool do_expensive_check,
+                   cugraph_result_options_t const& options)
     : abstract_functor(),
       handle_(handle),
       graph_(graph),
@@ -69,7 +75,9 @@ struct pagerank_functor : public abstract_functor {
       epsilon_(epsilon),
       max_iterations_(max_iterations),
       has_initial_guess_(has_initial_guess),
-      do_expensive_check_(do_expensive_check)
+      do_expensive_check_(do_expensive_check),
+      vertex_ids_mode_(options.vertex_ids_mode),
+      pageranks_output_(reinterpret_cast<cugraph_type_erased_device_array_t*>(options.values))
   {
   }
 
@@ -99,10 +107,18 @@ struct pagerank_functor : public abstract_functor {
 
       auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
 
-      rmm::device_uvector<vertex_t> vertex_ids(graph->get_number_of_vertices(),
-                                               handle_.get_stream());
-      rmm::device_uvector<weight_t> pageranks(graph->get_number_of_vertices(),
-                                              handle_.get_stream());
+      size_t num_vertices = graph->get_number_of_vertices();
+
+      if (!is_valid_output(pageranks_output_, num_vertices, graph_->weight_type_)) {
+        error_code_            = CUGRAPH_INVALID_INPUT;
+        error_->error_message_ = "output array should have one weight_t element per vertex";
+        return;
+      }
+
+      // write into the caller-provided output array if there is one
+      rmm::device_uvector<weight_t> pageranks(0, handle_.get_stream());
+
+      auto pageranks_data = output_data(handle_, pageranks_output_, num_vertices, pageranks);
 
       if (personalization_vertices_ != nullptr) {
         //
@@ -117,12 +133,16 @@ struct pagerank_functor : public abstract_functor {
                                                    do_expensive_check_);
       }
 
+      // graphs opened from the registry share the out-weight sums across calls
+      weight_t const* out_weight_sums =
+        precomputed_vertex_out_weight_sums_
+          ? precomputed_vertex_out_weight_sums_->as_type<weight_t const>()
+          : cached_out_weight_sums<vertex_t, edge_t, weight_t, true, multi_gpu>(handle_, graph_);
+
       cugraph::pagerank<vertex_t, edge_t, weight_t, weight_t, multi_gpu>(
         handle_,
         graph_view,
-        precomputed_vertex_out_weight_sums_
-          ? std::make_optional(precomputed_vertex_out_weight_sums_->as_type<weight_t const>())
-          : std::nullopt,
+        out_weight_sums ? std::make_optional(out_weight_sums) : std::nullopt,
         personalization_vertices_
           ? std::make_optional(personalization_vertices_->as_type<vertex_t const>())
           : std::nullopt,
@@ -132,18 +152,17 @@ struct pagerank_functor : public abstract_functor {
         personalization_vertices_
           ? std::make_optional(static_cast<vertex_t>(personalization_vertices_->size_))
           : std::nullopt,
-        pageranks.data(),
+        pageranks_data,
         static_cast<weight_t>(alpha_),
         static_cast<weight_t>(epsilon_),
         max_iterations_,
         has_initial_guess_,
         do_expensive_check_);
 
-      raft::copy(vertex_ids.data(), number_map->data(), vertex_ids.size(), handle_.get_stream());
-
       result_ = new cugraph_pagerank_result_t{
-        new cugraph_type_erased_device_array_t(std::move(vertex_ids), graph_->vertex_type_),
-        new cugraph_type_erased_device_array_t(std::move(pageranks), graph_->weight_type_)};
+        make_vertex_ids_array(
+          handle_, *number_map, num_vertices, graph_->vertex_type_, vertex_ids_mode_),
+        make_result_array(pageranks_output_, std::move(pageranks), graph_->weight_type_)};
     }
   }
 };
@@ -184,12 +203,40 @@ extern "C" cugraph_error_code_t cugraph_pagerank(
   bool_t do_expensive_check,
   cugraph_pagerank_result_t** result,
   cugraph_error_t** error)
+{
+  return cugraph_pagerank_with_options(handle,
+                                       graph,
+                                       precomputed_vertex_out_weight_sums,
+                                       alpha,
+                                       epsilon,
+                                       max_iterations,
+                                       has_initial_guess,
+                                       do_expensive_check,
+                                       nullptr,
+                                       result,
+                                       error);
+}
+
+extern "C" cugraph_error_code_t cugraph_pagerank_with_options(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_t* precomputed_vertex_out_weight_sums,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool_t has_initial_guess,
+  bool_t do_expensive_check,
+  const cugraph_result_options_t* options,
+  cugraph_pagerank_result_t** result,
+  cugraph_error_t** error)
 {
   *result = nullptr;
   *error  = nullptr;
 
   try {
-    auto p_handle = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    auto p_handle = cugraph::c_api::get_raft_handle(handle);
     auto p_graph  = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
 
     auto p_precomputed_vertex_out_weight_sums =
@@ -205,7 +252,10 @@ extern "C" cugraph_error_code_t cugraph_pagerank(
                                              epsilon,
                                              max_iterations,
                                              has_initial_guess,
-                                             do_expensive_check);
+                                             do_expensive_check,
+                                             options != nullptr
+                                               ? *options
+                                               : cugraph::c_api::default_result_options());
 
     cugraph::dispatch::vertex_dispatcher(cugraph::c_api::dtypes_mapping[p_graph->vertex_type_],
                                          cugraph::c_api::dtypes_mapping[p_graph->edge_type_],
@@ -241,12 +291,44 @@ extern "C" cugraph_error_code_t cugraph_personalized_pagerank(
   bool_t do_expensive_check,
   cugraph_pagerank_result_t** result,
   cugraph_error_t** error)
+{
+  return cugraph_personalized_pagerank_with_options(handle,
+                                                    graph,
+                                                    precomputed_vertex_out_weight_sums,
+                                                    personalization_vertices,
+                                                    personalization_values,
+                                                    alpha,
+                                                    epsilon,
+                                                    max_iterations,
+                                                    has_initial_guess,
+                                                    do_expensive_check,
+                                                    nullptr,
+                                                    result,
+                                                    error);
+}
+
+extern "C" cugraph_error_code_t cugraph_personalized_pagerank_with_options(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_t* precomputed_vertex_out_weight_sums,
+  cugraph_type_erased_device_array_t* personalization_vertices,
+  const cugraph_type_erased_device_array_t* personalization_values,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool_t has_initial_guess,
+  bool_t do_expensive_check,
+  const cugraph_result_options_t* options,
+  cugraph_pagerank_result_t** result,
+  cugraph_error_t** error)
 {
   *result = nullptr;
   *error  = nullptr;
 
   try {
-    auto p_handle = reinterpret_cast<raft::handle_t const*>(handle);
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    auto p_handle = cugraph::c_api::get_raft_handle(handle);
     auto p_graph  = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
 
     auto p_precomputed_vertex_out_weight_sums =
@@ -257,7 +339,7 @@ extern "C" cugraph_error_code_t cugraph_personalized_pagerank(
         personalization_vertices);
     auto p_personalization_values =
       reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(
-        personalization_vertices);
+        personalization_values);
 
     cugraph::c_api::pagerank_functor functor(*p_handle,
                                              p_graph,
@@ -268,7 +350,10 @@ extern "C" cugraph_error_code_t cugraph_personalized_pagerank(
                                              epsilon,
                                              max_iterations,
                                              has_initial_guess,
-                                             do_expensive_check);
+                                             do_expensive_check,
+                                             options != nullptr
+                                               ? *options
+                                               : cugraph::c_api::default_result_options());
 
     cugraph::dispatch::vertex_dispatcher(cugraph::c_api::dtypes_mapping[p_graph->vertex_type_],
                                          cugraph::c_api::dtypes_mapping[p_graph->edge_type_],
@@ -290,3 +375,44 @@ extern "C" cugraph_error_code_t cugraph_personalized_pagerank(
 
   return CUGRAPH_SUCCESS;
 }
+
+extern "C" cugraph_error_code_t cugraph_pagerank_async(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_t* precomputed_vertex_out_weight_sums,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool_t has_initial_guess,
+  bool_t do_expensive_check,
+  const cugraph_result_options_t* options,
+  cugraph_completion_callback_t callback,
+  void* user_data,
+  cugraph_pagerank_result_t** result,
+  cugraph_completion_t** completion,
+  cugraph_error_t** error)
+{
+  *result = nullptr;
+
+  auto options_copy = options != nullptr ? *options : cugraph::c_api::default_result_options();
+
+  return cugraph::c_api::launch_async(
+    handle,
+    [=](cugraph_error_t** call_error) {
+      return cugraph_pagerank_with_options(handle,
+                                           graph,
+                                           precomputed_vertex_out_weight_sums,
+                                           alpha,
+                                           epsilon,
+                                           max_iterations,
+                                           has_initial_guess,
+                                           do_expensive_check,
+                                           &options_copy,
+                                           result,
+                                           call_error);
+    },
+    callback,
+    user_data,
+    completion,
+    error);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph_c/cugraph_api.h>
+
+#include <raft/handle.hpp>
+
+#include <memory>
+
+namespace cugraph {
+namespace c_api {
+
+class handle_memory_resource_t;
+
+struct cugraph_resource_handle_t {
+  // memory resource created for this handle (if any, e.g. a pool), reference counted by the handle
+  // and by every allocation made through it so device memory allocated by a call on this handle
+  // (e.g. result arrays) can outlive the handle
+  handle_memory_resource_t* memory_resource_{nullptr};
+  int device_id_{0};
+
+  // shared with the graphs created on this handle, graph_t objects keep a pointer to the handle
+  // they are built with so the raft handle has to outlive the graph (which may be registered in
+  // the graph registry and used after this handle is freed)
+  std::shared_ptr<raft::handle_t> handle_{};
+
+  cugraph_resource_handle_t() = default;
+  ~cugraph_resource_handle_t();
+  cugraph_resource_handle_t(cugraph_resource_handle_t const&) = delete;
+  cugraph_resource_handle_t& operator=(cugraph_resource_handle_t const&) = delete;
+};
+
+/**
+ * Make @p handle's device the calling thread's current device and route the device allocations of
+ * the calling thread to the memory resource of @p handle (the device's previous resource if
+ * @p handle has no memory resource of its own) until the scope exits; the previous device is
+ * restored on exit. Every C API call on a resource handle enters a scope, so a handle's pool serves
+ * only the calls on this handle, and other handles (and threads) on the same device are unaffected.
+ */
+class memory_resource_scope_t {
+ public:
+  explicit memory_resource_scope_t(::cugraph_resource_handle_t const* handle);
+  ~memory_resource_scope_t();
+
+  memory_resource_scope_t(memory_resource_scope_t const&) = delete;
+  memory_resource_scope_t& operator=(memory_resource_scope_t const&) = delete;
+
+ private:
+  int previous_device_id_{-1};  // calling thread's current device on entry
+  int previous_routed_device_id_{-1};
+  handle_memory_resource_t* previous_memory_resource_{nullptr};
+};
+
+// Install the memory resource router (if not installed yet) as @p device_id's current resource.
+void install_memory_resource_router(int device_id);
+
+inline raft::handle_t const* get_raft_handle(::cugraph_resource_handle_t const* handle)
+{
+  return handle != nullptr
+           ? reinterpret_cast<cugraph_resource_handle_t const*>(handle)->handle_.get()
+           : nullptr;
+}
+
+inline std::shared_ptr<raft::handle_t const> get_shared_raft_handle(
+  ::cugraph_resource_handle_t const* handle)
+{
+  return handle != nullptr ? reinterpret_cast<cugraph_resource_handle_t const*>(handle)->handle_
+                           : nullptr;
+}
+
+}  // namespace c_api
+}  // namespace cugraph
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph_c/algorithms.h>
+
+#include <c_api/array.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+namespace cugraph {
+namespace c_api {
+
+// default result options (used if the caller passes NULL)
+inline cugraph_result_options_t default_result_options()
+{
+  cugraph_result_options_t options{};
+  cugraph_result_options_init(&options);
+  return options;
+}
+
+// true if @p output is not provided or matches the expected size and type
+inline bool is_valid_output(cugraph_type_erased_device_array_t const* output,
+                            size_t size,
+                            data_type_id_t type)
+{
+  return (output == nullptr) || ((output->size_ == size) && (output->type_ == type));
+}
+
+// Return a pointer to the caller-provided @p output if there is one, otherwise allocate @p buffer
+// (@p size elements) and return its pointer.
+template <typename T>
+T* output_data(raft::handle_t const& handle,
+               cugraph_type_erased_device_array_t* output,
+               size_t size,
+               rmm::device_uvector<T>& buffer)
+{
+  if (output != nullptr) { return output->as_type<T>(); }
+  buffer.resize(size, handle.get_stream());
+  return buffer.data();
+}
+
+// Wrap the result values, a view over the caller-provided @p output if there is one, otherwise
+// @p buffer (moved).
+template <typename T>
+cugraph_type_erased_device_array_t* make_result_array(cugraph_type_erased_device_array_t* output,
+                                                      rmm::device_uvector<T>&& buffer,
+                                                      data_type_id_t type)
+{
+  return output != nullptr
+           ? new cugraph_type_erased_device_array_t(output->data(), output->size_, type)
+           : new cugraph_type_erased_device_array_t(std::move(buffer), type);
+}
+
+// Wrap the vertex ids of a result as requested by @p mode (NULL if the vertex ids are skipped).
+template <typename vertex_t>
+cugraph_type_erased_device_array_t* make_vertex_ids_array(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t>& number_map,
+  size_t size,
+  data_type_id_t type,
+  cugraph_vertex_ids_mode_t mode)
+{
+  if (mode == CUGRAPH_VERTEX_IDS_SKIP) { return nullptr; }
+  if (mode == CUGRAPH_VERTEX_IDS_VIEW) {
+    return new cugraph_type_erased_device_array_t(number_map.data(), size, type);
+  }
+  rmm::device_uvector<vertex_t> vertex_ids(size, handle.get_stream());
+  raft::copy(vertex_ids.data(), number_map.data(), vertex_ids.size(), handle.get_stream());
+  return new cugraph_type_erased_device_array_t(std::move(vertex_ids), type);
+}
+
+}  // namespace c_api
+}  // namespace cugraph
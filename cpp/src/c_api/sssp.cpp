@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph_c/algorithms.h>
+
+#include <c_api/abstract_functor.hpp>
+#include <c_api/completion.hpp>
+#include <c_api/graph.hpp>
+#include <c_api/paths_result.hpp>
+#include <c_api/resource_handle.hpp>
+#include <c_api/result_options.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/visitors/generic_cascaded_dispatch.hpp>
+
+#include <raft/handle.hpp>
+
+#include <vector>
+
+namespace cugraph {
+namespace c_api {
+
+struct sssp_functor : public abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph_graph_t* graph_;
+  cugraph_type_erased_device_array_t const* sources_;
+  double cutoff_;
+  bool compute_predecessors_;
+  bool do_expensive_check_;
+  cugraph_paths_result_t* result_{};
+
+  sssp_functor(raft::handle_t const& handle,
+               cugraph_graph_t* graph,
+               cugraph_type_erased_device_array_t const* sources,
+               double cutoff,
+               bool compute_predecessors,
+               bool do_expensive_check)
+    : abstract_functor(),
+      handle_(handle),
+      graph_(graph),
+      sources_(sources),
+      cutoff_(cutoff),
+      compute_predecessors_(compute_predecessors),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else if constexpr (multi_gpu) {
+      // FIXME: in multi-GPU, a source is local to a single GPU while every GPU should call sssp
+      error_code_            = CUGRAPH_NOT_IMPLEMENTED;
+      error_->error_message_ = "SSSP is not supported for multi-GPU graphs";
+    } else {
+      // SSSP expects store_transposed == false
+      if constexpr (store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph =
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, false, multi_gpu>*>(
+          graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      size_t num_vertices = graph->get_number_of_vertices();
+      size_t num_sources  = sources_->size_;
+
+      // renumber a copy of the sources (the caller's array is left untouched)
+      rmm::device_uvector<vertex_t> sources(num_sources, handle_.get_stream());
+      raft::copy(
+        sources.data(), sources_->as_type<vertex_t>(), num_sources, handle_.get_stream());
+
+      renumber_ext_vertices<vertex_t, multi_gpu>(handle_,
+                                                 sources.data(),
+                                                 sources.size(),
+                                                 number_map->data(),
+                                                 graph_view.get_local_vertex_first(),
+                                                 graph_view.get_local_vertex_last(),
+                                                 do_expensive_check_);
+
+      std::vector<vertex_t> h_sources(num_sources);
+      raft::update_host(h_sources.data(), sources.data(), num_sources, handle_.get_stream());
+      handle_.get_stream_view().synchronize();
+
+      rmm::device_uvector<weight_t> distances(num_sources * num_vertices, handle_.get_stream());
+      rmm::device_uvector<vertex_t> predecessors(
+        compute_predecessors_ ? num_sources * num_vertices : size_t{0}, handle_.get_stream());
+
+      // the searches share the graph view and the stream, one launch sequence per source
+      for (size_t i = 0; i < num_sources; ++i) {
+        cugraph::sssp<vertex_t, edge_t, weight_t, multi_gpu>(
+          handle_,
+          graph_view,
+          distances.data() + i * num_vertices,
+          compute_predecessors_ ? predecessors.data() + i * num_vertices : nullptr,
+          h_sources[i],
+          static_cast<weight_t>(cutoff_),
+          do_expensive_check_);
+      }
+
+      if (compute_predecessors_) {
+        std::vector<vertex_t> vertex_partition_lasts = graph_view.get_vertex_partition_lasts();
+
+        unrenumber_int_vertices<vertex_t, multi_gpu>(handle_,
+                                                     predecessors.data(),
+                                                     predecessors.size(),
+                                                     number_map->data(),
+                                                     vertex_partition_lasts,
+                                                     do_expensive_check_);
+      }
+
+      result_ = new cugraph_paths_result_t{
+        make_vertex_ids_array(
+          handle_, *number_map, num_vertices, graph_->vertex_type_, CUGRAPH_VERTEX_IDS_COPY),
+        new cugraph_type_erased_device_array_t(std::move(distances), graph_->weight_type_),
+        new cugraph_type_erased_device_array_t(std::move(predecessors), graph_->vertex_type_)};
+    }
+  }
+};
+
+}  // namespace c_api
+}  // namespace cugraph
+
+namespace {
+
+cugraph_error_code_t run_sssp(const cugraph_resource_handle_t* handle,
+                              cugraph_graph_t* graph,
+                              cugraph::c_api::cugraph_type_erased_device_array_t const* sources,
+                              double cutoff,
+                              bool_t compute_predecessors,
+                              bool_t do_expensive_check,
+                              cugraph_paths_result_t** result,
+                              cugraph_error_t** error)
+{
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    auto p_handle = cugraph::c_api::get_raft_handle(handle);
+    auto p_graph  = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
+
+    CAPI_EXPECTS(sources->type_ == p_graph->vertex_type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "vertex type of graph and sources must match",
+                 *error);
+
+    cugraph::c_api::sssp_functor functor(
+      *p_handle, p_graph, sources, cutoff, compute_predecessors, do_expensive_check);
+
+    cugraph::dispatch::vertex_dispatcher(cugraph::c_api::dtypes_mapping[p_graph->vertex_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->edge_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->weight_type_],
+                                         p_graph->store_transposed_,
+                                         p_graph->multi_gpu_,
+                                         functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+
+    *result = reinterpret_cast<cugraph_paths_result_t*>(functor.result_);
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+}  // namespace
+
+extern "C" cugraph_error_code_t cugraph_sssp(const cugraph_resource_handle_t* handle,
+                                             cugraph_graph_t* graph,
+                                             size_t source,
+                                             double cutoff,
+                                             bool_t compute_predecessors,
+                                             bool_t do_expensive_check,
+                                             cugraph_paths_result_t** result,
+                                             cugraph_error_t** error)
+{
+  *result = nullptr;
+  *error  = nullptr;
+
+  try {
+    cugraph::c_api::memory_resource_scope_t memory_resource_scope(handle);
+
+    auto p_handle = cugraph::c_api::get_raft_handle(handle);
+    auto p_graph  = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
+
+    // a single element source array, in the graph's vertex type
+    cugraph::c_api::cugraph_type_erased_device_array_t sources(
+      1, ::data_type_sz[p_graph->vertex_type_], p_graph->vertex_type_, p_handle->get_stream());
+    if (p_graph->vertex_type_ == INT32) {
+      auto v = static_cast<int32_t>(source);
+      raft::update_device(sources.as_type<int32_t>(), &v, 1, p_handle->get_stream());
+    } else {
+      auto v = static_cast<int64_t>(source);
+      raft::update_device(sources.as_type<int64_t>(), &v, 1, p_handle->get_stream());
+    }
+
+    return run_sssp(
+      handle, graph, &sources, cutoff, compute_predecessors, do_expensive_check, result, error);
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_sssp_batch(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_t* sources,
+  double cutoff,
+  bool_t compute_predecessors,
+  bool_t do_expensive_check,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error)
+{
+  *result = nullptr;
+  *error  = nullptr;
+
+  return run_sssp(
+    handle,
+    graph,
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t const*>(sources),
+    cutoff,
+    compute_predecessors,
+    do_expensive_check,
+    result,
+    error);
+}
+
+extern "C" cugraph_error_code_t cugraph_sssp_batch_async(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_t* sources,
+  double cutoff,
+  bool_t compute_predecessors,
+  bool_t do_expensive_check,
+  cugraph_completion_callback_t callback,
+  void* user_data,
+  cugraph_paths_result_t** result,
+  cugraph_completion_t** completion,
+  cugraph_error_t** error)
+{
+  *result = nullptr;
+
+  return cugraph::c_api::launch_async(
+    handle,
+    [=](cugraph_error_t** call_error) {
+      return cugraph_sssp_batch(handle,
+                                graph,
+                                sources,
+                                cutoff,
+                                compute_predecessors,
+                                do_expensive_check,
+                                result,
+                                call_error);
+    },
+    callback,
+    user_data,
+    completion,
+    error);
+}
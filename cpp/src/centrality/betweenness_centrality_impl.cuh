@@ -0,0 +1,716 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <link_analysis/batch_utils.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/dataframe_buffer.cuh>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// path counts overflow float quickly, so they are kept in double regardless of result_t
+using bc_sigma_t = double;
+
+// the path counts of the lanes (sources) for which the vertex is at the given BFS level, zeros in
+// the other lanes
+template <typename vertex_t>
+struct level_sigmas_t {
+  vertex_t const* distances{nullptr};
+  bc_sigma_t const* sigmas{nullptr};
+  size_t ld{0};
+  vertex_t level{0};
+
+  __device__ bc_sigma_t lane_value(size_t c, vertex_t i) const
+  {
+    return distances[c * ld + i] == level ? sigmas[c * ld + i] : bc_sigma_t{0.0};
+  }
+
+  __device__ batch_value_t<bc_sigma_t> operator()(vertex_t i) const
+  {
+    static_assert(batch_width == 4);
+    return thrust::make_tuple(
+      lane_value(0, i), lane_value(1, i), lane_value(2, i), lane_value(3, i));
+  }
+};
+
+// (1 + delta) / sigma of the lanes for which the vertex is at the given BFS level, zeros in the
+// other lanes
+template <typename vertex_t, typename result_t>
+struct level_dependency_ratios_t {
+  vertex_t const* distances{nullptr};
+  bc_sigma_t const* sigmas{nullptr};
+  result_t const* deltas{nullptr};
+  size_t ld{0};
+  vertex_t level{0};
+
+  __device__ bc_sigma_t lane_value(size_t c, vertex_t i) const
+  {
+    return distances[c * ld + i] == level
+             ? (bc_sigma_t{1.0} + static_cast<bc_sigma_t>(deltas[c * ld + i])) / sigmas[c * ld + i]
+             : bc_sigma_t{0.0};
+  }
+
+  __device__ batch_value_t<bc_sigma_t> operator()(vertex_t i) const
+  {
+    static_assert(batch_width == 4);
+    return thrust::make_tuple(
+      lane_value(0, i), lane_value(1, i), lane_value(2, i), lane_value(3, i));
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, bool multi_gpu>
+struct push_sigmas_e_op_t {
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition;
+  vertex_t const* distances{nullptr};
+  size_t ld{0};
+  vertex_t invalid_distance{std::numeric_limits<vertex_t>::max()};
+
+  template <typename DstValue>
+  __device__ thrust::optional<batch_value_t<bc_sigma_t>> operator()(
+    vertex_t, vertex_t dst, batch_value_t<bc_sigma_t> src_sigmas, DstValue) const
+  {
+    static_assert(batch_width == 4);
+    if (vertex_partition.is_local_vertex_nocheck(dst)) {  // skip the lanes that already reached dst
+      auto dst_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(dst);
+      if (distances[dst_offset] != invalid_distance) { thrust::get<0>(src_sigmas) = 0.0; }
+      if (distances[ld + dst_offset] != invalid_distance) { thrust::get<1>(src_sigmas) = 0.0; }
+      if (distances[2 * ld + dst_offset] != invalid_distance) { thrust::get<2>(src_sigmas) = 0.0; }
+      if (distances[3 * ld + dst_offset] != invalid_distance) { thrust::get<3>(src_sigmas) = 0.0; }
+    }
+    return ((thrust::get<0>(src_sigmas) > 0.0) || (thrust::get<1>(src_sigmas) > 0.0) ||
+            (thrust::get<2>(src_sigmas) > 0.0) || (thrust::get<3>(src_sigmas) > 0.0))
+             ? thrust::optional<batch_value_t<bc_sigma_t>>{src_sigmas}
+             : thrust::nullopt;
+  }
+};
+
+// the distances & path counts of the batch_width lanes
+template <typename vertex_t>
+using bc_path_value_t = thrust::
+  tuple<vertex_t, vertex_t, vertex_t, vertex_t, bc_sigma_t, bc_sigma_t, bc_sigma_t, bc_sigma_t>;
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct discover_lanes_v_op_t {
+  vertex_t level{0};
+  size_t next_bucket_idx{0};
+  vertex_t invalid_distance{std::numeric_limits<vertex_t>::max()};
+
+  template <size_t c>
+  __device__ bool discover_lane(bc_path_value_t<vertex_t>& value,
+                                batch_value_t<bc_sigma_t> const& pushed_sigmas) const
+  {
+    if ((thrust::get<c>(value) == invalid_distance) && (thrust::get<c>(pushed_sigmas) > 0.0)) {
+      thrust::get<c>(value)               = level + 1;
+      thrust::get<batch_width + c>(value) = thrust::get<c>(pushed_sigmas);
+      return true;
+    }
+    return false;
+  }
+
+  __device__ thrust::optional<thrust::tuple<size_t, bc_path_value_t<vertex_t>>> operator()(
+    vertex_t, bc_path_value_t<vertex_t> value, batch_value_t<bc_sigma_t> pushed_sigmas) const
+  {
+    static_assert(batch_width == 4);
+    auto discovered = discover_lane<0>(value, pushed_sigmas);
+    discovered      = discover_lane<1>(value, pushed_sigmas) || discovered;
+    discovered      = discover_lane<2>(value, pushed_sigmas) || discovered;
+    discovered      = discover_lane<3>(value, pushed_sigmas) || discovered;
+    return discovered ? thrust::optional<thrust::tuple<size_t, bc_path_value_t<vertex_t>>>{
+                          thrust::make_tuple(next_bucket_idx, value)}
+                      : thrust::nullopt;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename result_t, bool multi_gpu>
+struct update_dependencies_t {
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition;
+  vertex_t const* distances{nullptr};
+  bc_sigma_t const* sigmas{nullptr};
+  result_t* deltas{nullptr};
+  batch_value_t<bc_sigma_t> const* ratio_sums{nullptr};
+  size_t ld{0};
+  vertex_t level{0};
+
+  template <size_t c>
+  __device__ void update_lane(vertex_t v_offset, batch_value_t<bc_sigma_t> const& sums) const
+  {
+    if (distances[c * ld + v_offset] == level) {
+      deltas[c * ld + v_offset] =
+        static_cast<result_t>(sigmas[c * ld + v_offset] * thrust::get<c>(sums));
+    }
+  }
+
+  __device__ void operator()(vertex_t v) const
+  {
+    static_assert(batch_width == 4);
+    auto v_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+    batch_value_t<bc_sigma_t> sums = ratio_sums[v_offset];
+    update_lane<0>(v_offset, sums);
+    update_lane<1>(v_offset, sums);
+    update_lane<2>(v_offset, sums);
+    update_lane<3>(v_offset, sums);
+  }
+};
+
+// Brandes' algorithm for up to batch_width sources at once. The forward BFS keeps per-source
+// (lane) distances & path counts (sigma) and a single (untagged) frontier holding the vertices
+// reached at the current level by any of the sources; one frontier expansion pushes the masked path
+// counts of every lane. The backward pass visits the recorded BFS levels in the reverse order and
+// accumulates the dependencies (delta) of each level's vertices from their outgoing edges only.
+// delta_s(v) (s != v) of every lane is added to dependency_sums and (delta_s(v) / (n - 2))^2 to
+// normalized_dependency_square_sums (if provided).
+template <typename GraphViewType, typename result_t>
+void accumulate_batch_dependencies(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  std::vector<typename GraphViewType::vertex_type> const& h_batch_sources,
+  result_t* dependency_sums,
+  std::optional<result_t*> normalized_dependency_square_sums)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  auto const ld           = static_cast<size_t>(push_graph_view.get_number_of_local_vertices());
+  auto const num_lanes    = h_batch_sources.size();
+  CUGRAPH_EXPECTS(num_lanes <= batch_width, "Invalid input argument: too many batch sources.");
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+
+  // 1. initialize the distances & path counts (column-major, one column per lane)
+
+  rmm::device_uvector<vertex_t> distances(ld * batch_width, handle.get_stream());
+  rmm::device_uvector<bc_sigma_t> sigmas(ld * batch_width, handle.get_stream());
+  rmm::device_uvector<result_t> deltas(ld * batch_width, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), distances.begin(), distances.end(), invalid_distance);
+  thrust::fill(handle.get_thrust_policy(), sigmas.begin(), sigmas.end(), bc_sigma_t{0.0});
+  thrust::fill(handle.get_thrust_policy(), deltas.begin(), deltas.end(), result_t{0.0});
+
+  rmm::device_uvector<vertex_t> batch_sources(num_lanes, handle.get_stream());
+  raft::update_device(
+    batch_sources.data(), h_batch_sources.data(), h_batch_sources.size(), handle.get_stream());
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(num_lanes),
+                   [vertex_partition,
+                    batch_sources = batch_sources.data(),
+                    distances     = distances.data(),
+                    sigmas        = sigmas.data(),
+                    ld] __device__(auto c) {
+                     auto s = batch_sources[c];
+                     if (vertex_partition.is_local_vertex_nocheck(s)) {
+                       auto s_offset =
+                         vertex_partition.get_local_vertex_offset_from_vertex_nocheck(s);
+                       distances[c * ld + s_offset] = vertex_t{0};
+                       sigmas[c * ld + s_offset]    = bc_sigma_t{1.0};
+                     }
+                   });
+
+  auto lane_first = [ld](auto* values) {
+    return thrust::make_zip_iterator(
+      thrust::make_tuple(values, values + ld, values + 2 * ld, values + 3 * ld));
+  };
+  static_assert(batch_width == 4);
+  auto path_value_first = thrust::make_zip_iterator(thrust::make_tuple(distances.data(),
+                                                                       distances.data() + ld,
+                                                                       distances.data() + 2 * ld,
+                                                                       distances.data() + 3 * ld,
+                                                                       sigmas.data(),
+                                                                       sigmas.data() + ld,
+                                                                       sigmas.data() + 2 * ld,
+                                                                       sigmas.data() + 3 * ld));
+
+  // 2. forward BFS for every lane, recording the vertices of each level
+
+  enum class Bucket { cur, next, num_buckets };
+  VertexFrontier<vertex_t,
+                 void,
+                 GraphViewType::is_multi_gpu,
+                 static_cast<size_t>(Bucket::num_buckets)>
+    vertex_frontier(handle);
+
+  std::vector<rmm::device_uvector<vertex_t>> level_vertices{};
+  {
+    rmm::device_uvector<vertex_t> frontier_vertices(ld, handle.get_stream());
+    frontier_vertices.resize(
+      thrust::distance(
+        frontier_vertices.begin(),
+        thrust::copy_if(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+                        thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                        lane_first(distances.data()),
+                        frontier_vertices.begin(),
+                        [] __device__(auto lane_distances) {
+                          return (thrust::get<0>(lane_distances) == vertex_t{0}) ||
+                                 (thrust::get<1>(lane_distances) == vertex_t{0}) ||
+                                 (thrust::get<2>(lane_distances) == vertex_t{0}) ||
+                                 (thrust::get<3>(lane_distances) == vertex_t{0});
+                        })),
+      handle.get_stream());
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+      .insert(frontier_vertices.begin(), frontier_vertices.end());
+    level_vertices.push_back(std::move(frontier_vertices));
+  }
+
+  row_properties_t<GraphViewType, batch_value_t<bc_sigma_t>> adj_matrix_row_sigmas(
+    handle, push_graph_view);
+
+  vertex_t level{0};
+  while (true) {
+    nvtx_range_t level_range("forward level", static_cast<int64_t>(level));
+
+    auto& cur_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+    copy_to_adj_matrix_row(
+      handle,
+      push_graph_view,
+      cur_frontier_bucket.begin(),
+      cur_frontier_bucket.end(),
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(vertex_t{0}),
+        level_sigmas_t<vertex_t>{distances.data(), sigmas.data(), ld, level}),
+      adj_matrix_row_sigmas);
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      adj_matrix_row_sigmas.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      push_sigmas_e_op_t<vertex_t, GraphViewType::is_multi_gpu>{
+        vertex_partition, distances.data(), ld, invalid_distance},
+      reduce_op::plus<batch_value_t<bc_sigma_t>>(),
+      path_value_first,
+      path_value_first,
+      discover_lanes_v_op_t<vertex_t>{
+        level, static_cast<size_t>(Bucket::next), invalid_distance});
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+
+    auto& next_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+    if (next_frontier_bucket.aggregate_size() == 0) { break; }
+
+    rmm::device_uvector<vertex_t> frontier_vertices(next_frontier_bucket.size(),
+                                                    handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 next_frontier_bucket.begin(),
+                 next_frontier_bucket.end(),
+                 frontier_vertices.begin());
+    level_vertices.push_back(std::move(frontier_vertices));
+    ++level;
+  }
+  profiler_add_counter("levels", static_cast<int64_t>(level_vertices.size()));
+
+  // 3. backward dependency accumulation, delta_s(v) = sum over the outgoing edges (v, w) with
+  // d_s(w) = d_s(v) + 1 of sigma_s(v) / sigma_s(w) * (1 + delta_s(w))
+
+  col_properties_t<GraphViewType, batch_value_t<bc_sigma_t>> adj_matrix_col_ratios(
+    handle, push_graph_view);
+  // the stale column values of the deeper levels are never read (d_s(w) <= d_s(v) + 1 for every
+  // edge (v, w)), but the initial values should be valid numbers
+  adj_matrix_col_ratios.fill(thrust::make_tuple(bc_sigma_t{0.0}, bc_sigma_t{0.0}, bc_sigma_t{0.0},
+                                                bc_sigma_t{0.0}),
+                             handle.get_stream());
+  auto ratio_sums = allocate_dataframe_buffer<batch_value_t<bc_sigma_t>>(ld, handle.get_stream());
+
+  for (size_t l = level_vertices.size() - 1; l-- > 0;) {
+    nvtx_range_t level_range("backward level", static_cast<int64_t>(l));
+
+    copy_to_adj_matrix_col(
+      handle,
+      push_graph_view,
+      level_vertices[l + 1].begin(),
+      level_vertices[l + 1].end(),
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(vertex_t{0}),
+        level_dependency_ratios_t<vertex_t, result_t>{
+          distances.data(), sigmas.data(), deltas.data(), ld, static_cast<vertex_t>(l + 1)}),
+      adj_matrix_col_ratios);
+
+    copy_v_transform_reduce_out_nbr(
+      handle,
+      push_graph_view,
+      level_vertices[l].begin(),
+      level_vertices[l].end(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      adj_matrix_col_ratios.device_view(),
+      [] __device__(vertex_t, vertex_t, auto, auto dst_ratios) { return dst_ratios; },
+      thrust::make_tuple(bc_sigma_t{0.0}, bc_sigma_t{0.0}, bc_sigma_t{0.0}, bc_sigma_t{0.0}),
+      get_dataframe_buffer_begin(ratio_sums));
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     level_vertices[l].begin(),
+                     level_vertices[l].end(),
+                     update_dependencies_t<vertex_t, result_t, GraphViewType::is_multi_gpu>{
+                       vertex_partition,
+                       distances.data(),
+                       sigmas.data(),
+                       deltas.data(),
+                       get_dataframe_buffer_begin(ratio_sums),
+                       ld,
+                       static_cast<vertex_t>(l)});
+  }
+
+  // 4. accumulate the dependencies of the lanes (a source does not depend on itself)
+
+  auto scale = num_vertices > 2 ? result_t{1.0} / static_cast<result_t>(num_vertices - 2)
+                                : result_t{0.0};
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(ld),
+    [distances = distances.data(),
+     deltas    = deltas.data(),
+     dependency_sums,
+     square_sums =
+       normalized_dependency_square_sums ? *normalized_dependency_square_sums : nullptr,
+     num_lanes,
+     ld,
+     scale,
+     invalid_distance] __device__(auto i) {
+      for (size_t c = 0; c < num_lanes; ++c) {
+        auto d = distances[c * ld + i];
+        if ((d != vertex_t{0}) && (d != invalid_distance)) {
+          auto delta = deltas[c * ld + i];
+          dependency_sums[i] += delta;
+          if (square_sums != nullptr) { square_sums[i] += (delta * scale) * (delta * scale); }
+        }
+      }
+    });
+
+  CUDA_TRY(cudaStreamSynchronize(
+    handle.get_stream()));  // this is as necessary vertex_frontier will become out-of-scope once
+                            // this function returns (FIXME: should I stream sync in VertexFrontier
+                            // destructor?)
+}
+
+// n / k scales the dependencies of k sampled sources to an unbiased estimate of the n source sum.
+// The normalized scores are divided by (n - 1)(n - 2) and the unnormalized scores of symmetric
+// graphs by 2 (each undirected path is counted from both ends).
+template <typename GraphViewType, typename result_t>
+void rescale_betweenness_centrality(raft::handle_t const& handle,
+                                    GraphViewType const& graph_view,
+                                    result_t* betweennesses,
+                                    size_t num_samples,
+                                    bool normalized)
+{
+  auto const n        = static_cast<result_t>(graph_view.get_number_of_vertices());
+  auto rescale_factor = n / static_cast<result_t>(num_samples);
+  if (normalized) {
+    rescale_factor = graph_view.get_number_of_vertices() > 2
+                       ? rescale_factor / ((n - result_t{1.0}) * (n - result_t{2.0}))
+                       : result_t{0.0};
+  } else if (graph_view.is_symmetric()) {
+    rescale_factor /= result_t{2.0};
+  }
+  thrust::transform(handle.get_thrust_policy(),
+                    betweennesses,
+                    betweennesses + graph_view.get_number_of_local_vertices(),
+                    betweennesses,
+                    [rescale_factor] __device__(auto val) { return val * rescale_factor; });
+}
+
+template <typename GraphViewType, typename result_t>
+void betweenness_centrality(raft::handle_t const& handle,
+                            GraphViewType const& push_graph_view,
+                            typename GraphViewType::vertex_type const* sources,
+                            size_t n_sources,
+                            result_t* betweennesses,
+                            bool normalized,
+                            bool do_expensive_check)
+{
+  scoped_phase_t phase("betweenness_centrality", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((n_sources == 0) || (sources != nullptr),
+                  "Invalid input argument: sources cannot be null");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      push_graph_view.get_vertex_partition_view());
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 push_graph_view,
+                 sources,
+                 sources + n_sources,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: sources have invalid vertex IDs.");
+  }
+
+  // 2. collect the sources of every GPU (every GPU traverses from every source)
+
+  std::vector<vertex_t> h_sources{};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm = handle.get_comms();
+    auto rx_counts = host_scalar_allgather(comm, n_sources, handle.get_stream());
+    std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+    std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+    rmm::device_uvector<vertex_t> aggregate_sources(displacements.back() + rx_counts.back(),
+                                                    handle.get_stream());
+    device_allgatherv(comm,
+                      sources,
+                      aggregate_sources.begin(),
+                      rx_counts,
+                      displacements,
+                      handle.get_stream());
+    h_sources.resize(aggregate_sources.size());
+    raft::update_host(
+      h_sources.data(), aggregate_sources.data(), aggregate_sources.size(), handle.get_stream());
+  } else {
+    h_sources.resize(n_sources);
+    raft::update_host(h_sources.data(), sources, n_sources, handle.get_stream());
+  }
+  handle.get_stream_view().synchronize();
+  CUGRAPH_EXPECTS(h_sources.size() > 0,
+                  "Invalid input argument: input should have at least one source");
+
+  // 3. accumulate the dependencies batch_width sources at a time
+
+  thrust::fill(handle.get_thrust_policy(),
+               betweennesses,
+               betweennesses + push_graph_view.get_number_of_local_vertices(),
+               result_t{0.0});
+  for (size_t i = 0; i < h_sources.size(); i += batch_width) {
+    profiler_add_counter("batches", 1);
+    nvtx_range_t batch_range("batch", static_cast<int64_t>(i / batch_width));
+    std::vector<vertex_t> h_batch_sources(
+      h_sources.begin() + i, h_sources.begin() + std::min(i + batch_width, h_sources.size()));
+    accumulate_batch_dependencies(
+      handle, push_graph_view, h_batch_sources, betweennesses, std::optional<result_t*>{});
+  }
+
+  rescale_betweenness_centrality(
+    handle, push_graph_view, betweennesses, h_sources.size(), normalized);
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename result_t>
+struct bernstein_bound_exceeds_t {
+  result_t num_samples{};
+  result_t scale{};  // 1 / (n - 2)
+  result_t log_term{};
+  result_t epsilon{};
+
+  __device__ bool operator()(thrust::tuple<result_t, result_t> sums) const
+  {
+    auto mean     = thrust::get<0>(sums) * scale / num_samples;
+    auto variance =
+      (thrust::get<1>(sums) - num_samples * mean * mean) / (num_samples - result_t{1.0});
+    variance = variance > result_t{0.0} ? variance : result_t{0.0};  // round-off
+    auto bound = std::sqrt(result_t{2.0} * variance * log_term / num_samples) +
+                 result_t{7.0} * log_term / (result_t{3.0} * (num_samples - result_t{1.0}));
+    return bound > epsilon;
+  }
+};
+
+// Samples sources uniformly at random (with replacement) and stops at the first checkpoint (the
+// number of samples doubles from a checkpoint to the next) at which the empirical Bernstein bound
+// (A. Maurer and M. Pontil, "Empirical Bernstein bounds and sample variance penalization," 2009) of
+// every vertex's normalized dependency X_s(v) = delta_s(v) / (n - 2) in [0, 1] is within epsilon,
+// similar to the adaptive stopping of KADABRA (M. Borassi and E. Natale, "KADABRA is an ADaptive
+// Algorithm for Betweenness via Random Approximation," 2016) over per-source dependencies instead
+// of sampled paths. The sampling stops regardless at the Hoeffding (union bound) sample size. Half
+// of delta is spent on the Hoeffding bound and the other half is split across the checkpoints.
+template <typename GraphViewType, typename result_t>
+size_t approximate_betweenness_centrality(raft::handle_t const& handle,
+                                          GraphViewType const& push_graph_view,
+                                          result_t* betweennesses,
+                                          result_t epsilon,
+                                          result_t delta,
+                                          uint64_t seed,
+                                          bool normalized,
+                                          bool do_expensive_check)
+{
+  scoped_phase_t phase("approximate_betweenness_centrality", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return size_t{0}; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((epsilon > 0.0) && (epsilon < 1.0),
+                  "Invalid input argument: epsilon should be in (0.0, 1.0).");
+  CUGRAPH_EXPECTS((delta > 0.0) && (delta < 1.0),
+                  "Invalid input argument: delta should be in (0.0, 1.0).");
+
+  auto const ld = static_cast<size_t>(push_graph_view.get_number_of_local_vertices());
+  thrust::fill(handle.get_thrust_policy(), betweennesses, betweennesses + ld, result_t{0.0});
+  if (num_vertices <= 2) { return size_t{0}; }  // every dependency is 0
+
+  // 2. set the checkpoints
+
+  auto const n           = static_cast<double>(num_vertices);
+  auto const max_samples = static_cast<size_t>(std::ceil(
+    std::log(4.0 * n / static_cast<double>(delta)) /
+    (2.0 * static_cast<double>(epsilon) * static_cast<double>(epsilon))));
+  std::vector<size_t> h_checkpoints{};
+  for (auto k = batch_width * 16; k < max_samples; k *= 2) {
+    h_checkpoints.push_back(k);
+  }
+  h_checkpoints.push_back(max_samples);
+  auto const log_term = static_cast<result_t>(std::log(
+    8.0 * static_cast<double>(h_checkpoints.size()) * n / static_cast<double>(delta)));
+
+  // 3. sample the sources
+
+  rmm::device_uvector<result_t> square_sums(ld, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), square_sums.begin(), square_sums.end(), result_t{0.0});
+
+  // every GPU draws the same sources
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<vertex_t> source_distribution(vertex_t{0}, num_vertices - 1);
+
+  size_t num_samples{0};
+  for (size_t i = 0; i < h_checkpoints.size(); ++i) {
+    while (num_samples < h_checkpoints[i]) {
+      profiler_add_counter("batches", 1);
+      nvtx_range_t batch_range("batch", static_cast<int64_t>(num_samples / batch_width));
+      std::vector<vertex_t> h_batch_sources(std::min(batch_width, h_checkpoints[i] - num_samples));
+      std::generate(h_batch_sources.begin(), h_batch_sources.end(), [&source_distribution, &gen]() {
+        return source_distribution(gen);
+      });
+      accumulate_batch_dependencies(handle,
+                                    push_graph_view,
+                                    h_batch_sources,
+                                    betweennesses,
+                                    std::optional<result_t*>{square_sums.data()});
+      num_samples += h_batch_sources.size();
+    }
+
+    if (i == h_checkpoints.size() - 1) { break; }  // the Hoeffding bound holds
+    auto num_unsettled_vertices = count_if_v(
+      handle,
+      push_graph_view,
+      thrust::make_zip_iterator(thrust::make_tuple(betweennesses, square_sums.begin())),
+      bernstein_bound_exceeds_t<result_t>{static_cast<result_t>(num_samples),
+                                          result_t{1.0} / static_cast<result_t>(num_vertices - 2),
+                                          log_term,
+                                          epsilon});
+    if (num_unsettled_vertices == 0) { break; }
+  }
+  profiler_add_counter("samples", static_cast<int64_t>(num_samples));
+
+  rescale_betweenness_centrality(handle, push_graph_view, betweennesses, num_samples, normalized);
+
+  return num_samples;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* sources,
+  size_t n_sources,
+  result_t* betweennesses,
+  bool normalized,
+  bool do_expensive_check)
+{
+  detail::betweenness_centrality(
+    handle, graph_view, sources, n_sources, betweennesses, normalized, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+size_t approximate_betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  result_t* betweennesses,
+  result_t epsilon,
+  result_t delta,
+  uint64_t seed,
+  bool normalized,
+  bool do_expensive_check)
+{
+  return detail::approximate_betweenness_centrality(
+    handle, graph_view, betweennesses, epsilon, delta, seed, normalized, do_expensive_check);
+}
+
+}  // namespace cugraph
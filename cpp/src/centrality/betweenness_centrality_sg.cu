@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <centrality/betweenness_centrality_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  int32_t const* sources,
+  size_t n_sources,
+  float* betweennesses,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  int32_t const* sources,
+  size_t n_sources,
+  float* betweennesses,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  int64_t const* sources,
+  size_t n_sources,
+  float* betweennesses,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  int32_t const* sources,
+  size_t n_sources,
+  double* betweennesses,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  int32_t const* sources,
+  size_t n_sources,
+  double* betweennesses,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  int64_t const* sources,
+  size_t n_sources,
+  double* betweennesses,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template size_t approximate_betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  float* betweennesses,
+  float epsilon,
+  float delta,
+  uint64_t seed,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template size_t approximate_betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  float* betweennesses,
+  float epsilon,
+  float delta,
+  uint64_t seed,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template size_t approximate_betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  float* betweennesses,
+  float epsilon,
+  float delta,
+  uint64_t seed,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template size_t approximate_betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  double* betweennesses,
+  double epsilon,
+  double delta,
+  uint64_t seed,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template size_t approximate_betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  double* betweennesses,
+  double epsilon,
+  double delta,
+  uint64_t seed,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template size_t approximate_betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  double* betweennesses,
+  double epsilon,
+  double delta,
+  uint64_t seed,
+  bool normalized,
+  bool do_expensive_check);
+#endif
+
+}  // namespace cugraph
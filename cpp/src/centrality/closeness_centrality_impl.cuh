@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// maximum number of pivots per bfs_batch call
+size_t constexpr closeness_pivot_batch_size{64};
+
+// returns num_pivots distinct vertices in [0, num_vertices) drawn uniformly at random (every vertex
+// if num_pivots >= num_vertices) in the ascending order (R. W. Floyd's sampling algorithm)
+template <typename vertex_t>
+std::vector<vertex_t> sample_pivots(vertex_t num_vertices, size_t num_pivots, uint64_t seed)
+{
+  std::vector<vertex_t> pivots{};
+  if (num_pivots >= static_cast<size_t>(num_vertices)) {
+    pivots.resize(num_vertices);
+    std::iota(pivots.begin(), pivots.end(), vertex_t{0});
+  } else {
+    std::mt19937_64 gen(seed);
+    std::unordered_set<vertex_t> selected{};
+    for (auto j = num_vertices - static_cast<vertex_t>(num_pivots); j < num_vertices; ++j) {
+      auto v = std::uniform_int_distribution<vertex_t>(vertex_t{0}, j)(gen);
+      if (!selected.insert(v).second) { selected.insert(j); }
+    }
+    pivots.assign(selected.begin(), selected.end());
+    std::sort(pivots.begin(), pivots.end());
+  }
+  return pivots;
+}
+
+// Estimates the closeness & harmonic centralities from the BFS distances of sampled pivots to every
+// vertex (D. Eppstein and J. Wang, "Fast approximation of centrality," 2001). The pivots run
+// closeness_pivot_batch_size at a time through the bit-parallel bfs_batch. For a vertex v reached
+// by c of the k' pivots other than v with the distance sum S and the reciprocal distance sum R,
+// harmonic(v) is estimated as (n - 1) / k' * R and closeness(v) (Wasserman & Faust's variant for
+// disconnected graphs, (r - 1)^2 / ((n - 1) * sum of the distances from the r - 1 vertices reaching
+// v)) as c^2 / (k' * S). The estimates are exact if every vertex is a pivot.
+template <typename GraphViewType, typename result_t>
+void closeness_centrality(raft::handle_t const& handle,
+                          GraphViewType const& push_graph_view,
+                          size_t num_pivots,
+                          uint64_t seed,
+                          std::optional<result_t*> closenesses,
+                          std::optional<result_t*> harmonic_centralities,
+                          bool do_expensive_check)
+{
+  scoped_phase_t phase("closeness_centrality", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(num_pivots > 0, "Invalid input argument: num_pivots should be positive.");
+  CUGRAPH_EXPECTS(closenesses || harmonic_centralities,
+                  "Invalid input argument: at least one of closenesses and harmonic_centralities "
+                  "should be provided.");
+
+  // 2. sample the pivots (every GPU draws the same pivots)
+
+  auto h_pivots = sample_pivots(num_vertices, num_pivots, seed);
+
+  // 3. accumulate the pivot distances to every vertex
+
+  auto const ld = static_cast<size_t>(push_graph_view.get_number_of_local_vertices());
+  rmm::device_uvector<result_t> distance_sums(ld, handle.get_stream());
+  rmm::device_uvector<result_t> reciprocal_distance_sums(ld, handle.get_stream());
+  rmm::device_uvector<vertex_t> reached_counts(ld, handle.get_stream());
+  rmm::device_uvector<uint8_t> is_pivot(ld, handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), distance_sums.begin(), distance_sums.end(), result_t{0.0});
+  thrust::fill(handle.get_thrust_policy(),
+               reciprocal_distance_sums.begin(),
+               reciprocal_distance_sums.end(),
+               result_t{0.0});
+  thrust::fill(
+    handle.get_thrust_policy(), reached_counts.begin(), reached_counts.end(), vertex_t{0});
+  thrust::fill(handle.get_thrust_policy(), is_pivot.begin(), is_pivot.end(), uint8_t{0});
+
+  rmm::device_uvector<vertex_t> distances(ld * closeness_pivot_batch_size, handle.get_stream());
+  rmm::device_uvector<vertex_t> local_pivots(closeness_pivot_batch_size, handle.get_stream());
+  for (size_t i = 0; i < h_pivots.size(); i += closeness_pivot_batch_size) {
+    profiler_add_counter("batches", 1);
+    nvtx_range_t batch_range("batch", static_cast<int64_t>(i / closeness_pivot_batch_size));
+
+    auto batch_first = h_pivots.begin() + i;
+    auto batch_last  = h_pivots.begin() + std::min(i + closeness_pivot_batch_size, h_pivots.size());
+    std::vector<vertex_t> h_local_pivots{};
+    std::copy_if(batch_first,
+                 batch_last,
+                 std::back_inserter(h_local_pivots),
+                 [local_vertex_first = push_graph_view.get_local_vertex_first(),
+                  local_vertex_last  = push_graph_view.get_local_vertex_last()](auto v) {
+                   return (v >= local_vertex_first) && (v < local_vertex_last);
+                 });
+    raft::update_device(
+      local_pivots.data(), h_local_pivots.data(), h_local_pivots.size(), handle.get_stream());
+
+    auto batch_size = static_cast<size_t>(std::distance(batch_first, batch_last));
+    bfs_batch(handle,
+              push_graph_view,
+              distances.data(),
+              local_pivots.data(),
+              h_local_pivots.size(),
+              std::numeric_limits<vertex_t>::max(),
+              do_expensive_check);
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(ld),
+      [distances                = distances.data(),
+       distance_sums            = distance_sums.data(),
+       reciprocal_distance_sums = reciprocal_distance_sums.data(),
+       reached_counts           = reached_counts.data(),
+       is_pivot                 = is_pivot.data(),
+       batch_size,
+       ld,
+       invalid_distance = std::numeric_limits<vertex_t>::max()] __device__(auto v) {
+        auto distance_sum            = distance_sums[v];
+        auto reciprocal_distance_sum = reciprocal_distance_sums[v];
+        auto reached_count           = reached_counts[v];
+        for (size_t c = 0; c < batch_size; ++c) {
+          auto d = distances[c * ld + v];
+          if (d == vertex_t{0}) {
+            is_pivot[v] = uint8_t{1};
+          } else if (d != invalid_distance) {
+            distance_sum += static_cast<result_t>(d);
+            reciprocal_distance_sum += result_t{1.0} / static_cast<result_t>(d);
+            ++reached_count;
+          }
+        }
+        distance_sums[v]            = distance_sum;
+        reciprocal_distance_sums[v] = reciprocal_distance_sum;
+        reached_counts[v]           = reached_count;
+      });
+  }
+
+  // 4. compute the estimates
+
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(ld),
+    [distance_sums            = distance_sums.data(),
+     reciprocal_distance_sums = reciprocal_distance_sums.data(),
+     reached_counts           = reached_counts.data(),
+     is_pivot                 = is_pivot.data(),
+     closenesses              = closenesses ? *closenesses : nullptr,
+     harmonic_centralities    = harmonic_centralities ? *harmonic_centralities : nullptr,
+     num_vertices,
+     num_pivots = h_pivots.size()] __device__(auto i) {
+      auto num_other_pivots = static_cast<result_t>(num_pivots - (is_pivot[i] ? 1 : 0));
+      if (closenesses != nullptr) {
+        auto c         = static_cast<result_t>(reached_counts[i]);
+        closenesses[i] = (reached_counts[i] > 0) ? c * c / (num_other_pivots * distance_sums[i])
+                                                 : result_t{0.0};
+      }
+      if (harmonic_centralities != nullptr) {
+        harmonic_centralities[i] =
+          num_other_pivots > result_t{0.0}
+            ? static_cast<result_t>(num_vertices - 1) / num_other_pivots *
+                reciprocal_distance_sums[i]
+            : result_t{0.0};
+      }
+    });
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void closeness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t num_pivots,
+  uint64_t seed,
+  std::optional<result_t*> closenesses,
+  std::optional<result_t*> harmonic_centralities,
+  bool do_expensive_check)
+{
+  detail::closeness_centrality(handle,
+                               graph_view,
+                               num_pivots,
+                               seed,
+                               closenesses,
+                               harmonic_centralities,
+                               do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <link_analysis/power_iteration.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/reduce_v.cuh>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/handle.hpp>
+
+#include <thrust/fill.h>
+
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// the values are extrapolated (Aitken's delta-squared process) every
+// eigenvector_centrality_aitken_period iterations
+size_t constexpr eigenvector_centrality_aitken_period{8};
+
+template <typename GraphViewType, typename result_t>
+void eigenvector_centrality(raft::handle_t const& handle,
+                            GraphViewType const& pull_graph_view,
+                            result_t* centralities,
+                            result_t epsilon,
+                            size_t max_iterations,
+                            bool has_initial_guess,
+                            bool do_expensive_check)
+{
+  static_assert(std::is_integral<typename GraphViewType::vertex_type>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  auto const num_vertices = pull_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+
+  if (do_expensive_check) {
+    if (has_initial_guess) {
+      auto num_negative_values = count_if_v(
+        handle, pull_graph_view, centralities, [] __device__(auto val) { return val < 0.0; });
+      CUGRAPH_EXPECTS(num_negative_values == 0,
+                      "Invalid input argument: initial guess values should be non-negative.");
+    }
+  }
+
+  // 2. initialize eigenvector centrality values
+
+  if (has_initial_guess) {
+    auto sum = reduce_v(handle, pull_graph_view, centralities, result_t{0.0});
+    CUGRAPH_EXPECTS(sum > 0.0,
+                    "Invalid input argument: sum of the initial guess values should be positive.");
+  } else {
+    thrust::fill(handle.get_thrust_policy(),
+                 centralities,
+                 centralities + pull_graph_view.get_number_of_local_vertices(),
+                 result_t{1.0} / static_cast<result_t>(num_vertices));
+  }
+
+  // 3. power iteration on A + I (this has the same eigenvectors as A and the shift keeps the
+  // iteration from oscillating on bipartite graphs), the tolerance is per vertex
+
+  auto converged = std::get<1>(
+    batched_power_iteration(handle,
+                            pull_graph_view,
+                            centralities,
+                            size_t{1},
+                            std::vector<result_t>{result_t{1.0}},
+                            result_t{1.0},
+                            static_cast<result_t const*>(nullptr),
+                            result_t{0.0},
+                            power_iteration_normalization_t::l2,
+                            epsilon * static_cast<result_t>(num_vertices),
+                            max_iterations,
+                            eigenvector_centrality_aitken_period));
+  if (!converged) { CUGRAPH_FAIL("Eigenvector Centrality failed to converge."); }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void eigenvector_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  result_t* centralities,
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check)
+{
+  detail::eigenvector_centrality(handle,
+                                 graph_view,
+                                 centralities,
+                                 epsilon,
+                                 max_iterations,
+                                 has_initial_guess,
+                                 do_expensive_check);
+}
+
+}  // namespace cugraph
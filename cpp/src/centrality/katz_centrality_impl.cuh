@@ -15,27 +15,295 @@
  */
 #pragma once
 
+#include <link_analysis/power_iteration.cuh>
+#include <utilities/captured_iteration.hpp>
+#include <utilities/mixed_precision.hpp>
+
 #include <cugraph/algorithms.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
 #include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
 #include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/reduce_v.cuh>
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/prims/transform_reduce_v.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cub/cub.cuh>
+
+#include <thrust/copy.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
 namespace cugraph {
 namespace detail {
 
+int32_t constexpr update_katz_centralities_block_size = 512;
+
+// adds the betas to the SpMV outputs, updates the Katz Centrality values and the row properties
+// (the local vertices in single-GPU), and accumulates the sum of the changes to *diff_sum
+template <typename vertex_t, typename result_t>
+__global__ void update_katz_centralities(vertex_t num_vertices,
+                                         result_t const* spmv_outputs,
+                                         result_t const* betas,
+                                         result_t* katz_centralities,
+                                         result_t* adj_matrix_row_katz_centralities,
+                                         result_t* diff_sum)
+{
+  using BlockReduce = cub::BlockReduce<result_t, update_katz_centralities_block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+
+  auto idx = static_cast<size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+  result_t diff{0.0};
+  while (idx < static_cast<size_t>(num_vertices)) {
+    auto new_value = spmv_outputs[idx];
+    if (betas != nullptr) { new_value += betas[idx]; }
+    diff += std::abs(new_value - katz_centralities[idx]);
+    katz_centralities[idx]                = new_value;
+    adj_matrix_row_katz_centralities[idx] = new_value;
+    idx += gridDim.x * blockDim.x;
+  }
+  diff = BlockReduce(temp_storage).Sum(diff);
+  if (threadIdx.x == 0) { atomicAdd(diff_sum, diff); }
+}
+
+// scales the Katz Centrality values to make the L2-norm 1.0
+template <typename GraphViewType, typename result_t>
+void normalize_katz_centralities(raft::handle_t const& handle,
+                                 GraphViewType const& pull_graph_view,
+                                 result_t* katz_centralities)
+{
+  auto l2_norm = transform_reduce_v(
+    handle,
+    pull_graph_view,
+    katz_centralities,
+    [] __device__(auto val) { return val * val; },
+    result_t{0.0});
+  l2_norm = std::sqrt(l2_norm);
+  CUGRAPH_EXPECTS(l2_norm > 0.0,
+                  "L2 norm of the computed Katz Centrality values should be positive.");
+  thrust::transform(handle.get_thrust_policy(),
+                    katz_centralities,
+                    katz_centralities + pull_graph_view.get_number_of_local_vertices(),
+                    katz_centralities,
+                    [l2_norm] __device__(auto val) { return val / l2_norm; });
+}
+
+// single-GPU Katz Centrality iterations captured into a CUDA graph, the convergence is tested
+// every capture_interval iterations
+template <typename GraphViewType, typename result_t>
+void captured_katz_centrality_iterations(raft::handle_t const& handle,
+                                         GraphViewType const& pull_graph_view,
+                                         result_t const* betas,
+                                         result_t* katz_centralities,
+                                         result_t alpha,
+                                         result_t beta,
+                                         result_t epsilon,
+                                         size_t max_iterations,
+                                         size_t capture_interval)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(!GraphViewType::is_multi_gpu);
+
+  auto const num_vertices = pull_graph_view.get_number_of_vertices();
+
+  rmm::device_uvector<result_t> spmv_outputs(num_vertices, handle.get_stream());
+  rmm::device_uvector<result_t> diff_sum(1, handle.get_stream());
+  row_properties_t<GraphViewType, result_t> adj_matrix_row_katz_centralities(handle,
+                                                                             pull_graph_view);
+  copy_to_adj_matrix_row(
+    handle, pull_graph_view, katz_centralities, adj_matrix_row_katz_centralities);
+
+  auto e_op = [alpha] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
+    return static_cast<result_t>(alpha * src_val * w);
+  };
+  auto init = betas != nullptr ? result_t{0.0} : beta;
+
+  auto iteration = [&]() {
+    CUDA_TRY(cudaMemsetAsync(diff_sum.data(), 0, sizeof(result_t), handle.get_stream()));
+    copy_v_transform_reduce_in_nbr(handle,
+                                   pull_graph_view,
+                                   adj_matrix_row_katz_centralities.device_view(),
+                                   dummy_properties_t<vertex_t>{}.device_view(),
+                                   e_op,
+                                   init,
+                                   spmv_outputs.data());
+    raft::grid_1d_thread_t update_grid(num_vertices,
+                                       update_katz_centralities_block_size,
+                                       handle.get_device_properties().maxGridSize[0]);
+    update_katz_centralities<<<update_grid.num_blocks,
+                               update_grid.block_size,
+                               0,
+                               handle.get_stream()>>>(num_vertices,
+                                                      spmv_outputs.data(),
+                                                      betas,
+                                                      katz_centralities,
+                                                      adj_matrix_row_katz_centralities.value_data(),
+                                                      diff_sum.data());
+  };
+
+  std::optional<captured_iteration_t> captured_iteration{std::nullopt};
+  size_t iter{0};
+  while (true) {
+    profiler_add_counter("iterations", 1);
+
+    if (captured_iteration) {
+      captured_iteration->replay();
+    } else {
+      iteration();  // the first iteration runs uncaptured (this also tunes the kernel launches)
+      captured_iteration.emplace(handle.get_stream_view(), iteration);
+    }
+
+    iter++;
+
+    if ((iter % capture_interval == 0) || (iter >= max_iterations)) {
+      result_t h_diff_sum{};
+      raft::update_host(&h_diff_sum, diff_sum.data(), size_t{1}, handle.get_stream());
+      handle.get_stream_view().synchronize();
+      if (h_diff_sum < epsilon) {
+        break;
+      } else if (iter >= max_iterations) {
+        CUGRAPH_FAIL("Katz Centrality failed to converge.");
+      }
+    }
+  }
+}
+
+// the (uncaptured) Katz Centrality iterations from the values in cur_katz_centralities
+// (next_katz_centralities is the ping-pong buffer). The SpMV inputs (the row properties, and in
+// multi-GPU the values exchanged to fill them) are stored in row_value_t and the SpMV accumulates
+// in result_t. If stop_at_float_error is true, the iterations also stop once the sum of the changes
+// drops below mixed_precision_switch_ratio times the sum of the values or stops decreasing. Returns
+// the pointer to the latest values (cur_katz_centralities or next_katz_centralities); iter counts
+// the iterations.
+template <typename row_value_t, typename GraphViewType, typename result_t>
+result_t* katz_centrality_iterations(raft::handle_t const& handle,
+                                     GraphViewType const& pull_graph_view,
+                                     result_t const* betas,
+                                     result_t* cur_katz_centralities,
+                                     result_t* next_katz_centralities,
+                                     result_t alpha,
+                                     result_t beta,
+                                     result_t epsilon,
+                                     bool stop_at_float_error,
+                                     size_t& iter,
+                                     size_t max_iterations)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  constexpr bool convert_row_values =
+    GraphViewType::is_multi_gpu && !std::is_same_v<row_value_t, result_t>;
+
+  row_properties_t<GraphViewType, row_value_t> adj_matrix_row_katz_centralities(handle,
+                                                                                pull_graph_view);
+  // copy_to_adj_matrix_row exchanges the input value type in multi-GPU
+  rmm::device_uvector<row_value_t> row_values(
+    convert_row_values ? pull_graph_view.get_number_of_local_vertices() : vertex_t{0},
+    handle.get_stream());
+  auto prev_diff_sum = std::numeric_limits<result_t>::max();
+  while (true) {
+    if constexpr (convert_row_values) {
+      thrust::transform(handle.get_thrust_policy(),
+                        cur_katz_centralities,
+                        cur_katz_centralities + pull_graph_view.get_number_of_local_vertices(),
+                        row_values.begin(),
+                        [] __device__(auto val) { return static_cast<row_value_t>(val); });
+      copy_to_adj_matrix_row(
+        handle, pull_graph_view, row_values.data(), adj_matrix_row_katz_centralities);
+    } else {
+      copy_to_adj_matrix_row(
+        handle, pull_graph_view, cur_katz_centralities, adj_matrix_row_katz_centralities);
+    }
+
+    copy_v_transform_reduce_in_nbr(
+      handle,
+      pull_graph_view,
+      adj_matrix_row_katz_centralities.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      [alpha] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
+        return static_cast<result_t>(alpha * static_cast<result_t>(src_val) * w);
+      },
+      betas != nullptr ? result_t{0.0} : beta,
+      next_katz_centralities);
+
+    if (betas != nullptr) {
+      auto val_first = thrust::make_zip_iterator(thrust::make_tuple(next_katz_centralities, betas));
+      thrust::transform(handle.get_thrust_policy(),
+                        val_first,
+                        val_first + pull_graph_view.get_number_of_local_vertices(),
+                        next_katz_centralities,
+                        [] __device__(auto val) {
+                          auto const katz_centrality = thrust::get<0>(val);
+                          auto const beta            = thrust::get<1>(val);
+                          return katz_centrality + beta;
+                        });
+    }
+
+    // the sum of the values (for the float rounding error test) is all-reduced with the sum of the
+    // changes
+    deferred_host_scalar_allreduce_t<result_t, GraphViewType::is_multi_gpu> sums{};
+    auto diff_sum_slot = transform_reduce_v(
+      handle,
+      pull_graph_view,
+      thrust::make_zip_iterator(thrust::make_tuple(next_katz_centralities, cur_katz_centralities)),
+      [] __device__(auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
+      result_t{0.0},
+      sums);
+    std::optional<size_t> sum_slot{std::nullopt};
+    if (stop_at_float_error) {
+      sum_slot = transform_reduce_v(
+        handle,
+        pull_graph_view,
+        next_katz_centralities,
+        [] __device__(auto val) { return std::abs(val); },
+        result_t{0.0},
+        sums);
+    }
+    sums.resolve(handle);
+    auto diff_sum = sums.get(diff_sum_slot);
+    std::swap(cur_katz_centralities, next_katz_centralities);
+
+    iter++;
+
+    if (diff_sum < epsilon) { break; }
+    if (stop_at_float_error) {
+      if ((diff_sum >= prev_diff_sum) ||
+          (diff_sum < static_cast<result_t>(mixed_precision_switch_ratio) * sums.get(*sum_slot))) {
+        break;
+      }
+    }
+    if (iter >= max_iterations) { CUGRAPH_FAIL("Katz Centrality failed to converge."); }
+    prev_diff_sum = diff_sum;
+  }
+
+  return cur_katz_centralities;
+}
+
 template <typename GraphViewType, typename result_t>
 void katz_centrality(raft::handle_t const& handle,
                      GraphViewType const& pull_graph_view,
@@ -47,7 +315,9 @@ void katz_centrality(raft::handle_t const& handle,
                      size_t max_iterations,
                      bool has_initial_guess,
                      bool normalize,
-                     bool do_expensive_check)
+                     bool do_expensive_check,
+                     size_t iteration_capture_interval = 0,
+                     bool mixed_precision              = false)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using weight_t = typename GraphViewType::weight_type;
@@ -90,83 +360,348 @@ void katz_centrality(raft::handle_t const& handle,
 
   // 3. katz centrality iteration
 
-  // old katz centrality values
+  // the Katz Centrality values ping-pong between katz_centralities and tmp_katz_centralities
   rmm::device_uvector<result_t> tmp_katz_centralities(
     pull_graph_view.get_number_of_local_vertices(), handle.get_stream());
+  auto cur_katz_centralities = katz_centralities;
+  size_t iter{0};
+
+  if constexpr (std::is_same_v<result_t, double>) {
+    if (mixed_precision) {
+      // float SpMV inputs until the changes drop to the float rounding error, the iterations below
+      // continue from there with double SpMV inputs
+      cur_katz_centralities = katz_centrality_iterations<float>(handle,
+                                                                pull_graph_view,
+                                                                betas,
+                                                                cur_katz_centralities,
+                                                                tmp_katz_centralities.data(),
+                                                                alpha,
+                                                                beta,
+                                                                epsilon,
+                                                                true,
+                                                                iter,
+                                                                max_iterations);
+    }
+  }
+
+  bool captured{false};
+  if constexpr (!GraphViewType::is_multi_gpu) {
+    if (is_iteration_capturable(handle, pull_graph_view, iteration_capture_interval)) {
+      if (cur_katz_centralities != katz_centralities) {
+        thrust::copy(handle.get_thrust_policy(),
+                     cur_katz_centralities,
+                     cur_katz_centralities + pull_graph_view.get_number_of_local_vertices(),
+                     katz_centralities);
+        cur_katz_centralities = katz_centralities;
+      }
+      captured_katz_centrality_iterations(handle,
+                                          pull_graph_view,
+                                          betas,
+                                          katz_centralities,
+                                          alpha,
+                                          beta,
+                                          epsilon,
+                                          max_iterations - iter,
+                                          iteration_capture_interval);
+      captured = true;
+    }
+  }
+
+  if (!captured) {
+    cur_katz_centralities = katz_centrality_iterations<result_t>(
+      handle,
+      pull_graph_view,
+      betas,
+      cur_katz_centralities,
+      cur_katz_centralities == katz_centralities ? tmp_katz_centralities.data() : katz_centralities,
+      alpha,
+      beta,
+      epsilon,
+      false,
+      iter,
+      max_iterations);
+  }
+
+  if (cur_katz_centralities != katz_centralities) {
+    thrust::copy(handle.get_thrust_policy(),
+                 cur_katz_centralities,
+                 cur_katz_centralities + pull_graph_view.get_number_of_local_vertices(),
+                 katz_centralities);
+  }
+
+  if (normalize) { normalize_katz_centralities(handle, pull_graph_view, katz_centralities); }
+}
+
+// Jacobi iteration restricted to the active vertices, a vertex drops out of the active set once its
+// value changes by less than epsilon (the values of the other vertices are frozen). Once the active
+// set empties, an iteration over every vertex re-computes every value, and the vertices changed by
+// epsilon or more become active again; the iteration converges if no vertex becomes active again.
+template <typename GraphViewType, typename result_t>
+std::tuple<result_t, size_t> adaptive_katz_centrality(raft::handle_t const& handle,
+                                                      GraphViewType const& pull_graph_view,
+                                                      result_t const* betas,
+                                                      result_t* katz_centralities,
+                                                      result_t alpha,
+                                                      result_t beta,
+                                                      result_t epsilon,
+                                                      size_t max_iterations,
+                                                      bool has_initial_guess,
+                                                      bool normalize,
+                                                      bool do_expensive_check)
+{
+  scoped_phase_t phase("adaptive_katz_centrality", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  auto const num_vertices = pull_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return std::make_tuple(result_t{0.0}, size_t{0}); }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon > 0.0, "Invalid input argument: epsilon should be positive.");
+
+  if (do_expensive_check) {
+    if (has_initial_guess) {
+      auto num_negative_values = count_if_v(
+        handle, pull_graph_view, katz_centralities, [] __device__(auto val) { return val < 0.0; });
+      CUGRAPH_EXPECTS(num_negative_values == 0,
+                      "Invalid input argument: initial guess values should be non-negative.");
+    }
+  }
+
+  // 2. initialize katz centrality values
+
+  auto const num_local_vertices = pull_graph_view.get_number_of_local_vertices();
+  auto const local_vertex_first = pull_graph_view.get_local_vertex_first();
+
+  if (!has_initial_guess) {
+    thrust::fill(handle.get_thrust_policy(),
+                 katz_centralities,
+                 katz_centralities + num_local_vertices,
+                 result_t{0.0});
+  }
+
+  // 3. katz centrality iteration
+
+  rmm::device_uvector<result_t> new_katz_centralities(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<result_t> diffs(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> active_vertices(0, handle.get_stream());
   row_properties_t<GraphViewType, result_t> adj_matrix_row_katz_centralities(handle,
                                                                              pull_graph_view);
-  auto new_katz_centralities = katz_centralities;
-  auto old_katz_centralities = tmp_katz_centralities.data();
+
+  auto e_op = [alpha] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
+    return static_cast<result_t>(alpha * src_val * w);
+  };
+  auto init = betas != nullptr ? result_t{0.0} : beta;
+
+  // the sum of the changes in the last iteration over every vertex
+  result_t residual_sum{std::numeric_limits<result_t>::max()};
+  bool full_iteration{true};
+  bool converged{false};
   size_t iter{0};
-  while (true) {
-    std::swap(new_katz_centralities, old_katz_centralities);
+  while (iter < max_iterations) {
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration", static_cast<int64_t>(iter));
+
+    if (full_iteration) {
+      active_vertices.resize(num_local_vertices, handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(local_vertex_first),
+                   thrust::make_counting_iterator(pull_graph_view.get_local_vertex_last()),
+                   active_vertices.begin());
+    }
+    profiler_add_counter("active_vertices", static_cast<int64_t>(active_vertices.size()));
 
     copy_to_adj_matrix_row(
-      handle, pull_graph_view, old_katz_centralities, adj_matrix_row_katz_centralities);
+      handle, pull_graph_view, katz_centralities, adj_matrix_row_katz_centralities);
 
-    copy_v_transform_reduce_in_nbr(
-      handle,
-      pull_graph_view,
-      adj_matrix_row_katz_centralities.device_view(),
-      dummy_properties_t<vertex_t>{}.device_view(),
-      [alpha] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
-        return static_cast<result_t>(alpha * src_val * w);
-      },
-      betas != nullptr ? result_t{0.0} : beta,
-      new_katz_centralities);
+    if (full_iteration) {
+      copy_v_transform_reduce_in_nbr(handle,
+                                     pull_graph_view,
+                                     adj_matrix_row_katz_centralities.device_view(),
+                                     dummy_properties_t<vertex_t>{}.device_view(),
+                                     e_op,
+                                     init,
+                                     new_katz_centralities.data());
+    } else {
+      copy_v_transform_reduce_in_nbr(handle,
+                                     pull_graph_view,
+                                     active_vertices.begin(),
+                                     active_vertices.end(),
+                                     adj_matrix_row_katz_centralities.device_view(),
+                                     dummy_properties_t<vertex_t>{}.device_view(),
+                                     e_op,
+                                     init,
+                                     new_katz_centralities.data());
+    }
 
-    if (betas != nullptr) {
-      auto val_first = thrust::make_zip_iterator(thrust::make_tuple(new_katz_centralities, betas));
-      thrust::transform(handle.get_thrust_policy(),
-                        val_first,
-                        val_first + pull_graph_view.get_number_of_local_vertices(),
-                        new_katz_centralities,
-                        [] __device__(auto val) {
-                          auto const katz_centrality = thrust::get<0>(val);
-                          auto const beta            = thrust::get<1>(val);
-                          return katz_centrality + beta;
-                        });
+    thrust::for_each(handle.get_thrust_policy(),
+                     active_vertices.begin(),
+                     active_vertices.end(),
+                     [betas,
+                      katz_centralities,
+                      new_katz_centralities = new_katz_centralities.data(),
+                      diffs                 = diffs.data(),
+                      local_vertex_first] __device__(auto v) {
+                       auto v_offset  = v - local_vertex_first;
+                       auto new_value = new_katz_centralities[v_offset];
+                       if (betas != nullptr) { new_value += betas[v_offset]; }
+                       diffs[v_offset] = std::abs(new_value - katz_centralities[v_offset]);
+                       katz_centralities[v_offset] = new_value;
+                     });
+
+    if (full_iteration) {
+      residual_sum = reduce_v(handle, pull_graph_view, diffs.begin(), diffs.end(), result_t{0.0});
+    }
+
+    auto active_last = thrust::remove_if(
+      handle.get_thrust_policy(),
+      active_vertices.begin(),
+      active_vertices.end(),
+      [diffs = diffs.data(), local_vertex_first, epsilon] __device__(auto v) {
+        return diffs[v - local_vertex_first] < epsilon;
+      });
+    active_vertices.resize(thrust::distance(active_vertices.begin(), active_last),
+                           handle.get_stream());
+
+    iter++;
+
+    auto num_active_vertices = active_vertices.size();
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_active_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_active_vertices, raft::comms::op_t::SUM, handle.get_stream());
     }
+    if (num_active_vertices == 0) {
+      if (full_iteration) {
+        converged = true;
+        break;
+      }
+      // the values of the vertices that dropped out can be stale, re-compute every value
+      full_iteration = true;
+    } else {
+      full_iteration = false;
+    }
+  }
 
-    auto diff_sum = transform_reduce_v(
+  if (!converged) {
+    // return the residual of the partial results
+    copy_to_adj_matrix_row(
+      handle, pull_graph_view, katz_centralities, adj_matrix_row_katz_centralities);
+    copy_v_transform_reduce_in_nbr(handle,
+                                   pull_graph_view,
+                                   adj_matrix_row_katz_centralities.device_view(),
+                                   dummy_properties_t<vertex_t>{}.device_view(),
+                                   e_op,
+                                   init,
+                                   new_katz_centralities.data());
+    residual_sum = transform_reduce_v(
       handle,
       pull_graph_view,
-      thrust::make_zip_iterator(thrust::make_tuple(new_katz_centralities, old_katz_centralities)),
-      [] __device__(auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
+      thrust::make_counting_iterator(vertex_t{0}),
+      [betas,
+       katz_centralities,
+       new_katz_centralities = new_katz_centralities.data()] __device__(auto v_offset) {
+        auto new_value = new_katz_centralities[v_offset];
+        if (betas != nullptr) { new_value += betas[v_offset]; }
+        return std::abs(new_value - katz_centralities[v_offset]);
+      },
       result_t{0.0});
+  }
 
-    iter++;
+  if (normalize) { normalize_katz_centralities(handle, pull_graph_view, katz_centralities); }
+
+  return std::make_tuple(residual_sum, iter);
+}
+
+// Katz Centrality for multiple attenuation factors at once (column c of the column-major block
+// katz_centralities holds the scores for alphas[c]) on the batched power iteration
+template <typename GraphViewType, typename result_t>
+std::vector<size_t> katz_centrality_batch(raft::handle_t const& handle,
+                                          GraphViewType const& pull_graph_view,
+                                          result_t const* betas,
+                                          result_t* katz_centralities,
+                                          std::vector<result_t> const& alphas,
+                                          result_t beta,  // relevant only if betas == nullptr
+                                          result_t epsilon,
+                                          size_t max_iterations,
+                                          bool has_initial_guess,
+                                          bool normalize,
+                                          bool do_expensive_check)
+{
+  static_assert(std::is_integral<typename GraphViewType::vertex_type>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  auto const num_vertices = pull_graph_view.get_number_of_vertices();
+  if ((num_vertices == 0) || (alphas.size() == 0)) { return std::vector<size_t>(alphas.size()); }
+
+  auto const ld = static_cast<size_t>(pull_graph_view.get_number_of_local_vertices());
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(std::all_of(alphas.begin(),
+                              alphas.end(),
+                              [](auto alpha) { return (alpha >= 0.0) && (alpha <= 1.0); }),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
 
-    if (diff_sum < epsilon) {
-      break;
-    } else if (iter >= max_iterations) {
-      CUGRAPH_FAIL("Katz Centrality failed to converge.");
+  if (do_expensive_check) {
+    if (has_initial_guess) {
+      auto num_negative_values = count_if_v(handle,
+                                            pull_graph_view,
+                                            katz_centralities,
+                                            katz_centralities + ld * alphas.size(),
+                                            [] __device__(auto val) { return val < 0.0; });
+      CUGRAPH_EXPECTS(num_negative_values == 0,
+                      "Invalid input argument: initial guess values should be non-negative.");
     }
   }
 
-  if (new_katz_centralities != katz_centralities) {
-    thrust::copy(handle.get_thrust_policy(),
-                 new_katz_centralities,
-                 new_katz_centralities + pull_graph_view.get_number_of_local_vertices(),
-                 katz_centralities);
+  // 2. initialize katz centrality values
+
+  if (!has_initial_guess) {
+    thrust::fill(handle.get_thrust_policy(),
+                 katz_centralities,
+                 katz_centralities + ld * alphas.size(),
+                 result_t{0.0});
   }
 
+  // 3. katz centrality iteration
+
+  auto [iterations, converged] = batched_power_iteration(handle,
+                                                         pull_graph_view,
+                                                         katz_centralities,
+                                                         alphas.size(),
+                                                         alphas,
+                                                         result_t{0.0},
+                                                         betas,
+                                                         beta,
+                                                         power_iteration_normalization_t::none,
+                                                         epsilon,
+                                                         max_iterations,
+                                                         size_t{0});
+  if (!converged) { CUGRAPH_FAIL("Katz Centrality failed to converge."); }
+
   if (normalize) {
-    auto l2_norm = transform_reduce_v(
-      handle,
-      pull_graph_view,
-      katz_centralities,
-      [] __device__(auto val) { return val * val; },
-      result_t{0.0});
-    l2_norm = std::sqrt(l2_norm);
-    CUGRAPH_EXPECTS(l2_norm > 0.0,
-                    "L2 norm of the computed Katz Centrality values should be positive.");
-    thrust::transform(handle.get_thrust_policy(),
-                      katz_centralities,
-                      katz_centralities + pull_graph_view.get_number_of_local_vertices(),
-                      katz_centralities,
-                      [l2_norm] __device__(auto val) { return val / l2_norm; });
+    for (size_t i = 0; i < alphas.size(); ++i) {
+      normalize_katz_centralities(handle, pull_graph_view, katz_centralities + i * ld);
+    }
   }
+
+  return std::move(iterations);
 }
 
 }  // namespace detail
@@ -182,7 +717,9 @@ void katz_centrality(raft::handle_t const& handle,
                      size_t max_iterations,
                      bool has_initial_guess,
                      bool normalize,
-                     bool do_expensive_check)
+                     bool do_expensive_check,
+                     size_t iteration_capture_interval,
+                     bool mixed_precision)
 {
   detail::katz_centrality(handle,
                           graph_view,
@@ -194,7 +731,63 @@ void katz_centrality(raft::handle_t const& handle,
                           max_iterations,
                           has_initial_guess,
                           normalize,
-                          do_expensive_check);
+                          do_expensive_check,
+                          iteration_capture_interval,
+                          mixed_precision);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<result_t, size_t> adaptive_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  result_t const* betas,
+  result_t* katz_centralities,
+  result_t alpha,
+  result_t beta,  // relevant only if beta == nullptr
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check)
+{
+  return detail::adaptive_katz_centrality(handle,
+                                          graph_view,
+                                          betas,
+                                          katz_centralities,
+                                          alpha,
+                                          beta,
+                                          epsilon,
+                                          max_iterations,
+                                          has_initial_guess,
+                                          normalize,
+                                          do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::vector<size_t> katz_centrality_batch(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  result_t const* betas,
+  result_t* katz_centralities,
+  std::vector<result_t> const& alphas,
+  result_t beta,  // relevant only if beta == nullptr
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check)
+{
+  return detail::katz_centrality_batch(handle,
+                                       graph_view,
+                                       betas,
+                                       katz_centralities,
+                                       alphas,
+                                       beta,
+                                       epsilon,
+                                       max_iterations,
+                                       has_initial_guess,
+                                       normalize,
+                                       do_expensive_check);
 }
 
 }  // namespace cugraph
@@ -19,6 +19,7 @@ namespace cugraph {
 
 // SG instantiation
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template void katz_centrality(raft::handle_t const& handle,
                               graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
                               float const* betas,
@@ -29,8 +30,12 @@ template void katz_centrality(raft::handle_t const& handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t iteration_capture_interval,
+                              bool mixed_precision);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template void katz_centrality(raft::handle_t const& handle,
                               graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
                               double const* betas,
@@ -41,8 +46,12 @@ template void katz_centrality(raft::handle_t const& handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t iteration_capture_interval,
+                              bool mixed_precision);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template void katz_centrality(raft::handle_t const& handle,
                               graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
                               float const* betas,
@@ -53,8 +62,12 @@ template void katz_centrality(raft::handle_t const& handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t iteration_capture_interval,
+                              bool mixed_precision);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template void katz_centrality(raft::handle_t const& handle,
                               graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
                               double const* betas,
@@ -65,8 +78,12 @@ template void katz_centrality(raft::handle_t const& handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t iteration_capture_interval,
+                              bool mixed_precision);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template void katz_centrality(raft::handle_t const& handle,
                               graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
                               float const* betas,
@@ -77,8 +94,12 @@ template void katz_centrality(raft::handle_t const& handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t iteration_capture_interval,
+                              bool mixed_precision);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template void katz_centrality(raft::handle_t const& handle,
                               graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
                               double const* betas,
@@ -89,6 +110,189 @@ template void katz_centrality(raft::handle_t const& handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t iteration_capture_interval,
+                              bool mixed_precision);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::tuple<float, size_t> adaptive_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
+  float const* betas,
+  float* katz_centralities,
+  float alpha,
+  float beta,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::tuple<double, size_t> adaptive_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
+  double const* betas,
+  double* katz_centralities,
+  double alpha,
+  double beta,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::tuple<float, size_t> adaptive_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
+  float const* betas,
+  float* katz_centralities,
+  float alpha,
+  float beta,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::tuple<double, size_t> adaptive_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
+  double const* betas,
+  double* katz_centralities,
+  double alpha,
+  double beta,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::tuple<float, size_t> adaptive_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
+  float const* betas,
+  float* katz_centralities,
+  float alpha,
+  float beta,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::tuple<double, size_t> adaptive_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
+  double const* betas,
+  double* katz_centralities,
+  double alpha,
+  double beta,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::vector<size_t> katz_centrality_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
+  float const* betas,
+  float* katz_centralities,
+  std::vector<float> const& alphas,
+  float beta,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::vector<size_t> katz_centrality_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
+  double const* betas,
+  double* katz_centralities,
+  std::vector<double> const& alphas,
+  double beta,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::vector<size_t> katz_centrality_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
+  float const* betas,
+  float* katz_centralities,
+  std::vector<float> const& alphas,
+  float beta,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::vector<size_t> katz_centrality_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
+  double const* betas,
+  double* katz_centralities,
+  std::vector<double> const& alphas,
+  double beta,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::vector<size_t> katz_centrality_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
+  float const* betas,
+  float* katz_centralities,
+  std::vector<float> const& alphas,
+  float beta,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::vector<size_t> katz_centrality_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
+  double const* betas,
+  double* katz_centralities,
+  std::vector<double> const& alphas,
+  double beta,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/louvain.cuh>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// maps [0, num_vertices) to a pseudo-random permutation of [0, num_vertices): x -> ((x * multiplier
+// + increment) mod 2^k) followed by x ^= (x >> shift) is a bijection on [0, 2^k) (multiplier is
+// odd), and cycle-walking (re-applying the bijection until the result is smaller than
+// num_vertices, 2^k < 2 * num_vertices) restricts it to a bijection on [0, num_vertices). Every GPU
+// computes the labels of its local vertices without communication.
+template <typename vertex_t>
+struct random_permutation_t {
+  uint64_t num_vertices{};
+  uint64_t mask{};  // 2^k - 1
+  uint64_t multiplier{};
+  uint64_t increment{};
+  int shift{};
+
+  __device__ vertex_t operator()(vertex_t v) const
+  {
+    auto x = static_cast<uint64_t>(v);
+    do {
+      x = (x * multiplier + increment) & mask;
+      x ^= (x >> shift);
+    } while (x >= num_vertices);
+    return static_cast<vertex_t>(x);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t,
+          typename weight_t,
+          typename MatrixPartitionDeviceView,
+          typename AdjMatrixRowClusterInputWrapper,
+          typename AdjMatrixColClusterInputWrapper>
+struct count_intra_cluster_edge_t {
+  MatrixPartitionDeviceView matrix_partition{};
+  AdjMatrixRowClusterInputWrapper matrix_partition_row_cluster_input{};
+  AdjMatrixColClusterInputWrapper adj_matrix_col_cluster_input{};
+  vertex_t const* majors{nullptr};
+  vertex_t const* minors{nullptr};
+  weight_t* counts{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    if (matrix_partition_row_cluster_input.get(
+          matrix_partition.get_major_offset_from_major_nocheck(majors[i])) ==
+        adj_matrix_col_cluster_input.get(
+          matrix_partition.get_minor_offset_from_minor_nocheck(minors[i]))) {
+      counts[i] += weight_t{1};
+    }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename weight_t>
+struct ecg_weight_op_t {
+  weight_t min_weight{};
+  weight_t ensemble_size{};
+
+  __device__ weight_t operator()(weight_t count) const
+  {
+    return min_weight + (weight_t{1} - min_weight) * count / ensemble_size;
+  }
+};
+
+}  // namespace detail
+
+// ECG runs single-level Louvain on an ensemble of random vertex orderings and re-weights every
+// edge by the fraction of the ensemble members placing its end points in the same cluster. Every
+// member runs on the same (input) graph: a member only differs in the initial (singleton) cluster
+// IDs (a random permutation of the vertex IDs, which changes the tie breaking and the up_down rule
+// of the local moving phase), so the vertex weights are computed once and the co-membership
+// counts are accumulated in a single buffer (in the edge order of the local adjacency matrix
+// partitions) instead of creating a graph per member.
+template <typename graph_view_type>
+class EcgLouvain : public Louvain<graph_view_type> {
+ public:
+  using graph_view_t = graph_view_type;
+  using vertex_t     = typename graph_view_t::vertex_type;
+  using edge_t       = typename graph_view_t::edge_type;
+  using weight_t     = typename graph_view_t::weight_type;
+  using graph_t      = typename Louvain<graph_view_type>::graph_t;
+
+  EcgLouvain(raft::handle_t const& handle, graph_view_t const& graph_view)
+    : Louvain<graph_view_type>(handle, graph_view)
+  {
+  }
+
+  // returns the graph with the ECG edge weights (the vertex partitioning of the input graph is
+  // unchanged)
+  std::unique_ptr<graph_t> compute_ecg_graph(weight_t min_weight,
+                                             vertex_t ensemble_size,
+                                             uint64_t seed)
+  {
+    auto const& handle     = this->handle_;
+    auto const& graph_view = this->current_graph_view_;
+
+    auto [edgelist_majors, edgelist_minors, edgelist_weights] =
+      this->decompress_local_adj_matrix_partitions();
+
+    // the co-membership counts start from the input edge weights (1 for unweighted graphs) as in
+    // the legacy implementation
+    std::vector<rmm::device_uvector<weight_t>> edgelist_counts{};
+    if (edgelist_weights) {
+      edgelist_counts = std::move(*edgelist_weights);
+    } else {
+      for (size_t i = 0; i < edgelist_majors.size(); ++i) {
+        edgelist_counts.emplace_back(edgelist_majors[i].size(), handle.get_stream());
+        thrust::fill(handle.get_thrust_policy(),
+                     edgelist_counts.back().begin(),
+                     edgelist_counts.back().end(),
+                     weight_t{1});
+      }
+    }
+
+    weight_t total_edge_weight = this->compute_total_edge_weight();
+
+    this->dendrogram_->add_level(graph_view.get_local_vertex_first(),
+                                 graph_view.get_number_of_local_vertices(),
+                                 handle.get_stream_view());
+    this->vertex_weights_v_ = graph_view.compute_out_weight_sums(handle);
+
+    std::mt19937_64 rng(seed);
+    for (vertex_t member = 0; member < ensemble_size; ++member) {
+      initialize_random_permutation_level(rng);
+      this->initialize_cluster_weights();
+
+      this->update_clustering(total_edge_weight, weight_t{1});
+
+      accumulate_intra_cluster_edge_counts(edgelist_majors, edgelist_minors, edgelist_counts);
+    }
+
+    for (auto& counts : edgelist_counts) {
+      thrust::transform(handle.get_thrust_policy(),
+                        counts.begin(),
+                        counts.end(),
+                        counts.begin(),
+                        detail::ecg_weight_op_t<weight_t>{min_weight,
+                                                          static_cast<weight_t>(ensemble_size)});
+    }
+
+    return this->create_graph_from_local_adj_matrix_partition_edgelists(
+      edgelist_majors, edgelist_minors, std::make_optional(std::move(edgelist_counts)));
+  }
+
+ protected:
+  // sets the (singleton) clusters in the current dendrogram level to a random permutation of the
+  // vertex IDs
+  void initialize_random_permutation_level(std::mt19937_64& rng)
+  {
+    auto num_vertices = static_cast<uint64_t>(this->current_graph_view_.get_number_of_vertices());
+    int k{0};
+    while ((uint64_t{1} << k) < num_vertices) {
+      ++k;
+    }
+
+    detail::random_permutation_t<vertex_t> permutation_op{};
+    permutation_op.num_vertices = num_vertices;
+    permutation_op.mask         = (k < 64) ? ((uint64_t{1} << k) - 1) : ~uint64_t{0};
+    permutation_op.multiplier   = rng() | uint64_t{1};
+    permutation_op.increment    = rng();
+    permutation_op.shift        = std::max(k / 2, 1);
+
+    thrust::transform(this->handle_.get_thrust_policy(),
+                      thrust::make_counting_iterator(
+                        this->current_graph_view_.get_local_vertex_first()),
+                      thrust::make_counting_iterator(
+                        this->current_graph_view_.get_local_vertex_last()),
+                      this->dendrogram_->current_level_begin(),
+                      permutation_op);
+  }
+
+  // adds 1 to the count of every edge whose end points belong to the same cluster in the current
+  // dendrogram level
+  void accumulate_intra_cluster_edge_counts(
+    std::vector<rmm::device_uvector<vertex_t>> const& edgelist_majors,
+    std::vector<rmm::device_uvector<vertex_t>> const& edgelist_minors,
+    std::vector<rmm::device_uvector<weight_t>>& edgelist_counts) const
+  {
+    auto const& handle     = this->handle_;
+    auto const& graph_view = this->current_graph_view_;
+
+    row_properties_t<graph_view_t, vertex_t> src_clusters{};
+    col_properties_t<graph_view_t, vertex_t> dst_clusters{};
+    if constexpr (graph_view_t::is_multi_gpu) {
+      src_clusters = row_properties_t<graph_view_t, vertex_t>(handle, graph_view);
+      copy_to_adj_matrix_row(
+        handle, graph_view, this->dendrogram_->current_level_begin(), src_clusters);
+      dst_clusters = col_properties_t<graph_view_t, vertex_t>(handle, graph_view);
+      copy_to_adj_matrix_col(
+        handle, graph_view, this->dendrogram_->current_level_begin(), dst_clusters);
+    }
+    auto row_cluster_input =
+      graph_view_t::is_multi_gpu
+        ? src_clusters.device_view()
+        : detail::major_properties_device_view_t<vertex_t, vertex_t const*>(
+            this->dendrogram_->current_level_begin());
+    auto col_cluster_input =
+      graph_view_t::is_multi_gpu
+        ? dst_clusters.device_view()
+        : detail::minor_properties_device_view_t<vertex_t, vertex_t const*>(
+            this->dendrogram_->current_level_begin());
+
+    for (size_t i = 0; i < edgelist_majors.size(); ++i) {
+      auto matrix_partition =
+        matrix_partition_device_view_t<vertex_t, edge_t, weight_t, graph_view_t::is_multi_gpu>(
+          graph_view.get_matrix_partition_view(i));
+
+      auto matrix_partition_row_cluster_input = row_cluster_input;
+      matrix_partition_row_cluster_input.set_local_adj_matrix_partition_idx(i);
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(edgelist_majors[i].size()),
+        detail::count_intra_cluster_edge_t<vertex_t,
+                                           weight_t,
+                                           decltype(matrix_partition),
+                                           decltype(matrix_partition_row_cluster_input),
+                                           decltype(col_cluster_input)>{matrix_partition,
+                                                     matrix_partition_row_cluster_input,
+                                                     col_cluster_input,
+                                                     edgelist_majors[i].data(),
+                                                     edgelist_minors[i].data(),
+                                                     edgelist_counts[i].data()});
+    }
+  }
+};
+
+}  // namespace cugraph
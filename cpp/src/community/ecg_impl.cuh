@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/ecg.cuh>
+#include <community/louvain_impl.cuh>
+#include <cugraph/graph.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+namespace cugraph {
+
+template <typename graph_view_t>
+void ecg(raft::handle_t const& handle,
+         graph_view_t const& graph_view,
+         typename graph_view_t::weight_type min_weight,
+         typename graph_view_t::vertex_type ensemble_size,
+         typename graph_view_t::vertex_type* clustering)
+{
+  using weight_t = typename graph_view_t::weight_type;
+
+  CUGRAPH_EXPECTS((min_weight >= weight_t{0}) && (min_weight <= weight_t{1}),
+                  "Invalid input argument: min_weight should be in [0, 1].");
+  CUGRAPH_EXPECTS(ensemble_size > 0,
+                  "Invalid input argument: ensemble_size should be a positive integer.");
+  detail::check_clustering(graph_view, clustering);
+
+  // FIXME:  This seed should be a parameter
+  uint64_t seed{1};
+
+  EcgLouvain<graph_view_t> runner(handle, graph_view);
+  auto ecg_graph = runner.compute_ecg_graph(min_weight, ensemble_size, seed);
+
+  // Run Louvain on the original graph using the computed weights
+  // (pass max_level = 100 for a "full run")
+  louvain(handle, ecg_graph->view(), clustering, size_t{100}, weight_t{1});
+}
+
+}  // namespace cugraph
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <community/ecg_impl.cuh>
+
+namespace cugraph {
+
+// Explicit template instantations
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void ecg(raft::handle_t const&,
+                  graph_view_t<int32_t, int32_t, float, false, false> const&,
+                  float,
+                  int32_t,
+                  int32_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void ecg(raft::handle_t const&,
+                  graph_view_t<int32_t, int64_t, float, false, false> const&,
+                  float,
+                  int32_t,
+                  int32_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void ecg(raft::handle_t const&,
+                  graph_view_t<int64_t, int64_t, float, false, false> const&,
+                  float,
+                  int64_t,
+                  int64_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void ecg(raft::handle_t const&,
+                  graph_view_t<int32_t, int32_t, double, false, false> const&,
+                  double,
+                  int32_t,
+                  int32_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void ecg(raft::handle_t const&,
+                  graph_view_t<int32_t, int64_t, double, false, false> const&,
+                  double,
+                  int32_t,
+                  int32_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void ecg(raft::handle_t const&,
+                  graph_view_t<int64_t, int64_t, double, false, false> const&,
+                  double,
+                  int64_t,
+                  int64_t*);
+#endif
+
+}  // namespace cugraph
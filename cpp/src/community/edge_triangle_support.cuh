@@ -0,0 +1,569 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// Triangles are enumerated on the oriented graph: every undirected edge is oriented from the end
+// point with the smaller (degree, vertex ID) pair to the other end point (so every vertex has
+// O(sqrt(E)) out-neighbors), and every triangle is found once from its lowest edge (u, v) as a
+// common (oriented) neighbor w of u & v. A GPU stores the oriented edges with its local vertices as
+// majors sorted by (major, minor) (CSR offsets over the local vertices), and the oriented neighbor
+// lists of the minors owned by the other GPUs are fetched in rounds.
+
+// the neighbor lists of up to this many vertices are fetched from the other GPUs at a time
+size_t constexpr max_num_nbr_list_vertices_per_round{size_t{1} << 20};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t,
+          typename edge_t,
+          typename MatrixPartitionDeviceView,
+          typename AdjMatrixRowDegreeInputWrapper,
+          typename AdjMatrixColDegreeInputWrapper>
+struct is_not_low_to_high_degree_edge_t {
+  MatrixPartitionDeviceView matrix_partition{};
+  AdjMatrixRowDegreeInputWrapper matrix_partition_row_degree_input{};
+  AdjMatrixColDegreeInputWrapper adj_matrix_col_degree_input{};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    auto major          = thrust::get<0>(e);
+    auto minor          = thrust::get<1>(e);
+    edge_t major_degree = matrix_partition_row_degree_input.get(
+      matrix_partition.get_major_offset_from_major_nocheck(major));
+    edge_t minor_degree =
+      adj_matrix_col_degree_input.get(matrix_partition.get_minor_offset_from_minor_nocheck(minor));
+    return !((major_degree < minor_degree) || ((major_degree == minor_degree) && (major < minor)));
+  }
+};
+
+// intersects the (sorted, oriented) neighbor lists of the two end points of an oriented edge; the
+// neighbor lists of the majors are local (CSR offsets into minors), and the neighbor lists of the
+// minors are looked up in (nbr_offsets, nbr_indices), indexed by the position of the minor in
+// nbr_vertices (or by minor - nbr_vertex_first if nbr_vertices is nullptr)
+template <typename vertex_t, typename edge_t>
+struct intersect_nbr_lists_t {
+  vertex_t const* majors{nullptr};
+  vertex_t const* minors{nullptr};
+  edge_t const* offsets{nullptr};
+  vertex_t major_first{0};
+  edge_t const* edge_indices{nullptr};  // if nullptr, the i'th edge is the i'th edge to process
+
+  vertex_t const* nbr_vertices{nullptr};
+  vertex_t num_nbr_vertices{0};
+  vertex_t nbr_vertex_first{0};
+  edge_t const* nbr_offsets{nullptr};
+  vertex_t const* nbr_indices{nullptr};
+
+  // if not nullptr, for the k'th common neighbor w of the i'th edge (u, v), the positions of (u, w)
+  // in minors and (v, w) in nbr_indices are written to major_edge_indices and minor_edge_indices
+  // (at common_nbr_offsets[i] + k), respectively
+  edge_t const* common_nbr_offsets{nullptr};
+  edge_t* major_edge_indices{nullptr};
+  edge_t* minor_edge_indices{nullptr};
+
+  __device__ edge_t operator()(edge_t i) const
+  {
+    auto e     = edge_indices != nullptr ? edge_indices[i] : i;
+    auto major = majors[e];
+    auto minor = minors[e];
+
+    auto first0 = minors + offsets[major - major_first];
+    auto last0  = minors + offsets[major - major_first + 1];
+    auto idx    = nbr_vertices != nullptr
+                 ? static_cast<vertex_t>(thrust::distance(
+                     nbr_vertices,
+                     thrust::lower_bound(
+                       thrust::seq, nbr_vertices, nbr_vertices + num_nbr_vertices, minor)))
+                 : minor - nbr_vertex_first;
+    auto first1 = nbr_indices + nbr_offsets[idx];
+    auto last1  = nbr_indices + nbr_offsets[idx + 1];
+
+    edge_t count{0};
+    while ((first0 < last0) && (first1 < last1)) {
+      if (*first0 < *first1) {
+        ++first0;
+      } else if (*first1 < *first0) {
+        ++first1;
+      } else {
+        if (major_edge_indices != nullptr) {
+          major_edge_indices[common_nbr_offsets[i] + count] =
+            static_cast<edge_t>(thrust::distance(minors, first0));
+        }
+        if (minor_edge_indices != nullptr) {
+          minor_edge_indices[common_nbr_offsets[i] + count] =
+            static_cast<edge_t>(thrust::distance(nbr_indices, first1));
+        }
+        ++count;
+        ++first0;
+        ++first1;
+      }
+    }
+
+    return count;
+  }
+};
+
+// returns the oriented edges (u, v) of graph_view with (degree(u), u) < (degree(v), v) (this drops
+// self-loops as well); the returned edges are stored on the GPUs owning the majors (in multi-GPU)
+// and sorted by (major, minor)
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+extract_low_to_high_degree_edges(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>;
+
+  auto out_degrees = graph_view.compute_out_degrees(handle);
+
+  row_properties_t<graph_view_type, edge_t> row_degrees{};
+  col_properties_t<graph_view_type, edge_t> col_degrees{};
+  if constexpr (multi_gpu) {
+    row_degrees = row_properties_t<graph_view_type, edge_t>(handle, graph_view);
+    copy_to_adj_matrix_row(handle, graph_view, out_degrees.begin(), row_degrees);
+    col_degrees = col_properties_t<graph_view_type, edge_t>(handle, graph_view);
+    copy_to_adj_matrix_col(handle, graph_view, out_degrees.begin(), col_degrees);
+  }
+  auto row_degree_input =
+    multi_gpu ? row_degrees.device_view()
+              : detail::major_properties_device_view_t<vertex_t, edge_t const*>(out_degrees.data());
+  auto col_degree_input =
+    multi_gpu ? col_degrees.device_view()
+              : detail::minor_properties_device_view_t<vertex_t, edge_t const*>(out_degrees.data());
+
+  std::vector<size_t> edge_counts(graph_view.get_number_of_local_adj_matrix_partitions());
+  for (size_t i = 0; i < edge_counts.size(); ++i) {
+    edge_counts[i] =
+      static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_edges(i));
+  }
+
+  rmm::device_uvector<vertex_t> majors(std::reduce(edge_counts.begin(), edge_counts.end()),
+                                       handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(majors.size(), handle.get_stream());
+  size_t num_oriented_edges{0};
+  for (size_t i = 0; i < edge_counts.size(); ++i) {
+    auto matrix_partition = matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+      graph_view.get_matrix_partition_view(i));
+
+    rmm::device_uvector<vertex_t> tmp_majors(edge_counts[i], handle.get_stream());
+    rmm::device_uvector<vertex_t> tmp_minors(tmp_majors.size(), handle.get_stream());
+    decompress_matrix_partition_to_edgelist(
+      handle,
+      matrix_partition,
+      tmp_majors.data(),
+      tmp_minors.data(),
+      std::optional<weight_t*>{std::nullopt},
+      graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+
+    auto matrix_partition_row_degree_input = row_degree_input;
+    matrix_partition_row_degree_input.set_local_adj_matrix_partition_idx(i);
+    auto tmp_edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(tmp_majors.begin(), tmp_minors.begin()));
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+    num_oriented_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::remove_copy_if(
+        handle.get_thrust_policy(),
+        tmp_edge_first,
+        tmp_edge_first + tmp_majors.size(),
+        edge_first + num_oriented_edges,
+        is_not_low_to_high_degree_edge_t<vertex_t,
+                                         edge_t,
+                                         decltype(matrix_partition),
+                                         decltype(matrix_partition_row_degree_input),
+                                         decltype(col_degree_input)>{
+          matrix_partition, matrix_partition_row_degree_input, col_degree_input})));
+  }
+  majors.resize(num_oriented_edges, handle.get_stream());
+  minors.resize(num_oriented_edges, handle.get_stream());
+  majors.shrink_to_fit(handle.get_stream());
+  minors.shrink_to_fit(handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    auto& comm                  = handle.get_comms();
+    auto vertex_partition_lasts = graph_view.get_vertex_partition_lasts();
+    rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                           handle.get_stream());
+    raft::update_device(d_vertex_partition_lasts.data(),
+                        vertex_partition_lasts.data(),
+                        vertex_partition_lasts.size(),
+                        handle.get_stream());
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+    std::forward_as_tuple(std::tie(majors, minors), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        edge_first,
+        edge_first + majors.size(),
+        renumbered_vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(),
+                                                comm.get_size()},
+        handle.get_stream());
+  }
+
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+  thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + majors.size());
+
+  return std::make_tuple(std::move(majors), std::move(minors));
+}
+
+// calls batch_op(intersect_op, num_edges, nbr_edge_indices) for the batches of the local oriented
+// edges (majors, minors, offsets as returned by extract_low_to_high_degree_edges &
+// compute_sorted_edge_offsets), every local oriented edge belongs to exactly one batch;
+// intersect_op is set to intersect the neighbor lists of the end points of the batch's edges, and
+// nbr_edge_indices (if with_nbr_edge_indices is true in multi-GPU, nullptr otherwise) maps a
+// position in intersect_op.nbr_indices to the position of the edge in the owner's local edges (in
+// single-GPU, the positions in intersect_op.nbr_indices are the positions in minors)
+template <typename vertex_t, typename edge_t, bool multi_gpu, typename BatchOp>
+void for_each_oriented_edge_batch(raft::handle_t const& handle,
+                                  rmm::device_uvector<vertex_t> const& majors,
+                                  rmm::device_uvector<vertex_t> const& minors,
+                                  rmm::device_uvector<edge_t> const& offsets,
+                                  vertex_t local_vertex_first,
+                                  std::vector<vertex_t> const& vertex_partition_lasts,
+                                  bool with_nbr_edge_indices,
+                                  BatchOp batch_op)
+{
+  intersect_nbr_lists_t<vertex_t, edge_t> intersect_op{};
+  intersect_op.majors      = majors.data();
+  intersect_op.minors      = minors.data();
+  intersect_op.offsets     = offsets.data();
+  intersect_op.major_first = local_vertex_first;
+
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    // sort the edges by minors to process the edges with the minors in a round together
+
+    rmm::device_uvector<edge_t> minor_sorted_edge_indices(majors.size(), handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(),
+                     minor_sorted_edge_indices.begin(),
+                     minor_sorted_edge_indices.end(),
+                     edge_t{0});
+    rmm::device_uvector<vertex_t> sorted_minors(minors.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), minors.begin(), minors.end(), sorted_minors.begin());
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        sorted_minors.begin(),
+                        sorted_minors.end(),
+                        minor_sorted_edge_indices.begin());
+
+    rmm::device_uvector<vertex_t> unique_minors(sorted_minors.size(), handle.get_stream());
+    unique_minors.resize(
+      thrust::distance(unique_minors.begin(),
+                       thrust::unique_copy(handle.get_thrust_policy(),
+                                           sorted_minors.begin(),
+                                           sorted_minors.end(),
+                                           unique_minors.begin())),
+      handle.get_stream());
+
+    rmm::device_uvector<edge_t> unique_minor_edge_offsets(unique_minors.size() + 1,
+                                                          handle.get_stream());
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        sorted_minors.begin(),
+                        sorted_minors.end(),
+                        unique_minors.begin(),
+                        unique_minors.end(),
+                        unique_minor_edge_offsets.begin());
+    unique_minor_edge_offsets.set_element_async(
+      unique_minors.size(), static_cast<edge_t>(sorted_minors.size()), handle.get_stream());
+    sorted_minors.resize(0, handle.get_stream());
+    sorted_minors.shrink_to_fit(handle.get_stream());
+
+    rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                           handle.get_stream());
+    raft::update_device(d_vertex_partition_lasts.data(),
+                        vertex_partition_lasts.data(),
+                        vertex_partition_lasts.size(),
+                        handle.get_stream());
+
+    auto num_rounds = host_scalar_allreduce(
+      comm,
+      (unique_minors.size() + max_num_nbr_list_vertices_per_round - 1) /
+        max_num_nbr_list_vertices_per_round,
+      raft::comms::op_t::MAX,
+      handle.get_stream());
+
+    for (size_t r = 0; r < num_rounds; ++r) {
+      auto round_first = std::min(r * max_num_nbr_list_vertices_per_round, unique_minors.size());
+      auto round_last =
+        std::min((r + 1) * max_num_nbr_list_vertices_per_round, unique_minors.size());
+
+      auto [nbr_offsets, nbr_indices, nbr_edge_indices] =
+        fetch_nbr_lists(handle,
+                        unique_minors.data() + round_first,
+                        round_last - round_first,
+                        minors,
+                        offsets,
+                        local_vertex_first,
+                        d_vertex_partition_lasts,
+                        with_nbr_edge_indices);
+
+      auto edge_first = unique_minor_edge_offsets.element(round_first, handle.get_stream());
+      auto edge_last  = unique_minor_edge_offsets.element(round_last, handle.get_stream());
+
+      intersect_op.edge_indices     = minor_sorted_edge_indices.data() + edge_first;
+      intersect_op.nbr_vertices     = unique_minors.data() + round_first;
+      intersect_op.num_nbr_vertices = static_cast<vertex_t>(round_last - round_first);
+      intersect_op.nbr_offsets      = nbr_offsets.data();
+      intersect_op.nbr_indices      = nbr_indices.data();
+
+      batch_op(intersect_op,
+               static_cast<size_t>(edge_last - edge_first),
+               nbr_edge_indices ? static_cast<edge_t const*>((*nbr_edge_indices).data())
+                                : static_cast<edge_t const*>(nullptr));
+    }
+  } else {
+    intersect_op.nbr_vertex_first = local_vertex_first;
+    intersect_op.nbr_offsets      = offsets.data();
+    intersect_op.nbr_indices      = minors.data();
+
+    batch_op(intersect_op, majors.size(), static_cast<edge_t const*>(nullptr));
+  }
+}
+
+// returns (common_nbr_offsets, major_edge_indices[, minor_edge_indices]) for the num_edges edges of
+// intersect_op (see intersect_nbr_lists_t), common_nbr_offsets[i + 1] - common_nbr_offsets[i] is
+// the number of the triangles found from the i'th edge
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<edge_t>,
+           rmm::device_uvector<edge_t>,
+           std::optional<rmm::device_uvector<edge_t>>>
+find_common_nbrs(raft::handle_t const& handle,
+                 intersect_nbr_lists_t<vertex_t, edge_t> intersect_op,
+                 size_t num_edges,
+                 bool with_minor_edge_indices)
+{
+  rmm::device_uvector<edge_t> common_nbr_offsets(num_edges + 1, handle.get_stream());
+  common_nbr_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(edge_t{0}),
+                    thrust::make_counting_iterator(static_cast<edge_t>(num_edges)),
+                    common_nbr_offsets.begin() + 1,
+                    intersect_op);
+  thrust::inclusive_scan(handle.get_thrust_policy(),
+                         common_nbr_offsets.begin() + 1,
+                         common_nbr_offsets.end(),
+                         common_nbr_offsets.begin() + 1);
+  auto num_common_nbrs = static_cast<size_t>(common_nbr_offsets.back_element(handle.get_stream()));
+
+  rmm::device_uvector<edge_t> major_edge_indices(num_common_nbrs, handle.get_stream());
+  auto minor_edge_indices =
+    with_minor_edge_indices
+      ? std::make_optional<rmm::device_uvector<edge_t>>(num_common_nbrs, handle.get_stream())
+      : std::nullopt;
+  intersect_op.common_nbr_offsets = common_nbr_offsets.data();
+  intersect_op.major_edge_indices = major_edge_indices.data();
+  intersect_op.minor_edge_indices = minor_edge_indices ? (*minor_edge_indices).data() : nullptr;
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(edge_t{0}),
+                   thrust::make_counting_iterator(static_cast<edge_t>(num_edges)),
+                   intersect_op);
+
+  return std::make_tuple(
+    std::move(common_nbr_offsets), std::move(major_edge_indices), std::move(minor_edge_indices));
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct add_batch_edge_supports_t {
+  edge_t const* edge_indices{nullptr};  // if nullptr, the i'th edge is the i'th edge of the batch
+  edge_t const* common_nbr_offsets{nullptr};
+  edge_t* supports{nullptr};
+
+  __device__ void operator()(edge_t i) const
+  {
+    auto e = edge_indices != nullptr ? edge_indices[i] : i;
+    // an edge belongs to a single batch and appears once in the batch, so no atomics are necessary
+    supports[e] += common_nbr_offsets[i + 1] - common_nbr_offsets[i];
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct set_minor_edge_owners_t {
+  vertex_t const* minors{nullptr};
+  edge_t const* edge_indices{nullptr};  // if nullptr, the i'th edge is the i'th edge of the batch
+  edge_t const* common_nbr_offsets{nullptr};
+  edge_t const* nbr_edge_indices{nullptr};
+  vertex_t* owner_vertices{nullptr};
+  edge_t* minor_edge_indices{nullptr};
+
+  __device__ void operator()(edge_t i) const
+  {
+    auto e     = edge_indices != nullptr ? edge_indices[i] : i;
+    auto minor = minors[e];
+    for (auto k = common_nbr_offsets[i]; k < common_nbr_offsets[i + 1]; ++k) {
+      owner_vertices[k]     = minor;
+      minor_edge_indices[k] = nbr_edge_indices[minor_edge_indices[k]];
+    }
+  }
+};
+
+/**
+ * @brief Compute the triangle support (the number of the triangles including the edge) of every
+ * local oriented edge.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param majors Majors of the local oriented edges (see extract_low_to_high_degree_edges).
+ * @param minors Minors of the local oriented edges.
+ * @param offsets CSR offsets of the local oriented edges (see compute_sorted_edge_offsets).
+ * @param local_vertex_first First local vertex ID.
+ * @param vertex_partition_lasts Last (exclusive) vertex IDs of the vertex partitions (multi-GPU
+ * only).
+ * @return rmm::device_uvector<edge_t> The triangle supports of the local oriented edges (in the
+ * order of majors & minors).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<edge_t> compute_edge_triangle_supports(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t> const& majors,
+  rmm::device_uvector<vertex_t> const& minors,
+  rmm::device_uvector<edge_t> const& offsets,
+  vertex_t local_vertex_first,
+  std::vector<vertex_t> const& vertex_partition_lasts)
+{
+  rmm::device_uvector<edge_t> supports(majors.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), supports.begin(), supports.end(), edge_t{0});
+
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                         handle.get_stream());
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      vertex_partition_lasts.data(),
+                      vertex_partition_lasts.size(),
+                      handle.get_stream());
+
+  // a triangle (u, v, w) found from the oriented edge (u, v) adds 1 to the supports of (u, v),
+  // (u, w) (local, u is a local vertex), and (v, w) (stored in the GPU owning v)
+
+  for_each_oriented_edge_batch<vertex_t, edge_t, multi_gpu>(
+    handle,
+    majors,
+    minors,
+    offsets,
+    local_vertex_first,
+    vertex_partition_lasts,
+    true,
+    [&handle, &supports, &d_vertex_partition_lasts](
+      intersect_nbr_lists_t<vertex_t, edge_t> intersect_op,
+      size_t num_edges,
+      edge_t const* nbr_edge_indices) {
+      auto [common_nbr_offsets, major_edge_indices, minor_edge_indices] =
+        find_common_nbrs(handle, intersect_op, num_edges, true);
+
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(edge_t{0}),
+                       thrust::make_counting_iterator(static_cast<edge_t>(num_edges)),
+                       add_batch_edge_supports_t<vertex_t, edge_t>{
+                         intersect_op.edge_indices, common_nbr_offsets.data(), supports.data()});
+
+      if constexpr (multi_gpu) {
+        auto& comm = handle.get_comms();
+
+        rmm::device_uvector<vertex_t> owner_vertices((*minor_edge_indices).size(),
+                                                     handle.get_stream());
+        thrust::for_each(handle.get_thrust_policy(),
+                         thrust::make_counting_iterator(edge_t{0}),
+                         thrust::make_counting_iterator(static_cast<edge_t>(num_edges)),
+                         set_minor_edge_owners_t<vertex_t, edge_t>{intersect_op.minors,
+                                                                   intersect_op.edge_indices,
+                                                                   common_nbr_offsets.data(),
+                                                                   nbr_edge_indices,
+                                                                   owner_vertices.data(),
+                                                                   (*minor_edge_indices).data()});
+        common_nbr_offsets.resize(0, handle.get_stream());
+        common_nbr_offsets.shrink_to_fit(handle.get_stream());
+
+        auto pair_first = thrust::make_zip_iterator(
+          thrust::make_tuple(owner_vertices.begin(), (*minor_edge_indices).begin()));
+        std::forward_as_tuple(std::tie(owner_vertices, *minor_edge_indices), std::ignore) =
+          groupby_gpuid_and_shuffle_values(
+            comm,
+            pair_first,
+            pair_first + owner_vertices.size(),
+            renumbered_vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(),
+                                                    comm.get_size()},
+            handle.get_stream());
+      }
+
+      rmm::device_uvector<edge_t> keys(major_edge_indices.size() + (*minor_edge_indices).size(),
+                                       handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   major_edge_indices.begin(),
+                   major_edge_indices.end(),
+                   keys.begin());
+      thrust::copy(handle.get_thrust_policy(),
+                   (*minor_edge_indices).begin(),
+                   (*minor_edge_indices).end(),
+                   keys.begin() + major_edge_indices.size());
+      major_edge_indices.resize(0, handle.get_stream());
+      major_edge_indices.shrink_to_fit(handle.get_stream());
+      (*minor_edge_indices).resize(0, handle.get_stream());
+      (*minor_edge_indices).shrink_to_fit(handle.get_stream());
+
+      rmm::device_uvector<edge_t> increments(keys.size(), handle.get_stream());
+      thrust::fill(handle.get_thrust_policy(), increments.begin(), increments.end(), edge_t{1});
+      reduce_by_sorted_key(handle, keys, increments);
+
+      // keys are unique, so no atomics are necessary
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(keys.size()),
+                       add_reduced_values_t<edge_t, edge_t>{
+                         keys.data(), increments.data(), supports.data(), edge_t{0}});
+    });
+
+  return supports;
+}
+
+}  // namespace detail
+}  // namespace cugraph
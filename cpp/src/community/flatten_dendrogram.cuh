@@ -18,11 +18,81 @@
 #include <cugraph/dendrogram.hpp>
 #include <cugraph/graph_functions.hpp>
 
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <vector>
+
 namespace cugraph {
 
+namespace detail {
+
+// in single-GPU, the level l map sends a vertex v in [first_l, first_l + size_l) to its cluster at
+// level l + 1 (the vertex ID of the next level); one thread composes every level map for an input
+// vertex instead of relabeling the whole partition once per level, and (if level_partitions is not
+// nullptr) stores the vertex's cluster at every level on the way
+template <typename vertex_t>
+struct compose_level_maps_t {
+  vertex_t const* const* level_maps{nullptr};
+  vertex_t const* level_first_indices{nullptr};
+  size_t num_levels{0};
+  vertex_t* level_partitions{nullptr};  // size = num_levels * num_verts, nullptr if not used
+  size_t num_verts{0};
+
+  __device__ vertex_t operator()(vertex_t v, size_t i) const
+  {
+    for (size_t l = 0; l < num_levels; ++l) {
+      v = level_maps[l][v - level_first_indices[l]];
+      if (level_partitions != nullptr) { level_partitions[l * num_verts + i] = v; }
+    }
+    return v;
+  }
+};
+
+template <typename vertex_t>
+void sg_compose_level_maps(raft::handle_t const& handle,
+                           Dendrogram<vertex_t> const& dendrogram,
+                           vertex_t const* d_vertex_ids,
+                           vertex_t* d_partition,
+                           vertex_t* d_level_partitions,
+                           size_t num_levels)
+{
+  size_t local_num_verts = dendrogram.get_level_size_nocheck(0);
+
+  std::vector<vertex_t const*> h_level_maps(num_levels);
+  std::vector<vertex_t> h_level_first_indices(num_levels);
+  for (size_t l = 0; l < num_levels; ++l) {
+    h_level_maps[l]          = dendrogram.get_level_ptr_nocheck(l);
+    h_level_first_indices[l] = dendrogram.get_level_first_index_nocheck(l);
+  }
+  rmm::device_uvector<vertex_t const*> d_level_maps(num_levels, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_level_first_indices(num_levels, handle.get_stream());
+  raft::update_device(d_level_maps.data(), h_level_maps.data(), num_levels, handle.get_stream());
+  raft::update_device(d_level_first_indices.data(),
+                      h_level_first_indices.data(),
+                      num_levels,
+                      handle.get_stream());
+
+  thrust::transform(handle.get_thrust_policy(),
+                    d_vertex_ids,
+                    d_vertex_ids + local_num_verts,
+                    thrust::make_counting_iterator(size_t{0}),
+                    d_partition,
+                    compose_level_maps_t<vertex_t>{d_level_maps.data(),
+                                                   d_level_first_indices.data(),
+                                                   num_levels,
+                                                   d_level_partitions,
+                                                   local_num_verts});
+}
+
+}  // namespace detail
+
 template <typename vertex_t, bool multi_gpu>
 void partition_at_level(raft::handle_t const& handle,
                         Dendrogram<vertex_t> const& dendrogram,
@@ -31,6 +101,13 @@ void partition_at_level(raft::handle_t const& handle,
                         size_t level)
 {
   vertex_t local_num_verts = dendrogram.get_level_size_nocheck(0);
+
+  if constexpr (!multi_gpu) {
+    detail::sg_compose_level_maps(
+      handle, dendrogram, d_vertex_ids, d_partition, static_cast<vertex_t*>(nullptr), level);
+    return;
+  }
+
   rmm::device_uvector<vertex_t> local_vertex_ids_v(local_num_verts, handle.get_stream());
 
   raft::copy(d_partition, d_vertex_ids, local_num_verts, handle.get_stream());
@@ -56,4 +133,51 @@ void partition_at_level(raft::handle_t const& handle,
     });
 }
 
+// flattens the dendrogram at every level at once, d_level_partitions (size = # levels * level 0
+// size) stores the partition at level l + 1 in [l * level 0 size, (l + 1) * level 0 size); this
+// takes a single pass over the levels instead of calling partition_at_level once per level
+template <typename vertex_t, bool multi_gpu>
+void partition_at_all_levels(raft::handle_t const& handle,
+                             Dendrogram<vertex_t> const& dendrogram,
+                             vertex_t const* d_vertex_ids,
+                             vertex_t* d_level_partitions)
+{
+  auto num_levels = dendrogram.num_levels();
+  if (num_levels == 0) { return; }
+  size_t local_num_verts = dendrogram.get_level_size_nocheck(0);
+
+  if constexpr (!multi_gpu) {
+    rmm::device_uvector<vertex_t> tmp_partition(local_num_verts, handle.get_stream());
+    detail::sg_compose_level_maps(
+      handle, dendrogram, d_vertex_ids, tmp_partition.data(), d_level_partitions, num_levels);
+    return;
+  }
+
+  rmm::device_uvector<vertex_t> local_vertex_ids_v(local_num_verts, handle.get_stream());
+  rmm::device_uvector<vertex_t> partition(local_num_verts, handle.get_stream());
+
+  raft::copy(partition.data(), d_vertex_ids, local_num_verts, handle.get_stream());
+
+  for (size_t l = 0; l < num_levels; ++l) {
+    thrust::sequence(handle.get_thrust_policy(),
+                     local_vertex_ids_v.begin(),
+                     local_vertex_ids_v.begin() + dendrogram.get_level_size_nocheck(l),
+                     dendrogram.get_level_first_index_nocheck(l));
+
+    cugraph::relabel<vertex_t, multi_gpu>(
+      handle,
+      std::tuple<vertex_t const*, vertex_t const*>(local_vertex_ids_v.data(),
+                                                   dendrogram.get_level_ptr_nocheck(l)),
+      dendrogram.get_level_size_nocheck(l),
+      partition.data(),
+      static_cast<vertex_t>(local_num_verts),
+      false);
+
+    raft::copy(d_level_partitions + l * local_num_verts,
+               partition.data(),
+               local_num_verts,
+               handle.get_stream());
+  }
+}
+
 }  // namespace cugraph
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/edge_triangle_support.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/tuple.h>
+
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> k_truss_subgraph_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t k,
+  bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: k_truss_subgraph currently supports only undirected "
+                  "(symmetric) graphs.");
+  CUGRAPH_EXPECTS(
+    !graph_view.is_multigraph(),
+    "Invalid input argument: k_truss_subgraph currently does not support multi-graphs.");
+  CUGRAPH_EXPECTS(k >= 2, "Invalid input argument: k should be at least 2.");
+
+  if (do_expensive_check) {
+    // nothing to do (self-loops are dropped in orienting the edges)
+  }
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  std::vector<vertex_t> vertex_partition_lasts{};
+  if constexpr (multi_gpu) { vertex_partition_lasts = graph_view.get_vertex_partition_lasts(); }
+
+  // 2. orient the edges by (degree, vertex ID), the orientation of the input graph is kept while
+  // peeling (the oriented out-degrees remain O(sqrt(E)) as edges are only removed)
+
+  auto [majors, minors] = detail::extract_low_to_high_degree_edges(handle, graph_view);
+
+  // 3. peel: every round removes all the edges with triangle supports (in the remaining graph)
+  // smaller than k - 2 at once
+
+  if (k > 2) {
+    auto min_support = static_cast<edge_t>(k - 2);
+    while (true) {
+      auto offsets = detail::compute_sorted_edge_offsets<vertex_t, edge_t>(
+        handle, majors, local_vertex_first, num_local_vertices);
+      auto supports = detail::compute_edge_triangle_supports<vertex_t, edge_t, multi_gpu>(
+        handle, majors, minors, offsets, local_vertex_first, vertex_partition_lasts);
+
+      // remove_if is stable, so the remaining edges stay sorted by (major, minor)
+      auto edge_first =
+        thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+      auto num_remaining_edges = static_cast<size_t>(thrust::distance(
+        edge_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          edge_first,
+                          edge_first + majors.size(),
+                          supports.begin(),
+                          [min_support] __device__(auto s) { return s < min_support; })));
+      auto num_removed_edges = majors.size() - num_remaining_edges;
+      majors.resize(num_remaining_edges, handle.get_stream());
+      minors.resize(num_remaining_edges, handle.get_stream());
+      majors.shrink_to_fit(handle.get_stream());
+      minors.shrink_to_fit(handle.get_stream());
+
+      if constexpr (multi_gpu) {
+        num_removed_edges = host_scalar_allreduce(
+          handle.get_comms(), num_removed_edges, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (num_removed_edges == 0) { break; }
+    }
+  }
+
+  // 4. return both directions of the remaining edges
+
+  rmm::device_uvector<vertex_t> srcs(majors.size() * 2, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(srcs.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), majors.begin(), majors.end(), srcs.begin());
+  thrust::copy(
+    handle.get_thrust_policy(), minors.begin(), minors.end(), srcs.begin() + majors.size());
+  thrust::copy(handle.get_thrust_policy(), minors.begin(), minors.end(), dsts.begin());
+  thrust::copy(
+    handle.get_thrust_policy(), majors.begin(), majors.end(), dsts.begin() + majors.size());
+
+  return std::make_tuple(std::move(srcs), std::move(dsts));
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> k_truss_subgraph(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t k,
+  bool do_expensive_check)
+{
+  return k_truss_subgraph_impl(handle, graph_view, k, do_expensive_check);
+}
+
+}  // namespace cugraph
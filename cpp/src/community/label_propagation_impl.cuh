@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/graph_utils.cuh>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_key_aggregated_out_nbr.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/dataframe_buffer.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
+#include <cuco/detail/hash_functions.cuh>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <array>
+
+namespace cugraph {
+
+namespace {
+
+// (aggregated edge weight to the label, 1 if the label is the vertex's current label, label); a
+// vertex moves to the label with the largest weight, ties are broken in favor of the current label
+// first (so a vertex does not leave a label that is as good as any other) and the smaller label ID
+// next
+template <typename vertex_t, typename weight_t>
+using label_score_t = thrust::tuple<weight_t, uint8_t, vertex_t>;
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct label_score_e_op_t {
+  __device__ label_score_t<vertex_t, weight_t> operator()(vertex_t,
+                                                          vertex_t nbr_label,
+                                                          weight_t w,
+                                                          vertex_t label,
+                                                          vertex_t /* map value, unused */) const
+  {
+    return thrust::make_tuple(w, static_cast<uint8_t>(nbr_label == label), nbr_label);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct max_label_score_op_t {
+  __device__ label_score_t<vertex_t, weight_t> operator()(
+    label_score_t<vertex_t, weight_t> s0, label_score_t<vertex_t, weight_t> s1) const
+  {
+    if (thrust::get<0>(s0) != thrust::get<0>(s1)) {
+      return thrust::get<0>(s0) > thrust::get<0>(s1) ? s0 : s1;
+    } else if (thrust::get<1>(s0) != thrust::get<1>(s1)) {
+      return thrust::get<1>(s0) > thrust::get<1>(s1) ? s0 : s1;
+    } else {
+      return thrust::get<2>(s0) < thrust::get<2>(s1) ? s0 : s1;
+    }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct update_label_op_t {
+  __device__ vertex_t operator()(vertex_t label, label_score_t<vertex_t, weight_t> score) const
+  {
+    auto new_label = thrust::get<2>(score);
+    return new_label != invalid_vertex_id<vertex_t>::value ? new_label : label;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_label_changed_t {
+  vertex_t const* old_labels{nullptr};
+  vertex_t const* new_labels{nullptr};
+  __device__ bool operator()(vertex_t i) const { return old_labels[i] != new_labels[i]; }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_in_group_t {
+  vertex_t local_vertex_first{};
+  uint8_t group{};
+  __device__ uint8_t operator()(vertex_t i) const
+  {
+    cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
+    return static_cast<uint8_t>((hash_func(local_vertex_first + i) % 2) == group);
+  }
+};
+
+// the label set only shrinks (a vertex moves to one of its neighbors' labels), so the map keys
+// built at the beginning of an iteration cover every label seen in the iteration; keys are mapped
+// to the processes with compute_gpu_id_from_vertex_t in multi-GPU
+template <typename vertex_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> compute_unique_labels(raft::handle_t const& handle,
+                                                    vertex_t const* labels,
+                                                    vertex_t num_local_vertices)
+{
+  rmm::device_uvector<vertex_t> unique_labels(num_local_vertices, handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), labels, labels + num_local_vertices, unique_labels.begin());
+  thrust::sort(handle.get_thrust_policy(), unique_labels.begin(), unique_labels.end());
+  unique_labels.resize(thrust::distance(unique_labels.begin(),
+                                        thrust::unique(handle.get_thrust_policy(),
+                                                       unique_labels.begin(),
+                                                       unique_labels.end())),
+                       handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    unique_labels = detail::shuffle_vertices_by_gpu_id(handle, std::move(unique_labels));
+    thrust::sort(handle.get_thrust_policy(), unique_labels.begin(), unique_labels.end());
+    unique_labels.resize(thrust::distance(unique_labels.begin(),
+                                          thrust::unique(handle.get_thrust_policy(),
+                                                         unique_labels.begin(),
+                                                         unique_labels.end())),
+                         handle.get_stream());
+  }
+  unique_labels.shrink_to_fit(handle.get_stream());
+
+  return unique_labels;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t label_propagation_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* labels,
+  size_t max_iterations,
+  double changed_fraction_threshold,
+  bool semi_synchronous,
+  bool do_expensive_check)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>;
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: label_propagation currently supports only undirected "
+                  "(symmetric) graphs.");
+  CUGRAPH_EXPECTS((num_local_vertices == 0) || (labels != nullptr),
+                  "Invalid input argument: labels should not be nullptr.");
+  CUGRAPH_EXPECTS(
+    (changed_fraction_threshold >= 0.0) && (changed_fraction_threshold <= 1.0),
+    "Invalid input argument: changed_fraction_threshold should be in [0.0, 1.0].");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  // 2. start from the singleton labels
+
+  thrust::sequence(
+    handle.get_thrust_policy(), labels, labels + num_local_vertices, local_vertex_first);
+
+  row_properties_t<graph_view_type, vertex_t> row_labels{};
+  col_properties_t<graph_view_type, vertex_t> col_labels{};
+  if constexpr (multi_gpu) {
+    row_labels = row_properties_t<graph_view_type, vertex_t>(handle, graph_view);
+    col_labels = col_properties_t<graph_view_type, vertex_t>(handle, graph_view);
+  }
+
+  // in the semi-synchronous mode, vertices are split into two groups (by hashing the vertex IDs)
+  // and the groups update their labels in turn, every group seeing the other group's latest
+  // labels; this breaks the label oscillation of the synchronous updates (e.g. two vertices
+  // connected by an edge swapping their labels every iteration)
+
+  std::array<rmm::device_uvector<uint8_t>, 2> group_flags{
+    rmm::device_uvector<uint8_t>(semi_synchronous ? num_local_vertices : vertex_t{0},
+                                 handle.get_stream()),
+    rmm::device_uvector<uint8_t>(semi_synchronous ? num_local_vertices : vertex_t{0},
+                                 handle.get_stream())};
+  std::array<row_properties_t<graph_view_type, uint8_t>, 2> row_group_flags{};
+  if (semi_synchronous) {
+    for (size_t i = 0; i < group_flags.size(); ++i) {
+      thrust::transform(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(vertex_t{0}),
+                        thrust::make_counting_iterator(num_local_vertices),
+                        group_flags[i].begin(),
+                        is_in_group_t<vertex_t>{local_vertex_first, static_cast<uint8_t>(i)});
+      if constexpr (multi_gpu) {
+        row_group_flags[i] = row_properties_t<graph_view_type, uint8_t>(handle, graph_view);
+        copy_to_adj_matrix_row(handle, graph_view, group_flags[i].begin(), row_group_flags[i]);
+      }
+    }
+  }
+
+  auto scores =
+    allocate_dataframe_buffer<label_score_t<vertex_t, weight_t>>(num_local_vertices,
+                                                                 handle.get_stream());
+  rmm::device_uvector<vertex_t> new_labels(num_local_vertices, handle.get_stream());
+
+  // 3. iterate until the fraction of the vertices changing labels drops to (or below) the
+  // threshold
+
+  size_t iter{0};
+  while (iter < max_iterations) {
+    auto unique_labels =
+      compute_unique_labels<vertex_t, multi_gpu>(handle, labels, num_local_vertices);
+    // every label maps to itself, the map is used only to aggregate the edges by labels
+    key_aggregated_kv_map_t<vertex_t, vertex_t, multi_gpu> kv_map(
+      handle, unique_labels.begin(), unique_labels.end(), unique_labels.begin());
+    unique_labels.resize(0, handle.get_stream());
+    unique_labels.shrink_to_fit(handle.get_stream());
+
+    size_t num_changed_labels{0};
+    for (size_t i = 0; i < (semi_synchronous ? group_flags.size() : size_t{1}); ++i) {
+      if constexpr (multi_gpu) {
+        copy_to_adj_matrix_row(handle, graph_view, labels, row_labels);
+        copy_to_adj_matrix_col(handle, graph_view, labels, col_labels);
+      }
+      auto row_label_input =
+        multi_gpu ? row_labels.device_view()
+                  : detail::major_properties_device_view_t<vertex_t, vertex_t const*>(labels);
+      auto col_label_input =
+        multi_gpu ? col_labels.device_view()
+                  : detail::minor_properties_device_view_t<vertex_t, vertex_t const*>(labels);
+
+      if (semi_synchronous) {
+        copy_v_transform_reduce_key_aggregated_out_nbr(
+          handle,
+          graph_view,
+          row_label_input,
+          multi_gpu ? row_group_flags[i].device_view()
+                    : detail::major_properties_device_view_t<vertex_t, uint8_t const*>(
+                        group_flags[i].data()),
+          col_label_input,
+          kv_map,
+          label_score_e_op_t<vertex_t, weight_t>{},
+          max_label_score_op_t<vertex_t, weight_t>{},
+          thrust::make_tuple(weight_t{0}, uint8_t{1}, invalid_vertex_id<vertex_t>::value),
+          get_dataframe_buffer_begin(scores));
+      } else {
+        copy_v_transform_reduce_key_aggregated_out_nbr(
+          handle,
+          graph_view,
+          row_label_input,
+          col_label_input,
+          kv_map,
+          label_score_e_op_t<vertex_t, weight_t>{},
+          max_label_score_op_t<vertex_t, weight_t>{},
+          thrust::make_tuple(weight_t{0}, uint8_t{1}, invalid_vertex_id<vertex_t>::value),
+          get_dataframe_buffer_begin(scores));
+      }
+
+      thrust::transform(handle.get_thrust_policy(),
+                        labels,
+                        labels + num_local_vertices,
+                        get_dataframe_buffer_begin(scores),
+                        new_labels.begin(),
+                        update_label_op_t<vertex_t, weight_t>{});
+      num_changed_labels += static_cast<size_t>(
+        thrust::count_if(handle.get_thrust_policy(),
+                         thrust::make_counting_iterator(vertex_t{0}),
+                         thrust::make_counting_iterator(num_local_vertices),
+                         is_label_changed_t<vertex_t>{labels, new_labels.data()}));
+      thrust::copy(handle.get_thrust_policy(), new_labels.begin(), new_labels.end(), labels);
+    }
+    if constexpr (multi_gpu) {
+      num_changed_labels = host_scalar_allreduce(
+        handle.get_comms(), num_changed_labels, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    ++iter;
+
+    if (static_cast<double>(num_changed_labels) <=
+        changed_fraction_threshold * static_cast<double>(graph_view.get_number_of_vertices())) {
+      break;
+    }
+  }
+
+  return iter;
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* labels,
+  size_t max_iterations,
+  double changed_fraction_threshold,
+  bool semi_synchronous,
+  bool do_expensive_check)
+{
+  return label_propagation_impl(handle,
+                                graph_view,
+                                labels,
+                                max_iterations,
+                                changed_fraction_threshold,
+                                semi_synchronous,
+                                do_expensive_check);
+}
+
+}  // namespace cugraph
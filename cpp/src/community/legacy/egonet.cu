@@ -36,9 +36,23 @@
 
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
 
 #include <utilities/high_res_timer.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
 namespace {
 
 /*
@@ -172,6 +186,235 @@ extract(raft::handle_t const& handle,
     handle, csr_view, neighbors_offsets.data().get(), neighbors.data().get(), n_subgraphs);
 }
 
+// maps a vertex to the GPU that owns it in the vertex partitioning
+template <typename vertex_t>
+struct ego_vertex_to_gpu_id_t {
+  vertex_t const* vertex_partition_lasts{nullptr};
+  int comm_size{1};
+
+  template <typename tuple_t>
+  __device__ int operator()(tuple_t t) const
+  {
+    return static_cast<int>(thrust::distance(
+      vertex_partition_lasts,
+      thrust::upper_bound(thrust::seq,
+                          vertex_partition_lasts,
+                          vertex_partition_lasts + comm_size,
+                          thrust::get<0>(t))));
+  }
+};
+
+// maps a (global) subgraph key to the GPU that requested the subgraph
+struct ego_key_to_gpu_id_t {
+  size_t const* key_offsets{nullptr};  // size == comm_size + 1
+  int comm_size{1};
+
+  template <typename tuple_t>
+  __device__ int operator()(tuple_t t) const
+  {
+    return static_cast<int>(thrust::distance(
+      key_offsets + 1,
+      thrust::upper_bound(
+        thrust::seq, key_offsets + 1, key_offsets + (comm_size + 1), thrust::get<0>(t))));
+  }
+};
+
+// maps an index into the batched BFS distance array to a (subgraph key, vertex) pair
+template <typename vertex_t>
+struct ego_reached_pair_t {
+  size_t const* batch_keys{nullptr};
+  vertex_t local_vertex_first{0};
+  vertex_t num_local_vertices{0};
+
+  __device__ thrust::tuple<size_t, vertex_t> operator()(size_t i) const
+  {
+    return thrust::make_tuple(batch_keys[i / num_local_vertices],
+                              local_vertex_first + static_cast<vertex_t>(i % num_local_vertices));
+  }
+};
+
+/*
+Multi-GPU version: the seeds are shuffled to the GPUs owning them and traversed together, 64 at a
+time, by the bit-parallel multi-source BFS (each search is tagged with a global subgraph key), so
+the number of collective rounds is (the aggregate number of seeds / 64) * radius instead of one BFS
+per seed. The reached (key, vertex) pairs are sent back to the GPUs the seeds came from and all the
+ego networks are then extracted by one multi-GPU induced subgraph extraction.
+*/
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>>
+extract_mg(raft::handle_t const& handle,
+           cugraph::graph_view_t<vertex_t, edge_t, weight_t, false, true> const& graph_view,
+           vertex_t const* source_vertex,
+           vertex_t n_subgraphs,
+           vertex_t radius)
+{
+  auto& comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+  auto const comm_rank = comm.get_rank();
+
+  // 1. assign global subgraph keys (the i'th local seed of GPU r has key h_key_offsets[r] + i)
+
+  auto h_n_subgraphs =
+    cugraph::host_scalar_allgather(comm, static_cast<size_t>(n_subgraphs), handle.get_stream());
+  std::vector<size_t> h_key_offsets(comm_size + 1, size_t{0});
+  std::partial_sum(h_n_subgraphs.begin(), h_n_subgraphs.end(), h_key_offsets.begin() + 1);
+  CUGRAPH_EXPECTS(h_key_offsets.back() > 0, "Need at least one source to extract the egonet from");
+
+  rmm::device_uvector<size_t> d_key_offsets(h_key_offsets.size(), handle.get_stream());
+  raft::update_device(
+    d_key_offsets.data(), h_key_offsets.data(), h_key_offsets.size(), handle.get_stream());
+
+  // 2. send the seeds to the GPUs owning them (bfs_batch takes local sources)
+
+  rmm::device_uvector<vertex_t> seeds(n_subgraphs, handle.get_stream());
+  rmm::device_uvector<size_t> seed_keys(n_subgraphs, handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), source_vertex, source_vertex + n_subgraphs, seeds.begin());
+  thrust::sequence(
+    handle.get_thrust_policy(), seed_keys.begin(), seed_keys.end(), h_key_offsets[comm_rank]);
+
+  auto h_vertex_partition_lasts = graph_view.get_vertex_partition_lasts();
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(h_vertex_partition_lasts.size(),
+                                                         handle.get_stream());
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      h_vertex_partition_lasts.data(),
+                      h_vertex_partition_lasts.size(),
+                      handle.get_stream());
+
+  {
+    auto seed_first =
+      thrust::make_zip_iterator(thrust::make_tuple(seeds.begin(), seed_keys.begin()));
+    std::forward_as_tuple(std::tie(seeds, seed_keys), std::ignore) =
+      cugraph::groupby_gpuid_and_shuffle_values(
+        comm,
+        seed_first,
+        seed_first + seeds.size(),
+        ego_vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(), comm_size},
+        handle.get_stream_view());
+  }
+
+  // 3. run the batched BFS; batches are consecutive ranges of the owned seeds of all the GPUs
+  // ordered by GPU rank (the source order of bfs_batch)
+
+  auto h_n_owned_seeds = cugraph::host_scalar_allgather(comm, seeds.size(), handle.get_stream());
+  std::vector<size_t> h_owned_seed_offsets(comm_size + 1, size_t{0});
+  std::partial_sum(
+    h_n_owned_seeds.begin(), h_n_owned_seeds.end(), h_owned_seed_offsets.begin() + 1);
+  auto aggregate_n_seeds = h_owned_seed_offsets.back();
+
+  auto constexpr max_batch_size = static_cast<size_t>(std::numeric_limits<uint64_t>::digits);
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+  auto num_local_vertices         = graph_view.get_number_of_local_vertices();
+
+  rmm::device_uvector<vertex_t> distances(0, handle.get_stream());
+  rmm::device_uvector<size_t> batch_keys(0, handle.get_stream());
+  rmm::device_uvector<size_t> reached_keys(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> reached_vertices(0, handle.get_stream());
+  for (size_t batch_first = 0; batch_first < aggregate_n_seeds; batch_first += max_batch_size) {
+    auto batch_last = std::min(batch_first + max_batch_size, aggregate_n_seeds);
+
+    std::vector<size_t> h_batch_counts(comm_size);
+    std::vector<size_t> h_batch_displacements(comm_size);
+    for (int i = 0; i < comm_size; ++i) {
+      auto first = std::clamp(batch_first, h_owned_seed_offsets[i], h_owned_seed_offsets[i + 1]);
+      auto last  = std::clamp(batch_last, h_owned_seed_offsets[i], h_owned_seed_offsets[i + 1]);
+      h_batch_counts[i]        = last - first;
+      h_batch_displacements[i] = first - batch_first;
+    }
+    auto local_seed_first = std::clamp(batch_first,
+                                       h_owned_seed_offsets[comm_rank],
+                                       h_owned_seed_offsets[comm_rank + 1]) -
+                            h_owned_seed_offsets[comm_rank];
+    auto batch_size = batch_last - batch_first;
+
+    batch_keys.resize(batch_size, handle.get_stream());
+    cugraph::device_allgatherv(comm,
+                               seed_keys.begin() + local_seed_first,
+                               batch_keys.begin(),
+                               h_batch_counts,
+                               h_batch_displacements,
+                               handle.get_stream());
+
+    distances.resize(static_cast<size_t>(num_local_vertices) * batch_size, handle.get_stream());
+    cugraph::bfs_batch(handle,
+                       graph_view,
+                       distances.data(),
+                       seeds.data() + local_seed_first,
+                       h_batch_counts[comm_rank],
+                       radius);
+
+    auto num_reached = static_cast<size_t>(thrust::count_if(
+      handle.get_thrust_policy(),
+      distances.begin(),
+      distances.end(),
+      [invalid_distance] __device__(auto d) { return d != invalid_distance; }));
+    auto num_old_reached = reached_keys.size();
+    reached_keys.resize(num_old_reached + num_reached, handle.get_stream());
+    reached_vertices.resize(reached_keys.size(), handle.get_stream());
+    thrust::copy_if(
+      handle.get_thrust_policy(),
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(size_t{0}),
+        ego_reached_pair_t<vertex_t>{batch_keys.data(),
+                                     graph_view.get_local_vertex_first(),
+                                     num_local_vertices}),
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(distances.size()),
+        ego_reached_pair_t<vertex_t>{batch_keys.data(),
+                                     graph_view.get_local_vertex_first(),
+                                     num_local_vertices}),
+      distances.begin(),
+      thrust::make_zip_iterator(thrust::make_tuple(reached_keys.begin() + num_old_reached,
+                                                   reached_vertices.begin() + num_old_reached)),
+      [invalid_distance] __device__(auto d) { return d != invalid_distance; });
+  }
+  distances.resize(0, handle.get_stream());
+  distances.shrink_to_fit(handle.get_stream());
+  seeds.resize(0, handle.get_stream());
+  seeds.shrink_to_fit(handle.get_stream());
+  seed_keys.resize(0, handle.get_stream());
+  seed_keys.shrink_to_fit(handle.get_stream());
+
+  // 4. send the reached vertices back to the GPUs that requested the ego networks and build the
+  // (sorted) subgraph vertex lists
+
+  {
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(reached_keys.begin(), reached_vertices.begin()));
+    std::forward_as_tuple(std::tie(reached_keys, reached_vertices), std::ignore) =
+      cugraph::groupby_gpuid_and_shuffle_values(
+        comm,
+        pair_first,
+        pair_first + reached_keys.size(),
+        ego_key_to_gpu_id_t{d_key_offsets.data(), comm_size},
+        handle.get_stream_view());
+  }
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(reached_keys.begin(), reached_vertices.begin()));
+  thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + reached_keys.size());
+
+  rmm::device_uvector<size_t> neighbors_offsets(n_subgraphs + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      reached_keys.begin(),
+                      reached_keys.end(),
+                      thrust::make_counting_iterator(h_key_offsets[comm_rank]),
+                      thrust::make_counting_iterator(h_key_offsets[comm_rank + 1] + 1),
+                      neighbors_offsets.begin());
+  reached_keys.resize(0, handle.get_stream());
+  reached_keys.shrink_to_fit(handle.get_stream());
+
+  // 5. extract
+
+  return cugraph::extract_induced_subgraphs(handle,
+                                            graph_view,
+                                            neighbors_offsets.data(),
+                                            reached_vertices.data(),
+                                            static_cast<size_t>(n_subgraphs));
+}
+
 }  // namespace
 
 namespace cugraph {
@@ -187,25 +430,26 @@ extract_ego(raft::handle_t const& handle,
             vertex_t n_subgraphs,
             vertex_t radius)
 {
-  if (multi_gpu) {
-    CUGRAPH_FAIL("Unimplemented.");
-    return std::make_tuple(rmm::device_uvector<vertex_t>(0, handle.get_stream()),
-                           rmm::device_uvector<vertex_t>(0, handle.get_stream()),
-                           rmm::device_uvector<weight_t>(0, handle.get_stream()),
-                           rmm::device_uvector<size_t>(0, handle.get_stream()));
-  }
-  CUGRAPH_EXPECTS(n_subgraphs > 0, "Need at least one source to extract the egonet from");
+  CUGRAPH_EXPECTS(multi_gpu || (n_subgraphs > 0),
+                  "Need at least one source to extract the egonet from");
   CUGRAPH_EXPECTS(n_subgraphs < graph_view.get_number_of_vertices(),
                   "Can't have more sources to extract from than vertices in the graph");
   CUGRAPH_EXPECTS(radius > 0, "Radius should be at least 1");
   CUGRAPH_EXPECTS(radius < graph_view.get_number_of_vertices(), "radius is too large");
   // source_vertex range is checked in bfs.
 
-  return extract<vertex_t, edge_t, weight_t>(
-    handle, graph_view, source_vertex, n_subgraphs, radius);
+  if constexpr (multi_gpu) {
+    // n_subgraphs can be 0 on some GPUs, the aggregate number is checked in extract_mg
+    return extract_mg<vertex_t, edge_t, weight_t>(
+      handle, graph_view, source_vertex, n_subgraphs, radius);
+  } else {
+    return extract<vertex_t, edge_t, weight_t>(
+      handle, graph_view, source_vertex, n_subgraphs, radius);
+  }
 }
 
 // SG FP32
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<float>>,
@@ -215,6 +459,8 @@ extract_ego(raft::handle_t const&,
             int32_t*,
             int32_t,
             int32_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<float>>,
@@ -224,6 +470,8 @@ extract_ego(raft::handle_t const&,
             int32_t*,
             int32_t,
             int32_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::tuple<rmm::device_uvector<int64_t>,
                     rmm::device_uvector<int64_t>,
                     std::optional<rmm::device_uvector<float>>,
@@ -233,8 +481,10 @@ extract_ego(raft::handle_t const&,
             int64_t*,
             int64_t,
             int64_t);
+#endif
 
 // SG FP64
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<double>>,
@@ -244,6 +494,8 @@ extract_ego(raft::handle_t const&,
             int32_t*,
             int32_t,
             int32_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<double>>,
@@ -253,6 +505,8 @@ extract_ego(raft::handle_t const&,
             int32_t*,
             int32_t,
             int32_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::tuple<rmm::device_uvector<int64_t>,
                     rmm::device_uvector<int64_t>,
                     std::optional<rmm::device_uvector<double>>,
@@ -262,4 +516,75 @@ extract_ego(raft::handle_t const&,
             int64_t*,
             int64_t,
             int64_t);
+#endif
+
+// MG FP32
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    rmm::device_uvector<size_t>>
+extract_ego(raft::handle_t const&,
+            graph_view_t<int32_t, int32_t, float, false, true> const&,
+            int32_t*,
+            int32_t,
+            int32_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    rmm::device_uvector<size_t>>
+extract_ego(raft::handle_t const&,
+            graph_view_t<int32_t, int64_t, float, false, true> const&,
+            int32_t*,
+            int32_t,
+            int32_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    rmm::device_uvector<size_t>>
+extract_ego(raft::handle_t const&,
+            graph_view_t<int64_t, int64_t, float, false, true> const&,
+            int64_t*,
+            int64_t,
+            int64_t);
+#endif
+
+// MG FP64
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    rmm::device_uvector<size_t>>
+extract_ego(raft::handle_t const&,
+            graph_view_t<int32_t, int32_t, double, false, true> const&,
+            int32_t*,
+            int32_t,
+            int32_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    rmm::device_uvector<size_t>>
+extract_ego(raft::handle_t const&,
+            graph_view_t<int32_t, int64_t, double, false, true> const&,
+            int32_t*,
+            int32_t,
+            int32_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    rmm::device_uvector<size_t>>
+extract_ego(raft::handle_t const&,
+            graph_view_t<int64_t, int64_t, double, false, true> const&,
+            int64_t*,
+            int64_t,
+            int64_t);
+#endif
 }  // namespace cugraph
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/louvain.cuh>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/tuple.h>
+
+#include <optional>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename MatrixPartitionDeviceView,
+          typename AdjMatrixRowClusterInputWrapper,
+          typename AdjMatrixColClusterInputWrapper>
+struct is_inter_cluster_edge_t {
+  MatrixPartitionDeviceView matrix_partition{};
+  AdjMatrixRowClusterInputWrapper matrix_partition_row_cluster_input{};
+  AdjMatrixColClusterInputWrapper adj_matrix_col_cluster_input{};
+  template <typename EdgeTuple>
+  __device__ bool operator()(EdgeTuple e /* major, minor[, weight] */) const
+  {
+    return matrix_partition_row_cluster_input.get(
+             matrix_partition.get_major_offset_from_major_nocheck(thrust::get<0>(e))) !=
+           adj_matrix_col_cluster_input.get(
+             matrix_partition.get_minor_offset_from_minor_nocheck(thrust::get<1>(e)));
+  }
+};
+
+}  // namespace detail
+
+// Leiden refines the clustering found by the Louvain local moving phase before aggregating the
+// graph: vertices restart from singleton clusters and are moved (by the same local moving phase)
+// only to the neighbor clusters within their Louvain clusters, which splits the Louvain clusters
+// that are not well connected.
+template <typename graph_view_type>
+class Leiden : public Louvain<graph_view_type> {
+ public:
+  using graph_view_t = graph_view_type;
+  using vertex_t     = typename graph_view_t::vertex_type;
+  using edge_t       = typename graph_view_t::edge_type;
+  using weight_t     = typename graph_view_t::weight_type;
+  using graph_t      = typename Louvain<graph_view_type>::graph_t;
+
+  Leiden(raft::handle_t const& handle, graph_view_t const& graph_view)
+    : Louvain<graph_view_type>(handle, graph_view)
+  {
+  }
+
+  weight_t operator()(size_t max_level, weight_t resolution) override
+  {
+    scoped_phase_t phase("leiden", this->handle_.get_stream_view());
+
+    weight_t best_modularity = weight_t{-1};
+
+    weight_t total_edge_weight = this->compute_total_edge_weight();
+
+    while (this->dendrogram_->num_levels() < max_level) {
+      //
+      //  Initialize every cluster to reference each vertex to itself
+      //
+      this->initialize_dendrogram_level();
+
+      this->compute_vertex_and_cluster_weights();
+
+      this->update_clustering(total_edge_weight, resolution);
+
+      weight_t new_Q = refine_clustering(total_edge_weight, resolution);
+
+      if (new_Q <= best_modularity) { break; }
+
+      best_modularity = new_Q;
+
+      this->shrink_graph();
+    }
+
+    return best_modularity;
+  }
+
+ protected:
+  // refines the (Louvain) clustering in the current dendrogram level and returns the modularity of
+  // the refined clustering (which replaces the Louvain clustering in the current dendrogram level)
+  weight_t refine_clustering(weight_t total_edge_weight, weight_t resolution)
+  {
+    scoped_phase_t phase("refine_clustering", this->handle_.get_stream_view());
+
+    auto refinement_graph = create_intra_cluster_graph();
+
+    // the edges removed from the refinement graph are never intra-cluster edges of the refined
+    // clustering (refined clusters are subsets of the Louvain clusters), so the local moving phase
+    // on the refinement graph (with the vertex weights of the current graph) evaluates the delta
+    // modularity and the modularity of the current graph.
+
+    auto graph_view           = this->current_graph_view_;
+    this->current_graph_view_ = refinement_graph->view();
+
+    thrust::sequence(this->handle_.get_thrust_policy(),
+                     this->dendrogram_->current_level_begin(),
+                     this->dendrogram_->current_level_end(),
+                     this->current_graph_view_.get_local_vertex_first());
+    this->initialize_cluster_weights();
+
+    weight_t Q = this->update_clustering(total_edge_weight, resolution);
+
+    this->current_graph_view_ = graph_view;
+
+    return Q;
+  }
+
+  // creates a graph with the edges of the current graph whose end points belong to the same
+  // cluster in the current dendrogram level (the vertex partitioning is unchanged)
+  std::unique_ptr<graph_t> create_intra_cluster_graph() const
+  {
+    auto const& handle     = this->handle_;
+    auto const& graph_view = this->current_graph_view_;
+
+    row_properties_t<graph_view_t, vertex_t> src_clusters{};
+    col_properties_t<graph_view_t, vertex_t> dst_clusters{};
+    if constexpr (graph_view_t::is_multi_gpu) {
+      src_clusters = row_properties_t<graph_view_t, vertex_t>(handle, graph_view);
+      copy_to_adj_matrix_row(
+        handle, graph_view, this->dendrogram_->current_level_begin(), src_clusters);
+      dst_clusters = col_properties_t<graph_view_t, vertex_t>(handle, graph_view);
+      copy_to_adj_matrix_col(
+        handle, graph_view, this->dendrogram_->current_level_begin(), dst_clusters);
+    }
+    auto row_cluster_input =
+      graph_view_t::is_multi_gpu
+        ? src_clusters.device_view()
+        : detail::major_properties_device_view_t<vertex_t, vertex_t const*>(
+            this->dendrogram_->current_level_begin());
+    auto col_cluster_input =
+      graph_view_t::is_multi_gpu
+        ? dst_clusters.device_view()
+        : detail::minor_properties_device_view_t<vertex_t, vertex_t const*>(
+            this->dendrogram_->current_level_begin());
+
+    auto [edgelist_majors, edgelist_minors, edgelist_weights] =
+      this->decompress_local_adj_matrix_partitions();
+    for (size_t i = 0; i < edgelist_majors.size(); ++i) {
+      auto matrix_partition =
+        matrix_partition_device_view_t<vertex_t, edge_t, weight_t, graph_view_t::is_multi_gpu>(
+          graph_view.get_matrix_partition_view(i));
+      auto& majors = edgelist_majors[i];
+      auto& minors = edgelist_minors[i];
+
+      auto matrix_partition_row_cluster_input = row_cluster_input;
+      matrix_partition_row_cluster_input.set_local_adj_matrix_partition_idx(i);
+      detail::is_inter_cluster_edge_t<decltype(matrix_partition),
+                                      decltype(matrix_partition_row_cluster_input),
+                                      decltype(col_cluster_input)>
+        is_inter_cluster_edge_op{
+          matrix_partition, matrix_partition_row_cluster_input, col_cluster_input};
+      size_t num_intra_cluster_edges{};
+      if (edgelist_weights) {
+        auto edge_first = thrust::make_zip_iterator(
+          thrust::make_tuple(majors.begin(), minors.begin(), (*edgelist_weights)[i].begin()));
+        num_intra_cluster_edges = thrust::distance(
+          edge_first,
+          thrust::remove_if(handle.get_thrust_policy(),
+                            edge_first,
+                            edge_first + majors.size(),
+                            is_inter_cluster_edge_op));
+      } else {
+        auto edge_first =
+          thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+        num_intra_cluster_edges = thrust::distance(
+          edge_first,
+          thrust::remove_if(handle.get_thrust_policy(),
+                            edge_first,
+                            edge_first + majors.size(),
+                            is_inter_cluster_edge_op));
+      }
+      majors.resize(num_intra_cluster_edges, handle.get_stream());
+      minors.resize(num_intra_cluster_edges, handle.get_stream());
+      majors.shrink_to_fit(handle.get_stream());
+      minors.shrink_to_fit(handle.get_stream());
+      if (edgelist_weights) {
+        (*edgelist_weights)[i].resize(num_intra_cluster_edges, handle.get_stream());
+        (*edgelist_weights)[i].shrink_to_fit(handle.get_stream());
+      }
+    }
+
+    return this->create_graph_from_local_adj_matrix_partition_edgelists(
+      edgelist_majors, edgelist_minors, edgelist_weights);
+  }
+};
+
+}  // namespace cugraph
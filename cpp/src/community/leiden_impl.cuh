@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <community/leiden.cuh>
+#include <community/louvain_impl.cuh>
+#include <cugraph/graph.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t max_level,
+  weight_t resolution)
+{
+  Leiden<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>> runner(handle, graph_view);
+
+  weight_t wt = runner(max_level, resolution);
+
+  return std::make_pair(runner.move_dendrogram(), wt);
+}
+
+}  // namespace detail
+
+template <typename graph_view_t>
+std::pair<std::unique_ptr<Dendrogram<typename graph_view_t::vertex_type>>,
+          typename graph_view_t::weight_type>
+leiden(raft::handle_t const& handle,
+       graph_view_t const& graph_view,
+       size_t max_level,
+       typename graph_view_t::weight_type resolution)
+{
+  return detail::leiden(handle, graph_view, max_level, resolution);
+}
+
+template <typename graph_view_t>
+std::pair<size_t, typename graph_view_t::weight_type> leiden(
+  raft::handle_t const& handle,
+  graph_view_t const& graph_view,
+  typename graph_view_t::vertex_type* clustering,
+  size_t max_level,
+  typename graph_view_t::weight_type resolution)
+{
+  using vertex_t = typename graph_view_t::vertex_type;
+  using weight_t = typename graph_view_t::weight_type;
+
+  detail::check_clustering(graph_view, clustering);
+
+  std::unique_ptr<Dendrogram<vertex_t>> dendrogram;
+  weight_t modularity;
+
+  std::tie(dendrogram, modularity) = leiden(handle, graph_view, max_level, resolution);
+
+  flatten_dendrogram(handle, graph_view, *dendrogram, clustering);
+
+  return std::make_pair(dendrogram->num_levels(), modularity);
+}
+
+}  // namespace cugraph
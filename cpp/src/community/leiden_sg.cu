@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <community/leiden_impl.cuh>
+
+namespace cugraph {
+
+// Explicit template instantations
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> leiden(
+  raft::handle_t const&, graph_view_t<int32_t, int32_t, float, false, false> const&, size_t, float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> leiden(
+  raft::handle_t const&, graph_view_t<int32_t, int64_t, float, false, false> const&, size_t, float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::pair<std::unique_ptr<Dendrogram<int64_t>>, float> leiden(
+  raft::handle_t const&, graph_view_t<int64_t, int64_t, float, false, false> const&, size_t, float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> leiden(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int32_t, double, false, false> const&,
+  size_t,
+  double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> leiden(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int64_t, double, false, false> const&,
+  size_t,
+  double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::pair<std::unique_ptr<Dendrogram<int64_t>>, double> leiden(
+  raft::handle_t const&,
+  graph_view_t<int64_t, int64_t, double, false, false> const&,
+  size_t,
+  double);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::pair<size_t, float> leiden(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int32_t, float, false, false> const&,
+  int32_t*,
+  size_t,
+  float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::pair<size_t, double> leiden(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int32_t, double, false, false> const&,
+  int32_t*,
+  size_t,
+  double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::pair<size_t, float> leiden(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int64_t, float, false, false> const&,
+  int32_t*,
+  size_t,
+  float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::pair<size_t, double> leiden(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int64_t, double, false, false> const&,
+  int32_t*,
+  size_t,
+  double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::pair<size_t, float> leiden(
+  raft::handle_t const&,
+  graph_view_t<int64_t, int64_t, float, false, false> const&,
+  int64_t*,
+  size_t,
+  float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::pair<size_t, double> leiden(
+  raft::handle_t const&,
+  graph_view_t<int64_t, int64_t, double, false, false> const&,
+  int64_t*,
+  size_t,
+  double);
+#endif
+
+}  // namespace cugraph
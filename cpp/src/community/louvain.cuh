@@ -15,31 +15,52 @@
  */
 #pragma once
 
+#include <serialization/checkpoint_utils.cuh>
+
 #include <cugraph/dendrogram.hpp>
 
+#include <cugraph/detail/decompress_matrix_partition.cuh>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/partition_manager.hpp>
 
 #include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
 #include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
 #include <cugraph/prims/copy_v_transform_reduce_key_aggregated_out_nbr.cuh>
 #include <cugraph/prims/row_col_properties.cuh>
-#include <cugraph/prims/transform_reduce_by_adj_matrix_row_col_key_e.cuh>
 #include <cugraph/prims/transform_reduce_e.cuh>
 #include <cugraph/prims/transform_reduce_v.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/serialization/serializer.hpp>
 #include <cugraph/utilities/collect_comm.cuh>
+#include <cugraph/utilities/dataframe_buffer.cuh>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
 #include <thrust/transform_reduce.h>
 
-//#define TIMING
-
-#ifdef TIMING
-#include <utilities/high_res_timer.hpp>
-#endif
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
 
 namespace cugraph {
 
@@ -104,12 +125,22 @@ struct cluster_update_op_t {
 };
 
 // a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
-template <typename vertex_t, typename weight_t>
-struct return_edge_weight_t {
-  __device__ auto operator()(
-    vertex_t, vertex_t, weight_t w, thrust::nullopt_t, thrust::nullopt_t) const
+struct push_to_every_nbr_e_op_t {
+  template <typename... Args>
+  __device__ bool operator()(Args...) const
   {
-    return w;
+    return true;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct activate_nbr_v_op_t {
+  size_t next_bucket_idx{};
+  __device__ thrust::optional<thrust::tuple<size_t, uint8_t>> operator()(vertex_t,
+                                                                         int /* v_val */) const
+  {
+    return thrust::make_tuple(next_bucket_idx, uint8_t{1});
   }
 };
 
@@ -130,13 +161,15 @@ class Louvain {
 
   static_assert(!graph_view_t::is_adj_matrix_transposed);
 
-  Louvain(raft::handle_t const& handle, graph_view_t const& graph_view)
-    :
-#ifdef TIMING
-      hr_timer_(),
-#endif
-      handle_(handle),
+  // if prune_inactive_vertices is true, only the vertices that moved or have a neighbor that
+  // moved (or were kept from moving by the up_down rule) in the previous local moving iteration
+  // evaluate their moves
+  Louvain(raft::handle_t const& handle,
+          graph_view_t const& graph_view,
+          bool prune_inactive_vertices = true)
+    : handle_(handle),
       dendrogram_(std::make_unique<Dendrogram<vertex_t>>()),
+      input_graph_view_(graph_view),
       current_graph_view_(graph_view),
       cluster_keys_v_(0, handle.get_stream_view()),
       cluster_weights_v_(0, handle.get_stream_view()),
@@ -144,7 +177,18 @@ class Louvain {
       src_vertex_weights_cache_(),
       next_clusters_v_(0, handle.get_stream_view()),
       src_clusters_cache_(),
-      dst_clusters_cache_()
+      dst_clusters_cache_(),
+      prev_clusters_v_(0, handle.get_stream()),
+      old_cluster_sum_v_(0, handle.get_stream()),
+      cluster_subtract_v_(0, handle.get_stream()),
+      src_old_cluster_sum_subtract_pairs_cache_(),
+      vertex_cluster_weights_v_(0, handle.get_stream()),
+      src_cluster_weights_cache_(),
+      cluster_delta_modularity_pairs_(
+        allocate_dataframe_buffer<thrust::tuple<vertex_t, weight_t>>(0, handle.get_stream())),
+      prune_inactive_vertices_(prune_inactive_vertices),
+      active_vertex_flags_v_(0, handle.get_stream()),
+      src_active_vertex_flags_cache_()
   {
   }
 
@@ -156,15 +200,105 @@ class Louvain {
 
   virtual weight_t operator()(size_t max_level, weight_t resolution)
   {
+    return run(max_level, resolution, std::nullopt);
+  }
+
+  // Runs Louvain as operator() does and checkpoints the dendrogram, the modularity, and the
+  // coarsened graph after every checkpoint_params.interval levels; if checkpoint_params.resume is
+  // set, resumes from the last checkpoint (if exists).
+  weight_t checkpointed_run(size_t max_level,
+                            weight_t resolution,
+                            checkpoint_params_t const& checkpoint_params)
+  {
+    detail::check_checkpoint_params(checkpoint_params);
+    return run(max_level, resolution, checkpoint_params);
+  }
+
+  // Runs Louvain from the input graph for every resolution in resolutions and returns the
+  // dendrogram and the modularity of each run. The total edge weight and the first level's vertex
+  // and cluster weights do not depend on the resolution, so they are computed once (this saves an
+  // edge pass, and in multi-GPU a shuffle and a row property cache update, per run) and copied to
+  // every run.
+  std::vector<std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t>> sweep(
+    size_t max_level, std::vector<weight_t> const& resolutions)
+  {
+    scoped_phase_t phase("louvain_sweep", handle_.get_stream_view());
+
+    std::vector<std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t>> results{};
+    results.reserve(resolutions.size());
+
+    current_graph_.reset();
+    current_graph_view_ = input_graph_view_;
+
+    weight_t total_edge_weight = compute_total_edge_weight();
+
+    rmm::device_uvector<weight_t> first_vertex_weights_v(0, handle_.get_stream());
+    rmm::device_uvector<vertex_t> first_cluster_keys_v(0, handle_.get_stream());
+    rmm::device_uvector<weight_t> first_cluster_weights_v(0, handle_.get_stream());
+    bool first_level_weights_valid{false};
+
+    for (auto resolution : resolutions) {
+      dendrogram_ = std::make_unique<Dendrogram<vertex_t>>();
+      current_graph_.reset();
+      current_graph_view_ = input_graph_view_;
+
+      weight_t best_modularity = weight_t{-1};
+
+      while (dendrogram_->num_levels() < max_level) {
+        initialize_dendrogram_level();
+
+        if (dendrogram_->num_levels() == 1) {
+          if (first_level_weights_valid) {
+            restore_vertex_and_cluster_weights(
+              first_vertex_weights_v, first_cluster_keys_v, first_cluster_weights_v);
+          } else {
+            compute_vertex_and_cluster_weights();
+            // update_clustering() updates the cluster weights in-place
+            first_vertex_weights_v =
+              rmm::device_uvector<weight_t>(vertex_weights_v_, handle_.get_stream());
+            first_cluster_keys_v =
+              rmm::device_uvector<vertex_t>(cluster_keys_v_, handle_.get_stream());
+            first_cluster_weights_v =
+              rmm::device_uvector<weight_t>(cluster_weights_v_, handle_.get_stream());
+            first_level_weights_valid = true;
+          }
+        } else {
+          compute_vertex_and_cluster_weights();
+        }
+
+        weight_t new_Q = update_clustering(total_edge_weight, resolution);
+
+        if (new_Q <= best_modularity) { break; }
+
+        best_modularity = new_Q;
+
+        shrink_graph();
+      }
+
+      dendrogram_->shrink_to_fit(handle_.get_stream_view());
+      results.push_back(std::make_pair(std::move(dendrogram_), best_modularity));
+    }
+
+    dendrogram_ = std::make_unique<Dendrogram<vertex_t>>();
+
+    return results;
+  }
+
+ protected:
+  weight_t run(size_t max_level,
+               weight_t resolution,
+               std::optional<checkpoint_params_t> const& checkpoint_params)
+  {
+    scoped_phase_t phase("louvain", handle_.get_stream_view());
+
     weight_t best_modularity = weight_t{-1};
 
-    weight_t total_edge_weight = transform_reduce_e(
-      handle_,
-      current_graph_view_,
-      dummy_properties_t<vertex_t>{}.device_view(),
-      dummy_properties_t<vertex_t>{}.device_view(),
-      [] __device__(auto, auto, weight_t wt, auto, auto) { return wt; },
-      weight_t{0});
+    weight_t total_edge_weight = compute_total_edge_weight();
+
+    if (checkpoint_params && checkpoint_params->resume) {
+      auto checkpointed_modularity = read_louvain_checkpoint(*checkpoint_params);
+      if (checkpointed_modularity) { best_modularity = *checkpointed_modularity; }
+    }
 
     while (dendrogram_->num_levels() < max_level) {
       //
@@ -181,52 +315,107 @@ class Louvain {
       best_modularity = new_Q;
 
       shrink_graph();
+
+      if (checkpoint_params && (dendrogram_->num_levels() % checkpoint_params->interval == 0)) {
+        write_louvain_checkpoint(*checkpoint_params, best_modularity);
+      }
     }
 
-    timer_display(std::cout);
+    dendrogram_->shrink_to_fit(handle_.get_stream_view());
 
     return best_modularity;
   }
 
- protected:
-  void timer_start(std::string const& region)
+  // the checkpointed state (after shrink_graph()): the dendrogram levels (the last level maps the
+  // previous level's vertices to the vertices of current_graph_), the modularity, and
+  // current_graph_
+  void write_louvain_checkpoint(checkpoint_params_t const& checkpoint_params,
+                                weight_t best_modularity)
   {
-#ifdef TIMING
-    if (graph_view_t::is_multi_gpu) {
-      if (handle.get_comms().get_rank() == 0) hr_timer_.start(region);
-    } else {
-      hr_timer_.start(region);
+    auto num_levels     = dendrogram_->num_levels();
+    auto graph_sz_bytes = serializer::serializer_t::get_device_graph_sz_bytes(*current_graph_);
+    auto sz_bytes       = sizeof(size_t) + num_levels * (sizeof(vertex_t) + sizeof(size_t)) +
+                    dendrogram_->size() * sizeof(vertex_t) + sizeof(weight_t) +
+                    2 * sizeof(size_t) + graph_sz_bytes.first + graph_sz_bytes.second;
+
+    serializer::serializer_t ser(handle_, sz_bytes);
+    ser.serialize(num_levels);
+    for (size_t l = 0; l < num_levels; ++l) {
+      ser.serialize(dendrogram_->get_level_first_index_nocheck(l));
+      ser.serialize(dendrogram_->get_level_size_nocheck(l));
     }
-#endif
+    ser.serialize(dendrogram_->data(), dendrogram_->size());
+    ser.serialize(best_modularity);
+    ser.serialize(graph_sz_bytes.first);
+    ser.serialize(graph_sz_bytes.second);
+    serializer::serializer_t::graph_meta_t<graph_t> graph_meta{};
+    ser.serialize(*current_graph_, graph_meta);
+
+    detail::write_checkpoint<graph_view_t::is_multi_gpu>(handle_,
+                                                         checkpoint_params,
+                                                         detail::louvain_checkpoint_tag,
+                                                         static_cast<uint64_t>(num_levels),
+                                                         ser,
+                                                         sz_bytes);
   }
 
-  void timer_stop(rmm::cuda_stream_view stream_view)
+  // restores the state written by write_louvain_checkpoint() and returns the modularity, or
+  // returns std::nullopt if there is no checkpoint
+  std::optional<weight_t> read_louvain_checkpoint(checkpoint_params_t const& checkpoint_params)
   {
-#ifdef TIMING
-    if (graph_view_t::is_multi_gpu) {
-      if (handle.get_comms().get_rank() == 0) {
-        stream_view.synchronize();
-        hr_timer_.stop();
-      }
-    } else {
-      stream_view.synchronize();
-      hr_timer_.stop();
+    auto checkpoint = detail::read_checkpoint<graph_view_t::is_multi_gpu>(
+      handle_, checkpoint_params, detail::louvain_checkpoint_tag);
+    if (!checkpoint) { return std::nullopt; }
+
+    auto& payload = std::get<1>(*checkpoint);
+    serializer::serializer_t ser(handle_, payload.data());
+
+    auto num_levels = ser.unserialize<size_t>();
+    std::vector<vertex_t> level_first_indices(num_levels);
+    std::vector<size_t> level_sizes(num_levels);
+    for (size_t l = 0; l < num_levels; ++l) {
+      level_first_indices[l] = ser.unserialize<vertex_t>();
+      level_sizes[l]         = ser.unserialize<size_t>();
     }
-#endif
+    detail::check_checkpoint_consistency<graph_view_t::is_multi_gpu>(
+      handle_,
+      (num_levels > 0) && (level_first_indices[0] == input_graph_view_.get_local_vertex_first()) &&
+        (level_sizes[0] == static_cast<size_t>(input_graph_view_.get_number_of_local_vertices())));
+
+    dendrogram_ = std::make_unique<Dendrogram<vertex_t>>();
+    dendrogram_->reserve(std::reduce(level_sizes.begin(), level_sizes.end()),
+                         handle_.get_stream_view());
+    for (size_t l = 0; l < num_levels; ++l) {
+      dendrogram_->add_level(
+        level_first_indices[l], static_cast<vertex_t>(level_sizes[l]), handle_.get_stream_view());
+    }
+    auto levels = ser.unserialize<vertex_t>(dendrogram_->size());
+    thrust::copy(handle_.get_thrust_policy(),
+                 levels.begin(),
+                 levels.end(),
+                 dendrogram_->get_level_ptr_nocheck(0));
+
+    auto best_modularity       = ser.unserialize<weight_t>();
+    auto graph_device_sz_bytes = ser.unserialize<size_t>();
+    auto graph_host_sz_bytes   = ser.unserialize<size_t>();
+    current_graph_      = std::make_unique<graph_t>(
+      ser.unserialize<graph_t>(graph_device_sz_bytes, graph_host_sz_bytes));
+    current_graph_view_ = current_graph_->view();
+
+    return best_modularity;
   }
 
-  void timer_display(std::ostream& os)
+  weight_t compute_total_edge_weight() const
   {
-#ifdef TIMING
-    if (graph_view_t::is_multi_gpu) {
-      if (handle.get_comms().get_rank() == 0) hr_timer_.display(os);
-    } else {
-      hr_timer_.display(os);
-    }
-#endif
+    return transform_reduce_e(
+      handle_,
+      current_graph_view_,
+      dummy_properties_t<vertex_t>{}.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      [] __device__(auto, auto, weight_t wt, auto, auto) { return wt; },
+      weight_t{0});
   }
 
- protected:
   void initialize_dendrogram_level()
   {
     dendrogram_->add_level(current_graph_view_.get_local_vertex_first(),
@@ -240,40 +429,39 @@ class Louvain {
   }
 
  public:
-  weight_t modularity(weight_t total_edge_weight, weight_t resolution) const
+  // old_cluster_sum_v & cluster_subtract_v are the outputs of compute_cluster_sum_and_subtract()
+  // for next_clusters_v_; this avoids an additional edge pass to compute the intra-cluster edge
+  // weight sum.
+  weight_t modularity(weight_t total_edge_weight,
+                      weight_t resolution,
+                      rmm::device_uvector<weight_t> const& old_cluster_sum_v,
+                      rmm::device_uvector<weight_t> const& cluster_subtract_v) const
   {
-    weight_t sum_degree_squared = thrust::transform_reduce(
+    // the two sums are all-reduced with a single collective call
+    deferred_host_scalar_allreduce_t<weight_t, graph_view_t::is_multi_gpu> sums{};
+
+    auto sum_degree_squared_slot = sums.add(thrust::transform_reduce(
       handle_.get_thrust_policy(),
       cluster_weights_v_.begin(),
       cluster_weights_v_.end(),
       [] __device__(weight_t p) { return p * p; },
       weight_t{0},
-      thrust::plus<weight_t>());
+      thrust::plus<weight_t>()));
 
-    if (graph_view_t::is_multi_gpu) {
-      sum_degree_squared = host_scalar_allreduce(
-        handle_.get_comms(), sum_degree_squared, raft::comms::op_t::SUM, handle_.get_stream());
-    }
+    // self-loops are excluded from old_cluster_sum_v and counted in cluster_subtract_v
+    auto pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(old_cluster_sum_v.begin(), cluster_subtract_v.begin()));
+    auto sum_internal_slot = sums.add(thrust::transform_reduce(
+      handle_.get_thrust_policy(),
+      pair_first,
+      pair_first + old_cluster_sum_v.size(),
+      [] __device__(auto p) { return thrust::get<0>(p) + thrust::get<1>(p); },
+      weight_t{0},
+      thrust::plus<weight_t>()));
 
-    weight_t sum_internal = transform_reduce_e(
-      handle_,
-      current_graph_view_,
-      graph_view_t::is_multi_gpu
-        ? src_clusters_cache_.device_view()
-        : detail::major_properties_device_view_t<vertex_t, vertex_t const*>(
-            next_clusters_v_.begin()),
-      graph_view_t::is_multi_gpu
-        ? dst_clusters_cache_.device_view()
-        : detail::minor_properties_device_view_t<vertex_t, vertex_t const*>(
-            next_clusters_v_.begin()),
-      [] __device__(auto, auto, weight_t wt, auto src_cluster, auto nbr_cluster) {
-        if (src_cluster == nbr_cluster) {
-          return wt;
-        } else {
-          return weight_t{0};
-        }
-      },
-      weight_t{0});
+    sums.resolve(handle_);
+    auto sum_degree_squared = sums.get(sum_degree_squared_slot);
+    auto sum_internal       = sums.get(sum_internal_slot);
 
     weight_t Q = sum_internal / total_edge_weight -
                  (resolution * sum_degree_squared) / (total_edge_weight * total_edge_weight);
@@ -283,16 +471,25 @@ class Louvain {
 
   void compute_vertex_and_cluster_weights()
   {
-    timer_start("compute_vertex_and_cluster_weights");
+    scoped_phase_t phase("compute_vertex_and_cluster_weights", handle_.get_stream_view());
 
     vertex_weights_v_ = current_graph_view_.compute_out_weight_sums(handle_);
+
+    initialize_cluster_weights();
+  }
+
+  // initializes cluster_keys_v_ & cluster_weights_v_ (and the row cache of vertex_weights_v_ for
+  // current_graph_view_) from vertex_weights_v_ for the singleton clusters in the current
+  // dendrogram level (the cluster IDs need not be the vertex IDs, but should be unique)
+  void initialize_cluster_weights()
+  {
     cluster_keys_v_.resize(vertex_weights_v_.size(), handle_.get_stream_view());
     cluster_weights_v_.resize(vertex_weights_v_.size(), handle_.get_stream_view());
 
-    thrust::sequence(handle_.get_thrust_policy(),
-                     cluster_keys_v_.begin(),
-                     cluster_keys_v_.end(),
-                     current_graph_view_.get_local_vertex_first());
+    raft::copy(cluster_keys_v_.begin(),
+               dendrogram_->current_level_begin(),
+               dendrogram_->current_level_size(),
+               handle_.get_stream());
 
     raft::copy(cluster_weights_v_.begin(),
                vertex_weights_v_.begin(),
@@ -321,24 +518,61 @@ class Louvain {
       cluster_weights_v_ = std::move(rx_weights_v);
     }
 
+    // update_by_delta_modularity() & update_cluster_weights() look up cluster_keys_v_ with binary
+    // search
+    thrust::sort_by_key(handle_.get_thrust_policy(),
+                        cluster_keys_v_.begin(),
+                        cluster_keys_v_.end(),
+                        cluster_weights_v_.begin());
+
+    // vertex_weights_v_ is kept (also in multi-GPU) to update cluster weights from vertex moves
     if constexpr (graph_view_t::is_multi_gpu) {
       src_vertex_weights_cache_ =
         row_properties_t<graph_view_t, weight_t>(handle_, current_graph_view_);
       copy_to_adj_matrix_row(
         handle_, current_graph_view_, vertex_weights_v_.begin(), src_vertex_weights_cache_);
-      vertex_weights_v_.resize(0, handle_.get_stream());
-      vertex_weights_v_.shrink_to_fit(handle_.get_stream());
     }
+  }
 
-    timer_stop(handle_.get_stream_view());
+  // restores the vertex and cluster weights saved after compute_vertex_and_cluster_weights() (for
+  // the same graph and clustering)
+  void restore_vertex_and_cluster_weights(rmm::device_uvector<weight_t> const& vertex_weights_v,
+                                          rmm::device_uvector<vertex_t> const& cluster_keys_v,
+                                          rmm::device_uvector<weight_t> const& cluster_weights_v)
+  {
+    vertex_weights_v_.resize(vertex_weights_v.size(), handle_.get_stream());
+    raft::copy(vertex_weights_v_.begin(),
+               vertex_weights_v.begin(),
+               vertex_weights_v.size(),
+               handle_.get_stream());
+    cluster_keys_v_.resize(cluster_keys_v.size(), handle_.get_stream());
+    raft::copy(
+      cluster_keys_v_.begin(), cluster_keys_v.begin(), cluster_keys_v.size(), handle_.get_stream());
+    cluster_weights_v_.resize(cluster_weights_v.size(), handle_.get_stream());
+    raft::copy(cluster_weights_v_.begin(),
+               cluster_weights_v.begin(),
+               cluster_weights_v.size(),
+               handle_.get_stream());
+
+    if constexpr (graph_view_t::is_multi_gpu) {
+      src_vertex_weights_cache_ =
+        row_properties_t<graph_view_t, weight_t>(handle_, current_graph_view_);
+      copy_to_adj_matrix_row(
+        handle_, current_graph_view_, vertex_weights_v_.begin(), src_vertex_weights_cache_);
+    }
   }
 
   virtual weight_t update_clustering(weight_t total_edge_weight, weight_t resolution)
   {
-    timer_start("update_clustering");
+    scoped_phase_t phase("update_clustering", handle_.get_stream_view());
+
+    // The per-vertex buffers are resized instead of re-allocated (the number of vertices never
+    // increases, so the first level's allocations are reused by the later levels), and the
+    // row/column caches are allocated once per level; every local moving iteration reuses them,
+    // which avoids the allocation churn (and the memory pool fragmentation) of allocating fresh
+    // buffers in every iteration.
 
-    next_clusters_v_ =
-      rmm::device_uvector<vertex_t>(dendrogram_->current_level_size(), handle_.get_stream());
+    resize_vertex_buffers(dendrogram_->current_level_size());
 
     raft::copy(next_clusters_v_.begin(),
                dendrogram_->current_level_begin(),
@@ -346,51 +580,98 @@ class Louvain {
                handle_.get_stream());
 
     if constexpr (graph_view_t::is_multi_gpu) {
-      src_clusters_cache_ = row_properties_t<graph_view_t, vertex_t>(handle_, current_graph_view_);
-      copy_to_adj_matrix_row(
-        handle_, current_graph_view_, next_clusters_v_.begin(), src_clusters_cache_);
-      dst_clusters_cache_ = col_properties_t<graph_view_t, vertex_t>(handle_, current_graph_view_);
-      copy_to_adj_matrix_col(
-        handle_, current_graph_view_, next_clusters_v_.begin(), dst_clusters_cache_);
+      src_clusters_cache_ =
+        incremental_row_properties_t<graph_view_t, vertex_t>(handle_, current_graph_view_);
+      src_clusters_cache_.sync(handle_, current_graph_view_, next_clusters_v_.begin());
+      dst_clusters_cache_ =
+        incremental_col_properties_t<graph_view_t, vertex_t>(handle_, current_graph_view_);
+      dst_clusters_cache_.sync(handle_, current_graph_view_, next_clusters_v_.begin());
+      src_cluster_weights_cache_ =
+        row_properties_t<graph_view_t, weight_t>(handle_, current_graph_view_);
+      src_old_cluster_sum_subtract_pairs_cache_ =
+        row_properties_t<graph_view_t, thrust::tuple<weight_t, weight_t>>(handle_,
+                                                                          current_graph_view_);
+    }
+
+    if (prune_inactive_vertices_) {
+      active_vertex_flags_v_.resize(next_clusters_v_.size(), handle_.get_stream());
+      thrust::fill(handle_.get_thrust_policy(),
+                   active_vertex_flags_v_.begin(),
+                   active_vertex_flags_v_.end(),
+                   uint8_t{1});
+      if constexpr (graph_view_t::is_multi_gpu) {
+        src_active_vertex_flags_cache_ =
+          row_properties_t<graph_view_t, uint8_t>(handle_, current_graph_view_);
+        copy_to_adj_matrix_row(handle_,
+                               current_graph_view_,
+                               active_vertex_flags_v_.begin(),
+                               src_active_vertex_flags_cache_);
+      }
     }
 
-    weight_t new_Q = modularity(total_edge_weight, resolution);
-    weight_t cur_Q = new_Q - 1;
+    // The modularity of next_clusters_v_ is evaluated from the edge pass computing the per-vertex
+    // intra-cluster edge weight sums (needed by the next delta modularity computation anyway) and
+    // the cluster weights (updated incrementally from vertex moves), so evaluating the modularity
+    // takes an O(V / P + # clusters / P) reduction instead of an edge pass. prev_clusters_v_ keeps
+    // the clustering before the last moves to restore it (instead of copying every improved
+    // clustering to the dendrogram) if the last moves decreased the modularity.
+
+    weight_t cur_Q{0};
 
     // To avoid the potential of having two vertices swap clusters
     // we will only allow vertices to move up (true) or down (false)
     // during each iteration of the loop
     bool up_down = true;
 
-    while (new_Q > (cur_Q + 0.0001)) {
-      cur_Q = new_Q;
+    for (size_t iter = 0; true; ++iter) {
+      profiler_add_counter("local_moving_iterations", 1);
+      nvtx_range_t iteration_range("local_moving_iteration", static_cast<int64_t>(iter));
 
-      update_by_delta_modularity(total_edge_weight, resolution, next_clusters_v_, up_down);
+      compute_cluster_sum_and_subtract();
 
-      up_down = !up_down;
+      weight_t new_Q =
+        modularity(total_edge_weight, resolution, old_cluster_sum_v_, cluster_subtract_v_);
 
-      new_Q = modularity(total_edge_weight, resolution);
-
-      if (new_Q > cur_Q) {
-        raft::copy(dendrogram_->current_level_begin(),
-                   next_clusters_v_.begin(),
-                   next_clusters_v_.size(),
-                   handle_.get_stream());
+      if (iter > 0) {
+        if (!(new_Q > cur_Q)) { std::swap(next_clusters_v_, prev_clusters_v_); }
+        if (!(new_Q > cur_Q + 0.0001)) { break; }
       }
+
+      cur_Q = new_Q;
+
+      update_by_delta_modularity(total_edge_weight, resolution, up_down);
+
+      up_down = !up_down;
     }
 
-    timer_stop(handle_.get_stream_view());
+    raft::copy(dendrogram_->current_level_begin(),
+               next_clusters_v_.begin(),
+               next_clusters_v_.size(),
+               handle_.get_stream());
+
     return cur_Q;
   }
 
-  std::tuple<rmm::device_uvector<weight_t>, rmm::device_uvector<weight_t>>
-  compute_cluster_sum_and_subtract() const
+  // resizes the per-vertex buffers (this does not re-allocate if the new size does not exceed the
+  // capacity)
+  void resize_vertex_buffers(size_t num_local_vertices)
   {
-    rmm::device_uvector<weight_t> old_cluster_sum_v(
-      current_graph_view_.get_number_of_local_vertices(), handle_.get_stream());
-    rmm::device_uvector<weight_t> cluster_subtract_v(
-      current_graph_view_.get_number_of_local_vertices(), handle_.get_stream());
+    next_clusters_v_.resize(num_local_vertices, handle_.get_stream());
+    prev_clusters_v_.resize(num_local_vertices, handle_.get_stream());
+    old_cluster_sum_v_.resize(num_local_vertices, handle_.get_stream());
+    cluster_subtract_v_.resize(num_local_vertices, handle_.get_stream());
+    if constexpr (!graph_view_t::is_multi_gpu) {
+      vertex_cluster_weights_v_.resize(num_local_vertices, handle_.get_stream());
+    }
+    resize_dataframe_buffer(
+      cluster_delta_modularity_pairs_, num_local_vertices, handle_.get_stream());
+  }
 
+  // computes old_cluster_sum_v_ (the sum of the weights of the edges to the vertex's cluster,
+  // excluding self-loops) & cluster_subtract_v_ (the sum of the self-loop weights) for
+  // next_clusters_v_
+  void compute_cluster_sum_and_subtract()
+  {
     copy_v_transform_reduce_out_nbr(
       handle_,
       current_graph_view_,
@@ -415,47 +696,37 @@ class Louvain {
       },
       thrust::make_tuple(weight_t{0}, weight_t{0}),
       thrust::make_zip_iterator(
-        thrust::make_tuple(old_cluster_sum_v.begin(), cluster_subtract_v.begin())));
-
-    return std::make_tuple(std::move(old_cluster_sum_v), std::move(cluster_subtract_v));
+        thrust::make_tuple(old_cluster_sum_v_.begin(), cluster_subtract_v_.begin())));
   }
 
-  void update_by_delta_modularity(weight_t total_edge_weight,
-                                  weight_t resolution,
-                                  rmm::device_uvector<vertex_t>& next_clusters_v_,
-                                  bool up_down)
+  // moves vertices to the neighbor clusters maximizing the delta modularity (the clustering
+  // before the moves is swapped to prev_clusters_v_), old_cluster_sum_v_ & cluster_subtract_v_
+  // should be up-to-date for next_clusters_v_
+  void update_by_delta_modularity(weight_t total_edge_weight, weight_t resolution, bool up_down)
   {
-    rmm::device_uvector<weight_t> vertex_cluster_weights_v(0, handle_.get_stream());
-    row_properties_t<graph_view_t, weight_t> src_cluster_weights{};
     if constexpr (graph_view_t::is_multi_gpu) {
       cugraph::detail::compute_gpu_id_from_vertex_t<vertex_t> vertex_to_gpu_id_op{
         handle_.get_comms().get_size()};
 
-      vertex_cluster_weights_v = cugraph::collect_values_for_keys(handle_.get_comms(),
-                                                                  cluster_keys_v_.begin(),
-                                                                  cluster_keys_v_.end(),
-                                                                  cluster_weights_v_.data(),
-                                                                  next_clusters_v_.begin(),
-                                                                  next_clusters_v_.end(),
-                                                                  vertex_to_gpu_id_op,
-                                                                  handle_.get_stream());
+      auto vertex_cluster_weights_v =
+        cugraph::collect_values_for_keys(handle_.get_comms(),
+                                         cluster_keys_v_.begin(),
+                                         cluster_keys_v_.end(),
+                                         cluster_weights_v_.data(),
+                                         next_clusters_v_.begin(),
+                                         next_clusters_v_.end(),
+                                         vertex_to_gpu_id_op,
+                                         handle_.get_stream());
 
-      src_cluster_weights = row_properties_t<graph_view_t, weight_t>(handle_, current_graph_view_);
-      copy_to_adj_matrix_row(
-        handle_, current_graph_view_, vertex_cluster_weights_v.begin(), src_cluster_weights);
-      vertex_cluster_weights_v.resize(0, handle_.get_stream());
-      vertex_cluster_weights_v.shrink_to_fit(handle_.get_stream());
+      copy_to_adj_matrix_row(handle_,
+                             current_graph_view_,
+                             vertex_cluster_weights_v.begin(),
+                             src_cluster_weights_cache_);
     } else {
-      thrust::sort_by_key(handle_.get_thrust_policy(),
-                          cluster_keys_v_.begin(),
-                          cluster_keys_v_.end(),
-                          cluster_weights_v_.begin());
-
-      vertex_cluster_weights_v.resize(next_clusters_v_.size(), handle_.get_stream());
       thrust::transform(handle_.get_thrust_policy(),
                         next_clusters_v_.begin(),
                         next_clusters_v_.end(),
-                        vertex_cluster_weights_v.begin(),
+                        vertex_cluster_weights_v_.begin(),
                         [d_cluster_weights = cluster_weights_v_.data(),
                          d_cluster_keys    = cluster_keys_v_.data(),
                          num_clusters      = cluster_keys_v_.size()] __device__(vertex_t cluster) {
@@ -465,90 +736,387 @@ class Louvain {
                         });
     }
 
-    auto [old_cluster_sum_v, cluster_subtract_v] = compute_cluster_sum_and_subtract();
-
-    row_properties_t<graph_view_t, thrust::tuple<weight_t, weight_t>>
-      src_old_cluster_sum_subtract_pairs{};
     if constexpr (graph_view_t::is_multi_gpu) {
-      src_old_cluster_sum_subtract_pairs =
-        row_properties_t<graph_view_t, thrust::tuple<weight_t, weight_t>>(handle_,
-                                                                          current_graph_view_);
       copy_to_adj_matrix_row(handle_,
                              current_graph_view_,
                              thrust::make_zip_iterator(thrust::make_tuple(
-                               old_cluster_sum_v.begin(), cluster_subtract_v.begin())),
-                             src_old_cluster_sum_subtract_pairs);
+                               old_cluster_sum_v_.begin(), cluster_subtract_v_.begin())),
+                             src_old_cluster_sum_subtract_pairs_cache_);
     }
 
-    auto output_buffer = allocate_dataframe_buffer<thrust::tuple<vertex_t, weight_t>>(
-      current_graph_view_.get_number_of_local_vertices(), handle_.get_stream());
-
     auto cluster_old_sum_subtract_pair_first = thrust::make_zip_iterator(
-      thrust::make_tuple(old_cluster_sum_v.cbegin(), cluster_subtract_v.cbegin()));
+      thrust::make_tuple(old_cluster_sum_v_.cbegin(), cluster_subtract_v_.cbegin()));
     auto zipped_src_device_view =
       graph_view_t::is_multi_gpu
         ? device_view_concat(src_vertex_weights_cache_.device_view(),
                              src_clusters_cache_.device_view(),
-                             src_cluster_weights.device_view(),
-                             src_old_cluster_sum_subtract_pairs.device_view())
+                             src_cluster_weights_cache_.device_view(),
+                             src_old_cluster_sum_subtract_pairs_cache_.device_view())
         : device_view_concat(
             detail::major_properties_device_view_t<vertex_t, weight_t const*>(
               vertex_weights_v_.data()),
             detail::major_properties_device_view_t<vertex_t, vertex_t const*>(
               next_clusters_v_.data()),
             detail::major_properties_device_view_t<vertex_t, weight_t const*>(
-              vertex_cluster_weights_v.data()),
+              vertex_cluster_weights_v_.data()),
             detail::major_properties_device_view_t<vertex_t,
                                                    decltype(cluster_old_sum_subtract_pair_first)>(
               cluster_old_sum_subtract_pair_first));
 
-    copy_v_transform_reduce_key_aggregated_out_nbr(
-      handle_,
-      current_graph_view_,
-      zipped_src_device_view,
+    auto dst_clusters_device_view =
       graph_view_t::is_multi_gpu
         ? dst_clusters_cache_.device_view()
         : detail::minor_properties_device_view_t<vertex_t, vertex_t const*>(
-            next_clusters_v_.data()),
-      cluster_keys_v_.begin(),
-      cluster_keys_v_.end(),
-      cluster_weights_v_.begin(),
-      detail::key_aggregated_edge_op_t<vertex_t, weight_t>{total_edge_weight, resolution},
-      detail::reduce_op_t<vertex_t, weight_t>{},
-      thrust::make_tuple(vertex_t{-1}, weight_t{0}),
-      cugraph::get_dataframe_buffer_begin(output_buffer));
+            next_clusters_v_.data());
+    if (prune_inactive_vertices_) {
+      // inactive vertices are set to (-1, 0) and stay in their clusters
+      copy_v_transform_reduce_key_aggregated_out_nbr(
+        handle_,
+        current_graph_view_,
+        zipped_src_device_view,
+        graph_view_t::is_multi_gpu
+          ? src_active_vertex_flags_cache_.device_view()
+          : detail::major_properties_device_view_t<vertex_t, uint8_t const*>(
+              active_vertex_flags_v_.data()),
+        dst_clusters_device_view,
+        cluster_keys_v_.begin(),
+        cluster_keys_v_.end(),
+        cluster_weights_v_.begin(),
+        detail::key_aggregated_edge_op_t<vertex_t, weight_t>{total_edge_weight, resolution},
+        detail::reduce_op_t<vertex_t, weight_t>{},
+        thrust::make_tuple(vertex_t{-1}, weight_t{0}),
+        cugraph::get_dataframe_buffer_begin(cluster_delta_modularity_pairs_));
+    } else {
+      copy_v_transform_reduce_key_aggregated_out_nbr(
+        handle_,
+        current_graph_view_,
+        zipped_src_device_view,
+        dst_clusters_device_view,
+        cluster_keys_v_.begin(),
+        cluster_keys_v_.end(),
+        cluster_weights_v_.begin(),
+        detail::key_aggregated_edge_op_t<vertex_t, weight_t>{total_edge_weight, resolution},
+        detail::reduce_op_t<vertex_t, weight_t>{},
+        thrust::make_tuple(vertex_t{-1}, weight_t{0}),
+        cugraph::get_dataframe_buffer_begin(cluster_delta_modularity_pairs_));
+    }
 
+    std::swap(prev_clusters_v_, next_clusters_v_);
     thrust::transform(handle_.get_thrust_policy(),
-                      next_clusters_v_.begin(),
-                      next_clusters_v_.end(),
-                      cugraph::get_dataframe_buffer_begin(output_buffer),
+                      prev_clusters_v_.begin(),
+                      prev_clusters_v_.end(),
+                      cugraph::get_dataframe_buffer_begin(cluster_delta_modularity_pairs_),
                       next_clusters_v_.begin(),
                       detail::cluster_update_op_t<vertex_t, weight_t>{up_down});
 
     if constexpr (graph_view_t::is_multi_gpu) {
-      copy_to_adj_matrix_row(
-        handle_, current_graph_view_, next_clusters_v_.begin(), src_clusters_cache_);
-      copy_to_adj_matrix_col(
-        handle_, current_graph_view_, next_clusters_v_.begin(), dst_clusters_cache_);
+      // only the vertices that moved are sent once few vertices move
+      src_clusters_cache_.sync(handle_, current_graph_view_, next_clusters_v_.begin());
+      dst_clusters_cache_.sync(handle_, current_graph_view_, next_clusters_v_.begin());
+    }
+
+    if (prune_inactive_vertices_) {
+      update_active_vertices(prev_clusters_v_,
+                             cugraph::get_dataframe_buffer_begin(cluster_delta_modularity_pairs_));
     }
 
-    std::tie(cluster_keys_v_, cluster_weights_v_) =
-      cugraph::transform_reduce_by_adj_matrix_row_key_e(
+    update_cluster_weights(prev_clusters_v_);
+  }
+
+  // a vertex stays active if it moved (prev_clusters_v to next_clusters_v_) or has a positive
+  // delta modularity move blocked by the up_down rule, and becomes active if any of its neighbors
+  // moved; this takes work proportional to the moved vertices' degrees instead of an edge pass
+  // (the graph is symmetric, so pushing to the out-neighbors reaches every neighbor)
+  template <typename DeltaModularityIterator>
+  void update_active_vertices(rmm::device_uvector<vertex_t> const& prev_clusters_v,
+                              DeltaModularityIterator cluster_delta_modularity_pair_first)
+  {
+    auto num_local_vertices = static_cast<vertex_t>(next_clusters_v_.size());
+    auto local_vertex_first = current_graph_view_.get_local_vertex_first();
+    rmm::device_uvector<vertex_t> moved_vertices(next_clusters_v_.size(), handle_.get_stream());
+    moved_vertices.resize(
+      thrust::distance(moved_vertices.begin(),
+                       thrust::copy_if(handle_.get_thrust_policy(),
+                                       thrust::make_counting_iterator(local_vertex_first),
+                                       thrust::make_counting_iterator(local_vertex_first +
+                                                                      num_local_vertices),
+                                       moved_vertices.begin(),
+                                       [prev_clusters = prev_clusters_v.data(),
+                                        next_clusters = next_clusters_v_.data(),
+                                        local_vertex_first] __device__(auto v) {
+                                         auto offset = v - local_vertex_first;
+                                         return prev_clusters[offset] != next_clusters[offset];
+                                       })),
+      handle_.get_stream());
+
+    thrust::transform(handle_.get_thrust_policy(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_local_vertices),
+                      active_vertex_flags_v_.begin(),
+                      [prev_clusters = prev_clusters_v.data(),
+                       next_clusters = next_clusters_v_.data(),
+                       cluster_delta_modularity_pair_first] __device__(auto i) {
+                        return static_cast<uint8_t>(
+                          (prev_clusters[i] != next_clusters[i]) ||
+                          (thrust::get<1>(*(cluster_delta_modularity_pair_first + i)) >
+                           weight_t{0}));
+                      });
+
+    enum class Bucket { cur, next, num_buckets };
+    VertexFrontier<vertex_t,
+                   void,
+                   graph_view_t::is_multi_gpu,
+                   static_cast<size_t>(Bucket::num_buckets)>
+      vertex_frontier(handle_);
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+      .insert(moved_vertices.begin(), moved_vertices.end());
+    moved_vertices.resize(0, handle_.get_stream());
+    moved_vertices.shrink_to_fit(handle_.get_stream());
+
+    update_frontier_v_push_if_out_nbr(
+      handle_,
+      current_graph_view_,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      dummy_properties_t<vertex_t>{}.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      detail::push_to_every_nbr_e_op_t{},
+      reduce_op::null(),
+      thrust::make_constant_iterator(0) /* dummy */,
+      active_vertex_flags_v_.begin(),
+      detail::activate_nbr_v_op_t<vertex_t>{static_cast<size_t>(Bucket::next)});
+
+    if constexpr (graph_view_t::is_multi_gpu) {
+      copy_to_adj_matrix_row(handle_,
+                             current_graph_view_,
+                             active_vertex_flags_v_.begin(),
+                             src_active_vertex_flags_cache_);
+    }
+  }
+
+  // update cluster_weights_v_ from the vertex moves (prev_clusters_v to next_clusters_v_), this
+  // takes O(# moved vertices) work instead of an edge pass
+  void update_cluster_weights(rmm::device_uvector<vertex_t> const& prev_clusters_v)
+  {
+    rmm::device_uvector<vertex_t> moved_vertex_offsets(next_clusters_v_.size(),
+                                                       handle_.get_stream());
+    auto num_local_vertices = static_cast<vertex_t>(next_clusters_v_.size());
+    auto num_moved_vertices = static_cast<vertex_t>(thrust::distance(
+      moved_vertex_offsets.begin(),
+      thrust::copy_if(handle_.get_thrust_policy(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_local_vertices),
+                      moved_vertex_offsets.begin(),
+                      [prev_clusters = prev_clusters_v.data(),
+                       next_clusters = next_clusters_v_.data()] __device__(auto i) {
+                        return prev_clusters[i] != next_clusters[i];
+                      })));
+
+    // a moved vertex subtracts its weight from the old cluster and adds to the new cluster
+
+    rmm::device_uvector<vertex_t> delta_keys_v(size_t{2} * num_moved_vertices,
+                                               handle_.get_stream());
+    rmm::device_uvector<weight_t> delta_weights_v(delta_keys_v.size(), handle_.get_stream());
+    thrust::for_each(handle_.get_thrust_policy(),
+                     thrust::make_counting_iterator(vertex_t{0}),
+                     thrust::make_counting_iterator(num_moved_vertices),
+                     [moved_vertex_offsets = moved_vertex_offsets.data(),
+                      prev_clusters        = prev_clusters_v.data(),
+                      next_clusters        = next_clusters_v_.data(),
+                      vertex_weights       = vertex_weights_v_.data(),
+                      delta_keys           = delta_keys_v.data(),
+                      delta_weights        = delta_weights_v.data(),
+                      num_moved_vertices] __device__(auto i) {
+                       auto offset                        = moved_vertex_offsets[i];
+                       delta_keys[i]                      = prev_clusters[offset];
+                       delta_weights[i]                   = -vertex_weights[offset];
+                       delta_keys[num_moved_vertices + i] = next_clusters[offset];
+                       delta_weights[num_moved_vertices + i] = vertex_weights[offset];
+                     });
+    moved_vertex_offsets.resize(0, handle_.get_stream());
+    moved_vertex_offsets.shrink_to_fit(handle_.get_stream());
+
+    if constexpr (graph_view_t::is_multi_gpu) {
+      auto const comm_size = handle_.get_comms().get_size();
+
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(delta_keys_v.begin(), delta_weights_v.begin()));
+      std::forward_as_tuple(std::tie(delta_keys_v, delta_weights_v), std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          handle_.get_comms(),
+          pair_first,
+          pair_first + delta_keys_v.size(),
+          [key_func =
+             cugraph::detail::compute_gpu_id_from_vertex_t<vertex_t>{
+               comm_size}] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+          handle_.get_stream_view());
+    }
+
+    thrust::sort_by_key(handle_.get_thrust_policy(),
+                        delta_keys_v.begin(),
+                        delta_keys_v.end(),
+                        delta_weights_v.begin());
+    rmm::device_uvector<vertex_t> unique_keys_v(delta_keys_v.size(), handle_.get_stream());
+    rmm::device_uvector<weight_t> weight_sums_v(unique_keys_v.size(), handle_.get_stream());
+    auto num_unique_keys = static_cast<size_t>(
+      thrust::distance(unique_keys_v.begin(),
+                       thrust::get<0>(thrust::reduce_by_key(handle_.get_thrust_policy(),
+                                                            delta_keys_v.begin(),
+                                                            delta_keys_v.end(),
+                                                            delta_weights_v.begin(),
+                                                            unique_keys_v.begin(),
+                                                            weight_sums_v.begin()))));
+
+    // cluster_keys_v_ is sorted and includes every (local) cluster ID, and unique_keys_v has no
+    // duplicates, so no atomics are necessary
+    thrust::for_each(handle_.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_unique_keys),
+                     [unique_keys     = unique_keys_v.data(),
+                      weight_sums     = weight_sums_v.data(),
+                      cluster_keys    = cluster_keys_v_.data(),
+                      cluster_weights = cluster_weights_v_.data(),
+                      num_clusters    = cluster_keys_v_.size()] __device__(auto i) {
+                       auto pos = thrust::lower_bound(
+                         thrust::seq, cluster_keys, cluster_keys + num_clusters, unique_keys[i]);
+                       cluster_weights[thrust::distance(cluster_keys, pos)] += weight_sums[i];
+                     });
+  }
+
+  // decompresses the local adjacency matrix partitions of current_graph_view_ to edge lists (one
+  // per local adjacency matrix partition)
+  std::tuple<std::vector<rmm::device_uvector<vertex_t>>,
+             std::vector<rmm::device_uvector<vertex_t>>,
+             std::optional<std::vector<rmm::device_uvector<weight_t>>>>
+  decompress_local_adj_matrix_partitions() const
+  {
+    std::vector<rmm::device_uvector<vertex_t>> edgelist_majors{};
+    std::vector<rmm::device_uvector<vertex_t>> edgelist_minors{};
+    auto edgelist_weights = current_graph_view_.is_weighted()
+                              ? std::make_optional<std::vector<rmm::device_uvector<weight_t>>>()
+                              : std::nullopt;
+    for (size_t i = 0; i < current_graph_view_.get_number_of_local_adj_matrix_partitions(); ++i) {
+      auto matrix_partition =
+        matrix_partition_device_view_t<vertex_t, edge_t, weight_t, graph_view_t::is_multi_gpu>(
+          current_graph_view_.get_matrix_partition_view(i));
+
+      rmm::device_uvector<vertex_t> majors(matrix_partition.get_number_of_edges(),
+                                           handle_.get_stream());
+      rmm::device_uvector<vertex_t> minors(majors.size(), handle_.get_stream());
+      auto weights = edgelist_weights ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                          majors.size(), handle_.get_stream())
+                                      : std::nullopt;
+      detail::decompress_matrix_partition_to_edgelist(
         handle_,
-        current_graph_view_,
-        dummy_properties_t<vertex_t>{}.device_view(),
-        dummy_properties_t<vertex_t>{}.device_view(),
-        graph_view_t::is_multi_gpu
-          ? src_clusters_cache_.device_view()
-          : detail::major_properties_device_view_t<vertex_t, vertex_t const*>(
-              next_clusters_v_.data()),
-        detail::return_edge_weight_t<vertex_t, weight_t>{},
-        weight_t{0});
+        matrix_partition,
+        majors.data(),
+        minors.data(),
+        weights ? std::optional<weight_t*>{(*weights).data()} : std::nullopt,
+        current_graph_view_.get_local_adj_matrix_partition_segment_offsets(i));
+
+      edgelist_majors.push_back(std::move(majors));
+      edgelist_minors.push_back(std::move(minors));
+      if (weights) { (*edgelist_weights).push_back(std::move(*weights)); }
+    }
+
+    return std::make_tuple(
+      std::move(edgelist_majors), std::move(edgelist_minors), std::move(edgelist_weights));
+  }
+
+  // creates a graph (with the vertex partitioning of current_graph_view_) from the edge lists of
+  // the local adjacency matrix partitions (edges sorted by majors, e.g. from
+  // decompress_local_adj_matrix_partitions() after removing or re-weighting edges)
+  std::unique_ptr<graph_t> create_graph_from_local_adj_matrix_partition_edgelists(
+    std::vector<rmm::device_uvector<vertex_t>> const& edgelist_majors,
+    std::vector<rmm::device_uvector<vertex_t>> const& edgelist_minors,
+    std::optional<std::vector<rmm::device_uvector<weight_t>>> const& edgelist_weights) const
+  {
+    std::vector<edgelist_t<vertex_t, edge_t, weight_t>> edgelists(edgelist_majors.size());
+    for (size_t i = 0; i < edgelists.size(); ++i) {
+      edgelists[i].p_src_vertices = edgelist_majors[i].data();
+      edgelists[i].p_dst_vertices = edgelist_minors[i].data();
+      edgelists[i].p_edge_weights =
+        edgelist_weights ? std::optional<weight_t const*>{(*edgelist_weights)[i].data()}
+                         : std::nullopt;
+      edgelists[i].number_of_edges = static_cast<edge_t>(edgelist_majors[i].size());
+    }
+
+    graph_properties_t properties{current_graph_view_.is_symmetric(),
+                                  current_graph_view_.is_multigraph()};
+
+    if constexpr (graph_view_t::is_multi_gpu) {
+      auto& row_comm = handle_.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+      auto& col_comm = handle_.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+      auto vertex_partition_lasts = current_graph_view_.get_vertex_partition_lasts();
+      std::vector<vertex_t> vertex_partition_offsets(vertex_partition_lasts.size() + 1,
+                                                     vertex_t{0});
+      std::copy(vertex_partition_lasts.begin(),
+                vertex_partition_lasts.end(),
+                vertex_partition_offsets.begin() + 1);
+      partition_t<vertex_t> partition(vertex_partition_offsets,
+                                      row_comm.get_size(),
+                                      col_comm.get_size(),
+                                      row_comm.get_rank(),
+                                      col_comm.get_rank());
+
+      // the major ranges of the local adjacency matrix partitions are disjoint
+      vertex_t num_local_unique_edge_rows{0};
+      size_t num_local_edges{0};
+      for (size_t i = 0; i < edgelist_majors.size(); ++i) {
+        num_local_unique_edge_rows += static_cast<vertex_t>(thrust::count_if(
+          handle_.get_thrust_policy(),
+          thrust::make_counting_iterator(size_t{0}),
+          thrust::make_counting_iterator(edgelist_majors[i].size()),
+          detail::is_first_in_run_t<vertex_t>{edgelist_majors[i].data()}));
+        num_local_edges += edgelist_majors[i].size();
+      }
+      vertex_t num_local_unique_edge_cols{0};
+      {
+        rmm::device_uvector<vertex_t> minors(num_local_edges, handle_.get_stream());
+        size_t offset{0};
+        for (size_t i = 0; i < edgelist_minors.size(); ++i) {
+          thrust::copy(handle_.get_thrust_policy(),
+                       edgelist_minors[i].begin(),
+                       edgelist_minors[i].end(),
+                       minors.begin() + offset);
+          offset += edgelist_minors[i].size();
+        }
+        thrust::sort(handle_.get_thrust_policy(), minors.begin(), minors.end());
+        num_local_unique_edge_cols = static_cast<vertex_t>(
+          thrust::count_if(handle_.get_thrust_policy(),
+                           thrust::make_counting_iterator(size_t{0}),
+                           thrust::make_counting_iterator(minors.size()),
+                           detail::is_first_in_run_t<vertex_t>{minors.data()}));
+      }
+
+      auto number_of_edges = static_cast<edge_t>(host_scalar_allreduce(
+        handle_.get_comms(), num_local_edges, raft::comms::op_t::SUM, handle_.get_stream()));
+
+      return std::make_unique<graph_t>(
+        handle_,
+        edgelists,
+        graph_meta_t<vertex_t, edge_t, graph_view_t::is_multi_gpu>{
+          current_graph_view_.get_number_of_vertices(),
+          number_of_edges,
+          properties,
+          partition,
+          std::nullopt,
+          num_local_unique_edge_rows,
+          num_local_unique_edge_cols});
+    } else {
+      return std::make_unique<graph_t>(
+        handle_,
+        edgelists[0],
+        graph_meta_t<vertex_t, edge_t, graph_view_t::is_multi_gpu>{
+          current_graph_view_.get_number_of_vertices(), properties, std::nullopt});
+    }
   }
 
   void shrink_graph()
   {
-    timer_start("shrinking graph");
+    scoped_phase_t phase("shrink_graph", handle_.get_stream_view());
 
     rmm::device_uvector<vertex_t> numbering_map(0, handle_.get_stream());
 
@@ -571,8 +1139,6 @@ class Louvain {
       dendrogram_->current_level_begin(),
       dendrogram_->current_level_size(),
       false);
-
-    timer_stop(handle_.get_stream());
   }
 
  protected:
@@ -580,6 +1146,8 @@ class Louvain {
 
   std::unique_ptr<Dendrogram<vertex_t>> dendrogram_;
 
+  graph_view_t input_graph_view_;
+
   //
   //  Initially we run on the input graph view,
   //  but as we shrink the graph we'll keep the
@@ -596,12 +1164,29 @@ class Louvain {
     src_vertex_weights_cache_;  // src cache for vertex_weights_v_
 
   rmm::device_uvector<vertex_t> next_clusters_v_;
-  row_properties_t<graph_view_t, vertex_t> src_clusters_cache_;  // src cache for next_clusters_v_
-  col_properties_t<graph_view_t, vertex_t> dst_clusters_cache_;  // dst cache for next_clusters_v_
+  incremental_row_properties_t<graph_view_t, vertex_t>
+    src_clusters_cache_;  // src cache for next_clusters_v_
+  incremental_col_properties_t<graph_view_t, vertex_t>
+    dst_clusters_cache_;  // dst cache for next_clusters_v_
+
+  // buffers reused by the local moving iterations
+  rmm::device_uvector<vertex_t> prev_clusters_v_;
+  rmm::device_uvector<weight_t> old_cluster_sum_v_;
+  rmm::device_uvector<weight_t> cluster_subtract_v_;
+  row_properties_t<graph_view_t, thrust::tuple<weight_t, weight_t>>
+    src_old_cluster_sum_subtract_pairs_cache_;  // src cache for old_cluster_sum_v_ &
+                                                // cluster_subtract_v_
+  rmm::device_uvector<weight_t> vertex_cluster_weights_v_;  // SG only
+  row_properties_t<graph_view_t, weight_t>
+    src_cluster_weights_cache_;  // MG only, src cache for the weights of next_clusters_v_
+  decltype(allocate_dataframe_buffer<thrust::tuple<vertex_t, weight_t>>(
+    0, rmm::cuda_stream_view{})) cluster_delta_modularity_pairs_;
+
+  bool prune_inactive_vertices_{true};
+  rmm::device_uvector<uint8_t> active_vertex_flags_v_;
+  row_properties_t<graph_view_t, uint8_t>
+    src_active_vertex_flags_cache_;  // src cache for active_vertex_flags_v_
 
-#ifdef TIMING
-  HighResTimer hr_timer_;
-#endif
 };
 
 }  // namespace cugraph
@@ -51,6 +51,33 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   return std::make_pair(runner.move_dendrogram(), wt);
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  checkpoint_params_t const& checkpoint_params,
+  size_t max_level,
+  weight_t resolution)
+{
+  Louvain<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>> runner(handle, graph_view);
+
+  weight_t wt = runner.checkpointed_run(max_level, resolution, checkpoint_params);
+
+  return std::make_pair(runner.move_dendrogram(), wt);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::vector<std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t>> louvain_multi_resolution(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  std::vector<weight_t> const& resolutions,
+  size_t max_level)
+{
+  Louvain<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>> runner(handle, graph_view);
+
+  return runner.sweep(max_level, resolutions);
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 void flatten_dendrogram(
   raft::handle_t const& handle,
@@ -70,6 +97,25 @@ void flatten_dendrogram(
     handle, dendrogram, vertex_ids_v.data(), clustering, dendrogram.num_levels());
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void flatten_dendrogram_levels(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  Dendrogram<vertex_t> const& dendrogram,
+  vertex_t* level_clusterings)
+{
+  rmm::device_uvector<vertex_t> vertex_ids_v(graph_view.get_number_of_local_vertices(),
+                                             handle.get_stream());
+
+  thrust::sequence(handle.get_thrust_policy(),
+                   vertex_ids_v.begin(),
+                   vertex_ids_v.end(),
+                   graph_view.get_local_vertex_first());
+
+  partition_at_all_levels<vertex_t, multi_gpu>(
+    handle, dendrogram, vertex_ids_v.data(), level_clusterings);
+}
+
 }  // namespace detail
 
 template <typename graph_view_t>
@@ -83,6 +129,29 @@ louvain(raft::handle_t const& handle,
   return detail::louvain(handle, graph_view, max_level, resolution);
 }
 
+template <typename graph_view_t>
+std::pair<std::unique_ptr<Dendrogram<typename graph_view_t::vertex_type>>,
+          typename graph_view_t::weight_type>
+louvain(raft::handle_t const& handle,
+        graph_view_t const& graph_view,
+        checkpoint_params_t const& checkpoint_params,
+        size_t max_level,
+        typename graph_view_t::weight_type resolution)
+{
+  return detail::louvain(handle, graph_view, checkpoint_params, max_level, resolution);
+}
+
+template <typename graph_view_t>
+std::vector<std::pair<std::unique_ptr<Dendrogram<typename graph_view_t::vertex_type>>,
+                      typename graph_view_t::weight_type>>
+louvain_multi_resolution(raft::handle_t const& handle,
+                         graph_view_t const& graph_view,
+                         std::vector<typename graph_view_t::weight_type> const& resolutions,
+                         size_t max_level)
+{
+  return detail::louvain_multi_resolution(handle, graph_view, resolutions, max_level);
+}
+
 template <typename graph_view_t>
 void flatten_dendrogram(raft::handle_t const& handle,
                         graph_view_t const& graph_view,
@@ -92,6 +161,15 @@ void flatten_dendrogram(raft::handle_t const& handle,
   detail::flatten_dendrogram(handle, graph_view, dendrogram, clustering);
 }
 
+template <typename graph_view_t>
+void flatten_dendrogram_levels(raft::handle_t const& handle,
+                               graph_view_t const& graph_view,
+                               Dendrogram<typename graph_view_t::vertex_type> const& dendrogram,
+                               typename graph_view_t::vertex_type* level_clusterings)
+{
+  detail::flatten_dendrogram_levels(handle, graph_view, dendrogram, level_clusterings);
+}
+
 template <typename graph_view_t>
 std::pair<size_t, typename graph_view_t::weight_type> louvain(
   raft::handle_t const& handle,
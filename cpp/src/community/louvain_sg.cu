@@ -19,63 +19,222 @@
 namespace cugraph {
 
 // Explicit template instantations
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
   raft::handle_t const&, graph_view_t<int32_t, int32_t, float, false, false> const&, size_t, float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
   raft::handle_t const&, graph_view_t<int32_t, int64_t, float, false, false> const&, size_t, float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::pair<std::unique_ptr<Dendrogram<int64_t>>, float> louvain(
   raft::handle_t const&, graph_view_t<int64_t, int64_t, float, false, false> const&, size_t, float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
   raft::handle_t const&,
   graph_view_t<int32_t, int32_t, double, false, false> const&,
   size_t,
   double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
   raft::handle_t const&,
   graph_view_t<int32_t, int64_t, double, false, false> const&,
   size_t,
   double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::pair<std::unique_ptr<Dendrogram<int64_t>>, double> louvain(
   raft::handle_t const&,
   graph_view_t<int64_t, int64_t, double, false, false> const&,
   size_t,
   double);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int32_t, float, false, false> const&,
+  checkpoint_params_t const&,
+  size_t,
+  float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int64_t, float, false, false> const&,
+  checkpoint_params_t const&,
+  size_t,
+  float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::pair<std::unique_ptr<Dendrogram<int64_t>>, float> louvain(
+  raft::handle_t const&,
+  graph_view_t<int64_t, int64_t, float, false, false> const&,
+  checkpoint_params_t const&,
+  size_t,
+  float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int32_t, double, false, false> const&,
+  checkpoint_params_t const&,
+  size_t,
+  double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int64_t, double, false, false> const&,
+  checkpoint_params_t const&,
+  size_t,
+  double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::pair<std::unique_ptr<Dendrogram<int64_t>>, double> louvain(
+  raft::handle_t const&,
+  graph_view_t<int64_t, int64_t, double, false, false> const&,
+  checkpoint_params_t const&,
+  size_t,
+  double);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::pair<size_t, float> louvain(
   raft::handle_t const&,
   graph_view_t<int32_t, int32_t, float, false, false> const&,
   int32_t*,
   size_t,
   float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::pair<size_t, double> louvain(
   raft::handle_t const&,
   graph_view_t<int32_t, int32_t, double, false, false> const&,
   int32_t*,
   size_t,
   double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::pair<size_t, float> louvain(
   raft::handle_t const&,
   graph_view_t<int32_t, int64_t, float, false, false> const&,
   int32_t*,
   size_t,
   float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::pair<size_t, double> louvain(
   raft::handle_t const&,
   graph_view_t<int32_t, int64_t, double, false, false> const&,
   int32_t*,
   size_t,
   double);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::pair<size_t, float> louvain(
   raft::handle_t const&,
   graph_view_t<int64_t, int64_t, float, false, false> const&,
   int64_t*,
   size_t,
   float);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::pair<size_t, double> louvain(
   raft::handle_t const&,
   graph_view_t<int64_t, int64_t, double, false, false> const&,
   int64_t*,
   size_t,
   double);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void flatten_dendrogram_levels(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int32_t, float, false, false> const&,
+  Dendrogram<int32_t> const&,
+  int32_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void flatten_dendrogram_levels(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int32_t, double, false, false> const&,
+  Dendrogram<int32_t> const&,
+  int32_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void flatten_dendrogram_levels(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int64_t, float, false, false> const&,
+  Dendrogram<int32_t> const&,
+  int32_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void flatten_dendrogram_levels(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int64_t, double, false, false> const&,
+  Dendrogram<int32_t> const&,
+  int32_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void flatten_dendrogram_levels(
+  raft::handle_t const&,
+  graph_view_t<int64_t, int64_t, float, false, false> const&,
+  Dendrogram<int64_t> const&,
+  int64_t*);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void flatten_dendrogram_levels(
+  raft::handle_t const&,
+  graph_view_t<int64_t, int64_t, double, false, false> const&,
+  Dendrogram<int64_t> const&,
+  int64_t*);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::vector<std::pair<std::unique_ptr<Dendrogram<int32_t>>, float>>
+louvain_multi_resolution(raft::handle_t const&,
+                         graph_view_t<int32_t, int32_t, float, false, false> const&,
+                         std::vector<float> const&,
+                         size_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::vector<std::pair<std::unique_ptr<Dendrogram<int32_t>>, double>>
+louvain_multi_resolution(raft::handle_t const&,
+                         graph_view_t<int32_t, int32_t, double, false, false> const&,
+                         std::vector<double> const&,
+                         size_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::vector<std::pair<std::unique_ptr<Dendrogram<int32_t>>, float>>
+louvain_multi_resolution(raft::handle_t const&,
+                         graph_view_t<int32_t, int64_t, float, false, false> const&,
+                         std::vector<float> const&,
+                         size_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::vector<std::pair<std::unique_ptr<Dendrogram<int32_t>>, double>>
+louvain_multi_resolution(raft::handle_t const&,
+                         graph_view_t<int32_t, int64_t, double, false, false> const&,
+                         std::vector<double> const&,
+                         size_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::vector<std::pair<std::unique_ptr<Dendrogram<int64_t>>, float>>
+louvain_multi_resolution(raft::handle_t const&,
+                         graph_view_t<int64_t, int64_t, float, false, false> const&,
+                         std::vector<float> const&,
+                         size_t);
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::vector<std::pair<std::unique_ptr<Dendrogram<int64_t>>, double>>
+louvain_multi_resolution(raft::handle_t const&,
+                         graph_view_t<int64_t, int64_t, double, false, false> const&,
+                         std::vector<double> const&,
+                         size_t);
+#endif
 
 }  // namespace cugraph
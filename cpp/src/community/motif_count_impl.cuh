@@ -0,0 +1,734 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/edge_triangle_support.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/collect_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// Wedges (paths of length 2) are counted at their centers from the vertex degrees. 4-cliques are
+// enumerated on the graph oriented by (degree, vertex ID) (see edge_triangle_support.cuh): every
+// 4-clique (a, b, c, d) is found once from its lowest edge (a, b) and its third lowest vertex c, as
+// an (oriented) neighbor d of c among the common (oriented) neighbors W of a & b. 4-cycles are
+// enumerated as in Chiba & Nishizeki: every 4-cycle (u, x, w, y) with u the highest ranked vertex
+// is found from the wedges u - x - w (x & w ranked lower than u) sharing the end points (u, w).
+
+// vertices are ranked by (degree, vertex ID)
+template <typename vertex_t, typename edge_t>
+__device__ bool is_lower_ranked(vertex_t v0, edge_t degree0, vertex_t v1, edge_t degree1)
+{
+  return (degree0 < degree1) || ((degree0 == degree1) && (v0 < v1));
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename edge_t>
+struct wedge_count_t {
+  __device__ edge_t operator()(edge_t degree) const { return (degree * (degree - 1)) / 2; }
+};
+
+// for the k'th common (oriented) neighbor c of the i'th edge (a, b), counts (and, if
+// clique_offsets is not nullptr, writes) the (oriented) neighbors d of c among the common
+// neighbors of a & b (positions in minors are major_edge_indices[common_nbr_offsets[i]] to
+// major_edge_indices[common_nbr_offsets[i + 1]], sorted by vertex ID); the neighbor lists of c are
+// looked up in (nbr_offsets, nbr_indices), indexed by the position of c in nbr_vertices (or by
+// c - nbr_vertex_first if nbr_vertices is nullptr)
+template <typename vertex_t, typename edge_t>
+struct find_four_cliques_t {
+  vertex_t const* minors{nullptr};
+  edge_t const* common_nbr_offsets{nullptr};
+  edge_t const* major_edge_indices{nullptr};
+  edge_t num_edges{0};
+
+  vertex_t const* nbr_vertices{nullptr};
+  vertex_t num_nbr_vertices{0};
+  vertex_t nbr_vertex_first{0};
+  edge_t const* nbr_offsets{nullptr};
+  vertex_t const* nbr_indices{nullptr};
+
+  edge_t const* clique_offsets{nullptr};
+  vertex_t* clique_vertices{nullptr};
+
+  __device__ edge_t operator()(edge_t k) const
+  {
+    auto i = static_cast<edge_t>(thrust::distance(
+      common_nbr_offsets + 1,
+      thrust::upper_bound(
+        thrust::seq, common_nbr_offsets + 1, common_nbr_offsets + num_edges + 1, k)));
+    auto c = minors[major_edge_indices[k]];
+
+    auto first0 = major_edge_indices + common_nbr_offsets[i];
+    auto last0  = major_edge_indices + common_nbr_offsets[i + 1];
+    auto idx    = nbr_vertices != nullptr
+                 ? static_cast<vertex_t>(thrust::distance(
+                     nbr_vertices,
+                     thrust::lower_bound(
+                       thrust::seq, nbr_vertices, nbr_vertices + num_nbr_vertices, c)))
+                 : c - nbr_vertex_first;
+    auto first1 = nbr_indices + nbr_offsets[idx];
+    auto last1  = nbr_indices + nbr_offsets[idx + 1];
+
+    edge_t count{0};
+    while ((first0 < last0) && (first1 < last1)) {
+      auto w = minors[*first0];
+      if (w < *first1) {
+        ++first0;
+      } else if (*first1 < w) {
+        ++first1;
+      } else {
+        if (clique_offsets != nullptr) { clique_vertices[clique_offsets[k] + count] = w; }
+        ++count;
+        ++first0;
+        ++first1;
+      }
+    }
+
+    return count;
+  }
+};
+
+// the i'th edge (a, b) adds the number of the 4-cliques found from the edge to a & b, and the k'th
+// common neighbor c of a & b adds the number of the 4-cliques found from (a, b, c) to c (the fourth
+// vertices are added separately)
+template <typename vertex_t, typename edge_t>
+struct emit_four_clique_count_increments_t {
+  vertex_t const* majors{nullptr};
+  vertex_t const* minors{nullptr};
+  edge_t const* edge_indices{nullptr};  // if nullptr, the i'th edge is the i'th edge of the batch
+  edge_t const* common_nbr_offsets{nullptr};
+  edge_t const* major_edge_indices{nullptr};
+  edge_t const* clique_offsets{nullptr};
+  edge_t num_edges{0};
+  vertex_t* keys{nullptr};
+  edge_t* increments{nullptr};
+
+  __device__ void operator()(edge_t i) const
+  {
+    auto e                = edge_indices != nullptr ? edge_indices[i] : i;
+    auto first            = common_nbr_offsets[i];
+    auto last             = common_nbr_offsets[i + 1];
+    auto count            = clique_offsets[last] - clique_offsets[first];
+    keys[2 * i]           = majors[e];
+    keys[2 * i + 1]       = minors[e];
+    increments[2 * i]     = count;
+    increments[2 * i + 1] = count;
+    for (auto k = first; k < last; ++k) {
+      keys[2 * num_edges + k]       = minors[major_edge_indices[k]];
+      increments[2 * num_edges + k] = clique_offsets[k + 1] - clique_offsets[k];
+    }
+  }
+};
+
+// for the i'th edge (u, x), counts (and, if wedge_offsets is not nullptr, writes) the wedges
+// u - x - w with x & w ranked lower than u; the neighbor lists of x are looked up in (nbr_offsets,
+// nbr_indices) as in intersect_nbr_lists_t, and the degrees of w are looked up in degrees, indexed
+// by the position of w in degree_vertices (or by w - degree_vertex_first if degree_vertices is
+// nullptr)
+template <typename vertex_t, typename edge_t>
+struct find_four_cycle_wedges_t {
+  vertex_t const* majors{nullptr};
+  vertex_t const* minors{nullptr};
+  vertex_t major_first{0};
+  edge_t const* major_degrees{nullptr};
+  edge_t const* edge_indices{nullptr};  // if nullptr, the i'th edge is the i'th edge to process
+
+  vertex_t const* nbr_vertices{nullptr};
+  vertex_t num_nbr_vertices{0};
+  vertex_t nbr_vertex_first{0};
+  edge_t const* nbr_offsets{nullptr};
+  vertex_t const* nbr_indices{nullptr};
+
+  vertex_t const* degree_vertices{nullptr};
+  vertex_t num_degree_vertices{0};
+  vertex_t degree_vertex_first{0};
+  edge_t const* degrees{nullptr};
+
+  edge_t const* wedge_offsets{nullptr};
+  vertex_t* wedge_majors{nullptr};
+  vertex_t* wedge_opposites{nullptr};
+  vertex_t* wedge_midpoints{nullptr};
+
+  __device__ edge_t operator()(edge_t i) const
+  {
+    auto e        = edge_indices != nullptr ? edge_indices[i] : i;
+    auto u        = majors[e];
+    auto x        = minors[e];
+    auto u_degree = major_degrees[u - major_first];
+
+    auto idx      = nbr_vertices != nullptr
+                      ? static_cast<vertex_t>(thrust::distance(
+                          nbr_vertices,
+                          thrust::lower_bound(
+                            thrust::seq, nbr_vertices, nbr_vertices + num_nbr_vertices, x)))
+                      : x - nbr_vertex_first;
+    auto x_degree = nbr_offsets[idx + 1] - nbr_offsets[idx];
+    if (!is_lower_ranked(x, x_degree, u, u_degree)) { return edge_t{0}; }
+
+    edge_t count{0};
+    for (auto j = nbr_offsets[idx]; j < nbr_offsets[idx + 1]; ++j) {
+      auto w = nbr_indices[j];
+      if (w == u) { continue; }
+      auto w_idx = degree_vertices != nullptr
+                     ? static_cast<vertex_t>(thrust::distance(
+                         degree_vertices,
+                         thrust::lower_bound(
+                           thrust::seq, degree_vertices, degree_vertices + num_degree_vertices, w)))
+                     : w - degree_vertex_first;
+      if (is_lower_ranked(w, degrees[w_idx], u, u_degree)) {
+        if (wedge_offsets != nullptr) {
+          wedge_majors[wedge_offsets[i] + count]    = u;
+          wedge_opposites[wedge_offsets[i] + count] = w;
+          wedge_midpoints[wedge_offsets[i] + count] = x;
+        }
+        ++count;
+      }
+    }
+
+    return count;
+  }
+};
+
+// the c wedges sharing the end points (u, w) form c * (c - 1) / 2 4-cycles; u & w belong to all of
+// them and every midpoint belongs to c - 1 of them
+template <typename vertex_t, typename edge_t>
+struct emit_four_cycle_count_increments_t {
+  vertex_t const* pair_majors{nullptr};
+  vertex_t const* pair_opposites{nullptr};
+  edge_t const* pair_offsets{nullptr};
+  vertex_t const* wedge_midpoints{nullptr};
+  edge_t num_pairs{0};
+  vertex_t* keys{nullptr};
+  edge_t* increments{nullptr};
+
+  __device__ void operator()(edge_t p) const
+  {
+    auto c                = pair_offsets[p + 1] - pair_offsets[p];
+    keys[2 * p]           = pair_majors[p];
+    keys[2 * p + 1]       = pair_opposites[p];
+    increments[2 * p]     = (c * (c - 1)) / 2;
+    increments[2 * p + 1] = (c * (c - 1)) / 2;
+    for (auto j = pair_offsets[p]; j < pair_offsets[p + 1]; ++j) {
+      keys[2 * num_pairs + j]       = wedge_midpoints[j];
+      increments[2 * num_pairs + j] = c - 1;
+    }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct edge_index_to_minor_t {
+  vertex_t const* minors{nullptr};
+
+  __device__ vertex_t operator()(edge_t e) const { return minors[e]; }
+};
+
+// sums the (vertex, increment) pairs by vertex and adds the sums to the counts of the local
+// vertices (the increments for the remote vertices are sent to the owners in multi-GPU)
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void add_vertex_count_increments(raft::handle_t const& handle,
+                                 rmm::device_uvector<vertex_t>&& keys,
+                                 rmm::device_uvector<edge_t>&& increments,
+                                 edge_t* counts,
+                                 vertex_t local_vertex_first,
+                                 rmm::device_uvector<vertex_t> const& d_vertex_partition_lasts)
+{
+  detail::reduce_by_sorted_key(handle, keys, increments);
+
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(keys.begin(), increments.begin()));
+    std::forward_as_tuple(std::tie(keys, increments), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        pair_first,
+        pair_first + keys.size(),
+        detail::renumbered_vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(),
+                                                        comm.get_size()},
+        handle.get_stream());
+
+    detail::reduce_by_sorted_key(handle, keys, increments);
+  }
+
+  // keys are unique, so no atomics are necessary
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(keys.size()),
+    detail::add_reduced_values_t<vertex_t, edge_t>{
+      keys.data(), increments.data(), counts, local_vertex_first});
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void count_four_cliques(raft::handle_t const& handle,
+                        rmm::device_uvector<vertex_t> const& majors,
+                        rmm::device_uvector<vertex_t> const& minors,
+                        rmm::device_uvector<edge_t> const& offsets,
+                        vertex_t local_vertex_first,
+                        std::vector<vertex_t> const& vertex_partition_lasts,
+                        rmm::device_uvector<vertex_t> const& d_vertex_partition_lasts,
+                        edge_t* four_clique_counts)
+{
+  detail::for_each_oriented_edge_batch<vertex_t, edge_t, multi_gpu>(
+    handle,
+    majors,
+    minors,
+    offsets,
+    local_vertex_first,
+    vertex_partition_lasts,
+    false,
+    [&handle, &minors, &offsets, &d_vertex_partition_lasts, four_clique_counts, local_vertex_first](
+      detail::intersect_nbr_lists_t<vertex_t, edge_t> intersect_op,
+      size_t num_edges,
+      edge_t const*) {
+      auto [common_nbr_offsets, major_edge_indices, minor_edge_indices] =
+        detail::find_common_nbrs(handle, intersect_op, num_edges, false);
+
+      // the (oriented) neighbor lists of the third vertices (local in single-GPU)
+
+      find_four_cliques_t<vertex_t, edge_t> clique_op{};
+      clique_op.minors             = minors.data();
+      clique_op.common_nbr_offsets = common_nbr_offsets.data();
+      clique_op.major_edge_indices = major_edge_indices.data();
+      clique_op.num_edges          = static_cast<edge_t>(num_edges);
+
+      rmm::device_uvector<vertex_t> unique_nbrs(0, handle.get_stream());
+      rmm::device_uvector<edge_t> nbr_offsets(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> nbr_indices(0, handle.get_stream());
+      if constexpr (multi_gpu) {
+        unique_nbrs.resize(major_edge_indices.size(), handle.get_stream());
+        thrust::transform(handle.get_thrust_policy(),
+                          major_edge_indices.begin(),
+                          major_edge_indices.end(),
+                          unique_nbrs.begin(),
+                          edge_index_to_minor_t<vertex_t, edge_t>{minors.data()});
+        thrust::sort(handle.get_thrust_policy(), unique_nbrs.begin(), unique_nbrs.end());
+        unique_nbrs.resize(
+          thrust::distance(
+            unique_nbrs.begin(),
+            thrust::unique(handle.get_thrust_policy(), unique_nbrs.begin(), unique_nbrs.end())),
+          handle.get_stream());
+
+        std::tie(nbr_offsets, nbr_indices, std::ignore) =
+          detail::fetch_nbr_lists(handle,
+                                  unique_nbrs.data(),
+                                  unique_nbrs.size(),
+                                  minors,
+                                  offsets,
+                                  local_vertex_first,
+                                  d_vertex_partition_lasts,
+                                  false);
+
+        clique_op.nbr_vertices     = unique_nbrs.data();
+        clique_op.num_nbr_vertices = static_cast<vertex_t>(unique_nbrs.size());
+        clique_op.nbr_offsets      = nbr_offsets.data();
+        clique_op.nbr_indices      = nbr_indices.data();
+      } else {
+        clique_op.nbr_vertex_first = local_vertex_first;
+        clique_op.nbr_offsets      = offsets.data();
+        clique_op.nbr_indices      = minors.data();
+      }
+
+      rmm::device_uvector<edge_t> clique_offsets(major_edge_indices.size() + 1,
+                                                 handle.get_stream());
+      clique_offsets.set_element_to_zero_async(0, handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(edge_t{0}),
+                        thrust::make_counting_iterator(
+                          static_cast<edge_t>(major_edge_indices.size())),
+                        clique_offsets.begin() + 1,
+                        clique_op);
+      thrust::inclusive_scan(handle.get_thrust_policy(),
+                             clique_offsets.begin() + 1,
+                             clique_offsets.end(),
+                             clique_offsets.begin() + 1);
+      auto num_cliques = static_cast<size_t>(clique_offsets.back_element(handle.get_stream()));
+
+      rmm::device_uvector<vertex_t> keys(num_edges * 2 + major_edge_indices.size() + num_cliques,
+                                         handle.get_stream());
+      rmm::device_uvector<edge_t> increments(keys.size(), handle.get_stream());
+      clique_op.clique_offsets  = clique_offsets.data();
+      clique_op.clique_vertices = keys.data() + num_edges * 2 + major_edge_indices.size();
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(edge_t{0}),
+                       thrust::make_counting_iterator(
+                         static_cast<edge_t>(major_edge_indices.size())),
+                       clique_op);
+      thrust::fill(handle.get_thrust_policy(),
+                   increments.begin() + num_edges * 2 + major_edge_indices.size(),
+                   increments.end(),
+                   edge_t{1});
+      nbr_offsets.resize(0, handle.get_stream());
+      nbr_offsets.shrink_to_fit(handle.get_stream());
+      nbr_indices.resize(0, handle.get_stream());
+      nbr_indices.shrink_to_fit(handle.get_stream());
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(edge_t{0}),
+        thrust::make_counting_iterator(static_cast<edge_t>(num_edges)),
+        emit_four_clique_count_increments_t<vertex_t, edge_t>{intersect_op.majors,
+                                                              intersect_op.minors,
+                                                              intersect_op.edge_indices,
+                                                              common_nbr_offsets.data(),
+                                                              major_edge_indices.data(),
+                                                              clique_offsets.data(),
+                                                              static_cast<edge_t>(num_edges),
+                                                              keys.data(),
+                                                              increments.data()});
+      common_nbr_offsets.resize(0, handle.get_stream());
+      common_nbr_offsets.shrink_to_fit(handle.get_stream());
+      major_edge_indices.resize(0, handle.get_stream());
+      major_edge_indices.shrink_to_fit(handle.get_stream());
+      clique_offsets.resize(0, handle.get_stream());
+      clique_offsets.shrink_to_fit(handle.get_stream());
+
+      add_vertex_count_increments<vertex_t, edge_t, multi_gpu>(handle,
+                                                               std::move(keys),
+                                                               std::move(increments),
+                                                               four_clique_counts,
+                                                               local_vertex_first,
+                                                               d_vertex_partition_lasts);
+    });
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void count_four_cycles(raft::handle_t const& handle,
+                       rmm::device_uvector<vertex_t> const& majors,
+                       rmm::device_uvector<vertex_t> const& minors,
+                       rmm::device_uvector<edge_t> const& offsets,
+                       rmm::device_uvector<edge_t> const& degrees,
+                       vertex_t local_vertex_first,
+                       std::vector<vertex_t> const& vertex_partition_lasts,
+                       rmm::device_uvector<vertex_t> const& d_vertex_partition_lasts,
+                       edge_t* four_cycle_counts)
+{
+  // 1. collect the wedges u - x - w (x & w ranked lower than u) of the local vertices u, the wedges
+  // sharing the end points can be found in different batches
+
+  rmm::device_uvector<vertex_t> wedge_majors(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> wedge_opposites(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> wedge_midpoints(0, handle.get_stream());
+
+  detail::for_each_oriented_edge_batch<vertex_t, edge_t, multi_gpu>(
+    handle,
+    majors,
+    minors,
+    offsets,
+    local_vertex_first,
+    vertex_partition_lasts,
+    false,
+    [&handle,
+     &degrees,
+     &vertex_partition_lasts,
+     &wedge_majors,
+     &wedge_opposites,
+     &wedge_midpoints,
+     local_vertex_first](detail::intersect_nbr_lists_t<vertex_t, edge_t> intersect_op,
+                         size_t num_edges,
+                         edge_t const*) {
+      find_four_cycle_wedges_t<vertex_t, edge_t> wedge_op{};
+      wedge_op.majors           = intersect_op.majors;
+      wedge_op.minors           = intersect_op.minors;
+      wedge_op.major_first      = intersect_op.major_first;
+      wedge_op.major_degrees    = degrees.data();
+      wedge_op.edge_indices     = intersect_op.edge_indices;
+      wedge_op.nbr_vertices     = intersect_op.nbr_vertices;
+      wedge_op.num_nbr_vertices = intersect_op.num_nbr_vertices;
+      wedge_op.nbr_vertex_first = intersect_op.nbr_vertex_first;
+      wedge_op.nbr_offsets      = intersect_op.nbr_offsets;
+      wedge_op.nbr_indices      = intersect_op.nbr_indices;
+
+      // the degrees of the end points of the fetched neighbor lists (local in single-GPU)
+
+      rmm::device_uvector<vertex_t> unique_nbrs(0, handle.get_stream());
+      rmm::device_uvector<edge_t> nbr_degrees(0, handle.get_stream());
+      if constexpr (multi_gpu) {
+        edge_t num_nbrs{0};
+        raft::update_host(&num_nbrs,
+                          intersect_op.nbr_offsets + intersect_op.num_nbr_vertices,
+                          1,
+                          handle.get_stream());
+        handle.get_stream_view().synchronize();
+        unique_nbrs.resize(num_nbrs, handle.get_stream());
+        thrust::copy(handle.get_thrust_policy(),
+                     intersect_op.nbr_indices,
+                     intersect_op.nbr_indices + num_nbrs,
+                     unique_nbrs.begin());
+        thrust::sort(handle.get_thrust_policy(), unique_nbrs.begin(), unique_nbrs.end());
+        unique_nbrs.resize(
+          thrust::distance(
+            unique_nbrs.begin(),
+            thrust::unique(handle.get_thrust_policy(), unique_nbrs.begin(), unique_nbrs.end())),
+          handle.get_stream());
+
+        nbr_degrees = collect_values_for_sorted_unique_vertices(handle.get_comms(),
+                                                                unique_nbrs.data(),
+                                                                static_cast<vertex_t>(
+                                                                  unique_nbrs.size()),
+                                                                degrees.data(),
+                                                                vertex_partition_lasts,
+                                                                handle.get_stream_view());
+
+        wedge_op.degree_vertices     = unique_nbrs.data();
+        wedge_op.num_degree_vertices = static_cast<vertex_t>(unique_nbrs.size());
+        wedge_op.degrees             = nbr_degrees.data();
+      } else {
+        wedge_op.degree_vertex_first = local_vertex_first;
+        wedge_op.degrees             = degrees.data();
+      }
+
+      rmm::device_uvector<edge_t> wedge_offsets(num_edges + 1, handle.get_stream());
+      wedge_offsets.set_element_to_zero_async(0, handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(edge_t{0}),
+                        thrust::make_counting_iterator(static_cast<edge_t>(num_edges)),
+                        wedge_offsets.begin() + 1,
+                        wedge_op);
+      thrust::inclusive_scan(handle.get_thrust_policy(),
+                             wedge_offsets.begin() + 1,
+                             wedge_offsets.end(),
+                             wedge_offsets.begin() + 1);
+      auto num_wedges = static_cast<size_t>(wedge_offsets.back_element(handle.get_stream()));
+
+      auto old_size = wedge_majors.size();
+      wedge_majors.resize(old_size + num_wedges, handle.get_stream());
+      wedge_opposites.resize(wedge_majors.size(), handle.get_stream());
+      wedge_midpoints.resize(wedge_majors.size(), handle.get_stream());
+      wedge_op.wedge_offsets   = wedge_offsets.data();
+      wedge_op.wedge_majors    = wedge_majors.data() + old_size;
+      wedge_op.wedge_opposites = wedge_opposites.data() + old_size;
+      wedge_op.wedge_midpoints = wedge_midpoints.data() + old_size;
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(edge_t{0}),
+                       thrust::make_counting_iterator(static_cast<edge_t>(num_edges)),
+                       wedge_op);
+    });
+
+  // 2. group the wedges by the end points, every pair of the wedges sharing the end points forms a
+  // 4-cycle
+
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(wedge_majors.begin(), wedge_opposites.begin()));
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      pair_first,
+                      pair_first + wedge_majors.size(),
+                      wedge_midpoints.begin());
+
+  rmm::device_uvector<vertex_t> pair_majors(wedge_majors.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> pair_opposites(pair_majors.size(), handle.get_stream());
+  rmm::device_uvector<edge_t> pair_offsets(pair_majors.size() + 1, handle.get_stream());
+  auto unique_pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(pair_majors.begin(), pair_opposites.begin()));
+  auto num_pairs = static_cast<size_t>(thrust::distance(
+    unique_pair_first,
+    thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                         pair_first,
+                                         pair_first + wedge_majors.size(),
+                                         thrust::make_constant_iterator(edge_t{1}),
+                                         unique_pair_first,
+                                         pair_offsets.begin() + 1))));
+  wedge_majors.resize(0, handle.get_stream());
+  wedge_majors.shrink_to_fit(handle.get_stream());
+  wedge_opposites.resize(0, handle.get_stream());
+  wedge_opposites.shrink_to_fit(handle.get_stream());
+  pair_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::inclusive_scan(handle.get_thrust_policy(),
+                         pair_offsets.begin() + 1,
+                         pair_offsets.begin() + 1 + num_pairs,
+                         pair_offsets.begin() + 1);
+
+  rmm::device_uvector<vertex_t> keys(num_pairs * 2 + wedge_midpoints.size(), handle.get_stream());
+  rmm::device_uvector<edge_t> increments(keys.size(), handle.get_stream());
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(edge_t{0}),
+                   thrust::make_counting_iterator(static_cast<edge_t>(num_pairs)),
+                   emit_four_cycle_count_increments_t<vertex_t, edge_t>{pair_majors.data(),
+                                                                        pair_opposites.data(),
+                                                                        pair_offsets.data(),
+                                                                        wedge_midpoints.data(),
+                                                                        static_cast<edge_t>(
+                                                                          num_pairs),
+                                                                        keys.data(),
+                                                                        increments.data()});
+  pair_majors.resize(0, handle.get_stream());
+  pair_majors.shrink_to_fit(handle.get_stream());
+  pair_opposites.resize(0, handle.get_stream());
+  pair_opposites.shrink_to_fit(handle.get_stream());
+  pair_offsets.resize(0, handle.get_stream());
+  pair_offsets.shrink_to_fit(handle.get_stream());
+  wedge_midpoints.resize(0, handle.get_stream());
+  wedge_midpoints.shrink_to_fit(handle.get_stream());
+
+  add_vertex_count_increments<vertex_t, edge_t, multi_gpu>(handle,
+                                                           std::move(keys),
+                                                           std::move(increments),
+                                                           four_cycle_counts,
+                                                           local_vertex_first,
+                                                           d_vertex_partition_lasts);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void motif_count_impl(raft::handle_t const& handle,
+                      graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                      std::optional<edge_t*> wedge_counts,
+                      std::optional<edge_t*> four_cycle_counts,
+                      std::optional<edge_t*> four_clique_counts,
+                      bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: motif_count currently supports only undirected "
+                  "(symmetric) graphs.");
+  CUGRAPH_EXPECTS(!graph_view.is_multigraph(),
+                  "Invalid input argument: motif_count currently does not support multi-graphs.");
+  CUGRAPH_EXPECTS((graph_view.get_number_of_local_vertices() == 0) ||
+                    ((!wedge_counts || (*wedge_counts != nullptr)) &&
+                     (!four_cycle_counts || (*four_cycle_counts != nullptr)) &&
+                     (!four_clique_counts || (*four_clique_counts != nullptr))),
+                  "Invalid input argument: the requested output count arrays should not be "
+                  "nullptr.");
+
+  if (do_expensive_check) {
+    // nothing to do (self-loops are dropped in extracting the edges)
+  }
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  std::vector<vertex_t> vertex_partition_lasts{};
+  if constexpr (multi_gpu) { vertex_partition_lasts = graph_view.get_vertex_partition_lasts(); }
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                         handle.get_stream());
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      vertex_partition_lasts.data(),
+                      vertex_partition_lasts.size(),
+                      handle.get_stream());
+
+  // 2. wedges & 4-cycles (on the local edges without self-loops)
+
+  if (wedge_counts || four_cycle_counts) {
+    auto [majors, minors] = detail::extract_local_major_edgelist(handle, graph_view);
+    auto offsets          = detail::compute_sorted_edge_offsets<vertex_t, edge_t>(
+      handle, majors, local_vertex_first, num_local_vertices);
+    rmm::device_uvector<edge_t> degrees(num_local_vertices, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      offsets.begin() + 1,
+                      offsets.end(),
+                      offsets.begin(),
+                      degrees.begin(),
+                      thrust::minus<edge_t>());
+
+    if (wedge_counts) {
+      thrust::transform(handle.get_thrust_policy(),
+                        degrees.begin(),
+                        degrees.end(),
+                        *wedge_counts,
+                        wedge_count_t<edge_t>{});
+    }
+
+    if (four_cycle_counts) {
+      thrust::fill(handle.get_thrust_policy(),
+                   *four_cycle_counts,
+                   *four_cycle_counts + num_local_vertices,
+                   edge_t{0});
+      count_four_cycles<vertex_t, edge_t, multi_gpu>(handle,
+                                                     majors,
+                                                     minors,
+                                                     offsets,
+                                                     degrees,
+                                                     local_vertex_first,
+                                                     vertex_partition_lasts,
+                                                     d_vertex_partition_lasts,
+                                                     *four_cycle_counts);
+    }
+  }
+
+  // 3. 4-cliques (on the edges oriented by (degree, vertex ID))
+
+  if (four_clique_counts) {
+    thrust::fill(handle.get_thrust_policy(),
+                 *four_clique_counts,
+                 *four_clique_counts + num_local_vertices,
+                 edge_t{0});
+
+    auto [majors, minors] = detail::extract_low_to_high_degree_edges(handle, graph_view);
+    auto offsets          = detail::compute_sorted_edge_offsets<vertex_t, edge_t>(
+      handle, majors, local_vertex_first, num_local_vertices);
+
+    count_four_cliques<vertex_t, edge_t, multi_gpu>(handle,
+                                                    majors,
+                                                    minors,
+                                                    offsets,
+                                                    local_vertex_first,
+                                                    vertex_partition_lasts,
+                                                    d_vertex_partition_lasts,
+                                                    *four_clique_counts);
+  }
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void motif_count(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 std::optional<edge_t*> wedge_counts,
+                 std::optional<edge_t*> four_cycle_counts,
+                 std::optional<edge_t*> four_clique_counts,
+                 bool do_expensive_check)
+{
+  motif_count_impl(handle,
+                   graph_view,
+                   wedge_counts,
+                   four_cycle_counts,
+                   four_clique_counts,
+                   do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,1073 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
+#include <cublas_v2.h>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// Blocks of vectors (one entry per local vertex) are stored in column-major order with the leading
+// dimension max(# local vertices, 1) (cuBLAS requires a positive leading dimension).
+
+// the number of the vectors multiplied by the adjacency matrix in a single pass over the edges
+size_t constexpr spmv_block_width{4};
+
+template <typename weight_t>
+using spmv_block_value_t = thrust::tuple<weight_t, weight_t, weight_t, weight_t>;
+
+__host__ __device__ inline uint64_t splitmix64(uint64_t x)
+{
+  x += uint64_t{0x9e3779b97f4a7c15};
+  x = (x ^ (x >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  x = (x ^ (x >> 27)) * uint64_t{0x94d049bb133111eb};
+  return x ^ (x >> 31);
+}
+
+inline cublasStatus_t gemm(cublasHandle_t handle,
+                           cublasOperation_t transa,
+                           cublasOperation_t transb,
+                           int m,
+                           int n,
+                           int k,
+                           float const* alpha,
+                           float const* A,
+                           int lda,
+                           float const* B,
+                           int ldb,
+                           float const* beta,
+                           float* C,
+                           int ldc)
+{
+  return cublasSgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+inline cublasStatus_t gemm(cublasHandle_t handle,
+                           cublasOperation_t transa,
+                           cublasOperation_t transb,
+                           int m,
+                           int n,
+                           int k,
+                           double const* alpha,
+                           double const* A,
+                           int lda,
+                           double const* B,
+                           int ldb,
+                           double const* beta,
+                           double* C,
+                           int ldc)
+{
+  return cublasDgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// returns the (p x q, column-major) inner products of the columns of the (num_rows x p) block A and
+// the columns of the (num_rows x q) block B (summed over all the GPUs in multi-GPU)
+template <typename weight_t, bool multi_gpu>
+std::vector<double> compute_inner_products(raft::handle_t const& handle,
+                                           weight_t const* A,
+                                           weight_t const* B,
+                                           size_t num_rows,
+                                           size_t ld,
+                                           size_t p,
+                                           size_t q)
+{
+  rmm::device_uvector<weight_t> d_products(p * q, handle.get_stream());
+  weight_t one{1};
+  weight_t zero{0};
+  cublasSetStream(handle.get_cublas_handle(), handle.get_stream());
+  CUGRAPH_EXPECTS(gemm(handle.get_cublas_handle(),
+                       CUBLAS_OP_T,
+                       CUBLAS_OP_N,
+                       static_cast<int>(p),
+                       static_cast<int>(q),
+                       static_cast<int>(num_rows),
+                       &one,
+                       A,
+                       static_cast<int>(ld),
+                       B,
+                       static_cast<int>(ld),
+                       &zero,
+                       d_products.data(),
+                       static_cast<int>(p)) == CUBLAS_STATUS_SUCCESS,
+                  "cuBLAS gemm failed.");
+  if constexpr (multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     d_products.data(),
+                     d_products.data(),
+                     d_products.size(),
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+  std::vector<weight_t> h_products(d_products.size());
+  raft::update_host(h_products.data(), d_products.data(), d_products.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  return std::vector<double>(h_products.begin(), h_products.end());
+}
+
+// Y (num_rows x q) = A (num_rows x p) * C (p x q, column-major with the leading dimension ldc)
+template <typename weight_t>
+void multiply_by_coefficients(raft::handle_t const& handle,
+                              weight_t const* A,
+                              size_t num_rows,
+                              size_t ld,
+                              size_t p,
+                              weight_t const* C,
+                              size_t ldc,
+                              size_t q,
+                              weight_t* Y)
+{
+  weight_t one{1};
+  weight_t zero{0};
+  cublasSetStream(handle.get_cublas_handle(), handle.get_stream());
+  CUGRAPH_EXPECTS(gemm(handle.get_cublas_handle(),
+                       CUBLAS_OP_N,
+                       CUBLAS_OP_N,
+                       static_cast<int>(num_rows),
+                       static_cast<int>(q),
+                       static_cast<int>(p),
+                       &one,
+                       A,
+                       static_cast<int>(ld),
+                       C,
+                       static_cast<int>(ldc),
+                       &zero,
+                       Y,
+                       static_cast<int>(ld)) == CUBLAS_STATUS_SUCCESS,
+                  "cuBLAS gemm failed.");
+}
+
+// returns the eigenvalues (in descending order) and the eigenvectors (column-major) of the (n x n,
+// column-major) symmetric matrix a (cyclic Jacobi, the matrices here are a few hundred rows or
+// smaller)
+inline std::tuple<std::vector<double>, std::vector<double>> symmetric_eigen(std::vector<double> a,
+                                                                            size_t n)
+{
+  std::vector<double> v(n * n, 0.0);
+  for (size_t i = 0; i < n; ++i) {
+    v[i + i * n] = 1.0;
+  }
+
+  double norm{0.0};
+  for (size_t i = 0; i < n * n; ++i) {
+    norm += a[i] * a[i];
+  }
+  size_t constexpr max_sweeps{100};
+  for (size_t sweep = 0; sweep < max_sweeps; ++sweep) {
+    double off{0.0};
+    for (size_t p = 0; p < n; ++p) {
+      for (size_t q = p + 1; q < n; ++q) {
+        off += a[p + q * n] * a[p + q * n];
+      }
+    }
+    if (off <= norm * std::numeric_limits<double>::epsilon() *
+                  std::numeric_limits<double>::epsilon()) {
+      break;
+    }
+    for (size_t p = 0; p < n; ++p) {
+      for (size_t q = p + 1; q < n; ++q) {
+        auto apq = a[p + q * n];
+        if (apq == 0.0) { continue; }
+        auto theta = (a[q + q * n] - a[p + p * n]) / (2.0 * apq);
+        auto t =
+          (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+        auto c = 1.0 / std::sqrt(t * t + 1.0);
+        auto s = t * c;
+        for (size_t k = 0; k < n; ++k) {
+          auto akp         = a[k + p * n];
+          auto akq         = a[k + q * n];
+          a[k + p * n] = c * akp - s * akq;
+          a[k + q * n] = s * akp + c * akq;
+        }
+        for (size_t k = 0; k < n; ++k) {
+          auto apk     = a[p + k * n];
+          auto aqk     = a[q + k * n];
+          a[p + k * n] = c * apk - s * aqk;
+          a[q + k * n] = s * apk + c * aqk;
+        }
+        for (size_t k = 0; k < n; ++k) {
+          auto vkp     = v[k + p * n];
+          auto vkq     = v[k + q * n];
+          v[k + p * n] = c * vkp - s * vkq;
+          v[k + q * n] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+
+  std::vector<size_t> order(n);
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::sort(order.begin(), order.end(), [&a, n](auto lhs, auto rhs) {
+    return a[lhs + lhs * n] > a[rhs + rhs * n];
+  });
+  std::vector<double> eigenvalues(n);
+  std::vector<double> eigenvectors(n * n);
+  for (size_t i = 0; i < n; ++i) {
+    eigenvalues[i] = a[order[i] + order[i] * n];
+    std::copy(
+      v.begin() + order[i] * n, v.begin() + (order[i] + 1) * n, eigenvectors.begin() + i * n);
+  }
+
+  return std::make_tuple(std::move(eigenvalues), std::move(eigenvectors));
+}
+
+// Rayleigh-Ritz on the subspace spanned by the p columns of a block S given the Gram matrix G =
+// S^T S and H = S^T A S: the columns are scaled to the unit norm (so the residual & search
+// directions, which get small as the iteration converges, are not lost in the rounding errors) and
+// the (numerically) linearly dependent directions are dropped; returns the coefficients (p x b,
+// column-major) of the b Ritz vectors with the largest Ritz values and the Ritz values.
+inline std::tuple<std::vector<double>, std::vector<double>> rayleigh_ritz(
+  std::vector<double> G, std::vector<double> const& H, size_t p, size_t b, double drop_tolerance)
+{
+  std::vector<double> d(p);
+  for (size_t i = 0; i < p; ++i) {
+    d[i] = G[i + i * p] > 0.0 ? 1.0 / std::sqrt(G[i + i * p]) : 0.0;
+  }
+  for (size_t j = 0; j < p; ++j) {
+    for (size_t i = 0; i < p; ++i) {
+      G[i + j * p] *= d[i] * d[j];
+    }
+  }
+
+  auto [sigmas, V] = symmetric_eigen(std::move(G), p);
+  size_t r{0};
+  while ((r < p) && (sigmas[r] > sigmas[0] * drop_tolerance)) {
+    ++r;
+  }
+  CUGRAPH_EXPECTS(r >= b, "Rayleigh-Ritz failed, the search subspace is rank deficient.");
+
+  // T = diag(d) * V[:, 0:r] * diag(sigmas[0:r])^(-1/2), the columns of S * T are orthonormal
+
+  std::vector<double> T(p * r);
+  for (size_t j = 0; j < r; ++j) {
+    for (size_t i = 0; i < p; ++i) {
+      T[i + j * p] = d[i] * V[i + j * p] / std::sqrt(sigmas[j]);
+    }
+  }
+
+  std::vector<double> HT(p * r, 0.0);
+  for (size_t j = 0; j < r; ++j) {
+    for (size_t l = 0; l < p; ++l) {
+      for (size_t i = 0; i < p; ++i) {
+        HT[i + j * p] += H[i + l * p] * T[l + j * p];
+      }
+    }
+  }
+  std::vector<double> reduced_H(r * r, 0.0);
+  for (size_t j = 0; j < r; ++j) {
+    for (size_t i = 0; i < r; ++i) {
+      for (size_t l = 0; l < p; ++l) {
+        reduced_H[i + j * r] += T[l + i * p] * HT[l + j * p];
+      }
+    }
+  }
+  for (size_t j = 0; j < r; ++j) {
+    for (size_t i = j + 1; i < r; ++i) {
+      auto avg               = (reduced_H[i + j * r] + reduced_H[j + i * r]) * 0.5;
+      reduced_H[i + j * r] = avg;
+      reduced_H[j + i * r] = avg;
+    }
+  }
+
+  auto [thetas, W] = symmetric_eigen(std::move(reduced_H), r);
+
+  std::vector<double> C(p * b, 0.0);
+  for (size_t j = 0; j < b; ++j) {
+    for (size_t l = 0; l < r; ++l) {
+      for (size_t i = 0; i < p; ++i) {
+        C[i + j * p] += T[i + l * p] * W[l + j * r];
+      }
+    }
+  }
+  thetas.resize(b);
+
+  return std::make_tuple(std::move(C), std::move(thetas));
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct block_spmv_e_op_t {
+  template <typename RowValue>
+  __device__ spmv_block_value_t<weight_t> operator()(
+    vertex_t, vertex_t, weight_t w, RowValue, spmv_block_value_t<weight_t> x) const
+  {
+    return thrust::make_tuple(
+      w * thrust::get<0>(x), w * thrust::get<1>(x), w * thrust::get<2>(x), w * thrust::get<3>(x));
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct random_block_entry_t {
+  size_t ld{0};
+  size_t num_rows{0};
+  vertex_t vertex_first{0};
+  uint64_t seed{0};
+
+  __device__ weight_t operator()(size_t idx) const
+  {
+    auto i = idx % ld;
+    auto j = idx / ld;
+    if (i >= num_rows) { return weight_t{0}; }
+    auto h = splitmix64(splitmix64(static_cast<uint64_t>(vertex_first + i) ^ seed) + j);
+    return static_cast<weight_t>(static_cast<double>(h >> 11) * (1.0 / 9007199254740992.0) - 0.5);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename weight_t>
+struct residual_t {
+  weight_t const* AX{nullptr};
+  weight_t const* X{nullptr};
+  weight_t const* thetas{nullptr};
+  size_t ld{0};
+  weight_t* R{nullptr};
+
+  __device__ void operator()(size_t idx) const { R[idx] = AX[idx] - X[idx] * thetas[idx / ld]; }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename weight_t>
+struct inverse_sqrt_t {
+  __device__ weight_t operator()(weight_t d) const
+  {
+    return d > weight_t{0} ? weight_t{1} / sqrt(d) : weight_t{0};
+  }
+};
+
+// The operators (symmetric linear maps on the local vertex values) for the spectral embeddings.
+// Multiplication by the adjacency matrix A is a pass over the edges
+// (copy_v_transform_reduce_out_nbr, A is symmetric) multiplying spmv_block_width vectors at a time.
+template <typename GraphViewType>
+class spectral_operator_t {
+ public:
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  // normalized: D^(-1/2) A D^(-1/2), otherwise (modularity): A - d d^T / (2m) (d is the vector of
+  // the weighted degrees and 2m is the sum of the weighted degrees)
+  spectral_operator_t(raft::handle_t const& handle,
+                      GraphViewType const& graph_view,
+                      bool normalized)
+    : handle_(handle),
+      graph_view_(graph_view),
+      normalized_(normalized),
+      degrees_(graph_view.compute_out_weight_sums(handle)),
+      ld_(std::max(static_cast<size_t>(graph_view.get_number_of_local_vertices()), size_t{1})),
+      zeros_(ld_, handle.get_stream()),
+      scratch_(ld_, handle.get_stream()),
+      scaled_x_(0, handle.get_stream()),
+      dst_values_(handle, graph_view)
+  {
+    thrust::fill(handle.get_thrust_policy(), zeros_.begin(), zeros_.end(), weight_t{0});
+    if (normalized_) {
+      thrust::transform(handle.get_thrust_policy(),
+                        degrees_.begin(),
+                        degrees_.end(),
+                        degrees_.begin(),
+                        inverse_sqrt_t<weight_t>{});
+    } else {
+      two_m_ = static_cast<double>(
+        thrust::reduce(handle.get_thrust_policy(), degrees_.begin(), degrees_.end(), weight_t{0}));
+      if constexpr (GraphViewType::is_multi_gpu) {
+        two_m_ = host_scalar_allreduce(
+          handle.get_comms(), two_m_, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      CUGRAPH_EXPECTS(two_m_ > 0.0, "Invalid input argument: the graph has no edge weight.");
+    }
+  }
+
+  size_t ld() const { return ld_; }
+
+  // Y = op * X (X & Y are ld() x num_vectors blocks)
+  void apply(weight_t const* X, weight_t* Y, size_t num_vectors)
+  {
+    auto num_rows = static_cast<size_t>(graph_view_.get_number_of_local_vertices());
+
+    if (normalized_) {
+      scaled_x_.resize(ld_ * num_vectors, handle_.get_stream());
+      thrust::transform(handle_.get_thrust_policy(),
+                        thrust::make_counting_iterator(size_t{0}),
+                        thrust::make_counting_iterator(ld_ * num_vectors),
+                        scaled_x_.begin(),
+                        [X, s = degrees_.data(), ld = ld_, num_rows] __device__(auto idx) {
+                          auto i = idx % ld;
+                          return i < num_rows ? X[idx] * s[i] : weight_t{0};
+                        });
+      X = scaled_x_.data();
+    }
+
+    for (size_t j = 0; j < num_vectors; j += spmv_block_width) {
+      auto in_column = [this, X, j, num_vectors](size_t c) {
+        return (j + c < num_vectors) ? X + (j + c) * ld_ : zeros_.data();
+      };
+      auto out_column = [this, Y, j, num_vectors](size_t c) {
+        return (j + c < num_vectors) ? Y + (j + c) * ld_ : scratch_.data();
+      };
+      static_assert(spmv_block_width == 4);
+      auto in_first  = thrust::make_zip_iterator(thrust::make_tuple(
+        in_column(0), in_column(1), in_column(2), in_column(3)));
+      auto out_first = thrust::make_zip_iterator(thrust::make_tuple(
+        out_column(0), out_column(1), out_column(2), out_column(3)));
+
+      copy_to_adj_matrix_col(handle_, graph_view_, in_first, dst_values_);
+      copy_v_transform_reduce_out_nbr(
+        handle_,
+        graph_view_,
+        dummy_properties_t<weight_t>{}.device_view(),
+        dst_values_.device_view(),
+        block_spmv_e_op_t<vertex_t, weight_t>{},
+        thrust::make_tuple(weight_t{0}, weight_t{0}, weight_t{0}, weight_t{0}),
+        out_first);
+    }
+
+    if (normalized_) {
+      thrust::for_each(handle_.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(ld_ * num_vectors),
+                       [Y, s = degrees_.data(), ld = ld_, num_rows] __device__(auto idx) {
+                         auto i = idx % ld;
+                         if (i < num_rows) { Y[idx] *= s[i]; }
+                       });
+    } else {
+      auto dots = compute_inner_products<weight_t, GraphViewType::is_multi_gpu>(
+        handle_, degrees_.data(), X, num_rows, ld_, size_t{1}, num_vectors);
+      std::vector<weight_t> h_scales(num_vectors);
+      for (size_t j = 0; j < num_vectors; ++j) {
+        h_scales[j] = static_cast<weight_t>(dots[j] / two_m_);
+      }
+      rmm::device_uvector<weight_t> d_scales(num_vectors, handle_.get_stream());
+      raft::update_device(d_scales.data(), h_scales.data(), h_scales.size(), handle_.get_stream());
+      thrust::for_each(
+        handle_.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(ld_ * num_vectors),
+        [Y, d = degrees_.data(), scales = d_scales.data(), ld = ld_, num_rows] __device__(
+          auto idx) {
+          auto i = idx % ld;
+          if (i < num_rows) { Y[idx] -= d[i] * scales[idx / ld]; }
+        });
+    }
+  }
+
+ private:
+  raft::handle_t const& handle_;
+  GraphViewType const& graph_view_;
+  bool normalized_{true};
+  rmm::device_uvector<weight_t> degrees_;  // D^(-1/2) (normalized) or d (modularity)
+  double two_m_{0.0};
+  size_t ld_{1};
+  rmm::device_uvector<weight_t> zeros_;
+  rmm::device_uvector<weight_t> scratch_;
+  rmm::device_uvector<weight_t> scaled_x_;
+  col_properties_t<GraphViewType, spmv_block_value_t<weight_t>> dst_values_;
+};
+
+// LOBPCG (locally optimal block preconditioned conjugate gradient, without preconditioning) for the
+// block_size largest eigenpairs of a symmetric operator: every iteration multiplies the operator
+// with the block of the residual vectors (one operator application for block_size vectors) and
+// runs Rayleigh-Ritz on the span of the current eigenvector estimates, the residuals, and the
+// previous search directions. Iterates until the relative residual norms of the first num_wanted
+// eigenpairs fall below tolerance (or max_iterations); returns the eigenvector estimates (ld x
+// block_size, orthonormal) and the eigenvalue estimates (in descending order).
+template <typename vertex_t, typename weight_t, bool multi_gpu, typename OperatorT>
+std::tuple<rmm::device_uvector<weight_t>, std::vector<double>> lobpcg_largest(
+  raft::handle_t const& handle,
+  OperatorT& op,
+  size_t num_rows,
+  vertex_t vertex_first,
+  size_t block_size,
+  size_t num_wanted,
+  weight_t tolerance,
+  size_t max_iterations,
+  uint64_t seed)
+{
+  auto ld = op.ld();
+  auto b  = block_size;
+  auto drop_tolerance =
+    static_cast<double>(std::numeric_limits<weight_t>::epsilon()) * 3.0 * b * 10.0;
+
+  // S = [X, R, P], AS = op * S
+
+  rmm::device_uvector<weight_t> S(ld * b * 3, handle.get_stream());
+  rmm::device_uvector<weight_t> AS(ld * b * 3, handle.get_stream());
+  rmm::device_uvector<weight_t> new_X(ld * b, handle.get_stream());
+  rmm::device_uvector<weight_t> new_AX(ld * b, handle.get_stream());
+  rmm::device_uvector<weight_t> new_P(ld * b, handle.get_stream());
+  rmm::device_uvector<weight_t> new_AP(ld * b, handle.get_stream());
+  auto X  = S.data();
+  auto R  = S.data() + ld * b;
+  auto P  = S.data() + ld * b * 2;
+  auto AX = AS.data();
+  auto AR = AS.data() + ld * b;
+  auto AP = AS.data() + ld * b * 2;
+
+  rmm::device_uvector<weight_t> d_coefficients(b * b * 3, handle.get_stream());
+  rmm::device_uvector<weight_t> d_thetas(b, handle.get_stream());
+
+  // updates X, AX (and P, AP if update_p is true) from the Rayleigh-Ritz coefficients on the first
+  // p columns of S
+  auto update = [&](std::vector<double> const& C, size_t p, bool update_p) {
+    std::vector<weight_t> h_C(C.begin(), C.end());
+    raft::update_device(d_coefficients.data(), h_C.data(), h_C.size(), handle.get_stream());
+    multiply_by_coefficients(
+      handle, S.data(), num_rows, ld, p, d_coefficients.data(), p, b, new_X.data());
+    multiply_by_coefficients(
+      handle, AS.data(), num_rows, ld, p, d_coefficients.data(), p, b, new_AX.data());
+    if (update_p) {
+      multiply_by_coefficients(
+        handle, R, num_rows, ld, p - b, d_coefficients.data() + b, p, b, new_P.data());
+      multiply_by_coefficients(
+        handle, AR, num_rows, ld, p - b, d_coefficients.data() + b, p, b, new_AP.data());
+      thrust::copy(handle.get_thrust_policy(), new_P.begin(), new_P.end(), P);
+      thrust::copy(handle.get_thrust_policy(), new_AP.begin(), new_AP.end(), AP);
+    }
+    thrust::copy(handle.get_thrust_policy(), new_X.begin(), new_X.end(), X);
+    thrust::copy(handle.get_thrust_policy(), new_AX.begin(), new_AX.end(), AX);
+  };
+
+  // 1. start from a random block
+
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(ld * b),
+                    X,
+                    random_block_entry_t<vertex_t, weight_t>{ld, num_rows, vertex_first, seed});
+  op.apply(X, AX, b);
+
+  std::vector<double> thetas{};
+  {
+    auto G = compute_inner_products<weight_t, multi_gpu>(handle, X, X, num_rows, ld, b, b);
+    auto H = compute_inner_products<weight_t, multi_gpu>(handle, X, AX, num_rows, ld, b, b);
+    std::vector<double> C{};
+    std::tie(C, thetas) = rayleigh_ritz(std::move(G), H, b, b, drop_tolerance);
+    update(C, b, false);
+  }
+
+  // 2. iterate
+
+  bool has_p{false};
+  for (size_t iter = 0; iter < max_iterations; ++iter) {
+    std::vector<weight_t> h_thetas(thetas.begin(), thetas.end());
+    raft::update_device(d_thetas.data(), h_thetas.data(), h_thetas.size(), handle.get_stream());
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(ld * b),
+                     residual_t<weight_t>{AX, X, d_thetas.data(), ld, R});
+
+    auto p = has_p ? b * 3 : b * 2;
+    auto G = compute_inner_products<weight_t, multi_gpu>(
+      handle, S.data(), S.data(), num_rows, ld, p, p);
+
+    double scale{0.0};
+    for (size_t j = 0; j < b; ++j) {
+      scale = std::max(scale, std::abs(thetas[j]));
+    }
+    bool converged{true};
+    for (size_t j = 0; j < num_wanted; ++j) {
+      if (std::sqrt(G[(b + j) + (b + j) * p]) > tolerance * std::max(scale, 1e-30)) {
+        converged = false;
+        break;
+      }
+    }
+    if (converged) { break; }
+
+    op.apply(R, AR, b);
+    auto H = compute_inner_products<weight_t, multi_gpu>(
+      handle, S.data(), AS.data(), num_rows, ld, p, p);
+
+    std::vector<double> C{};
+    std::tie(C, thetas) = rayleigh_ritz(std::move(G), H, p, b, drop_tolerance);
+    update(C, p, true);
+    has_p = true;
+  }
+
+  rmm::device_uvector<weight_t> eigenvectors(ld * b, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), X, X + ld * b, eigenvectors.begin());
+
+  return std::make_tuple(std::move(eigenvectors), std::move(thetas));
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct nearest_centroid_t {
+  weight_t const* points{nullptr};
+  size_t ld{0};
+  size_t dim{0};
+  weight_t const* centroids{nullptr};  // row-major
+  size_t num_centroids{0};
+
+  __device__ thrust::tuple<vertex_t, weight_t> operator()(size_t i) const
+  {
+    vertex_t best{0};
+    auto best_dist = std::numeric_limits<weight_t>::max();
+    for (size_t c = 0; c < num_centroids; ++c) {
+      weight_t dist{0};
+      for (size_t j = 0; j < dim; ++j) {
+        auto diff = points[j * ld + i] - centroids[c * dim + j];
+        dist += diff * diff;
+      }
+      if (dist < best_dist) {
+        best      = static_cast<vertex_t>(c);
+        best_dist = dist;
+      }
+    }
+    return thrust::make_tuple(best, best_dist);
+  }
+};
+
+// returns the global ID of the local vertex with the largest score (ties are broken by the vertex
+// ID) over all the GPUs
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+vertex_t select_max_score_vertex(raft::handle_t const& handle,
+                                 weight_t const* scores,
+                                 size_t num_rows,
+                                 vertex_t vertex_first)
+{
+  auto max_score = thrust::reduce(handle.get_thrust_policy(),
+                                  scores,
+                                  scores + num_rows,
+                                  std::numeric_limits<weight_t>::lowest(),
+                                  thrust::maximum<weight_t>());
+  if constexpr (multi_gpu) {
+    max_score = host_scalar_allreduce(
+      handle.get_comms(), max_score, raft::comms::op_t::MAX, handle.get_stream());
+  }
+  auto v = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_rows),
+    [scores, max_score, vertex_first] __device__(auto i) {
+      return scores[i] == max_score ? vertex_first + static_cast<vertex_t>(i)
+                                    : std::numeric_limits<vertex_t>::max();
+    },
+    std::numeric_limits<vertex_t>::max(),
+    thrust::minimum<vertex_t>());
+  if constexpr (multi_gpu) {
+    v = host_scalar_allreduce(handle.get_comms(), v, raft::comms::op_t::MIN, handle.get_stream());
+  }
+  return v;
+}
+
+// returns the coordinates of the point of the vertex v (which can be owned by another GPU)
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> get_point(raft::handle_t const& handle,
+                                        weight_t const* points,
+                                        size_t num_rows,
+                                        size_t ld,
+                                        size_t dim,
+                                        vertex_t vertex_first,
+                                        vertex_t v)
+{
+  rmm::device_uvector<weight_t> point(dim, handle.get_stream());
+  auto is_local = (v >= vertex_first) && (v < vertex_first + static_cast<vertex_t>(num_rows));
+  auto i        = is_local ? static_cast<size_t>(v - vertex_first) : size_t{0};
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(dim),
+                    point.begin(),
+                    [points, ld, i, is_local] __device__(auto j) {
+                      return is_local ? points[j * ld + i] : weight_t{0};
+                    });
+  if constexpr (multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     point.data(),
+                     point.data(),
+                     point.size(),
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+  return point;
+}
+
+// k-means (Lloyd's algorithm) on the num_rows x dim (column-major) points, the initial centroids
+// are selected by farthest-first traversal starting from a pseudo-randomly chosen point
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+void kmeans(raft::handle_t const& handle,
+            weight_t const* points,
+            size_t num_rows,
+            size_t ld,
+            size_t dim,
+            vertex_t vertex_first,
+            size_t num_clusters,
+            weight_t tolerance,
+            size_t max_iterations,
+            uint64_t seed,
+            vertex_t* clustering)
+{
+  rmm::device_uvector<weight_t> centroids(num_clusters * dim, handle.get_stream());
+
+  // 1. initialize the centroids
+
+  rmm::device_uvector<weight_t> scores(num_rows, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(num_rows),
+                    scores.begin(),
+                    [vertex_first, seed] __device__(auto i) {
+                      auto h = splitmix64(static_cast<uint64_t>(vertex_first + i) ^ seed);
+                      return static_cast<weight_t>(static_cast<double>(h >> 11) *
+                                                   (1.0 / 9007199254740992.0));
+                    });
+  for (size_t c = 0; c < num_clusters; ++c) {
+    auto v = select_max_score_vertex<vertex_t, weight_t, multi_gpu>(
+      handle, scores.data(), num_rows, vertex_first);
+    auto point = get_point<vertex_t, weight_t, multi_gpu>(
+      handle, points, num_rows, ld, dim, vertex_first, v);
+    thrust::copy(
+      handle.get_thrust_policy(), point.begin(), point.end(), centroids.begin() + c * dim);
+    if (c == 0) {  // from now on, scores are the squared distances to the nearest centroid
+      thrust::fill(handle.get_thrust_policy(),
+                   scores.begin(),
+                   scores.end(),
+                   std::numeric_limits<weight_t>::max());
+    }
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_rows),
+                     [points, ld, dim, centroid = point.data(), scores = scores.data()] __device__(
+                       auto i) {
+                       weight_t dist{0};
+                       for (size_t j = 0; j < dim; ++j) {
+                         auto diff = points[j * ld + i] - centroid[j];
+                         dist += diff * diff;
+                       }
+                       scores[i] = dist < scores[i] ? dist : scores[i];
+                     });
+  }
+
+  // 2. iterate
+
+  rmm::device_uvector<vertex_t> sorted_clusters(num_rows, handle.get_stream());
+  rmm::device_uvector<size_t> permutation(num_rows, handle.get_stream());
+  rmm::device_uvector<vertex_t> unique_clusters(num_clusters, handle.get_stream());
+  rmm::device_uvector<weight_t> reduced_values(num_clusters, handle.get_stream());
+  rmm::device_uvector<weight_t> sums(num_clusters * (dim + 1), handle.get_stream());
+  std::vector<weight_t> h_sums(sums.size());
+  std::vector<weight_t> h_centroids(centroids.size());
+
+  auto prev_cost = std::numeric_limits<double>::max();
+  for (size_t iter = 0; iter < max_iterations; ++iter) {
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_rows),
+      thrust::make_zip_iterator(thrust::make_tuple(clustering, scores.begin())),
+      nearest_centroid_t<vertex_t, weight_t>{points, ld, dim, centroids.data(), num_clusters});
+
+    auto cost = static_cast<double>(
+      thrust::reduce(handle.get_thrust_policy(), scores.begin(), scores.end(), weight_t{0}));
+    if constexpr (multi_gpu) {
+      cost = host_scalar_allreduce(
+        handle.get_comms(), cost, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (prev_cost - cost <= static_cast<double>(tolerance) * cost) { break; }
+    prev_cost = cost;
+
+    // sums (the first dim columns, one row per cluster) and counts (the last column) of the points
+    // in every cluster
+
+    thrust::copy(
+      handle.get_thrust_policy(), clustering, clustering + num_rows, sorted_clusters.begin());
+    thrust::sequence(handle.get_thrust_policy(), permutation.begin(), permutation.end(), size_t{0});
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        sorted_clusters.begin(),
+                        sorted_clusters.end(),
+                        permutation.begin());
+    thrust::fill(handle.get_thrust_policy(), sums.begin(), sums.end(), weight_t{0});
+    for (size_t j = 0; j <= dim; ++j) {
+      size_t num_unique_clusters{0};
+      if (j < dim) {
+        num_unique_clusters = static_cast<size_t>(thrust::distance(
+          unique_clusters.begin(),
+          thrust::reduce_by_key(handle.get_thrust_policy(),
+                                sorted_clusters.begin(),
+                                sorted_clusters.end(),
+                                thrust::make_permutation_iterator(points + j * ld,
+                                                                  permutation.begin()),
+                                unique_clusters.begin(),
+                                reduced_values.begin())
+            .first));
+      } else {
+        num_unique_clusters = static_cast<size_t>(thrust::distance(
+          unique_clusters.begin(),
+          thrust::reduce_by_key(handle.get_thrust_policy(),
+                                sorted_clusters.begin(),
+                                sorted_clusters.end(),
+                                thrust::make_constant_iterator(weight_t{1}),
+                                unique_clusters.begin(),
+                                reduced_values.begin())
+            .first));
+      }
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(num_unique_clusters),
+                       [unique_clusters = unique_clusters.data(),
+                        reduced_values  = reduced_values.data(),
+                        sums            = sums.data(),
+                        dim,
+                        j] __device__(auto i) {
+                         sums[unique_clusters[i] * (dim + 1) + j] = reduced_values[i];
+                       });
+    }
+    if constexpr (multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       sums.data(),
+                       sums.data(),
+                       sums.size(),
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+    }
+
+    // empty clusters keep their centroids
+
+    raft::update_host(h_sums.data(), sums.data(), sums.size(), handle.get_stream());
+    raft::update_host(h_centroids.data(), centroids.data(), centroids.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+    for (size_t c = 0; c < num_clusters; ++c) {
+      auto count = h_sums[c * (dim + 1) + dim];
+      if (count > weight_t{0}) {
+        for (size_t j = 0; j < dim; ++j) {
+          h_centroids[c * dim + j] = h_sums[c * (dim + 1) + j] / count;
+        }
+      }
+    }
+    raft::update_device(
+      centroids.data(), h_centroids.data(), h_centroids.size(), handle.get_stream());
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void spectral_clustering_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  bool normalized_cut,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  weight_t evs_tolerance,
+  size_t evs_max_iterations,
+  weight_t kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  vertex_t* clustering,
+  weight_t* eigenvalues,
+  weight_t* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>;
+
+  auto num_vertices = static_cast<size_t>(graph_view.get_number_of_vertices());
+  auto num_rows     = static_cast<size_t>(graph_view.get_number_of_local_vertices());
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: spectral clustering currently supports only "
+                  "undirected (symmetric) graphs.");
+  CUGRAPH_EXPECTS((num_clusters > 0) && (num_clusters <= num_vertices),
+                  "Invalid input argument: num_clusters should be in [1, # vertices].");
+  CUGRAPH_EXPECTS((num_eigenvectors > 0) && (num_eigenvectors <= num_vertices),
+                  "Invalid input argument: num_eigenvectors should be in [1, # vertices].");
+  CUGRAPH_EXPECTS(evs_tolerance > weight_t{0},
+                  "Invalid input argument: evs_tolerance should be positive.");
+  CUGRAPH_EXPECTS(kmeans_tolerance >= weight_t{0},
+                  "Invalid input argument: kmeans_tolerance should be non-negative.");
+  CUGRAPH_EXPECTS((num_rows == 0) || (clustering != nullptr),
+                  "Invalid input argument: clustering cannot be null.");
+  CUGRAPH_EXPECTS(num_rows <= static_cast<size_t>(std::numeric_limits<int>::max()),
+                  "Invalid input argument: the number of local vertices exceeds the cuBLAS limit.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  auto vertex_first = graph_view.get_local_vertex_first();
+
+  // 2. compute the eigenvectors (the block holds spmv_block_width-aligned extra vectors, as long as
+  // there are enough vertices, to accelerate the convergence of the wanted eigenvectors)
+
+  auto block_size = std::min(
+    ((num_eigenvectors + spmv_block_width - 1) / spmv_block_width) * spmv_block_width,
+    num_vertices);
+
+  spectral_operator_t<graph_view_type> op(handle, graph_view, normalized_cut);
+  auto [X, thetas] = lobpcg_largest<vertex_t, weight_t, multi_gpu>(handle,
+                                                                   op,
+                                                                   num_rows,
+                                                                   vertex_first,
+                                                                   block_size,
+                                                                   num_eigenvectors,
+                                                                   evs_tolerance,
+                                                                   evs_max_iterations,
+                                                                   seed);
+  auto ld = op.ld();
+
+  if (eigenvalues != nullptr) {
+    // the eigenvalues of the normalized Laplacian I - D^(-1/2) A D^(-1/2) (in ascending order) or
+    // the modularity matrix (in descending order)
+    std::vector<weight_t> h_eigenvalues(num_eigenvectors);
+    for (size_t j = 0; j < num_eigenvectors; ++j) {
+      h_eigenvalues[j] = static_cast<weight_t>(normalized_cut ? 1.0 - thetas[j] : thetas[j]);
+    }
+    raft::update_device(
+      eigenvalues, h_eigenvalues.data(), h_eigenvalues.size(), handle.get_stream());
+  }
+  if ((eigenvectors != nullptr) && (num_rows > 0)) {
+    for (size_t j = 0; j < num_eigenvectors; ++j) {
+      thrust::copy(handle.get_thrust_policy(),
+                   X.begin() + j * ld,
+                   X.begin() + j * ld + num_rows,
+                   eigenvectors + j * num_rows);
+    }
+  }
+
+  // 3. cluster the vertices in the spectral embedding (the rows of the first num_eigenvectors
+  // eigenvectors, normalized to the unit length in the normalized cut case)
+
+  if (normalized_cut) {
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_rows),
+                     [embedding = X.data(), ld, num_eigenvectors] __device__(auto i) {
+                       weight_t norm{0};
+                       for (size_t j = 0; j < num_eigenvectors; ++j) {
+                         norm += embedding[j * ld + i] * embedding[j * ld + i];
+                       }
+                       norm = sqrt(norm);
+                       if (norm > weight_t{0}) {
+                         for (size_t j = 0; j < num_eigenvectors; ++j) {
+                           embedding[j * ld + i] /= norm;
+                         }
+                       }
+                     });
+  }
+
+  kmeans<vertex_t, weight_t, multi_gpu>(handle,
+                                        X.data(),
+                                        num_rows,
+                                        ld,
+                                        num_eigenvectors,
+                                        vertex_first,
+                                        num_clusters,
+                                        kmeans_tolerance,
+                                        kmeans_max_iterations,
+                                        seed,
+                                        clustering);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void spectral_balanced_cut_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  weight_t evs_tolerance,
+  size_t evs_max_iterations,
+  weight_t kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  vertex_t* clustering,
+  weight_t* eigenvalues,
+  weight_t* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  detail::spectral_clustering_impl(handle,
+                                   graph_view,
+                                   true,
+                                   num_clusters,
+                                   num_eigenvectors,
+                                   evs_tolerance,
+                                   evs_max_iterations,
+                                   kmeans_tolerance,
+                                   kmeans_max_iterations,
+                                   clustering,
+                                   eigenvalues,
+                                   eigenvectors,
+                                   seed,
+                                   do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void spectral_modularity_maximization(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  weight_t evs_tolerance,
+  size_t evs_max_iterations,
+  weight_t kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  vertex_t* clustering,
+  weight_t* eigenvalues,
+  weight_t* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  detail::spectral_clustering_impl(handle,
+                                   graph_view,
+                                   false,
+                                   num_clusters,
+                                   num_eigenvectors,
+                                   evs_tolerance,
+                                   evs_max_iterations,
+                                   kmeans_tolerance,
+                                   kmeans_max_iterations,
+                                   clustering,
+                                   eigenvalues,
+                                   eigenvectors,
+                                   seed,
+                                   do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <community/spectral_clustering_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void spectral_balanced_cut_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  float evs_tolerance,
+  size_t evs_max_iterations,
+  float kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int32_t* clustering,
+  float* eigenvalues,
+  float* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void spectral_balanced_cut_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  double evs_tolerance,
+  size_t evs_max_iterations,
+  double kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int32_t* clustering,
+  double* eigenvalues,
+  double* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void spectral_balanced_cut_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  float evs_tolerance,
+  size_t evs_max_iterations,
+  float kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int32_t* clustering,
+  float* eigenvalues,
+  float* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void spectral_balanced_cut_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  double evs_tolerance,
+  size_t evs_max_iterations,
+  double kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int32_t* clustering,
+  double* eigenvalues,
+  double* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void spectral_balanced_cut_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  float evs_tolerance,
+  size_t evs_max_iterations,
+  float kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int64_t* clustering,
+  float* eigenvalues,
+  float* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void spectral_balanced_cut_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  double evs_tolerance,
+  size_t evs_max_iterations,
+  double kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int64_t* clustering,
+  double* eigenvalues,
+  double* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void spectral_modularity_maximization(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  float evs_tolerance,
+  size_t evs_max_iterations,
+  float kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int32_t* clustering,
+  float* eigenvalues,
+  float* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void spectral_modularity_maximization(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  double evs_tolerance,
+  size_t evs_max_iterations,
+  double kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int32_t* clustering,
+  double* eigenvalues,
+  double* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void spectral_modularity_maximization(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  float evs_tolerance,
+  size_t evs_max_iterations,
+  float kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int32_t* clustering,
+  float* eigenvalues,
+  float* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void spectral_modularity_maximization(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  double evs_tolerance,
+  size_t evs_max_iterations,
+  double kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int32_t* clustering,
+  double* eigenvalues,
+  double* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void spectral_modularity_maximization(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  float evs_tolerance,
+  size_t evs_max_iterations,
+  float kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int64_t* clustering,
+  float* eigenvalues,
+  float* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void spectral_modularity_maximization(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  double evs_tolerance,
+  size_t evs_max_iterations,
+  double kmeans_tolerance,
+  size_t kmeans_max_iterations,
+  int64_t* clustering,
+  double* eigenvalues,
+  double* eigenvectors,
+  uint64_t seed,
+  bool do_expensive_check);
+#endif
+
+}  // namespace cugraph
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/edge_triangle_support.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// every triangle (u, v, w) is found once (from the oriented edge (u, v), w is a common neighbor of
+// u & v), and the edge (u, v) adds its number of common neighbors to u & v and every common
+// neighbor w gets 1
+template <typename vertex_t, typename edge_t>
+struct emit_triangle_count_increments_t {
+  vertex_t const* majors{nullptr};
+  vertex_t const* minors{nullptr};
+  edge_t const* edge_indices{nullptr};  // if nullptr, the i'th edge is the i'th edge of the batch
+  edge_t const* common_nbr_offsets{nullptr};
+  vertex_t* keys{nullptr};
+  edge_t* increments{nullptr};
+
+  __device__ void operator()(edge_t i) const
+  {
+    auto e                = edge_indices != nullptr ? edge_indices[i] : i;
+    auto count            = common_nbr_offsets[i + 1] - common_nbr_offsets[i];
+    keys[2 * i]           = majors[e];
+    keys[2 * i + 1]       = minors[e];
+    increments[2 * i]     = count;
+    increments[2 * i + 1] = count;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct edge_index_to_minor_t {
+  vertex_t const* minors{nullptr};
+
+  __device__ vertex_t operator()(edge_t e) const { return minors[e]; }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void triangle_count_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  edge_t* triangle_counts,
+  bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: triangle_count currently supports only undirected "
+                  "(symmetric) graphs.");
+  CUGRAPH_EXPECTS(
+    !graph_view.is_multigraph(),
+    "Invalid input argument: triangle_count currently does not support multi-graphs.");
+  CUGRAPH_EXPECTS((graph_view.get_number_of_local_vertices() == 0) || (triangle_counts != nullptr),
+                  "Invalid input argument: triangle_counts should not be nullptr.");
+
+  if (do_expensive_check) {
+    // nothing to do (self-loops are dropped in orienting the edges)
+  }
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  thrust::fill(handle.get_thrust_policy(),
+               triangle_counts,
+               triangle_counts + num_local_vertices,
+               edge_t{0});
+
+  // 2. orient the edges by (degree, vertex ID)
+
+  auto [majors, minors] = detail::extract_low_to_high_degree_edges(handle, graph_view);
+  auto offsets = detail::compute_sorted_edge_offsets<vertex_t, edge_t>(
+    handle, majors, local_vertex_first, num_local_vertices);
+
+  std::vector<vertex_t> vertex_partition_lasts{};
+  if constexpr (multi_gpu) { vertex_partition_lasts = graph_view.get_vertex_partition_lasts(); }
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                         handle.get_stream());
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      vertex_partition_lasts.data(),
+                      vertex_partition_lasts.size(),
+                      handle.get_stream());
+
+  // 3. intersect the neighbor lists of the end points of every oriented edge and accumulate the
+  // per-vertex counts (the contributions to the remote vertices are aggregated and sent to the
+  // owners in multi-GPU)
+
+  detail::for_each_oriented_edge_batch<vertex_t, edge_t, multi_gpu>(
+    handle,
+    majors,
+    minors,
+    offsets,
+    local_vertex_first,
+    vertex_partition_lasts,
+    false,
+    [&handle, &d_vertex_partition_lasts, triangle_counts, local_vertex_first](
+      detail::intersect_nbr_lists_t<vertex_t, edge_t> intersect_op,
+      size_t num_edges,
+      edge_t const*) {
+      auto [common_nbr_offsets, major_edge_indices, minor_edge_indices] =
+        detail::find_common_nbrs(handle, intersect_op, num_edges, false);
+
+      rmm::device_uvector<vertex_t> keys(num_edges * 2 + major_edge_indices.size(),
+                                         handle.get_stream());
+      rmm::device_uvector<edge_t> increments(keys.size(), handle.get_stream());
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(edge_t{0}),
+                       thrust::make_counting_iterator(static_cast<edge_t>(num_edges)),
+                       emit_triangle_count_increments_t<vertex_t, edge_t>{intersect_op.majors,
+                                                                         intersect_op.minors,
+                                                                         intersect_op.edge_indices,
+                                                                         common_nbr_offsets.data(),
+                                                                         keys.data(),
+                                                                         increments.data()});
+      thrust::transform(handle.get_thrust_policy(),
+                        major_edge_indices.begin(),
+                        major_edge_indices.end(),
+                        keys.begin() + num_edges * 2,
+                        edge_index_to_minor_t<vertex_t, edge_t>{intersect_op.minors});
+      thrust::fill(handle.get_thrust_policy(),
+                   increments.begin() + num_edges * 2,
+                   increments.end(),
+                   edge_t{1});
+      common_nbr_offsets.resize(0, handle.get_stream());
+      common_nbr_offsets.shrink_to_fit(handle.get_stream());
+      major_edge_indices.resize(0, handle.get_stream());
+      major_edge_indices.shrink_to_fit(handle.get_stream());
+
+      detail::reduce_by_sorted_key(handle, keys, increments);
+
+      if constexpr (multi_gpu) {
+        auto& comm = handle.get_comms();
+
+        auto pair_first =
+          thrust::make_zip_iterator(thrust::make_tuple(keys.begin(), increments.begin()));
+        std::forward_as_tuple(std::tie(keys, increments), std::ignore) =
+          groupby_gpuid_and_shuffle_values(
+            comm,
+            pair_first,
+            pair_first + keys.size(),
+            detail::renumbered_vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(),
+                                                            comm.get_size()},
+            handle.get_stream());
+
+        detail::reduce_by_sorted_key(handle, keys, increments);
+      }
+
+      // keys are unique, so no atomics are necessary
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(keys.size()),
+                       detail::add_reduced_values_t<vertex_t, edge_t>{
+                         keys.data(), increments.data(), triangle_counts, local_vertex_first});
+    });
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void triangle_count(raft::handle_t const& handle,
+                    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                    edge_t* triangle_counts,
+                    bool do_expensive_check)
+{
+  triangle_count_impl(handle, graph_view, triangle_counts, do_expensive_check);
+}
+
+}  // namespace cugraph
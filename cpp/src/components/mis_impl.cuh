@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <cuco/detail/hash_functions.cuh>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+
+#include <cstdint>
+
+namespace cugraph {
+
+namespace detail {
+
+// vertices are ordered by (hashed vertex ID, vertex ID), this is a strict total order and the
+// hashing removes the correlation between the vertex IDs and the priorities
+template <typename vertex_t>
+struct vertex_priority_t {
+  uint32_t seed{0};
+
+  __device__ bool operator()(vertex_t lhs, vertex_t rhs) const  // true if lhs > rhs
+  {
+    cuco::detail::MurmurHash3_32<vertex_t> hash_func{seed};
+    auto lhs_hash = hash_func(lhs);
+    auto rhs_hash = hash_func(rhs);
+    return (lhs_hash != rhs_hash) ? (lhs_hash > rhs_hash) : (lhs > rhs);
+  }
+};
+
+enum class mis_state_t : uint8_t { removed = 0, candidate, selected };
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct count_higher_priority_candidate_nbrs_e_op_t {
+  vertex_priority_t<vertex_t> is_higher_priority{};
+
+  template <typename RowValue>
+  __device__ int32_t operator()(vertex_t src, vertex_t dst, RowValue, uint8_t dst_state) const
+  {
+    return ((src != dst) && (dst_state == static_cast<uint8_t>(mis_state_t::candidate)) &&
+            is_higher_priority(dst, src))
+             ? int32_t{1}
+             : int32_t{0};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct count_selected_nbrs_e_op_t {
+  template <typename RowValue>
+  __device__ int32_t operator()(vertex_t src, vertex_t dst, RowValue, uint8_t dst_state) const
+  {
+    return ((src != dst) && (dst_state == static_cast<uint8_t>(mis_state_t::selected)))
+             ? int32_t{1}
+             : int32_t{0};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct select_candidate_t {
+  uint8_t* states{nullptr};
+  int32_t const* nbr_counts{nullptr};
+  vertex_t local_vertex_first{};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto offset = v - local_vertex_first;
+    if (nbr_counts[offset] == 0) { states[offset] = static_cast<uint8_t>(mis_state_t::selected); }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct remove_candidate_t {
+  uint8_t* states{nullptr};
+  int32_t const* nbr_counts{nullptr};
+  vertex_t local_vertex_first{};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto offset = v - local_vertex_first;
+    if ((states[offset] == static_cast<uint8_t>(mis_state_t::candidate)) &&
+        (nbr_counts[offset] > 0)) {
+      states[offset] = static_cast<uint8_t>(mis_state_t::removed);
+    }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_not_candidate_t {
+  uint8_t const* states{nullptr};
+  vertex_t local_vertex_first{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return states[v - local_vertex_first] != static_cast<uint8_t>(mis_state_t::candidate);
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> maximal_independent_set_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>;
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: maximal_independent_set currently supports only "
+                  "undirected (symmetric) graphs.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  // 2. Luby's algorithm: in every round, the candidates with no higher priority candidate neighbor
+  // are selected, and the selected vertices and their neighbors stop being candidates
+
+  auto is_higher_priority =
+    vertex_priority_t<vertex_t>{static_cast<uint32_t>(seed ^ (seed >> 32))};
+
+  rmm::device_uvector<uint8_t> states(num_local_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               states.begin(),
+               states.end(),
+               static_cast<uint8_t>(mis_state_t::candidate));
+  rmm::device_uvector<vertex_t> candidates(num_local_vertices, handle.get_stream());
+  thrust::sequence(
+    handle.get_thrust_policy(), candidates.begin(), candidates.end(), local_vertex_first);
+  rmm::device_uvector<int32_t> nbr_counts(num_local_vertices, handle.get_stream());
+
+  col_properties_t<graph_view_type, uint8_t> col_states{};
+  if constexpr (multi_gpu) {
+    col_states = col_properties_t<graph_view_type, uint8_t>(handle, graph_view);
+  }
+  auto col_state_input =
+    multi_gpu ? col_states.device_view()
+              : detail::minor_properties_device_view_t<vertex_t, uint8_t const*>(states.data());
+
+  while (true) {
+    auto num_candidates = candidates.size();
+    if constexpr (multi_gpu) {
+      num_candidates = host_scalar_allreduce(
+        handle.get_comms(), num_candidates, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_candidates == 0) { break; }
+
+    profiler_add_counter("iterations", 1);
+
+    if constexpr (multi_gpu) {
+      copy_to_adj_matrix_col(handle, graph_view, states.data(), col_states);
+    }
+    copy_v_transform_reduce_out_nbr(handle,
+                                    graph_view,
+                                    candidates.begin(),
+                                    candidates.end(),
+                                    dummy_properties_t<vertex_t>{}.device_view(),
+                                    col_state_input,
+                                    count_higher_priority_candidate_nbrs_e_op_t<vertex_t>{
+                                      is_higher_priority},
+                                    int32_t{0},
+                                    nbr_counts.begin());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      candidates.begin(),
+      candidates.end(),
+      select_candidate_t<vertex_t>{states.data(), nbr_counts.data(), local_vertex_first});
+
+    if constexpr (multi_gpu) {
+      copy_to_adj_matrix_col(handle, graph_view, states.data(), col_states);
+    }
+    copy_v_transform_reduce_out_nbr(handle,
+                                    graph_view,
+                                    candidates.begin(),
+                                    candidates.end(),
+                                    dummy_properties_t<vertex_t>{}.device_view(),
+                                    col_state_input,
+                                    count_selected_nbrs_e_op_t<vertex_t>{},
+                                    int32_t{0},
+                                    nbr_counts.begin());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      candidates.begin(),
+      candidates.end(),
+      remove_candidate_t<vertex_t>{states.data(), nbr_counts.data(), local_vertex_first});
+    candidates.resize(
+      thrust::distance(candidates.begin(),
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         candidates.begin(),
+                                         candidates.end(),
+                                         is_not_candidate_t<vertex_t>{states.data(),
+                                                                      local_vertex_first})),
+      handle.get_stream());
+  }
+
+  // 3. return the selected vertices
+
+  rmm::device_uvector<vertex_t> mis_vertices(num_local_vertices, handle.get_stream());
+  mis_vertices.resize(
+    thrust::distance(mis_vertices.begin(),
+                     thrust::copy_if(handle.get_thrust_policy(),
+                                     thrust::make_counting_iterator(local_vertex_first),
+                                     thrust::make_counting_iterator(local_vertex_first +
+                                                                    num_local_vertices),
+                                     states.begin(),
+                                     mis_vertices.begin(),
+                                     [] __device__(auto state) {
+                                       return state ==
+                                              static_cast<uint8_t>(mis_state_t::selected);
+                                     })),
+    handle.get_stream());
+  mis_vertices.shrink_to_fit(handle.get_stream());
+
+  return mis_vertices;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> maximal_independent_set(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  return detail::maximal_independent_set_impl(handle, graph_view, seed, do_expensive_check);
+}
+
+}  // namespace cugraph
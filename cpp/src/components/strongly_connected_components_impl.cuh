@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/sequence.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// stop trimming once a trimming round removes less than this fraction of the remaining vertices
+double constexpr scc_min_trim_ratio = 0.01;
+
+// the color of an unassigned vertex or std::numeric_limits<vertex_t>::max() if the vertex is
+// already assigned to a component (used as the adjacency matrix column value, pushes to assigned
+// vertices are filtered out as no color is larger than the maximum)
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct scc_key_t {
+  vertex_t const* components{nullptr};
+  vertex_t const* colors{nullptr};
+
+  __device__ vertex_t operator()(vertex_t offset) const
+  {
+    return components[offset] == invalid_component_id<vertex_t>::value
+             ? colors[offset]
+             : std::numeric_limits<vertex_t>::max();
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct count_unassigned_nbrs_e_op_t {
+  template <typename SrcValue>
+  __device__ edge_t operator()(vertex_t src, vertex_t dst, SrcValue, vertex_t dst_key) const
+  {
+    return ((src != dst) && (dst_key != std::numeric_limits<vertex_t>::max())) ? edge_t{1}
+                                                                                : edge_t{0};
+  }
+};
+
+// forward coloring: push the source color to the unassigned destinations with larger colors
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct push_color_e_op_t {
+  __device__ thrust::optional<vertex_t> operator()(vertex_t,
+                                                   vertex_t,
+                                                   vertex_t src_color,
+                                                   vertex_t dst_key) const
+  {
+    return src_color < dst_key ? thrust::optional<vertex_t>{src_color} : thrust::nullopt;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct update_color_v_op_t {
+  size_t next_bucket_idx{};
+
+  __device__ thrust::optional<thrust::tuple<size_t, vertex_t>> operator()(
+    vertex_t, vertex_t key, vertex_t pushed_color) const
+  {
+    return ((key != std::numeric_limits<vertex_t>::max()) && (pushed_color < key))
+             ? thrust::optional<thrust::tuple<size_t, vertex_t>>{thrust::make_tuple(
+                 next_bucket_idx, pushed_color)}
+             : thrust::nullopt;
+  }
+};
+
+// backward reachability (on the reversed graph): push the color to the unassigned in-neighbors of
+// the same color
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct push_component_e_op_t {
+  __device__ thrust::optional<vertex_t> operator()(vertex_t,
+                                                   vertex_t,
+                                                   vertex_t src_color,
+                                                   vertex_t dst_key) const
+  {
+    return src_color == dst_key ? thrust::optional<vertex_t>{src_color} : thrust::nullopt;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct assign_component_v_op_t {
+  size_t next_bucket_idx{};
+
+  __device__ thrust::optional<thrust::tuple<size_t, vertex_t>> operator()(
+    vertex_t, vertex_t key, vertex_t pushed_color) const
+  {
+    return pushed_color == key
+             ? thrust::optional<thrust::tuple<size_t, vertex_t>>{thrust::make_tuple(
+                 next_bucket_idx, pushed_color)}
+             : thrust::nullopt;
+  }
+};
+
+// Coloring based strongly connected components (S. Orzan, "On distributed verification and
+// verified distribution," 2004) with trimming (W. McLendon III et al., "Finding strongly connected
+// components in distributed graphs," 2005). Every round
+// 1) repeatedly trims the unassigned vertices without unassigned in-neighbors or out-neighbors
+// (each forms a single vertex component),
+// 2) colors every unassigned vertex with the smallest vertex ID that reaches the vertex (forward
+// frontier expansion), and
+// 3) for each color c, assigns c to the vertices of color c that reach vertex c (vertex c has color
+// c and every vertex in the component of vertex c has color c as well; backward frontier expansion
+// from the roots on the reversed graph).
+// Each round assigns at least one component per color, and the unassigned vertices start over with
+// fresh colors in the next round.
+template <typename GraphViewType>
+void strongly_connected_components(raft::handle_t const& handle,
+                                   GraphViewType const& push_graph_view,
+                                   typename GraphViewType::vertex_type* components,
+                                   bool do_expensive_check)
+{
+  scoped_phase_t phase("strongly_connected_components", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  // strongly connected components coincide with weakly connected components on symmetric graphs
+
+  if (push_graph_view.is_symmetric()) {
+    weakly_connected_components(handle, push_graph_view, components, do_expensive_check);
+    return;
+  }
+
+  // 2. in-edges are traversed along the out-edges of the reversed graph (the cached one if
+  // push_graph_view provides it, otherwise a temporary unweighted one), which shares the vertex
+  // partitioning with push_graph_view, so vertex property arrays and adjacency matrix row/column
+  // property buffers serve both graphs
+
+  auto reversed_graph =
+    !push_graph_view.has_reversed_view()
+      ? std::make_optional(create_reversed_graph(handle, push_graph_view, false))
+      : std::nullopt;
+  auto reversed_graph_view =
+    reversed_graph ? (*reversed_graph).view() : push_graph_view.get_reversed_view();
+
+  // 3. iterate till every vertex gets assigned
+
+  auto const local_vertex_first = push_graph_view.get_local_vertex_first();
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+
+  thrust::fill(handle.get_thrust_policy(),
+               components,
+               components + num_local_vertices,
+               invalid_component_id<vertex_t>::value);
+  rmm::device_uvector<vertex_t> colors(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<edge_t> out_degrees(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<edge_t> in_degrees(num_local_vertices, handle.get_stream());
+
+  auto key_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(vertex_t{0}),
+    scc_key_t<vertex_t>{static_cast<vertex_t const*>(components), colors.data()});
+
+  row_properties_t<GraphViewType, vertex_t> adj_matrix_row_colors(handle, push_graph_view);
+  col_properties_t<GraphViewType, vertex_t> adj_matrix_col_keys(handle, push_graph_view);
+
+  enum class Bucket { cur, next, num_buckets };
+  VertexFrontier<vertex_t,
+                 void,
+                 GraphViewType::is_multi_gpu,
+                 static_cast<size_t>(Bucket::num_buckets)>
+    vertex_frontier(handle);
+
+  auto num_unassigned_vertices = static_cast<vertex_t>(num_vertices);
+  size_t round{0};
+  while (num_unassigned_vertices > 0) {
+    profiler_add_counter("rounds", 1);
+    nvtx_range_t round_range("round", static_cast<int64_t>(round));
+
+    thrust::sequence(handle.get_thrust_policy(), colors.begin(), colors.end(), local_vertex_first);
+    copy_to_adj_matrix_col(handle, push_graph_view, key_first, adj_matrix_col_keys);
+
+    // 3-1. trim
+
+    {
+      scoped_phase_t trim_phase("trim", handle.get_stream_view());
+      while (true) {
+        copy_v_transform_reduce_out_nbr(handle,
+                                        push_graph_view,
+                                        dummy_properties_t<vertex_t>{}.device_view(),
+                                        adj_matrix_col_keys.device_view(),
+                                        count_unassigned_nbrs_e_op_t<vertex_t, edge_t>{},
+                                        edge_t{0},
+                                        out_degrees.begin());
+        copy_v_transform_reduce_out_nbr(handle,
+                                        reversed_graph_view,
+                                        dummy_properties_t<vertex_t>{}.device_view(),
+                                        adj_matrix_col_keys.device_view(),
+                                        count_unassigned_nbrs_e_op_t<vertex_t, edge_t>{},
+                                        edge_t{0},
+                                        in_degrees.begin());
+
+        rmm::device_uvector<vertex_t> trimmed_vertices(num_local_vertices, handle.get_stream());
+        trimmed_vertices.resize(
+          thrust::distance(
+            trimmed_vertices.begin(),
+            thrust::copy_if(handle.get_thrust_policy(),
+                            thrust::make_counting_iterator(local_vertex_first),
+                            thrust::make_counting_iterator(local_vertex_first + num_local_vertices),
+                            trimmed_vertices.begin(),
+                            [components,
+                             out_degrees = out_degrees.data(),
+                             in_degrees  = in_degrees.data(),
+                             local_vertex_first] __device__(auto v) {
+                              auto offset = v - local_vertex_first;
+                              return (components[offset] ==
+                                      invalid_component_id<vertex_t>::value) &&
+                                     ((out_degrees[offset] == 0) || (in_degrees[offset] == 0));
+                            })),
+          handle.get_stream());
+        thrust::for_each(handle.get_thrust_policy(),
+                         trimmed_vertices.begin(),
+                         trimmed_vertices.end(),
+                         [components, local_vertex_first] __device__(auto v) {
+                           components[v - local_vertex_first] = v;
+                         });
+        copy_to_adj_matrix_col(handle,
+                               push_graph_view,
+                               trimmed_vertices.begin(),
+                               trimmed_vertices.end(),
+                               key_first,
+                               adj_matrix_col_keys);
+
+        auto num_trimmed_vertices = static_cast<vertex_t>(trimmed_vertices.size());
+        if (GraphViewType::is_multi_gpu) {
+          num_trimmed_vertices = host_scalar_allreduce(
+            handle.get_comms(), num_trimmed_vertices, raft::comms::op_t::SUM, handle.get_stream());
+        }
+        profiler_add_counter("trimmed_vertices", static_cast<int64_t>(num_trimmed_vertices));
+        num_unassigned_vertices -= num_trimmed_vertices;
+        if (static_cast<double>(num_trimmed_vertices) <=
+            static_cast<double>(num_unassigned_vertices) * scc_min_trim_ratio) {
+          break;
+        }
+      }
+    }
+    if (num_unassigned_vertices == 0) { break; }
+
+    // 3-2. forward coloring
+
+    {
+      scoped_phase_t forward_phase("forward", handle.get_stream_view());
+
+      rmm::device_uvector<vertex_t> unassigned_vertices(num_local_vertices, handle.get_stream());
+      unassigned_vertices.resize(
+        thrust::distance(
+          unassigned_vertices.begin(),
+          thrust::copy_if(handle.get_thrust_policy(),
+                          thrust::make_counting_iterator(local_vertex_first),
+                          thrust::make_counting_iterator(local_vertex_first + num_local_vertices),
+                          unassigned_vertices.begin(),
+                          [components, local_vertex_first] __device__(auto v) {
+                            return components[v - local_vertex_first] ==
+                                   invalid_component_id<vertex_t>::value;
+                          })),
+        handle.get_stream());
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+        .insert(unassigned_vertices.begin(), unassigned_vertices.end());
+
+      while (true) {
+        auto& cur_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+        copy_to_adj_matrix_row(handle,
+                               push_graph_view,
+                               cur_frontier_bucket.begin(),
+                               cur_frontier_bucket.end(),
+                               colors.begin(),
+                               adj_matrix_row_colors);
+
+        update_frontier_v_push_if_out_nbr(handle,
+                                          push_graph_view,
+                                          vertex_frontier,
+                                          static_cast<size_t>(Bucket::cur),
+                                          std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+                                          adj_matrix_row_colors.device_view(),
+                                          adj_matrix_col_keys.device_view(),
+                                          push_color_e_op_t<vertex_t>{},
+                                          reduce_op::min<vertex_t>(),
+                                          key_first,
+                                          colors.begin(),
+                                          update_color_v_op_t<vertex_t>{
+                                            static_cast<size_t>(Bucket::next)});
+
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+        vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                     static_cast<size_t>(Bucket::next));
+
+        auto& next_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+        if (next_frontier_bucket.aggregate_size() == 0) { break; }
+
+        copy_to_adj_matrix_col(handle,
+                               push_graph_view,
+                               next_frontier_bucket.begin(),
+                               next_frontier_bucket.end(),
+                               key_first,
+                               adj_matrix_col_keys);
+      }
+    }
+
+    // 3-3. backward reachability from the roots (vertices keeping their own IDs as colors)
+
+    {
+      scoped_phase_t backward_phase("backward", handle.get_stream_view());
+
+      rmm::device_uvector<vertex_t> roots(num_local_vertices, handle.get_stream());
+      roots.resize(
+        thrust::distance(
+          roots.begin(),
+          thrust::copy_if(handle.get_thrust_policy(),
+                          thrust::make_counting_iterator(local_vertex_first),
+                          thrust::make_counting_iterator(local_vertex_first + num_local_vertices),
+                          roots.begin(),
+                          [components, colors = colors.data(), local_vertex_first] __device__(
+                            auto v) {
+                            auto offset = v - local_vertex_first;
+                            return (components[offset] == invalid_component_id<vertex_t>::value) &&
+                                   (colors[offset] == v);
+                          })),
+        handle.get_stream());
+      thrust::for_each(handle.get_thrust_policy(),
+                       roots.begin(),
+                       roots.end(),
+                       [components, local_vertex_first] __device__(auto v) {
+                         components[v - local_vertex_first] = v;
+                       });
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+        .insert(roots.begin(), roots.end());
+
+      auto num_assigned_vertices = static_cast<vertex_t>(roots.size());
+      while (true) {
+        auto& cur_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+        copy_to_adj_matrix_col(handle,
+                               push_graph_view,
+                               cur_frontier_bucket.begin(),
+                               cur_frontier_bucket.end(),
+                               key_first,
+                               adj_matrix_col_keys);
+        copy_to_adj_matrix_row(handle,
+                               push_graph_view,
+                               cur_frontier_bucket.begin(),
+                               cur_frontier_bucket.end(),
+                               colors.begin(),
+                               adj_matrix_row_colors);
+
+        update_frontier_v_push_if_out_nbr(handle,
+                                          reversed_graph_view,
+                                          vertex_frontier,
+                                          static_cast<size_t>(Bucket::cur),
+                                          std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+                                          adj_matrix_row_colors.device_view(),
+                                          adj_matrix_col_keys.device_view(),
+                                          push_component_e_op_t<vertex_t>{},
+                                          reduce_op::any<vertex_t>(),
+                                          key_first,
+                                          components,
+                                          assign_component_v_op_t<vertex_t>{
+                                            static_cast<size_t>(Bucket::next)});
+
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+        vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                     static_cast<size_t>(Bucket::next));
+
+        auto& next_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+        num_assigned_vertices += static_cast<vertex_t>(next_frontier_bucket.size());
+        if (next_frontier_bucket.aggregate_size() == 0) { break; }
+      }
+
+      if (GraphViewType::is_multi_gpu) {
+        num_assigned_vertices = host_scalar_allreduce(
+          handle.get_comms(), num_assigned_vertices, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      num_unassigned_vertices -= num_assigned_vertices;
+    }
+
+    ++round;
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void strongly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* components,
+  bool do_expensive_check)
+{
+  detail::strongly_connected_components(handle, graph_view, components, do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <components/mis_impl.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/dataframe_buffer.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/tuple.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace cugraph {
+
+namespace detail {
+
+// a vertex being colored finds the smallest color not taken by its neighbors by counting the
+// neighbors with the colors in [base, base + color_window_size) for base = 0, color_window_size,
+// ... (the counts are summed by copy_v_transform_reduce_out_nbr)
+int32_t constexpr color_window_size = 8;
+using color_window_counts_t =
+  thrust::tuple<int32_t, int32_t, int32_t, int32_t, int32_t, int32_t, int32_t, int32_t>;
+static_assert(thrust::tuple_size<color_window_counts_t>::value == color_window_size);
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct count_higher_priority_uncolored_nbrs_e_op_t {
+  vertex_priority_t<vertex_t> is_higher_priority{};
+
+  template <typename RowValue>
+  __device__ int32_t operator()(vertex_t src, vertex_t dst, RowValue, vertex_t dst_color) const
+  {
+    return ((src != dst) && (dst_color == invalid_vertex_id<vertex_t>::value) &&
+            is_higher_priority(dst, src))
+             ? int32_t{1}
+             : int32_t{0};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct count_nbr_colors_in_window_e_op_t {
+  vertex_t base{};
+
+  template <typename RowValue>
+  __device__ color_window_counts_t operator()(vertex_t src,
+                                              vertex_t dst,
+                                              RowValue,
+                                              vertex_t dst_color) const
+  {
+    auto slot = ((src != dst) && (dst_color != invalid_vertex_id<vertex_t>::value) &&
+                 (dst_color >= base) && (dst_color - base < color_window_size))
+                  ? static_cast<int32_t>(dst_color - base)
+                  : color_window_size;
+    return thrust::make_tuple(static_cast<int32_t>(slot == 0),
+                              static_cast<int32_t>(slot == 1),
+                              static_cast<int32_t>(slot == 2),
+                              static_cast<int32_t>(slot == 3),
+                              static_cast<int32_t>(slot == 4),
+                              static_cast<int32_t>(slot == 5),
+                              static_cast<int32_t>(slot == 6),
+                              static_cast<int32_t>(slot == 7));
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_ready_t {
+  int32_t const* nbr_counts{nullptr};
+  vertex_t local_vertex_first{};
+
+  __device__ bool operator()(vertex_t v) const { return nbr_counts[v - local_vertex_first] == 0; }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename WindowCountIterator>
+struct assign_color_in_window_t {
+  vertex_t* colors{nullptr};
+  WindowCountIterator window_count_first{};
+  vertex_t local_vertex_first{};
+  vertex_t base{};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto offset = v - local_vertex_first;
+    auto counts = *(window_count_first + offset);
+    int32_t count_array[color_window_size] = {thrust::get<0>(counts),
+                                              thrust::get<1>(counts),
+                                              thrust::get<2>(counts),
+                                              thrust::get<3>(counts),
+                                              thrust::get<4>(counts),
+                                              thrust::get<5>(counts),
+                                              thrust::get<6>(counts),
+                                              thrust::get<7>(counts)};
+    for (int32_t i = 0; i < color_window_size; ++i) {
+      if (count_array[i] == 0) {
+        colors[offset] = base + static_cast<vertex_t>(i);
+        break;
+      }
+    }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_colored_t {
+  vertex_t const* colors{nullptr};
+  vertex_t local_vertex_first{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return colors[v - local_vertex_first] != invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+vertex_t vertex_coloring_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* colors,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>;
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: vertex_coloring currently supports only undirected "
+                  "(symmetric) graphs.");
+  CUGRAPH_EXPECTS((num_local_vertices == 0) || (colors != nullptr),
+                  "Invalid input argument: colors should not be nullptr.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  // 2. Jones-Plassmann: in every round, the uncolored vertices with no higher priority uncolored
+  // neighbor (they are independent) take the smallest colors not taken by their neighbors
+
+  auto is_higher_priority =
+    vertex_priority_t<vertex_t>{static_cast<uint32_t>(seed ^ (seed >> 32))};
+
+  thrust::fill(handle.get_thrust_policy(),
+               colors,
+               colors + num_local_vertices,
+               invalid_vertex_id<vertex_t>::value);
+  rmm::device_uvector<vertex_t> uncolored_vertices(num_local_vertices, handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(),
+                   uncolored_vertices.begin(),
+                   uncolored_vertices.end(),
+                   local_vertex_first);
+  rmm::device_uvector<int32_t> nbr_counts(num_local_vertices, handle.get_stream());
+  auto window_counts =
+    allocate_dataframe_buffer<color_window_counts_t>(num_local_vertices, handle.get_stream());
+
+  col_properties_t<graph_view_type, vertex_t> col_colors{};
+  if constexpr (multi_gpu) {
+    col_colors = col_properties_t<graph_view_type, vertex_t>(handle, graph_view);
+  }
+  auto col_color_input =
+    multi_gpu ? col_colors.device_view()
+              : detail::minor_properties_device_view_t<vertex_t, vertex_t const*>(colors);
+
+  while (true) {
+    auto num_uncolored_vertices = uncolored_vertices.size();
+    if constexpr (multi_gpu) {
+      num_uncolored_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_uncolored_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_uncolored_vertices == 0) { break; }
+
+    profiler_add_counter("iterations", 1);
+
+    if constexpr (multi_gpu) { copy_to_adj_matrix_col(handle, graph_view, colors, col_colors); }
+
+    copy_v_transform_reduce_out_nbr(
+      handle,
+      graph_view,
+      uncolored_vertices.begin(),
+      uncolored_vertices.end(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      col_color_input,
+      count_higher_priority_uncolored_nbrs_e_op_t<vertex_t>{is_higher_priority},
+      int32_t{0},
+      nbr_counts.begin());
+
+    auto is_ready = is_ready_t<vertex_t>{nbr_counts.data(), local_vertex_first};
+    rmm::device_uvector<vertex_t> ready_vertices(uncolored_vertices.size(), handle.get_stream());
+    ready_vertices.resize(thrust::distance(ready_vertices.begin(),
+                                           thrust::copy_if(handle.get_thrust_policy(),
+                                                           uncolored_vertices.begin(),
+                                                           uncolored_vertices.end(),
+                                                           ready_vertices.begin(),
+                                                           is_ready)),
+                          handle.get_stream());
+    uncolored_vertices.resize(thrust::distance(uncolored_vertices.begin(),
+                                               thrust::remove_if(handle.get_thrust_policy(),
+                                                                 uncolored_vertices.begin(),
+                                                                 uncolored_vertices.end(),
+                                                                 is_ready)),
+                              handle.get_stream());
+
+    // the ready vertices are not adjacent to each other, so coloring a ready vertex does not
+    // affect the colors available to the other ready vertices
+    vertex_t base{0};
+    while (true) {
+      auto num_ready_vertices = ready_vertices.size();
+      if constexpr (multi_gpu) {
+        num_ready_vertices = host_scalar_allreduce(
+          handle.get_comms(), num_ready_vertices, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (num_ready_vertices == 0) { break; }
+
+      copy_v_transform_reduce_out_nbr(
+        handle,
+        graph_view,
+        ready_vertices.begin(),
+        ready_vertices.end(),
+        dummy_properties_t<vertex_t>{}.device_view(),
+        col_color_input,
+        count_nbr_colors_in_window_e_op_t<vertex_t>{base},
+        color_window_counts_t{0, 0, 0, 0, 0, 0, 0, 0},
+        get_dataframe_buffer_begin(window_counts));
+      auto window_count_first = get_dataframe_buffer_begin(window_counts);
+      thrust::for_each(handle.get_thrust_policy(),
+                       ready_vertices.begin(),
+                       ready_vertices.end(),
+                       assign_color_in_window_t<vertex_t, decltype(window_count_first)>{
+                         colors, window_count_first, local_vertex_first, base});
+      ready_vertices.resize(
+        thrust::distance(ready_vertices.begin(),
+                         thrust::remove_if(handle.get_thrust_policy(),
+                                           ready_vertices.begin(),
+                                           ready_vertices.end(),
+                                           is_colored_t<vertex_t>{colors, local_vertex_first})),
+        handle.get_stream());
+
+      base += static_cast<vertex_t>(color_window_size);
+    }
+  }
+
+  // 3. return the number of colors
+
+  auto num_colors = thrust::reduce(handle.get_thrust_policy(),
+                                   colors,
+                                   colors + num_local_vertices,
+                                   vertex_t{-1},
+                                   thrust::maximum<vertex_t>{}) +
+                    vertex_t{1};
+  if constexpr (multi_gpu) {
+    num_colors = host_scalar_allreduce(
+      handle.get_comms(), num_colors, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  return num_colors;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+vertex_t vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* colors,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  return detail::vertex_coloring_impl(handle, graph_view, colors, seed, do_expensive_check);
+}
+
+}  // namespace cugraph
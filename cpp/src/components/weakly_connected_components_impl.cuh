@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <serialization/checkpoint_utils.cuh>
+
 #include <cugraph/algorithms.hpp>
 #include <cugraph/detail/graph_utils.cuh>
 #include <cugraph/graph_functions.hpp>
@@ -23,25 +25,43 @@
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
 #include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/serialization/serializer.hpp>
+#include <cugraph/utilities/collect_comm.cuh>
 #include <cugraph/utilities/device_comm.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
+#include <cuco/static_map.cuh>
+#include <cuda/atomic>
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/polymorphic_allocator.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/gather.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/optional.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
 #include <thrust/shuffle.h>
+#include <thrust/sort.h>
 #include <thrust/tuple.h>
+#include <thrust/unique.h>
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <numeric>
+#include <optional>
 #include <random>
 #include <type_traits>
 #include <vector>
@@ -164,6 +184,65 @@ accumulate_new_roots(raft::handle_t const& handle,
   return std::make_tuple(std::move(new_roots), num_scanned, degree_sum);
 }
 
+// a pair of component IDs with 32 bit vertex IDs fits in a 64 bit key, so the conflict edges can be
+// deduplicated with a hash set on insertion
+template <typename vertex_t>
+constexpr bool use_edge_set = sizeof(vertex_t) * 2 <= sizeof(uint64_t);
+
+template <typename vertex_t>
+__host__ __device__ uint64_t pack_edge(vertex_t lhs, vertex_t rhs)
+{
+  static_assert(use_edge_set<vertex_t>);
+  return (static_cast<uint64_t>(static_cast<uint32_t>(lhs)) << 32) |
+         static_cast<uint64_t>(static_cast<uint32_t>(rhs));
+}
+
+template <typename vertex_t>
+struct edge_to_edge_set_pair_t {
+  __device__ cuco::pair_type<uint64_t, uint32_t> operator()(
+    thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    return cuco::make_pair(pack_edge(thrust::get<0>(e), thrust::get<1>(e)), uint32_t{0});
+  }
+};
+
+// appends the edge between two conflicting components to the edge buffer (keeping only the edges in
+// the lower triangular part), edges already in the edge set (if EdgeSetViewType is not void) are
+// skipped
+template <typename vertex_t, typename EdgeSetViewType = void>
+struct insert_conflict_edge_t {
+  decltype(thrust::make_zip_iterator(thrust::make_tuple(
+    static_cast<vertex_t*>(nullptr), static_cast<vertex_t*>(nullptr)))) edge_buffer_first;
+  size_t* num_edge_inserts;
+  mutable EdgeSetViewType edge_set_view;
+
+  __device__ void operator()(vertex_t tag, vertex_t old) const
+  {
+    auto lhs = tag >= old ? tag : old;
+    auto rhs = tag >= old ? old : tag;
+    if (edge_set_view.insert(cuco::make_pair(pack_edge(lhs, rhs), uint32_t{0}))) {
+      auto edge_idx = cuda::atomic_ref<size_t, cuda::thread_scope_device>(*num_edge_inserts)
+                        .fetch_add(size_t{1}, cuda::std::memory_order_relaxed);
+      *(edge_buffer_first + edge_idx) = thrust::make_tuple(lhs, rhs);
+    }
+  }
+};
+
+template <typename vertex_t>
+struct insert_conflict_edge_t<vertex_t, void> {
+  decltype(thrust::make_zip_iterator(thrust::make_tuple(
+    static_cast<vertex_t*>(nullptr), static_cast<vertex_t*>(nullptr)))) edge_buffer_first;
+  size_t* num_edge_inserts;
+
+  __device__ void operator()(vertex_t tag, vertex_t old) const
+  {
+    auto edge_idx = cuda::atomic_ref<size_t, cuda::thread_scope_device>(*num_edge_inserts)
+                      .fetch_add(size_t{1}, cuda::std::memory_order_relaxed);
+    *(edge_buffer_first + edge_idx) =
+      tag >= old ? thrust::make_tuple(tag, old) : thrust::make_tuple(old, tag);
+  }
+};
+
 // FIXME: to silence the spurious warning (missing return statement ...) due to the nvcc bug
 // (https://stackoverflow.com/questions/64523302/cuda-missing-return-statement-at-end-of-non-void-
 // function-in-constexpr-if-fun)
@@ -176,8 +255,6 @@ struct v_op_t {
   vertex_type* level_components{};
   decltype(thrust::make_zip_iterator(thrust::make_tuple(
     static_cast<vertex_type*>(nullptr), static_cast<vertex_type*>(nullptr)))) edge_buffer_first{};
-  // FIXME: we can use cuda::atomic instead but currently on a system with x86 + GPU, this requires
-  // placing the atomic barrier on managed memory and this adds additional complication.
   size_t* num_edge_inserts{};
   size_t next_bucket_idx{};
   size_t conflict_bucket_idx{};  // relevant only if GraphViewType::is_multi_gpu is true
@@ -189,10 +266,9 @@ struct v_op_t {
     auto tag = thrust::get<1>(tagged_v);
     auto v_offset =
       vertex_partition.get_local_vertex_offset_from_vertex_nocheck(thrust::get<0>(tagged_v));
-    // FIXME: better switch to atomic_ref after
-    // https://github.com/nvidia/libcudacxx/milestone/2
-    auto old =
-      atomicCAS(level_components + v_offset, invalid_component_id<vertex_type>::value, tag);
+    auto old = invalid_component_id<vertex_type>::value;
+    cuda::atomic_ref<vertex_type, cuda::thread_scope_device>(*(level_components + v_offset))
+      .compare_exchange_strong(old, tag, cuda::std::memory_order_relaxed);
     if (old != invalid_component_id<vertex_type>::value && old != tag) {  // conflict
       return thrust::optional<thrust::tuple<size_t, std::byte>>{
         thrust::make_tuple(conflict_bucket_idx, std::byte{0} /* dummy */)};
@@ -213,12 +289,119 @@ struct v_op_t {
   }
 };
 
+// the checkpointed state after num_levels levels: the component IDs of the completed levels (of the
+// input graph's local vertices in components for level 0, and in level_component_vectors for the
+// other levels), the renumber maps and the local vertex first of the completed levels (except for
+// level 0), and the next level's graph and renumber map
+template <typename vertex_t, typename graph_t>
+void write_weakly_connected_components_checkpoint(
+  raft::handle_t const& handle,
+  checkpoint_params_t const& checkpoint_params,
+  size_t num_levels,
+  vertex_t const* components,
+  size_t num_local_vertices,
+  std::vector<rmm::device_uvector<vertex_t>> const& level_component_vectors,
+  std::vector<rmm::device_uvector<vertex_t>> const& level_renumber_map_vectors,
+  std::vector<vertex_t> const& level_local_vertex_first_vectors,
+  graph_t const& level_graph,
+  rmm::device_uvector<vertex_t> const& level_renumber_map)
+{
+  auto graph_sz_bytes = serializer::serializer_t::get_device_graph_sz_bytes(level_graph);
+  auto sz_bytes       = 2 * sizeof(size_t) + num_local_vertices * sizeof(vertex_t);
+  for (size_t l = 1; l < num_levels; ++l) {
+    sz_bytes += 2 * sizeof(size_t) + sizeof(vertex_t) +
+                (level_component_vectors[l].size() + level_renumber_map_vectors[l].size()) *
+                  sizeof(vertex_t);
+  }
+  sz_bytes += 3 * sizeof(size_t) + level_renumber_map.size() * sizeof(vertex_t) +
+              graph_sz_bytes.first + graph_sz_bytes.second;
+
+  serializer::serializer_t ser(handle, sz_bytes);
+  ser.serialize(num_levels);
+  ser.serialize(num_local_vertices);
+  ser.serialize(components, num_local_vertices);
+  for (size_t l = 1; l < num_levels; ++l) {
+    ser.serialize(level_component_vectors[l].size());
+    ser.serialize(level_component_vectors[l].data(), level_component_vectors[l].size());
+    ser.serialize(level_renumber_map_vectors[l].size());
+    ser.serialize(level_renumber_map_vectors[l].data(), level_renumber_map_vectors[l].size());
+    ser.serialize(level_local_vertex_first_vectors[l]);
+  }
+  ser.serialize(level_renumber_map.size());
+  ser.serialize(level_renumber_map.data(), level_renumber_map.size());
+  ser.serialize(graph_sz_bytes.first);
+  ser.serialize(graph_sz_bytes.second);
+  serializer::serializer_t::graph_meta_t<graph_t> graph_meta{};
+  ser.serialize(level_graph, graph_meta);
+
+  detail::write_checkpoint<graph_t::is_multi_gpu>(
+    handle,
+    checkpoint_params,
+    detail::weakly_connected_components_checkpoint_tag,
+    static_cast<uint64_t>(num_levels),
+    ser,
+    sz_bytes);
+}
+
+// restores the state written by write_weakly_connected_components_checkpoint() and returns the
+// number of the completed levels, or returns std::nullopt if there is no checkpoint
+template <typename vertex_t, typename graph_t>
+std::optional<size_t> read_weakly_connected_components_checkpoint(
+  raft::handle_t const& handle,
+  checkpoint_params_t const& checkpoint_params,
+  vertex_t* components,
+  size_t num_local_vertices,
+  vertex_t local_vertex_first,
+  std::vector<rmm::device_uvector<vertex_t>>& level_component_vectors,
+  std::vector<rmm::device_uvector<vertex_t>>& level_renumber_map_vectors,
+  std::vector<vertex_t>& level_local_vertex_first_vectors,
+  graph_t& level_graph,
+  rmm::device_uvector<vertex_t>& level_renumber_map)
+{
+  auto checkpoint = detail::read_checkpoint<graph_t::is_multi_gpu>(
+    handle, checkpoint_params, detail::weakly_connected_components_checkpoint_tag);
+  if (!checkpoint) { return std::nullopt; }
+
+  auto& payload = std::get<1>(*checkpoint);
+  serializer::serializer_t ser(handle, payload.data());
+
+  auto num_levels                = ser.unserialize<size_t>();
+  auto num_checkpointed_vertices = ser.unserialize<size_t>();
+  detail::check_checkpoint_consistency<graph_t::is_multi_gpu>(
+    handle, (num_levels > 0) && (num_checkpointed_vertices == num_local_vertices));
+
+  auto level_0_components = ser.unserialize<vertex_t>(num_local_vertices);
+  thrust::copy(
+    handle.get_thrust_policy(), level_0_components.begin(), level_0_components.end(), components);
+  level_component_vectors.push_back(rmm::device_uvector<vertex_t>(0, handle.get_stream_view()));
+  level_renumber_map_vectors.push_back(rmm::device_uvector<vertex_t>(0, handle.get_stream_view()));
+  level_local_vertex_first_vectors.push_back(local_vertex_first);
+  for (size_t l = 1; l < num_levels; ++l) {
+    auto num_level_components = ser.unserialize<size_t>();
+    level_component_vectors.push_back(ser.unserialize<vertex_t>(num_level_components));
+    auto renumber_map_size = ser.unserialize<size_t>();
+    level_renumber_map_vectors.push_back(ser.unserialize<vertex_t>(renumber_map_size));
+    level_local_vertex_first_vectors.push_back(ser.unserialize<vertex_t>());
+  }
+  auto renumber_map_size     = ser.unserialize<size_t>();
+  level_renumber_map         = ser.unserialize<vertex_t>(renumber_map_size);
+  auto graph_device_sz_bytes = ser.unserialize<size_t>();
+  auto graph_host_sz_bytes   = ser.unserialize<size_t>();
+  level_graph = ser.unserialize<graph_t>(graph_device_sz_bytes, graph_host_sz_bytes);
+
+  return num_levels;
+}
+
 template <typename GraphViewType>
-void weakly_connected_components_impl(raft::handle_t const& handle,
-                                      GraphViewType const& push_graph_view,
-                                      typename GraphViewType::vertex_type* components,
-                                      bool do_expensive_check)
+void weakly_connected_components_impl(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  typename GraphViewType::vertex_type* components,
+  bool do_expensive_check,
+  std::optional<checkpoint_params_t> const& checkpoint_params = std::nullopt)
 {
+  scoped_phase_t phase("weakly_connected_components", handle.get_stream_view());
+
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
   using weight_t = typename GraphViewType::weight_type;
@@ -237,6 +420,8 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
     push_graph_view.is_symmetric(),
     "Invalid input argument: input graph should be symmetric for weakly connected components.");
 
+  if (checkpoint_params) { detail::check_checkpoint_params(*checkpoint_params); }
+
   if (do_expensive_check) {
     // nothing to do
   }
@@ -267,6 +452,20 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
   // vertex ID in this level to the component ID in the previous level
   std::vector<rmm::device_uvector<vertex_t>> level_renumber_map_vectors{};
   std::vector<vertex_t> level_local_vertex_first_vectors{};
+  if (checkpoint_params && checkpoint_params->resume) {
+    auto checkpointed_num_levels = read_weakly_connected_components_checkpoint(
+      handle,
+      *checkpoint_params,
+      components,
+      static_cast<size_t>(push_graph_view.get_number_of_local_vertices()),
+      push_graph_view.get_local_vertex_first(),
+      level_component_vectors,
+      level_renumber_map_vectors,
+      level_local_vertex_first_vectors,
+      level_graph,
+      level_renumber_map);
+    if (checkpointed_num_levels) { num_levels = *checkpointed_num_levels; }
+  }
   while (true) {
     auto level_graph_view = num_levels == 0 ? push_graph_view : level_graph.view();
     auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
@@ -410,36 +609,13 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
                     std::numeric_limits<vertex_t>::max());
         }
 
-        // FIXME: we need to add host_scalar_scatter
-#if 1
-        rmm::device_uvector<vertex_t> d_counts(comm_size, handle.get_stream_view());
-        raft::update_device(d_counts.data(),
-                            init_max_new_root_counts.data(),
-                            init_max_new_root_counts.size(),
-                            handle.get_stream());
-        device_bcast(
-          comm, d_counts.data(), d_counts.data(), d_counts.size(), int{0}, handle.get_stream());
-        raft::update_host(
-          &init_max_new_roots, d_counts.data() + comm_rank, size_t{1}, handle.get_stream());
-#else
         init_max_new_roots =
           host_scalar_scatter(comm, init_max_new_root_counts.data(), int{0}, handle.get_stream());
-#endif
       } else {
-        // FIXME: we need to add host_scalar_scatter
-#if 1
-        rmm::device_uvector<vertex_t> d_counts(comm_size, handle.get_stream_view());
-        device_bcast(
-          comm, d_counts.data(), d_counts.data(), d_counts.size(), int{0}, handle.get_stream());
-        raft::update_host(
-          &init_max_new_roots, d_counts.data() + comm_rank, size_t{1}, handle.get_stream());
-#else
-        init_max_new_roots =
-          host_scalar_scatter(comm, init_max_new_root_counts.data(), int{0}, handle.get_stream());
-#endif
+        init_max_new_roots = host_scalar_scatter(
+          comm, static_cast<vertex_t const*>(nullptr), int{0}, handle.get_stream());
       }
 
-      handle.get_stream_view().synchronize();
       init_max_new_roots = std::min(init_max_new_roots, max_new_roots);
     }
 
@@ -455,10 +631,14 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
 
     auto edge_buffer =
       allocate_dataframe_buffer<thrust::tuple<vertex_t, vertex_t>>(0, handle.get_stream());
-    // FIXME: we can use cuda::atomic instead but currently on a system with x86 + GPU, this
-    // requires placing the atomic variable on managed memory and this make it less attractive.
     rmm::device_scalar<size_t> num_edge_inserts(size_t{0}, handle.get_stream_view());
 
+    auto poly_alloc = rmm::mr::polymorphic_allocator<char>(rmm::mr::get_current_device_resource());
+    auto stream_adapter = rmm::mr::make_stream_allocator_adaptor(poly_alloc, cudaStream_t{nullptr});
+    using edge_set_t =
+      cuco::static_map<uint64_t, uint32_t, cuda::thread_scope_device, decltype(stream_adapter)>;
+    std::unique_ptr<edge_set_t> edge_set{};
+
     auto adj_matrix_col_components =
       GraphViewType::is_multi_gpu
         ? col_properties_t<GraphViewType, vertex_t>(handle, level_graph_view)
@@ -525,11 +705,51 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
               handle, level_graph_view, vertex_frontier, static_cast<size_t>(Bucket::cur))
           : edge_count;
 
-      // FIXME: if we use cuco::static_map (no duplicates, ideally we need static_set), edge_buffer
-      // size cannot exceed (# roots)^2 and we can avoid additional sort & unique (but resizing the
-      // buffer may be more expensive).
+      // conflict edges are inserted in the e_op (and for the conflict bucket in multi-GPU). With
+      // the edge set, duplicates are never inserted and the edge buffer size cannot exceed
+      // (# roots)^2; otherwise, duplicates are removed by sort & unique after the push.
       auto old_num_edge_inserts = num_edge_inserts.value(handle.get_stream_view());
-      resize_dataframe_buffer(edge_buffer, old_num_edge_inserts + max_pushes, handle.get_stream());
+      auto max_new_edge_inserts = GraphViewType::is_multi_gpu
+                                    ? static_cast<size_t>(max_pushes) * size_t{2}
+                                    : static_cast<size_t>(max_pushes);
+      resize_dataframe_buffer(
+        edge_buffer, old_num_edge_inserts + max_new_edge_inserts, handle.get_stream());
+
+      if constexpr (use_edge_set<vertex_t>) {
+        double constexpr load_factor = 0.7;
+        auto max_edges               = old_num_edge_inserts + max_new_edge_inserts;
+        if (!edge_set ||
+            static_cast<double>(edge_set->get_capacity()) * load_factor < max_edges + 1) {
+          // grow geometrically and re-insert the edges found so far
+          auto capacity =
+            std::max(static_cast<size_t>(static_cast<double>(max_edges) / load_factor),
+                     max_edges + 1);  // cuco::static_map requires at least one empty slot
+          if (edge_set) { capacity = std::max(capacity, edge_set->get_capacity() * 2); }
+          // cuco::static_map currently does not take stream
+          handle.get_stream_view().synchronize();
+          edge_set = nullptr;
+          edge_set = std::make_unique<edge_set_t>(capacity,
+                                                  std::numeric_limits<uint64_t>::max(),
+                                                  std::numeric_limits<uint32_t>::max(),
+                                                  stream_adapter);
+          if (old_num_edge_inserts > 0) {
+            auto pair_first = thrust::make_transform_iterator(
+              get_dataframe_buffer_begin(edge_buffer), edge_to_edge_set_pair_t<vertex_t>{});
+            edge_set->insert(pair_first, pair_first + old_num_edge_inserts);
+          }
+        }
+      }
+      auto insert_conflict_edge = [&]() {
+        if constexpr (use_edge_set<vertex_t>) {
+          return insert_conflict_edge_t<vertex_t, typename edge_set_t::device_mutable_view>{
+            get_dataframe_buffer_begin(edge_buffer),
+            num_edge_inserts.data(),
+            edge_set->get_device_mutable_view()};
+        } else {
+          return insert_conflict_edge_t<vertex_t>{get_dataframe_buffer_begin(edge_buffer),
+                                                  num_edge_inserts.data()};
+        }
+      }();
 
       update_frontier_v_push_if_out_nbr(
         handle,
@@ -545,23 +765,16 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
            GraphViewType::is_multi_gpu
              ? adj_matrix_col_components.mutable_device_view()
              : detail::minor_properties_device_view_t<vertex_t, vertex_t*>(level_components),
-         col_first         = level_graph_view.get_local_adj_matrix_partition_col_first(),
-         edge_buffer_first = get_dataframe_buffer_begin(edge_buffer),
-         num_edge_inserts =
-           num_edge_inserts.data()] __device__(auto tagged_src, vertex_t dst, auto, auto) {
+         col_first = level_graph_view.get_local_adj_matrix_partition_col_first(),
+         insert_conflict_edge] __device__(auto tagged_src, vertex_t dst, auto, auto) {
           auto tag        = thrust::get<1>(tagged_src);
           auto col_offset = dst - col_first;
-          // FIXME: better switch to atomic_ref after
-          // https://github.com/nvidia/libcudacxx/milestone/2
-          auto old = atomicCAS(
-            col_components.get_iter(col_offset), invalid_component_id<vertex_t>::value, tag);
+          auto old        = invalid_component_id<vertex_t>::value;
+          cuda::atomic_ref<vertex_t, cuda::thread_scope_device>(
+            *(col_components.get_iter(col_offset)))
+            .compare_exchange_strong(old, tag, cuda::std::memory_order_relaxed);
           if (old != invalid_component_id<vertex_t>::value && old != tag) {  // conflict
-            static_assert(sizeof(unsigned long long int) == sizeof(size_t));
-            auto edge_idx = atomicAdd(reinterpret_cast<unsigned long long int*>(num_edge_inserts),
-                                      static_cast<unsigned long long int>(1));
-            // keep only the edges in the lower triangular part
-            *(edge_buffer_first + edge_idx) =
-              tag >= old ? thrust::make_tuple(tag, old) : thrust::make_tuple(old, tag);
+            insert_conflict_edge(tag, old);
           }
           return (old == invalid_component_id<vertex_t>::value) ? thrust::optional<vertex_t>{tag}
                                                                 : thrust::nullopt;
@@ -577,36 +790,24 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
                               static_cast<size_t>(Bucket::conflict)});
 
       if (GraphViewType::is_multi_gpu) {
-        auto cur_num_edge_inserts = num_edge_inserts.value(handle.get_stream_view());
+        // the edge buffer already has room for the conflict bucket (the conflict bucket size cannot
+        // exceed max_pushes)
         auto& conflict_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::conflict));
-        resize_dataframe_buffer(
-          edge_buffer, cur_num_edge_inserts + conflict_bucket.size(), handle.get_stream());
         thrust::for_each(
           handle.get_thrust_policy(),
           conflict_bucket.begin(),
           conflict_bucket.end(),
-          [vertex_partition,
-           level_components,
-           edge_buffer_first = get_dataframe_buffer_begin(edge_buffer),
-           num_edge_inserts  = num_edge_inserts.data()] __device__(auto tagged_v) {
+          [vertex_partition, level_components, insert_conflict_edge] __device__(auto tagged_v) {
             auto v_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(
               thrust::get<0>(tagged_v));
-            auto old = *(level_components + v_offset);
-            auto tag = thrust::get<1>(tagged_v);
-            static_assert(sizeof(unsigned long long int) == sizeof(size_t));
-            auto edge_idx = atomicAdd(reinterpret_cast<unsigned long long int*>(num_edge_inserts),
-                                      static_cast<unsigned long long int>(1));
-            // keep only the edges in the lower triangular part
-            *(edge_buffer_first + edge_idx) =
-              tag >= old ? thrust::make_tuple(tag, old) : thrust::make_tuple(old, tag);
+            insert_conflict_edge(thrust::get<1>(tagged_v), *(level_components + v_offset));
           });
         conflict_bucket.clear();
       }
 
-      // maintain the list of sorted unique edges (we can avoid this if we use cuco::static_map(no
-      // duplicates, ideally we need static_set)).
+      // maintain the list of sorted unique edges (not necessary with the edge set)
       auto new_num_edge_inserts = num_edge_inserts.value(handle.get_stream_view());
-      if (new_num_edge_inserts > old_num_edge_inserts) {
+      if (!use_edge_set<vertex_t> && (new_num_edge_inserts > old_num_edge_inserts)) {
         auto edge_first = get_dataframe_buffer_begin(edge_buffer);
         thrust::sort(handle.get_thrust_policy(),
                      edge_first + old_num_edge_inserts,
@@ -713,6 +914,20 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
                                                                 graph_properties_t{true, false},
                                                                 true);
       level_renumber_map = std::move(*tmp_renumber_map);
+
+      if (checkpoint_params && (num_levels % checkpoint_params->interval == 0)) {
+        write_weakly_connected_components_checkpoint(
+          handle,
+          *checkpoint_params,
+          num_levels,
+          static_cast<vertex_t const*>(components),
+          static_cast<size_t>(push_graph_view.get_number_of_local_vertices()),
+          level_component_vectors,
+          level_renumber_map_vectors,
+          level_local_vertex_first_vectors,
+          level_graph,
+          level_renumber_map);
+      }
     } else {
       break;
     }
@@ -749,6 +964,257 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
   }
 }
 
+// Merges the components connected by the newly inserted edges. Every new edge is mapped to the
+// (previous) component IDs of its endpoints, and a Shiloach-Vishkin style union-find (hooking
+// larger roots to smaller roots, then pointer jumping) runs on the compacted set of the affected
+// component IDs only. Merged components take the smallest component ID among the merged ones, and
+// the component IDs of the unaffected components stay the same.
+template <typename GraphViewType>
+void incremental_weakly_connected_components_impl(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  typename GraphViewType::vertex_type const* new_edge_srcs,
+  typename GraphViewType::vertex_type const* new_edge_dsts,
+  typename GraphViewType::edge_type num_new_edges,
+  typename GraphViewType::vertex_type* components,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    push_graph_view.is_symmetric(),
+    "Invalid input argument: input graph should be symmetric for weakly connected components.");
+  CUGRAPH_EXPECTS(num_new_edges >= 0,
+                  "Invalid input argument: num_new_edges should be non-negative.");
+  CUGRAPH_EXPECTS(
+    (num_new_edges == 0) || ((new_edge_srcs != nullptr) && (new_edge_dsts != nullptr)),
+    "Invalid input argument: new_edge_srcs and new_edge_dsts should not be nullptr if "
+    "num_new_edges > 0.");
+
+  if (do_expensive_check) {
+    auto num_invalid_vertices = thrust::count_if(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(new_edge_srcs, new_edge_dsts)),
+      thrust::make_zip_iterator(thrust::make_tuple(new_edge_srcs, new_edge_dsts)) + num_new_edges,
+      [num_vertices] __device__(auto e) {
+        return !is_valid_vertex(num_vertices, thrust::get<0>(e)) ||
+               !is_valid_vertex(num_vertices, thrust::get<1>(e));
+      });
+    if (GraphViewType::is_multi_gpu) {
+      num_invalid_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: new edges have invalid vertex IDs.");
+  }
+
+  // 2. map the new edges to the pairs of the endpoint component IDs
+
+  rmm::device_uvector<vertex_t> lhs_components(num_new_edges, handle.get_stream_view());
+  rmm::device_uvector<vertex_t> rhs_components(num_new_edges, handle.get_stream_view());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    rmm::device_uvector<vertex_t> endpoints(size_t{2} * num_new_edges, handle.get_stream_view());
+    thrust::copy(
+      handle.get_thrust_policy(), new_edge_srcs, new_edge_srcs + num_new_edges, endpoints.begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 new_edge_dsts,
+                 new_edge_dsts + num_new_edges,
+                 endpoints.begin() + num_new_edges);
+    thrust::sort(handle.get_thrust_policy(), endpoints.begin(), endpoints.end());
+    endpoints.resize(
+      thrust::distance(
+        endpoints.begin(),
+        thrust::unique(handle.get_thrust_policy(), endpoints.begin(), endpoints.end())),
+      handle.get_stream_view());
+    auto endpoint_components =
+      collect_values_for_sorted_unique_vertices(handle.get_comms(),
+                                                endpoints.data(),
+                                                static_cast<vertex_t>(endpoints.size()),
+                                                components,
+                                                push_graph_view.get_vertex_partition_lasts(),
+                                                handle.get_stream_view());
+    auto lookup = [endpoint_first      = endpoints.begin(),
+                   endpoint_last       = endpoints.end(),
+                   endpoint_components = endpoint_components.data()] __device__(auto v) {
+      return endpoint_components[thrust::distance(
+        endpoint_first, thrust::lower_bound(thrust::seq, endpoint_first, endpoint_last, v))];
+    };
+    thrust::transform(handle.get_thrust_policy(),
+                      new_edge_srcs,
+                      new_edge_srcs + num_new_edges,
+                      lhs_components.begin(),
+                      lookup);
+    thrust::transform(handle.get_thrust_policy(),
+                      new_edge_dsts,
+                      new_edge_dsts + num_new_edges,
+                      rhs_components.begin(),
+                      lookup);
+  } else {
+    thrust::gather(handle.get_thrust_policy(),
+                   new_edge_srcs,
+                   new_edge_srcs + num_new_edges,
+                   components,
+                   lhs_components.begin());
+    thrust::gather(handle.get_thrust_policy(),
+                   new_edge_dsts,
+                   new_edge_dsts + num_new_edges,
+                   components,
+                   rhs_components.begin());
+  }
+
+  // 3. drop the edges inside a component and the duplicate component pairs
+
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(lhs_components.begin(), rhs_components.begin()));
+  thrust::transform(handle.get_thrust_policy(),
+                    pair_first,
+                    pair_first + num_new_edges,
+                    pair_first,
+                    [] __device__(auto pair) {
+                      auto lhs = thrust::get<0>(pair);
+                      auto rhs = thrust::get<1>(pair);
+                      return lhs <= rhs ? thrust::make_tuple(lhs, rhs)
+                                        : thrust::make_tuple(rhs, lhs);
+                    });
+  auto num_pairs = static_cast<size_t>(thrust::distance(
+    pair_first,
+    thrust::remove_if(handle.get_thrust_policy(),
+                      pair_first,
+                      pair_first + num_new_edges,
+                      [] __device__(auto pair) {
+                        return thrust::get<0>(pair) == thrust::get<1>(pair);
+                      })));
+  thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + num_pairs);
+  num_pairs = static_cast<size_t>(thrust::distance(
+    pair_first, thrust::unique(handle.get_thrust_policy(), pair_first, pair_first + num_pairs)));
+  lhs_components.resize(num_pairs, handle.get_stream_view());
+  rhs_components.resize(num_pairs, handle.get_stream_view());
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    // the component pairs are much fewer than the vertices, so every GPU runs the union-find on
+    // the aggregate pairs instead of partitioning the union-find forest
+    auto& comm     = handle.get_comms();
+    auto rx_counts = host_scalar_allgather(comm, num_pairs, handle.get_stream());
+    std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+    std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+    num_pairs = displacements.back() + rx_counts.back();
+    rmm::device_uvector<vertex_t> aggregate_lhs_components(num_pairs, handle.get_stream_view());
+    rmm::device_uvector<vertex_t> aggregate_rhs_components(num_pairs, handle.get_stream_view());
+    device_allgatherv(comm,
+                      lhs_components.begin(),
+                      aggregate_lhs_components.begin(),
+                      rx_counts,
+                      displacements,
+                      handle.get_stream());
+    device_allgatherv(comm,
+                      rhs_components.begin(),
+                      aggregate_rhs_components.begin(),
+                      rx_counts,
+                      displacements,
+                      handle.get_stream());
+    lhs_components = std::move(aggregate_lhs_components);
+    rhs_components = std::move(aggregate_rhs_components);
+  }
+  if (num_pairs == 0) { return; }
+
+  // 4. compact the affected component IDs
+
+  rmm::device_uvector<vertex_t> roots(size_t{2} * num_pairs, handle.get_stream_view());
+  thrust::copy(
+    handle.get_thrust_policy(), lhs_components.begin(), lhs_components.end(), roots.begin());
+  thrust::copy(handle.get_thrust_policy(),
+               rhs_components.begin(),
+               rhs_components.end(),
+               roots.begin() + num_pairs);
+  thrust::sort(handle.get_thrust_policy(), roots.begin(), roots.end());
+  roots.resize(
+    thrust::distance(roots.begin(),
+                     thrust::unique(handle.get_thrust_policy(), roots.begin(), roots.end())),
+    handle.get_stream_view());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      roots.begin(),
+                      roots.end(),
+                      lhs_components.begin(),
+                      lhs_components.end(),
+                      lhs_components.begin());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      roots.begin(),
+                      roots.end(),
+                      rhs_components.begin(),
+                      rhs_components.end(),
+                      rhs_components.begin());
+
+  // 5. union-find over the compacted component IDs
+
+  rmm::device_uvector<vertex_t> parents(roots.size(), handle.get_stream_view());
+  thrust::sequence(handle.get_thrust_policy(), parents.begin(), parents.end(), vertex_t{0});
+  pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(lhs_components.begin(), rhs_components.begin()));
+  while (true) {
+    // hook the larger root to the smaller root (a racy write, any winner keeps the forest acyclic
+    // as parents always have smaller indices than their children)
+    thrust::for_each(handle.get_thrust_policy(),
+                     pair_first,
+                     pair_first + num_pairs,
+                     [parents = parents.data()] __device__(auto pair) {
+                       auto lhs_root = parents[thrust::get<0>(pair)];
+                       auto rhs_root = parents[thrust::get<1>(pair)];
+                       if (lhs_root < rhs_root) {
+                         parents[rhs_root] = lhs_root;
+                       } else if (rhs_root < lhs_root) {
+                         parents[lhs_root] = rhs_root;
+                       }
+                     });
+
+    // pointer jumping
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(vertex_t{0}),
+                     thrust::make_counting_iterator(static_cast<vertex_t>(parents.size())),
+                     [parents = parents.data()] __device__(auto i) {
+                       auto root = parents[i];
+                       while (parents[root] != root) {
+                         root = parents[root];
+                       }
+                       parents[i] = root;
+                     });
+
+    auto num_unmerged_pairs = thrust::count_if(
+      handle.get_thrust_policy(),
+      pair_first,
+      pair_first + num_pairs,
+      [parents = parents.data()] __device__(auto pair) {
+        return parents[thrust::get<0>(pair)] != parents[thrust::get<1>(pair)];
+      });
+    if (num_unmerged_pairs == 0) { break; }
+  }
+
+  // 6. relabel the vertices in the affected components (roots are the smallest component IDs in
+  // the merged sets as hooking always picks the smaller index)
+
+  thrust::transform(handle.get_thrust_policy(),
+                    components,
+                    components + push_graph_view.get_number_of_local_vertices(),
+                    components,
+                    [root_first = roots.begin(),
+                     root_last  = roots.end(),
+                     parents    = parents.data()] __device__(auto c) {
+                      auto it = thrust::lower_bound(thrust::seq, root_first, root_last, c);
+                      return ((it != root_last) && (*it == c))
+                               ? *(root_first + parents[thrust::distance(root_first, it)])
+                               : c;
+                    });
+}
+
 }  // namespace
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
@@ -761,4 +1227,35 @@ void weakly_connected_components(
   weakly_connected_components_impl(handle, graph_view, components, do_expensive_check);
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* components,
+  checkpoint_params_t const& checkpoint_params,
+  bool do_expensive_check)
+{
+  weakly_connected_components_impl(
+    handle, graph_view, components, do_expensive_check, std::make_optional(checkpoint_params));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* new_edge_srcs,
+  vertex_t const* new_edge_dsts,
+  edge_t num_new_edges,
+  vertex_t* components,
+  bool do_expensive_check)
+{
+  incremental_weakly_connected_components_impl(handle,
+                                               graph_view,
+                                               new_edge_srcs,
+                                               new_edge_dsts,
+                                               num_new_edges,
+                                               components,
+                                               do_expensive_check);
+}
+
 }  // namespace cugraph
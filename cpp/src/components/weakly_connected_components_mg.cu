@@ -19,40 +19,172 @@
 namespace cugraph {
 
 // MG instantiations
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template void weakly_connected_components(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
   int32_t* components,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template void weakly_connected_components(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
   int32_t* components,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template void weakly_connected_components(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
   int32_t* components,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template void weakly_connected_components(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
   int32_t* components,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template void weakly_connected_components(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
   int64_t* components,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template void weakly_connected_components(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
   int64_t* components,
   bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  int32_t* components,
+  checkpoint_params_t const& checkpoint_params,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  int32_t* components,
+  checkpoint_params_t const& checkpoint_params,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  int32_t* components,
+  checkpoint_params_t const& checkpoint_params,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  int32_t* components,
+  checkpoint_params_t const& checkpoint_params,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  int64_t* components,
+  checkpoint_params_t const& checkpoint_params,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  int64_t* components,
+  checkpoint_params_t const& checkpoint_params,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  int32_t const* new_edge_srcs,
+  int32_t const* new_edge_dsts,
+  int32_t num_new_edges,
+  int32_t* components,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  int32_t const* new_edge_srcs,
+  int32_t const* new_edge_dsts,
+  int32_t num_new_edges,
+  int32_t* components,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  int32_t const* new_edge_srcs,
+  int32_t const* new_edge_dsts,
+  int64_t num_new_edges,
+  int32_t* components,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  int32_t const* new_edge_srcs,
+  int32_t const* new_edge_dsts,
+  int64_t num_new_edges,
+  int32_t* components,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  int64_t const* new_edge_srcs,
+  int64_t const* new_edge_dsts,
+  int64_t num_new_edges,
+  int64_t* components,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  int64_t const* new_edge_srcs,
+  int64_t const* new_edge_dsts,
+  int64_t num_new_edges,
+  int64_t* components,
+  bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
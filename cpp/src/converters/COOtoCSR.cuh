@@ -22,14 +22,25 @@
 
 #pragma once
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 #include <algorithm>
 
 #include <cugraph/utilities/error.hpp>
+#include <raft/device_atomics.cuh>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <cub/device/device_radix_sort.cuh>
@@ -140,6 +151,228 @@ rmm::device_buffer create_offset(VT* source,
   return offsets_buffer;
 }
 
+// neighbor lists with up to this many edges are sorted by a single thread (insertion sort)
+constexpr int32_t coo_to_csr_short_list_size_threshold{32};
+
+template <typename VT, typename ET>
+struct count_source_degree_t {
+  VT const* src{nullptr};
+  ET* degrees{nullptr};
+
+  __device__ void operator()(ET i) const { atomicAdd(degrees + src[i], ET{1}); }
+};
+
+template <typename VT, typename ET>
+struct scatter_edge_id_t {
+  VT const* src{nullptr};
+  ET* cursors{nullptr};
+  ET* edge_ids{nullptr};
+
+  __device__ void operator()(ET i) const { edge_ids[atomicAdd(cursors + src[i], ET{1})] = i; }
+};
+
+// an edge (in the CSR order) is out of order if its (dst, edge ID) is smaller than the previous
+// edge's in the same neighbor list
+template <typename VT, typename ET>
+struct is_out_of_order_t {
+  VT const* src{nullptr};
+  VT const* dst{nullptr};
+  ET const* edge_ids{nullptr};  // nullptr if the identity
+
+  __device__ bool operator()(ET i) const
+  {
+    auto e0 = edge_ids != nullptr ? edge_ids[i - 1] : i - 1;
+    auto e1 = edge_ids != nullptr ? edge_ids[i] : i;
+    return (src[e0] == src[e1]) && ((dst[e0] > dst[e1]) || ((dst[e0] == dst[e1]) && (e0 > e1)));
+  }
+};
+
+template <typename VT, typename ET>
+struct sort_short_list_by_dst_t {
+  ET const* offsets{nullptr};
+  VT const* dst{nullptr};
+  ET* edge_ids{nullptr};
+
+  __device__ void operator()(VT v) const
+  {
+    auto first  = offsets[v];
+    auto degree = offsets[v + 1] - first;
+    if ((degree < 2) || (degree > coo_to_csr_short_list_size_threshold)) { return; }
+    auto p_edge_ids = edge_ids + first;
+    for (ET j = 1; j < degree; ++j) {
+      auto e = p_edge_ids[j];
+      auto k = j;
+      while ((k > 0) && ((dst[p_edge_ids[k - 1]] > dst[e]) ||
+                         ((dst[p_edge_ids[k - 1]] == dst[e]) && (p_edge_ids[k - 1] > e)))) {
+        p_edge_ids[k] = p_edge_ids[k - 1];
+        --k;
+      }
+      p_edge_ids[k] = e;
+    }
+  }
+};
+
+template <typename VT, typename ET>
+struct is_long_list_edge_t {
+  ET const* offsets{nullptr};
+  VT const* src{nullptr};
+  ET const* edge_ids{nullptr};
+
+  __device__ bool operator()(ET i) const
+  {
+    auto v = src[edge_ids[i]];
+    return offsets[v + 1] - offsets[v] > coo_to_csr_short_list_size_threshold;
+  }
+};
+
+template <typename VT, typename ET>
+struct csr_order_less_t {
+  VT const* src{nullptr};
+  VT const* dst{nullptr};
+
+  __device__ bool operator()(ET e0, ET e1) const
+  {
+    return thrust::make_tuple(src[e0], dst[e0], e0) < thrust::make_tuple(src[e1], dst[e1], e1);
+  }
+};
+
+/**
+ * @brief     Build CSR offsets, indices and (optional) weights from an unsorted COO
+ *
+ * A counting sort by source replaces the general sort by (src, dst): the source degrees are
+ * histogrammed and scanned to the offsets, and the edge IDs are scattered to their source's
+ * neighbor list. The neighbor lists are then ordered by (dst, edge ID) (the order of a stable
+ * sort by (src, dst)); this pass is skipped if the lists are already in order (e.g. the input is
+ * sorted), which is checked in a linear pass. The input COO is not modified.
+ *
+ * @param[in] src          Source vertex IDs (size = number_of_edges)
+ * @param[in] dst          Destination vertex IDs (size = number_of_edges)
+ * @param[in] weights      Edge weights (size = number_of_edges), nullptr if unweighted
+ * @param[out] offsets     CSR offsets (size = number_of_vertices + 1)
+ * @param[out] indices     CSR indices (size = number_of_edges)
+ * @param[out] edge_data   CSR weights (size = number_of_edges), nullptr if unweighted
+ */
+template <typename VT, typename ET, typename WT>
+void counting_sort_coo_to_csr(VT const* src,
+                              VT const* dst,
+                              WT const* weights,
+                              VT number_of_vertices,
+                              ET number_of_edges,
+                              ET* offsets,
+                              VT* indices,
+                              WT* edge_data,
+                              rmm::cuda_stream_view stream_view)
+{
+  thrust::fill(rmm::exec_policy(stream_view), offsets, offsets + number_of_vertices + 1, ET{0});
+  if (number_of_edges == 0) { return; }
+
+  // 1. histogram & scan to the offsets
+
+  thrust::for_each(rmm::exec_policy(stream_view),
+                   thrust::make_counting_iterator(ET{0}),
+                   thrust::make_counting_iterator(number_of_edges),
+                   count_source_degree_t<VT, ET>{src, offsets});
+  thrust::exclusive_scan(rmm::exec_policy(stream_view),
+                         offsets,
+                         offsets + number_of_vertices + 1,
+                         offsets);
+
+  // 2. order the edge IDs by source, the input order is kept if it is already in the CSR order
+
+  auto in_order = thrust::is_sorted(rmm::exec_policy(stream_view), src, src + number_of_edges) &&
+                  (thrust::count_if(rmm::exec_policy(stream_view),
+                                    thrust::make_counting_iterator(ET{1}),
+                                    thrust::make_counting_iterator(number_of_edges),
+                                    is_out_of_order_t<VT, ET>{src, dst, nullptr}) == 0);
+  if (in_order) {
+    thrust::copy(rmm::exec_policy(stream_view), dst, dst + number_of_edges, indices);
+    if (weights != nullptr) {
+      thrust::copy(rmm::exec_policy(stream_view), weights, weights + number_of_edges, edge_data);
+    }
+    return;
+  }
+
+  rmm::device_uvector<ET> edge_ids(number_of_edges, stream_view);
+  {
+    rmm::device_uvector<ET> cursors(number_of_vertices, stream_view);
+    thrust::copy(
+      rmm::exec_policy(stream_view), offsets, offsets + number_of_vertices, cursors.begin());
+    thrust::for_each(rmm::exec_policy(stream_view),
+                     thrust::make_counting_iterator(ET{0}),
+                     thrust::make_counting_iterator(number_of_edges),
+                     scatter_edge_id_t<VT, ET>{src, cursors.data(), edge_ids.data()});
+  }
+
+  // 3. order each neighbor list by (dst, edge ID), short lists are sorted by a single thread and
+  // the (few) edges of the long lists are sorted together
+
+  if (thrust::count_if(rmm::exec_policy(stream_view),
+                       thrust::make_counting_iterator(ET{1}),
+                       thrust::make_counting_iterator(number_of_edges),
+                       is_out_of_order_t<VT, ET>{src, dst, edge_ids.data()}) > 0) {
+    thrust::for_each(rmm::exec_policy(stream_view),
+                     thrust::make_counting_iterator(VT{0}),
+                     thrust::make_counting_iterator(number_of_vertices),
+                     sort_short_list_by_dst_t<VT, ET>{offsets, dst, edge_ids.data()});
+
+    rmm::device_uvector<ET> long_list_positions(number_of_edges, stream_view);
+    long_list_positions.resize(
+      thrust::distance(long_list_positions.begin(),
+                       thrust::copy_if(rmm::exec_policy(stream_view),
+                                       thrust::make_counting_iterator(ET{0}),
+                                       thrust::make_counting_iterator(number_of_edges),
+                                       long_list_positions.begin(),
+                                       is_long_list_edge_t<VT, ET>{offsets, src, edge_ids.data()})),
+      stream_view);
+    if (long_list_positions.size() > 0) {
+      // the long lists' edges keep their (source ordered) positions, so sorting the edge IDs
+      // gathered from these positions and scattering them back orders every long list
+      rmm::device_uvector<ET> long_list_edge_ids(long_list_positions.size(), stream_view);
+      thrust::gather(rmm::exec_policy(stream_view),
+                     long_list_positions.begin(),
+                     long_list_positions.end(),
+                     edge_ids.begin(),
+                     long_list_edge_ids.begin());
+      thrust::sort(rmm::exec_policy(stream_view),
+                   long_list_edge_ids.begin(),
+                   long_list_edge_ids.end(),
+                   csr_order_less_t<VT, ET>{src, dst});
+      thrust::scatter(rmm::exec_policy(stream_view),
+                      long_list_edge_ids.begin(),
+                      long_list_edge_ids.end(),
+                      long_list_positions.begin(),
+                      edge_ids.begin());
+    }
+  }
+
+  // 4. gather the indices & weights in the CSR order
+
+  thrust::gather(rmm::exec_policy(stream_view), edge_ids.begin(), edge_ids.end(), dst, indices);
+  if (weights != nullptr) {
+    thrust::gather(
+      rmm::exec_policy(stream_view), edge_ids.begin(), edge_ids.end(), weights, edge_data);
+  }
+}
+
+// the legacy COO views may point to host memory (coo_to_csr used to copy the COO to the device
+// before sorting)
+template <typename T>
+bool is_device_accessible(T const* ptr)
+{
+  if (ptr == nullptr) { return true; }
+  cudaPointerAttributes attributes{};
+  CUDA_TRY(cudaPointerGetAttributes(&attributes, ptr));
+  return (attributes.type == cudaMemoryTypeDevice) || (attributes.type == cudaMemoryTypeManaged);
+}
+
+template <typename VT>
+struct max_vertex_id_t {
+  __device__ VT operator()(thrust::tuple<VT, VT> e) const
+  {
+    return thrust::get<0>(e) > thrust::get<1>(e) ? thrust::get<0>(e) : thrust::get<1>(e);
+  }
+};
+
 }  // namespace detail
 
 template <typename VT, typename ET, typename WT>
@@ -148,18 +381,52 @@ std::unique_ptr<legacy::GraphCSR<VT, ET, WT>> coo_to_csr(
 {
   rmm::cuda_stream_view stream_view;
 
-  legacy::GraphCOO<VT, ET, WT> temp_graph(graph, stream_view.value(), mr);
-  legacy::GraphCOOView<VT, ET, WT> temp_graph_view = temp_graph.view();
-  VT total_vertex_count                            = detail::sort(temp_graph_view, stream_view);
-  rmm::device_buffer offsets                       = detail::create_offset(
-    temp_graph.src_indices(), total_vertex_count, temp_graph.number_of_edges(), stream_view, mr);
-  auto coo_contents = temp_graph.release();
-  legacy::GraphSparseContents<VT, ET, WT> csr_contents{
-    total_vertex_count,
-    coo_contents.number_of_edges,
-    std::make_unique<rmm::device_buffer>(std::move(offsets)),
-    std::move(coo_contents.dst_indices),
-    std::move(coo_contents.edge_data)};
+  auto src     = static_cast<VT const*>(graph.src_indices);
+  auto dst     = static_cast<VT const*>(graph.dst_indices);
+  auto weights = graph.has_data() ? static_cast<WT const*>(graph.edge_data) : nullptr;
+  std::unique_ptr<legacy::GraphCOO<VT, ET, WT>> device_graph{};
+  if ((graph.number_of_edges > 0) &&
+      !(detail::is_device_accessible(src) && detail::is_device_accessible(dst) &&
+        detail::is_device_accessible(weights))) {
+    device_graph = std::make_unique<legacy::GraphCOO<VT, ET, WT>>(graph, stream_view.value(), mr);
+    src          = device_graph->src_indices();
+    dst          = device_graph->dst_indices();
+    weights      = graph.has_data() ? device_graph->edge_data() : nullptr;
+  }
+
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(src, dst));
+  VT total_vertex_count = thrust::transform_reduce(rmm::exec_policy(stream_view),
+                                                   edge_first,
+                                                   edge_first + graph.number_of_edges,
+                                                   detail::max_vertex_id_t<VT>{},
+                                                   VT{0},
+                                                   thrust::maximum<VT>()) +
+                          VT{1};
+
+  // Offset array needs an extra element at the end to contain the ending offsets
+  // of the last vertex
+  auto offsets = std::make_unique<rmm::device_buffer>(
+    sizeof(ET) * (total_vertex_count + 1), stream_view, mr);
+  auto indices =
+    std::make_unique<rmm::device_buffer>(sizeof(VT) * graph.number_of_edges, stream_view, mr);
+  auto edge_data = std::make_unique<rmm::device_buffer>(
+    graph.has_data() ? sizeof(WT) * graph.number_of_edges : size_t{0}, stream_view, mr);
+
+  detail::counting_sort_coo_to_csr(src,
+                                   dst,
+                                   weights,
+                                   total_vertex_count,
+                                   graph.number_of_edges,
+                                   static_cast<ET*>(offsets->data()),
+                                   static_cast<VT*>(indices->data()),
+                                   graph.has_data() ? static_cast<WT*>(edge_data->data()) : nullptr,
+                                   stream_view);
+
+  legacy::GraphSparseContents<VT, ET, WT> csr_contents{total_vertex_count,
+                                                       graph.number_of_edges,
+                                                       std::move(offsets),
+                                                       std::move(indices),
+                                                       std::move(edge_data)};
 
   return std::make_unique<legacy::GraphCSR<VT, ET, WT>>(std::move(csr_contents));
 }
@@ -170,18 +437,15 @@ void coo_to_csr_inplace(legacy::GraphCOOView<VT, ET, WT>& graph,
 {
   rmm::cuda_stream_view stream_view;
 
-  detail::sort(graph, stream_view);
-  detail::fill_offset(graph.src_indices,
-                      result.offsets,
-                      graph.number_of_vertices,
-                      graph.number_of_edges,
-                      stream_view);
-
-  CUDA_TRY(cudaMemcpy(
-    result.indices, graph.dst_indices, sizeof(VT) * graph.number_of_edges, cudaMemcpyDefault));
-  if (graph.has_data())
-    CUDA_TRY(cudaMemcpy(
-      result.edge_data, graph.edge_data, sizeof(WT) * graph.number_of_edges, cudaMemcpyDefault));
+  detail::counting_sort_coo_to_csr(graph.src_indices,
+                                   graph.dst_indices,
+                                   graph.has_data() ? graph.edge_data : nullptr,
+                                   graph.number_of_vertices,
+                                   graph.number_of_edges,
+                                   result.offsets,
+                                   result.indices,
+                                   graph.has_data() ? result.edge_data : nullptr,
+                                   stream_view);
 }
 
 // Explicit Instantiation Declarations (EIDecl)
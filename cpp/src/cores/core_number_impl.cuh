@@ -16,17 +16,37 @@
 #pragma once
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
-#include <cugraph/prims/reduce_v.cuh>
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
 #include <cugraph/prims/vertex_frontier.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
 #include <cstddef>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
 
 namespace cugraph {
 
@@ -47,6 +67,247 @@ struct mult_degree_by_two_t {
   __device__ edge_t operator()(edge_t d) const { return d * edge_t{2}; }
 };
 
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct core_number_in_range_t {
+  edge_t const* core_numbers{nullptr};
+  vertex_t v_first{0};
+  edge_t range_first{0};
+  edge_t range_last{0};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    auto c = core_numbers[v - v_first];
+    return (c >= range_first) && (c < range_last);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct core_number_if_not_less_than_t {
+  edge_t const* core_numbers{nullptr};
+  vertex_t v_first{0};
+  edge_t threshold{0};
+
+  __device__ edge_t operator()(vertex_t v) const
+  {
+    auto c = core_numbers[v - v_first];
+    return c >= threshold ? c : std::numeric_limits<edge_t>::max();
+  }
+};
+
+// A bucket queue of the (local) remaining vertices keyed by their current core numbers (see J. Shun
+// et al., "Julienne: A Framework for Parallel Graph Algorithms using Work-efficient Bucketing",
+// 2017). Keys in the open range [open_key_first, open_key_first + num_open_buckets) have their own
+// append-only buckets; vertices with larger core numbers are kept in the overflow bucket, which is
+// re-distributed only when the open range moves past its end. A vertex whose core number decreases
+// is appended to its new bucket, stale entries left behind are filtered out on extraction (an entry
+// is valid only if its key matches the vertex's current core number, core numbers never increase).
+template <typename vertex_t, typename edge_t>
+class core_number_bucket_queue_t {
+ public:
+  static constexpr size_t num_open_buckets{64};
+
+  core_number_bucket_queue_t(raft::handle_t const& handle,
+                             edge_t const* core_numbers,
+                             vertex_t local_vertex_first,
+                             size_t open_key_first)
+    : handle_ptr_(&handle),
+      core_numbers_(core_numbers),
+      local_vertex_first_(local_vertex_first),
+      open_key_first_(open_key_first),
+      overflow_bucket_(0, handle.get_stream())
+  {
+    open_buckets_.reserve(num_open_buckets);
+    for (size_t i = 0; i < num_open_buckets; ++i) {
+      open_buckets_.emplace_back(0, handle.get_stream());
+    }
+  }
+
+  // insert vertices with core numbers no smaller than open_key_first_ (and not yet in the queue)
+  void insert(vertex_t const* vertex_first, vertex_t const* vertex_last)
+  {
+    auto num_vertices = static_cast<size_t>(thrust::distance(vertex_first, vertex_last));
+    rmm::device_uvector<vertex_t> open_vertices(num_vertices, handle_ptr_->get_stream());
+    auto overflow_size = overflow_bucket_.size();
+    overflow_bucket_.resize(overflow_size + num_vertices, handle_ptr_->get_stream());
+    auto it = thrust::partition_copy(handle_ptr_->get_thrust_policy(),
+                                     vertex_first,
+                                     vertex_last,
+                                     open_vertices.begin(),
+                                     overflow_bucket_.begin() + overflow_size,
+                                     in_open_range());
+    open_vertices.resize(thrust::distance(open_vertices.begin(), it.first),
+                         handle_ptr_->get_stream());
+    overflow_bucket_.resize(thrust::distance(overflow_bucket_.begin(), it.second),
+                            handle_ptr_->get_stream());
+    append_to_open_buckets(std::move(open_vertices));
+  }
+
+  // vertices (already in the queue) with decreased core numbers; only the vertices with core
+  // numbers in the open range need to move (the others stay in the overflow bucket)
+  void update(vertex_t const* vertex_first, vertex_t const* vertex_last)
+  {
+    rmm::device_uvector<vertex_t> open_vertices(thrust::distance(vertex_first, vertex_last),
+                                                handle_ptr_->get_stream());
+    open_vertices.resize(thrust::distance(open_vertices.begin(),
+                                          thrust::copy_if(handle_ptr_->get_thrust_policy(),
+                                                          vertex_first,
+                                                          vertex_last,
+                                                          open_vertices.begin(),
+                                                          in_open_range())),
+                         handle_ptr_->get_stream());
+    append_to_open_buckets(std::move(open_vertices));
+  }
+
+  // extract the vertices with core numbers in [key_first, key_last), every smaller key should be
+  // exhausted before (so key_first never decreases over calls)
+  rmm::device_uvector<vertex_t> extract(size_t key_first, size_t key_last)
+  {
+    rmm::device_uvector<vertex_t> vertices(0, handle_ptr_->get_stream());
+    for (size_t key = key_first; key < key_last; ++key) {
+      if (key >= open_key_first_ + num_open_buckets) { move_open_range(key); }
+      auto& bucket = open_buckets_[key - open_key_first_];
+      auto old_size = vertices.size();
+      vertices.resize(old_size + bucket.size(), handle_ptr_->get_stream());
+      vertices.resize(
+        thrust::distance(vertices.begin(),
+                         thrust::copy_if(handle_ptr_->get_thrust_policy(),
+                                         bucket.begin(),
+                                         bucket.end(),
+                                         vertices.begin() + old_size,
+                                         core_number_in_range_t<vertex_t, edge_t>{
+                                           core_numbers_,
+                                           local_vertex_first_,
+                                           static_cast<edge_t>(key),
+                                           static_cast<edge_t>(key + 1)})),
+        handle_ptr_->get_stream());
+      bucket.resize(0, handle_ptr_->get_stream());
+      bucket.shrink_to_fit(handle_ptr_->get_stream());
+    }
+    return vertices;
+  }
+
+  // the minimum core number (no smaller than threshold) of the queued vertices, returns
+  // std::numeric_limits<edge_t>::max() if there is none; stale entries of the remaining vertices
+  // carry the current core numbers as well and those of the peeled vertices are below threshold,
+  // so the entries need not be validated.
+  edge_t min_key(size_t threshold) const
+  {
+    auto op = core_number_if_not_less_than_t<vertex_t, edge_t>{
+      core_numbers_, local_vertex_first_, static_cast<edge_t>(threshold)};
+    auto ret = std::numeric_limits<edge_t>::max();
+    for (size_t i = 0; i < open_buckets_.size() + 1; ++i) {
+      auto const& bucket = i < open_buckets_.size() ? open_buckets_[i] : overflow_bucket_;
+      if (bucket.size() > 0) {
+        ret = std::min(ret,
+                       thrust::transform_reduce(handle_ptr_->get_thrust_policy(),
+                                                bucket.begin(),
+                                                bucket.end(),
+                                                op,
+                                                std::numeric_limits<edge_t>::max(),
+                                                thrust::minimum<edge_t>()));
+      }
+    }
+    return ret;
+  }
+
+ private:
+  raft::handle_t const* handle_ptr_{nullptr};
+  edge_t const* core_numbers_{nullptr};
+  vertex_t local_vertex_first_{0};
+
+  size_t open_key_first_{0};
+  std::vector<rmm::device_uvector<vertex_t>> open_buckets_{};
+  rmm::device_uvector<vertex_t> overflow_bucket_;
+
+  core_number_in_range_t<vertex_t, edge_t> in_open_range() const
+  {
+    return core_number_in_range_t<vertex_t, edge_t>{
+      core_numbers_,
+      local_vertex_first_,
+      static_cast<edge_t>(open_key_first_),
+      static_cast<edge_t>(std::min(open_key_first_ + num_open_buckets,
+                                   static_cast<size_t>(std::numeric_limits<edge_t>::max())))};
+  }
+
+  // vertices with core numbers in the open range, each vertex should appear at most once
+  void append_to_open_buckets(rmm::device_uvector<vertex_t>&& vertices)
+  {
+    if (vertices.size() == 0) { return; }
+
+    rmm::device_uvector<edge_t> keys(vertices.size(), handle_ptr_->get_stream());
+    thrust::transform(handle_ptr_->get_thrust_policy(),
+                      vertices.begin(),
+                      vertices.end(),
+                      keys.begin(),
+                      v_to_core_number_t<vertex_t, edge_t>{core_numbers_, local_vertex_first_});
+    thrust::sort_by_key(
+      handle_ptr_->get_thrust_policy(), keys.begin(), keys.end(), vertices.begin());
+
+    rmm::device_uvector<edge_t> unique_keys(num_open_buckets, handle_ptr_->get_stream());
+    rmm::device_uvector<size_t> counts(unique_keys.size(), handle_ptr_->get_stream());
+    auto it = thrust::reduce_by_key(handle_ptr_->get_thrust_policy(),
+                                    keys.begin(),
+                                    keys.end(),
+                                    thrust::make_constant_iterator(size_t{1}),
+                                    unique_keys.begin(),
+                                    counts.begin());
+    auto num_unique_keys =
+      static_cast<size_t>(thrust::distance(unique_keys.begin(), thrust::get<0>(it)));
+    std::vector<edge_t> h_unique_keys(num_unique_keys);
+    std::vector<size_t> h_counts(num_unique_keys);
+    raft::update_host(
+      h_unique_keys.data(), unique_keys.data(), num_unique_keys, handle_ptr_->get_stream());
+    raft::update_host(h_counts.data(), counts.data(), num_unique_keys, handle_ptr_->get_stream());
+    handle_ptr_->get_stream_view().synchronize();
+
+    size_t offset{0};
+    for (size_t i = 0; i < num_unique_keys; ++i) {
+      auto& bucket  = open_buckets_[static_cast<size_t>(h_unique_keys[i]) - open_key_first_];
+      auto old_size = bucket.size();
+      if (old_size + h_counts[i] > bucket.capacity()) {  // grow geometrically to amortize copies
+        bucket.reserve(std::max(old_size + h_counts[i], bucket.capacity() * 2),
+                       handle_ptr_->get_stream());
+      }
+      bucket.resize(old_size + h_counts[i], handle_ptr_->get_stream());
+      thrust::copy(handle_ptr_->get_thrust_policy(),
+                   vertices.begin() + offset,
+                   vertices.begin() + offset + h_counts[i],
+                   bucket.begin() + old_size);
+      offset += h_counts[i];
+    }
+  }
+
+  // move the open range to start from new_open_key_first (>= the current open range's end), the
+  // vertices in the current open buckets should be all peeled by now.
+  void move_open_range(size_t new_open_key_first)
+  {
+    for (auto& bucket : open_buckets_) {
+      bucket.resize(0, handle_ptr_->get_stream());
+      bucket.shrink_to_fit(handle_ptr_->get_stream());
+    }
+    open_key_first_ = new_open_key_first;
+
+    // overflow entries with core numbers below the current open range's end are stale (the
+    // vertices are either peeled or already appended to the open buckets on update)
+
+    auto valid_last = thrust::partition(
+      handle_ptr_->get_thrust_policy(),
+      overflow_bucket_.begin(),
+      overflow_bucket_.end(),
+      core_number_in_range_t<vertex_t, edge_t>{core_numbers_,
+                                               local_vertex_first_,
+                                               static_cast<edge_t>(open_key_first_),
+                                               std::numeric_limits<edge_t>::max()});
+    overflow_bucket_.resize(thrust::distance(overflow_bucket_.begin(), valid_last),
+                            handle_ptr_->get_stream());
+    rmm::device_uvector<vertex_t> vertices(std::move(overflow_bucket_));
+    overflow_bucket_ = rmm::device_uvector<vertex_t>(0, handle_ptr_->get_stream());
+    insert(vertices.data(), vertices.data() + vertices.size());
+  }
+};
+
 }  // namespace
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
@@ -58,10 +319,10 @@ void core_number(raft::handle_t const& handle,
                  size_t k_last,
                  bool do_expensive_check)
 {
+  scoped_phase_t phase("core_number", handle.get_stream_view());
+
   // check input arguments.
 
-  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
-                  "Invalid input argument: core_number currently supports only undirected graphs.");
   CUGRAPH_EXPECTS((degree_type == k_core_degree_type_t::IN) ||
                     (degree_type == k_core_degree_type_t::OUT) ||
                     (degree_type == k_core_degree_type_t::INOUT),
@@ -77,37 +338,55 @@ void core_number(raft::handle_t const& handle,
     }
   }
 
-  // initialize core_numbers to degrees
+  // initialize core_numbers to degrees (taken from the degree cache if the graph has one)
+
+  auto get_degrees = [&handle, &graph_view](bool in) {
+    auto cached = in ? graph_view.get_cached_in_degrees(handle)
+                     : graph_view.get_cached_out_degrees(handle);
+    auto tmp    = cached ? rmm::device_uvector<edge_t>(0, handle.get_stream())
+                  : in   ? graph_view.compute_in_degrees(handle)
+                         : graph_view.compute_out_degrees(handle);
+    return std::make_tuple(std::move(cached), std::move(tmp));
+  };
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
 
   if (graph_view.is_symmetric()) {  // in-degree == out-degree
-    auto out_degrees = graph_view.compute_out_degrees(handle);
+    auto [cached_out_degrees, tmp_out_degrees] = get_degrees(false);
+    edge_t const* out_degrees = cached_out_degrees ? *cached_out_degrees : tmp_out_degrees.data();
     if ((degree_type == k_core_degree_type_t::IN) || (degree_type == k_core_degree_type_t::OUT)) {
       thrust::copy(
-        handle.get_thrust_policy(), out_degrees.begin(), out_degrees.end(), core_numbers);
+        handle.get_thrust_policy(), out_degrees, out_degrees + num_local_vertices, core_numbers);
     } else {
       auto inout_degree_first =
-        thrust::make_transform_iterator(out_degrees.begin(), mult_degree_by_two_t<edge_t>{});
+        thrust::make_transform_iterator(out_degrees, mult_degree_by_two_t<edge_t>{});
       thrust::copy(handle.get_thrust_policy(),
                    inout_degree_first,
-                   inout_degree_first + out_degrees.size(),
+                   inout_degree_first + num_local_vertices,
                    core_numbers);
     }
   } else {
     if (degree_type == k_core_degree_type_t::IN) {
-      auto in_degrees = graph_view.compute_in_degrees(handle);
-      thrust::copy(handle.get_thrust_policy(), in_degrees.begin(), in_degrees.end(), core_numbers);
+      auto [cached_in_degrees, tmp_in_degrees] = get_degrees(true);
+      edge_t const* in_degrees = cached_in_degrees ? *cached_in_degrees : tmp_in_degrees.data();
+      thrust::copy(
+        handle.get_thrust_policy(), in_degrees, in_degrees + num_local_vertices, core_numbers);
     } else if (degree_type == k_core_degree_type_t::OUT) {
-      auto out_degrees = graph_view.compute_out_degrees(handle);
+      auto [cached_out_degrees, tmp_out_degrees] = get_degrees(false);
+      edge_t const* out_degrees =
+        cached_out_degrees ? *cached_out_degrees : tmp_out_degrees.data();
       thrust::copy(
-        handle.get_thrust_policy(), out_degrees.begin(), out_degrees.end(), core_numbers);
+        handle.get_thrust_policy(), out_degrees, out_degrees + num_local_vertices, core_numbers);
     } else {
-      auto in_degrees  = graph_view.compute_in_degrees(handle);
-      auto out_degrees = graph_view.compute_out_degrees(handle);
+      auto [cached_in_degrees, tmp_in_degrees]   = get_degrees(true);
+      auto [cached_out_degrees, tmp_out_degrees] = get_degrees(false);
+      edge_t const* in_degrees = cached_in_degrees ? *cached_in_degrees : tmp_in_degrees.data();
+      edge_t const* out_degrees =
+        cached_out_degrees ? *cached_out_degrees : tmp_out_degrees.data();
       auto degree_pair_first =
-        thrust::make_zip_iterator(thrust::make_tuple(in_degrees.begin(), out_degrees.begin()));
+        thrust::make_zip_iterator(thrust::make_tuple(in_degrees, out_degrees));
       thrust::transform(handle.get_thrust_policy(),
                         degree_pair_first,
-                        degree_pair_first + in_degrees.size(),
+                        degree_pair_first + num_local_vertices,
                         core_numbers,
                         [] __device__(auto p) { return thrust::get<0>(p) + thrust::get<1>(p); });
     }
@@ -149,41 +428,73 @@ void core_number(raft::handle_t const& handle,
     dst_core_numbers(handle, graph_view);
   copy_to_adj_matrix_col(handle, graph_view, core_numbers, dst_core_numbers);
 
+  // out-degrees decrease as in-neighbors are peeled off, so on directed graphs, OUT and INOUT need
+  // to push to in-neighbors as well; we push along the out-edges of the reversed graph (the cached
+  // one if graph_view provides it, otherwise a temporary unweighted one created only if necessary).
+  // The reversed graph shares the vertex partitioning with graph_view, so core_numbers and
+  // dst_core_numbers serve both graphs.
+
+  auto push_to_in_nbrs = !graph_view.is_symmetric() &&
+                         ((degree_type == k_core_degree_type_t::OUT) ||
+                          (degree_type == k_core_degree_type_t::INOUT));
+  auto reversed_graph = (push_to_in_nbrs && !graph_view.has_reversed_view())
+                          ? std::make_optional(create_reversed_graph(handle, graph_view, false))
+                          : std::nullopt;
+  auto reversed_graph_view =
+    push_to_in_nbrs
+      ? std::make_optional(reversed_graph ? (*reversed_graph).view()
+                                          : graph_view.get_reversed_view())
+      : std::nullopt;
+
   auto k = std::max(k_first, size_t{2});  // degree 0|1 vertices belong to 0|1-core
   if (graph_view.is_symmetric() && (degree_type == k_core_degree_type_t::INOUT) &&
       ((k % 2) == 1)) {  // core numbers are always even numbers if symmetric and INOUT
     ++k;
   }
+  auto delta = (graph_view.is_symmetric() && (degree_type == k_core_degree_type_t::INOUT))
+                 ? edge_t{2}
+                 : edge_t{1};
+
+  // the vertices with core numbers less than the initial k form the first frontier, the others are
+  // inserted to the bucket queue (outside the edge relaxations, a vertex with core number c is
+  // visited O(1 + c / num_open_buckets) times instead of once per k)
+
+  auto num_remaining_vertices = remaining_vertices.size();
+  auto less_than_k_first      = thrust::stable_partition(
+    handle.get_thrust_policy(),
+    remaining_vertices.begin(),
+    remaining_vertices.end(),
+    [core_numbers, k, v_first = graph_view.get_local_vertex_first()] __device__(auto v) {
+      return core_numbers[v - v_first] >= k;
+    });
+  vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+    .insert(less_than_k_first, remaining_vertices.end());
+  core_number_bucket_queue_t<vertex_t, edge_t> bucket_queue(
+    handle, core_numbers, graph_view.get_local_vertex_first(), k);
+  bucket_queue.insert(remaining_vertices.data(), less_than_k_first);
+  remaining_vertices.resize(0, handle.get_stream());
+  remaining_vertices.shrink_to_fit(handle.get_stream());
+
+  bool first_round{true};
   while (k <= k_last) {
     size_t aggregate_num_remaining_vertices{0};
     if constexpr (multi_gpu) {
       auto& comm                       = handle.get_comms();
       aggregate_num_remaining_vertices = host_scalar_allreduce(
-        comm, remaining_vertices.size(), raft::comms::op_t::SUM, handle.get_stream());
+        comm, num_remaining_vertices, raft::comms::op_t::SUM, handle.get_stream());
     } else {
-      aggregate_num_remaining_vertices = remaining_vertices.size();
+      aggregate_num_remaining_vertices = num_remaining_vertices;
     }
     if (aggregate_num_remaining_vertices == 0) { break; }
 
-    // FIXME: scanning the remaining vertices can add significant overhead if the number of distinct
-    // core numbers in [k_first, std::min(max_degree, k_last)] is large and there are many high core
-    // number vertices (so the number of remaining vertices remains large for many iterations). Need
-    // more tuning (e.g. Possibly use a logarithmic binning) if we encounter such use cases.
-    auto less_than_k_first = thrust::stable_partition(
-      handle.get_thrust_policy(),
-      remaining_vertices.begin(),
-      remaining_vertices.end(),
-      [core_numbers, k, v_first = graph_view.get_local_vertex_first()] __device__(auto v) {
-        return core_numbers[v - v_first] >= k;
-      });
-    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
-      .insert(less_than_k_first, remaining_vertices.end());
-    remaining_vertices.resize(thrust::distance(remaining_vertices.begin(), less_than_k_first),
-                              handle.get_stream());
-
-    auto delta = (graph_view.is_symmetric() && (degree_type == k_core_degree_type_t::INOUT))
-                   ? edge_t{2}
-                   : edge_t{1};
+    if (!first_round) {  // all the remaining vertices have core numbers no smaller than k - delta
+      auto frontier_vertices = bucket_queue.extract(k - delta, k);
+      thrust::sort(handle.get_thrust_policy(), frontier_vertices.begin(), frontier_vertices.end());
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+        .insert(frontier_vertices.begin(), frontier_vertices.end());
+    }
+    first_round = false;
+
     if (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() > 0) {
       do {
         // FIXME: If most vertices have core numbers less than k, (dst_val >= k) will be mostly
@@ -191,6 +502,17 @@ void core_number(raft::handle_t const& handle,
         // the number of distinct core numbers in [k_first, std::min(max_degree, k_last)] is large).
         // There are two potential solutions: 1) extract a sub-graph and work on the sub-graph & 2)
         // mask-out/delete edges.
+        auto e_op = [k, delta] __device__(vertex_t src, vertex_t dst, auto, auto dst_val) {
+          return dst_val >= k ? thrust::optional<edge_t>{delta} : thrust::nullopt;
+        };
+        auto v_op = [k_first, k, delta] __device__(auto v, auto v_val, auto pushed_val) {
+          auto new_core_number = v_val >= pushed_val ? v_val - pushed_val : edge_t{0};
+          new_core_number      = new_core_number < (k - delta) ? (k - delta) : new_core_number;
+          new_core_number      = new_core_number < k_first ? edge_t{0} : new_core_number;
+          return thrust::optional<thrust::tuple<size_t, edge_t>>{
+            thrust::make_tuple(static_cast<size_t>(Bucket::next), new_core_number)};
+        };
+
         if (graph_view.is_symmetric() || ((degree_type == k_core_degree_type_t::IN) ||
                                           (degree_type == k_core_degree_type_t::INOUT))) {
           update_frontier_v_push_if_out_nbr(
@@ -201,27 +523,30 @@ void core_number(raft::handle_t const& handle,
             std::vector<size_t>{static_cast<size_t>(Bucket::next)},
             dummy_properties_t<vertex_t>{}.device_view(),
             dst_core_numbers.device_view(),
-            [k, delta] __device__(vertex_t src, vertex_t dst, auto, auto dst_val) {
-              return dst_val >= k ? thrust::optional<edge_t>{delta} : thrust::nullopt;
-            },
+            e_op,
             reduce_op::plus<edge_t>(),
             core_numbers,
             core_numbers,
-            [k_first, k, delta, v_first = graph_view.get_local_vertex_first()] __device__(
-              auto v, auto v_val, auto pushed_val) {
-              auto new_core_number = v_val >= pushed_val ? v_val - pushed_val : edge_t{0};
-              new_core_number      = new_core_number < (k - delta) ? (k - delta) : new_core_number;
-              new_core_number      = new_core_number < k_first ? edge_t{0} : new_core_number;
-              return thrust::optional<thrust::tuple<size_t, edge_t>>{
-                thrust::make_tuple(static_cast<size_t>(Bucket::next), new_core_number)};
-            });
+            v_op);
         }
 
-        if (!graph_view.is_symmetric() && ((degree_type == k_core_degree_type_t::OUT) ||
-                                           (degree_type == k_core_degree_type_t::INOUT))) {
-          // FIXME: we can create a transposed copy of the input graph (note that currently,
-          // transpose works only on graph_t (and does not work on graph_view_t)).
-          CUGRAPH_FAIL("unimplemented.");
+        if (reversed_graph_view) {
+          // dst_core_numbers is not updated yet for the vertices that just fell below k in the
+          // push above; those receive extra decrements here, but v_op clips them to (k - delta)
+          // and the next bucket stores unique vertices, so this does not affect the results.
+          update_frontier_v_push_if_out_nbr(
+            handle,
+            *reversed_graph_view,
+            vertex_frontier,
+            static_cast<size_t>(Bucket::cur),
+            std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+            dummy_properties_t<vertex_t>{}.device_view(),
+            dst_core_numbers.device_view(),
+            e_op,
+            reduce_op::plus<edge_t>(),
+            core_numbers,
+            core_numbers,
+            v_op);
         }
 
         copy_to_adj_matrix_col(
@@ -232,16 +557,24 @@ void core_number(raft::handle_t const& handle,
           core_numbers,
           dst_core_numbers);
 
+        // the vertices still in the k-core stay in the bucket queue (with updated keys), the others
+        // are peeled in the next iteration
+
+        num_remaining_vertices -=
+          vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).size();
+
+        auto next_first = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next)).begin();
+        auto next_last  = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next)).end();
+        auto less_than_k_last = thrust::stable_partition(
+          handle.get_thrust_policy(),
+          next_first,
+          next_last,
+          [core_numbers, k, v_first = graph_view.get_local_vertex_first()] __device__(auto v) {
+            return core_numbers[v - v_first] < k;
+          });
+        bucket_queue.update(less_than_k_last, next_last);
         vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next))
-          .resize(static_cast<size_t>(thrust::distance(
-            vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next)).begin(),
-            thrust::remove_if(
-              handle.get_thrust_policy(),
-              vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next)).begin(),
-              vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next)).end(),
-              [core_numbers, k, v_first = graph_view.get_local_vertex_first()] __device__(auto v) {
-                return core_numbers[v - v_first] >= k;
-              }))));
+          .resize(static_cast<size_t>(thrust::distance(next_first, less_than_k_last)));
         vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next)).shrink_to_fit();
 
         vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
@@ -250,34 +583,13 @@ void core_number(raft::handle_t const& handle,
                                      static_cast<size_t>(Bucket::next));
       } while (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() > 0);
 
-      // FIXME: scanning the remaining vertices can add significant overhead if the number of
-      // distinct core numbers in [k_first, std::min(max_degree, k_last)] is large and there are
-      // many high core number vertices (so the number of remaining vertices remains large for many
-      // iterations). Need more tuning (e.g. Possibly use a logarithmic binning) if we encounter
-      // such use cases.
-      remaining_vertices.resize(
-        thrust::distance(
-          remaining_vertices.begin(),
-          thrust::remove_if(
-            handle.get_thrust_policy(),
-            remaining_vertices.begin(),
-            remaining_vertices.end(),
-            [core_numbers, k, v_first = graph_view.get_local_vertex_first()] __device__(auto v) {
-              return core_numbers[v - v_first] < k;
-            })),
-        handle.get_stream());
       k += delta;
     } else {
-      auto remaining_vertex_core_number_first = thrust::make_transform_iterator(
-        remaining_vertices.begin(),
-        v_to_core_number_t<vertex_t, edge_t>{core_numbers, graph_view.get_local_vertex_first()});
-      auto min_core_number =
-        reduce_v(handle,
-                 graph_view,
-                 remaining_vertex_core_number_first,
-                 remaining_vertex_core_number_first + remaining_vertices.size(),
-                 std::numeric_limits<edge_t>::max(),
-                 raft::comms::op_t::MIN);
+      auto min_core_number = bucket_queue.min_key(k);
+      if constexpr (multi_gpu) {
+        min_core_number = host_scalar_allreduce(
+          handle.get_comms(), min_core_number, raft::comms::op_t::MIN, handle.get_stream());
+      }
       k = std::max(k + delta, static_cast<size_t>(min_core_number + edge_t{delta}));
     }
   }
@@ -20,6 +20,7 @@ namespace cugraph {
 
 // MG instantiation
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template void core_number(raft::handle_t const& handle,
                           graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
                           int32_t* core_numbers,
@@ -27,7 +28,9 @@ template void core_number(raft::handle_t const& handle,
                           size_t k_first,
                           size_t k_last,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template void core_number(raft::handle_t const& handle,
                           graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
                           int32_t* core_numbers,
@@ -35,7 +38,9 @@ template void core_number(raft::handle_t const& handle,
                           size_t k_first,
                           size_t k_last,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template void core_number(raft::handle_t const& handle,
                           graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
                           int64_t* core_numbers,
@@ -43,7 +48,9 @@ template void core_number(raft::handle_t const& handle,
                           size_t k_first,
                           size_t k_last,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template void core_number(raft::handle_t const& handle,
                           graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
                           int64_t* core_numbers,
@@ -51,7 +58,9 @@ template void core_number(raft::handle_t const& handle,
                           size_t k_first,
                           size_t k_last,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template void core_number(raft::handle_t const& handle,
                           graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
                           int64_t* core_numbers,
@@ -59,7 +68,9 @@ template void core_number(raft::handle_t const& handle,
                           size_t k_first,
                           size_t k_last,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template void core_number(raft::handle_t const& handle,
                           graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
                           int64_t* core_numbers,
@@ -67,5 +78,6 @@ template void core_number(raft::handle_t const& handle,
                           size_t k_first,
                           size_t k_last,
                           bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
@@ -16,15 +16,136 @@
 #include <cugraph/detail/graph_utils.cuh>
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
+#include <raft/cudart_utils.h>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <optional>
 #include <tuple>
+#include <vector>
 
 namespace cugraph {
 namespace detail {
 
+namespace {
+
+// a chunk in flight needs about the chunk size for the sort temporaries and another chunk size for
+// the received edges, and two chunks are in flight (one grouped while the other is exchanged)
+size_t constexpr shuffle_edgelist_chunk_memory_factor{4};
+
+// Groups and exchanges the edges in chunks of edges_per_chunk edges. Grouping chunk i + 1 (on the
+// first internal stream of handle if available) overlaps with exchanging chunk i (on the main
+// stream). Every GPU runs the same number of (possibly empty) chunks as shuffle_values is a
+// collective.
+template <typename EdgeIterator, typename EdgeToGPUIdOp>
+auto shuffle_edges_in_chunks(raft::handle_t const& handle,
+                             EdgeIterator edge_first /* [INOUT] */,
+                             size_t num_edges,
+                             EdgeToGPUIdOp edge_to_gpu_id_op,
+                             size_t edges_per_chunk)
+{
+  auto& comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+  auto const comm_rank = comm.get_rank();
+
+  // 1. find the number of edges to receive to allocate the output once
+
+  rmm::device_uvector<size_t> d_counts(comm_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), d_counts.begin(), d_counts.end(), size_t{0});
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(num_edges),
+                   [edge_first, edge_to_gpu_id_op, counts = d_counts.data()] __device__(auto i) {
+                     atomicAdd(reinterpret_cast<unsigned long long int*>(
+                                 counts + edge_to_gpu_id_op(*(edge_first + i))),
+                               static_cast<unsigned long long int>(1));
+                   });
+  device_allreduce(comm,
+                   d_counts.data(),
+                   d_counts.data(),
+                   d_counts.size(),
+                   raft::comms::op_t::SUM,
+                   handle.get_stream());
+  size_t num_rx_edges{0};
+  raft::update_host(&num_rx_edges, d_counts.data() + comm_rank, 1, handle.get_stream());
+
+  auto num_chunks = host_scalar_allreduce(comm,
+                                          (num_edges + edges_per_chunk - 1) / edges_per_chunk,
+                                          raft::comms::op_t::MAX,
+                                          handle.get_stream());
+
+  auto rx_edge_buffer = allocate_dataframe_buffer<
+    typename thrust::iterator_traits<EdgeIterator>::value_type>(num_rx_edges, handle.get_stream());
+
+  // 2. group & exchange the chunks
+
+  auto group_stream_view = handle.get_num_internal_streams() > 0
+                             ? handle.get_internal_stream_view(0)
+                             : handle.get_stream_view();
+  if (group_stream_view.value() != handle.get_stream()) {
+    // the input edges are ready on handle.get_stream()
+    cudaEvent_t input_ready_event{};
+    CUDA_TRY(cudaEventCreateWithFlags(&input_ready_event, cudaEventDisableTiming));
+    CUDA_TRY(cudaEventRecord(input_ready_event, handle.get_stream()));
+    CUDA_TRY(cudaStreamWaitEvent(group_stream_view.value(), input_ready_event, 0));
+    CUDA_TRY(cudaEventDestroy(input_ready_event));
+  }
+
+  auto chunk_first = [num_edges, edges_per_chunk](size_t i) {
+    return std::min(i * edges_per_chunk, num_edges);
+  };
+  auto chunk_last = [num_edges, edges_per_chunk](size_t i) {
+    return std::min((i + 1) * edges_per_chunk, num_edges);
+  };
+
+  auto d_tx_counts = groupby_and_count(edge_first + chunk_first(0),
+                                       edge_first + chunk_last(0),
+                                       edge_to_gpu_id_op,
+                                       comm_size,
+                                       group_stream_view);
+  std::vector<size_t> h_tx_counts(comm_size);
+  size_t rx_offset{0};
+  for (size_t i = 0; i < num_chunks; ++i) {
+    nvtx_range_t chunk_range("chunk", static_cast<int64_t>(i));
+
+    raft::update_host(h_tx_counts.data(), d_tx_counts.data(), comm_size, group_stream_view.value());
+    group_stream_view.synchronize();
+
+    if (i + 1 < num_chunks) {
+      d_tx_counts = groupby_and_count(edge_first + chunk_first(i + 1),
+                                      edge_first + chunk_last(i + 1),
+                                      edge_to_gpu_id_op,
+                                      comm_size,
+                                      group_stream_view);
+    }
+
+    auto rx_chunk_buffer = std::get<0>(
+      shuffle_values(comm, edge_first + chunk_first(i), h_tx_counts, handle.get_stream_view()));
+    auto rx_chunk_size = size_dataframe_buffer(rx_chunk_buffer);
+    thrust::copy(handle.get_thrust_policy(),
+                 get_dataframe_buffer_begin(rx_chunk_buffer),
+                 get_dataframe_buffer_end(rx_chunk_buffer),
+                 get_dataframe_buffer_begin(rx_edge_buffer) + rx_offset);
+    rx_offset += rx_chunk_size;
+  }
+  CUGRAPH_EXPECTS(rx_offset == num_rx_edges,
+                  "Invalid internal state: the received edge count does not match the expected.");
+
+  return rx_edge_buffer;
+}
+
+}  // namespace
+
 template <typename vertex_t, typename weight_t>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
@@ -32,7 +153,8 @@ std::tuple<rmm::device_uvector<vertex_t>,
 shuffle_edgelist_by_gpu_id(raft::handle_t const& handle,
                            rmm::device_uvector<vertex_t>&& d_edgelist_majors,
                            rmm::device_uvector<vertex_t>&& d_edgelist_minors,
-                           std::optional<rmm::device_uvector<weight_t>>&& d_edgelist_weights)
+                           std::optional<rmm::device_uvector<weight_t>>&& d_edgelist_weights,
+                           std::optional<size_t> memory_budget)
 {
   auto& comm               = handle.get_comms();
   auto const comm_size     = comm.get_size();
@@ -41,6 +163,20 @@ shuffle_edgelist_by_gpu_id(raft::handle_t const& handle,
   auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
   auto const col_comm_size = col_comm.get_size();
 
+  auto edge_to_gpu_id_op =
+    [key_func =
+       cugraph::detail::compute_gpu_id_from_edge_t<vertex_t>{
+         comm_size, row_comm_size, col_comm_size}] __device__(auto val) {
+      return key_func(thrust::get<0>(val), thrust::get<1>(val));
+    };
+
+  std::optional<size_t> edges_per_chunk{std::nullopt};
+  if (memory_budget) {
+    auto edge_size = sizeof(vertex_t) * 2 + (d_edgelist_weights ? sizeof(weight_t) : size_t{0});
+    edges_per_chunk =
+      std::max(*memory_budget / (shuffle_edgelist_chunk_memory_factor * edge_size), size_t{1});
+  }
+
   rmm::device_uvector<vertex_t> d_rx_edgelist_majors(0, handle.get_stream());
   rmm::device_uvector<vertex_t> d_rx_edgelist_minors(0, handle.get_stream());
   std::optional<rmm::device_uvector<weight_t>> d_rx_edgelist_weights{std::nullopt};
@@ -48,35 +184,36 @@ shuffle_edgelist_by_gpu_id(raft::handle_t const& handle,
     auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(
       d_edgelist_majors.begin(), d_edgelist_minors.begin(), (*d_edgelist_weights).begin()));
 
-    std::forward_as_tuple(
-      std::tie(d_rx_edgelist_majors, d_rx_edgelist_minors, d_rx_edgelist_weights),
-      std::ignore) =
-      cugraph::groupby_gpuid_and_shuffle_values(
-        comm,  // handle.get_comms(),
-        edge_first,
-        edge_first + d_edgelist_majors.size(),
-        [key_func =
-           cugraph::detail::compute_gpu_id_from_edge_t<vertex_t>{
-             comm_size, row_comm_size, col_comm_size}] __device__(auto val) {
-          return key_func(thrust::get<0>(val), thrust::get<1>(val));
-        },
-        handle.get_stream());
+    if (edges_per_chunk) {
+      std::tie(d_rx_edgelist_majors, d_rx_edgelist_minors, d_rx_edgelist_weights) =
+        shuffle_edges_in_chunks(
+          handle, edge_first, d_edgelist_majors.size(), edge_to_gpu_id_op, *edges_per_chunk);
+    } else {
+      std::forward_as_tuple(
+        std::tie(d_rx_edgelist_majors, d_rx_edgelist_minors, d_rx_edgelist_weights),
+        std::ignore) =
+        cugraph::groupby_gpuid_and_shuffle_values(comm,  // handle.get_comms(),
+                                                  edge_first,
+                                                  edge_first + d_edgelist_majors.size(),
+                                                  edge_to_gpu_id_op,
+                                                  handle.get_stream());
+    }
   } else {
     auto edge_first = thrust::make_zip_iterator(
       thrust::make_tuple(d_edgelist_majors.begin(), d_edgelist_minors.begin()));
 
-    std::forward_as_tuple(std::tie(d_rx_edgelist_majors, d_rx_edgelist_minors),
-                          std::ignore) =
-      cugraph::groupby_gpuid_and_shuffle_values(
-        comm,  // handle.get_comms(),
-        edge_first,
-        edge_first + d_edgelist_majors.size(),
-        [key_func =
-           cugraph::detail::compute_gpu_id_from_edge_t<vertex_t>{
-             comm_size, row_comm_size, col_comm_size}] __device__(auto val) {
-          return key_func(thrust::get<0>(val), thrust::get<1>(val));
-        },
-        handle.get_stream());
+    if (edges_per_chunk) {
+      std::tie(d_rx_edgelist_majors, d_rx_edgelist_minors) = shuffle_edges_in_chunks(
+        handle, edge_first, d_edgelist_majors.size(), edge_to_gpu_id_op, *edges_per_chunk);
+    } else {
+      std::forward_as_tuple(std::tie(d_rx_edgelist_majors, d_rx_edgelist_minors),
+                            std::ignore) =
+        cugraph::groupby_gpuid_and_shuffle_values(comm,  // handle.get_comms(),
+                                                  edge_first,
+                                                  edge_first + d_edgelist_majors.size(),
+                                                  edge_to_gpu_id_op,
+                                                  handle.get_stream());
+    }
   }
 
   return std::make_tuple(std::move(d_rx_edgelist_majors),
@@ -90,7 +227,8 @@ template std::tuple<rmm::device_uvector<int32_t>,
 shuffle_edgelist_by_gpu_id(raft::handle_t const& handle,
                            rmm::device_uvector<int32_t>&& d_edgelist_majors,
                            rmm::device_uvector<int32_t>&& d_edgelist_minors,
-                           std::optional<rmm::device_uvector<float>>&& d_edgelist_weights);
+                           std::optional<rmm::device_uvector<float>>&& d_edgelist_weights,
+                           std::optional<size_t> memory_budget);
 
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
@@ -98,7 +236,8 @@ template std::tuple<rmm::device_uvector<int32_t>,
 shuffle_edgelist_by_gpu_id(raft::handle_t const& handle,
                            rmm::device_uvector<int32_t>&& d_edgelist_majors,
                            rmm::device_uvector<int32_t>&& d_edgelist_minors,
-                           std::optional<rmm::device_uvector<double>>&& d_edgelist_weights);
+                           std::optional<rmm::device_uvector<double>>&& d_edgelist_weights,
+                           std::optional<size_t> memory_budget);
 
 template std::tuple<rmm::device_uvector<int64_t>,
                     rmm::device_uvector<int64_t>,
@@ -106,7 +245,8 @@ template std::tuple<rmm::device_uvector<int64_t>,
 shuffle_edgelist_by_gpu_id(raft::handle_t const& handle,
                            rmm::device_uvector<int64_t>&& d_edgelist_majors,
                            rmm::device_uvector<int64_t>&& d_edgelist_minors,
-                           std::optional<rmm::device_uvector<float>>&& d_edgelist_weights);
+                           std::optional<rmm::device_uvector<float>>&& d_edgelist_weights,
+                           std::optional<size_t> memory_budget);
 
 template std::tuple<rmm::device_uvector<int64_t>,
                     rmm::device_uvector<int64_t>,
@@ -114,7 +254,8 @@ template std::tuple<rmm::device_uvector<int64_t>,
 shuffle_edgelist_by_gpu_id(raft::handle_t const& handle,
                            rmm::device_uvector<int64_t>&& d_edgelist_majors,
                            rmm::device_uvector<int64_t>&& d_edgelist_minors,
-                           std::optional<rmm::device_uvector<double>>&& d_edgelist_weights);
+                           std::optional<rmm::device_uvector<double>>&& d_edgelist_weights,
+                           std::optional<size_t> memory_budget);
 
 template <typename vertex_t>
 rmm::device_uvector<vertex_t> shuffle_vertices_by_gpu_id(raft::handle_t const& handle,
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph_generators.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <generators/splitmix64.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <cstdint>
+#include <limits>
+#include <tuple>
+
+namespace cugraph {
+
+namespace {
+
+// Batagelj-Brandes formulation of preferential attachment: the endpoint array M holds (source,
+// target) of edge i at M[2 * i] and M[2 * i + 1], M[2 * i] = i / edges_per_vertex, and M[2 * i + 1]
+// copies M[r] for r drawn uniformly from [0, 2 * i]. r is a pure function of (seed, i), so a
+// target copying an earlier target is resolved by recomputing that edge's draw (P. Sanders and C.
+// Schulz, "Scalable generation of scale-free graphs," 2016); each step ends the chain with
+// probability ~1/2, so the expected cost per edge is O(1) and no edge depends on another GPU.
+template <typename vertex_t>
+struct barabasi_albert_edge_t {
+  size_t edges_per_vertex{1};
+  uint64_t seed{0};
+
+  __device__ thrust::tuple<vertex_t, vertex_t> operator()(size_t i) const
+  {
+    auto src = static_cast<vertex_t>(i / edges_per_vertex);
+    auto e   = i;
+    while (true) {
+      detail::splitmix64_t rng(seed, e);
+      auto r = rng.next() % (2 * static_cast<uint64_t>(e) + 1);
+      if (r % 2 == 0) {
+        return thrust::make_tuple(src, static_cast<vertex_t>((r / 2) / edges_per_vertex));
+      }
+      e = static_cast<size_t>(r / 2);
+    }
+  }
+};
+
+}  // namespace
+
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+generate_barabasi_albert_edgelist(raft::handle_t const& handle,
+                                  vertex_t num_vertices,
+                                  size_t edges_per_vertex,
+                                  uint64_t seed,
+                                  bool symmetrize,
+                                  bool store_transposed)
+{
+  CUGRAPH_EXPECTS(num_vertices >= 0, "Invalid input argument: num_vertices should be non-negative");
+  CUGRAPH_EXPECTS(edges_per_vertex > 0,
+                  "Invalid input argument: edges_per_vertex should be positive");
+  CUGRAPH_EXPECTS(static_cast<size_t>(num_vertices) <=
+                    std::numeric_limits<size_t>::max() / (2 * edges_per_vertex),
+                  "Implementation cannot support specified value");
+
+  // this GPU generates the (contiguous) range of edges [edge_first, edge_last)
+
+  auto num_edges  = static_cast<size_t>(num_vertices) * edges_per_vertex;
+  auto edge_first = size_t{0};
+  auto edge_last  = num_edges;
+  if (handle.comms_initialized()) {
+    auto const comm_size = static_cast<size_t>(handle.get_comms().get_size());
+    auto const comm_rank = static_cast<size_t>(handle.get_comms().get_rank());
+    // floor(num_edges * rank / comm_size) without overflow
+    auto edges_before = [num_edges, comm_size](size_t rank) {
+      return (num_edges / comm_size) * rank + ((num_edges % comm_size) * rank) / comm_size;
+    };
+    edge_first = edges_before(comm_rank);
+    edge_last  = edges_before(comm_rank + 1);
+  }
+  auto num_local_edges = edge_last - edge_first;
+
+  rmm::device_uvector<vertex_t> srcs(num_local_edges * (symmetrize ? 2 : 1), handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(srcs.size(), handle.get_stream());
+  auto edge_output_first =
+    thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(edge_first),
+                    thrust::make_counting_iterator(edge_last),
+                    edge_output_first,
+                    barabasi_albert_edge_t<vertex_t>{edges_per_vertex, seed});
+
+  // add the reversed off-diagonal edges
+
+  if (symmetrize) {
+    auto reversed_output_first =
+      thrust::make_zip_iterator(thrust::make_tuple(dsts.begin(), srcs.begin()));
+    auto last = thrust::copy_if(
+      handle.get_thrust_policy(),
+      edge_output_first,
+      edge_output_first + num_local_edges,
+      reversed_output_first + num_local_edges,
+      [] __device__(auto e) { return thrust::get<0>(e) != thrust::get<1>(e); });
+    srcs.resize(thrust::distance(reversed_output_first, last), handle.get_stream());
+    dsts.resize(srcs.size(), handle.get_stream());
+  }
+
+  // move the edges to the GPUs that own them
+
+  if (handle.comms_initialized()) {
+    auto& majors = store_transposed ? dsts : srcs;
+    auto& minors = store_transposed ? srcs : dsts;
+    std::tie(majors, minors, std::ignore) =
+      detail::shuffle_edgelist_by_gpu_id(handle,
+                                         std::move(majors),
+                                         std::move(minors),
+                                         std::optional<rmm::device_uvector<float>>{std::nullopt});
+  }
+
+  return std::make_tuple(std::move(srcs), std::move(dsts));
+}
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+generate_barabasi_albert_edgelist<int32_t>(raft::handle_t const& handle,
+                                           int32_t num_vertices,
+                                           size_t edges_per_vertex,
+                                           uint64_t seed,
+                                           bool symmetrize,
+                                           bool store_transposed);
+
+template std::tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+generate_barabasi_albert_edgelist<int64_t>(raft::handle_t const& handle,
+                                           int64_t num_vertices,
+                                           size_t edges_per_vertex,
+                                           uint64_t seed,
+                                           bool symmetrize,
+                                           bool store_transposed);
+
+}  // namespace cugraph
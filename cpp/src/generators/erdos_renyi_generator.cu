@@ -16,17 +16,127 @@
 
 #include <cugraph/graph_generators.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <generators/splitmix64.cuh>
 
 #include <rmm/device_uvector.hpp>
 
-#include <thrust/copy.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
-#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
-#include <thrust/random.h>
+#include <thrust/scan.h>
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <tuple>
 
 namespace cugraph {
 
+namespace {
+
+// Bernoulli(p) sampling of the row-major indices (src * num_vertices + dst) of the adjacency matrix
+// by geometric skipping: the gap between two consecutive selected indices is geometrically
+// distributed, so sampling a chunk costs O(number of selected indices) instead of O(chunk size).
+// Chunks are fixed ranges of the global index space with their own random stream, so a GPU can
+// sample the part of a chunk inside [index_first, index_last) and the union over the GPUs does not
+// depend on the number of GPUs.
+struct gnp_chunk_sampler_t {
+  uint64_t seed{0};
+  size_t chunk_size{1};
+  size_t index_first{0};
+  size_t index_last{0};
+  double log_q{0.0};  // log(1 - p)
+
+  template <typename op_t>
+  __device__ size_t operator()(size_t chunk, op_t op) const
+  {
+    detail::splitmix64_t rng(seed, chunk);
+    auto idx  = chunk * chunk_size;
+    auto last = (index_last - idx > chunk_size) ? idx + chunk_size : index_last;
+    size_t count{0};
+    while (idx < last) {
+      auto skip = floor(log1p(-rng.uniform()) / log_q);
+      if (!(skip < static_cast<double>(last - idx))) { break; }
+      idx += static_cast<size_t>(skip);
+      if (idx >= index_first) { op(count++, idx); }
+      ++idx;
+    }
+    return count;
+  }
+};
+
+// rows [row_first, row_last) of the adjacency matrix assigned to this GPU (all rows in SG)
+template <typename vertex_t>
+std::tuple<size_t, size_t> local_row_range(raft::handle_t const& handle, vertex_t num_vertices)
+{
+  auto n = static_cast<size_t>(num_vertices);
+  if (handle.comms_initialized()) {
+    auto const comm_size = static_cast<size_t>(handle.get_comms().get_size());
+    auto const comm_rank = static_cast<size_t>(handle.get_comms().get_rank());
+    return std::make_tuple(n * comm_rank / comm_size, n * (comm_rank + 1) / comm_size);
+  }
+  return std::make_tuple(size_t{0}, n);
+}
+
+// k distinct indices drawn uniformly from [first, first + size), in ascending order
+rmm::device_uvector<size_t> sample_distinct_indices(
+  raft::handle_t const& handle, size_t first, size_t size, size_t k, uint64_t seed, uint64_t stream)
+{
+  rmm::device_uvector<size_t> indices(0, handle.get_stream());
+  uint64_t num_draws{0};
+  while (indices.size() < k) {
+    auto num_old_indices = indices.size();
+    indices.resize(k, handle.get_stream());
+    thrust::tabulate(
+      handle.get_thrust_policy(),
+      indices.begin() + num_old_indices,
+      indices.end(),
+      [first, size, seed, stream, num_draws] __device__(size_t i) {
+        detail::splitmix64_t rng(seed, stream);
+        rng.discard(num_draws + i);
+        return first + static_cast<size_t>(rng.next() % size);
+      });
+    num_draws += k - num_old_indices;
+    thrust::sort(handle.get_thrust_policy(), indices.begin(), indices.end());
+    indices.resize(
+      thrust::distance(indices.begin(),
+                       thrust::unique(handle.get_thrust_policy(), indices.begin(), indices.end())),
+      handle.get_stream());
+  }
+  return indices;
+}
+
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> indices_to_edgelist(
+  raft::handle_t const& handle,
+  rmm::device_uvector<size_t> const& indices,
+  vertex_t num_vertices,
+  vertex_t base_vertex_id)
+{
+  rmm::device_uvector<vertex_t> src_v(indices.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> dst_v(indices.size(), handle.get_stream());
+
+  thrust::transform(handle.get_thrust_policy(),
+                    indices.begin(),
+                    indices.end(),
+                    thrust::make_zip_iterator(thrust::make_tuple(src_v.begin(), dst_v.begin())),
+                    [num_vertices, base_vertex_id] __device__(size_t index) {
+                      return thrust::make_tuple(
+                        base_vertex_id + static_cast<vertex_t>(index / num_vertices),
+                        base_vertex_id + static_cast<vertex_t>(index % num_vertices));
+                    });
+
+  return std::make_tuple(std::move(src_v), std::move(dst_v));
+}
+
+}  // namespace
+
 template <typename vertex_t>
 std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
 generate_erdos_renyi_graph_edgelist_gnp(raft::handle_t const& handle,
@@ -35,48 +145,58 @@ generate_erdos_renyi_graph_edgelist_gnp(raft::handle_t const& handle,
                                         vertex_t base_vertex_id,
                                         uint64_t seed)
 {
-  CUGRAPH_EXPECTS(num_vertices < std::numeric_limits<int32_t>::max(),
-                  "Implementation cannot support specified value");
+  CUGRAPH_EXPECTS(num_vertices >= 0, "Invalid input argument: num_vertices should be non-negative");
+  CUGRAPH_EXPECTS(
+    static_cast<uint64_t>(num_vertices) <= uint64_t{std::numeric_limits<uint32_t>::max()},
+    "Implementation cannot support specified value");
+  CUGRAPH_EXPECTS((p >= 0.0f) && (p <= 1.0f), "Invalid input argument: p should be in [0, 1]");
 
-  auto random_iterator = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_t>(0), [seed] __device__(size_t index) {
-      thrust::default_random_engine rng(seed);
-      thrust::uniform_real_distribution<float> dist(0.0, 1.0);
-      rng.discard(index);
-      return dist(rng);
-    });
+  auto [row_first, row_last] = local_row_range(handle, num_vertices);
+  auto num_indices           = static_cast<size_t>(num_vertices) * num_vertices;
+  auto index_first           = row_first * num_vertices;
+  auto index_last            = row_last * num_vertices;
 
-  size_t count = thrust::count_if(handle.get_thrust_policy(),
-                                  random_iterator,
-                                  random_iterator + num_vertices * num_vertices,
-                                  [p] __device__(float prob) { return prob < p; });
+  if ((p == 0.0f) || (index_first == index_last)) {
+    return std::make_tuple(rmm::device_uvector<vertex_t>(0, handle.get_stream()),
+                           rmm::device_uvector<vertex_t>(0, handle.get_stream()));
+  }
 
-  rmm::device_uvector<size_t> indices_v(count, handle.get_stream());
+  // a chunk holds ~256 selected indices on average (a tuning parameter)
+  auto constexpr expected_indices_per_chunk = 256.0;
+  auto chunk_size = static_cast<size_t>(
+    std::min(std::ceil(expected_indices_per_chunk / p), static_cast<double>(num_indices)));
+  chunk_size       = std::max(chunk_size, size_t{1});
+  auto chunk_first = index_first / chunk_size;
+  auto chunk_last  = (index_last - 1) / chunk_size + 1;
 
-  thrust::copy_if(handle.get_thrust_policy(),
-                  random_iterator,
-                  random_iterator + num_vertices * num_vertices,
-                  indices_v.begin(),
-                  [p] __device__(float prob) { return prob < p; });
-
-  rmm::device_uvector<vertex_t> src_v(count, handle.get_stream());
-  rmm::device_uvector<vertex_t> dst_v(count, handle.get_stream());
+  gnp_chunk_sampler_t sampler{
+    seed, chunk_size, index_first, index_last, std::log1p(-static_cast<double>(p))};
 
+  rmm::device_uvector<size_t> chunk_offsets(chunk_last - chunk_first + 1, handle.get_stream());
   thrust::transform(handle.get_thrust_policy(),
-                    indices_v.begin(),
-                    indices_v.end(),
-                    thrust::make_zip_iterator(thrust::make_tuple(src_v.begin(), src_v.end())),
-                    [num_vertices] __device__(size_t index) {
-                      size_t src = index / num_vertices;
-                      size_t dst = index % num_vertices;
-
-                      return thrust::make_tuple(static_cast<vertex_t>(src),
-                                                static_cast<vertex_t>(dst));
+                    thrust::make_counting_iterator(chunk_first),
+                    thrust::make_counting_iterator(chunk_last),
+                    chunk_offsets.begin(),
+                    [sampler] __device__(size_t chunk) {
+                      return sampler(chunk, [](size_t, size_t) {});
                     });
+  thrust::exclusive_scan(
+    handle.get_thrust_policy(), chunk_offsets.begin(), chunk_offsets.end(), chunk_offsets.begin());
 
-  handle.get_stream_view().synchronize();
+  rmm::device_uvector<size_t> indices(chunk_offsets.back_element(handle.get_stream()),
+                                      handle.get_stream());
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(chunk_first),
+                   thrust::make_counting_iterator(chunk_last),
+                   [sampler,
+                    chunk_first,
+                    chunk_offsets = chunk_offsets.data(),
+                    indices       = indices.data()] __device__(size_t chunk) {
+                     auto output = indices + chunk_offsets[chunk - chunk_first];
+                     sampler(chunk, [output](size_t i, size_t index) { output[i] = index; });
+                   });
 
-  return std::make_tuple(std::move(src_v), std::move(dst_v));
+  return indices_to_edgelist(handle, indices, num_vertices, base_vertex_id);
 }
 
 template <typename vertex_t>
@@ -87,7 +207,41 @@ generate_erdos_renyi_graph_edgelist_gnm(raft::handle_t const& handle,
                                         vertex_t base_vertex_id,
                                         uint64_t seed)
 {
-  CUGRAPH_FAIL("Not implemented");
+  CUGRAPH_EXPECTS(num_vertices >= 0, "Invalid input argument: num_vertices should be non-negative");
+  CUGRAPH_EXPECTS(
+    static_cast<uint64_t>(num_vertices) <= uint64_t{std::numeric_limits<uint32_t>::max()},
+    "Implementation cannot support specified value");
+  auto n = static_cast<size_t>(num_vertices);
+  CUGRAPH_EXPECTS(m <= n * n,
+                  "Invalid input argument: m should not exceed num_vertices * num_vertices");
+
+  // the edges are split over the GPUs in proportion to their rows, floor(m * row / n) edges are
+  // drawn from the rows in [0, row) (m * row is computed without overflow as n * n < 2^64)
+  auto [row_first, row_last] = local_row_range(handle, num_vertices);
+  auto edges_before = [m, n](size_t row) { return (m / n) * row + ((m % n) * row) / n; };
+  auto local_m = n > 0 ? edges_before(row_last) - edges_before(row_first) : size_t{0};
+
+  auto index_first = row_first * n;
+  auto num_indices = (row_last - row_first) * n;
+  uint64_t stream  = handle.comms_initialized() ? handle.get_comms().get_rank() : 0;
+
+  rmm::device_uvector<size_t> indices(0, handle.get_stream());
+  if (2 * local_m <= num_indices) {
+    indices = sample_distinct_indices(handle, index_first, num_indices, local_m, seed, stream);
+  } else {
+    // dense: sample the indices to leave out instead, then take the complement
+    auto excluded = sample_distinct_indices(
+      handle, index_first, num_indices, num_indices - local_m, seed, stream);
+    indices.resize(local_m, handle.get_stream());
+    thrust::set_difference(handle.get_thrust_policy(),
+                           thrust::make_counting_iterator(index_first),
+                           thrust::make_counting_iterator(index_first + num_indices),
+                           excluded.begin(),
+                           excluded.end(),
+                           indices.begin());
+  }
+
+  return indices_to_edgelist(handle, indices, num_vertices, base_vertex_id);
 }
 
 template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
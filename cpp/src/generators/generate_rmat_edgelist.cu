@@ -14,14 +14,21 @@
  * limitations under the License.
  */
 
+#include <cugraph/detail/graph_utils.cuh>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_generators.hpp>
+#include <cugraph/partition_manager.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <generators/scramble.cuh>
 
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <random>
@@ -30,6 +37,57 @@
 
 namespace cugraph {
 
+namespace detail {
+
+// the i'th edge of an R-mat batch from the 2 * scale random values in [0, 1) drawn for the edge
+template <typename vertex_t>
+struct generate_rmat_edge_t {
+  size_t scale{0};
+  bool clip_and_flip{false};
+  float const* rands{nullptr};
+  double a_plus_b{0.0};
+  double a_norm{0.0};
+  double c_norm{0.0};
+
+  __device__ thrust::tuple<vertex_t, vertex_t> operator()(size_t i) const
+  {
+    vertex_t src{0};
+    vertex_t dst{0};
+    for (int bit = static_cast<int>(scale) - 1; bit >= 0; --bit) {
+      auto r0          = rands[i * 2 * scale + 2 * bit];
+      auto r1          = rands[i * 2 * scale + 2 * bit + 1];
+      auto src_bit_set = r0 > a_plus_b;
+      auto dst_bit_set = r1 > (src_bit_set ? c_norm : a_norm);
+      if (clip_and_flip) {
+        if (src == dst) {
+          if (!src_bit_set && dst_bit_set) {
+            src_bit_set = !src_bit_set;
+            dst_bit_set = !dst_bit_set;
+          }
+        }
+      }
+      src += src_bit_set ? static_cast<vertex_t>(vertex_t{1} << bit) : 0;
+      dst += dst_bit_set ? static_cast<vertex_t>(vertex_t{1} << bit) : 0;
+    }
+    return thrust::make_tuple(src, dst);
+  }
+};
+
+// if a + b == 0.0, a_norm is irrelevant, if (1.0 - (a+b)) == 0.0, c_norm is irrelevant
+template <typename vertex_t>
+generate_rmat_edge_t<vertex_t> make_generate_rmat_edge_op(
+  size_t scale, bool clip_and_flip, float const* rands, double a, double b, double c)
+{
+  return generate_rmat_edge_t<vertex_t>{scale,
+                                        clip_and_flip,
+                                        rands,
+                                        a + b,
+                                        (a + b) > 0.0 ? a / (a + b) : 0.0,
+                                        (1.0 - (a + b)) > 0.0 ? c / (1.0 - (a + b)) : 0.0};
+}
+
+}  // namespace detail
+
 template <typename vertex_t>
 std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> generate_rmat_edgelist(
   raft::handle_t const& handle,
@@ -72,39 +130,140 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> generat
       thrust::make_counting_iterator(size_t{0}),
       thrust::make_counting_iterator(num_edges_to_generate),
       pair_first,
-      // if a + b == 0.0, a_norm is irrelevant, if (1.0 - (a+b)) == 0.0, c_norm is irrelevant
-      [scale,
-       clip_and_flip,
-       rands    = rands.data(),
-       a_plus_b = a + b,
-       a_norm   = (a + b) > 0.0 ? a / (a + b) : 0.0,
-       c_norm   = (1.0 - (a + b)) > 0.0 ? c / (1.0 - (a + b)) : 0.0] __device__(auto i) {
-        vertex_t src{0};
-        vertex_t dst{0};
-        for (int bit = static_cast<int>(scale) - 1; bit >= 0; --bit) {
-          auto r0          = rands[i * 2 * scale + 2 * bit];
-          auto r1          = rands[i * 2 * scale + 2 * bit + 1];
-          auto src_bit_set = r0 > a_plus_b;
-          auto dst_bit_set = r1 > (src_bit_set ? c_norm : a_norm);
-          if (clip_and_flip) {
-            if (src == dst) {
-              if (!src_bit_set && dst_bit_set) {
-                src_bit_set = !src_bit_set;
-                dst_bit_set = !dst_bit_set;
-              }
-            }
-          }
-          src += src_bit_set ? static_cast<vertex_t>(1 << bit) : 0;
-          dst += dst_bit_set ? static_cast<vertex_t>(1 << bit) : 0;
-        }
-        return thrust::make_tuple(src, dst);
-      });
+      detail::make_generate_rmat_edge_op<vertex_t>(scale, clip_and_flip, rands.data(), a, b, c));
     num_edges_generated += num_edges_to_generate;
   }
 
   return std::make_tuple(std::move(srcs), std::move(dsts));
 }
 
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+generate_partitioned_rmat_edgelist(raft::handle_t const& handle,
+                                   size_t scale,
+                                   size_t num_edges,
+                                   double a,
+                                   double b,
+                                   double c,
+                                   uint64_t seed,
+                                   bool clip_and_flip,
+                                   bool scramble_vertex_ids,
+                                   bool symmetrize,
+                                   bool store_transposed)
+{
+  CUGRAPH_EXPECTS((size_t{1} << scale) <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+                  "Invalid input argument: scale too large for vertex_t.");
+  CUGRAPH_EXPECTS((a >= 0.0) && (b >= 0.0) && (c >= 0.0) && (a + b + c <= 1.0),
+                  "Invalid input argument: a, b, c should be non-negative and a + b + c should not "
+                  "be larger than 1.0.");
+  CUGRAPH_EXPECTS(!symmetrize || clip_and_flip,
+                  "Invalid input argument: symmetrize requires clip_and_flip to be true.");
+
+  auto& comm               = handle.get_comms();
+  auto const comm_size     = comm.get_size();
+  auto const comm_rank     = comm.get_rank();
+  auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+  auto const row_comm_size = row_comm.get_size();
+  auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_size = col_comm.get_size();
+
+  // every GPU walks through the same (global) sequence of batches as generate_rmat_edgelist, so
+  // the batch size should be uniform across the GPUs (1024 is a tuning parameter)
+  auto max_edges_to_generate_per_iteration = host_scalar_allreduce(
+    comm,
+    static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * 1024,
+    raft::comms::op_t::MIN,
+    handle.get_stream());
+  auto batch_size = std::min(num_edges, max_edges_to_generate_per_iteration);
+  rmm::device_uvector<float> rands(batch_size * 2 * scale, handle.get_stream_view());
+  rmm::device_uvector<vertex_t> batch_srcs(batch_size, handle.get_stream_view());
+  rmm::device_uvector<vertex_t> batch_dsts(batch_size, handle.get_stream_view());
+
+  rmm::device_uvector<vertex_t> srcs(0, handle.get_stream_view());
+  rmm::device_uvector<vertex_t> dsts(0, handle.get_stream_view());
+
+  auto is_local_edge =
+    [comm_rank,
+     store_transposed,
+     key_func = detail::compute_gpu_id_from_edge_t<vertex_t>{
+       comm_size, row_comm_size, col_comm_size}] __device__(auto e) {
+      auto src = thrust::get<0>(e);
+      auto dst = thrust::get<1>(e);
+      return key_func(store_transposed ? dst : src, store_transposed ? src : dst) == comm_rank;
+    };
+
+  size_t num_edges_generated{0};
+  while (num_edges_generated < num_edges) {
+    auto num_edges_to_generate =
+      std::min(num_edges - num_edges_generated, max_edges_to_generate_per_iteration);
+    auto batch_first =
+      thrust::make_zip_iterator(thrust::make_tuple(batch_srcs.begin(), batch_dsts.begin()));
+    auto batch_last = batch_first + num_edges_to_generate;
+
+    detail::uniform_random_fill(
+      handle.get_stream_view(), rands.data(), num_edges_to_generate * 2 * scale, 0.0f, 1.0f, seed);
+    seed += num_edges_to_generate * 2 * scale;
+
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_edges_to_generate),
+      batch_first,
+      detail::make_generate_rmat_edge_op<vertex_t>(scale, clip_and_flip, rands.data(), a, b, c));
+    if (scramble_vertex_ids) {
+      thrust::transform(handle.get_thrust_policy(),
+                        batch_first,
+                        batch_last,
+                        batch_first,
+                        [scale] __device__(auto e) {
+                          return thrust::make_tuple(detail::scramble(thrust::get<0>(e), scale),
+                                                    detail::scramble(thrust::get<1>(e), scale));
+                        });
+    }
+
+    // keep the edges (and, if symmetrize is true, the reversed off-diagonal edges) that belong to
+    // this GPU
+
+    auto reversed_first =
+      thrust::make_zip_iterator(thrust::make_tuple(batch_dsts.begin(), batch_srcs.begin()));
+    auto reversed_last          = reversed_first + num_edges_to_generate;
+    auto is_local_reversed_edge = [is_local_edge] __device__(auto e) {
+      return (thrust::get<0>(e) != thrust::get<1>(e)) && is_local_edge(e);
+    };
+
+    auto num_local_edges = static_cast<size_t>(
+      thrust::count_if(handle.get_thrust_policy(), batch_first, batch_last, is_local_edge));
+    auto num_local_reversed_edges =
+      symmetrize ? static_cast<size_t>(thrust::count_if(handle.get_thrust_policy(),
+                                                        reversed_first,
+                                                        reversed_last,
+                                                        is_local_reversed_edge))
+                 : size_t{0};
+
+    auto old_size = srcs.size();
+    srcs.resize(old_size + num_local_edges + num_local_reversed_edges, handle.get_stream_view());
+    dsts.resize(srcs.size(), handle.get_stream_view());
+    auto output_first =
+      thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin())) + old_size;
+    thrust::copy_if(
+      handle.get_thrust_policy(), batch_first, batch_last, output_first, is_local_edge);
+    if (symmetrize) {
+      thrust::copy_if(handle.get_thrust_policy(),
+                      reversed_first,
+                      reversed_last,
+                      output_first + num_local_edges,
+                      is_local_reversed_edge);
+    }
+
+    num_edges_generated += num_edges_to_generate;
+  }
+
+  srcs.shrink_to_fit(handle.get_stream_view());
+  dsts.shrink_to_fit(handle.get_stream_view());
+
+  return std::make_tuple(std::move(srcs), std::move(dsts));
+}
+
 template <typename vertex_t>
 std::vector<std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>>
 generate_rmat_edgelists(raft::handle_t const& handle,
@@ -177,6 +336,32 @@ generate_rmat_edgelist<int64_t>(raft::handle_t const& handle,
                                 uint64_t seed,
                                 bool clip_and_flip);
 
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+generate_partitioned_rmat_edgelist<int32_t>(raft::handle_t const& handle,
+                                            size_t scale,
+                                            size_t num_edges,
+                                            double a,
+                                            double b,
+                                            double c,
+                                            uint64_t seed,
+                                            bool clip_and_flip,
+                                            bool scramble_vertex_ids,
+                                            bool symmetrize,
+                                            bool store_transposed);
+
+template std::tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+generate_partitioned_rmat_edgelist<int64_t>(raft::handle_t const& handle,
+                                            size_t scale,
+                                            size_t num_edges,
+                                            double a,
+                                            double b,
+                                            double c,
+                                            uint64_t seed,
+                                            bool clip_and_flip,
+                                            bool scramble_vertex_ids,
+                                            bool symmetrize,
+                                            bool store_transposed);
+
 template std::vector<std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>>
 generate_rmat_edgelists<int32_t>(raft::handle_t const& handle,
                                  size_t n_edgelists,
@@ -23,7 +23,10 @@
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
 
+#include <algorithm>
 #include <numeric>
 
 namespace cugraph {
@@ -66,7 +69,24 @@ void scramble_vertex_ids(raft::handle_t const& handle,
                          vertex_t vertex_id_offset,
                          uint64_t seed)
 {
-  vertex_t scale = 1 + raft::log2(d_src_v.size());
+  if (d_src_v.size() == 0) { return; }
+
+  // scramble in [0, 2^scale) where scale is the number of bits of the largest vertex ID (this is
+  // the R-mat scale for the R-mat graphs), so the scrambled vertex IDs stay in the vertex ID range
+  auto max_vertex_id = std::max(thrust::reduce(handle.get_thrust_policy(),
+                                               d_src_v.begin(),
+                                               d_src_v.end(),
+                                               vertex_t{0},
+                                               thrust::maximum<vertex_t>()),
+                                thrust::reduce(handle.get_thrust_policy(),
+                                               d_dst_v.begin(),
+                                               d_dst_v.end(),
+                                               vertex_t{0},
+                                               thrust::maximum<vertex_t>()));
+  size_t scale{1};
+  while ((uint64_t{1} << scale) <= static_cast<uint64_t>(max_vertex_id)) {
+    ++scale;
+  }
 
   auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(d_src_v.begin(), d_dst_v.begin()));
   thrust::transform(handle.get_thrust_policy(),
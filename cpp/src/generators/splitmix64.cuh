@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace cugraph {
+namespace detail {
+
+// SplitMix64 (G. L. Steele, D. Lea, and C. H. Flood, "Fast splittable pseudorandom number
+// generators," 2014); the state advances by a constant, so a generator can be keyed by (seed,
+// stream) and skip ahead in O(1), which makes each chunk/thread independent of the others.
+struct splitmix64_t {
+  static constexpr uint64_t gamma = uint64_t{0x9e3779b97f4a7c15};
+
+  uint64_t state{0};
+
+  __host__ __device__ splitmix64_t(uint64_t seed, uint64_t stream)
+    : state{mix(seed + gamma) ^ mix(stream + 2 * gamma)}
+  {
+  }
+
+  __host__ __device__ static uint64_t mix(uint64_t z)
+  {
+    z = (z ^ (z >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+    z = (z ^ (z >> 27)) * uint64_t{0x94d049bb133111eb};
+    return z ^ (z >> 31);
+  }
+
+  __host__ __device__ void discard(uint64_t n) { state += n * gamma; }
+
+  __host__ __device__ uint64_t next()
+  {
+    state += gamma;
+    return mix(state);
+  }
+
+  // in [0, 1)
+  __host__ __device__ double uniform()
+  {
+    return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);  // 2^-53
+  }
+};
+
+}  // namespace detail
+}  // namespace cugraph
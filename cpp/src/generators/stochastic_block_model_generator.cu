@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph_generators.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <generators/splitmix64.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// the vertex pairs of block pair (i, j) are indexed in the row-major order of the block, (src =
+// src_first + index / dst_size, dst = dst_first + index % dst_size)
+template <typename vertex_t>
+struct block_pair_t {
+  vertex_t src_first{};
+  vertex_t dst_first{};
+  size_t dst_size{0};
+  size_t num_indices{0};
+  size_t chunk_size{1};
+  double log_q{0.0};  // log(1 - p)
+  bool diagonal{false};
+};
+
+// Bernoulli(p) sampling of the vertex pairs of a block pair by geometric skipping (as in
+// generate_erdos_renyi_graph_edgelist_gnp), chunks are numbered globally (over every block pair)
+// and each chunk has its own random stream, so a GPU can sample any subset of the chunks and the
+// union over the GPUs does not depend on the number of GPUs. Self-loops are skipped, so are the
+// pairs with src > dst in the diagonal blocks if undirected (the reversed edges are added later).
+template <typename vertex_t>
+struct sbm_chunk_sampler_t {
+  block_pair_t<vertex_t> const* block_pairs{nullptr};
+  size_t const* block_pair_chunk_offsets{nullptr};
+  size_t num_block_pairs{0};
+  uint64_t seed{0};
+  bool directed{false};
+
+  template <typename op_t>
+  __device__ size_t operator()(size_t chunk, op_t op) const
+  {
+    auto pair_idx = static_cast<size_t>(
+      thrust::distance(block_pair_chunk_offsets + 1,
+                       thrust::upper_bound(thrust::seq,
+                                           block_pair_chunk_offsets + 1,
+                                           block_pair_chunk_offsets + (num_block_pairs + 1),
+                                           chunk)));
+    auto pair = block_pairs[pair_idx];
+
+    detail::splitmix64_t rng(seed, chunk);
+    auto idx  = (chunk - block_pair_chunk_offsets[pair_idx]) * pair.chunk_size;
+    auto last = (pair.num_indices - idx > pair.chunk_size) ? idx + pair.chunk_size
+                                                           : pair.num_indices;
+    size_t count{0};
+    while (idx < last) {
+      auto skip = floor(log1p(-rng.uniform()) / pair.log_q);
+      if (!(skip < static_cast<double>(last - idx))) { break; }
+      idx += static_cast<size_t>(skip);
+      auto src_offset = static_cast<vertex_t>(idx / pair.dst_size);
+      auto dst_offset = static_cast<vertex_t>(idx % pair.dst_size);
+      if (!pair.diagonal || (directed ? (src_offset != dst_offset) : (src_offset < dst_offset))) {
+        op(count++, pair.src_first + src_offset, pair.dst_first + dst_offset);
+      }
+      ++idx;
+    }
+    return count;
+  }
+};
+
+}  // namespace
+
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+generate_stochastic_block_model_edgelist(raft::handle_t const& handle,
+                                         std::vector<vertex_t> const& block_sizes,
+                                         std::vector<double> const& block_edge_probabilities,
+                                         bool directed,
+                                         uint64_t seed,
+                                         bool store_transposed)
+{
+  auto num_blocks = block_sizes.size();
+  CUGRAPH_EXPECTS(block_edge_probabilities.size() == num_blocks * num_blocks,
+                  "Invalid input argument: block_edge_probabilities.size() should be "
+                  "block_sizes.size() * block_sizes.size().");
+  CUGRAPH_EXPECTS(std::all_of(block_sizes.begin(),
+                              block_sizes.end(),
+                              [](auto size) { return size >= vertex_t{0}; }),
+                  "Invalid input argument: block sizes should be non-negative.");
+  CUGRAPH_EXPECTS(std::all_of(block_edge_probabilities.begin(),
+                              block_edge_probabilities.end(),
+                              [](auto p) { return (p >= 0.0) && (p <= 1.0); }),
+                  "Invalid input argument: block edge probabilities should be in [0, 1].");
+  auto num_vertices =
+    std::accumulate(block_sizes.begin(), block_sizes.end(), uint64_t{0}, [](auto lhs, auto rhs) {
+      return lhs + static_cast<uint64_t>(rhs);
+    });
+  CUGRAPH_EXPECTS(num_vertices <= uint64_t{std::numeric_limits<uint32_t>::max()},
+                  "Implementation cannot support specified value");
+  if (!directed) {
+    for (size_t i = 0; i < num_blocks; ++i) {
+      for (size_t j = i + 1; j < num_blocks; ++j) {
+        CUGRAPH_EXPECTS(
+          block_edge_probabilities[i * num_blocks + j] ==
+            block_edge_probabilities[j * num_blocks + i],
+          "Invalid input argument: block_edge_probabilities should be symmetric if undirected.");
+      }
+    }
+  }
+
+  // 1. enumerate the block pairs with non-zero edge probabilities and split them into chunks
+
+  std::vector<vertex_t> block_firsts(num_blocks, vertex_t{0});
+  if (num_blocks > 0) {
+    std::partial_sum(block_sizes.begin(), block_sizes.end() - 1, block_firsts.begin() + 1);
+  }
+
+  // a chunk holds ~256 selected vertex pairs on average (a tuning parameter)
+  auto constexpr expected_indices_per_chunk = 256.0;
+  std::vector<block_pair_t<vertex_t>> h_block_pairs{};
+  std::vector<size_t> h_block_pair_chunk_offsets{0};
+  for (size_t i = 0; i < num_blocks; ++i) {
+    for (size_t j = directed ? 0 : i; j < num_blocks; ++j) {
+      auto p           = block_edge_probabilities[i * num_blocks + j];
+      auto num_indices = static_cast<size_t>(block_sizes[i]) * static_cast<size_t>(block_sizes[j]);
+      if ((p == 0.0) || (num_indices == 0)) { continue; }
+      auto chunk_size = static_cast<size_t>(
+        std::min(std::ceil(expected_indices_per_chunk / p), static_cast<double>(num_indices)));
+      chunk_size = std::max(chunk_size, size_t{1});
+      h_block_pairs.push_back(block_pair_t<vertex_t>{block_firsts[i],
+                                                     block_firsts[j],
+                                                     static_cast<size_t>(block_sizes[j]),
+                                                     num_indices,
+                                                     chunk_size,
+                                                     std::log1p(-p),
+                                                     i == j});
+      h_block_pair_chunk_offsets.push_back(h_block_pair_chunk_offsets.back() +
+                                           (num_indices - 1) / chunk_size + 1);
+    }
+  }
+
+  rmm::device_uvector<block_pair_t<vertex_t>> block_pairs(h_block_pairs.size(),
+                                                          handle.get_stream());
+  rmm::device_uvector<size_t> block_pair_chunk_offsets(h_block_pair_chunk_offsets.size(),
+                                                       handle.get_stream());
+  raft::update_device(
+    block_pairs.data(), h_block_pairs.data(), h_block_pairs.size(), handle.get_stream());
+  raft::update_device(block_pair_chunk_offsets.data(),
+                      h_block_pair_chunk_offsets.data(),
+                      h_block_pair_chunk_offsets.size(),
+                      handle.get_stream());
+
+  // 2. sample this GPU's (contiguous) range of chunks
+
+  auto num_chunks  = h_block_pair_chunk_offsets.back();
+  auto chunk_first = size_t{0};
+  auto chunk_last  = num_chunks;
+  if (handle.comms_initialized()) {
+    auto const comm_size = static_cast<size_t>(handle.get_comms().get_size());
+    auto const comm_rank = static_cast<size_t>(handle.get_comms().get_rank());
+    chunk_first          = num_chunks * comm_rank / comm_size;
+    chunk_last           = num_chunks * (comm_rank + 1) / comm_size;
+  }
+
+  sbm_chunk_sampler_t<vertex_t> sampler{block_pairs.data(),
+                                        block_pair_chunk_offsets.data(),
+                                        h_block_pairs.size(),
+                                        seed,
+                                        directed};
+
+  rmm::device_uvector<size_t> chunk_offsets(chunk_last - chunk_first + 1, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(chunk_first),
+                    thrust::make_counting_iterator(chunk_last),
+                    chunk_offsets.begin(),
+                    [sampler] __device__(size_t chunk) {
+                      return sampler(chunk, [](size_t, vertex_t, vertex_t) {});
+                    });
+  thrust::exclusive_scan(
+    handle.get_thrust_policy(), chunk_offsets.begin(), chunk_offsets.end(), chunk_offsets.begin());
+  auto num_sampled_edges = chunk_offsets.back_element(handle.get_stream());
+
+  rmm::device_uvector<vertex_t> srcs(num_sampled_edges * (directed ? 1 : 2), handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(srcs.size(), handle.get_stream());
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(chunk_first),
+                   thrust::make_counting_iterator(chunk_last),
+                   [sampler,
+                    chunk_first,
+                    chunk_offsets = chunk_offsets.data(),
+                    srcs          = srcs.data(),
+                    dsts          = dsts.data()] __device__(size_t chunk) {
+                     auto offset = chunk_offsets[chunk - chunk_first];
+                     sampler(chunk, [offset, srcs, dsts](size_t i, vertex_t src, vertex_t dst) {
+                       srcs[offset + i] = src;
+                       dsts[offset + i] = dst;
+                     });
+                   });
+  if (!directed) {
+    thrust::copy(handle.get_thrust_policy(),
+                 thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin())),
+                 thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin())) +
+                   num_sampled_edges,
+                 thrust::make_zip_iterator(thrust::make_tuple(dsts.begin(), srcs.begin())) +
+                   num_sampled_edges);
+  }
+
+  // 3. move the edges to the GPUs that own them
+
+  if (handle.comms_initialized()) {
+    auto& majors = store_transposed ? dsts : srcs;
+    auto& minors = store_transposed ? srcs : dsts;
+    std::tie(majors, minors, std::ignore) =
+      detail::shuffle_edgelist_by_gpu_id(handle,
+                                         std::move(majors),
+                                         std::move(minors),
+                                         std::optional<rmm::device_uvector<float>>{std::nullopt});
+  }
+
+  return std::make_tuple(std::move(srcs), std::move(dsts));
+}
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+generate_stochastic_block_model_edgelist<int32_t>(
+  raft::handle_t const& handle,
+  std::vector<int32_t> const& block_sizes,
+  std::vector<double> const& block_edge_probabilities,
+  bool directed,
+  uint64_t seed,
+  bool store_transposed);
+
+template std::tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+generate_stochastic_block_model_edgelist<int64_t>(
+  raft::handle_t const& handle,
+  std::vector<int64_t> const& block_sizes,
+  std::vector<double> const& block_edge_probabilities,
+  bool directed,
+  uint64_t seed,
+  bool store_transposed);
+
+}  // namespace cugraph
@@ -0,0 +1,1096 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <layout/fa2_kernels.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/collect_comm.cuh>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <cuda_fp16.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// the repulsion pyramid has at most this many levels (level l is a 2^l x 2^l grid), the finest
+// level has 4^9 = 262144 cells and the whole pyramid (every GPU holds a replica) 349525 cells
+int constexpr fa2_max_quadtree_levels{10};
+
+// softening of the Barnes-Hut repulsion (same as the legacy Barnes-Hut kernels)
+float constexpr fa2_repulsion_epssq{0.0025};
+
+// the initial positions are uniformly distributed in [-100, 100) and keyed by the (global) vertex
+// ID, so the layout does not depend on the number of GPUs
+struct fa2_random_position_t {
+  uint64_t seed{0};
+
+  __device__ float operator()(uint64_t key) const
+  {
+    uint64_t z = seed + (key + 1) * uint64_t{0x9e3779b97f4a7c15};  // SplitMix64
+    z          = (z ^ (z >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+    z          = (z ^ (z >> 27)) * uint64_t{0x94d049bb133111eb};
+    z          = z ^ (z >> 31);
+    return static_cast<float>(z >> 40) * (200.0f / 16777216.0f) - 100.0f;  // 2^24
+  }
+};
+
+template <typename vertex_t>
+struct fa2_initial_position_t {
+  vertex_t local_vertex_first{0};
+  fa2_random_position_t random_position{};
+
+  __device__ thrust::tuple<float, float> operator()(vertex_t i) const
+  {
+    auto key = static_cast<uint64_t>(local_vertex_first + i) * 2;
+    return thrust::make_tuple(random_position(key), random_position(key + 1));
+  }
+};
+
+// attraction along the edges (the force on the row vertex), the row properties are (x, y, mass)
+// and the column properties (x, y)
+struct fa2_attraction_e_op_t {
+  float coef{1.0};
+  float edge_weight_influence{1.0};
+  bool outbound_attraction_distribution{true};
+  bool lin_log_mode{false};
+
+  template <typename vertex_t, typename weight_t, typename RowValue, typename ColValue>
+  __device__ thrust::tuple<float, float> operator()(
+    vertex_t, vertex_t, weight_t w, RowValue row_val, ColValue col_val) const
+  {
+    auto x_dist = thrust::get<0>(row_val) - thrust::get<0>(col_val);
+    auto y_dist = thrust::get<1>(row_val) - thrust::get<1>(col_val);
+    auto factor = -coef * powf(static_cast<float>(w), edge_weight_influence);
+    if (lin_log_mode) {
+      auto distance = sqrtf(x_dist * x_dist + y_dist * y_dist + FLT_EPSILON);
+      factor *= logf(1.0f + distance) / distance;
+    }
+    if (outbound_attraction_distribution) { factor /= thrust::get<2>(row_val); }
+    return thrust::make_tuple(x_dist * factor, y_dist * factor);
+  }
+};
+
+// the bounding square of the layout and the cell lookup, level l has 2^l x 2^l cells stored in the
+// Morton (Z) order after the (4^l - 1) / 3 cells of the coarser levels, so the four children of a
+// cell are contiguous and the cells close in space are mostly close in memory
+struct fa2_quadtree_grid_t {
+  float x_first{0.0};
+  float y_first{0.0};
+  float width{1.0};
+  int num_levels{1};
+
+  __device__ static size_t level_offset(int level)
+  {
+    return ((size_t{1} << (2 * level)) - 1) / 3;
+  }
+
+  // spreads the (at most 16) bits of v to the even bit positions
+  __device__ static uint32_t spread_bits(uint32_t v)
+  {
+    v = (v | (v << 8)) & uint32_t{0x00ff00ff};
+    v = (v | (v << 4)) & uint32_t{0x0f0f0f0f};
+    v = (v | (v << 2)) & uint32_t{0x33333333};
+    v = (v | (v << 1)) & uint32_t{0x55555555};
+    return v;
+  }
+
+  // inverse of spread_bits
+  __device__ static uint32_t compact_bits(uint32_t v)
+  {
+    v &= uint32_t{0x55555555};
+    v = (v | (v >> 1)) & uint32_t{0x33333333};
+    v = (v | (v >> 2)) & uint32_t{0x0f0f0f0f};
+    v = (v | (v >> 4)) & uint32_t{0x00ff00ff};
+    v = (v | (v >> 8)) & uint32_t{0x0000ffff};
+    return v;
+  }
+
+  __device__ int coordinate(float pos, float first, int level) const
+  {
+    auto num_cells = int{1} << level;
+    auto c         = static_cast<int>((pos - first) / width * static_cast<float>(num_cells));
+    return c < 0 ? 0 : (c >= num_cells ? num_cells - 1 : c);
+  }
+
+  // Morton code of the finest level cell holding (x, y), the code of the level l cell is this code
+  // shifted right by 2 * (num_levels - 1 - l) bits
+  __device__ uint32_t finest_code(float x, float y) const
+  {
+    return spread_bits(coordinate(x, x_first, num_levels - 1)) |
+           (spread_bits(coordinate(y, y_first, num_levels - 1)) << 1);
+  }
+
+  __device__ uint32_t code(uint32_t finest_code, int level) const
+  {
+    return finest_code >> (2 * (num_levels - 1 - level));
+  }
+
+  __device__ size_t cell(int level, uint32_t code) const { return level_offset(level) + code; }
+
+  __device__ float cell_width(int level) const
+  {
+    return width / static_cast<float>(int{1} << level);
+  }
+
+  __device__ thrust::tuple<float, float> cell_first(int level, uint32_t code) const
+  {
+    auto w = cell_width(level);
+    return thrust::make_tuple(x_first + static_cast<float>(compact_bits(code)) * w,
+                              y_first + static_cast<float>(compact_bits(code >> 1)) * w);
+  }
+};
+
+// the cell sums are accumulated (and all-reduced) in float as three segments of a single buffer:
+// masses, mass * x sums, and mass * y sums
+struct fa2_accumulate_quadtree_t {
+  fa2_quadtree_grid_t grid{};
+  float const* x_pos{nullptr};
+  float const* y_pos{nullptr};
+  float const* mass{nullptr};
+  float* cell_sums{nullptr};
+  size_t num_cells{0};
+
+  template <typename vertex_t>
+  __device__ void operator()(vertex_t i) const
+  {
+    auto x    = x_pos[i];
+    auto y    = y_pos[i];
+    auto m    = mass[i];
+    auto code = grid.finest_code(x, y);
+    for (int l = 0; l < grid.num_levels; ++l) {
+      auto c = grid.cell(l, grid.code(code, l));
+      atomicAdd(cell_sums + c, m);
+      atomicAdd(cell_sums + num_cells + c, m * x);
+      atomicAdd(cell_sums + 2 * num_cells + c, m * y);
+    }
+  }
+};
+
+// the traversal reads one packed record per cell: the mass and the center of mass, the latter
+// either in float (16 byte records) or in half precision as the offset from the cell's corner
+// relative to the cell width (8 byte records, the error is at most about 1/2048 of the cell width)
+struct alignas(16) fa2_quadtree_cell_t {
+  float mass;
+  float x;
+  float y;
+  float padding;
+
+  __device__ static fa2_quadtree_cell_t encode(
+    float mass, float x, float y, float, float, float)
+  {
+    return fa2_quadtree_cell_t{mass, x, y, 0.0f};
+  }
+
+  __device__ thrust::tuple<float, float> center(float, float, float) const
+  {
+    return thrust::make_tuple(x, y);
+  }
+};
+
+struct alignas(8) fa2_half_quadtree_cell_t {
+  float mass;
+  __half2 offset;
+
+  __device__ static fa2_half_quadtree_cell_t encode(
+    float mass, float x, float y, float x_first, float y_first, float width)
+  {
+    return fa2_half_quadtree_cell_t{
+      mass, __floats2half2_rn((x - x_first) / width, (y - y_first) / width)};
+  }
+
+  __device__ thrust::tuple<float, float> center(float x_first, float y_first, float width) const
+  {
+    return thrust::make_tuple(x_first + __low2float(offset) * width,
+                              y_first + __high2float(offset) * width);
+  }
+};
+
+template <typename cell_t>
+struct fa2_pack_quadtree_t {
+  fa2_quadtree_grid_t grid{};
+  float const* cell_sums{nullptr};
+  size_t num_cells{0};
+
+  __device__ cell_t operator()(size_t c) const
+  {
+    int l{0};
+    while (fa2_quadtree_grid_t::level_offset(l + 1) <= c) {
+      ++l;
+    }
+    auto m = cell_sums[c];
+    if (!(m > 0.0f)) { return cell_t::encode(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f); }
+    auto first =
+      grid.cell_first(l, static_cast<uint32_t>(c - fa2_quadtree_grid_t::level_offset(l)));
+    return cell_t::encode(m,
+                          cell_sums[num_cells + c] / m,
+                          cell_sums[2 * num_cells + c] / m,
+                          thrust::get<0>(first),
+                          thrust::get<1>(first),
+                          grid.cell_width(l));
+  }
+};
+
+// Barnes-Hut traversal of the pyramid: a cell not containing the vertex is taken as a single body
+// at its center of mass if (cell width) / distance < theta and is opened otherwise; the cells of
+// the finest level are always taken as single bodies (excluding the vertex itself, from the float
+// sums).
+template <typename cell_t>
+struct fa2_repulsion_t {
+  fa2_quadtree_grid_t grid{};
+  float const* x_pos{nullptr};
+  float const* y_pos{nullptr};
+  float const* mass{nullptr};
+  cell_t const* cells{nullptr};
+  float const* cell_sums{nullptr};
+  size_t num_cells{0};
+  float theta{0.5};
+  float scaling_ratio{2.0};
+
+  template <typename vertex_t>
+  __device__ thrust::tuple<float, float> operator()(vertex_t i) const
+  {
+    auto x           = x_pos[i];
+    auto y           = y_pos[i];
+    auto m           = mass[i];
+    auto theta_2     = theta * theta;
+    auto vertex_code = grid.finest_code(x, y);
+
+    int stack_levels[4 * fa2_max_quadtree_levels];
+    uint32_t stack_codes[4 * fa2_max_quadtree_levels];
+    int stack_size{1};
+    stack_levels[0] = 0;
+    stack_codes[0]  = 0;
+
+    float repel_x{0.0};
+    float repel_y{0.0};
+    while (stack_size > 0) {
+      --stack_size;
+      auto l    = stack_levels[stack_size];
+      auto code = stack_codes[stack_size];
+      auto c    = grid.cell(l, code);
+
+      auto cell = cells[c];
+      if (!(cell.mass > 0.0f)) { continue; }
+      bool finest   = (l + 1 == grid.num_levels);
+      bool contains = grid.code(vertex_code, l) == code;
+      if (finest || !contains) {
+        auto cell_mass = cell.mass;
+        float x_dist{};
+        float y_dist{};
+        if (contains) {
+          cell_mass -= m;
+          if (!(cell_mass > 0.0f)) { continue; }
+          x_dist = x - (cell_sums[num_cells + c] - m * x) / cell_mass;
+          y_dist = y - (cell_sums[2 * num_cells + c] - m * y) / cell_mass;
+        } else {
+          auto first = grid.cell_first(l, code);
+          auto center =
+            cell.center(thrust::get<0>(first), thrust::get<1>(first), grid.cell_width(l));
+          x_dist = x - thrust::get<0>(center);
+          y_dist = y - thrust::get<1>(center);
+        }
+        auto dist_2     = x_dist * x_dist + y_dist * y_dist;
+        auto cell_width = grid.cell_width(l);
+        if (finest || (cell_width * cell_width < theta_2 * dist_2)) {
+          auto factor = scaling_ratio * m * cell_mass / (dist_2 + fa2_repulsion_epssq);
+          repel_x += x_dist * factor;
+          repel_y += y_dist * factor;
+          continue;
+        }
+      }
+      for (uint32_t j = 0; j < 4; ++j) {
+        stack_levels[stack_size] = l + 1;
+        stack_codes[stack_size]  = 4 * code + j;
+        ++stack_size;
+      }
+    }
+
+    return thrust::make_tuple(repel_x, repel_y);
+  }
+};
+
+// packs the cell records and computes the repulsion of the local vertices
+template <typename vertex_t, typename cell_t>
+void apply_fa2_repulsion(raft::handle_t const& handle,
+                         fa2_quadtree_grid_t grid,
+                         float const* x_pos,
+                         float const* y_pos,
+                         float const* mass,
+                         float const* cell_sums,
+                         rmm::device_uvector<cell_t>& cells,
+                         vertex_t num_local_vertices,
+                         float* repel_x,
+                         float* repel_y,
+                         float theta,
+                         float scaling_ratio)
+{
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(cells.size()),
+                    cells.begin(),
+                    fa2_pack_quadtree_t<cell_t>{grid, cell_sums, cells.size()});
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(num_local_vertices),
+                    thrust::make_zip_iterator(thrust::make_tuple(repel_x, repel_y)),
+                    fa2_repulsion_t<cell_t>{grid,
+                                            x_pos,
+                                            y_pos,
+                                            mass,
+                                            cells.data(),
+                                            cell_sums,
+                                            cells.size(),
+                                            theta,
+                                            scaling_ratio});
+}
+
+struct fa2_gravity_t {
+  float gravity{1.0};
+  float scaling_ratio{2.0};
+  bool strong_gravity_mode{false};
+
+  __device__ thrust::tuple<float, float> operator()(thrust::tuple<float, float> attract,
+                                                    thrust::tuple<float, float, float> pos) const
+  {
+    auto x = thrust::get<0>(pos);
+    auto y = thrust::get<1>(pos);
+    auto factor =
+      strong_gravity_mode
+        ? scaling_ratio * thrust::get<2>(pos) * gravity
+        : thrust::get<2>(pos) * gravity / sqrtf(x * x + y * y + FLT_EPSILON);
+    return thrust::make_tuple(thrust::get<0>(attract) - x * factor,
+                              thrust::get<1>(attract) - y * factor);
+  }
+};
+
+// (swinging, traction) of a vertex
+struct fa2_local_speed_t {
+  float const* repel_x{nullptr};
+  float const* repel_y{nullptr};
+  float const* attract_x{nullptr};
+  float const* attract_y{nullptr};
+  float const* old_dx{nullptr};
+  float const* old_dy{nullptr};
+  float const* mass{nullptr};
+
+  template <typename vertex_t>
+  __device__ thrust::tuple<float, float> operator()(vertex_t i) const
+  {
+    auto dx = repel_x[i] + attract_x[i];
+    auto dy = repel_y[i] + attract_y[i];
+    auto sx = old_dx[i] - dx;
+    auto sy = old_dy[i] - dy;
+    auto tx = old_dx[i] + dx;
+    auto ty = old_dy[i] + dy;
+    return thrust::make_tuple(mass[i] * sqrtf(sx * sx + sy * sy),
+                              0.5f * mass[i] * sqrtf(tx * tx + ty * ty));
+  }
+};
+
+struct fa2_update_position_t {
+  float* x_pos{nullptr};
+  float* y_pos{nullptr};
+  float const* repel_x{nullptr};
+  float const* repel_y{nullptr};
+  float const* attract_x{nullptr};
+  float const* attract_y{nullptr};
+  float* old_dx{nullptr};
+  float* old_dy{nullptr};
+  float const* mass{nullptr};
+  float speed{1.0};
+
+  template <typename vertex_t>
+  __device__ void operator()(vertex_t i) const
+  {
+    auto dx = repel_x[i] + attract_x[i];
+    auto dy = repel_y[i] + attract_y[i];
+    auto sx = old_dx[i] - dx;
+    auto sy = old_dy[i] - dy;
+    auto factor = speed / (1.0f + sqrtf(speed * mass[i] * sqrtf(sx * sx + sy * sy)));
+    x_pos[i] += dx * factor;
+    y_pos[i] += dy * factor;
+    old_dx[i] = dx;
+    old_dy[i] = dy;
+  }
+};
+
+struct fa2_bounding_box_op_t {
+  __device__ thrust::tuple<float, float, float, float> operator()(
+    thrust::tuple<float, float, float, float> lhs,
+    thrust::tuple<float, float, float, float> rhs) const
+  {
+    return thrust::make_tuple(fminf(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                              fminf(thrust::get<1>(lhs), thrust::get<1>(rhs)),
+                              fmaxf(thrust::get<2>(lhs), thrust::get<2>(rhs)),
+                              fmaxf(thrust::get<3>(lhs), thrust::get<3>(rhs)));
+  }
+};
+
+struct fa2_point_box_t {
+  __device__ thrust::tuple<float, float, float, float> operator()(
+    thrust::tuple<float, float> pos) const
+  {
+    return thrust::make_tuple(
+      thrust::get<0>(pos), thrust::get<1>(pos), thrust::get<0>(pos), thrust::get<1>(pos));
+  }
+};
+
+struct fa2_tuple_plus_t {
+  __device__ thrust::tuple<float, float> operator()(thrust::tuple<float, float> lhs,
+                                                    thrust::tuple<float, float> rhs) const
+  {
+    return thrust::make_tuple(thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                              thrust::get<1>(lhs) + thrust::get<1>(rhs));
+  }
+};
+
+struct fa2_is_not_finite_t {
+  __device__ bool operator()(float val) const { return !isfinite(val); }
+};
+
+// ForceAtlas2 (M. Jacomy, T. Venturini, S. Heymann, and M. Bastian, "ForceAtlas2, a continuous
+// graph layout algorithm for handy network visualization designed for the Gephi software," 2014)
+// on graph_view_t. Attraction is reduced over the out-going edges by the edge prims (the row and
+// column properties carry the positions), and repulsion is approximated by a Barnes-Hut traversal
+// of a coarse quadtree pyramid over the bounding square of the layout. The pyramid holds only the
+// per-cell mass and mass-weighted position sums, every GPU accumulates its local vertices and an
+// allreduce replicates it, so a GPU needs the positions of its local vertices only.
+template <typename GraphViewType>
+void force_atlas2(raft::handle_t const& handle,
+                  GraphViewType const& graph_view,
+                  float* x_pos,
+                  float* y_pos,
+                  size_t max_iter,
+                  std::optional<float const*> x_start,
+                  std::optional<float const*> y_start,
+                  bool outbound_attraction_distribution,
+                  bool lin_log_mode,
+                  float edge_weight_influence,
+                  float jitter_tolerance,
+                  float barnes_hut_theta,
+                  float scaling_ratio,
+                  bool strong_gravity_mode,
+                  float gravity,
+                  bool verbose,
+                  bool half_precision_quadtree,
+                  bool do_expensive_check)
+{
+  scoped_phase_t phase("force_atlas2", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+  auto const num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: force_atlas2 expects a symmetric graph.");
+  CUGRAPH_EXPECTS(x_start.has_value() == y_start.has_value(),
+                  "Invalid input argument: x_start and y_start should be both set or both unset.");
+  CUGRAPH_EXPECTS(barnes_hut_theta >= 0.0f,
+                  "Invalid input argument: barnes_hut_theta should be non-negative.");
+  CUGRAPH_EXPECTS(scaling_ratio > 0.0f,
+                  "Invalid input argument: scaling_ratio should be positive.");
+
+  if (do_expensive_check && x_start) {
+    auto num_invalids = thrust::count_if(handle.get_thrust_policy(),
+                                         *x_start,
+                                         *x_start + num_local_vertices,
+                                         fa2_is_not_finite_t{}) +
+                        thrust::count_if(handle.get_thrust_policy(),
+                                         *y_start,
+                                         *y_start + num_local_vertices,
+                                         fa2_is_not_finite_t{});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalids = host_scalar_allreduce(
+        handle.get_comms(), num_invalids, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalids == 0,
+                    "Invalid input argument: starting positions should be finite.");
+  }
+
+  // 2. initialize the positions and the masses (degree + 1)
+
+  auto pos_first = thrust::make_zip_iterator(thrust::make_tuple(x_pos, y_pos));
+  if (x_start) {
+    thrust::copy(handle.get_thrust_policy(),
+                 thrust::make_zip_iterator(thrust::make_tuple(*x_start, *y_start)),
+                 thrust::make_zip_iterator(thrust::make_tuple(*x_start, *y_start)) +
+                   num_local_vertices,
+                 pos_first);
+  } else {
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(num_local_vertices),
+      pos_first,
+      fa2_initial_position_t<vertex_t>{graph_view.get_local_vertex_first(),
+                                       fa2_random_position_t{0}});
+  }
+
+  rmm::device_uvector<float> mass(num_local_vertices, handle.get_stream());
+  {
+    auto out_degrees = graph_view.compute_out_degrees(handle);
+    thrust::transform(handle.get_thrust_policy(),
+                      out_degrees.begin(),
+                      out_degrees.end(),
+                      mass.begin(),
+                      [] __device__(auto d) { return static_cast<float>(d) + 1.0f; });
+  }
+
+  float outbound_att_compensation{1.0};
+  if (outbound_attraction_distribution) {
+    auto mass_sum = thrust::reduce(
+      handle.get_thrust_policy(), mass.begin(), mass.end(), double{0.0});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      mass_sum = host_scalar_allreduce(
+        handle.get_comms(), mass_sum, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    outbound_att_compensation = static_cast<float>(mass_sum / static_cast<double>(num_vertices));
+  }
+
+  // 3. force atlas 2 iteration
+
+  rmm::device_uvector<float> repel_x(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<float> repel_y(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<float> attract_x(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<float> attract_y(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<float> old_dx(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<float> old_dy(num_local_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), old_dx.begin(), old_dx.end(), 0.0f);
+  thrust::fill(handle.get_thrust_policy(), old_dy.begin(), old_dy.end(), 0.0f);
+
+  row_properties_t<GraphViewType, thrust::tuple<float, float, float>> adj_matrix_row_pos_masses(
+    handle, graph_view);
+  col_properties_t<GraphViewType, thrust::tuple<float, float>> adj_matrix_col_positions(
+    handle, graph_view);
+
+  // enough levels for about one vertex per finest cell
+  int num_levels{1};
+  while ((num_levels < fa2_max_quadtree_levels) &&
+         ((vertex_t{1} << (2 * (num_levels - 1))) < num_vertices)) {
+    ++num_levels;
+  }
+  auto num_cells = ((size_t{1} << (2 * num_levels)) - 1) / 3;
+  rmm::device_uvector<float> cell_sums(3 * num_cells, handle.get_stream());
+  rmm::device_uvector<fa2_quadtree_cell_t> cells(half_precision_quadtree ? size_t{0} : num_cells,
+                                                 handle.get_stream());
+  rmm::device_uvector<fa2_half_quadtree_cell_t> half_cells(
+    half_precision_quadtree ? num_cells : size_t{0}, handle.get_stream());
+
+  float speed{1.0};
+  float speed_efficiency{1.0};
+  float jt{0.0};
+
+  for (size_t iter = 0; iter < max_iter; ++iter) {
+    nvtx_range_t iteration_range("iteration", static_cast<int64_t>(iter));
+
+    // 3-1. attraction
+
+    copy_to_adj_matrix_row(
+      handle,
+      graph_view,
+      thrust::make_zip_iterator(thrust::make_tuple(x_pos, y_pos, mass.data())),
+      adj_matrix_row_pos_masses);
+    copy_to_adj_matrix_col(handle, graph_view, pos_first, adj_matrix_col_positions);
+
+    copy_v_transform_reduce_out_nbr(
+      handle,
+      graph_view,
+      adj_matrix_row_pos_masses.device_view(),
+      adj_matrix_col_positions.device_view(),
+      fa2_attraction_e_op_t{outbound_att_compensation,
+                            edge_weight_influence,
+                            outbound_attraction_distribution,
+                            lin_log_mode},
+      thrust::make_tuple(float{0.0}, float{0.0}),
+      thrust::make_zip_iterator(thrust::make_tuple(attract_x.begin(), attract_y.begin())));
+
+    // 3-2. gravity
+
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(attract_x.begin(), attract_y.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(attract_x.end(), attract_y.end())),
+      thrust::make_zip_iterator(thrust::make_tuple(x_pos, y_pos, mass.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(attract_x.begin(), attract_y.begin())),
+      fa2_gravity_t{gravity, scaling_ratio, strong_gravity_mode});
+
+    // 3-3. repulsion
+
+    auto init_box = thrust::make_tuple(std::numeric_limits<float>::max(),
+                                       std::numeric_limits<float>::max(),
+                                       std::numeric_limits<float>::lowest(),
+                                       std::numeric_limits<float>::lowest());
+    auto box = thrust::transform_reduce(handle.get_thrust_policy(),
+                                        pos_first,
+                                        pos_first + num_local_vertices,
+                                        fa2_point_box_t{},
+                                        init_box,
+                                        fa2_bounding_box_op_t{});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      // (min x, min y, -max x, -max y) to reduce with a single MIN
+      auto mins = host_scalar_allreduce(handle.get_comms(),
+                                        thrust::make_tuple(thrust::get<0>(box),
+                                                           thrust::get<1>(box),
+                                                           -thrust::get<2>(box),
+                                                           -thrust::get<3>(box)),
+                                        raft::comms::op_t::MIN,
+                                        handle.get_stream());
+      box       = thrust::make_tuple(thrust::get<0>(mins),
+                               thrust::get<1>(mins),
+                               -thrust::get<2>(mins),
+                               -thrust::get<3>(mins));
+    }
+    auto width = std::max(thrust::get<2>(box) - thrust::get<0>(box),
+                          thrust::get<3>(box) - thrust::get<1>(box));
+    width      = width * (1.0f + 1e-4f) + FLT_EPSILON;
+    fa2_quadtree_grid_t grid{thrust::get<0>(box), thrust::get<1>(box), width, num_levels};
+
+    thrust::fill(handle.get_thrust_policy(), cell_sums.begin(), cell_sums.end(), 0.0f);
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(num_local_vertices),
+      fa2_accumulate_quadtree_t{grid, x_pos, y_pos, mass.data(), cell_sums.data(), num_cells});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       cell_sums.begin(),
+                       cell_sums.begin(),
+                       cell_sums.size(),
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+    }
+
+    if (half_precision_quadtree) {
+      apply_fa2_repulsion(handle,
+                          grid,
+                          x_pos,
+                          y_pos,
+                          mass.data(),
+                          cell_sums.data(),
+                          half_cells,
+                          num_local_vertices,
+                          repel_x.data(),
+                          repel_y.data(),
+                          barnes_hut_theta,
+                          scaling_ratio);
+    } else {
+      apply_fa2_repulsion(handle,
+                          grid,
+                          x_pos,
+                          y_pos,
+                          mass.data(),
+                          cell_sums.data(),
+                          cells,
+                          num_local_vertices,
+                          repel_x.data(),
+                          repel_y.data(),
+                          barnes_hut_theta,
+                          scaling_ratio);
+    }
+
+    // 3-4. global swinging & traction, and adapt the speed
+
+    auto speeds = thrust::transform_reduce(handle.get_thrust_policy(),
+                                           thrust::make_counting_iterator(vertex_t{0}),
+                                           thrust::make_counting_iterator(num_local_vertices),
+                                           fa2_local_speed_t{repel_x.data(),
+                                                             repel_y.data(),
+                                                             attract_x.data(),
+                                                             attract_y.data(),
+                                                             old_dx.data(),
+                                                             old_dy.data(),
+                                                             mass.data()},
+                                           thrust::make_tuple(float{0.0}, float{0.0}),
+                                           fa2_tuple_plus_t{});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      speeds = host_scalar_allreduce(
+        handle.get_comms(), speeds, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    auto s = thrust::get<0>(speeds);  // swinging
+    auto t = thrust::get<1>(speeds);  // traction
+
+    // n is passed as float as n * n overflows vertex_t
+    adapt_speed<float>(jitter_tolerance,
+                       &jt,
+                       &speed,
+                       &speed_efficiency,
+                       s,
+                       t,
+                       static_cast<float>(num_vertices));
+
+    // 3-5. move the vertices
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(vertex_t{0}),
+                     thrust::make_counting_iterator(num_local_vertices),
+                     fa2_update_position_t{x_pos,
+                                           y_pos,
+                                           repel_x.data(),
+                                           repel_y.data(),
+                                           attract_x.data(),
+                                           attract_y.data(),
+                                           old_dx.data(),
+                                           old_dy.data(),
+                                           mass.data(),
+                                           speed});
+
+    if (verbose && (!GraphViewType::is_multi_gpu || handle.get_comms().get_rank() == 0)) {
+      std::cout << "iteration: " << iter + 1 << ", speed: " << speed
+                << ", speed_efficiency: " << speed_efficiency << ", jt: " << jt
+                << ", swinging: " << s << ", traction: " << t << "\n";
+    }
+  }
+}
+
+// positions of the coarse vertices (by label) plus a small jitter keyed by the (global) vertex ID,
+// so the vertices of a cluster do not start from the same point
+template <typename vertex_t>
+struct fa2_interpolate_position_t {
+  vertex_t local_vertex_first{0};
+  fa2_random_position_t random_position{};
+  float jitter_scale{0.01};
+
+  __device__ thrust::tuple<float, float> operator()(vertex_t i,
+                                                    thrust::tuple<float, float> coarse_pos) const
+  {
+    auto key = static_cast<uint64_t>(local_vertex_first + i) * 2;
+    return thrust::make_tuple(thrust::get<0>(coarse_pos) + random_position(key) * jitter_scale,
+                              thrust::get<1>(coarse_pos) + random_position(key + 1) * jitter_scale);
+  }
+};
+
+// stop coarsening if a level has no more than this many vertices or shrinks by less than 1/4
+size_t constexpr fa2_min_coarse_vertices{64};
+
+// Multilevel ForceAtlas2 (Y. Hu, "Efficient, high-quality force-directed graph drawing," 2005): the
+// graph is coarsened level by level by contracting single-level Louvain clusters (coarsen_graph),
+// the coarsest graph is laid out with coarse_max_iter iterations, and the positions are
+// interpolated (a vertex starts at its cluster's position) and refined with refine_max_iter
+// iterations on every finer level.
+template <typename GraphViewType>
+void multilevel_force_atlas2(raft::handle_t const& handle,
+                             GraphViewType const& graph_view,
+                             float* x_pos,
+                             float* y_pos,
+                             size_t coarse_max_iter,
+                             size_t refine_max_iter,
+                             size_t max_levels,
+                             bool outbound_attraction_distribution,
+                             bool lin_log_mode,
+                             float edge_weight_influence,
+                             float jitter_tolerance,
+                             float barnes_hut_theta,
+                             float scaling_ratio,
+                             bool strong_gravity_mode,
+                             float gravity,
+                             bool verbose,
+                             bool half_precision_quadtree,
+                             bool do_expensive_check)
+{
+  scoped_phase_t phase("multilevel_force_atlas2", handle.get_stream_view());
+
+  using vertex_t      = typename GraphViewType::vertex_type;
+  using edge_t        = typename GraphViewType::edge_type;
+  using weight_t      = typename GraphViewType::weight_type;
+  using level_graph_t = graph_t<vertex_t, edge_t, weight_t, false, GraphViewType::is_multi_gpu>;
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: force_atlas2 expects a symmetric graph.");
+  CUGRAPH_EXPECTS(max_levels > 0, "Invalid input argument: max_levels should be positive.");
+
+  auto run_fa2 = [&](GraphViewType const& level_graph_view,
+                     float* level_x_pos,
+                     float* level_y_pos,
+                     size_t max_iter,
+                     std::optional<float const*> x_start,
+                     std::optional<float const*> y_start) {
+    detail::force_atlas2(handle,
+                         level_graph_view,
+                         level_x_pos,
+                         level_y_pos,
+                         max_iter,
+                         x_start,
+                         y_start,
+                         outbound_attraction_distribution,
+                         lin_log_mode,
+                         edge_weight_influence,
+                         jitter_tolerance,
+                         barnes_hut_theta,
+                         scaling_ratio,
+                         strong_gravity_mode,
+                         gravity,
+                         verbose,
+                         half_precision_quadtree,
+                         do_expensive_check);
+  };
+
+  // 1. coarsen, coarse_labels[l] maps the local vertices of level l to the vertices of level l + 1
+
+  std::vector<std::unique_ptr<level_graph_t>> coarse_graphs{};
+  std::vector<rmm::device_uvector<vertex_t>> coarse_labels{};
+  auto level_view = [&](size_t l) {
+    return l == 0 ? graph_view : coarse_graphs[l - 1]->view();
+  };
+
+  while (coarse_graphs.size() + 1 < max_levels) {
+    auto fine_view = level_view(coarse_graphs.size());
+    if (static_cast<size_t>(fine_view.get_number_of_vertices()) <= fa2_min_coarse_vertices) {
+      break;
+    }
+
+    rmm::device_uvector<vertex_t> labels(fine_view.get_number_of_local_vertices(),
+                                         handle.get_stream());
+    louvain(handle, fine_view, labels.data(), size_t{1}, weight_t{1});
+
+    std::unique_ptr<level_graph_t> coarse_graph{};
+    rmm::device_uvector<vertex_t> numbering_map(0, handle.get_stream());
+    std::tie(coarse_graph, numbering_map) = coarsen_graph(handle, fine_view, labels.data());
+    auto coarse_view = coarse_graph->view();
+    if (coarse_view.get_number_of_vertices() * 4 > fine_view.get_number_of_vertices() * 3) {
+      break;
+    }
+
+    rmm::device_uvector<vertex_t> numbering_indices(numbering_map.size(), handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(),
+                     numbering_indices.begin(),
+                     numbering_indices.end(),
+                     coarse_view.get_local_vertex_first());
+    relabel<vertex_t, GraphViewType::is_multi_gpu>(
+      handle,
+      std::make_tuple(static_cast<vertex_t const*>(numbering_map.data()),
+                      static_cast<vertex_t const*>(numbering_indices.data())),
+      coarse_view.get_number_of_local_vertices(),
+      labels.data(),
+      static_cast<vertex_t>(labels.size()),
+      false);
+
+    coarse_graphs.push_back(std::move(coarse_graph));
+    coarse_labels.push_back(std::move(labels));
+  }
+
+  if (coarse_graphs.size() == 0) {
+    run_fa2(graph_view, x_pos, y_pos, coarse_max_iter, std::nullopt, std::nullopt);
+    return;
+  }
+
+  // 2. lay out the coarsest graph
+
+  auto coarsest_view = level_view(coarse_graphs.size());
+  rmm::device_uvector<float> coarse_x_pos(coarsest_view.get_number_of_local_vertices(),
+                                          handle.get_stream());
+  rmm::device_uvector<float> coarse_y_pos(coarsest_view.get_number_of_local_vertices(),
+                                          handle.get_stream());
+  run_fa2(coarsest_view,
+          coarse_x_pos.data(),
+          coarse_y_pos.data(),
+          coarse_max_iter,
+          std::nullopt,
+          std::nullopt);
+
+  // 3. interpolate & refine level by level
+
+  for (size_t l = coarse_graphs.size(); l-- > 0;) {
+    auto fine_view          = level_view(l);
+    auto coarse_view        = level_view(l + 1);
+    auto num_local_vertices = fine_view.get_number_of_local_vertices();
+    auto const& labels      = coarse_labels[l];
+
+    rmm::device_uvector<float> x_start(num_local_vertices, handle.get_stream());
+    rmm::device_uvector<float> y_start(num_local_vertices, handle.get_stream());
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto vertex_partition_lasts = coarse_view.get_vertex_partition_lasts();
+      x_start                     = collect_values_for_vertices(handle.get_comms(),
+                                                labels.begin(),
+                                                labels.end(),
+                                                coarse_x_pos.begin(),
+                                                vertex_partition_lasts,
+                                                handle.get_stream());
+      y_start                     = collect_values_for_vertices(handle.get_comms(),
+                                                labels.begin(),
+                                                labels.end(),
+                                                coarse_y_pos.begin(),
+                                                vertex_partition_lasts,
+                                                handle.get_stream());
+    } else {
+      thrust::gather(handle.get_thrust_policy(),
+                     labels.begin(),
+                     labels.end(),
+                     coarse_x_pos.begin(),
+                     x_start.begin());
+      thrust::gather(handle.get_thrust_policy(),
+                     labels.begin(),
+                     labels.end(),
+                     coarse_y_pos.begin(),
+                     y_start.begin());
+    }
+    auto start_first =
+      thrust::make_zip_iterator(thrust::make_tuple(x_start.begin(), y_start.begin()));
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(num_local_vertices),
+      start_first,
+      start_first,
+      fa2_interpolate_position_t<vertex_t>{fine_view.get_local_vertex_first(),
+                                           fa2_random_position_t{static_cast<uint64_t>(l + 1)}});
+
+    if (l == 0) {
+      run_fa2(fine_view, x_pos, y_pos, refine_max_iter, x_start.data(), y_start.data());
+    } else {
+      coarse_x_pos.resize(num_local_vertices, handle.get_stream());
+      coarse_y_pos.resize(num_local_vertices, handle.get_stream());
+      run_fa2(fine_view,
+              coarse_x_pos.data(),
+              coarse_y_pos.data(),
+              refine_max_iter,
+              x_start.data(),
+              y_start.data());
+    }
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void force_atlas2(raft::handle_t const& handle,
+                  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                  float* x_pos,
+                  float* y_pos,
+                  size_t max_iter,
+                  std::optional<float const*> x_start,
+                  std::optional<float const*> y_start,
+                  bool outbound_attraction_distribution,
+                  bool lin_log_mode,
+                  float edge_weight_influence,
+                  float jitter_tolerance,
+                  float barnes_hut_theta,
+                  float scaling_ratio,
+                  bool strong_gravity_mode,
+                  float gravity,
+                  bool verbose,
+                  bool half_precision_quadtree,
+                  bool do_expensive_check)
+{
+  detail::force_atlas2(handle,
+                       graph_view,
+                       x_pos,
+                       y_pos,
+                       max_iter,
+                       x_start,
+                       y_start,
+                       outbound_attraction_distribution,
+                       lin_log_mode,
+                       edge_weight_influence,
+                       jitter_tolerance,
+                       barnes_hut_theta,
+                       scaling_ratio,
+                       strong_gravity_mode,
+                       gravity,
+                       verbose,
+                       half_precision_quadtree,
+                       do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void multilevel_force_atlas2(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  float* x_pos,
+  float* y_pos,
+  size_t coarse_max_iter,
+  size_t refine_max_iter,
+  size_t max_levels,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  float edge_weight_influence,
+  float jitter_tolerance,
+  float barnes_hut_theta,
+  float scaling_ratio,
+  bool strong_gravity_mode,
+  float gravity,
+  bool verbose,
+  bool half_precision_quadtree,
+  bool do_expensive_check)
+{
+  detail::multilevel_force_atlas2(handle,
+                                  graph_view,
+                                  x_pos,
+                                  y_pos,
+                                  coarse_max_iter,
+                                  refine_max_iter,
+                                  max_levels,
+                                  outbound_attraction_distribution,
+                                  lin_log_mode,
+                                  edge_weight_influence,
+                                  jitter_tolerance,
+                                  barnes_hut_theta,
+                                  scaling_ratio,
+                                  strong_gravity_mode,
+                                  gravity,
+                                  verbose,
+                                  half_precision_quadtree,
+                                  do_expensive_check);
+}
+
+}  // namespace cugraph
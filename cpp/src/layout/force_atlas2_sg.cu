@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <layout/force_atlas2_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void force_atlas2(raft::handle_t const& handle,
+                           graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+                           float* x_pos,
+                           float* y_pos,
+                           size_t max_iter,
+                           std::optional<float const*> x_start,
+                           std::optional<float const*> y_start,
+                           bool outbound_attraction_distribution,
+                           bool lin_log_mode,
+                           float edge_weight_influence,
+                           float jitter_tolerance,
+                           float barnes_hut_theta,
+                           float scaling_ratio,
+                           bool strong_gravity_mode,
+                           float gravity,
+                           bool verbose,
+                           bool half_precision_quadtree,
+                           bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void force_atlas2(raft::handle_t const& handle,
+                           graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+                           float* x_pos,
+                           float* y_pos,
+                           size_t max_iter,
+                           std::optional<float const*> x_start,
+                           std::optional<float const*> y_start,
+                           bool outbound_attraction_distribution,
+                           bool lin_log_mode,
+                           float edge_weight_influence,
+                           float jitter_tolerance,
+                           float barnes_hut_theta,
+                           float scaling_ratio,
+                           bool strong_gravity_mode,
+                           float gravity,
+                           bool verbose,
+                           bool half_precision_quadtree,
+                           bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void force_atlas2(raft::handle_t const& handle,
+                           graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+                           float* x_pos,
+                           float* y_pos,
+                           size_t max_iter,
+                           std::optional<float const*> x_start,
+                           std::optional<float const*> y_start,
+                           bool outbound_attraction_distribution,
+                           bool lin_log_mode,
+                           float edge_weight_influence,
+                           float jitter_tolerance,
+                           float barnes_hut_theta,
+                           float scaling_ratio,
+                           bool strong_gravity_mode,
+                           float gravity,
+                           bool verbose,
+                           bool half_precision_quadtree,
+                           bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void force_atlas2(raft::handle_t const& handle,
+                           graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+                           float* x_pos,
+                           float* y_pos,
+                           size_t max_iter,
+                           std::optional<float const*> x_start,
+                           std::optional<float const*> y_start,
+                           bool outbound_attraction_distribution,
+                           bool lin_log_mode,
+                           float edge_weight_influence,
+                           float jitter_tolerance,
+                           float barnes_hut_theta,
+                           float scaling_ratio,
+                           bool strong_gravity_mode,
+                           float gravity,
+                           bool verbose,
+                           bool half_precision_quadtree,
+                           bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void force_atlas2(raft::handle_t const& handle,
+                           graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+                           float* x_pos,
+                           float* y_pos,
+                           size_t max_iter,
+                           std::optional<float const*> x_start,
+                           std::optional<float const*> y_start,
+                           bool outbound_attraction_distribution,
+                           bool lin_log_mode,
+                           float edge_weight_influence,
+                           float jitter_tolerance,
+                           float barnes_hut_theta,
+                           float scaling_ratio,
+                           bool strong_gravity_mode,
+                           float gravity,
+                           bool verbose,
+                           bool half_precision_quadtree,
+                           bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void force_atlas2(raft::handle_t const& handle,
+                           graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+                           float* x_pos,
+                           float* y_pos,
+                           size_t max_iter,
+                           std::optional<float const*> x_start,
+                           std::optional<float const*> y_start,
+                           bool outbound_attraction_distribution,
+                           bool lin_log_mode,
+                           float edge_weight_influence,
+                           float jitter_tolerance,
+                           float barnes_hut_theta,
+                           float scaling_ratio,
+                           bool strong_gravity_mode,
+                           float gravity,
+                           bool verbose,
+                           bool half_precision_quadtree,
+                           bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void multilevel_force_atlas2(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  float* x_pos,
+  float* y_pos,
+  size_t coarse_max_iter,
+  size_t refine_max_iter,
+  size_t max_levels,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  float edge_weight_influence,
+  float jitter_tolerance,
+  float barnes_hut_theta,
+  float scaling_ratio,
+  bool strong_gravity_mode,
+  float gravity,
+  bool verbose,
+  bool half_precision_quadtree,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void multilevel_force_atlas2(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  float* x_pos,
+  float* y_pos,
+  size_t coarse_max_iter,
+  size_t refine_max_iter,
+  size_t max_levels,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  float edge_weight_influence,
+  float jitter_tolerance,
+  float barnes_hut_theta,
+  float scaling_ratio,
+  bool strong_gravity_mode,
+  float gravity,
+  bool verbose,
+  bool half_precision_quadtree,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void multilevel_force_atlas2(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  float* x_pos,
+  float* y_pos,
+  size_t coarse_max_iter,
+  size_t refine_max_iter,
+  size_t max_levels,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  float edge_weight_influence,
+  float jitter_tolerance,
+  float barnes_hut_theta,
+  float scaling_ratio,
+  bool strong_gravity_mode,
+  float gravity,
+  bool verbose,
+  bool half_precision_quadtree,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void multilevel_force_atlas2(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  float* x_pos,
+  float* y_pos,
+  size_t coarse_max_iter,
+  size_t refine_max_iter,
+  size_t max_levels,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  float edge_weight_influence,
+  float jitter_tolerance,
+  float barnes_hut_theta,
+  float scaling_ratio,
+  bool strong_gravity_mode,
+  float gravity,
+  bool verbose,
+  bool half_precision_quadtree,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void multilevel_force_atlas2(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  float* x_pos,
+  float* y_pos,
+  size_t coarse_max_iter,
+  size_t refine_max_iter,
+  size_t max_levels,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  float edge_weight_influence,
+  float jitter_tolerance,
+  float barnes_hut_theta,
+  float scaling_ratio,
+  bool strong_gravity_mode,
+  float gravity,
+  bool verbose,
+  bool half_precision_quadtree,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void multilevel_force_atlas2(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  float* x_pos,
+  float* y_pos,
+  size_t coarse_max_iter,
+  size_t refine_max_iter,
+  size_t max_levels,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  float edge_weight_influence,
+  float jitter_tolerance,
+  float barnes_hut_theta,
+  float scaling_ratio,
+  bool strong_gravity_mode,
+  float gravity,
+  bool verbose,
+  bool half_precision_quadtree,
+  bool do_expensive_check);
+#endif
+
+}  // namespace cugraph
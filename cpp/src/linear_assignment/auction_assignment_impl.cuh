@@ -0,0 +1,663 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/extract_if_e.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+uint8_t constexpr auction_non_worker{0};
+uint8_t constexpr auction_active_worker{1};
+uint8_t constexpr auction_priced_out_worker{2};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_worker_to_job_e_op_t {
+  __device__ bool operator()(vertex_t, vertex_t, uint8_t src_state, uint8_t dst_state) const
+  {
+    return (src_state != auction_non_worker) && (dst_state == auction_non_worker);
+  }
+};
+
+// (value of the best job (benefit - price), weight of the edge to the best job, best job, value of
+// the second best job (over the jobs other than the best job))
+template <typename vertex_t, typename weight_t>
+using auction_candidate_t = thrust::tuple<weight_t, weight_t, vertex_t, weight_t>;
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct auction_edge_candidate_t {
+  vertex_t const* dsts{nullptr};
+  weight_t const* weights{nullptr};
+  weight_t const* adj_matrix_col_prices{nullptr};
+  vertex_t col_first{};
+  weight_t max_weight{};
+
+  __device__ auction_candidate_t<vertex_t, weight_t> operator()(size_t i) const
+  {
+    auto dst = dsts[i];
+    auto w   = weights[i];
+    return thrust::make_tuple((max_weight - w) - adj_matrix_col_prices[dst - col_first],
+                              w,
+                              dst,
+                              std::numeric_limits<weight_t>::lowest());
+  }
+};
+
+// keeps the best (value, then smaller job ID) job and the best value of the remaining jobs; the
+// result does not depend on the reduction order, so SG and MG pick the same bids
+template <typename vertex_t, typename weight_t>
+struct top2_candidate_t {
+  __device__ auction_candidate_t<vertex_t, weight_t> operator()(
+    auction_candidate_t<vertex_t, weight_t> lhs, auction_candidate_t<vertex_t, weight_t> rhs) const
+  {
+    if (thrust::get<2>(lhs) == thrust::get<2>(rhs)) {  // multi-edges
+      auto second = thrust::max(thrust::get<3>(lhs), thrust::get<3>(rhs));
+      auto& first = thrust::get<0>(lhs) >= thrust::get<0>(rhs) ? lhs : rhs;
+      return thrust::make_tuple(
+        thrust::get<0>(first), thrust::get<1>(first), thrust::get<2>(first), second);
+    }
+    bool lhs_first = (thrust::get<0>(lhs) > thrust::get<0>(rhs)) ||
+                     ((thrust::get<0>(lhs) == thrust::get<0>(rhs)) &&
+                      (thrust::get<2>(lhs) < thrust::get<2>(rhs)));
+    auto& first  = lhs_first ? lhs : rhs;
+    auto& second = lhs_first ? rhs : lhs;
+    return thrust::make_tuple(thrust::get<0>(first),
+                              thrust::get<1>(first),
+                              thrust::get<2>(first),
+                              thrust::max(thrust::get<3>(first), thrust::get<0>(second)));
+  }
+};
+
+// (bid price, bidding worker, weight of the edge to the job)
+template <typename vertex_t, typename weight_t>
+using auction_bid_t = thrust::tuple<weight_t, vertex_t, weight_t>;
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct max_bid_t {
+  __device__ auction_bid_t<vertex_t, weight_t> operator()(
+    auction_bid_t<vertex_t, weight_t> lhs, auction_bid_t<vertex_t, weight_t> rhs) const
+  {
+    return ((thrust::get<0>(lhs) > thrust::get<0>(rhs)) ||
+            ((thrust::get<0>(lhs) == thrust::get<0>(rhs)) &&
+             (thrust::get<1>(lhs) < thrust::get<1>(rhs))))
+             ? lhs
+             : rhs;
+  }
+};
+
+// shuffles the tuples in [tuple_first, tuple_first + num_tuples) to the GPUs owning the vertex
+// stored in the first tuple element
+template <typename vertex_t, typename TupleIterator>
+auto auction_shuffle_to_vertex_owners(raft::handle_t const& handle,
+                                      TupleIterator tuple_first,
+                                      size_t num_tuples,
+                                      rmm::device_uvector<vertex_t> const& d_vertex_partition_lasts)
+{
+  auto [rx_tuples, rx_counts] = groupby_gpuid_and_shuffle_values(
+    handle.get_comms(),
+    tuple_first,
+    tuple_first + num_tuples,
+    [vertex_partition_lasts = d_vertex_partition_lasts.data(),
+     num_vertex_partitions  = d_vertex_partition_lasts.size()] __device__(auto val) {
+      return static_cast<int>(
+        thrust::distance(vertex_partition_lasts,
+                         thrust::upper_bound(thrust::seq,
+                                             vertex_partition_lasts,
+                                             vertex_partition_lasts + num_vertex_partitions,
+                                             thrust::get<0>(val))));
+    },
+    handle.get_stream());
+  return std::move(rx_tuples);
+}
+
+// Forward auction (Bertsekas) with epsilon-scaling on the worker -> job edges of the input graph.
+// Every round, each unassigned worker bids for its best job (maximizing benefit - price, benefit =
+// max. weight - weight) raising the price by the difference between the best and the second best
+// values + epsilon, each job goes to its highest bidder, and the previous owner becomes unassigned.
+// A phase ends when no worker bids, and the next phase restarts the assignment with a smaller
+// epsilon keeping the prices. The worker -> job edge list is extracted once and stays on the GPUs
+// holding the edges (memory is linear in the number of edges); in multi-GPU, the per-worker
+// candidates are reduced on the GPUs owning the workers and the bids on the GPUs owning the jobs.
+template <typename GraphViewType>
+typename GraphViewType::weight_type auction_assignment(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  typename GraphViewType::vertex_type const* workers,
+  typename GraphViewType::vertex_type num_workers,
+  typename GraphViewType::vertex_type* assignments,
+  std::optional<typename GraphViewType::weight_type> epsilon,
+  typename GraphViewType::weight_type epsilon_scaling_factor,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  scoped_phase_t phase("auction_assignment", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<weight_t>::value,
+                "GraphViewType::weight_type should be a floating point type.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const local_vertex_first      = push_graph_view.get_local_vertex_first();
+  auto const num_local_vertices      = push_graph_view.get_number_of_local_vertices();
+  auto const local_vertex_last       = local_vertex_first + num_local_vertices;
+  auto const invalid_vertex          = invalid_vertex_id<vertex_t>::value;
+  auto const& vertex_partition_lasts = push_graph_view.get_vertex_partition_lasts();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(push_graph_view.is_weighted(),
+                  "Invalid input argument: input graph should be weighted for auction assignment.");
+  CUGRAPH_EXPECTS((num_workers == 0) || (workers != nullptr),
+                  "Invalid input argument: workers should not be nullptr if num_workers > 0.");
+  CUGRAPH_EXPECTS((num_workers == 0) || (assignments != nullptr),
+                  "Invalid input argument: assignments should not be nullptr if num_workers > 0.");
+  CUGRAPH_EXPECTS(!epsilon || (*epsilon > weight_t{0.0}),
+                  "Invalid input argument: epsilon should be positive.");
+  CUGRAPH_EXPECTS(epsilon_scaling_factor > weight_t{1.0},
+                  "Invalid input argument: epsilon_scaling_factor should be larger than 1.");
+
+  if (do_expensive_check) {
+    auto num_invalid_workers = thrust::count_if(
+      handle.get_thrust_policy(),
+      workers,
+      workers + num_workers,
+      [local_vertex_first, local_vertex_last] __device__(auto v) {
+        return (v < local_vertex_first) || (v >= local_vertex_last);
+      });
+    if (GraphViewType::is_multi_gpu) {
+      num_invalid_workers = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_workers, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_workers == 0,
+                    "Invalid input argument: workers should be local vertices of this GPU.");
+
+    rmm::device_uvector<vertex_t> sorted_workers(num_workers, handle.get_stream());
+    thrust::copy(
+      handle.get_thrust_policy(), workers, workers + num_workers, sorted_workers.begin());
+    thrust::sort(handle.get_thrust_policy(), sorted_workers.begin(), sorted_workers.end());
+    CUGRAPH_EXPECTS(
+      thrust::distance(
+        sorted_workers.begin(),
+        thrust::unique(handle.get_thrust_policy(), sorted_workers.begin(), sorted_workers.end())) ==
+        static_cast<std::ptrdiff_t>(num_workers),
+      "Invalid input argument: workers should not have duplicates.");
+  }
+
+  // 2. mark the workers and extract the worker -> job edges (sorted by worker)
+
+  rmm::device_uvector<uint8_t> worker_states(num_local_vertices, handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), worker_states.begin(), worker_states.end(), auction_non_worker);
+  thrust::for_each(handle.get_thrust_policy(),
+                   workers,
+                   workers + num_workers,
+                   [worker_states = worker_states.data(), local_vertex_first] __device__(auto v) {
+                     worker_states[v - local_vertex_first] = auction_active_worker;
+                   });
+
+  rmm::device_uvector<vertex_t> srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(0, handle.get_stream());
+  rmm::device_uvector<weight_t> weights(0, handle.get_stream());
+  {
+    row_properties_t<GraphViewType, uint8_t> adj_matrix_row_states(handle, push_graph_view);
+    col_properties_t<GraphViewType, uint8_t> adj_matrix_col_states(handle, push_graph_view);
+    copy_to_adj_matrix_row(handle, push_graph_view, worker_states.begin(), adj_matrix_row_states);
+    copy_to_adj_matrix_col(handle, push_graph_view, worker_states.begin(), adj_matrix_col_states);
+
+    std::optional<rmm::device_uvector<weight_t>> edge_weights{std::nullopt};
+    std::tie(srcs, dsts, edge_weights) = extract_if_e(handle,
+                                                      push_graph_view,
+                                                      adj_matrix_row_states.device_view(),
+                                                      adj_matrix_col_states.device_view(),
+                                                      is_worker_to_job_e_op_t<vertex_t>{});
+    weights = std::move(*edge_weights);
+  }
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      srcs.begin(),
+                      srcs.end(),
+                      thrust::make_zip_iterator(thrust::make_tuple(dsts.begin(), weights.begin())));
+
+  // 3. set the benefit range and the epsilon schedule
+
+  auto aggregate_num_workers = num_workers;
+  auto min_weight            = std::numeric_limits<weight_t>::max();
+  auto max_weight            = std::numeric_limits<weight_t>::lowest();
+  if (weights.size() > 0) {
+    min_weight = thrust::reduce(handle.get_thrust_policy(),
+                                weights.begin(),
+                                weights.end(),
+                                std::numeric_limits<weight_t>::max(),
+                                thrust::minimum<weight_t>{});
+    max_weight = thrust::reduce(handle.get_thrust_policy(),
+                                weights.begin(),
+                                weights.end(),
+                                std::numeric_limits<weight_t>::lowest(),
+                                thrust::maximum<weight_t>{});
+  }
+  if (GraphViewType::is_multi_gpu) {
+    aggregate_num_workers = host_scalar_allreduce(
+      handle.get_comms(), num_workers, raft::comms::op_t::SUM, handle.get_stream());
+    min_weight = host_scalar_allreduce(
+      handle.get_comms(), min_weight, raft::comms::op_t::MIN, handle.get_stream());
+    max_weight = host_scalar_allreduce(
+      handle.get_comms(), max_weight, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  rmm::device_uvector<vertex_t> worker_assignments(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> job_owners(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<weight_t> job_prices(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<weight_t> job_weights(num_local_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               worker_assignments.begin(),
+               worker_assignments.end(),
+               invalid_vertex);
+  thrust::fill(handle.get_thrust_policy(), job_owners.begin(), job_owners.end(), invalid_vertex);
+  thrust::fill(handle.get_thrust_policy(), job_prices.begin(), job_prices.end(), weight_t{0.0});
+
+  weight_t total_cost{0.0};
+  if (max_weight >= min_weight) {
+    auto benefit_range = thrust::max(max_weight - min_weight, weight_t{1.0});
+
+    // 1 / (number of workers + 1) makes the assignment optimal for integer weights
+    auto final_epsilon = epsilon ? *epsilon : weight_t{1.0} / (aggregate_num_workers + 1);
+    std::vector<weight_t> epsilons{};
+    for (auto eps = benefit_range / epsilon_scaling_factor; eps > final_epsilon;
+         eps /= epsilon_scaling_factor) {
+      epsilons.push_back(eps);
+    }
+    epsilons.push_back(final_epsilon);
+
+    // a worker whose best value falls below this bound is priced out (this exceeds the price
+    // increase needed to reach an assignment if every worker can be assigned, so only the workers
+    // left over in an incomplete assignment are priced out)
+    auto price_bound = (weight_t{2.0} * aggregate_num_workers + weight_t{1.0}) *
+                       (benefit_range + epsilons[0]);
+
+    rmm::device_uvector<vertex_t> d_vertex_partition_lasts(0, handle.get_stream());
+    if constexpr (GraphViewType::is_multi_gpu) {
+      d_vertex_partition_lasts.resize(vertex_partition_lasts.size(), handle.get_stream());
+      raft::update_device(d_vertex_partition_lasts.data(),
+                          vertex_partition_lasts.data(),
+                          vertex_partition_lasts.size(),
+                          handle.get_stream());
+    }
+
+    col_properties_t<GraphViewType, weight_t> adj_matrix_col_prices(handle, push_graph_view);
+    auto col_first = push_graph_view.get_local_adj_matrix_partition_col_first();
+
+    // 4. run the auction phases
+
+    size_t iter{0};
+    for (size_t p = 0; p < epsilons.size(); ++p) {
+      auto eps = epsilons[p];
+      nvtx_range_t phase_range("epsilon_phase", static_cast<int64_t>(p));
+
+      thrust::fill(handle.get_thrust_policy(),
+                   worker_assignments.begin(),
+                   worker_assignments.end(),
+                   invalid_vertex);
+      thrust::fill(
+        handle.get_thrust_policy(), job_owners.begin(), job_owners.end(), invalid_vertex);
+
+      while (true) {
+        CUGRAPH_EXPECTS(iter < max_iterations, "Auction assignment failed to converge.");
+        ++iter;
+        profiler_add_counter("rounds", 1);
+
+        // 4-1. find the best and the second best jobs of every worker
+
+        copy_to_adj_matrix_col(handle, push_graph_view, job_prices.begin(), adj_matrix_col_prices);
+
+        rmm::device_uvector<vertex_t> candidate_workers(srcs.size(), handle.get_stream());
+        rmm::device_uvector<weight_t> candidate_values(srcs.size(), handle.get_stream());
+        rmm::device_uvector<weight_t> candidate_weights(srcs.size(), handle.get_stream());
+        rmm::device_uvector<vertex_t> candidate_jobs(srcs.size(), handle.get_stream());
+        rmm::device_uvector<weight_t> candidate_second_values(srcs.size(), handle.get_stream());
+        {
+          auto candidate_first = thrust::make_zip_iterator(thrust::make_tuple(
+            candidate_values.begin(),
+            candidate_weights.begin(),
+            candidate_jobs.begin(),
+            candidate_second_values.begin()));
+          auto num_candidates = static_cast<size_t>(thrust::distance(
+            candidate_workers.begin(),
+            thrust::get<0>(thrust::reduce_by_key(
+              handle.get_thrust_policy(),
+              srcs.begin(),
+              srcs.end(),
+              thrust::make_transform_iterator(
+                thrust::make_counting_iterator(size_t{0}),
+                auction_edge_candidate_t<vertex_t, weight_t>{
+                  dsts.data(),
+                  weights.data(),
+                  adj_matrix_col_prices.device_view().value_data(),
+                  col_first,
+                  max_weight}),
+              candidate_workers.begin(),
+              candidate_first,
+              thrust::equal_to<vertex_t>{},
+              top2_candidate_t<vertex_t, weight_t>{}))));
+          candidate_workers.resize(num_candidates, handle.get_stream());
+          candidate_values.resize(num_candidates, handle.get_stream());
+          candidate_weights.resize(num_candidates, handle.get_stream());
+          candidate_jobs.resize(num_candidates, handle.get_stream());
+          candidate_second_values.resize(num_candidates, handle.get_stream());
+        }
+
+        if constexpr (GraphViewType::is_multi_gpu) {
+          auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(
+            candidate_workers.begin(),
+            candidate_values.begin(),
+            candidate_weights.begin(),
+            candidate_jobs.begin(),
+            candidate_second_values.begin()));
+          rmm::device_uvector<vertex_t> rx_workers(0, handle.get_stream());
+          rmm::device_uvector<weight_t> rx_values(0, handle.get_stream());
+          rmm::device_uvector<weight_t> rx_weights(0, handle.get_stream());
+          rmm::device_uvector<vertex_t> rx_jobs(0, handle.get_stream());
+          rmm::device_uvector<weight_t> rx_second_values(0, handle.get_stream());
+          std::tie(rx_workers, rx_values, rx_weights, rx_jobs, rx_second_values) =
+            auction_shuffle_to_vertex_owners(
+              handle, pair_first, candidate_workers.size(), d_vertex_partition_lasts);
+
+          auto rx_first = thrust::make_zip_iterator(thrust::make_tuple(
+            rx_values.begin(), rx_weights.begin(), rx_jobs.begin(), rx_second_values.begin()));
+          thrust::sort_by_key(
+            handle.get_thrust_policy(), rx_workers.begin(), rx_workers.end(), rx_first);
+          candidate_workers.resize(rx_workers.size(), handle.get_stream());
+          candidate_values.resize(candidate_workers.size(), handle.get_stream());
+          candidate_weights.resize(candidate_workers.size(), handle.get_stream());
+          candidate_jobs.resize(candidate_workers.size(), handle.get_stream());
+          candidate_second_values.resize(candidate_workers.size(), handle.get_stream());
+          auto candidate_first = thrust::make_zip_iterator(thrust::make_tuple(
+            candidate_values.begin(),
+            candidate_weights.begin(),
+            candidate_jobs.begin(),
+            candidate_second_values.begin()));
+          auto num_candidates = static_cast<size_t>(thrust::distance(
+            candidate_workers.begin(),
+            thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                                 rx_workers.begin(),
+                                                 rx_workers.end(),
+                                                 rx_first,
+                                                 candidate_workers.begin(),
+                                                 candidate_first,
+                                                 thrust::equal_to<vertex_t>{},
+                                                 top2_candidate_t<vertex_t, weight_t>{}))));
+          candidate_workers.resize(num_candidates, handle.get_stream());
+          candidate_values.resize(num_candidates, handle.get_stream());
+          candidate_weights.resize(num_candidates, handle.get_stream());
+          candidate_jobs.resize(num_candidates, handle.get_stream());
+          candidate_second_values.resize(num_candidates, handle.get_stream());
+        }
+
+        // 4-2. unassigned workers bid (or are priced out), the bids overwrite the candidates
+
+        auto candidate_first = thrust::make_zip_iterator(thrust::make_tuple(
+          candidate_workers.begin(),
+          candidate_values.begin(),
+          candidate_weights.begin(),
+          candidate_jobs.begin(),
+          candidate_second_values.begin()));
+        thrust::transform(
+          handle.get_thrust_policy(),
+          candidate_first,
+          candidate_first + candidate_workers.size(),
+          candidate_first,
+          [worker_states      = worker_states.data(),
+           worker_assignments = worker_assignments.data(),
+           local_vertex_first,
+           max_weight,
+           price_bound,
+           eps,
+           invalid_vertex] __device__(auto candidate) {
+            auto worker       = thrust::get<0>(candidate);
+            auto value        = thrust::get<1>(candidate);
+            auto w            = thrust::get<2>(candidate);
+            auto job          = thrust::get<3>(candidate);
+            auto second_value = thrust::max(thrust::get<4>(candidate), -price_bound);
+            auto offset       = worker - local_vertex_first;
+            if ((worker_states[offset] != auction_active_worker) ||
+                (worker_assignments[offset] != invalid_vertex)) {
+              job = invalid_vertex;
+            } else if (value < -price_bound) {
+              worker_states[offset] = auction_priced_out_worker;
+              job                   = invalid_vertex;
+            }
+            // bid price = price + (value - second value) + epsilon
+            return thrust::make_tuple(job, (max_weight - w) - second_value + eps, w, worker, w);
+          });
+        auto num_bids = static_cast<size_t>(thrust::distance(
+          candidate_first,
+          thrust::remove_if(handle.get_thrust_policy(),
+                            candidate_first,
+                            candidate_first + candidate_workers.size(),
+                            [invalid_vertex] __device__(auto bid) {
+                              return thrust::get<0>(bid) == invalid_vertex;
+                            })));
+        auto bid_jobs    = std::move(candidate_workers);
+        auto bid_prices  = std::move(candidate_values);
+        auto bid_workers = std::move(candidate_jobs);
+        auto bid_weights = std::move(candidate_weights);
+        bid_jobs.resize(num_bids, handle.get_stream());
+        bid_prices.resize(num_bids, handle.get_stream());
+        bid_workers.resize(num_bids, handle.get_stream());
+        bid_weights.resize(num_bids, handle.get_stream());
+        candidate_second_values.resize(0, handle.get_stream());
+        candidate_second_values.shrink_to_fit(handle.get_stream());
+
+        auto aggregate_num_bids = num_bids;
+        if (GraphViewType::is_multi_gpu) {
+          aggregate_num_bids = host_scalar_allreduce(
+            handle.get_comms(), num_bids, raft::comms::op_t::SUM, handle.get_stream());
+        }
+        if (aggregate_num_bids == 0) { break; }
+
+        // 4-3. assign every job with bids to the highest bidder
+
+        if constexpr (GraphViewType::is_multi_gpu) {
+          auto bid_first = thrust::make_zip_iterator(thrust::make_tuple(
+            bid_jobs.begin(), bid_prices.begin(), bid_workers.begin(), bid_weights.begin()));
+          std::tie(bid_jobs, bid_prices, bid_workers, bid_weights) =
+            auction_shuffle_to_vertex_owners(
+              handle, bid_first, bid_jobs.size(), d_vertex_partition_lasts);
+        }
+
+        auto bid_value_first = thrust::make_zip_iterator(
+          thrust::make_tuple(bid_prices.begin(), bid_workers.begin(), bid_weights.begin()));
+        thrust::sort_by_key(
+          handle.get_thrust_policy(), bid_jobs.begin(), bid_jobs.end(), bid_value_first);
+        rmm::device_uvector<vertex_t> winning_jobs(bid_jobs.size(), handle.get_stream());
+        rmm::device_uvector<weight_t> winning_prices(bid_jobs.size(), handle.get_stream());
+        rmm::device_uvector<vertex_t> winning_workers(bid_jobs.size(), handle.get_stream());
+        rmm::device_uvector<weight_t> winning_weights(bid_jobs.size(), handle.get_stream());
+        auto num_winning_bids = static_cast<size_t>(thrust::distance(
+          winning_jobs.begin(),
+          thrust::get<0>(thrust::reduce_by_key(
+            handle.get_thrust_policy(),
+            bid_jobs.begin(),
+            bid_jobs.end(),
+            bid_value_first,
+            winning_jobs.begin(),
+            thrust::make_zip_iterator(thrust::make_tuple(
+              winning_prices.begin(), winning_workers.begin(), winning_weights.begin())),
+            thrust::equal_to<vertex_t>{},
+            max_bid_t<vertex_t, weight_t>{}))));
+
+        // 4-4. update the job owners and prices (the winning bids are overwritten with the updates
+        // to the winning and the evicted workers)
+
+        rmm::device_uvector<vertex_t> update_workers(num_winning_bids * 2, handle.get_stream());
+        rmm::device_uvector<vertex_t> update_jobs(update_workers.size(), handle.get_stream());
+        thrust::for_each(
+          handle.get_thrust_policy(),
+          thrust::make_counting_iterator(size_t{0}),
+          thrust::make_counting_iterator(num_winning_bids),
+          [winning_jobs    = winning_jobs.data(),
+           winning_prices  = winning_prices.data(),
+           winning_workers = winning_workers.data(),
+           winning_weights = winning_weights.data(),
+           job_owners      = job_owners.data(),
+           job_prices      = job_prices.data(),
+           job_weights     = job_weights.data(),
+           update_workers  = update_workers.data(),
+           update_jobs     = update_jobs.data(),
+           num_winning_bids,
+           local_vertex_first,
+           invalid_vertex] __device__(auto i) {
+            auto job                             = winning_jobs[i];
+            auto offset                          = job - local_vertex_first;
+            update_workers[i]                    = winning_workers[i];
+            update_jobs[i]                       = job;
+            update_workers[num_winning_bids + i] = job_owners[offset];
+            update_jobs[num_winning_bids + i]    = invalid_vertex;
+            job_owners[offset]                   = winning_workers[i];
+            job_prices[offset]                   = winning_prices[i];
+            job_weights[offset]                  = winning_weights[i];
+          });
+        auto update_first = thrust::make_zip_iterator(
+          thrust::make_tuple(update_workers.begin(), update_jobs.begin()));
+        auto num_updates = static_cast<size_t>(thrust::distance(
+          update_first,
+          thrust::remove_if(handle.get_thrust_policy(),
+                            update_first,
+                            update_first + update_workers.size(),
+                            [invalid_vertex] __device__(auto pair) {
+                              return thrust::get<0>(pair) == invalid_vertex;
+                            })));
+        update_workers.resize(num_updates, handle.get_stream());
+        update_jobs.resize(num_updates, handle.get_stream());
+
+        // 4-5. apply the updates to the workers (a worker bids only when unassigned, so a worker is
+        // either a winner or evicted in a round)
+
+        if constexpr (GraphViewType::is_multi_gpu) {
+          auto pair_first = thrust::make_zip_iterator(
+            thrust::make_tuple(update_workers.begin(), update_jobs.begin()));
+          std::tie(update_workers, update_jobs) = auction_shuffle_to_vertex_owners(
+            handle, pair_first, update_workers.size(), d_vertex_partition_lasts);
+        }
+        thrust::for_each(
+          handle.get_thrust_policy(),
+          thrust::make_zip_iterator(
+            thrust::make_tuple(update_workers.begin(), update_jobs.begin())),
+          thrust::make_zip_iterator(thrust::make_tuple(update_workers.end(), update_jobs.end())),
+          [worker_assignments = worker_assignments.data(), local_vertex_first] __device__(
+            auto pair) {
+            worker_assignments[thrust::get<0>(pair) - local_vertex_first] = thrust::get<1>(pair);
+          });
+      }
+    }
+
+    // 5. sum the weights of the assigned edges
+
+    total_cost = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(job_owners.begin(), job_weights.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(job_owners.end(), job_weights.end())),
+      [invalid_vertex] __device__(auto pair) {
+        return thrust::get<0>(pair) != invalid_vertex ? thrust::get<1>(pair) : weight_t{0.0};
+      },
+      weight_t{0.0},
+      thrust::plus<weight_t>{});
+    if (GraphViewType::is_multi_gpu) {
+      total_cost = host_scalar_allreduce(
+        handle.get_comms(), total_cost, raft::comms::op_t::SUM, handle.get_stream());
+    }
+  }
+
+  thrust::transform(handle.get_thrust_policy(),
+                    workers,
+                    workers + num_workers,
+                    assignments,
+                    [worker_assignments = worker_assignments.data(),
+                     local_vertex_first] __device__(auto v) {
+                      return worker_assignments[v - local_vertex_first];
+                    });
+
+  return total_cost;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+weight_t auction_assignment(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* workers,
+  vertex_t num_workers,
+  vertex_t* assignments,
+  std::optional<weight_t> epsilon,
+  weight_t epsilon_scaling_factor,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  return detail::auction_assignment(handle,
+                                    graph_view,
+                                    workers,
+                                    num_workers,
+                                    assignments,
+                                    epsilon,
+                                    epsilon_scaling_factor,
+                                    max_iterations,
+                                    do_expensive_check);
+}
+
+}  // namespace cugraph
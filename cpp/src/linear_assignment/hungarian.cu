@@ -22,8 +22,14 @@
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/random.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 
@@ -114,6 +120,121 @@ weight_t hungarian(raft::handle_t const& handle,
   }
 }
 
+// bounds the cost matrix entries (and the LAP workspace, which scales with it) solved at once by
+// hungarian_batch
+size_t constexpr hungarian_batch_max_entries{size_t{1} << 26};
+
+template <typename index_t, typename weight_t>
+void hungarian_batch(raft::handle_t const& handle,
+                     index_t num_problems,
+                     index_t num_rows,
+                     index_t num_cols,
+                     weight_t const* d_original_costs,
+                     index_t* d_assignments,
+                     weight_t* d_objective_values,
+                     weight_t epsilon)
+{
+  CUGRAPH_EXPECTS(num_problems >= 0,
+                  "Invalid input argument: num_problems should be non-negative.");
+  CUGRAPH_EXPECTS((num_rows > 0) && (num_cols > 0),
+                  "Invalid input argument: num_rows and num_cols should be positive.");
+  CUGRAPH_EXPECTS(d_assignments != nullptr,
+                  "Invalid input argument: assignments pointer is NULL");
+  if (num_problems == 0) { return; }
+
+  //
+  //  raft's LAP solves a batch of equally sized square problems in the same kernel launches, so
+  //  the problems are solved in chunks of as many problems as fit hungarian_batch_max_entries.
+  //  Non-square problems are padded with max(costs) as in hungarian().
+  //
+  index_t n               = std::max(num_rows, num_cols);
+  bool square             = (num_rows == num_cols);
+  size_t problem_entries  = static_cast<size_t>(n) * static_cast<size_t>(n);
+  size_t original_entries = static_cast<size_t>(num_rows) * static_cast<size_t>(num_cols);
+  index_t chunk_size      = static_cast<index_t>(
+    std::min(static_cast<size_t>(num_problems),
+             std::max(hungarian_batch_max_entries / problem_entries, size_t{1})));
+
+  weight_t max_cost{0};
+  if (!square) {
+    max_cost = thrust::reduce(handle.get_thrust_policy(),
+                              d_original_costs,
+                              d_original_costs + original_entries * num_problems,
+                              weight_t{0},
+                              thrust::maximum<weight_t>());
+  }
+
+  rmm::device_uvector<weight_t> tmp_cost_v(square ? size_t{0} : chunk_size * problem_entries,
+                                           handle.get_stream_view());
+  rmm::device_uvector<index_t> tmp_row_assignment_v(square ? size_t{0} : chunk_size * n,
+                                                    handle.get_stream_view());
+  rmm::device_uvector<index_t> tmp_col_assignment_v(chunk_size * n, handle.get_stream_view());
+
+  for (index_t first = 0; first < num_problems; first += chunk_size) {
+    index_t count = std::min(chunk_size, num_problems - first);
+
+    weight_t const* d_cost = d_original_costs + original_entries * first;
+    index_t* d_row_assignment =
+      square ? d_assignments + static_cast<size_t>(num_rows) * first : tmp_row_assignment_v.data();
+    if (!square) {
+      thrust::transform(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator<size_t>(0),
+                        thrust::make_counting_iterator<size_t>(problem_entries * count),
+                        tmp_cost_v.begin(),
+                        [max_cost, d_cost, n, num_rows, num_cols] __device__(size_t i) {
+                          auto problem = i / (static_cast<size_t>(n) * n);
+                          auto row     = static_cast<index_t>((i / n) % n);
+                          auto col     = static_cast<index_t>(i % n);
+
+                          return ((row < num_rows) && (col < num_cols))
+                                   ? d_cost[(problem * num_rows + row) * num_cols + col]
+                                   : max_cost;
+                        });
+      d_cost = tmp_cost_v.data();
+    }
+
+    raft::lap::LinearAssignmentProblem<index_t, weight_t> lpx(handle, n, count, epsilon);
+
+    // Solve LAP(s) for given cost matrices
+    lpx.solve(d_cost, d_row_assignment, tmp_col_assignment_v.data());
+
+    if (!square) {
+      thrust::transform(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator<size_t>(0),
+                        thrust::make_counting_iterator<size_t>(static_cast<size_t>(num_rows) *
+                                                               count),
+                        d_assignments + static_cast<size_t>(num_rows) * first,
+                        [d_row_assignment, n, num_rows] __device__(size_t i) {
+                          return d_row_assignment[(i / num_rows) * n + (i % num_rows)];
+                        });
+    }
+  }
+
+  //
+  //  The objective of a problem is the sum of the original costs of its assigned rows (rows
+  //  assigned to padded columns are unassigned and contribute nothing). Computed on the device
+  //  to avoid reading one host scalar per problem.
+  //
+  if (d_objective_values != nullptr) {
+    auto assigned_cost_first = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_t>(0),
+      [d_original_costs, d_assignments, num_rows, num_cols] __device__(size_t i) {
+        auto col = d_assignments[i];
+        return ((col >= 0) && (col < num_cols)) ? d_original_costs[i * num_cols + col]
+                                                : weight_t{0};
+      });
+    auto problem_first = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_t>(0),
+      [num_rows] __device__(size_t i) { return i / static_cast<size_t>(num_rows); });
+    thrust::reduce_by_key(handle.get_thrust_policy(),
+                          problem_first,
+                          problem_first + static_cast<size_t>(num_rows) * num_problems,
+                          assigned_cost_first,
+                          thrust::make_discard_iterator(),
+                          d_objective_values);
+  }
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 weight_t hungarian_sparse(raft::handle_t const& handle,
                           legacy::GraphCOOView<vertex_t, edge_t, weight_t> const& graph,
@@ -345,6 +466,39 @@ weight_t hungarian(raft::handle_t const& handle,
   return detail::hungarian(handle, num_rows, num_cols, costs, assignment, epsilon);
 }
 
+template <typename index_t, typename weight_t>
+void hungarian_batch(raft::handle_t const& handle,
+                     weight_t const* costs,
+                     index_t num_problems,
+                     index_t num_rows,
+                     index_t num_cols,
+                     index_t* assignments,
+                     weight_t* objective_values)
+{
+  detail::hungarian_batch(handle,
+                          num_problems,
+                          num_rows,
+                          num_cols,
+                          costs,
+                          assignments,
+                          objective_values,
+                          detail::default_epsilon<weight_t>());
+}
+
+template <typename index_t, typename weight_t>
+void hungarian_batch(raft::handle_t const& handle,
+                     weight_t const* costs,
+                     index_t num_problems,
+                     index_t num_rows,
+                     index_t num_cols,
+                     index_t* assignments,
+                     weight_t* objective_values,
+                     weight_t epsilon)
+{
+  detail::hungarian_batch(
+    handle, num_problems, num_rows, num_cols, costs, assignments, objective_values, epsilon);
+}
+
 template int32_t hungarian<int32_t, int32_t>(
   raft::handle_t const&, int32_t const*, int32_t, int32_t, int32_t*);
 template float hungarian<int32_t, float>(
@@ -358,6 +512,19 @@ template float hungarian<int32_t, float>(
 template double hungarian<int32_t, double>(
   raft::handle_t const&, double const*, int32_t, int32_t, int32_t*, double);
 
+template void hungarian_batch<int32_t, int32_t>(
+  raft::handle_t const&, int32_t const*, int32_t, int32_t, int32_t, int32_t*, int32_t*);
+template void hungarian_batch<int32_t, float>(
+  raft::handle_t const&, float const*, int32_t, int32_t, int32_t, int32_t*, float*);
+template void hungarian_batch<int32_t, double>(
+  raft::handle_t const&, double const*, int32_t, int32_t, int32_t, int32_t*, double*);
+template void hungarian_batch<int32_t, int32_t>(
+  raft::handle_t const&, int32_t const*, int32_t, int32_t, int32_t, int32_t*, int32_t*, int32_t);
+template void hungarian_batch<int32_t, float>(
+  raft::handle_t const&, float const*, int32_t, int32_t, int32_t, int32_t*, float*, float);
+template void hungarian_batch<int32_t, double>(
+  raft::handle_t const&, double const*, int32_t, int32_t, int32_t, int32_t*, double*, double);
+
 }  // namespace dense
 
 }  // namespace cugraph
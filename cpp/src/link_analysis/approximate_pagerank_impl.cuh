@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/count_if_e.cuh>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/reduce_v.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <optional>
+
+namespace cugraph {
+namespace detail {
+
+// adds scale * (the normalized personalization values) to the residuals of the personalization
+// vertices and inserts the personalization vertices above the threshold to the bucket
+template <typename GraphViewType, typename VertexFrontierType, typename result_t>
+void add_to_personalization_residuals(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  VertexFrontierType& vertex_frontier,
+  size_t bucket_idx,
+  typename GraphViewType::vertex_type const* personalization_vertices,
+  result_t const* personalization_values,
+  typename GraphViewType::vertex_type personalization_vector_size,
+  result_t personalization_sum,
+  typename GraphViewType::weight_type const* vertex_out_weight_sums,
+  result_t* residuals,
+  result_t scale,
+  result_t epsilon)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+
+  auto pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(personalization_vertices, personalization_values));
+  thrust::for_each(handle.get_thrust_policy(),
+                   pair_first,
+                   pair_first + personalization_vector_size,
+                   [vertex_partition, personalization_sum, residuals, scale] __device__(auto pair) {
+                     auto v_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(
+                       thrust::get<0>(pair));
+                     residuals[v_offset] += scale * (thrust::get<1>(pair) / personalization_sum);
+                   });
+
+  rmm::device_uvector<vertex_t> above_threshold_vertices(personalization_vector_size,
+                                                         handle.get_stream());
+  above_threshold_vertices.resize(
+    thrust::distance(
+      above_threshold_vertices.begin(),
+      thrust::copy_if(handle.get_thrust_policy(),
+                      personalization_vertices,
+                      personalization_vertices + personalization_vector_size,
+                      above_threshold_vertices.begin(),
+                      [vertex_partition, vertex_out_weight_sums, residuals, epsilon] __device__(
+                        auto v) {
+                        auto v_offset =
+                          vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+                        return residuals[v_offset] >
+                               epsilon * static_cast<result_t>(vertex_out_weight_sums[v_offset]);
+                      })),
+    handle.get_stream());
+  vertex_frontier.get_bucket(bucket_idx)
+    .insert(above_threshold_vertices.begin(), above_threshold_vertices.end());
+}
+
+// Forward push (Andersen, Chung & Lang): every vertex u holding a residual r(u) above epsilon *
+// (out-going edge weight sum of u) moves (1 - alpha) * r(u) to its PageRank value and pushes alpha
+// * r(u) to its out-going neighbors (in proportion to the edge weights, or back to the
+// personalization vertices if u is a dangling vertex). The frontier holds the vertices above the
+// threshold, so the work follows the mass instead of the graph size.
+template <typename GraphViewType, typename result_t>
+void approximate_personalized_pagerank(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  std::optional<typename GraphViewType::weight_type const*> precomputed_vertex_out_weight_sums,
+  typename GraphViewType::vertex_type const* personalization_vertices,
+  result_t const* personalization_values,
+  typename GraphViewType::vertex_type personalization_vector_size,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  scoped_phase_t phase("approximate_personalized_pagerank", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((personalization_vertices != nullptr) || (personalization_vector_size == 0),
+                  "Invalid input argument: personalization_vertices cannot be NULL if "
+                  "personalization_vector_size > 0.");
+  CUGRAPH_EXPECTS((personalization_values != nullptr) || (personalization_vector_size == 0),
+                  "Invalid input argument: personalization_values cannot be NULL if "
+                  "personalization_vector_size > 0.");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha < 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0).");
+  CUGRAPH_EXPECTS(epsilon > 0.0, "Invalid input argument: epsilon should be positive.");
+
+  if (do_expensive_check) {
+    if (precomputed_vertex_out_weight_sums) {
+      auto num_negative_precomputed_vertex_out_weight_sums = count_if_v(
+        handle, push_graph_view, *precomputed_vertex_out_weight_sums, [] __device__(auto val) {
+          return val < result_t{0.0};
+        });
+      CUGRAPH_EXPECTS(
+        num_negative_precomputed_vertex_out_weight_sums == 0,
+        "Invalid input argument: outgoing edge weight sum values should be non-negative.");
+    }
+
+    if (push_graph_view.is_weighted()) {
+      auto num_nonpositive_edge_weights =
+        count_if_e(handle,
+                   push_graph_view,
+                   dummy_properties_t<vertex_t>{}.device_view(),
+                   dummy_properties_t<vertex_t>{}.device_view(),
+                   [] __device__(vertex_t, vertex_t, weight_t w, auto, auto) { return w <= 0.0; });
+      CUGRAPH_EXPECTS(num_nonpositive_edge_weights == 0,
+                      "Invalid input argument: input graph should have postive edge weights.");
+    }
+
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      push_graph_view.get_vertex_partition_view());
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 push_graph_view,
+                 personalization_vertices,
+                 personalization_vertices + personalization_vector_size,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: peresonalization vertices have invalid vertex IDs.");
+    auto num_negative_values = count_if_v(handle,
+                                          push_graph_view,
+                                          personalization_values,
+                                          personalization_values + personalization_vector_size,
+                                          [] __device__(auto val) { return val < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: peresonalization values should be non-negative.");
+  }
+
+  // 2. compute the sums of the out-going edge weights (if not provided)
+
+  auto tmp_vertex_out_weight_sums = precomputed_vertex_out_weight_sums
+                                      ? std::nullopt
+                                      : std::optional<rmm::device_uvector<weight_t>>{
+                                          push_graph_view.compute_out_weight_sums(handle)};
+  auto vertex_out_weight_sums     = precomputed_vertex_out_weight_sums
+                                      ? *precomputed_vertex_out_weight_sums
+                                      : (*tmp_vertex_out_weight_sums).data();
+
+  // 3. initialize the PageRank values & the residuals
+
+  auto personalization_sum = reduce_v(handle,
+                                      push_graph_view,
+                                      personalization_values,
+                                      personalization_values + personalization_vector_size,
+                                      result_t{0.0});
+  CUGRAPH_EXPECTS(personalization_sum > 0.0,
+                  "Invalid input argument: sum of personalization valuese "
+                  "should be positive.");
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+
+  rmm::device_uvector<result_t> residuals(push_graph_view.get_number_of_local_vertices(),
+                                          handle.get_stream());
+  // alpha * r(u) / (out-going edge weight sum of u) for the vertices in the frontier
+  rmm::device_uvector<result_t> push_values(residuals.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               pageranks,
+               pageranks + push_graph_view.get_number_of_local_vertices(),
+               result_t{0.0});
+  thrust::fill(handle.get_thrust_policy(), residuals.begin(), residuals.end(), result_t{0.0});
+  thrust::fill(handle.get_thrust_policy(), push_values.begin(), push_values.end(), result_t{0.0});
+
+  enum class Bucket { cur, next, num_buckets };
+  using vertex_frontier_t = VertexFrontier<vertex_t,
+                                           void,
+                                           GraphViewType::is_multi_gpu,
+                                           static_cast<size_t>(Bucket::num_buckets)>;
+  vertex_frontier_t vertex_frontier(handle,
+                                    push_graph_view.get_local_vertex_first(),
+                                    push_graph_view.get_local_vertex_last());
+
+  add_to_personalization_residuals(handle,
+                                   push_graph_view,
+                                   vertex_frontier,
+                                   static_cast<size_t>(Bucket::cur),
+                                   personalization_vertices,
+                                   personalization_values,
+                                   personalization_vector_size,
+                                   personalization_sum,
+                                   vertex_out_weight_sums,
+                                   residuals.data(),
+                                   result_t{1.0},
+                                   epsilon);
+
+  // 4. push iteration
+
+  auto adj_matrix_row_push_values =
+    GraphViewType::is_multi_gpu ? row_properties_t<GraphViewType, result_t>(handle, push_graph_view)
+                                : row_properties_t<GraphViewType, result_t>{};
+
+  size_t iter{0};
+  while (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() > 0) {
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration", static_cast<int64_t>(iter));
+
+    auto& cur_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+
+    // the residuals of the dangling vertices in the frontier go back to the personalization
+    // vertices
+    auto dangling_sum = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      cur_frontier_bucket.begin(),
+      cur_frontier_bucket.end(),
+      [vertex_partition, vertex_out_weight_sums, residuals = residuals.data()] __device__(auto v) {
+        auto v_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+        return vertex_out_weight_sums[v_offset] == weight_t{0.0} ? residuals[v_offset]
+                                                                 : result_t{0.0};
+      },
+      result_t{0.0},
+      thrust::plus<result_t>());
+    if (GraphViewType::is_multi_gpu) {
+      dangling_sum = host_scalar_allreduce(
+        handle.get_comms(), dangling_sum, raft::comms::op_t::SUM, handle.get_stream());
+    }
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     cur_frontier_bucket.begin(),
+                     cur_frontier_bucket.end(),
+                     [vertex_partition,
+                      vertex_out_weight_sums,
+                      pageranks,
+                      residuals   = residuals.data(),
+                      push_values = push_values.data(),
+                      alpha] __device__(auto v) {
+                       auto v_offset =
+                         vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+                       auto residual       = residuals[v_offset];
+                       auto out_weight_sum = vertex_out_weight_sums[v_offset];
+                       pageranks[v_offset] += (result_t{1.0} - alpha) * residual;
+                       push_values[v_offset] =
+                         out_weight_sum == weight_t{0.0}
+                           ? result_t{0.0}
+                           : alpha * residual / static_cast<result_t>(out_weight_sum);
+                       residuals[v_offset] = result_t{0.0};
+                     });
+
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(handle,
+                             push_graph_view,
+                             cur_frontier_bucket.begin(),
+                             cur_frontier_bucket.end(),
+                             push_values.data(),
+                             adj_matrix_row_push_values);
+    }
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      GraphViewType::is_multi_gpu
+        ? adj_matrix_row_push_values.device_view()
+        : detail::major_properties_device_view_t<vertex_t, result_t const*>(push_values.data()),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      [] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
+        return thrust::optional<result_t>{src_val * static_cast<result_t>(w)};
+      },
+      reduce_op::plus<result_t>(),
+      residuals.data(),
+      residuals.data(),
+      [vertex_partition,
+       vertex_out_weight_sums,
+       epsilon,
+       invalid_bucket_idx = vertex_frontier_t::kInvalidBucketIdx] __device__(
+        auto v, auto v_val, auto pushed_val) {
+        auto new_residual = v_val + pushed_val;
+        auto out_weight_sum =
+          vertex_out_weight_sums[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)];
+        auto idx = new_residual > epsilon * static_cast<result_t>(out_weight_sum)
+                     ? static_cast<size_t>(Bucket::next)
+                     : invalid_bucket_idx;
+        return thrust::optional<thrust::tuple<size_t, result_t>>{
+          thrust::make_tuple(idx, new_residual)};
+      });
+
+    if (dangling_sum > result_t{0.0}) {
+      add_to_personalization_residuals(handle,
+                                       push_graph_view,
+                                       vertex_frontier,
+                                       static_cast<size_t>(Bucket::next),
+                                       personalization_vertices,
+                                       personalization_values,
+                                       personalization_vector_size,
+                                       personalization_sum,
+                                       vertex_out_weight_sums,
+                                       residuals.data(),
+                                       alpha * dangling_sum,
+                                       epsilon);
+    }
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+
+    iter++;
+    if ((vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() > 0) &&
+        (iter >= max_iterations)) {
+      CUGRAPH_FAIL("Approximate PageRank failed to converge.");
+    }
+  }
+
+  CUDA_TRY(cudaStreamSynchronize(
+    handle.get_stream()));  // this is as necessary vertex_frontier will become out-of-scope once
+                            // this function returns
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void approximate_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  vertex_t const* personalization_vertices,
+  result_t const* personalization_values,
+  vertex_t personalization_vector_size,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  detail::approximate_personalized_pagerank(handle,
+                                            graph_view,
+                                            precomputed_vertex_out_weight_sums,
+                                            personalization_vertices,
+                                            personalization_values,
+                                            personalization_vector_size,
+                                            pageranks,
+                                            alpha,
+                                            epsilon,
+                                            max_iterations,
+                                            do_expensive_check);
+}
+
+}  // namespace cugraph
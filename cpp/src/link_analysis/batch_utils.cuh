@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/utilities/device_comm.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
+#include <thrust/tuple.h>
+
+namespace cugraph {
+namespace detail {
+
+// number of vectors served by a single pass over the edges in the batched link analysis
+// algorithms
+size_t constexpr batch_width{4};
+
+template <typename result_t>
+using batch_value_t = thrust::tuple<result_t, result_t, result_t, result_t>;
+
+// maps a personalization entry index to its personalization vector index
+struct personalization_vector_index_t {
+  size_t const* offsets{nullptr};
+  size_t num_vectors{0};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    return static_cast<size_t>(thrust::distance(
+      offsets + 1, thrust::upper_bound(thrust::seq, offsets + 1, offsets + num_vectors + 1, i)));
+  }
+};
+
+// maps an index into the active columns of a column-major block (leading dimension ld) to the
+// column (if column is true) or to the index of the value in the block (if column is false)
+template <bool column>
+struct active_block_index_t {
+  size_t const* active_columns{nullptr};
+  size_t ld{0};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    return column ? active_columns[i / ld] : active_columns[i / ld] * ld + i % ld;
+  }
+};
+
+// returns the num_columns per-column sums (aggregated over the GPUs in multi-GPU) of value_op(i)
+// for i in [0, num_values); column_op(i) gives the column of the i'th value and should be
+// non-decreasing in i
+template <bool multi_gpu, typename result_t, typename ColumnOp, typename ValueOp>
+rmm::device_uvector<result_t> compute_column_sums(raft::handle_t const& handle,
+                                                  size_t num_values,
+                                                  ColumnOp column_op,
+                                                  ValueOp value_op,
+                                                  size_t num_columns)
+{
+  rmm::device_uvector<result_t> sums(num_columns, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), sums.begin(), sums.end(), result_t{0.0});
+  if (num_values > 0) {
+    rmm::device_uvector<size_t> unique_columns(num_columns, handle.get_stream());
+    rmm::device_uvector<result_t> reduced_values(num_columns, handle.get_stream());
+    auto column_first =
+      thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}), column_op);
+    auto value_first =
+      thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}), value_op);
+    auto num_unique_columns = static_cast<size_t>(
+      thrust::distance(unique_columns.begin(),
+                       thrust::reduce_by_key(handle.get_thrust_policy(),
+                                             column_first,
+                                             column_first + num_values,
+                                             value_first,
+                                             unique_columns.begin(),
+                                             reduced_values.begin())
+                         .first));
+    thrust::scatter(handle.get_thrust_policy(),
+                    reduced_values.begin(),
+                    reduced_values.begin() + num_unique_columns,
+                    unique_columns.begin(),
+                    sums.begin());
+  }
+  if constexpr (multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     sums.data(),
+                     sums.data(),
+                     sums.size(),
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+  return sums;
+}
+
+}  // namespace detail
+}  // namespace cugraph
@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <link_analysis/batch_utils.cuh>
+
 #include <cugraph/algorithms.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
@@ -23,9 +25,24 @@
 #include <cugraph/prims/reduce_v.cuh>
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/prims/transform_reduce_v.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/cudart_utils.h>
 
+#include <thrust/copy.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
 
 namespace cugraph {
 namespace detail {
@@ -61,6 +78,8 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
                                   bool normalize,
                                   bool do_expensive_check)
 {
+  scoped_phase_t phase("hits", handle.get_stream_view());
+
   using vertex_t = typename GraphViewType::vertex_type;
   static_assert(std::is_integral<vertex_t>::value,
                 "GraphViewType::vertex_type should be integral.");
@@ -109,6 +128,9 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
                  result_t{1.0} / num_vertices);
   }
   for (size_t iter = 0; iter < max_iterations; ++iter) {
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration", static_cast<int64_t>(iter));
+
     // Update current destination authorities property
     copy_v_transform_reduce_in_nbr(
       handle,
@@ -175,6 +197,340 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
   return std::make_tuple(diff_sum, final_iteration_count);
 }
 
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <bool use_src_value, typename result_t>
+struct hits_batch_e_op_t {
+  template <typename vertex_t, typename weight_t, typename SrcValue, typename DstValue>
+  __device__ batch_value_t<result_t> operator()(
+    vertex_t, vertex_t, weight_t, SrcValue src_val, DstValue dst_val) const
+  {
+    if constexpr (use_src_value) {
+      return src_val;
+    } else {
+      return dst_val;
+    }
+  }
+};
+
+// The hub & authority values of the seed vectors are kept in column-major blocks (the leading
+// dimension is the number of local vertices). Each iteration pulls the authorities from the hubs
+// (copy_v_transform_reduce_in_nbr) and pushes the hubs back from the authorities
+// (copy_v_transform_reduce_out_nbr) over the single stored (transposed) graph once per batch_width
+// vectors still iterating, vectors drop out once converged. The new hubs (L1 normalized) are mixed
+// with the (L1 normalized) seed values with the weight teleport_probability.
+template <typename GraphViewType, typename result_t>
+std::tuple<std::vector<result_t>, std::vector<size_t>> personalized_hits_batch(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  size_t const* seed_offsets,
+  typename GraphViewType::vertex_type const* seed_vertices,
+  result_t const* seed_values,
+  size_t num_seed_vectors,
+  result_t* hubs,
+  result_t* authorities,
+  result_t teleport_probability,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  scoped_phase_t phase("personalized_hits_batch", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  auto const num_vertices = graph_view.get_number_of_vertices();
+  auto const num_columns  = num_seed_vectors;
+  std::vector<result_t> h_diff_sums(num_columns, std::numeric_limits<result_t>::max());
+  std::vector<size_t> h_iteration_counts(num_columns, max_iterations);
+  if ((num_vertices == 0) || (num_columns == 0)) {
+    return std::make_tuple(std::move(h_diff_sums), std::move(h_iteration_counts));
+  }
+
+  auto const ld = static_cast<size_t>(graph_view.get_number_of_local_vertices());
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((teleport_probability >= 0.0) && (teleport_probability <= 1.0),
+                  "Invalid input argument: teleport_probability should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+
+  std::vector<size_t> h_offsets(num_columns + 1);
+  raft::update_host(h_offsets.data(), seed_offsets, h_offsets.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+  CUGRAPH_EXPECTS((h_offsets[0] == 0) && std::is_sorted(h_offsets.begin(), h_offsets.end()),
+                  "Invalid input argument: seed_offsets should start from 0 and be "
+                  "non-decreasing.");
+  auto const num_entries = h_offsets.back();
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    graph_view.get_vertex_partition_view());
+
+  if (do_expensive_check) {
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 graph_view,
+                 seed_vertices,
+                 seed_vertices + num_entries,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: seed vertices have invalid vertex IDs.");
+    auto num_negative_values = count_if_v(handle,
+                                          graph_view,
+                                          seed_values,
+                                          seed_values + num_entries,
+                                          [] __device__(auto val) { return val < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: seed values should be non-negative.");
+  }
+
+  // 2. initialize the hubs to the (L1 normalized) seed values
+
+  auto vector_index_op = personalization_vector_index_t{seed_offsets, num_columns};
+  auto seed_sums       = compute_column_sums<GraphViewType::is_multi_gpu, result_t>(
+    handle,
+    num_entries,
+    vector_index_op,
+    [seed_values] __device__(size_t i) { return seed_values[i]; },
+    num_columns);
+  {
+    std::vector<result_t> h_sums(num_columns);
+    raft::update_host(h_sums.data(), seed_sums.data(), h_sums.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+    CUGRAPH_EXPECTS(std::all_of(h_sums.begin(), h_sums.end(), [](auto sum) { return sum > 0.0; }),
+                    "Invalid input argument: sum of seed values should be positive for every "
+                    "seed vector.");
+  }
+
+  thrust::fill(handle.get_thrust_policy(), hubs, hubs + ld * num_columns, result_t{0.0});
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_entries),
+    [vertex_partition,
+     vector_index_op,
+     seed_vertices,
+     seed_values,
+     seed_sums = seed_sums.data(),
+     hubs,
+     ld] __device__(size_t i) {
+      auto c = vector_index_op(i);
+      *(hubs + c * ld + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(
+                          seed_vertices[i])) += seed_values[i] / seed_sums[c];
+    });
+
+  // 3. HITS iteration
+
+  rmm::device_uvector<result_t> old_hubs(ld * num_columns, handle.get_stream());
+  // stand-ins for the unused entries of the last block of batch_width vectors
+  rmm::device_uvector<result_t> zeros(std::max(ld, size_t{1}), handle.get_stream());
+  rmm::device_uvector<result_t> scratch(zeros.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), zeros.begin(), zeros.end(), result_t{0.0});
+  row_properties_t<GraphViewType, batch_value_t<result_t>> adj_matrix_row_hubs(handle,
+                                                                               graph_view);
+  col_properties_t<GraphViewType, batch_value_t<result_t>> adj_matrix_col_authorities(handle,
+                                                                                      graph_view);
+
+  std::vector<size_t> h_active_columns(num_columns);
+  std::iota(h_active_columns.begin(), h_active_columns.end(), size_t{0});
+  std::vector<uint8_t> h_active_flags(num_columns, uint8_t{1});
+  rmm::device_uvector<size_t> active_columns(num_columns, handle.get_stream());
+  rmm::device_uvector<uint8_t> active_flags(num_columns, handle.get_stream());
+  raft::update_device(
+    active_columns.data(), h_active_columns.data(), h_active_columns.size(), handle.get_stream());
+  raft::update_device(
+    active_flags.data(), h_active_flags.data(), h_active_flags.size(), handle.get_stream());
+  std::vector<result_t> h_hub_sums(num_columns);
+  std::vector<result_t> h_authority_sums(num_columns);
+
+  size_t iter{0};
+  while (h_active_columns.size() > 0) {
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration", static_cast<int64_t>(iter));
+
+    auto num_active_columns = h_active_columns.size();
+    profiler_add_counter("vector_iterations", static_cast<int64_t>(num_active_columns));
+    auto active_column_op = active_block_index_t<true>{active_columns.data(), ld};
+    auto active_index_op  = active_block_index_t<false>{active_columns.data(), ld};
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(ld * num_active_columns),
+      [active_index_op, hubs, old_hubs = old_hubs.data()] __device__(size_t i) {
+        auto idx      = active_index_op(i);
+        old_hubs[idx] = hubs[idx];
+      });
+
+    for (size_t j = 0; j < num_active_columns; j += batch_width) {
+      auto in_column = [&h_active_columns, &zeros, ld, j, num_active_columns](result_t* values,
+                                                                              size_t c) {
+        return (j + c < num_active_columns) ? values + h_active_columns[j + c] * ld
+                                            : zeros.data();
+      };
+      auto out_column = [&h_active_columns, &scratch, ld, j, num_active_columns](
+                          result_t* values, size_t c) {
+        return (j + c < num_active_columns) ? values + h_active_columns[j + c] * ld
+                                            : scratch.data();
+      };
+      static_assert(batch_width == 4);
+      auto hub_first = thrust::make_zip_iterator(thrust::make_tuple(
+        in_column(hubs, 0), in_column(hubs, 1), in_column(hubs, 2), in_column(hubs, 3)));
+      auto authority_in_first = thrust::make_zip_iterator(thrust::make_tuple(
+        in_column(authorities, 0),
+        in_column(authorities, 1),
+        in_column(authorities, 2),
+        in_column(authorities, 3)));
+      auto authority_out_first = thrust::make_zip_iterator(thrust::make_tuple(
+        out_column(authorities, 0),
+        out_column(authorities, 1),
+        out_column(authorities, 2),
+        out_column(authorities, 3)));
+      auto hub_out_first = thrust::make_zip_iterator(thrust::make_tuple(
+        out_column(hubs, 0), out_column(hubs, 1), out_column(hubs, 2), out_column(hubs, 3)));
+
+      copy_to_adj_matrix_row(handle, graph_view, hub_first, adj_matrix_row_hubs);
+
+      copy_v_transform_reduce_in_nbr(
+        handle,
+        graph_view,
+        adj_matrix_row_hubs.device_view(),
+        dummy_properties_t<vertex_t>{}.device_view(),
+        hits_batch_e_op_t<true, result_t>{},
+        thrust::make_tuple(result_t{0.0}, result_t{0.0}, result_t{0.0}, result_t{0.0}),
+        authority_out_first);
+
+      copy_to_adj_matrix_col(handle, graph_view, authority_in_first, adj_matrix_col_authorities);
+
+      copy_v_transform_reduce_out_nbr(
+        handle,
+        graph_view,
+        dummy_properties_t<vertex_t>{}.device_view(),
+        adj_matrix_col_authorities.device_view(),
+        hits_batch_e_op_t<false, result_t>{},
+        thrust::make_tuple(result_t{0.0}, result_t{0.0}, result_t{0.0}, result_t{0.0}),
+        hub_out_first);
+    }
+
+    auto hub_sums = compute_column_sums<GraphViewType::is_multi_gpu, result_t>(
+      handle,
+      ld * num_active_columns,
+      active_column_op,
+      [active_index_op, hubs] __device__(size_t i) { return hubs[active_index_op(i)]; },
+      num_columns);
+    auto authority_sums = compute_column_sums<GraphViewType::is_multi_gpu, result_t>(
+      handle,
+      ld * num_active_columns,
+      active_column_op,
+      [active_index_op, authorities] __device__(size_t i) {
+        return authorities[active_index_op(i)];
+      },
+      num_columns);
+    if (teleport_probability == 0.0) {
+      raft::update_host(h_hub_sums.data(), hub_sums.data(), hub_sums.size(), handle.get_stream());
+      raft::update_host(h_authority_sums.data(),
+                        authority_sums.data(),
+                        authority_sums.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+      CUGRAPH_EXPECTS(std::all_of(h_active_columns.begin(),
+                                  h_active_columns.end(),
+                                  [&h_hub_sums, &h_authority_sums](auto c) {
+                                    return (h_hub_sums[c] > 0.0) && (h_authority_sums[c] > 0.0);
+                                  }),
+                      "Norm is required to be a positive value.");
+    }
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(ld * num_active_columns),
+                     [active_column_op,
+                      active_index_op,
+                      hubs,
+                      authorities,
+                      hub_sums       = hub_sums.data(),
+                      authority_sums = authority_sums.data(),
+                      teleport_probability] __device__(size_t i) {
+                       auto c             = active_column_op(i);
+                       auto idx           = active_index_op(i);
+                       auto hub_sum       = hub_sums[c];
+                       auto authority_sum = authority_sums[c];
+                       hubs[idx] = hub_sum > 0.0 ? (result_t{1.0} - teleport_probability) *
+                                                     hubs[idx] / hub_sum
+                                                 : result_t{0.0};
+                       authorities[idx] =
+                         authority_sum > 0.0 ? authorities[idx] / authority_sum : result_t{0.0};
+                     });
+
+    if (teleport_probability > 0.0) {
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(num_entries),
+                       [vertex_partition,
+                        vector_index_op,
+                        seed_vertices,
+                        seed_values,
+                        active_flags = active_flags.data(),
+                        seed_sums    = seed_sums.data(),
+                        hubs,
+                        ld,
+                        teleport_probability] __device__(size_t i) {
+                         auto c = vector_index_op(i);
+                         if (!active_flags[c]) { return; }
+                         *(hubs + c * ld +
+                           vertex_partition.get_local_vertex_offset_from_vertex_nocheck(
+                             seed_vertices[i])) +=
+                           teleport_probability * (seed_values[i] / seed_sums[c]);
+                       });
+    }
+
+    auto diff_sums = compute_column_sums<GraphViewType::is_multi_gpu, result_t>(
+      handle,
+      ld * num_active_columns,
+      active_column_op,
+      [active_index_op, hubs, old_hubs = old_hubs.data()] __device__(size_t i) {
+        auto idx = active_index_op(i);
+        return std::abs(hubs[idx] - old_hubs[idx]);
+      },
+      num_columns);
+    std::vector<result_t> h_new_diff_sums(num_columns);
+    raft::update_host(
+      h_new_diff_sums.data(), diff_sums.data(), diff_sums.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    iter++;
+
+    // converged seed vectors (and every vector after max_iterations) drop out
+    for (auto c : h_active_columns) {
+      h_diff_sums[c] = h_new_diff_sums[c];
+      if ((h_diff_sums[c] < epsilon) || (iter >= max_iterations)) {
+        h_iteration_counts[c] = iter;
+        h_active_flags[c]     = uint8_t{0};
+      }
+    }
+    h_active_columns.erase(std::remove_if(h_active_columns.begin(),
+                                          h_active_columns.end(),
+                                          [&h_active_flags](auto c) { return !h_active_flags[c]; }),
+                           h_active_columns.end());
+
+    raft::update_device(active_columns.data(),
+                        h_active_columns.data(),
+                        h_active_columns.size(),
+                        handle.get_stream());
+    raft::update_device(
+      active_flags.data(), h_active_flags.data(), h_active_flags.size(), handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(h_diff_sums), std::move(h_iteration_counts));
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
@@ -200,4 +556,33 @@ std::tuple<weight_t, size_t> hits(
                       do_expensive_check);
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<std::vector<weight_t>, std::vector<size_t>> personalized_hits_batch(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  size_t const* seed_offsets,
+  vertex_t const* seed_vertices,
+  weight_t const* seed_values,
+  size_t num_seed_vectors,
+  weight_t* hubs,
+  weight_t* authorities,
+  weight_t teleport_probability,
+  weight_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  return detail::personalized_hits_batch(handle,
+                                         graph_view,
+                                         seed_offsets,
+                                         seed_vertices,
+                                         seed_values,
+                                         num_seed_vectors,
+                                         hubs,
+                                         authorities,
+                                         teleport_probability,
+                                         epsilon,
+                                         max_iterations,
+                                         do_expensive_check);
+}
+
 }  // namespace cugraph
@@ -19,6 +19,7 @@
 namespace cugraph {
 
 // SG instantiation
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::tuple<float, size_t> hits(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
@@ -29,7 +30,9 @@ template std::tuple<float, size_t> hits(
   bool has_initial_hubs_guess,
   bool normalize,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::tuple<double, size_t> hits(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
@@ -40,7 +43,9 @@ template std::tuple<double, size_t> hits(
   bool has_initial_hubs_guess,
   bool normalize,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::tuple<float, size_t> hits(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
@@ -51,7 +56,9 @@ template std::tuple<float, size_t> hits(
   bool has_initial_hubs_guess,
   bool normalize,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::tuple<double, size_t> hits(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
@@ -62,7 +69,9 @@ template std::tuple<double, size_t> hits(
   bool has_initial_hubs_guess,
   bool normalize,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::tuple<float, size_t> hits(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
@@ -73,7 +82,9 @@ template std::tuple<float, size_t> hits(
   bool has_initial_hubs_guess,
   bool normalize,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::tuple<double, size_t> hits(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
@@ -84,5 +95,102 @@ template std::tuple<double, size_t> hits(
   bool has_initial_hubs_guess,
   bool normalize,
   bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::tuple<std::vector<float>, std::vector<size_t>> personalized_hits_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
+  size_t const* seed_offsets,
+  int32_t const* seed_vertices,
+  float const* seed_values,
+  size_t num_seed_vectors,
+  float* hubs,
+  float* authorities,
+  float teleport_probability,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::tuple<std::vector<double>, std::vector<size_t>> personalized_hits_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
+  size_t const* seed_offsets,
+  int32_t const* seed_vertices,
+  double const* seed_values,
+  size_t num_seed_vectors,
+  double* hubs,
+  double* authorities,
+  double teleport_probability,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::tuple<std::vector<float>, std::vector<size_t>> personalized_hits_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
+  size_t const* seed_offsets,
+  int32_t const* seed_vertices,
+  float const* seed_values,
+  size_t num_seed_vectors,
+  float* hubs,
+  float* authorities,
+  float teleport_probability,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::tuple<std::vector<double>, std::vector<size_t>> personalized_hits_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
+  size_t const* seed_offsets,
+  int32_t const* seed_vertices,
+  double const* seed_values,
+  size_t num_seed_vectors,
+  double* hubs,
+  double* authorities,
+  double teleport_probability,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::tuple<std::vector<float>, std::vector<size_t>> personalized_hits_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
+  size_t const* seed_offsets,
+  int64_t const* seed_vertices,
+  float const* seed_values,
+  size_t num_seed_vectors,
+  float* hubs,
+  float* authorities,
+  float teleport_probability,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::tuple<std::vector<double>, std::vector<size_t>> personalized_hits_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
+  size_t const* seed_offsets,
+  int64_t const* seed_vertices,
+  double const* seed_values,
+  size_t num_seed_vectors,
+  double* hubs,
+  double* authorities,
+  double teleport_probability,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
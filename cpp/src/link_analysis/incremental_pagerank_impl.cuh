@@ -0,0 +1,509 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/reduce_v.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/count.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <optional>
+#include <tuple>
+
+namespace cugraph {
+namespace detail {
+
+template <typename weight_t, typename result_t>
+__device__ result_t inverse_or_zero(weight_t w)
+{
+  return w > weight_t{0.0} ? result_t{1.0} / static_cast<result_t>(w) : result_t{0.0};
+}
+
+// Gauss-Southwell style correction of the PageRank values of the graph before the edge changes.
+//
+// With the PageRank values x (x = (1 - alpha) / V + alpha * (P^T x + the uniformly spread dangling
+// mass)) of the graph before the changes, the residuals r = (1 - alpha) / V + alpha * P'^T x - x of
+// the changed graph (P' is the changed transition matrix) are non-zero only at the out-going
+// neighbors of the sources of the changed edges. The vertices with |r(u)| above epsilon / V add
+// r(u) to x(u) and push alpha * r(u) to their out-going neighbors (in proportion to the edge
+// weights) till every residual is below the threshold. The (uniformly spread) changes in the
+// dangling mass are folded in by re-normalizing x as applying a uniform residual c scales the
+// PageRank values by (1 + c V / (1 - alpha)).
+template <typename GraphViewType, typename result_t>
+void incremental_pagerank(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  std::optional<typename GraphViewType::weight_type const*> precomputed_vertex_out_weight_sums,
+  typename GraphViewType::vertex_type const* changed_edge_srcs,
+  typename GraphViewType::vertex_type const* changed_edge_dsts,
+  typename GraphViewType::weight_type const* changed_edge_weight_deltas,
+  typename GraphViewType::edge_type num_changed_edges,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  scoped_phase_t phase("incremental_pagerank", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(((changed_edge_srcs != nullptr) && (changed_edge_dsts != nullptr) &&
+                   (changed_edge_weight_deltas != nullptr)) ||
+                    (num_changed_edges == 0),
+                  "Invalid input argument: changed_edge_srcs, changed_edge_dsts, and "
+                  "changed_edge_weight_deltas cannot be NULL if num_changed_edges > 0.");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha < 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0).");
+  CUGRAPH_EXPECTS(epsilon > 0.0, "Invalid input argument: epsilon should be positive.");
+
+  if (do_expensive_check) {
+    auto num_negative_values = count_if_v(
+      handle, push_graph_view, pageranks, [] __device__(auto val) { return val < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: the previous PageRank values should be "
+                    "non-negative.");
+    auto num_invalid_edges = thrust::count_if(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(changed_edge_srcs, changed_edge_dsts)),
+      thrust::make_zip_iterator(thrust::make_tuple(changed_edge_srcs, changed_edge_dsts)) +
+        num_changed_edges,
+      [num_vertices] __device__(auto e) {
+        auto src = thrust::get<0>(e);
+        auto dst = thrust::get<1>(e);
+        return (src < 0) || (src >= num_vertices) || (dst < 0) || (dst >= num_vertices);
+      });
+    if (GraphViewType::is_multi_gpu) {
+      num_invalid_edges = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_edges, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_edges == 0,
+                    "Invalid input argument: changed edges have invalid vertex IDs.");
+  }
+
+  // 2. compute the sums of the out-going edge weights (if not provided)
+
+  auto tmp_vertex_out_weight_sums = precomputed_vertex_out_weight_sums
+                                      ? std::nullopt
+                                      : std::optional<rmm::device_uvector<weight_t>>{
+                                          push_graph_view.compute_out_weight_sums(handle)};
+  auto vertex_out_weight_sums     = precomputed_vertex_out_weight_sums
+                                      ? *precomputed_vertex_out_weight_sums
+                                      : (*tmp_vertex_out_weight_sums).data();
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+  auto threshold = epsilon / static_cast<result_t>(num_vertices);
+
+  // 3. group the changed edges by source (in multi-GPU, move the changed edges to the GPUs owning
+  // the sources)
+
+  rmm::device_uvector<vertex_t> srcs(num_changed_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(num_changed_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> weight_deltas(num_changed_edges, handle.get_stream());
+  auto changed_edge_first = thrust::make_zip_iterator(
+    thrust::make_tuple(changed_edge_srcs, changed_edge_dsts, changed_edge_weight_deltas));
+  thrust::copy(handle.get_thrust_policy(),
+               changed_edge_first,
+               changed_edge_first + num_changed_edges,
+               thrust::make_zip_iterator(
+                 thrust::make_tuple(srcs.begin(), dsts.begin(), weight_deltas.begin())));
+
+  std::optional<rmm::device_uvector<vertex_t>> d_vertex_partition_lasts{std::nullopt};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm                  = handle.get_comms();
+    auto vertex_partition_lasts = push_graph_view.get_vertex_partition_lasts();
+    d_vertex_partition_lasts =
+      rmm::device_uvector<vertex_t>(vertex_partition_lasts.size(), handle.get_stream());
+    raft::update_device((*d_vertex_partition_lasts).data(),
+                        vertex_partition_lasts.data(),
+                        vertex_partition_lasts.size(),
+                        handle.get_stream());
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(srcs.begin(), dsts.begin(), weight_deltas.begin()));
+    std::forward_as_tuple(std::tie(srcs, dsts, weight_deltas), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        edge_first,
+        edge_first + srcs.size(),
+        renumbered_vertex_to_gpu_id_t<vertex_t>{(*d_vertex_partition_lasts).data(),
+                                                comm.get_size()},
+        handle.get_stream());
+  }
+
+  thrust::sort_by_key(
+    handle.get_thrust_policy(),
+    srcs.begin(),
+    srcs.end(),
+    thrust::make_zip_iterator(thrust::make_tuple(dsts.begin(), weight_deltas.begin())));
+
+  // the sources of the changed edges & the edge weight sums before the changes
+
+  rmm::device_uvector<vertex_t> unique_srcs(srcs.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> old_out_weight_sums(srcs.size(), handle.get_stream());
+  auto num_unique_srcs = static_cast<size_t>(
+    thrust::distance(unique_srcs.begin(),
+                     thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           srcs.begin(),
+                                           srcs.end(),
+                                           weight_deltas.begin(),
+                                           unique_srcs.begin(),
+                                           old_out_weight_sums.begin())
+                       .first));
+  unique_srcs.resize(num_unique_srcs, handle.get_stream());
+  old_out_weight_sums.resize(num_unique_srcs, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    unique_srcs.begin(),
+                    unique_srcs.end(),
+                    old_out_weight_sums.begin(),
+                    old_out_weight_sums.begin(),
+                    [vertex_partition, vertex_out_weight_sums] __device__(auto v, auto delta) {
+                      auto old_sum =
+                        vertex_out_weight_sums[
+                          vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)] -
+                        delta;
+                      return old_sum > weight_t{0.0} ? old_sum : weight_t{0.0};
+                    });
+
+  // 4. compute the residuals from the changes
+
+  enum class Bucket { cur, next, num_buckets };
+  using vertex_frontier_t = VertexFrontier<vertex_t,
+                                           void,
+                                           GraphViewType::is_multi_gpu,
+                                           static_cast<size_t>(Bucket::num_buckets)>;
+  vertex_frontier_t vertex_frontier(handle,
+                                    push_graph_view.get_local_vertex_first(),
+                                    push_graph_view.get_local_vertex_last());
+
+  auto adj_matrix_row_push_values =
+    GraphViewType::is_multi_gpu ? row_properties_t<GraphViewType, result_t>(handle, push_graph_view)
+                                : row_properties_t<GraphViewType, result_t>{};
+
+  auto e_op = [] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
+    return thrust::optional<result_t>{src_val * static_cast<result_t>(w)};
+  };
+  auto v_op = [threshold, invalid_bucket_idx = vertex_frontier_t::kInvalidBucketIdx] __device__(
+                auto v, auto v_val, auto pushed_val) {
+    auto new_residual = v_val + pushed_val;
+    auto idx          = ((new_residual > threshold) || (new_residual < -threshold))
+                          ? static_cast<size_t>(Bucket::next)
+                          : invalid_bucket_idx;
+    return thrust::optional<thrust::tuple<size_t, result_t>>{thrust::make_tuple(idx, new_residual)};
+  };
+
+  // with W(u, v) = W'(u, v) - delta(u, v) and inv(d) = (d > 0 ? 1 / d : 0), the residual of v
+  // changes by alpha * x(u) * (inv(d'(u)) * W'(u, v) - inv(d(u)) * W(u, v)) = alpha * x(u) *
+  // ((inv(d'(u)) - inv(d(u))) * W'(u, v) + inv(d(u)) * delta(u, v)); the first term is pushed over
+  // the (changed) graph and the second term over the changed edges.
+
+  rmm::device_uvector<result_t> residuals(push_graph_view.get_number_of_local_vertices(),
+                                          handle.get_stream());
+  rmm::device_uvector<result_t> push_values(residuals.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), residuals.begin(), residuals.end(), result_t{0.0});
+  thrust::fill(handle.get_thrust_policy(), push_values.begin(), push_values.end(), result_t{0.0});
+
+  {
+    rmm::device_uvector<vertex_t> delta_dsts(dsts.size(), handle.get_stream());
+    rmm::device_uvector<result_t> delta_residuals(dsts.size(), handle.get_stream());
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(srcs.begin(), dsts.begin(), weight_deltas.begin()));
+    thrust::transform(
+      handle.get_thrust_policy(),
+      edge_first,
+      edge_first + srcs.size(),
+      thrust::make_zip_iterator(thrust::make_tuple(delta_dsts.begin(), delta_residuals.begin())),
+      [vertex_partition,
+       unique_srcs         = unique_srcs.data(),
+       old_out_weight_sums = old_out_weight_sums.data(),
+       num_unique_srcs,
+       pageranks,
+       alpha] __device__(auto e) {
+        auto src = thrust::get<0>(e);
+        auto idx = thrust::distance(
+          unique_srcs,
+          thrust::lower_bound(thrust::seq, unique_srcs, unique_srcs + num_unique_srcs, src));
+        auto x = pageranks[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(src)];
+        return thrust::make_tuple(thrust::get<1>(e),
+                                  alpha * x *
+                                    inverse_or_zero<weight_t, result_t>(old_out_weight_sums[idx]) *
+                                    static_cast<result_t>(thrust::get<2>(e)));
+      });
+    srcs.resize(0, handle.get_stream());
+    srcs.shrink_to_fit(handle.get_stream());
+    dsts.resize(0, handle.get_stream());
+    dsts.shrink_to_fit(handle.get_stream());
+    weight_deltas.resize(0, handle.get_stream());
+    weight_deltas.shrink_to_fit(handle.get_stream());
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto& comm      = handle.get_comms();
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(delta_dsts.begin(), delta_residuals.begin()));
+      std::forward_as_tuple(std::tie(delta_dsts, delta_residuals), std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          comm,
+          pair_first,
+          pair_first + delta_dsts.size(),
+          renumbered_vertex_to_gpu_id_t<vertex_t>{(*d_vertex_partition_lasts).data(),
+                                                  comm.get_size()},
+          handle.get_stream());
+    }
+
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), delta_dsts.begin(), delta_dsts.end(), delta_residuals.begin());
+    auto num_unique_dsts = static_cast<size_t>(
+      thrust::distance(delta_dsts.begin(),
+                       thrust::reduce_by_key(handle.get_thrust_policy(),
+                                             delta_dsts.begin(),
+                                             delta_dsts.end(),
+                                             delta_residuals.begin(),
+                                             delta_dsts.begin(),
+                                             delta_residuals.begin())
+                         .first));
+    delta_dsts.resize(num_unique_dsts, handle.get_stream());
+    delta_residuals.resize(num_unique_dsts, handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(delta_dsts.begin(), delta_residuals.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(delta_dsts.end(), delta_residuals.end())),
+      [vertex_partition, residuals = residuals.data()] __device__(auto pair) {
+        residuals[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(
+          thrust::get<0>(pair))] += thrust::get<1>(pair);
+      });
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_zip_iterator(
+                       thrust::make_tuple(unique_srcs.begin(), old_out_weight_sums.begin())),
+                     thrust::make_zip_iterator(
+                       thrust::make_tuple(unique_srcs.end(), old_out_weight_sums.end())),
+                     [vertex_partition,
+                      vertex_out_weight_sums,
+                      pageranks,
+                      push_values = push_values.data(),
+                      alpha] __device__(auto pair) {
+                       auto v_offset =
+                         vertex_partition.get_local_vertex_offset_from_vertex_nocheck(
+                           thrust::get<0>(pair));
+                       push_values[v_offset] =
+                         alpha * pageranks[v_offset] *
+                         (inverse_or_zero<weight_t, result_t>(vertex_out_weight_sums[v_offset]) -
+                          inverse_or_zero<weight_t, result_t>(thrust::get<1>(pair)));
+                     });
+
+    // the destinations of the changed edges above the threshold and the vertices crossing the
+    // threshold by the pushes from the sources of the changed edges form the initial frontier
+    delta_dsts.resize(
+      thrust::distance(
+        delta_dsts.begin(),
+        thrust::remove_if(
+          handle.get_thrust_policy(),
+          delta_dsts.begin(),
+          delta_dsts.end(),
+          [vertex_partition, residuals = residuals.data(), threshold] __device__(auto v) {
+            auto r = residuals[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)];
+            return !((r > threshold) || (r < -threshold));
+          })),
+      handle.get_stream());
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next))
+      .insert(delta_dsts.begin(), delta_dsts.end());
+  }
+
+  vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+    .insert(unique_srcs.begin(), unique_srcs.end());
+
+  if (GraphViewType::is_multi_gpu) {
+    copy_to_adj_matrix_row(handle,
+                           push_graph_view,
+                           unique_srcs.begin(),
+                           unique_srcs.end(),
+                           push_values.data(),
+                           adj_matrix_row_push_values);
+  }
+
+  update_frontier_v_push_if_out_nbr(
+    handle,
+    push_graph_view,
+    vertex_frontier,
+    static_cast<size_t>(Bucket::cur),
+    std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+    GraphViewType::is_multi_gpu
+      ? adj_matrix_row_push_values.device_view()
+      : detail::major_properties_device_view_t<vertex_t, result_t const*>(push_values.data()),
+    dummy_properties_t<vertex_t>{}.device_view(),
+    e_op,
+    reduce_op::plus<result_t>(),
+    residuals.data(),
+    residuals.data(),
+    v_op);
+
+  vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+  vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+  vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                               static_cast<size_t>(Bucket::next));
+
+  // 5. push iteration
+
+  size_t iter{0};
+  while (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() > 0) {
+    if (iter >= max_iterations) { CUGRAPH_FAIL("Incremental PageRank failed to converge."); }
+
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration", static_cast<int64_t>(iter));
+
+    auto& cur_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     cur_frontier_bucket.begin(),
+                     cur_frontier_bucket.end(),
+                     [vertex_partition,
+                      vertex_out_weight_sums,
+                      pageranks,
+                      residuals   = residuals.data(),
+                      push_values = push_values.data(),
+                      alpha] __device__(auto v) {
+                       auto v_offset =
+                         vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+                       auto residual = residuals[v_offset];
+                       pageranks[v_offset] += residual;
+                       push_values[v_offset] =
+                         alpha * residual *
+                         inverse_or_zero<weight_t, result_t>(vertex_out_weight_sums[v_offset]);
+                       residuals[v_offset] = result_t{0.0};
+                     });
+
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(handle,
+                             push_graph_view,
+                             cur_frontier_bucket.begin(),
+                             cur_frontier_bucket.end(),
+                             push_values.data(),
+                             adj_matrix_row_push_values);
+    }
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      GraphViewType::is_multi_gpu
+        ? adj_matrix_row_push_values.device_view()
+        : detail::major_properties_device_view_t<vertex_t, result_t const*>(push_values.data()),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      e_op,
+      reduce_op::plus<result_t>(),
+      residuals.data(),
+      residuals.data(),
+      v_op);
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+
+    iter++;
+  }
+
+  // 6. fold in the changes in the (uniformly spread) dangling mass
+
+  auto sum = reduce_v(handle, push_graph_view, pageranks, result_t{0.0});
+  CUGRAPH_EXPECTS(sum > 0.0, "Invalid input argument: the previous PageRank values sum to 0.");
+  thrust::transform(handle.get_thrust_policy(),
+                    pageranks,
+                    pageranks + push_graph_view.get_number_of_local_vertices(),
+                    pageranks,
+                    [sum] __device__(auto val) { return val / sum; });
+
+  CUDA_TRY(cudaStreamSynchronize(
+    handle.get_stream()));  // this is as necessary vertex_frontier will become out-of-scope once
+                            // this function returns
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  vertex_t const* changed_edge_srcs,
+  vertex_t const* changed_edge_dsts,
+  weight_t const* changed_edge_weight_deltas,
+  edge_t num_changed_edges,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  detail::incremental_pagerank(handle,
+                               graph_view,
+                               precomputed_vertex_out_weight_sums,
+                               changed_edge_srcs,
+                               changed_edge_dsts,
+                               changed_edge_weight_deltas,
+                               num_changed_edges,
+                               pageranks,
+                               alpha,
+                               epsilon,
+                               max_iterations,
+                               do_expensive_check);
+}
+
+}  // namespace cugraph
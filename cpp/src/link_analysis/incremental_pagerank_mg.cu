@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <link_analysis/incremental_pagerank_impl.cuh>
+
+namespace cugraph {
+
+// MG instantiation
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  std::optional<float const*> precomputed_vertex_out_weight_sums,
+  int32_t const* changed_edge_srcs,
+  int32_t const* changed_edge_dsts,
+  float const* changed_edge_weight_deltas,
+  int32_t num_changed_edges,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  std::optional<double const*> precomputed_vertex_out_weight_sums,
+  int32_t const* changed_edge_srcs,
+  int32_t const* changed_edge_dsts,
+  double const* changed_edge_weight_deltas,
+  int32_t num_changed_edges,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  std::optional<float const*> precomputed_vertex_out_weight_sums,
+  int32_t const* changed_edge_srcs,
+  int32_t const* changed_edge_dsts,
+  float const* changed_edge_weight_deltas,
+  int64_t num_changed_edges,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  std::optional<double const*> precomputed_vertex_out_weight_sums,
+  int32_t const* changed_edge_srcs,
+  int32_t const* changed_edge_dsts,
+  double const* changed_edge_weight_deltas,
+  int64_t num_changed_edges,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  std::optional<float const*> precomputed_vertex_out_weight_sums,
+  int64_t const* changed_edge_srcs,
+  int64_t const* changed_edge_dsts,
+  float const* changed_edge_weight_deltas,
+  int64_t num_changed_edges,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  std::optional<double const*> precomputed_vertex_out_weight_sums,
+  int64_t const* changed_edge_srcs,
+  int64_t const* changed_edge_dsts,
+  double const* changed_edge_weight_deltas,
+  int64_t num_changed_edges,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+#endif
+
+}  // namespace cugraph
@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+#include <cugraph/vertex_partition_device_view.cuh>
+#include <generators/splitmix64.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct take_walk_step_t {
+  edge_t const* offsets{nullptr};
+  vertex_t const* indices{nullptr};
+  vertex_t local_vertex_first{};
+  uint64_t rng_seed{};
+  size_t step{};
+  double alpha{};
+  vertex_t invalid_vertex{};
+
+  // returns the next vertex of the walk (or invalid_vertex if the walk stops), the walk continues
+  // with probability alpha to a uniform random out-neighbor, or to the source if the current vertex
+  // has no out-edges (as pagerank() redistributes the dangling vertex scores to the personalization
+  // vertices)
+  __device__ vertex_t operator()(thrust::tuple<vertex_t, size_t, vertex_t> walker) const
+  {
+    splitmix64_t rng(rng_seed, thrust::get<1>(walker));
+    rng.discard(step * 2);
+    if (rng.uniform() >= alpha) { return invalid_vertex; }
+    auto offset = thrust::get<0>(walker) - local_vertex_first;
+    auto degree = offsets[offset + 1] - offsets[offset];
+    if (degree == 0) { return thrust::get<2>(walker); }
+    return indices[offsets[offset] +
+                   static_cast<edge_t>(rng.next() % static_cast<uint64_t>(degree))];
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_stopped_walker_t {
+  vertex_t invalid_vertex{};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, size_t, size_t, vertex_t> walker) const
+  {
+    return thrust::get<0>(walker) == invalid_vertex;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename result_t>
+struct visit_count_to_score_t {
+  result_t scale{};
+
+  __device__ result_t operator()(size_t count) const
+  {
+    return static_cast<result_t>(count) * scale;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename result_t>
+struct higher_visit_score_first_t {
+  __device__ bool operator()(thrust::tuple<size_t, result_t, vertex_t> lhs,
+                             thrust::tuple<size_t, result_t, vertex_t> rhs) const
+  {
+    if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+      return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+    } else if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+      return thrust::get<1>(lhs) > thrust::get<1>(rhs);
+    } else {
+      return thrust::get<2>(lhs) < thrust::get<2>(rhs);
+    }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+struct rank_in_source_t {
+  size_t const* sorted_source_indices{nullptr};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    auto first = thrust::lower_bound(
+      thrust::seq, sorted_source_indices, sorted_source_indices + i, sorted_source_indices[i]);
+    return static_cast<size_t>(thrust::distance(first, sorted_source_indices + i));
+  }
+};
+
+// sorts and reduces the (source index, vertex, visit count) triplets (the visit counts of the same
+// (source index, vertex) pairs are summed)
+template <typename vertex_t>
+void reduce_visit_counts(raft::handle_t const& handle,
+                         rmm::device_uvector<size_t>& source_indices,
+                         rmm::device_uvector<vertex_t>& vertices,
+                         rmm::device_uvector<size_t>& counts)
+{
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(source_indices.begin(), vertices.begin()));
+  thrust::sort_by_key(
+    handle.get_thrust_policy(), pair_first, pair_first + source_indices.size(), counts.begin());
+
+  rmm::device_uvector<size_t> reduced_source_indices(source_indices.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> reduced_vertices(vertices.size(), handle.get_stream());
+  rmm::device_uvector<size_t> reduced_counts(counts.size(), handle.get_stream());
+  auto reduced_pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(reduced_source_indices.begin(), reduced_vertices.begin()));
+  auto num_pairs = static_cast<size_t>(
+    thrust::distance(reduced_pair_first,
+                     thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           pair_first,
+                                           pair_first + source_indices.size(),
+                                           counts.begin(),
+                                           reduced_pair_first,
+                                           reduced_counts.begin())
+                       .first));
+  reduced_source_indices.resize(num_pairs, handle.get_stream());
+  reduced_vertices.resize(num_pairs, handle.get_stream());
+  reduced_counts.resize(num_pairs, handle.get_stream());
+  reduced_source_indices.shrink_to_fit(handle.get_stream());
+  reduced_vertices.shrink_to_fit(handle.get_stream());
+  reduced_counts.shrink_to_fit(handle.get_stream());
+
+  source_indices = std::move(reduced_source_indices);
+  vertices       = std::move(reduced_vertices);
+  counts         = std::move(reduced_counts);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<result_t>>
+monte_carlo_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* sources,
+  size_t num_sources,
+  size_t num_walks_per_source,
+  size_t k,
+  result_t alpha,
+  size_t max_walk_length,
+  uint64_t rng_seed,
+  bool do_expensive_check)
+{
+  scoped_phase_t phase("monte_carlo_personalized_pagerank", handle.get_stream_view());
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((sources != nullptr) || (num_sources == 0),
+                  "Invalid input argument: sources cannot be null if num_sources > 0.");
+  CUGRAPH_EXPECTS(num_walks_per_source > 0,
+                  "Invalid input argument: num_walks_per_source should be positive.");
+  CUGRAPH_EXPECTS(k > 0, "Invalid input argument: k should be positive.");
+  CUGRAPH_EXPECTS((alpha >= result_t{0.0}) && (alpha < result_t{1.0}),
+                  "Invalid input argument: alpha should be in [0.0, 1.0).");
+  CUGRAPH_EXPECTS(max_walk_length > 0,
+                  "Invalid input argument: max_walk_length should be positive.");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, multi_gpu>(
+      graph_view.get_vertex_partition_view());
+    auto num_invalid_sources = count_if_v(
+      handle, graph_view, sources, sources + num_sources, [vertex_partition] __device__(auto v) {
+        return !(vertex_partition.is_valid_vertex(v) &&
+                 vertex_partition.is_local_vertex_nocheck(v));
+      });
+    CUGRAPH_EXPECTS(num_invalid_sources == 0,
+                    "Invalid input argument: sources have invalid vertex IDs or vertices not local "
+                    "to this GPU.");
+  }
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+  auto invalid_vertex     = graph_view.get_number_of_vertices();
+
+  // 2. store the out-neighbor lists of the local vertices in a local CSR (the walkers move to the
+  // GPUs owning their current vertices in multi-GPU)
+
+  auto [majors, minors] = extract_local_major_edgelist(handle, graph_view, true, false);
+  auto offsets          = compute_sorted_edge_offsets<vertex_t, edge_t>(
+    handle, majors, local_vertex_first, num_local_vertices);
+  majors.resize(0, handle.get_stream());
+  majors.shrink_to_fit(handle.get_stream());
+
+  // 3. the sources are numbered globally (in the GPU rank order), a walk is identified by (source
+  // index, walk index) and draws its random numbers from its own splitmix64 stream
+
+  size_t source_first{0};
+  std::vector<size_t> h_source_lasts{num_sources};
+  if constexpr (multi_gpu) {
+    auto& comm           = handle.get_comms();
+    auto h_source_counts = host_scalar_allgather(comm, num_sources, handle.get_stream());
+    h_source_lasts.resize(h_source_counts.size());
+    std::inclusive_scan(h_source_counts.begin(), h_source_counts.end(), h_source_lasts.begin());
+    source_first = h_source_lasts[comm.get_rank()] - num_sources;
+  }
+
+  auto num_walkers = num_sources * num_walks_per_source;
+  rmm::device_uvector<vertex_t> walker_vertices(num_walkers, handle.get_stream());
+  rmm::device_uvector<size_t> walker_ids(num_walkers, handle.get_stream());
+  rmm::device_uvector<size_t> walker_source_indices(num_walkers, handle.get_stream());
+  rmm::device_uvector<vertex_t> walker_sources(num_walkers, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_walkers),
+    thrust::make_zip_iterator(thrust::make_tuple(walker_vertices.begin(),
+                                                 walker_ids.begin(),
+                                                 walker_source_indices.begin(),
+                                                 walker_sources.begin())),
+    [sources, source_first, num_walks_per_source] __device__(auto i) {
+      auto s = sources[i / num_walks_per_source];
+      return thrust::make_tuple(s,
+                                source_first * num_walks_per_source + i,
+                                source_first + i / num_walks_per_source,
+                                s);
+    });
+
+  // 4. walk, the visits are accumulated per (source index, vertex) on the GPU owning the vertex;
+  // the visit buffer is reduced once it outgrows the reduced visit counts, so the memory footprint
+  // follows the set of the visited (source, vertex) pairs rather than the total walk length
+
+  rmm::device_uvector<size_t> visit_source_indices(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> visit_vertices(0, handle.get_stream());
+  rmm::device_uvector<size_t> visit_counts(0, handle.get_stream());
+  size_t num_reduced_visits{0};
+
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(0, handle.get_stream());
+  if constexpr (multi_gpu) {
+    auto vertex_partition_lasts = graph_view.get_vertex_partition_lasts();
+    d_vertex_partition_lasts.resize(vertex_partition_lasts.size(), handle.get_stream());
+    raft::update_device(d_vertex_partition_lasts.data(),
+                        vertex_partition_lasts.data(),
+                        vertex_partition_lasts.size(),
+                        handle.get_stream());
+  }
+
+  for (size_t step = 0; step < max_walk_length; ++step) {
+    auto num_aggregate_walkers = multi_gpu ? host_scalar_allreduce(handle.get_comms(),
+                                                                   walker_vertices.size(),
+                                                                   raft::comms::op_t::SUM,
+                                                                   handle.get_stream())
+                                           : walker_vertices.size();
+    if (num_aggregate_walkers == 0) { break; }
+
+    // 4.1 record the visits
+
+    auto old_num_visits = visit_source_indices.size();
+    visit_source_indices.resize(old_num_visits + walker_vertices.size(), handle.get_stream());
+    visit_vertices.resize(visit_source_indices.size(), handle.get_stream());
+    visit_counts.resize(visit_source_indices.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 walker_source_indices.begin(),
+                 walker_source_indices.end(),
+                 visit_source_indices.begin() + old_num_visits);
+    thrust::copy(handle.get_thrust_policy(),
+                 walker_vertices.begin(),
+                 walker_vertices.end(),
+                 visit_vertices.begin() + old_num_visits);
+    thrust::fill(handle.get_thrust_policy(),
+                 visit_counts.begin() + old_num_visits,
+                 visit_counts.end(),
+                 size_t{1});
+    if (visit_source_indices.size() - num_reduced_visits >= num_reduced_visits) {
+      reduce_visit_counts(handle, visit_source_indices, visit_vertices, visit_counts);
+      num_reduced_visits = visit_source_indices.size();
+    }
+
+    if (step + 1 == max_walk_length) { break; }
+
+    // 4.2 move (or stop) the walkers
+
+    auto walker_first =
+      thrust::make_zip_iterator(thrust::make_tuple(walker_vertices.begin(),
+                                                   walker_ids.begin(),
+                                                   walker_source_indices.begin(),
+                                                   walker_sources.begin()));
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        walker_vertices.begin(), walker_ids.begin(), walker_sources.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(walker_vertices.end(), walker_ids.end(), walker_sources.end())),
+      walker_vertices.begin(),
+      take_walk_step_t<vertex_t, edge_t>{offsets.data(),
+                                         minors.data(),
+                                         local_vertex_first,
+                                         rng_seed,
+                                         step,
+                                         static_cast<double>(alpha),
+                                         invalid_vertex});
+    auto num_remaining_walkers = static_cast<size_t>(
+      thrust::distance(walker_first,
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         walker_first,
+                                         walker_first + walker_vertices.size(),
+                                         is_stopped_walker_t<vertex_t>{invalid_vertex})));
+    walker_vertices.resize(num_remaining_walkers, handle.get_stream());
+    walker_ids.resize(num_remaining_walkers, handle.get_stream());
+    walker_source_indices.resize(num_remaining_walkers, handle.get_stream());
+    walker_sources.resize(num_remaining_walkers, handle.get_stream());
+
+    if constexpr (multi_gpu) {
+      auto& comm   = handle.get_comms();
+      walker_first = thrust::make_zip_iterator(thrust::make_tuple(walker_vertices.begin(),
+                                                                  walker_ids.begin(),
+                                                                  walker_source_indices.begin(),
+                                                                  walker_sources.begin()));
+      std::forward_as_tuple(
+        std::tie(walker_vertices, walker_ids, walker_source_indices, walker_sources),
+        std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          comm,
+          walker_first,
+          walker_first + walker_vertices.size(),
+          renumbered_vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(),
+                                                  comm.get_size()},
+          handle.get_stream());
+    }
+  }
+  walker_vertices.resize(0, handle.get_stream());
+  walker_vertices.shrink_to_fit(handle.get_stream());
+  walker_ids.resize(0, handle.get_stream());
+  walker_ids.shrink_to_fit(handle.get_stream());
+  walker_source_indices.resize(0, handle.get_stream());
+  walker_source_indices.shrink_to_fit(handle.get_stream());
+  walker_sources.resize(0, handle.get_stream());
+  walker_sources.shrink_to_fit(handle.get_stream());
+  minors.resize(0, handle.get_stream());
+  minors.shrink_to_fit(handle.get_stream());
+  offsets.resize(0, handle.get_stream());
+  offsets.shrink_to_fit(handle.get_stream());
+
+  reduce_visit_counts(handle, visit_source_indices, visit_vertices, visit_counts);
+
+  // 5. send the visit counts to the GPUs owning the sources
+
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+    rmm::device_uvector<size_t> d_source_lasts(h_source_lasts.size(), handle.get_stream());
+    raft::update_device(
+      d_source_lasts.data(), h_source_lasts.data(), h_source_lasts.size(), handle.get_stream());
+    auto visit_first = thrust::make_zip_iterator(thrust::make_tuple(
+      visit_source_indices.begin(), visit_vertices.begin(), visit_counts.begin()));
+    std::forward_as_tuple(std::tie(visit_source_indices, visit_vertices, visit_counts),
+                          std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        visit_first,
+        visit_first + visit_source_indices.size(),
+        renumbered_vertex_to_gpu_id_t<size_t>{d_source_lasts.data(), comm.get_size()},
+        handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      visit_source_indices.begin(),
+                      visit_source_indices.end(),
+                      visit_source_indices.begin(),
+                      [source_first] __device__(auto i) { return i - source_first; });
+  }
+
+  // 6. estimate the personalized PageRank scores, a walk visits v (1 - alpha)^-1 PPR(s, v) times
+  // (in expectation), and select the top-k vertices per source
+
+  auto num_pairs = visit_source_indices.size();
+  rmm::device_uvector<result_t> scores(num_pairs, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    visit_counts.begin(),
+    visit_counts.end(),
+    scores.begin(),
+    visit_count_to_score_t<result_t>{
+      (result_t{1.0} - alpha) / static_cast<result_t>(num_walks_per_source)});
+  visit_counts.resize(0, handle.get_stream());
+  visit_counts.shrink_to_fit(handle.get_stream());
+
+  auto triplet_first = thrust::make_zip_iterator(
+    thrust::make_tuple(visit_source_indices.begin(), scores.begin(), visit_vertices.begin()));
+  thrust::sort(handle.get_thrust_policy(),
+               triplet_first,
+               triplet_first + num_pairs,
+               higher_visit_score_first_t<vertex_t, result_t>{});
+  rmm::device_uvector<size_t> ranks(num_pairs, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(num_pairs),
+                    ranks.begin(),
+                    rank_in_source_t{visit_source_indices.data()});
+  auto num_selected = static_cast<size_t>(thrust::distance(
+    triplet_first,
+    thrust::remove_if(handle.get_thrust_policy(),
+                      triplet_first,
+                      triplet_first + num_pairs,
+                      ranks.begin(),
+                      [k] __device__(auto rank) { return rank >= k; })));
+  ranks.resize(0, handle.get_stream());
+  ranks.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<vertex_t> ret_sources(num_selected, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    visit_source_indices.begin(),
+                    visit_source_indices.begin() + num_selected,
+                    ret_sources.begin(),
+                    [sources] __device__(auto i) { return sources[i]; });
+  visit_vertices.resize(num_selected, handle.get_stream());
+  visit_vertices.shrink_to_fit(handle.get_stream());
+  scores.resize(num_selected, handle.get_stream());
+  scores.shrink_to_fit(handle.get_stream());
+
+  return std::make_tuple(std::move(ret_sources), std::move(visit_vertices), std::move(scores));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<result_t>>
+monte_carlo_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* sources,
+  size_t num_sources,
+  size_t num_walks_per_source,
+  size_t k,
+  result_t alpha,
+  size_t max_walk_length,
+  uint64_t rng_seed,
+  bool do_expensive_check)
+{
+  return detail::monte_carlo_personalized_pagerank(handle,
+                                                   graph_view,
+                                                   sources,
+                                                   num_sources,
+                                                   num_walks_per_source,
+                                                   k,
+                                                   alpha,
+                                                   max_walk_length,
+                                                   rng_seed,
+                                                   do_expensive_check);
+}
+
+}  // namespace cugraph
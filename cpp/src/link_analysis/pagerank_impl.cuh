@@ -15,30 +15,417 @@
  */
 #pragma once
 
+#include <link_analysis/batch_utils.cuh>
+#include <serialization/checkpoint_utils.cuh>
+#include <utilities/captured_iteration.hpp>
+#include <utilities/mixed_precision.hpp>
+
 #include <cugraph/algorithms.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
 #include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
 #include <cugraph/prims/count_if_e.cuh>
 #include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/property_op_utils.cuh>
 #include <cugraph/prims/reduce_v.cuh>
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/prims/transform_reduce_v.cuh>
+#include <cugraph/serialization/serializer.hpp>
+#include <cugraph/utilities/device_comm.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cub/cub.cuh>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/copy.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 namespace cugraph {
 namespace detail {
 
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename weight_t, typename result_t, typename scaled_t>
+struct update_pagerank_vertex_t {
+  result_t const* old_pageranks{nullptr};
+  result_t const* new_pageranks{nullptr};
+  weight_t const* vertex_out_weight_sums{nullptr};
+  scaled_t* scaled_pageranks{nullptr};
+
+  __device__ thrust::tuple<result_t, result_t> operator()(size_t i) const
+  {
+    auto const pagerank       = new_pageranks[i];
+    auto const out_weight_sum = vertex_out_weight_sums[i];
+    auto const is_dangling    = out_weight_sum == weight_t{0.0};
+    scaled_pageranks[i]       = static_cast<scaled_t>(
+      is_dangling ? pagerank : pagerank / static_cast<result_t>(out_weight_sum));
+    return thrust::make_tuple(std::abs(pagerank - old_pageranks[i]),
+                              is_dangling ? pagerank : result_t{0.0});
+  }
+};
+
+// a single pass (thrust::transform_reduce visits every index once, the transform also writes
+// scaled_pageranks) over the local vertices dividing the new PageRank values by the out-going edge
+// weight sums (to scaled_pageranks) and returning the (aggregate in multi-GPU) sum of the
+// differences from the old PageRank values and the sum of the new PageRank values of the dangling
+// vertices
+template <bool multi_gpu, typename weight_t, typename result_t, typename scaled_t>
+std::tuple<result_t, result_t> update_pagerank_vertices(raft::handle_t const& handle,
+                                                        size_t num_local_vertices,
+                                                        result_t const* old_pageranks,
+                                                        result_t const* new_pageranks,
+                                                        weight_t const* vertex_out_weight_sums,
+                                                        scaled_t* scaled_pageranks)
+{
+  auto sums = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_local_vertices),
+    update_pagerank_vertex_t<weight_t, result_t, scaled_t>{
+      old_pageranks, new_pageranks, vertex_out_weight_sums, scaled_pageranks},
+    thrust::make_tuple(result_t{0.0}, result_t{0.0}),
+    property_op<thrust::tuple<result_t, result_t>, thrust::plus>{});
+  if constexpr (multi_gpu) {
+    sums = host_scalar_allreduce(
+      handle.get_comms(), sums, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  return std::make_tuple(thrust::get<0>(sums), thrust::get<1>(sums));
+}
+
+int32_t constexpr update_pagerank_vertices_block_size = 512;
+
+// the update_pagerank_vertices counterpart for the iterations captured into a CUDA graph, adds the
+// unvarying part (computed from the dangling sum of the previous iteration in prev_sums[1]) to the
+// SpMV outputs, updates the PageRank values in place, and accumulates the sum of the differences
+// and the dangling sum to sums[0] and sums[1]
+template <typename vertex_t, typename weight_t, typename result_t>
+__global__ void update_pagerank_vertices_in_place(vertex_t num_vertices,
+                                                  result_t const* spmv_outputs,
+                                                  weight_t const* vertex_out_weight_sums,
+                                                  result_t alpha,
+                                                  result_t const* prev_sums,
+                                                  result_t* pageranks,
+                                                  result_t* scaled_pageranks,
+                                                  result_t* sums)
+{
+  using BlockReduce = cub::BlockReduce<result_t, update_pagerank_vertices_block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+
+  auto const unvarying_part = (prev_sums[1] * alpha + static_cast<result_t>(1.0 - alpha)) /
+                              static_cast<result_t>(num_vertices);
+  auto idx = static_cast<size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+  result_t diff_sum{0.0};
+  result_t dangling_sum{0.0};
+  while (idx < static_cast<size_t>(num_vertices)) {
+    auto const pagerank       = spmv_outputs[idx] + unvarying_part;
+    auto const out_weight_sum = vertex_out_weight_sums[idx];
+    auto const is_dangling    = out_weight_sum == weight_t{0.0};
+    diff_sum += std::abs(pagerank - pageranks[idx]);
+    if (is_dangling) { dangling_sum += pagerank; }
+    pageranks[idx] = pagerank;
+    scaled_pageranks[idx] =
+      is_dangling ? pagerank : pagerank / static_cast<result_t>(out_weight_sum);
+    idx += gridDim.x * blockDim.x;
+  }
+  diff_sum = BlockReduce(temp_storage).Sum(diff_sum);
+  __syncthreads();
+  dangling_sum = BlockReduce(temp_storage).Sum(dangling_sum);
+  if (threadIdx.x == 0) {
+    atomicAdd(sums, diff_sum);
+    atomicAdd(sums + 1, dangling_sum);
+  }
+}
+
+// single-GPU PageRank (without personalization) iterations captured into a CUDA graph, the
+// convergence is tested every capture_interval iterations; pageranks and scaled_pageranks (the
+// row properties) should be up-to-date on entry
+template <typename GraphViewType, typename result_t>
+void captured_pagerank_iterations(
+  raft::handle_t const& handle,
+  GraphViewType const& pull_graph_view,
+  typename GraphViewType::weight_type const* vertex_out_weight_sums,
+  row_properties_t<GraphViewType, result_t>& adj_matrix_row_pageranks,
+  result_t* pageranks,
+  result_t dangling_sum,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  size_t capture_interval)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(!GraphViewType::is_multi_gpu);
+
+  auto const num_vertices = pull_graph_view.get_number_of_vertices();
+
+  rmm::device_uvector<result_t> spmv_outputs(num_vertices, handle.get_stream());
+  // (diff sum, dangling sum) of the current and the previous iterations
+  rmm::device_uvector<result_t> sums(4, handle.get_stream());
+  auto prev_sums = sums.data() + 2;
+  raft::update_device(prev_sums + 1, &dangling_sum, size_t{1}, handle.get_stream());
+
+  auto e_op = [alpha] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
+    return src_val * w * alpha;
+  };
+
+  auto iteration = [&]() {
+    CUDA_TRY(cudaMemsetAsync(sums.data(), 0, 2 * sizeof(result_t), handle.get_stream()));
+    copy_v_transform_reduce_in_nbr(handle,
+                                   pull_graph_view,
+                                   adj_matrix_row_pageranks.device_view(),
+                                   dummy_properties_t<vertex_t>{}.device_view(),
+                                   e_op,
+                                   result_t{0.0},
+                                   spmv_outputs.data());
+    raft::grid_1d_thread_t update_grid(num_vertices,
+                                       update_pagerank_vertices_block_size,
+                                       handle.get_device_properties().maxGridSize[0]);
+    update_pagerank_vertices_in_place<<<update_grid.num_blocks,
+                                        update_grid.block_size,
+                                        0,
+                                        handle.get_stream()>>>(
+      num_vertices,
+      spmv_outputs.data(),
+      vertex_out_weight_sums,
+      alpha,
+      prev_sums,
+      pageranks,
+      adj_matrix_row_pageranks.value_data(),
+      sums.data());
+    CUDA_TRY(cudaMemcpyAsync(prev_sums,
+                             sums.data(),
+                             2 * sizeof(result_t),
+                             cudaMemcpyDeviceToDevice,
+                             handle.get_stream()));
+  };
+
+  std::optional<captured_iteration_t> captured_iteration{std::nullopt};
+  size_t iter{0};
+  while (true) {
+    profiler_add_counter("iterations", 1);
+
+    if (captured_iteration) {
+      captured_iteration->replay();
+    } else {
+      iteration();  // the first iteration runs uncaptured (this also tunes the kernel launches)
+      captured_iteration.emplace(handle.get_stream_view(), iteration);
+    }
+
+    iter++;
+
+    if ((iter % capture_interval == 0) || (iter >= max_iterations)) {
+      result_t diff_sum{};
+      raft::update_host(&diff_sum, prev_sums, size_t{1}, handle.get_stream());
+      handle.get_stream_view().synchronize();
+      if (diff_sum < epsilon) {
+        break;
+      } else if (iter >= max_iterations) {
+        CUGRAPH_FAIL("PageRank failed to converge.");
+      }
+    }
+  }
+}
+
+// checkpoint of the PageRank values (of the local vertices) after iter iterations
+template <bool multi_gpu, typename result_t>
+void write_pagerank_checkpoint(raft::handle_t const& handle,
+                               checkpoint_params_t const& checkpoint_params,
+                               result_t const* pageranks,
+                               size_t num_local_vertices,
+                               size_t iter)
+{
+  auto sz_bytes = sizeof(size_t) + num_local_vertices * sizeof(result_t);
+  serializer::serializer_t ser(handle, sz_bytes);
+  ser.serialize(num_local_vertices);
+  ser.serialize(pageranks, num_local_vertices);
+  write_checkpoint<multi_gpu>(
+    handle, checkpoint_params, pagerank_checkpoint_tag, static_cast<uint64_t>(iter), ser, sz_bytes);
+}
+
+// restores the PageRank values (of the local vertices) from the last checkpoint and returns the
+// checkpointed iteration count, or returns std::nullopt (and leaves pageranks untouched) if there
+// is no checkpoint
+template <bool multi_gpu, typename result_t>
+std::optional<size_t> read_pagerank_checkpoint(raft::handle_t const& handle,
+                                               checkpoint_params_t const& checkpoint_params,
+                                               result_t* pageranks,
+                                               size_t num_local_vertices)
+{
+  auto checkpoint = read_checkpoint<multi_gpu>(handle, checkpoint_params, pagerank_checkpoint_tag);
+  if (!checkpoint) { return std::nullopt; }
+
+  auto& [iter, payload] = *checkpoint;
+  serializer::serializer_t ser(handle, payload.data());
+  auto num_checkpointed_vertices = ser.unserialize<size_t>();
+  check_checkpoint_consistency<multi_gpu>(handle, num_checkpointed_vertices == num_local_vertices);
+  auto checkpointed_pageranks = ser.unserialize<result_t>(num_local_vertices);
+  thrust::copy(handle.get_thrust_policy(),
+               checkpointed_pageranks.begin(),
+               checkpointed_pageranks.end(),
+               pageranks);
+
+  return static_cast<size_t>(iter);
+}
+
+// the (uncaptured) PageRank iterations from the PageRank values in cur_pageranks (next_pageranks is
+// the ping-pong buffer). The SpMV inputs (the PageRank values divided by the out-going edge weight
+// sums, written by the same vertex pass computing the dangling sum and the convergence check, in
+// single-GPU directly to the row properties) are stored in row_value_t and the SpMV accumulates in
+// result_t. Iterates until the sum of the differences drops below epsilon (or stops decreasing if
+// stop_at_stagnation is true) and returns the pointer to the latest PageRank values (cur_pageranks
+// or next_pageranks) and the last sum of the differences; iter counts the iterations. If
+// checkpoint_params.has_value() is true, the PageRank values are checkpointed every
+// checkpoint_params->interval iterations (unless converged).
+template <typename row_value_t, typename GraphViewType, typename result_t>
+std::tuple<result_t*, result_t> pagerank_iterations(
+  raft::handle_t const& handle,
+  GraphViewType const& pull_graph_view,
+  typename GraphViewType::weight_type const* vertex_out_weight_sums,
+  std::optional<typename GraphViewType::vertex_type const*> personalization_vertices,
+  std::optional<result_t const*> personalization_values,
+  std::optional<typename GraphViewType::vertex_type> personalization_vector_size,
+  typename GraphViewType::vertex_type aggregate_personalization_vector_size,
+  result_t personalization_sum,
+  result_t* cur_pageranks,
+  result_t* next_pageranks,
+  result_t alpha,
+  result_t epsilon,
+  bool stop_at_stagnation,
+  size_t& iter,
+  size_t max_iterations,
+  std::optional<checkpoint_params_t> const& checkpoint_params)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const num_vertices = pull_graph_view.get_number_of_vertices();
+
+  row_properties_t<GraphViewType, row_value_t> adj_matrix_row_pageranks(handle, pull_graph_view);
+  rmm::device_uvector<row_value_t> scaled_pageranks(
+    GraphViewType::is_multi_gpu ? pull_graph_view.get_number_of_local_vertices() : vertex_t{0},
+    handle.get_stream());
+  auto scaled_pagerank_first =
+    GraphViewType::is_multi_gpu ? scaled_pageranks.data() : adj_matrix_row_pageranks.value_data();
+
+  result_t diff_sum{0.0};
+  result_t dangling_sum{0.0};
+  std::tie(diff_sum, dangling_sum) = update_pagerank_vertices<GraphViewType::is_multi_gpu>(
+    handle,
+    pull_graph_view.get_number_of_local_vertices(),
+    cur_pageranks,
+    cur_pageranks,
+    vertex_out_weight_sums,
+    scaled_pagerank_first);
+
+  auto prev_diff_sum = std::numeric_limits<result_t>::max();
+  while (true) {
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration", static_cast<int64_t>(iter));
+
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(
+        handle, pull_graph_view, scaled_pageranks.data(), adj_matrix_row_pageranks);
+    }
+
+    auto unvarying_part = aggregate_personalization_vector_size == 0
+                            ? (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) /
+                                static_cast<result_t>(num_vertices)
+                            : result_t{0.0};
+
+    copy_v_transform_reduce_in_nbr(
+      handle,
+      pull_graph_view,
+      adj_matrix_row_pageranks.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      [alpha] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
+        return static_cast<result_t>(src_val) * w * alpha;
+      },
+      unvarying_part,
+      next_pageranks);
+
+    if (aggregate_personalization_vector_size > 0) {
+      auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+        pull_graph_view.get_vertex_partition_view());
+      auto val_first = thrust::make_zip_iterator(
+        thrust::make_tuple(*personalization_vertices, *personalization_values));
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        val_first,
+        val_first + *personalization_vector_size,
+        [vertex_partition,
+         pageranks = next_pageranks,
+         dangling_sum,
+         personalization_sum,
+         alpha] __device__(auto val) {
+          auto v     = thrust::get<0>(val);
+          auto value = thrust::get<1>(val);
+          *(pageranks + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)) +=
+            (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) *
+            (value / personalization_sum);
+        });
+    }
+
+    std::tie(diff_sum, dangling_sum) = update_pagerank_vertices<GraphViewType::is_multi_gpu>(
+      handle,
+      pull_graph_view.get_number_of_local_vertices(),
+      cur_pageranks,
+      next_pageranks,
+      vertex_out_weight_sums,
+      scaled_pagerank_first);
+    std::swap(cur_pageranks, next_pageranks);
+
+    iter++;
+
+    auto converged = (diff_sum < epsilon) || (stop_at_stagnation && (diff_sum >= prev_diff_sum));
+    if (!converged && checkpoint_params && (iter % checkpoint_params->interval == 0)) {
+      // checkpointed before failing at max_iterations as well, to resume with a larger limit
+      write_pagerank_checkpoint<GraphViewType::is_multi_gpu>(
+        handle,
+        *checkpoint_params,
+        cur_pageranks,
+        static_cast<size_t>(pull_graph_view.get_number_of_local_vertices()),
+        iter);
+    }
+
+    if (converged) {
+      break;
+    } else if (iter >= max_iterations) {
+      CUGRAPH_FAIL("PageRank failed to converge.");
+    }
+    prev_diff_sum = diff_sum;
+  }
+
+  return std::make_tuple(cur_pageranks, diff_sum);
+}
+
 // FIXME: personalization_vector_size is confusing in OPG (local or aggregate?)
 template <typename GraphViewType, typename result_t>
 void pagerank(
@@ -53,8 +440,13 @@ void pagerank(
   result_t epsilon,
   size_t max_iterations,
   bool has_initial_guess,
-  bool do_expensive_check)
+  bool do_expensive_check,
+  std::optional<checkpoint_params_t> const& checkpoint_params = std::nullopt,
+  size_t iteration_capture_interval                           = 0,
+  bool mixed_precision                                        = false)
 {
+  scoped_phase_t phase("pagerank", handle.get_stream_view());
+
   using vertex_t = typename GraphViewType::vertex_type;
   using weight_t = typename GraphViewType::weight_type;
 
@@ -87,6 +479,7 @@ void pagerank(
   CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
                   "Invalid input argument: alpha should be in [0.0, 1.0].");
   CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  if (checkpoint_params) { check_checkpoint_params(*checkpoint_params); }
 
   if (do_expensive_check) {
     if (precomputed_vertex_out_weight_sums) {
@@ -141,8 +534,11 @@ void pagerank(
     }
   }
 
-  // 2. compute the sums of the out-going edge weights (if not provided)
+  // 2. compute the sums of the out-going edge weights (if not provided or cached)
 
+  if (!precomputed_vertex_out_weight_sums) {
+    precomputed_vertex_out_weight_sums = pull_graph_view.get_cached_out_weight_sums(handle);
+  }
   auto tmp_vertex_out_weight_sums = precomputed_vertex_out_weight_sums
                                       ? std::nullopt
                                       : std::optional<rmm::device_uvector<weight_t>>{
@@ -153,7 +549,18 @@ void pagerank(
 
   // 3. initialize pagerank values
 
-  if (has_initial_guess) {
+  std::optional<size_t> checkpointed_iter{std::nullopt};
+  if (checkpoint_params && checkpoint_params->resume) {
+    checkpointed_iter = read_pagerank_checkpoint<GraphViewType::is_multi_gpu>(
+      handle,
+      *checkpoint_params,
+      pageranks,
+      static_cast<size_t>(pull_graph_view.get_number_of_local_vertices()));
+  }
+
+  if (checkpointed_iter) {
+    // resume from the checkpointed (already normalized) PageRank values
+  } else if (has_initial_guess) {
     auto sum = reduce_v(handle, pull_graph_view, pageranks, result_t{0.0});
     CUGRAPH_EXPECTS(sum > 0.0,
                     "Invalid input argument: sum of the PageRank initial "
@@ -186,94 +593,425 @@ void pagerank(
 
   // 5. pagerank iteration
 
-  // old PageRank values
-  rmm::device_uvector<result_t> old_pageranks(pull_graph_view.get_number_of_local_vertices(),
+  // the PageRank values ping-pong between pageranks and tmp_pageranks
+  rmm::device_uvector<result_t> tmp_pageranks(pull_graph_view.get_number_of_local_vertices(),
                                               handle.get_stream());
-  row_properties_t<GraphViewType, result_t> adj_matrix_row_pageranks(handle, pull_graph_view);
-  size_t iter{0};
-  while (true) {
+  auto cur_pageranks = pageranks;
+  size_t iter{checkpointed_iter ? *checkpointed_iter : size_t{0}};
+
+  if constexpr (std::is_same_v<result_t, double>) {
+    if (mixed_precision) {
+      // float SpMV inputs until the changes drop to the float rounding error (the PageRank values
+      // sum to 1.0), the iterations below continue from there with double SpMV inputs
+      std::tie(cur_pageranks, std::ignore) =
+        pagerank_iterations<float>(handle,
+                                   pull_graph_view,
+                                   vertex_out_weight_sums,
+                                   personalization_vertices,
+                                   personalization_values,
+                                   personalization_vector_size,
+                                   aggregate_personalization_vector_size,
+                                   personalization_sum,
+                                   cur_pageranks,
+                                   tmp_pageranks.data(),
+                                   alpha,
+                                   std::max(epsilon, result_t{mixed_precision_switch_ratio}),
+                                   true,
+                                   iter,
+                                   max_iterations,
+                                   checkpoint_params);
+    }
+  }
+
+  // the captured iterations run back to back on the device (the host checks the convergence every
+  // capture_interval iterations), so not used if checkpointing
+  bool captured{false};
+  if constexpr (!GraphViewType::is_multi_gpu) {
+    if ((aggregate_personalization_vector_size == 0) && !checkpoint_params &&
+        is_iteration_capturable(handle, pull_graph_view, iteration_capture_interval)) {
+      row_properties_t<GraphViewType, result_t> adj_matrix_row_pageranks(handle, pull_graph_view);
+      result_t dangling_sum{0.0};
+      std::tie(std::ignore, dangling_sum) = update_pagerank_vertices<GraphViewType::is_multi_gpu>(
+        handle,
+        pull_graph_view.get_number_of_local_vertices(),
+        cur_pageranks,
+        cur_pageranks,
+        vertex_out_weight_sums,
+        adj_matrix_row_pageranks.value_data());
+      captured_pagerank_iterations(handle,
+                                   pull_graph_view,
+                                   vertex_out_weight_sums,
+                                   adj_matrix_row_pageranks,
+                                   cur_pageranks,
+                                   dangling_sum,
+                                   alpha,
+                                   epsilon,
+                                   max_iterations - iter,
+                                   iteration_capture_interval);
+      captured = true;
+    }
+  }
+
+  if (!captured) {
+    std::tie(cur_pageranks, std::ignore) =
+      pagerank_iterations<result_t>(handle,
+                                    pull_graph_view,
+                                    vertex_out_weight_sums,
+                                    personalization_vertices,
+                                    personalization_values,
+                                    personalization_vector_size,
+                                    aggregate_personalization_vector_size,
+                                    personalization_sum,
+                                    cur_pageranks,
+                                    cur_pageranks == pageranks ? tmp_pageranks.data() : pageranks,
+                                    alpha,
+                                    epsilon,
+                                    false,
+                                    iter,
+                                    max_iterations,
+                                    checkpoint_params);
+  }
+
+  if (cur_pageranks != pageranks) {
     thrust::copy(handle.get_thrust_policy(),
-                 pageranks,
-                 pageranks + pull_graph_view.get_number_of_local_vertices(),
-                 old_pageranks.data());
+                 cur_pageranks,
+                 cur_pageranks + pull_graph_view.get_number_of_local_vertices(),
+                 pageranks);
+  }
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t, typename result_t>
+struct pagerank_batch_e_op_t {
+  result_t alpha{};
 
-    auto vertex_val_first =
-      thrust::make_zip_iterator(thrust::make_tuple(pageranks, vertex_out_weight_sums));
+  template <typename DstValue>
+  __device__ batch_value_t<result_t> operator()(
+    vertex_t, vertex_t, weight_t w, batch_value_t<result_t> src_val, DstValue) const
+  {
+    auto scale = static_cast<result_t>(w) * alpha;
+    return thrust::make_tuple(thrust::get<0>(src_val) * scale,
+                              thrust::get<1>(src_val) * scale,
+                              thrust::get<2>(src_val) * scale,
+                              thrust::get<3>(src_val) * scale);
+  }
+};
 
-    auto dangling_sum = transform_reduce_v(
+// The PageRank values of the personalization vectors are kept in a column-major block (the leading
+// dimension is the number of local vertices). Each iteration passes over the edges once per
+// batch_width vectors still iterating, vectors drop out once converged.
+template <typename GraphViewType, typename result_t>
+void personalized_pagerank_batch(
+  raft::handle_t const& handle,
+  GraphViewType const& pull_graph_view,
+  std::optional<typename GraphViewType::weight_type const*> precomputed_vertex_out_weight_sums,
+  size_t const* personalization_offsets,
+  typename GraphViewType::vertex_type const* personalization_vertices,
+  result_t const* personalization_values,
+  size_t num_personalization_vectors,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check)
+{
+  scoped_phase_t phase("personalized_pagerank_batch", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  auto const num_vertices = pull_graph_view.get_number_of_vertices();
+  if ((num_vertices == 0) || (num_personalization_vectors == 0)) { return; }
+
+  auto const ld          = static_cast<size_t>(pull_graph_view.get_number_of_local_vertices());
+  auto const num_columns = num_personalization_vectors;
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+
+  std::vector<size_t> h_offsets(num_columns + 1);
+  raft::update_host(
+    h_offsets.data(), personalization_offsets, h_offsets.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+  CUGRAPH_EXPECTS((h_offsets[0] == 0) && std::is_sorted(h_offsets.begin(), h_offsets.end()),
+                  "Invalid input argument: personalization_offsets should start from 0 and be "
+                  "non-decreasing.");
+  auto const num_entries = h_offsets.back();
+
+  if (do_expensive_check) {
+    if (precomputed_vertex_out_weight_sums) {
+      auto num_negative_precomputed_vertex_out_weight_sums = count_if_v(
+        handle, pull_graph_view, *precomputed_vertex_out_weight_sums, [] __device__(auto val) {
+          return val < result_t{0.0};
+        });
+      CUGRAPH_EXPECTS(
+        num_negative_precomputed_vertex_out_weight_sums == 0,
+        "Invalid input argument: outgoing edge weight sum values should be non-negative.");
+    }
+
+    if (pull_graph_view.is_weighted()) {
+      auto num_nonpositive_edge_weights =
+        count_if_e(handle,
+                   pull_graph_view,
+                   dummy_properties_t<vertex_t>{}.device_view(),
+                   dummy_properties_t<vertex_t>{}.device_view(),
+                   [] __device__(vertex_t, vertex_t, weight_t w, auto, auto) { return w <= 0.0; });
+      CUGRAPH_EXPECTS(num_nonpositive_edge_weights == 0,
+                      "Invalid input argument: input graph should have postive edge weights.");
+    }
+
+    if (has_initial_guess) {
+      auto num_negative_values = count_if_v(handle,
+                                            pull_graph_view,
+                                            pageranks,
+                                            pageranks + ld * num_columns,
+                                            [] __device__(auto val) { return val < 0.0; });
+      CUGRAPH_EXPECTS(num_negative_values == 0,
+                      "Invalid input argument: initial guess values should be non-negative.");
+    }
+
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      pull_graph_view.get_vertex_partition_view());
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 pull_graph_view,
+                 personalization_vertices,
+                 personalization_vertices + num_entries,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: peresonalization vertices have invalid vertex IDs.");
+    auto num_negative_values = count_if_v(handle,
+                                          pull_graph_view,
+                                          personalization_values,
+                                          personalization_values + num_entries,
+                                          [] __device__(auto val) { return val < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: peresonalization values should be non-negative.");
+  }
+
+  // 2. compute the sums of the out-going edge weights (if not provided or cached)
+
+  if (!precomputed_vertex_out_weight_sums) {
+    precomputed_vertex_out_weight_sums = pull_graph_view.get_cached_out_weight_sums(handle);
+  }
+  auto tmp_vertex_out_weight_sums = precomputed_vertex_out_weight_sums
+                                      ? std::nullopt
+                                      : std::optional<rmm::device_uvector<weight_t>>{
+                                          pull_graph_view.compute_out_weight_sums(handle)};
+  auto vertex_out_weight_sums     = precomputed_vertex_out_weight_sums
+                                      ? *precomputed_vertex_out_weight_sums
+                                      : (*tmp_vertex_out_weight_sums).data();
+
+  // 3. initialize pagerank values
+
+  if (has_initial_guess) {
+    auto sums = compute_column_sums<GraphViewType::is_multi_gpu, result_t>(
       handle,
-      pull_graph_view,
-      vertex_val_first,
-      [] __device__(auto val) {
-        auto const pagerank       = thrust::get<0>(val);
-        auto const out_weight_sum = thrust::get<1>(val);
-        return out_weight_sum == result_t{0.0} ? pagerank : result_t{0.0};
-      },
-      result_t{0.0});
+      ld * num_columns,
+      [ld] __device__(size_t i) { return i / ld; },
+      [pageranks] __device__(size_t i) { return pageranks[i]; },
+      num_columns);
+    std::vector<result_t> h_sums(num_columns);
+    raft::update_host(h_sums.data(), sums.data(), sums.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+    CUGRAPH_EXPECTS(
+      std::all_of(h_sums.begin(), h_sums.end(), [](auto sum) { return sum > 0.0; }),
+      "Invalid input argument: sum of the PageRank initial guess values should be positive.");
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(ld * num_columns),
+                     [pageranks, sums = sums.data(), ld] __device__(size_t i) {
+                       pageranks[i] /= sums[i / ld];
+                     });
+  } else {
+    thrust::fill(handle.get_thrust_policy(),
+                 pageranks,
+                 pageranks + ld * num_columns,
+                 result_t{1.0} / static_cast<result_t>(num_vertices));
+  }
 
-    thrust::transform(handle.get_thrust_policy(),
-                      vertex_val_first,
-                      vertex_val_first + pull_graph_view.get_number_of_local_vertices(),
-                      pageranks,
-                      [] __device__(auto val) {
-                        auto const pagerank       = thrust::get<0>(val);
-                        auto const out_weight_sum = thrust::get<1>(val);
-                        auto const divisor =
-                          out_weight_sum == result_t{0.0} ? result_t{1.0} : out_weight_sum;
-                        return pagerank / divisor;
-                      });
+  // 4. sum the personalization values (per personalization vector)
 
-    copy_to_adj_matrix_row(handle, pull_graph_view, pageranks, adj_matrix_row_pageranks);
+  auto vector_index_op = personalization_vector_index_t{personalization_offsets, num_columns};
+  auto personalization_sums = compute_column_sums<GraphViewType::is_multi_gpu, result_t>(
+    handle,
+    num_entries,
+    vector_index_op,
+    [personalization_values] __device__(size_t i) { return personalization_values[i]; },
+    num_columns);
+  {
+    std::vector<result_t> h_sums(num_columns);
+    raft::update_host(
+      h_sums.data(), personalization_sums.data(), h_sums.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+    CUGRAPH_EXPECTS(std::all_of(h_sums.begin(), h_sums.end(), [](auto sum) { return sum > 0.0; }),
+                    "Invalid input argument: sum of personalization values should be positive "
+                    "for every personalization vector.");
+  }
 
-    auto unvarying_part = aggregate_personalization_vector_size == 0
-                            ? (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) /
-                                static_cast<result_t>(num_vertices)
-                            : result_t{0.0};
+  // 5. pagerank iteration
 
-    copy_v_transform_reduce_in_nbr(
+  rmm::device_uvector<result_t> old_pageranks(ld * num_columns, handle.get_stream());
+  // stand-ins for the unused entries of the last block of batch_width vectors
+  rmm::device_uvector<result_t> zeros(std::max(ld, size_t{1}), handle.get_stream());
+  rmm::device_uvector<result_t> scratch(zeros.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), zeros.begin(), zeros.end(), result_t{0.0});
+  row_properties_t<GraphViewType, batch_value_t<result_t>> adj_matrix_row_pageranks(
+    handle, pull_graph_view);
+
+  std::vector<size_t> h_active_columns(num_columns);
+  std::iota(h_active_columns.begin(), h_active_columns.end(), size_t{0});
+  std::vector<uint8_t> h_active_flags(num_columns, uint8_t{1});
+  rmm::device_uvector<size_t> active_columns(num_columns, handle.get_stream());
+  rmm::device_uvector<uint8_t> active_flags(num_columns, handle.get_stream());
+  raft::update_device(
+    active_columns.data(), h_active_columns.data(), h_active_columns.size(), handle.get_stream());
+  raft::update_device(
+    active_flags.data(), h_active_flags.data(), h_active_flags.size(), handle.get_stream());
+  std::vector<result_t> h_diff_sums(num_columns);
+
+  size_t iter{0};
+  while (true) {
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration", static_cast<int64_t>(iter));
+
+    auto num_active_columns = h_active_columns.size();
+    profiler_add_counter("vector_iterations", static_cast<int64_t>(num_active_columns));
+    auto active_column_op = active_block_index_t<true>{active_columns.data(), ld};
+    auto active_index_op  = active_block_index_t<false>{active_columns.data(), ld};
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(ld * num_active_columns),
+                     [active_index_op, pageranks, old_pageranks = old_pageranks.data()] __device__(
+                       size_t i) {
+                       auto idx           = active_index_op(i);
+                       old_pageranks[idx] = pageranks[idx];
+                     });
+
+    auto dangling_sums = compute_column_sums<GraphViewType::is_multi_gpu, result_t>(
       handle,
-      pull_graph_view,
-      adj_matrix_row_pageranks.device_view(),
-      dummy_properties_t<vertex_t>{}.device_view(),
-      [alpha] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
-        return src_val * w * alpha;
+      ld * num_active_columns,
+      active_column_op,
+      [active_index_op, pageranks, vertex_out_weight_sums, ld] __device__(size_t i) {
+        return vertex_out_weight_sums[i % ld] == weight_t{0.0} ? pageranks[active_index_op(i)]
+                                                                : result_t{0.0};
       },
-      unvarying_part,
-      pageranks);
+      num_columns);
 
-    if (aggregate_personalization_vector_size > 0) {
-      auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
-        pull_graph_view.get_vertex_partition_view());
-      auto val_first = thrust::make_zip_iterator(
-        thrust::make_tuple(*personalization_vertices, *personalization_values));
-      thrust::for_each(
-        handle.get_thrust_policy(),
-        val_first,
-        val_first + *personalization_vector_size,
-        [vertex_partition, pageranks, dangling_sum, personalization_sum, alpha] __device__(
-          auto val) {
-          auto v     = thrust::get<0>(val);
-          auto value = thrust::get<1>(val);
-          *(pageranks + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)) +=
-            (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) *
-            (value / personalization_sum);
-        });
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(ld * num_active_columns),
+                     [active_index_op, pageranks, vertex_out_weight_sums, ld] __device__(size_t i) {
+                       auto const out_weight_sum = vertex_out_weight_sums[i % ld];
+                       auto const divisor  = out_weight_sum == weight_t{0.0}
+                                               ? result_t{1.0}
+                                               : static_cast<result_t>(out_weight_sum);
+                       pageranks[active_index_op(i)] /= divisor;
+                     });
+
+    for (size_t j = 0; j < num_active_columns; j += batch_width) {
+      auto in_column = [&h_active_columns, &zeros, pageranks, ld, j, num_active_columns](size_t c) {
+        return (j + c < num_active_columns) ? pageranks + h_active_columns[j + c] * ld
+                                            : zeros.data();
+      };
+      auto out_column = [&h_active_columns, &scratch, pageranks, ld, j, num_active_columns](
+                          size_t c) {
+        return (j + c < num_active_columns) ? pageranks + h_active_columns[j + c] * ld
+                                            : scratch.data();
+      };
+      static_assert(batch_width == 4);
+      auto in_first  = thrust::make_zip_iterator(thrust::make_tuple(
+        in_column(0), in_column(1), in_column(2), in_column(3)));
+      auto out_first = thrust::make_zip_iterator(thrust::make_tuple(
+        out_column(0), out_column(1), out_column(2), out_column(3)));
+
+      copy_to_adj_matrix_row(handle, pull_graph_view, in_first, adj_matrix_row_pageranks);
+
+      copy_v_transform_reduce_in_nbr(
+        handle,
+        pull_graph_view,
+        adj_matrix_row_pageranks.device_view(),
+        dummy_properties_t<vertex_t>{}.device_view(),
+        pagerank_batch_e_op_t<vertex_t, weight_t, result_t>{alpha},
+        thrust::make_tuple(result_t{0.0}, result_t{0.0}, result_t{0.0}, result_t{0.0}),
+        out_first);
     }
 
-    auto diff_sum = transform_reduce_v(
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      pull_graph_view.get_vertex_partition_view());
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_entries),
+                     [vertex_partition,
+                      vector_index_op,
+                      personalization_vertices,
+                      personalization_values,
+                      active_flags         = active_flags.data(),
+                      dangling_sums        = dangling_sums.data(),
+                      personalization_sums = personalization_sums.data(),
+                      pageranks,
+                      ld,
+                      alpha] __device__(size_t i) {
+                       auto c = vector_index_op(i);
+                       if (!active_flags[c]) { return; }
+                       auto v = personalization_vertices[i];
+                       *(pageranks + c * ld +
+                         vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)) +=
+                         (dangling_sums[c] * alpha + static_cast<result_t>(1.0 - alpha)) *
+                         (personalization_values[i] / personalization_sums[c]);
+                     });
+
+    auto diff_sums = compute_column_sums<GraphViewType::is_multi_gpu, result_t>(
       handle,
-      pull_graph_view,
-      thrust::make_zip_iterator(thrust::make_tuple(pageranks, old_pageranks.data())),
-      [] __device__(auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
-      result_t{0.0});
+      ld * num_active_columns,
+      active_column_op,
+      [active_index_op, pageranks, old_pageranks = old_pageranks.data()] __device__(size_t i) {
+        auto idx = active_index_op(i);
+        return std::abs(pageranks[idx] - old_pageranks[idx]);
+      },
+      num_columns);
+    raft::update_host(h_diff_sums.data(), diff_sums.data(), diff_sums.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
 
     iter++;
 
-    if (diff_sum < epsilon) {
+    // converged personalization vectors drop out
+    h_active_columns.erase(std::remove_if(h_active_columns.begin(),
+                                          h_active_columns.end(),
+                                          [&h_diff_sums, &h_active_flags, epsilon](auto c) {
+                                            auto converged = h_diff_sums[c] < epsilon;
+                                            if (converged) { h_active_flags[c] = uint8_t{0}; }
+                                            return converged;
+                                          }),
+                           h_active_columns.end());
+
+    if (h_active_columns.size() == 0) {
       break;
     } else if (iter >= max_iterations) {
       CUGRAPH_FAIL("PageRank failed to converge.");
     }
+
+    raft::update_device(active_columns.data(),
+                        h_active_columns.data(),
+                        h_active_columns.size(),
+                        handle.get_stream());
+    raft::update_device(
+      active_flags.data(), h_active_flags.data(), h_active_flags.size(), handle.get_stream());
   }
 }
 
@@ -291,6 +1029,40 @@ void pagerank(raft::handle_t const& handle,
               result_t epsilon,
               size_t max_iterations,
               bool has_initial_guess,
+              bool do_expensive_check,
+              size_t iteration_capture_interval,
+              bool mixed_precision)
+{
+  detail::pagerank(handle,
+                   graph_view,
+                   precomputed_vertex_out_weight_sums,
+                   personalization_vertices,
+                   personalization_values,
+                   personalization_vector_size,
+                   pageranks,
+                   alpha,
+                   epsilon,
+                   max_iterations,
+                   has_initial_guess,
+                   do_expensive_check,
+                   std::nullopt,
+                   iteration_capture_interval,
+                   mixed_precision);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void pagerank(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+              std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+              std::optional<vertex_t const*> personalization_vertices,
+              std::optional<result_t const*> personalization_values,
+              std::optional<vertex_t> personalization_vector_size,
+              result_t* pageranks,
+              result_t alpha,
+              result_t epsilon,
+              checkpoint_params_t const& checkpoint_params,
+              size_t max_iterations,
+              bool has_initial_guess,
               bool do_expensive_check)
 {
   detail::pagerank(handle,
@@ -304,7 +1076,39 @@ void pagerank(raft::handle_t const& handle,
                    epsilon,
                    max_iterations,
                    has_initial_guess,
-                   do_expensive_check);
+                   do_expensive_check,
+                   std::make_optional(checkpoint_params));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void personalized_pagerank_batch(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  size_t const* personalization_offsets,
+  vertex_t const* personalization_vertices,
+  result_t const* personalization_values,
+  size_t num_personalization_vectors,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check)
+{
+  detail::personalized_pagerank_batch(handle,
+                                      graph_view,
+                                      precomputed_vertex_out_weight_sums,
+                                      personalization_offsets,
+                                      personalization_vertices,
+                                      personalization_values,
+                                      num_personalization_vectors,
+                                      pageranks,
+                                      alpha,
+                                      epsilon,
+                                      max_iterations,
+                                      has_initial_guess,
+                                      do_expensive_check);
 }
 
 }  // namespace cugraph
@@ -18,6 +18,7 @@
 namespace cugraph {
 
 // MG instantiation
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int32_t, float, true, true> const& graph_view,
                        std::optional<float const*> precomputed_vertex_out_weight_sums,
@@ -29,8 +30,113 @@ template void pagerank(raft::handle_t const& handle,
                        float epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
+                       bool do_expensive_check,
+                       size_t iteration_capture_interval,
+                       bool mixed_precision);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int32_t, int32_t, double, true, true> const& graph_view,
+                       std::optional<double const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int32_t const*> personalization_vertices,
+                       std::optional<double const*> personalization_values,
+                       std::optional<int32_t> personalization_vector_size,
+                       double* pageranks,
+                       double alpha,
+                       double epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check,
+                       size_t iteration_capture_interval,
+                       bool mixed_precision);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int32_t, int64_t, float, true, true> const& graph_view,
+                       std::optional<float const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int32_t const*> personalization_vertices,
+                       std::optional<float const*> personalization_values,
+                       std::optional<int32_t> personalization_vector_size,
+                       float* pageranks,
+                       float alpha,
+                       float epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check,
+                       size_t iteration_capture_interval,
+                       bool mixed_precision);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int32_t, int64_t, double, true, true> const& graph_view,
+                       std::optional<double const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int32_t const*> personalization_vertices,
+                       std::optional<double const*> personalization_values,
+                       std::optional<int32_t> personalization_vector_size,
+                       double* pageranks,
+                       double alpha,
+                       double epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check,
+                       size_t iteration_capture_interval,
+                       bool mixed_precision);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int64_t, int64_t, float, true, true> const& graph_view,
+                       std::optional<float const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int64_t const*> personalization_vertices,
+                       std::optional<float const*> personalization_values,
+                       std::optional<int64_t> personalization_vector_size,
+                       float* pageranks,
+                       float alpha,
+                       float epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check,
+                       size_t iteration_capture_interval,
+                       bool mixed_precision);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int64_t, int64_t, double, true, true> const& graph_view,
+                       std::optional<double const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int64_t const*> personalization_vertices,
+                       std::optional<double const*> personalization_values,
+                       std::optional<int64_t> personalization_vector_size,
+                       double* pageranks,
+                       double alpha,
+                       double epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check,
+                       size_t iteration_capture_interval,
+                       bool mixed_precision);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int32_t, int32_t, float, true, true> const& graph_view,
+                       std::optional<float const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int32_t const*> personalization_vertices,
+                       std::optional<float const*> personalization_values,
+                       std::optional<int32_t> personalization_vector_size,
+                       float* pageranks,
+                       float alpha,
+                       float epsilon,
+                       checkpoint_params_t const& checkpoint_params,
+                       size_t max_iterations,
+                       bool has_initial_guess,
                        bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int32_t, double, true, true> const& graph_view,
                        std::optional<double const*> precomputed_vertex_out_weight_sums,
@@ -40,10 +146,13 @@ template void pagerank(raft::handle_t const& handle,
                        double* pageranks,
                        double alpha,
                        double epsilon,
+                       checkpoint_params_t const& checkpoint_params,
                        size_t max_iterations,
                        bool has_initial_guess,
                        bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int64_t, float, true, true> const& graph_view,
                        std::optional<float const*> precomputed_vertex_out_weight_sums,
@@ -53,10 +162,13 @@ template void pagerank(raft::handle_t const& handle,
                        float* pageranks,
                        float alpha,
                        float epsilon,
+                       checkpoint_params_t const& checkpoint_params,
                        size_t max_iterations,
                        bool has_initial_guess,
                        bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int64_t, double, true, true> const& graph_view,
                        std::optional<double const*> precomputed_vertex_out_weight_sums,
@@ -66,10 +178,13 @@ template void pagerank(raft::handle_t const& handle,
                        double* pageranks,
                        double alpha,
                        double epsilon,
+                       checkpoint_params_t const& checkpoint_params,
                        size_t max_iterations,
                        bool has_initial_guess,
                        bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int64_t, int64_t, float, true, true> const& graph_view,
                        std::optional<float const*> precomputed_vertex_out_weight_sums,
@@ -79,10 +194,13 @@ template void pagerank(raft::handle_t const& handle,
                        float* pageranks,
                        float alpha,
                        float epsilon,
+                       checkpoint_params_t const& checkpoint_params,
                        size_t max_iterations,
                        bool has_initial_guess,
                        bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int64_t, int64_t, double, true, true> const& graph_view,
                        std::optional<double const*> precomputed_vertex_out_weight_sums,
@@ -92,8 +210,112 @@ template void pagerank(raft::handle_t const& handle,
                        double* pageranks,
                        double alpha,
                        double epsilon,
+                       checkpoint_params_t const& checkpoint_params,
                        size_t max_iterations,
                        bool has_initial_guess,
                        bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void personalized_pagerank_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, true, true> const& graph_view,
+  std::optional<float const*> precomputed_vertex_out_weight_sums,
+  size_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  float const* personalization_values,
+  size_t num_personalization_vectors,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void personalized_pagerank_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, true, true> const& graph_view,
+  std::optional<double const*> precomputed_vertex_out_weight_sums,
+  size_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  double const* personalization_values,
+  size_t num_personalization_vectors,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void personalized_pagerank_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, true, true> const& graph_view,
+  std::optional<float const*> precomputed_vertex_out_weight_sums,
+  size_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  float const* personalization_values,
+  size_t num_personalization_vectors,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void personalized_pagerank_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, true, true> const& graph_view,
+  std::optional<double const*> precomputed_vertex_out_weight_sums,
+  size_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  double const* personalization_values,
+  size_t num_personalization_vectors,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void personalized_pagerank_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, true, true> const& graph_view,
+  std::optional<float const*> precomputed_vertex_out_weight_sums,
+  size_t const* personalization_offsets,
+  int64_t const* personalization_vertices,
+  float const* personalization_values,
+  size_t num_personalization_vectors,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void personalized_pagerank_batch(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, true, true> const& graph_view,
+  std::optional<double const*> precomputed_vertex_out_weight_sums,
+  size_t const* personalization_offsets,
+  int64_t const* personalization_vertices,
+  double const* personalization_values,
+  size_t num_personalization_vectors,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <link_analysis/batch_utils.cuh>
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+enum class power_iteration_normalization_t { none = 0, l1, l2 };
+
+// scales the active columns of the column-major block values to make their L1 (or L2) norms 1.0
+// (columns of zeros are left unchanged)
+template <bool multi_gpu, typename result_t>
+void normalize_active_columns(raft::handle_t const& handle,
+                              result_t* values,
+                              size_t num_active_values,
+                              active_block_index_t<true> active_column_op,
+                              active_block_index_t<false> active_index_op,
+                              size_t num_columns,
+                              power_iteration_normalization_t normalization)
+{
+  if (normalization == power_iteration_normalization_t::none) { return; }
+  auto l2    = normalization == power_iteration_normalization_t::l2;
+  auto norms = compute_column_sums<multi_gpu, result_t>(
+    handle,
+    num_active_values,
+    active_column_op,
+    [active_index_op, values, l2] __device__(size_t i) {
+      auto val = values[active_index_op(i)];
+      return l2 ? val * val : std::abs(val);
+    },
+    num_columns);
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_active_values),
+    [active_column_op, active_index_op, values, norms = norms.data(), l2] __device__(size_t i) {
+      auto norm = l2 ? std::sqrt(norms[active_column_op(i)]) : norms[active_column_op(i)];
+      if (norm > result_t{0.0}) { values[active_index_op(i)] /= norm; }
+    });
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t, typename result_t>
+struct power_iteration_batch_e_op_t {
+  template <typename DstValue>
+  __device__ batch_value_t<result_t> operator()(
+    vertex_t, vertex_t, weight_t w, batch_value_t<result_t> src_val, DstValue) const
+  {
+    auto scale = static_cast<result_t>(w);
+    return thrust::make_tuple(thrust::get<0>(src_val) * scale,
+                              thrust::get<1>(src_val) * scale,
+                              thrust::get<2>(src_val) * scale,
+                              thrust::get<3>(src_val) * scale);
+  }
+};
+
+// Runs x_c <- normalize(scales[c] * A^T x_c + shift * x_c + b) for the num_vectors vectors x_c kept
+// in the column-major block values (the leading dimension is the number of local vertices, the
+// input values are the initial guesses) until the L1 norm of the change in x_c drops below
+// epsilon. b is biases (shared by every vector) if biases is not nullptr and the constant bias
+// otherwise. As in personalized_pagerank_batch, each iteration passes over the edges once per
+// batch_width vectors still iterating and vectors drop out once converged. If aitken_period is
+// not 0, the values are extrapolated with Aitken's delta-squared process (from the last three
+// iterates) every aitken_period iterations; convergence is tested on the plain iterations only, so
+// this changes only the number of iterations. Returns the number of iterations per vector and
+// whether every vector converged within max_iterations.
+template <typename GraphViewType, typename result_t>
+std::tuple<std::vector<size_t>, bool> batched_power_iteration(
+  raft::handle_t const& handle,
+  GraphViewType const& pull_graph_view,
+  result_t* values,
+  size_t num_vectors,
+  std::vector<result_t> const& scales,
+  result_t shift,
+  result_t const* biases,
+  result_t bias,
+  power_iteration_normalization_t normalization,
+  result_t epsilon,
+  size_t max_iterations,
+  size_t aitken_period)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  CUGRAPH_EXPECTS(scales.size() == num_vectors,
+                  "Invalid input argument: scales.size() should coincide with num_vectors.");
+  CUGRAPH_EXPECTS((aitken_period == 0) || (aitken_period >= 3),
+                  "Invalid input argument: aitken_period should be 0 or larger than 2.");
+
+  auto const ld          = static_cast<size_t>(pull_graph_view.get_number_of_local_vertices());
+  auto const num_columns = num_vectors;
+
+  std::vector<size_t> h_iterations(num_columns, size_t{0});
+  if (num_columns == 0) { return std::make_tuple(std::move(h_iterations), true); }
+
+  rmm::device_uvector<result_t> d_scales(num_columns, handle.get_stream());
+  raft::update_device(d_scales.data(), scales.data(), scales.size(), handle.get_stream());
+
+  rmm::device_uvector<result_t> next_values(ld * num_columns, handle.get_stream());
+  // the last two iterates (for the Aitken extrapolation)
+  rmm::device_uvector<result_t> prev_values(aitken_period > 0 ? ld * num_columns : size_t{0},
+                                            handle.get_stream());
+  rmm::device_uvector<result_t> prev_prev_values(prev_values.size(), handle.get_stream());
+  // stand-ins for the unused entries of the last block of batch_width vectors
+  rmm::device_uvector<result_t> zeros(std::max(ld, size_t{1}), handle.get_stream());
+  rmm::device_uvector<result_t> scratch(zeros.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), zeros.begin(), zeros.end(), result_t{0.0});
+  row_properties_t<GraphViewType, batch_value_t<result_t>> adj_matrix_row_values(handle,
+                                                                                  pull_graph_view);
+
+  std::vector<size_t> h_active_columns(num_columns);
+  std::iota(h_active_columns.begin(), h_active_columns.end(), size_t{0});
+  rmm::device_uvector<size_t> active_columns(num_columns, handle.get_stream());
+  raft::update_device(
+    active_columns.data(), h_active_columns.data(), h_active_columns.size(), handle.get_stream());
+  std::vector<result_t> h_diff_sums(num_columns);
+
+  normalize_active_columns<GraphViewType::is_multi_gpu>(
+    handle,
+    values,
+    ld * num_columns,
+    active_block_index_t<true>{active_columns.data(), ld},
+    active_block_index_t<false>{active_columns.data(), ld},
+    num_columns,
+    normalization);
+
+  size_t iter{0};
+  while (true) {
+    profiler_add_counter("iterations", 1);
+
+    auto num_active_columns = h_active_columns.size();
+    auto num_active_values  = ld * num_active_columns;
+    profiler_add_counter("vector_iterations", static_cast<int64_t>(num_active_columns));
+    auto active_column_op = active_block_index_t<true>{active_columns.data(), ld};
+    auto active_index_op  = active_block_index_t<false>{active_columns.data(), ld};
+
+    for (size_t j = 0; j < num_active_columns; j += batch_width) {
+      auto in_column = [&h_active_columns, &zeros, values, ld, j, num_active_columns](size_t c) {
+        return (j + c < num_active_columns) ? values + h_active_columns[j + c] * ld
+                                            : zeros.data();
+      };
+      auto out_column = [&h_active_columns, &scratch, &next_values, ld, j, num_active_columns](
+                          size_t c) {
+        return (j + c < num_active_columns) ? next_values.data() + h_active_columns[j + c] * ld
+                                            : scratch.data();
+      };
+      static_assert(batch_width == 4);
+      auto in_first  = thrust::make_zip_iterator(
+        thrust::make_tuple(in_column(0), in_column(1), in_column(2), in_column(3)));
+      auto out_first = thrust::make_zip_iterator(
+        thrust::make_tuple(out_column(0), out_column(1), out_column(2), out_column(3)));
+
+      copy_to_adj_matrix_row(handle, pull_graph_view, in_first, adj_matrix_row_values);
+
+      copy_v_transform_reduce_in_nbr(
+        handle,
+        pull_graph_view,
+        adj_matrix_row_values.device_view(),
+        dummy_properties_t<vertex_t>{}.device_view(),
+        power_iteration_batch_e_op_t<vertex_t, weight_t, result_t>{},
+        thrust::make_tuple(result_t{0.0}, result_t{0.0}, result_t{0.0}, result_t{0.0}),
+        out_first);
+    }
+
+    // values <- scale * A^T x + shift * x + b (keeping the old values for the convergence test &
+    // the extrapolation)
+
+    if (aitken_period > 0) {
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(num_active_values),
+                       [active_index_op,
+                        values,
+                        prev_values      = prev_values.data(),
+                        prev_prev_values = prev_prev_values.data()] __device__(size_t i) {
+                         auto idx              = active_index_op(i);
+                         prev_prev_values[idx] = prev_values[idx];
+                         prev_values[idx]      = values[idx];
+                       });
+    }
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_active_values),
+                     [active_column_op,
+                      active_index_op,
+                      values,
+                      next_values = next_values.data(),
+                      scales      = d_scales.data(),
+                      shift,
+                      biases,
+                      bias,
+                      ld] __device__(size_t i) {
+                       auto idx     = active_index_op(i);
+                       auto old_val = values[idx];
+                       auto new_val = next_values[idx] * scales[active_column_op(i)] +
+                                      shift * old_val + (biases != nullptr ? biases[i % ld] : bias);
+                       next_values[idx] = old_val;
+                       values[idx]      = new_val;
+                     });
+    normalize_active_columns<GraphViewType::is_multi_gpu>(handle,
+                                                          values,
+                                                          num_active_values,
+                                                          active_column_op,
+                                                          active_index_op,
+                                                          num_columns,
+                                                          normalization);
+
+    auto diff_sums = compute_column_sums<GraphViewType::is_multi_gpu, result_t>(
+      handle,
+      num_active_values,
+      active_column_op,
+      [active_index_op, values, next_values = next_values.data()] __device__(size_t i) {
+        auto idx = active_index_op(i);
+        return std::abs(values[idx] - next_values[idx]);
+      },
+      num_columns);
+    raft::update_host(h_diff_sums.data(), diff_sums.data(), diff_sums.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    iter++;
+    for (auto c : h_active_columns) {
+      h_iterations[c] = iter;
+    }
+
+    // converged vectors drop out
+    h_active_columns.erase(
+      std::remove_if(h_active_columns.begin(),
+                     h_active_columns.end(),
+                     [&h_diff_sums, epsilon](auto c) { return h_diff_sums[c] < epsilon; }),
+      h_active_columns.end());
+
+    if (h_active_columns.size() == 0) {
+      break;
+    } else if (iter >= max_iterations) {
+      return std::make_tuple(std::move(h_iterations), false);
+    }
+
+    raft::update_device(active_columns.data(),
+                        h_active_columns.data(),
+                        h_active_columns.size(),
+                        handle.get_stream());
+
+    if ((aitken_period > 0) && (iter % aitken_period == 0)) {
+      num_active_values = ld * h_active_columns.size();
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(num_active_values),
+        [active_index_op,
+         values,
+         prev_values      = prev_values.data(),
+         prev_prev_values = prev_prev_values.data()] __device__(size_t i) {
+          auto idx   = active_index_op(i);
+          auto d1    = values[idx] - prev_values[idx];
+          auto d0    = prev_values[idx] - prev_prev_values[idx];
+          auto denom = d1 - d0;
+          // skip the values that are (numerically) not converging geometrically
+          if (std::abs(denom) >
+              std::numeric_limits<result_t>::epsilon() * std::abs(values[idx]) * result_t{16.0}) {
+            auto extrapolated = values[idx] - d1 * d1 / denom;
+            if (std::isfinite(extrapolated)) { values[idx] = extrapolated; }
+          }
+        });
+      normalize_active_columns<GraphViewType::is_multi_gpu>(handle,
+                                                            values,
+                                                            num_active_values,
+                                                            active_column_op,
+                                                            active_index_op,
+                                                            num_columns,
+                                                            normalization);
+    }
+  }
+
+  return std::make_tuple(std::move(h_iterations), true);
+}
+
+}  // namespace detail
+}  // namespace cugraph
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <structure/two_hop_paths.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/utilities/collect_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// the maximum number of 2-hop paths enumerated at a time (a query vertex with more 2-hop paths
+// forms a batch by itself)
+size_t constexpr max_num_two_hop_paths_per_batch{size_t{1} << 26};
+
+template <typename weight_t>
+struct jaccard_functor_t {
+  template <typename edge_t>
+  __device__ weight_t operator()(edge_t degree0, edge_t degree1, edge_t intersection) const
+  {
+    return static_cast<weight_t>(intersection) /
+           static_cast<weight_t>(degree0 + degree1 - intersection);
+  }
+};
+
+template <typename weight_t>
+struct overlap_functor_t {
+  template <typename edge_t>
+  __device__ weight_t operator()(edge_t degree0, edge_t degree1, edge_t intersection) const
+  {
+    return static_cast<weight_t>(intersection) /
+           static_cast<weight_t>(degree0 < degree1 ? degree0 : degree1);
+  }
+};
+
+// (query index, score, candidate) tuples are ordered by query index, then in descending score
+// order, and then by candidate vertex ID (to break ties deterministically)
+template <typename vertex_t, typename weight_t>
+struct higher_score_first_t {
+  __device__ bool operator()(thrust::tuple<size_t, weight_t, vertex_t> lhs,
+                             thrust::tuple<size_t, weight_t, vertex_t> rhs) const
+  {
+    if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+      return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+    } else if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+      return thrust::get<1>(lhs) > thrust::get<1>(rhs);
+    } else {
+      return thrust::get<2>(lhs) < thrust::get<2>(rhs);
+    }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+struct rank_in_query_t {
+  size_t const* sorted_query_indices{nullptr};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    auto first = thrust::lower_bound(
+      thrust::seq, sorted_query_indices, sorted_query_indices + i, sorted_query_indices[i]);
+    return static_cast<size_t>(thrust::distance(first, sorted_query_indices + i));
+  }
+};
+
+// reduces the 2-hop paths of a batch to (query, candidate) pairs with the intersection sizes (the
+// number of the paths per pair), scores the pairs, and appends the top-k pairs of every query
+// vertex to the output
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu,
+          typename SimilarityFunctor>
+void append_top_k_pairs(raft::handle_t const& handle,
+                        vertex_t const* query_vertices,
+                        rmm::device_uvector<edge_t> const& degrees,
+                        vertex_t local_vertex_first,
+                        std::vector<vertex_t> const& vertex_partition_lasts,
+                        size_t k,
+                        SimilarityFunctor similarity_op,
+                        rmm::device_uvector<size_t>& path_query_indices,
+                        rmm::device_uvector<vertex_t>& path_candidates,
+                        rmm::device_uvector<vertex_t>& ret_query_vertices,
+                        rmm::device_uvector<vertex_t>& ret_candidates,
+                        rmm::device_uvector<weight_t>& ret_scores)
+{
+  // 1. count the 2-hop paths per (query, candidate) pair
+
+  auto num_paths  = path_query_indices.size();
+  auto path_first = thrust::make_zip_iterator(
+    thrust::make_tuple(path_query_indices.begin(), path_candidates.begin()));
+  thrust::sort(handle.get_thrust_policy(), path_first, path_first + num_paths);
+
+  rmm::device_uvector<size_t> pair_query_indices(num_paths, handle.get_stream());
+  rmm::device_uvector<vertex_t> pair_candidates(num_paths, handle.get_stream());
+  rmm::device_uvector<edge_t> pair_intersections(num_paths, handle.get_stream());
+  auto pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(pair_query_indices.begin(), pair_candidates.begin()));
+  auto num_pairs = static_cast<size_t>(
+    thrust::distance(pair_first,
+                     thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           path_first,
+                                           path_first + num_paths,
+                                           thrust::make_constant_iterator(edge_t{1}),
+                                           pair_first,
+                                           pair_intersections.begin())
+                       .first));
+  path_query_indices.resize(0, handle.get_stream());
+  path_query_indices.shrink_to_fit(handle.get_stream());
+  path_candidates.resize(0, handle.get_stream());
+  path_candidates.shrink_to_fit(handle.get_stream());
+  pair_query_indices.resize(num_pairs, handle.get_stream());
+  pair_candidates.resize(num_pairs, handle.get_stream());
+  pair_intersections.resize(num_pairs, handle.get_stream());
+
+  // 2. compute the similarity scores
+
+  rmm::device_uvector<edge_t> candidate_degrees(num_pairs, handle.get_stream());
+  if constexpr (multi_gpu) {
+    candidate_degrees = collect_values_for_vertices(handle.get_comms(),
+                                                    pair_candidates.begin(),
+                                                    pair_candidates.end(),
+                                                    degrees.begin(),
+                                                    vertex_partition_lasts,
+                                                    handle.get_stream());
+  } else {
+    thrust::gather(handle.get_thrust_policy(),
+                   pair_candidates.begin(),
+                   pair_candidates.end(),
+                   degrees.begin(),
+                   candidate_degrees.begin());
+  }
+
+  rmm::device_uvector<weight_t> pair_scores(num_pairs, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(thrust::make_tuple(
+      pair_query_indices.begin(), candidate_degrees.begin(), pair_intersections.begin())),
+    thrust::make_zip_iterator(thrust::make_tuple(
+      pair_query_indices.end(), candidate_degrees.end(), pair_intersections.end())),
+    pair_scores.begin(),
+    [query_vertices,
+     degrees = degrees.data(),
+     local_vertex_first,
+     similarity_op] __device__(auto t) {
+      return similarity_op(degrees[query_vertices[thrust::get<0>(t)] - local_vertex_first],
+                           thrust::get<1>(t),
+                           thrust::get<2>(t));
+    });
+  candidate_degrees.resize(0, handle.get_stream());
+  candidate_degrees.shrink_to_fit(handle.get_stream());
+  pair_intersections.resize(0, handle.get_stream());
+  pair_intersections.shrink_to_fit(handle.get_stream());
+
+  // 3. select the top-k candidates per query vertex
+
+  auto triplet_first = thrust::make_zip_iterator(
+    thrust::make_tuple(pair_query_indices.begin(), pair_scores.begin(), pair_candidates.begin()));
+  thrust::sort(handle.get_thrust_policy(),
+               triplet_first,
+               triplet_first + num_pairs,
+               higher_score_first_t<vertex_t, weight_t>{});
+  rmm::device_uvector<size_t> ranks(num_pairs, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(num_pairs),
+                    ranks.begin(),
+                    rank_in_query_t{pair_query_indices.data()});
+  auto num_selected = static_cast<size_t>(thrust::distance(
+    triplet_first,
+    thrust::remove_if(handle.get_thrust_policy(),
+                      triplet_first,
+                      triplet_first + num_pairs,
+                      ranks.begin(),
+                      [k] __device__(auto rank) { return rank >= k; })));
+
+  auto old_size = ret_query_vertices.size();
+  ret_query_vertices.resize(old_size + num_selected, handle.get_stream());
+  ret_candidates.resize(old_size + num_selected, handle.get_stream());
+  ret_scores.resize(old_size + num_selected, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    pair_query_indices.begin(),
+                    pair_query_indices.begin() + num_selected,
+                    ret_query_vertices.begin() + old_size,
+                    [query_vertices] __device__(auto i) { return query_vertices[i]; });
+  thrust::copy(handle.get_thrust_policy(),
+               pair_candidates.begin(),
+               pair_candidates.begin() + num_selected,
+               ret_candidates.begin() + old_size);
+  thrust::copy(handle.get_thrust_policy(),
+               pair_scores.begin(),
+               pair_scores.begin() + num_selected,
+               ret_scores.begin() + old_size);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu,
+          typename SimilarityFunctor>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+similarity_top_k(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 vertex_t const* query_vertices,
+                 size_t num_query_vertices,
+                 size_t k,
+                 SimilarityFunctor similarity_op,
+                 bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: similarity currently supports only undirected "
+                  "(symmetric) graphs.");
+  CUGRAPH_EXPECTS(!graph_view.is_multigraph(),
+                  "Invalid input argument: similarity currently does not support multi-graphs.");
+  CUGRAPH_EXPECTS(k > 0, "Invalid input argument: k should be positive.");
+  CUGRAPH_EXPECTS((num_query_vertices == 0) || (query_vertices != nullptr),
+                  "Invalid input argument: query_vertices cannot be null.");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, multi_gpu>(
+      graph_view.get_vertex_partition_view());
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 graph_view,
+                 query_vertices,
+                 query_vertices + num_query_vertices,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: query_vertices have invalid vertex IDs.");
+  }
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  std::vector<vertex_t> vertex_partition_lasts{};
+  if constexpr (multi_gpu) { vertex_partition_lasts = graph_view.get_vertex_partition_lasts(); }
+
+  // 2. store the neighbor lists of the local vertices in a local CSR (excluding self-loops, the
+  // degrees exclude self-loops as well)
+
+  auto [majors, minors] = detail::extract_local_major_edgelist(handle, graph_view);
+  auto offsets          = detail::compute_sorted_edge_offsets<vertex_t, edge_t>(
+    handle, majors, local_vertex_first, num_local_vertices);
+  majors.resize(0, handle.get_stream());
+  majors.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<edge_t> degrees(num_local_vertices, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    offsets.begin() + 1,
+                    offsets.end(),
+                    offsets.begin(),
+                    degrees.begin(),
+                    thrust::minus<edge_t>());
+
+  // 3. enumerate the 2-hop paths from the query vertices in batches, the number of the 2-hop paths
+  // from a query vertex q to a candidate vertex c is the size of the intersection of their neighbor
+  // lists
+
+  rmm::device_uvector<vertex_t> ret_query_vertices(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> ret_candidates(0, handle.get_stream());
+  rmm::device_uvector<weight_t> ret_scores(0, handle.get_stream());
+
+  detail::for_each_two_hop_path_batch<vertex_t, edge_t, multi_gpu>(
+    handle,
+    minors,
+    offsets,
+    local_vertex_first,
+    vertex_partition_lasts,
+    query_vertices,
+    num_query_vertices,
+    max_num_two_hop_paths_per_batch,
+    [&](rmm::device_uvector<size_t>& path_query_indices,
+        rmm::device_uvector<vertex_t>& path_candidates) {
+      append_top_k_pairs<vertex_t, edge_t, weight_t, multi_gpu>(handle,
+                                                                query_vertices,
+                                                                degrees,
+                                                                local_vertex_first,
+                                                                vertex_partition_lasts,
+                                                                k,
+                                                                similarity_op,
+                                                                path_query_indices,
+                                                                path_candidates,
+                                                                ret_query_vertices,
+                                                                ret_candidates,
+                                                                ret_scores);
+    });
+
+  return std::make_tuple(
+    std::move(ret_query_vertices), std::move(ret_candidates), std::move(ret_scores));
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+jaccard_top_k(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+              vertex_t const* query_vertices,
+              size_t num_query_vertices,
+              size_t k,
+              bool do_expensive_check)
+{
+  return similarity_top_k(handle,
+                          graph_view,
+                          query_vertices,
+                          num_query_vertices,
+                          k,
+                          jaccard_functor_t<weight_t>{},
+                          do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+overlap_top_k(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+              vertex_t const* query_vertices,
+              size_t num_query_vertices,
+              size_t k,
+              bool do_expensive_check)
+{
+  return similarity_top_k(handle,
+                          graph_view,
+                          query_vertices,
+                          num_query_vertices,
+                          k,
+                          overlap_functor_t<weight_t>{},
+                          do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,637 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_readers.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename T>
+using pinned_host_vector_t =
+  thrust::host_vector<T, thrust::system::cuda::experimental::pinned_allocator<T>>;
+
+constexpr uint8_t line_status_skip{0};  // blank or comment line
+constexpr uint8_t line_status_edge{1};
+constexpr uint8_t line_status_malformed{2};
+
+__device__ inline char const* skip_separators(char const* p, char const* last, char delimiter)
+{
+  while ((p != last) && ((*p == ' ') || (*p == '\t') || (*p == '\r') || (*p == delimiter))) {
+    ++p;
+  }
+  return p;
+}
+
+__device__ inline bool is_token_last(char const* p, char const* last, char delimiter)
+{
+  return (p == last) || (*p == ' ') || (*p == '\t') || (*p == '\r') || (*p == delimiter);
+}
+
+__device__ inline bool parse_integer(char const*& p, char const* last, int64_t& value)
+{
+  bool negative{false};
+  if ((p != last) && ((*p == '-') || (*p == '+'))) {
+    negative = (*p == '-');
+    ++p;
+  }
+  if ((p == last) || (*p < '0') || (*p > '9')) { return false; }
+  int64_t ret{0};
+  while ((p != last) && (*p >= '0') && (*p <= '9')) {
+    auto digit = static_cast<int64_t>(*p - '0');
+    if (ret > (std::numeric_limits<int64_t>::max() - digit) / 10) { return false; }  // overflow
+    ret = ret * 10 + digit;
+    ++p;
+  }
+  value = negative ? -ret : ret;
+  return true;
+}
+
+// decimal mantissa (up to 19 significant digits) times a power of 10, not necessarily correctly
+// rounded in the last bit
+__device__ inline bool parse_real(char const*& p, char const* last, double& value)
+{
+  constexpr int max_significant_digits{19};
+
+  bool negative{false};
+  if ((p != last) && ((*p == '-') || (*p == '+'))) {
+    negative = (*p == '-');
+    ++p;
+  }
+  uint64_t mantissa{0};
+  int num_significant_digits{0};
+  int64_t exponent{0};
+  bool has_digits{false};
+  while ((p != last) && (*p >= '0') && (*p <= '9')) {
+    if (num_significant_digits < max_significant_digits) {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+      if (mantissa > 0) { ++num_significant_digits; }
+    } else {
+      ++exponent;
+    }
+    has_digits = true;
+    ++p;
+  }
+  if ((p != last) && (*p == '.')) {
+    ++p;
+    while ((p != last) && (*p >= '0') && (*p <= '9')) {
+      if (num_significant_digits < max_significant_digits) {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+        if (mantissa > 0) { ++num_significant_digits; }
+        --exponent;
+      }
+      has_digits = true;
+      ++p;
+    }
+  }
+  if (!has_digits) { return false; }
+  if ((p != last) && ((*p == 'e') || (*p == 'E'))) {
+    ++p;
+    int64_t e{0};
+    if (!parse_integer(p, last, e)) { return false; }
+    exponent += std::min(std::max(e, int64_t{-1000}), int64_t{1000});
+  }
+  auto ret = static_cast<double>(mantissa);
+  if (mantissa != 0) {
+    ret = exponent >= 0 ? ret * ::pow(10.0, static_cast<double>(exponent))
+                        : ret / ::pow(10.0, static_cast<double>(-exponent));
+  }
+  value = negative ? -ret : ret;
+  return true;
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+struct is_newline_t {
+  __device__ bool operator()(char c) const { return c == '\n'; }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+struct is_not_edge_line_t {
+  __device__ bool operator()(uint8_t status) const { return status != line_status_edge; }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+struct is_off_diagonal_t {
+  template <typename EdgeTuple>
+  __device__ bool operator()(EdgeTuple e) const
+  {
+    return thrust::get<0>(e) != thrust::get<1>(e);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct parse_edge_line_t {
+  char const* chars{nullptr};
+  size_t const* line_lasts{nullptr};  // offsets of the '\n' (or the end of the chunk) of each line
+  char delimiter{' '};
+  bool parse_weight{false};
+  int64_t index_base{0};
+  int64_t num_vertices{0};  // vertex IDs (after subtracting index_base) should be smaller than this
+
+  __device__ thrust::tuple<vertex_t, vertex_t, weight_t, uint8_t> operator()(size_t i) const
+  {
+    auto p    = chars + (i == 0 ? size_t{0} : line_lasts[i - 1] + 1);
+    auto last = chars + line_lasts[i];
+
+    thrust::tuple<vertex_t, vertex_t, weight_t, uint8_t> ret{
+      vertex_t{0}, vertex_t{0}, weight_t{1.0}, line_status_skip};
+    p = skip_separators(p, last, delimiter);
+    if ((p == last) || (*p == '#') || (*p == '%')) { return ret; }
+
+    thrust::get<3>(ret) = line_status_malformed;
+    int64_t src{0};
+    int64_t dst{0};
+    if (!parse_integer(p, last, src) || !is_token_last(p, last, delimiter)) { return ret; }
+    p = skip_separators(p, last, delimiter);
+    if (!parse_integer(p, last, dst) || !is_token_last(p, last, delimiter)) { return ret; }
+    src -= index_base;
+    dst -= index_base;
+    if ((src < 0) || (src >= num_vertices) || (dst < 0) || (dst >= num_vertices)) { return ret; }
+    if (parse_weight) {
+      p = skip_separators(p, last, delimiter);
+      double w{0.0};
+      if (!parse_real(p, last, w) || !is_token_last(p, last, delimiter)) { return ret; }
+      thrust::get<2>(ret) = static_cast<weight_t>(w);
+    }
+    thrust::get<0>(ret) = static_cast<vertex_t>(src);
+    thrust::get<1>(ret) = static_cast<vertex_t>(dst);
+    thrust::get<3>(ret) = line_status_edge;
+
+    return ret;
+  }
+};
+
+// copy a chunk of complete lines to the GPU and parse the edges there (one thread per line);
+// returns (srcs, dsts, weights), weights is empty if parse_weight is false
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+parse_edgelist_chunk(raft::handle_t const& handle,
+                     char const* h_chars,
+                     size_t num_chars,
+                     char delimiter,
+                     bool parse_weight,
+                     int64_t index_base,
+                     int64_t num_vertices)
+{
+  rmm::device_uvector<char> d_chars(num_chars, handle.get_stream());
+  raft::update_device(d_chars.data(), h_chars, num_chars, handle.get_stream());
+
+  auto num_newlines = static_cast<size_t>(
+    thrust::count(handle.get_thrust_policy(), d_chars.begin(), d_chars.end(), '\n'));
+  auto terminated = h_chars[num_chars - 1] == '\n';
+  rmm::device_uvector<size_t> line_lasts(num_newlines + (terminated ? 0 : 1), handle.get_stream());
+  thrust::copy_if(handle.get_thrust_policy(),
+                  thrust::make_counting_iterator(size_t{0}),
+                  thrust::make_counting_iterator(num_chars),
+                  d_chars.begin(),
+                  line_lasts.begin(),
+                  is_newline_t{});
+  if (!terminated) { line_lasts.set_element_async(num_newlines, num_chars, handle.get_stream()); }
+
+  auto num_lines = line_lasts.size();
+  rmm::device_uvector<vertex_t> srcs(num_lines, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(num_lines, handle.get_stream());
+  rmm::device_uvector<weight_t> weights(num_lines, handle.get_stream());
+  rmm::device_uvector<uint8_t> statuses(num_lines, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_lines),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(srcs.begin(), dsts.begin(), weights.begin(), statuses.begin())),
+    parse_edge_line_t<vertex_t, weight_t>{
+      d_chars.data(), line_lasts.data(), delimiter, parse_weight, index_base, num_vertices});
+
+  auto num_malformed_lines = thrust::count(
+    handle.get_thrust_policy(), statuses.begin(), statuses.end(), line_status_malformed);
+  CUGRAPH_EXPECTS(num_malformed_lines == 0,
+                  "Invalid input argument: the input file has malformed lines (or vertex IDs out "
+                  "of range).");
+
+  auto edge_first =
+    thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin(), weights.begin()));
+  auto num_edges = static_cast<size_t>(thrust::distance(
+    edge_first,
+    thrust::remove_if(handle.get_thrust_policy(),
+                      edge_first,
+                      edge_first + num_lines,
+                      statuses.begin(),
+                      is_not_edge_line_t{})));
+  srcs.resize(num_edges, handle.get_stream());
+  srcs.shrink_to_fit(handle.get_stream());
+  dsts.resize(num_edges, handle.get_stream());
+  dsts.shrink_to_fit(handle.get_stream());
+  weights.resize(parse_weight ? num_edges : size_t{0}, handle.get_stream());
+  weights.shrink_to_fit(handle.get_stream());
+
+  return std::make_tuple(std::move(srcs), std::move(dsts), std::move(weights));
+}
+
+// parse the lines whose first bytes are in [range_first, range_last) (range_first is either
+// data_offset, the offset of the first line, or any byte after that); the file is read in chunks of
+// chunk_size bytes, the partial last line of a chunk is carried over to the next chunk
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+read_edgelist_range(raft::handle_t const& handle,
+                    std::ifstream& file,
+                    size_t file_size,
+                    size_t data_offset,
+                    size_t range_first,
+                    size_t range_last,
+                    size_t chunk_size,
+                    char delimiter,
+                    bool parse_weight,
+                    int64_t index_base,
+                    int64_t num_vertices)
+{
+  std::vector<rmm::device_uvector<vertex_t>> chunk_srcs{};
+  std::vector<rmm::device_uvector<vertex_t>> chunk_dsts{};
+  std::vector<rmm::device_uvector<weight_t>> chunk_weights{};
+
+  pinned_host_vector_t<char> h_buffer(std::max(chunk_size, size_t{1}));
+  // the line including the byte at range_first - 1 belongs to the previous range
+  bool skip_first_line = range_first > data_offset;
+  auto buffer_offset   = skip_first_line ? range_first - 1 : range_first;  // offset of h_buffer[0]
+  size_t num_carried{0};
+  bool done = range_first >= range_last;
+  while (!done) {
+    if (num_carried == h_buffer.size()) {  // a line longer than the buffer
+      h_buffer.resize(h_buffer.size() * 2);
+    }
+    auto num_read =
+      std::min(h_buffer.size() - num_carried, file_size - (buffer_offset + num_carried));
+    file.seekg(static_cast<std::streamoff>(buffer_offset + num_carried));
+    file.read(h_buffer.data() + num_carried, static_cast<std::streamsize>(num_read));
+    CUGRAPH_EXPECTS(file.good(), "failed to read the input file.");
+    auto num_chars = num_carried + num_read;
+    auto at_eof    = buffer_offset + num_chars == file_size;
+
+    auto first = h_buffer.data();
+    size_t parse_first{0};
+    if (skip_first_line) {
+      auto it = std::find(first, first + num_chars, '\n');
+      if (it == first + num_chars) {
+        buffer_offset += num_chars;
+        num_carried = 0;
+        done        = at_eof;
+        continue;
+      }
+      parse_first     = static_cast<size_t>(std::distance(first, it)) + 1;
+      skip_first_line = false;
+    }
+
+    auto parse_last = parse_first;
+    if (range_last <= buffer_offset + parse_first) {
+      done = true;
+    } else {
+      if (range_last < buffer_offset + num_chars) {  // find the end of the line at range_last - 1
+        auto it = std::find(first + (range_last - 1 - buffer_offset), first + num_chars, '\n');
+        if (it != first + num_chars) {
+          parse_last = static_cast<size_t>(std::distance(first, it)) + 1;
+          done       = true;
+        }
+      }
+      if (!done) {
+        if (at_eof) {
+          parse_last = num_chars;
+          done       = true;
+        } else {  // parse till the last complete line
+          auto it    = std::find(std::make_reverse_iterator(first + num_chars),
+                              std::make_reverse_iterator(first + parse_first),
+                              '\n');
+          parse_last = static_cast<size_t>(std::distance(first, it.base()));
+        }
+      }
+    }
+
+    if (parse_last > parse_first) {
+      auto [srcs, dsts, weights] =
+        parse_edgelist_chunk<vertex_t, weight_t>(handle,
+                                                 first + parse_first,
+                                                 parse_last - parse_first,
+                                                 delimiter,
+                                                 parse_weight,
+                                                 index_base,
+                                                 num_vertices);
+      chunk_srcs.push_back(std::move(srcs));
+      chunk_dsts.push_back(std::move(dsts));
+      chunk_weights.push_back(std::move(weights));
+    }
+
+    // parse_edgelist_chunk synchronizes handle.get_stream(), so h_buffer can be overwritten here
+    num_carried = num_chars - parse_last;
+    std::memmove(first, first + parse_last, num_carried);
+    buffer_offset += parse_last;
+  }
+
+  if (chunk_srcs.size() == 1) {
+    return std::make_tuple(
+      std::move(chunk_srcs[0]), std::move(chunk_dsts[0]), std::move(chunk_weights[0]));
+  }
+
+  size_t num_edges{0};
+  for (size_t i = 0; i < chunk_srcs.size(); ++i) {
+    num_edges += chunk_srcs[i].size();
+  }
+  rmm::device_uvector<vertex_t> srcs(num_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(num_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> weights(parse_weight ? num_edges : size_t{0}, handle.get_stream());
+  size_t offset{0};
+  for (size_t i = 0; i < chunk_srcs.size(); ++i) {
+    thrust::copy(handle.get_thrust_policy(),
+                 chunk_srcs[i].begin(),
+                 chunk_srcs[i].end(),
+                 srcs.begin() + offset);
+    thrust::copy(handle.get_thrust_policy(),
+                 chunk_dsts[i].begin(),
+                 chunk_dsts[i].end(),
+                 dsts.begin() + offset);
+    thrust::copy(handle.get_thrust_policy(),
+                 chunk_weights[i].begin(),
+                 chunk_weights[i].end(),
+                 weights.begin() + offset);
+    offset += chunk_srcs[i].size();
+  }
+
+  return std::make_tuple(std::move(srcs), std::move(dsts), std::move(weights));
+}
+
+// [range_first, range_last) of the data section this GPU parses
+template <bool multi_gpu>
+std::tuple<size_t, size_t> get_read_range(raft::handle_t const& handle,
+                                          size_t data_offset,
+                                          size_t file_size)
+{
+  if constexpr (multi_gpu) {
+    auto const comm_size = static_cast<size_t>(handle.get_comms().get_size());
+    auto const comm_rank = static_cast<size_t>(handle.get_comms().get_rank());
+    auto data_size       = file_size - data_offset;
+    auto range_first     = data_offset + (data_size / comm_size) * comm_rank +
+                       std::min(data_size % comm_size, comm_rank);
+    auto range_last = range_first + data_size / comm_size +
+                      (comm_rank < data_size % comm_size ? size_t{1} : size_t{0});
+    return std::make_tuple(range_first, range_last);
+  } else {
+    return std::make_tuple(data_offset, file_size);
+  }
+}
+
+inline size_t get_file_size(std::ifstream& file)
+{
+  file.seekg(0, std::ios::end);
+  auto file_size = static_cast<size_t>(file.tellg());
+  file.seekg(0, std::ios::beg);
+  return file_size;
+}
+
+// the offset of the byte after the line last read with std::getline
+inline size_t get_next_line_offset(std::ifstream& file, size_t file_size)
+{
+  auto offset = file.eof() ? file_size : static_cast<size_t>(file.tellg());
+  file.clear();
+  return offset;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           vertex_t,
+           bool>
+read_matrix_market_edgelist(raft::handle_t const& handle,
+                            std::string const& file_path,
+                            bool read_weights,
+                            size_t chunk_size)
+{
+  std::ifstream file(file_path, std::ios::binary);
+  CUGRAPH_EXPECTS(file.is_open(), "Invalid input argument: failed to open %s.", file_path.c_str());
+  auto file_size = detail::get_file_size(file);
+
+  // 1. parse the header on the host
+
+  std::string line{};
+  std::getline(file, line);
+  std::transform(line.begin(), line.end(), line.begin(), [](unsigned char c) {
+    return static_cast<char>(std::tolower(c));
+  });
+  std::istringstream banner(line);
+  std::string tag{};
+  std::string object{};
+  std::string format{};
+  std::string field{};
+  std::string symmetry{};
+  banner >> tag >> object >> format >> field >> symmetry;
+  CUGRAPH_EXPECTS(
+    (tag == "%%matrixmarket") && (object == "matrix") && (format == "coordinate"),
+    "Invalid input argument: %s is not a Matrix Market file in the coordinate format.",
+    file_path.c_str());
+  CUGRAPH_EXPECTS((field == "pattern") || (field == "integer") || (field == "real"),
+                  "Invalid input argument: unsupported Matrix Market field (%s).",
+                  field.c_str());
+  CUGRAPH_EXPECTS((symmetry == "general") || (symmetry == "symmetric"),
+                  "Invalid input argument: unsupported Matrix Market symmetry (%s).",
+                  symmetry.c_str());
+  auto is_pattern   = field == "pattern";
+  auto is_symmetric = symmetry == "symmetric";
+
+  while (std::getline(file, line)) {
+    if ((line.find_first_not_of(" \t\r") != std::string::npos) && (line[0] != '%')) { break; }
+  }
+  std::istringstream size_line(line);
+  size_t num_rows{0};
+  size_t num_cols{0};
+  size_t nnz{0};
+  CUGRAPH_EXPECTS(static_cast<bool>(size_line >> num_rows >> num_cols >> nnz),
+                  "Invalid input argument: failed to read the size line of %s.",
+                  file_path.c_str());
+  auto num_vertices = std::max(num_rows, num_cols);
+  CUGRAPH_EXPECTS(num_vertices <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+                  "Invalid input argument: the number of vertices overflows vertex_t.");
+  auto data_offset = detail::get_next_line_offset(file, file_size);
+
+  // 2. read & parse (this GPU's part of) the data section on the GPU
+
+  auto [range_first, range_last] =
+    detail::get_read_range<multi_gpu>(handle, data_offset, file_size);
+  auto parse_weight = read_weights && !is_pattern;
+  auto [srcs, dsts, weights] =
+    detail::read_edgelist_range<vertex_t, weight_t>(handle,
+                                                    file,
+                                                    file_size,
+                                                    data_offset,
+                                                    range_first,
+                                                    range_last,
+                                                    chunk_size,
+                                                    ' ',
+                                                    parse_weight,
+                                                    int64_t{1},
+                                                    static_cast<int64_t>(num_vertices));
+
+  auto num_entries = srcs.size();
+  if constexpr (multi_gpu) {
+    num_entries = host_scalar_allreduce(
+      handle.get_comms(), num_entries, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  CUGRAPH_EXPECTS(num_entries == nnz,
+                  "Invalid input argument: the number of entries in %s does not match the size "
+                  "line.",
+                  file_path.c_str());
+
+  if (read_weights && is_pattern) {
+    weights.resize(srcs.size(), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), weights.begin(), weights.end(), weight_t{1.0});
+  }
+
+  // 3. add the symmetric complement of the off-diagonal entries
+
+  if (is_symmetric) {
+    auto num_edges = srcs.size();
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+    auto num_off_diagonals = static_cast<size_t>(thrust::count_if(handle.get_thrust_policy(),
+                                                                  edge_first,
+                                                                  edge_first + num_edges,
+                                                                  detail::is_off_diagonal_t{}));
+    srcs.resize(num_edges + num_off_diagonals, handle.get_stream());
+    dsts.resize(num_edges + num_off_diagonals, handle.get_stream());
+    if (read_weights) {
+      weights.resize(num_edges + num_off_diagonals, handle.get_stream());
+      auto input_first = thrust::make_zip_iterator(
+        thrust::make_tuple(dsts.begin(), srcs.begin(), weights.begin()));
+      thrust::copy_if(handle.get_thrust_policy(),
+                      input_first,
+                      input_first + num_edges,
+                      thrust::make_zip_iterator(thrust::make_tuple(srcs.begin() + num_edges,
+                                                                   dsts.begin() + num_edges,
+                                                                   weights.begin() + num_edges)),
+                      detail::is_off_diagonal_t{});
+    } else {
+      auto input_first =
+        thrust::make_zip_iterator(thrust::make_tuple(dsts.begin(), srcs.begin()));
+      thrust::copy_if(
+        handle.get_thrust_policy(),
+        input_first,
+        input_first + num_edges,
+        thrust::make_zip_iterator(
+          thrust::make_tuple(srcs.begin() + num_edges, dsts.begin() + num_edges)),
+        detail::is_off_diagonal_t{});
+    }
+  }
+
+  return std::make_tuple(
+    std::move(srcs),
+    std::move(dsts),
+    read_weights ? std::make_optional(std::move(weights)) : std::nullopt,
+    static_cast<vertex_t>(num_vertices),
+    is_symmetric);
+}
+
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           vertex_t>
+read_delimited_edgelist(raft::handle_t const& handle,
+                        std::string const& file_path,
+                        bool read_weights,
+                        char delimiter,
+                        size_t num_header_lines,
+                        size_t chunk_size)
+{
+  std::ifstream file(file_path, std::ios::binary);
+  CUGRAPH_EXPECTS(file.is_open(), "Invalid input argument: failed to open %s.", file_path.c_str());
+  auto file_size = detail::get_file_size(file);
+
+  std::string line{};
+  for (size_t i = 0; i < num_header_lines; ++i) {
+    if (!std::getline(file, line)) { break; }
+  }
+  auto data_offset = detail::get_next_line_offset(file, file_size);
+
+  auto [range_first, range_last] =
+    detail::get_read_range<multi_gpu>(handle, data_offset, file_size);
+  auto [srcs, dsts, weights] = detail::read_edgelist_range<vertex_t, weight_t>(
+    handle,
+    file,
+    file_size,
+    data_offset,
+    range_first,
+    range_last,
+    chunk_size,
+    delimiter,
+    read_weights,
+    int64_t{0},
+    static_cast<int64_t>(std::numeric_limits<vertex_t>::max()));
+
+  auto max_vertex = thrust::reduce(handle.get_thrust_policy(),
+                                   srcs.begin(),
+                                   srcs.end(),
+                                   vertex_t{-1},
+                                   thrust::maximum<vertex_t>{});
+  max_vertex      = thrust::reduce(handle.get_thrust_policy(),
+                              dsts.begin(),
+                              dsts.end(),
+                              max_vertex,
+                              thrust::maximum<vertex_t>{});
+  if constexpr (multi_gpu) {
+    max_vertex = host_scalar_allreduce(
+      handle.get_comms(), max_vertex, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(srcs),
+                         std::move(dsts),
+                         read_weights ? std::make_optional(std::move(weights)) : std::nullopt,
+                         static_cast<vertex_t>(max_vertex + 1));
+}
+
+}  // namespace cugraph
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <readers/read_edgelist_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    int32_t,
+                    bool>
+read_matrix_market_edgelist<int32_t, float, false>(raft::handle_t const& handle,
+                                                   std::string const& file_path,
+                                                   bool read_weights,
+                                                   size_t chunk_size);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    int32_t>
+read_delimited_edgelist<int32_t, float, false>(raft::handle_t const& handle,
+                                               std::string const& file_path,
+                                               bool read_weights,
+                                               char delimiter,
+                                               size_t num_header_lines,
+                                               size_t chunk_size);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    int32_t,
+                    bool>
+read_matrix_market_edgelist<int32_t, double, false>(raft::handle_t const& handle,
+                                                    std::string const& file_path,
+                                                    bool read_weights,
+                                                    size_t chunk_size);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    int32_t>
+read_delimited_edgelist<int32_t, double, false>(raft::handle_t const& handle,
+                                                std::string const& file_path,
+                                                bool read_weights,
+                                                char delimiter,
+                                                size_t num_header_lines,
+                                                size_t chunk_size);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    int64_t,
+                    bool>
+read_matrix_market_edgelist<int64_t, float, false>(raft::handle_t const& handle,
+                                                   std::string const& file_path,
+                                                   bool read_weights,
+                                                   size_t chunk_size);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    int64_t>
+read_delimited_edgelist<int64_t, float, false>(raft::handle_t const& handle,
+                                               std::string const& file_path,
+                                               bool read_weights,
+                                               char delimiter,
+                                               size_t num_header_lines,
+                                               size_t chunk_size);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    int64_t,
+                    bool>
+read_matrix_market_edgelist<int64_t, double, false>(raft::handle_t const& handle,
+                                                    std::string const& file_path,
+                                                    bool read_weights,
+                                                    size_t chunk_size);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    int64_t>
+read_delimited_edgelist<int64_t, double, false>(raft::handle_t const& handle,
+                                                std::string const& file_path,
+                                                bool read_weights,
+                                                char delimiter,
+                                                size_t num_header_lines,
+                                                size_t chunk_size);
+#endif
+
+}  // namespace cugraph
@@ -23,6 +23,7 @@ namespace cugraph {
 // template explicit instantiation directives (EIDir's):
 //
 // SG FP32{
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::
   tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>, rmm::device_uvector<int32_t>>
   random_walks(raft::handle_t const& handle,
@@ -32,7 +33,9 @@ template std::
                int32_t max_depth,
                bool use_padding,
                std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::
   tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>, rmm::device_uvector<int64_t>>
   random_walks(raft::handle_t const& handle,
@@ -42,7 +45,9 @@ template std::
                int64_t max_depth,
                bool use_padding,
                std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::
   tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<float>, rmm::device_uvector<int64_t>>
   random_walks(raft::handle_t const& handle,
@@ -52,9 +57,11 @@ template std::
                int64_t max_depth,
                bool use_padding,
                std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
 //}
 //
 // SG FP64{
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::
   tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>, rmm::device_uvector<int32_t>>
   random_walks(raft::handle_t const& handle,
@@ -64,7 +71,9 @@ template std::
                int32_t max_depth,
                bool use_padding,
                std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::
   tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>, rmm::device_uvector<int64_t>>
   random_walks(raft::handle_t const& handle,
@@ -74,7 +83,9 @@ template std::
                int64_t max_depth,
                bool use_padding,
                std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::
   tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<double>, rmm::device_uvector<int64_t>>
   random_walks(raft::handle_t const& handle,
@@ -84,6 +95,261 @@ template std::
                int64_t max_depth,
                bool use_padding,
                std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
+//}
+
+// MG FP32{
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>, rmm::device_uvector<int32_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int32_t, int32_t, float, false, true> const& gview,
+               int32_t const* ptr_d_start,
+               int32_t num_paths,
+               int32_t max_depth,
+               bool use_padding,
+               std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>, rmm::device_uvector<int64_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int32_t, int64_t, float, false, true> const& gview,
+               int32_t const* ptr_d_start,
+               int64_t num_paths,
+               int64_t max_depth,
+               bool use_padding,
+               std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::
+  tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<float>, rmm::device_uvector<int64_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int64_t, int64_t, float, false, true> const& gview,
+               int64_t const* ptr_d_start,
+               int64_t num_paths,
+               int64_t max_depth,
+               bool use_padding,
+               std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
+//}
+
+// MG FP64{
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>, rmm::device_uvector<int32_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int32_t, int32_t, double, false, true> const& gview,
+               int32_t const* ptr_d_start,
+               int32_t num_paths,
+               int32_t max_depth,
+               bool use_padding,
+               std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>, rmm::device_uvector<int64_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int32_t, int64_t, double, false, true> const& gview,
+               int32_t const* ptr_d_start,
+               int64_t num_paths,
+               int64_t max_depth,
+               bool use_padding,
+               std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::
+  tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<double>, rmm::device_uvector<int64_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int64_t, int64_t, double, false, true> const& gview,
+               int64_t const* ptr_d_start,
+               int64_t num_paths,
+               int64_t max_depth,
+               bool use_padding,
+               std::unique_ptr<sampling_params_t> sampling_strategy);
+#endif
+//}
+
+// batched random walks:
+//
+// SG FP32{
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& gview,
+  int32_t const* ptr_d_start,
+  int32_t num_paths,
+  int32_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int32_t max_paths_per_batch,
+  random_walks_batch_op_t<int32_t, float, int32_t> batch_op,
+  bool overlap_output);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& gview,
+  int32_t const* ptr_d_start,
+  int64_t num_paths,
+  int64_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int64_t max_paths_per_batch,
+  random_walks_batch_op_t<int32_t, float, int64_t> batch_op,
+  bool overlap_output);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& gview,
+  int64_t const* ptr_d_start,
+  int64_t num_paths,
+  int64_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int64_t max_paths_per_batch,
+  random_walks_batch_op_t<int64_t, float, int64_t> batch_op,
+  bool overlap_output);
+#endif
+//}
+
+// SG FP64{
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& gview,
+  int32_t const* ptr_d_start,
+  int32_t num_paths,
+  int32_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int32_t max_paths_per_batch,
+  random_walks_batch_op_t<int32_t, double, int32_t> batch_op,
+  bool overlap_output);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& gview,
+  int32_t const* ptr_d_start,
+  int64_t num_paths,
+  int64_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int64_t max_paths_per_batch,
+  random_walks_batch_op_t<int32_t, double, int64_t> batch_op,
+  bool overlap_output);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& gview,
+  int64_t const* ptr_d_start,
+  int64_t num_paths,
+  int64_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int64_t max_paths_per_batch,
+  random_walks_batch_op_t<int64_t, double, int64_t> batch_op,
+  bool overlap_output);
+#endif
+//}
+
+// MG FP32{
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& gview,
+  int32_t const* ptr_d_start,
+  int32_t num_paths,
+  int32_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int32_t max_paths_per_batch,
+  random_walks_batch_op_t<int32_t, float, int32_t> batch_op,
+  bool overlap_output);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& gview,
+  int32_t const* ptr_d_start,
+  int64_t num_paths,
+  int64_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int64_t max_paths_per_batch,
+  random_walks_batch_op_t<int32_t, float, int64_t> batch_op,
+  bool overlap_output);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& gview,
+  int64_t const* ptr_d_start,
+  int64_t num_paths,
+  int64_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int64_t max_paths_per_batch,
+  random_walks_batch_op_t<int64_t, float, int64_t> batch_op,
+  bool overlap_output);
+#endif
+//}
+
+// MG FP64{
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& gview,
+  int32_t const* ptr_d_start,
+  int32_t num_paths,
+  int32_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int32_t max_paths_per_batch,
+  random_walks_batch_op_t<int32_t, double, int32_t> batch_op,
+  bool overlap_output);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& gview,
+  int32_t const* ptr_d_start,
+  int64_t num_paths,
+  int64_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int64_t max_paths_per_batch,
+  random_walks_batch_op_t<int32_t, double, int64_t> batch_op,
+  bool overlap_output);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& gview,
+  int64_t const* ptr_d_start,
+  int64_t num_paths,
+  int64_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  int64_t max_paths_per_batch,
+  random_walks_batch_op_t<int64_t, double, int64_t> batch_op,
+  bool overlap_output);
+#endif
 //}
 
 template std::
@@ -18,21 +18,29 @@
 //
 #pragma once
 
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/decompress_matrix_partition.cuh>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <topology/topology.cuh>
 #include <utilities/graph_utils.cuh>
 
+#include <raft/cudart_utils.h>
 #include <raft/device_atomics.cuh>
 #include <raft/handle.hpp>
 
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/fill.h>
 #include <thrust/find.h>
+#include <thrust/for_each.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -42,18 +50,24 @@
 #include <thrust/optional.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>  // FIXME: requirement for temporary std::getenv()
 #include <ctime>
 #include <limits>
 //
+#include <numeric>
 #include <optional>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "rw_traversals.hpp"
 
@@ -76,6 +90,10 @@ struct rrandom_gen_t {
   using seed_type = seed_t;
   using real_type = real_t;
 
+  // random values must be materialized in device buffers:
+  //
+  static constexpr bool is_counter_based = false;
+
   // cnstr. version that provides step-wise in-place
   // rnd generation:
   //
@@ -150,6 +168,89 @@ struct rrandom_gen_t {
   seed_t seed_;           // seed to be used for current batch
 };
 
+// counter-based random generator: Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy
+// as 1, 2, 3", SC'11), keyed by the seed; the i-th random value of a sequence is a (bijective)
+// function of i, hence it can be evaluated inline, where needed, instead of being read from a
+// pre-generated buffer (see `horizontal_traversal_t`); buffers, where still needed, are filled with
+// the very same values;
+//
+template <typename vertex_t,
+          typename edge_t,
+          typename seed_t  = uint64_t,
+          typename real_t  = float,
+          typename index_t = edge_t>
+struct philox_gen_t : rrandom_gen_t<vertex_t, edge_t, seed_t, real_t, index_t> {
+  using base_t = rrandom_gen_t<vertex_t, edge_t, seed_t, real_t, index_t>;
+
+  static_assert(sizeof(seed_t) <= sizeof(uint64_t), "Philox keys are 64-bit.");
+
+  static constexpr bool is_counter_based = true;
+
+  // cnstr. version that provides step-wise in-place
+  // rnd generation:
+  //
+  philox_gen_t(raft::handle_t const& handle,
+               index_t num_paths,
+               device_vec_t<real_t>& d_random,  // scratch-pad, non-coalesced
+               seed_t seed = seed_t{})
+    : base_t(handle, num_paths, raw_ptr(d_random), seed)
+  {
+    CUGRAPH_EXPECTS(d_random.size() >= static_cast<size_t>(num_paths),
+                    "Un-allocated random buffer.");
+
+    generate_random(handle, raw_ptr(d_random), num_paths, seed);
+  }
+
+  // cnstr. version for the case when the
+  // random vector is provided by the caller:
+  //
+  philox_gen_t(raft::handle_t const& handle,
+               index_t num_paths,
+               real_t* ptr_d_rnd,  // supplied
+               seed_t seed = seed_t{})
+    : base_t(handle, num_paths, ptr_d_rnd, seed)
+  {
+  }
+
+  // `counter`-th random value in [0, 1) of the sequence given by `seed`:
+  //
+  __host__ __device__ static real_t draw(seed_t seed, uint64_t counter)
+  {
+    uint32_t ctr[4] = {static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), 0, 0};
+    uint32_t key[2] = {static_cast<uint32_t>(static_cast<uint64_t>(seed)),
+                       static_cast<uint32_t>(static_cast<uint64_t>(seed) >> 32)};
+
+    for (int round = 0; round < 10; ++round) {
+      uint64_t prod0 = uint64_t{0xD2511F53} * ctr[0];
+      uint64_t prod1 = uint64_t{0xCD9E8D57} * ctr[2];
+
+      ctr[0] = static_cast<uint32_t>(prod1 >> 32) ^ ctr[1] ^ key[0];
+      ctr[1] = static_cast<uint32_t>(prod1);
+      ctr[2] = static_cast<uint32_t>(prod0 >> 32) ^ ctr[3] ^ key[1];
+      ctr[3] = static_cast<uint32_t>(prod0);
+
+      key[0] += uint32_t{0x9E3779B9};
+      key[1] += uint32_t{0xBB67AE85};
+    }
+
+    if constexpr (sizeof(real_t) <= sizeof(float)) {
+      return static_cast<real_t>(static_cast<float>(ctr[0] >> 8) * (1.0f / 16777216.0f));  // 2^-24
+    } else {
+      uint64_t bits = (static_cast<uint64_t>(ctr[0]) << 21) ^ (ctr[1] >> 11);  // 53 bits
+      return static_cast<real_t>(static_cast<double>(bits) * (1.0 / 9007199254740992.0));  // 2^-53
+    }
+  }
+
+  // abstracts away the random values generation:
+  //
+  static void generate_random(raft::handle_t const& handle, real_t* p_d_rnd, size_t sz, seed_t seed)
+  {
+    thrust::tabulate(handle.get_thrust_policy(), p_d_rnd, p_d_rnd + sz, [seed] __device__(auto i) {
+      return draw(seed, static_cast<uint64_t>(i));
+    });
+  }
+};
+
 // seeding policy: time (clock) dependent,
 // to avoid RW calls repeating same random data:
 //
@@ -322,6 +423,193 @@ struct col_indx_extract_t<graph_t, index_t, std::enable_if_t<graph_t::is_multi_g
   index_t max_depth_;
 };
 
+// specialization for multi-gpu functionality:
+// operates on the walkers currently residing on this GPU (i.e., on the walkers whose current
+// vertex is owned by this GPU), rather than on coalesced paths; the next vertex is extracted from
+// the local out-adjacency of the vertex partition owned by this GPU (the selector's sampler);
+//
+template <typename graph_t, typename index_t>
+struct col_indx_extract_t<graph_t, index_t, std::enable_if_t<graph_t::is_multi_gpu == true>> {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  col_indx_extract_t(raft::handle_t const& handle, graph_t const& graph, index_t num_walkers)
+    : handle_(handle),
+      local_vertex_first_(graph.get_local_vertex_first()),
+      num_walkers_(num_walkers)
+  {
+  }
+
+  // in-place extractor of next set of vertices and weights,
+  // (d_v_next_vertices, d_v_next_weights), given the current vertex of each walker:
+  //
+  // for each indx in [0, num_walkers){
+  //   if( out_degs(d_v_walker_vertices[indx]) > 0 ) {
+  //     (d_v_next_vertices[indx], d_v_next_weights[indx]) =
+  //       sampler(d_v_walker_vertices[indx] - local_vertex_first, ptr_d_random[indx]);
+  //   } else {
+  //     d_v_next_vertices[indx] = invalid_vertex_id;
+  //   }
+  // }
+  //
+  // this is the first order (uniform, biased) selection; for node2vec it is the proposal step of
+  // the rejection sampling;
+  //
+  template <typename selector_t, typename real_t>
+  void operator()(selector_t const& selector,
+                  real_t const* ptr_d_random,          // in: random values, one per walker
+                  device_vec_t<vertex_t> const& d_v_walker_vertices,  // in: current vertices
+                  device_vec_t<vertex_t>& d_v_next_vertices,          // out: next vertices
+                  device_vec_t<weight_t>& d_v_next_weights) const     // out: next weights
+  {
+    thrust::transform(
+      handle_.get_thrust_policy(),
+      d_v_walker_vertices.begin(),
+      d_v_walker_vertices.begin() + num_walkers_,
+      ptr_d_random,
+      thrust::make_zip_iterator(
+        thrust::make_tuple(d_v_next_vertices.begin(), d_v_next_weights.begin())),
+      [local_vertex_first = local_vertex_first_,
+       sampler            = selector.get_strategy()] __device__(auto src_v, auto rnd_val) {
+        auto src_offset    = src_v - local_vertex_first;
+        auto opt_tpl_vn_wn = sampler(src_offset, rnd_val, src_offset, edge_t{0}, true);
+        return opt_tpl_vn_wn.has_value()
+                 ? *opt_tpl_vn_wn
+                 : thrust::make_tuple(invalid_vertex_id<vertex_t>::value, weight_t{0});
+      });
+  }
+
+ private:
+  raft::handle_t const& handle_;
+  vertex_t local_vertex_first_;
+  index_t num_walkers_;
+};
+
+// maps a vertex ID to the rank of the GPU owning its vertex partition (multi-GPU only):
+//
+template <typename vertex_t>
+struct vertex_partition_owner_t {
+  vertex_t const* vertex_partition_lasts{nullptr};
+  int comm_size{0};
+
+  __device__ int operator()(vertex_t v) const
+  {
+    return static_cast<int>(thrust::distance(
+      vertex_partition_lasts,
+      thrust::upper_bound(
+        thrust::seq, vertex_partition_lasts, vertex_partition_lasts + comm_size, v)));
+  }
+};
+
+// gathers the out-edges of the vertex partition owned by this GPU (out of the 2D partitioned
+// adjacency matrix, where these are spread across the GPUs of the same GPU column) into a local
+// CSR; this duplicates the edges once, but it keeps the per step sampling communication free;
+//
+template <typename graph_t>
+std::enable_if_t<graph_t::is_multi_gpu == true,
+                 local_adjacency_t<typename graph_t::vertex_type,
+                                   typename graph_t::edge_type,
+                                   typename graph_t::weight_type>>
+build_local_adjacency(raft::handle_t const& handle, graph_t const& graph)
+{
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  static_assert(!graph_t::is_adj_matrix_transposed,
+                "Random walks require the out-edges (store_transposed == false).");
+
+  auto& comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+
+  std::vector<size_t> edgelist_edge_counts(graph.get_number_of_local_adj_matrix_partitions(),
+                                           size_t{0});
+  for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
+    edgelist_edge_counts[i] =
+      static_cast<size_t>(graph.get_number_of_local_adj_matrix_partition_edges(i));
+  }
+  auto number_of_local_edges =
+    std::reduce(edgelist_edge_counts.begin(), edgelist_edge_counts.end());
+
+  device_vec_t<vertex_t> d_majors(number_of_local_edges, handle.get_stream());
+  device_vec_t<vertex_t> d_minors(d_majors.size(), handle.get_stream());
+  auto d_weights =
+    graph.is_weighted()
+      ? std::make_optional<device_vec_t<weight_t>>(d_majors.size(), handle.get_stream())
+      : std::nullopt;
+
+  size_t cur_size{0};
+  for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
+    decompress_matrix_partition_to_edgelist(
+      handle,
+      matrix_partition_device_view_t<vertex_t, edge_t, weight_t, true>(
+        graph.get_matrix_partition_view(i)),
+      d_majors.data() + cur_size,
+      d_minors.data() + cur_size,
+      d_weights ? std::optional<weight_t*>{(*d_weights).data() + cur_size} : std::nullopt,
+      graph.get_local_adj_matrix_partition_segment_offsets(i));
+    cur_size += edgelist_edge_counts[i];
+  }
+
+  auto h_vertex_partition_lasts = graph.get_vertex_partition_lasts();
+  device_vec_t<vertex_t> d_vertex_partition_lasts(h_vertex_partition_lasts.size(),
+                                                  handle.get_stream());
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      h_vertex_partition_lasts.data(),
+                      h_vertex_partition_lasts.size(),
+                      handle.get_stream());
+  vertex_partition_owner_t<vertex_t> owner_op{d_vertex_partition_lasts.data(), comm_size};
+
+  // shuffle the edges to the owner of their source (major) vertex, then sort them (the node2vec
+  // sampler binary-searches the neighbor lists):
+  //
+  device_vec_t<vertex_t> d_rx_majors(0, handle.get_stream());
+  device_vec_t<vertex_t> d_rx_minors(0, handle.get_stream());
+  std::optional<device_vec_t<weight_t>> d_rx_weights{std::nullopt};
+  if (d_weights) {
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(d_majors.begin(), d_minors.begin(), (*d_weights).begin()));
+    std::forward_as_tuple(std::tie(d_rx_majors, d_rx_minors, d_rx_weights), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        edge_first,
+        edge_first + d_majors.size(),
+        [owner_op] __device__(auto val) { return owner_op(thrust::get<0>(val)); },
+        handle.get_stream());
+
+    auto rx_edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(d_rx_majors.begin(), d_rx_minors.begin(), (*d_rx_weights).begin()));
+    thrust::sort(handle.get_thrust_policy(), rx_edge_first, rx_edge_first + d_rx_majors.size());
+  } else {
+    auto edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(d_majors.begin(), d_minors.begin()));
+    std::forward_as_tuple(std::tie(d_rx_majors, d_rx_minors), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        edge_first,
+        edge_first + d_majors.size(),
+        [owner_op] __device__(auto val) { return owner_op(thrust::get<0>(val)); },
+        handle.get_stream());
+
+    auto rx_edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(d_rx_majors.begin(), d_rx_minors.begin()));
+    thrust::sort(handle.get_thrust_policy(), rx_edge_first, rx_edge_first + d_rx_majors.size());
+  }
+
+  auto local_vertex_first = graph.get_local_vertex_first();
+  device_vec_t<edge_t> d_offsets(graph.get_number_of_local_vertices() + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      d_rx_majors.begin(),
+                      d_rx_majors.end(),
+                      thrust::make_counting_iterator(local_vertex_first),
+                      thrust::make_counting_iterator(local_vertex_first) + d_offsets.size(),
+                      d_offsets.begin());
+
+  return local_adjacency_t<vertex_t, edge_t, weight_t>(
+    local_vertex_first, std::move(d_offsets), std::move(d_rx_minors), std::move(d_rx_weights));
+}
+
 /**
  * @brief Class abstracting the RW initialization, stepping, and stopping functionality
  *        The outline of the algorithm is as follows:
@@ -700,8 +988,9 @@ struct random_walker_t {
  * length. Single-GPU specialization.
  *
  * @tparam graph_t Type of graph (view).
- * @tparam traversal_t Traversal policy. Either horizontal (faster but requires more memory) or
- * vertical. Defaults to horizontal.
+ * @tparam traversal_t Traversal policy. Either horizontal (faster but requires more memory),
+ * vertical, or persistent (horizontal memory footprint, a single load-balanced kernel; suited for
+ * long walks). Defaults to horizontal.
  * @tparam random_engine_t Type of random engine used to generate RW.
  * @tparam seeding_policy_t Random engine seeding policy: variable or fixed (for reproducibility).
  * Defaults to variable, clock dependent.
@@ -765,6 +1054,13 @@ random_walks_impl(raft::handle_t const& handle,
 
   CUGRAPH_EXPECTS(static_cast<index_t>(how_many_valid) == d_v_start.size(),
                   "Invalid set of starting vertices.");
+  // the samplers index the offsets by vertex ID and read the (unpacked) indices
+  CUGRAPH_EXPECTS(!graph.get_matrix_partition_view().get_dcs_nzd_vertices(),
+                  "Invalid input argument: random walks on graphs in the hypersparse format are "
+                  "not supported yet.");
+  CUGRAPH_EXPECTS(!graph.get_matrix_partition_view().get_packed_minors(),
+                  "Invalid input argument: random walks on graphs with bit-packed minors are not "
+                  "supported yet.");
 
   auto num_paths = d_v_start.size();
   auto stream    = handle.get_stream();
@@ -792,7 +1088,7 @@ random_walks_impl(raft::handle_t const& handle,
 
   // random data handling:
   //
-  auto rnd_data_sz = traversor.get_random_buff_sz();
+  auto rnd_data_sz = traversor.get_random_buff_sz(random_engine_t::is_counter_based);
   device_vec_t<real_t> d_random(rnd_data_sz, stream);
   // abstracted out seed initialization:
   //
@@ -842,13 +1138,209 @@ random_walks_impl(raft::handle_t const& handle,
   }
 }
 
+// node2vec step for the multi-GPU walks:
+// the transition probability from `src_v` to `next_v` depends on whether `next_v` is a neighbor of
+// `prev_v`, but adj(prev_v) is only available on the GPU that owns `prev_v`; hence, the next vertex
+// is drawn by rejection sampling: a candidate is proposed by biased selection on the (unscaled)
+// weights of adj(src_v) and accepted with probability alpha(prev_v, next_v) / max(alpha), where
+// the `next_v` in adj(prev_v) queries are answered by the owners of `prev_v` (and skipped under
+// the lower bound of alpha); rejected walkers retry until none is left; as in the single-GPU case,
+// the 1st step in each path is not scaled;
+//
+template <typename graph_t, typename selector_t, typename random_engine_t, typename index_t>
+void node2vec_mg_step(raft::handle_t const& handle,
+                      graph_t const& graph,
+                      selector_t const& selector,
+                      vertex_partition_owner_t<typename graph_t::vertex_type> owner_op,
+                      typename random_engine_t::seed_type seed,
+                      device_vec_t<typename graph_t::vertex_type> const& d_walker_vertices,
+                      device_vec_t<typename graph_t::vertex_type> const& d_walker_prev_vertices,
+                      device_vec_t<index_t> const& d_walker_positions,
+                      device_vec_t<typename graph_t::vertex_type>& d_next_vertices,
+                      device_vec_t<typename graph_t::weight_type>& d_next_weights)
+{
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+  using seed_t   = typename random_engine_t::seed_type;
+  using real_t   = typename random_engine_t::real_type;
+
+  static_assert(sizeof(seed_t) >= sizeof(uint64_t),
+                "Rejection rounds are seeded through the upper 32 bits of the seed.");
+
+  auto& comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+  auto stream          = handle.get_stream();
+
+  auto local_vertex_first = graph.get_local_vertex_first();
+  auto sampler            = selector.get_strategy();
+
+  weight_t inv_p     = weight_t{1} / sampler.get_p();
+  weight_t inv_q     = weight_t{1} / sampler.get_q();
+  weight_t min_alpha = sampler.get_min_alpha();
+  weight_t max_alpha = sampler.get_max_alpha();
+
+  // walkers (indices) not yet assigned a next vertex:
+  //
+  device_vec_t<index_t> d_pending(d_walker_vertices.size(), stream);
+  thrust::sequence(handle.get_thrust_policy(), d_pending.begin(), d_pending.end(), index_t{0});
+
+  for (seed_t round = 0;; ++round) {
+    auto num_pending = d_pending.size();
+    if (host_scalar_allreduce(comm, num_pending, raft::comms::op_t::SUM, stream) == 0) break;
+
+    // 2 random values per pending walker: [proposal, acceptance]:
+    //
+    device_vec_t<real_t> d_random(2 * num_pending, stream);
+    random_engine_t::generate_random(
+      handle, raw_ptr(d_random), d_random.size(), seed + (round << 32));
+
+    // status: 0 == done (accepted or sink), 1 == rejected (retry), 2 == pending on a query;
+    //
+    device_vec_t<uint8_t> d_status(num_pending, stream);
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator<index_t>(0),
+      thrust::make_counting_iterator<index_t>(num_pending),
+      d_status.begin(),
+      [ptr_d_pending   = raw_const_ptr(d_pending),
+       ptr_d_random    = raw_const_ptr(d_random),
+       ptr_walker_v    = raw_const_ptr(d_walker_vertices),
+       ptr_walker_prev = raw_const_ptr(d_walker_prev_vertices),
+       ptr_positions   = raw_const_ptr(d_walker_positions),
+       ptr_next_v      = raw_ptr(d_next_vertices),
+       ptr_next_w      = raw_ptr(d_next_weights),
+       local_vertex_first,
+       sampler,
+       inv_p,
+       min_alpha,
+       max_alpha] __device__(index_t k) {
+        auto walker        = ptr_d_pending[k];
+        auto src_offset    = ptr_walker_v[walker] - local_vertex_first;
+        auto opt_tpl_vn_wn = sampler(src_offset, ptr_d_random[2 * k], src_offset, edge_t{0}, true);
+        if (!opt_tpl_vn_wn.has_value()) {  // sink
+          ptr_next_v[walker] = invalid_vertex_id<vertex_t>::value;
+          return uint8_t{0};
+        }
+
+        auto next_v        = thrust::get<0>(*opt_tpl_vn_wn);
+        ptr_next_v[walker] = next_v;
+        ptr_next_w[walker] = thrust::get<1>(*opt_tpl_vn_wn);
+
+        if (ptr_positions[walker] == 0) return uint8_t{0};  // 1st step in path
+        auto rnd_accept = ptr_d_random[2 * k + 1] * max_alpha;
+        if (rnd_accept < min_alpha) return uint8_t{0};  // accepted, whatever alpha is
+        if (next_v == ptr_walker_prev[walker]) {
+          return rnd_accept < inv_p ? uint8_t{0} : uint8_t{1};
+        }
+        return uint8_t{2};
+      });
+
+    // is the candidate a neighbor of the previous vertex?
+    // (queries grouped by the owner of the previous vertex):
+    //
+    auto num_queries =
+      thrust::count(handle.get_thrust_policy(), d_status.begin(), d_status.end(), uint8_t{2});
+
+    device_vec_t<vertex_t> d_query_prev(num_queries, stream);
+    device_vec_t<vertex_t> d_query_next(num_queries, stream);
+    device_vec_t<index_t> d_query_indices(num_queries, stream);
+    thrust::copy_if(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator<index_t>(0),
+                    thrust::make_counting_iterator<index_t>(num_pending),
+                    d_status.begin(),
+                    d_query_indices.begin(),
+                    [] __device__(auto status) { return status == uint8_t{2}; });
+    thrust::transform(
+      handle.get_thrust_policy(),
+      d_query_indices.begin(),
+      d_query_indices.end(),
+      thrust::make_zip_iterator(thrust::make_tuple(d_query_prev.begin(), d_query_next.begin())),
+      [ptr_d_pending   = raw_const_ptr(d_pending),
+       ptr_walker_prev = raw_const_ptr(d_walker_prev_vertices),
+       ptr_next_v      = raw_const_ptr(d_next_vertices)] __device__(auto k) {
+        auto walker = ptr_d_pending[k];
+        return thrust::make_tuple(ptr_walker_prev[walker], ptr_next_v[walker]);
+      });
+
+    auto query_first = thrust::make_zip_iterator(
+      thrust::make_tuple(d_query_prev.begin(), d_query_next.begin(), d_query_indices.begin()));
+    auto d_tx_counts = groupby_and_count(
+      query_first,
+      query_first + num_queries,
+      [owner_op] __device__(auto val) { return owner_op(thrust::get<0>(val)); },
+      comm_size,
+      stream);
+
+    std::vector<size_t> h_tx_counts(d_tx_counts.size());
+    raft::update_host(h_tx_counts.data(), d_tx_counts.data(), d_tx_counts.size(), stream);
+    handle.get_stream_view().synchronize();
+
+    auto [rx_queries, rx_counts] = shuffle_values(
+      comm,
+      thrust::make_zip_iterator(thrust::make_tuple(d_query_prev.begin(), d_query_next.begin())),
+      h_tx_counts,
+      stream);
+
+    device_vec_t<uint8_t> d_rx_answers(std::get<0>(rx_queries).size(), stream);
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(std::get<0>(rx_queries).begin(), std::get<1>(rx_queries).begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(std::get<0>(rx_queries).end(), std::get<1>(rx_queries).end())),
+      d_rx_answers.begin(),
+      [local_vertex_first, sampler] __device__(auto query) {
+        return static_cast<uint8_t>(
+          sampler.is_neighbor(thrust::get<0>(query) - local_vertex_first, thrust::get<1>(query)));
+      });
+
+    // answers come back in the (grouped) order the queries were sent in:
+    //
+    device_vec_t<uint8_t> d_answers(0, stream);
+    std::tie(d_answers, std::ignore) =
+      shuffle_values(comm, d_rx_answers.begin(), rx_counts, stream);
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator<size_t>(0),
+                     thrust::make_counting_iterator<size_t>(num_queries),
+                     [ptr_query_indices = raw_const_ptr(d_query_indices),
+                      ptr_answers       = raw_const_ptr(d_answers),
+                      ptr_d_random      = raw_const_ptr(d_random),
+                      ptr_status        = raw_ptr(d_status),
+                      inv_q,
+                      max_alpha] __device__(auto j) {
+                       auto k         = ptr_query_indices[j];
+                       weight_t alpha = ptr_answers[j] ? weight_t{1} : inv_q;
+                       ptr_status[k] =
+                         ptr_d_random[2 * k + 1] * max_alpha < alpha ? uint8_t{0} : uint8_t{1};
+                     });
+
+    // retry the rejected walkers:
+    //
+    auto pending_last =
+      thrust::remove_if(handle.get_thrust_policy(),
+                        d_pending.begin(),
+                        d_pending.end(),
+                        d_status.begin(),
+                        [] __device__(auto status) { return status != uint8_t{1}; });
+    d_pending.resize(thrust::distance(d_pending.begin(), pending_last), stream);
+  }
+}
+
 /**
  * @brief returns random walks (RW) from starting sources, where each path is of given maximum
  * length. Multi-GPU specialization.
  *
+ * Each GPU provides its own set of starting vertices (which can be any of the graph's vertices)
+ * and receives the paths starting from them. The walkers advance in sync, one step at a time: at
+ * each step they are shuffled to the GPU owning their current vertex, which samples the next
+ * vertex from its local out-adjacency (see `build_local_adjacency()`); the steps taken are sent
+ * back to the starting GPU once all the walkers are done.
+ *
  * @tparam graph_t Type of graph (view).
- * @tparam traversal_t Traversal policy. Either horizontal (faster but requires more memory) or
- * vertical. Defaults to horizontal.
+ * @tparam traversal_t Traversal policy. Ignored: multi-GPU walkers always advance step by step (as
+ * for the vertical traversal).
  * @tparam random_engine_t Type of random engine used to generate RW.
  * @tparam seeding_policy_t Random engine seeding policy: variable or fixed (for reproducibility).
  * Defaults to variable, clock dependent.
@@ -856,9 +1348,10 @@ random_walks_impl(raft::handle_t const& handle,
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph Graph object to generate RW on.
- * @param d_v_start Device (view) set of starting vertex indices for the RW. number(RW) ==
- * d_v_start.size().
+ * @param d_v_start Device (view) set of this GPU's starting vertex indices for the RW. number(RW)
+ * == d_v_start.size().
  * @param max_depth maximum length of RWs.
+ * @param selector Sampling strategy, constructed from this GPU's local out-adjacency.
  * @param use_padding (optional) specifies if return uses padded format (true), or coalesced
  * (compressed) format; when padding is used the output is a matrix of vertex paths and a matrix of
  * edges paths (weights); in this case the matrices are stored in row major order; the vertex path
@@ -866,14 +1359,8 @@ random_walks_impl(raft::handle_t const& handle,
  * @param seeder (optional) is object providing the random seeding mechanism. Defaults to local
  * clock time as initial seed.
  * @return std::tuple<device_vec_t<vertex_t>, device_vec_t<weight_t>,
- * device_vec_t<index_t>> Triplet of either padded or coalesced RW paths; in the coalesced case
- * (default), the return consists of corresponding vertex and edge weights for each, and
- * corresponding path sizes. This is meant to minimize the number of DF's to be passed to the Python
- * layer. The meaning of "coalesced" here is that a 2D array of paths of different sizes is
- * represented as a 1D contiguous array. In the padded case the return is a matrix of num_paths x
- * max_depth vertex paths; and num_paths x (max_depth-1) edge (weight) paths, with an empty array of
- * sizes. Note: if the graph is un-weighted the edge (weight) paths consists of `weight_t{1}`
- * entries;
+ * device_vec_t<index_t>> Triplet of either padded or coalesced RW paths, as in the single-GPU case,
+ * for the paths starting from this GPU's starting vertices.
  */
 template <typename graph_t,
           typename selector_t,
@@ -895,7 +1382,271 @@ random_walks_impl(raft::handle_t const& handle,
                   bool use_padding        = false,
                   seeding_policy_t seeder = clock_seeding_t<typename random_engine_t::seed_type>{})
 {
-  CUGRAPH_FAIL("Not implemented yet.");
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+  using seed_t   = typename random_engine_t::seed_type;
+  using real_t   = typename random_engine_t::real_type;
+
+  auto& comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+  auto const comm_rank = comm.get_rank();
+
+  vertex_t num_vertices = graph.get_number_of_vertices();
+  auto num_paths        = d_v_start.size();
+  auto stream           = handle.get_stream();
+
+  auto how_many_valid = thrust::count_if(handle.get_thrust_policy(),
+                                         d_v_start.begin(),
+                                         d_v_start.end(),
+                                         [num_vertices] __device__(auto crt_vertex) {
+                                           return (crt_vertex >= 0) && (crt_vertex < num_vertices);
+                                         });
+
+  // all the GPUs must agree (to not leave the others hanging in the collectives below):
+  //
+  auto how_many_invalid = host_scalar_allreduce(
+    comm, static_cast<size_t>(num_paths - how_many_valid), raft::comms::op_t::SUM, stream);
+  CUGRAPH_EXPECTS(how_many_invalid == 0, "Invalid set of starting vertices.");
+
+  random_walker_t<graph_t, random_engine_t> rand_walker{
+    handle, num_vertices, static_cast<index_t>(num_paths), static_cast<index_t>(max_depth)};
+
+  // pre-allocate num_paths * max_depth;
+  //
+  auto coalesced_sz = num_paths * max_depth;
+  device_vec_t<vertex_t> d_coalesced_v(coalesced_sz, stream);  // coalesced vertex set
+  device_vec_t<weight_t> d_coalesced_w(coalesced_sz, stream);  // coalesced weight set
+  device_vec_t<index_t> d_paths_sz(num_paths, stream);         // paths sizes
+
+  // abstracted out seed initialization:
+  //
+  seed_t seed0 = static_cast<seed_t>(seeder());
+
+  // if padding used, initialize padding values:
+  //
+  if (use_padding) rand_walker.init_padding(d_coalesced_v, d_coalesced_w);
+
+  // very first vertex, for each path:
+  //
+  rand_walker.start(d_v_start, d_coalesced_v, d_paths_sz);
+
+  // walkers: (current vertex, previous vertex, origin rank, path index, position in path);
+  //
+  device_vec_t<vertex_t> d_walker_v(num_paths, stream);
+  device_vec_t<vertex_t> d_walker_prev(num_paths, stream);
+  device_vec_t<int> d_walker_origins(num_paths, stream);
+  device_vec_t<index_t> d_walker_path_indices(num_paths, stream);
+  device_vec_t<index_t> d_walker_positions(num_paths, stream);
+
+  thrust::copy(handle.get_thrust_policy(), d_v_start.begin(), d_v_start.end(), d_walker_v.begin());
+  thrust::copy(
+    handle.get_thrust_policy(), d_v_start.begin(), d_v_start.end(), d_walker_prev.begin());
+  thrust::fill(
+    handle.get_thrust_policy(), d_walker_origins.begin(), d_walker_origins.end(), comm_rank);
+  thrust::sequence(handle.get_thrust_policy(),
+                   d_walker_path_indices.begin(),
+                   d_walker_path_indices.end(),
+                   index_t{0});
+  thrust::fill(
+    handle.get_thrust_policy(), d_walker_positions.begin(), d_walker_positions.end(), index_t{0});
+
+  // steps taken: (origin rank, path index, position in path, vertex, weight);
+  // recorded on the GPU taking them, sent back to the origin once all the walkers are done;
+  //
+  device_vec_t<int> d_step_origins(0, stream);
+  device_vec_t<index_t> d_step_path_indices(0, stream);
+  device_vec_t<index_t> d_step_positions(0, stream);
+  device_vec_t<vertex_t> d_step_v(0, stream);
+  device_vec_t<weight_t> d_step_w(0, stream);
+
+  auto h_vertex_partition_lasts = graph.get_vertex_partition_lasts();
+  device_vec_t<vertex_t> d_vertex_partition_lasts(h_vertex_partition_lasts.size(), stream);
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      h_vertex_partition_lasts.data(),
+                      h_vertex_partition_lasts.size(),
+                      stream);
+  vertex_partition_owner_t<vertex_t> owner_op{d_vertex_partition_lasts.data(), comm_size};
+
+  // start from 1, as 0-th was initialized above:
+  //
+  for (index_t step_indx = 1; step_indx < max_depth; ++step_indx) {
+    // early exit: all paths have reached sinks:
+    //
+    if (host_scalar_allreduce(comm, d_walker_v.size(), raft::comms::op_t::SUM, stream) == 0) {
+      break;
+    }
+
+    // move the walkers to the owner of their current vertex:
+    //
+    auto walker_first = thrust::make_zip_iterator(thrust::make_tuple(d_walker_v.begin(),
+                                                                     d_walker_prev.begin(),
+                                                                     d_walker_origins.begin(),
+                                                                     d_walker_path_indices.begin(),
+                                                                     d_walker_positions.begin()));
+    std::forward_as_tuple(std::tie(d_walker_v,
+                                   d_walker_prev,
+                                   d_walker_origins,
+                                   d_walker_path_indices,
+                                   d_walker_positions),
+                          std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        walker_first,
+        walker_first + d_walker_v.size(),
+        [owner_op] __device__(auto val) { return owner_op(thrust::get<0>(val)); },
+        stream);
+
+    auto num_walkers = d_walker_v.size();
+
+    // distinct seeds for each step and each GPU:
+    //
+    seed_t step_seed = seed0 + static_cast<seed_t>(step_indx) * static_cast<seed_t>(comm_size) +
+                       static_cast<seed_t>(comm_rank);
+
+    device_vec_t<vertex_t> d_next_v(num_walkers, stream);
+    device_vec_t<weight_t> d_next_w(num_walkers, stream);
+    if constexpr (is_second_order_selector_t<selector_t>::value) {
+      node2vec_mg_step<graph_t, selector_t, random_engine_t, index_t>(handle,
+                                                                      graph,
+                                                                      selector,
+                                                                      owner_op,
+                                                                      step_seed,
+                                                                      d_walker_v,
+                                                                      d_walker_prev,
+                                                                      d_walker_positions,
+                                                                      d_next_v,
+                                                                      d_next_w);
+    } else {
+      device_vec_t<real_t> d_random(num_walkers, stream);
+      random_engine_t::generate_random(handle, raw_ptr(d_random), d_random.size(), step_seed);
+
+      col_indx_extract_t<graph_t, index_t> col_extractor(
+        handle, graph, static_cast<index_t>(num_walkers));
+      col_extractor(selector, raw_const_ptr(d_random), d_walker_v, d_next_v, d_next_w);
+    }
+
+    // the walkers whose current vertex is a sink stop here:
+    //
+    auto walker_next_first =
+      thrust::make_zip_iterator(thrust::make_tuple(d_walker_v.begin(),
+                                                   d_walker_prev.begin(),
+                                                   d_walker_origins.begin(),
+                                                   d_walker_path_indices.begin(),
+                                                   d_walker_positions.begin(),
+                                                   d_next_v.begin(),
+                                                   d_next_w.begin()));
+    auto walker_next_last =
+      thrust::remove_if(handle.get_thrust_policy(),
+                        walker_next_first,
+                        walker_next_first + num_walkers,
+                        [] __device__(auto val) {
+                          return thrust::get<5>(val) == invalid_vertex_id<vertex_t>::value;
+                        });
+    num_walkers = thrust::distance(walker_next_first, walker_next_last);
+    d_walker_v.resize(num_walkers, stream);
+    d_walker_prev.resize(num_walkers, stream);
+    d_walker_origins.resize(num_walkers, stream);
+    d_walker_path_indices.resize(num_walkers, stream);
+    d_walker_positions.resize(num_walkers, stream);
+    d_next_v.resize(num_walkers, stream);
+    d_next_w.resize(num_walkers, stream);
+
+    // advance the remaining walkers:
+    //
+    d_walker_prev = std::move(d_walker_v);
+    d_walker_v    = std::move(d_next_v);
+    thrust::transform(handle.get_thrust_policy(),
+                      d_walker_positions.begin(),
+                      d_walker_positions.end(),
+                      d_walker_positions.begin(),
+                      [] __device__(auto pos) { return pos + 1; });
+
+    // record the steps just taken:
+    //
+    auto num_steps = d_step_v.size();
+    d_step_origins.resize(num_steps + num_walkers, stream);
+    d_step_path_indices.resize(d_step_origins.size(), stream);
+    d_step_positions.resize(d_step_origins.size(), stream);
+    d_step_v.resize(d_step_origins.size(), stream);
+    d_step_w.resize(d_step_origins.size(), stream);
+
+    auto new_step_first =
+      thrust::make_zip_iterator(thrust::make_tuple(d_walker_origins.begin(),
+                                                   d_walker_path_indices.begin(),
+                                                   d_walker_positions.begin(),
+                                                   d_walker_v.begin(),
+                                                   d_next_w.begin()));
+    thrust::copy(handle.get_thrust_policy(),
+                 new_step_first,
+                 new_step_first + num_walkers,
+                 thrust::make_zip_iterator(thrust::make_tuple(d_step_origins.begin(),
+                                                              d_step_path_indices.begin(),
+                                                              d_step_positions.begin(),
+                                                              d_step_v.begin(),
+                                                              d_step_w.begin())) +
+                   num_steps);
+  }
+
+  // send the steps back to the GPU that started the path:
+  //
+  auto step_first = thrust::make_zip_iterator(thrust::make_tuple(d_step_origins.begin(),
+                                                                 d_step_path_indices.begin(),
+                                                                 d_step_positions.begin(),
+                                                                 d_step_v.begin(),
+                                                                 d_step_w.begin()));
+  std::forward_as_tuple(
+    std::tie(d_step_origins, d_step_path_indices, d_step_positions, d_step_v, d_step_w),
+    std::ignore) =
+    groupby_gpuid_and_shuffle_values(
+      comm,
+      step_first,
+      step_first + d_step_v.size(),
+      [] __device__(auto val) { return thrust::get<0>(val); },
+      stream);
+
+  // scatter the steps to their corresponding coalesced (or padded) location and update the path
+  // sizes:
+  //
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator<size_t>(0),
+                   thrust::make_counting_iterator<size_t>(d_step_v.size()),
+                   [max_depth,
+                    ptr_path_indices = raw_const_ptr(d_step_path_indices),
+                    ptr_positions    = raw_const_ptr(d_step_positions),
+                    ptr_step_v       = raw_const_ptr(d_step_v),
+                    ptr_step_w       = raw_const_ptr(d_step_w),
+                    ptr_coalesced_v  = raw_ptr(d_coalesced_v),
+                    ptr_coalesced_w  = raw_ptr(d_coalesced_w),
+                    ptr_d_sizes      = raw_ptr(d_paths_sz)] __device__(auto i) {
+                     auto path_indx = ptr_path_indices[i];
+                     auto pos       = ptr_positions[i];
+
+                     ptr_coalesced_v[path_indx * max_depth + pos]           = ptr_step_v[i];
+                     ptr_coalesced_w[path_indx * (max_depth - 1) + pos - 1] = ptr_step_w[i];
+                     atomicAdd(ptr_d_sizes + path_indx, index_t{1});
+                   });
+
+  // wrap-up, post-process:
+  // truncate v_set, w_set to actual space used
+  // unless padding is used
+  //
+  if (!use_padding) { rand_walker.stop(d_coalesced_v, d_coalesced_w, d_paths_sz); }
+
+  // because device_uvector is not copy-cnstr-able:
+  //
+  if (!use_padding) {
+    return std::make_tuple(std::move(d_coalesced_v),
+                           std::move(d_coalesced_w),
+                           std::move(d_paths_sz),
+                           seed0);  // also return seed for repro
+  } else {
+    return std::make_tuple(
+      std::move(d_coalesced_v),
+      std::move(d_coalesced_w),
+      device_vec_t<index_t>(0, stream),  // purposely empty size array for the padded case, to avoid
+                                         // unnecessary allocations
+      seed0);                            // also return seed for repro
+  }
 }
 
 // provides conversion to (coalesced) path to COO format:
@@ -1045,6 +1796,189 @@ struct coo_convertor_t {
   index_t num_paths_;
 };
 
+// selects the (slower) vertical traversal strategy, if the memory requirements of the horizontal
+// one exceed the available GPU memory (single-GPU only); (the horizontal strategy needs no random
+// buffer if the random engine is counter-based):
+//
+template <typename graph_t, typename real_t, typename index_t>
+bool use_vertical_traversal(index_t num_paths, index_t max_depth, bool counter_based_rng)
+{
+  if constexpr (graph_t::is_multi_gpu) {
+    return false;  // multi-GPU walkers always advance step by step
+  } else {
+    using vertex_t = typename graph_t::vertex_type;
+    using edge_t   = typename graph_t::edge_type;
+    using weight_t = typename graph_t::weight_type;
+
+    // GPU memory availability:
+    //
+    size_t free_mem_sp_bytes{0};
+    size_t total_mem_sp_bytes{0};
+    cudaMemGetInfo(&free_mem_sp_bytes, &total_mem_sp_bytes);
+
+    // GPU memory requirements:
+    //
+    size_t coalesced_v_count = num_paths * max_depth;
+    auto coalesced_e_count   = coalesced_v_count - num_paths;
+    size_t req_mem_common    = sizeof(vertex_t) * coalesced_v_count +
+                            sizeof(weight_t) * coalesced_e_count +  // coalesced_v + coalesced_w
+                            (sizeof(vertex_t) + sizeof(index_t)) * num_paths;  // start_v + sizes
+
+    size_t req_mem_horizontal =
+      req_mem_common + (counter_based_rng ? 0 : sizeof(real_t) * coalesced_e_count);  // + rnd_buff
+    size_t req_mem_vertical =
+      req_mem_common + (sizeof(edge_t) + 2 * sizeof(vertex_t) + sizeof(weight_t) + sizeof(real_t)) *
+                         num_paths;  // + smaller_rnd_buff + tmp_buffs
+
+    bool use_vertical_strategy{false};
+    if (req_mem_horizontal > req_mem_vertical && req_mem_horizontal > free_mem_sp_bytes) {
+      use_vertical_strategy = true;
+      std::cerr
+        << "WARNING: Due to GPU memory availability, slower vertical traversal will be used.\n";
+    }
+    return use_vertical_strategy;
+  }
+}
+
+// constructs the selector for `sampling_strategy`, together with its persistent state (cached
+// out-degrees, sums of weights, alias tables, or, in the multi-GPU case, the local out-adjacency),
+// and invokes `selector_op(selector)`; hence, several batches of paths can be generated by the same
+// selector;
+//
+// `num_paths`: (maximum) number of paths per `random_walks_impl()` call, for the node2vec alpha
+// cache;
+//
+template <typename graph_t, typename real_t, typename index_t, typename selector_op_t>
+auto visit_selector(raft::handle_t const& handle,
+                    graph_t const& graph,
+                    sampling_params_t const* sampling_strategy,
+                    index_t num_paths,
+                    selector_op_t selector_op)
+{
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  int selector_type{0};
+  if (sampling_strategy) selector_type = static_cast<int>(sampling_strategy->sampling_type_);
+
+  // node2vec is only possible for weight_t being a floating-point type:
+  //
+  if constexpr (!std::is_floating_point_v<weight_t>) {
+    CUGRAPH_EXPECTS(selector_type != static_cast<int>(sampling_strategy_t::NODE2VEC),
+                    "node2vec requires floating point type for weights.");
+  }
+
+  weight_t p{1};
+  weight_t q{1};
+  if (selector_type == static_cast<int>(sampling_strategy_t::NODE2VEC)) {
+    p = static_cast<weight_t>(sampling_strategy->p_);
+    q = static_cast<weight_t>(sampling_strategy->q_);
+
+    weight_t roundoff = std::numeric_limits<weight_t>::epsilon();
+    CUGRAPH_EXPECTS(p > roundoff, "node2vec p parameter is too small.");
+
+    CUGRAPH_EXPECTS(q > roundoff, "node2vec q parameter is too small.");
+  }
+
+  // pre-computed alias tables for O(1) neighbor selection (built once for all the steps):
+  //
+  bool use_alias_table = sampling_strategy && sampling_strategy->use_alias_tables_ &&
+                         (selector_type != static_cast<int>(sampling_strategy_t::UNIFORM));
+
+  // `source`: the graph (single-GPU), or the local out-adjacency of the vertex partition owned by
+  // each GPU (multi-GPU), which the selectors sample from:
+  //
+  auto visit = [&](auto const& source) {
+    auto alias_table = use_alias_table
+                         ? std::make_optional(detail::build_alias_table(handle, source))
+                         : std::nullopt;
+    auto p_alias_table = alias_table ? &(*alias_table) : nullptr;
+
+    if (selector_type == static_cast<int>(sampling_strategy_t::BIASED)) {
+      biased_selector_t<graph_t, real_t> selector{handle, source, real_t{0}, p_alias_table};
+
+      return selector_op(selector);
+    } else if (selector_type == static_cast<int>(sampling_strategy_t::NODE2VEC)) {
+      if constexpr (graph_t::is_multi_gpu) {
+        node2vec_selector_t<graph_t, real_t> selector{
+          handle, source, real_t{0}, p, q, p_alias_table};
+
+        return selector_op(selector);
+      } else {
+        edge_t alpha_num_paths = sampling_strategy->use_alpha_cache_ ? num_paths : 0;
+
+        node2vec_selector_t<graph_t, real_t> selector{
+          handle, source, real_t{0}, p, q, alpha_num_paths, p_alias_table};
+
+        return selector_op(selector);
+      }
+    } else {
+      uniform_selector_t<graph_t, real_t> selector{handle, source, real_t{0}};
+
+      return selector_op(selector);
+    }
+  };
+
+  if constexpr (graph_t::is_multi_gpu) {
+    auto adjacency = build_local_adjacency(handle, graph);
+
+    return visit(adjacency);
+  } else {
+    return visit(graph);
+  }
+}
+
+// `random_walks_impl()` with the given traversal strategy:
+//
+template <typename random_engine_t, typename graph_t, typename selector_t, typename index_t>
+auto traverse_paths(raft::handle_t const& handle,
+                    graph_t const& graph,
+                    device_const_vector_view<typename graph_t::vertex_type, index_t>& d_v_start,
+                    index_t max_depth,
+                    selector_t const& selector,
+                    bool use_padding,
+                    bool use_vertical_strategy)
+{
+  return use_vertical_strategy
+           ? random_walks_impl<graph_t, selector_t, vertical_traversal_t, random_engine_t>(
+               handle, graph, d_v_start, max_depth, selector, use_padding)
+           : random_walks_impl<graph_t, selector_t, horizontal_traversal_t, random_engine_t>(
+               handle, graph, d_v_start, max_depth, selector, use_padding);
+}
+
+// generates the paths from `d_v_start` with the given selector, traversal strategy and random
+// engine;
+//
+template <typename graph_t, typename selector_t, typename index_t>
+std::tuple<device_vec_t<typename graph_t::vertex_type>,
+           device_vec_t<typename graph_t::weight_type>,
+           device_vec_t<index_t>>
+generate_paths(raft::handle_t const& handle,
+               graph_t const& graph,
+               device_const_vector_view<typename graph_t::vertex_type, index_t>& d_v_start,
+               index_t max_depth,
+               selector_t const& selector,
+               bool use_padding,
+               bool use_vertical_strategy,
+               bool counter_based_rng)
+{
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+
+  auto quad_tuple =
+    counter_based_rng
+      ? traverse_paths<philox_gen_t<vertex_t, edge_t>>(
+          handle, graph, d_v_start, max_depth, selector, use_padding, use_vertical_strategy)
+      : traverse_paths<rrandom_gen_t<vertex_t, edge_t>>(
+          handle, graph, d_v_start, max_depth, selector, use_padding, use_vertical_strategy);
+  // ignore last element of the quad, seed,
+  // since it's meant for testing / debugging, only:
+  //
+  return std::make_tuple(std::move(std::get<0>(quad_tuple)),
+                         std::move(std::get<1>(quad_tuple)),
+                         std::move(std::get<2>(quad_tuple)));
+}
+
 }  // namespace detail
 
 /**
@@ -1088,147 +2022,114 @@ random_walks(raft::handle_t const& handle,
              std::unique_ptr<sampling_params_t> sampling_strategy)
 {
   using vertex_t = typename graph_t::vertex_type;
-  using edge_t   = typename graph_t::edge_type;
-  using weight_t = typename graph_t::weight_type;
-  using real_t   = float;  // random engine type;
-  // FIXME: this should not be hardcoded; at least tag-dispatched
+  using real_t   = float;  // random engine real type (the engine is selected by `rng_type_`);
 
   // 0-copy const device view:
   //
   detail::device_const_vector_view<vertex_t, index_t> d_v_start{ptr_d_start, num_paths};
 
-  // GPU memory availability:
-  //
-  size_t free_mem_sp_bytes{0};
-  size_t total_mem_sp_bytes{0};
-  cudaMemGetInfo(&free_mem_sp_bytes, &total_mem_sp_bytes);
+  bool counter_based_rng =
+    sampling_strategy && (sampling_strategy->rng_type_ == rng_type_t::PHILOX);
+
+  bool use_vertical_strategy =
+    detail::use_vertical_traversal<graph_t, real_t>(num_paths, max_depth, counter_based_rng);
+
+  return detail::visit_selector<graph_t, real_t>(
+    handle, graph, sampling_strategy.get(), num_paths, [&](auto const& selector) {
+      return detail::generate_paths(handle,
+                                    graph,
+                                    d_v_start,
+                                    max_depth,
+                                    selector,
+                                    use_padding,
+                                    use_vertical_strategy,
+                                    counter_based_rng);
+    });
+}
 
-  // GPU memory requirements:
-  //
-  size_t coalesced_v_count = num_paths * max_depth;
-  auto coalesced_e_count   = coalesced_v_count - num_paths;
-  size_t req_mem_common    = sizeof(vertex_t) * coalesced_v_count +
-                          sizeof(weight_t) * coalesced_e_count +  // coalesced_v + coalesced_w
-                          (sizeof(vertex_t) + sizeof(index_t)) * num_paths;  // start_v + sizes
-
-  size_t req_mem_horizontal = req_mem_common + sizeof(real_t) * coalesced_e_count;  // + rnd_buff
-  size_t req_mem_vertical =
-    req_mem_common + (sizeof(edge_t) + 2 * sizeof(vertex_t) + sizeof(weight_t) + sizeof(real_t)) *
-                       num_paths;  // + smaller_rnd_buff + tmp_buffs
-
-  bool use_vertical_strategy{false};
-  if (req_mem_horizontal > req_mem_vertical && req_mem_horizontal > free_mem_sp_bytes) {
-    use_vertical_strategy = true;
-    std::cerr
-      << "WARNING: Due to GPU memory availability, slower vertical traversal will be used.\n";
-  }
+/**
+ * @brief generates random walks (RW) from starting sources in batches of (at most)
+ * `max_paths_per_batch` paths (see the declaration in <cugraph/algorithms.hpp>).
+ */
+template <typename graph_t, typename index_t>
+void random_walks_batched(
+  raft::handle_t const& handle,
+  graph_t const& graph,
+  typename graph_t::vertex_type const* ptr_d_start,
+  index_t num_paths,
+  index_t max_depth,
+  bool use_padding,
+  std::unique_ptr<sampling_params_t> sampling_strategy,
+  index_t max_paths_per_batch,
+  random_walks_batch_op_t<typename graph_t::vertex_type, typename graph_t::weight_type, index_t>
+    batch_op,
+  bool overlap_output)
+{
+  using vertex_t = typename graph_t::vertex_type;
+  using real_t   = float;  // random engine real type (the engine is selected by `rng_type_`);
 
-  int selector_type{0};
-  if (sampling_strategy) selector_type = static_cast<int>(sampling_strategy->sampling_type_);
+  CUGRAPH_EXPECTS(max_paths_per_batch > 0,
+                  "Invalid input argument: max_paths_per_batch should be positive.");
 
-  // node2vec is only possible for weight_t being a floating-point type:
-  //
-  if constexpr (!std::is_floating_point_v<weight_t>) {
-    CUGRAPH_EXPECTS(selector_type != static_cast<int>(sampling_strategy_t::NODE2VEC),
-                    "node2vec requires floating point type for weights.");
+  auto num_batches = (num_paths + max_paths_per_batch - 1) / max_paths_per_batch;
+  if constexpr (graph_t::is_multi_gpu) {
+    // the walkers of all the GPUs advance in sync, hence all GPUs go through the same number of
+    // batches (possibly empty, on some GPUs):
+    //
+    num_batches = host_scalar_allreduce(
+      handle.get_comms(), num_batches, raft::comms::op_t::MAX, handle.get_stream());
   }
 
-  if (use_vertical_strategy) {
-    if (selector_type == static_cast<int>(sampling_strategy_t::BIASED)) {
-      detail::biased_selector_t<graph_t, real_t> selector{handle, graph, real_t{0}};
-
-      auto quad_tuple =
-        detail::random_walks_impl<graph_t, decltype(selector), detail::vertical_traversal_t>(
-          handle, graph, d_v_start, max_depth, selector, use_padding);
-      // ignore last element of the quad, seed,
-      // since it's meant for testing / debugging, only:
-      //
-      return std::make_tuple(std::move(std::get<0>(quad_tuple)),
-                             std::move(std::get<1>(quad_tuple)),
-                             std::move(std::get<2>(quad_tuple)));
-    } else if (selector_type == static_cast<int>(sampling_strategy_t::NODE2VEC)) {
-      weight_t p(sampling_strategy->p_);
-      weight_t q(sampling_strategy->q_);
-
-      edge_t alpha_num_paths = sampling_strategy->use_alpha_cache_ ? num_paths : 0;
-
-      weight_t roundoff = std::numeric_limits<weight_t>::epsilon();
-      CUGRAPH_EXPECTS(p > roundoff, "node2vec p parameter is too small.");
-
-      CUGRAPH_EXPECTS(q > roundoff, "node2vec q parameter is too small.");
-
-      detail::node2vec_selector_t<graph_t, real_t> selector{
-        handle, graph, real_t{0}, p, q, alpha_num_paths};
-
-      auto quad_tuple =
-        detail::random_walks_impl<graph_t, decltype(selector), detail::vertical_traversal_t>(
-          handle, graph, d_v_start, max_depth, selector, use_padding);
-      // ignore last element of the quad, seed,
-      // since it's meant for testing / debugging, only:
-      //
-      return std::make_tuple(std::move(std::get<0>(quad_tuple)),
-                             std::move(std::get<1>(quad_tuple)),
-                             std::move(std::get<2>(quad_tuple)));
-    } else {
-      detail::uniform_selector_t<graph_t, real_t> selector{handle, graph, real_t{0}};
-
-      auto quad_tuple =
-        detail::random_walks_impl<graph_t, decltype(selector), detail::vertical_traversal_t>(
-          handle, graph, d_v_start, max_depth, selector, use_padding);
-      // ignore last element of the quad, seed,
-      // since it's meant for testing / debugging, only:
-      //
-      return std::make_tuple(std::move(std::get<0>(quad_tuple)),
-                             std::move(std::get<1>(quad_tuple)),
-                             std::move(std::get<2>(quad_tuple)));
-    }
-  } else {  // horizontal traversal strategy
-    if (selector_type == static_cast<int>(sampling_strategy_t::BIASED)) {
-      detail::biased_selector_t<graph_t, real_t> selector{handle, graph, real_t{0}};
-
-      auto quad_tuple =
-        detail::random_walks_impl(handle, graph, d_v_start, max_depth, selector, use_padding);
-      // ignore last element of the quad, seed,
-      // since it's meant for testing / debugging, only:
-      //
-      return std::make_tuple(std::move(std::get<0>(quad_tuple)),
-                             std::move(std::get<1>(quad_tuple)),
-                             std::move(std::get<2>(quad_tuple)));
-    } else if (selector_type == static_cast<int>(sampling_strategy_t::NODE2VEC)) {
-      weight_t p(sampling_strategy->p_);
-      weight_t q(sampling_strategy->q_);
-
-      edge_t alpha_num_paths = sampling_strategy->use_alpha_cache_ ? num_paths : 0;
-
-      weight_t roundoff = std::numeric_limits<weight_t>::epsilon();
-      CUGRAPH_EXPECTS(p > roundoff, "node2vec p parameter is too small.");
-
-      CUGRAPH_EXPECTS(q > roundoff, "node2vec q parameter is too small.");
-
-      detail::node2vec_selector_t<graph_t, real_t> selector{
-        handle, graph, real_t{0}, p, q, alpha_num_paths};
-
-      auto quad_tuple =
-        detail::random_walks_impl(handle, graph, d_v_start, max_depth, selector, use_padding);
-      // ignore last element of the quad, seed,
-      // since it's meant for testing / debugging, only:
-      //
-      return std::make_tuple(std::move(std::get<0>(quad_tuple)),
-                             std::move(std::get<1>(quad_tuple)),
-                             std::move(std::get<2>(quad_tuple)));
-    } else {
-      detail::uniform_selector_t<graph_t, real_t> selector{handle, graph, real_t{0}};
-
-      auto quad_tuple =
-        detail::random_walks_impl(handle, graph, d_v_start, max_depth, selector, use_padding);
-      // ignore last element of the quad, seed,
-      // since it's meant for testing / debugging, only:
-      //
-      return std::make_tuple(std::move(std::get<0>(quad_tuple)),
-                             std::move(std::get<1>(quad_tuple)),
-                             std::move(std::get<2>(quad_tuple)));
-    }
-  }
+  bool counter_based_rng =
+    sampling_strategy && (sampling_strategy->rng_type_ == rng_type_t::PHILOX);
+
+  bool use_vertical_strategy = detail::use_vertical_traversal<graph_t, real_t>(
+    max_paths_per_batch, max_depth, counter_based_rng);
+
+  auto output_stream = overlap_output && (handle.get_num_internal_streams() > 0)
+                         ? handle.get_internal_stream_view(0)
+                         : handle.get_stream_view();
+
+  cudaEvent_t compute_event{};
+  CUDA_TRY(cudaEventCreateWithFlags(&compute_event, cudaEventDisableTiming));
+
+  detail::visit_selector<graph_t, real_t>(
+    handle, graph, sampling_strategy.get(), max_paths_per_batch, [&](auto const& selector) {
+      for (index_t batch = 0; batch < num_batches; ++batch) {
+        auto path_first = std::min(batch * max_paths_per_batch, num_paths);
+        auto path_last  = std::min(path_first + max_paths_per_batch, num_paths);
+
+        detail::device_const_vector_view<vertex_t, index_t> d_v_start{ptr_d_start + path_first,
+                                                                      path_last - path_first};
+
+        auto [d_coalesced_v, d_coalesced_w, d_sizes] = detail::generate_paths(handle,
+                                                                              graph,
+                                                                              d_v_start,
+                                                                              max_depth,
+                                                                              selector,
+                                                                              use_padding,
+                                                                              use_vertical_strategy,
+                                                                              counter_based_rng);
+
+        if (path_first == path_last) continue;  // (multi-GPU) no local paths in this batch
+
+        if (output_stream.value() != handle.get_stream_view().value()) {
+          CUDA_TRY(cudaEventRecord(compute_event, handle.get_stream()));
+          CUDA_TRY(cudaStreamWaitEvent(output_stream.value(), compute_event, 0));
+          d_coalesced_v.set_stream(output_stream);
+          d_coalesced_w.set_stream(output_stream);
+          d_sizes.set_stream(output_stream);
+        }
+
+        batch_op(path_first,
+                 std::move(d_coalesced_v),
+                 std::move(d_coalesced_w),
+                 std::move(d_sizes),
+                 output_stream);
+      }
+    });
+
+  CUDA_TRY(cudaEventDestroy(compute_event));
 }
 
 /**
@@ -27,19 +27,27 @@
 
 #include <cub/cub.cuh>
 
+#include <raft/cuda_utils.cuh>
 #include <raft/device_atomics.cuh>
 #include <raft/handle.hpp>
 #include <raft/random/rng.hpp>
 
+#include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
+#include <thrust/random.h>
 #include <thrust/reduce.h>
+#include <thrust/transform.h>
 
 #include <algorithm>
 #include <future>
+#include <limits>
+#include <optional>
 #include <thread>
+#include <type_traits>
 
 namespace cugraph {
 
@@ -102,6 +110,231 @@ value_t const* raw_const_ptr(device_const_vector_view<value_t>& dv)
   return dv.begin();
 }
 
+// local out-adjacency (CSR) of the vertex partition owned by a GPU (multi-GPU only):
+// rows are local vertex offsets (v - local_vertex_first), column indices are (global) vertex IDs,
+// sorted within each row; all the out-edges of a locally owned vertex are available, hence the
+// next vertex of a walker can be sampled without any communication;
+//
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct local_adjacency_t {
+  local_adjacency_t(vertex_t local_vertex_first,
+                    device_vec_t<edge_t>&& offsets,
+                    device_vec_t<vertex_t>&& indices,
+                    std::optional<device_vec_t<weight_t>>&& weights)
+    : local_vertex_first_(local_vertex_first),
+      offsets_(std::move(offsets)),
+      indices_(std::move(indices)),
+      weights_(std::move(weights))
+  {
+  }
+
+  vertex_t get_local_vertex_first(void) const { return local_vertex_first_; }
+
+  vertex_t get_number_of_local_vertices(void) const
+  {
+    return static_cast<vertex_t>(offsets_.size() - 1);
+  }
+
+  edge_t get_number_of_local_edges(void) const { return static_cast<edge_t>(indices_.size()); }
+
+  edge_t const* get_offsets(void) const { return offsets_.data(); }
+
+  vertex_t const* get_indices(void) const { return indices_.data(); }
+
+  std::optional<weight_t const*> get_weights(void) const
+  {
+    return weights_ ? std::optional<weight_t const*>{(*weights_).data()} : std::nullopt;
+  }
+
+  device_vec_t<edge_t> compute_out_degrees(raft::handle_t const& handle) const
+  {
+    device_vec_t<edge_t> d_out_degs(get_number_of_local_vertices(), handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      offsets_.begin() + 1,
+                      offsets_.end(),
+                      offsets_.begin(),
+                      d_out_degs.begin(),
+                      thrust::minus<edge_t>{});
+    return d_out_degs;
+  }
+
+ private:
+  vertex_t local_vertex_first_{0};
+  device_vec_t<edge_t> offsets_;
+  device_vec_t<vertex_t> indices_;
+  std::optional<device_vec_t<weight_t>> weights_;
+};
+
+// (non-owning) device view of the alias tables below, to be captured by the samplers:
+//
+template <typename edge_t, typename weight_t>
+struct alias_table_view_t {
+  // O(1) selection of an out-edge slot in [0, degree) of the row starting at `first`,
+  // from a single random value in [0, 1]: the integer part of `rnd_val * degree` picks the slot,
+  // the fractional part decides between the slot and its alias;
+  //
+  template <typename real_t>
+  __device__ edge_t operator()(edge_t first, edge_t degree, real_t rnd_val) const
+  {
+    auto scaled_rnd = rnd_val * static_cast<real_t>(degree);
+    auto slot       = static_cast<edge_t>(scaled_rnd);
+    if (slot >= degree) slot = degree - 1;  // rnd_val == 1
+
+    return (scaled_rnd - static_cast<real_t>(slot)) < static_cast<real_t>(probs_[first + slot])
+             ? slot
+             : aliases_[first + slot];
+  }
+
+  weight_t const* probs_;
+  edge_t const* aliases_;
+};
+
+// Walker alias tables (one per CSR row), for O(1) biased selection of a neighbor:
+// the k-th out-edge slot of row `r` is kept with probability `probs[offsets[r] + k]` and otherwise
+// replaced by slot `aliases[offsets[r] + k]`; an un-weighted graph (`values == nullptr`) yields
+// uniform tables;
+//
+// the tables only depend on the graph, hence they can be built once and shared by the selectors
+// of any number of random walks calls on the same graph (the caller owns them and must keep them
+// alive for as long as these selectors are used);
+//
+template <typename edge_t, typename weight_t>
+struct alias_table_t {
+  static_assert(std::is_floating_point_v<weight_t>,
+                "Alias tables require floating point type for weights.");
+
+  alias_table_t(raft::handle_t const& handle,
+                edge_t const* offsets,
+                weight_t const* values,
+                size_t num_rows,
+                edge_t num_edges)
+    : d_probs_(num_edges, handle.get_stream()), d_aliases_(num_edges, handle.get_stream())
+  {
+    // scratch-pad for the per-row worklists of Vose's method:
+    //
+    device_vec_t<edge_t> d_worklists(num_edges, handle.get_stream());
+
+    // one thread per row builds the table of that row, in O(out-degree):
+    //
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator<size_t>(0),
+      thrust::make_counting_iterator<size_t>(num_rows),
+      [offsets,
+       values,
+       probs     = d_probs_.data(),
+       aliases   = d_aliases_.data(),
+       worklists = d_worklists.data()] __device__(auto row) {
+        auto first  = offsets[row];
+        auto degree = offsets[row + 1] - first;
+        if (degree == 0) return;  // sink
+
+        weight_t sum_w{0};
+        for (edge_t k = 0; k < degree; ++k) {
+          sum_w += (values == nullptr ? weight_t{1} : values[first + k]);
+        }
+        bool is_uniform = (values == nullptr) || !(sum_w > weight_t{0});
+
+        // scaled probabilities (average 1); "small" slots (< 1) are stacked from the front of
+        // the row's worklist, "large" ones (>= 1) from the back:
+        //
+        edge_t num_small{0};
+        edge_t num_large{0};
+        for (edge_t k = 0; k < degree; ++k) {
+          auto p =
+            is_uniform ? weight_t{1} : values[first + k] * static_cast<weight_t>(degree) / sum_w;
+          probs[first + k]   = p;
+          aliases[first + k] = k;
+          if (p < weight_t{1}) {
+            worklists[first + num_small++] = k;
+          } else {
+            worklists[first + degree - (++num_large)] = k;
+          }
+        }
+
+        // each small slot is topped up by a large one, which may become small in turn:
+        //
+        while ((num_small > 0) && (num_large > 0)) {
+          auto s = worklists[first + (--num_small)];
+          auto l = worklists[first + degree - num_large];
+
+          aliases[first + s] = l;
+          probs[first + l]   = (probs[first + l] + probs[first + s]) - weight_t{1};
+          if (probs[first + l] < weight_t{1}) {
+            --num_large;
+            worklists[first + num_small++] = l;
+          }
+        }
+
+        // left-overs are only due to round-off errors:
+        //
+        for (; num_large > 0; --num_large) {
+          probs[first + worklists[first + degree - num_large]] = weight_t{1};
+        }
+        for (; num_small > 0; --num_small) {
+          probs[first + worklists[first + num_small - 1]] = weight_t{1};
+        }
+      });
+  }
+
+  edge_t get_number_of_edges(void) const { return static_cast<edge_t>(d_probs_.size()); }
+
+  weight_t const* get_probs(void) const { return d_probs_.data(); }
+
+  edge_t const* get_aliases(void) const { return d_aliases_.data(); }
+
+  alias_table_view_t<edge_t, weight_t> view(void) const
+  {
+    return alias_table_view_t<edge_t, weight_t>{d_probs_.data(), d_aliases_.data()};
+  }
+
+ private:
+  device_vec_t<weight_t> d_probs_;
+  device_vec_t<edge_t> d_aliases_;
+};
+
+// alias tables of a (single-GPU) graph:
+//
+template <typename graph_type>
+alias_table_t<typename graph_type::edge_type, typename graph_type::weight_type> build_alias_table(
+  raft::handle_t const& handle, graph_type const& graph)
+{
+  using edge_t   = typename graph_type::edge_type;
+  using weight_t = typename graph_type::weight_type;
+
+  auto opt_weights = graph.get_matrix_partition_view().get_weights();
+  return alias_table_t<edge_t, weight_t>(handle,
+                                         graph.get_matrix_partition_view().get_offsets(),
+                                         opt_weights ? *opt_weights : nullptr,
+                                         graph.get_number_of_vertices(),
+                                         graph.get_number_of_edges());
+}
+
+// alias tables of the local out-adjacency of a GPU (multi-GPU):
+//
+template <typename vertex_t, typename edge_t, typename weight_t>
+alias_table_t<edge_t, weight_t> build_alias_table(
+  raft::handle_t const& handle, local_adjacency_t<vertex_t, edge_t, weight_t> const& adjacency)
+{
+  return alias_table_t<edge_t, weight_t>(
+    handle,
+    adjacency.get_offsets(),
+    adjacency.get_weights() ? *(adjacency.get_weights()) : static_cast<weight_t const*>(nullptr),
+    adjacency.get_number_of_local_vertices(),
+    adjacency.get_number_of_local_edges());
+}
+
+// alias table view, if any:
+//
+template <typename edge_t, typename weight_t>
+thrust::optional<alias_table_view_t<edge_t, weight_t>> get_alias_table_view(
+  alias_table_t<edge_t, weight_t> const* p_alias_table)
+{
+  return p_alias_table != nullptr
+           ? thrust::optional<alias_table_view_t<edge_t, weight_t>>{p_alias_table->view()}
+           : thrust::nullopt;
+}
+
 // Uniform RW selector logic:
 //
 template <typename graph_type, typename real_t>
@@ -163,6 +396,21 @@ struct uniform_selector_t {
   {
   }
 
+  // multi-GPU version: samples from the local out-adjacency of the vertex partition owned by this
+  // GPU; hence, the sampler expects local vertex offsets as sources;
+  //
+  uniform_selector_t(raft::handle_t const& handle,
+                     local_adjacency_t<vertex_t, edge_t, weight_t> const& adjacency,
+                     real_t tag)
+    : d_cache_out_degs_(adjacency.compute_out_degrees(handle)),
+      sampler_{adjacency.get_offsets(),
+               adjacency.get_indices(),
+               adjacency.get_weights() ? *(adjacency.get_weights())
+                                       : static_cast<weight_t const*>(nullptr),
+               d_cache_out_degs_.data()}
+  {
+  }
+
   device_vec_t<edge_t> const& get_cached_out_degs(void) const { return d_cache_out_degs_; }
 
   sampler_t const& get_strategy(void) const { return sampler_; }
@@ -199,11 +447,15 @@ struct visitor_aggregate_weights_t : visitors::visitor_t {
     auto opt_weights = graph_view.get_matrix_partition_view().get_weights();
     CUGRAPH_EXPECTS(opt_weights.has_value(), "Cannot aggregate weights of un-weighted graph.");
 
-    size_t num_vertices = d_aggregate_weights_.size();
-
-    edge_t const* offsets = graph_view.get_matrix_partition_view().get_offsets();
+    aggregate(graph_view.get_matrix_partition_view().get_offsets(), *opt_weights);
+  }
 
-    weight_t const* values = *opt_weights;
+  // segmented reduction of `values` over the CSR rows given by `offsets`
+  // (also used directly by the multi-GPU selectors, on the local out-adjacency);
+  //
+  void aggregate(edge_t const* offsets, weight_t const* values)
+  {
+    size_t num_vertices = d_aggregate_weights_.size();
 
     // Determine temporary device storage requirements:
     //
@@ -274,8 +526,13 @@ struct biased_selector_t {
     sampler_t(edge_t const* ro,
               vertex_t const* ci,
               weight_t const* w,
-              weight_t const* ptr_d_sum_weights)
-      : row_offsets_(ro), col_indices_(ci), values_(w), ptr_d_sum_weights_(ptr_d_sum_weights)
+              weight_t const* ptr_d_sum_weights,
+              thrust::optional<alias_table_view_t<edge_t, weight_t>> alias_table = thrust::nullopt)
+      : row_offsets_(ro),
+        col_indices_(ci),
+        values_(w),
+        ptr_d_sum_weights_(ptr_d_sum_weights),
+        alias_table_(alias_table)
     {
     }
 
@@ -283,6 +540,7 @@ struct biased_selector_t {
     //
     // Sum(weights(neighborhood(src_v))) are pre-computed and
     // stored in ptr_d_sum_weights_ (too expensive to check, here);
+    // (or, alias tables are available, in which case the selection is O(1));
     //
     __device__ thrust::optional<thrust::tuple<vertex_t, weight_t>> operator()(
       vertex_t src_v,
@@ -291,13 +549,19 @@ struct biased_selector_t {
       edge_t   = 0 /* not used*/,
       bool     = false /* not used*/) const
     {
-      weight_t run_sum_w{0};
-      auto rnd_sum_weights = rnd_val * ptr_d_sum_weights_[src_v];
-
       auto col_indx_begin = row_offsets_[src_v];
       auto col_indx_end   = row_offsets_[src_v + 1];
       if (col_indx_begin == col_indx_end) return thrust::nullopt;  // src_v is a sink
 
+      if (alias_table_.has_value()) {
+        auto col_indx =
+          col_indx_begin + (*alias_table_)(col_indx_begin, col_indx_end - col_indx_begin, rnd_val);
+        return thrust::optional{thrust::make_tuple(col_indices_[col_indx], values_[col_indx])};
+      }
+
+      weight_t run_sum_w{0};
+      auto rnd_sum_weights = rnd_val * ptr_d_sum_weights_[src_v];
+
       auto col_indx      = col_indx_begin;
       auto prev_col_indx = col_indx;
 
@@ -317,20 +581,64 @@ struct biased_selector_t {
     weight_t const* values_;
 
     weight_t const* ptr_d_sum_weights_;
+
+    thrust::optional<alias_table_view_t<edge_t, weight_t>> alias_table_;
   };
 
   using sampler_type = sampler_t;
 
-  biased_selector_t(raft::handle_t const& handle, graph_type const& graph, real_t tag)
-    : sum_calculator_(handle, graph.get_number_of_vertices()),
+  // `p_alias_table` (optional): pre-computed alias tables of `graph` (see `build_alias_table()`),
+  // which replace the per-step scan of the neighborhood by an O(1) selection; (the sums of weights
+  // are not needed, in this case);
+  //
+  biased_selector_t(raft::handle_t const& handle,
+                    graph_type const& graph,
+                    real_t tag,
+                    alias_table_t<edge_t, weight_t> const* p_alias_table = nullptr)
+    : sum_calculator_(handle, p_alias_table == nullptr ? graph.get_number_of_vertices() : 0),
       sampler_{graph.get_matrix_partition_view().get_offsets(),
                graph.get_matrix_partition_view().get_indices(),
                graph.get_matrix_partition_view().get_weights()
                  ? *(graph.get_matrix_partition_view().get_weights())
                  : static_cast<weight_t*>(nullptr),
-               sum_calculator_.get_aggregated_weights().data()}
+               sum_calculator_.get_aggregated_weights().data(),
+               get_alias_table_view(p_alias_table)}
   {
-    graph.apply(sum_calculator_);
+    if (p_alias_table == nullptr) {
+      graph.apply(sum_calculator_);
+    } else {
+      CUGRAPH_EXPECTS(graph.get_matrix_partition_view().get_weights().has_value(),
+                      "Biased sampling requires a weighted graph.");
+      CUGRAPH_EXPECTS(p_alias_table->get_number_of_edges() == graph.get_number_of_edges(),
+                      "Invalid input argument: alias tables do not match the graph.");
+    }
+  }
+
+  // multi-GPU version: samples from the local out-adjacency of the vertex partition owned by this
+  // GPU; hence, the sampler expects local vertex offsets as sources;
+  //
+  biased_selector_t(raft::handle_t const& handle,
+                    local_adjacency_t<vertex_t, edge_t, weight_t> const& adjacency,
+                    real_t tag,
+                    alias_table_t<edge_t, weight_t> const* p_alias_table = nullptr)
+    : sum_calculator_(handle,
+                      p_alias_table == nullptr ? adjacency.get_number_of_local_vertices() : 0),
+      sampler_{adjacency.get_offsets(),
+               adjacency.get_indices(),
+               adjacency.get_weights() ? *(adjacency.get_weights())
+                                       : static_cast<weight_t const*>(nullptr),
+               sum_calculator_.get_aggregated_weights().data(),
+               get_alias_table_view(p_alias_table)}
+  {
+    CUGRAPH_EXPECTS(adjacency.get_weights().has_value(),
+                    "Cannot aggregate weights of un-weighted graph.");
+    if (p_alias_table == nullptr) {
+      sum_calculator_.aggregate(adjacency.get_offsets(), *(adjacency.get_weights()));
+    } else {
+      CUGRAPH_EXPECTS(
+        p_alias_table->get_number_of_edges() == adjacency.get_number_of_local_edges(),
+        "Invalid input argument: alias tables do not match the local adjacency.");
+    }
   }
 
   sampler_t const& get_strategy(void) const { return sampler_; }
@@ -365,17 +673,21 @@ struct node2vec_selector_t {
               weight_t q,
               vertex_t max_degree,
               edge_t num_paths,
-              weight_t* ptr_alpha)
+              weight_t* ptr_alpha,
+              thrust::optional<alias_table_view_t<edge_t, weight_t>> alias_table = thrust::nullopt)
       : row_offsets_(ro),
         col_indices_(ci),
         values_(w),
         p_(p),
         q_(q),
+        min_alpha_(std::min({weight_t{1} / p, weight_t{1}, weight_t{1} / q})),
+        max_alpha_(std::max({weight_t{1} / p, weight_t{1}, weight_t{1} / q})),
         coalesced_alpha_{
           (max_degree > 0) && (num_paths > 0) && (ptr_alpha != nullptr)
             ? thrust::optional<thrust::tuple<vertex_t, edge_t, weight_t*>>{thrust::make_tuple(
                 max_degree, num_paths, ptr_alpha)}
-            : thrust::nullopt}
+            : thrust::nullopt},
+        alias_table_(alias_table)
     {
     }
 
@@ -388,15 +700,7 @@ struct node2vec_selector_t {
       if (next_v == prev_v) {
         return 1.0 / p_;
       } else {
-        // binary-search `next_v` in the adj(prev_v)
-        //
-        auto prev_indx_begin = row_offsets_[prev_v];
-        auto prev_indx_end   = row_offsets_[prev_v + 1];
-
-        auto found_next_from_prev = thrust::binary_search(
-          thrust::seq, col_indices_ + prev_indx_begin, col_indices_ + prev_indx_end, next_v);
-
-        if (found_next_from_prev) {
+        if (is_neighbor(prev_v, next_v)) {
           return 1;
         } else {
           return 1.0 / q_;
@@ -404,6 +708,18 @@ struct node2vec_selector_t {
       }
     }
 
+    // binary-search `v` in the adj(`row`):
+    // (in the multi-GPU case `row` is a local vertex offset, while `v` is a vertex ID)
+    //
+    __device__ bool is_neighbor(vertex_t row, vertex_t v) const
+    {
+      auto row_indx_begin = row_offsets_[row];
+      auto row_indx_end   = row_offsets_[row + 1];
+
+      return thrust::binary_search(
+        thrust::seq, col_indices_ + row_indx_begin, col_indices_ + row_indx_end, v);
+    }
+
     __device__ thrust::optional<thrust::tuple<vertex_t, weight_t>> operator()(
       vertex_t src_v, real_t rnd_val, vertex_t prev_v, edge_t path_index, bool start_path) const
     {
@@ -415,6 +731,48 @@ struct node2vec_selector_t {
 
       if (offset_indx_begin == offset_indx_end) return thrust::nullopt;  // src_v is a sink
 
+      // alias tables available: O(1) proposals from the unscaled weights, accepted with
+      // probability alpha / max_alpha (rejection sampling); proposals under the `min_alpha_` bound
+      // are accepted without looking up adj(prev_v); the 1st vertex in path is not scaled;
+      //
+      if (alias_table_.has_value()) {
+        auto const degree = offset_indx_end - offset_indx_begin;
+        auto alias_select = [offset_indx_begin, degree, alias_table = *alias_table_](real_t rnd) {
+          return offset_indx_begin + alias_table(offset_indx_begin, degree, rnd);
+        };
+
+        if (start_path) {
+          offset_indx = alias_select(rnd_val);
+          return thrust::optional{
+            thrust::make_tuple(col_indices_[offset_indx],
+                               values_ == nullptr ? weight_t{1} : values_[offset_indx])};
+        }
+
+        // the acceptance tests (and retries) draw from a per-path stream, seeded by `rnd_val`:
+        //
+        auto rnd_bits = static_cast<uint32_t>(
+          rnd_val * static_cast<real_t>(std::numeric_limits<uint32_t>::max()));
+        thrust::default_random_engine rng(
+          rnd_bits ^ static_cast<uint32_t>(static_cast<uint64_t>(path_index) * 2654435761u));
+        thrust::uniform_real_distribution<real_t> rnd_dist(real_t{0}, real_t{1});
+
+        auto rnd_proposal = rnd_val;
+        for (int attempt = 0; attempt < max_rejection_attempts; ++attempt) {
+          offset_indx     = alias_select(rnd_proposal);
+          auto next_v     = col_indices_[offset_indx];
+          auto rnd_accept = rnd_dist(rng) * max_alpha_;
+          if ((rnd_accept < min_alpha_) || (rnd_accept < get_alpha(prev_v, src_v, next_v))) {
+            return thrust::optional{thrust::make_tuple(
+              next_v, values_ == nullptr ? weight_t{1} : values_[offset_indx])};
+          }
+          rnd_proposal = rnd_dist(rng);
+        }
+
+        // (unlikely) too many rejections: fall back to the exact selection below;
+        //
+        offset_indx = offset_indx_begin;
+      }
+
       // for 1st vertex in path just use biased random selection:
       //
       if (start_path) {  // `src_v` is starting vertex in path
@@ -523,7 +881,22 @@ struct node2vec_selector_t {
 
     decltype(auto) get_alpha_buffer(void) const { return coalesced_alpha_; }
 
+    __host__ __device__ weight_t get_p(void) const { return p_; }
+
+    __host__ __device__ weight_t get_q(void) const { return q_; }
+
+    // bounds of alpha(), for rejection sampling:
+    //
+    __host__ __device__ weight_t get_min_alpha(void) const { return min_alpha_; }
+
+    __host__ __device__ weight_t get_max_alpha(void) const { return max_alpha_; }
+
    private:
+    // cap on the rejection sampling attempts per step (each attempt is accepted with probability
+    // at least min_alpha / max_alpha, so this is rarely reached);
+    //
+    static constexpr int max_rejection_attempts = 64;
+
     edge_t const* row_offsets_;
     vertex_t const* col_indices_;
     weight_t const* values_;
@@ -531,6 +904,9 @@ struct node2vec_selector_t {
     weight_t const p_;
     weight_t const q_;
 
+    weight_t const min_alpha_;
+    weight_t const max_alpha_;
+
     // alpha scaling coalesced buffer (per path):
     // (use as cache since the per-path alpha-buffer
     //  is used twice for each node transition:
@@ -542,16 +918,22 @@ struct node2vec_selector_t {
     mutable thrust::optional<thrust::tuple<vertex_t, edge_t, weight_t*>>
       coalesced_alpha_;  // tuple<max_vertex_degree,
                          // num_paths, alpha_buffer[max_vertex_degree*num_paths]>
+
+    thrust::optional<alias_table_view_t<edge_t, weight_t>> alias_table_;
   };
 
   using sampler_type = sampler_t;
 
+  // `p_alias_table` (optional): pre-computed alias tables of `graph` (see `build_alias_table()`),
+  // for O(1) proposals of the next vertex, which is then drawn by rejection sampling;
+  //
   node2vec_selector_t(raft::handle_t const& handle,
                       graph_type const& graph,
                       real_t tag,
                       weight_t p,
                       weight_t q,
-                      edge_t num_paths = 0)
+                      edge_t num_paths                                     = 0,
+                      alias_table_t<edge_t, weight_t> const* p_alias_table = nullptr)
     : max_out_degree_(num_paths > 0 ? graph.compute_max_out_degree(handle) : 0),
       d_coalesced_alpha_{max_out_degree_ * num_paths, handle.get_stream()},
       sampler_{graph.get_matrix_partition_view().get_offsets(),
@@ -563,8 +945,41 @@ struct node2vec_selector_t {
                q,
                static_cast<vertex_t>(max_out_degree_),
                num_paths,
-               raw_ptr(d_coalesced_alpha_)}
+               raw_ptr(d_coalesced_alpha_),
+               get_alias_table_view(p_alias_table)}
   {
+    CUGRAPH_EXPECTS((p_alias_table == nullptr) ||
+                      (p_alias_table->get_number_of_edges() == graph.get_number_of_edges()),
+                    "Invalid input argument: alias tables do not match the graph.");
+  }
+
+  // multi-GPU version: samples from the local out-adjacency of the vertex partition owned by this
+  // GPU; the alpha cache is not used, because the multi-GPU walks draw the next vertex by
+  // rejection sampling (see `random_walks_impl()`), whose proposals use `p_alias_table`, if any;
+  //
+  node2vec_selector_t(raft::handle_t const& handle,
+                      local_adjacency_t<vertex_t, edge_t, weight_t> const& adjacency,
+                      real_t tag,
+                      weight_t p,
+                      weight_t q,
+                      alias_table_t<edge_t, weight_t> const* p_alias_table = nullptr)
+    : max_out_degree_(0),
+      d_coalesced_alpha_{0, handle.get_stream()},
+      sampler_{adjacency.get_offsets(),
+               adjacency.get_indices(),
+               adjacency.get_weights() ? *(adjacency.get_weights())
+                                       : static_cast<weight_t const*>(nullptr),
+               p,
+               q,
+               vertex_t{0},
+               edge_t{0},
+               static_cast<weight_t*>(nullptr),
+               get_alias_table_view(p_alias_table)}
+  {
+    CUGRAPH_EXPECTS(
+      (p_alias_table == nullptr) ||
+        (p_alias_table->get_number_of_edges() == adjacency.get_number_of_local_edges()),
+      "Invalid input argument: alias tables do not match the local adjacency.");
   }
 
   sampler_t const& get_strategy(void) const { return sampler_; }
@@ -584,6 +999,121 @@ struct node2vec_selector_t {
   sampler_t sampler_;
 };
 
+// node2vec is a 2nd order walk (the next vertex depends on the previous one, too):
+//
+template <typename selector_t>
+struct is_second_order_selector_t : std::false_type {
+};
+
+template <typename graph_type, typename real_t>
+struct is_second_order_selector_t<node2vec_selector_t<graph_type, real_t>> : std::true_type {
+};
+
+// advances one path from start to finish (or until it reaches a sink);
+// the random values are read from `ptr_d_random` (of size num_paths x (max_depth - 1)), unless the
+// random engine is counter-based, in which case they are evaluated on the fly;
+//
+template <typename random_engine_t,
+          typename sampler_t,
+          typename index_t,
+          typename seed_t,
+          typename real_t,
+          typename vertex_t,
+          typename weight_t>
+__device__ void walk_path(sampler_t const& sampler,
+                          index_t path_index,
+                          index_t max_depth,
+                          seed_t seed0,
+                          real_t const* ptr_d_random,
+                          vertex_t* ptr_coalesced_v,
+                          weight_t* ptr_coalesced_w,
+                          index_t* ptr_d_sizes)
+{
+  auto chunk_offset   = path_index * max_depth;
+  vertex_t src_vertex = ptr_coalesced_v[chunk_offset];
+  auto prev_v         = src_vertex;
+  bool start_path     = true;
+
+  // start from 1, as 0-th was initialized above:
+  //
+  for (index_t step_indx = 1; step_indx < max_depth; ++step_indx) {
+    // indexing into coalesced arrays of size num_paths x (max_depth -1):
+    // (d_random, d_coalesced_w)
+    //
+    auto stepping_index = chunk_offset - path_index + step_indx - 1;
+
+    real_t real_rnd_indx{};
+    if constexpr (random_engine_t::is_counter_based) {
+      real_rnd_indx = random_engine_t::draw(seed0, static_cast<uint64_t>(stepping_index));
+    } else {
+      real_rnd_indx = ptr_d_random[stepping_index];
+    }
+
+    auto opt_tpl_vn_wn = sampler(src_vertex, real_rnd_indx, prev_v, path_index, start_path);
+    if (!opt_tpl_vn_wn.has_value()) break;
+
+    prev_v     = src_vertex;
+    start_path = false;
+
+    src_vertex      = thrust::get<0>(*opt_tpl_vn_wn);
+    auto crt_weight = thrust::get<1>(*opt_tpl_vn_wn);
+
+    ptr_coalesced_v[chunk_offset + step_indx] = src_vertex;
+    ptr_coalesced_w[stepping_index]           = crt_weight;
+    ptr_d_sizes[path_index]++;
+  }
+}
+
+// persistent kernel driving the paths of `persistent_traversal_t`:
+// each warp repeatedly claims the next chunk of (warp size) paths from a global work counter and
+// each of its lanes advances one of these paths to the end; paths that stop early (sinks) hence
+// don't hold back the rest of the grid;
+//
+template <typename random_engine_t,
+          typename sampler_t,
+          typename index_t,
+          typename seed_t,
+          typename real_t,
+          typename vertex_t,
+          typename weight_t>
+__global__ void persistent_walks_kernel(sampler_t sampler,
+                                        index_t num_paths,
+                                        index_t max_depth,
+                                        seed_t seed0,
+                                        real_t const* ptr_d_random,
+                                        vertex_t* ptr_coalesced_v,
+                                        weight_t* ptr_coalesced_w,
+                                        index_t* ptr_d_sizes,
+                                        unsigned long long int* ptr_next_chunk)
+{
+  auto const lane_id = threadIdx.x % raft::warp_size();
+
+  while (true) {
+    unsigned long long int chunk_first{0};
+    if (lane_id == 0) {
+      chunk_first =
+        atomicAdd(ptr_next_chunk, static_cast<unsigned long long int>(raft::warp_size()));
+    }
+    chunk_first = __shfl_sync(raft::warp_full_mask(), chunk_first, 0);
+
+    // (uniform across the warp)
+    //
+    if (chunk_first >= static_cast<unsigned long long int>(num_paths)) break;
+
+    auto path_index = static_cast<index_t>(chunk_first + lane_id);
+    if (path_index < num_paths) {
+      walk_path<random_engine_t>(sampler,
+                                 path_index,
+                                 max_depth,
+                                 seed0,
+                                 ptr_d_random,
+                                 ptr_coalesced_v,
+                                 ptr_coalesced_w,
+                                 ptr_d_sizes);
+    }
+  }
+}
+
 // classes abstracting the way the random walks path are generated:
 //
 
@@ -643,7 +1173,10 @@ struct vertical_traversal_t {
     }
   }
 
-  size_t get_random_buff_sz(void) const { return num_paths_; }
+  // (the random values of each step are read by the column extractor from a buffer, whether or
+  //  not the random engine is counter-based)
+  //
+  size_t get_random_buff_sz(bool counter_based_rng = false) const { return num_paths_; }
   size_t get_tmp_buff_sz(void) const { return num_paths_; }
 
  private:
@@ -655,6 +1188,7 @@ struct vertical_traversal_t {
 // each path is generated independently from start to finish;
 // when a vertex is a sink the corresponding path doesn't advance anymore;
 // requires (num_paths x max_depth) precomputed real random values in [0,1];
+// (unless the random engine is counter-based, in which case these are evaluated on the fly);
 //
 // larger memory footprint, but potentially more efficient;
 //
@@ -695,7 +1229,11 @@ struct horizontal_traversal_t {
     auto const& handle = rand_walker.get_handle();
     auto* ptr_d_random = raw_ptr(d_random);
 
-    random_engine_t::generate_random(handle, ptr_d_random, d_random.size(), seed0);
+    // counter-based engines draw the random values inline, instead:
+    //
+    if constexpr (!random_engine_t::is_counter_based) {
+      random_engine_t::generate_random(handle, ptr_d_random, d_random.size(), seed0);
+    }
 
     auto* ptr_d_sizes = raw_ptr(d_paths_sz);
 
@@ -703,48 +1241,33 @@ struct horizontal_traversal_t {
     //
     sampler_t const& sampler = selector.get_strategy();
 
-    // start from 1, as 0-th was initialized above:
-    //
     thrust::for_each(handle.get_thrust_policy(),
                      thrust::make_counting_iterator<index_t>(0),
                      thrust::make_counting_iterator<index_t>(num_paths_),
-                     [max_depth       = max_depth_,
+                     [max_depth       = static_cast<index_t>(max_depth_),
                       ptr_coalesced_v = raw_ptr(d_coalesced_v),
                       ptr_coalesced_w = raw_ptr(d_coalesced_w),
                       ptr_d_random,
                       ptr_d_sizes,
-                      sampler] __device__(auto path_index) {
-                       auto chunk_offset   = path_index * max_depth;
-                       vertex_t src_vertex = ptr_coalesced_v[chunk_offset];
-                       auto prev_v         = src_vertex;
-                       bool start_path     = true;
-
-                       for (index_t step_indx = 1; step_indx < max_depth; ++step_indx) {
-                         // indexing into coalesced arrays of size num_paths x (max_depth -1):
-                         // (d_random, d_coalesced_w)
-                         //
-                         auto stepping_index = chunk_offset - path_index + step_indx - 1;
-
-                         auto real_rnd_indx = ptr_d_random[stepping_index];
-
-                         auto opt_tpl_vn_wn =
-                           sampler(src_vertex, real_rnd_indx, prev_v, path_index, start_path);
-                         if (!opt_tpl_vn_wn.has_value()) break;
-
-                         prev_v     = src_vertex;
-                         start_path = false;
-
-                         src_vertex      = thrust::get<0>(*opt_tpl_vn_wn);
-                         auto crt_weight = thrust::get<1>(*opt_tpl_vn_wn);
-
-                         ptr_coalesced_v[chunk_offset + step_indx] = src_vertex;
-                         ptr_coalesced_w[stepping_index]           = crt_weight;
-                         ptr_d_sizes[path_index]++;
-                       }
+                      sampler,
+                      seed0] __device__(auto path_index) {
+                       walk_path<random_engine_t>(sampler,
+                                                  path_index,
+                                                  max_depth,
+                                                  seed0,
+                                                  ptr_d_random,
+                                                  ptr_coalesced_v,
+                                                  ptr_coalesced_w,
+                                                  ptr_d_sizes);
                      });
   }
 
-  size_t get_random_buff_sz(void) const { return num_paths_ * (max_depth_ - 1); }
+  // a counter-based random engine is evaluated inline, hence requires no random buffer:
+  //
+  size_t get_random_buff_sz(bool counter_based_rng = false) const
+  {
+    return counter_based_rng ? 0 : num_paths_ * (max_depth_ - 1);
+  }
   size_t get_tmp_buff_sz(void) const
   {
     return 0;
@@ -756,5 +1279,105 @@ struct horizontal_traversal_t {
   size_t max_depth_;
 };
 
+// persistent traversal proxy:
+// same paths layout and random values as the horizontal traversal, but generated by a single
+// persistent kernel, sized to the device (rather than to the number of paths), whose warps keep
+// claiming chunks of paths until all are done; balances long walks of very uneven lengths
+// (early sinks) better and avoids any per-step round-trip to the host;
+//
+// memory footprint as for the horizontal traversal;
+//
+struct persistent_traversal_t {
+  persistent_traversal_t(size_t num_paths, size_t max_depth)
+    : num_paths_(num_paths), max_depth_(max_depth)
+  {
+  }
+
+  template <typename graph_t,
+            typename random_walker_t,
+            typename selector_t,
+            typename index_t,
+            typename real_t,
+            typename seed_t>
+  void operator()(
+    graph_t const& graph,                // graph being traversed
+    random_walker_t const& rand_walker,  // random walker object for which traversal is driven
+    selector_t const& selector,          // sampling type (uniform, biased, etc.)
+    seed_t seed0,                        // initial seed value
+    device_vec_t<typename graph_t::vertex_type>& d_coalesced_v,  // crt coalesced vertex set
+    device_vec_t<typename graph_t::weight_type>& d_coalesced_w,  // crt coalesced weight set
+    device_vec_t<index_t>& d_paths_sz,                           // crt paths sizes
+    device_vec_t<typename graph_t::edge_type>&
+      d_crt_out_degs,                // ignored: out-degs for the current set of vertices
+    device_vec_t<real_t>& d_random,  // _entire_ set of random real values
+    device_vec_t<typename graph_t::vertex_type>&
+      d_col_indx)  // ignored: crt col indices to be used for retrieving next step
+    const
+  {
+    using vertex_t        = typename graph_t::vertex_type;
+    using weight_t        = typename graph_t::weight_type;
+    using random_engine_t = typename random_walker_t::rnd_engine_t;
+    using sampler_t       = typename selector_t::sampler_type;
+
+    if (num_paths_ == 0) return;
+
+    auto const& handle = rand_walker.get_handle();
+    auto* ptr_d_random = raw_ptr(d_random);
+
+    if constexpr (!random_engine_t::is_counter_based) {
+      random_engine_t::generate_random(handle, ptr_d_random, d_random.size(), seed0);
+    }
+
+    sampler_t const& sampler = selector.get_strategy();
+
+    auto kernel = persistent_walks_kernel<random_engine_t,
+                                          sampler_t,
+                                          index_t,
+                                          seed_t,
+                                          real_t,
+                                          vertex_t,
+                                          weight_t>;
+
+    // as many blocks as can be simultaneously resident, but no more than there are paths for:
+    //
+    int num_blocks_per_sm{0};
+    CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &num_blocks_per_sm, kernel, persistent_walks_block_size, 0));
+    auto max_num_blocks = static_cast<size_t>(std::max(num_blocks_per_sm, 1)) *
+                          static_cast<size_t>(handle.get_device_properties().multiProcessorCount);
+    auto num_blocks = std::min(max_num_blocks,
+                               (num_paths_ + persistent_walks_block_size - 1) /
+                                 static_cast<size_t>(persistent_walks_block_size));
+
+    rmm::device_scalar<unsigned long long int> next_chunk(0, handle.get_stream());
+
+    kernel<<<num_blocks, persistent_walks_block_size, 0, handle.get_stream()>>>(
+      sampler,
+      static_cast<index_t>(num_paths_),
+      static_cast<index_t>(max_depth_),
+      seed0,
+      ptr_d_random,
+      raw_ptr(d_coalesced_v),
+      raw_ptr(d_coalesced_w),
+      raw_ptr(d_paths_sz),
+      next_chunk.data());
+    CUDA_TRY(cudaPeekAtLastError());
+  }
+
+  // as for the horizontal traversal:
+  //
+  size_t get_random_buff_sz(bool counter_based_rng = false) const
+  {
+    return counter_based_rng ? 0 : num_paths_ * (max_depth_ - 1);
+  }
+  size_t get_tmp_buff_sz(void) const { return 0; }
+
+ private:
+  static constexpr int persistent_walks_block_size = 128;
+
+  size_t num_paths_;
+  size_t max_depth_;
+};
+
 }  // namespace detail
 }  // namespace cugraph
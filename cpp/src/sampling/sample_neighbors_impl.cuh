@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/sample_out_nbr.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/sort.h>
+#include <thrust/unique.h>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+template <typename vertex_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> sort_and_unique_frontier(raft::handle_t const& handle,
+                                                       rmm::device_uvector<vertex_t>&& frontier)
+{
+  thrust::sort(handle.get_thrust_policy(), frontier.begin(), frontier.end());
+  auto last = thrust::unique(handle.get_thrust_policy(), frontier.begin(), frontier.end());
+  frontier.resize(thrust::distance(frontier.begin(), last), handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    frontier = detail::shuffle_vertices_by_gpu_id(handle, std::move(frontier));
+    thrust::sort(handle.get_thrust_policy(), frontier.begin(), frontier.end());
+    last = thrust::unique(handle.get_thrust_policy(), frontier.begin(), frontier.end());
+    frontier.resize(thrust::distance(frontier.begin(), last), handle.get_stream());
+  }
+  frontier.shrink_to_fit(handle.get_stream());
+
+  return std::move(frontier);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::vector<std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>>
+sample_neighbors(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 vertex_t const* seeds,
+                 size_t num_seeds,
+                 std::vector<size_t> const& fanouts,
+                 bool weighted,
+                 uint64_t rng_seed,
+                 bool do_expensive_check)
+{
+  scoped_phase_t phase("sample_neighbors", handle.get_stream_view());
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((seeds != nullptr) || (num_seeds == 0),
+                  "Invalid input argument: seeds cannot be null if num_seeds > 0.");
+  CUGRAPH_EXPECTS(!weighted || graph_view.is_weighted(),
+                  "Invalid input argument: weighted sampling requires a weighted graph.");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, multi_gpu>(
+      graph_view.get_vertex_partition_view());
+    auto num_invalid_seeds = count_if_v(
+      handle, graph_view, seeds, seeds + num_seeds, [vertex_partition] __device__(auto v) {
+        return !(vertex_partition.is_valid_vertex(v) &&
+                 vertex_partition.is_local_vertex_nocheck(v));
+      });
+    CUGRAPH_EXPECTS(num_invalid_seeds == 0,
+                    "Invalid input argument: seeds have invalid vertex IDs or vertices not local "
+                    "to this GPU.");
+  }
+
+  // 2. sample hop by hop, the destinations of a hop (de-duplicated) form the next frontier
+
+  rmm::device_uvector<vertex_t> frontier(num_seeds, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), seeds, seeds + num_seeds, frontier.begin());
+  frontier = sort_and_unique_frontier<vertex_t, multi_gpu>(handle, std::move(frontier));
+
+  std::vector<std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>> hops{};
+  hops.reserve(fanouts.size());
+  for (size_t hop = 0; hop < fanouts.size(); ++hop) {
+    auto [srcs, dsts] = sample_out_nbr(handle,
+                                       graph_view,
+                                       frontier.begin(),
+                                       frontier.end(),
+                                       fanouts[hop],
+                                       weighted,
+                                       rng_seed + static_cast<uint64_t>(hop));
+
+    if (hop + 1 < fanouts.size()) {
+      frontier.resize(dsts.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(), dsts.begin(), dsts.end(), frontier.begin());
+      frontier = sort_and_unique_frontier<vertex_t, multi_gpu>(handle, std::move(frontier));
+    }
+
+    hops.push_back(std::make_tuple(std::move(srcs), std::move(dsts)));
+  }
+
+  return hops;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::vector<std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>>
+sample_neighbors(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 vertex_t const* seeds,
+                 size_t num_seeds,
+                 std::vector<size_t> const& fanouts,
+                 bool weighted,
+                 uint64_t rng_seed,
+                 bool do_expensive_check)
+{
+  return detail::sample_neighbors(
+    handle, graph_view, seeds, num_seeds, fanouts, weighted, rng_seed, do_expensive_check);
+}
+
+}  // namespace cugraph
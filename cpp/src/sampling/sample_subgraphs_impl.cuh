@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+#include <generators/splitmix64.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename T>
+struct draw_uniform_index_t {
+  uint64_t seed{};
+  uint64_t stream_first{};
+  T range{};
+
+  __device__ T operator()(size_t i) const
+  {
+    splitmix64_t rng(seed, stream_first + i);
+    return static_cast<T>(rng.next() % static_cast<uint64_t>(range));
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+struct draw_to_subgraph_t {
+  size_t num_draws_per_subgraph{};
+
+  __device__ size_t operator()(size_t i) const { return i / num_draws_per_subgraph; }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_padding_vertex_t {
+  vertex_t num_vertices{};
+
+  __device__ bool operator()(thrust::tuple<size_t, vertex_t> pair) const
+  {
+    return thrust::get<1>(pair) == num_vertices;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct to_subgraph_local_edge_t {
+  size_t const* subgraph_edge_offsets{nullptr};
+  size_t num_subgraphs{};
+  size_t const* subgraph_vertex_offsets{nullptr};
+  vertex_t const* subgraph_vertices{nullptr};
+
+  // returns (the row in the concatenated CSR, the column local to the subgraph)
+  __device__ thrust::tuple<size_t, vertex_t> operator()(
+    thrust::tuple<size_t, vertex_t, vertex_t> e) const
+  {
+    auto s     = static_cast<size_t>(thrust::distance(
+      subgraph_edge_offsets + 1,
+      thrust::upper_bound(thrust::seq,
+                          subgraph_edge_offsets + 1,
+                          subgraph_edge_offsets + num_subgraphs + 1,
+                          thrust::get<0>(e))));
+    auto first = subgraph_vertices + subgraph_vertex_offsets[s];
+    auto last  = subgraph_vertices + subgraph_vertex_offsets[s + 1];
+    auto row   = subgraph_vertex_offsets[s] +
+               static_cast<size_t>(thrust::distance(
+                 first, thrust::lower_bound(thrust::seq, first, last, thrust::get<1>(e))));
+    auto col = static_cast<vertex_t>(
+      thrust::distance(first, thrust::lower_bound(thrust::seq, first, last, thrust::get<2>(e))));
+    return thrust::make_tuple(row, col);
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>>
+draw_sampled_edge_endpoints(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t num_draws,
+  size_t num_draws_per_subgraph,
+  uint64_t rng_seed,
+  uint64_t stream_first)
+{
+  // the local edge lists of all the GPUs, concatenated in the GPU rank order, form the global
+  // edge list, and the edges are drawn from this list uniformly (with replacement)
+
+  auto [majors, minors] = extract_local_major_edgelist(handle, graph_view, true);
+
+  std::vector<size_t> h_edge_lasts{majors.size()};
+  if constexpr (multi_gpu) {
+    auto h_edge_counts =
+      host_scalar_allgather(handle.get_comms(), majors.size(), handle.get_stream());
+    h_edge_lasts.resize(h_edge_counts.size());
+    std::inclusive_scan(h_edge_counts.begin(), h_edge_counts.end(), h_edge_lasts.begin());
+  }
+  CUGRAPH_EXPECTS(h_edge_lasts.back() > 0,
+                  "Invalid input argument: edge sampling requires a graph with edges.");
+
+  rmm::device_uvector<size_t> draws(num_draws, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(num_draws),
+                    draws.begin(),
+                    draw_uniform_index_t<size_t>{rng_seed, stream_first, h_edge_lasts.back()});
+  rmm::device_uvector<size_t> draw_positions(num_draws, handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), draw_positions.begin(), draw_positions.end());
+
+  rmm::device_uvector<vertex_t> draw_majors(num_draws, handle.get_stream());
+  rmm::device_uvector<vertex_t> draw_minors(num_draws, handle.get_stream());
+  if constexpr (multi_gpu) {
+    auto& comm           = handle.get_comms();
+    auto const comm_rank = comm.get_rank();
+
+    // send the drawn (global) edge indices to the GPUs storing the edges, the edge endpoints come
+    // back in the same order
+
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), draws.begin(), draws.end(), draw_positions.begin());
+
+    rmm::device_uvector<size_t> d_edge_lasts(h_edge_lasts.size(), handle.get_stream());
+    raft::update_device(
+      d_edge_lasts.data(), h_edge_lasts.data(), h_edge_lasts.size(), handle.get_stream());
+    rmm::device_uvector<size_t> d_tx_counts(d_edge_lasts.size(), handle.get_stream());
+    thrust::upper_bound(handle.get_thrust_policy(),
+                        draws.begin(),
+                        draws.end(),
+                        d_edge_lasts.begin(),
+                        d_edge_lasts.end(),
+                        d_tx_counts.begin());
+    thrust::adjacent_difference(
+      handle.get_thrust_policy(), d_tx_counts.begin(), d_tx_counts.end(), d_tx_counts.begin());
+    std::vector<size_t> h_tx_counts(d_tx_counts.size());
+    raft::update_host(
+      h_tx_counts.data(), d_tx_counts.data(), d_tx_counts.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    auto [rx_draws, rx_counts] =
+      shuffle_values(comm, draws.begin(), h_tx_counts, handle.get_stream());
+    draws.resize(0, handle.get_stream());
+    draws.shrink_to_fit(handle.get_stream());
+
+    auto local_edge_first = comm_rank == 0 ? size_t{0} : h_edge_lasts[comm_rank - 1];
+    thrust::transform(handle.get_thrust_policy(),
+                      rx_draws.begin(),
+                      rx_draws.end(),
+                      rx_draws.begin(),
+                      [local_edge_first] __device__(auto i) { return i - local_edge_first; });
+    rmm::device_uvector<vertex_t> rx_majors(rx_draws.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_minors(rx_draws.size(), handle.get_stream());
+    thrust::gather(
+      handle.get_thrust_policy(),
+      rx_draws.begin(),
+      rx_draws.end(),
+      thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(rx_majors.begin(), rx_minors.begin())));
+
+    std::tie(draw_majors, std::ignore) =
+      shuffle_values(comm, rx_majors.begin(), rx_counts, handle.get_stream());
+    std::tie(draw_minors, std::ignore) =
+      shuffle_values(comm, rx_minors.begin(), rx_counts, handle.get_stream());
+  } else {
+    thrust::gather(
+      handle.get_thrust_policy(),
+      draws.begin(),
+      draws.end(),
+      thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(draw_majors.begin(), draw_minors.begin())));
+  }
+
+  // both endpoints of a drawn edge belong to the subgraph of the draw
+
+  rmm::device_uvector<size_t> subgraph_ids(num_draws * 2, handle.get_stream());
+  rmm::device_uvector<vertex_t> vertices(subgraph_ids.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    draw_positions.begin(),
+                    draw_positions.end(),
+                    subgraph_ids.begin(),
+                    draw_to_subgraph_t{num_draws_per_subgraph});
+  thrust::copy(handle.get_thrust_policy(),
+               subgraph_ids.begin(),
+               subgraph_ids.begin() + num_draws,
+               subgraph_ids.begin() + num_draws);
+  thrust::copy(
+    handle.get_thrust_policy(), draw_majors.begin(), draw_majors.end(), vertices.begin());
+  thrust::copy(handle.get_thrust_policy(),
+               draw_minors.begin(),
+               draw_minors.end(),
+               vertices.begin() + num_draws);
+
+  return std::make_tuple(std::move(subgraph_ids), std::move(vertices));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+sample_subgraphs(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 subgraph_sampler_t sampler,
+                 size_t num_subgraphs,
+                 size_t sample_size,
+                 size_t walk_length,
+                 uint64_t rng_seed)
+{
+  scoped_phase_t phase("sample_subgraphs", handle.get_stream_view());
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(sampler != subgraph_sampler_t::random_walk || walk_length >= 1,
+                  "Invalid input argument: walk_length should be at least 1.");
+  CUGRAPH_EXPECTS(graph_view.get_number_of_vertices() > 0,
+                  "Invalid input argument: the input graph should have at least one vertex.");
+
+  auto num_draws = num_subgraphs * sample_size;
+
+  // the draws of a GPU use a disjoint range of the splitmix64 streams, so the sample depends only
+  // on (rng_seed, the GPU rank)
+
+  uint64_t stream_first{0};
+  if constexpr (multi_gpu) {
+    stream_first = static_cast<uint64_t>(handle.get_comms().get_rank()) << 48;
+  }
+
+  // 2. draw the vertices of each subgraph, as (subgraph ID, vertex) pairs
+
+  rmm::device_uvector<size_t> subgraph_ids(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> vertices(0, handle.get_stream());
+  if (sampler == subgraph_sampler_t::edge) {
+    std::tie(subgraph_ids, vertices) = draw_sampled_edge_endpoints(
+      handle, graph_view, num_draws, sample_size, rng_seed, stream_first);
+  } else {
+    rmm::device_uvector<vertex_t> roots(num_draws, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_draws),
+                      roots.begin(),
+                      draw_uniform_index_t<vertex_t>{
+                        rng_seed, stream_first, graph_view.get_number_of_vertices()});
+
+    auto num_vertices_per_draw =
+      sampler == subgraph_sampler_t::random_walk ? walk_length : size_t{1};
+    if (num_vertices_per_draw > 1) {
+      // the padded paths form a num_draws x walk_length matrix (in row major order) padded with
+      // the number of vertices (paths can stop early at vertices without out-edges)
+      std::tie(vertices, std::ignore, std::ignore) =
+        random_walks(handle,
+                     graph_view,
+                     roots.data(),
+                     static_cast<edge_t>(num_draws),
+                     static_cast<edge_t>(walk_length),
+                     true);
+    } else {
+      vertices = std::move(roots);
+    }
+
+    subgraph_ids.resize(vertices.size(), handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(subgraph_ids.size()),
+                      subgraph_ids.begin(),
+                      draw_to_subgraph_t{sample_size * num_vertices_per_draw});
+
+    if (num_vertices_per_draw > 1) {
+      auto pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(subgraph_ids.begin(), vertices.begin()));
+      auto num_pairs = static_cast<size_t>(thrust::distance(
+        pair_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          pair_first,
+                          pair_first + subgraph_ids.size(),
+                          is_padding_vertex_t<vertex_t>{graph_view.get_number_of_vertices()})));
+      subgraph_ids.resize(num_pairs, handle.get_stream());
+      vertices.resize(num_pairs, handle.get_stream());
+    }
+  }
+
+  // 3. sort & unique the vertices of each subgraph
+
+  {
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(subgraph_ids.begin(), vertices.begin()));
+    thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + subgraph_ids.size());
+    auto num_pairs = static_cast<size_t>(thrust::distance(
+      pair_first,
+      thrust::unique(handle.get_thrust_policy(), pair_first, pair_first + subgraph_ids.size())));
+    subgraph_ids.resize(num_pairs, handle.get_stream());
+    vertices.resize(num_pairs, handle.get_stream());
+    vertices.shrink_to_fit(handle.get_stream());
+  }
+
+  rmm::device_uvector<size_t> subgraph_vertex_offsets(num_subgraphs + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      subgraph_ids.begin(),
+                      subgraph_ids.end(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_subgraphs + 1),
+                      subgraph_vertex_offsets.begin());
+  subgraph_ids.resize(0, handle.get_stream());
+  subgraph_ids.shrink_to_fit(handle.get_stream());
+
+  // 4. extract the induced subgraphs (of all the GPUs together in multi-GPU)
+
+  auto [majors, minors, weights, subgraph_edge_offsets] =
+    extract_induced_subgraphs(handle,
+                              graph_view,
+                              subgraph_vertex_offsets.data(),
+                              vertices.data(),
+                              num_subgraphs);
+
+  // 5. relabel the edges to the subgraph local vertex IDs, the edges are grouped by subgraph and
+  // sorted by major within a subgraph, so the rows of the concatenated CSR are non-decreasing
+
+  rmm::device_uvector<size_t> rows(majors.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> indices(majors.size(), handle.get_stream());
+  auto edge_first = thrust::make_zip_iterator(
+    thrust::make_tuple(thrust::make_counting_iterator(size_t{0}), majors.begin(), minors.begin()));
+  thrust::transform(
+    handle.get_thrust_policy(),
+    edge_first,
+    edge_first + majors.size(),
+    thrust::make_zip_iterator(thrust::make_tuple(rows.begin(), indices.begin())),
+    to_subgraph_local_edge_t<vertex_t>{subgraph_edge_offsets.data(),
+                                       num_subgraphs,
+                                       subgraph_vertex_offsets.data(),
+                                       vertices.data()});
+  majors.resize(0, handle.get_stream());
+  majors.shrink_to_fit(handle.get_stream());
+  minors.resize(0, handle.get_stream());
+  minors.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<size_t> offsets(vertices.size() + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      rows.begin(),
+                      rows.end(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(vertices.size() + 1),
+                      offsets.begin());
+
+  return std::make_tuple(std::move(subgraph_vertex_offsets),
+                         std::move(vertices),
+                         std::move(offsets),
+                         std::move(indices),
+                         std::move(weights));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+sample_subgraphs(raft::handle_t const& handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                 subgraph_sampler_t sampler,
+                 size_t num_subgraphs,
+                 size_t sample_size,
+                 size_t walk_length,
+                 uint64_t rng_seed)
+{
+  return detail::sample_subgraphs(
+    handle, graph_view, sampler, num_subgraphs, sample_size, walk_length, rng_seed);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sampling/sample_subgraphs_impl.cuh>
+
+namespace cugraph {
+
+// MG instantiation
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>>
+sample_subgraphs(raft::handle_t const& handle,
+                 graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+                 subgraph_sampler_t sampler,
+                 size_t num_subgraphs,
+                 size_t sample_size,
+                 size_t walk_length,
+                 uint64_t rng_seed);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>>
+sample_subgraphs(raft::handle_t const& handle,
+                 graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+                 subgraph_sampler_t sampler,
+                 size_t num_subgraphs,
+                 size_t sample_size,
+                 size_t walk_length,
+                 uint64_t rng_seed);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<float>>>
+sample_subgraphs(raft::handle_t const& handle,
+                 graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+                 subgraph_sampler_t sampler,
+                 size_t num_subgraphs,
+                 size_t sample_size,
+                 size_t walk_length,
+                 uint64_t rng_seed);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>>
+sample_subgraphs(raft::handle_t const& handle,
+                 graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+                 subgraph_sampler_t sampler,
+                 size_t num_subgraphs,
+                 size_t sample_size,
+                 size_t walk_length,
+                 uint64_t rng_seed);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>>
+sample_subgraphs(raft::handle_t const& handle,
+                 graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+                 subgraph_sampler_t sampler,
+                 size_t num_subgraphs,
+                 size_t sample_size,
+                 size_t walk_length,
+                 uint64_t rng_seed);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<double>>>
+sample_subgraphs(raft::handle_t const& handle,
+                 graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+                 subgraph_sampler_t sampler,
+                 size_t num_subgraphs,
+                 size_t sample_size,
+                 size_t walk_length,
+                 uint64_t rng_seed);
+#endif
+
+}  // namespace cugraph
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/serialization/checkpoint.hpp>
+#include <cugraph/serialization/serializer.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <tuple>
+
+namespace cugraph {
+namespace detail {
+
+// algorithm tags of the checkpoint files (so a checkpoint is never resumed by another algorithm)
+constexpr uint64_t pagerank_checkpoint_tag{1};
+constexpr uint64_t louvain_checkpoint_tag{2};
+constexpr uint64_t weakly_connected_components_checkpoint_tag{3};
+
+inline void check_checkpoint_params(checkpoint_params_t const& checkpoint_params)
+{
+  CUGRAPH_EXPECTS(!checkpoint_params.path_prefix.empty(),
+                  "Invalid input argument: checkpoint_params.path_prefix should not be empty.");
+  CUGRAPH_EXPECTS(checkpoint_params.interval > 0,
+                  "Invalid input argument: checkpoint_params.interval should be positive.");
+}
+
+template <bool multi_gpu>
+std::string get_checkpoint_file_path(raft::handle_t const& handle,
+                                     checkpoint_params_t const& checkpoint_params)
+{
+  int rank{0};
+  if constexpr (multi_gpu) { rank = handle.get_comms().get_rank(); }
+  return checkpoint_params.path_prefix + "." + std::to_string(rank);
+}
+
+// Each rank writes its checkpoint to a temporary file and replaces the previous checkpoint (by
+// renaming) only after every rank has finished writing. A failure before the renames leaves the
+// previous checkpoint in every rank's file, and a failure in the middle of the renames leaves the
+// new checkpoint in either the file or the temporary file of every rank, so read_checkpoint() below
+// always finds a checkpoint with the same sequence number in every rank (sequence_number should be
+// positive and increase with the algorithm's progress).
+template <bool multi_gpu>
+void write_checkpoint(raft::handle_t const& handle,
+                      checkpoint_params_t const& checkpoint_params,
+                      uint64_t algorithm_tag,
+                      uint64_t sequence_number,
+                      serializer::serializer_t const& ser,
+                      size_t sz_bytes)
+{
+  auto file_path     = get_checkpoint_file_path<multi_gpu>(handle, checkpoint_params);
+  auto tmp_file_path = file_path + ".tmp";
+
+  serializer::serializer_t::write_checkpoint(
+    handle, tmp_file_path, algorithm_tag, sequence_number, ser.get_storage(), sz_bytes);
+  if constexpr (multi_gpu) { handle.get_comms().barrier(); }
+  CUGRAPH_EXPECTS(std::rename(tmp_file_path.c_str(), file_path.c_str()) == 0,
+                  "Failed to rename %s.",
+                  tmp_file_path.c_str());
+  if constexpr (multi_gpu) { handle.get_comms().barrier(); }
+}
+
+// returns the sequence number and the payload of the last checkpoint completed by every rank, or
+// std::nullopt if there is none
+template <bool multi_gpu>
+std::optional<std::tuple<uint64_t, rmm::device_uvector<serializer::serializer_t::byte_t>>>
+read_checkpoint(raft::handle_t const& handle,
+                checkpoint_params_t const& checkpoint_params,
+                uint64_t algorithm_tag)
+{
+  auto file_path     = get_checkpoint_file_path<multi_gpu>(handle, checkpoint_params);
+  auto tmp_file_path = file_path + ".tmp";
+
+  auto sequence_number =
+    serializer::serializer_t::read_checkpoint_sequence_number(file_path, algorithm_tag);
+  auto tmp_sequence_number =
+    serializer::serializer_t::read_checkpoint_sequence_number(tmp_file_path, algorithm_tag);
+
+  // a rank's temporary file may hold a complete checkpoint not yet written by (or truncated in)
+  // the other ranks, so resume from the minimum (over the ranks) of the last complete checkpoint
+  auto last_sequence_number =
+    std::max(sequence_number.value_or(uint64_t{0}), tmp_sequence_number.value_or(uint64_t{0}));
+  if constexpr (multi_gpu) {
+    last_sequence_number = host_scalar_allreduce(handle.get_comms(),
+                                                 last_sequence_number,
+                                                 raft::comms::op_t::MIN,
+                                                 handle.get_stream());
+  }
+  if (last_sequence_number == 0) { return std::nullopt; }
+
+  std::optional<std::string> path{std::nullopt};
+  if (sequence_number && (*sequence_number == last_sequence_number)) {
+    path = file_path;
+  } else if (tmp_sequence_number && (*tmp_sequence_number == last_sequence_number)) {
+    path = tmp_file_path;
+  }
+  auto num_missing = path ? int{0} : int{1};
+  if constexpr (multi_gpu) {
+    num_missing = host_scalar_allreduce(
+      handle.get_comms(), num_missing, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  CUGRAPH_EXPECTS(num_missing == 0,
+                  "Invalid input argument: inconsistent checkpoint files (%s.*), some ranks do not "
+                  "have the checkpoint the other ranks resume from.",
+                  checkpoint_params.path_prefix.c_str());
+
+  auto ret = serializer::serializer_t::read_checkpoint(handle, *path, algorithm_tag);
+  CUGRAPH_EXPECTS(ret.has_value(), "Failed to read %s.", (*path).c_str());
+  return ret;
+}
+
+// checks (in every rank) that a checkpoint matches the input (e.g. the local vertex counts), and
+// fails in every rank (instead of failing in some ranks and hanging in the others) if not
+template <bool multi_gpu>
+void check_checkpoint_consistency(raft::handle_t const& handle, bool consistent)
+{
+  auto num_inconsistent = consistent ? int{0} : int{1};
+  if constexpr (multi_gpu) {
+    num_inconsistent = host_scalar_allreduce(
+      handle.get_comms(), num_inconsistent, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  CUGRAPH_EXPECTS(num_inconsistent == 0,
+                  "Invalid input argument: the checkpoint does not match the input graph.");
+}
+
+}  // namespace detail
+}  // namespace cugraph
@@ -19,17 +19,226 @@
 
 #include <cugraph/serialization/serializer.hpp>
 
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
 #include <utilities/graph_utils.cuh>
 
 #include <raft/device_atomics.cuh>
 
 #include <thrust/copy.h>
-
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <tuple>
 #include <type_traits>
 
 namespace cugraph {
 namespace serializer {
 
+namespace {
+
+constexpr uint64_t graph_file_magic{0x48505247'47554343};  // "CCUGGRPH"
+constexpr uint32_t graph_file_version{1};
+
+// staging buffer size for host (memory-mapped file) to device copies
+constexpr size_t graph_file_staging_buffer_size{size_t{1} << 26};
+
+struct graph_file_header_t {
+  uint64_t magic{graph_file_magic};
+  uint32_t version{graph_file_version};
+  uint8_t vertex_sz{0};
+  uint8_t edge_sz{0};
+  uint8_t weight_sz{0};
+  uint8_t is_weighted{0};
+  uint64_t num_vertices{0};
+  uint64_t num_edges{0};
+  uint8_t is_symmetric{0};
+  uint8_t is_multigraph{0};
+  uint8_t padding[6]{};
+  uint64_t num_segment_offsets{0};
+};
+
+size_t round_up_to_graph_file_alignment(size_t offset)
+{
+  return ((offset + graph_file_alignment - 1) / graph_file_alignment) * graph_file_alignment;
+}
+
+// section offsets (in bytes, from the beginning of the file) of the segment offsets, offsets,
+// indices, and weights, and the file size
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::array<size_t, 5> compute_graph_file_section_offsets(graph_file_header_t const& header)
+{
+  std::array<size_t, 5> ret{};
+  ret[0] = sizeof(graph_file_header_t);
+  ret[1] =
+    round_up_to_graph_file_alignment(ret[0] + header.num_segment_offsets * sizeof(vertex_t));
+  ret[2] = round_up_to_graph_file_alignment(ret[1] + (header.num_vertices + 1) * sizeof(edge_t));
+  ret[3] = round_up_to_graph_file_alignment(ret[2] + header.num_edges * sizeof(vertex_t));
+  ret[4] = ret[3] + (header.is_weighted ? header.num_edges * sizeof(weight_t) : size_t{0});
+  return ret;
+}
+
+void write_padding(std::ofstream& ofs, size_t size)
+{
+  std::vector<char> zeros(size, char{0});
+  ofs.write(zeros.data(), zeros.size());
+}
+
+template <typename value_t>
+void write_device_array(raft::handle_t const& handle,
+                        std::ofstream& ofs,
+                        value_t const* d_array,
+                        size_t size)
+{
+  std::vector<value_t> h_buffer(
+    std::min(size, std::max(graph_file_staging_buffer_size / sizeof(value_t), size_t{1})));
+  for (size_t i = 0; i < size; i += h_buffer.size()) {
+    auto block_size = std::min(h_buffer.size(), size - i);
+    raft::update_host(h_buffer.data(), d_array + i, block_size, handle.get_stream());
+    handle.get_stream_view().synchronize();
+    ofs.write(reinterpret_cast<char const*>(h_buffer.data()), block_size * sizeof(value_t));
+  }
+}
+
+constexpr uint64_t checkpoint_file_magic{0x54504B43'47554343};  // "CCUGCKPT"
+constexpr uint32_t checkpoint_file_version{1};
+
+struct checkpoint_file_header_t {
+  uint64_t magic{checkpoint_file_magic};
+  uint32_t version{checkpoint_file_version};
+  uint8_t padding[4]{};
+  uint64_t algorithm_tag{0};
+  uint64_t sequence_number{0};
+  uint64_t payload_sz{0};
+};
+
+// returns std::nullopt if the file does not exist, is not a checkpoint of algorithm_tag, or is
+// truncated
+std::optional<checkpoint_file_header_t> read_checkpoint_file_header(std::ifstream& ifs,
+                                                                    uint64_t algorithm_tag)
+{
+  if (!ifs.is_open()) { return std::nullopt; }
+
+  checkpoint_file_header_t header{};
+  ifs.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!ifs || (header.magic != checkpoint_file_magic) ||
+      (header.version != checkpoint_file_version) || (header.algorithm_tag != algorithm_tag)) {
+    return std::nullopt;
+  }
+
+  ifs.seekg(0, std::ios::end);
+  auto file_sz = static_cast<size_t>(ifs.tellg());
+  if (file_sz != sizeof(header) + header.payload_sz) { return std::nullopt; }
+  ifs.seekg(sizeof(header), std::ios::beg);
+
+  return header;
+}
+
+template <typename T>
+using pinned_host_vector_t =
+  thrust::host_vector<T, thrust::system::cuda::experimental::pinned_allocator<T>>;
+
+// read-only memory-mapping of a file, un-mapped on destruction
+class mapped_file_t {
+ public:
+  mapped_file_t(std::string const& file_path)
+  {
+    fd_ = open(file_path.c_str(), O_RDONLY);
+    CUGRAPH_EXPECTS(fd_ != -1, "Failed to open %s.", file_path.c_str());
+    struct stat st {
+    };
+    if (fstat(fd_, &st) != 0) {
+      close(fd_);
+      CUGRAPH_FAIL("Failed to stat %s.", file_path.c_str());
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+      auto ptr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+      if (ptr == MAP_FAILED) {
+        close(fd_);
+        CUGRAPH_FAIL("Failed to memory-map %s.", file_path.c_str());
+      }
+      data_ = static_cast<std::byte const*>(ptr);
+      madvise(const_cast<std::byte*>(data_), size_, MADV_SEQUENTIAL | MADV_WILLNEED);
+    }
+  }
+
+  mapped_file_t(mapped_file_t const&) = delete;
+  mapped_file_t& operator=(mapped_file_t const&) = delete;
+
+  ~mapped_file_t()
+  {
+    if (data_ != nullptr) { munmap(const_cast<std::byte*>(data_), size_); }
+    close(fd_);
+  }
+
+  std::byte const* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  int fd_{-1};
+  std::byte const* data_{nullptr};
+  size_t size_{0};
+};
+
+// copy a memory-mapped array to device memory; staged through two pinned host buffers so page
+// faults on the mapping (i.e. file reads) for the next block overlap the host to device copy of the
+// current block
+template <typename value_t>
+rmm::device_uvector<value_t> read_device_array(raft::handle_t const& handle,
+                                               std::byte const* h_mapped_array,
+                                               size_t size)
+{
+  rmm::device_uvector<value_t> d_array(size, handle.get_stream());
+
+  auto block_size = std::min(size * sizeof(value_t), graph_file_staging_buffer_size);
+  std::array<pinned_host_vector_t<std::byte>, 2> h_staging_buffers{};
+  std::array<cudaEvent_t, 2> copy_events{};
+  for (size_t i = 0; i < h_staging_buffers.size(); ++i) {
+    h_staging_buffers[i].resize(block_size);
+    CUDA_TRY(cudaEventCreateWithFlags(&copy_events[i], cudaEventDisableTiming));
+  }
+
+  auto d_bytes    = reinterpret_cast<std::byte*>(d_array.data());
+  auto size_bytes = size * sizeof(value_t);
+  size_t block_idx{0};
+  for (size_t i = 0; i < size_bytes; i += block_size) {
+    auto& h_buffer = h_staging_buffers[block_idx % 2];
+    auto& event    = copy_events[block_idx % 2];
+    auto this_size = std::min(block_size, size_bytes - i);
+    CUDA_TRY(cudaEventSynchronize(event));  // wait till the previous copy from h_buffer finishes
+    std::memcpy(h_buffer.data(), h_mapped_array + i, this_size);
+    raft::update_device(d_bytes + i, h_buffer.data(), this_size, handle.get_stream());
+    CUDA_TRY(cudaEventRecord(event, handle.get_stream()));
+    ++block_idx;
+  }
+  handle.get_stream_view().synchronize();
+
+  for (size_t i = 0; i < copy_events.size(); ++i) {
+    CUDA_TRY(cudaEventDestroy(copy_events[i]));
+  }
+
+  return d_array;
+}
+
+}  // namespace
+
 template <typename value_t>
 void serializer_t::serialize(value_t val)
 {
@@ -79,6 +288,35 @@ rmm::device_uvector<value_t> serializer_t::unserialize(size_t size)
   return d_dest;
 }
 
+template <typename value_t>
+void serializer_t::serialize_host_vector(std::vector<value_t> const& vec)
+{
+  auto byte_buff_sz = vec.size() * sizeof(value_t);
+  auto it_end       = begin_ + byte_buff_sz;
+
+  if (byte_buff_sz > 0) {
+    raft::update_device(
+      begin_, reinterpret_cast<byte_t const*>(vec.data()), byte_buff_sz, handle_.get_stream());
+  }
+
+  begin_ = it_end;
+}
+
+template <typename value_t>
+std::vector<value_t> serializer_t::unserialize_host_vector(size_t size)
+{
+  std::vector<value_t> vec(size);
+
+  if (size > 0) {
+    raft::update_host(
+      vec.data(), reinterpret_cast<value_t const*>(cbegin_), size, handle_.get_stream());
+    handle_.get_stream_view().synchronize();
+  }
+
+  cbegin_ += size * sizeof(value_t);
+  return vec;
+}
+
 // serialization of graph metadata, via device orchestration:
 //
 template <typename graph_t>
@@ -111,7 +349,49 @@ void serializer_t::serialize(serializer_t::graph_meta_t<graph_t> const& gmeta)
     }
 
   } else {
-    CUGRAPH_FAIL("Unsupported graph type for serialization.");
+    using bool_t = typename graph_meta_t<graph_t>::bool_ser_t;
+    using int_t  = typename graph_meta_t<graph_t>::int_ser_t;
+
+    serialize(gmeta.num_vertices_);
+    serialize(gmeta.num_edges_);
+    serialize(gmeta.segment_offsets_ ? (*(gmeta.segment_offsets_)).size() : size_t{0});
+    serialize(gmeta.num_local_sorted_unique_edge_rows_
+                ? *(gmeta.num_local_sorted_unique_edge_rows_)
+                : size_t{0});
+    serialize(gmeta.local_sorted_unique_edge_row_offsets_
+                ? (*(gmeta.local_sorted_unique_edge_row_offsets_)).size()
+                : size_t{0});
+    serialize(gmeta.num_local_sorted_unique_edge_cols_
+                ? *(gmeta.num_local_sorted_unique_edge_cols_)
+                : size_t{0});
+    serialize(gmeta.local_sorted_unique_edge_col_offsets_
+                ? (*(gmeta.local_sorted_unique_edge_col_offsets_)).size()
+                : size_t{0});
+
+    serialize(static_cast<bool_t>(gmeta.properties_.is_symmetric));
+    serialize(static_cast<bool_t>(gmeta.properties_.is_multigraph));
+    serialize(static_cast<bool_t>(gmeta.is_weighted_));
+    serialize(static_cast<bool_t>(gmeta.dcs_nzd_vertex_counts_.has_value()));
+    serialize(static_cast<bool_t>(gmeta.use_compressed_indices_));
+    serialize(static_cast<bool_t>(gmeta.num_local_sorted_unique_edge_rows_.has_value()));
+    serialize(static_cast<bool_t>(gmeta.num_local_sorted_unique_edge_cols_.has_value()));
+
+    serialize(static_cast<int_t>(gmeta.row_comm_size_));
+    serialize(static_cast<int_t>(gmeta.col_comm_size_));
+    serialize(static_cast<int_t>(gmeta.row_comm_rank_));
+    serialize(static_cast<int_t>(gmeta.col_comm_rank_));
+
+    serialize_host_vector(gmeta.vertex_partition_offsets_);
+    serialize_host_vector(gmeta.offsets_sizes_);
+    serialize_host_vector(gmeta.edge_counts_);
+    if (gmeta.dcs_nzd_vertex_counts_) { serialize_host_vector(*(gmeta.dcs_nzd_vertex_counts_)); }
+    if (gmeta.segment_offsets_) { serialize_host_vector(*(gmeta.segment_offsets_)); }
+    if (gmeta.local_sorted_unique_edge_row_offsets_) {
+      serialize_host_vector(*(gmeta.local_sorted_unique_edge_row_offsets_));
+    }
+    if (gmeta.local_sorted_unique_edge_col_offsets_) {
+      serialize_host_vector(*(gmeta.local_sorted_unique_edge_col_offsets_));
+    }
   }
 }
 
@@ -159,48 +439,272 @@ serializer_t::graph_meta_t<graph_t> serializer_t::unserialize(
       num_vertices, num_edges, properties, static_cast<bool>(is_weighted), segment_offsets};
 
   } else {
-    CUGRAPH_FAIL("Unsupported graph type for unserialization.");
-    return graph_meta_t<graph_t>{};
+    using bool_t = typename graph_meta_t<graph_t>::bool_ser_t;
+    using int_t  = typename graph_meta_t<graph_t>::int_ser_t;
+
+    CUGRAPH_EXPECTS(
+      graph_meta_sz_bytes >= 7 * sizeof(size_t) + 7 * sizeof(bool_t) + 4 * sizeof(int_t),
+      "Un/serialization meta size mismatch.");
+
+    graph_meta_t<graph_t> gmeta{};
+
+    gmeta.num_vertices_                           = unserialize<size_t>();
+    gmeta.num_edges_                              = unserialize<size_t>();
+    auto num_segment_offsets                      = unserialize<size_t>();
+    auto num_local_sorted_unique_edge_rows        = unserialize<size_t>();
+    auto num_local_sorted_unique_edge_row_offsets = unserialize<size_t>();
+    auto num_local_sorted_unique_edge_cols        = unserialize<size_t>();
+    auto num_local_sorted_unique_edge_col_offsets = unserialize<size_t>();
+
+    bool_t is_symmetric           = unserialize<bool_t>();
+    bool_t is_multigraph          = unserialize<bool_t>();
+    bool_t is_weighted            = unserialize<bool_t>();
+    bool_t use_dcs                = unserialize<bool_t>();
+    bool_t use_compressed_indices = unserialize<bool_t>();
+    bool_t has_unique_edge_rows   = unserialize<bool_t>();
+    bool_t has_unique_edge_cols   = unserialize<bool_t>();
+
+    gmeta.properties_ =
+      graph_properties_t{static_cast<bool>(is_symmetric), static_cast<bool>(is_multigraph)};
+    gmeta.is_weighted_            = static_cast<bool>(is_weighted);
+    gmeta.use_compressed_indices_ = static_cast<bool>(use_compressed_indices);
+
+    gmeta.row_comm_size_ = unserialize<int_t>();
+    gmeta.col_comm_size_ = unserialize<int_t>();
+    gmeta.row_comm_rank_ = unserialize<int_t>();
+    gmeta.col_comm_rank_ = unserialize<int_t>();
+
+    CUGRAPH_EXPECTS((gmeta.row_comm_size_ > 0) && (gmeta.col_comm_size_ > 0),
+                    "Un/serialization meta corrupted.");
+    auto num_partitions = static_cast<size_t>(gmeta.col_comm_size_);
+
+    gmeta.vertex_partition_offsets_ = unserialize_host_vector<vertex_t>(
+      static_cast<size_t>(gmeta.row_comm_size_) * num_partitions + 1);
+    gmeta.offsets_sizes_ = unserialize_host_vector<size_t>(num_partitions);
+    gmeta.edge_counts_   = unserialize_host_vector<size_t>(num_partitions);
+    if (use_dcs) {
+      gmeta.dcs_nzd_vertex_counts_ = unserialize_host_vector<vertex_t>(num_partitions);
+    }
+    if (num_segment_offsets > 0) {
+      gmeta.segment_offsets_ = unserialize_host_vector<vertex_t>(num_segment_offsets);
+    }
+    if (has_unique_edge_rows) {
+      gmeta.num_local_sorted_unique_edge_rows_ = num_local_sorted_unique_edge_rows;
+      gmeta.local_sorted_unique_edge_row_offsets_ =
+        unserialize_host_vector<vertex_t>(num_local_sorted_unique_edge_row_offsets);
+    }
+    if (has_unique_edge_cols) {
+      gmeta.num_local_sorted_unique_edge_cols_ = num_local_sorted_unique_edge_cols;
+      gmeta.local_sorted_unique_edge_col_offsets_ =
+        unserialize_host_vector<vertex_t>(num_local_sorted_unique_edge_col_offsets);
+    }
+
+    CUGRAPH_EXPECTS(gmeta.get_device_sz_bytes() == graph_meta_sz_bytes,
+                    "Un/serialization meta size mismatch.");
+
+    return gmeta;
   }
 }
 
-// graph serialization:
-// metadata argument (gvmeta) can be used for checking / testing;
+// device arrays of a graph in the serialization order (following the graph metadata):
 //
 template <typename graph_t>
-void serializer_t::serialize(graph_t const& graph, serializer_t::graph_meta_t<graph_t>& gvmeta)
+std::vector<std::tuple<serializer_t::byte_t const*, size_t>>
+serializer_t::get_device_graph_segments(graph_t const& graph)
 {
-  using vertex_t = typename graph_t::vertex_type;
-  using edge_t   = typename graph_t::edge_type;
-  using weight_t = typename graph_t::weight_type;
+  CUGRAPH_EXPECTS(!graph.has_deleted_edges(),
+                  "Invalid input argument: graph has deleted edges, call compact_edges() first.");
+
+  std::vector<std::tuple<byte_t const*, size_t>> segments{};
+  auto add_segment = [&segments](auto const* ptr, size_t size) {
+    segments.emplace_back(reinterpret_cast<byte_t const*>(ptr), size * sizeof(*ptr));
+  };
 
   if constexpr (!graph_t::is_multi_gpu) {
+    CUGRAPH_EXPECTS(!graph.use_dcs(),
+                    "Invalid input argument: serializing graphs in the hypersparse format is not "
+                    "supported yet.");
+    CUGRAPH_EXPECTS(!graph.has_packed_minors(),
+                    "Invalid input argument: graph has bit-packed minors, call unpack_minors() "
+                    "first.");
+
     size_t num_vertices = graph.get_number_of_vertices();
     size_t num_edges    = graph.get_number_of_edges();
     auto&& gview        = graph.view();
 
-    gvmeta = graph_meta_t<graph_t>{graph};
-
     auto offsets = gview.get_matrix_partition_view().get_offsets();
     auto indices = gview.get_matrix_partition_view().get_indices();
     auto weights = gview.get_matrix_partition_view().get_weights();
 
-    // FIXME: remove when host_bcast() becomes available for vectors;
-    //
-    // for now, this must come first, because unserialize()
-    // needs it at the beginning to extract graph metadata
-    // to be able to finish the rest of the graph unserialization;
-    //
-    serialize(gvmeta);
+    add_segment(offsets, num_vertices + 1);
+    add_segment(indices, num_edges);
 
-    serialize(offsets, num_vertices + 1);
-    serialize(indices, num_edges);
-
-    if (weights) serialize(*weights, num_edges);
+    if (weights) add_segment(*weights, num_edges);
 
   } else {
-    CUGRAPH_FAIL("Unsupported graph type for serialization.");
+    auto gview = graph.view();
+
+    for (size_t i = 0; i < graph.adj_matrix_partition_offsets_.size(); ++i) {
+      size_t num_edges = gview.get_number_of_local_adj_matrix_partition_edges(i);
+      add_segment(graph.adj_matrix_partition_offsets_[i].data(),
+                  graph.adj_matrix_partition_offsets_[i].size());
+      if (graph.adj_matrix_partition_compressed_indices_) {
+        add_segment((*(graph.adj_matrix_partition_compressed_indices_))[i].data(), num_edges);
+      } else {
+        add_segment(graph.adj_matrix_partition_indices_[i].data(), num_edges);
+      }
+      if (graph.adj_matrix_partition_weights_) {
+        add_segment((*(graph.adj_matrix_partition_weights_))[i].data(), num_edges);
+      }
+      if (graph.adj_matrix_partition_dcs_nzd_vertices_) {
+        add_segment((*(graph.adj_matrix_partition_dcs_nzd_vertices_))[i].data(),
+                    (*(graph.adj_matrix_partition_dcs_nzd_vertices_))[i].size());
+      }
+    }
+    if (graph.local_sorted_unique_edge_rows_) {
+      add_segment((*(graph.local_sorted_unique_edge_rows_)).data(),
+                  (*(graph.local_sorted_unique_edge_rows_)).size());
+    }
+    if (graph.local_sorted_unique_edge_cols_) {
+      add_segment((*(graph.local_sorted_unique_edge_cols_)).data(),
+                  (*(graph.local_sorted_unique_edge_cols_)).size());
+    }
+  }
+
+  return segments;
+}
+
+// graph metadata serialized into a (small) device buffer:
+//
+template <typename graph_t>
+rmm::device_uvector<serializer_t::byte_t> serializer_t::serialize_graph_meta(
+  raft::handle_t const& handle, serializer_t::graph_meta_t<graph_t> const& gmeta)
+{
+  serializer_t ser(handle, gmeta.get_device_sz_bytes());
+  ser.serialize(gmeta);
+  return std::move(ser.d_storage_);
+}
+
+// graph serialization:
+// metadata argument (gvmeta) can be used for checking / testing;
+//
+template <typename graph_t>
+void serializer_t::serialize(graph_t const& graph, serializer_t::graph_meta_t<graph_t>& gvmeta)
+{
+  gvmeta = graph_meta_t<graph_t>{graph};
+
+  // FIXME: remove when host_bcast() becomes available for vectors;
+  //
+  // for now, this must come first, because unserialize()
+  // needs it at the beginning to extract graph metadata
+  // to be able to finish the rest of the graph unserialization;
+  //
+  serialize(gvmeta);
+
+  for (auto [ptr, sz_bytes] : get_device_graph_segments(graph)) {
+    serialize(ptr, sz_bytes);
+  }
+}
+
+// stream-ordered graph serialization to host memory:
+//
+template <typename graph_t>
+void serializer_t::serialize_to_host(raft::handle_t const& handle,
+                                     graph_t const& graph,
+                                     byte_t* h_storage,
+                                     serializer_t::graph_meta_t<graph_t>& gvmeta)
+{
+  gvmeta = graph_meta_t<graph_t>{graph};
+
+  // device memory deallocation is stream-ordered, so d_meta can go out of scope before the copy
+  // completes
+  auto d_meta = serialize_graph_meta(handle, gvmeta);
+  raft::update_host(h_storage, d_meta.data(), d_meta.size(), handle.get_stream());
+  h_storage += d_meta.size();
+
+  for (auto [ptr, sz_bytes] : get_device_graph_segments(graph)) {
+    raft::update_host(h_storage, ptr, sz_bytes, handle.get_stream());
+    h_storage += sz_bytes;
+  }
+}
+
+// pipelined graph serialization to a file descriptor:
+//
+template <typename graph_t>
+void serializer_t::serialize_to_fd(raft::handle_t const& handle,
+                                   graph_t const& graph,
+                                   int fd,
+                                   serializer_t::graph_meta_t<graph_t>& gvmeta,
+                                   size_t chunk_sz_bytes)
+{
+  CUGRAPH_EXPECTS(chunk_sz_bytes > 0, "Invalid input argument: chunk_sz_bytes should be positive.");
+
+  gvmeta = graph_meta_t<graph_t>{graph};
+
+  auto d_meta   = serialize_graph_meta(handle, gvmeta);
+  auto segments = get_device_graph_segments(graph);
+  segments.insert(segments.begin(), std::make_tuple(d_meta.data(), d_meta.size()));
+
+  size_t total_sz_bytes{0};
+  for (auto [ptr, sz_bytes] : segments) {
+    total_sz_bytes += sz_bytes;
+  }
+  chunk_sz_bytes = std::min(chunk_sz_bytes, std::max(total_sz_bytes, size_t{1}));
+
+  // double buffering: the device to host copy of the next chunk overlaps the write of the current
+  // chunk
+
+  std::array<pinned_host_vector_t<byte_t>, 2> h_staging_buffers{};
+  std::array<cudaEvent_t, 2> copy_events{};
+  for (size_t i = 0; i < h_staging_buffers.size(); ++i) {
+    h_staging_buffers[i].resize(chunk_sz_bytes);
+    CUDA_TRY(cudaEventCreateWithFlags(&copy_events[i], cudaEventDisableTiming));
+  }
+
+  auto write_chunk = [fd](byte_t const* h_chunk, size_t sz_bytes) {
+    while (sz_bytes > 0) {
+      auto ret = write(fd, h_chunk, sz_bytes);
+      if ((ret == -1) && (errno == EINTR)) { continue; }
+      CUGRAPH_EXPECTS(ret > 0, "Failed to write to the file descriptor (errno=%d).", errno);
+      h_chunk += ret;
+      sz_bytes -= static_cast<size_t>(ret);
+    }
+  };
+
+  std::array<size_t, 2> chunk_sizes{0, 0};
+  size_t chunk_idx{0};
+  std::exception_ptr error{};  // release the staging resources before re-throwing
+  try {
+    for (auto [ptr, sz_bytes] : segments) {
+      for (size_t i = 0; i < sz_bytes; i += chunk_sz_bytes) {
+        auto this_sz_bytes = std::min(chunk_sz_bytes, sz_bytes - i);
+        auto buffer_idx    = chunk_idx % 2;
+        raft::update_host(
+          h_staging_buffers[buffer_idx].data(), ptr + i, this_sz_bytes, handle.get_stream());
+        CUDA_TRY(cudaEventRecord(copy_events[buffer_idx], handle.get_stream()));
+        chunk_sizes[buffer_idx] = this_sz_bytes;
+        if (chunk_idx > 0) {
+          auto prev_buffer_idx = (chunk_idx - 1) % 2;
+          CUDA_TRY(cudaEventSynchronize(copy_events[prev_buffer_idx]));
+          write_chunk(h_staging_buffers[prev_buffer_idx].data(), chunk_sizes[prev_buffer_idx]);
+        }
+        ++chunk_idx;
+      }
+    }
+    if (chunk_idx > 0) {
+      auto last_buffer_idx = (chunk_idx - 1) % 2;
+      CUDA_TRY(cudaEventSynchronize(copy_events[last_buffer_idx]));
+      write_chunk(h_staging_buffers[last_buffer_idx].data(), chunk_sizes[last_buffer_idx]);
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  handle.get_stream_view().synchronize();
+  for (size_t i = 0; i < copy_events.size(); ++i) {
+    CUDA_TRY(cudaEventDestroy(copy_events[i]));
   }
+  if (error) { std::rethrow_exception(error); }
 }
 
 // graph unserialization:
@@ -247,14 +751,403 @@ graph_t serializer_t::unserialize(size_t device_sz_bytes, size_t host_sz_bytes)
       is_weighted ? std::optional<rmm::device_uvector<weight_t>>{unserialize<weight_t>(num_edges)}
                   : std::nullopt,
       std::move(seg_offsets));  // RVO-ed
+  } else {
+    graph_meta_t<graph_t> empty_meta{};  // tag-dispatching only
+
+    // FIXME: remove when host_bcast() becomes available for vectors;
+    //
+    // for now, this must come first (see the single-GPU path above);
+    //
+    auto gvmeta = unserialize(host_sz_bytes, empty_meta);
+
+    auto pair_sz = get_device_graph_sz_bytes(gvmeta);
+
+    CUGRAPH_EXPECTS((pair_sz.first == device_sz_bytes) && (pair_sz.second == host_sz_bytes),
+                    "Un/serialization size mismatch.");
+
+    // the graph is reloaded on the same rank layout, so no shuffling is necessary
+
+    auto& row_comm = handle_.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto& col_comm = handle_.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    CUGRAPH_EXPECTS((row_comm.get_size() == gvmeta.row_comm_size_) &&
+                      (col_comm.get_size() == gvmeta.col_comm_size_) &&
+                      (row_comm.get_rank() == gvmeta.row_comm_rank_) &&
+                      (col_comm.get_rank() == gvmeta.col_comm_rank_),
+                    "Unserialization rank layout mismatch: a multi-GPU graph should be "
+                    "unserialized on the same (row_comm_size, col_comm_size) grid and rank it was "
+                    "serialized on.");
+
+    partition_t<vertex_t> partition(gvmeta.vertex_partition_offsets_,
+                                    gvmeta.row_comm_size_,
+                                    gvmeta.col_comm_size_,
+                                    gvmeta.row_comm_rank_,
+                                    gvmeta.col_comm_rank_);
+
+    auto num_partitions = gvmeta.offsets_sizes_.size();
+    std::vector<rmm::device_uvector<edge_t>> offsets{};
+    std::vector<rmm::device_uvector<vertex_t>> indices{};
+    auto weights =
+      gvmeta.is_weighted_ ? std::make_optional<std::vector<rmm::device_uvector<weight_t>>>()
+                          : std::nullopt;
+    auto dcs_nzd_vertices =
+      gvmeta.dcs_nzd_vertex_counts_
+        ? std::make_optional<std::vector<rmm::device_uvector<vertex_t>>>()
+        : std::nullopt;
+    auto compressed_indices =
+      gvmeta.use_compressed_indices_
+        ? std::make_optional<std::vector<rmm::device_uvector<uint32_t>>>()
+        : std::nullopt;
+    offsets.reserve(num_partitions);
+    indices.reserve(num_partitions);
+    if (weights) { (*weights).reserve(num_partitions); }
+    if (dcs_nzd_vertices) { (*dcs_nzd_vertices).reserve(num_partitions); }
+    if (compressed_indices) { (*compressed_indices).reserve(num_partitions); }
+    for (size_t i = 0; i < num_partitions; ++i) {
+      auto num_edges = gvmeta.edge_counts_[i];
+      offsets.push_back(unserialize<edge_t>(gvmeta.offsets_sizes_[i]));
+      if (compressed_indices) {
+        (*compressed_indices).push_back(unserialize<uint32_t>(num_edges));
+        indices.push_back(rmm::device_uvector<vertex_t>(0, handle_.get_stream()));
+      } else {
+        indices.push_back(unserialize<vertex_t>(num_edges));
+      }
+      if (weights) { (*weights).push_back(unserialize<weight_t>(num_edges)); }
+      if (dcs_nzd_vertices) {
+        (*dcs_nzd_vertices)
+          .push_back(unserialize<vertex_t>((*(gvmeta.dcs_nzd_vertex_counts_))[i]));
+      }
+    }
+    auto local_sorted_unique_edge_rows =
+      gvmeta.num_local_sorted_unique_edge_rows_
+        ? std::make_optional<rmm::device_uvector<vertex_t>>(
+            unserialize<vertex_t>(*(gvmeta.num_local_sorted_unique_edge_rows_)))
+        : std::nullopt;
+    auto local_sorted_unique_edge_cols =
+      gvmeta.num_local_sorted_unique_edge_cols_
+        ? std::make_optional<rmm::device_uvector<vertex_t>>(
+            unserialize<vertex_t>(*(gvmeta.num_local_sorted_unique_edge_cols_)))
+        : std::nullopt;
+
+    return graph_t(handle_,
+                   static_cast<vertex_t>(gvmeta.num_vertices_),
+                   static_cast<edge_t>(gvmeta.num_edges_),
+                   gvmeta.properties_,
+                   partition,
+                   std::move(offsets),
+                   std::move(indices),
+                   std::move(weights),
+                   std::move(dcs_nzd_vertices),
+                   std::move(gvmeta.dcs_nzd_vertex_counts_),
+                   std::move(gvmeta.segment_offsets_),
+                   std::move(local_sorted_unique_edge_rows),
+                   std::move(local_sorted_unique_edge_cols),
+                   std::move(gvmeta.local_sorted_unique_edge_row_offsets_),
+                   std::move(gvmeta.local_sorted_unique_edge_col_offsets_),
+                   std::move(compressed_indices));  // RVO-ed
+  }
+}
+
+template <typename graph_t>
+void serializer_t::write_graph_to_file(raft::handle_t const& handle,
+                                       graph_t const& graph,
+                                       std::string const& file_path)
+{
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  CUGRAPH_EXPECTS(!graph.has_deleted_edges(),
+                  "Invalid input argument: graph has deleted edges, call compact_edges() first.");
+
+  if constexpr (!graph_t::is_multi_gpu) {
+    CUGRAPH_EXPECTS(!graph.use_dcs(),
+                    "Invalid input argument: serializing graphs in the hypersparse format is not "
+                    "supported yet.");
+    CUGRAPH_EXPECTS(!graph.has_packed_minors(),
+                    "Invalid input argument: graph has bit-packed minors, call unpack_minors() "
+                    "first.");
+
+    auto gview           = graph.view();
+    auto segment_offsets = gview.get_local_adj_matrix_partition_segment_offsets(0);
+
+    graph_file_header_t header{};
+    header.vertex_sz           = static_cast<uint8_t>(sizeof(vertex_t));
+    header.edge_sz             = static_cast<uint8_t>(sizeof(edge_t));
+    header.weight_sz           = static_cast<uint8_t>(sizeof(weight_t));
+    header.is_weighted         = static_cast<uint8_t>(graph.is_weighted());
+    header.num_vertices        = static_cast<uint64_t>(graph.get_number_of_vertices());
+    header.num_edges           = static_cast<uint64_t>(graph.get_number_of_edges());
+    header.is_symmetric        = static_cast<uint8_t>(graph.is_symmetric());
+    header.is_multigraph       = static_cast<uint8_t>(graph.is_multigraph());
+    header.num_segment_offsets = segment_offsets ? (*segment_offsets).size() : size_t{0};
+
+    auto section_offsets = compute_graph_file_section_offsets<vertex_t, edge_t, weight_t>(header);
+
+    std::ofstream ofs(file_path, std::ios::binary | std::ios::trunc);
+    CUGRAPH_EXPECTS(ofs.is_open(), "Failed to open %s.", file_path.c_str());
+
+    ofs.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    if (segment_offsets) {
+      ofs.write(reinterpret_cast<char const*>((*segment_offsets).data()),
+                (*segment_offsets).size() * sizeof(vertex_t));
+    }
+    write_padding(ofs, section_offsets[1] - static_cast<size_t>(ofs.tellp()));
+
+    auto matrix_partition = gview.get_matrix_partition_view();
+    write_device_array(handle, ofs, matrix_partition.get_offsets(), header.num_vertices + 1);
+    write_padding(ofs, section_offsets[2] - static_cast<size_t>(ofs.tellp()));
+    write_device_array(handle, ofs, matrix_partition.get_indices(), header.num_edges);
+    if (matrix_partition.get_weights()) {
+      write_padding(ofs, section_offsets[3] - static_cast<size_t>(ofs.tellp()));
+      write_device_array(handle, ofs, *(matrix_partition.get_weights()), header.num_edges);
+    }
+
+    ofs.close();
+    CUGRAPH_EXPECTS(!ofs.fail(), "Failed to write %s.", file_path.c_str());
+  } else {
+    CUGRAPH_FAIL("Unsupported graph type for serialization.");
+  }
+}
+
+template <typename graph_t>
+graph_t serializer_t::read_graph_from_file(raft::handle_t const& handle,
+                                           std::string const& file_path)
+{
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  if constexpr (!graph_t::is_multi_gpu) {
+    mapped_file_t mapped_file(file_path);
+
+    CUGRAPH_EXPECTS(mapped_file.size() >= sizeof(graph_file_header_t),
+                    "Invalid graph file: %s is too small.",
+                    file_path.c_str());
+    graph_file_header_t header{};
+    std::memcpy(&header, mapped_file.data(), sizeof(header));
+    CUGRAPH_EXPECTS(header.magic == graph_file_magic,
+                    "Invalid graph file: %s is not a graph file.",
+                    file_path.c_str());
+    CUGRAPH_EXPECTS(header.version == graph_file_version,
+                    "Invalid graph file: unsupported graph file version %u.",
+                    header.version);
+    CUGRAPH_EXPECTS((header.vertex_sz == sizeof(vertex_t)) && (header.edge_sz == sizeof(edge_t)) &&
+                      (header.weight_sz == sizeof(weight_t)),
+                    "Invalid template parameters: vertex_t, edge_t, and/or weight_t do not match "
+                    "the graph file.");
+    CUGRAPH_EXPECTS(
+      (header.num_vertices <= static_cast<uint64_t>(std::numeric_limits<vertex_t>::max())) &&
+        (header.num_edges <= static_cast<uint64_t>(std::numeric_limits<edge_t>::max())),
+      "Invalid graph file: number of vertices and/or edges overflow vertex_t and/or edge_t.");
+
+    auto section_offsets = compute_graph_file_section_offsets<vertex_t, edge_t, weight_t>(header);
+    CUGRAPH_EXPECTS(mapped_file.size() >= section_offsets[4],
+                    "Invalid graph file: %s is truncated.",
+                    file_path.c_str());
+
+    std::optional<std::vector<vertex_t>> segment_offsets{std::nullopt};
+    if (header.num_segment_offsets > 0) {
+      segment_offsets = std::vector<vertex_t>(header.num_segment_offsets);
+      std::memcpy((*segment_offsets).data(),
+                  mapped_file.data() + section_offsets[0],
+                  (*segment_offsets).size() * sizeof(vertex_t));
+    }
+
+    auto d_offsets = read_device_array<edge_t>(
+      handle, mapped_file.data() + section_offsets[1], header.num_vertices + 1);
+    auto d_indices = read_device_array<vertex_t>(
+      handle, mapped_file.data() + section_offsets[2], header.num_edges);
+    auto d_weights = header.is_weighted
+                       ? std::make_optional<rmm::device_uvector<weight_t>>(
+                           read_device_array<weight_t>(
+                             handle, mapped_file.data() + section_offsets[3], header.num_edges))
+                       : std::nullopt;
+
+    return graph_t(handle,
+                   static_cast<vertex_t>(header.num_vertices),
+                   static_cast<edge_t>(header.num_edges),
+                   graph_properties_t{static_cast<bool>(header.is_symmetric),
+                                      static_cast<bool>(header.is_multigraph)},
+                   std::move(d_offsets),
+                   std::move(d_indices),
+                   std::move(d_weights),
+                   std::move(segment_offsets));
   } else {
     CUGRAPH_FAIL("Unsupported graph type for unserialization.");
 
-    return graph_t{handle_};
+    return graph_t{handle};
+  }
+}
+
+// chunked graph broadcast:
+//
+template <typename graph_t>
+graph_t serializer_t::broadcast(raft::handle_t const& handle,
+                                graph_t* graph_ptr,
+                                int root,
+                                size_t chunk_sz_bytes)
+{
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  if constexpr (!graph_t::is_multi_gpu) {
+    CUGRAPH_EXPECTS(chunk_sz_bytes > 0,
+                    "Invalid input argument: chunk_sz_bytes should be positive.");
+
+    auto& comm   = handle.get_comms();
+    auto is_root = comm.get_rank() == root;
+    CUGRAPH_EXPECTS(!is_root || (graph_ptr != nullptr), "Cannot broadcast nullptr graph pointer.");
+
+    // 1. broadcast the graph metadata
+
+    auto gvmeta = is_root ? graph_meta_t<graph_t>{*graph_ptr} : graph_meta_t<graph_t>{};
+    auto meta_sz_bytes =
+      host_scalar_bcast(comm,
+                        is_root ? gvmeta.get_device_sz_bytes() : size_t{0},
+                        root,
+                        handle.get_stream());
+    auto d_meta = is_root ? serialize_graph_meta(handle, gvmeta)
+                          : rmm::device_uvector<byte_t>(meta_sz_bytes, handle.get_stream());
+    device_bcast(comm, d_meta.data(), d_meta.data(), meta_sz_bytes, root, handle.get_stream());
+    if (!is_root) {
+      serializer_t ser(handle, d_meta.data());
+      gvmeta = ser.unserialize(meta_sz_bytes, graph_meta_t<graph_t>{});
+    }
+
+    // 2. allocate the graph arrays on the non-root ranks
+
+    auto num_vertices = static_cast<vertex_t>(gvmeta.num_vertices_);
+    auto num_edges    = static_cast<edge_t>(gvmeta.num_edges_);
+
+    rmm::device_uvector<edge_t> offsets(is_root ? size_t{0} : static_cast<size_t>(num_vertices) + 1,
+                                        handle.get_stream());
+    rmm::device_uvector<vertex_t> indices(is_root ? edge_t{0} : num_edges, handle.get_stream());
+    auto weights = (!is_root && gvmeta.is_weighted_)
+                     ? std::make_optional<rmm::device_uvector<weight_t>>(num_edges,
+                                                                         handle.get_stream())
+                     : std::nullopt;
+
+    // 3. broadcast the graph arrays chunk by chunk (in-place on the root, straight into the arrays
+    // allocated above on the other ranks)
+
+    std::vector<std::tuple<byte_t const*, size_t>> segments{};
+    std::vector<byte_t*> output_firsts{};
+    if (is_root) {
+      segments = get_device_graph_segments(*graph_ptr);
+      output_firsts.resize(segments.size());
+      for (size_t i = 0; i < segments.size(); ++i) {
+        // the root owns the input graph and NCCL does not modify the root's buffer in an in-place
+        // broadcast
+        output_firsts[i] = const_cast<byte_t*>(std::get<0>(segments[i]));
+      }
+    } else {
+      auto add_segment = [&segments, &output_firsts](auto* ptr, size_t size) {
+        segments.emplace_back(reinterpret_cast<byte_t const*>(ptr), size * sizeof(*ptr));
+        output_firsts.push_back(reinterpret_cast<byte_t*>(ptr));
+      };
+      add_segment(offsets.data(), offsets.size());
+      add_segment(indices.data(), indices.size());
+      if (weights) { add_segment((*weights).data(), (*weights).size()); }
+    }
+
+    for (size_t i = 0; i < segments.size(); ++i) {
+      auto [input_first, sz_bytes] = segments[i];
+      for (size_t j = 0; j < sz_bytes; j += chunk_sz_bytes) {
+        device_bcast(comm,
+                     input_first + j,
+                     output_firsts[i] + j,
+                     std::min(chunk_sz_bytes, sz_bytes - j),
+                     root,
+                     handle.get_stream());
+      }
+    }
+
+    if (is_root) {
+      return std::move(*graph_ptr);
+    } else {
+      return graph_t(handle,
+                     num_vertices,
+                     num_edges,
+                     gvmeta.properties_,
+                     std::move(offsets),
+                     std::move(indices),
+                     std::move(weights),
+                     std::move(gvmeta.segment_offsets_));
+    }
+  } else {
+    CUGRAPH_FAIL("Unsupported graph type for broadcasting (a multi-GPU graph is already "
+                 "distributed over the ranks).");
+
+    return graph_t{handle};
+  }
+}
+
+void serializer_t::write_checkpoint(raft::handle_t const& handle,
+                                    std::string const& file_path,
+                                    uint64_t algorithm_tag,
+                                    uint64_t sequence_number,
+                                    byte_t const* d_payload,
+                                    size_t payload_sz_bytes)
+{
+  checkpoint_file_header_t header{};
+  header.algorithm_tag   = algorithm_tag;
+  header.sequence_number = sequence_number;
+  header.payload_sz      = static_cast<uint64_t>(payload_sz_bytes);
+
+  std::ofstream ofs(file_path, std::ios::binary | std::ios::trunc);
+  CUGRAPH_EXPECTS(ofs.is_open(), "Failed to open %s.", file_path.c_str());
+
+  ofs.write(reinterpret_cast<char const*>(&header), sizeof(header));
+  write_device_array(handle, ofs, d_payload, payload_sz_bytes);
+
+  ofs.close();
+  CUGRAPH_EXPECTS(!ofs.fail(), "Failed to write %s.", file_path.c_str());
+}
+
+std::optional<uint64_t> serializer_t::read_checkpoint_sequence_number(std::string const& file_path,
+                                                                      uint64_t algorithm_tag)
+{
+  std::ifstream ifs(file_path, std::ios::binary);
+  auto header = read_checkpoint_file_header(ifs, algorithm_tag);
+  return header ? std::optional<uint64_t>{(*header).sequence_number} : std::nullopt;
+}
+
+std::optional<std::tuple<uint64_t, rmm::device_uvector<serializer_t::byte_t>>>
+serializer_t::read_checkpoint(raft::handle_t const& handle,
+                              std::string const& file_path,
+                              uint64_t algorithm_tag)
+{
+  std::ifstream ifs(file_path, std::ios::binary);
+  auto header = read_checkpoint_file_header(ifs, algorithm_tag);
+  if (!header) { return std::nullopt; }
+
+  rmm::device_uvector<byte_t> d_payload((*header).payload_sz, handle.get_stream());
+  std::vector<byte_t> h_buffer(std::min(d_payload.size(), graph_file_staging_buffer_size));
+  for (size_t i = 0; i < d_payload.size(); i += h_buffer.size()) {
+    auto block_size = std::min(h_buffer.size(), d_payload.size() - i);
+    ifs.read(reinterpret_cast<char*>(h_buffer.data()), block_size);
+    CUGRAPH_EXPECTS(ifs.good(), "Failed to read %s.", file_path.c_str());
+    raft::update_device(d_payload.data() + i, h_buffer.data(), block_size, handle.get_stream());
+    handle.get_stream_view().synchronize();
   }
+
+  return std::make_tuple((*header).sequence_number, std::move(d_payload));
 }
 
 // Manual template instantiations (EIDir's):
+
+template void serializer_t::serialize(int32_t val);
+template void serializer_t::serialize(int64_t val);
+template void serializer_t::serialize(size_t val);
+template void serializer_t::serialize(float val);
+template void serializer_t::serialize(double val);
+
+template int32_t serializer_t::unserialize(void);
+template int64_t serializer_t::unserialize(void);
+template size_t serializer_t::unserialize(void);
+template float serializer_t::unserialize(void);
+template double serializer_t::unserialize(void);
 //
 template void serializer_t::serialize(int32_t const* p_d_src, size_t size);
 template void serializer_t::serialize(int64_t const* p_d_src, size_t size);
@@ -268,43 +1161,513 @@ template rmm::device_uvector<double> serializer_t::unserialize(size_t size);
 
 // serialize graph:
 //
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template void serializer_t::serialize(
   graph_t<int32_t, int32_t, float, false, false> const& graph,
   serializer_t::graph_meta_t<graph_t<int32_t, int32_t, float, false, false>>&);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template void serializer_t::serialize(
   graph_t<int32_t, int64_t, float, false, false> const& graph,
   serializer_t::graph_meta_t<graph_t<int32_t, int64_t, float, false, false>>&);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template void serializer_t::serialize(
   graph_t<int64_t, int64_t, float, false, false> const& graph,
   serializer_t::graph_meta_t<graph_t<int64_t, int64_t, float, false, false>>&);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template void serializer_t::serialize(
   graph_t<int32_t, int32_t, double, false, false> const& graph,
   serializer_t::graph_meta_t<graph_t<int32_t, int32_t, double, false, false>>&);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template void serializer_t::serialize(
   graph_t<int32_t, int64_t, double, false, false> const& graph,
   serializer_t::graph_meta_t<graph_t<int32_t, int64_t, double, false, false>>&);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template void serializer_t::serialize(
   graph_t<int64_t, int64_t, double, false, false> const& graph,
   serializer_t::graph_meta_t<graph_t<int64_t, int64_t, double, false, false>>&);
+#endif
 
 // unserialize graph:
 //
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template graph_t<int32_t, int32_t, float, false, false> serializer_t::unserialize(size_t, size_t);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template graph_t<int32_t, int64_t, float, false, false> serializer_t::unserialize(size_t, size_t);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template graph_t<int64_t, int64_t, float, false, false> serializer_t::unserialize(size_t, size_t);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template graph_t<int32_t, int32_t, double, false, false> serializer_t::unserialize(size_t, size_t);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template graph_t<int32_t, int64_t, double, false, false> serializer_t::unserialize(size_t, size_t);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template graph_t<int64_t, int64_t, double, false, false> serializer_t::unserialize(size_t, size_t);
+#endif
+
+// serialize multi-GPU graph:
+//
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void serializer_t::serialize(
+  graph_t<int32_t, int32_t, float, false, true> const& graph,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, float, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void serializer_t::serialize(
+  graph_t<int32_t, int64_t, float, false, true> const& graph,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, float, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void serializer_t::serialize(
+  graph_t<int64_t, int64_t, float, false, true> const& graph,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, float, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void serializer_t::serialize(
+  graph_t<int32_t, int32_t, double, false, true> const& graph,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, double, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void serializer_t::serialize(
+  graph_t<int32_t, int64_t, double, false, true> const& graph,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, double, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void serializer_t::serialize(
+  graph_t<int64_t, int64_t, double, false, true> const& graph,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, double, false, true>>&);
+#endif
+
+// unserialize multi-GPU graph:
+//
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template graph_t<int32_t, int32_t, float, false, true> serializer_t::unserialize(size_t, size_t);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template graph_t<int32_t, int64_t, float, false, true> serializer_t::unserialize(size_t, size_t);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template graph_t<int64_t, int64_t, float, false, true> serializer_t::unserialize(size_t, size_t);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template graph_t<int32_t, int32_t, double, false, true> serializer_t::unserialize(size_t, size_t);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template graph_t<int32_t, int64_t, double, false, true> serializer_t::unserialize(size_t, size_t);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template graph_t<int64_t, int64_t, double, false, true> serializer_t::unserialize(size_t, size_t);
+#endif
+
+// serialize graph to host memory:
+//
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, float, false, false> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, float, false, false>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, float, false, false> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, float, false, false>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, float, false, false> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, float, false, false>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, double, false, false> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, double, false, false>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, double, false, false> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, double, false, false>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, double, false, false> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, double, false, false>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, float, false, true> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, float, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, float, false, true> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, float, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, float, false, true> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, float, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, double, false, true> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, double, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, double, false, true> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, double, false, true>>&);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void serializer_t::serialize_to_host(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, double, false, true> const& graph,
+  byte_t* h_storage,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, double, false, true>>&);
+#endif
+
+// serialize graph to a file descriptor:
+//
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, float, false, false> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, float, false, false>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, float, false, false> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, float, false, false>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, float, false, false> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, float, false, false>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, double, false, false> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, double, false, false>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, double, false, false> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, double, false, false>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, double, false, false> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, double, false, false>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, float, false, true> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, float, false, true>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, float, false, true> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, float, false, true>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, float, false, true> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, float, false, true>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, double, false, true> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int32_t, int32_t, double, false, true>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, double, false, true> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int32_t, int64_t, double, false, true>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void serializer_t::serialize_to_fd(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, double, false, true> const& graph,
+  int fd,
+  serializer_t::graph_meta_t<graph_t<int64_t, int64_t, double, false, true>>&,
+  size_t chunk_sz_bytes);
+#endif
+
+// write graph to file:
+//
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void serializer_t::write_graph_to_file(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, float, false, false> const& graph,
+  std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void serializer_t::write_graph_to_file(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, float, false, false> const& graph,
+  std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void serializer_t::write_graph_to_file(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, float, false, false> const& graph,
+  std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void serializer_t::write_graph_to_file(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, double, false, false> const& graph,
+  std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void serializer_t::write_graph_to_file(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, double, false, false> const& graph,
+  std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void serializer_t::write_graph_to_file(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, double, false, false> const& graph,
+  std::string const& file_path);
+#endif
+
+// read graph from file:
+//
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template graph_t<int32_t, int32_t, float, false, false> serializer_t::read_graph_from_file(
+  raft::handle_t const& handle, std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template graph_t<int32_t, int64_t, float, false, false> serializer_t::read_graph_from_file(
+  raft::handle_t const& handle, std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template graph_t<int64_t, int64_t, float, false, false> serializer_t::read_graph_from_file(
+  raft::handle_t const& handle, std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template graph_t<int32_t, int32_t, double, false, false> serializer_t::read_graph_from_file(
+  raft::handle_t const& handle, std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template graph_t<int32_t, int64_t, double, false, false> serializer_t::read_graph_from_file(
+  raft::handle_t const& handle, std::string const& file_path);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template graph_t<int64_t, int64_t, double, false, false> serializer_t::read_graph_from_file(
+  raft::handle_t const& handle, std::string const& file_path);
+#endif
+
+// broadcast graph:
+//
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template graph_t<int32_t, int32_t, float, false, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, float, false, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template graph_t<int32_t, int64_t, float, false, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, float, false, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template graph_t<int64_t, int64_t, float, false, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, float, false, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template graph_t<int32_t, int32_t, double, false, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, double, false, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template graph_t<int32_t, int64_t, double, false, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, double, false, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template graph_t<int64_t, int64_t, double, false, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, double, false, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template graph_t<int32_t, int32_t, float, true, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, float, true, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template graph_t<int32_t, int64_t, float, true, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, float, true, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template graph_t<int64_t, int64_t, float, true, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, float, true, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template graph_t<int32_t, int32_t, double, true, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, double, true, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template graph_t<int32_t, int64_t, double, true, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int64_t, double, true, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template graph_t<int64_t, int64_t, double, true, false> serializer_t::broadcast(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, double, true, false>* graph_ptr,
+  int root,
+  size_t chunk_sz_bytes);
+#endif
 
 }  // namespace serializer
 }  // namespace cugraph
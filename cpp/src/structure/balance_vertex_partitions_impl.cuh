@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/detail/graph_utils.cuh>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/collect_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <structure/renumbered_edgelist_utils.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+template <typename edge_t>
+struct vertex_cost_t {
+  double vertex_weight{0.0};
+  double edge_weight{0.0};
+
+  __device__ double operator()(edge_t degree) const
+  {
+    return vertex_weight + edge_weight * static_cast<double>(degree);
+  }
+};
+
+// assign a vertex to the GPU whose (equal-cost) slice of the global cost prefix range contains the
+// vertex's cost prefix; the cost prefix is non-decreasing in the vertex ID (also in floating point
+// arithmetic), so each GPU is assigned a contiguous range of the current internal vertex IDs
+struct cost_prefix_to_gpu_id_t {
+  double cost_offset{0.0};
+  double cost_per_gpu{0.0};
+  int comm_size{0};
+
+  __device__ int operator()(double local_cost_prefix) const
+  {
+    auto gpu_id = cost_per_gpu > 0.0 ? (cost_offset + local_cost_prefix) / cost_per_gpu : 0.0;
+    return gpu_id < static_cast<double>(comm_size - 1) ? static_cast<int>(gpu_id) : comm_size - 1;
+  }
+};
+
+}  // namespace
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
+           rmm::device_uvector<vertex_t>>
+balance_vertex_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  rmm::device_uvector<vertex_t>&& renumber_map_labels,
+  double edge_balance_ratio,
+  bool do_expensive_check)
+{
+  static_assert(multi_gpu, "balance_vertex_partitions is valid only in multi-GPU.");
+
+  auto& comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+  auto const comm_rank = comm.get_rank();
+
+  CUGRAPH_EXPECTS((edge_balance_ratio >= 0.0) && (edge_balance_ratio <= 1.0),
+                  "Invalid input argument: edge_balance_ratio should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(
+    renumber_map_labels.size() == static_cast<size_t>(graph_view.get_number_of_local_vertices()),
+    "Invalid input argument: renumber_map_labels.size() does not match with the number of local "
+    "vertices.");
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+
+  // 1. compute each vertex's cost, (1 - edge_balance_ratio) * (average degree) + edge_balance_ratio
+  // * degree, the sum of the costs is the number of edges for any edge_balance_ratio
+
+  auto degrees = store_transposed ? graph_view.compute_in_degrees(handle)
+                                  : graph_view.compute_out_degrees(handle);
+
+  rmm::device_uvector<int> gpu_ids(0, handle.get_stream());
+  {
+    rmm::device_uvector<double> cost_prefixes(degrees.size(), handle.get_stream());
+    auto average_degree =
+      graph_view.get_number_of_vertices() > 0
+        ? static_cast<double>(graph_view.get_number_of_edges()) /
+            static_cast<double>(graph_view.get_number_of_vertices())
+        : 0.0;
+    auto cost_first = thrust::make_transform_iterator(
+      degrees.begin(),
+      vertex_cost_t<edge_t>{(1.0 - edge_balance_ratio) * average_degree, edge_balance_ratio});
+    thrust::exclusive_scan(handle.get_thrust_policy(),
+                           cost_first,
+                           cost_first + degrees.size(),
+                           cost_prefixes.begin());
+    auto local_cost = thrust::reduce(
+      handle.get_thrust_policy(), cost_first, cost_first + degrees.size(), double{0.0});
+
+    auto costs = host_scalar_allgather(comm, local_cost, handle.get_stream());
+    std::vector<double> cost_offsets(costs.size() + 1, 0.0);
+    std::partial_sum(costs.begin(), costs.end(), cost_offsets.begin() + 1);
+
+    gpu_ids.resize(cost_prefixes.size(), handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      cost_prefixes.begin(),
+      cost_prefixes.end(),
+      gpu_ids.begin(),
+      cost_prefix_to_gpu_id_t{
+        cost_offsets[comm_rank], cost_offsets.back() / static_cast<double>(comm_size), comm_size});
+  }
+
+  // 2. send the vertices to their new owners (the new GPU IDs are sorted)
+
+  std::vector<size_t> tx_counts(comm_size, 0);
+  {
+    rmm::device_uvector<size_t> d_tx_offsets(comm_size, handle.get_stream());
+    thrust::upper_bound(handle.get_thrust_policy(),
+                        gpu_ids.begin(),
+                        gpu_ids.end(),
+                        thrust::make_counting_iterator(int{0}),
+                        thrust::make_counting_iterator(comm_size),
+                        d_tx_offsets.begin());
+    std::vector<size_t> tx_offsets(comm_size + 1, 0);
+    raft::update_host(tx_offsets.data() + 1, d_tx_offsets.data(), comm_size, handle.get_stream());
+    handle.get_stream_view().synchronize();
+    std::adjacent_difference(tx_offsets.begin() + 1, tx_offsets.end(), tx_counts.begin());
+  }
+  gpu_ids.resize(0, handle.get_stream());
+  gpu_ids.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<vertex_t> old_vertices(degrees.size(), handle.get_stream());
+  thrust::sequence(
+    handle.get_thrust_policy(), old_vertices.begin(), old_vertices.end(), local_vertex_first);
+
+  {
+    auto tx_first = thrust::make_zip_iterator(
+      thrust::make_tuple(renumber_map_labels.begin(), degrees.begin(), old_vertices.begin()));
+    std::forward_as_tuple(std::tie(renumber_map_labels, degrees, old_vertices), std::ignore) =
+      shuffle_values(comm, tx_first, tx_counts, handle.get_stream_view());
+  }
+
+  // 3. the received vertices are sorted by the current internal vertex IDs; sort them by degree
+  // (stable, the order inside each degree segment is preserved) and assign the new internal IDs
+
+  auto num_local_vertices = static_cast<vertex_t>(renumber_map_labels.size());
+  auto vertex_counts      = host_scalar_allgather(comm, num_local_vertices, handle.get_stream());
+  std::vector<vertex_t> vertex_partition_lasts(comm_size);
+  std::partial_sum(vertex_counts.begin(), vertex_counts.end(), vertex_partition_lasts.begin());
+  auto new_local_vertex_first = vertex_partition_lasts[comm_rank] - num_local_vertices;
+
+  thrust::stable_sort_by_key(
+    handle.get_thrust_policy(),
+    degrees.begin(),
+    degrees.end(),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(renumber_map_labels.begin(), old_vertices.begin())),
+    thrust::greater<edge_t>{});
+
+  auto segment_offsets = detail::compute_degree_segment_offsets<vertex_t, edge_t, multi_gpu>(
+    handle, degrees.data(), degrees.size(), num_local_vertices);
+  degrees.resize(0, handle.get_stream());
+  degrees.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<vertex_t> new_vertices(old_vertices.size(), handle.get_stream());
+  thrust::sequence(
+    handle.get_thrust_policy(), new_vertices.begin(), new_vertices.end(), new_local_vertex_first);
+  thrust::sort_by_key(
+    handle.get_thrust_policy(), old_vertices.begin(), old_vertices.end(), new_vertices.begin());
+
+  // 4. extract the edges and map their end points to the new internal IDs (each GPU is assigned a
+  // contiguous range of the current internal IDs, and the range boundaries coincide with
+  // vertex_partition_lasts)
+
+  std::vector<size_t> edgelist_edge_counts(graph_view.get_number_of_local_adj_matrix_partitions(),
+                                           size_t{0});
+  for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
+    edgelist_edge_counts[i] =
+      static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_edges(i));
+  }
+  auto number_of_local_edges =
+    std::reduce(edgelist_edge_counts.begin(), edgelist_edge_counts.end());
+
+  rmm::device_uvector<vertex_t> edgelist_majors(number_of_local_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> edgelist_minors(edgelist_majors.size(), handle.get_stream());
+  auto edgelist_weights = graph_view.is_weighted()
+                            ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                edgelist_majors.size(), handle.get_stream())
+                            : std::nullopt;
+  size_t cur_size{0};
+  for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
+    detail::decompress_matrix_partition_to_edgelist(
+      handle,
+      matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+        graph_view.get_matrix_partition_view(i)),
+      edgelist_majors.data() + cur_size,
+      edgelist_minors.data() + cur_size,
+      edgelist_weights ? std::optional<weight_t*>{(*edgelist_weights).data() + cur_size}
+                       : std::nullopt,
+      graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+    cur_size += edgelist_edge_counts[i];
+  }
+
+  {
+    rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                           handle.get_stream());
+    raft::update_device(d_vertex_partition_lasts.data(),
+                        vertex_partition_lasts.data(),
+                        vertex_partition_lasts.size(),
+                        handle.get_stream());
+    detail::compute_gpu_id_from_int_vertex_t<vertex_t> vertex_to_gpu_id_op{
+      d_vertex_partition_lasts.data(), comm_size};
+
+    edgelist_majors = collect_values_for_keys(comm,
+                                              old_vertices.begin(),
+                                              old_vertices.end(),
+                                              new_vertices.begin(),
+                                              edgelist_majors.begin(),
+                                              edgelist_majors.end(),
+                                              vertex_to_gpu_id_op,
+                                              handle.get_stream(),
+                                              collect_values_policy_t::binary_search);
+    edgelist_minors = collect_values_for_keys(comm,
+                                              old_vertices.begin(),
+                                              old_vertices.end(),
+                                              new_vertices.begin(),
+                                              edgelist_minors.begin(),
+                                              edgelist_minors.end(),
+                                              vertex_to_gpu_id_op,
+                                              handle.get_stream(),
+                                              collect_values_policy_t::binary_search);
+  }
+  old_vertices.resize(0, handle.get_stream());
+  old_vertices.shrink_to_fit(handle.get_stream());
+  new_vertices.resize(0, handle.get_stream());
+  new_vertices.shrink_to_fit(handle.get_stream());
+
+  // 5. shuffle the edges to their new owners and create the re-partitioned graph
+
+  auto graph = detail::
+    create_graph_from_renumbered_edgelist<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+      handle,
+      std::move(edgelist_majors),
+      std::move(edgelist_minors),
+      std::move(edgelist_weights),
+      vertex_partition_lasts,
+      std::make_optional(segment_offsets),
+      graph_view.get_number_of_vertices(),
+      graph_view.get_number_of_edges(),
+      graph_properties_t{graph_view.is_symmetric(), graph_view.is_multigraph()});
+
+  return std::make_tuple(std::move(graph), std::move(renumber_map_labels));
+}
+
+}  // namespace cugraph
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <structure/two_hop_paths.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// the memory budget (in bytes) for the 2-hop paths of a batch in the non-batched
+// bipartite_projection
+size_t constexpr bipartite_projection_batch_memory_budget{size_t{1} << 30};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct query_index_to_vertex_t {
+  vertex_t const* query_vertices{nullptr};
+
+  __device__ vertex_t operator()(size_t i) const { return query_vertices[i]; }
+};
+
+// (query index, weight, candidate) tuples are ordered by query index, then in descending weight
+// order, and then by candidate vertex ID (to break ties deterministically)
+template <typename vertex_t, typename weight_t>
+struct higher_weight_first_t {
+  __device__ bool operator()(thrust::tuple<size_t, weight_t, vertex_t> lhs,
+                             thrust::tuple<size_t, weight_t, vertex_t> rhs) const
+  {
+    if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+      return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+    } else if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+      return thrust::get<1>(lhs) > thrust::get<1>(rhs);
+    } else {
+      return thrust::get<2>(lhs) < thrust::get<2>(rhs);
+    }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+struct rank_in_query_t {
+  size_t const* sorted_query_indices{nullptr};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    auto first = thrust::lower_bound(
+      thrust::seq, sorted_query_indices, sorted_query_indices + i, sorted_query_indices[i]);
+    return static_cast<size_t>(thrust::distance(first, sorted_query_indices + i));
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+struct rank_exceeds_k_t {
+  size_t k{0};
+
+  __device__ bool operator()(size_t rank) const { return rank >= k; }
+};
+
+// accumulates the 2-hop path weights (or counts, if unweighted) of a batch per (query, candidate)
+// pair, keeps the top-k pairs per query vertex (if k is provided), and hands the pairs over to
+// batch_op
+template <typename vertex_t, typename weight_t>
+void reduce_projection_batch(raft::handle_t const& handle,
+                             vertex_t const* projection_vertices,
+                             std::optional<size_t> k,
+                             rmm::device_uvector<size_t>& path_query_indices,
+                             rmm::device_uvector<vertex_t>& path_candidates,
+                             std::optional<rmm::device_uvector<weight_t>>& path_weights,
+                             bipartite_projection_batch_op_t<vertex_t, weight_t> const& batch_op)
+{
+  // 1. accumulate the path weights per (query, candidate) pair
+
+  auto num_paths  = path_query_indices.size();
+  auto path_first = thrust::make_zip_iterator(
+    thrust::make_tuple(path_query_indices.begin(), path_candidates.begin()));
+
+  rmm::device_uvector<size_t> pair_query_indices(num_paths, handle.get_stream());
+  rmm::device_uvector<vertex_t> pair_candidates(num_paths, handle.get_stream());
+  rmm::device_uvector<weight_t> pair_weights(num_paths, handle.get_stream());
+  auto pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(pair_query_indices.begin(), pair_candidates.begin()));
+  size_t num_pairs{0};
+  if (path_weights) {
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), path_first, path_first + num_paths, (*path_weights).begin());
+    num_pairs = static_cast<size_t>(
+      thrust::distance(pair_first,
+                       thrust::reduce_by_key(handle.get_thrust_policy(),
+                                             path_first,
+                                             path_first + num_paths,
+                                             (*path_weights).begin(),
+                                             pair_first,
+                                             pair_weights.begin())
+                         .first));
+    (*path_weights).resize(0, handle.get_stream());
+    (*path_weights).shrink_to_fit(handle.get_stream());
+  } else {
+    thrust::sort(handle.get_thrust_policy(), path_first, path_first + num_paths);
+    num_pairs = static_cast<size_t>(
+      thrust::distance(pair_first,
+                       thrust::reduce_by_key(handle.get_thrust_policy(),
+                                             path_first,
+                                             path_first + num_paths,
+                                             thrust::make_constant_iterator(weight_t{1.0}),
+                                             pair_first,
+                                             pair_weights.begin())
+                         .first));
+  }
+  path_query_indices.resize(0, handle.get_stream());
+  path_query_indices.shrink_to_fit(handle.get_stream());
+  path_candidates.resize(0, handle.get_stream());
+  path_candidates.shrink_to_fit(handle.get_stream());
+
+  // 2. select the top-k candidates per query vertex (a query vertex never spans two batches)
+
+  if (k) {
+    auto triplet_first = thrust::make_zip_iterator(thrust::make_tuple(
+      pair_query_indices.begin(), pair_weights.begin(), pair_candidates.begin()));
+    thrust::sort(handle.get_thrust_policy(),
+                 triplet_first,
+                 triplet_first + num_pairs,
+                 higher_weight_first_t<vertex_t, weight_t>{});
+    rmm::device_uvector<size_t> ranks(num_pairs, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_pairs),
+                      ranks.begin(),
+                      rank_in_query_t{pair_query_indices.data()});
+    num_pairs = static_cast<size_t>(
+      thrust::distance(triplet_first,
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         triplet_first,
+                                         triplet_first + num_pairs,
+                                         ranks.begin(),
+                                         rank_exceeds_k_t{*k})));
+  }
+
+  pair_candidates.resize(num_pairs, handle.get_stream());
+  pair_candidates.shrink_to_fit(handle.get_stream());
+  pair_weights.resize(num_pairs, handle.get_stream());
+  pair_weights.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<vertex_t> srcs(num_pairs, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    pair_query_indices.begin(),
+                    pair_query_indices.begin() + num_pairs,
+                    srcs.begin(),
+                    query_index_to_vertex_t<vertex_t>{projection_vertices});
+  pair_query_indices.resize(0, handle.get_stream());
+  pair_query_indices.shrink_to_fit(handle.get_stream());
+
+  batch_op(std::move(srcs), std::move(pair_candidates), std::move(pair_weights));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void bipartite_projection_batched_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* projection_vertices,
+  size_t num_projection_vertices,
+  std::optional<size_t> k,
+  size_t batch_memory_budget,
+  bipartite_projection_batch_op_t<vertex_t, weight_t> batch_op,
+  bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((num_projection_vertices == 0) || (projection_vertices != nullptr),
+                  "Invalid input argument: projection_vertices cannot be null.");
+  CUGRAPH_EXPECTS(!k || (*k > 0), "Invalid input argument: k should be positive.");
+  CUGRAPH_EXPECTS(batch_op != nullptr, "Invalid input argument: batch_op cannot be empty.");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, multi_gpu>(
+      graph_view.get_vertex_partition_view());
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 graph_view,
+                 projection_vertices,
+                 projection_vertices + num_projection_vertices,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: projection_vertices have invalid vertex IDs.");
+  }
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  std::vector<vertex_t> vertex_partition_lasts{};
+  if constexpr (multi_gpu) { vertex_partition_lasts = graph_view.get_vertex_partition_lasts(); }
+
+  // 2. store the (unmasked) out-edges of the local vertices in a local CSR with the edge weights
+
+  auto [majors, minors, weights] =
+    detail::extract_local_major_weighted_edgelist(handle, graph_view, true);
+  auto offsets = detail::compute_sorted_edge_offsets<vertex_t, edge_t>(
+    handle, majors, local_vertex_first, num_local_vertices);
+  majors.resize(0, handle.get_stream());
+  majors.shrink_to_fit(handle.get_stream());
+
+  // 3. enumerate the 2-hop paths a-u-b from the projection vertices in batches and accumulate the
+  // path weights w(a, u) * w(u, b) per (a, b) pair (a path takes a query index, a candidate vertex
+  // & a weight, and sorting the paths takes about as much temporary memory)
+
+  auto max_num_paths_per_batch = std::max(
+    batch_memory_budget / ((sizeof(size_t) + sizeof(vertex_t) + sizeof(weight_t)) * 2), size_t{1});
+
+  detail::for_each_weighted_two_hop_path_batch<vertex_t, edge_t, weight_t, multi_gpu>(
+    handle,
+    minors,
+    weights,
+    offsets,
+    local_vertex_first,
+    vertex_partition_lasts,
+    projection_vertices,
+    num_projection_vertices,
+    max_num_paths_per_batch,
+    [&handle, projection_vertices, k, &batch_op](
+      rmm::device_uvector<size_t>& path_query_indices,
+      rmm::device_uvector<vertex_t>& path_candidates,
+      std::optional<rmm::device_uvector<weight_t>>& path_weights) {
+      reduce_projection_batch(handle,
+                              projection_vertices,
+                              k,
+                              path_query_indices,
+                              path_candidates,
+                              path_weights,
+                              batch_op);
+    });
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void bipartite_projection_batched(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* projection_vertices,
+  size_t num_projection_vertices,
+  std::optional<size_t> k,
+  size_t batch_memory_budget,
+  bipartite_projection_batch_op_t<vertex_t, weight_t> batch_op,
+  bool do_expensive_check)
+{
+  bipartite_projection_batched_impl(handle,
+                                    graph_view,
+                                    projection_vertices,
+                                    num_projection_vertices,
+                                    k,
+                                    batch_memory_budget,
+                                    std::move(batch_op),
+                                    do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+bipartite_projection(raft::handle_t const& handle,
+                     graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                     vertex_t const* projection_vertices,
+                     size_t num_projection_vertices,
+                     std::optional<size_t> k,
+                     bool do_expensive_check)
+{
+  rmm::device_uvector<vertex_t> ret_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> ret_dsts(0, handle.get_stream());
+  rmm::device_uvector<weight_t> ret_weights(0, handle.get_stream());
+
+  bipartite_projection_batched_impl(
+    handle,
+    graph_view,
+    projection_vertices,
+    num_projection_vertices,
+    k,
+    bipartite_projection_batch_memory_budget,
+    bipartite_projection_batch_op_t<vertex_t, weight_t>{
+      [&handle, &ret_srcs, &ret_dsts, &ret_weights](rmm::device_uvector<vertex_t>&& srcs,
+                                                    rmm::device_uvector<vertex_t>&& dsts,
+                                                    rmm::device_uvector<weight_t>&& weights) {
+        auto old_size = ret_srcs.size();
+        ret_srcs.resize(old_size + srcs.size(), handle.get_stream());
+        ret_dsts.resize(ret_srcs.size(), handle.get_stream());
+        ret_weights.resize(ret_srcs.size(), handle.get_stream());
+        thrust::copy(
+          handle.get_thrust_policy(), srcs.begin(), srcs.end(), ret_srcs.begin() + old_size);
+        thrust::copy(
+          handle.get_thrust_policy(), dsts.begin(), dsts.end(), ret_dsts.begin() + old_size);
+        thrust::copy(handle.get_thrust_policy(),
+                     weights.begin(),
+                     weights.end(),
+                     ret_weights.begin() + old_size);
+      }},
+    do_expensive_check);
+
+  return std::make_tuple(std::move(ret_srcs), std::move(ret_dsts), std::move(ret_weights));
+}
+
+}  // namespace cugraph
@@ -25,18 +25,28 @@
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/utilities/error.hpp>
 
+#include <cuco/static_map.cuh>
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/polymorphic_allocator.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/sort.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <tuple>
 #include <utility>
@@ -93,6 +103,205 @@ edge_t groupby_e_and_coarsen_edgelist(vertex_t* edgelist_major_vertices /* [INOU
   }
 }
 
+// a pair of cluster IDs with 32 bit vertex IDs fits in a 64 bit key, so the relabeled edges can be
+// aggregated with a hash map directly from the compressed sparse format (without decompressing the
+// matrix partition to an edge list and sorting the edge list)
+template <typename vertex_t>
+constexpr bool use_coarsened_edge_map = sizeof(vertex_t) * 2 <= sizeof(uint64_t);
+
+template <typename vertex_t>
+__host__ __device__ uint64_t pack_coarsened_edge(vertex_t major, vertex_t minor)
+{
+  static_assert(use_coarsened_edge_map<vertex_t>);
+  return (static_cast<uint64_t>(static_cast<uint32_t>(major)) << 32) |
+         static_cast<uint64_t>(static_cast<uint32_t>(minor));
+}
+
+template <typename vertex_t>
+struct unpack_coarsened_edge_t {
+  __device__ thrust::tuple<vertex_t, vertex_t> operator()(uint64_t key) const
+  {
+    return thrust::make_tuple(static_cast<vertex_t>(static_cast<uint32_t>(key >> 32)),
+                              static_cast<vertex_t>(static_cast<uint32_t>(key)));
+  }
+};
+
+// returns the (major label, minor label) key of the i'th edge of the matrix partition, the major
+// of the i'th edge is found by binary searching the offsets array (instead of decompressing the
+// majors of every edge)
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu,
+          typename AdjMatrixMinorLabelInputWrapper>
+struct relabeled_edge_key_t {
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> matrix_partition;
+  vertex_t const* major_label_first{nullptr};
+  AdjMatrixMinorLabelInputWrapper minor_label_input;
+  vertex_t major_hypersparse_first{0};  // major_idx == major_offset below this
+  vertex_t num_major_idxs{0};
+
+  __device__ uint64_t operator()(edge_t i) const
+  {
+    auto offsets   = matrix_partition.get_offsets();
+    auto major_idx = static_cast<vertex_t>(thrust::distance(
+      offsets + 1,
+      thrust::upper_bound(thrust::seq, offsets + 1, offsets + (num_major_idxs + 1), i)));
+    auto major_offset =
+      major_idx < major_hypersparse_first
+        ? major_idx
+        : matrix_partition.get_major_offset_from_major_nocheck(
+            *(matrix_partition.get_major_from_major_hypersparse_idx_nocheck(
+              major_idx - major_hypersparse_first)));
+    auto minor_offset =
+      matrix_partition.get_minor_offset_from_minor_nocheck(*(matrix_partition.get_minors() + i));
+    return pack_coarsened_edge(*(major_label_first + major_offset),
+                               minor_label_input.get(minor_offset));
+  }
+};
+
+// the edge whose (key, edge index) pair got inserted to the edge map (one per key) represents the
+// key
+template <typename EdgeKeyOp, typename EdgeMapViewType>
+struct is_representative_edge_t {
+  EdgeKeyOp edge_key_op;
+  EdgeMapViewType edge_map_view;
+
+  template <typename edge_t>
+  __device__ bool operator()(edge_t i) const
+  {
+    return edge_map_view.find(edge_key_op(i))->second.load(cuda::std::memory_order_relaxed) == i;
+  }
+};
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu,
+          typename AdjMatrixMinorLabelInputWrapper>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+aggregate_matrix_partition_to_relabeled_and_coarsened_edgelist(
+  raft::handle_t const& handle,
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> const matrix_partition,
+  vertex_t const* major_label_first,
+  AdjMatrixMinorLabelInputWrapper const minor_label_input,
+  std::optional<std::vector<vertex_t>> const& segment_offsets)
+{
+  static_assert(use_coarsened_edge_map<vertex_t>);
+
+  double constexpr load_factor = 0.7;
+
+  auto number_of_edges         = matrix_partition.get_number_of_edges();
+  auto major_hypersparse_first = matrix_partition.get_major_size();
+  auto num_major_idxs          = matrix_partition.get_major_size();
+  if (matrix_partition.get_dcs_nzd_vertex_count()) {
+    major_hypersparse_first = (*segment_offsets)[detail::num_sparse_segments_per_vertex_partition];
+    num_major_idxs =
+      major_hypersparse_first + *(matrix_partition.get_dcs_nzd_vertex_count());
+  }
+  relabeled_edge_key_t<vertex_t, edge_t, weight_t, multi_gpu, AdjMatrixMinorLabelInputWrapper>
+    edge_key_op{matrix_partition,
+                major_label_first,
+                minor_label_input,
+                major_hypersparse_first,
+                num_major_idxs};
+  auto key_first =
+    thrust::make_transform_iterator(thrust::make_counting_iterator(edge_t{0}), edge_key_op);
+
+  auto poly_alloc = rmm::mr::polymorphic_allocator<char>(rmm::mr::get_current_device_resource());
+  auto stream_adapter = rmm::mr::make_stream_allocator_adaptor(poly_alloc, cudaStream_t{nullptr});
+  using edge_map_t =
+    cuco::static_map<uint64_t, edge_t, cuda::thread_scope_device, decltype(stream_adapter)>;
+
+  // 1. find the unique (major label, minor label) pairs
+
+  rmm::device_uvector<uint64_t> unique_keys(0, handle.get_stream());
+  {
+    handle.get_stream_view().synchronize();  // cuco::static_map currently does not take stream
+
+    edge_map_t edge_map(
+      // cuco::static_map requires at least one empty slot
+      std::max(static_cast<size_t>(static_cast<double>(number_of_edges) / load_factor),
+               static_cast<size_t>(number_of_edges) + 1),
+      std::numeric_limits<uint64_t>::max(),
+      invalid_edge_id<edge_t>::value,
+      stream_adapter);
+    auto pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(key_first, thrust::make_counting_iterator(edge_t{0})));
+    edge_map.insert(pair_first, pair_first + number_of_edges);
+
+    is_representative_edge_t<decltype(edge_key_op), decltype(edge_map.get_device_view())>
+      is_representative_edge{edge_key_op, edge_map.get_device_view()};
+    unique_keys.resize(thrust::count_if(handle.get_thrust_policy(),
+                                        thrust::make_counting_iterator(edge_t{0}),
+                                        thrust::make_counting_iterator(number_of_edges),
+                                        is_representative_edge),
+                       handle.get_stream());
+    thrust::copy_if(handle.get_thrust_policy(),
+                    key_first,
+                    key_first + number_of_edges,
+                    thrust::make_counting_iterator(edge_t{0}),
+                    unique_keys.begin(),
+                    is_representative_edge);
+  }
+  thrust::sort(handle.get_thrust_policy(), unique_keys.begin(), unique_keys.end());
+
+  // 2. sum the weights of the edges with the same (major label, minor label) pair
+
+  auto coarsened_weights =
+    matrix_partition.get_weights()
+      ? std::make_optional<rmm::device_uvector<weight_t>>(unique_keys.size(), handle.get_stream())
+      : std::nullopt;
+  if (coarsened_weights) {
+    thrust::fill(handle.get_thrust_policy(),
+                 (*coarsened_weights).begin(),
+                 (*coarsened_weights).end(),
+                 weight_t{0.0});
+
+    handle.get_stream_view().synchronize();  // cuco::static_map currently does not take stream
+
+    edge_map_t key_to_idx_map(
+      // cuco::static_map requires at least one empty slot
+      std::max(static_cast<size_t>(static_cast<double>(unique_keys.size()) / load_factor),
+               unique_keys.size() + 1),
+      std::numeric_limits<uint64_t>::max(),
+      invalid_edge_id<edge_t>::value,
+      stream_adapter);
+    auto pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(unique_keys.begin(), thrust::make_counting_iterator(edge_t{0})));
+    key_to_idx_map.insert(pair_first, pair_first + unique_keys.size());
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(number_of_edges),
+      [edge_key_op,
+       key_to_idx_map_view = key_to_idx_map.get_device_view(),
+       edge_weights        = *(matrix_partition.get_weights()),
+       coarsened_weights   = (*coarsened_weights).data()] __device__(auto i) {
+        auto idx =
+          key_to_idx_map_view.find(edge_key_op(i))->second.load(cuda::std::memory_order_relaxed);
+        atomicAdd(coarsened_weights + idx, edge_weights[i]);
+      });
+  }
+
+  // 3. unpack the keys
+
+  rmm::device_uvector<vertex_t> coarsened_majors(unique_keys.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> coarsened_minors(coarsened_majors.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    unique_keys.begin(),
+                    unique_keys.end(),
+                    thrust::make_zip_iterator(
+                      thrust::make_tuple(coarsened_majors.begin(), coarsened_minors.begin())),
+                    unpack_coarsened_edge_t<vertex_t>{});
+
+  return std::make_tuple(
+    std::move(coarsened_majors), std::move(coarsened_minors), std::move(coarsened_weights));
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -110,8 +319,10 @@ decompress_matrix_partition_to_relabeled_and_grouped_and_coarsened_edgelist(
 {
   static_assert(std::is_same_v<typename AdjMatrixMinorLabelInputWrapper::value_type, vertex_t>);
 
-  // FIXME: it might be possible to directly create relabled & coarsened edgelist from the
-  // compressed sparse format to save memory
+  if constexpr (use_coarsened_edge_map<vertex_t>) {
+    return aggregate_matrix_partition_to_relabeled_and_coarsened_edgelist(
+      handle, matrix_partition, major_label_first, minor_label_input, segment_offsets);
+  }
 
   rmm::device_uvector<vertex_t> edgelist_major_vertices(matrix_partition.get_number_of_edges(),
                                                         handle.get_stream());
@@ -230,10 +441,9 @@ coarsen_graph(
       (*coarsened_edgelist_weights).emplace_back(0, handle.get_stream());
     }
   }
-  // FIXME: we may compare performance/memory footprint with the hash_based approach especially when
-  // cuco::dynamic_map becomes available (so we don't need to preallocate memory assuming the worst
-  // case). We may be able to limit the memory requirement close to the final coarsened edgelist
-  // with the hash based approach.
+  // FIXME: the local step (1-1) aggregates with a hash map (with 32 bit vertex IDs), but the
+  // shuffled edges are still coarsened by sorting; we may switch once cuco::dynamic_map becomes
+  // available (so we don't need to preallocate memory assuming the worst case).
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     // 1-1. locally construct coarsened edge list
 
@@ -393,6 +603,8 @@ coarsen_graph(
       minor_ptrs,
       counts,
       std::nullopt,
+      renumber_order_t::degree,
+      std::nullopt,
       do_expensive_check);
   }
 
@@ -475,6 +687,8 @@ coarsen_graph(
     coarsened_edgelist_major_vertices.data(),
     coarsened_edgelist_minor_vertices.data(),
     static_cast<edge_t>(coarsened_edgelist_major_vertices.size()),
+    renumber_order_t::degree,
+    std::nullopt,
     do_expensive_check);
 
   edgelist_t<vertex_t, edge_t, weight_t> edgelist{};
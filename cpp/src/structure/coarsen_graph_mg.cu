@@ -19,6 +19,7 @@ namespace cugraph {
 
 // MG instantiation
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::tuple<std::unique_ptr<graph_t<int32_t, int32_t, float, true, true>>,
                     rmm::device_uvector<int32_t>>
 coarsen_graph(raft::handle_t const& handle,
@@ -32,7 +33,9 @@ coarsen_graph(raft::handle_t const& handle,
               graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
               int32_t const* labels,
               bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::tuple<std::unique_ptr<graph_t<int32_t, int64_t, float, true, true>>,
                     rmm::device_uvector<int32_t>>
 coarsen_graph(raft::handle_t const& handle,
@@ -46,7 +49,9 @@ coarsen_graph(raft::handle_t const& handle,
               graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
               int32_t const* labels,
               bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::tuple<std::unique_ptr<graph_t<int64_t, int64_t, float, true, true>>,
                     rmm::device_uvector<int64_t>>
 coarsen_graph(raft::handle_t const& handle,
@@ -60,7 +65,9 @@ coarsen_graph(raft::handle_t const& handle,
               graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
               int64_t const* labels,
               bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::tuple<std::unique_ptr<graph_t<int32_t, int32_t, double, true, true>>,
                     rmm::device_uvector<int32_t>>
 coarsen_graph(raft::handle_t const& handle,
@@ -74,7 +81,9 @@ coarsen_graph(raft::handle_t const& handle,
               graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
               int32_t const* labels,
               bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::tuple<std::unique_ptr<graph_t<int32_t, int64_t, double, true, true>>,
                     rmm::device_uvector<int32_t>>
 coarsen_graph(raft::handle_t const& handle,
@@ -88,7 +97,9 @@ coarsen_graph(raft::handle_t const& handle,
               graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
               int32_t const* labels,
               bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::tuple<std::unique_ptr<graph_t<int64_t, int64_t, double, true, true>>,
                     rmm::device_uvector<int64_t>>
 coarsen_graph(raft::handle_t const& handle,
@@ -102,5 +113,6 @@ coarsen_graph(raft::handle_t const& handle,
               graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
               int64_t const* labels,
               bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
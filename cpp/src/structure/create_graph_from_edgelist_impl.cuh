@@ -24,15 +24,33 @@
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.cuh>
 
+#include <raft/cudart_utils.h>
+#include <raft/device_atomics.cuh>
 #include <raft/handle.hpp>
 
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
+#include <thrust/unique.h>
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <numeric>
 
@@ -196,6 +214,7 @@ create_graph_from_edgelist_impl(raft::handle_t const& handle,
                                 std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
                                 graph_properties_t graph_properties,
                                 bool renumber,
+                                multi_edge_reduction_t multi_edge_reduction,
                                 bool do_expensive_check)
 {
   auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
@@ -290,7 +309,8 @@ create_graph_from_edgelist_impl(raft::handle_t const& handle,
         meta.partition,
         meta.segment_offsets,
         store_transposed ? meta.num_local_unique_edge_minors : meta.num_local_unique_edge_majors,
-        store_transposed ? meta.num_local_unique_edge_majors : meta.num_local_unique_edge_minors}),
+        store_transposed ? meta.num_local_unique_edge_majors : meta.num_local_unique_edge_minors,
+        multi_edge_reduction}),
     std::optional<rmm::device_uvector<vertex_t>>{std::move(renumber_map_labels)});
 }
 
@@ -310,6 +330,7 @@ create_graph_from_edgelist_impl(raft::handle_t const& handle,
                                 std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
                                 graph_properties_t graph_properties,
                                 bool renumber,
+                                multi_edge_reduction_t multi_edge_reduction,
                                 bool do_expensive_check)
 {
   CUGRAPH_EXPECTS(edgelist_rows.size() == edgelist_cols.size(),
@@ -351,6 +372,36 @@ create_graph_from_edgelist_impl(raft::handle_t const& handle,
     }
   }
 
+  auto graph_meta = cugraph::graph_meta_t<vertex_t, edge_t, multi_gpu>{
+    num_vertices,
+    graph_properties,
+    renumber ? std::optional<std::vector<vertex_t>>{meta.segment_offsets} : std::nullopt};
+  graph_meta.multi_edge_reduction = multi_edge_reduction;
+
+  // if the edge list is already sorted by major, the minors and weights we own are the compressed
+  // sparse indices and weights, so compute the offsets and move the edge list into the graph
+  // instead of building a copy (this avoids doubling the peak memory footprint)
+
+  auto& majors = store_transposed ? edgelist_cols : edgelist_rows;
+  auto& minors = store_transposed ? edgelist_rows : edgelist_cols;
+  if (thrust::is_sorted(handle.get_thrust_policy(), majors.begin(), majors.end())) {
+    rmm::device_uvector<edge_t> offsets(static_cast<size_t>(num_vertices) + 1,
+                                        handle.get_stream());
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        majors.begin(),
+                        majors.end(),
+                        thrust::make_counting_iterator(vertex_t{0}),
+                        thrust::make_counting_iterator(num_vertices + 1),
+                        offsets.begin());
+    majors.resize(0, handle.get_stream());
+    majors.shrink_to_fit(handle.get_stream());
+
+    return std::make_tuple(
+      cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+        handle, std::move(offsets), std::move(minors), std::move(edgelist_weights), graph_meta),
+      std::move(renumber_map_labels));
+  }
+
   return std::make_tuple(
     cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
       handle,
@@ -360,10 +411,440 @@ create_graph_from_edgelist_impl(raft::handle_t const& handle,
         edgelist_weights ? std::optional<weight_t const*>{(*edgelist_weights).data()}
                          : std::nullopt,
         static_cast<edge_t>(edgelist_rows.size())},
-      cugraph::graph_meta_t<vertex_t, edge_t, multi_gpu>{
-        num_vertices,
-        graph_properties,
-        renumber ? std::optional<std::vector<vertex_t>>{meta.segment_offsets} : std::nullopt}),
+      graph_meta),
+    std::move(renumber_map_labels));
+}
+
+template <typename T>
+using pinned_host_vector_t =
+  thrust::host_vector<T, thrust::system::cuda::experimental::pinned_allocator<T>>;
+
+// Stream the host edge list chunks to the device in blocks of at most edges_per_block edges, and
+// call block_op (on handle.get_stream()) with the device copy of each block. Blocks are staged
+// through two host pinned buffers and two device buffers, so copying the next block (on an internal
+// stream if available) overlaps with running block_op on the current block.
+template <typename vertex_t, typename edge_t, typename weight_t, typename BlockOp>
+void for_each_edgelist_block(
+  raft::handle_t const& handle,
+  std::vector<vertex_t const*> const& edgelist_row_chunks,
+  std::vector<vertex_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<weight_t const*>> const& edgelist_weight_chunks,
+  std::vector<edge_t> const& edgelist_chunk_sizes,
+  size_t edges_per_block,
+  BlockOp block_op)
+{
+  constexpr size_t num_buffers{2};
+
+  auto copy_stream = handle.get_num_internal_streams() > 0 ? handle.get_internal_stream_view(0)
+                                                           : handle.get_stream_view();
+
+  std::vector<pinned_host_vector_t<vertex_t>> h_rows(num_buffers);
+  std::vector<pinned_host_vector_t<vertex_t>> h_cols(num_buffers);
+  std::vector<pinned_host_vector_t<weight_t>> h_weights(num_buffers);
+  std::vector<rmm::device_uvector<vertex_t>> d_rows{};
+  std::vector<rmm::device_uvector<vertex_t>> d_cols{};
+  std::vector<rmm::device_uvector<weight_t>> d_weights{};
+  std::array<cudaEvent_t, num_buffers> copy_events{};
+  std::array<cudaEvent_t, num_buffers> compute_events{};
+  for (size_t i = 0; i < num_buffers; ++i) {
+    h_rows[i].resize(edges_per_block);
+    h_cols[i].resize(edges_per_block);
+    d_rows.emplace_back(edges_per_block, handle.get_stream());
+    d_cols.emplace_back(edges_per_block, handle.get_stream());
+    if (edgelist_weight_chunks) {
+      h_weights[i].resize(edges_per_block);
+      d_weights.emplace_back(edges_per_block, handle.get_stream());
+    }
+    CUDA_TRY(cudaEventCreateWithFlags(&copy_events[i], cudaEventDisableTiming));
+    CUDA_TRY(cudaEventCreateWithFlags(&compute_events[i], cudaEventDisableTiming));
+  }
+  // the device buffers are allocated on handle.get_stream()
+  CUDA_TRY(cudaEventRecord(compute_events[0], handle.get_stream()));
+  CUDA_TRY(cudaStreamWaitEvent(copy_stream, compute_events[0], 0));
+
+  size_t block_idx{0};
+  for (size_t i = 0; i < edgelist_chunk_sizes.size(); ++i) {
+    auto chunk_size = static_cast<size_t>(edgelist_chunk_sizes[i]);
+    for (size_t offset = 0; offset < chunk_size; offset += edges_per_block) {
+      auto block_size = std::min(edges_per_block, chunk_size - offset);
+      auto b          = block_idx % num_buffers;
+      if (block_idx >= num_buffers) {
+        CUDA_TRY(cudaEventSynchronize(copy_events[b]));  // h_*[b] can be overwritten
+        CUDA_TRY(cudaStreamWaitEvent(copy_stream, compute_events[b], 0));  // d_*[b] can be reused
+      }
+      std::copy(edgelist_row_chunks[i] + offset,
+                edgelist_row_chunks[i] + offset + block_size,
+                h_rows[b].begin());
+      std::copy(edgelist_col_chunks[i] + offset,
+                edgelist_col_chunks[i] + offset + block_size,
+                h_cols[b].begin());
+      raft::update_device(d_rows[b].data(), h_rows[b].data(), block_size, copy_stream);
+      raft::update_device(d_cols[b].data(), h_cols[b].data(), block_size, copy_stream);
+      if (edgelist_weight_chunks) {
+        std::copy((*edgelist_weight_chunks)[i] + offset,
+                  (*edgelist_weight_chunks)[i] + offset + block_size,
+                  h_weights[b].begin());
+        raft::update_device(d_weights[b].data(), h_weights[b].data(), block_size, copy_stream);
+      }
+      CUDA_TRY(cudaEventRecord(copy_events[b], copy_stream));
+      CUDA_TRY(cudaStreamWaitEvent(handle.get_stream(), copy_events[b], 0));
+
+      block_op(d_rows[b].data(),
+               d_cols[b].data(),
+               edgelist_weight_chunks ? std::optional<weight_t*>{d_weights[b].data()}
+                                      : std::nullopt,
+               block_size);
+
+      CUDA_TRY(cudaEventRecord(compute_events[b], handle.get_stream()));
+      ++block_idx;
+    }
+  }
+
+  CUDA_TRY(cudaStreamSynchronize(copy_stream));
+  handle.get_stream_view().synchronize();
+  for (size_t i = 0; i < num_buffers; ++i) {
+    CUDA_TRY(cudaEventDestroy(copy_events[i]));
+    CUDA_TRY(cudaEventDestroy(compute_events[i]));
+  }
+}
+
+// merge (sorted & unique) labels and counts with the (unsorted) vertices in [major_first,
+// major_first + num_edges) (adding 1 to the count per appearance) and [minor_first, minor_first +
+// num_edges) (adding 0)
+template <typename vertex_t, typename edge_t>
+void accumulate_vertex_degrees(raft::handle_t const& handle,
+                               vertex_t const* major_first,
+                               vertex_t const* minor_first,
+                               size_t num_edges,
+                               rmm::device_uvector<vertex_t>& labels /* [INOUT] */,
+                               rmm::device_uvector<edge_t>& counts /* [INOUT] */)
+{
+  rmm::device_uvector<vertex_t> tmp_labels(labels.size() + num_edges * 2, handle.get_stream());
+  rmm::device_uvector<edge_t> tmp_counts(tmp_labels.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), labels.begin(), labels.end(), tmp_labels.begin());
+  thrust::copy(handle.get_thrust_policy(), counts.begin(), counts.end(), tmp_counts.begin());
+  thrust::copy(handle.get_thrust_policy(),
+               major_first,
+               major_first + num_edges,
+               tmp_labels.begin() + labels.size());
+  thrust::copy(handle.get_thrust_policy(),
+               minor_first,
+               minor_first + num_edges,
+               tmp_labels.begin() + labels.size() + num_edges);
+  thrust::fill(handle.get_thrust_policy(),
+               tmp_counts.begin() + counts.size(),
+               tmp_counts.begin() + counts.size() + num_edges,
+               edge_t{1});
+  thrust::fill(handle.get_thrust_policy(),
+               tmp_counts.begin() + counts.size() + num_edges,
+               tmp_counts.end(),
+               edge_t{0});
+  labels.resize(0, handle.get_stream());
+  counts.resize(0, handle.get_stream());
+  labels.shrink_to_fit(handle.get_stream());
+  counts.shrink_to_fit(handle.get_stream());
+
+  thrust::sort_by_key(
+    handle.get_thrust_policy(), tmp_labels.begin(), tmp_labels.end(), tmp_counts.begin());
+  auto num_unique_labels = thrust::count_if(handle.get_thrust_policy(),
+                                            thrust::make_counting_iterator(size_t{0}),
+                                            thrust::make_counting_iterator(tmp_labels.size()),
+                                            [labels = tmp_labels.data()] __device__(auto i) {
+                                              return (i == 0) || (labels[i - 1] != labels[i]);
+                                            });
+  labels.resize(num_unique_labels, handle.get_stream());
+  counts.resize(labels.size(), handle.get_stream());
+  thrust::reduce_by_key(handle.get_thrust_policy(),
+                        tmp_labels.begin(),
+                        tmp_labels.end(),
+                        tmp_counts.begin(),
+                        labels.begin(),
+                        counts.begin());
+}
+
+template <typename vertex_t>
+struct renumber_t {
+  vertex_t const* sorted_labels{nullptr};
+  vertex_t num_labels{0};
+  vertex_t const* new_ids{nullptr};  // new vertex IDs of sorted_labels
+
+  __device__ vertex_t operator()(vertex_t v) const
+  {
+    auto it = thrust::lower_bound(thrust::seq, sorted_labels, sorted_labels + num_labels, v);
+    return new_ids[thrust::distance(sorted_labels, it)];
+  }
+};
+
+// renumber the edges in a block (if renumber_op.has_value() is true) and place the edges in their
+// final positions in the compressed sparse format (positions inside each neighbor list are decided
+// in the order of atomic updates on the cursors)
+template <typename vertex_t, typename edge_t, typename weight_t>
+void renumber_and_place_edges(raft::handle_t const& handle,
+                              vertex_t* majors /* [INOUT] */,
+                              vertex_t* minors /* [INOUT] */,
+                              std::optional<weight_t const*> weights,
+                              size_t num_edges,
+                              std::optional<renumber_t<vertex_t>> renumber_op,
+                              edge_t* cursors /* [INOUT] */,
+                              vertex_t* indices /* [OUT] */,
+                              std::optional<weight_t*> csr_weights /* [OUT] */)
+{
+  if (renumber_op) {
+    thrust::transform(handle.get_thrust_policy(), majors, majors + num_edges, majors, *renumber_op);
+    thrust::transform(handle.get_thrust_policy(), minors, minors + num_edges, minors, *renumber_op);
+  }
+
+  if (weights) {
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors, minors, *weights));
+    thrust::for_each(handle.get_thrust_policy(),
+                     edge_first,
+                     edge_first + num_edges,
+                     [cursors, indices, csr_weights = *csr_weights] __device__(auto e) {
+                       auto idx         = atomicAdd(cursors + thrust::get<0>(e), edge_t{1});
+                       indices[idx]     = thrust::get<1>(e);
+                       csr_weights[idx] = thrust::get<2>(e);
+                     });
+  } else {
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors, minors));
+    thrust::for_each(handle.get_thrust_policy(),
+                     edge_first,
+                     edge_first + num_edges,
+                     [cursors, indices] __device__(auto e) {
+                       auto idx     = atomicAdd(cursors + thrust::get<0>(e), edge_t{1});
+                       indices[idx] = thrust::get<1>(e);
+                     });
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+std::tuple<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>,
+           std::optional<rmm::device_uvector<vertex_t>>>
+create_graph_from_edgelist_chunks_impl(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<vertex_t>>&& vertices,
+  std::vector<vertex_t const*> const& edgelist_row_chunks,
+  std::vector<vertex_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<weight_t const*>> const& edgelist_weight_chunks,
+  std::vector<edge_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS((edgelist_row_chunks.size() == edgelist_chunk_sizes.size()) &&
+                    (edgelist_col_chunks.size() == edgelist_chunk_sizes.size()),
+                  "Invalid input arguments: edgelist_row_chunks.size() and/or "
+                  "edgelist_col_chunks.size() do not coincide with edgelist_chunk_sizes.size().");
+  CUGRAPH_EXPECTS(
+    !edgelist_weight_chunks || ((*edgelist_weight_chunks).size() == edgelist_chunk_sizes.size()),
+    "Invalid input arguments: edgelist_weight_chunks.size() does not coincide with "
+    "edgelist_chunk_sizes.size().");
+  CUGRAPH_EXPECTS(edges_per_block > 0,
+                  "Invalid input arguments: edges_per_block should be positive.");
+
+  auto num_edges =
+    std::accumulate(edgelist_chunk_sizes.begin(), edgelist_chunk_sizes.end(), edge_t{0});
+  auto max_chunk_size =
+    edgelist_chunk_sizes.size() > 0
+      ? static_cast<size_t>(
+          *std::max_element(edgelist_chunk_sizes.begin(), edgelist_chunk_sizes.end()))
+      : size_t{0};
+  // no need to allocate staging buffers larger than the largest chunk
+  edges_per_block = std::min(edges_per_block, std::max(max_chunk_size, size_t{1}));
+
+  // 1. (pass 1) build the sorted unique vertex list and vertex (major) degrees
+
+  rmm::device_uvector<vertex_t> labels(0, handle.get_stream());
+  rmm::device_uvector<edge_t> counts(0, handle.get_stream());
+  if (vertices) {
+    if (do_expensive_check) {
+      rmm::device_uvector<vertex_t> sorted_vertices((*vertices).size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   (*vertices).begin(),
+                   (*vertices).end(),
+                   sorted_vertices.begin());
+      thrust::sort(handle.get_thrust_policy(), sorted_vertices.begin(), sorted_vertices.end());
+      CUGRAPH_EXPECTS(static_cast<size_t>(thrust::distance(
+                        sorted_vertices.begin(),
+                        thrust::unique(handle.get_thrust_policy(),
+                                       sorted_vertices.begin(),
+                                       sorted_vertices.end()))) == sorted_vertices.size(),
+                      "Invalid input argument: vertices should not have duplicates.");
+    }
+    labels = std::move(*vertices);
+    thrust::sort(handle.get_thrust_policy(), labels.begin(), labels.end());
+    labels.resize(
+      thrust::distance(labels.begin(),
+                       thrust::unique(handle.get_thrust_policy(), labels.begin(), labels.end())),
+      handle.get_stream());
+    counts.resize(labels.size(), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), counts.begin(), counts.end(), edge_t{0});
+  }
+  auto input_vertex_list_size =
+    vertices ? std::make_optional<vertex_t>(static_cast<vertex_t>(labels.size())) : std::nullopt;
+  vertices = std::nullopt;
+
+  for_each_edgelist_block<vertex_t, edge_t, weight_t>(
+    handle,
+    edgelist_row_chunks,
+    edgelist_col_chunks,
+    std::nullopt,
+    edgelist_chunk_sizes,
+    edges_per_block,
+    [&handle, &labels, &counts](
+      vertex_t* rows, vertex_t* cols, std::optional<weight_t*>, size_t block_size) {
+      accumulate_vertex_degrees(handle,
+                                store_transposed ? cols : rows,
+                                store_transposed ? rows : cols,
+                                block_size,
+                                labels,
+                                counts);
+    });
+
+  // 2. compute the renumber map (if renumber is true) and the offsets
+
+  vertex_t num_vertices{0};
+  auto renumber_map_labels =
+    renumber ? std::make_optional<rmm::device_uvector<vertex_t>>(0, handle.get_stream())
+             : std::nullopt;
+  auto new_ids =
+    renumber ? std::make_optional<rmm::device_uvector<vertex_t>>(0, handle.get_stream())
+             : std::nullopt;
+  std::optional<std::vector<vertex_t>> segment_offsets{std::nullopt};
+  rmm::device_uvector<edge_t> offsets(0, handle.get_stream());
+  if (renumber) {
+    num_vertices = static_cast<vertex_t>(labels.size());
+
+    // sort vertices by degree (in the descending order) to build the renumber map, new vertex IDs
+    // are the positions in this order
+
+    rmm::device_uvector<vertex_t> perm(num_vertices, handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(), perm.begin(), perm.end(), vertex_t{0});
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        counts.begin(),
+                        counts.end(),
+                        perm.begin(),
+                        thrust::greater<edge_t>());
+    (*renumber_map_labels).resize(num_vertices, handle.get_stream());
+    thrust::gather(handle.get_thrust_policy(),
+                   perm.begin(),
+                   perm.end(),
+                   labels.begin(),
+                   (*renumber_map_labels).begin());
+    (*new_ids).resize(num_vertices, handle.get_stream());
+    thrust::scatter(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(num_vertices),
+                    perm.begin(),
+                    (*new_ids).begin());
+
+    static_assert(detail::num_sparse_segments_per_vertex_partition == 3);
+    std::vector<edge_t> h_thresholds{static_cast<edge_t>(detail::mid_degree_threshold),
+                                     static_cast<edge_t>(detail::low_degree_threshold)};
+    rmm::device_uvector<edge_t> d_thresholds(h_thresholds.size(), handle.get_stream());
+    raft::update_device(
+      d_thresholds.data(), h_thresholds.data(), h_thresholds.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_segment_offsets(d_thresholds.size(), handle.get_stream());
+    thrust::upper_bound(handle.get_thrust_policy(),
+                        counts.begin(),
+                        counts.end(),
+                        d_thresholds.begin(),
+                        d_thresholds.end(),
+                        d_segment_offsets.begin(),
+                        thrust::greater<edge_t>{});
+    segment_offsets =
+      std::vector<vertex_t>(detail::num_sparse_segments_per_vertex_partition + 1, vertex_t{0});
+    (*segment_offsets).back() = num_vertices;
+    raft::update_host((*segment_offsets).data() + 1,
+                      d_segment_offsets.data(),
+                      d_segment_offsets.size(),
+                      handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    offsets.resize(num_vertices + 1, handle.get_stream());
+    offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::inclusive_scan(
+      handle.get_thrust_policy(), counts.begin(), counts.end(), offsets.begin() + 1);
+  } else {
+    if (input_vertex_list_size) {
+      num_vertices = *input_vertex_list_size;
+    } else {
+      num_vertices =
+        labels.size() > 0 ? labels.back_element(handle.get_stream()) + 1 : vertex_t{0};
+    }
+    CUGRAPH_EXPECTS(
+      (labels.size() == 0) || ((labels.front_element(handle.get_stream()) >= 0) &&
+                               (labels.back_element(handle.get_stream()) < num_vertices)),
+      "Invalid input argument: edge list has out-of-range vertex IDs.");
+
+    rmm::device_uvector<edge_t> degrees(num_vertices, handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), degrees.begin(), degrees.end(), edge_t{0});
+    thrust::scatter(
+      handle.get_thrust_policy(), counts.begin(), counts.end(), labels.begin(), degrees.begin());
+    labels.resize(0, handle.get_stream());
+    labels.shrink_to_fit(handle.get_stream());
+
+    offsets.resize(num_vertices + 1, handle.get_stream());
+    offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::inclusive_scan(
+      handle.get_thrust_policy(), degrees.begin(), degrees.end(), offsets.begin() + 1);
+  }
+  counts.resize(0, handle.get_stream());
+  counts.shrink_to_fit(handle.get_stream());
+
+  // 3. (pass 2) renumber the edges (if renumber is true) and place the edges in the compressed
+  // sparse format
+
+  rmm::device_uvector<vertex_t> indices(num_edges, handle.get_stream());
+  auto weights =
+    edgelist_weight_chunks
+      ? std::make_optional<rmm::device_uvector<weight_t>>(num_edges, handle.get_stream())
+      : std::nullopt;
+  {
+    rmm::device_uvector<edge_t> cursors(num_vertices, handle.get_stream());
+    thrust::copy(
+      handle.get_thrust_policy(), offsets.begin(), offsets.end() - 1, cursors.begin());
+    auto renumber_op = renumber ? std::make_optional<renumber_t<vertex_t>>(renumber_t<vertex_t>{
+                                    labels.data(), num_vertices, (*new_ids).data()})
+                                : std::nullopt;
+    for_each_edgelist_block<vertex_t, edge_t, weight_t>(
+      handle,
+      edgelist_row_chunks,
+      edgelist_col_chunks,
+      edgelist_weight_chunks,
+      edgelist_chunk_sizes,
+      edges_per_block,
+      [&handle, renumber_op, &cursors, &indices, &weights](vertex_t* rows,
+                                                          vertex_t* cols,
+                                                          std::optional<weight_t*> block_weights,
+                                                          size_t block_size) {
+        renumber_and_place_edges(
+          handle,
+          store_transposed ? cols : rows,
+          store_transposed ? rows : cols,
+          block_weights ? std::optional<weight_t const*>{*block_weights} : std::nullopt,
+          block_size,
+          renumber_op,
+          cursors.data(),
+          indices.data(),
+          weights ? std::optional<weight_t*>{(*weights).data()} : std::nullopt);
+      });
+  }
+  labels.resize(0, handle.get_stream());
+  labels.shrink_to_fit(handle.get_stream());
+  new_ids = std::nullopt;
+
+  // 4. create a graph (this sorts each neighbor list)
+
+  return std::make_tuple(
+    cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>(
+      handle,
+      std::move(offsets),
+      std::move(indices),
+      std::move(weights),
+      cugraph::graph_meta_t<vertex_t, edge_t, false>{
+        num_vertices, graph_properties, segment_offsets},
+      do_expensive_check),
     std::move(renumber_map_labels));
 }
 
@@ -383,6 +864,7 @@ create_graph_from_edgelist(raft::handle_t const& handle,
                            std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
                            graph_properties_t graph_properties,
                            bool renumber,
+                           multi_edge_reduction_t multi_edge_reduction,
                            bool do_expensive_check)
 {
   return create_graph_from_edgelist_impl<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
@@ -393,6 +875,35 @@ create_graph_from_edgelist(raft::handle_t const& handle,
     std::move(edgelist_weights),
     graph_properties,
     renumber,
+    multi_edge_reduction,
+    do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+std::tuple<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>,
+           std::optional<rmm::device_uvector<vertex_t>>>
+create_graph_from_edgelist_chunks(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<vertex_t>>&& vertices,
+  std::vector<vertex_t const*> const& edgelist_row_chunks,
+  std::vector<vertex_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<weight_t const*>> const& edgelist_weight_chunks,
+  std::vector<edge_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check)
+{
+  return create_graph_from_edgelist_chunks_impl<vertex_t, edge_t, weight_t, store_transposed>(
+    handle,
+    std::move(vertices),
+    edgelist_row_chunks,
+    edgelist_col_chunks,
+    edgelist_weight_chunks,
+    edgelist_chunk_sizes,
+    graph_properties,
+    renumber,
+    edges_per_block,
     do_expensive_check);
 }
 
@@ -19,6 +19,7 @@ namespace cugraph {
 
 // explicit instantiations
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::tuple<cugraph::graph_t<int32_t, int32_t, float, false, true>,
                     std::optional<rmm::device_uvector<int32_t>>>
 create_graph_from_edgelist<int32_t, int32_t, float, false, true>(
@@ -29,6 +30,7 @@ create_graph_from_edgelist<int32_t, int32_t, float, false, true>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int32_t, int32_t, float, true, true>,
@@ -41,8 +43,11 @@ create_graph_from_edgelist<int32_t, int32_t, float, true, true>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::tuple<cugraph::graph_t<int32_t, int32_t, double, false, true>,
                     std::optional<rmm::device_uvector<int32_t>>>
 create_graph_from_edgelist<int32_t, int32_t, double, false, true>(
@@ -53,6 +58,7 @@ create_graph_from_edgelist<int32_t, int32_t, double, false, true>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int32_t, int32_t, double, true, true>,
@@ -65,8 +71,11 @@ create_graph_from_edgelist<int32_t, int32_t, double, true, true>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::tuple<cugraph::graph_t<int32_t, int64_t, float, false, true>,
                     std::optional<rmm::device_uvector<int32_t>>>
 create_graph_from_edgelist<int32_t, int64_t, float, false, true>(
@@ -77,6 +86,7 @@ create_graph_from_edgelist<int32_t, int64_t, float, false, true>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int32_t, int64_t, float, true, true>,
@@ -89,8 +99,11 @@ create_graph_from_edgelist<int32_t, int64_t, float, true, true>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::tuple<cugraph::graph_t<int32_t, int64_t, double, false, true>,
                     std::optional<rmm::device_uvector<int32_t>>>
 create_graph_from_edgelist<int32_t, int64_t, double, false, true>(
@@ -101,6 +114,7 @@ create_graph_from_edgelist<int32_t, int64_t, double, false, true>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int32_t, int64_t, double, true, true>,
@@ -113,8 +127,11 @@ create_graph_from_edgelist<int32_t, int64_t, double, true, true>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::tuple<cugraph::graph_t<int64_t, int64_t, float, false, true>,
                     std::optional<rmm::device_uvector<int64_t>>>
 create_graph_from_edgelist<int64_t, int64_t, float, false, true>(
@@ -125,6 +142,7 @@ create_graph_from_edgelist<int64_t, int64_t, float, false, true>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int64_t, int64_t, float, true, true>,
@@ -137,8 +155,11 @@ create_graph_from_edgelist<int64_t, int64_t, float, true, true>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::tuple<cugraph::graph_t<int64_t, int64_t, double, false, true>,
                     std::optional<rmm::device_uvector<int64_t>>>
 create_graph_from_edgelist<int64_t, int64_t, double, false, true>(
@@ -149,6 +170,7 @@ create_graph_from_edgelist<int64_t, int64_t, double, false, true>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int64_t, int64_t, double, true, true>,
@@ -161,6 +183,8 @@ create_graph_from_edgelist<int64_t, int64_t, double, true, true>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
@@ -19,6 +19,7 @@ namespace cugraph {
 
 // explicit instantiations
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::tuple<cugraph::graph_t<int32_t, int32_t, float, false, false>,
                     std::optional<rmm::device_uvector<int32_t>>>
 create_graph_from_edgelist<int32_t, int32_t, float, false, false>(
@@ -29,6 +30,7 @@ create_graph_from_edgelist<int32_t, int32_t, float, false, false>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int32_t, int32_t, float, true, false>,
@@ -41,8 +43,11 @@ create_graph_from_edgelist<int32_t, int32_t, float, true, false>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::tuple<cugraph::graph_t<int32_t, int32_t, double, false, false>,
                     std::optional<rmm::device_uvector<int32_t>>>
 create_graph_from_edgelist<int32_t, int32_t, double, false, false>(
@@ -53,6 +58,7 @@ create_graph_from_edgelist<int32_t, int32_t, double, false, false>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int32_t, int32_t, double, true, false>,
@@ -65,8 +71,11 @@ create_graph_from_edgelist<int32_t, int32_t, double, true, false>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::tuple<cugraph::graph_t<int32_t, int64_t, float, false, false>,
                     std::optional<rmm::device_uvector<int32_t>>>
 create_graph_from_edgelist<int32_t, int64_t, float, false, false>(
@@ -77,6 +86,7 @@ create_graph_from_edgelist<int32_t, int64_t, float, false, false>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int32_t, int64_t, float, true, false>,
@@ -89,8 +99,11 @@ create_graph_from_edgelist<int32_t, int64_t, float, true, false>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::tuple<cugraph::graph_t<int32_t, int64_t, double, false, false>,
                     std::optional<rmm::device_uvector<int32_t>>>
 create_graph_from_edgelist<int32_t, int64_t, double, false, false>(
@@ -101,6 +114,7 @@ create_graph_from_edgelist<int32_t, int64_t, double, false, false>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int32_t, int64_t, double, true, false>,
@@ -113,8 +127,11 @@ create_graph_from_edgelist<int32_t, int64_t, double, true, false>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::tuple<cugraph::graph_t<int64_t, int64_t, float, false, false>,
                     std::optional<rmm::device_uvector<int64_t>>>
 create_graph_from_edgelist<int64_t, int64_t, float, false, false>(
@@ -125,6 +142,7 @@ create_graph_from_edgelist<int64_t, int64_t, float, false, false>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int64_t, int64_t, float, true, false>,
@@ -137,8 +155,11 @@ create_graph_from_edgelist<int64_t, int64_t, float, true, false>(
   std::optional<rmm::device_uvector<float>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::tuple<cugraph::graph_t<int64_t, int64_t, double, false, false>,
                     std::optional<rmm::device_uvector<int64_t>>>
 create_graph_from_edgelist<int64_t, int64_t, double, false, false>(
@@ -149,6 +170,7 @@ create_graph_from_edgelist<int64_t, int64_t, double, false, false>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
 
 template std::tuple<cugraph::graph_t<int64_t, int64_t, double, true, false>,
@@ -161,6 +183,188 @@ create_graph_from_edgelist<int64_t, int64_t, double, true, false>(
   std::optional<rmm::device_uvector<double>>&& edgelist_weights,
   graph_properties_t graph_properties,
   bool renumber,
+  multi_edge_reduction_t multi_edge_reduction,
   bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::tuple<cugraph::graph_t<int32_t, int32_t, float, false, false>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+create_graph_from_edgelist_chunks<int32_t, int32_t, float, false>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  std::vector<int32_t const*> const& edgelist_row_chunks,
+  std::vector<int32_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<float const*>> const& edgelist_weight_chunks,
+  std::vector<int32_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+
+template std::tuple<cugraph::graph_t<int32_t, int32_t, float, true, false>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+create_graph_from_edgelist_chunks<int32_t, int32_t, float, true>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  std::vector<int32_t const*> const& edgelist_row_chunks,
+  std::vector<int32_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<float const*>> const& edgelist_weight_chunks,
+  std::vector<int32_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::tuple<cugraph::graph_t<int32_t, int32_t, double, false, false>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+create_graph_from_edgelist_chunks<int32_t, int32_t, double, false>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  std::vector<int32_t const*> const& edgelist_row_chunks,
+  std::vector<int32_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<double const*>> const& edgelist_weight_chunks,
+  std::vector<int32_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+
+template std::tuple<cugraph::graph_t<int32_t, int32_t, double, true, false>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+create_graph_from_edgelist_chunks<int32_t, int32_t, double, true>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  std::vector<int32_t const*> const& edgelist_row_chunks,
+  std::vector<int32_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<double const*>> const& edgelist_weight_chunks,
+  std::vector<int32_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::tuple<cugraph::graph_t<int32_t, int64_t, float, false, false>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+create_graph_from_edgelist_chunks<int32_t, int64_t, float, false>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  std::vector<int32_t const*> const& edgelist_row_chunks,
+  std::vector<int32_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<float const*>> const& edgelist_weight_chunks,
+  std::vector<int64_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+
+template std::tuple<cugraph::graph_t<int32_t, int64_t, float, true, false>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+create_graph_from_edgelist_chunks<int32_t, int64_t, float, true>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  std::vector<int32_t const*> const& edgelist_row_chunks,
+  std::vector<int32_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<float const*>> const& edgelist_weight_chunks,
+  std::vector<int64_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::tuple<cugraph::graph_t<int32_t, int64_t, double, false, false>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+create_graph_from_edgelist_chunks<int32_t, int64_t, double, false>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  std::vector<int32_t const*> const& edgelist_row_chunks,
+  std::vector<int32_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<double const*>> const& edgelist_weight_chunks,
+  std::vector<int64_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+
+template std::tuple<cugraph::graph_t<int32_t, int64_t, double, true, false>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+create_graph_from_edgelist_chunks<int32_t, int64_t, double, true>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  std::vector<int32_t const*> const& edgelist_row_chunks,
+  std::vector<int32_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<double const*>> const& edgelist_weight_chunks,
+  std::vector<int64_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::tuple<cugraph::graph_t<int64_t, int64_t, float, false, false>,
+                    std::optional<rmm::device_uvector<int64_t>>>
+create_graph_from_edgelist_chunks<int64_t, int64_t, float, false>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int64_t>>&& vertices,
+  std::vector<int64_t const*> const& edgelist_row_chunks,
+  std::vector<int64_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<float const*>> const& edgelist_weight_chunks,
+  std::vector<int64_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+
+template std::tuple<cugraph::graph_t<int64_t, int64_t, float, true, false>,
+                    std::optional<rmm::device_uvector<int64_t>>>
+create_graph_from_edgelist_chunks<int64_t, int64_t, float, true>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int64_t>>&& vertices,
+  std::vector<int64_t const*> const& edgelist_row_chunks,
+  std::vector<int64_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<float const*>> const& edgelist_weight_chunks,
+  std::vector<int64_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::tuple<cugraph::graph_t<int64_t, int64_t, double, false, false>,
+                    std::optional<rmm::device_uvector<int64_t>>>
+create_graph_from_edgelist_chunks<int64_t, int64_t, double, false>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int64_t>>&& vertices,
+  std::vector<int64_t const*> const& edgelist_row_chunks,
+  std::vector<int64_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<double const*>> const& edgelist_weight_chunks,
+  std::vector<int64_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+
+template std::tuple<cugraph::graph_t<int64_t, int64_t, double, true, false>,
+                    std::optional<rmm::device_uvector<int64_t>>>
+create_graph_from_edgelist_chunks<int64_t, int64_t, double, true>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int64_t>>&& vertices,
+  std::vector<int64_t const*> const& edgelist_row_chunks,
+  std::vector<int64_t const*> const& edgelist_col_chunks,
+  std::optional<std::vector<double const*>> const& edgelist_weight_chunks,
+  std::vector<int64_t> const& edgelist_chunk_sizes,
+  graph_properties_t graph_properties,
+  bool renumber,
+  size_t edges_per_block,
+  bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <structure/renumbered_edgelist_utils.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  bool with_weights)
+{
+  std::vector<size_t> edgelist_edge_counts(graph_view.get_number_of_local_adj_matrix_partitions(),
+                                           size_t{0});
+  for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
+    edgelist_edge_counts[i] =
+      static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_edges(i));
+  }
+  auto number_of_local_edges =
+    std::reduce(edgelist_edge_counts.begin(), edgelist_edge_counts.end());
+
+  // reversing an edge swaps its source and destination, so the majors of the reversed graph are
+  // the minors of graph_view and vice versa (independent of store_transposed)
+
+  rmm::device_uvector<vertex_t> edgelist_majors(number_of_local_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> edgelist_minors(edgelist_majors.size(), handle.get_stream());
+  auto edgelist_weights = (with_weights && graph_view.is_weighted())
+                            ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                edgelist_majors.size(), handle.get_stream())
+                            : std::nullopt;
+  // the edges masked out by the graph_view edge mask (if any) are not reversed
+  size_t cur_size{0};
+  for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
+    cur_size += detail::decompress_matrix_partition_to_unmasked_edgelist(
+      handle,
+      matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+        graph_view.get_matrix_partition_view(i)),
+      edgelist_minors.data() + cur_size,
+      edgelist_majors.data() + cur_size,
+      edgelist_weights ? std::optional<weight_t*>{(*edgelist_weights).data() + cur_size}
+                       : std::nullopt,
+      graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+  }
+  auto number_of_edges = graph_view.get_number_of_edges();
+  if (graph_view.has_edge_mask()) {
+    edgelist_majors.resize(cur_size, handle.get_stream());
+    edgelist_minors.resize(cur_size, handle.get_stream());
+    if (edgelist_weights) { (*edgelist_weights).resize(cur_size, handle.get_stream()); }
+    if constexpr (multi_gpu) {
+      number_of_edges = static_cast<edge_t>(host_scalar_allreduce(
+        handle.get_comms(), cur_size, raft::comms::op_t::SUM, handle.get_stream()));
+    } else {
+      number_of_edges = static_cast<edge_t>(cur_size);
+    }
+  }
+
+  graph_properties_t properties{graph_view.is_symmetric(), graph_view.is_multigraph()};
+
+  auto to_edgelist = [](vertex_t const* majors,
+                        vertex_t const* minors,
+                        std::optional<weight_t const*> weights,
+                        edge_t number_of_edges) {
+    return edgelist_t<vertex_t, edge_t, weight_t>{store_transposed ? minors : majors,
+                                                  store_transposed ? majors : minors,
+                                                  weights,
+                                                  number_of_edges};
+  };
+
+  if constexpr (multi_gpu) {
+    return detail::create_graph_from_renumbered_edgelist<vertex_t,
+                                                         edge_t,
+                                                         weight_t,
+                                                         store_transposed,
+                                                         multi_gpu>(
+      handle,
+      std::move(edgelist_majors),
+      std::move(edgelist_minors),
+      std::move(edgelist_weights),
+      graph_view.get_vertex_partition_lasts(),
+      std::nullopt,
+      graph_view.get_number_of_vertices(),
+      number_of_edges,
+      properties);
+  } else {
+    return graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+      handle,
+      to_edgelist(edgelist_majors.data(),
+                  edgelist_minors.data(),
+                  edgelist_weights ? std::optional<weight_t const*>{(*edgelist_weights).data()}
+                                   : std::nullopt,
+                  number_of_edges),
+      // the reversed graph of a hypersparse graph stores its isolated vertices in the hypersparse
+      // format as well (every vertex is in the hypersparse segment as the reversed graph vertices
+      // are not sorted by degree)
+      graph_meta_t<vertex_t, edge_t, multi_gpu>{
+        graph_view.get_number_of_vertices(),
+        properties,
+        std::nullopt,
+        graph_view.get_matrix_partition_view().get_dcs_nzd_vertices().has_value()});
+  }
+}
+
+}  // namespace cugraph
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <structure/create_reversed_graph_impl.cuh>
+
+namespace cugraph {
+
+// explicit instantiations
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template graph_t<int32_t, int32_t, float, false, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  bool with_weights);
+
+template graph_t<int32_t, int32_t, float, true, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
+  bool with_weights);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template graph_t<int32_t, int32_t, double, false, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  bool with_weights);
+
+template graph_t<int32_t, int32_t, double, true, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
+  bool with_weights);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template graph_t<int32_t, int64_t, float, false, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  bool with_weights);
+
+template graph_t<int32_t, int64_t, float, true, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
+  bool with_weights);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template graph_t<int32_t, int64_t, double, false, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  bool with_weights);
+
+template graph_t<int32_t, int64_t, double, true, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
+  bool with_weights);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template graph_t<int64_t, int64_t, float, false, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  bool with_weights);
+
+template graph_t<int64_t, int64_t, float, true, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
+  bool with_weights);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template graph_t<int64_t, int64_t, double, false, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  bool with_weights);
+
+template graph_t<int64_t, int64_t, double, true, false> create_reversed_graph(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
+  bool with_weights);
+#endif
+
+}  // namespace cugraph
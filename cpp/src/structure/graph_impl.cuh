@@ -24,23 +24,42 @@
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.cuh>
 
+#include <structure/renumbered_edgelist_utils.cuh>
+
 #include <raft/device_atomics.cuh>
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/managed_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/adjacent_difference.h>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/equal.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
+#include <thrust/functional.h>
 #include <thrust/gather.h>
+#include <thrust/sort.h>
+#include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <tuple>
+#include <utility>
 
 namespace cugraph {
 
@@ -86,6 +105,135 @@ struct rebase_offset_t {
   __device__ edge_t operator()(edge_t offset) const { return offset - base_offset; }
 };
 
+// clears the edge mask bits of every stored edge (major, minor) (including the parallel edges),
+// can't use lambda due to nvcc limitations (The enclosing parent function ("delete_edges") for an
+// extended __device__ lambda must allow its address to be taken)
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+struct clear_edge_mask_bits_t {
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> matrix_partition;
+  thrust::optional<vertex_t> major_hypersparse_first{thrust::nullopt};
+  uint32_t* edge_mask{nullptr};
+
+  __device__ void operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    auto major = thrust::get<0>(e);
+    auto minor = thrust::get<1>(e);
+    vertex_t major_idx{};
+    if (major_hypersparse_first && (major >= *major_hypersparse_first)) {
+      auto major_hypersparse_idx =
+        matrix_partition.get_major_hypersparse_idx_from_major_nocheck(major);
+      if (!major_hypersparse_idx) { return; }
+      major_idx = matrix_partition.get_major_offset_from_major_nocheck(*major_hypersparse_first) +
+                  *major_hypersparse_idx;
+    } else {
+      major_idx = matrix_partition.get_major_offset_from_major_nocheck(major);
+    }
+    auto local_offset = matrix_partition.get_local_offset(major_idx);
+    auto local_degree = matrix_partition.get_local_degree(major_idx);
+    auto minors       = matrix_partition.get_minors();
+    // neighbor lists are sorted
+    auto edge_offset = static_cast<edge_t>(thrust::distance(
+      minors,
+      thrust::lower_bound(
+        thrust::seq, minors + local_offset, minors + (local_offset + local_degree), minor)));
+    while ((edge_offset < local_offset + local_degree) && (minors[edge_offset] == minor)) {
+      atomicAnd(edge_mask + edge_offset / edge_t{32},
+                ~(uint32_t{1} << static_cast<uint32_t>(edge_offset % edge_t{32})));
+      ++edge_offset;
+    }
+  }
+};
+
+// number of edge chunks of a major (0 if the major does not have more than chunk_size local
+// edges), can't use lambda due to nvcc limitations (The enclosing parent function
+// ("enable_hub_splitting") for an extended __device__ lambda must allow its address to be taken)
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+struct hub_chunk_count_t {
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> matrix_partition;
+  edge_t chunk_size{};
+
+  __device__ edge_t operator()(vertex_t major_offset) const
+  {
+    auto local_degree = matrix_partition.get_local_degree(major_offset);
+    return local_degree > chunk_size ? (local_degree + chunk_size - 1) / chunk_size : edge_t{0};
+  }
+};
+
+// returns (major offset, offset of the first edge in the major's local edges) of the i'th chunk,
+// can't use lambda due to nvcc limitations (The enclosing parent function ("enable_hub_splitting")
+// for an extended __device__ lambda must allow its address to be taken)
+template <typename vertex_t, typename edge_t>
+struct hub_chunk_t {
+  edge_t const* chunk_count_inclusive_sums{nullptr};
+  vertex_t num_majors{};
+  edge_t chunk_size{};
+
+  __device__ thrust::tuple<vertex_t, edge_t> operator()(edge_t i) const
+  {
+    auto major_offset = static_cast<vertex_t>(thrust::distance(
+      chunk_count_inclusive_sums,
+      thrust::upper_bound(
+        thrust::seq, chunk_count_inclusive_sums, chunk_count_inclusive_sums + num_majors, i)));
+    auto first_chunk = major_offset > 0 ? chunk_count_inclusive_sums[major_offset - 1] : edge_t{0};
+    return thrust::make_tuple(major_offset, (i - first_chunk) * chunk_size);
+  }
+};
+
+// returns (smallest minor, # bits to store minor - smallest minor) of the b'th block of 32 edges
+// (see packed_minors_view_t), can't use lambda due to nvcc limitations (The enclosing parent
+// function ("pack_minors") for an extended __device__ lambda must allow its address to be taken)
+template <typename vertex_t, typename edge_t>
+struct packed_minor_block_t {
+  vertex_t const* indices{nullptr};
+  edge_t number_of_edges{};
+
+  __device__ thrust::tuple<vertex_t, edge_t> operator()(edge_t b) const
+  {
+    auto first     = b * edge_t{32};
+    auto last      = (number_of_edges - first) > edge_t{32} ? first + edge_t{32} : number_of_edges;
+    auto min_minor = indices[first];
+    auto max_minor = min_minor;
+    for (auto i = first + 1; i < last; ++i) {
+      min_minor = indices[i] < min_minor ? indices[i] : min_minor;
+      max_minor = indices[i] > max_minor ? indices[i] : max_minor;
+    }
+    auto range = static_cast<uint64_t>(max_minor - min_minor);
+    return thrust::make_tuple(
+      min_minor,
+      range == 0 ? edge_t{0}
+                 : static_cast<edge_t>(64 - __clzll(static_cast<unsigned long long>(range))));
+  }
+};
+
+// bit-packs the minors of the b'th block of 32 edges (the words of a block are written by a single
+// thread), can't use lambda due to nvcc limitations (The enclosing parent function
+// ("pack_minors") for an extended __device__ lambda must allow its address to be taken)
+template <typename vertex_t, typename edge_t>
+struct pack_minor_block_t {
+  vertex_t const* indices{nullptr};
+  edge_t number_of_edges{};
+  uint32_t* words{nullptr};
+  edge_t const* block_word_offsets{nullptr};
+  vertex_t const* block_bases{nullptr};
+
+  __device__ void operator()(edge_t b) const
+  {
+    auto word_first = block_word_offsets[b];
+    auto width      = static_cast<uint32_t>(block_word_offsets[b + 1] - word_first);
+    if (width == 0) { return; }
+    auto first = b * edge_t{32};
+    auto last  = (number_of_edges - first) > edge_t{32} ? first + edge_t{32} : number_of_edges;
+    for (auto i = first; i < last; ++i) {
+      auto bits  = static_cast<uint64_t>(indices[i] - block_bases[b]);
+      auto bit   = static_cast<uint32_t>(i - first) * width;
+      auto word  = words + (word_first + static_cast<edge_t>(bit / 32));
+      auto shift = bit % 32;
+      *word |= static_cast<uint32_t>(bits << shift);
+      if (shift + width > 32) { *(word + 1) |= static_cast<uint32_t>(bits >> (32 - shift)); }
+    }
+  }
+};
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -368,28 +516,155 @@ compress_edgelist(edgelist_t<vertex_t, edge_t, weight_t> const& edgelist,
     std::move(offsets), std::move(indices), std::move(weights), std::move(dcs_nzd_vertices));
 }
 
+// neighbor lists with up to this many edges are sorted by a single thread (insertion sort) instead
+// of cub's segmented sort (cub's segmented sort assigns a thread block per segment, which is
+// inefficient for short segments, and low degree vertices account for the majority of the vertices
+// in typical power-law graphs)
+constexpr int32_t short_neighbor_list_size_threshold{32};
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct sort_short_neighbor_list_t {
+  edge_t const* offsets{nullptr};
+  vertex_t* indices{nullptr};
+  weight_t* weights{nullptr};  // nullptr if unweighted
+
+  __device__ void operator()(vertex_t i) const
+  {
+    auto first  = offsets[i];
+    auto degree = offsets[i + 1] - first;
+    if ((degree < 2) || (degree > short_neighbor_list_size_threshold)) { return; }
+    auto p_indices = indices + first;
+    auto p_weights = weights != nullptr ? weights + first : static_cast<weight_t*>(nullptr);
+    for (edge_t j = 1; j < degree; ++j) {
+      auto key = p_indices[j];
+      auto w   = p_weights != nullptr ? p_weights[j] : weight_t{};
+      auto k   = j;
+      while ((k > 0) && (p_indices[k - 1] > key)) {
+        p_indices[k] = p_indices[k - 1];
+        if (p_weights != nullptr) { p_weights[k] = p_weights[k - 1]; }
+        --k;
+      }
+      p_indices[k] = key;
+      if (p_weights != nullptr) { p_weights[k] = w; }
+    }
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct is_long_neighbor_list_t {
+  edge_t const* offsets{nullptr};
+
+  __device__ bool operator()(vertex_t i) const
+  {
+    return offsets[i + 1] - offsets[i] > short_neighbor_list_size_threshold;
+  }
+};
+
+// an edge is out of order if its minor is smaller than the previous edge's; such an edge breaks
+// the neighbor list ordering unless it is the first edge of a neighbor list
+template <typename vertex_t, typename edge_t>
+struct is_descent_t {
+  vertex_t const* indices{nullptr};
+
+  __device__ bool operator()(edge_t i) const { return indices[i - 1] > indices[i]; }
+};
+
+template <typename vertex_t, typename edge_t>
+struct is_descent_at_neighbor_list_first_t {
+  edge_t const* offsets{nullptr};
+  vertex_t const* indices{nullptr};
+
+  __device__ bool operator()(vertex_t i) const
+  {
+    auto first = offsets[i];
+    return (first > 0) && (offsets[i + 1] > first) && (indices[first - 1] > indices[first]);
+  }
+};
+
+// returns true if every neighbor list is already sorted, this is a linear pass (# edges + #
+// vertices) and is much cheaper than sort_adjacency_list on already sorted input
+template <typename vertex_t, typename edge_t>
+bool is_adjacency_list_sorted(raft::handle_t const& handle,
+                              edge_t const* offsets,
+                              vertex_t const* indices,
+                              vertex_t num_vertices,
+                              edge_t num_edges)
+{
+  if (num_edges < 2) { return true; }
+
+  auto num_descents =
+    thrust::count_if(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(edge_t{1}),
+                     thrust::make_counting_iterator(num_edges),
+                     is_descent_t<vertex_t, edge_t>{indices});
+  if (num_descents == 0) { return true; }
+  auto num_descents_at_firsts =
+    thrust::count_if(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(vertex_t{0}),
+                     thrust::make_counting_iterator(num_vertices),
+                     is_descent_at_neighbor_list_first_t<vertex_t, edge_t>{offsets, indices});
+  return num_descents == num_descents_at_firsts;
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 void sort_adjacency_list(raft::handle_t const& handle,
                          edge_t const* offsets,
                          vertex_t* indices /* [INOUT} */,
                          std::optional<weight_t*> weights /* [INOUT] */,
                          vertex_t num_vertices,
-                         edge_t num_edges)
+                         edge_t num_edges,
+                         vertex_t minor_last)
 {
-  // FIXME: The current cub's segmented sort based implementation is slower than the global sort
-  // based approach, but we expect cub's segmented sort performance will get significantly better in
-  // few months. We also need to re-evaluate performance & memory overhead of presorting edge list
-  // and running thrust::reduce to update offset vs the current approach after updating the python
-  // interface. If we take r-values of rmm::device_uvector edge list, we can do indcies_ =
-  // std::move(minors) & weights_ = std::move (weights). This affects peak memory use and we may
-  // find the presorting approach more attractive under this scenario.
+  // FIXME: We need to re-evaluate performance & memory overhead of presorting edge list and running
+  // thrust::reduce to update offset vs the current approach after updating the python interface. If
+  // we take r-values of rmm::device_uvector edge list, we can do indcies_ = std::move(minors) &
+  // weights_ = std::move (weights). This affects peak memory use and we may find the presorting
+  // approach more attractive under this scenario.
 
   // 1. Check if there is anything to sort
 
   if (num_edges == 0) { return; }
 
-  // 2. We segmented sort edges in chunks, and we need to adjust chunk offsets as we need to sort
-  // each vertex's neighbors at once.
+  // 2. Sort short neighbor lists in-place, one thread per vertex (no additional memory)
+
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(num_vertices),
+    sort_short_neighbor_list_t<vertex_t, edge_t, weight_t>{
+      offsets, indices, weights ? *weights : static_cast<weight_t*>(nullptr)});
+
+  // 3. Find the vertices with long neighbor lists
+
+  rmm::device_uvector<vertex_t> long_vertices(num_vertices, handle.get_stream());
+  long_vertices.resize(
+    thrust::distance(long_vertices.begin(),
+                     thrust::copy_if(handle.get_thrust_policy(),
+                                     thrust::make_counting_iterator(vertex_t{0}),
+                                     thrust::make_counting_iterator(num_vertices),
+                                     long_vertices.begin(),
+                                     is_long_neighbor_list_t<vertex_t, edge_t>{offsets})),
+    handle.get_stream());
+  long_vertices.shrink_to_fit(handle.get_stream());
+  if (long_vertices.size() == 0) { return; }
+
+  rmm::device_uvector<edge_t> long_segment_firsts(long_vertices.size(), handle.get_stream());
+  rmm::device_uvector<edge_t> long_segment_lasts(long_vertices.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 long_vertices.begin(),
+                 long_vertices.end(),
+                 offsets,
+                 long_segment_firsts.begin());
+  thrust::gather(handle.get_thrust_policy(),
+                 long_vertices.begin(),
+                 long_vertices.end(),
+                 offsets + 1,
+                 long_segment_lasts.begin());
+  long_vertices.resize(0, handle.get_stream());
+  long_vertices.shrink_to_fit(handle.get_stream());
+
+  // 4. We segmented sort the long neighbor lists in chunks to bound the peak memory footprint (each
+  // vertex's neighbor list is sorted in a single chunk).
 
   // to limit memory footprint ((1 << 20) is a tuning parameter)
   auto approx_edges_to_sort_per_iteration =
@@ -401,36 +676,67 @@ void sort_adjacency_list(raft::handle_t const& handle,
                                     });
   auto num_chunks =
     (num_edges + approx_edges_to_sort_per_iteration - 1) / approx_edges_to_sort_per_iteration;
-  rmm::device_uvector<vertex_t> d_vertex_offsets(num_chunks - 1, handle.get_stream());
+  rmm::device_uvector<size_t> d_segment_offsets(num_chunks - 1, handle.get_stream());
   thrust::lower_bound(handle.get_thrust_policy(),
-                      offsets,
-                      offsets + num_vertices + 1,
+                      long_segment_firsts.begin(),
+                      long_segment_firsts.end(),
                       search_offset_first,
-                      search_offset_first + d_vertex_offsets.size(),
-                      d_vertex_offsets.begin());
-  rmm::device_uvector<edge_t> d_edge_offsets(d_vertex_offsets.size(), handle.get_stream());
-  thrust::gather(handle.get_thrust_policy(),
-                 d_vertex_offsets.begin(),
-                 d_vertex_offsets.end(),
-                 offsets,
-                 d_edge_offsets.begin());
-  std::vector<edge_t> h_edge_offsets(num_chunks + 1, edge_t{0});
-  h_edge_offsets.back() = num_edges;
-  raft::update_host(
-    h_edge_offsets.data() + 1, d_edge_offsets.data(), d_edge_offsets.size(), handle.get_stream());
-  std::vector<vertex_t> h_vertex_offsets(num_chunks + 1, vertex_t{0});
-  h_vertex_offsets.back() = num_vertices;
-  raft::update_host(h_vertex_offsets.data() + 1,
-                    d_vertex_offsets.data(),
-                    d_vertex_offsets.size(),
+                      search_offset_first + d_segment_offsets.size(),
+                      d_segment_offsets.begin());
+  std::vector<size_t> h_segment_offsets(num_chunks + 1, size_t{0});
+  h_segment_offsets.back() = long_segment_firsts.size();
+  raft::update_host(h_segment_offsets.data() + 1,
+                    d_segment_offsets.data(),
+                    d_segment_offsets.size(),
                     handle.get_stream());
+  handle.get_stream_view().synchronize();
+  h_segment_offsets.erase(std::unique(h_segment_offsets.begin(), h_segment_offsets.end()),
+                          h_segment_offsets.end());  // remove empty chunks
+  num_chunks = h_segment_offsets.size() - 1;
+
+  // chunk i covers the edge range [h_edge_firsts[i], h_edge_lasts[i]), this range may include short
+  // neighbor lists (already sorted) between long neighbor lists
+  std::vector<edge_t> h_edge_firsts(num_chunks);
+  std::vector<edge_t> h_edge_lasts(num_chunks);
+  {
+    rmm::device_uvector<size_t> d_chunk_segment_offsets(h_segment_offsets.size(),
+                                                        handle.get_stream());
+    raft::update_device(d_chunk_segment_offsets.data(),
+                        h_segment_offsets.data(),
+                        h_segment_offsets.size(),
+                        handle.get_stream());
+    rmm::device_uvector<edge_t> d_edge_firsts(num_chunks, handle.get_stream());
+    rmm::device_uvector<edge_t> d_edge_lasts(num_chunks, handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_chunks),
+      thrust::make_zip_iterator(thrust::make_tuple(d_edge_firsts.begin(), d_edge_lasts.begin())),
+      [chunk_segment_offsets = d_chunk_segment_offsets.data(),
+       segment_firsts        = long_segment_firsts.data(),
+       segment_lasts         = long_segment_lasts.data()] __device__(auto i) {
+        return thrust::make_tuple(segment_firsts[chunk_segment_offsets[i]],
+                                  segment_lasts[chunk_segment_offsets[i + 1] - 1]);
+      });
+    raft::update_host(h_edge_firsts.data(), d_edge_firsts.data(), num_chunks, handle.get_stream());
+    raft::update_host(h_edge_lasts.data(), d_edge_lasts.data(), num_chunks, handle.get_stream());
+    handle.get_stream_view().synchronize();
+  }
 
-  // 3. Segmented sort each vertex's neighbors
+  // 5. Segmented sort each long neighbor list
+
+  // no need to sort the bits that are always 0
+  int end_bit{0};
+  while ((end_bit < static_cast<int>(sizeof(vertex_t) * 8)) &&
+         ((static_cast<uint64_t>(minor_last - 1) >> end_bit) > 0)) {
+    ++end_bit;
+  }
+  end_bit = std::max(end_bit, 1);
 
   size_t max_chunk_size{0};
   for (size_t i = 0; i < num_chunks; ++i) {
     max_chunk_size =
-      std::max(max_chunk_size, static_cast<size_t>(h_edge_offsets[i + 1] - h_edge_offsets[i]));
+      std::max(max_chunk_size, static_cast<size_t>(h_edge_lasts[i] - h_edge_firsts[i]));
   }
   rmm::device_uvector<vertex_t> segment_sorted_indices(max_chunk_size, handle.get_stream());
   auto segment_sorted_weights =
@@ -438,34 +744,52 @@ void sort_adjacency_list(raft::handle_t const& handle,
             : std::nullopt;
   rmm::device_uvector<std::byte> d_temp_storage(0, handle.get_stream());
   for (size_t i = 0; i < num_chunks; ++i) {
+    auto chunk_size   = static_cast<size_t>(h_edge_lasts[i] - h_edge_firsts[i]);
+    auto num_segments = h_segment_offsets[i + 1] - h_segment_offsets[i];
+    // cub's segmented sort does not write to the output positions outside the segments, copy the
+    // input to preserve the (already sorted) short neighbor lists inside this chunk
+    thrust::copy(handle.get_thrust_policy(),
+                 indices + h_edge_firsts[i],
+                 indices + h_edge_lasts[i],
+                 segment_sorted_indices.begin());
+    if (weights) {
+      thrust::copy(handle.get_thrust_policy(),
+                   (*weights) + h_edge_firsts[i],
+                   (*weights) + h_edge_lasts[i],
+                   (*segment_sorted_weights).begin());
+    }
     size_t temp_storage_bytes{0};
-    auto offset_first = thrust::make_transform_iterator(offsets + h_vertex_offsets[i],
-                                                        rebase_offset_t<edge_t>{h_edge_offsets[i]});
+    auto begin_offset_first =
+      thrust::make_transform_iterator(long_segment_firsts.begin() + h_segment_offsets[i],
+                                      rebase_offset_t<edge_t>{h_edge_firsts[i]});
+    auto end_offset_first =
+      thrust::make_transform_iterator(long_segment_lasts.begin() + h_segment_offsets[i],
+                                      rebase_offset_t<edge_t>{h_edge_firsts[i]});
     if (weights) {
       cub::DeviceSegmentedRadixSort::SortPairs(static_cast<void*>(nullptr),
                                                temp_storage_bytes,
-                                               indices + h_edge_offsets[i],
+                                               indices + h_edge_firsts[i],
                                                segment_sorted_indices.data(),
-                                               (*weights) + h_edge_offsets[i],
+                                               (*weights) + h_edge_firsts[i],
                                                (*segment_sorted_weights).data(),
-                                               h_edge_offsets[i + 1] - h_edge_offsets[i],
-                                               h_vertex_offsets[i + 1] - h_vertex_offsets[i],
-                                               offset_first,
-                                               offset_first + 1,
+                                               chunk_size,
+                                               num_segments,
+                                               begin_offset_first,
+                                               end_offset_first,
                                                0,
-                                               sizeof(vertex_t) * 8,
+                                               end_bit,
                                                handle.get_stream());
     } else {
       cub::DeviceSegmentedRadixSort::SortKeys(static_cast<void*>(nullptr),
                                               temp_storage_bytes,
-                                              indices + h_edge_offsets[i],
+                                              indices + h_edge_firsts[i],
                                               segment_sorted_indices.data(),
-                                              h_edge_offsets[i + 1] - h_edge_offsets[i],
-                                              h_vertex_offsets[i + 1] - h_vertex_offsets[i],
-                                              offset_first,
-                                              offset_first + 1,
+                                              chunk_size,
+                                              num_segments,
+                                              begin_offset_first,
+                                              end_offset_first,
                                               0,
-                                              sizeof(vertex_t) * 8,
+                                              end_bit,
                                               handle.get_stream());
     }
     if (temp_storage_bytes > d_temp_storage.size()) {
@@ -474,41 +798,557 @@ void sort_adjacency_list(raft::handle_t const& handle,
     if (weights) {
       cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage.data(),
                                                temp_storage_bytes,
-                                               indices + h_edge_offsets[i],
+                                               indices + h_edge_firsts[i],
                                                segment_sorted_indices.data(),
-                                               (*weights) + h_edge_offsets[i],
+                                               (*weights) + h_edge_firsts[i],
                                                (*segment_sorted_weights).data(),
-                                               h_edge_offsets[i + 1] - h_edge_offsets[i],
-                                               h_vertex_offsets[i + 1] - h_vertex_offsets[i],
-                                               offset_first,
-                                               offset_first + 1,
+                                               chunk_size,
+                                               num_segments,
+                                               begin_offset_first,
+                                               end_offset_first,
                                                0,
-                                               sizeof(vertex_t) * 8,
+                                               end_bit,
                                                handle.get_stream());
     } else {
       cub::DeviceSegmentedRadixSort::SortKeys(d_temp_storage.data(),
                                               temp_storage_bytes,
-                                              indices + h_edge_offsets[i],
+                                              indices + h_edge_firsts[i],
                                               segment_sorted_indices.data(),
-                                              h_edge_offsets[i + 1] - h_edge_offsets[i],
-                                              h_vertex_offsets[i + 1] - h_vertex_offsets[i],
-                                              offset_first,
-                                              offset_first + 1,
+                                              chunk_size,
+                                              num_segments,
+                                              begin_offset_first,
+                                              end_offset_first,
                                               0,
-                                              sizeof(vertex_t) * 8,
+                                              end_bit,
                                               handle.get_stream());
     }
     thrust::copy(handle.get_thrust_policy(),
                  segment_sorted_indices.begin(),
-                 segment_sorted_indices.begin() + (h_edge_offsets[i + 1] - h_edge_offsets[i]),
-                 indices + h_edge_offsets[i]);
+                 segment_sorted_indices.begin() + chunk_size,
+                 indices + h_edge_firsts[i]);
     if (weights) {
       thrust::copy(handle.get_thrust_policy(),
                    (*segment_sorted_weights).begin(),
-                   (*segment_sorted_weights).begin() + (h_edge_offsets[i + 1] - h_edge_offsets[i]),
-                   (*weights) + h_edge_offsets[i]);
+                   (*segment_sorted_weights).begin() + chunk_size,
+                   (*weights) + h_edge_firsts[i]);
+    }
+  }
+}
+
+// find the major of the edge at edge offset e (the major whose neighbor list includes e)
+template <typename vertex_t, typename edge_t>
+__device__ vertex_t major_of_edge(edge_t const* offsets, vertex_t num_vertices, edge_t e)
+{
+  auto it = thrust::upper_bound(thrust::seq, offsets + 1, offsets + (num_vertices + 1), e);
+  return static_cast<vertex_t>(thrust::distance(offsets + 1, it));
+}
+
+// 1 if the edge at edge offset e is the first edge of a group of parallel edges (or not a parallel
+// edge), 0 otherwise, neighbor lists should be sorted
+template <typename vertex_t, typename edge_t>
+struct is_first_parallel_edge_t {
+  edge_t const* offsets{nullptr};
+  vertex_t const* indices{nullptr};
+  vertex_t num_vertices{};
+
+  __device__ edge_t operator()(edge_t e) const
+  {
+    if ((e == 0) || (indices[e] != indices[e - 1])) { return edge_t{1}; }
+    return offsets[major_of_edge(offsets, num_vertices, e)] == e ? edge_t{1} : edge_t{0};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename edge_t>
+struct collapsed_offset_t {
+  edge_t const* group_ids{nullptr};  // inclusive scan of is_first_parallel_edge_t
+
+  __device__ edge_t operator()(edge_t offset) const
+  {
+    return offset == edge_t{0} ? edge_t{0} : group_ids[offset - 1];
+  }
+};
+
+template <typename weight_t>
+struct multi_edge_reduce_op_t {
+  multi_edge_reduction_t reduction{multi_edge_reduction_t::sum};
+
+  __device__ weight_t operator()(weight_t lhs, weight_t rhs) const
+  {
+    if (reduction == multi_edge_reduction_t::min) {
+      return lhs < rhs ? lhs : rhs;
+    } else if (reduction == multi_edge_reduction_t::max) {
+      return lhs < rhs ? rhs : lhs;
+    } else {
+      return lhs + rhs;
+    }
+  }
+};
+
+// collapse each group of parallel edges to a single edge (reducing the edge weights), this takes
+// linear passes over the neighbor lists sorted by sort_adjacency_list (unlike reducing the parallel
+// edges in the input edge list, no additional sort is necessary); offsets may include the DCS
+// (hypersparse) offsets as collapsing does not change whether a vertex has neighbors or not
+template <typename vertex_t, typename edge_t, typename weight_t>
+void reduce_multi_edges(raft::handle_t const& handle,
+                        rmm::device_uvector<edge_t>& offsets /* [INOUT] */,
+                        rmm::device_uvector<vertex_t>& indices /* [INOUT] */,
+                        std::optional<rmm::device_uvector<weight_t>>& weights /* [INOUT] */,
+                        multi_edge_reduction_t reduction)
+{
+  auto num_edges = static_cast<edge_t>(indices.size());
+  if ((reduction == multi_edge_reduction_t::none) || (num_edges < 2)) { return; }
+
+  auto num_vertices = static_cast<vertex_t>(offsets.size() - 1);
+  auto first_op =
+    is_first_parallel_edge_t<vertex_t, edge_t>{offsets.data(), indices.data(), num_vertices};
+
+  rmm::device_uvector<edge_t> group_ids(num_edges, handle.get_stream());
+  thrust::transform_inclusive_scan(handle.get_thrust_policy(),
+                                   thrust::make_counting_iterator(edge_t{0}),
+                                   thrust::make_counting_iterator(num_edges),
+                                   group_ids.begin(),
+                                   first_op,
+                                   thrust::plus<edge_t>{});
+  auto num_groups = group_ids.back_element(handle.get_stream());
+  if (num_groups == num_edges) { return; }
+
+  rmm::device_uvector<vertex_t> collapsed_indices(num_groups, handle.get_stream());
+  thrust::copy_if(handle.get_thrust_policy(),
+                  indices.begin(),
+                  indices.end(),
+                  thrust::make_counting_iterator(edge_t{0}),
+                  collapsed_indices.begin(),
+                  first_op);
+  if (weights) {
+    rmm::device_uvector<weight_t> collapsed_weights(num_groups, handle.get_stream());
+    thrust::reduce_by_key(handle.get_thrust_policy(),
+                          group_ids.begin(),
+                          group_ids.end(),
+                          (*weights).begin(),
+                          thrust::make_discard_iterator(),
+                          collapsed_weights.begin(),
+                          thrust::equal_to<edge_t>{},
+                          multi_edge_reduce_op_t<weight_t>{reduction});
+    *weights = std::move(collapsed_weights);
+  }
+  // offsets are updated last as first_op reads the original offsets
+  thrust::transform(handle.get_thrust_policy(),
+                    offsets.begin(),
+                    offsets.end(),
+                    offsets.begin(),
+                    collapsed_offset_t<edge_t>{group_ids.data()});
+  indices = std::move(collapsed_indices);
+}
+
+// the out-neighbor list copy of a self-loop is kept and the in-neighbor list copy is dropped, an
+// edge appearing in both directions is kept once from the out-neighbor list, an edge appearing in
+// only one direction is kept only if !reciprocal
+template <typename vertex_t, typename edge_t>
+struct is_symmetrized_edge_t {
+  edge_t const* offsets{nullptr};
+  vertex_t const* indices{nullptr};
+  edge_t const* other_offsets{nullptr};  // reversed edges
+  vertex_t const* other_indices{nullptr};
+  vertex_t num_vertices{};
+  bool in_edges{false};  // true if offsets & indices store the reversed edges
+  bool reciprocal{false};
+
+  __device__ edge_t operator()(edge_t e) const
+  {
+    auto major = major_of_edge(offsets, num_vertices, e);
+    auto minor = indices[e];
+    if (major == minor) { return in_edges ? edge_t{0} : edge_t{1}; }
+    auto matched = thrust::binary_search(thrust::seq,
+                                         other_indices + other_offsets[major],
+                                         other_indices + other_offsets[major + 1],
+                                         minor);
+    return in_edges ? static_cast<edge_t>(!matched && !reciprocal)
+                    : static_cast<edge_t>(matched || !reciprocal);
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct symmetrized_degree_t {
+  edge_t const* out_offsets{nullptr};
+  edge_t const* out_ranks{nullptr};  // exclusive sum of the out-edge flags
+  edge_t const* in_offsets{nullptr};
+  edge_t const* in_ranks{nullptr};  // exclusive sum of the in-edge flags
+
+  __device__ edge_t operator()(vertex_t v) const
+  {
+    return (out_ranks[out_offsets[v + 1]] - out_ranks[out_offsets[v]]) +
+           (in_ranks[in_offsets[v + 1]] - in_ranks[in_offsets[v]]);
+  }
+};
+
+// write the kept edges to the symmetrized neighbor lists (out-neighbors first and then the
+// in-neighbors appearing only in the reversed direction, each neighbor list is sorted afterwards),
+// the weight of an edge appearing in both directions is the average of the two edge weights
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct scatter_symmetrized_edges_t {
+  edge_t const* offsets{nullptr};
+  vertex_t const* indices{nullptr};
+  weight_t const* weights{nullptr};  // nullptr if unweighted
+  edge_t const* ranks{nullptr};      // exclusive sum of the edge flags
+  edge_t const* other_offsets{nullptr};
+  vertex_t const* other_indices{nullptr};
+  weight_t const* other_weights{nullptr};  // nullptr if unweighted
+  edge_t const* out_offsets{nullptr};      // to skip the out-neighbors if in_edges is true
+  edge_t const* out_ranks{nullptr};
+  vertex_t const* old_to_new{nullptr};  // nullptr if not renumbering
+  edge_t const* symmetrized_offsets{nullptr};
+  vertex_t* symmetrized_indices{nullptr};
+  weight_t* symmetrized_weights{nullptr};  // nullptr if unweighted
+  vertex_t num_vertices{};
+  bool in_edges{false};
+
+  __device__ void operator()(edge_t e) const
+  {
+    if (ranks[e + 1] == ranks[e]) { return; }
+    auto major = major_of_edge(offsets, num_vertices, e);
+    auto minor = indices[e];
+    auto pos   = ranks[e] - ranks[offsets[major]];
+    if (in_edges) { pos += out_ranks[out_offsets[major + 1]] - out_ranks[out_offsets[major]]; }
+    auto new_major = old_to_new != nullptr ? old_to_new[major] : major;
+    pos += symmetrized_offsets[new_major];
+    symmetrized_indices[pos] = old_to_new != nullptr ? old_to_new[minor] : minor;
+    if (weights != nullptr) {
+      auto w = weights[e];
+      if (!in_edges) {
+        auto other_first = other_indices + other_offsets[major];
+        auto other_last  = other_indices + other_offsets[major + 1];
+        auto it = thrust::lower_bound(thrust::seq, other_first, other_last, minor);
+        if ((it != other_last) && (*it == minor) && (major != minor)) {
+          w = (w + other_weights[other_offsets[major] + thrust::distance(other_first, it)]) /
+              weight_t{2.0};  // average
+        }
+      }
+      symmetrized_weights[pos] = w;
     }
   }
+};
+
+// Symmetrize a single-GPU graph without parallel edges by merging each vertex's (sorted)
+// out-neighbor list with its in-neighbor list. This avoids decompressing the graph to an edge list
+// with both directions of every edge and sorting 2 * # edges edges globally; the in-neighbor lists
+// are built with a counting sort (compress_edgelist) and each neighbor list is sorted separately.
+// Produces the same edges & weights as symmetrize_edgelist. If renumber_map.has_value() is true,
+// the symmetrized graph is renumbered to sort the vertices by degree (and the segment offsets are
+// recomputed).
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<edge_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<vertex_t>>,
+           std::optional<std::vector<vertex_t>>>
+symmetrize_sorted_compressed_sparse(raft::handle_t const& handle,
+                                    rmm::device_uvector<edge_t>&& offsets,
+                                    rmm::device_uvector<vertex_t>&& indices,
+                                    std::optional<rmm::device_uvector<weight_t>>&& weights,
+                                    std::optional<rmm::device_uvector<vertex_t>>&& renumber_map,
+                                    bool reciprocal)
+{
+  auto num_vertices = static_cast<vertex_t>(offsets.size() - 1);
+  auto num_edges    = static_cast<edge_t>(indices.size());
+
+  // 1. build the (sorted) in-neighbor lists
+
+  rmm::device_uvector<edge_t> in_offsets(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> in_indices(0, handle.get_stream());
+  std::optional<rmm::device_uvector<weight_t>> in_weights{std::nullopt};
+  {
+    rmm::device_uvector<vertex_t> majors(num_edges, handle.get_stream());
+    thrust::upper_bound(handle.get_thrust_policy(),
+                        offsets.begin() + 1,
+                        offsets.end(),
+                        thrust::make_counting_iterator(edge_t{0}),
+                        thrust::make_counting_iterator(num_edges),
+                        majors.begin());
+    edgelist_t<vertex_t, edge_t, weight_t> reversed_edgelist{
+      indices.data(),
+      majors.data(),
+      weights ? std::optional<weight_t const*>{(*weights).data()} : std::nullopt,
+      num_edges};
+    std::tie(in_offsets, in_indices, in_weights, std::ignore) =
+      compress_edgelist<false>(reversed_edgelist,
+                               vertex_t{0},
+                               std::optional<vertex_t>{std::nullopt},
+                               num_vertices,
+                               vertex_t{0},
+                               num_vertices,
+                               handle.get_stream_view());
+  }
+  sort_adjacency_list(handle,
+                      in_offsets.data(),
+                      in_indices.data(),
+                      in_weights ? std::optional<weight_t*>{(*in_weights).data()} : std::nullopt,
+                      num_vertices,
+                      num_edges,
+                      num_vertices);
+
+  // 2. flag the edges to keep and rank them within each neighbor list
+
+  rmm::device_uvector<edge_t> out_ranks(static_cast<size_t>(num_edges) + 1, handle.get_stream());
+  rmm::device_uvector<edge_t> in_ranks(out_ranks.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(edge_t{0}),
+                    thrust::make_counting_iterator(num_edges),
+                    out_ranks.begin(),
+                    is_symmetrized_edge_t<vertex_t, edge_t>{offsets.data(),
+                                                            indices.data(),
+                                                            in_offsets.data(),
+                                                            in_indices.data(),
+                                                            num_vertices,
+                                                            false,
+                                                            reciprocal});
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(edge_t{0}),
+                    thrust::make_counting_iterator(num_edges),
+                    in_ranks.begin(),
+                    is_symmetrized_edge_t<vertex_t, edge_t>{in_offsets.data(),
+                                                            in_indices.data(),
+                                                            offsets.data(),
+                                                            indices.data(),
+                                                            num_vertices,
+                                                            true,
+                                                            reciprocal});
+  out_ranks.set_element_to_zero_async(num_edges, handle.get_stream());
+  in_ranks.set_element_to_zero_async(num_edges, handle.get_stream());
+  thrust::exclusive_scan(
+    handle.get_thrust_policy(), out_ranks.begin(), out_ranks.end(), out_ranks.begin());
+  thrust::exclusive_scan(
+    handle.get_thrust_policy(), in_ranks.begin(), in_ranks.end(), in_ranks.begin());
+
+  // 3. compute the symmetrized degrees and (if renumbering) sort the vertices by degree
+
+  rmm::device_uvector<edge_t> symmetrized_offsets(offsets.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(num_vertices),
+                    symmetrized_offsets.begin(),
+                    symmetrized_degree_t<vertex_t, edge_t>{
+                      offsets.data(), out_ranks.data(), in_offsets.data(), in_ranks.data()});
+
+  auto old_to_new = renumber_map ? std::make_optional<rmm::device_uvector<vertex_t>>(
+                                     num_vertices, handle.get_stream())
+                                 : std::nullopt;
+  auto segment_offsets = std::optional<std::vector<vertex_t>>{std::nullopt};
+  if (renumber_map) {
+    rmm::device_uvector<vertex_t> new_to_old(num_vertices, handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(), new_to_old.begin(), new_to_old.end(), vertex_t{0});
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        symmetrized_offsets.begin(),
+                        symmetrized_offsets.begin() + num_vertices,
+                        new_to_old.begin(),
+                        thrust::greater<edge_t>());
+    segment_offsets = detail::compute_degree_segment_offsets<vertex_t, edge_t, false>(
+      handle, symmetrized_offsets.data(), static_cast<size_t>(num_vertices), num_vertices);
+    thrust::scatter(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(num_vertices),
+                    new_to_old.begin(),
+                    (*old_to_new).begin());
+    thrust::gather(handle.get_thrust_policy(),
+                   new_to_old.begin(),
+                   new_to_old.end(),
+                   (*renumber_map).begin(),
+                   new_to_old.begin());  // new_to_old now stores the new renumber map
+    *renumber_map = std::move(new_to_old);
+  }
+  symmetrized_offsets.set_element_to_zero_async(num_vertices, handle.get_stream());
+  thrust::exclusive_scan(handle.get_thrust_policy(),
+                         symmetrized_offsets.begin(),
+                         symmetrized_offsets.end(),
+                         symmetrized_offsets.begin());
+
+  // 4. scatter the kept edges to the symmetrized neighbor lists
+
+  rmm::device_uvector<vertex_t> symmetrized_indices(
+    symmetrized_offsets.back_element(handle.get_stream()), handle.get_stream());
+  auto symmetrized_weights = weights ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                         symmetrized_indices.size(), handle.get_stream())
+                                     : std::nullopt;
+  auto p_weights    = weights ? (*weights).data() : static_cast<weight_t*>(nullptr);
+  auto p_in_weights = in_weights ? (*in_weights).data() : static_cast<weight_t*>(nullptr);
+  auto p_symmetrized_weights =
+    symmetrized_weights ? (*symmetrized_weights).data() : static_cast<weight_t*>(nullptr);
+  auto p_old_to_new = old_to_new ? (*old_to_new).data() : static_cast<vertex_t*>(nullptr);
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(edge_t{0}),
+    thrust::make_counting_iterator(num_edges),
+    scatter_symmetrized_edges_t<vertex_t, edge_t, weight_t>{offsets.data(),
+                                                            indices.data(),
+                                                            p_weights,
+                                                            out_ranks.data(),
+                                                            in_offsets.data(),
+                                                            in_indices.data(),
+                                                            p_in_weights,
+                                                            offsets.data(),
+                                                            out_ranks.data(),
+                                                            p_old_to_new,
+                                                            symmetrized_offsets.data(),
+                                                            symmetrized_indices.data(),
+                                                            p_symmetrized_weights,
+                                                            num_vertices,
+                                                            false});
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(edge_t{0}),
+    thrust::make_counting_iterator(num_edges),
+    scatter_symmetrized_edges_t<vertex_t, edge_t, weight_t>{in_offsets.data(),
+                                                            in_indices.data(),
+                                                            p_in_weights,
+                                                            in_ranks.data(),
+                                                            offsets.data(),
+                                                            indices.data(),
+                                                            p_weights,
+                                                            offsets.data(),
+                                                            out_ranks.data(),
+                                                            p_old_to_new,
+                                                            symmetrized_offsets.data(),
+                                                            symmetrized_indices.data(),
+                                                            p_symmetrized_weights,
+                                                            num_vertices,
+                                                            true});
+
+  return std::make_tuple(std::move(symmetrized_offsets),
+                         std::move(symmetrized_indices),
+                         std::move(symmetrized_weights),
+                         std::move(renumber_map),
+                         std::move(segment_offsets));
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::shared_ptr<detail::hub_split_t<vertex_t, edge_t>> compute_hub_split(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  edge_t chunk_size)
+{
+  auto hub_split        = std::make_shared<detail::hub_split_t<vertex_t, edge_t>>();
+  hub_split->chunk_size = chunk_size;
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto matrix_partition = matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+      graph_view.get_matrix_partition_view(i));
+    auto segment_offsets = graph_view.get_local_adj_matrix_partition_segment_offsets(i);
+
+    // only the majors in the high degree segment (processed by a thread block per major) are split
+    auto num_majors = segment_offsets ? (*segment_offsets)[1] : vertex_t{0};
+    rmm::device_uvector<edge_t> chunk_counts(num_majors, handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(num_majors),
+      chunk_counts.begin(),
+      hub_chunk_count_t<vertex_t, edge_t, weight_t, multi_gpu>{matrix_partition, chunk_size});
+    thrust::inclusive_scan(
+      handle.get_thrust_policy(), chunk_counts.begin(), chunk_counts.end(), chunk_counts.begin());
+    auto num_chunks = num_majors > 0 ? chunk_counts.back_element(handle.get_stream()) : edge_t{0};
+
+    hub_split->chunk_major_offsets.emplace_back(num_chunks, handle.get_stream());
+    hub_split->chunk_edge_offsets.emplace_back(num_chunks, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(edge_t{0}),
+                      thrust::make_counting_iterator(num_chunks),
+                      thrust::make_zip_iterator(thrust::make_tuple(
+                        hub_split->chunk_major_offsets.back().begin(),
+                        hub_split->chunk_edge_offsets.back().begin())),
+                      hub_chunk_t<vertex_t, edge_t>{chunk_counts.data(), num_majors, chunk_size});
+  }
+  // views obtained from the same graph_t object may be used on other streams
+  handle.get_stream_view().synchronize();
+
+  return hub_split;
+}
+
+// allocates with cudaMallocHost, the allocations are accessible from the device (with the unified
+// virtual addressing) without migrating to the device memory
+class pinned_host_memory_resource_t : public rmm::mr::device_memory_resource {
+ public:
+  bool supports_streams() const noexcept override { return false; }
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view) override
+  {
+    void* ptr{nullptr};
+    if (bytes > 0) { CUDA_TRY(cudaMallocHost(&ptr, bytes)); }
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t, rmm::cuda_stream_view) override
+  {
+    if (ptr != nullptr) { cudaFreeHost(ptr); }
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view) const override
+  {
+    return std::make_pair(std::size_t{0}, std::size_t{0});
+  }
+};
+
+void check_edge_memory_placement(edge_memory_placement_t placement)
+{
+  if (placement == edge_memory_placement_t::managed) {
+    int device{0};
+    int concurrent_managed_access{0};
+    CUDA_TRY(cudaGetDevice(&device));
+    CUDA_TRY(cudaDeviceGetAttribute(
+      &concurrent_managed_access, cudaDevAttrConcurrentManagedAccess, device));
+    CUGRAPH_EXPECTS(concurrent_managed_access != 0,
+                    "Invalid input argument: placing the edges in the managed memory requires a "
+                    "GPU supporting concurrent managed access.");
+  }
+}
+
+// moves an edge array to the memory of placement (this is a no-op if already there, e.g. if the
+// graph is created with a managed memory resource as the current device resource, so graphs
+// larger than the device memory can be placed in the managed memory)
+template <typename T>
+rmm::device_uvector<T> move_to_edge_memory(raft::handle_t const& handle,
+                                           rmm::device_uvector<T>&& array,
+                                           edge_memory_placement_t placement)
+{
+  static rmm::mr::managed_memory_resource managed_mr{};
+  static pinned_host_memory_resource_t pinned_host_mr{};
+
+  auto memory_type = cudaMemoryTypeUnregistered;
+  if (array.size() > 0) {
+    cudaPointerAttributes attributes{};
+    CUDA_TRY(cudaPointerGetAttributes(&attributes, array.data()));
+    memory_type = attributes.type;
+  }
+
+  auto ret = std::move(array);
+  if (((placement == edge_memory_placement_t::device) && (memory_type != cudaMemoryTypeDevice)) ||
+      ((placement == edge_memory_placement_t::managed) && (memory_type != cudaMemoryTypeManaged)) ||
+      ((placement == edge_memory_placement_t::pinned_host) &&
+       (memory_type != cudaMemoryTypeHost))) {
+    rmm::mr::device_memory_resource* mr{nullptr};
+    if (placement == edge_memory_placement_t::device) {
+      mr = rmm::mr::get_current_device_resource();
+    } else if (placement == edge_memory_placement_t::managed) {
+      mr = &managed_mr;
+    } else {
+      mr = &pinned_host_mr;
+    }
+    rmm::device_uvector<T> tmp(ret.size(), handle.get_stream(), mr);
+    raft::copy(tmp.data(), ret.data(), ret.size(), handle.get_stream());
+    ret = std::move(tmp);  // frees the old array (stream ordered)
+  }
+  if ((placement == edge_memory_placement_t::managed) && (ret.size() > 0)) {
+    int device{0};
+    CUDA_TRY(cudaGetDevice(&device));
+    CUDA_TRY(
+      cudaMemAdvise(ret.data(), ret.size() * sizeof(T), cudaMemAdviseSetReadMostly, device));
+  }
+
+  return ret;
 }
 
 }  // namespace
@@ -608,7 +1448,7 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
         "Invalid input argument: meta.property.is_symmetric is true but the input edge list is not "
         "symmetric.");
     }
-    if (!this->is_multigraph()) {
+    if (!this->is_multigraph() && (meta.multi_edge_reduction == multi_edge_reduction_t::none)) {
       CUGRAPH_EXPECTS(
         check_no_parallel_edge(handle, edgelists),
         "Invalid input argument: meta.property.is_multigraph is false but the input edge list has "
@@ -661,30 +1501,10 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
   // aggregate segment_offsets
 
   if (meta.segment_offsets) {
-    // FIXME: we need to add host_allgather
-    rmm::device_uvector<vertex_t> d_segment_offsets((*(meta.segment_offsets)).size(),
-                                                    default_stream_view);
-    raft::update_device(d_segment_offsets.data(),
-                        (*(meta.segment_offsets)).data(),
-                        (*(meta.segment_offsets)).size(),
-                        default_stream_view.value());
-    rmm::device_uvector<vertex_t> d_aggregate_segment_offsets(
-      col_comm_size * d_segment_offsets.size(), default_stream_view);
-    col_comm.allgather(d_segment_offsets.data(),
-                       d_aggregate_segment_offsets.data(),
-                       d_segment_offsets.size(),
-                       default_stream_view.value());
-
+    // host_allgather synchronizes the stream (adj_matrix_partition_segment_offsets_ can be used
+    // right after return)
     adj_matrix_partition_segment_offsets_ =
-      std::vector<vertex_t>(d_aggregate_segment_offsets.size(), vertex_t{0});
-    raft::update_host((*adj_matrix_partition_segment_offsets_).data(),
-                      d_aggregate_segment_offsets.data(),
-                      d_aggregate_segment_offsets.size(),
-                      default_stream_view.value());
-
-    default_stream_view
-      .synchronize();  // this is necessary as adj_matrix_partition_segment_offsets_ can be used
-                       // right after return.
+      host_allgather(col_comm, *(meta.segment_offsets), default_stream_view.value());
   }
 
   // compress edge list (COO) to CSR (or CSC) or CSR + DCSR (CSC + DCSC) hybrid
@@ -739,7 +1559,30 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
                           ? std::optional<weight_t*>{(*adj_matrix_partition_weights_)[i].data()}
                           : std::nullopt,
                         static_cast<vertex_t>(adj_matrix_partition_offsets_[i].size() - 1),
-                        static_cast<edge_t>(adj_matrix_partition_indices_[i].size()));
+                        static_cast<edge_t>(adj_matrix_partition_indices_[i].size()),
+                        partition_.get_matrix_partition_minor_last());
+  }
+
+  // collapse parallel edges
+
+  if (meta.multi_edge_reduction != multi_edge_reduction_t::none) {
+    edge_t number_of_local_edges{0};
+    for (size_t i = 0; i < adj_matrix_partition_offsets_.size(); ++i) {
+      auto weights = adj_matrix_partition_weights_
+                       ? std::make_optional<rmm::device_uvector<weight_t>>(
+                           std::move((*adj_matrix_partition_weights_)[i]))
+                       : std::nullopt;
+      reduce_multi_edges(handle,
+                         adj_matrix_partition_offsets_[i],
+                         adj_matrix_partition_indices_[i],
+                         weights,
+                         meta.multi_edge_reduction);
+      if (weights) { (*adj_matrix_partition_weights_)[i] = std::move(*weights); }
+      number_of_local_edges += static_cast<edge_t>(adj_matrix_partition_indices_[i].size());
+    }
+    this->set_number_of_edges(host_scalar_allreduce(
+      comm, number_of_local_edges, raft::comms::op_t::SUM, default_stream_view.value()));
+    this->set_graph_properties(graph_properties_t{this->is_symmetric(), false});
   }
 
   // if # unique edge rows/cols << V / row_comm_size|col_comm_size, store unique edge rows/cols to
@@ -900,6 +1743,33 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
       local_sorted_unique_edge_col_offsets_ = std::move(h_key_offsets);
     }
   }
+
+  // store minors as 32 bit offsets from the matrix partition minor first if vertex_t is wider
+  // than 32 bit and the local minor range fits in 32 bit (this halves the index memory footprint
+  // and the memory traffic in reading the indices)
+
+  if constexpr (sizeof(vertex_t) > sizeof(uint32_t)) {
+    auto minor_first = partition_.get_matrix_partition_minor_first();
+    if (static_cast<uint64_t>(partition_.get_matrix_partition_minor_size()) <=
+        static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())) {
+      adj_matrix_partition_compressed_indices_ = std::vector<rmm::device_uvector<uint32_t>>{};
+      (*adj_matrix_partition_compressed_indices_).reserve(adj_matrix_partition_indices_.size());
+      for (size_t i = 0; i < adj_matrix_partition_indices_.size(); ++i) {
+        rmm::device_uvector<uint32_t> compressed_indices(adj_matrix_partition_indices_[i].size(),
+                                                         handle.get_stream());
+        thrust::transform(handle.get_thrust_policy(),
+                          adj_matrix_partition_indices_[i].begin(),
+                          adj_matrix_partition_indices_[i].end(),
+                          compressed_indices.begin(),
+                          [minor_first] __device__(auto minor) {
+                            return static_cast<uint32_t>(minor - minor_first);
+                          });
+        adj_matrix_partition_indices_[i].resize(0, handle.get_stream());
+        adj_matrix_partition_indices_[i].shrink_to_fit(handle.get_stream());
+        (*adj_matrix_partition_compressed_indices_).push_back(std::move(compressed_indices));
+      }
+    }
+  }
 }
 
 template <typename vertex_t,
@@ -935,7 +1805,8 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
 
   CUGRAPH_EXPECTS(
     !segment_offsets_.has_value() ||
-      ((*segment_offsets_).size() == (detail::num_sparse_segments_per_vertex_partition + 1)),
+      ((*segment_offsets_).size() == (detail::num_sparse_segments_per_vertex_partition + 1)) ||
+      ((*segment_offsets_).size() == (detail::num_sparse_segments_per_vertex_partition + 2)),
     "Invalid input argument: (*(meta.segment_offsets)).size() returns an invalid value.");
 
   // optional expensive checks
@@ -960,7 +1831,7 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
         "Invalid input argument: meta.property.is_symmetric is true but the input edge list is not "
         "symmetric.");
     }
-    if (!this->is_multigraph()) {
+    if (!this->is_multigraph() && (meta.multi_edge_reduction == multi_edge_reduction_t::none)) {
       CUGRAPH_EXPECTS(
         check_no_parallel_edge(handle,
                                std::vector<edgelist_t<vertex_t, edge_t, weight_t>>{edgelist}),
@@ -969,17 +1840,144 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
     }
   }
 
-  // convert edge list (COO) to compressed sparse format (CSR or CSC)
+  // find the hypersparse segment, the isolated vertices follow the non-isolated vertices if the
+  // vertices are sorted by degree, the hypersparse segment covers every vertex otherwise
 
-  std::tie(offsets_, indices_, weights_, std::ignore) =
+  auto use_dcs =
+    meta.use_dcs ||
+    (segment_offsets_ &&
+     ((*segment_offsets_).size() == (detail::num_sparse_segments_per_vertex_partition + 2)));
+  auto major_hypersparse_first = std::optional<vertex_t>{std::nullopt};
+  if (use_dcs) {
+    if (!segment_offsets_) {
+      segment_offsets_ =
+        std::vector<vertex_t>(detail::num_sparse_segments_per_vertex_partition + 2, vertex_t{0});
+      (*segment_offsets_).back() = this->get_number_of_vertices();
+    } else if ((*segment_offsets_).size() ==
+               (detail::num_sparse_segments_per_vertex_partition + 1)) {
+      auto majors = store_transposed ? edgelist.p_dst_vertices : edgelist.p_src_vertices;
+      auto num_nzd_vertices =
+        edgelist.number_of_edges > 0
+          ? thrust::reduce(handle.get_thrust_policy(),
+                           majors,
+                           majors + edgelist.number_of_edges,
+                           vertex_t{0},
+                           thrust::maximum<vertex_t>{}) +
+              vertex_t{1}
+          : vertex_t{0};
+      auto low_degree_first =
+        (*segment_offsets_)[detail::num_sparse_segments_per_vertex_partition - 1];
+      (*segment_offsets_)
+        .insert((*segment_offsets_).end() - 1, std::max(num_nzd_vertices, low_degree_first));
+    }
+    major_hypersparse_first =
+      (*segment_offsets_)[detail::num_sparse_segments_per_vertex_partition];
+  }
+
+  // convert edge list (COO) to compressed sparse format (CSR or CSC, + DCSR or DCSC for the
+  // hypersparse segment)
+
+  std::tie(offsets_, indices_, weights_, dcs_nzd_vertices_) =
     compress_edgelist<store_transposed>(edgelist,
                                         vertex_t{0},
-                                        std::optional<vertex_t>{std::nullopt},
+                                        major_hypersparse_first,
                                         this->get_number_of_vertices(),
                                         vertex_t{0},
                                         this->get_number_of_vertices(),
                                         default_stream_view);
 
+  // segmented sort neighbors (compressed sparse input from upstream systems is often already
+  // sorted, and checking this takes a linear pass)
+
+  if (!is_adjacency_list_sorted(handle,
+                                offsets_.data(),
+                                indices_.data(),
+                                static_cast<vertex_t>(offsets_.size() - 1),
+                                static_cast<edge_t>(indices_.size()))) {
+    sort_adjacency_list(handle,
+                        offsets_.data(),
+                        indices_.data(),
+                        weights_ ? std::optional<weight_t*>{(*weights_).data()} : std::nullopt,
+                        static_cast<vertex_t>(offsets_.size() - 1),
+                        static_cast<edge_t>(indices_.size()),
+                        this->get_number_of_vertices());
+  }
+
+  // collapse parallel edges (segment_offsets_, if provided, are computed from the degrees before
+  // collapsing; they remain valid for partitioning the work but may no longer be tight)
+
+  if (meta.multi_edge_reduction != multi_edge_reduction_t::none) {
+    reduce_multi_edges(handle, offsets_, indices_, weights_, meta.multi_edge_reduction);
+    this->set_number_of_edges(static_cast<edge_t>(indices_.size()));
+    this->set_graph_properties(graph_properties_t{this->is_symmetric(), false});
+  }
+
+  // compute the segment offsets if the vertices are already sorted by degree (e.g. the input is
+  // renumbered upstream), otherwise the graph is processed without the degree based segments
+
+  if (!segment_offsets_ && (this->get_number_of_vertices() > 0)) {
+    rmm::device_uvector<edge_t> degrees(offsets_.size() - 1, handle.get_stream());
+    thrust::adjacent_difference(
+      handle.get_thrust_policy(), offsets_.begin() + 1, offsets_.end(), degrees.begin());
+    if (thrust::is_sorted(
+          handle.get_thrust_policy(), degrees.begin(), degrees.end(), thrust::greater<edge_t>{})) {
+      segment_offsets_ = detail::compute_degree_segment_offsets<vertex_t, edge_t, false>(
+        handle, degrees.data(), degrees.size(), this->get_number_of_vertices());
+    }
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  graph_t(raft::handle_t const& handle,
+          rmm::device_uvector<edge_t>&& offsets,
+          rmm::device_uvector<vertex_t>&& indices,
+          std::optional<rmm::device_uvector<weight_t>>&& weights,
+          graph_meta_t<vertex_t, edge_t, multi_gpu> meta,
+          bool do_expensive_check)
+  : detail::graph_base_t<vertex_t, edge_t, weight_t>(
+      handle, meta.number_of_vertices, static_cast<edge_t>(indices.size()), meta.properties),
+    offsets_(std::move(offsets)),
+    indices_(std::move(indices)),
+    weights_(std::move(weights)),
+    segment_offsets_(meta.segment_offsets)
+{
+  // cheap error checks
+
+  CUGRAPH_EXPECTS(offsets_.size() == static_cast<size_t>(this->get_number_of_vertices()) + 1,
+                  "Invalid input argument: offsets.size() should be meta.number_of_vertices + 1.");
+  CUGRAPH_EXPECTS(!weights_.has_value() || ((*weights_).size() == indices_.size()),
+                  "Invalid input argument: weights.size() should coincide with indices.size().");
+
+  CUGRAPH_EXPECTS(
+    !segment_offsets_.has_value() ||
+      ((*segment_offsets_).size() == (detail::num_sparse_segments_per_vertex_partition + 1)),
+    "Invalid input argument: (*(meta.segment_offsets)).size() returns an invalid value.");
+
+  // optional expensive checks
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(thrust::is_sorted(handle.get_thrust_policy(), offsets_.begin(), offsets_.end()),
+                    "Invalid input argument: offsets should be sorted.");
+    CUGRAPH_EXPECTS((offsets_.front_element(handle.get_stream()) == edge_t{0}) &&
+                      (offsets_.back_element(handle.get_stream()) ==
+                       static_cast<edge_t>(indices_.size())),
+                    "Invalid input argument: offsets should start with 0 and end with the number "
+                    "of edges.");
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(thrust::make_constant_iterator(vertex_t{0}), indices_.begin()));
+    CUGRAPH_EXPECTS(
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_first,
+                       edge_first + indices_.size(),
+                       out_of_range_t<vertex_t>{0, 1, 0, this->get_number_of_vertices()}) == 0,
+      "Invalid input argument: indices have out-of-range values.");
+  }
+
   // segmented sort neighbors
 
   sort_adjacency_list(handle,
@@ -987,7 +1985,16 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
                       indices_.data(),
                       weights_ ? std::optional<weight_t*>{(*weights_).data()} : std::nullopt,
                       static_cast<vertex_t>(offsets_.size() - 1),
-                      static_cast<edge_t>(indices_.size()));
+                      static_cast<edge_t>(indices_.size()),
+                      this->get_number_of_vertices());
+
+  // collapse parallel edges
+
+  if (meta.multi_edge_reduction != multi_edge_reduction_t::none) {
+    reduce_multi_edges(handle, offsets_, indices_, weights_, meta.multi_edge_reduction);
+    this->set_number_of_edges(static_cast<edge_t>(indices_.size()));
+    this->set_graph_properties(graph_properties_t{this->is_symmetric(), false});
+  }
 }
 
 template <typename vertex_t,
@@ -1049,6 +2056,31 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
   auto is_multigraph      = this->is_multigraph();
   bool renumber           = renumber_map.has_value();
 
+  // the neighbor lists are sorted, so symmetrize by merging each vertex's out- and in-neighbor
+  // lists (this requires matching parallel edges by weight to reproduce symmetrize_edgelist's
+  // result, so multigraphs take the edge list path below, and so do graphs with deleted edges as
+  // offsets_ and indices_ still store the deleted edges and graphs in the hypersparse format or
+  // with bit-packed minors)
+  if (!is_multigraph && !edge_mask_ && !dcs_nzd_vertices_ && !packed_minors_) {
+    auto [offsets, indices, weights, new_renumber_map, segment_offsets] =
+      symmetrize_sorted_compressed_sparse(handle,
+                                          std::move(offsets_),
+                                          std::move(indices_),
+                                          std::move(weights_),
+                                          std::move(renumber_map),
+                                          reciprocal);
+    *this = graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+      handle,
+      std::move(offsets),
+      std::move(indices),
+      std::move(weights),
+      graph_meta_t<vertex_t, edge_t, multi_gpu>{
+        number_of_vertices, graph_properties_t{is_multigraph, true}, std::move(segment_offsets)},
+      false);
+
+    return std::move(new_renumber_map);
+  }
+
   auto [edgelist_rows, edgelist_cols, edgelist_weights] =
     this->decompress_to_edgelist(handle, renumber_map, true);
 
@@ -1238,6 +2270,744 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
     renumber);
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  delete_edges(raft::handle_t const& handle,
+               vertex_t const* edgelist_rows,
+               vertex_t const* edgelist_cols,
+               size_t num_edges,
+               bool do_expensive_check)
+{
+  auto& comm               = handle.get_comms();
+  auto const comm_size     = comm.get_size();
+  auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+  auto const row_comm_size = row_comm.get_size();
+
+  CUGRAPH_EXPECTS(
+    (num_edges == 0) || ((edgelist_rows != nullptr) && (edgelist_cols != nullptr)),
+    "Invalid input argument: edgelist_rows and edgelist_cols should not be nullptr if num_edges > "
+    "0.");
+
+  if (do_expensive_check) {
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(edgelist_rows, edgelist_cols));
+    auto num_invalid_edges =
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_first,
+                       edge_first + num_edges,
+                       out_of_range_t<vertex_t>{vertex_t{0},
+                                                this->get_number_of_vertices(),
+                                                vertex_t{0},
+                                                this->get_number_of_vertices()});
+    CUGRAPH_EXPECTS(host_scalar_allreduce(
+                      comm, num_invalid_edges, raft::comms::op_t::SUM, handle.get_stream()) == 0,
+                    "Invalid input argument: edgelist_rows and edgelist_cols have out-of-range "
+                    "values.");
+  }
+
+  // 1. shuffle the edges to delete to the GPUs storing them and groupby the local adjacency matrix
+  // partitions (major ranges of the local adjacency matrix partitions are non-overlapping and
+  // increasing)
+
+  rmm::device_uvector<vertex_t> majors(num_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(num_edges, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               store_transposed ? edgelist_cols : edgelist_rows,
+               (store_transposed ? edgelist_cols : edgelist_rows) + num_edges,
+               majors.begin());
+  thrust::copy(handle.get_thrust_policy(),
+               store_transposed ? edgelist_rows : edgelist_cols,
+               (store_transposed ? edgelist_rows : edgelist_cols) + num_edges,
+               minors.begin());
+
+  auto vertex_partition_lasts = partition_.get_vertex_partition_lasts();
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                         handle.get_stream());
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      vertex_partition_lasts.data(),
+                      vertex_partition_lasts.size(),
+                      handle.get_stream());
+
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+  std::forward_as_tuple(std::tie(majors, minors), std::ignore) = groupby_gpuid_and_shuffle_values(
+    comm,
+    pair_first,
+    pair_first + majors.size(),
+    detail::renumbered_edge_to_gpu_id_t<vertex_t>{
+      d_vertex_partition_lasts.data(), comm_size, row_comm_size},
+    handle.get_stream());
+  pair_first = thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+  thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + majors.size());
+
+  // 2. clear the edge mask bits of the edges to delete
+
+  auto graph_view = this->view();
+
+  if (!edge_mask_) {
+    edge_mask_ = std::vector<rmm::device_uvector<uint32_t>>{};
+    (*edge_mask_).reserve(graph_view.get_number_of_local_adj_matrix_partitions());
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      rmm::device_uvector<uint32_t> edge_mask(
+        (static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_edges(i)) + 31) /
+          32,
+        handle.get_stream());
+      thrust::fill(handle.get_thrust_policy(),
+                   edge_mask.begin(),
+                   edge_mask.end(),
+                   std::numeric_limits<uint32_t>::max());
+      (*edge_mask_).push_back(std::move(edge_mask));
+    }
+  }
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto [major_first, major_last] = partition_.get_matrix_partition_major_range(i);
+    auto first                     = thrust::distance(
+      majors.begin(),
+      thrust::lower_bound(handle.get_thrust_policy(), majors.begin(), majors.end(), major_first));
+    auto last = thrust::distance(
+      majors.begin(),
+      thrust::lower_bound(handle.get_thrust_policy(), majors.begin(), majors.end(), major_last));
+    auto segment_offsets = graph_view.get_local_adj_matrix_partition_segment_offsets(i);
+    auto use_dcs =
+      segment_offsets
+        ? ((*segment_offsets).size() > (detail::num_sparse_segments_per_vertex_partition + 1))
+        : false;
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      pair_first + first,
+      pair_first + last,
+      clear_edge_mask_bits_t<vertex_t, edge_t, weight_t, multi_gpu>{
+        matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+          graph_view.get_matrix_partition_view(i)),
+        use_dcs ? thrust::optional<vertex_t>{major_first +
+                                             (*segment_offsets)
+                                               [detail::num_sparse_segments_per_vertex_partition]}
+                : thrust::nullopt,
+        (*edge_mask_)[i].data()});
+  }
+
+  reversed_graph_.reset();
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  delete_edges(raft::handle_t const& handle,
+               vertex_t const* edgelist_rows,
+               vertex_t const* edgelist_cols,
+               size_t num_edges,
+               bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(
+    (num_edges == 0) || ((edgelist_rows != nullptr) && (edgelist_cols != nullptr)),
+    "Invalid input argument: edgelist_rows and edgelist_cols should not be nullptr if num_edges > "
+    "0.");
+
+  auto edge_first = thrust::make_zip_iterator(
+    thrust::make_tuple(store_transposed ? edgelist_cols : edgelist_rows,
+                       store_transposed ? edgelist_rows : edgelist_cols));
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                     edge_first,
+                                     edge_first + num_edges,
+                                     out_of_range_t<vertex_t>{vertex_t{0},
+                                                              this->get_number_of_vertices(),
+                                                              vertex_t{0},
+                                                              this->get_number_of_vertices()}) ==
+                      0,
+                    "Invalid input argument: edgelist_rows and edgelist_cols have out-of-range "
+                    "values.");
+  }
+
+  if (!edge_mask_) {
+    edge_mask_ = std::vector<rmm::device_uvector<uint32_t>>{};
+    (*edge_mask_)
+      .emplace_back((static_cast<size_t>(this->get_number_of_edges()) + 31) / 32,
+                    handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(),
+                 (*edge_mask_)[0].begin(),
+                 (*edge_mask_)[0].end(),
+                 std::numeric_limits<uint32_t>::max());
+  }
+
+  auto graph_view = this->view();
+  auto major_hypersparse_first = thrust::optional<vertex_t>{thrust::nullopt};
+  if (dcs_nzd_vertices_) {
+    major_hypersparse_first = (*segment_offsets_)[detail::num_sparse_segments_per_vertex_partition];
+  }
+  thrust::for_each(handle.get_thrust_policy(),
+                   edge_first,
+                   edge_first + num_edges,
+                   clear_edge_mask_bits_t<vertex_t, edge_t, weight_t, multi_gpu>{
+                     matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+                       graph_view.get_matrix_partition_view()),
+                     major_hypersparse_first,
+                     (*edge_mask_)[0].data()});
+
+  reversed_graph_.reset();
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  insert_edges(raft::handle_t const& handle,
+               vertex_t const* edgelist_rows,
+               vertex_t const* edgelist_cols,
+               std::optional<weight_t const*> edgelist_weights,
+               size_t num_edges,
+               bool do_expensive_check)
+{
+  auto& comm = handle.get_comms();
+  auto& col_comm =
+    this->get_handle_ptr()->get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_rank = col_comm.get_rank();
+
+  CUGRAPH_EXPECTS(edgelist_weights.has_value() == this->is_weighted(),
+                  "Invalid input argument: edgelist_weights.has_value() should coincide with "
+                  "is_weighted().");
+  CUGRAPH_EXPECTS(
+    (num_edges == 0) || ((edgelist_rows != nullptr) && (edgelist_cols != nullptr) &&
+                         (!edgelist_weights || (*edgelist_weights != nullptr))),
+    "Invalid input argument: edgelist_rows, edgelist_cols, and *edgelist_weights (if valid) should "
+    "not be nullptr if num_edges > 0.");
+
+  if (do_expensive_check) {
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(edgelist_rows, edgelist_cols));
+    auto num_invalid_edges =
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_first,
+                       edge_first + num_edges,
+                       out_of_range_t<vertex_t>{vertex_t{0},
+                                                this->get_number_of_vertices(),
+                                                vertex_t{0},
+                                                this->get_number_of_vertices()});
+    CUGRAPH_EXPECTS(host_scalar_allreduce(
+                      comm, num_invalid_edges, raft::comms::op_t::SUM, handle.get_stream()) == 0,
+                    "Invalid input argument: edgelist_rows and edgelist_cols have out-of-range "
+                    "values.");
+  }
+
+  auto number_of_vertices     = this->get_number_of_vertices();
+  auto properties             = this->get_graph_properties();
+  auto vertex_partition_lasts = partition_.get_vertex_partition_lasts();
+  // the degree segment offsets of the local vertex partition
+  auto segment_offsets = this->view().get_local_adj_matrix_partition_segment_offsets(
+    static_cast<size_t>(col_comm_rank));
+  // settings re-applied to the rebuilt graph
+  auto with_degree_cache  = this->has_degree_cache();
+  auto with_launch_tuning = this->has_launch_tuning();
+  auto placement          = edge_memory_placement_;
+  auto tile_size          = edge_tile_size_;
+  auto hub_chunk_size =
+    hub_split_ ? std::optional<edge_t>{hub_split_->chunk_size} : std::nullopt;
+
+  // merge the (non-deleted) edges of this graph and the inserted edges, no need to renumber as the
+  // inserted edges have renumbered vertex IDs
+
+  auto [rows, cols, weights] = this->decompress_to_edgelist(handle, std::nullopt, true);
+
+  auto num_existing_edges = rows.size();
+  rows.resize(num_existing_edges + num_edges, handle.get_stream());
+  cols.resize(rows.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               edgelist_rows,
+               edgelist_rows + num_edges,
+               rows.begin() + num_existing_edges);
+  thrust::copy(handle.get_thrust_policy(),
+               edgelist_cols,
+               edgelist_cols + num_edges,
+               cols.begin() + num_existing_edges);
+  if (weights) {
+    (*weights).resize(rows.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 *edgelist_weights,
+                 *edgelist_weights + num_edges,
+                 (*weights).begin() + num_existing_edges);
+  }
+
+  auto number_of_edges =
+    host_scalar_allreduce(comm, rows.size(), raft::comms::op_t::SUM, handle.get_stream());
+
+  *this = detail::
+    create_graph_from_renumbered_edgelist<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+      handle,
+      std::move(store_transposed ? cols : rows),
+      std::move(store_transposed ? rows : cols),
+      std::move(weights),
+      vertex_partition_lasts,
+      segment_offsets,
+      number_of_vertices,
+      static_cast<edge_t>(number_of_edges),
+      properties);
+  if (with_degree_cache) { this->enable_degree_cache(); }
+  if (with_launch_tuning) { this->enable_launch_tuning(); }
+  if (hub_chunk_size) { this->enable_hub_splitting(handle, *hub_chunk_size); }
+  if (tile_size) {
+    this->set_edge_memory_placement(handle, placement, *tile_size);
+  } else if (placement != edge_memory_placement_t::device) {
+    this->set_edge_memory_placement(handle, placement);
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  insert_edges(raft::handle_t const& handle,
+               vertex_t const* edgelist_rows,
+               vertex_t const* edgelist_cols,
+               std::optional<weight_t const*> edgelist_weights,
+               size_t num_edges,
+               bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(edgelist_weights.has_value() == this->is_weighted(),
+                  "Invalid input argument: edgelist_weights.has_value() should coincide with "
+                  "is_weighted().");
+  CUGRAPH_EXPECTS(
+    (num_edges == 0) || ((edgelist_rows != nullptr) && (edgelist_cols != nullptr) &&
+                         (!edgelist_weights || (*edgelist_weights != nullptr))),
+    "Invalid input argument: edgelist_rows, edgelist_cols, and *edgelist_weights (if valid) should "
+    "not be nullptr if num_edges > 0.");
+
+  auto number_of_vertices = this->get_number_of_vertices();
+  auto properties         = this->get_graph_properties();
+  auto segment_offsets    = segment_offsets_;
+  // settings re-applied to the rebuilt graph
+  auto with_degree_cache  = this->has_degree_cache();
+  auto with_launch_tuning = this->has_launch_tuning();
+  auto with_packed_minors = this->has_packed_minors();
+  auto placement          = edge_memory_placement_;
+  auto tile_size          = edge_tile_size_;
+  auto hub_chunk_size =
+    hub_split_ ? std::optional<edge_t>{hub_split_->chunk_size} : std::nullopt;
+
+  // merge the (non-deleted) edges of this graph and the inserted edges, no need to renumber as the
+  // inserted edges have renumbered vertex IDs (the graph_t constructor below checks the inserted
+  // edges if do_expensive_check is true)
+
+  auto [rows, cols, weights] = this->decompress_to_edgelist(handle, std::nullopt, true);
+
+  auto num_existing_edges = rows.size();
+  rows.resize(num_existing_edges + num_edges, handle.get_stream());
+  cols.resize(rows.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               edgelist_rows,
+               edgelist_rows + num_edges,
+               rows.begin() + num_existing_edges);
+  thrust::copy(handle.get_thrust_policy(),
+               edgelist_cols,
+               edgelist_cols + num_edges,
+               cols.begin() + num_existing_edges);
+  if (weights) {
+    (*weights).resize(rows.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 *edgelist_weights,
+                 *edgelist_weights + num_edges,
+                 (*weights).begin() + num_existing_edges);
+  }
+
+  *this = graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    handle,
+    edgelist_t<vertex_t, edge_t, weight_t>{
+      rows.data(),
+      cols.data(),
+      weights ? std::optional<weight_t const*>{(*weights).data()} : std::nullopt,
+      static_cast<edge_t>(rows.size())},
+    graph_meta_t<vertex_t, edge_t, multi_gpu>{number_of_vertices, properties, segment_offsets},
+    do_expensive_check);
+  if (with_degree_cache) { this->enable_degree_cache(); }
+  if (with_launch_tuning) { this->enable_launch_tuning(); }
+  if (hub_chunk_size) { this->enable_hub_splitting(handle, *hub_chunk_size); }
+  if (with_packed_minors) { this->pack_minors(handle); }  // bit-packed minors imply device edges
+  if (tile_size) {
+    this->set_edge_memory_placement(handle, placement, *tile_size);
+  } else if (placement != edge_memory_placement_t::device) {
+    this->set_edge_memory_placement(handle, placement);
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  add_reversed_graph(raft::handle_t const& handle)
+{
+  if (this->is_symmetric() || reversed_graph_) { return; }
+
+  reversed_graph_ = std::make_unique<graph_t>(create_reversed_graph(handle, this->view(), true));
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  add_reversed_graph(raft::handle_t const& handle)
+{
+  if (this->is_symmetric() || reversed_graph_) { return; }
+
+  reversed_graph_ = std::make_unique<graph_t>(create_reversed_graph(handle, this->view(), true));
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  enable_hub_splitting(raft::handle_t const& handle, edge_t chunk_size)
+{
+  CUGRAPH_EXPECTS(chunk_size > 0, "Invalid input argument: chunk_size should be positive.");
+
+  hub_split_.reset();  // to release the current chunks (if any) before computing the new ones
+  hub_split_ = compute_hub_split(handle, this->view(), chunk_size);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  enable_hub_splitting(raft::handle_t const& handle, edge_t chunk_size)
+{
+  CUGRAPH_EXPECTS(chunk_size > 0, "Invalid input argument: chunk_size should be positive.");
+
+  hub_split_.reset();  // to release the current chunks (if any) before computing the new ones
+  hub_split_ = compute_hub_split(handle, this->view(), chunk_size);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  set_edge_memory_placement(raft::handle_t const& handle,
+                            edge_memory_placement_t placement,
+                            edge_t tile_size)
+{
+  CUGRAPH_EXPECTS(tile_size > 0, "Invalid input argument: tile_size should be positive.");
+  check_edge_memory_placement(placement);
+
+  // one array at a time to limit the peak memory usage
+  for (size_t i = 0; i < adj_matrix_partition_offsets_.size(); ++i) {
+    adj_matrix_partition_offsets_[i] =
+      move_to_edge_memory(handle, std::move(adj_matrix_partition_offsets_[i]), placement);
+    adj_matrix_partition_indices_[i] =
+      move_to_edge_memory(handle, std::move(adj_matrix_partition_indices_[i]), placement);
+    if (adj_matrix_partition_weights_) {
+      (*adj_matrix_partition_weights_)[i] =
+        move_to_edge_memory(handle, std::move((*adj_matrix_partition_weights_)[i]), placement);
+    }
+    if (adj_matrix_partition_dcs_nzd_vertices_) {
+      (*adj_matrix_partition_dcs_nzd_vertices_)[i] = move_to_edge_memory(
+        handle, std::move((*adj_matrix_partition_dcs_nzd_vertices_)[i]), placement);
+    }
+    if (adj_matrix_partition_compressed_indices_) {
+      (*adj_matrix_partition_compressed_indices_)[i] = move_to_edge_memory(
+        handle, std::move((*adj_matrix_partition_compressed_indices_)[i]), placement);
+    }
+  }
+  // views obtained from this object may be used on other streams
+  handle.get_stream_view().synchronize();
+
+  edge_memory_placement_ = placement;
+  edge_tile_size_ =
+    placement == edge_memory_placement_t::managed ? std::optional<edge_t>{tile_size} : std::nullopt;
+
+  if (reversed_graph_) { reversed_graph_->set_edge_memory_placement(handle, placement, tile_size); }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  set_edge_memory_placement(raft::handle_t const& handle,
+                            edge_memory_placement_t placement,
+                            edge_t tile_size)
+{
+  CUGRAPH_EXPECTS(tile_size > 0, "Invalid input argument: tile_size should be positive.");
+  check_edge_memory_placement(placement);
+  CUGRAPH_EXPECTS(!packed_minors_ || (placement == edge_memory_placement_t::device),
+                  "Invalid input argument: graphs with bit-packed minors should keep the edges in "
+                  "the device memory.");
+
+  offsets_ = move_to_edge_memory(handle, std::move(offsets_), placement);
+  indices_ = move_to_edge_memory(handle, std::move(indices_), placement);
+  if (weights_) { weights_ = move_to_edge_memory(handle, std::move(*weights_), placement); }
+  if (dcs_nzd_vertices_) {
+    dcs_nzd_vertices_ = move_to_edge_memory(handle, std::move(*dcs_nzd_vertices_), placement);
+  }
+  // views obtained from this object may be used on other streams
+  handle.get_stream_view().synchronize();
+
+  edge_memory_placement_ = placement;
+  edge_tile_size_ =
+    placement == edge_memory_placement_t::managed ? std::optional<edge_t>{tile_size} : std::nullopt;
+
+  if (reversed_graph_) { reversed_graph_->set_edge_memory_placement(handle, placement, tile_size); }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  pack_minors(raft::handle_t const& handle)
+{
+  if (packed_minors_) { return; }
+  CUGRAPH_EXPECTS(edge_memory_placement_ == edge_memory_placement_t::device,
+                  "Invalid input argument: bit-packing the minors requires the edges in the device "
+                  "memory.");
+
+  auto number_of_edges = static_cast<edge_t>(indices_.size());
+  auto num_blocks      = (number_of_edges + edge_t{31}) / edge_t{32};
+
+  // 1. find the base & the bit width (== # words) of each block
+
+  rmm::device_uvector<edge_t> block_word_offsets(num_blocks + 1, handle.get_stream());
+  rmm::device_uvector<vertex_t> block_bases(num_blocks, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(edge_t{0}),
+    thrust::make_counting_iterator(num_blocks),
+    thrust::make_zip_iterator(thrust::make_tuple(block_bases.begin(), block_word_offsets.begin())),
+    packed_minor_block_t<vertex_t, edge_t>{indices_.data(), number_of_edges});
+  auto max_width = thrust::reduce(handle.get_thrust_policy(),
+                                  block_word_offsets.begin(),
+                                  block_word_offsets.begin() + num_blocks,
+                                  edge_t{0},
+                                  thrust::maximum<edge_t>{});
+  CUGRAPH_EXPECTS(max_width <= edge_t{32},
+                  "Invalid input argument: the minors of a block of 32 edges should span less than "
+                  "2^32 vertex IDs to bit-pack the minors.");
+  block_word_offsets.set_element_to_zero_async(num_blocks, handle.get_stream());
+  thrust::exclusive_scan(handle.get_thrust_policy(),
+                         block_word_offsets.begin(),
+                         block_word_offsets.end(),
+                         block_word_offsets.begin());
+
+  // 2. pack
+
+  rmm::device_uvector<uint32_t> words(block_word_offsets.back_element(handle.get_stream()),
+                                      handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), words.begin(), words.end(), uint32_t{0});
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(edge_t{0}),
+                   thrust::make_counting_iterator(num_blocks),
+                   pack_minor_block_t<vertex_t, edge_t>{indices_.data(),
+                                                        number_of_edges,
+                                                        words.data(),
+                                                        block_word_offsets.data(),
+                                                        block_bases.data()});
+
+  indices_.resize(0, handle.get_stream());
+  indices_.shrink_to_fit(handle.get_stream());
+  packed_minors_ = detail::packed_minors_t<vertex_t, edge_t>{
+    std::move(words), std::move(block_word_offsets), std::move(block_bases)};
+  // views obtained from this object may be used on other streams
+  handle.get_stream_view().synchronize();
+
+  if (reversed_graph_) { reversed_graph_->pack_minors(handle); }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  unpack_minors(raft::handle_t const& handle)
+{
+  if (!packed_minors_) { return; }
+
+  auto matrix_partition = matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+    this->view().get_matrix_partition_view());
+  rmm::device_uvector<vertex_t> indices(this->get_number_of_edges(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               matrix_partition.get_minors(),
+               matrix_partition.get_minors() + indices.size(),
+               indices.begin());
+
+  indices_       = std::move(indices);
+  packed_minors_ = std::nullopt;
+  // views obtained from this object may be used on other streams
+  handle.get_stream_view().synchronize();
+
+  if (reversed_graph_) { reversed_graph_->unpack_minors(handle); }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+size_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  get_memory_size() const
+{
+  size_t ret{0};
+  for (size_t i = 0; i < adj_matrix_partition_offsets_.size(); ++i) {
+    ret += adj_matrix_partition_offsets_[i].size() * sizeof(edge_t) +
+           adj_matrix_partition_indices_[i].size() * sizeof(vertex_t);
+    if (adj_matrix_partition_weights_) {
+      ret += (*adj_matrix_partition_weights_)[i].size() * sizeof(weight_t);
+    }
+    if (adj_matrix_partition_dcs_nzd_vertices_) {
+      ret += (*adj_matrix_partition_dcs_nzd_vertices_)[i].size() * sizeof(vertex_t);
+    }
+    if (adj_matrix_partition_compressed_indices_) {
+      ret += (*adj_matrix_partition_compressed_indices_)[i].size() * sizeof(uint32_t);
+    }
+  }
+  if (local_sorted_unique_edge_rows_) {
+    ret += (*local_sorted_unique_edge_rows_).size() * sizeof(vertex_t);
+  }
+  if (local_sorted_unique_edge_cols_) {
+    ret += (*local_sorted_unique_edge_cols_).size() * sizeof(vertex_t);
+  }
+
+  return ret;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+size_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  get_memory_size() const
+{
+  size_t ret = offsets_.size() * sizeof(edge_t) + indices_.size() * sizeof(vertex_t);
+  if (weights_) { ret += (*weights_).size() * sizeof(weight_t); }
+  if (dcs_nzd_vertices_) { ret += (*dcs_nzd_vertices_).size() * sizeof(vertex_t); }
+  if (packed_minors_) { ret += (*packed_minors_).get_memory_size(); }
+
+  return ret;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_memory_footprint_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  get_memory_footprint() const
+{
+  graph_memory_footprint_t ret{};
+  for (size_t i = 0; i < adj_matrix_partition_offsets_.size(); ++i) {
+    ret.offsets += adj_matrix_partition_offsets_[i].size() * sizeof(edge_t);
+    ret.indices += adj_matrix_partition_indices_[i].size() * sizeof(vertex_t);
+    if (adj_matrix_partition_compressed_indices_) {
+      ret.indices += (*adj_matrix_partition_compressed_indices_)[i].size() * sizeof(uint32_t);
+    }
+    if (adj_matrix_partition_weights_) {
+      ret.weights += (*adj_matrix_partition_weights_)[i].size() * sizeof(weight_t);
+    }
+    if (adj_matrix_partition_dcs_nzd_vertices_) {
+      ret.dcs_nzd_vertices +=
+        (*adj_matrix_partition_dcs_nzd_vertices_)[i].size() * sizeof(vertex_t);
+    }
+  }
+  if (local_sorted_unique_edge_rows_) {
+    ret.edge_row_col_keys += (*local_sorted_unique_edge_rows_).size() * sizeof(vertex_t);
+  }
+  if (local_sorted_unique_edge_cols_) {
+    ret.edge_row_col_keys += (*local_sorted_unique_edge_cols_).size() * sizeof(vertex_t);
+  }
+  if (edge_mask_) {
+    for (auto const& mask : *edge_mask_) {
+      ret.edge_mask += mask.size() * sizeof(uint32_t);
+    }
+  }
+  if (degree_cache_) { ret.degree_cache = degree_cache_->get_memory_size(); }
+  if (hub_split_) { ret.hub_split = hub_split_->get_memory_size(); }
+  if (reversed_graph_) {
+    ret.reversed_graph = reversed_graph_->get_memory_footprint().device_total();
+  }
+
+  auto num_host_vertices = partition_.get_vertex_partition_offsets().size();
+  if (adj_matrix_partition_dcs_nzd_vertex_counts_) {
+    num_host_vertices += (*adj_matrix_partition_dcs_nzd_vertex_counts_).size();
+  }
+  if (adj_matrix_partition_segment_offsets_) {
+    num_host_vertices += (*adj_matrix_partition_segment_offsets_).size();
+  }
+  if (local_sorted_unique_edge_row_offsets_) {
+    num_host_vertices += (*local_sorted_unique_edge_row_offsets_).size();
+  }
+  if (local_sorted_unique_edge_col_offsets_) {
+    num_host_vertices += (*local_sorted_unique_edge_col_offsets_).size();
+  }
+  ret.host_metadata = num_host_vertices * sizeof(vertex_t);
+
+  return ret;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_memory_footprint_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  get_memory_footprint() const
+{
+  graph_memory_footprint_t ret{};
+  ret.offsets = offsets_.size() * sizeof(edge_t);
+  ret.indices = indices_.size() * sizeof(vertex_t) +
+                (packed_minors_ ? (*packed_minors_).get_memory_size() : size_t{0});
+  if (weights_) { ret.weights = (*weights_).size() * sizeof(weight_t); }
+  if (dcs_nzd_vertices_) { ret.dcs_nzd_vertices = (*dcs_nzd_vertices_).size() * sizeof(vertex_t); }
+  if (edge_mask_) {
+    for (auto const& mask : *edge_mask_) {
+      ret.edge_mask += mask.size() * sizeof(uint32_t);
+    }
+  }
+  if (degree_cache_) { ret.degree_cache = degree_cache_->get_memory_size(); }
+  if (hub_split_) { ret.hub_split = hub_split_->get_memory_size(); }
+  if (reversed_graph_) {
+    ret.reversed_graph = reversed_graph_->get_memory_footprint().device_total();
+  }
+  if (segment_offsets_) { ret.host_metadata = (*segment_offsets_).size() * sizeof(vertex_t); }
+
+  return ret;
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -1278,9 +3048,11 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
                                                   edgelist_majors.size(), handle.get_stream())
                                               : std::nullopt;
 
+  // the edges deleted by delete_edges are dropped (edgelist_edge_counts[i] is updated to the number
+  // of the remaining edges)
   size_t cur_size{0};
   for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
-    detail::decompress_matrix_partition_to_edgelist(
+    edgelist_edge_counts[i] = detail::decompress_matrix_partition_to_unmasked_edgelist(
       handle,
       matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
         graph_view.get_matrix_partition_view(i)),
@@ -1291,6 +3063,11 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
       graph_view.get_local_adj_matrix_partition_segment_offsets(i));
     cur_size += edgelist_edge_counts[i];
   }
+  if (cur_size < edgelist_majors.size()) {
+    edgelist_majors.resize(cur_size, handle.get_stream());
+    edgelist_minors.resize(cur_size, handle.get_stream());
+    if (edgelist_weights) { (*edgelist_weights).resize(cur_size, handle.get_stream()); }
+  }
 
   auto local_vertex_first = graph_view.get_local_vertex_first();
   auto local_vertex_last  = graph_view.get_local_vertex_last();
@@ -1381,7 +3158,8 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
   auto edgelist_weights = this->is_weighted() ? std::make_optional<rmm::device_uvector<weight_t>>(
                                                   edgelist_majors.size(), handle.get_stream())
                                               : std::nullopt;
-  detail::decompress_matrix_partition_to_edgelist(
+  // the edges deleted by delete_edges are dropped
+  auto number_of_unmasked_edges = detail::decompress_matrix_partition_to_unmasked_edgelist(
     handle,
     matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
       graph_view.get_matrix_partition_view()),
@@ -1389,6 +3167,13 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
     edgelist_minors.data(),
     edgelist_weights ? std::optional<weight_t*>{(*edgelist_weights).data()} : std::nullopt,
     graph_view.get_local_adj_matrix_partition_segment_offsets());
+  if (number_of_unmasked_edges < edgelist_majors.size()) {
+    edgelist_majors.resize(number_of_unmasked_edges, handle.get_stream());
+    edgelist_minors.resize(number_of_unmasked_edges, handle.get_stream());
+    if (edgelist_weights) {
+      (*edgelist_weights).resize(number_of_unmasked_edges, handle.get_stream());
+    }
+  }
 
   if (destroy) { *this = graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(handle); }
 
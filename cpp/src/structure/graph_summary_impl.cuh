@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/device_atomics.cuh>
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cub/cub.cuh>
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+int32_t constexpr graph_summary_block_size = 512;
+
+// (number of self-loops, number of multi-edges, weight sum, minimum weight, maximum weight)
+template <typename edge_t, typename weight_t>
+using edge_summary_t = thrust::tuple<edge_t, edge_t, weight_t, weight_t, weight_t>;
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename edge_t, typename weight_t>
+struct edge_summary_reduce_op_t {
+  __host__ __device__ edge_summary_t<edge_t, weight_t> operator()(
+    edge_summary_t<edge_t, weight_t> lhs, edge_summary_t<edge_t, weight_t> rhs) const
+  {
+    return thrust::make_tuple(thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                              thrust::get<1>(lhs) + thrust::get<1>(rhs),
+                              thrust::get<2>(lhs) + thrust::get<2>(rhs),
+                              thrust::get<3>(lhs) < thrust::get<3>(rhs) ? thrust::get<3>(lhs)
+                                                                        : thrust::get<3>(rhs),
+                              thrust::get<4>(lhs) < thrust::get<4>(rhs) ? thrust::get<4>(rhs)
+                                                                        : thrust::get<4>(lhs));
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename edge_t>
+struct log2_degree_bin_t {
+  __device__ uint8_t operator()(edge_t degree) const
+  {
+    return degree == edge_t{0}
+             ? uint8_t{0}
+             : static_cast<uint8_t>(64 - __clzll(static_cast<long long int>(degree)));
+  }
+};
+
+// threads_per_major threads (a thread, a warp, or a block) per major, major_idx is the index in
+// the offsets array (major_idx != major_offset in the hypersparse segment)
+template <int32_t threads_per_major,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu>
+__global__ void summarize_matrix_partition_edges(
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> matrix_partition,
+  vertex_t major_idx_first,
+  vertex_t major_idx_last,
+  vertex_t major_hypersparse_idx_first,
+  bool count_multi_edges,
+  edge_t* minor_degrees,
+  edge_t* counts /* self-loops, multi-edges */,
+  weight_t* weight_stats /* sum, min, max */)
+{
+  static_assert(graph_summary_block_size % threads_per_major == 0);
+  auto const tid        = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const lane_id    = tid % threads_per_major;
+  size_t idx            = static_cast<size_t>(tid / threads_per_major);
+  auto const num_groups = static_cast<size_t>(gridDim.x) * (blockDim.x / threads_per_major);
+
+  edge_summary_t<edge_t, weight_t> summary{edge_t{0},
+                                           edge_t{0},
+                                           weight_t{0.0},
+                                           std::numeric_limits<weight_t>::max(),
+                                           std::numeric_limits<weight_t>::lowest()};
+  while (idx < static_cast<size_t>(major_idx_last - major_idx_first)) {
+    auto major_idx = static_cast<vertex_t>(major_idx_first + idx);
+    auto major =
+      major_idx < major_hypersparse_idx_first
+        ? matrix_partition.get_major_from_major_offset_nocheck(major_idx)
+        : *(matrix_partition.get_major_from_major_hypersparse_idx_nocheck(
+            major_idx - major_hypersparse_idx_first));
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
+    thrust::optional<weight_t const*> weights{thrust::nullopt};
+    edge_t local_degree{};
+    thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_idx);
+    for (edge_t i = lane_id; i < local_degree; i += threads_per_major) {
+      auto minor = indices[i];
+      if (minor == major) { ++thrust::get<0>(summary); }
+      // assumes neighbors are sorted
+      if (count_multi_edges && (i != 0) && (indices[i - 1] == minor)) {
+        ++thrust::get<1>(summary);
+      }
+      if (weights) {
+        auto w = (*weights)[i];
+        thrust::get<2>(summary) += w;
+        thrust::get<3>(summary) = w < thrust::get<3>(summary) ? w : thrust::get<3>(summary);
+        thrust::get<4>(summary) = w > thrust::get<4>(summary) ? w : thrust::get<4>(summary);
+      }
+      atomicAdd(minor_degrees + matrix_partition.get_minor_offset_from_minor_nocheck(minor),
+                edge_t{1});
+    }
+    idx += num_groups;
+  }
+
+  using BlockReduce = cub::BlockReduce<edge_summary_t<edge_t, weight_t>, graph_summary_block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  summary = BlockReduce(temp_storage).Reduce(summary, edge_summary_reduce_op_t<edge_t, weight_t>{});
+  if (threadIdx.x == 0) {
+    atomicAdd(counts, thrust::get<0>(summary));
+    atomicAdd(counts + 1, thrust::get<1>(summary));
+    atomicAdd(weight_stats, thrust::get<2>(summary));
+    atomicMin(weight_stats + 1, thrust::get<3>(summary));
+    atomicMax(weight_stats + 2, thrust::get<4>(summary));
+  }
+}
+
+template <int32_t threads_per_major,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu>
+void launch_summarize_matrix_partition_edges(
+  raft::handle_t const& handle,
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> matrix_partition,
+  vertex_t major_idx_first,
+  vertex_t major_idx_last,
+  vertex_t major_hypersparse_idx_first,
+  bool count_multi_edges,
+  edge_t* minor_degrees,
+  edge_t* counts,
+  weight_t* weight_stats)
+{
+  if (major_idx_last <= major_idx_first) { return; }
+
+  auto num_threads = static_cast<size_t>(major_idx_last - major_idx_first) * threads_per_major;
+  auto num_blocks  = std::min(
+    (num_threads + graph_summary_block_size - 1) / graph_summary_block_size,
+    static_cast<size_t>(handle.get_device_properties().maxGridSize[0]));
+  summarize_matrix_partition_edges<threads_per_major>
+    <<<num_blocks, graph_summary_block_size, 0, handle.get_stream()>>>(matrix_partition,
+                                                                       major_idx_first,
+                                                                       major_idx_last,
+                                                                       major_hypersparse_idx_first,
+                                                                       count_multi_edges,
+                                                                       minor_degrees,
+                                                                       counts,
+                                                                       weight_stats);
+}
+
+// returns (min, max, log2 binned histogram) of the local degrees (aggregated over all the GPUs in
+// multi-GPU)
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<edge_t, edge_t, std::vector<vertex_t>> summarize_degrees(
+  raft::handle_t const& handle, rmm::device_uvector<edge_t> const& degrees)
+{
+  auto min_degree = thrust::reduce(handle.get_thrust_policy(),
+                                   degrees.begin(),
+                                   degrees.end(),
+                                   std::numeric_limits<edge_t>::max(),
+                                   thrust::minimum<edge_t>{});
+  auto max_degree = thrust::reduce(handle.get_thrust_policy(),
+                                   degrees.begin(),
+                                   degrees.end(),
+                                   edge_t{0},
+                                   thrust::maximum<edge_t>{});
+
+  auto num_bins = sizeof(edge_t) * 8 + 1;
+  rmm::device_uvector<uint8_t> bins(degrees.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    degrees.begin(),
+                    degrees.end(),
+                    bins.begin(),
+                    log2_degree_bin_t<edge_t>{});
+  thrust::sort(handle.get_thrust_policy(), bins.begin(), bins.end());
+  rmm::device_uvector<vertex_t> histogram(num_bins, handle.get_stream());
+  thrust::upper_bound(handle.get_thrust_policy(),
+                      bins.begin(),
+                      bins.end(),
+                      thrust::make_counting_iterator(uint8_t{0}),
+                      thrust::make_counting_iterator(static_cast<uint8_t>(num_bins)),
+                      histogram.begin());
+  thrust::adjacent_difference(
+    handle.get_thrust_policy(), histogram.begin(), histogram.end(), histogram.begin());
+
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+    min_degree =
+      host_scalar_allreduce(comm, min_degree, raft::comms::op_t::MIN, handle.get_stream());
+    max_degree =
+      host_scalar_allreduce(comm, max_degree, raft::comms::op_t::MAX, handle.get_stream());
+    device_allreduce(comm,
+                     histogram.begin(),
+                     histogram.begin(),
+                     histogram.size(),
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+
+  std::vector<vertex_t> h_histogram(num_bins);
+  raft::update_host(h_histogram.data(), histogram.data(), num_bins, handle.get_stream());
+  handle.get_stream_view().synchronize();
+  while ((h_histogram.size() > 1) && (h_histogram.back() == vertex_t{0})) {
+    h_histogram.pop_back();
+  }
+
+  return std::make_tuple(
+    min_degree == std::numeric_limits<edge_t>::max() ? edge_t{0} : min_degree,
+    max_degree,
+    std::move(h_histogram));
+}
+
+}  // namespace
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_summary_t<vertex_t, edge_t, weight_t> graph_summary(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(),
+                  "Invalid input argument: graph_summary does not support edge masks yet.");
+
+  // 1. one pass over the local edges (self-loops, multi-edges, weights, and minor degrees)
+
+  auto num_local_minors = store_transposed
+                            ? graph_view.get_number_of_local_adj_matrix_partition_rows()
+                            : graph_view.get_number_of_local_adj_matrix_partition_cols();
+  rmm::device_uvector<edge_t> local_minor_degrees(num_local_minors, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               local_minor_degrees.begin(),
+               local_minor_degrees.end(),
+               edge_t{0});
+  rmm::device_uvector<edge_t> counts(2, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), counts.begin(), counts.end(), edge_t{0});
+  std::vector<weight_t> h_weight_stats{
+    weight_t{0.0}, std::numeric_limits<weight_t>::max(), std::numeric_limits<weight_t>::lowest()};
+  rmm::device_uvector<weight_t> weight_stats(h_weight_stats.size(), handle.get_stream());
+  raft::update_device(
+    weight_stats.data(), h_weight_stats.data(), h_weight_stats.size(), handle.get_stream());
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto matrix_partition = matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+      graph_view.get_matrix_partition_view(i));
+    auto segment_offsets      = graph_view.get_local_adj_matrix_partition_segment_offsets(i);
+    auto dcs_nzd_vertex_count = matrix_partition.get_dcs_nzd_vertex_count();
+
+    if (segment_offsets) {
+      static_assert(detail::num_sparse_segments_per_vertex_partition == 3);
+      auto major_hypersparse_idx_first = (*segment_offsets)[3];
+      launch_summarize_matrix_partition_edges<graph_summary_block_size>(
+        handle,
+        matrix_partition,
+        vertex_t{0},
+        (*segment_offsets)[1],
+        major_hypersparse_idx_first,
+        graph_view.is_multigraph(),
+        local_minor_degrees.data(),
+        counts.data(),
+        weight_stats.data());
+      launch_summarize_matrix_partition_edges<raft::warp_size()>(handle,
+                                                                 matrix_partition,
+                                                                 (*segment_offsets)[1],
+                                                                 (*segment_offsets)[2],
+                                                                 major_hypersparse_idx_first,
+                                                                 graph_view.is_multigraph(),
+                                                                 local_minor_degrees.data(),
+                                                                 counts.data(),
+                                                                 weight_stats.data());
+      launch_summarize_matrix_partition_edges<1>(
+        handle,
+        matrix_partition,
+        (*segment_offsets)[2],
+        major_hypersparse_idx_first + (dcs_nzd_vertex_count ? *dcs_nzd_vertex_count : vertex_t{0}),
+        major_hypersparse_idx_first,
+        graph_view.is_multigraph(),
+        local_minor_degrees.data(),
+        counts.data(),
+        weight_stats.data());
+    } else {
+      launch_summarize_matrix_partition_edges<raft::warp_size()>(handle,
+                                                                 matrix_partition,
+                                                                 vertex_t{0},
+                                                                 matrix_partition.get_major_size(),
+                                                                 matrix_partition.get_major_size(),
+                                                                 graph_view.is_multigraph(),
+                                                                 local_minor_degrees.data(),
+                                                                 counts.data(),
+                                                                 weight_stats.data());
+    }
+  }
+
+  std::vector<edge_t> h_counts(counts.size());
+  raft::update_host(h_counts.data(), counts.data(), counts.size(), handle.get_stream());
+  raft::update_host(
+    h_weight_stats.data(), weight_stats.data(), weight_stats.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  // 2. aggregate the minor degrees to the vertex partitions (the major degrees come from the
+  // offsets)
+
+  rmm::device_uvector<edge_t> minor_degrees(0, handle.get_stream());
+  if constexpr (multi_gpu) {
+    auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto const row_comm_size = row_comm.get_size();
+    auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    auto const col_comm_rank = col_comm.get_rank();
+
+    minor_degrees.resize(graph_view.get_number_of_local_vertices(), handle.get_stream());
+    for (int i = 0; i < row_comm_size; ++i) {
+      auto offset = (graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size + i) -
+                     graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size));
+      device_reduce(row_comm,
+                    local_minor_degrees.begin() + offset,
+                    minor_degrees.begin(),
+                    static_cast<size_t>(
+                      graph_view.get_vertex_partition_size(col_comm_rank * row_comm_size + i)),
+                    raft::comms::op_t::SUM,
+                    i,
+                    handle.get_stream());
+    }
+    local_minor_degrees.resize(0, handle.get_stream());
+    local_minor_degrees.shrink_to_fit(handle.get_stream());
+  } else {
+    minor_degrees = std::move(local_minor_degrees);
+  }
+  auto major_degrees = store_transposed ? graph_view.compute_in_degrees(handle)
+                                        : graph_view.compute_out_degrees(handle);
+  auto& out_degrees = store_transposed ? minor_degrees : major_degrees;
+  auto& in_degrees  = store_transposed ? major_degrees : minor_degrees;
+
+  // 3. summarize
+
+  if constexpr (multi_gpu) {
+    auto& comm  = handle.get_comms();
+    h_counts[0] =
+      host_scalar_allreduce(comm, h_counts[0], raft::comms::op_t::SUM, handle.get_stream());
+    h_counts[1] =
+      host_scalar_allreduce(comm, h_counts[1], raft::comms::op_t::SUM, handle.get_stream());
+    h_weight_stats[0] =
+      host_scalar_allreduce(comm, h_weight_stats[0], raft::comms::op_t::SUM, handle.get_stream());
+    h_weight_stats[1] =
+      host_scalar_allreduce(comm, h_weight_stats[1], raft::comms::op_t::MIN, handle.get_stream());
+    h_weight_stats[2] =
+      host_scalar_allreduce(comm, h_weight_stats[2], raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  graph_summary_t<vertex_t, edge_t, weight_t> ret{};
+  ret.number_of_vertices    = graph_view.get_number_of_vertices();
+  ret.number_of_edges       = graph_view.get_number_of_edges();
+  ret.number_of_self_loops  = h_counts[0];
+  ret.number_of_multi_edges = h_counts[1];
+  ret.mean_degree           = ret.number_of_vertices > 0
+                                ? static_cast<double>(ret.number_of_edges) / ret.number_of_vertices
+                                : 0.0;
+  std::tie(ret.min_out_degree, ret.max_out_degree, ret.out_degree_histogram) =
+    summarize_degrees<vertex_t, edge_t, multi_gpu>(handle, out_degrees);
+  std::tie(ret.min_in_degree, ret.max_in_degree, ret.in_degree_histogram) =
+    summarize_degrees<vertex_t, edge_t, multi_gpu>(handle, in_degrees);
+  if (graph_view.is_weighted()) {
+    auto has_edges = ret.number_of_edges > 0;
+    ret.weight_sum = h_weight_stats[0];
+    ret.min_weight = has_edges ? h_weight_stats[1] : weight_t{0.0};
+    ret.max_weight = has_edges ? h_weight_stats[2] : weight_t{0.0};
+  }
+
+  return ret;
+}
+
+}  // namespace cugraph
@@ -163,15 +163,39 @@ rmm::device_uvector<edge_t> compute_major_degrees(
 // compute the numbers of nonzeros in rows (of the graph adjacency matrix, if store_transposed =
 // false) or columns (of the graph adjacency matrix, if store_transposed = true)
 template <typename vertex_t, typename edge_t>
-rmm::device_uvector<edge_t> compute_major_degrees(raft::handle_t const& handle,
-                                                  edge_t const* offsets,
-                                                  vertex_t number_of_vertices)
+rmm::device_uvector<edge_t> compute_major_degrees(
+  raft::handle_t const& handle,
+  edge_t const* offsets,
+  std::optional<vertex_t const*> dcs_nzd_vertices,
+  std::optional<vertex_t> dcs_nzd_vertex_count,
+  vertex_t number_of_vertices,
+  std::optional<std::vector<vertex_t>> const& segment_offsets)
 {
+  auto major_hypersparse_first =
+    dcs_nzd_vertices ? (*segment_offsets)[detail::num_sparse_segments_per_vertex_partition]
+                     : number_of_vertices;
   rmm::device_uvector<edge_t> degrees(number_of_vertices, handle.get_stream());
-  thrust::tabulate(
-    handle.get_thrust_policy(), degrees.begin(), degrees.end(), [offsets] __device__(auto i) {
-      return offsets[i + 1] - offsets[i];
-    });
+  thrust::tabulate(handle.get_thrust_policy(),
+                   degrees.begin(),
+                   degrees.begin() + major_hypersparse_first,
+                   [offsets] __device__(auto i) { return offsets[i + 1] - offsets[i]; });
+  if (dcs_nzd_vertices) {
+    thrust::fill(handle.get_thrust_policy(),
+                 degrees.begin() + major_hypersparse_first,
+                 degrees.end(),
+                 edge_t{0});
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(vertex_t{0}),
+                     thrust::make_counting_iterator(*dcs_nzd_vertex_count),
+                     [offsets,
+                      p_dcs_nzd_vertices = *dcs_nzd_vertices,
+                      major_hypersparse_first,
+                      degrees = degrees.data()] __device__(auto i) {
+                       degrees[p_dcs_nzd_vertices[i]] =
+                         offsets[major_hypersparse_first + i + 1] -
+                         offsets[major_hypersparse_first + i];
+                     });
+  }
   return degrees;
 }
 
@@ -209,6 +233,42 @@ rmm::device_uvector<edge_t> compute_minor_degrees(
   return minor_degrees;
 }
 
+// the offsets count the masked out edges as well, count the valid edges with the (edge mask aware)
+// prims if an edge mask is attached
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+rmm::device_uvector<edge_t> compute_masked_major_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view)
+{
+  rmm::device_uvector<edge_t> major_degrees(graph_view.get_number_of_local_vertices(),
+                                            handle.get_stream());
+  if (store_transposed) {
+    copy_v_transform_reduce_in_nbr(
+      handle,
+      graph_view,
+      dummy_properties_t<vertex_t>{}.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      [] __device__(vertex_t, vertex_t, weight_t, auto, auto) { return edge_t{1}; },
+      edge_t{0},
+      major_degrees.data());
+  } else {
+    copy_v_transform_reduce_out_nbr(
+      handle,
+      graph_view,
+      dummy_properties_t<vertex_t>{}.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      [] __device__(vertex_t, vertex_t, weight_t, auto, auto) { return edge_t{1}; },
+      edge_t{0},
+      major_degrees.data());
+  }
+
+  return major_degrees;
+}
+
 template <bool major,
           typename vertex_t,
           typename edge_t,
@@ -266,7 +326,7 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
   edge_t count_sum{0};
   while (idx < static_cast<size_t>(major_last - major_first)) {
     auto major_offset = static_cast<vertex_t>(major_start_offset + idx);
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     [[maybe_unused]] thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
@@ -296,7 +356,7 @@ __global__ void for_all_major_for_all_nbr_high_degree(
   edge_t count_sum{0};
   while (idx < static_cast<size_t>(major_last - major_first)) {
     auto major_offset = major_start_offset + idx;
-    vertex_t const* indices{nullptr};
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
     [[maybe_unused]] thrust::optional<weight_t const*> weights{thrust::nullopt};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) =
@@ -360,7 +420,7 @@ edge_t count_matrix_partition_multi_edges(
         thrust::make_counting_iterator(matrix_partition.get_major_first()) + (*segment_offsets)[3],
         [matrix_partition] __device__(auto major) {
           auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
-          vertex_t const* indices{nullptr};
+          detail::minor_iterator_t<vertex_t, edge_t> indices{};
           [[maybe_unused]] thrust::optional<weight_t const*> weights{thrust::nullopt};
           edge_t local_degree{};
           thrust::tie(indices, weights, local_degree) =
@@ -383,7 +443,7 @@ edge_t count_matrix_partition_multi_edges(
         [matrix_partition, major_start_offset = (*segment_offsets)[3]] __device__(auto idx) {
           auto major_idx =
             major_start_offset + idx;  // major_offset != major_idx in the hypersparse region
-          vertex_t const* indices{nullptr};
+          detail::minor_iterator_t<vertex_t, edge_t> indices{};
           [[maybe_unused]] thrust::optional<weight_t const*> weights{thrust::nullopt};
           edge_t local_degree{};
           thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_idx);
@@ -406,7 +466,7 @@ edge_t count_matrix_partition_multi_edges(
         matrix_partition.get_major_size(),
       [matrix_partition] __device__(auto major) {
         auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
-        vertex_t const* indices{nullptr};
+        detail::minor_iterator_t<vertex_t, edge_t> indices{};
         [[maybe_unused]] thrust::optional<weight_t const*> weights{thrust::nullopt};
         edge_t local_degree{};
         thrust::tie(indices, weights, local_degree) =
@@ -458,7 +518,8 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
     local_sorted_unique_edge_row_offsets_(meta.local_sorted_unique_edge_row_offsets),
     local_sorted_unique_edge_col_first_(meta.local_sorted_unique_edge_col_first),
     local_sorted_unique_edge_col_last_(meta.local_sorted_unique_edge_col_last),
-    local_sorted_unique_edge_col_offsets_(meta.local_sorted_unique_edge_col_offsets)
+    local_sorted_unique_edge_col_offsets_(meta.local_sorted_unique_edge_col_offsets),
+    adj_matrix_partition_compressed_indices_(meta.adj_matrix_partition_compressed_indices)
 {
   // cheap error checks
 
@@ -487,6 +548,11 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
                                adj_matrix_partition_offsets.size()),
                   "Internal Error: adj_matrix_partition_dcs_nzd_vertices.size() should coincide "
                   "with adj_matrix_partition_offsets.size() (if used).");
+  CUGRAPH_EXPECTS(!(meta.adj_matrix_partition_compressed_indices.has_value()) ||
+                    ((*(meta.adj_matrix_partition_compressed_indices)).size() ==
+                     adj_matrix_partition_offsets.size()),
+                  "Internal Error: adj_matrix_partition_compressed_indices.size() should coincide "
+                  "with adj_matrix_partition_offsets.size() (if used).");
 
   CUGRAPH_EXPECTS(adj_matrix_partition_offsets.size() == static_cast<size_t>(col_comm_size),
                   "Internal Error: erroneous adj_matrix_partition_offsets.size().");
@@ -525,10 +591,12 @@ graph_view_t<
 {
   // cheap error checks
 
-  CUGRAPH_EXPECTS(
-    !(meta.segment_offsets).has_value() ||
-      ((*(meta.segment_offsets)).size() == (detail::num_sparse_segments_per_vertex_partition + 1)),
-    "Internal Error: (*(meta.segment_offsets)).size() returns an invalid value.");
+  CUGRAPH_EXPECTS(!(meta.segment_offsets).has_value() ||
+                    ((*(meta.segment_offsets)).size() ==
+                     (detail::num_sparse_segments_per_vertex_partition + 1)) ||
+                    ((*(meta.segment_offsets)).size() ==
+                     (detail::num_sparse_segments_per_vertex_partition + 2)),
+                  "Internal Error: (*(meta.segment_offsets)).size() returns an invalid value.");
 
   // skip expensive error checks as this function is only called by graph_t
 }
@@ -543,6 +611,7 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
   compute_in_degrees(raft::handle_t const& handle) const
 {
   if (store_transposed) {
+    if (this->has_edge_mask()) { return compute_masked_major_degrees(handle, *this); }
     return compute_major_degrees(handle,
                                  this->adj_matrix_partition_offsets_,
                                  this->adj_matrix_partition_dcs_nzd_vertices_,
@@ -568,7 +637,13 @@ graph_view_t<vertex_t,
              std::enable_if_t<!multi_gpu>>::compute_in_degrees(raft::handle_t const& handle) const
 {
   if (store_transposed) {
-    return compute_major_degrees(handle, this->offsets_, this->get_number_of_local_vertices());
+    if (this->has_edge_mask()) { return compute_masked_major_degrees(handle, *this); }
+    return compute_major_degrees(handle,
+                                 this->offsets_,
+                                 this->dcs_nzd_vertices_,
+                                 this->dcs_nzd_vertex_count_,
+                                 this->get_number_of_local_vertices(),
+                                 this->segment_offsets_);
   } else {
     return compute_minor_degrees(handle, *this);
   }
@@ -586,6 +661,7 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
   if (store_transposed) {
     return compute_minor_degrees(handle, *this);
   } else {
+    if (this->has_edge_mask()) { return compute_masked_major_degrees(handle, *this); }
     return compute_major_degrees(handle,
                                  this->adj_matrix_partition_offsets_,
                                  this->adj_matrix_partition_dcs_nzd_vertices_,
@@ -611,7 +687,13 @@ graph_view_t<vertex_t,
   if (store_transposed) {
     return compute_minor_degrees(handle, *this);
   } else {
-    return compute_major_degrees(handle, this->offsets_, this->get_number_of_local_vertices());
+    if (this->has_edge_mask()) { return compute_masked_major_degrees(handle, *this); }
+    return compute_major_degrees(handle,
+                                 this->offsets_,
+                                 this->dcs_nzd_vertices_,
+                                 this->dcs_nzd_vertex_count_,
+                                 this->get_number_of_local_vertices(),
+                                 this->segment_offsets_);
   }
 }
 
@@ -913,6 +995,8 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
   count_multi_edges(raft::handle_t const& handle) const
 {
   if (!this->is_multigraph()) { return edge_t{0}; }
+  CUGRAPH_EXPECTS(!this->has_edge_mask(),
+                  "Invalid input argument: count_multi_edges does not support edge masks yet.");
 
   edge_t count{0};
   for (size_t i = 0; i < this->get_number_of_local_adj_matrix_partitions(); ++i) {
@@ -941,6 +1025,8 @@ edge_t graph_view_t<vertex_t,
   const
 {
   if (!this->is_multigraph()) { return edge_t{0}; }
+  CUGRAPH_EXPECTS(!this->has_edge_mask(),
+                  "Invalid input argument: count_multi_edges does not support edge masks yet.");
 
   return count_matrix_partition_multi_edges(
     handle,
@@ -19,17 +19,29 @@ namespace cugraph {
 
 // SG instantiation
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template class graph_view_t<int32_t, int32_t, float, true, false>;
 template class graph_view_t<int32_t, int32_t, float, false, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template class graph_view_t<int32_t, int32_t, double, true, false>;
 template class graph_view_t<int32_t, int32_t, double, false, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template class graph_view_t<int32_t, int64_t, float, true, false>;
 template class graph_view_t<int32_t, int64_t, float, false, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template class graph_view_t<int32_t, int64_t, double, true, false>;
 template class graph_view_t<int32_t, int64_t, double, false, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template class graph_view_t<int64_t, int64_t, float, true, false>;
 template class graph_view_t<int64_t, int64_t, float, false, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template class graph_view_t<int64_t, int64_t, double, true, false>;
 template class graph_view_t<int64_t, int64_t, double, false, false>;
+#endif
 
 }  // namespace cugraph
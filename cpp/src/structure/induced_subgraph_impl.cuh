@@ -19,23 +19,140 @@
 #include <cugraph/graph_view.hpp>
 #include <cugraph/matrix_partition_device_view.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/shuffle_comm.cuh>
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/adjacent_difference.h>
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/gather.h>
 #include <thrust/sort.h>
 #include <thrust/tuple.h>
 
+#include <numeric>
 #include <tuple>
+#include <vector>
 
 #include <utilities/high_res_timer.hpp>
 
 namespace cugraph {
 
+namespace detail {
+
+uint8_t constexpr induced_subgraph_major_role{0x1};
+uint8_t constexpr induced_subgraph_minor_role{0x2};
+
+// roles (major and/or minor) a vertex plays in the local adjacency matrix partitions of a GPU
+template <typename vertex_t>
+struct induced_subgraph_vertex_roles_t {
+  vertex_t const* major_firsts{nullptr};  // size = comm_size * num_matrix_partitions
+  vertex_t const* major_lasts{nullptr};   // size = comm_size * num_matrix_partitions
+  vertex_t const* minor_firsts{nullptr};  // size = comm_size
+  vertex_t const* minor_lasts{nullptr};   // size = comm_size
+  size_t num_matrix_partitions{0};
+
+  __device__ uint8_t operator()(int gpu_id, vertex_t v) const
+  {
+    uint8_t roles{0};
+    for (size_t i = 0; i < num_matrix_partitions; ++i) {
+      auto idx = static_cast<size_t>(gpu_id) * num_matrix_partitions + i;
+      if ((v >= major_firsts[idx]) && (v < major_lasts[idx])) {
+        roles |= induced_subgraph_major_role;
+        break;
+      }
+    }
+    if ((v >= minor_firsts[gpu_id]) && (v < minor_lasts[gpu_id])) {
+      roles |= induced_subgraph_minor_role;
+    }
+    return roles;
+  }
+};
+
+// candidate i pairs the (i % num_aggregate_subgraph_vertices)'th subgraph vertex with GPU (i /
+// num_aggregate_subgraph_vertices), so the selected candidates come out grouped by GPU
+template <typename vertex_t>
+struct induced_subgraph_tx_candidate_t {
+  size_t const* subgraph_offsets{nullptr};
+  vertex_t const* subgraph_vertices{nullptr};
+  size_t num_subgraphs{0};
+  size_t num_aggregate_subgraph_vertices{0};
+  size_t subgraph_key_first{0};
+  induced_subgraph_vertex_roles_t<vertex_t> vertex_roles{};
+
+  __device__ thrust::tuple<int, size_t, vertex_t, uint8_t> operator()(size_t i) const
+  {
+    auto gpu_id       = static_cast<int>(i / num_aggregate_subgraph_vertices);
+    auto idx          = i % num_aggregate_subgraph_vertices;
+    auto subgraph_idx = static_cast<size_t>(thrust::distance(
+      subgraph_offsets + 1,
+      thrust::upper_bound(thrust::seq, subgraph_offsets, subgraph_offsets + num_subgraphs, idx)));
+    auto v = subgraph_vertices[idx];
+    return thrust::make_tuple(
+      gpu_id, subgraph_key_first + subgraph_idx, v, vertex_roles(gpu_id, v));
+  }
+};
+
+// the local edges of the m'th (subgraph key, major) pair and the (sorted) vertices of the same
+// subgraph in the local minor range
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+struct induced_subgraph_local_major_t {
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> matrix_partition;
+  vertex_t major_hypersparse_first{};
+  size_t const* major_keys{nullptr};
+  vertex_t const* major_vertices{nullptr};
+  size_t const* minor_keys{nullptr};
+  vertex_t const* minor_vertices{nullptr};
+  size_t num_minors{0};
+
+  __device__ thrust::tuple<minor_iterator_t<vertex_t, edge_t>,
+                           thrust::optional<weight_t const*>,
+                           edge_t,
+                           vertex_t const*,
+                           vertex_t const*>
+  operator()(size_t m) const
+  {
+    auto key   = major_keys[m];
+    auto major = major_vertices[m];
+
+    minor_iterator_t<vertex_t, edge_t> indices{};
+    thrust::optional<weight_t const*> weights{thrust::nullopt};
+    edge_t local_degree{0};
+    auto major_idx = thrust::optional<vertex_t>{
+      matrix_partition.get_major_offset_from_major_nocheck(major)};
+    if (major >= major_hypersparse_first) {
+      auto major_hypersparse_idx =
+        matrix_partition.get_major_hypersparse_idx_from_major_nocheck(major);
+      major_idx =
+        major_hypersparse_idx
+          ? thrust::optional<vertex_t>{matrix_partition.get_major_offset_from_major_nocheck(
+                                         major_hypersparse_first) +
+                                       *major_hypersparse_idx}
+          : thrust::nullopt;  // no local edges
+    }
+    if (major_idx) {
+      thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(*major_idx);
+    }
+
+    auto vertex_first =
+      minor_vertices +
+      thrust::distance(minor_keys,
+                       thrust::lower_bound(thrust::seq, minor_keys, minor_keys + num_minors, key));
+    auto vertex_last =
+      minor_vertices +
+      thrust::distance(minor_keys,
+                       thrust::upper_bound(thrust::seq, minor_keys, minor_keys + num_minors, key));
+
+    return thrust::make_tuple(indices, weights, local_degree, vertex_first, vertex_last);
+  }
+};
+
+}  // namespace detail
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -86,8 +203,10 @@ extract_induced_subgraphs(
                                      subgraph_vertices,
                                      subgraph_vertices + num_aggregate_subgraph_vertices,
                                      [vertex_partition] __device__(auto v) {
+                                       // (multi-GPU: need not be local, shuffled below)
                                        return !vertex_partition.is_valid_vertex(v) ||
-                                              !vertex_partition.is_local_vertex_nocheck(v);
+                                              (!multi_gpu &&
+                                               !vertex_partition.is_local_vertex_nocheck(v));
                                      }) == 0,
                     "Invalid input argument: subgraph_vertices has invalid vertex IDs.");
 
@@ -115,12 +234,421 @@ extract_induced_subgraphs(
 
   // 2. extract induced subgraphs
 
-  if (multi_gpu) {
-    CUGRAPH_FAIL("Unimplemented.");
-    return std::make_tuple(rmm::device_uvector<vertex_t>(0, handle.get_stream_view()),
-                           rmm::device_uvector<vertex_t>(0, handle.get_stream_view()),
-                           rmm::device_uvector<weight_t>(0, handle.get_stream_view()),
-                           rmm::device_uvector<size_t>(0, handle.get_stream_view()));
+  if constexpr (multi_gpu) {
+    // the subgraph vertices are shuffled to the GPUs holding them as majors and/or minors, the
+    // edges are extracted locally and sent back to the GPU requesting the subgraph; all the local
+    // subgraphs are processed in bulk, so the same (fixed) set of collectives serves any number of
+    // subgraphs
+
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    size_t num_aggregate_subgraph_vertices{};
+    raft::update_host(
+      &num_aggregate_subgraph_vertices, subgraph_offsets + num_subgraphs, 1, handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    // 2-1. assign globally unique subgraph keys (subgraph_key_offsets[r] + local subgraph index for
+    // the subgraphs of GPU r)
+
+    auto h_num_subgraphs = host_scalar_allgather(comm, num_subgraphs, handle.get_stream());
+    std::vector<size_t> h_subgraph_key_offsets(comm_size + 1, size_t{0});
+    std::partial_sum(
+      h_num_subgraphs.begin(), h_num_subgraphs.end(), h_subgraph_key_offsets.begin() + 1);
+    rmm::device_uvector<size_t> d_subgraph_key_offsets(h_subgraph_key_offsets.size(),
+                                                       handle.get_stream_view());
+    raft::update_device(d_subgraph_key_offsets.data(),
+                        h_subgraph_key_offsets.data(),
+                        h_subgraph_key_offsets.size(),
+                        handle.get_stream());
+
+    // 2-2. collect the major ranges (of every local adjacency matrix partition) and the minor range
+    // of every GPU (the number of local adjacency matrix partitions is the same on every GPU)
+
+    auto num_matrix_partitions = graph_view.get_number_of_local_adj_matrix_partitions();
+    std::vector<vertex_t> h_major_firsts(comm_size * num_matrix_partitions);
+    std::vector<vertex_t> h_major_lasts(h_major_firsts.size());
+    for (size_t i = 0; i < num_matrix_partitions; ++i) {
+      auto matrix_partition = matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+        graph_view.get_matrix_partition_view(i));
+      auto major_ranges = host_scalar_allgather(
+        comm,
+        thrust::make_tuple(matrix_partition.get_major_first(), matrix_partition.get_major_last()),
+        handle.get_stream());
+      for (int j = 0; j < comm_size; ++j) {
+        h_major_firsts[j * num_matrix_partitions + i] = thrust::get<0>(major_ranges[j]);
+        h_major_lasts[j * num_matrix_partitions + i]  = thrust::get<1>(major_ranges[j]);
+      }
+    }
+    auto minor_range = [&graph_view]() {
+      auto matrix_partition = matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+        graph_view.get_matrix_partition_view(size_t{0}));
+      return thrust::make_tuple(matrix_partition.get_minor_first(),
+                                matrix_partition.get_minor_last());
+    }();
+    auto minor_ranges = host_scalar_allgather(comm, minor_range, handle.get_stream());
+    std::vector<vertex_t> h_minor_firsts(comm_size);
+    std::vector<vertex_t> h_minor_lasts(comm_size);
+    for (int j = 0; j < comm_size; ++j) {
+      h_minor_firsts[j] = thrust::get<0>(minor_ranges[j]);
+      h_minor_lasts[j]  = thrust::get<1>(minor_ranges[j]);
+    }
+
+    rmm::device_uvector<vertex_t> d_major_firsts(h_major_firsts.size(), handle.get_stream_view());
+    rmm::device_uvector<vertex_t> d_major_lasts(h_major_lasts.size(), handle.get_stream_view());
+    rmm::device_uvector<vertex_t> d_minor_firsts(h_minor_firsts.size(), handle.get_stream_view());
+    rmm::device_uvector<vertex_t> d_minor_lasts(h_minor_lasts.size(), handle.get_stream_view());
+    raft::update_device(
+      d_major_firsts.data(), h_major_firsts.data(), h_major_firsts.size(), handle.get_stream());
+    raft::update_device(
+      d_major_lasts.data(), h_major_lasts.data(), h_major_lasts.size(), handle.get_stream());
+    raft::update_device(
+      d_minor_firsts.data(), h_minor_firsts.data(), h_minor_firsts.size(), handle.get_stream());
+    raft::update_device(
+      d_minor_lasts.data(), h_minor_lasts.data(), h_minor_lasts.size(), handle.get_stream());
+
+    // 2-3. send each (subgraph key, vertex) pair to the GPUs holding the vertex as a major and/or
+    // minor
+
+    detail::induced_subgraph_tx_candidate_t<vertex_t> tx_candidate_op{
+      subgraph_offsets,
+      subgraph_vertices,
+      num_subgraphs,
+      num_aggregate_subgraph_vertices,
+      h_subgraph_key_offsets[comm_rank],
+      detail::induced_subgraph_vertex_roles_t<vertex_t>{d_major_firsts.data(),
+                                                        d_major_lasts.data(),
+                                                        d_minor_firsts.data(),
+                                                        d_minor_lasts.data(),
+                                                        num_matrix_partitions}};
+    auto tx_candidate_first =
+      thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}), tx_candidate_op);
+    auto tx_candidate_last =
+      tx_candidate_first + num_aggregate_subgraph_vertices * static_cast<size_t>(comm_size);
+
+    auto num_tx_pairs = static_cast<size_t>(thrust::count_if(
+      handle.get_thrust_policy(), tx_candidate_first, tx_candidate_last, [] __device__(auto t) {
+        return thrust::get<3>(t) != uint8_t{0};
+      }));
+
+    rmm::device_uvector<int> tx_gpu_ids(num_tx_pairs, handle.get_stream_view());
+    rmm::device_uvector<size_t> tx_keys(num_tx_pairs, handle.get_stream_view());
+    rmm::device_uvector<vertex_t> tx_vertices(num_tx_pairs, handle.get_stream_view());
+    rmm::device_uvector<uint8_t> tx_roles(num_tx_pairs, handle.get_stream_view());
+    thrust::copy_if(handle.get_thrust_policy(),
+                    tx_candidate_first,
+                    tx_candidate_last,
+                    thrust::make_zip_iterator(thrust::make_tuple(
+                      tx_gpu_ids.begin(), tx_keys.begin(), tx_vertices.begin(), tx_roles.begin())),
+                    [] __device__(auto t) { return thrust::get<3>(t) != uint8_t{0}; });
+
+    rmm::device_uvector<size_t> d_tx_counts(comm_size, handle.get_stream_view());
+    thrust::upper_bound(handle.get_thrust_policy(),
+                        tx_gpu_ids.begin(),
+                        tx_gpu_ids.end(),
+                        thrust::make_counting_iterator(int{0}),
+                        thrust::make_counting_iterator(comm_size),
+                        d_tx_counts.begin());
+    thrust::adjacent_difference(
+      handle.get_thrust_policy(), d_tx_counts.begin(), d_tx_counts.end(), d_tx_counts.begin());
+    std::vector<size_t> h_tx_counts(comm_size);
+    raft::update_host(h_tx_counts.data(), d_tx_counts.data(), comm_size, handle.get_stream());
+    handle.get_stream_view().synchronize();
+    tx_gpu_ids.resize(0, handle.get_stream_view());
+    tx_gpu_ids.shrink_to_fit(handle.get_stream_view());
+
+    rmm::device_uvector<size_t> rx_keys(0, handle.get_stream_view());
+    rmm::device_uvector<vertex_t> rx_vertices(0, handle.get_stream_view());
+    rmm::device_uvector<uint8_t> rx_roles(0, handle.get_stream_view());
+    std::forward_as_tuple(std::tie(rx_keys, rx_vertices, rx_roles), std::ignore) = shuffle_values(
+      comm,
+      thrust::make_zip_iterator(
+        thrust::make_tuple(tx_keys.begin(), tx_vertices.begin(), tx_roles.begin())),
+      h_tx_counts,
+      handle.get_stream_view());
+    tx_keys.resize(0, handle.get_stream_view());
+    tx_keys.shrink_to_fit(handle.get_stream_view());
+    tx_vertices.resize(0, handle.get_stream_view());
+    tx_vertices.shrink_to_fit(handle.get_stream_view());
+    tx_roles.resize(0, handle.get_stream_view());
+    tx_roles.shrink_to_fit(handle.get_stream_view());
+
+    // 2-4. split the received pairs into majors (sorted by vertex, so the majors of each local
+    // adjacency matrix partition are contiguous) and minors (sorted by subgraph key, then by
+    // vertex, to be searched)
+
+    auto rx_pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(rx_keys.begin(), rx_vertices.begin()));
+    auto is_major = [] __device__(auto r) {
+      return (r & detail::induced_subgraph_major_role) != uint8_t{0};
+    };
+    auto is_minor = [] __device__(auto r) {
+      return (r & detail::induced_subgraph_minor_role) != uint8_t{0};
+    };
+    auto num_majors = static_cast<size_t>(
+      thrust::count_if(handle.get_thrust_policy(), rx_roles.begin(), rx_roles.end(), is_major));
+    auto num_minors = static_cast<size_t>(
+      thrust::count_if(handle.get_thrust_policy(), rx_roles.begin(), rx_roles.end(), is_minor));
+
+    rmm::device_uvector<size_t> major_keys(num_majors, handle.get_stream_view());
+    rmm::device_uvector<vertex_t> major_vertices(num_majors, handle.get_stream_view());
+    rmm::device_uvector<size_t> minor_keys(num_minors, handle.get_stream_view());
+    rmm::device_uvector<vertex_t> minor_vertices(num_minors, handle.get_stream_view());
+    thrust::copy_if(
+      handle.get_thrust_policy(),
+      rx_pair_first,
+      rx_pair_first + rx_keys.size(),
+      rx_roles.begin(),
+      thrust::make_zip_iterator(thrust::make_tuple(major_keys.begin(), major_vertices.begin())),
+      is_major);
+    thrust::copy_if(
+      handle.get_thrust_policy(),
+      rx_pair_first,
+      rx_pair_first + rx_keys.size(),
+      rx_roles.begin(),
+      thrust::make_zip_iterator(thrust::make_tuple(minor_keys.begin(), minor_vertices.begin())),
+      is_minor);
+    rx_keys.resize(0, handle.get_stream_view());
+    rx_keys.shrink_to_fit(handle.get_stream_view());
+    rx_vertices.resize(0, handle.get_stream_view());
+    rx_vertices.shrink_to_fit(handle.get_stream_view());
+    rx_roles.resize(0, handle.get_stream_view());
+    rx_roles.shrink_to_fit(handle.get_stream_view());
+
+    auto major_pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(major_vertices.begin(), major_keys.begin()));
+    thrust::sort(handle.get_thrust_policy(), major_pair_first, major_pair_first + num_majors);
+    auto minor_pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(minor_keys.begin(), minor_vertices.begin()));
+    thrust::sort(handle.get_thrust_policy(), minor_pair_first, minor_pair_first + num_minors);
+
+    // 2-5. Phase 1: calculate memory requirements (as in single-GPU, per local adjacency matrix
+    // partition)
+
+    std::vector<size_t> h_major_partition_offsets(num_matrix_partitions + 1, size_t{0});
+    {
+      std::vector<vertex_t> h_local_major_lasts(
+        h_major_lasts.begin() + comm_rank * num_matrix_partitions,
+        h_major_lasts.begin() + (comm_rank + 1) * num_matrix_partitions);
+      rmm::device_uvector<vertex_t> d_local_major_lasts(h_local_major_lasts.size(),
+                                                        handle.get_stream_view());
+      raft::update_device(d_local_major_lasts.data(),
+                          h_local_major_lasts.data(),
+                          h_local_major_lasts.size(),
+                          handle.get_stream());
+      rmm::device_uvector<size_t> d_major_partition_offsets(num_matrix_partitions,
+                                                            handle.get_stream_view());
+      thrust::lower_bound(handle.get_thrust_policy(),
+                          major_vertices.begin(),
+                          major_vertices.end(),
+                          d_local_major_lasts.begin(),
+                          d_local_major_lasts.end(),
+                          d_major_partition_offsets.begin());
+      raft::update_host(h_major_partition_offsets.data() + 1,
+                        d_major_partition_offsets.data(),
+                        d_major_partition_offsets.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+    }
+
+    auto local_major_op = [&](size_t i) {
+      auto matrix_partition = matrix_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu>(
+        graph_view.get_matrix_partition_view(i));
+      auto segment_offsets = graph_view.get_local_adj_matrix_partition_segment_offsets(i);
+      auto use_dcs =
+        segment_offsets
+          ? ((*segment_offsets).size() > (detail::num_sparse_segments_per_vertex_partition + 1))
+          : false;
+      auto major_hypersparse_first =
+        use_dcs ? matrix_partition.get_major_first() +
+                    (*segment_offsets)[detail::num_sparse_segments_per_vertex_partition]
+                : matrix_partition.get_major_last();
+      return detail::induced_subgraph_local_major_t<vertex_t, edge_t, weight_t, multi_gpu>{
+        matrix_partition,
+        major_hypersparse_first,
+        major_keys.data(),
+        major_vertices.data(),
+        minor_keys.data(),
+        minor_vertices.data(),
+        num_minors};
+    };
+
+    rmm::device_uvector<size_t> major_output_offsets(num_majors + 1, handle.get_stream_view());
+    for (size_t i = 0; i < num_matrix_partitions; ++i) {
+      thrust::transform(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(h_major_partition_offsets[i]),
+                        thrust::make_counting_iterator(h_major_partition_offsets[i + 1]),
+                        major_output_offsets.begin() + h_major_partition_offsets[i],
+                        [local_major = local_major_op(i)] __device__(auto m) {
+                          auto t = local_major(m);
+                          // FIXME: this is inefficient for high local degree vertices
+                          return static_cast<size_t>(thrust::count_if(
+                            thrust::seq,
+                            thrust::get<0>(t),
+                            thrust::get<0>(t) + thrust::get<2>(t),
+                            [vertex_first = thrust::get<3>(t),
+                             vertex_last  = thrust::get<4>(t)] __device__(auto nbr) {
+                              return thrust::binary_search(
+                                thrust::seq, vertex_first, vertex_last, nbr);
+                            }));
+                        });
+    }
+    thrust::exclusive_scan(handle.get_thrust_policy(),
+                           major_output_offsets.begin(),
+                           major_output_offsets.end(),
+                           major_output_offsets.begin());
+
+    size_t num_local_edges{};
+    raft::update_host(
+      &num_local_edges, major_output_offsets.data() + num_majors, 1, handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    // 2-6. Phase 2: find the local edges in the induced subgraphs
+
+    rmm::device_uvector<size_t> edge_keys(num_local_edges, handle.get_stream_view());
+    rmm::device_uvector<vertex_t> edge_majors(num_local_edges, handle.get_stream_view());
+    rmm::device_uvector<vertex_t> edge_minors(num_local_edges, handle.get_stream_view());
+    auto edge_weights = graph_view.is_weighted()
+                          ? std::make_optional<rmm::device_uvector<weight_t>>(
+                              num_local_edges, handle.get_stream_view())
+                          : std::nullopt;
+
+    for (size_t i = 0; i < num_matrix_partitions; ++i) {
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(h_major_partition_offsets[i]),
+        thrust::make_counting_iterator(h_major_partition_offsets[i + 1]),
+        [local_major          = local_major_op(i),
+         major_output_offsets = major_output_offsets.data(),
+         edge_keys            = edge_keys.data(),
+         edge_majors          = edge_majors.data(),
+         edge_minors          = edge_minors.data(),
+         edge_weights = edge_weights ? thrust::optional<weight_t*>{(*edge_weights).data()}
+                                     : thrust::nullopt] __device__(auto m) {
+          detail::minor_iterator_t<vertex_t, edge_t> indices{};
+          thrust::optional<weight_t const*> weights{thrust::nullopt};
+          edge_t local_degree{};
+          vertex_t const* vertex_first{nullptr};
+          vertex_t const* vertex_last{nullptr};
+          thrust::tie(indices, weights, local_degree, vertex_first, vertex_last) = local_major(m);
+          auto key_first   = thrust::make_constant_iterator(local_major.major_keys[m]);
+          auto major_first = thrust::make_constant_iterator(local_major.major_vertices[m]);
+          auto pred = [vertex_first, vertex_last] __device__(auto t) {
+            return thrust::binary_search(
+              thrust::seq, vertex_first, vertex_last, thrust::get<2>(t));
+          };
+          // FIXME: this is inefficient for high local degree vertices
+          if (weights) {
+            auto edge_first = thrust::make_zip_iterator(
+              thrust::make_tuple(key_first, major_first, indices, *weights));
+            thrust::copy_if(thrust::seq,
+                            edge_first,
+                            edge_first + local_degree,
+                            thrust::make_zip_iterator(thrust::make_tuple(
+                              edge_keys, edge_majors, edge_minors, *edge_weights)) +
+                              major_output_offsets[m],
+                            pred);
+          } else {
+            auto edge_first =
+              thrust::make_zip_iterator(thrust::make_tuple(key_first, major_first, indices));
+            thrust::copy_if(
+              thrust::seq,
+              edge_first,
+              edge_first + local_degree,
+              thrust::make_zip_iterator(thrust::make_tuple(edge_keys, edge_majors, edge_minors)) +
+                major_output_offsets[m],
+              pred);
+          }
+        });
+    }
+    major_keys.resize(0, handle.get_stream_view());
+    major_keys.shrink_to_fit(handle.get_stream_view());
+    major_vertices.resize(0, handle.get_stream_view());
+    major_vertices.shrink_to_fit(handle.get_stream_view());
+    minor_keys.resize(0, handle.get_stream_view());
+    minor_keys.shrink_to_fit(handle.get_stream_view());
+    minor_vertices.resize(0, handle.get_stream_view());
+    minor_vertices.shrink_to_fit(handle.get_stream_view());
+
+    // 2-7. send the edges back to the GPUs that requested their subgraphs
+
+    auto key_to_gpu_id_op = [subgraph_key_offsets = d_subgraph_key_offsets.data(),
+                             comm_size] __device__(auto t) {
+      return static_cast<int>(
+        thrust::distance(subgraph_key_offsets + 1,
+                         thrust::upper_bound(thrust::seq,
+                                             subgraph_key_offsets + 1,
+                                             subgraph_key_offsets + (comm_size + 1),
+                                             thrust::get<0>(t))));
+    };
+
+    rmm::device_uvector<size_t> rx_edge_keys(0, handle.get_stream_view());
+    rmm::device_uvector<vertex_t> rx_edge_majors(0, handle.get_stream_view());
+    rmm::device_uvector<vertex_t> rx_edge_minors(0, handle.get_stream_view());
+    std::optional<rmm::device_uvector<weight_t>> rx_edge_weights{std::nullopt};
+    if (edge_weights) {
+      auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(
+        edge_keys.begin(), edge_majors.begin(), edge_minors.begin(), (*edge_weights).begin()));
+      std::forward_as_tuple(std::tie(rx_edge_keys, rx_edge_majors, rx_edge_minors, rx_edge_weights),
+                            std::ignore) =
+        groupby_gpuid_and_shuffle_values(comm,
+                                         edge_first,
+                                         edge_first + edge_keys.size(),
+                                         key_to_gpu_id_op,
+                                         handle.get_stream_view());
+    } else {
+      auto edge_first = thrust::make_zip_iterator(
+        thrust::make_tuple(edge_keys.begin(), edge_majors.begin(), edge_minors.begin()));
+      std::forward_as_tuple(std::tie(rx_edge_keys, rx_edge_majors, rx_edge_minors), std::ignore) =
+        groupby_gpuid_and_shuffle_values(comm,
+                                         edge_first,
+                                         edge_first + edge_keys.size(),
+                                         key_to_gpu_id_op,
+                                         handle.get_stream_view());
+    }
+    edge_keys.resize(0, handle.get_stream_view());
+    edge_keys.shrink_to_fit(handle.get_stream_view());
+    edge_majors.resize(0, handle.get_stream_view());
+    edge_majors.shrink_to_fit(handle.get_stream_view());
+    edge_minors.resize(0, handle.get_stream_view());
+    edge_minors.shrink_to_fit(handle.get_stream_view());
+    edge_weights = std::nullopt;
+
+    // 2-8. order the received edges by (local) subgraph index and compute the subgraph edge offsets
+
+    thrust::transform(handle.get_thrust_policy(),
+                      rx_edge_keys.begin(),
+                      rx_edge_keys.end(),
+                      rx_edge_keys.begin(),
+                      [subgraph_key_first = h_subgraph_key_offsets[comm_rank]] __device__(
+                        auto key) { return key - subgraph_key_first; });
+    auto rx_edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(rx_edge_keys.begin(), rx_edge_majors.begin(), rx_edge_minors.begin()));
+    if (rx_edge_weights) {
+      thrust::sort_by_key(handle.get_thrust_policy(),
+                          rx_edge_first,
+                          rx_edge_first + rx_edge_keys.size(),
+                          (*rx_edge_weights).begin());
+    } else {
+      thrust::sort(handle.get_thrust_policy(), rx_edge_first, rx_edge_first + rx_edge_keys.size());
+    }
+
+    rmm::device_uvector<size_t> subgraph_edge_offsets(num_subgraphs + 1, handle.get_stream_view());
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        rx_edge_keys.begin(),
+                        rx_edge_keys.end(),
+                        thrust::make_counting_iterator(size_t{0}),
+                        thrust::make_counting_iterator(num_subgraphs + 1),
+                        subgraph_edge_offsets.begin());
+#ifdef TIMING
+    hr_timer.stop();
+    hr_timer.display(std::cout);
+#endif
+    return std::make_tuple(std::move(rx_edge_majors),
+                           std::move(rx_edge_minors),
+                           std::move(rx_edge_weights),
+                           std::move(subgraph_edge_offsets));
   } else {
     // 2-1. Phase 1: calculate memory requirements
 
@@ -146,7 +674,7 @@ extract_induced_subgraphs(
         auto subgraph_idx = thrust::distance(
           subgraph_offsets + 1,
           thrust::upper_bound(thrust::seq, subgraph_offsets, subgraph_offsets + num_subgraphs, i));
-        vertex_t const* indices{nullptr};
+        detail::minor_iterator_t<vertex_t, edge_t> indices{};
         thrust::optional<weight_t const*> weights{thrust::nullopt};
         edge_t local_degree{};
         auto major_offset =
@@ -204,7 +732,7 @@ extract_induced_subgraphs(
           subgraph_offsets + 1,
           thrust::upper_bound(
             thrust::seq, subgraph_offsets, subgraph_offsets + num_subgraphs, size_t{i}));
-        vertex_t const* indices{nullptr};
+        detail::minor_iterator_t<vertex_t, edge_t> indices{};
         thrust::optional<weight_t const*> weights{thrust::nullopt};
         edge_t local_degree{};
         auto major_offset =
@@ -19,6 +19,7 @@ namespace cugraph {
 
 // MG instantiation
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<float>>,
@@ -40,7 +41,9 @@ extract_induced_subgraphs(raft::handle_t const& handle,
                           int32_t const* subgraph_vertices,
                           size_t num_subgraphs,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<double>>,
@@ -62,7 +65,9 @@ extract_induced_subgraphs(raft::handle_t const& handle,
                           int32_t const* subgraph_vertices,
                           size_t num_subgraphs,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<float>>,
@@ -84,7 +89,9 @@ extract_induced_subgraphs(raft::handle_t const& handle,
                           int32_t const* subgraph_vertices,
                           size_t num_subgraphs,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<double>>,
@@ -106,7 +113,9 @@ extract_induced_subgraphs(raft::handle_t const& handle,
                           int32_t const* subgraph_vertices,
                           size_t num_subgraphs,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::tuple<rmm::device_uvector<int64_t>,
                     rmm::device_uvector<int64_t>,
                     std::optional<rmm::device_uvector<float>>,
@@ -128,7 +137,9 @@ extract_induced_subgraphs(raft::handle_t const& handle,
                           int64_t const* subgraph_vertices,
                           size_t num_subgraphs,
                           bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::tuple<rmm::device_uvector<int64_t>,
                     rmm::device_uvector<int64_t>,
                     std::optional<rmm::device_uvector<double>>,
@@ -150,5 +161,6 @@ extract_induced_subgraphs(raft::handle_t const& handle,
                           int64_t const* subgraph_vertices,
                           size_t num_subgraphs,
                           bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
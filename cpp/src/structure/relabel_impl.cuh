@@ -19,18 +19,25 @@
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/relabel_table.hpp>
+#include <cugraph/utilities/collect_comm.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <cuco/static_map.cuh>
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/mr/device/polymorphic_allocator.hpp>
 
 #include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/sort.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
@@ -232,4 +239,140 @@ void relabel(raft::handle_t const& handle,
   return;
 }
 
+template <typename vertex_t, bool multi_gpu>
+relabel_table_t<vertex_t, multi_gpu>::relabel_table_t(
+  raft::handle_t const& handle,
+  std::tuple<vertex_t const*, vertex_t const*> old_new_label_pairs,
+  vertex_t num_label_pairs,
+  bool do_expensive_check)
+  : sorted_old_labels_(num_label_pairs, handle.get_stream_view()),
+    new_labels_(num_label_pairs, handle.get_stream_view())
+{
+  thrust::copy(handle.get_thrust_policy(),
+               std::get<0>(old_new_label_pairs),
+               std::get<0>(old_new_label_pairs) + num_label_pairs,
+               sorted_old_labels_.begin());
+  thrust::copy(handle.get_thrust_policy(),
+               std::get<1>(old_new_label_pairs),
+               std::get<1>(old_new_label_pairs) + num_label_pairs,
+               new_labels_.begin());
+
+  if (multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    // shuffle the old_new_label_pairs based on applying the compute_gpu_id_from_vertex_t functor
+    // to the old labels
+
+    auto pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(sorted_old_labels_.begin(), new_labels_.begin()));
+    std::forward_as_tuple(std::tie(sorted_old_labels_, new_labels_), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        pair_first,
+        pair_first + sorted_old_labels_.size(),
+        [key_func = detail::compute_gpu_id_from_vertex_t<vertex_t>{comm.get_size()}] __device__(
+          auto val) { return key_func(thrust::get<0>(val)); },
+        handle.get_stream_view());
+  }
+
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      sorted_old_labels_.begin(),
+                      sorted_old_labels_.end(),
+                      new_labels_.begin());
+
+  if (do_expensive_check && (sorted_old_labels_.size() > 1)) {
+    CUGRAPH_EXPECTS(
+      thrust::count_if(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{1}),
+                       thrust::make_counting_iterator(sorted_old_labels_.size()),
+                       [sorted_old_labels = sorted_old_labels_.data()] __device__(auto i) {
+                         return sorted_old_labels[i - 1] == sorted_old_labels[i];
+                       }) == 0,
+      "Invalid input argument: old_new_label_pairs have duplicate old labels.");
+  }
+}
+
+template <typename vertex_t, bool multi_gpu>
+void relabel_table_t<vertex_t, multi_gpu>::relabel(raft::handle_t const& handle,
+                                                   vertex_t* labels /* [INOUT] */,
+                                                   size_t num_labels,
+                                                   bool skip_missing_labels,
+                                                   bool do_expensive_check) const
+{
+  rmm::device_uvector<vertex_t> new_labels(0, handle.get_stream_view());
+  if (multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    new_labels = collect_values_for_keys(
+      comm,
+      sorted_old_labels_.begin(),
+      sorted_old_labels_.end(),
+      new_labels_.begin(),
+      labels,
+      labels + num_labels,
+      detail::compute_gpu_id_from_vertex_t<vertex_t>{comm.get_size()},
+      handle.get_stream_view(),
+      collect_values_policy_t::binary_search);
+  } else {
+    new_labels.resize(num_labels, handle.get_stream_view());
+    detail::find_values_with_binary_search(sorted_old_labels_.begin(),
+                                           sorted_old_labels_.end(),
+                                           new_labels_.begin(),
+                                           labels,
+                                           labels + num_labels,
+                                           new_labels.begin(),
+                                           handle.get_stream_view());
+  }
+
+  if (skip_missing_labels) {
+    auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(labels, new_labels.begin()));
+    thrust::transform(handle.get_thrust_policy(),
+                      pair_first,
+                      pair_first + num_labels,
+                      labels,
+                      [] __device__(auto pair) {
+                        return thrust::get<1>(pair) != invalid_vertex_id<vertex_t>::value
+                                 ? thrust::get<1>(pair)
+                                 : thrust::get<0>(pair);
+                      });
+  } else {
+    thrust::copy(handle.get_thrust_policy(), new_labels.begin(), new_labels.end(), labels);
+    if (do_expensive_check) {
+      CUGRAPH_EXPECTS(
+        thrust::count(handle.get_thrust_policy(),
+                      labels,
+                      labels + num_labels,
+                      invalid_vertex_id<vertex_t>::value) == 0,
+        "Invalid input argument: labels include old label values missing in the relabel table.");
+    }
+  }
+}
+
+template <typename vertex_t, bool multi_gpu>
+void relabel_table_t<vertex_t, multi_gpu>::relabel_chunked(raft::handle_t const& handle,
+                                                           vertex_t* labels /* [INOUT] */,
+                                                           size_t num_labels,
+                                                           size_t chunk_size,
+                                                           bool skip_missing_labels,
+                                                           bool do_expensive_check) const
+{
+  CUGRAPH_EXPECTS(chunk_size > 0, "Invalid input argument: chunk_size should be positive.");
+
+  auto num_chunks = (num_labels + (chunk_size - 1)) / chunk_size;
+  if (multi_gpu) {
+    num_chunks = host_scalar_allreduce(
+      handle.get_comms(), num_chunks, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  rmm::device_uvector<vertex_t> chunk(std::min(chunk_size, num_labels), handle.get_stream_view());
+  for (size_t i = 0; i < num_chunks; ++i) {
+    auto chunk_first     = std::min(i * chunk_size, num_labels);
+    auto this_chunk_size = std::min(chunk_size, num_labels - chunk_first);
+    raft::copy(chunk.data(), labels + chunk_first, this_chunk_size, handle.get_stream());
+    relabel(handle, chunk.data(), this_chunk_size, skip_missing_labels, do_expensive_check);
+    raft::copy(labels + chunk_first, chunk.data(), this_chunk_size, handle.get_stream());
+  }
+  handle.get_stream_view().synchronize();  // labels may be (pageable) host memory
+}
+
 }  // namespace cugraph
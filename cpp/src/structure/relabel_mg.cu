@@ -36,4 +36,7 @@ template void relabel<int64_t, true>(raft::handle_t const& handle,
                                      bool skip_missing_labels,
                                      bool do_expensive_check);
 
+template class relabel_table_t<int32_t, true>;
+template class relabel_table_t<int64_t, true>;
+
 }  // namespace cugraph
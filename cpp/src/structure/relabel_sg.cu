@@ -38,4 +38,7 @@ template void relabel<int64_t, false>(
   bool skip_missing_labels,
   bool do_expensive_check);
 
+template class relabel_table_t<int32_t, false>;
+template class relabel_table_t<int64_t, false>;
+
 }  // namespace cugraph
@@ -23,6 +23,8 @@
 #include <cugraph/utilities/host_scalar_comm.cuh>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
+#include <structure/renumbered_edgelist_utils.cuh>
+
 #include <cuco/static_map.cuh>
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
@@ -32,11 +34,14 @@
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/sort.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <tuple>
 #include <utility>
@@ -51,11 +56,35 @@ compute_renumber_map(raft::handle_t const& handle,
                      std::optional<rmm::device_uvector<vertex_t>>&& local_vertices,
                      std::vector<vertex_t const*> const& edgelist_majors,
                      std::vector<vertex_t const*> const& edgelist_minors,
-                     std::vector<edge_t> const& edgelist_edge_counts)
+                     std::vector<edge_t> const& edgelist_edge_counts,
+                     renumber_order_t order,
+                     std::optional<vertex_t const*> local_vertex_order_keys)
 {
   // FIXME: compare this sort based approach with hash based approach in both speed and memory
   // footprint
 
+  // 0. keep the (vertex, order key) pairs sorted by vertex (local_vertices is released in step 4)
+
+  std::optional<rmm::device_uvector<vertex_t>> sorted_key_vertices{std::nullopt};
+  std::optional<rmm::device_uvector<vertex_t>> vertex_keys{std::nullopt};
+  if (local_vertex_order_keys) {
+    sorted_key_vertices =
+      rmm::device_uvector<vertex_t>((*local_vertices).size(), handle.get_stream());
+    vertex_keys = rmm::device_uvector<vertex_t>((*sorted_key_vertices).size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 (*local_vertices).begin(),
+                 (*local_vertices).end(),
+                 (*sorted_key_vertices).begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 *local_vertex_order_keys,
+                 *local_vertex_order_keys + (*vertex_keys).size(),
+                 (*vertex_keys).begin());
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        (*sorted_key_vertices).begin(),
+                        (*sorted_key_vertices).end(),
+                        (*vertex_keys).begin());
+  }
+
   // 1. acquire (unique major label, count) pairs
 
   rmm::device_uvector<vertex_t> major_labels(0, handle.get_stream());
@@ -288,57 +317,51 @@ compute_renumber_map(raft::handle_t const& handle,
 
   // 6. compute segment_offsets
 
-  static_assert(detail::num_sparse_segments_per_vertex_partition == 3);
-  static_assert((detail::low_degree_threshold <= detail::mid_degree_threshold) &&
-                (detail::mid_degree_threshold <= std::numeric_limits<edge_t>::max()));
-  size_t mid_degree_threshold{detail::mid_degree_threshold};
-  size_t low_degree_threshold{detail::low_degree_threshold};
-  size_t hypersparse_degree_threshold{0};
-  if (multi_gpu) {
-    auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
-    auto const col_comm_size = col_comm.get_size();
-    mid_degree_threshold *= col_comm_size;
-    low_degree_threshold *= col_comm_size;
-    hypersparse_degree_threshold =
-      static_cast<size_t>(col_comm_size * detail::hypersparse_threshold_ratio);
+  auto h_segment_offsets =
+    detail::compute_degree_segment_offsets<vertex_t, edge_t, multi_gpu>(
+      handle, counts.data(), counts.size(), static_cast<vertex_t>(labels.size()));
+
+  // 7. re-order the vertices inside each segment (if requested); the segment boundaries do not
+  // change, so the segment offsets remain valid
+
+  if (order != renumber_order_t::degree) {
+    counts.resize(0, handle.get_stream());
+    counts.shrink_to_fit(handle.get_stream());
+
+    std::optional<rmm::device_uvector<vertex_t>> label_keys{std::nullopt};
+    if (vertex_keys) {
+      label_keys = rmm::device_uvector<vertex_t>(labels.size(), handle.get_stream());
+      thrust::transform(
+        handle.get_thrust_policy(),
+        labels.begin(),
+        labels.end(),
+        (*label_keys).begin(),
+        [vertex_first = (*sorted_key_vertices).begin(),
+         vertex_last  = (*sorted_key_vertices).end(),
+         key_first    = (*vertex_keys).begin()] __device__(auto v) {
+          auto it = thrust::lower_bound(thrust::seq, vertex_first, vertex_last, v);
+          return ((it != vertex_last) && (*it == v))
+                   ? *(key_first + thrust::distance(vertex_first, it))
+                   : std::numeric_limits<vertex_t>::max();
+        });
+      sorted_key_vertices = std::nullopt;
+      vertex_keys         = std::nullopt;
+    }
+
+    for (size_t i = 0; i < h_segment_offsets.size() - 1; ++i) {
+      if (label_keys) {
+        auto pair_first =
+          thrust::make_zip_iterator(thrust::make_tuple((*label_keys).begin(), labels.begin()));
+        thrust::sort(handle.get_thrust_policy(),
+                     pair_first + h_segment_offsets[i],
+                     pair_first + h_segment_offsets[i + 1]);
+      } else {
+        thrust::sort(handle.get_thrust_policy(),
+                     labels.begin() + h_segment_offsets[i],
+                     labels.begin() + h_segment_offsets[i + 1]);
+      }
+    }
   }
-  auto num_segments_per_vertex_partition =
-    detail::num_sparse_segments_per_vertex_partition +
-    (hypersparse_degree_threshold > 0 ? size_t{1} : size_t{0});
-  rmm::device_uvector<edge_t> d_thresholds(num_segments_per_vertex_partition - 1,
-                                           handle.get_stream());
-  auto h_thresholds = hypersparse_degree_threshold > 0
-                        ? std::vector<edge_t>{static_cast<edge_t>(mid_degree_threshold),
-                                              static_cast<edge_t>(low_degree_threshold),
-                                              static_cast<edge_t>(hypersparse_degree_threshold)}
-                        : std::vector<edge_t>{static_cast<edge_t>(mid_degree_threshold),
-                                              static_cast<edge_t>(low_degree_threshold)};
-  raft::update_device(
-    d_thresholds.data(), h_thresholds.data(), h_thresholds.size(), handle.get_stream());
-
-  rmm::device_uvector<vertex_t> d_segment_offsets(num_segments_per_vertex_partition + 1,
-                                                  handle.get_stream());
-
-  auto zero_vertex  = vertex_t{0};
-  auto vertex_count = static_cast<vertex_t>(labels.size());
-  d_segment_offsets.set_element_async(0, zero_vertex, handle.get_stream());
-  d_segment_offsets.set_element_async(
-    num_segments_per_vertex_partition, vertex_count, handle.get_stream());
-
-  thrust::upper_bound(handle.get_thrust_policy(),
-                      counts.begin(),
-                      counts.end(),
-                      d_thresholds.begin(),
-                      d_thresholds.end(),
-                      d_segment_offsets.begin() + 1,
-                      thrust::greater<edge_t>{});
-
-  std::vector<vertex_t> h_segment_offsets(d_segment_offsets.size());
-  raft::update_host(h_segment_offsets.data(),
-                    d_segment_offsets.data(),
-                    d_segment_offsets.size(),
-                    handle.get_stream());
-  handle.get_stream_view().synchronize();
 
   return std::make_tuple(std::move(labels),
                          h_segment_offsets,
@@ -554,6 +577,8 @@ renumber_edgelist(
   std::vector<vertex_t*> const& edgelist_minors /* [INOUT] */,
   std::vector<edge_t> const& edgelist_edge_counts,
   std::optional<std::vector<std::vector<edge_t>>> const& edgelist_intra_partition_segment_offsets,
+  renumber_order_t order,
+  std::optional<vertex_t const*> local_vertex_order_keys,
   bool do_expensive_check)
 {
   auto& comm               = handle.get_comms();
@@ -593,6 +618,12 @@ renumber_edgelist(
         "edgelist_edge_counts[].");
     }
   }
+  CUGRAPH_EXPECTS((order == renumber_order_t::vertex_key) == local_vertex_order_keys.has_value(),
+                  "Invalid input arguments: local_vertex_order_keys should be valid if and only if "
+                  "order is renumber_order_t::vertex_key.");
+  CUGRAPH_EXPECTS(!local_vertex_order_keys || local_vertices,
+                  "Invalid input arguments: local_vertices should be valid if "
+                  "local_vertex_order_keys is valid.");
 
   std::vector<vertex_t const*> edgelist_const_majors(edgelist_majors.size());
   std::vector<vertex_t const*> edgelist_const_minors(edgelist_const_majors.size());
@@ -621,7 +652,9 @@ renumber_edgelist(
                                                               std::move(local_vertices),
                                                               edgelist_const_majors,
                                                               edgelist_const_minors,
-                                                              edgelist_edge_counts);
+                                                              edgelist_edge_counts,
+                                                              order,
+                                                              local_vertex_order_keys);
 
   // 2. initialize partition_t object, number_of_vertices, and number_of_edges for the coarsened
   // graph
@@ -793,8 +826,17 @@ renumber_edgelist(raft::handle_t const& handle,
                   vertex_t* edgelist_majors /* [INOUT] */,
                   vertex_t* edgelist_minors /* [INOUT] */,
                   edge_t num_edgelist_edges,
+                  renumber_order_t order,
+                  std::optional<vertex_t const*> vertex_order_keys,
                   bool do_expensive_check)
 {
+  CUGRAPH_EXPECTS((order == renumber_order_t::vertex_key) == vertex_order_keys.has_value(),
+                  "Invalid input arguments: vertex_order_keys should be valid if and only if order "
+                  "is renumber_order_t::vertex_key.");
+  CUGRAPH_EXPECTS(!vertex_order_keys || vertices,
+                  "Invalid input arguments: vertices should be valid if vertex_order_keys is "
+                  "valid.");
+
   if (do_expensive_check) {
     detail::expensive_check_edgelist<vertex_t, edge_t, multi_gpu>(
       handle,
@@ -813,7 +855,9 @@ renumber_edgelist(raft::handle_t const& handle,
       std::move(vertices),
       std::vector<vertex_t const*>{edgelist_majors},
       std::vector<vertex_t const*>{edgelist_minors},
-      std::vector<edge_t>{num_edgelist_edges});
+      std::vector<edge_t>{num_edgelist_edges},
+      order,
+      vertex_order_keys);
 
   double constexpr load_factor = 0.7;
 
@@ -27,6 +27,8 @@ renumber_edgelist<int32_t, int32_t, true>(
   std::vector<int32_t*> const& edgelist_minors /* [INOUT] */,
   std::vector<int32_t> const& edgelist_edge_counts,
   std::optional<std::vector<std::vector<int32_t>>> const& edgelist_intra_partition_segment_offsets,
+  renumber_order_t order,
+  std::optional<int32_t const*> local_vertex_order_keys,
   bool do_expensive_check);
 
 template std::tuple<rmm::device_uvector<int32_t>, renumber_meta_t<int32_t, int64_t, true>>
@@ -37,6 +39,8 @@ renumber_edgelist<int32_t, int64_t, true>(
   std::vector<int32_t*> const& edgelist_minors /* [INOUT] */,
   std::vector<int64_t> const& edgelist_edge_counts,
   std::optional<std::vector<std::vector<int64_t>>> const& edgelist_intra_partition_segment_offsets,
+  renumber_order_t order,
+  std::optional<int32_t const*> local_vertex_order_keys,
   bool do_expensive_check);
 
 template std::tuple<rmm::device_uvector<int64_t>, renumber_meta_t<int64_t, int64_t, true>>
@@ -47,6 +51,8 @@ renumber_edgelist<int64_t, int64_t, true>(
   std::vector<int64_t*> const& edgelist_minors /* [INOUT] */,
   std::vector<int64_t> const& edgelist_edge_counts,
   std::optional<std::vector<std::vector<int64_t>>> const& edgelist_intra_partition_segment_offsets,
+  renumber_order_t order,
+  std::optional<int64_t const*> local_vertex_order_keys,
   bool do_expensive_check);
 
 }  // namespace cugraph
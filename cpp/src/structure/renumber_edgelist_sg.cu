@@ -25,6 +25,8 @@ renumber_edgelist<int32_t, int32_t, false>(raft::handle_t const& handle,
                                            int32_t* edgelist_majors /* [INOUT] */,
                                            int32_t* edgelist_minors /* [INOUT] */,
                                            int32_t num_edgelist_edges,
+                                           renumber_order_t order,
+                                           std::optional<int32_t const*> vertex_order_keys,
                                            bool do_expensive_check);
 
 template std::tuple<rmm::device_uvector<int32_t>, renumber_meta_t<int32_t, int64_t, false>>
@@ -33,6 +35,8 @@ renumber_edgelist<int32_t, int64_t, false>(raft::handle_t const& handle,
                                            int32_t* edgelist_majors /* [INOUT] */,
                                            int32_t* edgelist_minors /* [INOUT] */,
                                            int64_t num_edgelist_edges,
+                                           renumber_order_t order,
+                                           std::optional<int32_t const*> vertex_order_keys,
                                            bool do_expensive_check);
 
 template std::tuple<rmm::device_uvector<int64_t>, renumber_meta_t<int64_t, int64_t, false>>
@@ -41,6 +45,8 @@ renumber_edgelist<int64_t, int64_t, false>(raft::handle_t const& handle,
                                            int64_t* edgelist_majors /* [INOUT] */,
                                            int64_t* edgelist_minors /* [INOUT] */,
                                            int64_t num_edgelist_edges,
+                                           renumber_order_t order,
+                                           std::optional<int64_t const*> vertex_order_keys,
                                            bool do_expensive_check);
 
 }  // namespace cugraph
@@ -18,6 +18,7 @@
 #include <cugraph/detail/graph_utils.cuh>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
+#include <cugraph/renumber_index.hpp>
 #include <cugraph/utilities/collect_comm.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.cuh>
@@ -32,6 +33,7 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
@@ -652,4 +654,189 @@ std::enable_if_t<!multi_gpu, void> unrenumber_local_int_edges(raft::handle_t con
                                 do_expensive_check);
 }
 
+template <typename vertex_t, bool multi_gpu>
+renumber_index_t<vertex_t, multi_gpu>::renumber_index_t(
+  raft::handle_t const& handle,
+  vertex_t const* renumber_map_labels,
+  std::vector<vertex_t> const& vertex_partition_lasts,
+  bool do_expensive_check)
+  : vertex_partition_lasts_(vertex_partition_lasts),
+    d_vertex_partition_lasts_(vertex_partition_lasts.size(), handle.get_stream_view()),
+    labels_(0, handle.get_stream_view()),
+    sorted_ext_vertices_(0, handle.get_stream_view()),
+    int_vertices_(0, handle.get_stream_view())
+{
+  auto const comm_size = multi_gpu ? handle.get_comms().get_size() : int{1};
+  auto const comm_rank = multi_gpu ? handle.get_comms().get_rank() : int{0};
+
+  CUGRAPH_EXPECTS(vertex_partition_lasts_.size() == static_cast<size_t>(comm_size),
+                  "Invalid input argument: vertex_partition_lasts.size() does not match with the "
+                  "number of GPUs.");
+
+  local_vertex_first_ = comm_rank == 0 ? vertex_t{0} : vertex_partition_lasts_[comm_rank - 1];
+  auto num_local_vertices =
+    static_cast<size_t>(vertex_partition_lasts_[comm_rank] - local_vertex_first_);
+
+  raft::update_device(d_vertex_partition_lasts_.data(),
+                      vertex_partition_lasts_.data(),
+                      vertex_partition_lasts_.size(),
+                      handle.get_stream());
+
+  labels_.resize(num_local_vertices, handle.get_stream_view());
+  thrust::copy(handle.get_thrust_policy(),
+               renumber_map_labels,
+               renumber_map_labels + num_local_vertices,
+               labels_.begin());
+
+  sorted_ext_vertices_.resize(num_local_vertices, handle.get_stream_view());
+  int_vertices_.resize(num_local_vertices, handle.get_stream_view());
+  thrust::copy(
+    handle.get_thrust_policy(), labels_.begin(), labels_.end(), sorted_ext_vertices_.begin());
+  thrust::sequence(
+    handle.get_thrust_policy(), int_vertices_.begin(), int_vertices_.end(), local_vertex_first_);
+
+  if (multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    // move the (external ID, internal ID) pairs to the GPUs the external IDs are hashed to (this
+    // is a no-op for the renumber maps generated by renumber_edgelist)
+
+    auto pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(sorted_ext_vertices_.begin(), int_vertices_.begin()));
+    std::forward_as_tuple(std::tie(sorted_ext_vertices_, int_vertices_), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        pair_first,
+        pair_first + sorted_ext_vertices_.size(),
+        [key_func = detail::compute_gpu_id_from_vertex_t<vertex_t>{comm_size}] __device__(
+          auto val) { return key_func(thrust::get<0>(val)); },
+        handle.get_stream_view());
+  }
+
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      sorted_ext_vertices_.begin(),
+                      sorted_ext_vertices_.end(),
+                      int_vertices_.begin());
+
+  if (do_expensive_check && (sorted_ext_vertices_.size() > 1)) {
+    CUGRAPH_EXPECTS(
+      thrust::count_if(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{1}),
+                       thrust::make_counting_iterator(sorted_ext_vertices_.size()),
+                       [sorted_ext_vertices = sorted_ext_vertices_.data()] __device__(auto i) {
+                         return sorted_ext_vertices[i - 1] == sorted_ext_vertices[i];
+                       }) == 0,
+      "Invalid input arguments: renumber_map_labels have duplicate elements.");
+  }
+}
+
+template <typename vertex_t, bool multi_gpu>
+void renumber_index_t<vertex_t, multi_gpu>::renumber(raft::handle_t const& handle,
+                                                     vertex_t* vertices /* [INOUT] */,
+                                                     size_t num_vertices,
+                                                     bool do_expensive_check) const
+{
+  if (multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    // the keys are grouped by the owning GPUs once and the values are returned in the same
+    // round trip
+    auto int_vertices = collect_values_for_keys(
+      comm,
+      sorted_ext_vertices_.begin(),
+      sorted_ext_vertices_.end(),
+      int_vertices_.begin(),
+      vertices,
+      vertices + num_vertices,
+      detail::compute_gpu_id_from_vertex_t<vertex_t>{comm.get_size()},
+      handle.get_stream_view(),
+      collect_values_policy_t::binary_search);
+
+    if (do_expensive_check) {
+      auto pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(vertices, int_vertices.begin()));
+      CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                       pair_first,
+                                       pair_first + num_vertices,
+                                       [] __device__(auto pair) {
+                                         return (thrust::get<0>(pair) !=
+                                                 invalid_vertex_id<vertex_t>::value) &&
+                                                (thrust::get<1>(pair) ==
+                                                 invalid_vertex_id<vertex_t>::value);
+                                       }) == 0,
+                      "Invalid input arguments: vertices have elements that are missing in "
+                      "(aggregate) renumber_map_labels.");
+    }
+
+    thrust::copy(handle.get_thrust_policy(), int_vertices.begin(), int_vertices.end(), vertices);
+  } else {
+    if (do_expensive_check) {
+      CUGRAPH_EXPECTS(
+        thrust::count_if(handle.get_thrust_policy(),
+                         vertices,
+                         vertices + num_vertices,
+                         [first = sorted_ext_vertices_.begin(),
+                          last  = sorted_ext_vertices_.end()] __device__(auto v) {
+                           return (v != invalid_vertex_id<vertex_t>::value) &&
+                                  !thrust::binary_search(thrust::seq, first, last, v);
+                         }) == 0,
+        "Invalid input arguments: vertices have elements that are missing in "
+        "renumber_map_labels.");
+    }
+
+    detail::find_values_with_binary_search(sorted_ext_vertices_.begin(),
+                                           sorted_ext_vertices_.end(),
+                                           int_vertices_.begin(),
+                                           vertices,
+                                           vertices + num_vertices,
+                                           vertices,
+                                           handle.get_stream_view());
+  }
+}
+
+template <typename vertex_t, bool multi_gpu>
+void renumber_index_t<vertex_t, multi_gpu>::unrenumber(raft::handle_t const& handle,
+                                                       vertex_t* vertices /* [INOUT] */,
+                                                       size_t num_vertices,
+                                                       bool do_expensive_check) const
+{
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(
+      thrust::count_if(handle.get_thrust_policy(),
+                       vertices,
+                       vertices + num_vertices,
+                       [int_vertex_last = vertex_partition_lasts_.back()] __device__(auto v) {
+                         return v != invalid_vertex_id<vertex_t>::value &&
+                                !is_valid_vertex(int_vertex_last, v);
+                       }) == 0,
+      "Invalid input arguments: there are out-of-range vertices in [vertices, vertices "
+      "+ num_vertices).");
+  }
+
+  if (multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    auto ext_vertices = collect_values_for_keys(
+      comm,
+      thrust::make_counting_iterator(local_vertex_first_),
+      thrust::make_counting_iterator(get_local_vertex_last()),
+      labels_.begin(),
+      vertices,
+      vertices + num_vertices,
+      detail::compute_gpu_id_from_int_vertex_t<vertex_t>{d_vertex_partition_lasts_.data(),
+                                                          comm.get_size()},
+      handle.get_stream_view(),
+      collect_values_policy_t::binary_search);
+    thrust::copy(handle.get_thrust_policy(), ext_vertices.begin(), ext_vertices.end(), vertices);
+  } else {
+    thrust::transform(handle.get_thrust_policy(),
+                      vertices,
+                      vertices + num_vertices,
+                      vertices,
+                      [labels = labels_.data()] __device__(auto v) {
+                        return v == invalid_vertex_id<vertex_t>::value ? v : labels[v];
+                      });
+  }
+}
+
 }  // namespace cugraph
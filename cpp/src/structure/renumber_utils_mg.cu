@@ -92,4 +92,7 @@ template void unrenumber_local_int_edges<int64_t, true, true>(
   std::optional<std::vector<std::vector<size_t>>> const& edgelist_intra_partition_segment_offsets,
   bool do_expensive_check);
 
+template class renumber_index_t<int32_t, true>;
+template class renumber_index_t<int64_t, true>;
+
 }  // namespace cugraph
@@ -102,4 +102,7 @@ template void unrenumber_local_int_edges<int64_t, true, false>(raft::handle_t co
                                                                int64_t num_vertices,
                                                                bool do_expensive_check);
 
+template class renumber_index_t<int32_t, false>;
+template class renumber_index_t<int64_t, false>;
+
 }  // namespace cugraph
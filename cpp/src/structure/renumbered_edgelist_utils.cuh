@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// a GPU with (row_comm_rank, col_comm_rank) stores the edges with majors in the vertex partitions
+// (row_comm_size * i + row_comm_rank) for i in [0, col_comm_size) and minors in the vertex
+// partitions [row_comm_size * col_comm_rank, row_comm_size * (col_comm_rank + 1)); this maps an
+// edge (major, minor[, weight]) with renumbered vertex IDs to the GPU owning the edge.
+template <typename vertex_t>
+struct renumbered_edge_to_gpu_id_t {
+  vertex_t const* vertex_partition_lasts{nullptr};
+  int comm_size{0};
+  int row_comm_size{0};
+
+  template <typename edge_tuple_t>
+  __device__ int operator()(edge_tuple_t e) const
+  {
+    auto major_partition_id = static_cast<int>(
+      thrust::distance(vertex_partition_lasts,
+                       thrust::upper_bound(thrust::seq,
+                                           vertex_partition_lasts,
+                                           vertex_partition_lasts + comm_size,
+                                           thrust::get<0>(e))));
+    auto minor_partition_id = static_cast<int>(
+      thrust::distance(vertex_partition_lasts,
+                       thrust::upper_bound(thrust::seq,
+                                           vertex_partition_lasts,
+                                           vertex_partition_lasts + comm_size,
+                                           thrust::get<1>(e))));
+    return (minor_partition_id / row_comm_size) * row_comm_size +
+           (major_partition_id % row_comm_size);
+  }
+};
+
+template <typename vertex_t>
+struct is_first_in_sorted_run_t {
+  vertex_t const* sorted_first{nullptr};
+
+  __device__ bool operator()(size_t i) const { return sorted_first[i] != sorted_first[i - 1]; }
+};
+
+template <typename vertex_t>
+vertex_t count_unique_sorted(raft::handle_t const& handle, vertex_t const* first, size_t size)
+{
+  return size > 0 ? static_cast<vertex_t>(thrust::count_if(
+                      handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{1}),
+                      thrust::make_counting_iterator(size),
+                      is_first_in_sorted_run_t<vertex_t>{first})) +
+                      vertex_t{1}
+                  : vertex_t{0};
+}
+
+// returns the degree segment offsets of a vertex partition with the vertices sorted by degree (in
+// the descending order), [sorted_degree_first, sorted_degree_first + num_sorted_degrees) stores the
+// degrees of the first num_sorted_degrees vertices (the remaining vertices up to num_vertices are
+// isolated)
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::vector<vertex_t> compute_degree_segment_offsets(raft::handle_t const& handle,
+                                                     edge_t const* sorted_degree_first,
+                                                     size_t num_sorted_degrees,
+                                                     vertex_t num_vertices)
+{
+  static_assert(num_sparse_segments_per_vertex_partition == 3);
+  static_assert((low_degree_threshold <= mid_degree_threshold) &&
+                (mid_degree_threshold <= std::numeric_limits<edge_t>::max()));
+  size_t mid_threshold{mid_degree_threshold};
+  size_t low_threshold{low_degree_threshold};
+  size_t hypersparse_threshold{0};
+  if (multi_gpu) {
+    auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    auto const col_comm_size = col_comm.get_size();
+    mid_threshold *= col_comm_size;
+    low_threshold *= col_comm_size;
+    hypersparse_threshold = static_cast<size_t>(col_comm_size * hypersparse_threshold_ratio);
+  }
+  auto num_segments_per_vertex_partition =
+    num_sparse_segments_per_vertex_partition + (hypersparse_threshold > 0 ? size_t{1} : size_t{0});
+  rmm::device_uvector<edge_t> d_thresholds(num_segments_per_vertex_partition - 1,
+                                           handle.get_stream());
+  auto h_thresholds = hypersparse_threshold > 0
+                        ? std::vector<edge_t>{static_cast<edge_t>(mid_threshold),
+                                              static_cast<edge_t>(low_threshold),
+                                              static_cast<edge_t>(hypersparse_threshold)}
+                        : std::vector<edge_t>{static_cast<edge_t>(mid_threshold),
+                                              static_cast<edge_t>(low_threshold)};
+  raft::update_device(
+    d_thresholds.data(), h_thresholds.data(), h_thresholds.size(), handle.get_stream());
+
+  rmm::device_uvector<vertex_t> d_segment_offsets(num_segments_per_vertex_partition + 1,
+                                                  handle.get_stream());
+
+  auto zero_vertex = vertex_t{0};
+  d_segment_offsets.set_element_async(0, zero_vertex, handle.get_stream());
+  d_segment_offsets.set_element_async(
+    num_segments_per_vertex_partition, num_vertices, handle.get_stream());
+
+  thrust::upper_bound(handle.get_thrust_policy(),
+                      sorted_degree_first,
+                      sorted_degree_first + num_sorted_degrees,
+                      d_thresholds.begin(),
+                      d_thresholds.end(),
+                      d_segment_offsets.begin() + 1,
+                      thrust::greater<edge_t>{});
+
+  std::vector<vertex_t> h_segment_offsets(d_segment_offsets.size());
+  raft::update_host(h_segment_offsets.data(),
+                    d_segment_offsets.data(),
+                    d_segment_offsets.size(),
+                    handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  return h_segment_offsets;
+}
+
+// shuffle the edges (with renumbered vertex IDs) to their owning GPUs under the vertex partitioning
+// given by vertex_partition_lasts and create a multi-GPU graph from the shuffled edges; the input
+// edges can be on any GPU
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<multi_gpu, graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>
+create_graph_from_renumbered_edgelist(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t>&& edgelist_majors,
+  rmm::device_uvector<vertex_t>&& edgelist_minors,
+  std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+  std::vector<vertex_t> const& vertex_partition_lasts,
+  std::optional<std::vector<vertex_t>> const& segment_offsets,
+  vertex_t number_of_vertices,
+  edge_t number_of_edges,
+  graph_properties_t properties)
+{
+  auto& comm               = handle.get_comms();
+  auto const comm_size     = comm.get_size();
+  auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+  auto const row_comm_size = row_comm.get_size();
+  auto const row_comm_rank = row_comm.get_rank();
+  auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_size = col_comm.get_size();
+  auto const col_comm_rank = col_comm.get_rank();
+
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                         handle.get_stream());
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      vertex_partition_lasts.data(),
+                      vertex_partition_lasts.size(),
+                      handle.get_stream());
+  renumbered_edge_to_gpu_id_t<vertex_t> edge_to_gpu_id_op{
+    d_vertex_partition_lasts.data(), comm_size, row_comm_size};
+
+  // shuffle, then groupby the received edges by local adjacency matrix partition (major ranges of
+  // the local adjacency matrix partitions are non-overlapping and increasing)
+
+  auto pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(edgelist_majors.begin(), edgelist_minors.begin()));
+  if (edgelist_weights) {
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(
+      edgelist_majors.begin(), edgelist_minors.begin(), (*edgelist_weights).begin()));
+    std::forward_as_tuple(std::tie(edgelist_majors, edgelist_minors, *edgelist_weights),
+                          std::ignore) =
+      groupby_gpuid_and_shuffle_values(comm,
+                                       edge_first,
+                                       edge_first + edgelist_majors.size(),
+                                       edge_to_gpu_id_op,
+                                       handle.get_stream());
+    pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edgelist_majors.begin(), edgelist_minors.begin()));
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        pair_first,
+                        pair_first + edgelist_majors.size(),
+                        (*edgelist_weights).begin());
+  } else {
+    std::forward_as_tuple(std::tie(edgelist_majors, edgelist_minors), std::ignore) =
+      groupby_gpuid_and_shuffle_values(comm,
+                                       pair_first,
+                                       pair_first + edgelist_majors.size(),
+                                       edge_to_gpu_id_op,
+                                       handle.get_stream());
+    pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edgelist_majors.begin(), edgelist_minors.begin()));
+    thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + edgelist_majors.size());
+  }
+
+  std::vector<vertex_t> vertex_partition_offsets(vertex_partition_lasts.size() + 1, vertex_t{0});
+  std::copy(vertex_partition_lasts.begin(),
+            vertex_partition_lasts.end(),
+            vertex_partition_offsets.begin() + 1);
+  partition_t<vertex_t> partition(
+    vertex_partition_offsets, row_comm_size, col_comm_size, row_comm_rank, col_comm_rank);
+
+  std::vector<edgelist_t<vertex_t, edge_t, weight_t>> edgelists(col_comm_size);
+  for (int i = 0; i < col_comm_size; ++i) {
+    auto first = thrust::distance(
+      edgelist_majors.begin(),
+      thrust::lower_bound(handle.get_thrust_policy(),
+                          edgelist_majors.begin(),
+                          edgelist_majors.end(),
+                          partition.get_matrix_partition_major_first(i)));
+    auto last = thrust::distance(
+      edgelist_majors.begin(),
+      thrust::lower_bound(handle.get_thrust_policy(),
+                          edgelist_majors.begin(),
+                          edgelist_majors.end(),
+                          partition.get_matrix_partition_major_last(i)));
+    auto majors  = edgelist_majors.data() + first;
+    auto minors  = edgelist_minors.data() + first;
+    auto weights = edgelist_weights
+                     ? std::optional<weight_t const*>{(*edgelist_weights).data() + first}
+                     : std::nullopt;
+    edgelists[i] = edgelist_t<vertex_t, edge_t, weight_t>{store_transposed ? minors : majors,
+                                                          store_transposed ? majors : minors,
+                                                          weights,
+                                                          static_cast<edge_t>(last - first)};
+  }
+
+  auto num_local_unique_edge_majors =
+    count_unique_sorted(handle, edgelist_majors.data(), edgelist_majors.size());
+  vertex_t num_local_unique_edge_minors{0};
+  {
+    rmm::device_uvector<vertex_t> minors(edgelist_minors.size(), handle.get_stream());
+    thrust::copy(
+      handle.get_thrust_policy(), edgelist_minors.begin(), edgelist_minors.end(), minors.begin());
+    thrust::sort(handle.get_thrust_policy(), minors.begin(), minors.end());
+    num_local_unique_edge_minors = count_unique_sorted(handle, minors.data(), minors.size());
+  }
+
+  return graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    handle,
+    edgelists,
+    graph_meta_t<vertex_t, edge_t, multi_gpu>{
+      number_of_vertices,
+      number_of_edges,
+      properties,
+      partition,
+      segment_offsets,
+      store_transposed ? num_local_unique_edge_minors : num_local_unique_edge_majors,
+      store_transposed ? num_local_unique_edge_majors : num_local_unique_edge_minors});
+}
+
+}  // namespace detail
+}  // namespace cugraph
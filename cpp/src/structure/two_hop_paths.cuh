@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/utilities/collect_comm.cuh>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct copy_query_nbrs_t {
+  vertex_t const* query_vertices{nullptr};
+  edge_t const* query_nbr_offsets{nullptr};
+  vertex_t* query_nbrs{nullptr};
+  weight_t* query_nbr_weights{nullptr};  // nullptr if unweighted
+  vertex_t const* minors{nullptr};
+  weight_t const* weights{nullptr};  // nullptr if unweighted
+  edge_t const* offsets{nullptr};
+  vertex_t local_vertex_first{0};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto offset = query_vertices[i] - local_vertex_first;
+    thrust::copy(thrust::seq,
+                 minors + offsets[offset],
+                 minors + offsets[offset + 1],
+                 query_nbrs + query_nbr_offsets[i]);
+    if (weights != nullptr) {
+      thrust::copy(thrust::seq,
+                   weights + offsets[offset],
+                   weights + offsets[offset + 1],
+                   query_nbr_weights + query_nbr_offsets[i]);
+    }
+  }
+};
+
+// every neighbor w (the j'th first hop entry) of a query vertex q emits the 2-hop paths q-w-c for
+// the neighbors c of w (c == q included, these are removed afterwards) with the path weights
+// w(q, w) * w(w, c) (if weighted)
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct emit_two_hop_paths_t {
+  edge_t const* query_nbr_offsets{nullptr};  // for the queries in the batch
+  size_t num_queries{0};
+  size_t query_first{0};
+  vertex_t const* query_nbrs{nullptr};         // for the first hop entries in the batch
+  weight_t const* query_nbr_weights{nullptr};  // for the first hop entries in the batch
+  size_t const* path_offsets{nullptr};         // for the first hop entries in the batch
+  vertex_t const* nbr_vertices{nullptr};       // sorted unique query_nbrs (nullptr in single-GPU)
+  size_t num_nbr_vertices{0};
+  edge_t const* nbr_offsets{nullptr};
+  vertex_t const* nbr_indices{nullptr};
+  weight_t const* nbr_weights{nullptr};  // nullptr if unweighted
+  size_t* path_query_indices{nullptr};
+  vertex_t* path_candidates{nullptr};
+  weight_t* path_weights{nullptr};  // nullptr if unweighted
+
+  __device__ void operator()(size_t j) const
+  {
+    auto query_idx = static_cast<size_t>(thrust::distance(
+                       query_nbr_offsets + 1,
+                       thrust::upper_bound(thrust::seq,
+                                           query_nbr_offsets + 1,
+                                           query_nbr_offsets + num_queries + 1,
+                                           static_cast<edge_t>(j + query_nbr_offsets[0])))) +
+                     query_first;
+    auto w   = query_nbrs[j];
+    auto idx = nbr_vertices != nullptr
+                 ? static_cast<size_t>(thrust::distance(
+                     nbr_vertices,
+                     thrust::lower_bound(
+                       thrust::seq, nbr_vertices, nbr_vertices + num_nbr_vertices, w)))
+                 : static_cast<size_t>(w);
+    auto first = nbr_indices + nbr_offsets[idx];
+    auto last  = nbr_indices + nbr_offsets[idx + 1];
+    thrust::fill(thrust::seq,
+                 path_query_indices + path_offsets[j],
+                 path_query_indices + path_offsets[j] + thrust::distance(first, last),
+                 query_idx);
+    thrust::copy(thrust::seq, first, last, path_candidates + path_offsets[j]);
+    if (path_weights != nullptr) {
+      auto w_weight         = query_nbr_weights[j];
+      auto nbr_weight_first = nbr_weights + nbr_offsets[idx];
+      for (edge_t k = 0; k < static_cast<edge_t>(thrust::distance(first, last)); ++k) {
+        path_weights[path_offsets[j] + k] = w_weight * nbr_weight_first[k];
+      }
+    }
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_query_vertex_t {
+  vertex_t const* query_vertices{nullptr};
+
+  template <typename path_tuple_t>
+  __device__ bool operator()(path_tuple_t path) const
+  {
+    return query_vertices[thrust::get<0>(path)] == thrust::get<1>(path);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename edge_t>
+struct degree_to_size_t {
+  __device__ size_t operator()(edge_t degree) const { return static_cast<size_t>(degree); }
+};
+
+// same as for_each_two_hop_path_batch below, but also computes the path weights w(q, w) * w(w, c)
+// if the local edge weights (aligned with minors, as returned by
+// extract_local_major_weighted_edgelist) are provided; batch_op is invoked with the (global) query
+// vertex indices, the candidates, and the path weights (std::nullopt if unweighted) of the paths
+// in the batch.
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu, typename BatchOp>
+void for_each_weighted_two_hop_path_batch(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t> const& minors,
+  std::optional<rmm::device_uvector<weight_t>> const& weights,
+  rmm::device_uvector<edge_t> const& offsets,
+  vertex_t local_vertex_first,
+  std::vector<vertex_t> const& vertex_partition_lasts,
+  vertex_t const* query_vertices,
+  size_t num_query_vertices,
+  size_t max_num_paths_per_batch,
+  BatchOp batch_op)
+{
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                         handle.get_stream());
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      vertex_partition_lasts.data(),
+                      vertex_partition_lasts.size(),
+                      handle.get_stream());
+
+  rmm::device_uvector<edge_t> degrees(offsets.size() - 1, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    offsets.begin() + 1,
+                    offsets.end(),
+                    offsets.begin(),
+                    degrees.begin(),
+                    thrust::minus<edge_t>());
+
+  // 1. find the first hops (neighbors of the query vertices) and the number of the 2-hop paths
+  // starting from every first hop entry
+
+  rmm::device_uvector<edge_t> query_nbr_offsets(num_query_vertices + 1, handle.get_stream());
+  query_nbr_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::transform_inclusive_scan(
+    handle.get_thrust_policy(),
+    query_vertices,
+    query_vertices + num_query_vertices,
+    query_nbr_offsets.begin() + 1,
+    [degrees = degrees.data(), local_vertex_first] __device__(auto v) {
+      return degrees[v - local_vertex_first];
+    },
+    thrust::plus<edge_t>());
+  rmm::device_uvector<vertex_t> query_nbrs(query_nbr_offsets.back_element(handle.get_stream()),
+                                           handle.get_stream());
+  auto query_nbr_weights =
+    weights ? std::make_optional<rmm::device_uvector<weight_t>>(query_nbrs.size(),
+                                                                handle.get_stream())
+            : std::nullopt;
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_query_vertices),
+    copy_query_nbrs_t<vertex_t, edge_t, weight_t>{
+      query_vertices,
+      query_nbr_offsets.data(),
+      query_nbrs.data(),
+      query_nbr_weights ? (*query_nbr_weights).data() : static_cast<weight_t*>(nullptr),
+      minors.data(),
+      weights ? (*weights).data() : static_cast<weight_t const*>(nullptr),
+      offsets.data(),
+      local_vertex_first});
+
+  rmm::device_uvector<edge_t> query_nbr_degrees(query_nbrs.size(), handle.get_stream());
+  if constexpr (multi_gpu) {
+    query_nbr_degrees = collect_values_for_vertices(handle.get_comms(),
+                                                    query_nbrs.begin(),
+                                                    query_nbrs.end(),
+                                                    degrees.begin(),
+                                                    vertex_partition_lasts,
+                                                    handle.get_stream());
+  } else {
+    thrust::gather(handle.get_thrust_policy(),
+                   query_nbrs.begin(),
+                   query_nbrs.end(),
+                   degrees.begin(),
+                   query_nbr_degrees.begin());
+  }
+  degrees.resize(0, handle.get_stream());
+  degrees.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<size_t> path_offsets(query_nbrs.size() + 1, handle.get_stream());
+  path_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::transform_inclusive_scan(handle.get_thrust_policy(),
+                                   query_nbr_degrees.begin(),
+                                   query_nbr_degrees.end(),
+                                   path_offsets.begin() + 1,
+                                   degree_to_size_t<edge_t>{},
+                                   thrust::plus<size_t>());
+  query_nbr_degrees.resize(0, handle.get_stream());
+  query_nbr_degrees.shrink_to_fit(handle.get_stream());
+
+  // 2. split the query vertices into batches with bounded numbers of 2-hop paths
+
+  std::vector<edge_t> h_query_nbr_offsets(query_nbr_offsets.size());
+  raft::update_host(h_query_nbr_offsets.data(),
+                    query_nbr_offsets.data(),
+                    query_nbr_offsets.size(),
+                    handle.get_stream());
+  rmm::device_uvector<size_t> d_query_path_offsets(query_nbr_offsets.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 query_nbr_offsets.begin(),
+                 query_nbr_offsets.end(),
+                 path_offsets.begin(),
+                 d_query_path_offsets.begin());
+  std::vector<size_t> h_query_path_offsets(d_query_path_offsets.size());
+  raft::update_host(h_query_path_offsets.data(),
+                    d_query_path_offsets.data(),
+                    d_query_path_offsets.size(),
+                    handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  std::vector<size_t> h_batch_offsets{0};
+  while (h_batch_offsets.back() < num_query_vertices) {
+    auto first = h_batch_offsets.back();
+    auto last  = static_cast<size_t>(std::distance(
+                  h_query_path_offsets.begin(),
+                  std::upper_bound(h_query_path_offsets.begin() + first + 1,
+                                   h_query_path_offsets.end(),
+                                   h_query_path_offsets[first] + max_num_paths_per_batch))) -
+                1;
+    h_batch_offsets.push_back(std::max(last, first + 1));
+  }
+  auto num_batches = h_batch_offsets.size() - 1;
+  if constexpr (multi_gpu) {
+    num_batches = host_scalar_allreduce(
+      handle.get_comms(), num_batches, raft::comms::op_t::MAX, handle.get_stream());
+  }
+  h_batch_offsets.resize(num_batches + 1, h_batch_offsets.back());
+
+  // 3. enumerate the 2-hop paths of every batch
+
+  for (size_t b = 0; b < num_batches; ++b) {
+    auto query_first = h_batch_offsets[b];
+    auto query_last  = h_batch_offsets[b + 1];
+    auto entry_first = static_cast<size_t>(h_query_nbr_offsets[query_first]);
+    auto entry_last  = static_cast<size_t>(h_query_nbr_offsets[query_last]);
+
+    // 3-1. collect the neighbor lists of the first hops
+
+    emit_two_hop_paths_t<vertex_t, edge_t, weight_t> emit_op{};
+    emit_op.query_nbr_offsets = query_nbr_offsets.data() + query_first;
+    emit_op.num_queries       = query_last - query_first;
+    emit_op.query_first       = query_first;
+    emit_op.query_nbrs        = query_nbrs.data() + entry_first;
+    if (query_nbr_weights) {
+      emit_op.query_nbr_weights = (*query_nbr_weights).data() + entry_first;
+    }
+
+    rmm::device_uvector<vertex_t> unique_nbrs(0, handle.get_stream());
+    rmm::device_uvector<edge_t> nbr_offsets(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> nbr_indices(0, handle.get_stream());
+    rmm::device_uvector<weight_t> nbr_weights(0, handle.get_stream());
+    if constexpr (multi_gpu) {
+      unique_nbrs.resize(entry_last - entry_first, handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   query_nbrs.begin() + entry_first,
+                   query_nbrs.begin() + entry_last,
+                   unique_nbrs.begin());
+      thrust::sort(handle.get_thrust_policy(), unique_nbrs.begin(), unique_nbrs.end());
+      unique_nbrs.resize(
+        thrust::distance(
+          unique_nbrs.begin(),
+          thrust::unique(handle.get_thrust_policy(), unique_nbrs.begin(), unique_nbrs.end())),
+        handle.get_stream());
+
+      std::optional<rmm::device_uvector<edge_t>> nbr_edge_indices{std::nullopt};
+      std::tie(nbr_offsets, nbr_indices, nbr_edge_indices) =
+        fetch_nbr_lists(handle,
+                        unique_nbrs.data(),
+                        unique_nbrs.size(),
+                        minors,
+                        offsets,
+                        local_vertex_first,
+                        d_vertex_partition_lasts,
+                        weights.has_value());
+      if (weights) {
+        nbr_weights = fetch_nbr_list_weights(handle,
+                                             unique_nbrs.data(),
+                                             unique_nbrs.size(),
+                                             nbr_offsets,
+                                             *nbr_edge_indices,
+                                             *weights,
+                                             d_vertex_partition_lasts);
+      }
+
+      emit_op.nbr_vertices     = unique_nbrs.data();
+      emit_op.num_nbr_vertices = unique_nbrs.size();
+      emit_op.nbr_offsets      = nbr_offsets.data();
+      emit_op.nbr_indices      = nbr_indices.data();
+      if (weights) { emit_op.nbr_weights = nbr_weights.data(); }
+    } else {
+      emit_op.nbr_offsets = offsets.data();
+      emit_op.nbr_indices = minors.data();
+      if (weights) { emit_op.nbr_weights = (*weights).data(); }
+    }
+
+    // 3-2. enumerate the 2-hop paths
+
+    auto num_paths = h_query_path_offsets[query_last] - h_query_path_offsets[query_first];
+    rmm::device_uvector<size_t> path_query_indices(num_paths, handle.get_stream());
+    rmm::device_uvector<vertex_t> path_candidates(num_paths, handle.get_stream());
+    auto path_weights =
+      weights ? std::make_optional<rmm::device_uvector<weight_t>>(num_paths, handle.get_stream())
+              : std::nullopt;
+    rmm::device_uvector<size_t> batch_path_offsets(entry_last - entry_first, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      path_offsets.begin() + entry_first,
+                      path_offsets.begin() + entry_last,
+                      batch_path_offsets.begin(),
+                      [base = h_query_path_offsets[query_first]] __device__(auto offset) {
+                        return offset - base;
+                      });
+    emit_op.path_offsets       = batch_path_offsets.data();
+    emit_op.path_query_indices = path_query_indices.data();
+    emit_op.path_candidates    = path_candidates.data();
+    if (path_weights) { emit_op.path_weights = (*path_weights).data(); }
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(entry_last - entry_first),
+                     emit_op);
+    batch_path_offsets.resize(0, handle.get_stream());
+    batch_path_offsets.shrink_to_fit(handle.get_stream());
+    unique_nbrs.resize(0, handle.get_stream());
+    unique_nbrs.shrink_to_fit(handle.get_stream());
+    nbr_offsets.resize(0, handle.get_stream());
+    nbr_offsets.shrink_to_fit(handle.get_stream());
+    nbr_indices.resize(0, handle.get_stream());
+    nbr_indices.shrink_to_fit(handle.get_stream());
+    nbr_weights.resize(0, handle.get_stream());
+    nbr_weights.shrink_to_fit(handle.get_stream());
+
+    if (path_weights) {
+      auto path_first = thrust::make_zip_iterator(thrust::make_tuple(
+        path_query_indices.begin(), path_candidates.begin(), (*path_weights).begin()));
+      num_paths = static_cast<size_t>(
+        thrust::distance(path_first,
+                         thrust::remove_if(handle.get_thrust_policy(),
+                                           path_first,
+                                           path_first + num_paths,
+                                           is_query_vertex_t<vertex_t>{query_vertices})));
+      (*path_weights).resize(num_paths, handle.get_stream());
+    } else {
+      auto path_first = thrust::make_zip_iterator(
+        thrust::make_tuple(path_query_indices.begin(), path_candidates.begin()));
+      num_paths = static_cast<size_t>(
+        thrust::distance(path_first,
+                         thrust::remove_if(handle.get_thrust_policy(),
+                                           path_first,
+                                           path_first + num_paths,
+                                           is_query_vertex_t<vertex_t>{query_vertices})));
+    }
+    path_query_indices.resize(num_paths, handle.get_stream());
+    path_candidates.resize(num_paths, handle.get_stream());
+
+    batch_op(path_query_indices, path_candidates, path_weights);
+  }
+}
+
+// enumerates the 2-hop paths q-w-c (c != q) from the (local) query vertices q over the local CSR
+// (minors & offsets as returned by extract_local_major_edgelist & compute_sorted_edge_offsets) in
+// batches of consecutive query vertices; a batch holds at most max_num_paths_per_batch paths unless
+// a single query vertex has more. batch_op is invoked with the (global) query vertex indices &
+// the candidates c of the paths in the batch (in no particular order, a (q, c) pair appears once
+// per common neighbor w). In multi-GPU, the neighbor lists of the remote first hops are fetched
+// from their owners once per batch, and every GPU invokes batch_op the same number of times
+// (possibly with empty batches).
+template <typename vertex_t, typename edge_t, bool multi_gpu, typename BatchOp>
+void for_each_two_hop_path_batch(raft::handle_t const& handle,
+                                 rmm::device_uvector<vertex_t> const& minors,
+                                 rmm::device_uvector<edge_t> const& offsets,
+                                 vertex_t local_vertex_first,
+                                 std::vector<vertex_t> const& vertex_partition_lasts,
+                                 vertex_t const* query_vertices,
+                                 size_t num_query_vertices,
+                                 size_t max_num_paths_per_batch,
+                                 BatchOp batch_op)
+{
+  for_each_weighted_two_hop_path_batch<vertex_t, edge_t, float, multi_gpu>(
+    handle,
+    minors,
+    std::optional<rmm::device_uvector<float>>{std::nullopt},
+    offsets,
+    local_vertex_first,
+    vertex_partition_lasts,
+    query_vertices,
+    num_query_vertices,
+    max_num_paths_per_batch,
+    [&batch_op](rmm::device_uvector<size_t>& path_query_indices,
+                rmm::device_uvector<vertex_t>& path_candidates,
+                std::optional<rmm::device_uvector<float>>&) {
+      batch_op(path_query_indices, path_candidates);
+    });
+}
+
+}  // namespace detail
+}  // namespace cugraph
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/tuple.h>
+
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// implements the bit-parallel multi-source BFS in
+// M. Then, M. Kaufmann, F. Chirigati, T. Hoang-Vu, K. Pham, A. Kemper, T. Neumann, and H. T. Vo,
+// "The more the merrier: efficient multi-source graph traversal," 2014.
+// bit i of a vertex's visit (seen) mask is set if the vertex is in the frontier of (is visited by)
+// the breadth-first search from the i'th source.
+template <typename GraphViewType>
+void bfs_batch(raft::handle_t const& handle,
+               GraphViewType const& push_graph_view,
+               typename GraphViewType::vertex_type* distances,
+               typename GraphViewType::vertex_type const* sources,
+               size_t n_sources,
+               typename GraphViewType::vertex_type depth_limit,
+               bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using mask_t   = uint64_t;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((n_sources == 0) || (sources != nullptr),
+                  "Invalid input argument: sources cannot be null");
+
+  size_t source_id_offset{0};  // the index of the first local source in the global source list
+  auto aggregate_n_sources = n_sources;
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto h_n_sources = host_scalar_allgather(handle.get_comms(), n_sources, handle.get_stream());
+    source_id_offset = std::reduce(
+      h_n_sources.begin(), h_n_sources.begin() + handle.get_comms().get_rank(), size_t{0});
+    aggregate_n_sources = std::reduce(h_n_sources.begin(), h_n_sources.end(), size_t{0});
+  }
+  CUGRAPH_EXPECTS(aggregate_n_sources > 0,
+                  "Invalid input argument: input should have at least one source");
+  CUGRAPH_EXPECTS(aggregate_n_sources <= static_cast<size_t>(std::numeric_limits<mask_t>::digits),
+                  "Invalid input argument: the number of sources should not exceed 64.");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      push_graph_view.get_vertex_partition_view());
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 push_graph_view,
+                 sources,
+                 sources + n_sources,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: sources have invalid vertex IDs.");
+  }
+
+  // 2. initialize distances and masks
+
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+
+  auto num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  thrust::fill(handle.get_thrust_policy(),
+               distances,
+               distances + static_cast<size_t>(num_local_vertices) * aggregate_n_sources,
+               invalid_distance);
+
+  rmm::device_uvector<mask_t> visit_masks(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<mask_t> seen_masks(num_local_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), visit_masks.begin(), visit_masks.end(), mask_t{0});
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(n_sources),
+    [vertex_partition,
+     sources,
+     distances,
+     visit_masks = visit_masks.data(),
+     num_local_vertices,
+     source_id_offset] __device__(auto i) {
+      auto v_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(sources[i]);
+      static_assert(sizeof(unsigned long long int) == sizeof(mask_t));
+      atomicOr(reinterpret_cast<unsigned long long int*>(visit_masks + v_offset),
+               static_cast<unsigned long long int>(mask_t{1} << (source_id_offset + i)));
+      *(distances + (source_id_offset + i) * static_cast<size_t>(num_local_vertices) + v_offset) =
+        vertex_t{0};
+    });
+  thrust::copy(
+    handle.get_thrust_policy(), visit_masks.begin(), visit_masks.end(), seen_masks.begin());
+
+  // 3. initialize BFS frontier
+
+  enum class Bucket { cur, next, num_buckets };
+  VertexFrontier<vertex_t,
+                 void,
+                 GraphViewType::is_multi_gpu,
+                 static_cast<size_t>(Bucket::num_buckets)>
+    vertex_frontier(handle);
+
+  {
+    rmm::device_uvector<vertex_t> frontier_vertices(num_local_vertices, handle.get_stream());
+    frontier_vertices.resize(
+      thrust::distance(
+        frontier_vertices.begin(),
+        thrust::copy_if(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+                        thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                        visit_masks.begin(),
+                        frontier_vertices.begin(),
+                        [] __device__(auto mask) { return mask != mask_t{0}; })),
+      handle.get_stream());
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+      .insert(frontier_vertices.begin(), frontier_vertices.end());
+  }
+
+  // 4. BFS iteration, one frontier expansion serves every source
+
+  auto adj_matrix_row_visit_masks =
+    GraphViewType::is_multi_gpu ? row_properties_t<GraphViewType, mask_t>(handle, push_graph_view)
+                                : row_properties_t<GraphViewType, mask_t>{};
+
+  vertex_t depth{0};
+  while (true) {
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(handle,
+                             push_graph_view,
+                             vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+                             vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+                             visit_masks.begin(),
+                             adj_matrix_row_visit_masks);
+    }
+
+    rmm::device_uvector<mask_t> next_visit_masks(num_local_vertices, handle.get_stream());
+    thrust::fill(
+      handle.get_thrust_policy(), next_visit_masks.begin(), next_visit_masks.end(), mask_t{0});
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      GraphViewType::is_multi_gpu
+        ? adj_matrix_row_visit_masks.device_view()
+        : detail::major_properties_device_view_t<vertex_t, mask_t const*>(visit_masks.data()),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      [vertex_partition, seen_masks = seen_masks.data()] __device__(
+        vertex_t src, vertex_t dst, auto src_mask, auto) {
+        auto mask = src_mask;
+        if (vertex_partition.is_local_vertex_nocheck(dst)) {
+          mask &=
+            ~(*(seen_masks + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(dst)));
+        }
+        return mask != mask_t{0} ? thrust::optional<mask_t>{mask} : thrust::nullopt;
+      },
+      reduce_op::bitwise_or<mask_t>(),
+      seen_masks.begin(),
+      thrust::make_zip_iterator(thrust::make_tuple(seen_masks.begin(), next_visit_masks.begin())),
+      [] __device__(auto v, auto seen_mask, auto pushed_mask) {
+        auto new_mask = pushed_mask & ~seen_mask;
+        return (new_mask != mask_t{0})
+                 ? thrust::optional<thrust::tuple<size_t, thrust::tuple<mask_t, mask_t>>>{
+                     thrust::make_tuple(static_cast<size_t>(Bucket::next),
+                                        thrust::make_tuple(seen_mask | new_mask, new_mask))}
+                 : thrust::nullopt;
+      });
+
+    visit_masks = std::move(next_visit_masks);
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+
+    auto& cur_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      cur_frontier_bucket.begin(),
+      cur_frontier_bucket.end(),
+      [vertex_partition,
+       distances,
+       visit_masks = visit_masks.data(),
+       num_local_vertices,
+       depth] __device__(auto v) {
+        auto v_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+        auto mask     = *(visit_masks + v_offset);
+        while (mask != mask_t{0}) {
+          auto i = static_cast<size_t>(__ffsll(static_cast<long long int>(mask)) - 1);
+          *(distances + i * static_cast<size_t>(num_local_vertices) + v_offset) = depth + 1;
+          mask &= mask - mask_t{1};
+        }
+      });
+
+    if (cur_frontier_bucket.aggregate_size() == 0) { break; }
+
+    depth++;
+    if (depth >= depth_limit) { break; }
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void bfs_batch(raft::handle_t const& handle,
+               graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+               vertex_t* distances,
+               vertex_t const* sources,
+               size_t n_sources,
+               vertex_t depth_limit,
+               bool do_expensive_check)
+{
+  detail::bfs_batch(
+    handle, graph_view, distances, sources, n_sources, depth_limit, do_expensive_check);
+}
+
+}  // namespace cugraph
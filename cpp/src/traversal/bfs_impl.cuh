@@ -17,32 +17,423 @@
 
 #include <cugraph/algorithms.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
 #include <cugraph/prims/count_if_v.cuh>
 #include <cugraph/prims/reduce_op.cuh>
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
 #include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/device_comm.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/distance.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/optional.h>
+#include <thrust/remove.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
 #include <limits>
+#include <optional>
 #include <type_traits>
 
 namespace cugraph {
 namespace detail {
 
+// parameters to switch between the push (top-down) and pull (bottom-up) directions, from
+// S. Beamer, K. Asanovic, and D. Patterson, "Direction-optimizing breadth-first search," 2012.
+double constexpr direction_optimizing_alpha = 15.0;
+double constexpr direction_optimizing_beta  = 18.0;
+
+// visit the unvisited vertices adjacent to the current frontier in the pull (bottom-up) direction;
+// this requires a symmetric graph (out-neighbors are also in-neighbors), every unvisited vertex
+// scans its neighbors and stops at the first neighbor in the current frontier. Returns the newly
+// visited vertices (sorted) to form the next frontier.
+template <typename GraphViewType, typename PredecessorIterator>
+rmm::device_uvector<typename GraphViewType::vertex_type> bfs_pull(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  typename GraphViewType::vertex_type* distances,
+  PredecessorIterator predecessor_first,
+  typename GraphViewType::vertex_type const* frontier_vertex_first,
+  typename GraphViewType::vertex_type const* frontier_vertex_last,
+  typename GraphViewType::vertex_type depth)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+  auto constexpr invalid_parent   = std::numeric_limits<vertex_t>::max();  // reduced with MIN
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+
+  // 1. mark the frontier vertices (columns) and the unvisited vertices (rows)
+
+  rmm::device_uvector<uint8_t> frontier_flags(push_graph_view.get_number_of_local_vertices(),
+                                              handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), frontier_flags.begin(), frontier_flags.end(), uint8_t{0});
+  thrust::for_each(handle.get_thrust_policy(),
+                   frontier_vertex_first,
+                   frontier_vertex_last,
+                   [vertex_partition, frontier_flags = frontier_flags.data()] __device__(auto v) {
+                     frontier_flags[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(
+                       v)] = uint8_t{1};
+                   });
+  auto unvisited_flag_first = thrust::make_transform_iterator(
+    distances, [] __device__(auto d) { return static_cast<uint8_t>(d == invalid_distance); });
+
+  row_properties_t<GraphViewType, uint8_t> adj_matrix_row_unvisited_flags(handle, push_graph_view);
+  col_properties_t<GraphViewType, uint8_t> adj_matrix_col_frontier_flags(handle, push_graph_view);
+  copy_to_adj_matrix_row(
+    handle, push_graph_view, unvisited_flag_first, adj_matrix_row_unvisited_flags);
+  copy_to_adj_matrix_col(
+    handle, push_graph_view, frontier_flags.begin(), adj_matrix_col_frontier_flags);
+  frontier_flags.resize(0, handle.get_stream());
+  frontier_flags.shrink_to_fit(handle.get_stream());
+
+  // 2. find a parent in the current frontier for every unvisited vertex
+
+  rmm::device_uvector<vertex_t> parents(push_graph_view.get_number_of_local_vertices(),
+                                        handle.get_stream());
+  for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto matrix_partition =
+      matrix_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+        push_graph_view.get_matrix_partition_view(i));
+
+    auto segment_offsets = push_graph_view.get_local_adj_matrix_partition_segment_offsets(i);
+    auto use_dcs =
+      segment_offsets
+        ? ((*segment_offsets).size() > (detail::num_sparse_segments_per_vertex_partition + 1))
+        : false;
+    auto major_hypersparse_first =
+      use_dcs ? matrix_partition.get_major_first() +
+                  (*segment_offsets)[detail::num_sparse_segments_per_vertex_partition]
+              : matrix_partition.get_major_last();
+
+    auto matrix_partition_row_unvisited_flags = adj_matrix_row_unvisited_flags.device_view();
+    matrix_partition_row_unvisited_flags.set_local_adj_matrix_partition_idx(i);
+
+    rmm::device_uvector<vertex_t> matrix_partition_parents(
+      GraphViewType::is_multi_gpu ? matrix_partition.get_major_size() : vertex_t{0},
+      handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(matrix_partition.get_major_first()),
+      thrust::make_counting_iterator(matrix_partition.get_major_last()),
+      GraphViewType::is_multi_gpu ? matrix_partition_parents.begin() : parents.begin(),
+      [matrix_partition,
+       major_hypersparse_first,
+       row_unvisited_flags = matrix_partition_row_unvisited_flags,
+       col_frontier_flags  = adj_matrix_col_frontier_flags.device_view()] __device__(auto major) {
+        auto major_offset = matrix_partition.get_major_offset_from_major_nocheck(major);
+        auto major_idx    = major_offset;
+        if (major >= major_hypersparse_first) {
+          auto major_hypersparse_idx =
+            matrix_partition.get_major_hypersparse_idx_from_major_nocheck(major);
+          if (!major_hypersparse_idx) { return invalid_parent; }
+          major_idx = matrix_partition.get_major_offset_from_major_nocheck(major_hypersparse_first) +
+                      *major_hypersparse_idx;
+        }
+        detail::minor_iterator_t<vertex_t, edge_t> indices{};
+        thrust::optional<weight_t const*> weights{thrust::nullopt};
+        edge_t local_degree{};
+        thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_idx);
+        if ((local_degree == edge_t{0}) || (row_unvisited_flags.get(major_offset) == uint8_t{0})) {
+          return invalid_parent;
+        }
+        for (edge_t i = 0; i < local_degree; ++i) {
+          auto minor = indices[i];
+          if (col_frontier_flags.get(matrix_partition.get_minor_offset_from_minor_nocheck(minor)) !=
+              uint8_t{0}) {
+            return minor;
+          }
+        }
+        return invalid_parent;
+      });
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+      device_reduce(col_comm,
+                    matrix_partition_parents.begin(),
+                    parents.begin(),
+                    matrix_partition.get_major_size(),
+                    raft::comms::op_t::MIN,
+                    static_cast<int>(i),
+                    handle.get_stream());
+    }
+  }
+
+  // 3. update distances & predecessors of the newly visited vertices
+
+  rmm::device_uvector<vertex_t> new_frontier_vertices(
+    push_graph_view.get_number_of_local_vertices(), handle.get_stream());
+  new_frontier_vertices.resize(
+    thrust::distance(
+      new_frontier_vertices.begin(),
+      thrust::copy_if(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+                      thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                      parents.begin(),
+                      new_frontier_vertices.begin(),
+                      [] __device__(auto parent) { return parent != invalid_parent; })),
+    handle.get_stream());
+  new_frontier_vertices.shrink_to_fit(handle.get_stream());
+
+  thrust::for_each(handle.get_thrust_policy(),
+                   new_frontier_vertices.begin(),
+                   new_frontier_vertices.end(),
+                   [vertex_partition,
+                    distances,
+                    predecessor_first,
+                    parents = parents.data(),
+                    depth] __device__(auto v) {
+                     auto v_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+                     *(distances + v_offset)         = depth + 1;
+                     *(predecessor_first + v_offset) = parents[v_offset];
+                   });
+
+  return new_frontier_vertices;
+}
+
+// single-GPU bottom-up step (ported from the legacy BFS, see traversal/legacy/bfs_kernels.cuh):
+// only the vertices in the unvisited vertex queue are scanned (the queue shrinks as vertices are
+// visited), the current frontier is a bitmap, and a thread scans the first
+// bottom_up_max_edges_per_thread edges of an unvisited vertex; the vertices with more edges and no
+// parent found in the first edges are scanned by a group of bottom_up_large_degree_group_size
+// threads.
+int32_t constexpr bottom_up_max_edges_per_thread{6};
+int32_t constexpr bottom_up_large_degree_group_size{4};
+int32_t constexpr bottom_up_large_degree_block_size{256};
+
+template <typename vertex_t>
+__device__ bool is_in_bitmap(uint32_t const* bitmap, vertex_t v)
+{
+  return ((bitmap[v / vertex_t{32}] >> static_cast<uint32_t>(v % vertex_t{32})) & uint32_t{1}) !=
+         uint32_t{0};
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+__global__ void for_all_large_degree_unvisited_find_parent(
+  matrix_partition_device_view_t<vertex_t, edge_t, weight_t, false> matrix_partition,
+  vertex_t const* unvisited_vertices,
+  vertex_t const* large_degree_idx_first,
+  vertex_t num_large_degree_idxs,
+  uint32_t const* frontier_bitmap,
+  vertex_t* parents)
+{
+  static_assert(raft::warp_size() % bottom_up_large_degree_group_size == 0);
+  auto constexpr invalid_parent = std::numeric_limits<vertex_t>::max();
+
+  auto const tid        = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const lane_id    = threadIdx.x % raft::warp_size();
+  auto const group_lane = lane_id % bottom_up_large_degree_group_size;
+  auto const group_mask = ((uint32_t{1} << bottom_up_large_degree_group_size) - uint32_t{1})
+                          << (lane_id - group_lane);
+  auto const idx_stride = static_cast<size_t>(gridDim.x) *
+                          static_cast<size_t>(blockDim.x / bottom_up_large_degree_group_size);
+  auto idx              = static_cast<size_t>(tid / bottom_up_large_degree_group_size);
+
+  while (idx < static_cast<size_t>(num_large_degree_idxs)) {
+    auto unvisited_idx = large_degree_idx_first[idx];
+    detail::minor_iterator_t<vertex_t, edge_t> indices{};
+    thrust::optional<weight_t const*> weights{thrust::nullopt};
+    edge_t local_degree{};
+    thrust::tie(indices, weights, local_degree) =
+      matrix_partition.get_local_edges(unvisited_vertices[unvisited_idx]);
+    auto parent = invalid_parent;
+    for (edge_t base = bottom_up_max_edges_per_thread; base < local_degree;
+         base += bottom_up_large_degree_group_size) {
+      auto i     = base + static_cast<edge_t>(group_lane);
+      auto nbr   = invalid_parent;
+      auto found = false;
+      if (i < local_degree) {
+        nbr   = indices[i];
+        found = is_in_bitmap(frontier_bitmap, nbr);
+      }
+      auto ballot = __ballot_sync(group_mask, found) & group_mask;
+      if (ballot != uint32_t{0}) {
+        parent = __shfl_sync(group_mask, nbr, __ffs(ballot) - 1);
+        break;
+      }
+    }
+    if (group_lane == 0) { parents[unvisited_idx] = parent; }
+
+    idx += idx_stride;
+  }
+}
+
+// visit the unvisited vertices in unvisited_vertices (sorted) adjacent to the current frontier in
+// the pull (bottom-up) direction (the graph should be symmetric), the newly visited vertices are
+// removed from unvisited_vertices (the order is preserved) and returned (sorted) to form the next
+// frontier
+template <typename GraphViewType, typename PredecessorIterator>
+rmm::device_uvector<typename GraphViewType::vertex_type> bfs_pull_unvisited_queue(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  typename GraphViewType::vertex_type* distances,
+  PredecessorIterator predecessor_first,
+  typename GraphViewType::vertex_type const* frontier_vertex_first,
+  typename GraphViewType::vertex_type const* frontier_vertex_last,
+  typename GraphViewType::vertex_type depth,
+  rmm::device_uvector<typename GraphViewType::vertex_type>& unvisited_vertices)
+{
+  static_assert(!GraphViewType::is_multi_gpu);
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto constexpr invalid_parent = std::numeric_limits<vertex_t>::max();
+
+  // 1. mark the frontier vertices in a bitmap (vertex IDs are local offsets in single-GPU)
+
+  rmm::device_uvector<uint32_t> frontier_bitmap(
+    (static_cast<size_t>(push_graph_view.get_number_of_vertices()) + 31) / 32,
+    handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), frontier_bitmap.begin(), frontier_bitmap.end(), uint32_t{0});
+  thrust::for_each(handle.get_thrust_policy(),
+                   frontier_vertex_first,
+                   frontier_vertex_last,
+                   [frontier_bitmap = frontier_bitmap.data()] __device__(auto v) {
+                     atomicOr(frontier_bitmap + v / vertex_t{32},
+                              uint32_t{1} << static_cast<uint32_t>(v % vertex_t{32}));
+                   });
+
+  // 2. scan the first edges of the unvisited vertices (a thread per vertex)
+
+  auto matrix_partition =
+    matrix_partition_device_view_t<vertex_t, edge_t, weight_t, false>(
+      push_graph_view.get_matrix_partition_view());
+  rmm::device_uvector<vertex_t> parents(unvisited_vertices.size(), handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    unvisited_vertices.begin(),
+    unvisited_vertices.end(),
+    parents.begin(),
+    [matrix_partition, frontier_bitmap = frontier_bitmap.data()] __device__(auto v) {
+      detail::minor_iterator_t<vertex_t, edge_t> indices{};
+      thrust::optional<weight_t const*> weights{thrust::nullopt};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(v);
+      auto num_edges =
+        thrust::min(local_degree, static_cast<edge_t>(bottom_up_max_edges_per_thread));
+      for (edge_t i = 0; i < num_edges; ++i) {
+        auto nbr = indices[i];
+        if (is_in_bitmap(frontier_bitmap, nbr)) { return nbr; }
+      }
+      return invalid_parent;
+    });
+
+  // 3. scan the remaining edges of the large degree vertices without a parent found yet
+
+  rmm::device_uvector<vertex_t> large_degree_idxs(unvisited_vertices.size(), handle.get_stream());
+  large_degree_idxs.resize(
+    thrust::distance(
+      large_degree_idxs.begin(),
+      thrust::copy_if(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(vertex_t{0}),
+        thrust::make_counting_iterator(static_cast<vertex_t>(unvisited_vertices.size())),
+        large_degree_idxs.begin(),
+        [matrix_partition,
+         unvisited_vertices = unvisited_vertices.data(),
+         parents            = parents.data()] __device__(auto i) {
+          return (parents[i] == invalid_parent) &&
+                 (matrix_partition.get_local_degree(unvisited_vertices[i]) >
+                  static_cast<edge_t>(bottom_up_max_edges_per_thread));
+        })),
+    handle.get_stream());
+  if (large_degree_idxs.size() > 0) {
+    raft::grid_1d_thread_t update_grid(large_degree_idxs.size() * bottom_up_large_degree_group_size,
+                                       bottom_up_large_degree_block_size,
+                                       handle.get_device_properties().maxGridSize[0]);
+    for_all_large_degree_unvisited_find_parent<<<update_grid.num_blocks,
+                                                 update_grid.block_size,
+                                                 0,
+                                                 handle.get_stream()>>>(
+      matrix_partition,
+      unvisited_vertices.data(),
+      large_degree_idxs.data(),
+      static_cast<vertex_t>(large_degree_idxs.size()),
+      frontier_bitmap.data(),
+      parents.data());
+  }
+  large_degree_idxs.resize(0, handle.get_stream());
+  large_degree_idxs.shrink_to_fit(handle.get_stream());
+  frontier_bitmap.resize(0, handle.get_stream());
+  frontier_bitmap.shrink_to_fit(handle.get_stream());
+
+  // 4. update distances & predecessors of the newly visited vertices and remove them from the
+  // unvisited vertex queue
+
+  rmm::device_uvector<vertex_t> new_frontier_vertices(unvisited_vertices.size(),
+                                                      handle.get_stream());
+  rmm::device_uvector<vertex_t> new_frontier_parents(new_frontier_vertices.size(),
+                                                     handle.get_stream());
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(unvisited_vertices.begin(), parents.begin()));
+  new_frontier_vertices.resize(
+    thrust::distance(
+      thrust::make_zip_iterator(
+        thrust::make_tuple(new_frontier_vertices.begin(), new_frontier_parents.begin())),
+      thrust::copy_if(
+        handle.get_thrust_policy(),
+        pair_first,
+        pair_first + unvisited_vertices.size(),
+        thrust::make_zip_iterator(
+          thrust::make_tuple(new_frontier_vertices.begin(), new_frontier_parents.begin())),
+        [] __device__(auto pair) { return thrust::get<1>(pair) != invalid_parent; })),
+    handle.get_stream());
+  new_frontier_parents.resize(new_frontier_vertices.size(), handle.get_stream());
+
+  unvisited_vertices.resize(
+    thrust::distance(pair_first,
+                     thrust::remove_if(handle.get_thrust_policy(),
+                                       pair_first,
+                                       pair_first + unvisited_vertices.size(),
+                                       [] __device__(auto pair) {
+                                         return thrust::get<1>(pair) != invalid_parent;
+                                       })),
+    handle.get_stream());
+
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(new_frontier_vertices.size()),
+                   [distances,
+                    predecessor_first,
+                    vertices = new_frontier_vertices.data(),
+                    parents  = new_frontier_parents.data(),
+                    depth] __device__(auto i) {
+                     auto v                   = vertices[i];
+                     *(distances + v)         = depth + 1;
+                     *(predecessor_first + v) = parents[i];
+                   });
+  new_frontier_vertices.shrink_to_fit(handle.get_stream());
+
+  return new_frontier_vertices;
+}
+
 template <typename GraphViewType, typename PredecessorIterator>
 void bfs(raft::handle_t const& handle,
          GraphViewType const& push_graph_view,
@@ -52,9 +443,13 @@ void bfs(raft::handle_t const& handle,
          size_t n_sources,
          bool direction_optimizing,
          typename GraphViewType::vertex_type depth_limit,
-         bool do_expensive_check)
+         bool do_expensive_check,
+         bool compress_frontier_shuffle)
 {
+  scoped_phase_t phase("bfs", handle.get_stream_view());
+
   using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
 
   static_assert(std::is_integral<vertex_t>::value,
                 "GraphViewType::vertex_type should be integral.");
@@ -129,19 +524,82 @@ void bfs(raft::handle_t const& handle,
                  void,
                  GraphViewType::is_multi_gpu,
                  static_cast<size_t>(Bucket::num_buckets)>
-    vertex_frontier(handle);
+    vertex_frontier(handle,
+                    push_graph_view.get_local_vertex_first(),
+                    push_graph_view.get_local_vertex_last());
 
   vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).insert(sources, sources + n_sources);
 
   // 4. BFS iteration
+
+  // the out-degrees are used to estimate the number of edges to check in either direction (taken
+  // from the degree cache if the graph has one)
+  auto cached_out_degrees =
+    direction_optimizing ? push_graph_view.get_cached_out_degrees(handle) : std::nullopt;
+  auto tmp_out_degrees = (direction_optimizing && !cached_out_degrees)
+                           ? push_graph_view.compute_out_degrees(handle)
+                           : rmm::device_uvector<edge_t>(0, handle.get_stream());
+  edge_t const* out_degrees = cached_out_degrees ? *cached_out_degrees : tmp_out_degrees.data();
+  bool top_down{true};
+  auto cur_frontier_aggregate_size = aggregate_n_sources;
+  // the number of edges from the unvisited vertices, updated incrementally (as in the legacy BFS)
+  // instead of scanning every vertex in every iteration
+  std::optional<edge_t> m_u{std::nullopt};
+  // single-GPU only, valid in the bottom-up iterations (the top-down iterations do not maintain it)
+  [[maybe_unused]] std::optional<rmm::device_uvector<vertex_t>> unvisited_vertices{std::nullopt};
+
   vertex_t depth{0};
   while (true) {
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t level_range("level", depth);
+
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      push_graph_view.get_vertex_partition_view());
+
     if (direction_optimizing) {
-      CUGRAPH_FAIL("unimplemented.");
-    } else {
-      auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
-        push_graph_view.get_vertex_partition_view());
+      auto& cur_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+      auto m_f                  = thrust::transform_reduce(
+        handle.get_thrust_policy(),
+        cur_frontier_bucket.begin(),
+        cur_frontier_bucket.end(),
+        [vertex_partition, out_degrees] __device__(auto v) {
+          return out_degrees[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)];
+        },
+        edge_t{0},
+        thrust::plus<edge_t>());
+      if (GraphViewType::is_multi_gpu) {
+        m_f = host_scalar_allreduce(
+          handle.get_comms(), m_f, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (m_u) {
+        // the current frontier vertices were unvisited in the previous iteration
+        *m_u -= m_f;
+      } else {
+        m_u = thrust::transform_reduce(
+          handle.get_thrust_policy(),
+          thrust::make_counting_iterator(vertex_t{0}),
+          thrust::make_counting_iterator(push_graph_view.get_number_of_local_vertices()),
+          [distances, out_degrees] __device__(auto i) {
+            return distances[i] == invalid_distance ? out_degrees[i] : edge_t{0};
+          },
+          edge_t{0},
+          thrust::plus<edge_t>());
+        if (GraphViewType::is_multi_gpu) {
+          m_u = host_scalar_allreduce(
+            handle.get_comms(), *m_u, raft::comms::op_t::SUM, handle.get_stream());
+        }
+      }
+      if (top_down) {
+        top_down = static_cast<double>(m_f) <=
+                   static_cast<double>(*m_u) / detail::direction_optimizing_alpha;
+      } else {
+        top_down = static_cast<double>(cur_frontier_aggregate_size) <
+                   static_cast<double>(num_vertices) / detail::direction_optimizing_beta;
+      }
+    }
 
+    if (top_down) {
+      if constexpr (!GraphViewType::is_multi_gpu) { unvisited_vertices = std::nullopt; }
       update_frontier_v_push_if_out_nbr(
         handle,
         push_graph_view,
@@ -170,25 +628,69 @@ void bfs(raft::handle_t const& handle,
                        static_cast<size_t>(Bucket::next),
                        thrust::make_tuple(depth + 1, pushed_val))}
                    : thrust::nullopt;
-        });
-
-      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
-      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
-      vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
-                                   static_cast<size_t>(Bucket::next));
-      if (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() == 0) {
-        break;
+        },
+        compress_frontier_shuffle);
+    } else {
+      auto& cur_frontier_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+      rmm::device_uvector<vertex_t> new_frontier_vertices(0, handle.get_stream());
+      if constexpr (GraphViewType::is_multi_gpu) {
+        new_frontier_vertices = detail::bfs_pull(handle,
+                                                 push_graph_view,
+                                                 distances,
+                                                 predecessor_first,
+                                                 cur_frontier_bucket.begin(),
+                                                 cur_frontier_bucket.end(),
+                                                 depth);
+      } else if (push_graph_view.get_matrix_partition_view().get_dcs_nzd_vertices()) {
+        // the unvisited vertex queue indexes the offsets by vertex ID, this does not hold in the
+        // hypersparse (DCSR) segment
+        new_frontier_vertices = detail::bfs_pull(handle,
+                                                 push_graph_view,
+                                                 distances,
+                                                 predecessor_first,
+                                                 cur_frontier_bucket.begin(),
+                                                 cur_frontier_bucket.end(),
+                                                 depth);
+      } else {
+        if (!unvisited_vertices) {
+          unvisited_vertices = rmm::device_uvector<vertex_t>(
+            push_graph_view.get_number_of_local_vertices(), handle.get_stream());
+          (*unvisited_vertices)
+            .resize(thrust::distance(
+                      (*unvisited_vertices).begin(),
+                      thrust::copy_if(handle.get_thrust_policy(),
+                                      thrust::make_counting_iterator(vertex_t{0}),
+                                      thrust::make_counting_iterator(
+                                        push_graph_view.get_number_of_local_vertices()),
+                                      distances,
+                                      (*unvisited_vertices).begin(),
+                                      [] __device__(auto d) { return d == invalid_distance; })),
+                    handle.get_stream());
+        }
+        new_frontier_vertices = detail::bfs_pull_unvisited_queue(handle,
+                                                                 push_graph_view,
+                                                                 distances,
+                                                                 predecessor_first,
+                                                                 cur_frontier_bucket.begin(),
+                                                                 cur_frontier_bucket.end(),
+                                                                 depth,
+                                                                 *unvisited_vertices);
       }
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next))
+        .insert(new_frontier_vertices.begin(), new_frontier_vertices.end());
     }
 
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+    cur_frontier_aggregate_size =
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size();
+    if (cur_frontier_aggregate_size == 0) { break; }
+
     depth++;
     if (depth >= depth_limit) { break; }
   }
-
-  CUDA_TRY(cudaStreamSynchronize(
-    handle.get_stream()));  // this is as necessary vertex_frontier will become out-of-scope once
-                            // this function returns (FIXME: should I stream sync in VertexFrontier
-                            // destructor?)
 }
 
 }  // namespace detail
@@ -202,7 +704,8 @@ void bfs(raft::handle_t const& handle,
          size_t n_sources,
          bool direction_optimizing,
          vertex_t depth_limit,
-         bool do_expensive_check)
+         bool do_expensive_check,
+         bool compress_frontier_shuffle)
 {
   if (predecessors != nullptr) {
     detail::bfs(handle,
@@ -213,7 +716,8 @@ void bfs(raft::handle_t const& handle,
                 n_sources,
                 direction_optimizing,
                 depth_limit,
-                do_expensive_check);
+                do_expensive_check,
+                compress_frontier_shuffle);
   } else {
     detail::bfs(handle,
                 graph_view,
@@ -223,7 +727,8 @@ void bfs(raft::handle_t const& handle,
                 n_sources,
                 direction_optimizing,
                 depth_limit,
-                do_expensive_check);
+                do_expensive_check,
+                compress_frontier_shuffle);
   }
 }
 
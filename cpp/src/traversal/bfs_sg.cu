@@ -20,6 +20,7 @@ namespace cugraph {
 
 // SG instantiation
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template void bfs(raft::handle_t const& handle,
                   graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
                   int32_t* distances,
@@ -28,8 +29,11 @@ template void bfs(raft::handle_t const& handle,
                   size_t n_sources,
                   bool direction_optimizing,
                   int32_t depth_limit,
-                  bool do_expensive_check);
+                  bool do_expensive_check,
+                  bool compress_frontier_shuffle);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template void bfs(raft::handle_t const& handle,
                   graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
                   int32_t* distances,
@@ -38,8 +42,11 @@ template void bfs(raft::handle_t const& handle,
                   size_t n_sources,
                   bool direction_optimizing,
                   int32_t depth_limit,
-                  bool do_expensive_check);
+                  bool do_expensive_check,
+                  bool compress_frontier_shuffle);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template void bfs(raft::handle_t const& handle,
                   graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
                   int32_t* distances,
@@ -48,8 +55,11 @@ template void bfs(raft::handle_t const& handle,
                   size_t n_sources,
                   bool direction_optimizing,
                   int32_t depth_limit,
-                  bool do_expensive_check);
+                  bool do_expensive_check,
+                  bool compress_frontier_shuffle);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template void bfs(raft::handle_t const& handle,
                   graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
                   int32_t* distances,
@@ -58,8 +68,11 @@ template void bfs(raft::handle_t const& handle,
                   size_t n_sources,
                   bool direction_optimizing,
                   int32_t depth_limit,
-                  bool do_expensive_check);
+                  bool do_expensive_check,
+                  bool compress_frontier_shuffle);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template void bfs(raft::handle_t const& handle,
                   graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
                   int64_t* distances,
@@ -68,8 +81,11 @@ template void bfs(raft::handle_t const& handle,
                   size_t n_sources,
                   bool direction_optimizing,
                   int64_t depth_limit,
-                  bool do_expensive_check);
+                  bool do_expensive_check,
+                  bool compress_frontier_shuffle);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template void bfs(raft::handle_t const& handle,
                   graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
                   int64_t* distances,
@@ -78,6 +94,8 @@ template void bfs(raft::handle_t const& handle,
                   size_t n_sources,
                   bool direction_optimizing,
                   int64_t depth_limit,
-                  bool do_expensive_check);
+                  bool do_expensive_check,
+                  bool compress_frontier_shuffle);
+#endif
 
 }  // namespace cugraph
@@ -0,0 +1,460 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// the maximum number of sources of a single bfs_batch call
+size_t constexpr eccentricity_batch_size{64};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct distance_or_zero_t {
+  vertex_t const* distances{nullptr};
+
+  __device__ vertex_t operator()(size_t i) const
+  {
+    auto d = distances[i];
+    return d == std::numeric_limits<vertex_t>::max() ? vertex_t{0} : d;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct farthest_vertex_op_t {
+  vertex_t const* distances{nullptr};
+  vertex_t local_vertex_first{};
+
+  __device__ thrust::tuple<vertex_t, vertex_t> operator()(vertex_t v) const
+  {
+    auto d = distances[v - local_vertex_first];
+    return thrust::make_tuple(d == std::numeric_limits<vertex_t>::max() ? vertex_t{-1} : d, v);
+  }
+};
+
+// (distance, vertex) pairs are compared by distance first and then by vertex ID (the smaller ID is
+// farther)
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct farther_t {
+  __host__ __device__ thrust::tuple<vertex_t, vertex_t> operator()(
+    thrust::tuple<vertex_t, vertex_t> lhs, thrust::tuple<vertex_t, vertex_t> rhs) const
+  {
+    if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+      return thrust::get<0>(lhs) > thrust::get<0>(rhs) ? lhs : rhs;
+    } else {
+      return thrust::get<1>(lhs) < thrust::get<1>(rhs) ? lhs : rhs;
+    }
+  }
+};
+
+// returns (the largest distance, the smallest vertex ID with the largest distance) over the
+// vertices reachable from the source (distances are the output of (single source) bfs)
+template <typename GraphViewType>
+thrust::tuple<typename GraphViewType::vertex_type, typename GraphViewType::vertex_type>
+farthest_vertex(raft::handle_t const& handle,
+                GraphViewType const& graph_view,
+                typename GraphViewType::vertex_type const* distances)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto init = thrust::make_tuple(vertex_t{-1}, std::numeric_limits<vertex_t>::max());
+  auto ret  = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(graph_view.get_local_vertex_first()),
+    thrust::make_counting_iterator(graph_view.get_local_vertex_last()),
+    farthest_vertex_op_t<vertex_t>{distances, graph_view.get_local_vertex_first()},
+    init,
+    farther_t<vertex_t>{});
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto rets = host_scalar_allgather(handle.get_comms(), ret, handle.get_stream());
+    ret       = std::reduce(rets.begin(), rets.end(), init, farther_t<vertex_t>{});
+  }
+  return ret;
+}
+
+// the distances from the vertex source
+template <typename GraphViewType>
+void single_source_bfs(raft::handle_t const& handle,
+                       GraphViewType const& graph_view,
+                       typename GraphViewType::vertex_type source,
+                       typename GraphViewType::vertex_type* distances)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  rmm::device_scalar<vertex_t> d_source(source, handle.get_stream());
+  auto is_local = (source >= graph_view.get_local_vertex_first()) &&
+                  (source < graph_view.get_local_vertex_last());
+  bfs(handle,
+      graph_view,
+      distances,
+      static_cast<vertex_t*>(nullptr),
+      d_source.data(),
+      is_local ? size_t{1} : size_t{0},
+      graph_view.is_symmetric(),
+      std::numeric_limits<vertex_t>::max());
+}
+
+// returns the eccentricities (ignoring the unreachable vertices) of the aggregate_n_sources
+// sources in [batch_first, batch_first + batch_size) (in the global order, sources are ordered by
+// GPU rank first and then by the position in local_sources) on every GPU; batch_size should not
+// exceed eccentricity_batch_size, local_source_offset is the index of local_sources[0] in the
+// global order.
+template <typename GraphViewType>
+std::vector<typename GraphViewType::vertex_type> batch_eccentricities(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  typename GraphViewType::vertex_type const* local_sources,
+  size_t num_local_sources,
+  size_t local_source_offset,
+  size_t batch_first,
+  size_t batch_size)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto first = std::min(std::max(batch_first, local_source_offset),
+                        local_source_offset + num_local_sources);
+  auto last  = std::min(std::max(batch_first + batch_size, local_source_offset),
+                       local_source_offset + num_local_sources);
+
+  auto const ld = static_cast<size_t>(graph_view.get_number_of_local_vertices());
+  rmm::device_uvector<vertex_t> distances(ld * batch_size, handle.get_stream());
+  bfs_batch(handle,
+            graph_view,
+            distances.data(),
+            local_sources + (first - local_source_offset),
+            last - first,
+            std::numeric_limits<vertex_t>::max());
+
+  rmm::device_uvector<vertex_t> eccentricities(batch_size, handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), eccentricities.begin(), eccentricities.end(), vertex_t{0});
+  if (ld > 0) {
+    auto key_first = thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}),
+                                                     [ld] __device__(size_t i) { return i / ld; });
+    thrust::reduce_by_key(
+      handle.get_thrust_policy(),
+      key_first,
+      key_first + ld * batch_size,
+      thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}),
+                                      distance_or_zero_t<vertex_t>{distances.data()}),
+      thrust::make_discard_iterator(),
+      eccentricities.begin(),
+      thrust::equal_to<size_t>{},
+      thrust::maximum<vertex_t>{});
+  }
+  if constexpr (GraphViewType::is_multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     eccentricities.data(),
+                     eccentricities.data(),
+                     eccentricities.size(),
+                     raft::comms::op_t::MAX,
+                     handle.get_stream());
+  }
+
+  std::vector<vertex_t> h_eccentricities(batch_size);
+  raft::update_host(
+    h_eccentricities.data(), eccentricities.data(), eccentricities.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+  return h_eccentricities;
+}
+
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> eccentricity(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  typename GraphViewType::vertex_type const* vertices,
+  size_t n_vertices,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((n_vertices == 0) || (vertices != nullptr),
+                  "Invalid input argument: vertices cannot be null");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      graph_view.get_vertex_partition_view());
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 graph_view,
+                 vertices,
+                 vertices + n_vertices,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: vertices have invalid vertex IDs.");
+  }
+
+  // 2. breadth-first searches from eccentricity_batch_size vertices (aggregated over the GPUs) at
+  // a time
+
+  size_t local_offset{0};
+  auto aggregate_n_vertices = n_vertices;
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto h_n_vertices = host_scalar_allgather(handle.get_comms(), n_vertices, handle.get_stream());
+    local_offset      = std::reduce(
+      h_n_vertices.begin(), h_n_vertices.begin() + handle.get_comms().get_rank(), size_t{0});
+    aggregate_n_vertices = std::reduce(h_n_vertices.begin(), h_n_vertices.end(), size_t{0});
+  }
+
+  std::vector<vertex_t> h_eccentricities(n_vertices);
+  for (size_t i = 0; i < aggregate_n_vertices; i += eccentricity_batch_size) {
+    auto batch_size = std::min(eccentricity_batch_size, aggregate_n_vertices - i);
+    auto h_batch_eccentricities =
+      batch_eccentricities(handle, graph_view, vertices, n_vertices, local_offset, i, batch_size);
+    for (size_t j = 0; j < batch_size; ++j) {
+      if ((i + j >= local_offset) && (i + j < local_offset + n_vertices)) {
+        h_eccentricities[i + j - local_offset] = h_batch_eccentricities[j];
+      }
+    }
+  }
+
+  rmm::device_uvector<vertex_t> eccentricities(n_vertices, handle.get_stream());
+  raft::update_device(
+    eccentricities.data(), h_eccentricities.data(), h_eccentricities.size(), handle.get_stream());
+  return eccentricities;
+}
+
+// implements the iFUB algorithm (with the double sweep & midpoint start vertex) in
+// P. Crescenzi, R. Grossi, M. Habib, L. Lanzi, and A. Marino, "On computing the diameter of
+// real-world undirected graphs," 2013.
+// once the eccentricities of the vertices at distance i or larger from the start vertex u are
+// known (their maximum is the lower bound), the eccentricity of a vertex closer to u is bounded by
+// max(the lower bound, 2 * (i - 1)).
+template <typename GraphViewType>
+std::tuple<typename GraphViewType::vertex_type, typename GraphViewType::vertex_type>
+approximate_diameter(raft::handle_t const& handle,
+                     GraphViewType const& graph_view,
+                     std::optional<typename GraphViewType::vertex_type> start_vertex,
+                     size_t max_traversals,
+                     bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_signed<vertex_t>::value, "GraphViewType::vertex_type should be signed.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return std::make_tuple(vertex_t{0}, vertex_t{0}); }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: approximate_diameter currently supports only "
+                  "undirected (symmetric) graphs.");
+  CUGRAPH_EXPECTS(max_traversals >= 4,
+                  "Invalid input argument: max_traversals should be at least 4 (for the double "
+                  "sweep and the iFUB start vertex).");
+  CUGRAPH_EXPECTS(
+    !start_vertex || ((*start_vertex >= vertex_t{0}) && (*start_vertex < num_vertices)),
+    "Invalid input argument: start_vertex is out of range.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  auto const local_vertex_first = graph_view.get_local_vertex_first();
+  auto const ld = static_cast<size_t>(graph_view.get_number_of_local_vertices());
+
+  // 2. pick the maximum degree vertex if start_vertex is not provided
+
+  if (!start_vertex) {
+    auto out_degrees = graph_view.compute_out_degrees(handle);
+    auto init        = thrust::make_tuple(vertex_t{-1}, std::numeric_limits<vertex_t>::max());
+    auto ret         = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(local_vertex_first),
+      thrust::make_counting_iterator(graph_view.get_local_vertex_last()),
+      [out_degrees = out_degrees.data(), local_vertex_first] __device__(vertex_t v) {
+        return thrust::make_tuple(static_cast<vertex_t>(out_degrees[v - local_vertex_first]), v);
+      },
+      init,
+      farther_t<vertex_t>{});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto rets = host_scalar_allgather(handle.get_comms(), ret, handle.get_stream());
+      ret       = std::reduce(rets.begin(), rets.end(), init, farther_t<vertex_t>{});
+    }
+    start_vertex = thrust::get<1>(ret);
+  }
+
+  // 3. double sweep (the lower bound) & the midpoint of the double sweep path (the iFUB start
+  // vertex)
+
+  rmm::device_uvector<vertex_t> distances_a(ld, handle.get_stream());
+  rmm::device_uvector<vertex_t> distances_b(ld, handle.get_stream());
+
+  single_source_bfs(handle, graph_view, *start_vertex, distances_a.data());
+  auto a = thrust::get<1>(farthest_vertex(handle, graph_view, distances_a.data()));
+  single_source_bfs(handle, graph_view, a, distances_a.data());
+  auto farthest = farthest_vertex(handle, graph_view, distances_a.data());
+  auto lower    = thrust::get<0>(farthest);
+  single_source_bfs(handle, graph_view, thrust::get<1>(farthest), distances_b.data());
+  size_t num_traversals{3};
+
+  auto half = lower / 2;
+  auto u    = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(local_vertex_first),
+    thrust::make_counting_iterator(graph_view.get_local_vertex_last()),
+    [distances_a = distances_a.data(),
+     distances_b = distances_b.data(),
+     local_vertex_first,
+     half,
+     lower] __device__(vertex_t v) {
+      auto offset = v - local_vertex_first;
+      return ((distances_a[offset] == half) && (distances_b[offset] == lower - half))
+               ? v
+               : std::numeric_limits<vertex_t>::max();
+    },
+    std::numeric_limits<vertex_t>::max(),
+    thrust::minimum<vertex_t>{});
+  if constexpr (GraphViewType::is_multi_gpu) {
+    u = host_scalar_allreduce(handle.get_comms(), u, raft::comms::op_t::MIN, handle.get_stream());
+  }
+
+  // 4. iFUB from u, levels are processed from the farthest
+
+  auto& distances_u = distances_a;
+  single_source_bfs(handle, graph_view, u, distances_u.data());
+  ++num_traversals;
+  auto ecc_u = thrust::get<0>(farthest_vertex(handle, graph_view, distances_u.data()));
+  lower      = std::max(lower, ecc_u);
+  auto upper = vertex_t{2} * ecc_u;
+
+  rmm::device_uvector<vertex_t> fringe(ld, handle.get_stream());
+  for (auto i = ecc_u; (i > 0) && (upper > lower); --i) {
+    fringe.resize(ld, handle.get_stream());
+    fringe.resize(
+      thrust::distance(
+        fringe.begin(),
+        thrust::copy_if(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(local_vertex_first),
+                        thrust::make_counting_iterator(graph_view.get_local_vertex_last()),
+                        fringe.begin(),
+                        [distances_u = distances_u.data(), local_vertex_first, i] __device__(
+                          vertex_t v) { return distances_u[v - local_vertex_first] == i; })),
+      handle.get_stream());
+
+    size_t local_offset{0};
+    auto aggregate_fringe_size = fringe.size();
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto h_fringe_sizes =
+        host_scalar_allgather(handle.get_comms(), fringe.size(), handle.get_stream());
+      local_offset = std::reduce(h_fringe_sizes.begin(),
+                                 h_fringe_sizes.begin() + handle.get_comms().get_rank(),
+                                 size_t{0});
+      aggregate_fringe_size = std::reduce(h_fringe_sizes.begin(), h_fringe_sizes.end(), size_t{0});
+    }
+
+    // the upper bound can be lowered only once every fringe vertex is processed
+    bool fringe_done{true};
+    size_t j{0};
+    while ((j < aggregate_fringe_size) && (upper > lower)) {
+      if (num_traversals >= max_traversals) {
+        fringe_done = false;
+        break;
+      }
+      auto batch_size = std::min(
+        {eccentricity_batch_size, aggregate_fringe_size - j, max_traversals - num_traversals});
+      auto h_eccentricities = batch_eccentricities(
+        handle, graph_view, fringe.data(), fringe.size(), local_offset, j, batch_size);
+      num_traversals += batch_size;
+      lower = std::max(lower, *std::max_element(h_eccentricities.begin(), h_eccentricities.end()));
+      j += batch_size;
+    }
+    if (!fringe_done) { break; }
+
+    upper = std::max(lower, std::min(upper, vertex_t{2} * (i - 1)));
+  }
+  upper = std::max(upper, lower);
+
+  return std::make_tuple(lower, upper);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* vertices,
+  size_t n_vertices,
+  bool do_expensive_check)
+{
+  return detail::eccentricity(handle, graph_view, vertices, n_vertices, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<vertex_t, vertex_t> approximate_diameter(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  std::optional<vertex_t> start_vertex,
+  size_t max_traversals,
+  bool do_expensive_check)
+{
+  return detail::approximate_diameter(
+    handle, graph_view, start_vertex, max_traversals, do_expensive_check);
+}
+
+}  // namespace cugraph
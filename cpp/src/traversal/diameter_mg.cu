@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <traversal/diameter_impl.cuh>
+
+namespace cugraph {
+
+// MG instantiation
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template rmm::device_uvector<int32_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  int32_t const* vertices,
+  size_t n_vertices,
+  bool do_expensive_check);
+
+template std::tuple<int32_t, int32_t> approximate_diameter(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  std::optional<int32_t> start_vertex,
+  size_t max_traversals,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template rmm::device_uvector<int32_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  int32_t const* vertices,
+  size_t n_vertices,
+  bool do_expensive_check);
+
+template std::tuple<int32_t, int32_t> approximate_diameter(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  std::optional<int32_t> start_vertex,
+  size_t max_traversals,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template rmm::device_uvector<int64_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  int64_t const* vertices,
+  size_t n_vertices,
+  bool do_expensive_check);
+
+template std::tuple<int64_t, int64_t> approximate_diameter(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  std::optional<int64_t> start_vertex,
+  size_t max_traversals,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template rmm::device_uvector<int32_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  int32_t const* vertices,
+  size_t n_vertices,
+  bool do_expensive_check);
+
+template std::tuple<int32_t, int32_t> approximate_diameter(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  std::optional<int32_t> start_vertex,
+  size_t max_traversals,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template rmm::device_uvector<int32_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  int32_t const* vertices,
+  size_t n_vertices,
+  bool do_expensive_check);
+
+template std::tuple<int32_t, int32_t> approximate_diameter(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  std::optional<int32_t> start_vertex,
+  size_t max_traversals,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template rmm::device_uvector<int64_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  int64_t const* vertices,
+  size_t n_vertices,
+  bool do_expensive_check);
+
+template std::tuple<int64_t, int64_t> approximate_diameter(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  std::optional<int64_t> start_vertex,
+  size_t max_traversals,
+  bool do_expensive_check);
+#endif
+
+}  // namespace cugraph
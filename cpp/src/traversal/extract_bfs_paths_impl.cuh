@@ -32,8 +32,11 @@
 
 #include <thrust/binary_search.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
@@ -104,6 +107,44 @@ struct decrement_position {
   size_t __device__ operator()(size_t offset) { return offset - 1; }
 };
 
+// the number of vertices in the path to v (0 if v is unreachable, 1 if v is a source)
+template <typename vertex_t, bool is_multi_gpu>
+struct compute_path_length {
+  vertex_partition_device_view_t<vertex_t, is_multi_gpu> vertex_partition_;
+  vertex_t invalid_vertex_;
+  vertex_t const* predecessors_;
+  vertex_t const* distances_;
+
+  size_t __device__ operator()(vertex_t v)
+  {
+    auto offset = vertex_partition_.get_local_vertex_offset_from_vertex_nocheck(v);
+
+    if (predecessors_[offset] == invalid_vertex_) {
+      return distances_[offset] == vertex_t{0} ? size_t{1} : size_t{0};
+    }
+    return static_cast<size_t>(distances_[offset]) + 1;
+  }
+};
+
+// every predecessor is local in single-GPU, a thread walks back a whole path (no per-hop kernel
+// launch and the work is proportional to the path length)
+template <typename vertex_t>
+struct sg_walk_path {
+  vertex_t const* predecessors_;
+  vertex_t const* destinations_;
+  size_t const* path_offsets_;
+  vertex_t* paths_;
+
+  void __device__ operator()(size_t idx)
+  {
+    auto v = destinations_[idx];
+    for (auto offset = path_offsets_[idx + 1]; offset > path_offsets_[idx]; --offset) {
+      paths_[offset - 1] = v;
+      v                  = predecessors_[v];
+    }
+  }
+};
+
 template <typename vertex_t>
 std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<size_t>> shrink_extraction_list(
   raft::handle_t const& handle,
@@ -237,4 +278,133 @@ std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extract_bfs_paths(
   return std::make_tuple(std::move(paths), max_path_length);
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>>
+extract_bfs_paths_compressed(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* distances,
+  vertex_t const* predecessors,
+  vertex_t const* destinations,
+  size_t n_destinations)
+{
+  CUGRAPH_EXPECTS(distances != nullptr, "Invalid input argument: distances cannot be null");
+  CUGRAPH_EXPECTS(predecessors != nullptr, "Invalid input argument: predecessors cannot be null");
+
+  CUGRAPH_EXPECTS((n_destinations == 0) || (destinations != nullptr),
+                  "Invalid input argument: destinations cannot be null");
+
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition_device_view(
+    graph_view.get_vertex_partition_view());
+
+  if constexpr (multi_gpu) {
+    CUGRAPH_EXPECTS(0 == thrust::count_if(handle.get_thrust_policy(),
+                                          destinations,
+                                          destinations + n_destinations,
+                                          [vertex_partition_device_view] __device__(auto v) {
+                                            return !vertex_partition_device_view.is_valid_vertex(v);
+                                          }),
+                    "Invalid input argument: destinations must be partitioned on the correct GPU");
+  }
+
+  auto constexpr invalid_vertex = invalid_vertex_id<vertex_t>::value;
+
+  // 1. compute the path offsets (the exclusive sum of the path lengths)
+
+  rmm::device_uvector<size_t> path_offsets(n_destinations + 1, handle.get_stream());
+  path_offsets.set_element_to_zero_async(0, handle.get_stream());
+  auto path_length_first = thrust::make_transform_iterator(
+    destinations,
+    detail::compute_path_length<vertex_t, multi_gpu>{
+      vertex_partition_device_view, invalid_vertex, predecessors, distances});
+  thrust::inclusive_scan(handle.get_thrust_policy(),
+                         path_length_first,
+                         path_length_first + n_destinations,
+                         path_offsets.begin() + 1);
+
+  rmm::device_uvector<vertex_t> paths(path_offsets.back_element(handle.get_stream()),
+                                      handle.get_stream());
+
+  // 2. walk back the paths
+
+  if constexpr (multi_gpu) {
+    // a hop may cross GPUs, walk back every path one hop at a time (the ended paths are dropped)
+
+    vertex_t max_path_length =
+      1 + thrust::transform_reduce(
+            handle.get_thrust_policy(),
+            destinations,
+            destinations + n_destinations,
+            detail::compute_max_distance<vertex_t, multi_gpu>{
+              vertex_partition_device_view, invalid_vertex, predecessors, distances},
+            vertex_t{0},
+            detail::compute_max<vertex_t>{});
+    max_path_length = cugraph::host_scalar_allreduce(
+      handle.get_comms(), max_path_length, raft::comms::op_t::MAX, handle.get_stream());
+
+    rmm::device_uvector<vertex_t> current_frontier(n_destinations, handle.get_stream());
+    rmm::device_uvector<size_t> current_position(n_destinations, handle.get_stream());
+    raft::copy(current_frontier.data(), destinations, n_destinations, handle.get_stream());
+    // the position of the path's last vertex (the current_frontier vertices of the empty paths are
+    // invalidated to be dropped)
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(n_destinations),
+      [path_offsets     = path_offsets.data(),
+       current_frontier = current_frontier.data(),
+       current_position = current_position.data(),
+       invalid_vertex] __device__(auto i) {
+        if (path_offsets[i + 1] > path_offsets[i]) {
+          current_position[i] = path_offsets[i + 1] - 1;
+        } else {
+          current_frontier[i] = invalid_vertex;
+        }
+      });
+
+    auto h_vertex_partition_lasts = graph_view.get_vertex_partition_lasts();
+
+    std::tie(current_frontier, current_position) = detail::shrink_extraction_list(
+      handle, std::move(current_frontier), std::move(current_position));
+
+    thrust::for_each_n(handle.get_thrust_policy(),
+                       thrust::make_zip_iterator(
+                         thrust::make_tuple(current_frontier.begin(), current_position.begin())),
+                       current_frontier.size(),
+                       detail::update_paths<vertex_t>{paths.data(), invalid_vertex});
+
+    for (vertex_t count = 1; count < max_path_length; ++count) {
+      thrust::transform(handle.get_thrust_policy(),
+                        current_position.begin(),
+                        current_position.end(),
+                        current_position.data(),
+                        detail::decrement_position{});
+
+      current_frontier = collect_values_for_vertices(handle.get_comms(),
+                                                     current_frontier.begin(),
+                                                     current_frontier.end(),
+                                                     predecessors,
+                                                     h_vertex_partition_lasts,
+                                                     handle.get_stream());
+
+      std::tie(current_frontier, current_position) = detail::shrink_extraction_list(
+        handle, std::move(current_frontier), std::move(current_position));
+
+      thrust::for_each_n(handle.get_thrust_policy(),
+                         thrust::make_zip_iterator(
+                           thrust::make_tuple(current_frontier.begin(), current_position.begin())),
+                         current_frontier.size(),
+                         detail::update_paths<vertex_t>{paths.data(), invalid_vertex});
+    }
+  } else {
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(n_destinations),
+                     detail::sg_walk_path<vertex_t>{
+                       predecessors, destinations, path_offsets.data(), paths.data()});
+  }
+
+  return std::make_tuple(std::move(path_offsets), std::move(paths));
+}
+
 }  // namespace cugraph
@@ -20,6 +20,7 @@ namespace cugraph {
 
 // SG instantiation
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
@@ -28,6 +29,17 @@ template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
   int32_t const* destinations,
   size_t n_destinations);
 
+template std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>>
+extract_bfs_paths_compressed(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  int32_t const* distances,
+  int32_t const* predecessors,
+  int32_t const* destinations,
+  size_t n_destinations);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
@@ -36,6 +48,17 @@ template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
   int32_t const* destinations,
   size_t n_destinations);
 
+template std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>>
+extract_bfs_paths_compressed(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  int32_t const* distances,
+  int32_t const* predecessors,
+  int32_t const* destinations,
+  size_t n_destinations);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template std::tuple<rmm::device_uvector<int64_t>, int64_t> extract_bfs_paths(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
@@ -44,6 +67,17 @@ template std::tuple<rmm::device_uvector<int64_t>, int64_t> extract_bfs_paths(
   int64_t const* destinations,
   size_t n_destinations);
 
+template std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int64_t>>
+extract_bfs_paths_compressed(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  int64_t const* distances,
+  int64_t const* predecessors,
+  int64_t const* destinations,
+  size_t n_destinations);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
@@ -52,6 +86,17 @@ template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
   int32_t const* destinations,
   size_t n_destinations);
 
+template std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>>
+extract_bfs_paths_compressed(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  int32_t const* distances,
+  int32_t const* predecessors,
+  int32_t const* destinations,
+  size_t n_destinations);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
@@ -60,6 +105,17 @@ template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
   int32_t const* destinations,
   size_t n_destinations);
 
+template std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>>
+extract_bfs_paths_compressed(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  int32_t const* distances,
+  int32_t const* predecessors,
+  int32_t const* destinations,
+  size_t n_destinations);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template std::tuple<rmm::device_uvector<int64_t>, int64_t> extract_bfs_paths(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
@@ -68,4 +124,14 @@ template std::tuple<rmm::device_uvector<int64_t>, int64_t> extract_bfs_paths(
   int64_t const* destinations,
   size_t n_destinations);
 
+template std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int64_t>>
+extract_bfs_paths_compressed(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  int64_t const* distances,
+  int64_t const* predecessors,
+  int64_t const* destinations,
+  size_t n_destinations);
+#endif
+
 }  // namespace cugraph
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/optional.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// a vertex is tagged with the index of the query it is reached by
+using k_hop_query_t = int32_t;
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+struct k_hop_push_v_op_t {
+  size_t next_bucket_idx{};
+
+  template <typename key_t>
+  __device__ thrust::optional<thrust::tuple<size_t, int>> operator()(key_t, int) const
+  {
+    return thrust::make_tuple(next_bucket_idx, 0 /* dummy */);
+  }
+};
+
+// keeps at most hop_limit (query, vertex) pairs (the smallest vertex IDs first, and the lower ranks
+// first in multi-GPU) of each query among the sorted (by (vertex, query)) pairs newly reached in a
+// hop
+template <typename vertex_t, bool multi_gpu>
+void limit_k_hop_nbrs(raft::handle_t const& handle,
+                      rmm::device_uvector<vertex_t>& vertices /* [INOUT] */,
+                      rmm::device_uvector<k_hop_query_t>& queries /* [INOUT] */,
+                      size_t n_queries,
+                      size_t hop_limit)
+{
+  // sort by (query, vertex) and find the rank of each pair in its query
+
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(queries.begin(), vertices.begin()));
+  thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + vertices.size());
+
+  rmm::device_uvector<size_t> query_offsets(n_queries + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      queries.begin(),
+                      queries.end(),
+                      thrust::make_counting_iterator(k_hop_query_t{0}),
+                      thrust::make_counting_iterator(static_cast<k_hop_query_t>(n_queries + 1)),
+                      query_offsets.begin());
+
+  // the number of pairs of each query kept by the lower ranks
+  rmm::device_uvector<size_t> lower_rank_counts(n_queries, handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), lower_rank_counts.begin(), lower_rank_counts.end(), size_t{0});
+  if constexpr (multi_gpu) {
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    rmm::device_uvector<size_t> counts(n_queries, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      query_offsets.begin() + 1,
+                      query_offsets.end(),
+                      query_offsets.begin(),
+                      counts.begin(),
+                      thrust::minus<size_t>());
+    rmm::device_uvector<size_t> rx_counts(n_queries * comm_size, handle.get_stream());
+    std::vector<size_t> rx_sizes(comm_size, n_queries);
+    std::vector<size_t> rx_displs(comm_size);
+    std::exclusive_scan(rx_sizes.begin(), rx_sizes.end(), rx_displs.begin(), size_t{0});
+    device_allgatherv(comm,
+                      counts.begin(),
+                      rx_counts.begin(),
+                      rx_sizes,
+                      rx_displs,
+                      handle.get_stream());
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(n_queries),
+                     [rx_counts         = rx_counts.data(),
+                      lower_rank_counts = lower_rank_counts.data(),
+                      n_queries,
+                      comm_rank] __device__(auto i) {
+                       size_t count{0};
+                       for (int r = 0; r < comm_rank; ++r) {
+                         count += rx_counts[r * n_queries + i];
+                       }
+                       lower_rank_counts[i] = count;
+                     });
+  }
+
+  rmm::device_uvector<bool> over_limit_flags(vertices.size(), handle.get_stream());
+  thrust::tabulate(handle.get_thrust_policy(),
+                   over_limit_flags.begin(),
+                   over_limit_flags.end(),
+                   [queries           = queries.data(),
+                    query_offsets     = query_offsets.data(),
+                    lower_rank_counts = lower_rank_counts.data(),
+                    hop_limit] __device__(size_t i) {
+                     auto q = queries[i];
+                     return lower_rank_counts[q] + (i - query_offsets[q]) >= hop_limit;
+                   });
+  vertices.resize(thrust::distance(pair_first,
+                                   thrust::remove_if(handle.get_thrust_policy(),
+                                                     pair_first,
+                                                     pair_first + vertices.size(),
+                                                     over_limit_flags.begin(),
+                                                     thrust::identity<bool>())),
+                  handle.get_stream());
+  queries.resize(vertices.size(), handle.get_stream());
+
+  // back to the (vertex, query) order of the frontier
+
+  auto key_first = thrust::make_zip_iterator(thrust::make_tuple(vertices.begin(), queries.begin()));
+  thrust::sort(handle.get_thrust_policy(), key_first, key_first + vertices.size());
+}
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>>
+k_hop_nbrs(raft::handle_t const& handle,
+           GraphViewType const& push_graph_view,
+           typename GraphViewType::vertex_type const* seeds,
+           size_t const* seed_query_indices,
+           size_t n_seeds,
+           size_t n_queries,
+           size_t k,
+           std::optional<std::vector<size_t>> const& hop_limits,
+           bool do_expensive_check)
+{
+  scoped_phase_t phase("k_hop_nbrs", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((n_seeds == 0) || ((seeds != nullptr) && (seed_query_indices != nullptr)),
+                  "Invalid input argument: seeds and seed_query_indices cannot be null.");
+  CUGRAPH_EXPECTS(n_queries < static_cast<size_t>(std::numeric_limits<k_hop_query_t>::max()),
+                  "Invalid input argument: n_queries is too large.");
+  CUGRAPH_EXPECTS(!hop_limits || ((*hop_limits).size() == k),
+                  "Invalid input argument: hop_limits should have k elements.");
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(
+      count_if_v(handle,
+                 push_graph_view,
+                 seeds,
+                 seeds + n_seeds,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 }) == 0,
+      "Invalid input argument: seeds have invalid vertex IDs.");
+    auto num_invalid_query_indices = thrust::count_if(
+      handle.get_thrust_policy(),
+      seed_query_indices,
+      seed_query_indices + n_seeds,
+      [n_queries] __device__(auto q) { return q >= n_queries; });
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_query_indices = host_scalar_allreduce(handle.get_comms(),
+                                                        num_invalid_query_indices,
+                                                        raft::comms::op_t::SUM,
+                                                        handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_query_indices == 0,
+                    "Invalid input argument: seed_query_indices should be in [0, n_queries).");
+  }
+
+  // 2. initialize the reached (vertex, query) pairs (sorted) with the seeds
+
+  rmm::device_uvector<vertex_t> reached_vertices(n_seeds, handle.get_stream());
+  rmm::device_uvector<k_hop_query_t> reached_queries(n_seeds, handle.get_stream());
+  rmm::device_uvector<vertex_t> reached_hops(0, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), seeds, seeds + n_seeds, reached_vertices.begin());
+  thrust::transform(handle.get_thrust_policy(),
+                    seed_query_indices,
+                    seed_query_indices + n_seeds,
+                    reached_queries.begin(),
+                    [] __device__(auto q) { return static_cast<k_hop_query_t>(q); });
+  {
+    auto key_first = thrust::make_zip_iterator(
+      thrust::make_tuple(reached_vertices.begin(), reached_queries.begin()));
+    thrust::sort(handle.get_thrust_policy(), key_first, key_first + reached_vertices.size());
+    reached_vertices.resize(
+      thrust::distance(key_first,
+                       thrust::unique(handle.get_thrust_policy(),
+                                      key_first,
+                                      key_first + reached_vertices.size())),
+      handle.get_stream());
+    reached_queries.resize(reached_vertices.size(), handle.get_stream());
+    reached_hops.resize(reached_vertices.size(), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), reached_hops.begin(), reached_hops.end(), vertex_t{0});
+  }
+
+  // 3. initialize the frontier
+
+  enum class Bucket { cur, next, num_buckets };
+  VertexFrontier<vertex_t,
+                 k_hop_query_t,
+                 GraphViewType::is_multi_gpu,
+                 static_cast<size_t>(Bucket::num_buckets)>
+    vertex_frontier(handle);
+
+  vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+    .insert(thrust::make_zip_iterator(
+              thrust::make_tuple(reached_vertices.begin(), reached_queries.begin())),
+            thrust::make_zip_iterator(
+              thrust::make_tuple(reached_vertices.end(), reached_queries.end())));
+
+  // 4. expand the frontier k times, the cost of a hop is proportional to the frontier's out-edges
+  // and the (vertex, query) pairs reached so far
+
+  for (size_t hop = 1; hop <= k; ++hop) {
+    if (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() == 0) {
+      break;
+    }
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration", static_cast<int64_t>(hop));
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      dummy_properties_t<vertex_t>{}.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      [] __device__(auto tagged_src, vertex_t, auto, auto) {
+        return thrust::optional<k_hop_query_t>{thrust::get<1>(tagged_src)};
+      },
+      reduce_op::null(),
+      thrust::make_constant_iterator(0) /* dummy */,
+      thrust::make_discard_iterator() /* dummy */,
+      k_hop_push_v_op_t{static_cast<size_t>(Bucket::next)});
+
+    // drop the pairs reached in the earlier hops
+
+    auto& next_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next));
+    rmm::device_uvector<vertex_t> new_vertices(next_bucket.size(), handle.get_stream());
+    rmm::device_uvector<k_hop_query_t> new_queries(new_vertices.size(), handle.get_stream());
+    auto reached_key_first = thrust::make_zip_iterator(
+      thrust::make_tuple(reached_vertices.begin(), reached_queries.begin()));
+    auto new_key_first =
+      thrust::make_zip_iterator(thrust::make_tuple(new_vertices.begin(), new_queries.begin()));
+    new_vertices.resize(thrust::distance(new_key_first,
+                                         thrust::set_difference(handle.get_thrust_policy(),
+                                                                next_bucket.begin(),
+                                                                next_bucket.end(),
+                                                                reached_key_first,
+                                                                reached_key_first +
+                                                                  reached_vertices.size(),
+                                                                new_key_first)),
+                        handle.get_stream());
+    new_queries.resize(new_vertices.size(), handle.get_stream());
+    next_bucket.clear();
+    next_bucket.shrink_to_fit();
+
+    if (hop_limits) {
+      limit_k_hop_nbrs<vertex_t, GraphViewType::is_multi_gpu>(
+        handle, new_vertices, new_queries, n_queries, (*hop_limits)[hop - 1]);
+    }
+
+    // add the new pairs to the reached pairs and to the next frontier
+
+    rmm::device_uvector<vertex_t> merged_vertices(reached_vertices.size() + new_vertices.size(),
+                                                  handle.get_stream());
+    rmm::device_uvector<k_hop_query_t> merged_queries(merged_vertices.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> merged_hops(merged_vertices.size(), handle.get_stream());
+    thrust::merge_by_key(
+      handle.get_thrust_policy(),
+      reached_key_first,
+      reached_key_first + reached_vertices.size(),
+      thrust::make_zip_iterator(thrust::make_tuple(new_vertices.begin(), new_queries.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(new_vertices.end(), new_queries.end())),
+      reached_hops.begin(),
+      thrust::make_constant_iterator(static_cast<vertex_t>(hop)),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(merged_vertices.begin(), merged_queries.begin())),
+      merged_hops.begin());
+    reached_vertices = std::move(merged_vertices);
+    reached_queries  = std::move(merged_queries);
+    reached_hops     = std::move(merged_hops);
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+      .insert(
+        thrust::make_zip_iterator(thrust::make_tuple(new_vertices.begin(), new_queries.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(new_vertices.end(), new_queries.end())));
+  }
+
+  // 5. group the reached vertices by query
+
+  {
+    auto triplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(reached_queries.begin(), reached_vertices.begin(), reached_hops.begin()));
+    thrust::sort(handle.get_thrust_policy(), triplet_first, triplet_first + reached_queries.size());
+  }
+  rmm::device_uvector<size_t> query_offsets(n_queries + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      reached_queries.begin(),
+                      reached_queries.end(),
+                      thrust::make_counting_iterator(k_hop_query_t{0}),
+                      thrust::make_counting_iterator(static_cast<k_hop_query_t>(n_queries + 1)),
+                      query_offsets.begin());
+
+  return std::make_tuple(
+    std::move(query_offsets), std::move(reached_vertices), std::move(reached_hops));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>>
+k_hop_nbrs(raft::handle_t const& handle,
+           graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+           vertex_t const* seeds,
+           size_t const* seed_query_indices,
+           size_t n_seeds,
+           size_t n_queries,
+           size_t k,
+           std::optional<std::vector<size_t>> const& hop_limits,
+           bool do_expensive_check)
+{
+  return detail::k_hop_nbrs(handle,
+                            graph_view,
+                            seeds,
+                            seed_query_indices,
+                            n_seeds,
+                            n_queries,
+                            k,
+                            hop_limits,
+                            do_expensive_check);
+}
+
+}  // namespace cugraph
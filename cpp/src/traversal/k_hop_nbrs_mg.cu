@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <traversal/k_hop_nbrs_impl.cuh>
+
+namespace cugraph {
+
+// MG instantiation
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  k_hop_nbrs(raft::handle_t const& handle,
+             graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+             int32_t const* seeds,
+             size_t const* seed_query_indices,
+             size_t n_seeds,
+             size_t n_queries,
+             size_t k,
+             std::optional<std::vector<size_t>> const& hop_limits,
+             bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  k_hop_nbrs(raft::handle_t const& handle,
+             graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+             int32_t const* seeds,
+             size_t const* seed_query_indices,
+             size_t n_seeds,
+             size_t n_queries,
+             size_t k,
+             std::optional<std::vector<size_t>> const& hop_limits,
+             bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  k_hop_nbrs(raft::handle_t const& handle,
+             graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+             int32_t const* seeds,
+             size_t const* seed_query_indices,
+             size_t n_seeds,
+             size_t n_queries,
+             size_t k,
+             std::optional<std::vector<size_t>> const& hop_limits,
+             bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  k_hop_nbrs(raft::handle_t const& handle,
+             graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+             int32_t const* seeds,
+             size_t const* seed_query_indices,
+             size_t n_seeds,
+             size_t n_queries,
+             size_t k,
+             std::optional<std::vector<size_t>> const& hop_limits,
+             bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+  k_hop_nbrs(raft::handle_t const& handle,
+             graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+             int64_t const* seeds,
+             size_t const* seed_query_indices,
+             size_t n_seeds,
+             size_t n_queries,
+             size_t k,
+             std::optional<std::vector<size_t>> const& hop_limits,
+             bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+  k_hop_nbrs(raft::handle_t const& handle,
+             graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+             int64_t const* seeds,
+             size_t const* seed_query_indices,
+             size_t n_seeds,
+             size_t n_queries,
+             size_t k,
+             std::optional<std::vector<size_t>> const& hop_limits,
+             bool do_expensive_check);
+#endif
+
+}  // namespace cugraph
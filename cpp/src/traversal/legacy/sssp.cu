@@ -17,6 +17,7 @@
 // Author: Prasun Gera pgera@nvidia.com
 
 #include <algorithm>
+#include <type_traits>
 #include <cugraph/utilities/error.hpp>
 #include <rmm/device_vector.hpp>
 
@@ -47,14 +48,14 @@ void SSSP<IndexType, DistType>::setup()
   isolated_bmap.resize(vertices_bmap_size);
 
   // Allocate buffer for data that need to be reset every iteration
-  iter_buffer_size = sizeof(int) * (edges_bmap_size + vertices_bmap_size) + sizeof(IndexType);
+  iter_buffer_size = sizeof(IndexType) + sizeof(int) * (edges_bmap_size + vertices_bmap_size);
   iter_buffer.resize(iter_buffer_size, stream);
+  // num vertices in the next frontier (first, to be aligned for 64 bit IndexType)
+  d_new_frontier_cnt = static_cast<IndexType*>(iter_buffer.data());
   // ith bit of relaxed_edges_bmap <=> ith edge was relaxed
-  relaxed_edges_bmap = static_cast<int*>(iter_buffer.data());
+  relaxed_edges_bmap = reinterpret_cast<int*>(d_new_frontier_cnt + 1);
   // ith bit of next_frontier_bmap <=> vertex is active in the next frontier
-  next_frontier_bmap = static_cast<int*>(iter_buffer.data()) + edges_bmap_size;
-  // num vertices in the next frontier
-  d_new_frontier_cnt = next_frontier_bmap + vertices_bmap_size;
+  next_frontier_bmap = relaxed_edges_bmap + edges_bmap_size;
 
   // vertices_degree[i] = degree of vertex i
   vertex_degree.resize(n);
@@ -250,13 +251,15 @@ void sssp(legacy::GraphCSRView<VT, ET, WT> const& graph,
 {
   CUGRAPH_EXPECTS(distances || predecessors, "Invalid input argument, both outputs are nullptr");
 
-  if (typeid(VT) != typeid(int)) CUGRAPH_FAIL("Unsupported vertex id data type, please use int");
-  if (typeid(ET) != typeid(int)) CUGRAPH_FAIL("Unsupported edge id data type, please use int");
-  if (typeid(WT) != typeid(float) && typeid(WT) != typeid(double))
-    CUGRAPH_FAIL("Unsupported weight data type, please use float or double");
+  static_assert(std::is_integral<VT>::value && sizeof(VT) >= sizeof(int32_t),
+                "Unsupported vertex id data type. Use integral types of size >= sizeof(int32_t)");
+  static_assert(std::is_same<VT, ET>::value,
+                "VT and ET should be the same type for the current SSSP implementation");
+  static_assert(std::is_floating_point<WT>::value,
+                "Unsupported edge weight type. Use floating point types");
 
-  int num_vertices = graph.number_of_vertices;
-  int num_edges    = graph.number_of_edges;
+  VT num_vertices = graph.number_of_vertices;
+  ET num_edges    = graph.number_of_edges;
 
   const ET* offsets_ptr      = graph.offsets;
   const VT* indices_ptr      = graph.indices;
@@ -302,5 +305,15 @@ template void sssp<int, int, double>(legacy::GraphCSRView<int, int, double> cons
                                      double* distances,
                                      int* predecessors,
                                      const int source_vertex);
+template void sssp<int64_t, int64_t, float>(
+  legacy::GraphCSRView<int64_t, int64_t, float> const& graph,
+  float* distances,
+  int64_t* predecessors,
+  const int64_t source_vertex);
+template void sssp<int64_t, int64_t, double>(
+  legacy::GraphCSRView<int64_t, int64_t, double> const& graph,
+  double* distances,
+  int64_t* predecessors,
+  const int64_t source_vertex);
 
 }  // namespace cugraph
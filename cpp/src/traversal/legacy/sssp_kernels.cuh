@@ -243,7 +243,7 @@ __global__ void populate_frontier_and_preds(
           // for this thread, thread_new_frontier_offset + has_successor
           // (exclusive sum)
           if (inclusive_sum)
-            frontier_common_block_offset = atomicAdd(new_frontier_cnt, inclusive_sum);
+            frontier_common_block_offset = traversal::atomicAdd(new_frontier_cnt, inclusive_sum);
         }
 
         // Broadcasting frontier_common_block_offset
@@ -186,7 +186,8 @@ struct BitwiseOr {
 template <typename ValueType, typename SizeType>
 __global__ void fill_vec_kernel(ValueType* vec, SizeType n, ValueType val)
 {
-  for (SizeType idx = blockIdx.x * blockDim.x + threadIdx.x; idx < n; idx += blockDim.x * gridDim.x)
+  for (SizeType idx = static_cast<SizeType>(blockIdx.x) * blockDim.x + threadIdx.x; idx < n;
+       idx += static_cast<SizeType>(blockDim.x) * gridDim.x)
     vec[idx] = val;
 }
 
@@ -195,7 +196,7 @@ void fill_vec(ValueType* vec, SizeType n, ValueType val, cudaStream_t stream)
 {
   dim3 grid, block;
   block.x = 256;
-  grid.x  = (n + block.x - 1) / block.x;
+  grid.x  = min((n + block.x - 1) / block.x, (SizeType)MAXBLOCKS);
 
   fill_vec_kernel<<<grid, block, 0, stream>>>(vec, n, val);
   CHECK_CUDA(stream);
@@ -295,9 +296,11 @@ __global__ void flag_isolated_vertices_kernel(IndexType n,
 
   __shared__ IndexType row_ptr_tail[FLAG_ISOLATED_VERTICES_DIMX];
 
-  for (IndexType block_off = FLAG_ISOLATED_VERTICES_VERTICES_PER_THREAD * (blockDim.x * blockIdx.x);
+  for (IndexType block_off = FLAG_ISOLATED_VERTICES_VERTICES_PER_THREAD *
+                             (static_cast<IndexType>(blockDim.x) * blockIdx.x);
        block_off < n;
-       block_off += FLAG_ISOLATED_VERTICES_VERTICES_PER_THREAD * (blockDim.x * gridDim.x)) {
+       block_off += FLAG_ISOLATED_VERTICES_VERTICES_PER_THREAD *
+                    (static_cast<IndexType>(blockDim.x) * gridDim.x)) {
     IndexType thread_off = block_off + FLAG_ISOLATED_VERTICES_VERTICES_PER_THREAD * threadIdx.x;
     IndexType last_node_thread = thread_off + FLAG_ISOLATED_VERTICES_VERTICES_PER_THREAD - 1;
 
@@ -388,8 +391,8 @@ __global__ void set_frontier_degree_kernel(IndexType* frontier_degree,
                                            const IndexType* degree,
                                            IndexType n)
 {
-  for (IndexType idx = blockDim.x * blockIdx.x + threadIdx.x; idx < n;
-       idx += gridDim.x * blockDim.x) {
+  for (IndexType idx = static_cast<IndexType>(blockDim.x) * blockIdx.x + threadIdx.x; idx < n;
+       idx += static_cast<IndexType>(gridDim.x) * blockDim.x) {
     IndexType u          = frontier[idx];
     frontier_degree[idx] = degree[u];
   }
@@ -444,8 +447,8 @@ __global__ void compute_bucket_offsets_kernel(const IndexType* frontier_degrees_
   IndexType end =
     ((total_degree - 1 + TOP_DOWN_EXPAND_DIMX) / TOP_DOWN_EXPAND_DIMX * NBUCKETS_PER_BLOCK + 1);
 
-  for (IndexType bid = blockIdx.x * blockDim.x + threadIdx.x; bid <= end;
-       bid += gridDim.x * blockDim.x) {
+  for (IndexType bid = static_cast<IndexType>(blockIdx.x) * blockDim.x + threadIdx.x; bid <= end;
+       bid += static_cast<IndexType>(gridDim.x) * blockDim.x) {
     IndexType eid = min(bid * TOP_DOWN_BUCKET_SIZE, total_degree - 1);
 
     bucket_offsets[bid] =
@@ -0,0 +1,621 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <link_analysis/batch_utils.cuh>
+#include <traversal/sssp_impl.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// the tentative distances (the first batch_width elements) and the predecessors (the last
+// batch_width elements) of the batch_width lanes (sources)
+template <typename vertex_t, typename weight_t>
+using sssp_batch_value_t = thrust::
+  tuple<weight_t, weight_t, weight_t, weight_t, vertex_t, vertex_t, vertex_t, vertex_t>;
+
+// reduces the pushed (distance, predecessor) pairs of each lane to the pair with the minimum
+// distance (ties are broken by the predecessor ID as in sssp)
+template <typename vertex_t, typename weight_t>
+struct sssp_batch_min_t {
+  using type = sssp_batch_value_t<vertex_t, weight_t>;
+
+  static constexpr bool pure_function = true;  // this can be called in any process
+
+  template <size_t c>
+  __host__ __device__ void reduce_lane(type& lhs, type const& rhs) const
+  {
+    if ((thrust::get<c>(rhs) < thrust::get<c>(lhs)) ||
+        ((thrust::get<c>(rhs) == thrust::get<c>(lhs)) &&
+         (thrust::get<batch_width + c>(rhs) < thrust::get<batch_width + c>(lhs)))) {
+      thrust::get<c>(lhs)               = thrust::get<c>(rhs);
+      thrust::get<batch_width + c>(lhs) = thrust::get<batch_width + c>(rhs);
+    }
+  }
+
+  __host__ __device__ type operator()(type const& lhs, type const& rhs) const
+  {
+    static_assert(batch_width == 4);
+    auto ret = lhs;
+    reduce_lane<0>(ret, rhs);
+    reduce_lane<1>(ret, rhs);
+    reduce_lane<2>(ret, rhs);
+    reduce_lane<3>(ret, rhs);
+    return ret;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+struct relax_lanes_e_op_t {
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition;
+  weight_t const* lane_distances[batch_width];
+  weight_t cutoff{std::numeric_limits<weight_t>::max()};
+
+  template <size_t c>
+  __device__ bool relax_lane(sssp_batch_value_t<vertex_t, weight_t>& pushed,
+                             vertex_t src,
+                             thrust::optional<vertex_t> dst_offset,
+                             weight_t w,
+                             batch_value_t<weight_t> const& src_distances) const
+  {
+    auto constexpr invalid_distance = std::numeric_limits<weight_t>::max();
+    auto constexpr invalid_vertex   = invalid_vertex_id<vertex_t>::value;
+
+    auto src_distance = thrust::get<c>(src_distances);
+    auto new_distance = src_distance + w;
+    auto threshold    = cutoff;
+    if (dst_offset) {
+      auto old_distance = lane_distances[c][*dst_offset];
+      threshold         = old_distance < threshold ? old_distance : threshold;
+    }
+    auto relaxed = (src_distance != invalid_distance) && (new_distance < threshold);
+    thrust::get<c>(pushed)               = relaxed ? new_distance : invalid_distance;
+    thrust::get<batch_width + c>(pushed) = relaxed ? src : invalid_vertex;
+    return relaxed;
+  }
+
+  template <typename DstValue>
+  __device__ thrust::optional<sssp_batch_value_t<vertex_t, weight_t>> operator()(
+    vertex_t src, vertex_t dst, weight_t w, batch_value_t<weight_t> src_distances, DstValue) const
+  {
+    static_assert(batch_width == 4);
+    thrust::optional<vertex_t> dst_offset{thrust::nullopt};
+    if (vertex_partition.is_local_vertex_nocheck(dst)) {
+      dst_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(dst);
+    }
+    sssp_batch_value_t<vertex_t, weight_t> pushed{};
+    auto relaxed = relax_lane<0>(pushed, src, dst_offset, w, src_distances);
+    relaxed      = relax_lane<1>(pushed, src, dst_offset, w, src_distances) || relaxed;
+    relaxed      = relax_lane<2>(pushed, src, dst_offset, w, src_distances) || relaxed;
+    relaxed      = relax_lane<3>(pushed, src, dst_offset, w, src_distances) || relaxed;
+    return relaxed ? thrust::optional<sssp_batch_value_t<vertex_t, weight_t>>{pushed}
+                   : thrust::nullopt;
+  }
+};
+
+// the distances & predecessors of the lanes followed by the minimum tentative distance of the lanes
+// not relaxed yet from the vertex (invalid if every lane's distance is relaxed)
+template <typename vertex_t, typename weight_t>
+using sssp_batch_vertex_value_t = thrust::tuple<weight_t,
+                                                weight_t,
+                                                weight_t,
+                                                weight_t,
+                                                vertex_t,
+                                                vertex_t,
+                                                vertex_t,
+                                                vertex_t,
+                                                weight_t>;
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct update_lanes_v_op_t {
+  weight_t base{0.0};
+  weight_t delta{1.0};
+
+  template <size_t c>
+  __device__ bool update_lane(sssp_batch_vertex_value_t<vertex_t, weight_t>& value,
+                              sssp_batch_value_t<vertex_t, weight_t> const& pushed) const
+  {
+    if (thrust::get<c>(pushed) < thrust::get<c>(value)) {
+      thrust::get<c>(value)               = thrust::get<c>(pushed);
+      thrust::get<batch_width + c>(value) = thrust::get<batch_width + c>(pushed);
+      thrust::get<2 * batch_width>(value) =
+        thrust::get<c>(pushed) < thrust::get<2 * batch_width>(value)
+          ? thrust::get<c>(pushed)
+          : thrust::get<2 * batch_width>(value);
+      return true;
+    }
+    return false;
+  }
+
+  __device__ thrust::optional<thrust::tuple<size_t, sssp_batch_vertex_value_t<vertex_t, weight_t>>>
+  operator()(vertex_t,
+             sssp_batch_vertex_value_t<vertex_t, weight_t> value,
+             sssp_batch_value_t<vertex_t, weight_t> pushed) const
+  {
+    static_assert(batch_width == 4);
+    auto updated = update_lane<0>(value, pushed);
+    updated      = update_lane<1>(value, pushed) || updated;
+    updated      = update_lane<2>(value, pushed) || updated;
+    updated      = update_lane<3>(value, pushed) || updated;
+    if (!updated) { return thrust::nullopt; }
+    auto pending_distance = thrust::get<2 * batch_width>(value);
+    auto bucket_offset =
+      pending_distance > base ? (pending_distance - base) / delta : weight_t{0.0};
+    auto idx = bucket_offset < static_cast<weight_t>(sssp_num_delta_buckets)
+                 ? static_cast<size_t>(bucket_offset)
+                 : sssp_num_delta_buckets /* far bucket */;
+    return thrust::make_tuple(idx, value);
+  }
+};
+
+// delta-stepping (as in sssp) for up to batch_width sources at once. Every vertex keeps the
+// tentative distances & predecessors of every source (lane) and a single (untagged) frontier holds
+// the vertices with a lane not relaxed yet, a vertex is placed in the bucket of the minimum
+// tentative distance of its lanes not relaxed yet (pending distance). Once every vertex in the
+// frontier has pending distances no shorter than the current bucket's lower bound, the distances
+// shorter than the lower bound are final (the edge weights are non-negative); the search stops
+// early when every (target, lane) pair is final.
+template <typename GraphViewType>
+void sssp_lanes(raft::handle_t const& handle,
+                GraphViewType const& push_graph_view,
+                std::vector<typename GraphViewType::vertex_type> const& h_lane_sources,
+                typename GraphViewType::weight_type* const* lane_distances,
+                typename GraphViewType::vertex_type* const* lane_predecessors,
+                typename GraphViewType::vertex_type const* targets,
+                size_t n_targets,
+                typename GraphViewType::weight_type delta,
+                typename GraphViewType::weight_type cutoff)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto constexpr invalid_distance = std::numeric_limits<weight_t>::max();
+
+  auto const num_lanes = h_lane_sources.size();
+  auto const ld        = static_cast<size_t>(push_graph_view.get_number_of_local_vertices());
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+
+  // 1. initialize the source distances and the pending distances
+
+  rmm::device_uvector<weight_t> pending_distances(ld, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               pending_distances.begin(),
+               pending_distances.end(),
+               invalid_distance);
+
+  rmm::device_uvector<vertex_t> lane_sources(num_lanes, handle.get_stream());
+  raft::update_device(
+    lane_sources.data(), h_lane_sources.data(), h_lane_sources.size(), handle.get_stream());
+  static_assert(batch_width == 4);
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(num_lanes),
+                   [vertex_partition,
+                    lane_sources      = lane_sources.data(),
+                    d0                = lane_distances[0],
+                    d1                = lane_distances[1],
+                    d2                = lane_distances[2],
+                    d3                = lane_distances[3],
+                    pending_distances = pending_distances.data()] __device__(auto c) {
+                     auto s = lane_sources[c];
+                     if (vertex_partition.is_local_vertex_nocheck(s)) {
+                       auto s_offset =
+                         vertex_partition.get_local_vertex_offset_from_vertex_nocheck(s);
+                       auto d = c == 0 ? d0 : (c == 1 ? d1 : (c == 2 ? d2 : d3));
+                       d[s_offset]                 = weight_t{0.0};
+                       pending_distances[s_offset] = weight_t{0.0};
+                     }
+                   });
+
+  // 2. initialize the frontier
+
+  size_t constexpr num_delta_buckets = sssp_num_delta_buckets;
+  size_t constexpr far_bucket_idx    = num_delta_buckets;
+  size_t constexpr cur_bucket_idx    = num_delta_buckets + 1;
+  VertexFrontier<vertex_t, void, GraphViewType::is_multi_gpu, num_delta_buckets + 2>
+    vertex_frontier(handle,
+                    push_graph_view.get_local_vertex_first(),
+                    push_graph_view.get_local_vertex_last());
+
+  std::vector<size_t> next_bucket_indices(num_delta_buckets + 1);  // delta buckets + far bucket
+  std::iota(next_bucket_indices.begin(), next_bucket_indices.end(), size_t{0});
+  std::vector<size_t> delta_bucket_indices(num_delta_buckets);
+  std::iota(delta_bucket_indices.begin(), delta_bucket_indices.end(), size_t{0});
+
+  {
+    rmm::device_uvector<vertex_t> frontier_vertices(ld, handle.get_stream());
+    frontier_vertices.resize(
+      thrust::distance(
+        frontier_vertices.begin(),
+        thrust::copy_if(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+                        thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                        pending_distances.begin(),
+                        frontier_vertices.begin(),
+                        [] __device__(auto d) { return d == weight_t{0.0}; })),
+      handle.get_stream());
+    vertex_frontier.get_bucket(size_t{0}).insert(frontier_vertices.begin(),
+                                                 frontier_vertices.end());
+  }
+
+  // 3. delta-stepping iteration
+
+  auto lane_distance_first = thrust::make_zip_iterator(thrust::make_tuple(
+    lane_distances[0], lane_distances[1], lane_distances[2], lane_distances[3]));
+  auto vertex_value_first  = thrust::make_zip_iterator(thrust::make_tuple(lane_distances[0],
+                                                                         lane_distances[1],
+                                                                         lane_distances[2],
+                                                                         lane_distances[3],
+                                                                         lane_predecessors[0],
+                                                                         lane_predecessors[1],
+                                                                         lane_predecessors[2],
+                                                                         lane_predecessors[3],
+                                                                         pending_distances.data()));
+
+  row_properties_t<GraphViewType, batch_value_t<weight_t>> adj_matrix_row_distances(
+    handle, push_graph_view);
+
+  relax_lanes_e_op_t<vertex_t, weight_t, GraphViewType::is_multi_gpu> e_op{vertex_partition};
+  for (size_t c = 0; c < batch_width; ++c) {
+    e_op.lane_distances[c] = lane_distances[c];
+  }
+  e_op.cutoff = cutoff;
+
+  // returns true if the lanes' distances to every target are no longer than bound (and are final)
+  auto targets_settled = [&](weight_t bound) {
+    auto num_unsettled = thrust::count_if(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(n_targets * num_lanes),
+      [vertex_partition,
+       targets,
+       n_targets,
+       d0 = lane_distances[0],
+       d1 = lane_distances[1],
+       d2 = lane_distances[2],
+       d3 = lane_distances[3],
+       bound] __device__(auto i) {
+        auto c        = i / n_targets;
+        auto t_offset = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(
+          targets[i % n_targets]);
+        auto d = c == 0 ? d0 : (c == 1 ? d1 : (c == 2 ? d2 : d3));
+        return d[t_offset] > bound;
+      });
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_unsettled = host_scalar_allreduce(
+        handle.get_comms(), num_unsettled, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    return num_unsettled == 0;
+  };
+  bool check_targets{n_targets > 0};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    check_targets = host_scalar_allreduce(handle.get_comms(),
+                                          static_cast<size_t>(n_targets),
+                                          raft::comms::op_t::SUM,
+                                          handle.get_stream()) > 0;
+  }
+
+  weight_t base{0.0};
+  bool done{false};
+  while (!done) {
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration");
+
+    for (size_t i = 0; i < num_delta_buckets; ++i) {
+      // relaxing a light edge may insert vertices back to the bucket being processed
+      while (vertex_frontier.get_bucket(i).aggregate_size() > 0) {
+        if (check_targets && targets_settled(base + static_cast<weight_t>(i) * delta)) {
+          done = true;
+          break;
+        }
+
+        vertex_frontier.swap_buckets(i, cur_bucket_idx);
+        auto& cur_bucket = vertex_frontier.get_bucket(cur_bucket_idx);
+
+        copy_to_adj_matrix_row(handle,
+                               push_graph_view,
+                               cur_bucket.begin(),
+                               cur_bucket.end(),
+                               lane_distance_first,
+                               adj_matrix_row_distances);
+        // every lane is relaxed from the vertices in the current bucket
+        thrust::for_each(handle.get_thrust_policy(),
+                         cur_bucket.begin(),
+                         cur_bucket.end(),
+                         [vertex_partition,
+                          pending_distances = pending_distances.data()] __device__(auto v) {
+                           pending_distances[vertex_partition
+                                               .get_local_vertex_offset_from_vertex_nocheck(v)] =
+                             invalid_distance;
+                         });
+
+        update_frontier_v_push_if_out_nbr(handle,
+                                          push_graph_view,
+                                          vertex_frontier,
+                                          cur_bucket_idx,
+                                          next_bucket_indices,
+                                          adj_matrix_row_distances.device_view(),
+                                          dummy_properties_t<vertex_t>{}.device_view(),
+                                          e_op,
+                                          sssp_batch_min_t<vertex_t, weight_t>{},
+                                          vertex_value_first,
+                                          vertex_value_first,
+                                          update_lanes_v_op_t<vertex_t, weight_t>{base, delta});
+
+        vertex_frontier.get_bucket(cur_bucket_idx).clear();
+        vertex_frontier.get_bucket(cur_bucket_idx).shrink_to_fit();
+      }
+      if (done) { break; }
+    }
+    if (done) { break; }
+
+    // every delta bucket is empty, move the base to the bucket holding the minimum pending distance
+    // in the far bucket and split the far bucket (the vertices relaxed from a delta bucket after
+    // being inserted to the far bucket are dropped)
+
+    auto& far_bucket = vertex_frontier.get_bucket(far_bucket_idx);
+    if (far_bucket.aggregate_size() == 0) { break; }
+
+    auto min_far_distance = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      far_bucket.begin(),
+      far_bucket.end(),
+      [vertex_partition, pending_distances = pending_distances.data()] __device__(auto v) {
+        return pending_distances[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)];
+      },
+      invalid_distance,
+      thrust::minimum<weight_t>());
+    if constexpr (GraphViewType::is_multi_gpu) {
+      min_far_distance = host_scalar_allreduce(
+        handle.get_comms(), min_far_distance, raft::comms::op_t::MIN, handle.get_stream());
+    }
+    if (min_far_distance == invalid_distance) { break; }
+    base = std::max(base + static_cast<weight_t>(num_delta_buckets) * delta,
+                    std::floor(min_far_distance / delta) * delta);
+
+    vertex_frontier.split_bucket(
+      far_bucket_idx,
+      delta_bucket_indices,
+      [vertex_partition, pending_distances = pending_distances.data(), base, delta] __device__(
+        auto v) {
+        auto dist =
+          pending_distances[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)];
+        if (dist == invalid_distance) { return thrust::optional<size_t>{thrust::nullopt}; }
+        auto bucket_offset = dist > base ? (dist - base) / delta : weight_t{0.0};
+        return thrust::optional<size_t>{bucket_offset < static_cast<weight_t>(num_delta_buckets)
+                                          ? static_cast<size_t>(bucket_offset)
+                                          : far_bucket_idx};
+      });
+  }
+}
+
+template <typename GraphViewType>
+void sssp_batch(raft::handle_t const& handle,
+                GraphViewType const& push_graph_view,
+                typename GraphViewType::weight_type* distances,
+                typename GraphViewType::vertex_type* predecessors,
+                typename GraphViewType::vertex_type const* sources,
+                size_t n_sources,
+                typename GraphViewType::vertex_type const* targets,
+                size_t n_targets,
+                typename GraphViewType::weight_type cutoff,
+                bool do_expensive_check)
+{
+  scoped_phase_t phase("sssp_batch", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((n_sources == 0) || (sources != nullptr),
+                  "Invalid input argument: sources cannot be null");
+  CUGRAPH_EXPECTS((n_targets == 0) || (targets != nullptr),
+                  "Invalid input argument: targets cannot be null");
+  CUGRAPH_EXPECTS(push_graph_view.is_weighted(),
+                  "Invalid input argument: an unweighted graph is passed to SSSP, BFS is more "
+                  "efficient for unweighted graphs.");
+
+  weight_t delta{1.0};
+  weight_t min_edge_weight{std::numeric_limits<weight_t>::max()};
+  std::tie(delta, min_edge_weight) = compute_delta_stepping_delta(handle, push_graph_view);
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+  if (do_expensive_check) {
+    auto is_invalid = [vertex_partition] __device__(auto val) {
+      return !(vertex_partition.is_valid_vertex(val) &&
+               vertex_partition.is_local_vertex_nocheck(val));
+    };
+    CUGRAPH_EXPECTS(
+      count_if_v(handle, push_graph_view, sources, sources + n_sources, is_invalid) == 0,
+      "Invalid input argument: sources have invalid vertex IDs.");
+    CUGRAPH_EXPECTS(
+      count_if_v(handle, push_graph_view, targets, targets + n_targets, is_invalid) == 0,
+      "Invalid input argument: targets have invalid vertex IDs.");
+    CUGRAPH_EXPECTS(!(min_edge_weight < weight_t{0.0}),
+                    "Invalid input argument: input graph should have non-negative edge weights.");
+  }
+
+  // 2. collect the sources of every GPU (every GPU traverses from every source)
+
+  std::vector<vertex_t> h_sources{};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm     = handle.get_comms();
+    auto rx_counts = host_scalar_allgather(comm, n_sources, handle.get_stream());
+    std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+    std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+    rmm::device_uvector<vertex_t> aggregate_sources(displacements.back() + rx_counts.back(),
+                                                    handle.get_stream());
+    device_allgatherv(comm,
+                      sources,
+                      aggregate_sources.begin(),
+                      rx_counts,
+                      displacements,
+                      handle.get_stream());
+    h_sources.resize(aggregate_sources.size());
+    raft::update_host(
+      h_sources.data(), aggregate_sources.data(), aggregate_sources.size(), handle.get_stream());
+  } else {
+    h_sources.resize(n_sources);
+    raft::update_host(h_sources.data(), sources, n_sources, handle.get_stream());
+  }
+  handle.get_stream_view().synchronize();
+  CUGRAPH_EXPECTS(h_sources.size() > 0,
+                  "Invalid input argument: input should have at least one source");
+
+  // 3. initialize distances and predecessors
+
+  auto constexpr invalid_distance = std::numeric_limits<weight_t>::max();
+  auto constexpr invalid_vertex   = invalid_vertex_id<vertex_t>::value;
+
+  auto const ld = static_cast<size_t>(push_graph_view.get_number_of_local_vertices());
+  thrust::fill(
+    handle.get_thrust_policy(), distances, distances + ld * h_sources.size(), invalid_distance);
+  if (predecessors != nullptr) {
+    thrust::fill(handle.get_thrust_policy(),
+                 predecessors,
+                 predecessors + ld * h_sources.size(),
+                 invalid_vertex);
+  }
+
+  // the lanes beyond the last source and the predecessors (if not requested) are stored in the
+  // scratch buffers
+  auto num_scratch_distance_lanes =
+    h_sources.size() % batch_width != 0 ? batch_width - h_sources.size() % batch_width : size_t{0};
+  rmm::device_uvector<weight_t> scratch_distances(ld * num_scratch_distance_lanes,
+                                                  handle.get_stream());
+  rmm::device_uvector<vertex_t> scratch_predecessors(
+    predecessors != nullptr ? ld * num_scratch_distance_lanes : ld * batch_width,
+    handle.get_stream());
+
+  // 4. run delta-stepping batch_width sources at a time
+
+  for (size_t i = 0; i < h_sources.size(); i += batch_width) {
+    profiler_add_counter("batches", 1);
+    nvtx_range_t batch_range("batch", static_cast<int64_t>(i / batch_width));
+
+    std::vector<vertex_t> h_lane_sources(
+      h_sources.begin() + i, h_sources.begin() + std::min(i + batch_width, h_sources.size()));
+    weight_t* lane_distances[batch_width];
+    vertex_t* lane_predecessors[batch_width];
+    for (size_t c = 0; c < batch_width; ++c) {
+      auto source_idx = i + c;
+      if (source_idx < h_sources.size()) {
+        lane_distances[c] = distances + source_idx * ld;
+        lane_predecessors[c] = predecessors != nullptr ? predecessors + source_idx * ld
+                                                       : scratch_predecessors.data() + c * ld;
+      } else {
+        auto scratch_idx     = source_idx - h_sources.size();
+        lane_distances[c]    = scratch_distances.data() + scratch_idx * ld;
+        lane_predecessors[c] =
+          scratch_predecessors.data() + (predecessors != nullptr ? scratch_idx : c) * ld;
+      }
+    }
+    if (num_scratch_distance_lanes > 0) {
+      thrust::fill(handle.get_thrust_policy(),
+                   scratch_distances.begin(),
+                   scratch_distances.end(),
+                   invalid_distance);
+    }
+
+    sssp_lanes(handle,
+               push_graph_view,
+               h_lane_sources,
+               lane_distances,
+               lane_predecessors,
+               targets,
+               n_targets,
+               delta,
+               cutoff);
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sssp_batch(raft::handle_t const& handle,
+                graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+                weight_t* distances,
+                vertex_t* predecessors,
+                vertex_t const* sources,
+                size_t n_sources,
+                vertex_t const* targets,
+                size_t n_targets,
+                weight_t cutoff,
+                bool do_expensive_check)
+{
+  detail::sssp_batch(handle,
+                     graph_view,
+                     distances,
+                     predecessors,
+                     sources,
+                     n_sources,
+                     targets,
+                     n_targets,
+                     cutoff,
+                     do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -18,30 +18,83 @@
 #include <cugraph/algorithms.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
-#include <cugraph/prims/count_if_e.cuh>
 #include <cugraph/prims/reduce_op.cuh>
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/prims/transform_reduce_e.cuh>
 #include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
 #include <cugraph/prims/vertex_frontier.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/profiler.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/cudart_utils.h>
 
 #include <thrust/fill.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/optional.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
 
 namespace cugraph {
 namespace detail {
 
+// number of distance buckets (each covering a delta-wide distance range) in delta-stepping,
+// vertices with tentative distances beyond the last bucket are kept in a separate far bucket
+size_t constexpr sssp_num_delta_buckets{16};
+
+// returns the delta (the width of a distance bucket) of delta-stepping (sized to relax about a warp
+// worth of edges per vertex per bucket on average) and the minimum edge weight (to validate the
+// edge weights), both computed with a single pass over the edges
+template <typename GraphViewType>
+std::tuple<typename GraphViewType::weight_type, typename GraphViewType::weight_type>
+compute_delta_stepping_delta(raft::handle_t const& handle, GraphViewType const& push_graph_view)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  weight_t edge_count{0.0};
+  weight_t edge_weight_sum{0.0};
+  weight_t min_edge_weight{std::numeric_limits<weight_t>::max()};
+  thrust::tie(edge_count, edge_weight_sum, min_edge_weight) = transform_multi_reduce_e(
+    handle,
+    push_graph_view,
+    dummy_properties_t<vertex_t>{}.device_view(),
+    dummy_properties_t<vertex_t>{}.device_view(),
+    [] __device__(vertex_t, vertex_t, weight_t w, auto, auto) {
+      return thrust::make_tuple(weight_t{1.0}, w, w);
+    },
+    thrust::make_tuple(weight_t{0.0}, weight_t{0.0}, std::numeric_limits<weight_t>::max()),
+    reduce_op::elementwise<reduce_op::plus<weight_t>,
+                           reduce_op::plus<weight_t>,
+                           reduce_op::min<weight_t>>{});
+
+  weight_t delta{1.0};
+  if (push_graph_view.get_number_of_edges() > 0) {
+    auto average_vertex_degree =
+      edge_count / static_cast<weight_t>(push_graph_view.get_number_of_vertices());
+    auto average_edge_weight =
+      edge_weight_sum / static_cast<weight_t>(push_graph_view.get_number_of_edges());
+    delta =
+      (static_cast<weight_t>(raft::warp_size()) * average_edge_weight) / average_vertex_degree;
+    if (!(delta > weight_t{0.0})) {  // every edge weight is 0
+      delta = weight_t{1.0};
+    }
+  }
+
+  return std::make_tuple(delta, min_edge_weight);
+}
+
 template <typename GraphViewType, typename PredecessorIterator>
 void sssp(raft::handle_t const& handle,
           GraphViewType const& push_graph_view,
@@ -51,6 +104,8 @@ void sssp(raft::handle_t const& handle,
           typename GraphViewType::weight_type cutoff,
           bool do_expensive_check)
 {
+  scoped_phase_t phase("sssp", handle.get_stream_view());
+
   using vertex_t = typename GraphViewType::vertex_type;
   using weight_t = typename GraphViewType::weight_type;
 
@@ -63,9 +118,11 @@ void sssp(raft::handle_t const& handle,
   auto const num_edges    = push_graph_view.get_number_of_edges();
   if (num_vertices == 0) { return; }
 
-  // implements the Near-Far Pile method in
-  // A. Davidson, S. Baxter, M. Garland, and J. D. Owens, "Work-efficient parallel GPU methods for
-  // single-source shortest paths," 2014.
+  // implements the delta-stepping method in
+  // U. Meyer and P. Sanders, "Delta-stepping: a parallelizable shortest path algorithm," 2003.
+  // with multiple distance buckets (the Near-Far Pile method in A. Davidson, S. Baxter, M. Garland,
+  // and J. D. Owens, "Work-efficient parallel GPU methods for single-source shortest paths," 2014
+  // is a special case with a single near bucket)
 
   // 1. check input arguments
 
@@ -75,14 +132,15 @@ void sssp(raft::handle_t const& handle,
                   "Invalid input argument: an unweighted graph is passed to SSSP, BFS is more "
                   "efficient for unweighted graphs.");
 
+  // delta and the minimum edge weight (to validate the edge weights) are computed with a single
+  // pass over the edges
+
+  weight_t delta{1.0};
+  weight_t min_edge_weight{std::numeric_limits<weight_t>::max()};
+  std::tie(delta, min_edge_weight) = compute_delta_stepping_delta(handle, push_graph_view);
+
   if (do_expensive_check) {
-    auto num_negative_edge_weights =
-      count_if_e(handle,
-                 push_graph_view,
-                 dummy_properties_t<vertex_t>{}.device_view(),
-                 dummy_properties_t<vertex_t>{}.device_view(),
-                 [] __device__(vertex_t, vertex_t, weight_t w, auto, auto) { return w < 0.0; });
-    CUGRAPH_EXPECTS(num_negative_edge_weights == 0,
+    CUGRAPH_EXPECTS(!(min_edge_weight < weight_t{0.0}),
                     "Invalid input argument: input graph should have non-negative edge weights.");
   }
 
@@ -104,34 +162,25 @@ void sssp(raft::handle_t const& handle,
 
   if (num_edges == 0) { return; }
 
-  // 3. update delta
+  // 3. initialize SSSP frontier
 
-  weight_t average_vertex_degree{0.0};
-  weight_t average_edge_weight{0.0};
-  thrust::tie(average_vertex_degree, average_edge_weight) = transform_reduce_e(
-    handle,
-    push_graph_view,
-    dummy_properties_t<vertex_t>{}.device_view(),
-    dummy_properties_t<vertex_t>{}.device_view(),
-    [] __device__(vertex_t, vertex_t, weight_t w, auto, auto) {
-      return thrust::make_tuple(weight_t{1.0}, w);
-    },
-    thrust::make_tuple(weight_t{0.0}, weight_t{0.0}));
-  average_vertex_degree /= static_cast<weight_t>(num_vertices);
-  average_edge_weight /= static_cast<weight_t>(num_edges);
-  auto delta =
-    (static_cast<weight_t>(raft::warp_size()) * average_edge_weight) / average_vertex_degree;
-
-  // 4. initialize SSSP frontier
+  // bucket i in [0, sssp_num_delta_buckets) holds the vertices with tentative distances in [base +
+  // i * delta, base + (i + 1) * delta), the far bucket holds the vertices with larger tentative
+  // distances, and the cur bucket holds the vertices being relaxed.
+  size_t constexpr num_delta_buckets = sssp_num_delta_buckets;
+  size_t constexpr far_bucket_idx    = num_delta_buckets;
+  size_t constexpr cur_bucket_idx    = num_delta_buckets + 1;
+  VertexFrontier<vertex_t, void, GraphViewType::is_multi_gpu, num_delta_buckets + 2>
+    vertex_frontier(handle,
+                    push_graph_view.get_local_vertex_first(),
+                    push_graph_view.get_local_vertex_last());
 
-  enum class Bucket { cur_near, next_near, far, num_buckets };
-  VertexFrontier<vertex_t,
-                 void,
-                 GraphViewType::is_multi_gpu,
-                 static_cast<size_t>(Bucket::num_buckets)>
-    vertex_frontier(handle);
+  std::vector<size_t> next_bucket_indices(num_delta_buckets + 1);  // delta buckets + far bucket
+  std::iota(next_bucket_indices.begin(), next_bucket_indices.end(), size_t{0});
+  std::vector<size_t> delta_bucket_indices(num_delta_buckets);
+  std::iota(delta_bucket_indices.begin(), delta_bucket_indices.end(), size_t{0});
 
-  // 5. SSSP iteration
+  // 4. SSSP iteration
 
   auto adj_matrix_row_distances =
     GraphViewType::is_multi_gpu ? row_properties_t<GraphViewType, weight_t>(handle, push_graph_view)
@@ -141,111 +190,117 @@ void sssp(raft::handle_t const& handle,
   }
 
   if (push_graph_view.is_local_vertex_nocheck(source_vertex)) {
-    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).insert(source_vertex);
+    vertex_frontier.get_bucket(size_t{0}).insert(source_vertex);
   }
 
-  auto near_far_threshold = delta;
-  while (true) {
-    if (GraphViewType::is_multi_gpu) {
-      copy_to_adj_matrix_row(
-        handle,
-        push_graph_view,
-        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).begin(),
-        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).end(),
-        distances,
-        adj_matrix_row_distances);
-    }
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
 
-    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
-      push_graph_view.get_vertex_partition_view());
-
-    update_frontier_v_push_if_out_nbr(
-      handle,
-      push_graph_view,
-      vertex_frontier,
-      static_cast<size_t>(Bucket::cur_near),
-      std::vector<size_t>{static_cast<size_t>(Bucket::next_near), static_cast<size_t>(Bucket::far)},
-      GraphViewType::is_multi_gpu
-        ? adj_matrix_row_distances.device_view()
-        : detail::major_properties_device_view_t<vertex_t, weight_t const*>(distances),
-      dummy_properties_t<vertex_t>{}.device_view(),
-      [vertex_partition, distances, cutoff] __device__(
-        vertex_t src, vertex_t dst, weight_t w, auto src_val, auto) {
-        auto push         = true;
-        auto new_distance = src_val + w;
-        auto threshold    = cutoff;
-        if (vertex_partition.is_local_vertex_nocheck(dst)) {
-          auto local_vertex_offset =
-            vertex_partition.get_local_vertex_offset_from_vertex_nocheck(dst);
-          auto old_distance = *(distances + local_vertex_offset);
-          threshold         = old_distance < threshold ? old_distance : threshold;
+  weight_t base{0.0};
+  while (true) {
+    profiler_add_counter("iterations", 1);
+    nvtx_range_t iteration_range("iteration");
+
+    for (size_t i = 0; i < num_delta_buckets; ++i) {
+      // relaxing a light edge may insert vertices back to the bucket being processed
+      while (vertex_frontier.get_bucket(i).aggregate_size() > 0) {
+        vertex_frontier.swap_buckets(i, cur_bucket_idx);
+
+        if (GraphViewType::is_multi_gpu) {
+          copy_to_adj_matrix_row(handle,
+                                 push_graph_view,
+                                 vertex_frontier.get_bucket(cur_bucket_idx).begin(),
+                                 vertex_frontier.get_bucket(cur_bucket_idx).end(),
+                                 distances,
+                                 adj_matrix_row_distances);
         }
-        if (new_distance >= threshold) { push = false; }
-        return push ? thrust::optional<thrust::tuple<weight_t, vertex_t>>{thrust::make_tuple(
-                        new_distance, src)}
-                    : thrust::nullopt;
-      },
-      reduce_op::min<thrust::tuple<weight_t, vertex_t>>(),
-      distances,
-      thrust::make_zip_iterator(thrust::make_tuple(distances, predecessor_first)),
-      [near_far_threshold] __device__(auto v, auto v_val, auto pushed_val) {
-        auto new_dist = thrust::get<0>(pushed_val);
-        auto idx      = new_dist < v_val
-                          ? (new_dist < near_far_threshold ? static_cast<size_t>(Bucket::next_near)
-                                                           : static_cast<size_t>(Bucket::far))
-                          : VertexFrontier<vertex_t>::kInvalidBucketIdx;
-        return new_dist < v_val
-                 ? thrust::optional<thrust::tuple<size_t, decltype(pushed_val)>>{thrust::make_tuple(
-                     static_cast<size_t>(new_dist < near_far_threshold ? Bucket::next_near
-                                                                       : Bucket::far),
-                     pushed_val)}
-                 : thrust::nullopt;
-      });
 
-    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).clear();
-    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).shrink_to_fit();
-    if (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next_near)).aggregate_size() > 0) {
-      vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur_near),
-                                   static_cast<size_t>(Bucket::next_near));
-    } else if (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::far)).aggregate_size() >
-               0) {  // near queue is empty, split the far queue
-      auto old_near_far_threshold = near_far_threshold;
-      near_far_threshold += delta;
-
-      size_t near_size{0};
-      size_t far_size{0};
-      while (true) {
-        vertex_frontier.split_bucket(
-          static_cast<size_t>(Bucket::far),
-          std::vector<size_t>{static_cast<size_t>(Bucket::cur_near)},
-          [vertex_partition, distances, old_near_far_threshold, near_far_threshold] __device__(
-            auto v) {
-            auto dist =
-              *(distances + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v));
-            return dist >= old_near_far_threshold
-                     ? thrust::optional<size_t>{static_cast<size_t>(
-                         dist < near_far_threshold ? Bucket::cur_near : Bucket::far)}
+        update_frontier_v_push_if_out_nbr(
+          handle,
+          push_graph_view,
+          vertex_frontier,
+          cur_bucket_idx,
+          next_bucket_indices,
+          GraphViewType::is_multi_gpu
+            ? adj_matrix_row_distances.device_view()
+            : detail::major_properties_device_view_t<vertex_t, weight_t const*>(distances),
+          dummy_properties_t<vertex_t>{}.device_view(),
+          [vertex_partition, distances, cutoff] __device__(
+            vertex_t src, vertex_t dst, weight_t w, auto src_val, auto) {
+            auto push         = true;
+            auto new_distance = src_val + w;
+            auto threshold    = cutoff;
+            if (vertex_partition.is_local_vertex_nocheck(dst)) {
+              auto local_vertex_offset =
+                vertex_partition.get_local_vertex_offset_from_vertex_nocheck(dst);
+              auto old_distance = *(distances + local_vertex_offset);
+              threshold         = old_distance < threshold ? old_distance : threshold;
+            }
+            if (new_distance >= threshold) { push = false; }
+            return push ? thrust::optional<thrust::tuple<weight_t, vertex_t>>{thrust::make_tuple(
+                            new_distance, src)}
+                        : thrust::nullopt;
+          },
+          reduce_op::min<thrust::tuple<weight_t, vertex_t>>(),
+          distances,
+          thrust::make_zip_iterator(thrust::make_tuple(distances, predecessor_first)),
+          [base, delta] __device__(auto v, auto v_val, auto pushed_val) {
+            auto new_dist      = thrust::get<0>(pushed_val);
+            auto bucket_offset = (new_dist - base) / delta;
+            auto idx           = bucket_offset < static_cast<weight_t>(num_delta_buckets)
+                                   ? static_cast<size_t>(bucket_offset)
+                                   : far_bucket_idx;
+            return new_dist < v_val
+                     ? thrust::optional<thrust::tuple<size_t, decltype(pushed_val)>>{
+                         thrust::make_tuple(idx, pushed_val)}
                      : thrust::nullopt;
           });
-        near_size =
-          vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).aggregate_size();
-        far_size = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::far)).aggregate_size();
-        if ((near_size > 0) || (far_size == 0)) {
-          break;
-        } else {
-          near_far_threshold += delta;
-        }
+
+        vertex_frontier.get_bucket(cur_bucket_idx).clear();
+        vertex_frontier.get_bucket(cur_bucket_idx).shrink_to_fit();
       }
-      if ((near_size == 0) && (far_size == 0)) { break; }
-    } else {
-      break;
     }
-  }
 
-  CUDA_TRY(cudaStreamSynchronize(
-    handle.get_stream()));  // this is as necessary vertex_frontier will become out-of-scope once
-                            // this function returns (FIXME: should I stream sync in VertexFrontier
-                            // destructor?)
+    // every delta bucket is empty, move the base to the bucket holding the minimum tentative
+    // distance in the far bucket (skipping the empty distance ranges) and split the far bucket; a
+    // vertex relaxed into a delta bucket after being inserted to the far bucket has a distance
+    // below the old far threshold, it is already settled and its far bucket entry is dropped
+
+    auto& far_bucket = vertex_frontier.get_bucket(far_bucket_idx);
+    if (far_bucket.aggregate_size() == 0) { break; }
+
+    auto old_far_threshold = base + static_cast<weight_t>(num_delta_buckets) * delta;
+    auto min_far_distance  = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      far_bucket.begin(),
+      far_bucket.end(),
+      [vertex_partition, distances, old_far_threshold] __device__(auto v) {
+        auto dist = *(distances + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v));
+        return dist >= old_far_threshold ? dist : std::numeric_limits<weight_t>::max();
+      },
+      std::numeric_limits<weight_t>::max(),
+      thrust::minimum<weight_t>());
+    if (GraphViewType::is_multi_gpu) {
+      min_far_distance = host_scalar_allreduce(
+        handle.get_comms(), min_far_distance, raft::comms::op_t::MIN, handle.get_stream());
+    }
+    if (min_far_distance == std::numeric_limits<weight_t>::max()) {
+      break;  // every far bucket entry is stale
+    }
+    base = std::max(old_far_threshold, std::floor(min_far_distance / delta) * delta);
+
+    vertex_frontier.split_bucket(
+      far_bucket_idx,
+      delta_bucket_indices,
+      [vertex_partition, distances, base, delta] __device__(auto v) {
+        auto dist = *(distances + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v));
+        if (dist < base) { return thrust::optional<size_t>{thrust::nullopt}; }
+        auto bucket_offset = (dist - base) / delta;
+        return thrust::optional<size_t>{bucket_offset < static_cast<weight_t>(num_delta_buckets)
+                                          ? static_cast<size_t>(bucket_offset)
+                                          : far_bucket_idx};
+      });
+  }
 }
 
 }  // namespace detail
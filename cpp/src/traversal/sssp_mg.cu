@@ -19,6 +19,7 @@ namespace cugraph {
 
 // MG instantiation
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
                    float* distances,
@@ -26,7 +27,9 @@ template void sssp(raft::handle_t const& handle,
                    int32_t source_vertex,
                    float cutoff,
                    bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
                    double* distances,
@@ -34,7 +37,9 @@ template void sssp(raft::handle_t const& handle,
                    int32_t source_vertex,
                    double cutoff,
                    bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
                    float* distances,
@@ -42,7 +47,9 @@ template void sssp(raft::handle_t const& handle,
                    int32_t source_vertex,
                    float cutoff,
                    bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
                    double* distances,
@@ -50,7 +57,9 @@ template void sssp(raft::handle_t const& handle,
                    int32_t source_vertex,
                    double cutoff,
                    bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
                    float* distances,
@@ -58,7 +67,9 @@ template void sssp(raft::handle_t const& handle,
                    int64_t source_vertex,
                    float cutoff,
                    bool do_expensive_check);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
                    double* distances,
@@ -66,5 +77,6 @@ template void sssp(raft::handle_t const& handle,
                    int64_t source_vertex,
                    double cutoff,
                    bool do_expensive_check);
+#endif
 
 }  // namespace cugraph
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/temporal_edge_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/handle.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+template <typename GraphViewType, typename timestamp_t, typename PredecessorIterator>
+void temporal_bfs(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  temporal_edge_properties_t<GraphViewType, timestamp_t> const& edge_times,
+  typename GraphViewType::vertex_type* distances,
+  PredecessorIterator predecessor_first,
+  typename GraphViewType::vertex_type source_vertex,
+  timestamp_t window_first,
+  timestamp_t window_last,
+  typename GraphViewType::vertex_type depth_limit,
+  bool do_expensive_check)
+{
+  scoped_phase_t phase("temporal_bfs", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // breadth-first search on the edges with the time stamps in [window_first, window_last), the
+  // frontier rows visit only the edges in the window (binary searches in the time sorted neighbor
+  // lists of edge_times) instead of filtering every edge
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(push_graph_view.is_valid_vertex(source_vertex),
+                  "Invalid input argument: source vertex out-of-range.");
+  CUGRAPH_EXPECTS(!(window_last < window_first),
+                  "Invalid input argument: window_last should not be smaller than window_first.");
+  CUGRAPH_EXPECTS(depth_limit >= 0, "Invalid input argument: depth limit should be non-negative.");
+
+  // 2. initialize distances and predecessors
+
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+  auto constexpr invalid_vertex   = invalid_vertex_id<vertex_t>::value;
+
+  auto val_first = thrust::make_zip_iterator(thrust::make_tuple(distances, predecessor_first));
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                    val_first,
+                    [source_vertex] __device__(auto v) {
+                      return thrust::make_tuple(
+                        v == source_vertex ? vertex_t{0} : invalid_distance, invalid_vertex);
+                    });
+
+  // 3. initialize the frontier
+
+  enum class Bucket { cur, next, num_buckets };
+  VertexFrontier<vertex_t,
+                 void,
+                 GraphViewType::is_multi_gpu,
+                 static_cast<size_t>(Bucket::num_buckets)>
+    vertex_frontier(handle,
+                    push_graph_view.get_local_vertex_first(),
+                    push_graph_view.get_local_vertex_last());
+
+  if (push_graph_view.is_local_vertex_nocheck(source_vertex)) {
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).insert(source_vertex);
+  }
+
+  // 4. BFS iteration
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+
+  vertex_t depth{0};
+  while ((depth < depth_limit) &&
+         (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() > 0)) {
+    profiler_add_counter("iterations", 1);
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      dummy_properties_t<vertex_t>{}.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      edge_times.device_view(window_first, window_last),
+      [vertex_partition, distances] __device__(
+        vertex_t src, vertex_t dst, auto src_val, auto dst_val, timestamp_t) {
+        auto push = true;
+        if (vertex_partition.is_local_vertex_nocheck(dst)) {
+          auto distance =
+            *(distances + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(dst));
+          if (distance != invalid_distance) { push = false; }
+        }
+        return push ? thrust::optional<vertex_t>{src} : thrust::nullopt;
+      },
+      reduce_op::any<vertex_t>(),
+      distances,
+      thrust::make_zip_iterator(thrust::make_tuple(distances, predecessor_first)),
+      [depth] __device__(auto v, auto v_val, auto pushed_val) {
+        return (v_val == invalid_distance)
+                 ? thrust::optional<thrust::tuple<size_t, thrust::tuple<vertex_t, vertex_t>>>{
+                     thrust::make_tuple(static_cast<size_t>(Bucket::next),
+                                        thrust::make_tuple(depth + 1, pushed_val))}
+                 : thrust::nullopt;
+      });
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+
+    ++depth;
+  }
+}
+
+template <typename GraphViewType, typename timestamp_t, typename PredecessorIterator>
+void earliest_arrival_paths(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  temporal_edge_properties_t<GraphViewType, timestamp_t> const& edge_times,
+  timestamp_t* arrival_times,
+  PredecessorIterator predecessor_first,
+  typename GraphViewType::vertex_type source_vertex,
+  timestamp_t departure_time,
+  timestamp_t window_last,
+  bool do_expensive_check)
+{
+  scoped_phase_t phase("earliest_arrival_paths", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // a time-respecting path departs from a vertex no earlier than it arrives at the vertex, the
+  // arrival time at the destination of an edge is the time stamp of the edge. This runs a
+  // label-correcting search: a vertex re-enters the frontier when its arrival time improves, and
+  // the frontier rows visit only the edges with the time stamps in [arrival time, window_last)
+  // (binary searches in the time sorted neighbor lists of edge_times).
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(push_graph_view.is_valid_vertex(source_vertex),
+                  "Invalid input argument: source vertex out-of-range.");
+  CUGRAPH_EXPECTS(
+    !(window_last < departure_time),
+    "Invalid input argument: window_last should not be smaller than departure_time.");
+
+  // 2. initialize arrival times and predecessors
+
+  auto constexpr unreached      = std::numeric_limits<timestamp_t>::max();
+  auto constexpr invalid_vertex = invalid_vertex_id<vertex_t>::value;
+
+  auto val_first = thrust::make_zip_iterator(thrust::make_tuple(arrival_times, predecessor_first));
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                    val_first,
+                    [source_vertex, departure_time] __device__(auto v) {
+                      return thrust::make_tuple(v == source_vertex ? departure_time : unreached,
+                                                invalid_vertex);
+                    });
+
+  // 3. initialize the frontier
+
+  enum class Bucket { cur, next, num_buckets };
+  VertexFrontier<vertex_t,
+                 void,
+                 GraphViewType::is_multi_gpu,
+                 static_cast<size_t>(Bucket::num_buckets)>
+    vertex_frontier(handle,
+                    push_graph_view.get_local_vertex_first(),
+                    push_graph_view.get_local_vertex_last());
+
+  if (push_graph_view.is_local_vertex_nocheck(source_vertex)) {
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).insert(source_vertex);
+  }
+
+  // 4. relax the time sorted out-edges of the frontier vertices
+
+  auto adj_matrix_row_arrival_times =
+    GraphViewType::is_multi_gpu
+      ? row_properties_t<GraphViewType, timestamp_t>(handle, push_graph_view)
+      : row_properties_t<GraphViewType, timestamp_t>{};
+  if (GraphViewType::is_multi_gpu) {
+    adj_matrix_row_arrival_times.fill(unreached, handle.get_stream());
+  }
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.get_vertex_partition_view());
+
+  while (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() > 0) {
+    profiler_add_counter("iterations", 1);
+
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(handle,
+                             push_graph_view,
+                             vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+                             vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+                             arrival_times,
+                             adj_matrix_row_arrival_times);
+    }
+    auto row_arrival_time_input =
+      GraphViewType::is_multi_gpu
+        ? adj_matrix_row_arrival_times.device_view()
+        : detail::major_properties_device_view_t<vertex_t, timestamp_t const*>(arrival_times);
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      row_arrival_time_input,
+      dummy_properties_t<vertex_t>{}.device_view(),
+      edge_times.device_view(departure_time, window_last, row_arrival_time_input),
+      [vertex_partition, arrival_times] __device__(
+        vertex_t src, vertex_t dst, auto, auto, timestamp_t t) {
+        auto push = true;
+        if (vertex_partition.is_local_vertex_nocheck(dst)) {
+          auto old_arrival_time =
+            *(arrival_times + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(dst));
+          if (!(t < old_arrival_time)) { push = false; }
+        }
+        return push ? thrust::optional<thrust::tuple<timestamp_t, vertex_t>>{thrust::make_tuple(
+                        t, src)}
+                    : thrust::nullopt;
+      },
+      reduce_op::min<thrust::tuple<timestamp_t, vertex_t>>(),
+      arrival_times,
+      thrust::make_zip_iterator(thrust::make_tuple(arrival_times, predecessor_first)),
+      [] __device__(auto v, auto v_val, auto pushed_val) {
+        return thrust::get<0>(pushed_val) < v_val
+                 ? thrust::optional<thrust::tuple<size_t, decltype(pushed_val)>>{
+                     thrust::make_tuple(static_cast<size_t>(Bucket::next), pushed_val)}
+                 : thrust::nullopt;
+      });
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename timestamp_t,
+          bool multi_gpu>
+void temporal_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>,
+                             timestamp_t> const& edge_times,
+  vertex_t* distances,
+  vertex_t* predecessors,
+  vertex_t source_vertex,
+  timestamp_t window_first,
+  timestamp_t window_last,
+  vertex_t depth_limit,
+  bool do_expensive_check)
+{
+  if (predecessors != nullptr) {
+    detail::temporal_bfs(handle,
+                         graph_view,
+                         edge_times,
+                         distances,
+                         predecessors,
+                         source_vertex,
+                         window_first,
+                         window_last,
+                         depth_limit,
+                         do_expensive_check);
+  } else {
+    detail::temporal_bfs(handle,
+                         graph_view,
+                         edge_times,
+                         distances,
+                         thrust::make_discard_iterator(),
+                         source_vertex,
+                         window_first,
+                         window_last,
+                         depth_limit,
+                         do_expensive_check);
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename timestamp_t,
+          bool multi_gpu>
+void earliest_arrival_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>,
+                             timestamp_t> const& edge_times,
+  timestamp_t* arrival_times,
+  vertex_t* predecessors,
+  vertex_t source_vertex,
+  timestamp_t departure_time,
+  timestamp_t window_last,
+  bool do_expensive_check)
+{
+  if (predecessors != nullptr) {
+    detail::earliest_arrival_paths(handle,
+                                   graph_view,
+                                   edge_times,
+                                   arrival_times,
+                                   predecessors,
+                                   source_vertex,
+                                   departure_time,
+                                   window_last,
+                                   do_expensive_check);
+  } else {
+    detail::earliest_arrival_paths(handle,
+                                   graph_view,
+                                   edge_times,
+                                   arrival_times,
+                                   thrust::make_discard_iterator(),
+                                   source_vertex,
+                                   departure_time,
+                                   window_last,
+                                   do_expensive_check);
+  }
+}
+
+}  // namespace cugraph
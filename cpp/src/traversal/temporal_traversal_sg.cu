@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <traversal/temporal_traversal_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation (with int64_t time stamps)
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template void temporal_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int32_t, int32_t, float, false, false>,
+                             int64_t> const& edge_times,
+  int32_t* distances,
+  int32_t* predecessors,
+  int32_t source_vertex,
+  int64_t window_first,
+  int64_t window_last,
+  int32_t depth_limit,
+  bool do_expensive_check);
+
+template void earliest_arrival_paths(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int32_t, int32_t, float, false, false>,
+                             int64_t> const& edge_times,
+  int64_t* arrival_times,
+  int32_t* predecessors,
+  int32_t source_vertex,
+  int64_t departure_time,
+  int64_t window_last,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template void temporal_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int32_t, int64_t, float, false, false>,
+                             int64_t> const& edge_times,
+  int32_t* distances,
+  int32_t* predecessors,
+  int32_t source_vertex,
+  int64_t window_first,
+  int64_t window_last,
+  int32_t depth_limit,
+  bool do_expensive_check);
+
+template void earliest_arrival_paths(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int32_t, int64_t, float, false, false>,
+                             int64_t> const& edge_times,
+  int64_t* arrival_times,
+  int32_t* predecessors,
+  int32_t source_vertex,
+  int64_t departure_time,
+  int64_t window_last,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template void temporal_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int64_t, int64_t, float, false, false>,
+                             int64_t> const& edge_times,
+  int64_t* distances,
+  int64_t* predecessors,
+  int64_t source_vertex,
+  int64_t window_first,
+  int64_t window_last,
+  int64_t depth_limit,
+  bool do_expensive_check);
+
+template void earliest_arrival_paths(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int64_t, int64_t, float, false, false>,
+                             int64_t> const& edge_times,
+  int64_t* arrival_times,
+  int64_t* predecessors,
+  int64_t source_vertex,
+  int64_t departure_time,
+  int64_t window_last,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template void temporal_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int32_t, int32_t, double, false, false>,
+                             int64_t> const& edge_times,
+  int32_t* distances,
+  int32_t* predecessors,
+  int32_t source_vertex,
+  int64_t window_first,
+  int64_t window_last,
+  int32_t depth_limit,
+  bool do_expensive_check);
+
+template void earliest_arrival_paths(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int32_t, int32_t, double, false, false>,
+                             int64_t> const& edge_times,
+  int64_t* arrival_times,
+  int32_t* predecessors,
+  int32_t source_vertex,
+  int64_t departure_time,
+  int64_t window_last,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template void temporal_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int32_t, int64_t, double, false, false>,
+                             int64_t> const& edge_times,
+  int32_t* distances,
+  int32_t* predecessors,
+  int32_t source_vertex,
+  int64_t window_first,
+  int64_t window_last,
+  int32_t depth_limit,
+  bool do_expensive_check);
+
+template void earliest_arrival_paths(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int32_t, int64_t, double, false, false>,
+                             int64_t> const& edge_times,
+  int64_t* arrival_times,
+  int32_t* predecessors,
+  int32_t source_vertex,
+  int64_t departure_time,
+  int64_t window_last,
+  bool do_expensive_check);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template void temporal_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int64_t, int64_t, double, false, false>,
+                             int64_t> const& edge_times,
+  int64_t* distances,
+  int64_t* predecessors,
+  int64_t source_vertex,
+  int64_t window_first,
+  int64_t window_last,
+  int64_t depth_limit,
+  bool do_expensive_check);
+
+template void earliest_arrival_paths(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  temporal_edge_properties_t<graph_view_t<int64_t, int64_t, double, false, false>,
+                             int64_t> const& edge_times,
+  int64_t* arrival_times,
+  int64_t* predecessors,
+  int64_t source_vertex,
+  int64_t departure_time,
+  int64_t window_last,
+  bool do_expensive_check);
+#endif
+
+}  // namespace cugraph
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct is_source_t {
+  edge_t const* in_degrees{nullptr};
+  vertex_t local_vertex_first{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return in_degrees[v - local_vertex_first] == edge_t{0};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename edge_t>
+struct is_unsorted_t {
+  __device__ bool operator()(edge_t remaining_in_degree) const
+  {
+    return remaining_in_degree != edge_t{0};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename edge_t>
+struct count_in_edge_e_op_t {
+  template <typename vertex_t, typename weight_t>
+  __device__ thrust::optional<edge_t> operator()(
+    vertex_t, vertex_t, weight_t, thrust::nullopt_t, thrust::nullopt_t) const
+  {
+    return edge_t{1};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct assign_level_v_op_t {
+  vertex_t next_level{};
+  size_t next_bucket_idx{};
+  size_t invalid_bucket_idx{};
+
+  __device__ thrust::optional<thrust::tuple<size_t, thrust::tuple<edge_t, vertex_t>>> operator()(
+    vertex_t, edge_t remaining_in_degree, edge_t num_visited_in_edges) const
+  {
+    auto new_remaining_in_degree = remaining_in_degree - num_visited_in_edges;
+    auto sorted                  = new_remaining_in_degree == edge_t{0};
+    return thrust::make_tuple(
+      sorted ? next_bucket_idx : invalid_bucket_idx,
+      thrust::make_tuple(new_remaining_in_degree,
+                         sorted ? next_level : invalid_vertex_id<vertex_t>::value));
+  }
+};
+
+// the better of two (distance, predecessor) pairs, std::numeric_limits<weight_t>::max() is an
+// unreached distance (ties are broken by the smaller predecessor ID to be deterministic)
+template <typename vertex_t, typename weight_t, bool longest>
+__host__ __device__ thrust::tuple<weight_t, vertex_t> better_path(
+  thrust::tuple<weight_t, vertex_t> lhs, thrust::tuple<weight_t, vertex_t> rhs)
+{
+  auto constexpr unreached = std::numeric_limits<weight_t>::max();
+  auto lhs_dist            = thrust::get<0>(lhs);
+  auto rhs_dist            = thrust::get<0>(rhs);
+  if (lhs_dist == unreached) { return rhs; }
+  if (rhs_dist == unreached) { return lhs; }
+  if (lhs_dist == rhs_dist) { return thrust::get<1>(lhs) < thrust::get<1>(rhs) ? lhs : rhs; }
+  return (longest ? (lhs_dist > rhs_dist) : (lhs_dist < rhs_dist)) ? lhs : rhs;
+}
+
+// reduces (number of visited in-edges, distance, predecessor) triplets pushed to a vertex, the
+// counts are summed and the best path is kept
+template <typename vertex_t, typename edge_t, typename weight_t, bool longest>
+struct dag_relax_reduce_op_t {
+  using type = thrust::tuple<edge_t, weight_t, vertex_t>;
+
+  static constexpr bool pure_function = true;  // this can be called in any process
+
+  __host__ __device__ type operator()(type const& lhs, type const& rhs) const
+  {
+    auto path = better_path<vertex_t, weight_t, longest>(
+      thrust::make_tuple(thrust::get<1>(lhs), thrust::get<2>(lhs)),
+      thrust::make_tuple(thrust::get<1>(rhs), thrust::get<2>(rhs)));
+    return thrust::make_tuple(
+      thrust::get<0>(lhs) + thrust::get<0>(rhs), thrust::get<0>(path), thrust::get<1>(path));
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct dag_relax_e_op_t {
+  __device__ thrust::optional<thrust::tuple<edge_t, weight_t, vertex_t>> operator()(
+    vertex_t src, vertex_t, weight_t w, weight_t src_distance, thrust::nullopt_t) const
+  {
+    auto constexpr unreached = std::numeric_limits<weight_t>::max();
+    return src_distance == unreached
+             ? thrust::make_tuple(edge_t{1}, unreached, invalid_vertex_id<vertex_t>::value)
+             : thrust::make_tuple(edge_t{1}, src_distance + w, src);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t, typename weight_t, bool longest>
+struct dag_relax_v_op_t {
+  size_t next_bucket_idx{};
+  size_t invalid_bucket_idx{};
+
+  __device__ thrust::optional<thrust::tuple<size_t, thrust::tuple<edge_t, weight_t, vertex_t>>>
+  operator()(vertex_t,
+             thrust::tuple<edge_t, weight_t, vertex_t> v_val,
+             thrust::tuple<edge_t, weight_t, vertex_t> pushed_val) const
+  {
+    auto new_remaining_in_degree = thrust::get<0>(v_val) - thrust::get<0>(pushed_val);
+    auto old_path  = thrust::make_tuple(thrust::get<1>(v_val), thrust::get<2>(v_val));
+    auto new_path  = thrust::make_tuple(thrust::get<1>(pushed_val), thrust::get<2>(pushed_val));
+    auto best_path = old_path;
+    // keep the path found in the earlier levels on a tie
+    if (thrust::get<0>(better_path<vertex_t, weight_t, longest>(old_path, new_path)) !=
+        thrust::get<0>(old_path)) {
+      best_path = new_path;
+    }
+    return thrust::make_tuple(
+      new_remaining_in_degree == edge_t{0} ? next_bucket_idx : invalid_bucket_idx,
+      thrust::make_tuple(
+        new_remaining_in_degree, thrust::get<0>(best_path), thrust::get<1>(best_path)));
+  }
+};
+
+// initializes the remaining in-degree counters and inserts the vertices without in-edges to the
+// given frontier bucket
+template <typename GraphViewType, typename VertexFrontierType>
+rmm::device_uvector<typename GraphViewType::edge_type> init_kahn_frontier(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexFrontierType& vertex_frontier,
+  size_t bucket_idx)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  auto remaining_in_degrees = graph_view.compute_in_degrees(handle);
+
+  rmm::device_uvector<vertex_t> sources(remaining_in_degrees.size(), handle.get_stream());
+  sources.resize(
+    thrust::distance(
+      sources.begin(),
+      thrust::copy_if(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(graph_view.get_local_vertex_first()),
+                      thrust::make_counting_iterator(graph_view.get_local_vertex_last()),
+                      sources.begin(),
+                      is_source_t<vertex_t, edge_t>{remaining_in_degrees.data(),
+                                                    graph_view.get_local_vertex_first()})),
+    handle.get_stream());
+  vertex_frontier.get_bucket(bucket_idx).insert(sources.begin(), sources.end());
+
+  return remaining_in_degrees;
+}
+
+template <typename GraphViewType>
+std::tuple<typename GraphViewType::vertex_type, bool> topological_sort(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  typename GraphViewType::vertex_type* levels,
+  bool do_expensive_check)
+{
+  scoped_phase_t phase("topological_sort", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // implements the level-synchronous variant of Kahn's algorithm (A. B. Kahn, "Topological sorting
+  // of large networks," 1962), a vertex is assigned to a level once every in-edge is visited
+
+  if (push_graph_view.get_number_of_vertices() == 0) { return std::make_tuple(vertex_t{0}, true); }
+
+  // 1. initialize the levels and the frontier
+
+  enum class Bucket { cur, next, num_buckets };
+  using vertex_frontier_t = VertexFrontier<vertex_t,
+                                           void,
+                                           GraphViewType::is_multi_gpu,
+                                           static_cast<size_t>(Bucket::num_buckets)>;
+  vertex_frontier_t vertex_frontier(
+    handle, push_graph_view.get_local_vertex_first(), push_graph_view.get_local_vertex_last());
+
+  auto remaining_in_degrees =
+    init_kahn_frontier(handle, push_graph_view, vertex_frontier, static_cast<size_t>(Bucket::cur));
+
+  thrust::transform(handle.get_thrust_policy(),
+                    remaining_in_degrees.begin(),
+                    remaining_in_degrees.end(),
+                    levels,
+                    [] __device__(auto in_degree) {
+                      return in_degree == edge_t{0} ? vertex_t{0}
+                                                    : invalid_vertex_id<vertex_t>::value;
+                    });
+
+  // 2. visit the out-edges of the vertices in the current level, a vertex joins the next level
+  // when its last in-edge is visited
+
+  vertex_t num_levels{0};
+  while (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() > 0) {
+    ++num_levels;
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      dummy_properties_t<vertex_t>{}.device_view(),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      count_in_edge_e_op_t<edge_t>{},
+      reduce_op::plus<edge_t>(),
+      remaining_in_degrees.data(),
+      thrust::make_zip_iterator(thrust::make_tuple(remaining_in_degrees.begin(), levels)),
+      assign_level_v_op_t<vertex_t, edge_t>{num_levels,
+                                            static_cast<size_t>(Bucket::next),
+                                            vertex_frontier_t::kInvalidBucketIdx});
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+  }
+
+  // 3. the vertices on (or reachable from) a cycle are never assigned to a level
+
+  auto num_unsorted_vertices = count_if_v(
+    handle, push_graph_view, remaining_in_degrees.data(), is_unsorted_t<edge_t>{});
+
+  return std::make_tuple(num_levels, num_unsorted_vertices == vertex_t{0});
+}
+
+template <typename GraphViewType, bool longest>
+void dag_paths(raft::handle_t const& handle,
+               GraphViewType const& push_graph_view,
+               typename GraphViewType::weight_type* distances,
+               typename GraphViewType::vertex_type* predecessors,
+               typename GraphViewType::vertex_type source_vertex,
+               bool do_expensive_check)
+{
+  scoped_phase_t phase("dag_paths", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // visits the vertices in a topological order (with the same level-synchronous Kahn's algorithm
+  // as topological_sort) and relaxes the out-edges of each level once, the path to a vertex is
+  // final when its last in-edge is visited; negative edge weights are allowed.
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(push_graph_view.is_valid_vertex(source_vertex),
+                  "Invalid input argument: source vertex out-of-range.");
+
+  // 2. initialize distances and predecessors and the frontier
+
+  auto constexpr unreached = std::numeric_limits<weight_t>::max();
+
+  std::optional<rmm::device_uvector<vertex_t>> tmp_predecessors{std::nullopt};
+  if (predecessors == nullptr) {
+    tmp_predecessors = rmm::device_uvector<vertex_t>(
+      push_graph_view.get_number_of_local_vertices(), handle.get_stream());
+    predecessors = (*tmp_predecessors).data();
+  }
+
+  auto val_first = thrust::make_zip_iterator(thrust::make_tuple(distances, predecessors));
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                    val_first,
+                    [source_vertex] __device__(auto v) {
+                      return thrust::make_tuple(v == source_vertex ? weight_t{0.0} : unreached,
+                                                invalid_vertex_id<vertex_t>::value);
+                    });
+
+  enum class Bucket { cur, next, num_buckets };
+  using vertex_frontier_t = VertexFrontier<vertex_t,
+                                           void,
+                                           GraphViewType::is_multi_gpu,
+                                           static_cast<size_t>(Bucket::num_buckets)>;
+  vertex_frontier_t vertex_frontier(
+    handle, push_graph_view.get_local_vertex_first(), push_graph_view.get_local_vertex_last());
+
+  auto remaining_in_degrees =
+    init_kahn_frontier(handle, push_graph_view, vertex_frontier, static_cast<size_t>(Bucket::cur));
+
+  // 3. relax the out-edges of the vertices in the current level
+
+  auto adj_matrix_row_distances =
+    GraphViewType::is_multi_gpu ? row_properties_t<GraphViewType, weight_t>(handle, push_graph_view)
+                                : row_properties_t<GraphViewType, weight_t>{};
+  if (GraphViewType::is_multi_gpu) {
+    adj_matrix_row_distances.fill(unreached, handle.get_stream());
+  }
+
+  auto state_first = thrust::make_zip_iterator(
+    thrust::make_tuple(remaining_in_degrees.begin(), distances, predecessors));
+  while (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() > 0) {
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(handle,
+                             push_graph_view,
+                             vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+                             vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+                             distances,
+                             adj_matrix_row_distances);
+    }
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      GraphViewType::is_multi_gpu
+        ? adj_matrix_row_distances.device_view()
+        : detail::major_properties_device_view_t<vertex_t, weight_t const*>(distances),
+      dummy_properties_t<vertex_t>{}.device_view(),
+      dag_relax_e_op_t<vertex_t, edge_t, weight_t>{},
+      dag_relax_reduce_op_t<vertex_t, edge_t, weight_t, longest>{},
+      state_first,
+      state_first,
+      dag_relax_v_op_t<vertex_t, edge_t, weight_t, longest>{static_cast<size_t>(Bucket::next),
+                                                            vertex_frontier_t::kInvalidBucketIdx});
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).shrink_to_fit();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+  }
+
+  // 4. every vertex is visited if and only if the graph is acyclic
+
+  auto num_unvisited_vertices = count_if_v(
+    handle, push_graph_view, remaining_in_degrees.data(), is_unsorted_t<edge_t>{});
+  CUGRAPH_EXPECTS(num_unvisited_vertices == vertex_t{0},
+                  "Invalid input argument: the input graph has a cycle.");
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<vertex_t, bool> topological_sort(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t* levels,
+  bool do_expensive_check)
+{
+  return detail::topological_sort(handle, graph_view, levels, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void dag_shortest_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  weight_t* distances,
+  vertex_t* predecessors,
+  vertex_t source_vertex,
+  bool longest,
+  bool do_expensive_check)
+{
+  if (longest) {
+    detail::dag_paths<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>, true>(
+      handle, graph_view, distances, predecessors, source_vertex, do_expensive_check);
+  } else {
+    detail::dag_paths<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>, false>(
+      handle, graph_view, distances, predecessors, source_vertex, do_expensive_check);
+  }
+}
+
+}  // namespace cugraph
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <structure/two_hop_paths.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/nbr_list_utils.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct query_index_to_vertex_t {
+  vertex_t const* query_vertices{nullptr};
+
+  __device__ vertex_t operator()(size_t i) const { return query_vertices[i]; }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void get_two_hop_neighbors_batched_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* start_vertices,
+  size_t num_start_vertices,
+  size_t batch_memory_budget,
+  two_hop_neighbors_batch_op_t<vertex_t> batch_op,
+  bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((num_start_vertices == 0) || (start_vertices != nullptr),
+                  "Invalid input argument: start_vertices cannot be null.");
+  CUGRAPH_EXPECTS(batch_op != nullptr, "Invalid input argument: batch_op cannot be empty.");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, multi_gpu>(
+      graph_view.get_vertex_partition_view());
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 graph_view,
+                 start_vertices,
+                 start_vertices + num_start_vertices,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: start_vertices have invalid vertex IDs.");
+  }
+
+  auto local_vertex_first = graph_view.get_local_vertex_first();
+  auto num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  std::vector<vertex_t> vertex_partition_lasts{};
+  if constexpr (multi_gpu) { vertex_partition_lasts = graph_view.get_vertex_partition_lasts(); }
+
+  // 2. store the out-neighbor lists of the local vertices in a local CSR
+
+  auto [majors, minors] = detail::extract_local_major_edgelist(handle, graph_view);
+  auto offsets          = detail::compute_sorted_edge_offsets<vertex_t, edge_t>(
+    handle, majors, local_vertex_first, num_local_vertices);
+  majors.resize(0, handle.get_stream());
+  majors.shrink_to_fit(handle.get_stream());
+
+  // 3. enumerate the 2-hop paths in batches and hand over the deduplicated (start vertex, 2-hop
+  // neighbor) pairs of every batch (a path takes a query index & a candidate vertex, and sorting
+  // the paths takes about as much temporary memory)
+
+  auto max_num_paths_per_batch =
+    std::max(batch_memory_budget / ((sizeof(size_t) + sizeof(vertex_t)) * 2), size_t{1});
+
+  detail::for_each_two_hop_path_batch<vertex_t, edge_t, multi_gpu>(
+    handle,
+    minors,
+    offsets,
+    local_vertex_first,
+    vertex_partition_lasts,
+    start_vertices,
+    num_start_vertices,
+    max_num_paths_per_batch,
+    [&handle, start_vertices, &batch_op](rmm::device_uvector<size_t>& path_query_indices,
+                                         rmm::device_uvector<vertex_t>& path_candidates) {
+      auto path_first = thrust::make_zip_iterator(
+        thrust::make_tuple(path_query_indices.begin(), path_candidates.begin()));
+      thrust::sort(
+        handle.get_thrust_policy(), path_first, path_first + path_query_indices.size());
+      auto num_pairs = static_cast<size_t>(thrust::distance(
+        path_first,
+        thrust::unique(
+          handle.get_thrust_policy(), path_first, path_first + path_query_indices.size())));
+      path_candidates.resize(num_pairs, handle.get_stream());
+      path_candidates.shrink_to_fit(handle.get_stream());
+
+      rmm::device_uvector<vertex_t> srcs(num_pairs, handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        path_query_indices.begin(),
+                        path_query_indices.begin() + num_pairs,
+                        srcs.begin(),
+                        query_index_to_vertex_t<vertex_t>{start_vertices});
+      path_query_indices.resize(0, handle.get_stream());
+      path_query_indices.shrink_to_fit(handle.get_stream());
+
+      batch_op(std::move(srcs), std::move(path_candidates));
+    });
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void get_two_hop_neighbors_batched(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* start_vertices,
+  size_t num_start_vertices,
+  size_t batch_memory_budget,
+  two_hop_neighbors_batch_op_t<vertex_t> batch_op,
+  bool do_expensive_check)
+{
+  get_two_hop_neighbors_batched_impl(handle,
+                                     graph_view,
+                                     start_vertices,
+                                     num_start_vertices,
+                                     batch_memory_budget,
+                                     std::move(batch_op),
+                                     do_expensive_check);
+}
+
+}  // namespace cugraph
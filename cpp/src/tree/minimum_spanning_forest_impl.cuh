@@ -0,0 +1,560 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/extract_if_e.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/utilities/collect_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_lower_endpoint_e_op_t {
+  template <typename SrcValue, typename DstValue>
+  __device__ bool operator()(vertex_t src, vertex_t dst, SrcValue, DstValue) const
+  {
+    return src < dst;
+  }
+};
+
+// candidate edges are ordered by (weight, source, destination), ties in weight are broken by the
+// endpoint IDs to make the order strict (this keeps the hooked supervertices acyclic except for
+// mutual hooking pairs)
+template <typename vertex_t, typename weight_t>
+using msf_candidate_t = thrust::tuple<weight_t, vertex_t, vertex_t, vertex_t /* other label */>;
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct candidate_edge_t {
+  edge_t num_edges{};
+  vertex_t const* srcs{nullptr};
+  vertex_t const* dsts{nullptr};
+  weight_t const* weights{nullptr};
+  vertex_t const* src_labels{nullptr};
+  vertex_t const* dst_labels{nullptr};
+
+  __device__ msf_candidate_t<vertex_t, weight_t> operator()(edge_t i) const
+  {
+    auto e = i < num_edges ? i : i - num_edges;
+    return thrust::make_tuple(
+      weights[e], srcs[e], dsts[e], i < num_edges ? dst_labels[e] : src_labels[e]);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct min_candidate_t {
+  __device__ msf_candidate_t<vertex_t, weight_t> operator()(
+    msf_candidate_t<vertex_t, weight_t> lhs, msf_candidate_t<vertex_t, weight_t> rhs) const
+  {
+    return lhs < rhs ? lhs : rhs;
+  }
+};
+
+// returns the values of the local array local_value_first (indexed by local vertex offset) for the
+// sorted unique vertices in [unique_vertex_first, unique_vertex_first + num_vertices)
+template <bool multi_gpu, typename vertex_t>
+rmm::device_uvector<vertex_t> msf_collect_values(
+  raft::handle_t const& handle,
+  vertex_t const* unique_vertex_first,
+  vertex_t num_vertices,
+  vertex_t const* local_value_first,
+  std::vector<vertex_t> const& vertex_partition_lasts)
+{
+  if constexpr (multi_gpu) {
+    return collect_values_for_sorted_unique_vertices(handle.get_comms(),
+                                                     unique_vertex_first,
+                                                     num_vertices,
+                                                     local_value_first,
+                                                     vertex_partition_lasts,
+                                                     handle.get_stream_view());
+  } else {
+    rmm::device_uvector<vertex_t> values(num_vertices, handle.get_stream());
+    thrust::gather(handle.get_thrust_policy(),
+                   unique_vertex_first,
+                   unique_vertex_first + num_vertices,
+                   local_value_first,
+                   values.begin());
+    return values;
+  }
+}
+
+// replaces every label in [label_first, label_last) with its parent
+template <bool multi_gpu, typename vertex_t>
+void msf_relabel(raft::handle_t const& handle,
+                 vertex_t* label_first,
+                 vertex_t* label_last,
+                 vertex_t const* parents,
+                 std::vector<vertex_t> const& vertex_partition_lasts)
+{
+  if constexpr (multi_gpu) {
+    rmm::device_uvector<vertex_t> unique_labels(thrust::distance(label_first, label_last),
+                                                handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), label_first, label_last, unique_labels.begin());
+    thrust::sort(handle.get_thrust_policy(), unique_labels.begin(), unique_labels.end());
+    unique_labels.resize(
+      thrust::distance(
+        unique_labels.begin(),
+        thrust::unique(handle.get_thrust_policy(), unique_labels.begin(), unique_labels.end())),
+      handle.get_stream());
+    auto new_labels = msf_collect_values<multi_gpu>(handle,
+                                                   unique_labels.data(),
+                                                   static_cast<vertex_t>(unique_labels.size()),
+                                                   parents,
+                                                   vertex_partition_lasts);
+    thrust::transform(handle.get_thrust_policy(),
+                      label_first,
+                      label_last,
+                      label_first,
+                      [unique_label_first = unique_labels.begin(),
+                       unique_label_last  = unique_labels.end(),
+                       new_labels         = new_labels.data()] __device__(auto l) {
+                        auto it = thrust::lower_bound(
+                          thrust::seq, unique_label_first, unique_label_last, l);
+                        return new_labels[thrust::distance(unique_label_first, it)];
+                      });
+  } else {
+    thrust::transform(handle.get_thrust_policy(),
+                      label_first,
+                      label_last,
+                      label_first,
+                      [parents] __device__(auto l) { return parents[l]; });
+  }
+}
+
+// Boruvka's algorithm. Every round, each supervertex (a tree of the forest under construction,
+// identified by one of its member vertex IDs) picks its minimum weight incident edge, hooks itself
+// to the supervertex at the other end, and the hooked trees are contracted by pointer jumping. The
+// supervertices are stored on the GPUs owning the supervertex IDs in multi-GPU, and the contracted
+// edges stay on the GPUs holding the original edges. Parallel edges between two supervertices are
+// reduced to the minimum weight one (locally) and the edges inside a supervertex are dropped, so
+// the edge list shrinks every round and the number of rounds is at most log2(V).
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::weight_type>>
+minimum_spanning_forest(raft::handle_t const& handle,
+                        GraphViewType const& push_graph_view,
+                        bool do_expensive_check)
+{
+  scoped_phase_t phase("minimum_spanning_forest", handle.get_stream_view());
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    push_graph_view.is_symmetric(),
+    "Invalid input argument: input graph should be symmetric for minimum spanning forest.");
+  CUGRAPH_EXPECTS(
+    push_graph_view.is_weighted(),
+    "Invalid input argument: input graph should be weighted for minimum spanning forest.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  // 2. extract one direction per undirected edge (self-loops are dropped)
+
+  auto [srcs, dsts, edge_weights] = extract_if_e(handle,
+                                                 push_graph_view,
+                                                 dummy_properties_t<vertex_t>{}.device_view(),
+                                                 dummy_properties_t<vertex_t>{}.device_view(),
+                                                 is_lower_endpoint_e_op_t<vertex_t>{});
+  auto weights = std::move(*edge_weights);
+
+  rmm::device_uvector<vertex_t> src_labels(srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> dst_labels(dsts.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), srcs.begin(), srcs.end(), src_labels.begin());
+  thrust::copy(handle.get_thrust_policy(), dsts.begin(), dsts.end(), dst_labels.begin());
+
+  auto const local_vertex_first      = push_graph_view.get_local_vertex_first();
+  auto const& vertex_partition_lasts = push_graph_view.get_vertex_partition_lasts();
+
+  rmm::device_uvector<vertex_t> parents(push_graph_view.get_number_of_local_vertices(),
+                                        handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), parents.begin(), parents.end(), local_vertex_first);
+
+  rmm::device_uvector<vertex_t> forest_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> forest_dsts(0, handle.get_stream());
+  rmm::device_uvector<weight_t> forest_weights(0, handle.get_stream());
+
+  // 3. iterate till no edge crosses two supervertices
+
+  size_t round{0};
+  while (true) {
+    auto num_edges           = static_cast<edge_t>(srcs.size());
+    auto aggregate_num_edges = num_edges;
+    if (GraphViewType::is_multi_gpu) {
+      aggregate_num_edges = host_scalar_allreduce(
+        handle.get_comms(), num_edges, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (aggregate_num_edges == 0) { break; }
+
+    profiler_add_counter("rounds", 1);
+    nvtx_range_t round_range("round", static_cast<int64_t>(round));
+
+    // 3-1. find the minimum weight edge incident to each supervertex
+
+    rmm::device_uvector<vertex_t> labels(size_t{2} * num_edges, handle.get_stream());
+    rmm::device_uvector<weight_t> best_weights(labels.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> best_srcs(labels.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> best_dsts(labels.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> best_others(labels.size(), handle.get_stream());
+    {
+      rmm::device_uvector<vertex_t> candidate_labels(labels.size(), handle.get_stream());
+      rmm::device_uvector<edge_t> candidate_indices(labels.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   src_labels.begin(),
+                   src_labels.end(),
+                   candidate_labels.begin());
+      thrust::copy(handle.get_thrust_policy(),
+                   dst_labels.begin(),
+                   dst_labels.end(),
+                   candidate_labels.begin() + num_edges);
+      thrust::sequence(
+        handle.get_thrust_policy(), candidate_indices.begin(), candidate_indices.end(), edge_t{0});
+      thrust::sort_by_key(handle.get_thrust_policy(),
+                          candidate_labels.begin(),
+                          candidate_labels.end(),
+                          candidate_indices.begin());
+
+      auto best_first = thrust::make_zip_iterator(thrust::make_tuple(
+        best_weights.begin(), best_srcs.begin(), best_dsts.begin(), best_others.begin()));
+      auto num_labels = static_cast<size_t>(thrust::distance(
+        labels.begin(),
+        thrust::get<0>(thrust::reduce_by_key(
+          handle.get_thrust_policy(),
+          candidate_labels.begin(),
+          candidate_labels.end(),
+          thrust::make_transform_iterator(
+            candidate_indices.begin(),
+            candidate_edge_t<vertex_t, edge_t, weight_t>{num_edges,
+                                                         srcs.data(),
+                                                         dsts.data(),
+                                                         weights.data(),
+                                                         src_labels.data(),
+                                                         dst_labels.data()}),
+          labels.begin(),
+          best_first,
+          thrust::equal_to<vertex_t>{},
+          min_candidate_t<vertex_t, weight_t>{}))));
+      labels.resize(num_labels, handle.get_stream());
+      best_weights.resize(num_labels, handle.get_stream());
+      best_srcs.resize(num_labels, handle.get_stream());
+      best_dsts.resize(num_labels, handle.get_stream());
+      best_others.resize(num_labels, handle.get_stream());
+    }
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      // send the local minima to the GPUs owning the supervertices and reduce again
+      rmm::device_uvector<vertex_t> d_vertex_partition_lasts(vertex_partition_lasts.size(),
+                                                             handle.get_stream());
+      raft::update_device(d_vertex_partition_lasts.data(),
+                          vertex_partition_lasts.data(),
+                          vertex_partition_lasts.size(),
+                          handle.get_stream());
+      auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(labels.begin(),
+                                                                     best_weights.begin(),
+                                                                     best_srcs.begin(),
+                                                                     best_dsts.begin(),
+                                                                     best_others.begin()));
+      rmm::device_uvector<vertex_t> rx_labels(0, handle.get_stream());
+      rmm::device_uvector<weight_t> rx_weights(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> rx_srcs(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> rx_dsts(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> rx_others(0, handle.get_stream());
+      std::forward_as_tuple(std::tie(rx_labels, rx_weights, rx_srcs, rx_dsts, rx_others),
+                            std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          handle.get_comms(),
+          pair_first,
+          pair_first + labels.size(),
+          [vertex_partition_lasts = d_vertex_partition_lasts.data(),
+           num_vertex_partitions  = d_vertex_partition_lasts.size()] __device__(auto val) {
+            return static_cast<int>(
+              thrust::distance(vertex_partition_lasts,
+                               thrust::upper_bound(thrust::seq,
+                                                   vertex_partition_lasts,
+                                                   vertex_partition_lasts + num_vertex_partitions,
+                                                   thrust::get<0>(val))));
+          },
+          handle.get_stream());
+
+      auto rx_first = thrust::make_zip_iterator(thrust::make_tuple(
+        rx_weights.begin(), rx_srcs.begin(), rx_dsts.begin(), rx_others.begin()));
+      thrust::sort_by_key(
+        handle.get_thrust_policy(), rx_labels.begin(), rx_labels.end(), rx_first);
+      labels.resize(rx_labels.size(), handle.get_stream());
+      best_weights.resize(labels.size(), handle.get_stream());
+      best_srcs.resize(labels.size(), handle.get_stream());
+      best_dsts.resize(labels.size(), handle.get_stream());
+      best_others.resize(labels.size(), handle.get_stream());
+      auto best_first = thrust::make_zip_iterator(thrust::make_tuple(
+        best_weights.begin(), best_srcs.begin(), best_dsts.begin(), best_others.begin()));
+      auto num_labels = static_cast<size_t>(thrust::distance(
+        labels.begin(),
+        thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                             rx_labels.begin(),
+                                             rx_labels.end(),
+                                             rx_first,
+                                             labels.begin(),
+                                             best_first,
+                                             thrust::equal_to<vertex_t>{},
+                                             min_candidate_t<vertex_t, weight_t>{}))));
+      labels.resize(num_labels, handle.get_stream());
+      best_weights.resize(num_labels, handle.get_stream());
+      best_srcs.resize(num_labels, handle.get_stream());
+      best_dsts.resize(num_labels, handle.get_stream());
+      best_others.resize(num_labels, handle.get_stream());
+    }
+
+    // 3-2. hook each supervertex to the supervertex at the other end of its minimum weight edge;
+    // with the strict edge order, the only cycles are the pairs hooking to each other with the same
+    // edge, and the smaller supervertex in each pair stays as the root (and does not add the edge)
+
+    {
+      auto others = std::move(best_others);
+      rmm::device_uvector<vertex_t> unique_others(others.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(), others.begin(), others.end(), unique_others.begin());
+      thrust::sort(handle.get_thrust_policy(), unique_others.begin(), unique_others.end());
+      unique_others.resize(
+        thrust::distance(
+          unique_others.begin(),
+          thrust::unique(handle.get_thrust_policy(), unique_others.begin(), unique_others.end())),
+        handle.get_stream());
+      auto label_other_first =
+        thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), others.begin()));
+
+      thrust::for_each(handle.get_thrust_policy(),
+                       label_other_first,
+                       label_other_first + labels.size(),
+                       [parents = parents.data(), local_vertex_first] __device__(auto pair) {
+                         parents[thrust::get<0>(pair) - local_vertex_first] = thrust::get<1>(pair);
+                       });
+      auto other_parents = msf_collect_values<GraphViewType::is_multi_gpu>(
+        handle,
+        unique_others.data(),
+        static_cast<vertex_t>(unique_others.size()),
+        parents.data(),
+        vertex_partition_lasts);
+
+      auto tree_edge_first = thrust::make_zip_iterator(
+        thrust::make_tuple(best_srcs.begin(), best_dsts.begin(), best_weights.begin()));
+      thrust::transform(
+        handle.get_thrust_policy(),
+        label_other_first,
+        label_other_first + labels.size(),
+        others.begin(),
+        [unique_other_first = unique_others.begin(),
+         unique_other_last  = unique_others.end(),
+         other_parents      = other_parents.data()] __device__(auto pair) {
+          auto label        = thrust::get<0>(pair);
+          auto other        = thrust::get<1>(pair);
+          auto other_parent = other_parents[thrust::distance(
+            unique_other_first,
+            thrust::lower_bound(thrust::seq, unique_other_first, unique_other_last, other))];
+          return ((other_parent == label) && (label < other)) ? label : other;
+        });
+      thrust::for_each(handle.get_thrust_policy(),
+                       label_other_first,
+                       label_other_first + labels.size(),
+                       [parents = parents.data(), local_vertex_first] __device__(auto pair) {
+                         parents[thrust::get<0>(pair) - local_vertex_first] = thrust::get<1>(pair);
+                       });
+
+      // 3-3. add the edges of the hooked supervertices to the forest
+
+      auto num_tree_edges = static_cast<size_t>(thrust::distance(
+        tree_edge_first,
+        thrust::remove_if(
+          handle.get_thrust_policy(),
+          tree_edge_first,
+          tree_edge_first + labels.size(),
+          label_other_first,
+          [] __device__(auto pair) { return thrust::get<0>(pair) == thrust::get<1>(pair); })));
+      auto old_size = forest_srcs.size();
+      forest_srcs.resize(old_size + num_tree_edges, handle.get_stream());
+      forest_dsts.resize(forest_srcs.size(), handle.get_stream());
+      forest_weights.resize(forest_srcs.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   tree_edge_first,
+                   tree_edge_first + num_tree_edges,
+                   thrust::make_zip_iterator(thrust::make_tuple(forest_srcs.begin(),
+                                                                forest_dsts.begin(),
+                                                                forest_weights.begin())) +
+                     old_size);
+    }
+
+    // 3-4. contract the hooked trees (pointer jumping over the supervertices of this round)
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      rmm::device_uvector<vertex_t> cur_parents(labels.size(), handle.get_stream());
+      while (true) {
+        thrust::transform(handle.get_thrust_policy(),
+                          labels.begin(),
+                          labels.end(),
+                          cur_parents.begin(),
+                          [parents = parents.data(), local_vertex_first] __device__(auto l) {
+                            return parents[l - local_vertex_first];
+                          });
+        msf_relabel<GraphViewType::is_multi_gpu>(handle,
+                                                 cur_parents.begin(),
+                                                 cur_parents.end(),
+                                                 parents.data(),
+                                                 vertex_partition_lasts);
+        auto num_updates = static_cast<size_t>(thrust::count_if(
+          handle.get_thrust_policy(),
+          thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), cur_parents.begin())),
+          thrust::make_zip_iterator(thrust::make_tuple(labels.end(), cur_parents.end())),
+          [parents = parents.data(), local_vertex_first] __device__(auto pair) {
+            return parents[thrust::get<0>(pair) - local_vertex_first] != thrust::get<1>(pair);
+          }));
+        num_updates = host_scalar_allreduce(
+          handle.get_comms(), num_updates, raft::comms::op_t::SUM, handle.get_stream());
+        if (num_updates == 0) { break; }
+        thrust::for_each(
+          handle.get_thrust_policy(),
+          thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), cur_parents.begin())),
+          thrust::make_zip_iterator(thrust::make_tuple(labels.end(), cur_parents.end())),
+          [parents = parents.data(), local_vertex_first] __device__(auto pair) {
+            parents[thrust::get<0>(pair) - local_vertex_first] = thrust::get<1>(pair);
+          });
+      }
+    } else {
+      thrust::for_each(handle.get_thrust_policy(),
+                       labels.begin(),
+                       labels.end(),
+                       [parents = parents.data()] __device__(auto l) {
+                         auto root = parents[l];
+                         while (parents[root] != root) {
+                           root = parents[root];
+                         }
+                         parents[l] = root;
+                       });
+    }
+
+    // 3-5. relabel the edges, drop the edges inside the supervertices, and keep only the minimum
+    // weight edge between each pair of supervertices (in each GPU)
+
+    msf_relabel<GraphViewType::is_multi_gpu>(
+      handle, src_labels.begin(), src_labels.end(), parents.data(), vertex_partition_lasts);
+    msf_relabel<GraphViewType::is_multi_gpu>(
+      handle, dst_labels.begin(), dst_labels.end(), parents.data(), vertex_partition_lasts);
+
+    auto label_pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(src_labels.begin(), dst_labels.begin()));
+    thrust::transform(handle.get_thrust_policy(),
+                      label_pair_first,
+                      label_pair_first + num_edges,
+                      label_pair_first,
+                      [] __device__(auto pair) {
+                        auto lhs = thrust::get<0>(pair);
+                        auto rhs = thrust::get<1>(pair);
+                        return lhs <= rhs ? thrust::make_tuple(lhs, rhs)
+                                          : thrust::make_tuple(rhs, lhs);
+                      });
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(
+      src_labels.begin(), dst_labels.begin(), weights.begin(), srcs.begin(), dsts.begin()));
+    auto num_remaining_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        edge_first,
+                        edge_first + num_edges,
+                        [] __device__(auto e) { return thrust::get<0>(e) == thrust::get<1>(e); })));
+    thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + num_remaining_edges);
+    num_remaining_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::unique(handle.get_thrust_policy(),
+                     edge_first,
+                     edge_first + num_remaining_edges,
+                     [] __device__(auto lhs, auto rhs) {
+                       return (thrust::get<0>(lhs) == thrust::get<0>(rhs)) &&
+                              (thrust::get<1>(lhs) == thrust::get<1>(rhs));
+                     })));
+    src_labels.resize(num_remaining_edges, handle.get_stream());
+    dst_labels.resize(num_remaining_edges, handle.get_stream());
+    weights.resize(num_remaining_edges, handle.get_stream());
+    srcs.resize(num_remaining_edges, handle.get_stream());
+    dsts.resize(num_remaining_edges, handle.get_stream());
+    src_labels.shrink_to_fit(handle.get_stream());
+    dst_labels.shrink_to_fit(handle.get_stream());
+    weights.shrink_to_fit(handle.get_stream());
+    srcs.shrink_to_fit(handle.get_stream());
+    dsts.shrink_to_fit(handle.get_stream());
+
+    ++round;
+  }
+
+  return std::make_tuple(
+    std::move(forest_srcs), std::move(forest_dsts), std::move(forest_weights));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+minimum_spanning_forest(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check)
+{
+  return detail::minimum_spanning_forest(handle, graph_view, do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime.h>
+
+namespace cugraph {
+namespace detail {
+
+// returns true if the iterations of an algorithm on graph_view can be captured into a CUDA graph
+// with a positive capture interval, the edge tiling (managed memory edges) and the hub chunk
+// reduction synchronize the stream
+template <typename GraphViewType>
+bool is_iteration_capturable(raft::handle_t const& handle,
+                             GraphViewType const& graph_view,
+                             size_t capture_interval)
+{
+  return !GraphViewType::is_multi_gpu && (capture_interval > 0) &&
+         !handle.get_stream_view().is_default() && !graph_view.get_edge_tile_size() &&
+         (graph_view.get_hub_split() == nullptr);
+}
+
+// an iteration captured into a CUDA graph and replayed on the capture stream, the captured function
+// should enqueue its work on the stream (or on streams joined back to the stream) without
+// allocating memory or synchronizing, and the addresses it accesses should stay valid
+class captured_iteration_t {
+ public:
+  template <typename IterationFunc>
+  captured_iteration_t(rmm::cuda_stream_view stream_view, IterationFunc iteration)
+    : stream_view_(stream_view)
+  {
+    CUDA_TRY(cudaStreamBeginCapture(stream_view_.value(), cudaStreamCaptureModeThreadLocal));
+    try {
+      iteration();
+    } catch (...) {
+      cudaGraph_t graph{nullptr};
+      cudaStreamEndCapture(stream_view_.value(), &graph);
+      if (graph != nullptr) { cudaGraphDestroy(graph); }
+      throw;
+    }
+    CUDA_TRY(cudaStreamEndCapture(stream_view_.value(), &graph_));
+    auto status = cudaGraphInstantiate(&graph_exec_, graph_, nullptr, nullptr, 0);
+    if (status != cudaSuccess) {
+      cudaGraphDestroy(graph_);
+      CUGRAPH_FAIL("Failed to instantiate the captured iteration.");
+    }
+  }
+
+  captured_iteration_t(captured_iteration_t const&) = delete;
+  captured_iteration_t& operator=(captured_iteration_t const&) = delete;
+
+  ~captured_iteration_t()
+  {
+    cudaGraphExecDestroy(graph_exec_);
+    cudaGraphDestroy(graph_);
+  }
+
+  void replay() { CUDA_TRY(cudaGraphLaunch(graph_exec_, stream_view_.value())); }
+
+ private:
+  rmm::cuda_stream_view stream_view_{};
+  cudaGraph_t graph_{nullptr};
+  cudaGraphExec_t graph_exec_{nullptr};
+};
+
+}  // namespace detail
+}  // namespace cugraph
@@ -42,7 +42,9 @@
 #include <thrust/reduce.h>
 #include <thrust/scatter.h>
 
+#include <memory>
 #include <numeric>
+#include <typeindex>
 #include <vector>
 
 namespace cugraph {
@@ -123,7 +125,7 @@ template <typename vertex_t,
           bool transposed,
           bool multi_gpu,
           std::enable_if_t<multi_gpu>* = nullptr>
-std::unique_ptr<graph_t<vertex_t, edge_t, weight_t, transposed, multi_gpu>> create_graph(
+std::unique_ptr<graph_t<vertex_t, edge_t, weight_t, transposed, multi_gpu>> build_graph(
   raft::handle_t const& handle, graph_container_t const& graph_container)
 {
   auto num_local_partitions = static_cast<size_t>(graph_container.col_comm_size);
@@ -182,7 +184,7 @@ template <typename vertex_t,
           bool transposed,
           bool multi_gpu,
           std::enable_if_t<!multi_gpu>* = nullptr>
-std::unique_ptr<graph_t<vertex_t, edge_t, weight_t, transposed, multi_gpu>> create_graph(
+std::unique_ptr<graph_t<vertex_t, edge_t, weight_t, transposed, multi_gpu>> build_graph(
   raft::handle_t const& handle, graph_container_t const& graph_container)
 {
   edgelist_t<vertex_t, edge_t, weight_t> edgelist{
@@ -207,8 +209,59 @@ std::unique_ptr<graph_t<vertex_t, edge_t, weight_t, transposed, multi_gpu>> crea
     graph_container.do_expensive_check);
 }
 
+// Returns the graph_t instance cached in graph_container if one was built by an earlier call with
+// the same template parameters from the same data_version of the primitive data, otherwise builds
+// one (and caches it if graph_container has a persistent graph handle). A cached graph_t is built
+// with (and its views use) the persistent graph handle, an uncached graph_t is built with
+// @p handle.
+template <typename vertex_t, typename edge_t, typename weight_t, bool transposed, bool multi_gpu>
+std::shared_ptr<graph_t<vertex_t, edge_t, weight_t, transposed, multi_gpu>> create_graph(
+  raft::handle_t const& handle, graph_container_t const& graph_container)
+{
+  using graph_type = graph_t<vertex_t, edge_t, weight_t, transposed, multi_gpu>;
+
+  if (!graph_container.graph_handle) {
+    return std::shared_ptr<graph_type>(
+      build_graph<vertex_t, edge_t, weight_t, transposed, multi_gpu>(handle, graph_container));
+  }
+
+  auto key = std::type_index(typeid(graph_type));
+  auto it  = graph_container.graph_cache.find(key);
+  if ((it != graph_container.graph_cache.end()) &&
+      (it->second.data_version == graph_container.data_version)) {
+    return std::static_pointer_cast<graph_type>(it->second.graph);
+  }
+
+  // the graph_t is built on the persistent graph handle's stream, order it with the work on the
+  // wrapper's stream (e.g. producing the primitive data) before and after
+  auto const& graph_handle = *(graph_container.graph_handle);
+  handle.get_stream_view().synchronize();
+  auto graph = std::shared_ptr<graph_type>(
+    build_graph<vertex_t, edge_t, weight_t, transposed, multi_gpu>(graph_handle, graph_container));
+  graph_handle.get_stream_view().synchronize();
+  graph_container.graph_cache[key] =
+    graph_container_t::cached_graph_t{graph, graph_container.data_version};
+  return graph;
+}
+
 }  // namespace detail
 
+// Releases the graph_t instances cached in a graph_container_t (graph_t instances still in use by a
+// wrapper call are released once the call returns).
+void release_graph_container_cache(graph_container_t& graph_container)
+{
+  graph_container.graph_cache.clear();
+}
+
+// Sets the persistent handle cached graph_t instances are built with, the graph_t instances built
+// with the previous handle are released.
+void set_graph_container_handle(graph_container_t& graph_container,
+                                std::shared_ptr<raft::handle_t const> handle)
+{
+  graph_container.graph_cache.clear();
+  graph_container.graph_handle = std::move(handle);
+}
+
 // Populates a graph_container_t with a pointer to a new graph object and sets
 // the meta-data accordingly.  The graph container owns the pointer and it is
 // assumed it will delete it on destruction.
@@ -269,6 +322,8 @@ void populate_graph_container(graph_container_t& graph_container,
   graph_properties_t graph_props{.is_symmetric = is_symmetric, .is_multigraph = false};
   graph_container.graph_props = graph_props;
 
+  graph_container.graph_cache.clear();
+
   graph_container.graph_type = graphTypeEnum::graph_t;
 }
 
@@ -1297,7 +1352,15 @@ std::unique_ptr<renum_tuple_t<vertex_t, edge_t>> call_renumber(
 
     cugraph::renumber_meta_t<vertex_t, edge_t, true> meta{};
     std::tie(p_ret->get_dv(), meta) = cugraph::renumber_edgelist<vertex_t, edge_t, true>(
-      handle, std::nullopt, major_ptrs, minor_ptrs, edge_counts, std::nullopt, do_expensive_check);
+      handle,
+      std::nullopt,
+      major_ptrs,
+      minor_ptrs,
+      edge_counts,
+      std::nullopt,
+      cugraph::renumber_order_t::degree,
+      std::nullopt,
+      do_expensive_check);
     p_ret->get_num_vertices()    = meta.number_of_vertices;
     p_ret->get_num_edges()       = meta.number_of_edges;
     p_ret->get_partition()       = meta.partition;
@@ -1310,6 +1373,8 @@ std::unique_ptr<renum_tuple_t<vertex_t, edge_t>> call_renumber(
                                                           shuffled_edgelist_major_vertices,
                                                           shuffled_edgelist_minor_vertices,
                                                           edge_counts[0],
+                                                          cugraph::renumber_order_t::degree,
+                                                          std::nullopt,
                                                           do_expensive_check);
 
     p_ret->get_num_vertices()    = static_cast<vertex_t>(p_ret->get_dv().size());
@@ -22,23 +22,65 @@ namespace cugraph {
 namespace broadcast {
 // Manual template instantiations (EIDir's):
 //
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template graph_t<int32_t, int32_t, float, false, false> graph_broadcast(
   raft::handle_t const& handle, graph_t<int32_t, int32_t, float, false, false>* graph_ptr);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template graph_t<int32_t, int64_t, float, false, false> graph_broadcast(
   raft::handle_t const& handle, graph_t<int32_t, int64_t, float, false, false>* graph_ptr);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template graph_t<int64_t, int64_t, float, false, false> graph_broadcast(
   raft::handle_t const& handle, graph_t<int64_t, int64_t, float, false, false>* graph_ptr);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template graph_t<int32_t, int32_t, double, false, false> graph_broadcast(
   raft::handle_t const& handle, graph_t<int32_t, int32_t, double, false, false>* graph_ptr);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template graph_t<int32_t, int64_t, double, false, false> graph_broadcast(
   raft::handle_t const& handle, graph_t<int32_t, int64_t, double, false, false>* graph_ptr);
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template graph_t<int64_t, int64_t, double, false, false> graph_broadcast(
   raft::handle_t const& handle, graph_t<int64_t, int64_t, double, false, false>* graph_ptr);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
+template graph_t<int32_t, int32_t, float, true, false> graph_broadcast(
+  raft::handle_t const& handle, graph_t<int32_t, int32_t, float, true, false>* graph_ptr);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
+template graph_t<int32_t, int64_t, float, true, false> graph_broadcast(
+  raft::handle_t const& handle, graph_t<int32_t, int64_t, float, true, false>* graph_ptr);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
+template graph_t<int64_t, int64_t, float, true, false> graph_broadcast(
+  raft::handle_t const& handle, graph_t<int64_t, int64_t, float, true, false>* graph_ptr);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
+template graph_t<int32_t, int32_t, double, true, false> graph_broadcast(
+  raft::handle_t const& handle, graph_t<int32_t, int32_t, double, true, false>* graph_ptr);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
+template graph_t<int32_t, int64_t, double, true, false> graph_broadcast(
+  raft::handle_t const& handle, graph_t<int32_t, int64_t, double, true, false>* graph_ptr);
+#endif
+
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
+template graph_t<int64_t, int64_t, double, true, false> graph_broadcast(
+  raft::handle_t const& handle, graph_t<int64_t, int64_t, double, true, false>* graph_ptr);
+#endif
 
 }  // namespace broadcast
 }  // namespace cugraph
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/local_multi_gpu.hpp>
+
+#include <raft/comms/std_comms.hpp>
+#include <raft/cudart_utils.h>
+
+#include <cmath>
+#include <numeric>
+
+namespace cugraph {
+
+local_multi_gpu_t::local_multi_gpu_t(std::optional<std::vector<int>> devices,
+                                     std::optional<int> row_comm_size)
+{
+  if (devices) {
+    devices_ = std::move(*devices);
+  } else {
+    int num_devices{0};
+    CUDA_TRY(cudaGetDeviceCount(&num_devices));
+    devices_.resize(num_devices);
+    std::iota(devices_.begin(), devices_.end(), int{0});
+  }
+  auto const comm_size = static_cast<int>(devices_.size());
+  CUGRAPH_EXPECTS(comm_size > 0, "Invalid input argument: devices should not be empty.");
+
+  if (!row_comm_size) {
+    row_comm_size = static_cast<int>(std::sqrt(static_cast<double>(comm_size)));
+    while (comm_size % *row_comm_size != 0) {
+      --(*row_comm_size);
+    }
+  }
+  CUGRAPH_EXPECTS((*row_comm_size > 0) && (comm_size % *row_comm_size == 0),
+                  "Invalid input argument: row_comm_size should divide the number of GPUs.");
+
+  int current_device{0};
+  CUDA_TRY(cudaGetDevice(&current_device));
+
+  nccl_comms_.resize(comm_size);
+  CUGRAPH_EXPECTS(ncclCommInitAll(nccl_comms_.data(), comm_size, devices_.data()) == ncclSuccess,
+                  "ncclCommInitAll() failure.");
+
+  handles_.resize(comm_size);
+  for (int i = 0; i < comm_size; ++i) {
+    set_device(i);  // the handle's resources are created on the current device
+    handles_[i] = std::make_unique<raft::handle_t>();
+    raft::comms::build_comms_nccl_only(handles_[i].get(), nccl_comms_[i], comm_size, i);
+  }
+
+  // splitting the communicators is a collective operation
+  subcomm_factories_.resize(comm_size);
+  run([this, row_comm_size](raft::handle_t& handle, int rank) {
+    subcomm_factories_[rank] =
+      std::make_unique<partition_2d::subcomm_factory_t<partition_2d::key_naming_t, int>>(
+        handle, *row_comm_size);
+  });
+
+  CUDA_TRY(cudaSetDevice(current_device));
+}
+
+local_multi_gpu_t::~local_multi_gpu_t()
+{
+  int current_device{0};
+  cudaGetDevice(&current_device);
+  for (size_t i = 0; i < handles_.size(); ++i) {
+    cudaSetDevice(devices_[i]);
+    subcomm_factories_[i].reset();
+    handles_[i].reset();
+    ncclCommDestroy(nccl_comms_[i]);
+  }
+  cudaSetDevice(current_device);
+}
+
+void local_multi_gpu_t::set_device(int rank) const { CUDA_TRY(cudaSetDevice(devices_[rank])); }
+
+}  // namespace cugraph
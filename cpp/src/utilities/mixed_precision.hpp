@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <limits>
+
+namespace cugraph {
+namespace detail {
+
+// the float iterations of the mixed precision PageRank and Katz Centrality stop once the sum of the
+// changes drops below this ratio of the sum of the values, smaller changes are within the float
+// rounding error of the SpMV inputs
+double constexpr mixed_precision_switch_ratio = 64.0 * std::numeric_limits<float>::epsilon();
+
+}  // namespace detail
+}  // namespace cugraph
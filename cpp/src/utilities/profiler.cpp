@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/cudart_utils.h>
+
+#include <cuda_runtime.h>
+#include <nvtx3/nvToolsExt.h>
+
+#include <cstdlib>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+struct pending_phase_t {
+  std::string key{};
+  cudaEvent_t start{};
+  cudaEvent_t stop{};
+};
+
+struct open_phase_t {
+  std::string key{};
+  cudaEvent_t start{};
+};
+
+// phases complete on the GPU asynchronously, completed phases are folded into the statistics when
+// a phase stops (if the GPU is done with them) or when the statistics are queried
+struct profiler_state_t {
+  std::mutex mutex{};
+  std::map<std::string, profiler_t::phase_stats_t> phase_stats{};
+  std::map<std::string, int64_t> counters{};
+  std::vector<pending_phase_t> pending_phases{};
+  std::vector<cudaEvent_t> free_events{};
+
+  cudaEvent_t acquire_event()
+  {
+    cudaEvent_t event{};
+    if (free_events.size() > 0) {
+      event = free_events.back();
+      free_events.pop_back();
+    } else {
+      CUDA_TRY(cudaEventCreate(&event));
+    }
+    return event;
+  }
+
+  // folds the pending phases that completed (or all the pending phases if wait is true)
+  void fold_pending_phases(bool wait)
+  {
+    size_t num_remaining{0};
+    for (size_t i = 0; i < pending_phases.size(); ++i) {
+      auto& phase = pending_phases[i];
+      if (wait) {
+        CUDA_TRY(cudaEventSynchronize(phase.stop));
+      } else {
+        auto status = cudaEventQuery(phase.stop);
+        if (status == cudaErrorNotReady) {  // not done yet
+          if (num_remaining != i) { pending_phases[num_remaining] = std::move(phase); }
+          ++num_remaining;
+          continue;
+        }
+        CUDA_TRY(status);
+      }
+      float elapsed_ms{0.0};
+      CUDA_TRY(cudaEventElapsedTime(&elapsed_ms, phase.start, phase.stop));
+      auto& stats = phase_stats[phase.key];
+      ++stats.num_calls;
+      stats.total_elapsed_ms += elapsed_ms;
+      free_events.push_back(phase.start);
+      free_events.push_back(phase.stop);
+    }
+    pending_phases.resize(num_remaining);
+  }
+};
+
+profiler_state_t& get_profiler_state()
+{
+  static profiler_state_t state{};
+  return state;
+}
+
+thread_local std::vector<open_phase_t> open_phases{};
+
+nvtxDomainHandle_t get_nvtx_domain()
+{
+  static nvtxDomainHandle_t domain = nvtxDomainCreateA("cugraph");
+  return domain;
+}
+
+std::string get_key(std::string const& name)
+{
+  return open_phases.size() > 0 ? open_phases.back().key + "/" + name : name;
+}
+
+}  // namespace
+
+profiler_t::profiler_t()
+{
+  auto env = std::getenv("CUGRAPH_PROFILE");
+  enabled_.store((env != nullptr) && (std::atoi(env) != 0), std::memory_order_relaxed);
+  env = std::getenv("CUGRAPH_NVTX");
+  nvtx_enabled_.store((env != nullptr) && (std::atoi(env) != 0), std::memory_order_relaxed);
+}
+
+profiler_t& profiler_t::get()
+{
+  static profiler_t profiler{};
+  return profiler;
+}
+
+void profiler_t::reset()
+{
+  auto& state = get_profiler_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.fold_pending_phases(true);
+  state.phase_stats.clear();
+  state.counters.clear();
+}
+
+std::map<std::string, profiler_t::phase_stats_t> profiler_t::get_phase_stats()
+{
+  auto& state = get_profiler_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.fold_pending_phases(true);
+  return state.phase_stats;
+}
+
+std::map<std::string, int64_t> profiler_t::get_counters()
+{
+  auto& state = get_profiler_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.counters;
+}
+
+void profiler_t::add_counter(std::string const& name, int64_t delta)
+{
+  auto key    = get_key(name);
+  auto& state = get_profiler_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.counters[key] += delta;
+}
+
+void profiler_t::report(std::ostream& os)
+{
+  auto phase_stats = get_phase_stats();
+  auto counters    = get_counters();
+  os << "cuGraph profile (GPU time in ms):" << std::endl;
+  for (auto const& [key, stats] : phase_stats) {
+    os << "   " << key << " called " << stats.num_calls << " times, total time "
+       << stats.total_elapsed_ms << ", average time "
+       << stats.total_elapsed_ms / static_cast<double>(stats.num_calls) << std::endl;
+  }
+  for (auto const& [key, value] : counters) {
+    os << "   " << key << ": " << value << std::endl;
+  }
+}
+
+void profiler_t::push_nvtx_range(char const* name)
+{
+  nvtxEventAttributes_t attributes{};
+  attributes.version       = NVTX_VERSION;
+  attributes.size          = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+  attributes.messageType   = NVTX_MESSAGE_TYPE_ASCII;
+  attributes.message.ascii = name;
+  nvtxDomainRangePushEx(get_nvtx_domain(), &attributes);
+}
+
+void profiler_t::pop_nvtx_range() { nvtxDomainRangePop(get_nvtx_domain()); }
+
+void profiler_t::start_phase(std::string const& name, rmm::cuda_stream_view stream_view)
+{
+  push_nvtx_range(name.c_str());
+
+  auto key = get_key(name);
+
+  cudaEvent_t start{};
+  {
+    auto& state = get_profiler_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    start = state.acquire_event();
+  }
+  CUDA_TRY(cudaEventRecord(start, stream_view.value()));
+  open_phases.push_back(open_phase_t{std::move(key), start});
+}
+
+void profiler_t::stop_phase(rmm::cuda_stream_view stream_view)
+{
+  if (open_phases.size() == 0) { return; }  // unmatched stop_phase()
+  auto phase = std::move(open_phases.back());
+  open_phases.pop_back();
+  pop_nvtx_range();
+
+  auto& state = get_profiler_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  auto stop = state.acquire_event();
+  CUDA_TRY(cudaEventRecord(stop, stream_view.value()));
+  state.pending_phases.push_back(pending_phase_t{std::move(phase.key), phase.start, stop});
+  state.fold_pending_phases(false);
+}
+
+}  // namespace cugraph
@@ -13,11 +13,105 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <raft/spectral/matrix_wrappers.hpp>
 #include "spmv_1D.cuh"
 
+#include <cugraph/utilities/device_comm.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/gather.h>
+#include <thrust/pair.h>
+#include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <tuple>
+
 namespace cugraph {
 namespace mg {
+namespace {
+
+int32_t constexpr merge_path_spmv_block_size = 128;
+// # merge items (row ends + non-zeros) consumed by a thread
+int32_t constexpr merge_path_spmv_items_per_thread = 8;
+
+// the (row, non-zero) coordinate where the merge path of the row end offsets and the non-zero
+// indices crosses the diagonal
+template <typename vertex_t, typename edge_t>
+__device__ thrust::pair<vertex_t, edge_t> merge_path_search(edge_t diagonal,
+                                                             edge_t const* row_end_offsets,
+                                                             vertex_t num_rows,
+                                                             edge_t nnz)
+{
+  auto x_min = static_cast<vertex_t>(diagonal > nnz ? diagonal - nnz : edge_t{0});
+  auto x_max = static_cast<vertex_t>(diagonal < num_rows ? diagonal : num_rows);
+  while (x_min < x_max) {
+    auto pivot = x_min + (x_max - x_min) / 2;
+    if (row_end_offsets[pivot] <= diagonal - pivot - 1) {
+      x_min = pivot + 1;
+    } else {
+      x_max = pivot;
+    }
+  }
+  return thrust::make_pair(x_min, static_cast<edge_t>(diagonal - x_min));
+}
+
+// y should be zero initialized, a row split between threads is accumulated with atomics
+template <typename vertex_t, typename edge_t, typename weight_t>
+__global__ void merge_path_spmv(edge_t const* offsets,
+                                vertex_t const* indices,
+                                weight_t const* values,
+                                weight_t const* x,
+                                weight_t* y,
+                                vertex_t num_rows,
+                                edge_t nnz)
+{
+  auto num_items  = static_cast<edge_t>(num_rows) + nnz;
+  auto tid        = static_cast<edge_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  auto diag_first = tid * merge_path_spmv_items_per_thread;
+  if (diag_first >= num_items) { return; }
+  auto diag_last = diag_first + std::min(num_items - diag_first,
+                                         static_cast<edge_t>(merge_path_spmv_items_per_thread));
+
+  auto first            = merge_path_search(diag_first, offsets + 1, num_rows, nnz);
+  auto last             = merge_path_search(diag_last, offsets + 1, num_rows, nnz);
+  auto row              = first.first;
+  auto k                = first.second;
+  auto row_last         = last.first;
+  auto k_last           = last.second;
+  auto shares_first_row = k > offsets[row];  // the previous thread has a part of the row
+  weight_t sum{0.0};
+  for (; row < row_last; ++row) {
+    for (; k < offsets[row + 1]; ++k) {
+      sum += values[k] * x[indices[k]];
+    }
+    if (shares_first_row) {
+      atomicAdd(y + row, sum);
+      shares_first_row = false;
+    } else {
+      y[row] = sum;
+    }
+    sum = weight_t{0.0};
+  }
+  if (k < k_last) {  // carry out the partial sum of a row continued by the next thread
+    for (; k < k_last; ++k) {
+      sum += values[k] * x[indices[k]];
+    }
+    atomicAdd(y + row_last, sum);
+  }
+}
+
+}  // namespace
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 MGcsrmv<vertex_t, edge_t, weight_t>::MGcsrmv(raft::handle_t const& handle,
                                              vertex_t* local_vertices,
@@ -31,16 +125,92 @@ MGcsrmv<vertex_t, edge_t, weight_t>::MGcsrmv(raft::handle_t const& handle,
     part_off_(part_off),
     off_(off),
     ind_(ind),
-    val_(val)
+    val_(val),
+    y_loc_(0, handle.get_stream()),
+    ghosts_(0, handle.get_stream()),
+    send_rows_(0, handle.get_stream()),
+    send_values_(0, handle.get_stream()),
+    ghost_values_(0, handle.get_stream())
 {
-  i_      = handle_.get_comms().get_rank();
-  p_      = handle_.get_comms().get_size();
+  auto stream = handle_.get_stream();
+  auto const& comm{handle_.get_comms()};
+
+  i_      = comm.get_rank();
+  p_      = comm.get_size();
   v_glob_ = part_off_[p_ - 1] + local_vertices_[p_ - 1];
   v_loc_  = local_vertices_[i_];
-  vertex_t tmp;
-  CUDA_TRY(cudaMemcpy(&tmp, &off_[v_loc_], sizeof(vertex_t), cudaMemcpyDeviceToHost));
+  edge_t tmp;
+  CUDA_TRY(cudaMemcpy(&tmp, &off_[v_loc_], sizeof(edge_t), cudaMemcpyDeviceToHost));
   e_loc_ = tmp;
-  y_loc_.resize(v_loc_);
+  y_loc_.resize(v_loc_, stream);
+
+  // the ghost columns, sorted (so grouped by the owner) and without the local columns
+
+  ghosts_.resize(e_loc_, stream);
+  thrust::copy(handle_.get_thrust_policy(), ind_, ind_ + e_loc_, ghosts_.begin());
+  thrust::sort(handle_.get_thrust_policy(), ghosts_.begin(), ghosts_.end());
+  ghosts_.resize(
+    thrust::distance(ghosts_.begin(),
+                     thrust::unique(handle_.get_thrust_policy(), ghosts_.begin(), ghosts_.end())),
+    stream);
+  auto local_first = part_off_[i_];
+  auto local_last  = static_cast<vertex_t>(local_first + v_loc_);
+  ghosts_.resize(thrust::distance(ghosts_.begin(),
+                                  thrust::remove_if(handle_.get_thrust_policy(),
+                                                    ghosts_.begin(),
+                                                    ghosts_.end(),
+                                                    [local_first, local_last] __device__(auto v) {
+                                                      return (v >= local_first) && (v < local_last);
+                                                    })),
+                 stream);
+  ghosts_.shrink_to_fit(stream);
+
+  rmm::device_uvector<vertex_t> d_part_off(p_, stream);
+  raft::update_device(d_part_off.data(), part_off_, p_, stream);
+  rmm::device_uvector<size_t> d_ghost_offsets(p_, stream);
+  thrust::lower_bound(handle_.get_thrust_policy(),
+                      ghosts_.begin(),
+                      ghosts_.end(),
+                      d_part_off.begin(),
+                      d_part_off.end(),
+                      d_ghost_offsets.begin());
+  std::vector<size_t> ghost_offsets(p_ + 1, ghosts_.size());
+  raft::update_host(ghost_offsets.data(), d_ghost_offsets.data(), p_, stream);
+  handle_.get_stream_view().synchronize();
+  std::vector<size_t> ghost_counts(p_);
+  for (int r = 0; r < p_; ++r) {
+    ghost_counts[r] = ghost_offsets[r + 1] - ghost_offsets[r];
+  }
+
+  // send the ghost column IDs to the owners, the received IDs are the local rows to send back in
+  // every run
+
+  std::vector<size_t> send_counts{};
+  std::tie(send_rows_, send_counts) = shuffle_values(comm, ghosts_.begin(), ghost_counts, stream);
+  thrust::transform(handle_.get_thrust_policy(),
+                    send_rows_.begin(),
+                    send_rows_.end(),
+                    send_rows_.begin(),
+                    [local_first] __device__(auto v) { return v - local_first; });
+  send_values_.resize(send_rows_.size(), stream);
+  ghost_values_.resize(ghosts_.size(), stream);
+
+  size_t tx_offset{0};
+  size_t rx_offset{0};
+  for (int r = 0; r < p_; ++r) {
+    if (send_counts[r] > 0) {
+      tx_counts_.push_back(send_counts[r]);
+      tx_offsets_.push_back(tx_offset);
+      tx_dst_ranks_.push_back(r);
+      tx_offset += send_counts[r];
+    }
+    if (ghost_counts[r] > 0) {
+      rx_counts_.push_back(ghost_counts[r]);
+      rx_offsets_.push_back(rx_offset);
+      rx_src_ranks_.push_back(r);
+      rx_offset += ghost_counts[r];
+    }
+  }
 }
 
 template <typename vertex_t, typename edge_t, typename weight_t>
@@ -51,25 +221,55 @@ MGcsrmv<vertex_t, edge_t, weight_t>::~MGcsrmv()
 template <typename vertex_t, typename edge_t, typename weight_t>
 void MGcsrmv<vertex_t, edge_t, weight_t>::run(weight_t* x)
 {
-  using namespace raft::matrix;
+  auto stream = handle_.get_stream();
 
-  weight_t h_one  = 1.0;
-  weight_t h_zero = 0.0;
+  auto const& comm{handle_.get_comms()};  // local
 
-  sparse_matrix_t<vertex_t, weight_t> mat{handle_,                         // raft handle
-                                          off_,                            // CSR row_offsets
-                                          ind_,                            // CSR col_indices
-                                          val_,                            // CSR values
-                                          static_cast<vertex_t>(v_loc_),   // n_rows
-                                          static_cast<vertex_t>(v_glob_),  // n_cols
-                                          static_cast<vertex_t>(e_loc_)};  // nnz
+  thrust::fill(handle_.get_thrust_policy(), y_loc_.begin(), y_loc_.end(), weight_t{0.0});
+  auto num_items = v_loc_ + e_loc_;
+  if (num_items > 0) {
+    auto items_per_block =
+      static_cast<size_t>(merge_path_spmv_block_size) * merge_path_spmv_items_per_thread;
+    auto num_blocks = (num_items + items_per_block - 1) / items_per_block;
+    merge_path_spmv<<<num_blocks, merge_path_spmv_block_size, 0, stream>>>(
+      off_,
+      ind_,
+      val_,
+      x,
+      y_loc_.data(),
+      static_cast<vertex_t>(v_loc_),
+      static_cast<edge_t>(e_loc_));
+    CHECK_CUDA(stream);
+  }
 
-  mat.mv(h_one,                             // alpha
-         x,                                 // x
-         h_zero,                            // beta
-         y_loc_.data().get(),               // y
-         sparse_mv_alg_t::SPARSE_MV_ALG2);  // SpMV algorithm
+  // exchange the entries of the cut only
 
+  thrust::gather(handle_.get_thrust_policy(),
+                 send_rows_.begin(),
+                 send_rows_.end(),
+                 y_loc_.begin(),
+                 send_values_.begin());
+  device_multicast_sendrecv(comm,
+                            send_values_.begin(),
+                            tx_counts_,
+                            tx_offsets_,
+                            tx_dst_ranks_,
+                            ghost_values_.begin(),
+                            rx_counts_,
+                            rx_offsets_,
+                            rx_src_ranks_,
+                            stream);
+  thrust::scatter(handle_.get_thrust_policy(),
+                  ghost_values_.begin(),
+                  ghost_values_.end(),
+                  ghosts_.begin(),
+                  x);
+  thrust::copy(handle_.get_thrust_policy(), y_loc_.begin(), y_loc_.end(), x + part_off_[i_]);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void MGcsrmv<vertex_t, edge_t, weight_t>::allgather(weight_t* x)
+{
   auto stream = handle_.get_stream();
 
   auto const& comm{handle_.get_comms()};  // local
@@ -78,7 +278,7 @@ void MGcsrmv<vertex_t, edge_t, weight_t>::run(weight_t* x)
   std::vector<size_t> displs(comm.get_size());
   std::copy(local_vertices_, local_vertices_ + comm.get_size(), recvbuf.begin());
   std::copy(part_off_, part_off_ + comm.get_size(), displs.begin());
-  comm.allgatherv(y_loc_.data().get(), x, recvbuf.data(), displs.data(), stream);
+  comm.allgatherv(y_loc_.data(), x, recvbuf.data(), displs.data(), stream);
 }
 
 template class MGcsrmv<int32_t, int32_t, double>;
@@ -1,60 +1,86 @@
-/*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
- *
- * Licensed under the Apache License, Version 2.0 (the "License");
- * you may not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- *     http://www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
-#pragma once
-#include <cugraph/utilities/error.hpp>
-#include <raft/handle.hpp>
-#include <rmm/device_vector.hpp>
-
-namespace cugraph {
-namespace mg {
-
-template <typename vertex_t, typename edge_t, typename weight_t>
-class MGcsrmv {
- private:
-  size_t v_glob_;
-  size_t v_loc_;
-  size_t e_loc_;
-
-  raft::handle_t const& handle_;  // raft handle propagation for SpMV, etc.
-
-  vertex_t* part_off_;
-  vertex_t* local_vertices_;
-  int i_;
-  int p_;
-  edge_t* off_;
-  vertex_t* ind_;
-  weight_t* val_;
-  rmm::device_vector<weight_t> y_loc_;
-  std::vector<size_t> v_locs_h_;
-  std::vector<vertex_t> displs_h_;
-
- public:
-  MGcsrmv(raft::handle_t const& r_handle,
-          vertex_t* local_vertices,
-          vertex_t* part_off,
-          edge_t* row_off,
-          vertex_t* col_ind,
-          weight_t* vals,
-          weight_t* x);
-
-  ~MGcsrmv();
-
-  void run(weight_t* x);
-};
-
-}  // namespace mg
-}  // namespace cugraph
+/*
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cugraph/utilities/error.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <vector>
+
+namespace cugraph {
+namespace mg {
+
+// 1D partitioned SpMV, each rank owns a contiguous range of rows (and the matching entries of the
+// vector) and multiplies its rows with a merge-path kernel (load balanced over rows + non-zeros
+// regardless of the degree distribution). Only the vector entries referenced by the local rows
+// but owned by other ranks (the ghost columns, precomputed at construction) are exchanged, so the
+// per-iteration communication volume scales with the edge cut instead of the number of vertices.
+template <typename vertex_t, typename edge_t, typename weight_t>
+class MGcsrmv {
+ private:
+  size_t v_glob_;
+  size_t v_loc_;
+  size_t e_loc_;
+
+  raft::handle_t const& handle_;  // raft handle propagation for SpMV, etc.
+
+  vertex_t* part_off_;
+  vertex_t* local_vertices_;
+  int i_;
+  int p_;
+  edge_t* off_;
+  vertex_t* ind_;
+  weight_t* val_;
+  rmm::device_uvector<weight_t> y_loc_;
+  std::vector<size_t> v_locs_h_;
+  std::vector<vertex_t> displs_h_;
+
+  // ghost columns (global IDs, grouped by the owner) and the local rows requested by the others
+  rmm::device_uvector<vertex_t> ghosts_;
+  rmm::device_uvector<vertex_t> send_rows_;
+  rmm::device_uvector<weight_t> send_values_;
+  rmm::device_uvector<weight_t> ghost_values_;
+  std::vector<size_t> tx_counts_{};
+  std::vector<size_t> tx_offsets_{};
+  std::vector<int> tx_dst_ranks_{};
+  std::vector<size_t> rx_counts_{};
+  std::vector<size_t> rx_offsets_{};
+  std::vector<int> rx_src_ranks_{};
+
+ public:
+  MGcsrmv(raft::handle_t const& r_handle,
+          vertex_t* local_vertices,
+          vertex_t* part_off,
+          edge_t* row_off,
+          vertex_t* col_ind,
+          weight_t* vals,
+          weight_t* x);
+
+  ~MGcsrmv();
+
+  // x = A * x, on return x holds the product at the local rows and at the ghost columns (all the
+  // entries the next run reads), call allgather to update the remaining entries
+  void run(weight_t* x);
+
+  // fills every entry of x with the product computed by the last run
+  void allgather(weight_t* x);
+
+  size_t get_number_of_ghosts() const { return ghosts_.size(); }
+};
+
+}  // namespace mg
+}  // namespace cugraph
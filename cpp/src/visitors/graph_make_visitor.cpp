@@ -84,45 +84,93 @@ void graph_maker_visitor<vertex_t,
 
 // EIDir's:
 //
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template class graph_maker_visitor<int, int, float, true, true>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template class graph_maker_visitor<int, int, double, true, true>;
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template class graph_maker_visitor<int, int, float, true, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template class graph_maker_visitor<int, int, double, true, false>;
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template class graph_maker_visitor<int, int, float, false, true>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template class graph_maker_visitor<int, int, double, false, true>;
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_FLOAT
 template class graph_maker_visitor<int, int, float, false, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT32_DOUBLE
 template class graph_maker_visitor<int, int, double, false, false>;
+#endif
 
 //------
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template class graph_maker_visitor<int, long, float, true, true>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template class graph_maker_visitor<int, long, double, true, true>;
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template class graph_maker_visitor<int, long, float, true, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template class graph_maker_visitor<int, long, double, true, false>;
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template class graph_maker_visitor<int, long, float, false, true>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template class graph_maker_visitor<int, long, double, false, true>;
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_FLOAT
 template class graph_maker_visitor<int, long, float, false, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT32_INT64_DOUBLE
 template class graph_maker_visitor<int, long, double, false, false>;
+#endif
 
 //------
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template class graph_maker_visitor<long, long, float, true, true>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template class graph_maker_visitor<long, long, double, true, true>;
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template class graph_maker_visitor<long, long, float, true, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template class graph_maker_visitor<long, long, double, true, false>;
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template class graph_maker_visitor<long, long, float, false, true>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template class graph_maker_visitor<long, long, double, false, true>;
+#endif
 
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_FLOAT
 template class graph_maker_visitor<long, long, float, false, false>;
+#endif
+#ifndef CUGRAPH_NO_INSTANTIATE_INT64_INT64_DOUBLE
 template class graph_maker_visitor<long, long, double, false, false>;
+#endif
 
 }  // namespace visitors
 
@@ -30,8 +30,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cugraph/serialization/serializer.hpp>
 #include <cugraph/utilities/path_retrieval.hpp>
 
+#include <optional>
+
 ////////////////////////////////////////////////////////////////////////////////
 // Test param object. This defines the input and expected output for a test, and
 // will be instantiated as the parameter to the tests defined below using
@@ -39,11 +42,14 @@
 //
 struct GraphBcast_Usecase {
   std::string graph_file_full_path{};
+  std::optional<size_t> chunk_sz_bytes{std::nullopt};  // std::nullopt to use graph_broadcast()
 
   // FIXME:  We really should have a Graph_Testparms_Base class or something
   //         like that which can handle this graph_full_path thing.
   //
-  explicit GraphBcast_Usecase(std::string const& graph_file_path)
+  explicit GraphBcast_Usecase(std::string const& graph_file_path,
+                              std::optional<size_t> chunk_sz = std::nullopt)
+    : chunk_sz_bytes(chunk_sz)
   {
     if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
       graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
@@ -90,11 +96,17 @@ class GraphBcast_MG_Testfixture : public ::testing::TestWithParam<GraphBcast_Use
       cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
         handle, param.graph_file_full_path, true, /*renumber=*/false);
 
+    auto bcast = [&handle, &param](sg_graph_t* graph_ptr) {
+      return param.chunk_sz_bytes ? cugraph::serializer::serializer_t::broadcast(
+                                      handle, graph_ptr, 0, *(param.chunk_sz_bytes))
+                                  : graph_broadcast(handle, graph_ptr);
+    };
+
     if (comm_rank == 0) {
-      graph_broadcast(handle, &sg_graph);
+      bcast(&sg_graph);
     } else {
       sg_graph_t* g_ignore{nullptr};
-      auto graph_copy       = graph_broadcast(handle, g_ignore);
+      auto graph_copy       = bcast(g_ignore);
       auto [same, str_fail] = cugraph::test::compare_graphs(handle, sg_graph, graph_copy);
 
       if (!same) std::cerr << "Graph comparison failed on " << str_fail << '\n';
@@ -112,7 +124,10 @@ TEST_P(GraphBcast_MG_Testfixture, CheckInt32Int32Float)
 
 INSTANTIATE_TEST_SUITE_P(simple_test,
                          GraphBcast_MG_Testfixture,
-                         ::testing::Values(GraphBcast_Usecase("test/datasets/karate.mtx")
+                         ::testing::Values(GraphBcast_Usecase("test/datasets/karate.mtx"),
+                                           // chunk size not a multiple of the element sizes
+                                           GraphBcast_Usecase("test/datasets/karate.mtx", 100),
+                                           GraphBcast_Usecase("test/datasets/dolphins.mtx", 256)
                                            //,GraphBcast_Usecase("test/datasets/smallworld.mtx")
                                            ));
 
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/benchmark_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/legacy/graph.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <tuple>
+
+// Every benchmark runs an algorithm on an R-mat graph of the command line scale & edge factor
+// (symmetrized for the algorithms requiring a symmetric graph). The number of edges in the input
+// graph is reported as the edges processed per iteration (the algorithms iterate over the edges a
+// number of times depending on the input graph, so bytes moved is not reported).
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> construct_benchmark_graph(
+  raft::handle_t const& handle, bool weighted, bool symmetric)
+{
+  cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+      handle,
+      cugraph::test::benchmark_rmat_usecase(symmetric),
+      weighted,
+      true,
+      symmetric /* drop_self_loops */,
+      symmetric /* drop_multi_edges */);
+  return graph;
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_bfs(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  // symmetric, the direction optimizing BFS requires a symmetric graph
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false, true);
+  auto graph_view = graph.view();
+
+  bool const direction_optimizing = state.range(0) != 0;
+  rmm::device_uvector<vertex_t> distances(graph_view.get_number_of_vertices(), handle.get_stream());
+  rmm::device_uvector<vertex_t> predecessors(graph_view.get_number_of_vertices(),
+                                             handle.get_stream());
+  rmm::device_scalar<vertex_t> source(vertex_t{0}, handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::bfs(handle,
+                 graph_view,
+                 distances.data(),
+                 predecessors.data(),
+                 source.data(),
+                 size_t{1},
+                 direction_optimizing);
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+// the legacy (direction optimizing) BFS on the CSR of the same graph as BM_bfs, to compare the
+// implementations on the same input
+template <typename vertex_t, typename edge_t>
+void BM_legacy_bfs(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false, true);
+  auto graph_view = graph.view();
+
+  auto matrix_partition_view = graph_view.get_matrix_partition_view();
+  if (matrix_partition_view.get_compressed_indices()) {
+    state.SkipWithError("The legacy BFS requires uncompressed indices.");
+    return;
+  }
+  cugraph::legacy::GraphCSRView<vertex_t, edge_t, float> csr_view(
+    const_cast<edge_t*>(matrix_partition_view.get_offsets()),
+    const_cast<vertex_t*>(matrix_partition_view.get_indices()),
+    nullptr,
+    graph_view.get_number_of_vertices(),
+    graph_view.get_number_of_edges());
+
+  rmm::device_uvector<vertex_t> distances(graph_view.get_number_of_vertices(), handle.get_stream());
+  rmm::device_uvector<vertex_t> predecessors(graph_view.get_number_of_vertices(),
+                                             handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::bfs(handle,
+                 csr_view,
+                 distances.data(),
+                 predecessors.data(),
+                 static_cast<double*>(nullptr),
+                 vertex_t{0},
+                 false /* directed, direction optimizing if false */);
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_sssp(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, true, false);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<float> distances(graph_view.get_number_of_vertices(), handle.get_stream());
+  rmm::device_uvector<vertex_t> predecessors(graph_view.get_number_of_vertices(),
+                                             handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::sssp(handle, graph_view, distances.data(), predecessors.data(), vertex_t{0});
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_pagerank(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, true>(handle, false, false);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<float> pageranks(graph_view.get_number_of_vertices(), handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::pagerank<vertex_t, edge_t, float, float, false>(handle,
+                                                             graph_view,
+                                                             std::nullopt,
+                                                             std::nullopt,
+                                                             std::nullopt,
+                                                             std::nullopt,
+                                                             pageranks.data(),
+                                                             float{0.85},
+                                                             float{1e-6});
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_katz_centrality(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, true>(handle, false, false);
+  auto graph_view = graph.view();
+
+  auto const alpha = float{1.0} / static_cast<float>(graph_view.compute_max_in_degree(handle) + 1);
+  rmm::device_uvector<float> katz_centralities(graph_view.get_number_of_vertices(),
+                                               handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::katz_centrality(handle,
+                             graph_view,
+                             static_cast<float const*>(nullptr),
+                             katz_centralities.data(),
+                             alpha,
+                             float{1.0},
+                             float{1e-6});
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_weakly_connected_components(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false, true);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<vertex_t> components(graph_view.get_number_of_vertices(),
+                                           handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::weakly_connected_components(handle, graph_view, components.data());
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_core_number(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false, true);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<edge_t> core_numbers(graph_view.get_number_of_vertices(),
+                                           handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::core_number(
+      handle, graph_view, core_numbers.data(), cugraph::k_core_degree_type_t::OUT);
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_louvain(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, true, true);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<vertex_t> clustering(graph_view.get_number_of_vertices(),
+                                           handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    benchmark::DoNotOptimize(cugraph::louvain(handle, graph_view, clustering.data()));
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+#define CUGRAPH_ALGORITHM_BENCHMARK(func)                                                     \
+  BENCHMARK_TEMPLATE(func, int32_t, int32_t)->UseManualTime()->Unit(benchmark::kMillisecond); \
+  BENCHMARK_TEMPLATE(func, int64_t, int64_t)->UseManualTime()->Unit(benchmark::kMillisecond)
+
+// the argument is direction_optimizing (0: top-down only, 1: direction optimizing)
+BENCHMARK_TEMPLATE(BM_bfs, int32_t, int32_t)
+  ->ArgName("direction_optimizing")
+  ->Arg(0)
+  ->Arg(1)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_bfs, int64_t, int64_t)
+  ->ArgName("direction_optimizing")
+  ->Arg(0)
+  ->Arg(1)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+CUGRAPH_ALGORITHM_BENCHMARK(BM_legacy_bfs);
+CUGRAPH_ALGORITHM_BENCHMARK(BM_sssp);
+CUGRAPH_ALGORITHM_BENCHMARK(BM_pagerank);
+CUGRAPH_ALGORITHM_BENCHMARK(BM_katz_centrality);
+CUGRAPH_ALGORITHM_BENCHMARK(BM_weakly_connected_components);
+CUGRAPH_ALGORITHM_BENCHMARK(BM_core_number);
+CUGRAPH_ALGORITHM_BENCHMARK(BM_louvain);
+
+CUGRAPH_BENCHMARK_PROGRAM_MAIN()
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <utilities/cxxopts.hpp>
+#include <utilities/rmm_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace cugraph {
+namespace test {
+
+/**
+ * @brief Device memory resource adaptor tracking the number of bytes currently allocated (through
+ * this adaptor) and the peak since the last reset_peak() call.
+ *
+ * The benchmark main functions install this on top of the resource selected by --rmm_mode, and
+ * every benchmark resets the peak after constructing its input graph, so the reported peak is the
+ * input graph plus the working memory of the benchmarked function.
+ */
+class peak_memory_resource_adaptor_t final : public rmm::mr::device_memory_resource {
+ public:
+  explicit peak_memory_resource_adaptor_t(rmm::mr::device_memory_resource* upstream)
+    : upstream_(upstream)
+  {
+  }
+
+  size_t get_current_bytes() const { return current_bytes_.load(); }
+  size_t get_peak_bytes() const { return peak_bytes_.load(); }
+  void reset_peak() { peak_bytes_.store(current_bytes_.load()); }
+
+  bool supports_streams() const noexcept override { return upstream_->supports_streams(); }
+  bool supports_get_mem_info() const noexcept override
+  {
+    return upstream_->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    auto ptr     = upstream_->allocate(bytes, stream);
+    auto current = current_bytes_.fetch_add(bytes) + bytes;
+    auto peak    = peak_bytes_.load();
+    while ((current > peak) && !peak_bytes_.compare_exchange_weak(peak, current)) {}
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    upstream_->deallocate(ptr, bytes, stream);
+    current_bytes_.fetch_sub(bytes);
+  }
+
+  std::pair<size_t, size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override
+  {
+    return upstream_->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* upstream_{nullptr};
+  std::atomic<size_t> current_bytes_{0};
+  std::atomic<size_t> peak_bytes_{0};
+};
+
+// these variables are updated by command line arguments
+static size_t g_bench_rmat_scale{20};
+static size_t g_bench_rmat_edge_factor{16};
+
+static peak_memory_resource_adaptor_t* g_peak_memory_mr{nullptr};
+
+// R-mat graph of the command line scale & edge factor (the same parameters as the rmat benchmark
+// tests)
+inline Rmat_Usecase benchmark_rmat_usecase(bool undirected, bool multi_gpu = false)
+{
+  return Rmat_Usecase(g_bench_rmat_scale,
+                      g_bench_rmat_edge_factor,
+                      0.57,
+                      0.19,
+                      0.19,
+                      0,
+                      undirected,
+                      false,
+                      0,
+                      multi_gpu);
+}
+
+/**
+ * @brief Times a benchmark iteration (the lifetime of this object) for google benchmark's manual
+ * timing.
+ *
+ * The device is synchronized (and the processes are synchronized in multi-GPU) at both ends, so
+ * the iteration time covers the device work of the slowest process.
+ */
+class iteration_timer_t {
+ public:
+  iteration_timer_t(benchmark::State& state, raft::handle_t const& handle)
+    : state_(state), handle_(handle)
+  {
+    synchronize();
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  ~iteration_timer_t()
+  {
+    synchronize();
+    state_.SetIterationTime(
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+  }
+
+ private:
+  void synchronize()
+  {
+    CUDA_TRY(cudaDeviceSynchronize());
+    if (handle_.comms_initialized()) { handle_.get_comms().barrier(); }
+  }
+
+  benchmark::State& state_;
+  raft::handle_t const& handle_;
+  std::chrono::steady_clock::time_point start_{};
+};
+
+// call after setting up the benchmark input (and before the first iteration)
+inline void reset_peak_memory()
+{
+  if (g_peak_memory_mr != nullptr) { g_peak_memory_mr->reset_peak(); }
+}
+
+/**
+ * @brief Reports the edges processed per second, the bytes moved and the peak device memory usage
+ * (of this process) counters.
+ *
+ * @param state Google benchmark state.
+ * @param num_edges Number of edges processed per iteration (the number of edges of the entire
+ * graph in multi-GPU, 0 for the functions not iterating over edges).
+ * @param bytes_per_iteration Estimated number of device memory bytes read and written per
+ * iteration (0 if no estimate is available, in this case bytes/s is not reported).
+ */
+inline void set_benchmark_counters(benchmark::State& state,
+                                   double num_edges,
+                                   double bytes_per_iteration = 0.0)
+{
+  if (num_edges > 0.0) {
+    state.counters["edges_per_second"] =
+      benchmark::Counter(num_edges, benchmark::Counter::kIsIterationInvariantRate);
+  }
+  if (bytes_per_iteration > 0.0) {
+    state.SetBytesProcessed(static_cast<int64_t>(bytes_per_iteration) * state.iterations());
+  }
+  if (g_peak_memory_mr != nullptr) {
+    state.counters["peak_memory"] =
+      benchmark::Counter(static_cast<double>(g_peak_memory_mr->get_peak_bytes()),
+                         benchmark::Counter::kDefaults,
+                         benchmark::Counter::OneK::kIs1024);
+  }
+}
+
+}  // namespace test
+}  // namespace cugraph
+
+/**
+ * @brief Parses the cuGraph benchmark command line options (after google benchmark removes its
+ * own options).
+ *
+ * Currently supports 'rmm_mode', 'rmat_scale', and 'rmat_edge_factor'.
+ * 'rmm_mode` string paramater sets the rmm allocation mode. The default value of the parameter is
+ * 'pool'.
+ * 'rmat_scale' and 'rmat_edge_factor' integer parameters set the R-mat graph size (default 20 and
+ * 16).
+ *
+ * Example:
+ * ```
+ * ./PRIMS_BENCH --benchmark_filter=copy_v_transform_reduce --rmat_scale=24 --rmat_edge_factor=16
+ * ```
+ *
+ * @return Parsing results in the form of cxxopts::ParseResult
+ */
+inline auto parse_benchmark_options(int argc, char** argv)
+{
+  try {
+    cxxopts::Options options(argv[0], " - cuGraph benchmarks command line options");
+    options.allow_unrecognised_options().add_options()(
+      "rmm_mode", "RMM allocation mode", cxxopts::value<std::string>()->default_value("pool"))(
+      "rmat_scale", "R-mat scale", cxxopts::value<size_t>()->default_value("20"))(
+      "rmat_edge_factor", "R-mat edge factor", cxxopts::value<size_t>()->default_value("16"));
+
+    return options.parse(argc, argv);
+  } catch (const cxxopts::OptionException& e) {
+    CUGRAPH_FAIL("Error parsing command line options");
+  }
+}
+
+/**
+ * @brief Macro that sets up the rmm memory resource (with peak memory tracking) and the R-mat graph
+ * size from the command line and runs the registered google benchmarks.
+ */
+#define CUGRAPH_BENCHMARK_PROGRAM_MAIN()                                           \
+  int main(int argc, char** argv)                                                  \
+  {                                                                                \
+    ::benchmark::Initialize(&argc, argv);                                          \
+    auto const cmd_opts = parse_benchmark_options(argc, argv);                     \
+    auto const rmm_mode = cmd_opts["rmm_mode"].as<std::string>();                  \
+    auto resource       = cugraph::test::create_memory_resource(rmm_mode);         \
+    cugraph::test::peak_memory_resource_adaptor_t peak_mr(resource.get());         \
+    rmm::mr::set_current_device_resource(&peak_mr);                                \
+    cugraph::test::g_peak_memory_mr         = &peak_mr;                            \
+    cugraph::test::g_bench_rmat_scale       = cmd_opts["rmat_scale"].as<size_t>(); \
+    cugraph::test::g_bench_rmat_edge_factor =                                      \
+      cmd_opts["rmat_edge_factor"].as<size_t>();                                   \
+    ::benchmark::RunSpecifiedBenchmarks();                                         \
+    rmm::mr::set_current_device_resource(nullptr);                                 \
+    return 0;                                                                      \
+  }
@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Graph500 benchmark (single-GPU) following the Graph500 specification's kernel rules.
+//
+// 1. Generation (untimed): an R-mat edge list of 2^scale vertices and edge_factor * 2^scale edges
+//    with the Graph500 parameters (A = 0.57, B = 0.19, C = 0.19), Graph500 vertex ID scrambling,
+//    and uniform [0, 1) edge weights (for SSSP).
+// 2. Kernel 1 (timed): construction of the undirected graph from the edge list.
+// 3. Kernel 2 (timed per root): BFS from --num_roots (default 64) random roots with non-zero
+//    degree; every search is validated (the parent tree is checked against the BFS levels and the
+//    input edge list).
+// 4. Kernel 3 (timed per root): SSSP from the same roots, validated the same way with distances.
+//
+// TEPS counts the input edge tuples in the connected component of the root, and the results
+// are reported in the Graph500 output format (including the harmonic mean TEPS).
+//
+// Example:
+// ```
+// ./GRAPH500_BENCH --scale=24 --edge_factor=16
+// ```
+
+#include <utilities/cxxopts.hpp>
+#include <utilities/rmm_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_generators.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// synchronizes the device, returns the wall time in seconds
+double synchronize_and_get_time()
+{
+  CUDA_TRY(cudaDeviceSynchronize());
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+// validates a search result, returns the number of input edge tuples in the connected component
+// of the root (or nullopt if invalid).
+//
+// The checks follow the Graph500 specification: the root has distance 0 and no parent, every
+// other reached vertex has a reached parent with dist(parent) + w(parent, v) == dist(v) over an
+// input edge (parent, v) (w is 1 for BFS; with positive weights, distances decrease strictly along
+// the parent chains, so the parents form a tree rooted at the root), every input edge connects
+// two reached or two unreached vertices, and |dist(u) - dist(v)| <= w(u, v) for every input edge.
+template <typename vertex_t, typename weight_t, typename distance_t>
+std::optional<size_t> validate_search(raft::handle_t const& handle,
+                                      rmm::device_uvector<vertex_t> const& srcs,
+                                      rmm::device_uvector<vertex_t> const& dsts,
+                                      std::optional<rmm::device_uvector<weight_t>> const& weights,
+                                      vertex_t num_vertices,
+                                      vertex_t root,
+                                      distance_t const* distances,
+                                      vertex_t const* predecessors)
+{
+  auto constexpr invalid_distance = std::numeric_limits<distance_t>::max();
+  auto constexpr invalid_vertex   = cugraph::invalid_vertex_id<vertex_t>::value;
+  // tolerance for the floating point SSSP distances
+  auto const epsilon =
+    static_cast<distance_t>(std::is_floating_point_v<distance_t> ? 1e-4 : 0.0);
+
+  // 1. an input edge (u, v) validates the parent of v if parent(v) == u and dist(u) + w == dist(v)
+
+  rmm::device_uvector<uint8_t> parent_validated(num_vertices, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream_view()),
+               parent_validated.begin(),
+               parent_validated.end(),
+               uint8_t{0});
+
+  rmm::device_scalar<size_t> num_invalid_edges(size_t{0}, handle.get_stream());
+  rmm::device_scalar<size_t> num_component_edges(size_t{0}, handle.get_stream());
+  thrust::for_each(rmm::exec_policy(handle.get_stream_view()),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(srcs.size()),
+                   [srcs                = srcs.data(),
+                    dsts                = dsts.data(),
+                    weights             = weights ? weights->data() : nullptr,
+                    distances           = distances,
+                    predecessors        = predecessors,
+                    parent_validated    = parent_validated.data(),
+                    num_invalid_edges   = num_invalid_edges.data(),
+                    num_component_edges = num_component_edges.data(),
+                    epsilon] __device__(auto i) {
+                     auto u      = srcs[i];
+                     auto v      = dsts[i];
+                     auto w      = weights ? static_cast<distance_t>(weights[i]) : distance_t{1};
+                     auto u_dist = distances[u];
+                     auto v_dist = distances[v];
+                     if ((u_dist == invalid_distance) != (v_dist == invalid_distance)) {
+                       atomicAdd(num_invalid_edges, size_t{1});
+                       return;
+                     }
+                     if (u_dist == invalid_distance) { return; }
+                     atomicAdd(num_component_edges, size_t{1});
+                     if ((u_dist > v_dist + w + epsilon) || (v_dist > u_dist + w + epsilon)) {
+                       atomicAdd(num_invalid_edges, size_t{1});
+                     }
+                     // the input edge tuples are undirected
+                     auto diff = w - (v_dist - u_dist);
+                     if ((predecessors[v] == u) && (diff <= epsilon) && (diff >= -epsilon)) {
+                       parent_validated[v] = uint8_t{1};
+                     }
+                     diff = w - (u_dist - v_dist);
+                     if ((predecessors[u] == v) && (diff <= epsilon) && (diff >= -epsilon)) {
+                       parent_validated[u] = uint8_t{1};
+                     }
+                   });
+
+  // 2. every reached vertex but the root has a validated parent, the root has distance 0 and no
+  // parent, and unreached vertices have no parent
+
+  auto num_invalid_vertices = thrust::count_if(
+    rmm::exec_policy(handle.get_stream_view()),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(num_vertices),
+    [distances, predecessors, parent_validated = parent_validated.data(), root] __device__(
+      auto v) {
+      if (v == root) {
+        return (distances[v] != distance_t{0}) || (predecessors[v] != invalid_vertex);
+      } else if (distances[v] == invalid_distance) {
+        return predecessors[v] != invalid_vertex;
+      } else {
+        return parent_validated[v] == uint8_t{0};
+      }
+    });
+
+  if ((num_invalid_vertices > 0) || (num_invalid_edges.value(handle.get_stream()) > 0)) {
+    return std::nullopt;
+  }
+  return num_component_edges.value(handle.get_stream());
+}
+
+// Graph500 statistics (the quartiles are computed as in the reference implementation)
+void print_statistics(std::string const& prefix, std::vector<double> values, bool harmonic)
+{
+  std::sort(values.begin(), values.end());
+  auto n        = values.size();
+  auto quartile = [&values, n](size_t q) {
+    auto k = static_cast<double>(q * (n - 1)) / 4.0;
+    auto i = static_cast<size_t>(std::floor(k));
+    return (i + 1 < n) ? values[i] + (k - static_cast<double>(i)) * (values[i + 1] - values[i])
+                       : values[i];
+  };
+  std::cout << "min_" << prefix << ": " << values.front() << std::endl;
+  std::cout << "firstquartile_" << prefix << ": " << quartile(1) << std::endl;
+  std::cout << "median_" << prefix << ": " << quartile(2) << std::endl;
+  std::cout << "thirdquartile_" << prefix << ": " << quartile(3) << std::endl;
+  std::cout << "max_" << prefix << ": " << values.back() << std::endl;
+  if (harmonic) {
+    double inverse_sum{0.0};
+    for (auto value : values) {
+      inverse_sum += 1.0 / value;
+    }
+    auto mean = static_cast<double>(n) / inverse_sum;
+    double squared_deviation_sum{0.0};
+    for (auto value : values) {
+      squared_deviation_sum += (1.0 / value - 1.0 / mean) * (1.0 / value - 1.0 / mean);
+    }
+    auto stddev = (n > 1) ? (std::sqrt(squared_deviation_sum) / static_cast<double>(n - 1)) *
+                              mean * mean
+                          : 0.0;
+    std::cout << "harmonic_mean_" << prefix << ": " << mean << std::endl;
+    std::cout << "harmonic_stddev_" << prefix << ": " << stddev << std::endl;
+  } else {
+    double sum{0.0};
+    for (auto value : values) {
+      sum += value;
+    }
+    auto mean = sum / static_cast<double>(n);
+    double squared_deviation_sum{0.0};
+    for (auto value : values) {
+      squared_deviation_sum += (value - mean) * (value - mean);
+    }
+    auto stddev =
+      (n > 1) ? std::sqrt(squared_deviation_sum / static_cast<double>(n - 1)) : 0.0;
+    std::cout << "mean_" << prefix << ": " << mean << std::endl;
+    std::cout << "stddev_" << prefix << ": " << stddev << std::endl;
+  }
+}
+
+template <typename vertex_t, typename edge_t>
+bool run_graph500(size_t scale, size_t edge_factor, size_t num_roots, uint64_t seed)
+{
+  using weight_t = float;
+
+  raft::handle_t handle{};
+
+  // 1. generate the edge list (untimed)
+
+  auto num_vertices = static_cast<vertex_t>(size_t{1} << scale);
+  auto num_edges    = (size_t{1} << scale) * edge_factor;
+
+  rmm::device_uvector<vertex_t> srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(0, handle.get_stream());
+  std::tie(srcs, dsts) = cugraph::generate_rmat_edgelist<vertex_t>(
+    handle, scale, num_edges, 0.57, 0.19, 0.19, seed, false);
+  cugraph::scramble_vertex_ids(handle, srcs, dsts, vertex_t{0}, seed);
+  auto weights = std::make_optional<rmm::device_uvector<weight_t>>(num_edges, handle.get_stream());
+  cugraph::detail::uniform_random_fill(
+    handle.get_stream_view(), weights->data(), weights->size(), weight_t{0.0}, weight_t{1.0}, seed);
+
+  // 2. kernel 1: construct the graph (undirected, the input edge tuples are symmetrized)
+
+  auto construction_start = synchronize_and_get_time();
+
+  rmm::device_uvector<vertex_t> graph_srcs(srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> graph_dsts(dsts.size(), handle.get_stream());
+  auto graph_weights =
+    std::make_optional<rmm::device_uvector<weight_t>>(weights->size(), handle.get_stream());
+  raft::copy(graph_srcs.data(), srcs.data(), srcs.size(), handle.get_stream());
+  raft::copy(graph_dsts.data(), dsts.data(), dsts.size(), handle.get_stream());
+  raft::copy(graph_weights->data(), weights->data(), weights->size(), handle.get_stream());
+  std::tie(graph_srcs, graph_dsts, graph_weights) =
+    cugraph::symmetrize_edgelist_from_triangular<vertex_t, weight_t>(
+      handle, std::move(graph_srcs), std::move(graph_dsts), std::move(graph_weights), true);
+
+  rmm::device_uvector<vertex_t> vertices(num_vertices, handle.get_stream());
+  cugraph::detail::sequence_fill(
+    handle.get_stream_view(), vertices.data(), vertices.size(), vertex_t{0});
+
+  cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+      handle,
+      std::make_optional(std::move(vertices)),
+      std::move(graph_srcs),
+      std::move(graph_dsts),
+      std::move(graph_weights),
+      cugraph::graph_properties_t{true, true},
+      false);
+  auto graph_view = graph.view();
+
+  auto construction_time = synchronize_and_get_time() - construction_start;
+
+  // 3. select the roots (vertices with non-zero degree)
+
+  auto d_degrees = graph_view.compute_out_degrees(handle);
+  std::vector<edge_t> h_degrees(d_degrees.size());
+  raft::update_host(h_degrees.data(), d_degrees.data(), d_degrees.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<vertex_t> dist(vertex_t{0}, num_vertices - 1);
+  std::vector<vertex_t> roots{};
+  while (roots.size() < num_roots) {
+    auto v = dist(gen);
+    if (h_degrees[v] > edge_t{0}) { roots.push_back(v); }
+  }
+
+  // 4. kernel 2 (BFS) & kernel 3 (SSSP)
+
+  rmm::device_uvector<vertex_t> bfs_distances(num_vertices, handle.get_stream());
+  rmm::device_uvector<float> sssp_distances(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> predecessors(num_vertices, handle.get_stream());
+  rmm::device_scalar<vertex_t> d_root(vertex_t{0}, handle.get_stream());
+
+  std::vector<double> bfs_times{};
+  std::vector<double> bfs_teps{};
+  std::vector<double> sssp_times{};
+  std::vector<double> sssp_teps{};
+  std::optional<rmm::device_uvector<weight_t>> no_weights{std::nullopt};  // BFS validation
+  bool valid{true};
+  for (auto root : roots) {
+    d_root.set_value(root, handle.get_stream());
+    auto start = synchronize_and_get_time();
+    cugraph::bfs(handle,
+                 graph_view,
+                 bfs_distances.data(),
+                 predecessors.data(),
+                 d_root.data(),
+                 size_t{1},
+                 true);
+    auto time                = synchronize_and_get_time() - start;
+    auto num_traversed_edges = validate_search(handle,
+                                               srcs,
+                                               dsts,
+                                               no_weights,
+                                               num_vertices,
+                                               root,
+                                               bfs_distances.data(),
+                                               predecessors.data());
+    if (!num_traversed_edges) {
+      std::cerr << "BFS validation failed (root " << root << ")." << std::endl;
+      valid = false;
+      break;
+    }
+    bfs_times.push_back(time);
+    bfs_teps.push_back(static_cast<double>(*num_traversed_edges) / time);
+
+    start = synchronize_and_get_time();
+    cugraph::sssp(handle, graph_view, sssp_distances.data(), predecessors.data(), root);
+    time                = synchronize_and_get_time() - start;
+    num_traversed_edges = validate_search(handle,
+                                          srcs,
+                                          dsts,
+                                          weights,
+                                          num_vertices,
+                                          root,
+                                          sssp_distances.data(),
+                                          predecessors.data());
+    if (!num_traversed_edges) {
+      std::cerr << "SSSP validation failed (root " << root << ")." << std::endl;
+      valid = false;
+      break;
+    }
+    sssp_times.push_back(time);
+    sssp_teps.push_back(static_cast<double>(*num_traversed_edges) / time);
+  }
+
+  // 5. report (in the Graph500 output format)
+
+  std::cout << "SCALE: " << scale << std::endl;
+  std::cout << "edgefactor: " << edge_factor << std::endl;
+  std::cout << "NBFS: " << roots.size() << std::endl;
+  std::cout << "graph_generation: untimed" << std::endl;
+  std::cout << "num_mpi_processes: 1" << std::endl;
+  std::cout << "construction_time: " << construction_time << std::endl;
+  if (valid) {
+    print_statistics("bfs_time", bfs_times, false);
+    print_statistics("bfs_TEPS", bfs_teps, true);
+    print_statistics("sssp_time", sssp_times, false);
+    print_statistics("sssp_TEPS", sssp_teps, true);
+  }
+  return valid;
+}
+
+int main(int argc, char** argv)
+{
+  cxxopts::Options options(argv[0], " - cuGraph Graph500 benchmark");
+  options.add_options()(
+    "rmm_mode", "RMM allocation mode", cxxopts::value<std::string>()->default_value("pool"))(
+    "scale", "Graph500 scale", cxxopts::value<size_t>()->default_value("20"))(
+    "edge_factor", "Graph500 edge factor", cxxopts::value<size_t>()->default_value("16"))(
+    "num_roots", "number of BFS & SSSP roots", cxxopts::value<size_t>()->default_value("64"))(
+    "seed", "generator & root selection seed", cxxopts::value<uint64_t>()->default_value("0"));
+  auto const cmd_opts = options.parse(argc, argv);
+
+  auto resource = cugraph::test::create_memory_resource(cmd_opts["rmm_mode"].as<std::string>());
+  rmm::mr::set_current_device_resource(resource.get());
+
+  auto scale       = cmd_opts["scale"].as<size_t>();
+  auto edge_factor = cmd_opts["edge_factor"].as<size_t>();
+  auto num_roots   = cmd_opts["num_roots"].as<size_t>();
+  auto seed        = cmd_opts["seed"].as<uint64_t>();
+  CUGRAPH_EXPECTS(num_roots > 0, "Invalid input argument: num_roots should be positive.");
+
+  // the graph is symmetrized (the number of edges doubles)
+  auto max_num_edges = (size_t{1} << (scale + 1)) * edge_factor;
+  bool valid{false};
+  if (scale >= 31) {
+    valid = run_graph500<int64_t, int64_t>(scale, edge_factor, num_roots, seed);
+  } else if (max_num_edges > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    valid = run_graph500<int32_t, int64_t>(scale, edge_factor, num_roots, seed);
+  } else {
+    valid = run_graph500<int32_t, int32_t>(scale, edge_factor, num_roots, seed);
+  }
+
+  rmm::mr::set_current_device_resource(nullptr);
+  return valid ? 0 : 1;
+}
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/benchmark_utilities.hpp>
+#include <benchmarks/mg_benchmark_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+// Multi-GPU counterparts of algorithms_bench.cpp (run with mpirun, one process per GPU). Times are
+// measured between device & process synchronizations, so they are the times of the slowest
+// process; the edges per second counter uses the number of edges of the entire graph and the peak
+// memory counter is the peak of the rank 0 process.
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, true> construct_benchmark_graph(
+  raft::handle_t const& handle, bool weighted, bool symmetric)
+{
+  cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, true> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, true>(
+      handle,
+      cugraph::test::benchmark_rmat_usecase(symmetric, true),
+      weighted,
+      true,
+      symmetric /* drop_self_loops */,
+      symmetric /* drop_multi_edges */);
+  return graph;
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_mg_bfs(benchmark::State& state)
+{
+  cugraph::test::mg_benchmark_handle_t<vertex_t> mg_handle{};
+  auto const& handle = mg_handle.get();
+  // symmetric, the direction optimizing BFS requires a symmetric graph
+  auto graph =
+    construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false, true);
+  auto graph_view = graph.view();
+
+  bool const direction_optimizing = state.range(0) != 0;
+  rmm::device_uvector<vertex_t> distances(graph_view.get_number_of_local_vertices(),
+                                          handle.get_stream());
+  rmm::device_uvector<vertex_t> predecessors(graph_view.get_number_of_local_vertices(),
+                                             handle.get_stream());
+  auto const source = graph_view.is_local_vertex_nocheck(vertex_t{0})
+                        ? std::make_optional<rmm::device_scalar<vertex_t>>(vertex_t{0},
+                                                                           handle.get_stream())
+                        : std::nullopt;
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::bfs(handle,
+                 graph_view,
+                 distances.data(),
+                 predecessors.data(),
+                 source ? (*source).data() : static_cast<vertex_t const*>(nullptr),
+                 source ? size_t{1} : size_t{0},
+                 direction_optimizing);
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_mg_sssp(benchmark::State& state)
+{
+  cugraph::test::mg_benchmark_handle_t<vertex_t> mg_handle{};
+  auto const& handle = mg_handle.get();
+  auto graph =
+    construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, true, false);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<float> distances(graph_view.get_number_of_local_vertices(),
+                                       handle.get_stream());
+  rmm::device_uvector<vertex_t> predecessors(graph_view.get_number_of_local_vertices(),
+                                             handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::sssp(handle, graph_view, distances.data(), predecessors.data(), vertex_t{0});
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_mg_pagerank(benchmark::State& state)
+{
+  cugraph::test::mg_benchmark_handle_t<vertex_t> mg_handle{};
+  auto const& handle = mg_handle.get();
+  auto graph =
+    construct_benchmark_graph<vertex_t, edge_t, float, true>(handle, false, false);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<float> pageranks(graph_view.get_number_of_local_vertices(),
+                                       handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::pagerank<vertex_t, edge_t, float, float, true>(handle,
+                                                            graph_view,
+                                                            std::nullopt,
+                                                            std::nullopt,
+                                                            std::nullopt,
+                                                            std::nullopt,
+                                                            pageranks.data(),
+                                                            float{0.85},
+                                                            float{1e-6});
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_mg_weakly_connected_components(benchmark::State& state)
+{
+  cugraph::test::mg_benchmark_handle_t<vertex_t> mg_handle{};
+  auto const& handle = mg_handle.get();
+  auto graph =
+    construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false, true);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<vertex_t> components(graph_view.get_number_of_local_vertices(),
+                                           handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::weakly_connected_components(handle, graph_view, components.data());
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_mg_louvain(benchmark::State& state)
+{
+  cugraph::test::mg_benchmark_handle_t<vertex_t> mg_handle{};
+  auto const& handle = mg_handle.get();
+  auto graph =
+    construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, true, true);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<vertex_t> clustering(graph_view.get_number_of_local_vertices(),
+                                           handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    benchmark::DoNotOptimize(cugraph::louvain(handle, graph_view, clustering.data()));
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()));
+}
+
+#define CUGRAPH_MG_ALGORITHM_BENCHMARK(func)                                                  \
+  BENCHMARK_TEMPLATE(func, int32_t, int32_t)->UseManualTime()->Unit(benchmark::kMillisecond); \
+  BENCHMARK_TEMPLATE(func, int64_t, int64_t)->UseManualTime()->Unit(benchmark::kMillisecond)
+
+// the argument is direction_optimizing (0: top-down only, 1: direction optimizing)
+BENCHMARK_TEMPLATE(BM_mg_bfs, int32_t, int32_t)
+  ->ArgName("direction_optimizing")
+  ->Arg(0)
+  ->Arg(1)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_mg_bfs, int64_t, int64_t)
+  ->ArgName("direction_optimizing")
+  ->Arg(0)
+  ->Arg(1)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+CUGRAPH_MG_ALGORITHM_BENCHMARK(BM_mg_sssp);
+CUGRAPH_MG_ALGORITHM_BENCHMARK(BM_mg_pagerank);
+CUGRAPH_MG_ALGORITHM_BENCHMARK(BM_mg_weakly_connected_components);
+CUGRAPH_MG_ALGORITHM_BENCHMARK(BM_mg_louvain);
+
+// only rank 0 reports (all the processes run every benchmark)
+class null_benchmark_reporter_t : public benchmark::BenchmarkReporter {
+ public:
+  bool ReportContext(Context const&) override { return true; }
+  void ReportRuns(std::vector<Run> const&) override {}
+};
+
+int main(int argc, char** argv)
+{
+  MPI_TRY(MPI_Init(&argc, &argv));
+  int comm_rank{};
+  int comm_size{};
+  MPI_TRY(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank));
+  MPI_TRY(MPI_Comm_size(MPI_COMM_WORLD, &comm_size));
+  int num_gpus_per_node{};
+  CUDA_TRY(cudaGetDeviceCount(&num_gpus_per_node));
+  CUDA_TRY(cudaSetDevice(comm_rank % num_gpus_per_node));
+  ::benchmark::Initialize(&argc, argv);
+  auto const cmd_opts = parse_benchmark_options(argc, argv);
+  auto const rmm_mode = cmd_opts["rmm_mode"].as<std::string>();
+  auto resource       = cugraph::test::create_memory_resource(rmm_mode);
+  cugraph::test::peak_memory_resource_adaptor_t peak_mr(resource.get());
+  rmm::mr::set_current_device_resource(&peak_mr);
+  cugraph::test::g_peak_memory_mr         = &peak_mr;
+  cugraph::test::g_bench_rmat_scale       = cmd_opts["rmat_scale"].as<size_t>();
+  cugraph::test::g_bench_rmat_edge_factor = cmd_opts["rmat_edge_factor"].as<size_t>();
+  if (comm_rank == 0) {
+    ::benchmark::RunSpecifiedBenchmarks();
+  } else {
+    null_benchmark_reporter_t null_reporter{};
+    ::benchmark::RunSpecifiedBenchmarks(&null_reporter);
+  }
+  rmm::mr::set_current_device_resource(nullptr);
+  MPI_TRY(MPI_Finalize());
+  return 0;
+}
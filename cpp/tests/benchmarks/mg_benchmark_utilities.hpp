@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+
+#include <cmath>
+#include <memory>
+
+namespace cugraph {
+namespace test {
+
+// the handle with the 2D partitioning sub-communicators used by the multi-GPU algorithms
+template <typename vertex_t>
+class mg_benchmark_handle_t {
+ public:
+  mg_benchmark_handle_t()
+  {
+    raft::comms::initialize_mpi_comms(&handle_, MPI_COMM_WORLD);
+    auto const comm_size = handle_.get_comms().get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    subcomm_factory_ = std::make_unique<
+      cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>>(
+      handle_, row_comm_size);
+  }
+
+  raft::handle_t const& get() const { return handle_; }
+
+ private:
+  raft::handle_t handle_{};
+  std::unique_ptr<
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>>
+    subcomm_factory_{};
+};
+
+}  // namespace test
+}  // namespace cugraph
@@ -0,0 +1,455 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Multi-GPU weak & strong scaling driver (run with mpirun, one process per GPU).
+//
+// Every process generates its part of an R-mat graph (the graph is symmetrized, self-loops and
+// multi-edges are dropped), and the selected algorithms run --num_trials times. Each trial is
+// reported as a CSV line (on the rank 0 process's stdout) with the wall time, the communication
+// time (the GPU time of the device communication wrappers, see cugraph::profiler_t, maximum over
+// the processes) and the compute time (wall time - communication time). BFS & SSSP report
+// Graph500 style traversed edges per second (the number of undirected input edges with a reached
+// endpoint divided by the time, and the harmonic mean over the trials), the other algorithms report
+// the input edges per second.
+//
+// In weak scaling, --rmat_scale is the per-GPU scale (the graph scale is rmat_scale +
+// floor(log2(# GPUs)), so the edges per GPU stay constant with a power of two number of GPUs); in
+// strong scaling, --rmat_scale is the graph scale.
+//
+// Example:
+// ```
+// mpirun -n 8 ./MG_SCALING_BENCH --scaling=weak --rmat_scale=24 --algorithms=bfs,pagerank
+// ```
+
+#include <benchmarks/mg_benchmark_utilities.hpp>
+#include <utilities/cxxopts.hpp>
+#include <utilities/rmm_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct scaling_config_t {
+  bool weak_scaling{true};
+  size_t rmat_scale{20};  // graph scale (after the weak scaling adjustment)
+  size_t rmat_edge_factor{16};
+  size_t num_trials{4};
+  uint64_t seed{0};
+  std::vector<std::string> algorithms{};
+};
+
+struct trial_result_t {
+  double time_s{0.0};
+  double comm_s{0.0};
+  double traversed_edges{0.0};  // 0 if not a traversal
+};
+
+// synchronizes the device & the processes, returns the wall time in seconds
+double synchronize_and_get_time(raft::handle_t const& handle)
+{
+  CUDA_TRY(cudaDeviceSynchronize());
+  handle.get_comms().barrier();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+// the GPU time spent in the device communication wrappers since the last profiler reset (maximum
+// over the processes)
+double get_communication_time(raft::handle_t const& handle)
+{
+  double comm_ms{0.0};
+  for (auto const& [key, stats] : cugraph::profiler_t::get().get_phase_stats()) {
+    auto pos  = key.rfind('/');
+    auto name = (pos == std::string::npos) ? key : key.substr(pos + 1);
+    if (name.rfind("device_", 0) == 0) { comm_ms += stats.total_elapsed_ms; }
+  }
+  return cugraph::host_scalar_allreduce(
+           handle.get_comms(), comm_ms, raft::comms::op_t::MAX, handle.get_stream()) *
+         1e-3;
+}
+
+// times a trial (from the construction to the stop() call)
+class trial_timer_t {
+ public:
+  explicit trial_timer_t(raft::handle_t const& handle) : handle_(handle)
+  {
+    start_ = synchronize_and_get_time(handle_);
+    cugraph::profiler_t::get().reset();
+  }
+
+  trial_result_t stop()
+  {
+    trial_result_t result{};
+    result.time_s = synchronize_and_get_time(handle_) - start_;
+    result.comm_s = get_communication_time(handle_);
+    return result;
+  }
+
+ private:
+  raft::handle_t const& handle_;
+  double start_{0.0};
+};
+
+// the number of undirected (the graph is symmetric) edges with a reached endpoint
+template <typename vertex_t, typename edge_t, typename weight_t, typename distance_t>
+double count_traversed_edges(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<vertex_t, edge_t, weight_t, false, true> const& graph_view,
+  rmm::device_uvector<edge_t> const& out_degrees,
+  distance_t const* distances)
+{
+  auto num_traversed_edges = thrust::transform_reduce(
+    rmm::exec_policy(handle.get_stream_view()),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(graph_view.get_number_of_local_vertices()),
+    [distances, out_degrees = out_degrees.data()] __device__(auto i) {
+      return distances[i] != std::numeric_limits<distance_t>::max()
+               ? static_cast<edge_t>(out_degrees[i])
+               : edge_t{0};
+    },
+    edge_t{0},
+    thrust::plus<edge_t>());
+  num_traversed_edges = cugraph::host_scalar_allreduce(
+    handle.get_comms(), num_traversed_edges, raft::comms::op_t::SUM, handle.get_stream());
+  return static_cast<double>(num_traversed_edges) / 2.0;
+}
+
+// selects a source vertex with non-zero degree (Graph500 style), every process returns the same
+// vertex
+template <typename vertex_t, typename edge_t, typename weight_t>
+vertex_t select_source(raft::handle_t const& handle,
+                       cugraph::graph_view_t<vertex_t, edge_t, weight_t, false, true> const&
+                         graph_view,
+                       rmm::device_uvector<edge_t> const& out_degrees,
+                       std::mt19937_64& gen)
+{
+  std::uniform_int_distribution<vertex_t> dist(vertex_t{0},
+                                               graph_view.get_number_of_vertices() - 1);
+  while (true) {
+    auto v = dist(gen);  // every process draws from the same sequence
+    edge_t degree{0};
+    if (graph_view.is_local_vertex_nocheck(v)) {
+      raft::update_host(&degree,
+                        out_degrees.data() + (v - graph_view.get_local_vertex_first()),
+                        size_t{1},
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+    }
+    degree = cugraph::host_scalar_allreduce(
+      handle.get_comms(), degree, raft::comms::op_t::SUM, handle.get_stream());
+    if (degree > edge_t{0}) { return v; }
+  }
+}
+
+void print_header()
+{
+  std::cout << "num_gpus,scaling,rmat_scale,rmat_edge_factor,algorithm,num_vertices,num_edges,"
+               "trial,time_s,compute_s,comm_s,edges_per_second"
+            << std::endl;
+}
+
+void print_results(raft::handle_t const& handle,
+                   scaling_config_t const& config,
+                   std::string const& algorithm,
+                   double num_vertices,
+                   double num_edges,
+                   std::vector<trial_result_t> const& results)
+{
+  if (handle.get_comms().get_rank() != 0) { return; }
+
+  std::ostringstream prefix{};
+  prefix << handle.get_comms().get_size() << "," << (config.weak_scaling ? "weak" : "strong")
+         << "," << config.rmat_scale << "," << config.rmat_edge_factor << "," << algorithm << ","
+         << num_vertices << "," << num_edges << ",";
+
+  double total_time_s{0.0};
+  double total_comm_s{0.0};
+  double inverse_rate_sum{0.0};  // for the harmonic mean (Graph500)
+  for (size_t i = 0; i < results.size(); ++i) {
+    auto edges = results[i].traversed_edges > 0.0 ? results[i].traversed_edges : num_edges;
+    auto rate  = edges / results[i].time_s;
+    std::cout << prefix.str() << i << "," << results[i].time_s << ","
+              << results[i].time_s - results[i].comm_s << "," << results[i].comm_s << "," << rate
+              << std::endl;
+    total_time_s += results[i].time_s;
+    total_comm_s += results[i].comm_s;
+    inverse_rate_sum += 1.0 / rate;
+  }
+  auto n = static_cast<double>(results.size());
+  std::cout << prefix.str() << "mean," << total_time_s / n << ","
+            << (total_time_s - total_comm_s) / n << "," << total_comm_s / n << ","
+            << n / inverse_rate_sum << std::endl;
+}
+
+template <typename vertex_t, typename edge_t, bool store_transposed>
+cugraph::graph_t<vertex_t, edge_t, float, store_transposed, true> construct_scaling_graph(
+  raft::handle_t const& handle, scaling_config_t const& config, trial_result_t& result)
+{
+  cugraph::test::Rmat_Usecase usecase(config.rmat_scale,
+                                      config.rmat_edge_factor,
+                                      0.57,
+                                      0.19,
+                                      0.19,
+                                      config.seed,
+                                      true,
+                                      false,
+                                      0,
+                                      true);
+
+  trial_timer_t timer(handle);
+  cugraph::graph_t<vertex_t, edge_t, float, store_transposed, true> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::test::construct_graph<vertex_t, edge_t, float, store_transposed, true>(
+      handle, usecase, true, true, true /* drop_self_loops */, true /* drop_multi_edges */);
+  result = timer.stop();
+  return graph;
+}
+
+template <typename vertex_t, typename edge_t>
+void run_scaling_benchmarks(scaling_config_t const& config)
+{
+  cugraph::test::mg_benchmark_handle_t<vertex_t> mg_handle{};
+  auto const& handle = mg_handle.get();
+
+  auto selected = [&config](std::string const& algorithm) {
+    return std::find(config.algorithms.begin(), config.algorithms.end(), algorithm) !=
+           config.algorithms.end();
+  };
+
+  if (handle.get_comms().get_rank() == 0) { print_header(); }
+
+  trial_result_t construction_result{};
+  auto graph =
+    construct_scaling_graph<vertex_t, edge_t, false>(handle, config, construction_result);
+  auto graph_view   = graph.view();
+  auto num_vertices = static_cast<double>(graph_view.get_number_of_vertices());
+  auto num_edges    = static_cast<double>(graph_view.get_number_of_edges());
+  print_results(
+    handle, config, "graph_construction", num_vertices, num_edges, {construction_result});
+
+  auto out_degrees = graph_view.compute_out_degrees(handle);
+  std::mt19937_64 gen(config.seed);
+
+  if (selected("bfs")) {
+    rmm::device_uvector<vertex_t> distances(graph_view.get_number_of_local_vertices(),
+                                            handle.get_stream());
+    rmm::device_uvector<vertex_t> predecessors(graph_view.get_number_of_local_vertices(),
+                                               handle.get_stream());
+    std::vector<trial_result_t> results{};
+    for (size_t i = 0; i < config.num_trials; ++i) {
+      auto v      = select_source(handle, graph_view, out_degrees, gen);
+      auto source = graph_view.is_local_vertex_nocheck(v)
+                      ? std::make_optional<rmm::device_scalar<vertex_t>>(v, handle.get_stream())
+                      : std::nullopt;
+      trial_timer_t timer(handle);
+      cugraph::bfs(handle,
+                   graph_view,
+                   distances.data(),
+                   predecessors.data(),
+                   source ? (*source).data() : static_cast<vertex_t const*>(nullptr),
+                   source ? size_t{1} : size_t{0},
+                   true);
+      auto result            = timer.stop();
+      result.traversed_edges =
+        count_traversed_edges(handle, graph_view, out_degrees, distances.data());
+      results.push_back(result);
+    }
+    print_results(handle, config, "bfs", num_vertices, num_edges, results);
+  }
+
+  if (selected("sssp")) {
+    rmm::device_uvector<float> distances(graph_view.get_number_of_local_vertices(),
+                                         handle.get_stream());
+    rmm::device_uvector<vertex_t> predecessors(graph_view.get_number_of_local_vertices(),
+                                               handle.get_stream());
+    std::vector<trial_result_t> results{};
+    for (size_t i = 0; i < config.num_trials; ++i) {
+      auto v = select_source(handle, graph_view, out_degrees, gen);
+      trial_timer_t timer(handle);
+      cugraph::sssp(handle, graph_view, distances.data(), predecessors.data(), v);
+      auto result            = timer.stop();
+      result.traversed_edges =
+        count_traversed_edges(handle, graph_view, out_degrees, distances.data());
+      results.push_back(result);
+    }
+    print_results(handle, config, "sssp", num_vertices, num_edges, results);
+  }
+
+  if (selected("wcc")) {
+    rmm::device_uvector<vertex_t> components(graph_view.get_number_of_local_vertices(),
+                                             handle.get_stream());
+    std::vector<trial_result_t> results{};
+    for (size_t i = 0; i < config.num_trials; ++i) {
+      trial_timer_t timer(handle);
+      cugraph::weakly_connected_components(handle, graph_view, components.data());
+      results.push_back(timer.stop());
+    }
+    print_results(handle, config, "wcc", num_vertices, num_edges, results);
+  }
+
+  if (selected("core_number")) {
+    rmm::device_uvector<edge_t> core_numbers(graph_view.get_number_of_local_vertices(),
+                                             handle.get_stream());
+    std::vector<trial_result_t> results{};
+    for (size_t i = 0; i < config.num_trials; ++i) {
+      trial_timer_t timer(handle);
+      cugraph::core_number(
+        handle, graph_view, core_numbers.data(), cugraph::k_core_degree_type_t::OUT);
+      results.push_back(timer.stop());
+    }
+    print_results(handle, config, "core_number", num_vertices, num_edges, results);
+  }
+
+  if (selected("louvain")) {
+    rmm::device_uvector<vertex_t> clustering(graph_view.get_number_of_local_vertices(),
+                                             handle.get_stream());
+    std::vector<trial_result_t> results{};
+    for (size_t i = 0; i < config.num_trials; ++i) {
+      trial_timer_t timer(handle);
+      cugraph::louvain(handle, graph_view, clustering.data());
+      results.push_back(timer.stop());
+    }
+    print_results(handle, config, "louvain", num_vertices, num_edges, results);
+  }
+
+  if (selected("pagerank")) {
+    // PageRank requires the transposed storage
+    out_degrees.release();
+    graph = cugraph::graph_t<vertex_t, edge_t, float, false, true>(handle);
+
+    trial_result_t transposed_construction_result{};
+    auto transposed_graph = construct_scaling_graph<vertex_t, edge_t, true>(
+      handle, config, transposed_construction_result);
+    auto transposed_graph_view = transposed_graph.view();
+    print_results(handle,
+                  config,
+                  "graph_construction_transposed",
+                  num_vertices,
+                  num_edges,
+                  {transposed_construction_result});
+
+    rmm::device_uvector<float> pageranks(transposed_graph_view.get_number_of_local_vertices(),
+                                         handle.get_stream());
+    std::vector<trial_result_t> results{};
+    for (size_t i = 0; i < config.num_trials; ++i) {
+      trial_timer_t timer(handle);
+      cugraph::pagerank<vertex_t, edge_t, float, float, true>(handle,
+                                                              transposed_graph_view,
+                                                              std::nullopt,
+                                                              std::nullopt,
+                                                              std::nullopt,
+                                                              std::nullopt,
+                                                              pageranks.data(),
+                                                              float{0.85},
+                                                              float{1e-6});
+      results.push_back(timer.stop());
+    }
+    print_results(handle, config, "pagerank", num_vertices, num_edges, results);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  MPI_TRY(MPI_Init(&argc, &argv));
+  int comm_rank{};
+  int comm_size{};
+  MPI_TRY(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank));
+  MPI_TRY(MPI_Comm_size(MPI_COMM_WORLD, &comm_size));
+  int num_gpus_per_node{};
+  CUDA_TRY(cudaGetDeviceCount(&num_gpus_per_node));
+  CUDA_TRY(cudaSetDevice(comm_rank % num_gpus_per_node));
+
+  cxxopts::Options options(argv[0], " - cuGraph multi-GPU scaling benchmarks");
+  options.add_options()(
+    "rmm_mode", "RMM allocation mode", cxxopts::value<std::string>()->default_value("pool"))(
+    "scaling", "weak or strong", cxxopts::value<std::string>()->default_value("weak"))(
+    "rmat_scale",
+    "R-mat scale (per GPU in weak scaling)",
+    cxxopts::value<size_t>()->default_value("20"))(
+    "rmat_edge_factor", "R-mat edge factor", cxxopts::value<size_t>()->default_value("16"))(
+    "algorithms",
+    "comma separated list of bfs, sssp, pagerank, wcc, louvain, and core_number",
+    cxxopts::value<std::vector<std::string>>()->default_value(
+      "bfs,sssp,pagerank,wcc,louvain,core_number"))(
+    "num_trials", "number of trials", cxxopts::value<size_t>()->default_value("4"))(
+    "seed",
+    "R-mat generator & source selection seed",
+    cxxopts::value<uint64_t>()->default_value("0"));
+  auto const cmd_opts = options.parse(argc, argv);
+
+  auto resource = cugraph::test::create_memory_resource(cmd_opts["rmm_mode"].as<std::string>());
+  rmm::mr::set_current_device_resource(resource.get());
+
+  scaling_config_t config{};
+  auto scaling = cmd_opts["scaling"].as<std::string>();
+  CUGRAPH_EXPECTS((scaling == "weak") || (scaling == "strong"),
+                  "Invalid input argument: scaling should be weak or strong.");
+  config.weak_scaling = (scaling == "weak");
+  config.rmat_scale   = cmd_opts["rmat_scale"].as<size_t>();
+  if (config.weak_scaling) {
+    config.rmat_scale += static_cast<size_t>(std::floor(std::log2(static_cast<double>(comm_size))));
+  }
+  config.rmat_edge_factor = cmd_opts["rmat_edge_factor"].as<size_t>();
+  config.num_trials       = cmd_opts["num_trials"].as<size_t>();
+  config.seed             = cmd_opts["seed"].as<uint64_t>();
+  config.algorithms       = cmd_opts["algorithms"].as<std::vector<std::string>>();
+  CUGRAPH_EXPECTS(config.num_trials > 0, "Invalid input argument: num_trials should be positive.");
+
+  // the communication time is measured by the profiler
+  cugraph::profiler_t::get().enable(true);
+
+  // the graph is symmetrized (the number of edges doubles)
+  auto max_num_edges = (size_t{1} << (config.rmat_scale + 1)) * config.rmat_edge_factor;
+  if (config.rmat_scale >= 31) {
+    run_scaling_benchmarks<int64_t, int64_t>(config);
+  } else if (max_num_edges > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    run_scaling_benchmarks<int32_t, int64_t>(config);
+  } else {
+    run_scaling_benchmarks<int32_t, int32_t>(config);
+  }
+
+  rmm::mr::set_current_device_resource(nullptr);
+  MPI_TRY(MPI_Finalize());
+  return 0;
+}
@@ -0,0 +1,584 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/benchmark_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/copy_v_transform_reduce_key_aggregated_out_nbr.cuh>
+#include <cugraph/prims/count_if_e.cuh>
+#include <cugraph/prims/count_if_v.cuh>
+#include <cugraph/prims/edge_mask.cuh>
+#include <cugraph/prims/edge_properties.cuh>
+#include <cugraph/prims/extract_if_e.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/reduce_v.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/sample_out_nbr.cuh>
+#include <cugraph/prims/transform_reduce_by_adj_matrix_row_col_key_e.cuh>
+#include <cugraph/prims/transform_reduce_e.cuh>
+#include <cugraph/prims/transform_reduce_v.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+// Every benchmark runs a primitive on an (unweighted unless the primitive needs weights) R-mat
+// graph of the command line scale & edge factor. The reported bytes are the minimum device memory
+// traffic of a call (e.g. the CSR arrays & a row and a column value per edge for an edge pass);
+// the caches make the actual traffic lower for the property values and (atomics, shuffling, and
+// sorting) make it higher elsewhere, so they are to compare runs, not to compute bandwidth
+// efficiency.
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> construct_benchmark_graph(
+  raft::handle_t const& handle, bool weighted)
+{
+  cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+      handle, cugraph::test::benchmark_rmat_usecase(false), weighted, true);
+  return graph;
+}
+
+template <typename vertex_t, typename value_t>
+rmm::device_uvector<value_t> generate_vertex_values(raft::handle_t const& handle,
+                                                    vertex_t num_vertices)
+{
+  rmm::device_uvector<value_t> values(num_vertices, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(num_vertices),
+                    values.begin(),
+                    [] __device__(auto v) { return static_cast<value_t>(v % vertex_t{7}); });
+  return values;
+}
+
+// offsets and indices (and weights) of every edge and value_bytes per edge
+template <typename GraphViewType>
+double edge_pass_bytes(GraphViewType const& graph_view, size_t value_bytes)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto per_edge_bytes =
+    sizeof(vertex_t) + (graph_view.is_weighted() ? sizeof(weight_t) : size_t{0}) + value_bytes;
+  return static_cast<double>(graph_view.get_number_of_vertices() + 1) * sizeof(edge_t) +
+         static_cast<double>(graph_view.get_number_of_edges()) * per_edge_bytes;
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_copy_to_adj_matrix_row(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+  cugraph::row_properties_t<decltype(graph_view), float> row_values(handle, graph_view);
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::copy_to_adj_matrix_row(handle, graph_view, vertex_values.begin(), row_values);
+  }
+
+  cugraph::test::set_benchmark_counters(
+    state,
+    static_cast<double>(graph_view.get_number_of_edges()),
+    2.0 * graph_view.get_number_of_vertices() * sizeof(float));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_copy_v_transform_reduce_out_nbr(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+  cugraph::row_properties_t<decltype(graph_view), float> row_values(handle, graph_view);
+  cugraph::col_properties_t<decltype(graph_view), float> col_values(handle, graph_view);
+  cugraph::copy_to_adj_matrix_row(handle, graph_view, vertex_values.begin(), row_values);
+  cugraph::copy_to_adj_matrix_col(handle, graph_view, vertex_values.begin(), col_values);
+  rmm::device_uvector<float> outputs(graph_view.get_number_of_vertices(), handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::copy_v_transform_reduce_out_nbr(
+      handle,
+      graph_view,
+      row_values.device_view(),
+      col_values.device_view(),
+      [] __device__(auto row, auto col, auto row_val, auto col_val) { return row_val * col_val; },
+      float{0.0},
+      outputs.begin());
+  }
+
+  cugraph::test::set_benchmark_counters(
+    state,
+    static_cast<double>(graph_view.get_number_of_edges()),
+    edge_pass_bytes(graph_view, 2 * sizeof(float)) +
+      graph_view.get_number_of_vertices() * sizeof(float));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_copy_v_transform_reduce_in_nbr(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, true>(handle, false);
+  auto graph_view = graph.view();
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+  cugraph::row_properties_t<decltype(graph_view), float> row_values(handle, graph_view);
+  cugraph::copy_to_adj_matrix_row(handle, graph_view, vertex_values.begin(), row_values);
+  rmm::device_uvector<float> outputs(graph_view.get_number_of_vertices(), handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::copy_v_transform_reduce_in_nbr(
+      handle,
+      graph_view,
+      row_values.device_view(),
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      [] __device__(auto row, auto col, auto row_val, auto col_val) { return row_val; },
+      float{0.0},
+      outputs.begin());
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()),
+                                        edge_pass_bytes(graph_view, sizeof(float)) +
+                                          graph_view.get_number_of_vertices() * sizeof(float));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_copy_v_transform_reduce_key_aggregated_out_nbr(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, true);
+  auto graph_view = graph.view();
+
+  // a key (e.g. a cluster ID) per vertex, 16 vertices share a key on average
+  auto num_keys = std::max(graph_view.get_number_of_vertices() / vertex_t{16}, vertex_t{1});
+  rmm::device_uvector<vertex_t> vertex_keys(graph_view.get_number_of_vertices(),
+                                            handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(graph_view.get_number_of_vertices()),
+                    vertex_keys.begin(),
+                    [num_keys] __device__(auto v) { return v % num_keys; });
+  cugraph::col_properties_t<decltype(graph_view), vertex_t> col_keys(handle, graph_view);
+  cugraph::copy_to_adj_matrix_col(handle, graph_view, vertex_keys.begin(), col_keys);
+  rmm::device_uvector<vertex_t> map_keys(num_keys, handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), map_keys.begin(), map_keys.end(), vertex_t{0});
+  rmm::device_uvector<float> map_values(num_keys, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), map_values.begin(), map_values.end(), float{1.0});
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+  cugraph::row_properties_t<decltype(graph_view), float> row_values(handle, graph_view);
+  cugraph::copy_to_adj_matrix_row(handle, graph_view, vertex_values.begin(), row_values);
+  rmm::device_uvector<float> outputs(graph_view.get_number_of_vertices(), handle.get_stream());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::copy_v_transform_reduce_key_aggregated_out_nbr(
+      handle,
+      graph_view,
+      row_values.device_view(),
+      col_keys.device_view(),
+      map_keys.begin(),
+      map_keys.end(),
+      map_values.begin(),
+      [] __device__(auto src, auto key, auto w, auto src_val, auto key_val) {
+        return w * src_val * key_val;
+      },
+      thrust::plus<float>{},
+      float{0.0},
+      outputs.begin());
+  }
+
+  cugraph::test::set_benchmark_counters(
+    state,
+    static_cast<double>(graph_view.get_number_of_edges()),
+    edge_pass_bytes(graph_view, sizeof(vertex_t) + sizeof(float)) +
+      graph_view.get_number_of_vertices() * sizeof(float));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_count_if_e(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+  cugraph::row_properties_t<decltype(graph_view), float> row_values(handle, graph_view);
+  cugraph::col_properties_t<decltype(graph_view), float> col_values(handle, graph_view);
+  cugraph::copy_to_adj_matrix_row(handle, graph_view, vertex_values.begin(), row_values);
+  cugraph::copy_to_adj_matrix_col(handle, graph_view, vertex_values.begin(), col_values);
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    benchmark::DoNotOptimize(cugraph::count_if_e(
+      handle,
+      graph_view,
+      row_values.device_view(),
+      col_values.device_view(),
+      [] __device__(auto row, auto col, auto row_val, auto col_val) { return row_val < col_val; }));
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()),
+                                        edge_pass_bytes(graph_view, 2 * sizeof(float)));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_transform_reduce_e(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+  cugraph::row_properties_t<decltype(graph_view), float> row_values(handle, graph_view);
+  cugraph::col_properties_t<decltype(graph_view), float> col_values(handle, graph_view);
+  cugraph::copy_to_adj_matrix_row(handle, graph_view, vertex_values.begin(), row_values);
+  cugraph::copy_to_adj_matrix_col(handle, graph_view, vertex_values.begin(), col_values);
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    benchmark::DoNotOptimize(cugraph::transform_reduce_e(
+      handle,
+      graph_view,
+      row_values.device_view(),
+      col_values.device_view(),
+      [] __device__(auto row, auto col, auto row_val, auto col_val) { return row_val * col_val; },
+      float{0.0}));
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()),
+                                        edge_pass_bytes(graph_view, 2 * sizeof(float)));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_transform_reduce_by_adj_matrix_row_key_e(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  auto num_keys = std::max(graph_view.get_number_of_vertices() / vertex_t{16}, vertex_t{1});
+  rmm::device_uvector<vertex_t> vertex_keys(graph_view.get_number_of_vertices(),
+                                            handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(graph_view.get_number_of_vertices()),
+                    vertex_keys.begin(),
+                    [num_keys] __device__(auto v) { return v % num_keys; });
+  cugraph::row_properties_t<decltype(graph_view), vertex_t> row_keys(handle, graph_view);
+  cugraph::copy_to_adj_matrix_row(handle, graph_view, vertex_keys.begin(), row_keys);
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    auto key_value_pairs = cugraph::transform_reduce_by_adj_matrix_row_key_e(
+      handle,
+      graph_view,
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      row_keys.device_view(),
+      [] __device__(auto row, auto col, auto row_val, auto col_val) { return float{1.0}; },
+      float{0.0});
+    benchmark::DoNotOptimize(std::get<0>(key_value_pairs).data());
+  }
+
+  cugraph::test::set_benchmark_counters(state,
+                                        static_cast<double>(graph_view.get_number_of_edges()),
+                                        edge_pass_bytes(graph_view, sizeof(vertex_t)));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_extract_if_e(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+  cugraph::row_properties_t<decltype(graph_view), float> row_values(handle, graph_view);
+  cugraph::col_properties_t<decltype(graph_view), float> col_values(handle, graph_view);
+  cugraph::copy_to_adj_matrix_row(handle, graph_view, vertex_values.begin(), row_values);
+  cugraph::copy_to_adj_matrix_col(handle, graph_view, vertex_values.begin(), col_values);
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    auto edges = cugraph::extract_if_e(
+      handle,
+      graph_view,
+      row_values.device_view(),
+      col_values.device_view(),
+      [] __device__(auto row, auto col, auto row_val, auto col_val) { return row_val < col_val; });
+    benchmark::DoNotOptimize(std::get<0>(edges).data());
+  }
+
+  // the extracted edges (upper bound: all the edges) are written
+  cugraph::test::set_benchmark_counters(
+    state,
+    static_cast<double>(graph_view.get_number_of_edges()),
+    edge_pass_bytes(graph_view, 2 * sizeof(float) + 2 * sizeof(vertex_t)));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_set_edge_mask_if_e(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  cugraph::edge_mask_t<decltype(graph_view)> edge_mask(handle, graph_view);
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::set_edge_mask_if_e(
+      handle,
+      graph_view,
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      cugraph::dummy_edge_properties_t<edge_t>{}.device_view(),
+      [] __device__(auto row, auto col, auto row_val, auto col_val) { return row < col; },
+      edge_mask);
+  }
+
+  cugraph::test::set_benchmark_counters(
+    state,
+    static_cast<double>(graph_view.get_number_of_edges()),
+    edge_pass_bytes(graph_view, 0) + graph_view.get_number_of_edges() / 8.0);
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_update_frontier_v_push_if_out_nbr(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  // a BFS step from a frontier of every vertex (the densest frontier) to the unvisited vertices
+  // (every vertex)
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+  enum class Bucket { cur, next, num_buckets };
+  cugraph::VertexFrontier<vertex_t, void, false, static_cast<size_t>(Bucket::num_buckets)>
+    vertex_frontier(handle);
+  rmm::device_uvector<vertex_t> distances(graph_view.get_number_of_vertices(),
+                                          handle.get_stream());
+  auto distance_ptr = distances.data();
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    thrust::fill(
+      handle.get_thrust_policy(), distances.begin(), distances.end(), invalid_distance);
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::next)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+      .insert(thrust::make_counting_iterator(vertex_t{0}),
+              thrust::make_counting_iterator(graph_view.get_number_of_vertices()));
+
+    cugraph::test::iteration_timer_t timer(state, handle);
+    cugraph::update_frontier_v_push_if_out_nbr(
+      handle,
+      graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      [distance_ptr] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) {
+        return *(distance_ptr + dst) == invalid_distance ? thrust::optional<vertex_t>{src}
+                                                         : thrust::nullopt;
+      },
+      cugraph::reduce_op::any<vertex_t>(),
+      distances.begin(),
+      distances.begin(),
+      [] __device__(auto v, auto v_val, auto pushed_val) {
+        return (v_val == invalid_distance)
+                 ? thrust::optional<thrust::tuple<size_t, vertex_t>>{thrust::make_tuple(
+                     static_cast<size_t>(Bucket::next), vertex_t{1})}
+                 : thrust::nullopt;
+      });
+  }
+
+  cugraph::test::set_benchmark_counters(
+    state,
+    static_cast<double>(graph_view.get_number_of_edges()),
+    edge_pass_bytes(graph_view, sizeof(vertex_t)) +
+      2.0 * graph_view.get_number_of_vertices() * sizeof(vertex_t));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_sample_out_nbr(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  // every 16th vertex with a fanout of 10
+  size_t constexpr fanout{10};
+  auto num_seeds = (graph_view.get_number_of_vertices() + vertex_t{15}) / vertex_t{16};
+  rmm::device_uvector<vertex_t> seeds(num_seeds, handle.get_stream());
+  thrust::sequence(
+    handle.get_thrust_policy(), seeds.begin(), seeds.end(), vertex_t{0}, vertex_t{16});
+
+  cugraph::test::reset_peak_memory();
+  uint64_t rng_seed{0};
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    auto samples = cugraph::sample_out_nbr(
+      handle, graph_view, seeds.begin(), seeds.end(), fanout, false, rng_seed++);
+    benchmark::DoNotOptimize(std::get<0>(samples).data());
+  }
+
+  // reports the (upper bound of the) sampled edges per second
+  cugraph::test::set_benchmark_counters(state, static_cast<double>(num_seeds * fanout));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_count_if_v(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    benchmark::DoNotOptimize(cugraph::count_if_v(
+      handle, graph_view, vertex_values.begin(), [] __device__(auto val) { return val > 3.0; }));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(graph_view.get_number_of_vertices()) *
+                          state.iterations());
+  cugraph::test::set_benchmark_counters(
+    state, 0.0, static_cast<double>(graph_view.get_number_of_vertices()) * sizeof(float));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_reduce_v(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    benchmark::DoNotOptimize(
+      cugraph::reduce_v(handle, graph_view, vertex_values.begin(), float{0.0}));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(graph_view.get_number_of_vertices()) *
+                          state.iterations());
+  cugraph::test::set_benchmark_counters(
+    state, 0.0, static_cast<double>(graph_view.get_number_of_vertices()) * sizeof(float));
+}
+
+template <typename vertex_t, typename edge_t>
+void BM_transform_reduce_v(benchmark::State& state)
+{
+  raft::handle_t handle{};
+  auto graph      = construct_benchmark_graph<vertex_t, edge_t, float, false>(handle, false);
+  auto graph_view = graph.view();
+
+  auto vertex_values =
+    generate_vertex_values<vertex_t, float>(handle, graph_view.get_number_of_vertices());
+
+  cugraph::test::reset_peak_memory();
+  for (auto _ : state) {
+    cugraph::test::iteration_timer_t timer(state, handle);
+    benchmark::DoNotOptimize(cugraph::transform_reduce_v(
+      handle,
+      graph_view,
+      vertex_values.begin(),
+      [] __device__(auto val) { return val * val; },
+      float{0.0}));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(graph_view.get_number_of_vertices()) *
+                          state.iterations());
+  cugraph::test::set_benchmark_counters(
+    state, 0.0, static_cast<double>(graph_view.get_number_of_vertices()) * sizeof(float));
+}
+
+#define CUGRAPH_PRIM_BENCHMARK(func)                                                          \
+  BENCHMARK_TEMPLATE(func, int32_t, int32_t)->UseManualTime()->Unit(benchmark::kMillisecond); \
+  BENCHMARK_TEMPLATE(func, int64_t, int64_t)->UseManualTime()->Unit(benchmark::kMillisecond)
+
+CUGRAPH_PRIM_BENCHMARK(BM_copy_to_adj_matrix_row);
+CUGRAPH_PRIM_BENCHMARK(BM_copy_v_transform_reduce_out_nbr);
+CUGRAPH_PRIM_BENCHMARK(BM_copy_v_transform_reduce_in_nbr);
+CUGRAPH_PRIM_BENCHMARK(BM_copy_v_transform_reduce_key_aggregated_out_nbr);
+CUGRAPH_PRIM_BENCHMARK(BM_count_if_e);
+CUGRAPH_PRIM_BENCHMARK(BM_transform_reduce_e);
+CUGRAPH_PRIM_BENCHMARK(BM_transform_reduce_by_adj_matrix_row_key_e);
+CUGRAPH_PRIM_BENCHMARK(BM_extract_if_e);
+CUGRAPH_PRIM_BENCHMARK(BM_set_edge_mask_if_e);
+CUGRAPH_PRIM_BENCHMARK(BM_update_frontier_v_push_if_out_nbr);
+CUGRAPH_PRIM_BENCHMARK(BM_sample_out_nbr);
+CUGRAPH_PRIM_BENCHMARK(BM_count_if_v);
+CUGRAPH_PRIM_BENCHMARK(BM_reduce_v);
+CUGRAPH_PRIM_BENCHMARK(BM_transform_reduce_v);
+
+CUGRAPH_BENCHMARK_PROGRAM_MAIN()
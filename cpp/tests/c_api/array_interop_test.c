@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/array.h>
+#include <cugraph_c/cugraph_api.h>
+
+#include <stdio.h>
+
+/*
+ * Export an array and import the exported memory into a second array (through DLPack or Arrow),
+ * the imported array should alias the exported memory and keep it alive after the first array is
+ * freed.
+ */
+int generic_array_interop_test(int use_arrow)
+{
+  int test_ret_value = 0;
+
+  typedef int32_t vertex_t;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+  size_t num_vertices           = 6;
+
+  vertex_t h_src[] = {0, 1, 2, 3, 4, 5};
+  vertex_t h_result[6];
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  p_handle                            = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  cugraph_type_erased_device_array_t* src;
+  cugraph_type_erased_device_array_t* imported = NULL;
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, INT32, num_vertices, &src, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src create failed.");
+
+  ret_code =
+    cugraph_type_erased_device_array_copy_from_host(p_handle, src, (byte_t*)h_src, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  const void* src_pointer = cugraph_type_erased_device_array_pointer(src);
+
+  if (use_arrow) {
+    struct ArrowSchema schema;
+    struct ArrowDeviceArray device_array;
+
+    ret_code =
+      cugraph_type_erased_device_array_to_arrow(p_handle, src, &schema, &device_array, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "to_arrow failed.");
+
+    ret_code = cugraph_type_erased_device_array_from_arrow(
+      p_handle, &schema, &device_array, &imported, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "from_arrow failed.");
+    TEST_ASSERT(
+      test_ret_value, device_array.array.release == NULL, "imported arrow array not moved.");
+
+    schema.release(&schema);
+  } else {
+    struct DLManagedTensor* tensor = NULL;
+
+    ret_code = cugraph_type_erased_device_array_to_dlpack(p_handle, src, &tensor, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "to_dlpack failed.");
+
+    ret_code =
+      cugraph_type_erased_device_array_from_dlpack(p_handle, tensor, &imported, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "from_dlpack failed.");
+  }
+
+  if (test_ret_value == 0) {
+    TEST_ASSERT(test_ret_value,
+                cugraph_type_erased_device_array_pointer(imported) == src_pointer,
+                "imported array is a copy.");
+    TEST_ASSERT(test_ret_value,
+                cugraph_type_erased_device_array_size(imported) == num_vertices,
+                "imported array size doesn't match.");
+    TEST_ASSERT(test_ret_value,
+                cugraph_type_erased_device_array_type(imported) == INT32,
+                "imported array type doesn't match.");
+  }
+
+  cugraph_type_erased_device_array_free(src);
+
+  if (test_ret_value == 0) {
+    ret_code = cugraph_type_erased_device_array_copy_to_host(
+      p_handle, (byte_t*)h_result, imported, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "imported copy_to_host failed.");
+
+    for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+      TEST_ASSERT(test_ret_value, h_result[i] == h_src[i], "imported values don't match");
+    }
+  }
+
+  if (imported != NULL) { cugraph_type_erased_device_array_free(imported); }
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_dlpack_round_trip() { return generic_array_interop_test(0); }
+
+int test_arrow_round_trip() { return generic_array_interop_test(1); }
+
+void release_test_arrow_array(struct ArrowArray* array) { array->release = NULL; }
+
+int test_arrow_unsupported_type()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_t* ret_error                   = NULL;
+  cugraph_type_erased_device_array_t* imported = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  p_handle                            = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  const void* buffers[2] = {NULL, NULL};
+
+  struct ArrowSchema schema = {"s", "", NULL, 0, 0, NULL, NULL, NULL, NULL};
+  struct ArrowDeviceArray device_array;
+  device_array.array.length     = 0;
+  device_array.array.null_count = 0;
+  device_array.array.offset     = 0;
+  device_array.array.n_buffers  = 2;
+  device_array.array.n_children = 0;
+  device_array.array.buffers    = buffers;
+  device_array.array.release    = release_test_arrow_array;
+  device_array.device_id        = 0;
+  device_array.device_type      = ARROW_DEVICE_CUDA;
+  device_array.sync_event       = NULL;
+
+  cugraph_error_code_t ret_code = cugraph_type_erased_device_array_from_arrow(
+    p_handle, &schema, &device_array, &imported, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code != CUGRAPH_SUCCESS, "int16 arrow array accepted.");
+  TEST_ASSERT(test_ret_value,
+              device_array.array.release != NULL,
+              "rejected arrow array should stay owned by the caller.");
+
+  if (device_array.array.release != NULL) { device_array.array.release(&device_array.array); }
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_dlpack_round_trip);
+  result |= RUN_TEST(test_arrow_round_trip);
+  result |= RUN_TEST(test_arrow_unsupported_type);
+  return result;
+}
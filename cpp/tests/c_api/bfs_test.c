@@ -161,6 +161,294 @@ int test_bfs_with_transpose()
                           TRUE);
 }
 
+/*
+ * Write into caller-provided output arrays and view the graph's vertex ids.
+ */
+int test_bfs_with_options()
+{
+  int test_ret_value = 0;
+
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[]                 = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[]                 = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[]                 = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t h_seeds[]               = {0};
+  vertex_t expected_distances[]    = {0, 1, 2147483647, 2, 2, 3};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 3};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_handle                = NULL;
+  cugraph_graph_t* p_graph                           = NULL;
+  cugraph_paths_result_t* p_result                   = NULL;
+  cugraph_type_erased_device_array_t* p_sources      = NULL;
+  cugraph_type_erased_device_array_t* p_distances    = NULL;
+  cugraph_type_erased_device_array_t* p_predecessors = NULL;
+
+  p_handle = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code =
+    create_test_graph(p_handle, h_src, h_dst, h_wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_type_erased_device_array_create(p_handle, INT32, 1, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_from_host(
+    p_handle, p_sources, (byte_t*)h_seeds, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(
+    p_handle, INT32, num_vertices, &p_distances, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_distances create failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(
+    p_handle, INT32, num_vertices, &p_predecessors, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_predecessors create failed.");
+
+  cugraph_result_options_t options;
+  cugraph_result_options_init(&options);
+  options.vertex_ids_mode = CUGRAPH_VERTEX_IDS_VIEW;
+  options.values          = p_distances;
+  options.predecessors    = p_predecessors;
+
+  ret_code = cugraph_bfs_with_options(
+    p_handle, p_graph, p_sources, FALSE, 10, FALSE, TRUE, &options, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs_with_options failed.");
+
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_pointer(cugraph_paths_result_get_distances(
+                p_result)) == cugraph_type_erased_device_array_pointer(p_distances),
+              "distances should be written into the caller-provided array");
+
+  vertex_t h_vertices[num_vertices];
+  vertex_t h_distances[num_vertices];
+  vertex_t h_predecessors[num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_distances, p_distances, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_predecessors, p_predecessors, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                expected_distances[h_vertices[i]] == h_distances[i],
+                "bfs distances don't match");
+
+    TEST_ASSERT(test_ret_value,
+                expected_predecessors[h_vertices[i]] == h_predecessors[i],
+                "bfs predecessors don't match");
+  }
+
+  cugraph_paths_result_free(p_result);
+
+  // skipping the vertex ids leaves the result's vertex array NULL
+  options.vertex_ids_mode = CUGRAPH_VERTEX_IDS_SKIP;
+
+  ret_code = cugraph_bfs_with_options(
+    p_handle, p_graph, p_sources, FALSE, 10, FALSE, FALSE, &options, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs_with_options failed.");
+  TEST_ASSERT(test_ret_value,
+              cugraph_paths_result_get_vertices(p_result) == NULL,
+              "vertex ids should be skipped");
+
+  cugraph_paths_result_free(p_result);
+  cugraph_type_erased_device_array_free(p_predecessors);
+  cugraph_type_erased_device_array_free(p_distances);
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Run a batch of searches in one call, one row of distances per source.
+ */
+int test_bfs_batch()
+{
+  int test_ret_value = 0;
+
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+  size_t num_seeds    = 2;
+
+  vertex_t h_src[]              = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[]              = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[]              = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t h_seeds[]            = {0, 1};
+  vertex_t expected_distances[] = {0,          1, 2147483647, 2, 2, 3,
+                                   2147483647, 0, 2147483647, 1, 1, 2};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_handle           = NULL;
+  cugraph_graph_t* p_graph                      = NULL;
+  cugraph_paths_result_t* p_result              = NULL;
+  cugraph_type_erased_device_array_t* p_sources = NULL;
+
+  p_handle = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code =
+    create_test_graph(p_handle, h_src, h_dst, h_wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, INT32, num_seeds, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_from_host(
+    p_handle, p_sources, (byte_t*)h_seeds, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  ret_code = cugraph_bfs_batch(p_handle, p_graph, p_sources, 10, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs_batch failed.");
+
+  vertex_t h_vertices[num_vertices];
+  vertex_t h_distances[num_seeds * num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_distances, cugraph_paths_result_get_distances(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int s = 0; (s < num_seeds) && (test_ret_value == 0); ++s) {
+    for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+      TEST_ASSERT(test_ret_value,
+                  expected_distances[s * num_vertices + h_vertices[i]] ==
+                    h_distances[s * num_vertices + i],
+                  "bfs_batch distances don't match");
+    }
+  }
+
+  cugraph_paths_result_free(p_result);
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Launch a search asynchronously on a handle with its own stream and wait for it.
+ */
+int test_bfs_async()
+{
+  int test_ret_value = 0;
+
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[]                 = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[]                 = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[]                 = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t h_seeds[]               = {0};
+  vertex_t expected_distances[]    = {0, 1, 2147483647, 2, 2, 3};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 3};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_handle           = NULL;
+  cugraph_graph_t* p_graph                      = NULL;
+  cugraph_paths_result_t* p_result              = NULL;
+  cugraph_completion_t* p_completion            = NULL;
+  cugraph_type_erased_device_array_t* p_sources = NULL;
+
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+
+  cugraph_resource_handle_config_t config;
+  cugraph_resource_handle_config_init(&config);
+  config.stream = stream;
+
+  ret_code = cugraph_create_resource_handle_from_config(&config, &p_handle, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "resource handle creation failed.");
+
+  ret_code =
+    create_test_graph(p_handle, h_src, h_dst, h_wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_type_erased_device_array_create(p_handle, INT32, 1, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_from_host(
+    p_handle, p_sources, (byte_t*)h_seeds, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  ret_code = cugraph_bfs_async(p_handle,
+                               p_graph,
+                               p_sources,
+                               FALSE,
+                               10,
+                               FALSE,
+                               TRUE,
+                               NULL,
+                               NULL,
+                               NULL,
+                               &p_result,
+                               &p_completion,
+                               &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs_async failed.");
+
+  ret_code = cugraph_completion_wait(p_completion, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "async bfs failed.");
+  TEST_ASSERT(test_ret_value,
+              cugraph_completion_is_ready(p_completion) == TRUE,
+              "completion should be ready after wait");
+
+  vertex_t h_vertices[num_vertices];
+  vertex_t h_distances[num_vertices];
+  vertex_t h_predecessors[num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_distances, cugraph_paths_result_get_distances(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_predecessors, cugraph_paths_result_get_predecessors(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                expected_distances[h_vertices[i]] == h_distances[i],
+                "bfs distances don't match");
+
+    TEST_ASSERT(test_ret_value,
+                expected_predecessors[h_vertices[i]] == h_predecessors[i],
+                "bfs predecessors don't match");
+  }
+
+  cugraph_completion_free(p_completion);
+  cugraph_paths_result_free(p_result);
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cudaStreamDestroy(stream);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
 /******************************************************************************/
 
 int main(int argc, char** argv)
@@ -168,5 +456,8 @@ int main(int argc, char** argv)
   int result = 0;
   result |= RUN_TEST(test_bfs);
   result |= RUN_TEST(test_bfs_with_transpose);
+  result |= RUN_TEST(test_bfs_with_options);
+  result |= RUN_TEST(test_bfs_batch);
+  result |= RUN_TEST(test_bfs_async);
   return result;
 }
@@ -45,3 +45,12 @@ int create_test_graph(const cugraph_resource_handle_t* p_handle,
                       bool_t store_transposed,
                       cugraph_graph_t** p_graph,
                       cugraph_error_t** ret_error);
+int create_test_graph_with_properties(const cugraph_resource_handle_t* p_handle,
+                                      int32_t* h_src,
+                                      int32_t* h_dst,
+                                      float* h_wgt,
+                                      size_t num_edges,
+                                      bool_t store_transposed,
+                                      bool_t is_symmetric,
+                                      cugraph_graph_t** p_graph,
+                                      cugraph_error_t** ret_error);
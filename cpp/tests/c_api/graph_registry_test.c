@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <math.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+int check_pagerank(const cugraph_resource_handle_t* p_handle,
+                   cugraph_graph_t* p_graph,
+                   weight_t* h_result,
+                   size_t num_vertices)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_pagerank_result_t* p_result = NULL;
+
+  ret_code = cugraph_pagerank(
+    p_handle, p_graph, NULL, 0.95, 0.0001, 20, FALSE, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_pagerank failed.");
+
+  vertex_t h_vertices[num_vertices];
+  weight_t h_pageranks[num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_vertices, cugraph_pagerank_result_get_vertices(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_pageranks, cugraph_pagerank_result_get_pageranks(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(h_result[h_vertices[i]], h_pageranks[i], 0.001),
+                "pagerank results don't match");
+  }
+
+  cugraph_pagerank_result_free(p_result);
+
+  return test_ret_value;
+}
+
+/*
+ * Register one graph and run PageRank on two graphs opened from it.  The graph is registered
+ * in the non-transposed layout so the first call creates the cached transposed copy and the
+ * second call reuses it.
+ */
+int test_graph_registry()
+{
+  int test_ret_value = 0;
+
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[]    = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[]    = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[]    = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  weight_t h_result[] = {0.0915528, 0.168382, 0.0656831, 0.191468, 0.120677, 0.362237};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_graph_t* p_opened_1         = NULL;
+  cugraph_graph_t* p_opened_2         = NULL;
+
+  p_handle = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  // src/dst are passed backwards, transposing the graph restores the expected results
+  ret_code =
+    create_test_graph(p_handle, h_dst, h_src, h_wgt, num_edges, FALSE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  ret_code = cugraph_graph_registry_register("test_graph", p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "graph registration failed.");
+
+  ret_code = cugraph_graph_registry_open("test_graph", &p_opened_1, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "graph open failed.");
+
+  ret_code = cugraph_graph_registry_open("test_graph", &p_opened_2, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "graph open failed.");
+
+  ret_code = cugraph_graph_registry_register("test_graph", p_opened_1, &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code == CUGRAPH_INVALID_INPUT,
+              "registering an opened graph should fail.");
+  cugraph_error_free(ret_error);
+
+  test_ret_value |= check_pagerank(p_handle, p_opened_1, h_result, num_vertices);
+  test_ret_value |= check_pagerank(p_handle, p_opened_2, h_result, num_vertices);
+
+  // the storage outlives the registry entry until the last opened graph is freed
+  ret_code = cugraph_graph_registry_unregister("test_graph", &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "graph unregistration failed.");
+
+  ret_code = cugraph_graph_registry_open("test_graph", &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code == CUGRAPH_INVALID_INPUT,
+              "opening an unregistered graph should fail.");
+  cugraph_error_free(ret_error);
+
+  cugraph_sg_graph_free(p_opened_1);
+
+  test_ret_value |= check_pagerank(p_handle, p_opened_2, h_result, num_vertices);
+
+  cugraph_sg_graph_free(p_opened_2);
+  cugraph_free_resource_handle(p_handle);
+
+  return test_ret_value;
+}
+
+/*
+ * Free the resource handle the graph was created on right after registering the graph, then
+ * open the graph and run PageRank on a second handle.  The first call on the second handle
+ * builds the cached transposed copy, which refers to the (freed) creating handle.
+ */
+int test_graph_registry_free_creating_handle()
+{
+  int test_ret_value = 0;
+
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[]    = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[]    = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[]    = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  weight_t h_result[] = {0.0915528, 0.168382, 0.0656831, 0.191468, 0.120677, 0.362237};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_creating_handle = NULL;
+  cugraph_resource_handle_t* p_handle          = NULL;
+  cugraph_graph_t* p_graph                     = NULL;
+  cugraph_graph_t* p_opened                    = NULL;
+
+  p_creating_handle = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_creating_handle != NULL, "resource handle creation failed.");
+
+  // src/dst are passed backwards, transposing the graph restores the expected results
+  ret_code = create_test_graph(
+    p_creating_handle, h_dst, h_src, h_wgt, num_edges, FALSE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  ret_code = cugraph_graph_registry_register("test_graph", p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "graph registration failed.");
+
+  cugraph_free_resource_handle(p_creating_handle);
+
+  p_handle = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = cugraph_graph_registry_open("test_graph", &p_opened, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "graph open failed.");
+
+  test_ret_value |= check_pagerank(p_handle, p_opened, h_result, num_vertices);
+
+  ret_code = cugraph_graph_registry_unregister("test_graph", &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "graph unregistration failed.");
+
+  cugraph_sg_graph_free(p_opened);
+  cugraph_free_resource_handle(p_handle);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_graph_registry);
+  result |= RUN_TEST(test_graph_registry_free_creating_handle);
+  return result;
+}
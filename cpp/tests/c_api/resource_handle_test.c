@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/array.h>
+#include <cugraph_c/cugraph_api.h>
+#include <cugraph_c/graph.h>
+
+#include <cuda_runtime_api.h>
+#include <stdio.h>
+
+/*
+ * Round trip an array through a handle created from a configuration.
+ */
+int generic_resource_handle_test(cugraph_memory_resource_type_t memory_resource_type,
+                                 int use_stream)
+{
+  int test_ret_value = 0;
+
+  typedef int32_t vertex_t;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+  size_t num_vertices           = 6;
+
+  vertex_t h_src[] = {0, 1, 2, 3, 4, 5};
+  vertex_t h_result[6];
+
+  cudaStream_t stream = NULL;
+  if (use_stream) { cudaStreamCreate(&stream); }
+
+  cugraph_resource_handle_config_t config;
+  cugraph_resource_handle_config_init(&config);
+  config.stream               = stream;
+  config.num_internal_streams = use_stream ? 2 : 0;
+  config.memory_resource_type = memory_resource_type;
+  config.initial_pool_size    = 1 << 20;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  ret_code = cugraph_create_resource_handle_from_config(&config, &p_handle, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "resource handle creation failed.");
+
+  cugraph_type_erased_device_array_t* src;
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, INT32, num_vertices, &src, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src create failed.");
+
+  ret_code =
+    cugraph_type_erased_device_array_copy_from_host(p_handle, src, (byte_t*)h_src, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  ret_code =
+    cugraph_type_erased_device_array_copy_to_host(p_handle, (byte_t*)h_result, src, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_to_host failed.");
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_result[i] == h_src[i], "copied values don't match");
+  }
+
+  cugraph_type_erased_device_array_free(src);
+  cugraph_free_resource_handle(p_handle);
+  if (use_stream) { cudaStreamDestroy(stream); }
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_default_config()
+{
+  return generic_resource_handle_test(CUGRAPH_MEMORY_RESOURCE_CURRENT, 0);
+}
+
+int test_pool_with_stream()
+{
+  return generic_resource_handle_test(CUGRAPH_MEMORY_RESOURCE_POOL, 1);
+}
+
+int test_arena_with_stream()
+{
+  return generic_resource_handle_test(CUGRAPH_MEMORY_RESOURCE_ARENA, 1);
+}
+
+int test_invalid_config()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_config_t config;
+  cugraph_resource_handle_config_init(&config);
+  config.num_internal_streams = -1;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_error_code_t ret_code =
+    cugraph_create_resource_handle_from_config(&config, &p_handle, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code != CUGRAPH_SUCCESS, "invalid config accepted.");
+
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Results allocated from a pool handle's memory resource should stay valid after the handle (and
+ * a second pool handle created after it) is freed.
+ */
+int test_free_handle_before_results()
+{
+  int test_ret_value = 0;
+
+  typedef int32_t vertex_t;
+  typedef float weight_t;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+  size_t num_edges              = 8;
+  size_t num_vertices           = 6;
+
+  vertex_t h_src[]    = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[]    = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[]    = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  weight_t h_result[] = {0.0915528, 0.168382, 0.0656831, 0.191468, 0.120677, 0.362237};
+
+  cudaStream_t stream = NULL;
+  cudaStreamCreate(&stream);
+
+  cugraph_resource_handle_config_t config;
+  cugraph_resource_handle_config_init(&config);
+  config.stream               = stream;
+  config.memory_resource_type = CUGRAPH_MEMORY_RESOURCE_POOL;
+  config.initial_pool_size    = 1 << 20;
+
+  cugraph_resource_handle_t* p_handle       = NULL;
+  cugraph_resource_handle_t* p_other_handle = NULL;
+  ret_code = cugraph_create_resource_handle_from_config(&config, &p_handle, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "resource handle creation failed.");
+  ret_code = cugraph_create_resource_handle_from_config(&config, &p_other_handle, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "resource handle creation failed.");
+
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_pagerank_result_t* p_result = NULL;
+
+  ret_code =
+    create_test_graph(p_handle, h_src, h_dst, h_wgt, num_edges, TRUE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  ret_code = cugraph_pagerank(
+    p_handle, p_graph, NULL, 0.95, 0.0001, 20, FALSE, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_pagerank failed.");
+
+  /* free the handles (in creation order) before the graph and the results */
+  cugraph_free_resource_handle(p_handle);
+  cugraph_free_resource_handle(p_other_handle);
+
+  cugraph_resource_handle_t* p_read_handle = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_read_handle != NULL, "resource handle creation failed.");
+
+  vertex_t h_vertices[6];
+  weight_t h_pageranks[6];
+
+  if (test_ret_value == 0) {
+    ret_code = cugraph_type_erased_device_array_copy_to_host(
+      p_read_handle,
+      (byte_t*)h_vertices,
+      cugraph_pagerank_result_get_vertices(p_result),
+      &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_copy_to_host(
+      p_read_handle,
+      (byte_t*)h_pageranks,
+      cugraph_pagerank_result_get_pageranks(p_result),
+      &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+  }
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(h_result[h_vertices[i]], h_pageranks[i], 0.001),
+                "pagerank results don't match");
+  }
+
+  cugraph_pagerank_result_free(p_result);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_read_handle);
+  cudaStreamDestroy(stream);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_default_config);
+  result |= RUN_TEST(test_pool_with_stream);
+  result |= RUN_TEST(test_arena_with_stream);
+  result |= RUN_TEST(test_invalid_config);
+  result |= RUN_TEST(test_free_handle_before_results);
+  return result;
+}
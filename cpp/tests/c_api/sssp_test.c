@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <float.h>
+#include <math.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+const weight_t EPSILON = 0.001;
+
+/*
+ * Run sssp (num_seeds == 1) or sssp_batch and compare row s of the results with
+ * expected_distances[s * num_vertices, (s + 1) * num_vertices).
+ */
+int generic_sssp_test(vertex_t* h_src,
+                      vertex_t* h_dst,
+                      weight_t* h_wgt,
+                      vertex_t* h_seeds,
+                      weight_t const* expected_distances,
+                      vertex_t const* expected_predecessors,
+                      size_t num_vertices,
+                      size_t num_edges,
+                      size_t num_seeds,
+                      double cutoff,
+                      bool_t store_transposed)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_handle           = NULL;
+  cugraph_graph_t* p_graph                      = NULL;
+  cugraph_paths_result_t* p_result              = NULL;
+  cugraph_type_erased_device_array_t* p_sources = NULL;
+
+  p_handle = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph(
+    p_handle, h_src, h_dst, h_wgt, num_edges, store_transposed, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  if (num_seeds == 1) {
+    ret_code =
+      cugraph_sssp(p_handle, p_graph, h_seeds[0], cutoff, TRUE, FALSE, &p_result, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_sssp failed.");
+  } else {
+    ret_code =
+      cugraph_type_erased_device_array_create(p_handle, INT32, num_seeds, &p_sources, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+    ret_code = cugraph_type_erased_device_array_copy_from_host(
+      p_handle, p_sources, (byte_t*)h_seeds, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+    ret_code = cugraph_sssp_batch(
+      p_handle, p_graph, p_sources, cutoff, TRUE, FALSE, &p_result, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_sssp_batch failed.");
+  }
+
+  cugraph_type_erased_device_array_t* vertices;
+  cugraph_type_erased_device_array_t* distances;
+  cugraph_type_erased_device_array_t* predecessors;
+
+  vertices     = cugraph_paths_result_get_vertices(p_result);
+  distances    = cugraph_paths_result_get_distances(p_result);
+  predecessors = cugraph_paths_result_get_predecessors(p_result);
+
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_size(distances) == num_seeds * num_vertices,
+              "unexpected number of distances");
+
+  vertex_t h_vertices[num_vertices];
+  weight_t h_distances[num_seeds * num_vertices];
+  vertex_t h_predecessors[num_seeds * num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_vertices, vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_distances, distances, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_predecessors, predecessors, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int s = 0; (s < num_seeds) && (test_ret_value == 0); ++s) {
+    for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+      weight_t expected = expected_distances[s * num_vertices + h_vertices[i]];
+      weight_t computed = h_distances[s * num_vertices + i];
+      TEST_ASSERT(test_ret_value,
+                  (expected == FLT_MAX) ? (computed == FLT_MAX)
+                                        : (fabsf(expected - computed) < EPSILON),
+                  "sssp distances don't match");
+
+      TEST_ASSERT(test_ret_value,
+                  expected_predecessors[s * num_vertices + h_vertices[i]] ==
+                    h_predecessors[s * num_vertices + i],
+                  "sssp predecessors don't match");
+    }
+  }
+
+  if (p_sources != NULL) { cugraph_type_erased_device_array_free(p_sources); }
+  cugraph_paths_result_free(p_result);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_sssp()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                   = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[]                   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t seeds[]                 = {0};
+  weight_t expected_distances[]    = {0.0f, 0.1f, FLT_MAX, 2.2f, 1.2f, 4.4f};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 4};
+
+  // sssp wants store_transposed = FALSE
+  return generic_sssp_test(src,
+                           dst,
+                           wgt,
+                           seeds,
+                           expected_distances,
+                           expected_predecessors,
+                           num_vertices,
+                           num_edges,
+                           1,
+                           FLT_MAX,
+                           FALSE);
+}
+
+int test_sssp_batch_with_transpose()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                   = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[]                   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t seeds[]                 = {0, 1};
+  weight_t expected_distances[]    = {0.0f,    0.1f, FLT_MAX, 2.2f, 1.2f, 4.4f,
+                                   FLT_MAX, 0.0f, FLT_MAX, 2.1f, 1.1f, 4.3f};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 4, -1, -1, -1, 1, 1, 4};
+
+  // sssp wants store_transposed = FALSE
+  //    This call will force cugraph_sssp_batch to transpose the graph
+  return generic_sssp_test(src,
+                           dst,
+                           wgt,
+                           seeds,
+                           expected_distances,
+                           expected_predecessors,
+                           num_vertices,
+                           num_edges,
+                           2,
+                           FLT_MAX,
+                           TRUE);
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_sssp);
+  result |= RUN_TEST(test_sssp_batch_with_transpose);
+  return result;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Cold start benchmark: measures the time to the first result of a fresh process (create a
+ * handle, build a small graph, run BFS) and compares it with a second, warm, BFS call.  Must be
+ * the only cugraph work in the process, so it does not use RUN_TEST.  Run it with and without
+ * CUDA_MODULE_LOADING=LAZY to see how much of the startup cost is module loading.
+ */
+
+#include "c_test_utils.h"
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+static double now_in_seconds()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Seconds since the process started (includes loading and relocating the shared libraries
+ * before main), -1 if not available.  CLOCK_BOOTTIME and the process start time in
+ * /proc/self/stat share the same origin.
+ */
+static double seconds_since_process_start()
+{
+  FILE* fp = fopen("/proc/self/stat", "r");
+  if (fp == NULL) return -1.0;
+
+  // skip the first 21 fields (the second field, the executable name, contains no spaces here)
+  unsigned long long start_ticks = 0;
+  int ret = fscanf(fp,
+                   "%*d %*s %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %*u %*u %*d %*d %*d %*d "
+                   "%*d %*d %llu",
+                   &start_ticks);
+  fclose(fp);
+  if (ret != 1) return -1.0;
+
+  struct timespec ts;
+  clock_gettime(CLOCK_BOOTTIME, &ts);
+
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9 -
+         (double)start_ticks / (double)sysconf(_SC_CLK_TCK);
+}
+
+static int run_bfs(const cugraph_resource_handle_t* p_handle,
+                   cugraph_graph_t* p_graph,
+                   cugraph_type_erased_device_array_t* p_sources)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_paths_result_t* p_result = NULL;
+
+  ret_code =
+    cugraph_bfs(p_handle, p_graph, p_sources, FALSE, 10, TRUE, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs failed.");
+
+  vertex_t h_distances[6];
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_distances, cugraph_paths_result_get_distances(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  cugraph_paths_result_free(p_result);
+
+  return test_ret_value;
+}
+
+int main(int argc, char** argv)
+{
+  int test_ret_value = 0;
+
+  vertex_t h_src[]   = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[]   = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[]   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t h_seeds[] = {0};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_handle           = NULL;
+  cugraph_graph_t* p_graph                      = NULL;
+  cugraph_type_erased_device_array_t* p_sources = NULL;
+
+  const char* module_loading = getenv("CUDA_MODULE_LOADING");
+
+  double main_entry = seconds_since_process_start();
+  double start      = now_in_seconds();
+
+  p_handle = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+  if (test_ret_value != 0) return test_ret_value;
+
+  double handle_created = now_in_seconds();
+
+  ret_code = create_test_graph(p_handle, h_src, h_dst, h_wgt, 8, FALSE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "graph creation failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(p_handle, INT32, 1, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  ret_code = cugraph_type_erased_device_array_copy_from_host(
+    p_handle, p_sources, (byte_t*)h_seeds, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  double graph_created = now_in_seconds();
+
+  if (test_ret_value == 0) test_ret_value = run_bfs(p_handle, p_graph, p_sources);
+
+  double first_bfs = now_in_seconds();
+
+  if (test_ret_value == 0) test_ret_value = run_bfs(p_handle, p_graph, p_sources);
+
+  double second_bfs = now_in_seconds();
+
+  printf("startup (CUDA_MODULE_LOADING=%s):\n", module_loading ? module_loading : "<unset>");
+  if (main_entry >= 0.0) { printf("  process start to main:  %f s\n", main_entry); }
+  printf("  create handle:          %f s\n", handle_created - start);
+  printf("  create graph:           %f s\n", graph_created - handle_created);
+  printf("  first BFS:              %f s\n", first_bfs - graph_created);
+  printf("  time to first result:   %f s\n", first_bfs - start);
+  printf("  second (warm) BFS:      %f s\n", second_bfs - first_bfs);
+
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+
+  return test_ret_value;
+}
@@ -38,12 +38,30 @@ int create_test_graph(const cugraph_resource_handle_t* p_handle,
                       bool_t store_transposed,
                       cugraph_graph_t** p_graph,
                       cugraph_error_t** ret_error)
+{
+  return create_test_graph_with_properties(
+    p_handle, h_src, h_dst, h_wgt, num_edges, store_transposed, FALSE, p_graph, ret_error);
+}
+
+/*
+ * Same as create_test_graph, the caller tells whether the edge list is symmetric (both directions
+ * of every edge are listed).
+ */
+int create_test_graph_with_properties(const cugraph_resource_handle_t* p_handle,
+                                      int32_t* h_src,
+                                      int32_t* h_dst,
+                                      float* h_wgt,
+                                      size_t num_edges,
+                                      bool_t store_transposed,
+                                      bool_t is_symmetric,
+                                      cugraph_graph_t** p_graph,
+                                      cugraph_error_t** ret_error)
 {
   int test_ret_value = 0;
   cugraph_error_code_t ret_code;
   cugraph_graph_properties_t properties;
 
-  properties.is_symmetric  = FALSE;
+  properties.is_symmetric  = is_symmetric;
   properties.is_multigraph = FALSE;
 
   data_type_id_t vertex_tid = INT32;
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+/*
+ * Check that two vertices share a label iff they share a component in expected_components.
+ */
+int generic_wcc_test(vertex_t* h_src,
+                     vertex_t* h_dst,
+                     weight_t* h_wgt,
+                     vertex_t const* expected_components,
+                     size_t num_vertices,
+                     size_t num_edges,
+                     bool_t store_transposed)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_labeling_result_t* p_result = NULL;
+
+  p_handle = cugraph_create_resource_handle();
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph_with_properties(
+    p_handle, h_src, h_dst, h_wgt, num_edges, store_transposed, TRUE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  ret_code = cugraph_weakly_connected_components(p_handle, p_graph, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code == CUGRAPH_SUCCESS,
+              "cugraph_weakly_connected_components failed.");
+
+  cugraph_type_erased_device_array_t* vertices;
+  cugraph_type_erased_device_array_t* labels;
+
+  vertices = cugraph_labeling_result_get_vertices(p_result);
+  labels   = cugraph_labeling_result_get_labels(p_result);
+
+  vertex_t h_vertices[num_vertices];
+  vertex_t h_labels[num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_copy_to_host(
+    p_handle, (byte_t*)h_vertices, vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code =
+    cugraph_type_erased_device_array_copy_to_host(p_handle, (byte_t*)h_labels, labels, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    for (int j = 0; (j < num_vertices) && (test_ret_value == 0); ++j) {
+      TEST_ASSERT(test_ret_value,
+                  (expected_components[h_vertices[i]] == expected_components[h_vertices[j]]) ==
+                    (h_labels[i] == h_labels[j]),
+                  "wcc labels don't match");
+    }
+  }
+
+  cugraph_labeling_result_free(p_result);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_wcc()
+{
+  size_t num_edges    = 6;
+  size_t num_vertices = 5;
+
+  vertex_t src[]                 = {0, 1, 1, 2, 3, 4};
+  vertex_t dst[]                 = {1, 0, 2, 1, 4, 3};
+  weight_t wgt[]                 = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+  vertex_t expected_components[] = {0, 0, 0, 1, 1};
+
+  return generic_wcc_test(src, dst, wgt, expected_components, num_vertices, num_edges, FALSE);
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_wcc);
+  return result;
+}
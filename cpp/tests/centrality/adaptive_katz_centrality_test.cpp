@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+struct AdaptiveKatzCentrality_Usecase {
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_AdaptiveKatzCentrality
+  : public ::testing::TestWithParam<std::tuple<AdaptiveKatzCentrality_Usecase, input_usecase_t>> {
+ public:
+  Tests_AdaptiveKatzCentrality() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(AdaptiveKatzCentrality_Usecase const& katz_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, katz_usecase.test_weighted, true);
+    auto graph_view = graph.view();
+
+    auto degrees = graph_view.compute_in_degrees(handle);
+    std::vector<edge_t> h_degrees(degrees.size());
+    raft::update_host(h_degrees.data(), degrees.data(), degrees.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+    auto max_it = std::max_element(h_degrees.begin(), h_degrees.end());
+
+    result_t const alpha = result_t{1.0} / static_cast<result_t>(*max_it + 1);
+    result_t constexpr beta{1.0};
+    result_t constexpr epsilon{1e-6};
+
+    rmm::device_uvector<result_t> d_katz_centralities(graph_view.get_number_of_vertices(),
+                                                      handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [residual, num_iterations] =
+      cugraph::adaptive_katz_centrality(handle,
+                                        graph_view,
+                                        static_cast<result_t*>(nullptr),
+                                        d_katz_centralities.data(),
+                                        alpha,
+                                        beta,
+                                        epsilon,
+                                        std::numeric_limits<size_t>::max(),
+                                        false,
+                                        true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Adaptive Katz Centrality took " << elapsed_time * 1e-6 << " s ("
+                << num_iterations << " iterations).\n";
+    }
+
+    if (katz_usecase.check_correctness) {
+      // every vertex changes by less than epsilon in the final full iteration
+      ASSERT_TRUE(residual <
+                  epsilon * static_cast<result_t>(graph_view.get_number_of_vertices()))
+        << "Adaptive Katz centrality residual " << residual << " exceeds the tolerance.";
+
+      rmm::device_uvector<result_t> d_reference_katz_centralities(
+        graph_view.get_number_of_vertices(), handle.get_stream());
+      cugraph::katz_centrality(handle,
+                               graph_view,
+                               static_cast<result_t*>(nullptr),
+                               d_reference_katz_centralities.data(),
+                               alpha,
+                               beta,
+                               epsilon,
+                               std::numeric_limits<size_t>::max(),
+                               false,
+                               true);
+
+      std::vector<result_t> h_reference_katz_centralities(d_reference_katz_centralities.size());
+      std::vector<result_t> h_cugraph_katz_centralities(d_katz_centralities.size());
+      raft::update_host(h_reference_katz_centralities.data(),
+                        d_reference_katz_centralities.data(),
+                        d_reference_katz_centralities.size(),
+                        handle.get_stream());
+      raft::update_host(h_cugraph_katz_centralities.data(),
+                        d_katz_centralities.data(),
+                        d_katz_centralities.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      auto threshold_ratio = 1e-3;
+      auto threshold_magnitude =
+        (1.0 / static_cast<result_t>(graph_view.get_number_of_vertices())) *
+        threshold_ratio;  // skip comparison for low Katz Centrality verties (lowly ranked vertices)
+      auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <
+               std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+      };
+
+      ASSERT_TRUE(std::equal(h_reference_katz_centralities.begin(),
+                             h_reference_katz_centralities.end(),
+                             h_cugraph_katz_centralities.begin(),
+                             nearly_equal))
+        << "Adaptive Katz centrality values do not match with the Katz centrality values.";
+    }
+  }
+};
+
+using Tests_AdaptiveKatzCentrality_File = Tests_AdaptiveKatzCentrality<cugraph::test::File_Usecase>;
+using Tests_AdaptiveKatzCentrality_Rmat = Tests_AdaptiveKatzCentrality<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_AdaptiveKatzCentrality_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_AdaptiveKatzCentrality_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_AdaptiveKatzCentrality_Rmat, CheckInt64Int64FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_AdaptiveKatzCentrality_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(AdaptiveKatzCentrality_Usecase{false},
+                      AdaptiveKatzCentrality_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(rmat_small_test,
+                         Tests_AdaptiveKatzCentrality_Rmat,
+                         // enable correctness checks
+                         ::testing::Combine(::testing::Values(AdaptiveKatzCentrality_Usecase{false},
+                                                              AdaptiveKatzCentrality_Usecase{true}),
+                                            ::testing::Values(cugraph::test::Rmat_Usecase(
+                                              10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_AdaptiveKatzCentrality_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Combine(::testing::Values(AdaptiveKatzCentrality_Usecase{false, false},
+                                       AdaptiveKatzCentrality_Usecase{true, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <vector>
+
+// Brandes' algorithm, unnormalized scores (no division by 2 for symmetric graphs)
+template <typename vertex_t, typename edge_t, typename result_t>
+void betweenness_centrality_reference(edge_t const* offsets,
+                                      vertex_t const* indices,
+                                      vertex_t num_vertices,
+                                      result_t* betweennesses)
+{
+  std::fill(betweennesses, betweennesses + num_vertices, result_t{0.0});
+  std::vector<vertex_t> distances(num_vertices);
+  std::vector<double> sigmas(num_vertices);
+  std::vector<double> deltas(num_vertices);
+  std::vector<vertex_t> stack{};
+  for (vertex_t s = 0; s < num_vertices; ++s) {
+    std::fill(distances.begin(), distances.end(), std::numeric_limits<vertex_t>::max());
+    std::fill(sigmas.begin(), sigmas.end(), 0.0);
+    std::fill(deltas.begin(), deltas.end(), 0.0);
+    stack.clear();
+    std::queue<vertex_t> queue{};
+    distances[s] = 0;
+    sigmas[s]    = 1.0;
+    queue.push(s);
+    while (!queue.empty()) {
+      auto v = queue.front();
+      queue.pop();
+      stack.push_back(v);
+      for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+        auto w = indices[i];
+        if (distances[w] == std::numeric_limits<vertex_t>::max()) {
+          distances[w] = distances[v] + 1;
+          queue.push(w);
+        }
+        if (distances[w] == distances[v] + 1) { sigmas[w] += sigmas[v]; }
+      }
+    }
+    for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
+      auto v = *it;
+      for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+        auto w = indices[i];
+        if (distances[w] == distances[v] + 1) {
+          deltas[v] += sigmas[v] / sigmas[w] * (1.0 + deltas[w]);
+        }
+      }
+      if (v != s) { betweennesses[v] += static_cast<result_t>(deltas[v]); }
+    }
+  }
+}
+
+struct BetweennessCentrality_Usecase {
+  double epsilon{0.05};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_BetweennessCentrality
+  : public ::testing::TestWithParam<std::tuple<BetweennessCentrality_Usecase, input_usecase_t>> {
+ public:
+  Tests_BetweennessCentrality() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(BetweennessCentrality_Usecase const& bc_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = graph_view.get_number_of_vertices();
+
+    std::vector<vertex_t> h_sources(num_vertices);
+    std::iota(h_sources.begin(), h_sources.end(), vertex_t{0});
+    rmm::device_uvector<vertex_t> d_sources(h_sources.size(), handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+
+    rmm::device_uvector<result_t> d_betweennesses(num_vertices, handle.get_stream());
+    rmm::device_uvector<result_t> d_approximate_betweennesses(num_vertices, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::betweenness_centrality(handle,
+                                    graph_view,
+                                    d_sources.data(),
+                                    d_sources.size(),
+                                    d_betweennesses.data(),
+                                    false);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Betweenness Centrality took " << elapsed_time * 1e-6 << " s.\n";
+      hr_clock.start();
+    }
+
+    auto num_samples =
+      cugraph::approximate_betweenness_centrality(handle,
+                                                  graph_view,
+                                                  d_approximate_betweennesses.data(),
+                                                  static_cast<result_t>(bc_usecase.epsilon),
+                                                  result_t{0.01},
+                                                  uint64_t{0},
+                                                  false);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Approximate Betweenness Centrality took " << elapsed_time * 1e-6 << " s ("
+                << num_samples << " samples).\n";
+    }
+
+    if (bc_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(num_vertices + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        num_vertices + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      std::vector<result_t> h_cugraph_betweennesses(num_vertices);
+      std::vector<result_t> h_cugraph_approximate_betweennesses(num_vertices);
+      raft::update_host(h_cugraph_betweennesses.data(),
+                        d_betweennesses.data(),
+                        d_betweennesses.size(),
+                        handle.get_stream());
+      raft::update_host(h_cugraph_approximate_betweennesses.data(),
+                        d_approximate_betweennesses.data(),
+                        d_approximate_betweennesses.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      std::vector<result_t> h_reference_betweennesses(num_vertices);
+      betweenness_centrality_reference(
+        h_offsets.data(), h_indices.data(), num_vertices, h_reference_betweennesses.data());
+      auto symmetric_scale = graph_view.is_symmetric() ? result_t{2.0} : result_t{1.0};
+      std::transform(h_reference_betweennesses.begin(),
+                     h_reference_betweennesses.end(),
+                     h_reference_betweennesses.begin(),
+                     [symmetric_scale](auto val) { return val / symmetric_scale; });
+
+      auto threshold_ratio     = 1e-3;
+      auto threshold_magnitude = 1e-3;
+      auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <
+               std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+      };
+      ASSERT_TRUE(std::equal(h_reference_betweennesses.begin(),
+                             h_reference_betweennesses.end(),
+                             h_cugraph_betweennesses.begin(),
+                             nearly_equal))
+        << "Betweenness centrality values do not match with the reference values.";
+
+      if (num_vertices > 2) {
+        // the estimates divided by n(n - 2) are within epsilon (with the probability of 0.99)
+        auto error_scale = symmetric_scale / (static_cast<result_t>(num_vertices) *
+                                              static_cast<result_t>(num_vertices - 2));
+        auto epsilon     = bc_usecase.epsilon;
+        ASSERT_TRUE(std::equal(h_reference_betweennesses.begin(),
+                               h_reference_betweennesses.end(),
+                               h_cugraph_approximate_betweennesses.begin(),
+                               [error_scale, epsilon](auto lhs, auto rhs) {
+                                 return std::abs(lhs - rhs) * error_scale <= epsilon;
+                               }))
+          << "Approximate betweenness centrality values exceed the error tolerance.";
+      }
+    }
+  }
+};
+
+using Tests_BetweennessCentrality_File =
+  Tests_BetweennessCentrality<cugraph::test::File_Usecase>;
+using Tests_BetweennessCentrality_Rmat =
+  Tests_BetweennessCentrality<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_BetweennessCentrality_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_BetweennessCentrality_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BetweennessCentrality_Rmat, CheckInt64Int64DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_BetweennessCentrality_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BetweennessCentrality_Usecase{0.05}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(rmat_small_test,
+                         Tests_BetweennessCentrality_Rmat,
+                         // enable correctness checks
+                         ::testing::Combine(::testing::Values(BetweennessCentrality_Usecase{0.05}),
+                                            ::testing::Values(cugraph::test::Rmat_Usecase(
+                                              10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_BetweennessCentrality_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Combine(
+    ::testing::Values(BetweennessCentrality_Usecase{0.01, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(16, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <vector>
+
+template <typename vertex_t, typename edge_t, typename result_t>
+void closeness_centrality_reference(edge_t const* offsets,
+                                    vertex_t const* indices,
+                                    vertex_t num_vertices,
+                                    result_t* closenesses,
+                                    result_t* harmonic_centralities)
+{
+  std::vector<double> distance_sums(num_vertices, 0.0);
+  std::vector<double> reciprocal_distance_sums(num_vertices, 0.0);
+  std::vector<vertex_t> reached_counts(num_vertices, 0);
+  std::vector<vertex_t> distances(num_vertices);
+  for (vertex_t s = 0; s < num_vertices; ++s) {
+    std::fill(distances.begin(), distances.end(), std::numeric_limits<vertex_t>::max());
+    std::queue<vertex_t> queue{};
+    distances[s] = 0;
+    queue.push(s);
+    while (!queue.empty()) {
+      auto v = queue.front();
+      queue.pop();
+      if (v != s) {
+        distance_sums[v] += static_cast<double>(distances[v]);
+        reciprocal_distance_sums[v] += 1.0 / static_cast<double>(distances[v]);
+        ++reached_counts[v];
+      }
+      for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+        auto w = indices[i];
+        if (distances[w] == std::numeric_limits<vertex_t>::max()) {
+          distances[w] = distances[v] + 1;
+          queue.push(w);
+        }
+      }
+    }
+  }
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    auto c         = static_cast<double>(reached_counts[v]);
+    closenesses[v] = reached_counts[v] > 0
+                       ? static_cast<result_t>(c * c / ((num_vertices - 1) * distance_sums[v]))
+                       : result_t{0.0};
+    harmonic_centralities[v] = num_vertices > 1 ? static_cast<result_t>(reciprocal_distance_sums[v])
+                                                : result_t{0.0};
+  }
+}
+
+struct ClosenessCentrality_Usecase {
+  size_t num_pivots{std::numeric_limits<size_t>::max()};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ClosenessCentrality
+  : public ::testing::TestWithParam<std::tuple<ClosenessCentrality_Usecase, input_usecase_t>> {
+ public:
+  Tests_ClosenessCentrality() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(ClosenessCentrality_Usecase const& closeness_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = graph_view.get_number_of_vertices();
+
+    rmm::device_uvector<result_t> d_closenesses(num_vertices, handle.get_stream());
+    rmm::device_uvector<result_t> d_harmonic_centralities(num_vertices, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::closeness_centrality(handle,
+                                  graph_view,
+                                  closeness_usecase.num_pivots,
+                                  uint64_t{0},
+                                  std::make_optional(d_closenesses.data()),
+                                  std::make_optional(d_harmonic_centralities.data()));
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Closeness Centrality took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (closeness_usecase.check_correctness) {
+      ASSERT_TRUE(closeness_usecase.num_pivots >= static_cast<size_t>(num_vertices))
+        << "Correctness checks require every vertex to be a pivot.";
+
+      std::vector<edge_t> h_offsets(num_vertices + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        num_vertices + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      std::vector<result_t> h_cugraph_closenesses(num_vertices);
+      std::vector<result_t> h_cugraph_harmonic_centralities(num_vertices);
+      raft::update_host(h_cugraph_closenesses.data(),
+                        d_closenesses.data(),
+                        d_closenesses.size(),
+                        handle.get_stream());
+      raft::update_host(h_cugraph_harmonic_centralities.data(),
+                        d_harmonic_centralities.data(),
+                        d_harmonic_centralities.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      std::vector<result_t> h_reference_closenesses(num_vertices);
+      std::vector<result_t> h_reference_harmonic_centralities(num_vertices);
+      closeness_centrality_reference(h_offsets.data(),
+                                     h_indices.data(),
+                                     num_vertices,
+                                     h_reference_closenesses.data(),
+                                     h_reference_harmonic_centralities.data());
+
+      auto threshold_ratio     = 1e-4;
+      auto threshold_magnitude = 1e-6;
+      auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <
+               std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+      };
+      ASSERT_TRUE(std::equal(h_reference_closenesses.begin(),
+                             h_reference_closenesses.end(),
+                             h_cugraph_closenesses.begin(),
+                             nearly_equal))
+        << "Closeness centrality values do not match with the reference values.";
+      ASSERT_TRUE(std::equal(h_reference_harmonic_centralities.begin(),
+                             h_reference_harmonic_centralities.end(),
+                             h_cugraph_harmonic_centralities.begin(),
+                             nearly_equal))
+        << "Harmonic centrality values do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_ClosenessCentrality_File = Tests_ClosenessCentrality<cugraph::test::File_Usecase>;
+using Tests_ClosenessCentrality_Rmat = Tests_ClosenessCentrality<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ClosenessCentrality_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ClosenessCentrality_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ClosenessCentrality_Rmat, CheckInt64Int64DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ClosenessCentrality_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ClosenessCentrality_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ClosenessCentrality_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ClosenessCentrality_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ClosenessCentrality_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Combine(
+    ::testing::Values(ClosenessCentrality_Usecase{256, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+// power iteration on A + I (without the extrapolation)
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+void eigenvector_centrality_reference(edge_t const* offsets,
+                                      vertex_t const* indices,
+                                      std::optional<weight_t const*> weights,
+                                      result_t* centralities,
+                                      vertex_t num_vertices,
+                                      result_t epsilon,
+                                      size_t max_iterations)
+{
+  if (num_vertices == 0) { return; }
+
+  std::fill(centralities, centralities + num_vertices, result_t{1.0} / num_vertices);
+
+  std::vector<result_t> old_centralities(num_vertices, result_t{0.0});
+  size_t iter{0};
+  while (true) {
+    std::copy(centralities, centralities + num_vertices, old_centralities.begin());
+    for (vertex_t i = 0; i < num_vertices; ++i) {
+      centralities[i] = old_centralities[i];
+      for (auto j = *(offsets + i); j < *(offsets + i + 1); ++j) {
+        auto nbr = indices[j];
+        auto w   = weights ? (*weights)[j] : result_t{1.0};
+        centralities[i] += old_centralities[nbr] * w;
+      }
+    }
+    auto l2_norm = std::sqrt(
+      std::inner_product(centralities, centralities + num_vertices, centralities, result_t{0.0}));
+    std::transform(centralities,
+                   centralities + num_vertices,
+                   centralities,
+                   [l2_norm](auto val) { return val / l2_norm; });
+
+    result_t diff_sum{0.0};
+    for (vertex_t i = 0; i < num_vertices; ++i) {
+      diff_sum += std::abs(centralities[i] - old_centralities[i]);
+    }
+    if (diff_sum < epsilon * num_vertices) { break; }
+    iter++;
+    ASSERT_TRUE(iter < max_iterations);
+  }
+}
+
+struct EigenvectorCentrality_Usecase {
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_EigenvectorCentrality
+  : public ::testing::TestWithParam<std::tuple<EigenvectorCentrality_Usecase, input_usecase_t>> {
+ public:
+  Tests_EigenvectorCentrality() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(EigenvectorCentrality_Usecase const& eigenvector_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, eigenvector_usecase.test_weighted, false);
+    auto graph_view = graph.view();
+
+    result_t constexpr epsilon{1e-6};
+
+    rmm::device_uvector<result_t> d_centralities(graph_view.get_number_of_vertices(),
+                                                 handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::eigenvector_centrality(
+      handle, graph_view, d_centralities.data(), epsilon, std::numeric_limits<size_t>::max());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Eigenvector Centrality took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (eigenvector_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      auto h_weights = graph_view.is_weighted() ? std::make_optional<std::vector<weight_t>>(
+                                                    graph_view.get_number_of_edges(), weight_t{0.0})
+                                                : std::nullopt;
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        graph_view.get_number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      if (h_weights) {
+        raft::update_host((*h_weights).data(),
+                          *(graph_view.get_matrix_partition_view().get_weights()),
+                          graph_view.get_number_of_edges(),
+                          handle.get_stream());
+      }
+      auto h_cugraph_centralities =
+        cugraph::test::to_host(handle, d_centralities.data(), d_centralities.size());
+
+      // the reference runs with a tighter tolerance as the extrapolation changes the path to the
+      // fixed point
+      std::vector<result_t> h_reference_centralities(graph_view.get_number_of_vertices());
+      eigenvector_centrality_reference(
+        h_offsets.data(),
+        h_indices.data(),
+        h_weights ? std::optional<weight_t const*>{(*h_weights).data()} : std::nullopt,
+        h_reference_centralities.data(),
+        graph_view.get_number_of_vertices(),
+        epsilon * result_t{1e-2},
+        std::numeric_limits<size_t>::max());
+
+      auto threshold_ratio = 1e-3;
+      auto threshold_magnitude =
+        (1.0 / static_cast<result_t>(graph_view.get_number_of_vertices())) *
+        threshold_ratio;  // skip comparison for low centrality vertices (lowly ranked vertices)
+      auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <
+               std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+      };
+
+      ASSERT_TRUE(std::equal(h_reference_centralities.begin(),
+                             h_reference_centralities.end(),
+                             h_cugraph_centralities.begin(),
+                             nearly_equal))
+        << "Eigenvector centrality values do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_EigenvectorCentrality_File = Tests_EigenvectorCentrality<cugraph::test::File_Usecase>;
+using Tests_EigenvectorCentrality_Rmat = Tests_EigenvectorCentrality<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_EigenvectorCentrality_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_EigenvectorCentrality_File, CheckInt32Int32DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, double, double>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_EigenvectorCentrality_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_EigenvectorCentrality_Rmat, CheckInt64Int64FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_EigenvectorCentrality_File,
+  ::testing::Combine(
+    // enable correctness checks (connected graphs only, the limit depends on the initial values
+    // otherwise)
+    ::testing::Values(EigenvectorCentrality_Usecase{false}, EigenvectorCentrality_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_EigenvectorCentrality_Rmat,
+  ::testing::Combine(
+    // disable correctness checks
+    ::testing::Values(EigenvectorCentrality_Usecase{false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -9,8 +9,10 @@
  *
  */
 #include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
 #include <cugraph/legacy/graph.hpp>
 
 #include <rmm/device_vector.hpp>
@@ -160,4 +162,58 @@ TEST(ecg, dolphin)
   }
 }
 
+TEST(ecg, dolphin_graph_view)
+{
+  raft::handle_t handle;
+
+  auto [graph, d_renumber_map_labels] =
+    cugraph::test::construct_graph<int32_t, int32_t, float, false, false>(
+      handle, cugraph::test::File_Usecase("test/datasets/dolphins.mtx"), true, false);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<int32_t> result_v(graph_view.get_number_of_vertices(), handle.get_stream());
+
+  if (handle.get_device_properties().major < 7) {
+    EXPECT_THROW(cugraph::ecg(handle, graph_view, float{.05}, int32_t{16}, result_v.data()),
+                 cugraph::logic_error);
+  } else {
+    cugraph::ecg(handle, graph_view, float{.05}, int32_t{16}, result_v.data());
+
+    std::vector<int32_t> cluster_id(result_v.size());
+    raft::update_host(cluster_id.data(), result_v.data(), result_v.size(), handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());
+
+    int32_t max = *max_element(cluster_id.begin(), cluster_id.end());
+    int32_t min = *min_element(cluster_id.begin(), cluster_id.end());
+
+    ASSERT_EQ((min >= 0), 1);
+
+    std::set<int32_t> cluster_ids;
+    for (auto c : cluster_id) {
+      cluster_ids.insert(c);
+    }
+
+    ASSERT_EQ(cluster_ids.size(), size_t(max + 1));
+
+    // evaluate the modularity on the (input) CSR of graph_view
+    auto matrix_partition_view = graph_view.get_matrix_partition_view();
+    cugraph::legacy::GraphCSRView<int32_t, int32_t, float> graph_csr(
+      const_cast<int32_t*>(matrix_partition_view.get_offsets()),
+      const_cast<int32_t*>(matrix_partition_view.get_indices()),
+      const_cast<float*>(*(matrix_partition_view.get_weights())),
+      graph_view.get_number_of_vertices(),
+      graph_view.get_number_of_edges());
+
+    float modularity{0.0};
+
+    cugraph::ext_raft::analyzeClustering_modularity(
+      graph_csr, max + 1, result_v.data(), &modularity);
+
+    float random_modularity{0.95 * 0.4962422251701355};
+
+    ASSERT_GT(modularity, random_modularity);
+  }
+}
+
 CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+// self-loops are ignored, this code assumes that the graph is symmetric, has no multi-edges, and
+// every vertex's neighbor list is sorted; returns the K-truss edges (both directions) sorted by
+// (source, destination).
+template <typename vertex_t, typename edge_t>
+std::vector<std::tuple<vertex_t, vertex_t>> k_truss_reference(edge_t const* offsets,
+                                                              vertex_t const* indices,
+                                                              vertex_t num_vertices,
+                                                              size_t k)
+{
+  std::vector<std::vector<vertex_t>> adj_lists(num_vertices);
+  for (vertex_t i = 0; i < num_vertices; ++i) {
+    std::copy_if(indices + offsets[i],
+                 indices + offsets[i + 1],
+                 std::back_inserter(adj_lists[i]),
+                 [i](auto nbr) { return nbr != i; });
+  }
+
+  // peel one round at a time (supports are computed on the graph at the beginning of the round)
+
+  while (true) {
+    std::vector<std::vector<vertex_t>> new_adj_lists(num_vertices);
+    bool removed{false};
+    for (vertex_t i = 0; i < num_vertices; ++i) {
+      for (auto nbr : adj_lists[i]) {
+        std::vector<vertex_t> common_nbrs{};
+        std::set_intersection(adj_lists[i].begin(),
+                              adj_lists[i].end(),
+                              adj_lists[nbr].begin(),
+                              adj_lists[nbr].end(),
+                              std::back_inserter(common_nbrs));
+        if (common_nbrs.size() + 2 >= k) {
+          new_adj_lists[i].push_back(nbr);
+        } else {
+          removed = true;
+        }
+      }
+    }
+    adj_lists = std::move(new_adj_lists);
+    if (!removed) { break; }
+  }
+
+  std::vector<std::tuple<vertex_t, vertex_t>> edges{};
+  for (vertex_t i = 0; i < num_vertices; ++i) {
+    for (auto nbr : adj_lists[i]) {
+      edges.push_back(std::make_tuple(i, nbr));
+    }
+  }
+
+  return edges;
+}
+
+struct KTruss_Usecase {
+  size_t k{3};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_KTruss
+  : public ::testing::TestWithParam<std::tuple<KTruss_Usecase, input_usecase_t>> {
+ public:
+  Tests_KTruss() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(KTruss_Usecase const& k_truss_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false, true, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [d_srcs, d_dsts] = cugraph::k_truss_subgraph(handle, graph_view, k_truss_usecase.k);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "K-Truss took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (k_truss_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        graph_view.get_number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+
+      std::vector<vertex_t> h_srcs(d_srcs.size());
+      std::vector<vertex_t> h_dsts(d_dsts.size());
+      raft::update_host(h_srcs.data(), d_srcs.data(), d_srcs.size(), handle.get_stream());
+      raft::update_host(h_dsts.data(), d_dsts.data(), d_dsts.size(), handle.get_stream());
+
+      handle.get_stream_view().synchronize();
+
+      auto h_reference_edges = k_truss_reference(
+        h_offsets.data(), h_indices.data(), graph_view.get_number_of_vertices(), k_truss_usecase.k);
+
+      std::vector<std::tuple<vertex_t, vertex_t>> h_cugraph_edges(h_srcs.size());
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        h_cugraph_edges[i] = std::make_tuple(h_srcs[i], h_dsts[i]);
+      }
+      std::sort(h_cugraph_edges.begin(), h_cugraph_edges.end());
+
+      ASSERT_EQ(h_reference_edges.size(), h_cugraph_edges.size())
+        << "the number of K-truss edges does not match with the reference value.";
+      ASSERT_TRUE(
+        std::equal(h_reference_edges.begin(), h_reference_edges.end(), h_cugraph_edges.begin()))
+        << "K-truss edges do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_KTruss_File = Tests_KTruss<cugraph::test::File_Usecase>;
+using Tests_KTruss_Rmat = Tests_KTruss<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_KTruss_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_KTruss_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_KTruss_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_KTruss_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_KTruss_File,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(KTruss_Usecase{2}, KTruss_Usecase{3}, KTruss_Usecase{5}),
+    testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_KTruss_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(KTruss_Usecase{4}, KTruss_Usecase{8}),
+    testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_KTruss_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    testing::Values(KTruss_Usecase{8, false}),
+    testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
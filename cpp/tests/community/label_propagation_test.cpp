@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+// returns the number of vertices whose labels are not stable (a label is stable if no other label
+// has a larger weight among the vertex's neighbors), this code assumes that the graph is symmetric
+template <typename vertex_t, typename edge_t>
+vertex_t count_unstable_labels(edge_t const* offsets,
+                               vertex_t const* indices,
+                               vertex_t const* labels,
+                               vertex_t num_vertices)
+{
+  vertex_t num_unstable{0};
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    std::map<vertex_t, edge_t> label_counts{};
+    for (edge_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+      ++label_counts[labels[indices[i]]];
+    }
+    if (label_counts.empty()) { continue; }
+    auto max_count = std::max_element(label_counts.begin(),
+                                      label_counts.end(),
+                                      [](auto lhs, auto rhs) { return lhs.second < rhs.second; })
+                       ->second;
+    if (label_counts[labels[v]] != max_count) { ++num_unstable; }
+  }
+  return num_unstable;
+}
+
+struct LabelPropagation_Usecase {
+  size_t max_iterations{100};
+  double changed_fraction_threshold{0.0};
+  bool semi_synchronous{true};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_LabelPropagation
+  : public ::testing::TestWithParam<std::tuple<LabelPropagation_Usecase, input_usecase_t>> {
+ public:
+  Tests_LabelPropagation() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(LabelPropagation_Usecase const& label_propagation_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, true, true, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+    auto graph_view = graph.view();
+
+    rmm::device_uvector<vertex_t> d_labels(graph_view.get_number_of_vertices(),
+                                           handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto num_iterations =
+      cugraph::label_propagation(handle,
+                                 graph_view,
+                                 d_labels.data(),
+                                 label_propagation_usecase.max_iterations,
+                                 label_propagation_usecase.changed_fraction_threshold,
+                                 label_propagation_usecase.semi_synchronous);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "LabelPropagation took " << elapsed_time * 1e-6 << " s (" << num_iterations
+                << " iterations).\n";
+    }
+
+    ASSERT_TRUE(num_iterations <= label_propagation_usecase.max_iterations);
+
+    if (label_propagation_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      std::vector<vertex_t> h_labels(graph_view.get_number_of_vertices());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        graph_view.get_number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      raft::update_host(h_labels.data(), d_labels.data(), d_labels.size(), handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      // every label should be a vertex ID, and converged labels should be stable
+      for (vertex_t v = 0; v < graph_view.get_number_of_vertices(); ++v) {
+        ASSERT_TRUE((h_labels[v] >= 0) && (h_labels[v] < graph_view.get_number_of_vertices()))
+          << "vertex " << v << " has an invalid label " << h_labels[v] << ".";
+      }
+
+      if ((label_propagation_usecase.changed_fraction_threshold == 0.0) &&
+          (num_iterations < label_propagation_usecase.max_iterations)) {
+        ASSERT_EQ(count_unstable_labels(h_offsets.data(),
+                                        h_indices.data(),
+                                        h_labels.data(),
+                                        graph_view.get_number_of_vertices()),
+                  vertex_t{0})
+          << "label propagation converged to unstable labels.";
+      }
+    }
+  }
+};
+
+using Tests_LabelPropagation_File = Tests_LabelPropagation<cugraph::test::File_Usecase>;
+using Tests_LabelPropagation_Rmat = Tests_LabelPropagation<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_LabelPropagation_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_LabelPropagation_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_LabelPropagation_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_LabelPropagation_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_LabelPropagation_File,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(LabelPropagation_Usecase{100, 0.0, true},
+                    LabelPropagation_Usecase{100, 0.0, false},
+                    LabelPropagation_Usecase{100, 0.01, true}),
+    testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_LabelPropagation_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(LabelPropagation_Usecase{100, 0.0, true},
+                    LabelPropagation_Usecase{100, 0.0, false}),
+    testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_LabelPropagation_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    testing::Values(LabelPropagation_Usecase{20, 0.001, true, false}),
+    testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
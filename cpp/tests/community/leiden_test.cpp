@@ -10,7 +10,11 @@
  */
 #include <gtest/gtest.h>
 
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
 #include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
 #include <cugraph/legacy/graph.hpp>
 
 #include <thrust/extrema.h>
@@ -85,3 +89,37 @@ TEST(leiden_karate, success)
     ASSERT_GE(modularity, 0.41116042 * 0.99);
   }
 }
+
+TEST(leiden_karate, graph_view)
+{
+  raft::handle_t handle;
+
+  auto [graph, d_renumber_map_labels] =
+    cugraph::test::construct_graph<int32_t, int32_t, float, false, false>(
+      handle, cugraph::test::File_Usecase("test/datasets/karate.mtx"), true, false);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<int32_t> result_v(graph_view.get_number_of_vertices(), handle.get_stream());
+
+  float modularity{0.0};
+  size_t num_level{0};
+
+  if (handle.get_device_properties().major < 7) {
+    EXPECT_THROW(cugraph::leiden(handle, graph_view, result_v.data()), cugraph::logic_error);
+  } else {
+    std::tie(num_level, modularity) = cugraph::leiden(handle, graph_view, result_v.data());
+
+    std::vector<int32_t> cluster_id(result_v.size());
+    raft::update_host(cluster_id.data(), result_v.data(), result_v.size(), handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());
+
+    int32_t min = *min_element(cluster_id.begin(), cluster_id.end());
+    int32_t max = *max_element(cluster_id.begin(), cluster_id.end());
+
+    ASSERT_GE(num_level, size_t{1});
+    ASSERT_GE(min, 0);
+    ASSERT_LT(max, graph_view.get_number_of_vertices());
+    ASSERT_GE(modularity, 0.41116042 * 0.95);
+  }
+}
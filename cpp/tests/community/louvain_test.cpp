@@ -148,6 +148,67 @@ class Tests_Louvain
       ASSERT_FLOAT_EQ(compare_modularity, expected_modularity);
       ASSERT_EQ(level, expected_level);
     }
+
+    // flattening every level at once should match flattening level by level
+
+    auto [dendrogram, dendrogram_modularity] =
+      cugraph::louvain(handle, graph_view, size_t{100}, weight_t{1});
+    auto num_levels = dendrogram->num_levels();
+
+    rmm::device_uvector<vertex_t> last_clustering_v(num_vertices, handle.get_stream());
+    cugraph::flatten_dendrogram(handle, graph_view, *dendrogram, last_clustering_v.data());
+    rmm::device_uvector<vertex_t> level_clusterings_v(num_levels * num_vertices,
+                                                      handle.get_stream());
+    cugraph::flatten_dendrogram_levels(
+      handle, graph_view, *dendrogram, level_clusterings_v.data());
+
+    auto h_last_clustering =
+      cugraph::test::to_host(handle, last_clustering_v.data(), last_clustering_v.size());
+    auto h_level_clusterings =
+      cugraph::test::to_host(handle, level_clusterings_v.data(), level_clusterings_v.size());
+
+    auto h_dendrogram_levels = dendrogram->to_host(handle.get_stream_view());
+    auto const& level_offsets = dendrogram->get_level_offsets();
+    ASSERT_EQ(level_offsets.size(), num_levels + 1);
+    ASSERT_EQ(h_dendrogram_levels.size(), level_offsets.back());
+
+    for (size_t l = 0; l < num_levels; ++l) {
+      auto h_level_map = cugraph::test::to_host(handle,
+                                                dendrogram->get_level_ptr_nocheck(l),
+                                                dendrogram->get_level_size_nocheck(l));
+      ASSERT_TRUE(std::equal(h_level_map.begin(),
+                             h_level_map.end(),
+                             h_dendrogram_levels.begin() + level_offsets[l]))
+        << "Dendrogram level " << l << " does not match the single transfer copy.";
+      for (vertex_t i = 0; i < num_vertices; ++i) {
+        auto prev = l == 0 ? i : h_level_clusterings[(l - 1) * num_vertices + i];
+        ASSERT_EQ(h_level_clusterings[l * num_vertices + i],
+                  h_level_map[prev - dendrogram->get_level_first_index_nocheck(l)])
+          << "Flattened clustering at level " << l << " does not match the dendrogram.";
+      }
+    }
+    if (num_levels > 0) {
+      ASSERT_TRUE(std::equal(h_last_clustering.begin(),
+                             h_last_clustering.end(),
+                             h_level_clusterings.begin() + (num_levels - 1) * num_vertices))
+        << "Flattened clustering at the last level does not match flatten_dendrogram.";
+    }
+
+    // a resolution sweep should match running louvain for each resolution
+
+    std::vector<weight_t> resolutions{weight_t{0.5}, weight_t{1}, weight_t{2}};
+    auto sweep_results =
+      cugraph::louvain_multi_resolution(handle, graph_view, resolutions, size_t{100});
+    ASSERT_EQ(sweep_results.size(), resolutions.size());
+    for (size_t i = 0; i < resolutions.size(); ++i) {
+      auto [resolution_dendrogram, resolution_modularity] =
+        cugraph::louvain(handle, graph_view, size_t{100}, resolutions[i]);
+      ASSERT_NEAR(static_cast<float>(sweep_results[i].second),
+                  static_cast<float>(resolution_modularity),
+                  1e-3)
+        << "Resolution sweep modularity does not match for resolution " << resolutions[i] << ".";
+      ASSERT_GT(sweep_results[i].first->num_levels(), size_t{0});
+    }
   }
 };
 
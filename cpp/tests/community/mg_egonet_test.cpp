@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+struct MGEgonet_Usecase {
+  size_t n_sources_per_gpu{1};
+  int32_t radius{1};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGEgonet
+  : public ::testing::TestWithParam<std::tuple<MGEgonet_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGEgonet() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of the MG egonet extraction against the SG extraction from the same sources
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MGEgonet_Usecase const& egonet_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, egonet_usecase.test_weighted, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. generate the local sources (the sources need not be local)
+
+    auto n_sources = egonet_usecase.n_sources_per_gpu;
+    std::vector<vertex_t> h_sources(n_sources);
+    std::default_random_engine generator{static_cast<unsigned>(comm_rank)};
+    std::uniform_int_distribution<vertex_t> distribution{
+      0, mg_graph_view.get_number_of_vertices() - 1};
+    std::generate(h_sources.begin(), h_sources.end(), [&distribution, &generator]() {
+      return distribution(generator);
+    });
+
+    rmm::device_uvector<vertex_t> d_sources(h_sources.size(), handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+
+    // 4. run MG egonet extraction
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [d_mg_ego_edgelist_src,
+          d_mg_ego_edgelist_dst,
+          d_mg_ego_edgelist_weights,
+          d_mg_ego_offsets] =
+      cugraph::extract_ego(handle,
+                           mg_graph_view,
+                           d_sources.data(),
+                           static_cast<vertex_t>(n_sources),
+                           static_cast<vertex_t>(egonet_usecase.radius));
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG extract_ego took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    ASSERT_EQ(d_mg_ego_offsets.size(), n_sources + 1);
+    ASSERT_EQ(d_mg_ego_edgelist_weights.has_value(), egonet_usecase.test_weighted);
+
+    // 5. compare with SG
+
+    if (egonet_usecase.check_correctness) {
+      // 5-1. aggregate MG results
+
+      auto to_host = [&handle](auto const& v) {
+        return cugraph::test::to_host(handle, v.data(), v.size());
+      };
+
+      auto h_mg_ego_offsets = to_host(d_mg_ego_offsets);
+      std::vector<size_t> h_mg_ego_edge_counts(n_sources);
+      for (size_t i = 0; i < n_sources; ++i) {
+        h_mg_ego_edge_counts[i] = h_mg_ego_offsets[i + 1] - h_mg_ego_offsets[i];
+      }
+      rmm::device_uvector<size_t> d_mg_ego_edge_counts(n_sources, handle.get_stream());
+      raft::update_device(
+        d_mg_ego_edge_counts.data(), h_mg_ego_edge_counts.data(), n_sources, handle.get_stream());
+
+      auto d_mg_aggregate_renumber_map_labels = cugraph::test::device_gatherv(
+        handle, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+      auto d_aggregate_sources =
+        cugraph::test::device_gatherv(handle, d_sources.data(), d_sources.size());
+      auto d_mg_aggregate_ego_edge_counts = cugraph::test::device_gatherv(
+        handle, d_mg_ego_edge_counts.data(), d_mg_ego_edge_counts.size());
+      auto d_mg_aggregate_ego_edgelist_src = cugraph::test::device_gatherv(
+        handle, d_mg_ego_edgelist_src.data(), d_mg_ego_edgelist_src.size());
+      auto d_mg_aggregate_ego_edgelist_dst = cugraph::test::device_gatherv(
+        handle, d_mg_ego_edgelist_dst.data(), d_mg_ego_edgelist_dst.size());
+      auto d_mg_aggregate_ego_edgelist_weights =
+        d_mg_ego_edgelist_weights
+          ? std::make_optional<rmm::device_uvector<weight_t>>(
+              cugraph::test::device_gatherv(handle,
+                                            (*d_mg_ego_edgelist_weights).data(),
+                                            (*d_mg_ego_edgelist_weights).size()))
+          : std::nullopt;
+
+      if (comm_rank == int{0}) {
+        // 5-2. unrenumber the sources and the MG results
+
+        auto num_vertices = mg_graph_view.get_number_of_vertices();
+        for (auto* vertices : {&d_aggregate_sources,
+                               &d_mg_aggregate_ego_edgelist_src,
+                               &d_mg_aggregate_ego_edgelist_dst}) {
+          cugraph::unrenumber_int_vertices<vertex_t, false>(
+            handle,
+            (*vertices).data(),
+            (*vertices).size(),
+            d_mg_aggregate_renumber_map_labels.data(),
+            std::vector<vertex_t>{num_vertices});
+        }
+
+        auto h_mg_aggregate_ego_edge_counts  = to_host(d_mg_aggregate_ego_edge_counts);
+        auto h_mg_aggregate_ego_edgelist_src = to_host(d_mg_aggregate_ego_edgelist_src);
+        auto h_mg_aggregate_ego_edgelist_dst = to_host(d_mg_aggregate_ego_edgelist_dst);
+        auto h_mg_aggregate_ego_edgelist_weights =
+          d_mg_aggregate_ego_edgelist_weights
+            ? std::make_optional<std::vector<weight_t>>(
+                to_host(*d_mg_aggregate_ego_edgelist_weights))
+            : std::nullopt;
+
+        auto num_aggregate_sources = d_aggregate_sources.size();
+        std::vector<size_t> h_mg_aggregate_ego_offsets(num_aggregate_sources + 1, 0);
+        std::partial_sum(h_mg_aggregate_ego_edge_counts.begin(),
+                         h_mg_aggregate_ego_edge_counts.end(),
+                         h_mg_aggregate_ego_offsets.begin() + 1);
+
+        // 5-3. create SG graph and run SG egonet extraction (one worker stream per source)
+
+        raft::handle_t sg_handle(static_cast<int>(num_aggregate_sources));
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(sg_handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            sg_handle, input_usecase, egonet_usecase.test_weighted, false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        auto [d_sg_ego_edgelist_src,
+              d_sg_ego_edgelist_dst,
+              d_sg_ego_edgelist_weights,
+              d_sg_ego_offsets] =
+          cugraph::extract_ego(sg_handle,
+                               sg_graph_view,
+                               d_aggregate_sources.data(),
+                               static_cast<vertex_t>(num_aggregate_sources),
+                               static_cast<vertex_t>(egonet_usecase.radius));
+
+        auto sg_to_host = [&sg_handle](auto const& v) {
+          return cugraph::test::to_host(sg_handle, v.data(), v.size());
+        };
+
+        auto h_sg_ego_edgelist_src = sg_to_host(d_sg_ego_edgelist_src);
+        auto h_sg_ego_edgelist_dst = sg_to_host(d_sg_ego_edgelist_dst);
+        auto h_sg_ego_edgelist_weights =
+          d_sg_ego_edgelist_weights
+            ? std::make_optional<std::vector<weight_t>>(sg_to_host(*d_sg_ego_edgelist_weights))
+            : std::nullopt;
+        auto h_sg_ego_offsets = sg_to_host(d_sg_ego_offsets);
+
+        // 5-4. compare (the edges of each ego network, as sets)
+
+        ASSERT_TRUE(std::equal(
+          h_sg_ego_offsets.begin(), h_sg_ego_offsets.end(), h_mg_aggregate_ego_offsets.begin()))
+          << "MG egonet edge counts do not match with the SG values.";
+
+        for (size_t i = 0; i < num_aggregate_sources; ++i) {
+          auto start = h_sg_ego_offsets[i];
+          auto last  = h_sg_ego_offsets[i + 1];
+          std::vector<std::tuple<vertex_t, vertex_t, weight_t>> sg_tuples(last - start);
+          std::vector<std::tuple<vertex_t, vertex_t, weight_t>> mg_tuples(last - start);
+          for (auto j = start; j < last; ++j) {
+            sg_tuples[j - start] = std::make_tuple(
+              h_sg_ego_edgelist_src[j],
+              h_sg_ego_edgelist_dst[j],
+              h_sg_ego_edgelist_weights ? (*h_sg_ego_edgelist_weights)[j] : weight_t{1.0});
+            mg_tuples[j - start] =
+              std::make_tuple(h_mg_aggregate_ego_edgelist_src[j],
+                              h_mg_aggregate_ego_edgelist_dst[j],
+                              h_mg_aggregate_ego_edgelist_weights
+                                ? (*h_mg_aggregate_ego_edgelist_weights)[j]
+                                : weight_t{1.0});
+          }
+          std::sort(sg_tuples.begin(), sg_tuples.end());
+          std::sort(mg_tuples.begin(), mg_tuples.end());
+          ASSERT_TRUE(std::equal(sg_tuples.begin(), sg_tuples.end(), mg_tuples.begin()))
+            << "MG egonet edges do not match with the SG egonet edges.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_MGEgonet_File = Tests_MGEgonet<cugraph::test::File_Usecase>;
+using Tests_MGEgonet_Rmat = Tests_MGEgonet<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGEgonet_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGEgonet_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGEgonet_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGEgonet_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MGEgonet_Usecase{1, 1, false},
+                      MGEgonet_Usecase{1, 2, true},
+                      MGEgonet_Usecase{3, 2, false},
+                      MGEgonet_Usecase{3, 3, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGEgonet_Rmat,
+  ::testing::Combine(
+    // enable correctness checks (more than 64 sources in aggregate to cover multiple BFS batches)
+    ::testing::Values(MGEgonet_Usecase{10, 1, false}, MGEgonet_Usecase{40, 2, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGEgonet_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MGEgonet_Usecase{10000, 2, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+struct MGInducedSubgraph_Usecase {
+  std::vector<size_t> subgraph_sizes{};  // per GPU
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGInducedSubgraph
+  : public ::testing::TestWithParam<std::tuple<MGInducedSubgraph_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGInducedSubgraph() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of the MG extraction against the SG extraction of the same subgraphs
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(MGInducedSubgraph_Usecase const& induced_subgraph_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, true>(
+        handle, input_usecase, induced_subgraph_usecase.test_weighted, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. generate the local subgraphs (the subgraph vertices need not be local)
+
+    auto num_subgraphs = induced_subgraph_usecase.subgraph_sizes.size();
+    std::vector<size_t> h_subgraph_offsets(num_subgraphs + 1, 0);
+    std::partial_sum(induced_subgraph_usecase.subgraph_sizes.begin(),
+                     induced_subgraph_usecase.subgraph_sizes.end(),
+                     h_subgraph_offsets.begin() + 1);
+    std::vector<vertex_t> h_subgraph_vertices(h_subgraph_offsets.back());
+    std::default_random_engine generator{static_cast<unsigned>(comm_rank)};
+    for (size_t i = 0; i < num_subgraphs; ++i) {
+      auto start = h_subgraph_offsets[i];
+      auto last  = h_subgraph_offsets[i + 1];
+      ASSERT_TRUE(last - start <= static_cast<size_t>(mg_graph_view.get_number_of_vertices()))
+        << "Invalid subgraph size.";
+      std::vector<vertex_t> vertices(mg_graph_view.get_number_of_vertices());
+      std::iota(vertices.begin(), vertices.end(), vertex_t{0});
+      std::shuffle(vertices.begin(), vertices.end(), generator);
+      std::copy(
+        vertices.begin(), vertices.begin() + (last - start), h_subgraph_vertices.begin() + start);
+      std::sort(h_subgraph_vertices.begin() + start, h_subgraph_vertices.begin() + last);
+    }
+
+    rmm::device_uvector<size_t> d_subgraph_offsets(h_subgraph_offsets.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_subgraph_vertices(h_subgraph_vertices.size(),
+                                                      handle.get_stream());
+    raft::update_device(d_subgraph_offsets.data(),
+                        h_subgraph_offsets.data(),
+                        h_subgraph_offsets.size(),
+                        handle.get_stream());
+    raft::update_device(d_subgraph_vertices.data(),
+                        h_subgraph_vertices.data(),
+                        h_subgraph_vertices.size(),
+                        handle.get_stream());
+
+    // 4. run MG induced subgraph extraction
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [d_mg_subgraph_edgelist_majors,
+          d_mg_subgraph_edgelist_minors,
+          d_mg_subgraph_edgelist_weights,
+          d_mg_subgraph_edge_offsets] =
+      cugraph::extract_induced_subgraphs(handle,
+                                         mg_graph_view,
+                                         d_subgraph_offsets.data(),
+                                         d_subgraph_vertices.data(),
+                                         num_subgraphs,
+                                         !cugraph::test::g_perf);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG extract_induced_subgraphs took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    ASSERT_EQ(d_mg_subgraph_edge_offsets.size(), num_subgraphs + 1);
+    ASSERT_EQ(d_mg_subgraph_edgelist_weights.has_value(), induced_subgraph_usecase.test_weighted);
+
+    // 5. compare with SG
+
+    if (induced_subgraph_usecase.check_correctness) {
+      // 5-1. aggregate MG results
+
+      std::vector<size_t> h_mg_subgraph_edge_offsets(d_mg_subgraph_edge_offsets.size());
+      raft::update_host(h_mg_subgraph_edge_offsets.data(),
+                        d_mg_subgraph_edge_offsets.data(),
+                        d_mg_subgraph_edge_offsets.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+      std::vector<size_t> h_mg_subgraph_edge_counts(num_subgraphs);
+      std::vector<size_t> h_subgraph_sizes(induced_subgraph_usecase.subgraph_sizes);
+      for (size_t i = 0; i < num_subgraphs; ++i) {
+        h_mg_subgraph_edge_counts[i] =
+          h_mg_subgraph_edge_offsets[i + 1] - h_mg_subgraph_edge_offsets[i];
+      }
+      rmm::device_uvector<size_t> d_mg_subgraph_edge_counts(num_subgraphs, handle.get_stream());
+      rmm::device_uvector<size_t> d_subgraph_sizes(num_subgraphs, handle.get_stream());
+      raft::update_device(d_mg_subgraph_edge_counts.data(),
+                          h_mg_subgraph_edge_counts.data(),
+                          num_subgraphs,
+                          handle.get_stream());
+      raft::update_device(
+        d_subgraph_sizes.data(), h_subgraph_sizes.data(), num_subgraphs, handle.get_stream());
+
+      auto d_mg_aggregate_renumber_map_labels = cugraph::test::device_gatherv(
+        handle, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+      auto d_aggregate_subgraph_sizes =
+        cugraph::test::device_gatherv(handle, d_subgraph_sizes.data(), d_subgraph_sizes.size());
+      auto d_aggregate_subgraph_vertices = cugraph::test::device_gatherv(
+        handle, d_subgraph_vertices.data(), d_subgraph_vertices.size());
+      auto d_mg_aggregate_subgraph_edge_counts = cugraph::test::device_gatherv(
+        handle, d_mg_subgraph_edge_counts.data(), d_mg_subgraph_edge_counts.size());
+      auto d_mg_aggregate_subgraph_edgelist_majors = cugraph::test::device_gatherv(
+        handle, d_mg_subgraph_edgelist_majors.data(), d_mg_subgraph_edgelist_majors.size());
+      auto d_mg_aggregate_subgraph_edgelist_minors = cugraph::test::device_gatherv(
+        handle, d_mg_subgraph_edgelist_minors.data(), d_mg_subgraph_edgelist_minors.size());
+      auto d_mg_aggregate_subgraph_edgelist_weights =
+        d_mg_subgraph_edgelist_weights
+          ? std::make_optional<rmm::device_uvector<weight_t>>(
+              cugraph::test::device_gatherv(handle,
+                                            (*d_mg_subgraph_edgelist_weights).data(),
+                                            (*d_mg_subgraph_edgelist_weights).size()))
+          : std::nullopt;
+
+      if (comm_rank == int{0}) {
+        // 5-2. unrenumber the subgraph vertices and the MG results
+
+        auto num_vertices = mg_graph_view.get_number_of_vertices();
+        for (auto* vertices : {&d_aggregate_subgraph_vertices,
+                               &d_mg_aggregate_subgraph_edgelist_majors,
+                               &d_mg_aggregate_subgraph_edgelist_minors}) {
+          cugraph::unrenumber_int_vertices<vertex_t, false>(
+            handle,
+            (*vertices).data(),
+            (*vertices).size(),
+            d_mg_aggregate_renumber_map_labels.data(),
+            std::vector<vertex_t>{num_vertices});
+        }
+
+        auto to_host = [&handle](auto const& v) {
+          return cugraph::test::to_host(handle, v.data(), v.size());
+        };
+
+        auto h_aggregate_subgraph_sizes          = to_host(d_aggregate_subgraph_sizes);
+        auto h_aggregate_subgraph_vertices       = to_host(d_aggregate_subgraph_vertices);
+        auto h_mg_aggregate_subgraph_edge_counts = to_host(d_mg_aggregate_subgraph_edge_counts);
+        auto h_mg_aggregate_subgraph_edgelist_majors =
+          to_host(d_mg_aggregate_subgraph_edgelist_majors);
+        auto h_mg_aggregate_subgraph_edgelist_minors =
+          to_host(d_mg_aggregate_subgraph_edgelist_minors);
+        auto h_mg_aggregate_subgraph_edgelist_weights =
+          d_mg_aggregate_subgraph_edgelist_weights
+            ? std::make_optional<std::vector<weight_t>>(
+                to_host(*d_mg_aggregate_subgraph_edgelist_weights))
+            : std::nullopt;
+
+        auto num_aggregate_subgraphs = h_aggregate_subgraph_sizes.size();
+        std::vector<size_t> h_aggregate_subgraph_offsets(num_aggregate_subgraphs + 1, 0);
+        std::partial_sum(h_aggregate_subgraph_sizes.begin(),
+                         h_aggregate_subgraph_sizes.end(),
+                         h_aggregate_subgraph_offsets.begin() + 1);
+        std::vector<size_t> h_mg_aggregate_subgraph_edge_offsets(num_aggregate_subgraphs + 1, 0);
+        std::partial_sum(h_mg_aggregate_subgraph_edge_counts.begin(),
+                         h_mg_aggregate_subgraph_edge_counts.end(),
+                         h_mg_aggregate_subgraph_edge_offsets.begin() + 1);
+        for (size_t i = 0; i < num_aggregate_subgraphs; ++i) {
+          std::sort(h_aggregate_subgraph_vertices.begin() + h_aggregate_subgraph_offsets[i],
+                    h_aggregate_subgraph_vertices.begin() + h_aggregate_subgraph_offsets[i + 1]);
+        }
+
+        // 5-3. create SG graph and run SG induced subgraph extraction
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> sg_graph(handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+            handle, input_usecase, induced_subgraph_usecase.test_weighted, false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        rmm::device_uvector<size_t> d_aggregate_subgraph_offsets(
+          h_aggregate_subgraph_offsets.size(), handle.get_stream());
+        raft::update_device(d_aggregate_subgraph_offsets.data(),
+                            h_aggregate_subgraph_offsets.data(),
+                            h_aggregate_subgraph_offsets.size(),
+                            handle.get_stream());
+        raft::update_device(d_aggregate_subgraph_vertices.data(),
+                            h_aggregate_subgraph_vertices.data(),
+                            h_aggregate_subgraph_vertices.size(),
+                            handle.get_stream());
+
+        auto [d_sg_subgraph_edgelist_majors,
+              d_sg_subgraph_edgelist_minors,
+              d_sg_subgraph_edgelist_weights,
+              d_sg_subgraph_edge_offsets] =
+          cugraph::extract_induced_subgraphs(handle,
+                                             sg_graph_view,
+                                             d_aggregate_subgraph_offsets.data(),
+                                             d_aggregate_subgraph_vertices.data(),
+                                             num_aggregate_subgraphs,
+                                             true);
+
+        auto h_sg_subgraph_edgelist_majors = to_host(d_sg_subgraph_edgelist_majors);
+        auto h_sg_subgraph_edgelist_minors = to_host(d_sg_subgraph_edgelist_minors);
+        auto h_sg_subgraph_edgelist_weights =
+          d_sg_subgraph_edgelist_weights
+            ? std::make_optional<std::vector<weight_t>>(to_host(*d_sg_subgraph_edgelist_weights))
+            : std::nullopt;
+        auto h_sg_subgraph_edge_offsets = to_host(d_sg_subgraph_edge_offsets);
+
+        // 5-4. compare (the edges of each subgraph, as sets)
+
+        ASSERT_TRUE(std::equal(h_sg_subgraph_edge_offsets.begin(),
+                               h_sg_subgraph_edge_offsets.end(),
+                               h_mg_aggregate_subgraph_edge_offsets.begin()))
+          << "MG subgraph edge counts do not match with the SG values.";
+
+        for (size_t i = 0; i < num_aggregate_subgraphs; ++i) {
+          auto start = h_sg_subgraph_edge_offsets[i];
+          auto last  = h_sg_subgraph_edge_offsets[i + 1];
+          std::vector<std::tuple<vertex_t, vertex_t, weight_t>> sg_tuples(last - start);
+          std::vector<std::tuple<vertex_t, vertex_t, weight_t>> mg_tuples(last - start);
+          for (auto j = start; j < last; ++j) {
+            sg_tuples[j - start] =
+              std::make_tuple(h_sg_subgraph_edgelist_majors[j],
+                              h_sg_subgraph_edgelist_minors[j],
+                              h_sg_subgraph_edgelist_weights ? (*h_sg_subgraph_edgelist_weights)[j]
+                                                             : weight_t{1.0});
+            mg_tuples[j - start] =
+              std::make_tuple(h_mg_aggregate_subgraph_edgelist_majors[j],
+                              h_mg_aggregate_subgraph_edgelist_minors[j],
+                              h_mg_aggregate_subgraph_edgelist_weights
+                                ? (*h_mg_aggregate_subgraph_edgelist_weights)[j]
+                                : weight_t{1.0});
+          }
+          std::sort(sg_tuples.begin(), sg_tuples.end());
+          std::sort(mg_tuples.begin(), mg_tuples.end());
+          ASSERT_TRUE(std::equal(sg_tuples.begin(), sg_tuples.end(), mg_tuples.begin()))
+            << "MG extracted subgraph edges do not match with the SG extracted edges.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_MGInducedSubgraph_File = Tests_MGInducedSubgraph<cugraph::test::File_Usecase>;
+using Tests_MGInducedSubgraph_Rmat = Tests_MGInducedSubgraph<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGInducedSubgraph_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGInducedSubgraph_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGInducedSubgraph_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGInducedSubgraph_Rmat, CheckInt64Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGInducedSubgraph_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MGInducedSubgraph_Usecase{std::vector<size_t>{0}, false},
+                      MGInducedSubgraph_Usecase{std::vector<size_t>{1}, false},
+                      MGInducedSubgraph_Usecase{std::vector<size_t>{10}, false},
+                      MGInducedSubgraph_Usecase{std::vector<size_t>{34}, false},
+                      MGInducedSubgraph_Usecase{std::vector<size_t>{10, 0, 5}, false},
+                      MGInducedSubgraph_Usecase{std::vector<size_t>{9, 3, 10}, true},
+                      MGInducedSubgraph_Usecase{std::vector<size_t>{5, 12, 13}, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGInducedSubgraph_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MGInducedSubgraph_Usecase{std::vector<size_t>{250, 130, 15}, false},
+                      MGInducedSubgraph_Usecase{std::vector<size_t>(100, 8), true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGInducedSubgraph_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MGInducedSubgraph_Usecase{std::vector<size_t>(10000, 16), false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
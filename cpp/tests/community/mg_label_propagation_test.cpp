@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+// returns the number of vertices whose labels are not stable (a label is stable if no other label
+// has a larger weight among the vertex's neighbors), this code assumes that the graph is symmetric
+template <typename vertex_t, typename edge_t>
+vertex_t count_unstable_labels(edge_t const* offsets,
+                               vertex_t const* indices,
+                               vertex_t const* labels,
+                               vertex_t num_vertices)
+{
+  vertex_t num_unstable{0};
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    std::map<vertex_t, edge_t> label_counts{};
+    for (edge_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+      ++label_counts[labels[indices[i]]];
+    }
+    if (label_counts.empty()) { continue; }
+    auto max_count = std::max_element(label_counts.begin(),
+                                      label_counts.end(),
+                                      [](auto lhs, auto rhs) { return lhs.second < rhs.second; })
+                       ->second;
+    if (label_counts[labels[v]] != max_count) { ++num_unstable; }
+  }
+  return num_unstable;
+}
+
+struct LabelPropagation_Usecase {
+  size_t max_iterations{100};
+  double changed_fraction_threshold{0.0};
+  bool semi_synchronous{true};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGLabelPropagation
+  : public ::testing::TestWithParam<std::tuple<LabelPropagation_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGLabelPropagation() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Check the stability of the labels found on multiple GPUs (label IDs depend on the
+  // renumbering, so the results are not compared with a single-GPU run)
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(LabelPropagation_Usecase const& label_propagation_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, false, true, true, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run MG LabelPropagation
+
+    rmm::device_uvector<vertex_t> d_mg_labels(mg_graph_view.get_number_of_local_vertices(),
+                                              handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto num_iterations =
+      cugraph::label_propagation(handle,
+                                 mg_graph_view,
+                                 d_mg_labels.data(),
+                                 label_propagation_usecase.max_iterations,
+                                 label_propagation_usecase.changed_fraction_threshold,
+                                 label_propagation_usecase.semi_synchronous);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG LabelPropagation took " << elapsed_time * 1e-6 << " s (" << num_iterations
+                << " iterations).\n";
+    }
+
+    ASSERT_TRUE(num_iterations <= label_propagation_usecase.max_iterations);
+
+    // 4. check the MG results
+
+    if (label_propagation_usecase.check_correctness) {
+      // 4-1. aggregate MG results
+
+      auto d_mg_aggregate_renumber_map_labels = cugraph::test::device_gatherv(
+        handle, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+      auto d_mg_aggregate_labels =
+        cugraph::test::device_gatherv(handle, d_mg_labels.data(), d_mg_labels.size());
+
+      if (handle.get_comms().get_rank() == int{0}) {
+        // 4-2. unrenumber MG results (the labels stay renumbered vertex IDs, which is fine as
+        // only the partition matters)
+
+        std::tie(std::ignore, d_mg_aggregate_labels) = cugraph::test::sort_by_key(
+          handle, d_mg_aggregate_renumber_map_labels, d_mg_aggregate_labels);
+
+        // 4-3. create SG graph
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, false, false, true, true);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_EQ(mg_graph_view.get_number_of_vertices(), sg_graph_view.get_number_of_vertices());
+
+        // 4-4. check
+
+        std::vector<edge_t> h_offsets(sg_graph_view.get_number_of_vertices() + 1);
+        std::vector<vertex_t> h_indices(sg_graph_view.get_number_of_edges());
+        std::vector<vertex_t> h_mg_aggregate_labels(sg_graph_view.get_number_of_vertices());
+        raft::update_host(h_offsets.data(),
+                          sg_graph_view.get_matrix_partition_view().get_offsets(),
+                          sg_graph_view.get_number_of_vertices() + 1,
+                          handle.get_stream());
+        raft::update_host(h_indices.data(),
+                          sg_graph_view.get_matrix_partition_view().get_indices(),
+                          sg_graph_view.get_number_of_edges(),
+                          handle.get_stream());
+        raft::update_host(h_mg_aggregate_labels.data(),
+                          d_mg_aggregate_labels.data(),
+                          d_mg_aggregate_labels.size(),
+                          handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        for (vertex_t v = 0; v < sg_graph_view.get_number_of_vertices(); ++v) {
+          ASSERT_TRUE((h_mg_aggregate_labels[v] >= 0) &&
+                      (h_mg_aggregate_labels[v] < sg_graph_view.get_number_of_vertices()))
+            << "vertex " << v << " has an invalid label " << h_mg_aggregate_labels[v] << ".";
+        }
+
+        if ((label_propagation_usecase.changed_fraction_threshold == 0.0) &&
+            (num_iterations < label_propagation_usecase.max_iterations)) {
+          ASSERT_EQ(count_unstable_labels(h_offsets.data(),
+                                          h_indices.data(),
+                                          h_mg_aggregate_labels.data(),
+                                          sg_graph_view.get_number_of_vertices()),
+                    vertex_t{0})
+            << "label propagation converged to unstable labels.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_MGLabelPropagation_File = Tests_MGLabelPropagation<cugraph::test::File_Usecase>;
+using Tests_MGLabelPropagation_Rmat = Tests_MGLabelPropagation<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGLabelPropagation_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGLabelPropagation_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGLabelPropagation_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGLabelPropagation_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGLabelPropagation_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(LabelPropagation_Usecase{100, 0.0, true},
+                      LabelPropagation_Usecase{100, 0.0, false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGLabelPropagation_Rmat,
+  ::testing::Combine(::testing::Values(LabelPropagation_Usecase{100, 0.0, true},
+                                       LabelPropagation_Usecase{100, 0.01, true}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGLabelPropagation_Rmat,
+  ::testing::Combine(
+    ::testing::Values(LabelPropagation_Usecase{20, 0.001, true, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
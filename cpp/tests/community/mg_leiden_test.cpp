@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mg_louvain_helper.hpp"
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+
+#include <gtest/gtest.h>
+
+struct Leiden_Usecase {
+  std::string graph_file_full_path{};
+  double resolution{1.0};
+
+  Leiden_Usecase(std::string const& graph_file_path, double resolution) : resolution(resolution)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+};
+
+class Leiden_MG_Testfixture : public ::testing::TestWithParam<Leiden_Usecase> {
+ public:
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the first level of MNMG Leiden with SG Leiden (run for a single level) on the SG graph
+  // renumbered based on the MNMG renumbering. As with Louvain, MNMG Leiden and SG Leiden are
+  // deterministic only through a single iteration of the outer loop.
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_test(const Leiden_Usecase& param)
+  {
+    raft::handle_t handle;
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    const auto& comm = handle.get_comms();
+
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    auto [mg_graph, d_renumber_map_labels] =
+      cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, true>(
+        handle, param.graph_file_full_path, true, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    auto [dendrogram, mg_modularity] = cugraph::leiden(
+      handle, mg_graph_view, size_t{1}, static_cast<weight_t>(param.resolution));
+
+    ASSERT_EQ(dendrogram->num_levels(), size_t{1});
+
+    auto d_renumber_map_gathered_v = cugraph::test::device_gatherv(
+      handle, (*d_renumber_map_labels).data(), (*d_renumber_map_labels).size());
+    auto d_dendrogram_gathered_v = cugraph::test::device_gatherv(
+      handle, dendrogram->get_level_ptr_nocheck(0), dendrogram->get_level_size_nocheck(0));
+
+    if (comm_rank == 0) {
+      auto [d_edgelist_rows,
+            d_edgelist_cols,
+            d_edgelist_weights,
+            d_vertices,
+            number_of_vertices,
+            is_symmetric] =
+        cugraph::test::read_edgelist_from_matrix_market_file<vertex_t, weight_t, false, false>(
+          handle, param.graph_file_full_path, true);
+
+      cugraph::test::single_gpu_renumber_edgelist_given_number_map(
+        handle, d_edgelist_rows, d_edgelist_cols, d_renumber_map_gathered_v);
+
+      cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+      std::tie(sg_graph, std::ignore) =
+        cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+          handle,
+          std::move(d_vertices),
+          std::move(d_edgelist_rows),
+          std::move(d_edgelist_cols),
+          std::move(d_edgelist_weights),
+          cugraph::graph_properties_t{is_symmetric, false},
+          false);
+      auto sg_graph_view = sg_graph.view();
+
+      rmm::device_uvector<vertex_t> d_clustering_v(sg_graph_view.get_number_of_vertices(),
+                                                   handle.get_stream());
+      weight_t sg_modularity{};
+      std::tie(std::ignore, sg_modularity) =
+        cugraph::leiden(handle,
+                        sg_graph_view,
+                        d_clustering_v.data(),
+                        size_t{1},
+                        static_cast<weight_t>(param.resolution));
+
+      EXPECT_TRUE(
+        cugraph::test::renumbered_vectors_same(handle, d_clustering_v, d_dendrogram_gathered_v));
+      EXPECT_NEAR(mg_modularity, sg_modularity, std::abs(sg_modularity) * 1e-5);
+    }
+  }
+};
+
+TEST_P(Leiden_MG_Testfixture, CheckInt32Int32Float)
+{
+  run_test<int32_t, int32_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(simple_test,
+                         Leiden_MG_Testfixture,
+                         ::testing::Values(Leiden_Usecase("test/datasets/karate.mtx", 1),
+                                           Leiden_Usecase("test/datasets/dolphins.mtx", 1)));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
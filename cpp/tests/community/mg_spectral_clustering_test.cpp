@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+struct SpectralClustering_Usecase {
+  bool balanced_cut{true};
+  size_t num_clusters{4};
+  size_t num_eigenvectors{4};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGSpectralClustering
+  : public ::testing::TestWithParam<std::tuple<SpectralClustering_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGSpectralClustering() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  static void run_spectral_clustering(
+    raft::handle_t const& handle,
+    cugraph::graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+    SpectralClustering_Usecase const& spectral_usecase,
+    vertex_t* clustering,
+    weight_t* eigenvalues)
+  {
+    if (spectral_usecase.balanced_cut) {
+      cugraph::spectral_balanced_cut_clustering(handle,
+                                                graph_view,
+                                                spectral_usecase.num_clusters,
+                                                spectral_usecase.num_eigenvectors,
+                                                weight_t{1e-5},
+                                                size_t{1000},
+                                                weight_t{1e-4},
+                                                size_t{100},
+                                                clustering,
+                                                eigenvalues);
+    } else {
+      cugraph::spectral_modularity_maximization(handle,
+                                                graph_view,
+                                                spectral_usecase.num_clusters,
+                                                spectral_usecase.num_eigenvectors,
+                                                weight_t{1e-5},
+                                                size_t{1000},
+                                                weight_t{1e-4},
+                                                size_t{100},
+                                                clustering,
+                                                eigenvalues);
+    }
+  }
+
+  // Compare the eigenvalues computed on multiple GPUs to those of a single-GPU run (the clusterings
+  // can differ as the k-means initialization depends on the (renumbered) vertex IDs)
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(SpectralClustering_Usecase const& spectral_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, true, true, true, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run MG spectral clustering
+
+    rmm::device_uvector<vertex_t> d_mg_clustering(mg_graph_view.get_number_of_local_vertices(),
+                                                  handle.get_stream());
+    rmm::device_uvector<weight_t> d_mg_eigenvalues(spectral_usecase.num_eigenvectors,
+                                                   handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    run_spectral_clustering(handle,
+                            mg_graph_view,
+                            spectral_usecase,
+                            d_mg_clustering.data(),
+                            d_mg_eigenvalues.data());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG spectral clustering took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. compare SG & MG results
+
+    if (spectral_usecase.check_correctness) {
+      // 4-1. aggregate MG results
+
+      auto d_mg_aggregate_clustering =
+        cugraph::test::device_gatherv(handle, d_mg_clustering.data(), d_mg_clustering.size());
+
+      if (handle.get_comms().get_rank() == int{0}) {
+        // 4-2. create SG graph
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, true, false, true, true);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_EQ(mg_graph_view.get_number_of_vertices(), sg_graph_view.get_number_of_vertices());
+
+        // 4-3. run SG spectral clustering
+
+        rmm::device_uvector<vertex_t> d_sg_clustering(sg_graph_view.get_number_of_vertices(),
+                                                      handle.get_stream());
+        rmm::device_uvector<weight_t> d_sg_eigenvalues(spectral_usecase.num_eigenvectors,
+                                                       handle.get_stream());
+
+        run_spectral_clustering(handle,
+                                sg_graph_view,
+                                spectral_usecase,
+                                d_sg_clustering.data(),
+                                d_sg_eigenvalues.data());
+
+        // 4-4. compare
+
+        std::vector<vertex_t> h_mg_aggregate_clustering(d_mg_aggregate_clustering.size());
+        std::vector<weight_t> h_mg_eigenvalues(d_mg_eigenvalues.size());
+        std::vector<weight_t> h_sg_eigenvalues(d_sg_eigenvalues.size());
+        raft::update_host(h_mg_aggregate_clustering.data(),
+                          d_mg_aggregate_clustering.data(),
+                          d_mg_aggregate_clustering.size(),
+                          handle.get_stream());
+        raft::update_host(h_mg_eigenvalues.data(),
+                          d_mg_eigenvalues.data(),
+                          d_mg_eigenvalues.size(),
+                          handle.get_stream());
+        raft::update_host(h_sg_eigenvalues.data(),
+                          d_sg_eigenvalues.data(),
+                          d_sg_eigenvalues.size(),
+                          handle.get_stream());
+
+        handle.get_stream_view().synchronize();
+
+        ASSERT_TRUE(std::all_of(
+          h_mg_aggregate_clustering.begin(), h_mg_aggregate_clustering.end(), [&](auto c) {
+            return (c >= vertex_t{0}) &&
+                   (c < static_cast<vertex_t>(spectral_usecase.num_clusters));
+          }))
+          << "invalid cluster IDs.";
+
+        for (size_t j = 0; j < h_sg_eigenvalues.size(); ++j) {
+          ASSERT_NEAR(h_mg_eigenvalues[j], h_sg_eigenvalues[j], 1e-3)
+            << "MG eigenvalue " << j << " does not match with the SG eigenvalue.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_MGSpectralClustering_File = Tests_MGSpectralClustering<cugraph::test::File_Usecase>;
+using Tests_MGSpectralClustering_Rmat = Tests_MGSpectralClustering<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGSpectralClustering_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGSpectralClustering_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGSpectralClustering_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGSpectralClustering_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SpectralClustering_Usecase{true, 8, 8},
+                      SpectralClustering_Usecase{false, 4, 4}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGSpectralClustering_Rmat,
+  ::testing::Combine(
+    ::testing::Values(SpectralClustering_Usecase{true, 16, 16, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
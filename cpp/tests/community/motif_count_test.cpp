@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+// self-loops are ignored, this code assumes that the graph is symmetric, has no multi-edges, and
+// every vertex's neighbor list is sorted.
+template <typename vertex_t, typename edge_t>
+std::tuple<std::vector<edge_t>, std::vector<edge_t>, std::vector<edge_t>> motif_count_reference(
+  edge_t const* offsets, vertex_t const* indices, vertex_t num_vertices)
+{
+  std::vector<std::vector<vertex_t>> nbr_lists(num_vertices);
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (edge_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+      if (indices[i] != u) { nbr_lists[u].push_back(indices[i]); }
+    }
+  }
+
+  std::vector<edge_t> wedge_counts(num_vertices, edge_t{0});
+  std::vector<edge_t> four_cycle_counts(num_vertices, edge_t{0});
+  std::vector<edge_t> four_clique_counts(num_vertices, edge_t{0});
+
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    auto degree     = static_cast<edge_t>(nbr_lists[u].size());
+    wedge_counts[u] = (degree * (degree - 1)) / 2;
+  }
+
+  // every 4-cycle including u has a unique vertex w opposite to u, and its two other vertices are
+  // common neighbors of u & w
+
+  std::vector<edge_t> common_nbr_counts(num_vertices, edge_t{0});
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    std::vector<vertex_t> opposites{};
+    for (auto x : nbr_lists[u]) {
+      for (auto w : nbr_lists[x]) {
+        if (w == u) { continue; }
+        if (common_nbr_counts[w]++ == 0) { opposites.push_back(w); }
+      }
+    }
+    for (auto w : opposites) {
+      four_cycle_counts[u] += (common_nbr_counts[w] * (common_nbr_counts[w] - 1)) / 2;
+      common_nbr_counts[w] = 0;
+    }
+  }
+
+  // every 4-clique (u, v, w, z) with u < v < w < z is found once from (u, v, w)
+
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (auto v : nbr_lists[u]) {
+      if (v <= u) { continue; }
+      std::vector<vertex_t> uv_nbrs{};
+      std::set_intersection(nbr_lists[u].begin(),
+                            nbr_lists[u].end(),
+                            nbr_lists[v].begin(),
+                            nbr_lists[v].end(),
+                            std::back_inserter(uv_nbrs));
+      for (auto w : uv_nbrs) {
+        if (w <= v) { continue; }
+        std::vector<vertex_t> uvw_nbrs{};
+        std::set_intersection(uv_nbrs.begin(),
+                              uv_nbrs.end(),
+                              nbr_lists[w].begin(),
+                              nbr_lists[w].end(),
+                              std::back_inserter(uvw_nbrs));
+        for (auto z : uvw_nbrs) {
+          if (z <= w) { continue; }
+          ++four_clique_counts[u];
+          ++four_clique_counts[v];
+          ++four_clique_counts[w];
+          ++four_clique_counts[z];
+        }
+      }
+    }
+  }
+
+  return std::make_tuple(
+    std::move(wedge_counts), std::move(four_cycle_counts), std::move(four_clique_counts));
+}
+
+struct MotifCount_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MotifCount
+  : public ::testing::TestWithParam<std::tuple<MotifCount_Usecase, input_usecase_t>> {
+ public:
+  Tests_MotifCount() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(MotifCount_Usecase const& motif_count_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber, true, true);
+    auto graph_view = graph.view();
+
+    rmm::device_uvector<edge_t> d_wedge_counts(graph_view.get_number_of_vertices(),
+                                               handle.get_stream());
+    rmm::device_uvector<edge_t> d_four_cycle_counts(graph_view.get_number_of_vertices(),
+                                                    handle.get_stream());
+    rmm::device_uvector<edge_t> d_four_clique_counts(graph_view.get_number_of_vertices(),
+                                                     handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::motif_count(handle,
+                         graph_view,
+                         std::make_optional(d_wedge_counts.data()),
+                         std::make_optional(d_four_cycle_counts.data()),
+                         std::make_optional(d_four_clique_counts.data()));
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Motif Count took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (motif_count_usecase.check_correctness) {
+      cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> unrenumbered_graph(handle);
+      if (renumber) {
+        std::tie(unrenumbered_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, false, false, true, true);
+      }
+      auto unrenumbered_graph_view = renumber ? unrenumbered_graph.view() : graph_view;
+
+      std::vector<edge_t> h_offsets(unrenumbered_graph_view.get_number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(unrenumbered_graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        unrenumbered_graph_view.get_matrix_partition_view().get_offsets(),
+                        unrenumbered_graph_view.get_number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        unrenumbered_graph_view.get_matrix_partition_view().get_indices(),
+                        unrenumbered_graph_view.get_number_of_edges(),
+                        handle.get_stream());
+
+      handle.get_stream_view().synchronize();
+
+      std::vector<edge_t> h_reference_wedge_counts{};
+      std::vector<edge_t> h_reference_four_cycle_counts{};
+      std::vector<edge_t> h_reference_four_clique_counts{};
+      std::tie(h_reference_wedge_counts,
+               h_reference_four_cycle_counts,
+               h_reference_four_clique_counts) =
+        motif_count_reference(
+          h_offsets.data(), h_indices.data(), graph_view.get_number_of_vertices());
+
+      auto to_unrenumbered_host = [&handle, &d_renumber_map_labels](
+                                    rmm::device_uvector<edge_t> const& d_counts) {
+        if (renumber) {
+          rmm::device_uvector<edge_t> d_unrenumbered_counts(size_t{0}, handle.get_stream());
+          std::tie(std::ignore, d_unrenumbered_counts) =
+            cugraph::test::sort_by_key(handle, *d_renumber_map_labels, d_counts);
+          return cugraph::test::to_host(
+            handle, d_unrenumbered_counts.data(), d_unrenumbered_counts.size());
+        } else {
+          return cugraph::test::to_host(handle, d_counts.data(), d_counts.size());
+        }
+      };
+
+      auto h_cugraph_wedge_counts       = to_unrenumbered_host(d_wedge_counts);
+      auto h_cugraph_four_cycle_counts  = to_unrenumbered_host(d_four_cycle_counts);
+      auto h_cugraph_four_clique_counts = to_unrenumbered_host(d_four_clique_counts);
+
+      ASSERT_TRUE(std::equal(h_reference_wedge_counts.begin(),
+                             h_reference_wedge_counts.end(),
+                             h_cugraph_wedge_counts.begin()))
+        << "wedge counts do not match with the reference values.";
+      ASSERT_TRUE(std::equal(h_reference_four_cycle_counts.begin(),
+                             h_reference_four_cycle_counts.end(),
+                             h_cugraph_four_cycle_counts.begin()))
+        << "4-cycle counts do not match with the reference values.";
+      ASSERT_TRUE(std::equal(h_reference_four_clique_counts.begin(),
+                             h_reference_four_clique_counts.end(),
+                             h_cugraph_four_clique_counts.begin()))
+        << "4-clique counts do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_MotifCount_File = Tests_MotifCount<cugraph::test::File_Usecase>;
+using Tests_MotifCount_Rmat = Tests_MotifCount<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MotifCount_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MotifCount_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MotifCount_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MotifCount_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MotifCount_File,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(MotifCount_Usecase{}),
+    testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MotifCount_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(MotifCount_Usecase{}),
+    testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MotifCount_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    testing::Values(MotifCount_Usecase{false}),
+    testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+// returns the eigenvalues (in descending order) of the dense (n x n) symmetric matrix a (cyclic
+// Jacobi)
+std::vector<double> symmetric_eigenvalues_reference(std::vector<double> a, size_t n)
+{
+  for (size_t sweep = 0; sweep < 100; ++sweep) {
+    double off{0.0};
+    for (size_t p = 0; p < n; ++p) {
+      for (size_t q = p + 1; q < n; ++q) {
+        off += a[p * n + q] * a[p * n + q];
+      }
+    }
+    if (off < 1e-24) { break; }
+    for (size_t p = 0; p < n; ++p) {
+      for (size_t q = p + 1; q < n; ++q) {
+        auto apq = a[p * n + q];
+        if (apq == 0.0) { continue; }
+        auto theta = (a[q * n + q] - a[p * n + p]) / (2.0 * apq);
+        auto t = (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+        auto c = 1.0 / std::sqrt(t * t + 1.0);
+        auto s = t * c;
+        for (size_t k = 0; k < n; ++k) {
+          auto akp     = a[k * n + p];
+          auto akq     = a[k * n + q];
+          a[k * n + p] = c * akp - s * akq;
+          a[k * n + q] = s * akp + c * akq;
+        }
+        for (size_t k = 0; k < n; ++k) {
+          auto apk     = a[p * n + k];
+          auto aqk     = a[q * n + k];
+          a[p * n + k] = c * apk - s * aqk;
+          a[q * n + k] = s * apk + c * aqk;
+        }
+      }
+    }
+  }
+
+  std::vector<double> eigenvalues(n);
+  for (size_t i = 0; i < n; ++i) {
+    eigenvalues[i] = a[i * n + i];
+  }
+  std::sort(eigenvalues.begin(), eigenvalues.end(), std::greater<double>{});
+  return eigenvalues;
+}
+
+struct SpectralClustering_Usecase {
+  bool balanced_cut{true};
+  size_t num_clusters{4};
+  size_t num_eigenvectors{4};
+  double quality_threshold{0.0};  // max. edge cut ratio (balanced cut) or min. modularity
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_SpectralClustering
+  : public ::testing::TestWithParam<std::tuple<SpectralClustering_Usecase, input_usecase_t>> {
+ public:
+  Tests_SpectralClustering() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SpectralClustering_Usecase const& spectral_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false, true, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+    auto graph_view = graph.view();
+
+    auto num_vertices = static_cast<size_t>(graph_view.get_number_of_vertices());
+    rmm::device_uvector<vertex_t> d_clustering(num_vertices, handle.get_stream());
+    rmm::device_uvector<weight_t> d_eigenvalues(spectral_usecase.num_eigenvectors,
+                                                handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    if (spectral_usecase.balanced_cut) {
+      cugraph::spectral_balanced_cut_clustering(handle,
+                                                graph_view,
+                                                spectral_usecase.num_clusters,
+                                                spectral_usecase.num_eigenvectors,
+                                                weight_t{1e-5},
+                                                size_t{1000},
+                                                weight_t{1e-4},
+                                                size_t{100},
+                                                d_clustering.data(),
+                                                d_eigenvalues.data());
+    } else {
+      cugraph::spectral_modularity_maximization(handle,
+                                                graph_view,
+                                                spectral_usecase.num_clusters,
+                                                spectral_usecase.num_eigenvectors,
+                                                weight_t{1e-5},
+                                                size_t{1000},
+                                                weight_t{1e-4},
+                                                size_t{100},
+                                                d_clustering.data(),
+                                                d_eigenvalues.data());
+    }
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Spectral clustering took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (spectral_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(num_vertices + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      std::vector<weight_t> h_weights(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        num_vertices + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        h_indices.size(),
+                        handle.get_stream());
+      raft::update_host(h_weights.data(),
+                        *(graph_view.get_matrix_partition_view().get_weights()),
+                        h_weights.size(),
+                        handle.get_stream());
+
+      std::vector<vertex_t> h_clustering(num_vertices);
+      std::vector<weight_t> h_eigenvalues(spectral_usecase.num_eigenvectors);
+      raft::update_host(
+        h_clustering.data(), d_clustering.data(), d_clustering.size(), handle.get_stream());
+      raft::update_host(
+        h_eigenvalues.data(), d_eigenvalues.data(), d_eigenvalues.size(), handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      // 1. compare the eigenvalues with the dense reference
+
+      std::vector<double> degrees(num_vertices, 0.0);
+      double total_weight{0.0};
+      for (size_t u = 0; u < num_vertices; ++u) {
+        for (auto i = h_offsets[u]; i < h_offsets[u + 1]; ++i) {
+          degrees[u] += h_weights[i];
+        }
+        total_weight += degrees[u];
+      }
+      std::vector<double> a(num_vertices * num_vertices, 0.0);
+      for (size_t u = 0; u < num_vertices; ++u) {
+        for (auto i = h_offsets[u]; i < h_offsets[u + 1]; ++i) {
+          auto v = static_cast<size_t>(h_indices[i]);
+          a[u * num_vertices + v] +=
+            spectral_usecase.balanced_cut
+              ? h_weights[i] / std::sqrt(degrees[u] * degrees[v])
+              : static_cast<double>(h_weights[i]);
+        }
+        if (!spectral_usecase.balanced_cut) {
+          for (size_t v = 0; v < num_vertices; ++v) {
+            a[u * num_vertices + v] -= degrees[u] * degrees[v] / total_weight;
+          }
+        }
+      }
+      auto h_reference_eigenvalues = symmetric_eigenvalues_reference(a, num_vertices);
+
+      for (size_t j = 0; j < spectral_usecase.num_eigenvectors; ++j) {
+        auto expected = spectral_usecase.balanced_cut ? 1.0 - h_reference_eigenvalues[j]
+                                                      : h_reference_eigenvalues[j];
+        ASSERT_NEAR(h_eigenvalues[j], expected, 1e-3)
+          << "eigenvalue " << j << " does not match with the reference value.";
+      }
+
+      // 2. check the clustering quality
+
+      ASSERT_TRUE(std::all_of(h_clustering.begin(), h_clustering.end(), [&](auto c) {
+        return (c >= vertex_t{0}) && (c < static_cast<vertex_t>(spectral_usecase.num_clusters));
+      })) << "invalid cluster IDs.";
+
+      double cut_weight{0.0};
+      double modularity{0.0};
+      std::vector<double> cluster_degrees(spectral_usecase.num_clusters, 0.0);
+      for (size_t u = 0; u < num_vertices; ++u) {
+        for (auto i = h_offsets[u]; i < h_offsets[u + 1]; ++i) {
+          if (h_clustering[u] != h_clustering[h_indices[i]]) {
+            cut_weight += h_weights[i];
+          } else {
+            modularity += h_weights[i];
+          }
+        }
+        cluster_degrees[h_clustering[u]] += degrees[u];
+      }
+      modularity /= total_weight;
+      for (auto d : cluster_degrees) {
+        modularity -= (d / total_weight) * (d / total_weight);
+      }
+
+      if (spectral_usecase.balanced_cut) {
+        ASSERT_LE(cut_weight / total_weight, spectral_usecase.quality_threshold)
+          << "edge cut ratio is larger than expected.";
+      } else {
+        ASSERT_GE(modularity, spectral_usecase.quality_threshold)
+          << "modularity is smaller than expected.";
+      }
+    }
+  }
+};
+
+using Tests_SpectralClustering_File = Tests_SpectralClustering<cugraph::test::File_Usecase>;
+using Tests_SpectralClustering_Rmat = Tests_SpectralClustering<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_SpectralClustering_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SpectralClustering_File, CheckInt32Int32Double)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, double>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SpectralClustering_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_SpectralClustering_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_SpectralClustering_File,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(SpectralClustering_Usecase{true, 2, 2, 0.2},
+                    SpectralClustering_Usecase{true, 8, 8, 0.6},
+                    SpectralClustering_Usecase{false, 4, 4, 0.3}),
+    testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_SpectralClustering_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    testing::Values(SpectralClustering_Usecase{true, 16, 16, 1.0, false},
+                    SpectralClustering_Usecase{false, 16, 16, -1.0, false}),
+    testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
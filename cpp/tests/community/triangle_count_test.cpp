@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+// self-loops are ignored, this code assumes that the graph is symmetric, has no multi-edges, and
+// every vertex's neighbor list is sorted.
+template <typename vertex_t, typename edge_t>
+std::vector<edge_t> triangle_count_reference(edge_t const* offsets,
+                                             vertex_t const* indices,
+                                             vertex_t num_vertices)
+{
+  std::vector<edge_t> triangle_counts(num_vertices, edge_t{0});
+
+  // every triangle (u, v, w) with u < v < w is found once from the edge (u, v)
+
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (edge_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+      auto v = indices[i];
+      if (v <= u) { continue; }
+      auto first0 = std::upper_bound(indices + offsets[u], indices + offsets[u + 1], v);
+      auto last0  = indices + offsets[u + 1];
+      auto first1 = std::upper_bound(indices + offsets[v], indices + offsets[v + 1], v);
+      auto last1  = indices + offsets[v + 1];
+      std::vector<vertex_t> common_nbrs{};
+      std::set_intersection(first0, last0, first1, last1, std::back_inserter(common_nbrs));
+      triangle_counts[u] += static_cast<edge_t>(common_nbrs.size());
+      triangle_counts[v] += static_cast<edge_t>(common_nbrs.size());
+      for (auto w : common_nbrs) {
+        ++triangle_counts[w];
+      }
+    }
+  }
+
+  return triangle_counts;
+}
+
+struct TriangleCount_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_TriangleCount
+  : public ::testing::TestWithParam<std::tuple<TriangleCount_Usecase, input_usecase_t>> {
+ public:
+  Tests_TriangleCount() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(TriangleCount_Usecase const& triangle_count_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber, true, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+    auto graph_view = graph.view();
+
+    rmm::device_uvector<edge_t> d_triangle_counts(graph_view.get_number_of_vertices(),
+                                                  handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::triangle_count(handle, graph_view, d_triangle_counts.data());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Triangle Count took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (triangle_count_usecase.check_correctness) {
+      cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> unrenumbered_graph(handle);
+      if (renumber) {
+        std::tie(unrenumbered_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, false, false, true, true);
+      }
+      auto unrenumbered_graph_view = renumber ? unrenumbered_graph.view() : graph_view;
+
+      std::vector<edge_t> h_offsets(unrenumbered_graph_view.get_number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(unrenumbered_graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        unrenumbered_graph_view.get_matrix_partition_view().get_offsets(),
+                        unrenumbered_graph_view.get_number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        unrenumbered_graph_view.get_matrix_partition_view().get_indices(),
+                        unrenumbered_graph_view.get_number_of_edges(),
+                        handle.get_stream());
+
+      handle.get_stream_view().synchronize();
+
+      auto h_reference_triangle_counts = triangle_count_reference(
+        h_offsets.data(), h_indices.data(), graph_view.get_number_of_vertices());
+
+      std::vector<edge_t> h_cugraph_triangle_counts(graph_view.get_number_of_vertices());
+      if (renumber) {
+        rmm::device_uvector<edge_t> d_unrenumbered_triangle_counts(size_t{0},
+                                                                   handle.get_stream());
+        std::tie(std::ignore, d_unrenumbered_triangle_counts) =
+          cugraph::test::sort_by_key(handle, *d_renumber_map_labels, d_triangle_counts);
+        raft::update_host(h_cugraph_triangle_counts.data(),
+                          d_unrenumbered_triangle_counts.data(),
+                          d_unrenumbered_triangle_counts.size(),
+                          handle.get_stream());
+      } else {
+        raft::update_host(h_cugraph_triangle_counts.data(),
+                          d_triangle_counts.data(),
+                          d_triangle_counts.size(),
+                          handle.get_stream());
+      }
+
+      handle.get_stream_view().synchronize();
+
+      ASSERT_TRUE(std::equal(h_reference_triangle_counts.begin(),
+                             h_reference_triangle_counts.end(),
+                             h_cugraph_triangle_counts.begin()))
+        << "triangle counts do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_TriangleCount_File = Tests_TriangleCount<cugraph::test::File_Usecase>;
+using Tests_TriangleCount_Rmat = Tests_TriangleCount<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_TriangleCount_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_TriangleCount_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_TriangleCount_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_TriangleCount_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_TriangleCount_File,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(TriangleCount_Usecase{}),
+    testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_TriangleCount_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(TriangleCount_Usecase{}),
+    testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false),
+                    // skewed degree distribution, high degree vertices have few out-neighbors
+                    // in the oriented graph
+                    cugraph::test::Rmat_Usecase(10, 128, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_TriangleCount_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    testing::Values(TriangleCount_Usecase{false}),
+    testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+struct IncrementalWeaklyConnectedComponents_Usecase {
+  double inserted_edge_ratio{0.1};
+  bool check_correctness{true};
+};
+
+template <typename vertex_t, typename edge_t>
+cugraph::graph_t<vertex_t, edge_t, float, false, false> build_symmetric_graph(
+  raft::handle_t const& handle,
+  vertex_t num_vertices,
+  std::vector<vertex_t> const& h_srcs,
+  std::vector<vertex_t> const& h_dsts)
+{
+  rmm::device_uvector<vertex_t> d_vertices(num_vertices, handle.get_stream());
+  cugraph::detail::sequence_fill(
+    handle.get_stream_view(), d_vertices.data(), d_vertices.size(), vertex_t{0});
+  rmm::device_uvector<vertex_t> d_srcs(h_srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> d_dsts(h_dsts.size(), handle.get_stream());
+  raft::update_device(d_srcs.data(), h_srcs.data(), h_srcs.size(), handle.get_stream());
+  raft::update_device(d_dsts.data(), h_dsts.data(), h_dsts.size(), handle.get_stream());
+
+  cugraph::graph_t<vertex_t, edge_t, float, false, false> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::create_graph_from_edgelist<vertex_t, edge_t, float, false, false>(
+      handle,
+      std::optional<rmm::device_uvector<vertex_t>>{std::move(d_vertices)},
+      std::move(d_srcs),
+      std::move(d_dsts),
+      std::nullopt,
+      cugraph::graph_properties_t{true, false},
+      false);
+  return graph;
+}
+
+template <typename input_usecase_t>
+class Tests_IncrementalWeaklyConnectedComponents
+  : public ::testing::TestWithParam<
+      std::tuple<IncrementalWeaklyConnectedComponents_Usecase, input_usecase_t>> {
+ public:
+  Tests_IncrementalWeaklyConnectedComponents() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(IncrementalWeaklyConnectedComponents_Usecase const& wcc_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    // 1. split the (undirected) edges to the old edges and the inserted edges
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+    auto graph_view   = graph.view();
+    auto num_vertices = graph_view.get_number_of_vertices();
+    ASSERT_TRUE(graph_view.is_symmetric())
+      << "Weakly connected components works only on undirected (symmetric) graphs.";
+
+    auto [d_srcs, d_dsts, d_weights] = graph.decompress_to_edgelist(handle, std::nullopt, false);
+    std::vector<vertex_t> h_srcs(d_srcs.size());
+    std::vector<vertex_t> h_dsts(d_dsts.size());
+    raft::update_host(h_srcs.data(), d_srcs.data(), d_srcs.size(), handle.get_stream());
+    raft::update_host(h_dsts.data(), d_dsts.data(), d_dsts.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    std::default_random_engine generator{};
+    std::uniform_real_distribution<double> ratio_distribution{0.0, 1.0};
+
+    std::vector<vertex_t> h_old_srcs{};
+    std::vector<vertex_t> h_old_dsts{};
+    std::vector<vertex_t> h_inserted_srcs{};
+    std::vector<vertex_t> h_inserted_dsts{};
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      if (h_srcs[i] > h_dsts[i]) { continue; }
+      if (ratio_distribution(generator) < wcc_usecase.inserted_edge_ratio) {
+        // a single direction per undirected edge suffices
+        h_inserted_srcs.push_back(h_dsts[i]);
+        h_inserted_dsts.push_back(h_srcs[i]);
+      } else {
+        h_old_srcs.push_back(h_srcs[i]);
+        h_old_dsts.push_back(h_dsts[i]);
+        if (h_srcs[i] != h_dsts[i]) {
+          h_old_srcs.push_back(h_dsts[i]);
+          h_old_dsts.push_back(h_srcs[i]);
+        }
+      }
+    }
+
+    // 2. compute the components before the insertion
+
+    rmm::device_uvector<vertex_t> d_components(num_vertices, handle.get_stream());
+    {
+      auto old_graph =
+        build_symmetric_graph<vertex_t, edge_t>(handle, num_vertices, h_old_srcs, h_old_dsts);
+      cugraph::weakly_connected_components(handle, old_graph.view(), d_components.data());
+    }
+
+    // 3. update the components
+
+    rmm::device_uvector<vertex_t> d_inserted_srcs(h_inserted_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_inserted_dsts(h_inserted_dsts.size(), handle.get_stream());
+    raft::update_device(
+      d_inserted_srcs.data(), h_inserted_srcs.data(), h_inserted_srcs.size(), handle.get_stream());
+    raft::update_device(
+      d_inserted_dsts.data(), h_inserted_dsts.data(), h_inserted_dsts.size(), handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::incremental_weakly_connected_components(handle,
+                                                     graph_view,
+                                                     d_inserted_srcs.data(),
+                                                     d_inserted_dsts.data(),
+                                                     static_cast<edge_t>(d_inserted_srcs.size()),
+                                                     d_components.data(),
+                                                     true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "incremental_weakly_connected_components took " << elapsed_time * 1e-6
+                << " s.\n";
+    }
+
+    if (wcc_usecase.check_correctness) {
+      rmm::device_uvector<vertex_t> d_reference_components(num_vertices, handle.get_stream());
+      cugraph::weakly_connected_components(handle, graph_view, d_reference_components.data());
+
+      std::vector<vertex_t> h_cugraph_components(num_vertices);
+      std::vector<vertex_t> h_reference_components(num_vertices);
+      raft::update_host(h_cugraph_components.data(),
+                        d_components.data(),
+                        d_components.size(),
+                        handle.get_stream());
+      raft::update_host(h_reference_components.data(),
+                        d_reference_components.data(),
+                        d_reference_components.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      // the two labelings should induce the same partition
+      std::unordered_map<vertex_t, vertex_t> cugraph_to_reference_map{};
+      std::unordered_map<vertex_t, vertex_t> reference_to_cugraph_map{};
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        auto cugraph_it =
+          cugraph_to_reference_map.insert({h_cugraph_components[v], h_reference_components[v]})
+            .first;
+        auto reference_it =
+          reference_to_cugraph_map.insert({h_reference_components[v], h_cugraph_components[v]})
+            .first;
+        ASSERT_EQ(cugraph_it->second, h_reference_components[v])
+          << "components do not match with the reference values.";
+        ASSERT_EQ(reference_it->second, h_cugraph_components[v])
+          << "components do not match with the reference values.";
+      }
+    }
+  }
+};
+
+using Tests_IncrementalWeaklyConnectedComponents_File =
+  Tests_IncrementalWeaklyConnectedComponents<cugraph::test::File_Usecase>;
+using Tests_IncrementalWeaklyConnectedComponents_Rmat =
+  Tests_IncrementalWeaklyConnectedComponents<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_IncrementalWeaklyConnectedComponents_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_IncrementalWeaklyConnectedComponents_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_IncrementalWeaklyConnectedComponents_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_IncrementalWeaklyConnectedComponents_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalWeaklyConnectedComponents_Usecase{0.1},
+                      IncrementalWeaklyConnectedComponents_Usecase{0.5}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_IncrementalWeaklyConnectedComponents_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalWeaklyConnectedComponents_Usecase{0.1},
+                      IncrementalWeaklyConnectedComponents_Usecase{0.5}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_IncrementalWeaklyConnectedComponents_Rmat,
+  ::testing::Combine(
+    // disable correctness checks
+    ::testing::Values(IncrementalWeaklyConnectedComponents_Usecase{0.01, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
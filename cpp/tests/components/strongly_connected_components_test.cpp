@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Kosaraju's algorithm (iterative depth-first searches)
+template <typename vertex_t, typename edge_t>
+void strongly_connected_components_reference(edge_t const* offsets,
+                                             vertex_t const* indices,
+                                             vertex_t num_vertices,
+                                             vertex_t* components)
+{
+  // 1. post-order of the depth-first searches on the graph
+
+  std::vector<vertex_t> post_order{};
+  post_order.reserve(num_vertices);
+  std::vector<bool> visited(num_vertices, false);
+  std::vector<std::pair<vertex_t, edge_t>> stack{};
+  for (vertex_t s = 0; s < num_vertices; ++s) {
+    if (visited[s]) { continue; }
+    visited[s] = true;
+    stack.push_back(std::make_pair(s, offsets[s]));
+    while (!stack.empty()) {
+      auto& [v, i] = stack.back();
+      if (i < offsets[v + 1]) {
+        auto w = indices[i++];
+        if (!visited[w]) {
+          visited[w] = true;
+          stack.push_back(std::make_pair(w, offsets[w]));
+        }
+      } else {
+        post_order.push_back(v);
+        stack.pop_back();
+      }
+    }
+  }
+
+  // 2. depth-first searches on the reversed graph in the reverse post-order
+
+  std::vector<edge_t> reversed_offsets(num_vertices + 1, edge_t{0});
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+      ++reversed_offsets[indices[i] + 1];
+    }
+  }
+  std::partial_sum(reversed_offsets.begin(), reversed_offsets.end(), reversed_offsets.begin());
+  std::vector<vertex_t> reversed_indices(reversed_offsets.back());
+  auto insert_offsets = reversed_offsets;
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+      reversed_indices[insert_offsets[indices[i]]++] = v;
+    }
+  }
+
+  std::fill(components, components + num_vertices, std::numeric_limits<vertex_t>::max());
+  std::vector<vertex_t> dfs_stack{};
+  for (auto it = post_order.rbegin(); it != post_order.rend(); ++it) {
+    if (components[*it] != std::numeric_limits<vertex_t>::max()) { continue; }
+    components[*it] = *it;
+    dfs_stack.push_back(*it);
+    while (!dfs_stack.empty()) {
+      auto v = dfs_stack.back();
+      dfs_stack.pop_back();
+      for (auto i = reversed_offsets[v]; i < reversed_offsets[v + 1]; ++i) {
+        auto w = reversed_indices[i];
+        if (components[w] == std::numeric_limits<vertex_t>::max()) {
+          components[w] = *it;
+          dfs_stack.push_back(w);
+        }
+      }
+    }
+  }
+}
+
+struct StronglyConnectedComponents_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_StronglyConnectedComponents
+  : public ::testing::TestWithParam<
+      std::tuple<StronglyConnectedComponents_Usecase, input_usecase_t>> {
+ public:
+  Tests_StronglyConnectedComponents() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(StronglyConnectedComponents_Usecase const& scc_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = graph_view.get_number_of_vertices();
+
+    rmm::device_uvector<vertex_t> d_components(num_vertices, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::strongly_connected_components(handle, graph_view, d_components.data());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "strongly_connected_components took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (scc_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(num_vertices + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        num_vertices + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      std::vector<vertex_t> h_cugraph_components(num_vertices);
+      raft::update_host(h_cugraph_components.data(),
+                        d_components.data(),
+                        d_components.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      std::vector<vertex_t> h_reference_components(num_vertices);
+      strongly_connected_components_reference(
+        h_offsets.data(), h_indices.data(), num_vertices, h_reference_components.data());
+
+      // the two labelings should induce the same partition
+      std::unordered_map<vertex_t, vertex_t> cugraph_to_reference_map{};
+      std::unordered_map<vertex_t, vertex_t> reference_to_cugraph_map{};
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        auto cugraph_it =
+          cugraph_to_reference_map.insert({h_cugraph_components[v], h_reference_components[v]})
+            .first;
+        auto reference_it =
+          reference_to_cugraph_map.insert({h_reference_components[v], h_cugraph_components[v]})
+            .first;
+        ASSERT_EQ(cugraph_it->second, h_reference_components[v])
+          << "components do not match with the reference values.";
+        ASSERT_EQ(reference_it->second, h_cugraph_components[v])
+          << "components do not match with the reference values.";
+      }
+    }
+  }
+};
+
+using Tests_StronglyConnectedComponents_File =
+  Tests_StronglyConnectedComponents<cugraph::test::File_Usecase>;
+using Tests_StronglyConnectedComponents_Rmat =
+  Tests_StronglyConnectedComponents<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_StronglyConnectedComponents_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_StronglyConnectedComponents_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_StronglyConnectedComponents_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_StronglyConnectedComponents_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_StronglyConnectedComponents_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(StronglyConnectedComponents_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/cage6.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_StronglyConnectedComponents_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(StronglyConnectedComponents_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 4, 0.57, 0.19, 0.19, 0, false, false),
+                      cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_StronglyConnectedComponents_Rmat,
+  ::testing::Combine(
+    // disable correctness checks
+    ::testing::Values(StronglyConnectedComponents_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
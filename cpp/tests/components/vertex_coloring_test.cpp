@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+struct VertexColoring_Usecase {
+  uint64_t seed{0};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_VertexColoring
+  : public ::testing::TestWithParam<std::tuple<VertexColoring_Usecase, input_usecase_t>> {
+ public:
+  Tests_VertexColoring() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // the maximal independent set should be independent & maximal and the coloring should be proper
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(VertexColoring_Usecase const& coloring_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = graph_view.get_number_of_vertices();
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto d_mis = cugraph::maximal_independent_set(handle, graph_view, coloring_usecase.seed);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "maximal_independent_set took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    rmm::device_uvector<vertex_t> d_colors(num_vertices, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto num_colors =
+      cugraph::vertex_coloring(handle, graph_view, d_colors.data(), coloring_usecase.seed);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "vertex_coloring took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (coloring_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(num_vertices + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        num_vertices + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      auto h_mis    = cugraph::test::to_host(handle, d_mis.data(), d_mis.size());
+      auto h_colors = cugraph::test::to_host(handle, d_colors.data(), d_colors.size());
+
+      std::vector<bool> in_mis(num_vertices, false);
+      for (auto v : h_mis) {
+        ASSERT_TRUE((v >= 0) && (v < num_vertices)) << "invalid vertex in the independent set.";
+        ASSERT_FALSE(in_mis[v]) << "duplicate vertex in the independent set.";
+        in_mis[v] = true;
+      }
+
+      vertex_t h_max_color{-1};
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        bool has_nbr_in_mis{false};
+        ASSERT_TRUE((h_colors[v] >= 0) && (h_colors[v] < num_colors)) << "invalid color.";
+        h_max_color = std::max(h_max_color, h_colors[v]);
+        for (auto i = h_offsets[v]; i < h_offsets[v + 1]; ++i) {
+          auto nbr = h_indices[i];
+          if (nbr == v) { continue; }
+          ASSERT_FALSE(in_mis[v] && in_mis[nbr]) << "the independent set is not independent.";
+          has_nbr_in_mis = has_nbr_in_mis || in_mis[nbr];
+          ASSERT_NE(h_colors[v], h_colors[nbr]) << "neighbors have the same color.";
+        }
+        ASSERT_TRUE(in_mis[v] || has_nbr_in_mis) << "the independent set is not maximal.";
+      }
+      ASSERT_EQ(h_max_color + 1, num_colors) << "the number of colors is not correct.";
+    }
+  }
+};
+
+using Tests_VertexColoring_File = Tests_VertexColoring<cugraph::test::File_Usecase>;
+using Tests_VertexColoring_Rmat = Tests_VertexColoring<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_VertexColoring_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_VertexColoring_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_VertexColoring_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_VertexColoring_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(VertexColoring_Usecase{0}, VertexColoring_Usecase{42}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_VertexColoring_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(VertexColoring_Usecase{0}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_VertexColoring_Rmat,
+  ::testing::Combine(
+    // disable correctness checks
+    ::testing::Values(VertexColoring_Usecase{0, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -253,8 +253,11 @@ INSTANTIATE_TEST_SUITE_P(
                                        CoreNumber_Usecase{cugraph::k_core_degree_type_t::INOUT,
                                                           size_t{0},
                                                           std::numeric_limits<size_t>::max()}),
-                     ::testing::Values(cugraph::test::Rmat_Usecase(
-                       10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+                     ::testing::Values(
+                       cugraph::test::Rmat_Usecase(
+                         10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true),
+                       cugraph::test::Rmat_Usecase(
+                         10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_generators.hpp>
+
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+#include <thrust/unique.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+struct GenerateCommunityGraphTest : public ::testing::Test {
+};
+
+template <typename vertex_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> to_host_edgelist(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t> const& d_src_v,
+  rmm::device_uvector<vertex_t> const& d_dst_v)
+{
+  return std::make_tuple(cugraph::test::to_host(handle, d_src_v.data(), d_src_v.size()),
+                         cugraph::test::to_host(handle, d_dst_v.data(), d_dst_v.size()));
+}
+
+template <typename vertex_t>
+void test_symmetric(std::vector<vertex_t> h_src_v, std::vector<vertex_t> h_dst_v)
+{
+  std::vector<vertex_t> reverse_src_v(h_dst_v);
+  std::vector<vertex_t> reverse_dst_v(h_src_v);
+
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(h_src_v.begin(), h_dst_v.begin()));
+  thrust::sort(thrust::host, edge_first, edge_first + h_src_v.size());
+  auto reverse_edge_first =
+    thrust::make_zip_iterator(thrust::make_tuple(reverse_src_v.begin(), reverse_dst_v.begin()));
+  thrust::sort(thrust::host, reverse_edge_first, reverse_edge_first + reverse_src_v.size());
+
+  EXPECT_EQ(reverse_src_v, h_src_v);
+  EXPECT_EQ(reverse_dst_v, h_dst_v);
+}
+
+template <typename vertex_t>
+void sbm_test(std::vector<vertex_t> const& block_sizes, double p_in, double p_out, bool directed)
+{
+  raft::handle_t handle;
+
+  auto num_blocks = block_sizes.size();
+  std::vector<double> block_edge_probabilities(num_blocks * num_blocks, p_out);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    block_edge_probabilities[i * num_blocks + i] = p_in;
+  }
+
+  auto [d_src_v, d_dst_v] = cugraph::generate_stochastic_block_model_edgelist<vertex_t>(
+    handle, block_sizes, block_edge_probabilities, directed, uint64_t{7});
+  auto [h_src_v, h_dst_v] = to_host_edgelist(handle, d_src_v, d_dst_v);
+
+  std::vector<vertex_t> block_firsts(num_blocks + 1, vertex_t{0});
+  std::partial_sum(block_sizes.begin(), block_sizes.end(), block_firsts.begin() + 1);
+  auto block_of = [&block_firsts](vertex_t v) {
+    return std::distance(block_firsts.begin() + 1,
+                         std::upper_bound(block_firsts.begin() + 1, block_firsts.end(), v));
+  };
+
+  // the expected number of (directed) edges inside & across the blocks
+  double expected_intra_edges{0.0};
+  double expected_inter_edges{0.0};
+  for (size_t i = 0; i < num_blocks; ++i) {
+    auto n_i = static_cast<double>(block_sizes[i]);
+    expected_intra_edges += p_in * n_i * (n_i - 1.0);
+    expected_inter_edges += p_out * n_i * (static_cast<double>(block_firsts.back()) - n_i);
+  }
+
+  size_t num_intra_edges{0};
+  for (size_t i = 0; i < h_src_v.size(); ++i) {
+    ASSERT_TRUE(cugraph::is_valid_vertex(block_firsts.back(), h_src_v[i]));
+    ASSERT_TRUE(cugraph::is_valid_vertex(block_firsts.back(), h_dst_v[i]));
+    ASSERT_NE(h_src_v[i], h_dst_v[i]) << "SBM edge lists should not have self-loops.";
+    if (block_of(h_src_v[i]) == block_of(h_dst_v[i])) { ++num_intra_edges; }
+  }
+  auto num_inter_edges = h_src_v.size() - num_intra_edges;
+
+  ASSERT_GE(num_intra_edges, static_cast<size_t>(expected_intra_edges * 0.8));
+  ASSERT_LE(num_intra_edges, static_cast<size_t>(expected_intra_edges * 1.2));
+  ASSERT_GE(num_inter_edges, static_cast<size_t>(expected_inter_edges * 0.8));
+  ASSERT_LE(num_inter_edges, static_cast<size_t>(expected_inter_edges * 1.2));
+
+  std::vector<vertex_t> sorted_src_v(h_src_v);
+  std::vector<vertex_t> sorted_dst_v(h_dst_v);
+  auto sorted_edge_first =
+    thrust::make_zip_iterator(thrust::make_tuple(sorted_src_v.begin(), sorted_dst_v.begin()));
+  thrust::sort(thrust::host, sorted_edge_first, sorted_edge_first + sorted_src_v.size());
+  ASSERT_TRUE(thrust::unique(thrust::host,
+                             sorted_edge_first,
+                             sorted_edge_first + sorted_src_v.size()) ==
+              sorted_edge_first + sorted_src_v.size())
+    << "SBM edge lists should not have parallel edges.";
+
+  if (!directed) { test_symmetric(h_src_v, h_dst_v); }
+}
+
+template <typename vertex_t>
+void ba_test(vertex_t num_vertices, size_t edges_per_vertex, bool symmetrize)
+{
+  raft::handle_t handle;
+
+  auto [d_src_v, d_dst_v] = cugraph::generate_barabasi_albert_edgelist<vertex_t>(
+    handle, num_vertices, edges_per_vertex, uint64_t{3}, symmetrize);
+  auto [h_src_v, h_dst_v] = to_host_edgelist(handle, d_src_v, d_dst_v);
+
+  auto num_edges = static_cast<size_t>(num_vertices) * edges_per_vertex;
+  if (!symmetrize) {
+    ASSERT_EQ(h_src_v.size(), num_edges);
+    for (size_t i = 0; i < h_src_v.size(); ++i) {
+      ASSERT_EQ(h_src_v[i], static_cast<vertex_t>(i / edges_per_vertex));
+      ASSERT_TRUE((h_dst_v[i] >= vertex_t{0}) && (h_dst_v[i] <= h_src_v[i]))
+        << "a vertex should attach to the vertices added before.";
+    }
+  } else {
+    ASSERT_LE(h_src_v.size(), 2 * num_edges);
+    test_symmetric(h_src_v, h_dst_v);
+  }
+
+  // preferential attachment: the oldest vertices should have much higher degrees than average
+  std::vector<size_t> degrees(num_vertices, size_t{0});
+  for (size_t i = 0; i < h_src_v.size(); ++i) {
+    ++degrees[h_src_v[i]];
+    ++degrees[h_dst_v[i]];
+  }
+  auto average_degree = static_cast<double>(2 * h_src_v.size()) / num_vertices;
+  ASSERT_GT(static_cast<double>(*std::max_element(degrees.begin(), degrees.end())),
+            average_degree * 5.0);
+}
+
+TEST_F(GenerateCommunityGraphTest, SBMTest)
+{
+  sbm_test<int32_t>(std::vector<int32_t>{100, 200, 300}, 0.1, 0.01, false);
+  sbm_test<int32_t>(std::vector<int32_t>{100, 200, 300}, 0.1, 0.01, true);
+  sbm_test<int32_t>(std::vector<int32_t>{50, 0, 50}, 1.0, 0.0, false);
+  sbm_test<int32_t>(std::vector<int32_t>(100, 1000), 0.01, 0.0001, false);
+  sbm_test<int64_t>(std::vector<int64_t>(10, 10000), 0.001, 0.00001, false);
+}
+
+TEST_F(GenerateCommunityGraphTest, BATest)
+{
+  ba_test<int32_t>(int32_t{1000}, size_t{1}, false);
+  ba_test<int32_t>(int32_t{10000}, size_t{4}, false);
+  ba_test<int32_t>(int32_t{10000}, size_t{4}, true);
+  ba_test<int64_t>(int64_t{100000}, size_t{8}, false);
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -22,6 +22,7 @@
 
 #include <thrust/execution_policy.h>
 #include <thrust/sort.h>
+#include <thrust/unique.h>
 
 #include <gtest/gtest.h>
 
@@ -88,12 +89,66 @@ void er_test(size_t num_vertices, float p)
             0);
 }
 
+template <typename vertex_t>
+void er_gnm_test(size_t num_vertices, size_t m, vertex_t base_vertex_id)
+{
+  raft::handle_t handle;
+  rmm::device_uvector<vertex_t> d_src_v(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_dst_v(0, handle.get_stream());
+
+  std::tie(d_src_v, d_dst_v) = cugraph::generate_erdos_renyi_graph_edgelist_gnm<vertex_t>(
+    handle, static_cast<vertex_t>(num_vertices), m, base_vertex_id);
+
+  std::vector<vertex_t> h_src_v(d_src_v.size());
+  std::vector<vertex_t> h_dst_v(d_dst_v.size());
+
+  raft::update_host(h_src_v.data(), d_src_v.data(), d_src_v.size(), handle.get_stream());
+  raft::update_host(h_dst_v.data(), d_dst_v.data(), d_dst_v.size(), handle.get_stream());
+
+  handle.get_stream_view().synchronize();
+
+  ASSERT_EQ(h_src_v.size(), m);
+  ASSERT_EQ(h_dst_v.size(), m);
+  ASSERT_EQ(std::count_if(h_src_v.begin(),
+                          h_src_v.end(),
+                          [base_vertex_id, n = static_cast<vertex_t>(num_vertices)](auto v) {
+                            return !cugraph::is_valid_vertex(n, v - base_vertex_id);
+                          }),
+            0);
+  ASSERT_EQ(std::count_if(h_dst_v.begin(),
+                          h_dst_v.end(),
+                          [base_vertex_id, n = static_cast<vertex_t>(num_vertices)](auto v) {
+                            return !cugraph::is_valid_vertex(n, v - base_vertex_id);
+                          }),
+            0);
+
+  // G(n,m) edges are distinct
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(h_src_v.begin(), h_dst_v.begin()));
+  thrust::sort(thrust::host, edge_first, edge_first + h_src_v.size());
+  ASSERT_EQ(thrust::distance(edge_first,
+                             thrust::unique(thrust::host, edge_first, edge_first + h_src_v.size())),
+            static_cast<std::ptrdiff_t>(m));
+}
+
 TEST_F(GenerateErdosRenyiTest, ERTest)
 {
   er_test<int32_t>(size_t{10}, float{0.1});
   er_test<int32_t>(size_t{20}, float{0.1});
   er_test<int32_t>(size_t{50}, float{0.1});
   er_test<int32_t>(size_t{10000}, float{0.1});
+  er_test<int32_t>(size_t{100}, float{1.0});
+  er_test<int32_t>(size_t{1000000}, float{1e-6});
+  er_test<int64_t>(size_t{1000000}, float{1e-6});
+}
+
+TEST_F(GenerateErdosRenyiTest, ERGnmTest)
+{
+  er_gnm_test<int32_t>(size_t{10}, size_t{0}, int32_t{0});
+  er_gnm_test<int32_t>(size_t{10}, size_t{10}, int32_t{0});
+  er_gnm_test<int32_t>(size_t{10}, size_t{90}, int32_t{5});
+  er_gnm_test<int32_t>(size_t{10}, size_t{100}, int32_t{0});
+  er_gnm_test<int32_t>(size_t{10000}, size_t{100000}, int32_t{0});
+  er_gnm_test<int64_t>(size_t{1000000}, size_t{1000000}, int64_t{100});
 }
 
 CUGRAPH_TEST_PROGRAM_MAIN()
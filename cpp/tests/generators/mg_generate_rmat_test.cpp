@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph_generators.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct MGGenerateRmat_Usecase {
+  size_t scale{0};
+  size_t edge_factor{0};
+  bool clip_and_flip{false};
+  bool symmetrize{false};
+  bool scramble_vertex_ids{false};
+  bool store_transposed{false};
+  bool check_correctness{true};
+};
+
+class Tests_MGGenerateRmat : public ::testing::TestWithParam<MGGenerateRmat_Usecase> {
+ public:
+  Tests_MGGenerateRmat() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Check that the edges are generated on the GPUs that own them and that the aggregate edge list
+  // matches the edge list generated on a single GPU with the same seed
+  template <typename vertex_t>
+  void run_current_test(MGGenerateRmat_Usecase const& configuration)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. generate the partitioned edge list
+
+    auto num_vertices = static_cast<vertex_t>(size_t{1} << configuration.scale);
+    auto num_edges    = (size_t{1} << configuration.scale) * configuration.edge_factor;
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [d_srcs, d_dsts] =
+      cugraph::generate_partitioned_rmat_edgelist<vertex_t>(handle,
+                                                            configuration.scale,
+                                                            num_edges,
+                                                            0.57,
+                                                            0.19,
+                                                            0.19,
+                                                            uint64_t{0},
+                                                            configuration.clip_and_flip,
+                                                            configuration.scramble_vertex_ids,
+                                                            configuration.symmetrize,
+                                                            configuration.store_transposed);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "generate_partitioned_rmat_edgelist took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    ASSERT_EQ(d_srcs.size(), d_dsts.size());
+
+    if (configuration.check_correctness) {
+      auto to_host = [&handle](auto const& v) {
+        return cugraph::test::to_host(handle, v.data(), v.size());
+      };
+      auto to_sorted_edges = [](auto const& srcs, auto const& dsts) {
+        std::vector<std::tuple<vertex_t, vertex_t>> edges(srcs.size());
+        for (size_t i = 0; i < srcs.size(); ++i) {
+          edges[i] = std::make_tuple(srcs[i], dsts[i]);
+        }
+        std::sort(edges.begin(), edges.end());
+        return edges;
+      };
+
+      // 3-1. shuffling should not move any edge
+
+      rmm::device_uvector<vertex_t> d_majors(configuration.store_transposed ? d_dsts : d_srcs,
+                                             handle.get_stream());
+      rmm::device_uvector<vertex_t> d_minors(configuration.store_transposed ? d_srcs : d_dsts,
+                                             handle.get_stream());
+      std::tie(d_majors, d_minors, std::ignore) =
+        cugraph::detail::shuffle_edgelist_by_gpu_id<vertex_t, float>(
+          handle, std::move(d_majors), std::move(d_minors), std::nullopt);
+
+      auto h_srcs           = to_host(d_srcs);
+      auto h_dsts           = to_host(d_dsts);
+      auto h_edges          = to_sorted_edges(h_srcs, h_dsts);
+      auto h_shuffled_edges = configuration.store_transposed
+                                ? to_sorted_edges(to_host(d_minors), to_host(d_majors))
+                                : to_sorted_edges(to_host(d_majors), to_host(d_minors));
+      ASSERT_TRUE(h_edges == h_shuffled_edges) << "Edges are not generated on their owner GPUs.";
+
+      // 3-2. chunked shuffling (a budget of a few chunks) should not move any edge either
+
+      std::tie(d_majors, d_minors, std::ignore) =
+        cugraph::detail::shuffle_edgelist_by_gpu_id<vertex_t, float>(
+          handle,
+          std::move(d_majors),
+          std::move(d_minors),
+          std::nullopt,
+          std::optional<size_t>{d_majors.size() * sizeof(vertex_t) * 2});
+      auto h_chunk_shuffled_edges = configuration.store_transposed
+                                      ? to_sorted_edges(to_host(d_minors), to_host(d_majors))
+                                      : to_sorted_edges(to_host(d_majors), to_host(d_minors));
+      ASSERT_TRUE(h_edges == h_chunk_shuffled_edges)
+        << "Chunked shuffling moved edges generated on their owner GPUs.";
+
+      // 3-3. compare the aggregate edge list with the single-GPU edge list
+
+      auto d_aggregate_srcs = cugraph::test::device_gatherv(handle, d_srcs.data(), d_srcs.size());
+      auto d_aggregate_dsts = cugraph::test::device_gatherv(handle, d_dsts.data(), d_dsts.size());
+
+      if (comm_rank == int{0}) {
+        auto [d_sg_srcs, d_sg_dsts] =
+          cugraph::generate_rmat_edgelist<vertex_t>(handle,
+                                                    configuration.scale,
+                                                    num_edges,
+                                                    0.57,
+                                                    0.19,
+                                                    0.19,
+                                                    uint64_t{0},
+                                                    configuration.clip_and_flip);
+        if (configuration.symmetrize) {
+          std::tie(d_sg_srcs, d_sg_dsts, std::ignore) =
+            cugraph::symmetrize_edgelist_from_triangular<vertex_t, float>(
+              handle, std::move(d_sg_srcs), std::move(d_sg_dsts), std::nullopt, true);
+        }
+
+        auto h_aggregate_srcs = to_host(d_aggregate_srcs);
+        auto h_aggregate_dsts = to_host(d_aggregate_dsts);
+        auto h_sg_srcs        = to_host(d_sg_srcs);
+        auto h_sg_dsts        = to_host(d_sg_dsts);
+
+        ASSERT_EQ(h_aggregate_srcs.size(), h_sg_srcs.size());
+        ASSERT_EQ(std::count_if(h_aggregate_srcs.begin(),
+                                h_aggregate_srcs.end(),
+                                [num_vertices](auto v) {
+                                  return !cugraph::is_valid_vertex(num_vertices, v);
+                                }),
+                  0);
+        ASSERT_EQ(std::count_if(h_aggregate_dsts.begin(),
+                                h_aggregate_dsts.end(),
+                                [num_vertices](auto v) {
+                                  return !cugraph::is_valid_vertex(num_vertices, v);
+                                }),
+                  0);
+
+        if (configuration.scramble_vertex_ids) {
+          // scrambling is a permutation of the vertex IDs, compare the degree distributions
+          auto sorted_degrees = [num_vertices](auto const& vertices) {
+            std::vector<size_t> degrees(num_vertices, 0);
+            std::for_each(vertices.begin(), vertices.end(), [&degrees](auto v) { degrees[v]++; });
+            std::sort(degrees.begin(), degrees.end());
+            return degrees;
+          };
+          ASSERT_TRUE(sorted_degrees(h_aggregate_srcs) == sorted_degrees(h_sg_srcs));
+          ASSERT_TRUE(sorted_degrees(h_aggregate_dsts) == sorted_degrees(h_sg_dsts));
+        } else {
+          ASSERT_TRUE(to_sorted_edges(h_aggregate_srcs, h_aggregate_dsts) ==
+                      to_sorted_edges(h_sg_srcs, h_sg_dsts))
+            << "The aggregate edge list does not match with the single-GPU edge list.";
+        }
+      }
+    }
+  }
+};
+
+TEST_P(Tests_MGGenerateRmat, CheckInt32) { run_current_test<int32_t>(GetParam()); }
+
+TEST_P(Tests_MGGenerateRmat, CheckInt64) { run_current_test<int64_t>(GetParam()); }
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_MGGenerateRmat,
+  ::testing::Values(MGGenerateRmat_Usecase{10, 16, false, false, false, false},
+                    MGGenerateRmat_Usecase{10, 16, false, false, false, true},
+                    MGGenerateRmat_Usecase{10, 16, true, true, false, false},
+                    MGGenerateRmat_Usecase{10, 16, true, true, false, true},
+                    MGGenerateRmat_Usecase{12, 16, false, false, true, false},
+                    MGGenerateRmat_Usecase{12, 16, true, true, true, false}));
+
+INSTANTIATE_TEST_SUITE_P(
+  benchmark_test, /* note that the weak-scaling benchmarks should be run with the same scale per
+                     GPU, this (fixed) usecase is for quick performance checks */
+  Tests_MGGenerateRmat,
+  ::testing::Values(MGGenerateRmat_Usecase{24, 16, true, true, true, false, false}));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+struct ForceAtlas2_Usecase {
+  size_t max_iter{20};
+  bool multilevel{false};
+  bool check_correctness{true};
+};
+
+// distinct starting positions derived from the (unrenumbered) vertex IDs, so the SG & MG runs start
+// from the same layout
+template <typename vertex_t>
+void starting_positions(std::vector<vertex_t> const& labels,
+                        std::vector<float>& xs,
+                        std::vector<float>& ys)
+{
+  xs.resize(labels.size());
+  ys.resize(labels.size());
+  for (size_t i = 0; i < labels.size(); ++i) {
+    auto v = static_cast<int64_t>(labels[i]);
+    xs[i]  = static_cast<float>(v % 101) * 2.0f - 100.0f + static_cast<float>(v / 101) * 0.01f;
+    ys[i]  = static_cast<float>((v * 37) % 103) * 2.0f - 100.0f;
+  }
+}
+
+template <typename input_usecase_t>
+class Tests_MGForceAtlas2
+  : public ::testing::TestWithParam<std::tuple<ForceAtlas2_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGForceAtlas2() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of running ForceAtlas2 on multiple GPUs to that of a single-GPU run
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(ForceAtlas2_Usecase const& fa2_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run MG ForceAtlas2
+
+    std::vector<vertex_t> h_mg_labels((*d_mg_renumber_map_labels).size());
+    raft::update_host(h_mg_labels.data(),
+                      (*d_mg_renumber_map_labels).data(),
+                      (*d_mg_renumber_map_labels).size(),
+                      handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    std::vector<float> h_mg_x_start{};
+    std::vector<float> h_mg_y_start{};
+    starting_positions(h_mg_labels, h_mg_x_start, h_mg_y_start);
+    rmm::device_uvector<float> d_mg_x_start(h_mg_x_start.size(), handle.get_stream());
+    rmm::device_uvector<float> d_mg_y_start(h_mg_y_start.size(), handle.get_stream());
+    raft::update_device(
+      d_mg_x_start.data(), h_mg_x_start.data(), h_mg_x_start.size(), handle.get_stream());
+    raft::update_device(
+      d_mg_y_start.data(), h_mg_y_start.data(), h_mg_y_start.size(), handle.get_stream());
+
+    rmm::device_uvector<float> d_mg_x_pos(mg_graph_view.get_number_of_local_vertices(),
+                                          handle.get_stream());
+    rmm::device_uvector<float> d_mg_y_pos(mg_graph_view.get_number_of_local_vertices(),
+                                          handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    if (fa2_usecase.multilevel) {
+      cugraph::multilevel_force_atlas2(handle,
+                                       mg_graph_view,
+                                       d_mg_x_pos.data(),
+                                       d_mg_y_pos.data(),
+                                       fa2_usecase.max_iter,
+                                       fa2_usecase.max_iter / 10);
+    } else {
+      cugraph::force_atlas2(handle,
+                            mg_graph_view,
+                            d_mg_x_pos.data(),
+                            d_mg_y_pos.data(),
+                            fa2_usecase.max_iter,
+                            std::make_optional<float const*>(d_mg_x_start.data()),
+                            std::make_optional<float const*>(d_mg_y_start.data()));
+    }
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG ForceAtlas2 took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. compare SG & MG results
+
+    if (fa2_usecase.check_correctness) {
+      // 4-1. aggregate MG results
+
+      auto d_mg_aggregate_renumber_map_labels = cugraph::test::device_gatherv(
+        handle, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+      auto d_mg_aggregate_x_pos =
+        cugraph::test::device_gatherv(handle, d_mg_x_pos.data(), d_mg_x_pos.size());
+      auto d_mg_aggregate_y_pos =
+        cugraph::test::device_gatherv(handle, d_mg_y_pos.data(), d_mg_y_pos.size());
+
+      if (fa2_usecase.multilevel) {
+        // the clusterings (and hence the layouts) depend on the number of GPUs, check the MG
+        // layout is finite and non-degenerate only
+        if (handle.get_comms().get_rank() == int{0}) {
+          std::vector<float> h_mg_x_pos(d_mg_aggregate_x_pos.size());
+          std::vector<float> h_mg_y_pos(d_mg_aggregate_y_pos.size());
+          raft::update_host(h_mg_x_pos.data(),
+                            d_mg_aggregate_x_pos.data(),
+                            d_mg_aggregate_x_pos.size(),
+                            handle.get_stream());
+          raft::update_host(h_mg_y_pos.data(),
+                            d_mg_aggregate_y_pos.data(),
+                            d_mg_aggregate_y_pos.size(),
+                            handle.get_stream());
+          handle.get_stream_view().synchronize();
+          ASSERT_TRUE(std::all_of(h_mg_x_pos.begin(), h_mg_x_pos.end(), [](auto x) {
+            return std::isfinite(x);
+          }));
+          ASSERT_TRUE(std::all_of(h_mg_y_pos.begin(), h_mg_y_pos.end(), [](auto y) {
+            return std::isfinite(y);
+          }));
+          ASSERT_TRUE(*std::max_element(h_mg_x_pos.begin(), h_mg_x_pos.end()) >
+                      *std::min_element(h_mg_x_pos.begin(), h_mg_x_pos.end()));
+        }
+        return;
+      }
+
+      if (handle.get_comms().get_rank() == int{0}) {
+        // 4-2. unrenumber MG results
+
+        std::tie(std::ignore, d_mg_aggregate_x_pos) = cugraph::test::sort_by_key(
+          handle, d_mg_aggregate_renumber_map_labels, d_mg_aggregate_x_pos);
+        std::tie(std::ignore, d_mg_aggregate_y_pos) = cugraph::test::sort_by_key(
+          handle, d_mg_aggregate_renumber_map_labels, d_mg_aggregate_y_pos);
+
+        // 4-3. create SG graph
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, false, false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_TRUE(mg_graph_view.get_number_of_vertices() ==
+                    sg_graph_view.get_number_of_vertices());
+
+        // 4-4. run SG ForceAtlas2
+
+        std::vector<vertex_t> h_sg_labels(sg_graph_view.get_number_of_vertices());
+        std::iota(h_sg_labels.begin(), h_sg_labels.end(), vertex_t{0});
+        std::vector<float> h_sg_x_start{};
+        std::vector<float> h_sg_y_start{};
+        starting_positions(h_sg_labels, h_sg_x_start, h_sg_y_start);
+        rmm::device_uvector<float> d_sg_x_start(h_sg_x_start.size(), handle.get_stream());
+        rmm::device_uvector<float> d_sg_y_start(h_sg_y_start.size(), handle.get_stream());
+        raft::update_device(
+          d_sg_x_start.data(), h_sg_x_start.data(), h_sg_x_start.size(), handle.get_stream());
+        raft::update_device(
+          d_sg_y_start.data(), h_sg_y_start.data(), h_sg_y_start.size(), handle.get_stream());
+
+        rmm::device_uvector<float> d_sg_x_pos(sg_graph_view.get_number_of_vertices(),
+                                              handle.get_stream());
+        rmm::device_uvector<float> d_sg_y_pos(sg_graph_view.get_number_of_vertices(),
+                                              handle.get_stream());
+
+        cugraph::force_atlas2(handle,
+                              sg_graph_view,
+                              d_sg_x_pos.data(),
+                              d_sg_y_pos.data(),
+                              fa2_usecase.max_iter,
+                              std::make_optional<float const*>(d_sg_x_start.data()),
+                              std::make_optional<float const*>(d_sg_y_start.data()));
+
+        // 4-5. compare
+
+        auto num_vertices = static_cast<size_t>(sg_graph_view.get_number_of_vertices());
+        std::vector<float> h_mg_x_pos(num_vertices);
+        std::vector<float> h_mg_y_pos(num_vertices);
+        std::vector<float> h_sg_x_pos(num_vertices);
+        std::vector<float> h_sg_y_pos(num_vertices);
+        raft::update_host(
+          h_mg_x_pos.data(), d_mg_aggregate_x_pos.data(), num_vertices, handle.get_stream());
+        raft::update_host(
+          h_mg_y_pos.data(), d_mg_aggregate_y_pos.data(), num_vertices, handle.get_stream());
+        raft::update_host(h_sg_x_pos.data(), d_sg_x_pos.data(), num_vertices, handle.get_stream());
+        raft::update_host(h_sg_y_pos.data(), d_sg_y_pos.data(), num_vertices, handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        // the force sums are reduced in different orders, so compare relative to the layout extent
+        auto x_extent = *std::max_element(h_sg_x_pos.begin(), h_sg_x_pos.end()) -
+                        *std::min_element(h_sg_x_pos.begin(), h_sg_x_pos.end());
+        auto y_extent = *std::max_element(h_sg_y_pos.begin(), h_sg_y_pos.end()) -
+                        *std::min_element(h_sg_y_pos.begin(), h_sg_y_pos.end());
+        auto threshold = std::max(x_extent, y_extent) * 1e-2;
+        for (size_t i = 0; i < num_vertices; ++i) {
+          ASSERT_TRUE(std::isfinite(h_mg_x_pos[i]) && std::isfinite(h_mg_y_pos[i]));
+          ASSERT_TRUE(std::abs(h_mg_x_pos[i] - h_sg_x_pos[i]) < threshold)
+            << "vertex " << i << " x: MG " << h_mg_x_pos[i] << ", SG " << h_sg_x_pos[i];
+          ASSERT_TRUE(std::abs(h_mg_y_pos[i] - h_sg_y_pos[i]) < threshold)
+            << "vertex " << i << " y: MG " << h_mg_y_pos[i] << ", SG " << h_sg_y_pos[i];
+        }
+      }
+    }
+  }
+};
+
+using Tests_MGForceAtlas2_File = Tests_MGForceAtlas2<cugraph::test::File_Usecase>;
+using Tests_MGForceAtlas2_Rmat = Tests_MGForceAtlas2<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGForceAtlas2_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGForceAtlas2_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGForceAtlas2_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGForceAtlas2_File,
+  ::testing::Combine(::testing::Values(ForceAtlas2_Usecase{20, false, true},
+                                       ForceAtlas2_Usecase{100, true, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(rmat_small_test,
+                         Tests_MGForceAtlas2_Rmat,
+                         ::testing::Combine(::testing::Values(ForceAtlas2_Usecase{20, false, true},
+                                                              ForceAtlas2_Usecase{100, true, true}),
+                                            ::testing::Values(cugraph::test::Rmat_Usecase(
+                                              8, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGForceAtlas2_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(ForceAtlas2_Usecase{500, false, false},
+                      ForceAtlas2_Usecase{500, true, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
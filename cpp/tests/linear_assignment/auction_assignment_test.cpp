@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+// workers are [0, num_workers) and jobs are [num_workers, 2 * num_workers); every worker has an
+// edge to a job of a random permutation (so a complete assignment exists) and edges_per_worker
+// random jobs, the weights are integers in [1, 100]
+template <typename vertex_t, typename weight_t>
+void generate_bipartite_edgelist(size_t num_workers,
+                                 size_t edges_per_worker,
+                                 uint64_t seed,
+                                 std::vector<vertex_t>& h_srcs,
+                                 std::vector<vertex_t>& h_dsts,
+                                 std::vector<weight_t>& h_weights)
+{
+  std::mt19937_64 gen(seed);
+  std::vector<vertex_t> perm(num_workers);
+  std::iota(perm.begin(), perm.end(), vertex_t{0});
+  std::shuffle(perm.begin(), perm.end(), gen);
+  std::uniform_int_distribution<size_t> job_dist(0, num_workers - 1);
+  std::uniform_int_distribution<int> weight_dist(1, 100);
+
+  h_srcs.clear();
+  h_dsts.clear();
+  h_weights.clear();
+  for (size_t i = 0; i < num_workers; ++i) {
+    std::set<size_t> jobs{static_cast<size_t>(perm[i])};
+    for (size_t j = 0; j < edges_per_worker; ++j) {
+      jobs.insert(job_dist(gen));
+    }
+    for (auto job : jobs) {
+      h_srcs.push_back(static_cast<vertex_t>(i));
+      h_dsts.push_back(static_cast<vertex_t>(num_workers + job));
+      h_weights.push_back(static_cast<weight_t>(weight_dist(gen)));
+    }
+  }
+}
+
+// O(n^3) Hungarian algorithm with potentials on the dense cost matrix (missing edges cost more
+// than any complete assignment using the existing edges)
+template <typename vertex_t, typename weight_t>
+double auction_assignment_reference(size_t num_workers,
+                                    std::vector<vertex_t> const& h_srcs,
+                                    std::vector<vertex_t> const& h_dsts,
+                                    std::vector<weight_t> const& h_weights)
+{
+  auto n = num_workers;
+  std::vector<double> costs(n * n, 1e3 * (n + 1));
+  for (size_t i = 0; i < h_srcs.size(); ++i) {
+    costs[h_srcs[i] * n + (h_dsts[i] - n)] = static_cast<double>(h_weights[i]);
+  }
+
+  auto inf = std::numeric_limits<double>::max();
+  std::vector<double> u(n + 1, 0.0);
+  std::vector<double> v(n + 1, 0.0);
+  std::vector<size_t> p(n + 1, 0);
+  std::vector<size_t> way(n + 1, 0);
+  for (size_t i = 1; i <= n; ++i) {
+    p[0]    = i;
+    size_t j0{0};
+    std::vector<double> minv(n + 1, inf);
+    std::vector<bool> used(n + 1, false);
+    do {
+      used[j0] = true;
+      auto i0  = p[j0];
+      auto delta{inf};
+      size_t j1{0};
+      for (size_t j = 1; j <= n; ++j) {
+        if (!used[j]) {
+          auto cur = costs[(i0 - 1) * n + (j - 1)] - u[i0] - v[j];
+          if (cur < minv[j]) {
+            minv[j] = cur;
+            way[j]  = j0;
+          }
+          if (minv[j] < delta) {
+            delta = minv[j];
+            j1    = j;
+          }
+        }
+      }
+      for (size_t j = 0; j <= n; ++j) {
+        if (used[j]) {
+          u[p[j]] += delta;
+          v[j] -= delta;
+        } else {
+          minv[j] -= delta;
+        }
+      }
+      j0 = j1;
+    } while (p[j0] != 0);
+    do {
+      auto j1 = way[j0];
+      p[j0]   = p[j1];
+      j0      = j1;
+    } while (j0 != 0);
+  }
+
+  double total{0.0};
+  for (size_t j = 1; j <= n; ++j) {
+    total += costs[(p[j] - 1) * n + (j - 1)];
+  }
+  return total;
+}
+
+struct AuctionAssignment_Usecase {
+  size_t num_workers{0};
+  size_t edges_per_worker{0};
+  uint64_t seed{0};
+  bool check_correctness{true};
+};
+
+class Tests_AuctionAssignment : public ::testing::TestWithParam<AuctionAssignment_Usecase> {
+ public:
+  Tests_AuctionAssignment() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(AuctionAssignment_Usecase const& auction_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto num_workers = static_cast<vertex_t>(auction_usecase.num_workers);
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    std::vector<weight_t> h_weights{};
+    generate_bipartite_edgelist(auction_usecase.num_workers,
+                                auction_usecase.edges_per_worker,
+                                auction_usecase.seed,
+                                h_srcs,
+                                h_dsts,
+                                h_weights);
+
+    rmm::device_uvector<vertex_t> d_vertices(2 * num_workers, handle.get_stream());
+    cugraph::detail::sequence_fill(
+      handle.get_stream_view(), d_vertices.data(), d_vertices.size(), vertex_t{0});
+    rmm::device_uvector<vertex_t> d_srcs(h_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dsts(h_dsts.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> d_weights(h_weights.size(), handle.get_stream());
+    raft::update_device(d_srcs.data(), h_srcs.data(), h_srcs.size(), handle.get_stream());
+    raft::update_device(d_dsts.data(), h_dsts.data(), h_dsts.size(), handle.get_stream());
+    raft::update_device(d_weights.data(), h_weights.data(), h_weights.size(), handle.get_stream());
+
+    cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) =
+      cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+        handle,
+        std::optional<rmm::device_uvector<vertex_t>>{std::move(d_vertices)},
+        std::move(d_srcs),
+        std::move(d_dsts),
+        std::optional<rmm::device_uvector<weight_t>>{std::move(d_weights)},
+        cugraph::graph_properties_t{false, false},
+        false);
+    auto graph_view = graph.view();
+
+    rmm::device_uvector<vertex_t> d_workers(num_workers, handle.get_stream());
+    cugraph::detail::sequence_fill(
+      handle.get_stream_view(), d_workers.data(), d_workers.size(), vertex_t{0});
+    rmm::device_uvector<vertex_t> d_assignments(num_workers, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto total_cost = cugraph::auction_assignment(
+      handle, graph_view, d_workers.data(), num_workers, d_assignments.data());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "auction_assignment took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (auction_usecase.check_correctness) {
+      std::vector<vertex_t> h_assignments(num_workers);
+      raft::update_host(
+        h_assignments.data(), d_assignments.data(), d_assignments.size(), handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      // the assignment should be complete, one to one, and use the existing edges
+
+      std::vector<bool> assigned(num_workers, false);
+      double assigned_cost{0.0};
+      for (vertex_t i = 0; i < num_workers; ++i) {
+        auto job = h_assignments[i];
+        ASSERT_TRUE((job >= num_workers) && (job < 2 * num_workers))
+          << "worker " << i << " is not assigned to a job.";
+        ASSERT_FALSE(assigned[job - num_workers]) << "job " << job << " is assigned twice.";
+        assigned[job - num_workers] = true;
+
+        size_t e{0};
+        while ((e < h_srcs.size()) && ((h_srcs[e] != i) || (h_dsts[e] != job))) {
+          ++e;
+        }
+        ASSERT_TRUE(e < h_srcs.size()) << "worker " << i << " is assigned to a non-neighbor.";
+        assigned_cost += static_cast<double>(h_weights[e]);
+      }
+      ASSERT_EQ(assigned_cost, static_cast<double>(total_cost))
+        << "the returned total cost does not match the assignment.";
+
+      auto reference_cost = auction_assignment_reference(
+        auction_usecase.num_workers, h_srcs, h_dsts, h_weights);
+      ASSERT_EQ(assigned_cost, reference_cost)
+        << "the total cost does not match with the reference value.";
+    }
+  }
+};
+
+TEST_P(Tests_AuctionAssignment, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_AuctionAssignment, CheckInt32Int64Float)
+{
+  run_current_test<int32_t, int64_t, float>(GetParam());
+}
+
+TEST_P(Tests_AuctionAssignment, CheckInt64Int64Double)
+{
+  run_current_test<int64_t, int64_t, double>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(simple_test,
+                         Tests_AuctionAssignment,
+                         ::testing::Values(AuctionAssignment_Usecase{4, 2, 0},
+                                           AuctionAssignment_Usecase{64, 4, 1},
+                                           AuctionAssignment_Usecase{500, 8, 2},
+                                           AuctionAssignment_Usecase{500, 0, 3}));
+
+INSTANTIATE_TEST_SUITE_P(benchmark_test,
+                         Tests_AuctionAssignment,
+                         ::testing::Values(AuctionAssignment_Usecase{1 << 20, 16, 0, false}));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -278,6 +278,52 @@ TEST_F(HungarianTest, Dense6x4)
               std::equal(assignment.begin(), assignment.end(), expected2.begin()));
 }
 
+TEST_F(HungarianTest, DenseBatch4x6)
+{
+  raft::handle_t handle{};
+
+  int32_t num_problems = 3;
+  int32_t num_rows     = 4;
+  int32_t num_cols     = 6;
+  float cost[]         = {0,  16, 1,    0,    90, 100, 33, 45, 0,    4,    90, 100,
+                  22, 0,  1000, 2000, 90, 100, 2,  0,  3000, 4000, 90, 100};
+
+  // problem b is the Dense4x6 problem with every cost scaled by (b + 1)
+  std::vector<float> batch_cost(num_problems * num_rows * num_cols);
+  for (int32_t b = 0; b < num_problems; ++b) {
+    for (int32_t i = 0; i < num_rows * num_cols; ++i) {
+      batch_cost[b * num_rows * num_cols + i] = cost[i] * (b + 1);
+    }
+  }
+
+  std::vector<float> expected_costs({2, 4, 6});
+  std::vector<int32_t> expected({3, 2, 1, 0, 3, 2, 1, 0, 3, 2, 1, 0});
+  std::vector<float> costs(num_problems, 0);
+  std::vector<int32_t> assignment(num_problems * num_rows, 0);
+
+  rmm::device_uvector<float> cost_v(batch_cost.size(), handle.get_stream_view());
+  rmm::device_uvector<int32_t> assignment_v(assignment.size(), handle.get_stream_view());
+  rmm::device_uvector<float> objective_v(num_problems, handle.get_stream_view());
+
+  raft::update_device(cost_v.begin(), batch_cost.data(), batch_cost.size(), handle.get_stream());
+
+  cugraph::dense::hungarian_batch(handle,
+                                  cost_v.data(),
+                                  num_problems,
+                                  num_rows,
+                                  num_cols,
+                                  assignment_v.data(),
+                                  objective_v.data());
+
+  raft::update_host(
+    assignment.data(), assignment_v.data(), assignment_v.size(), handle.get_stream());
+  raft::update_host(costs.data(), objective_v.data(), objective_v.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  EXPECT_EQ(costs, expected_costs);
+  EXPECT_EQ(assignment, expected);
+}
+
 TEST_F(HungarianTest, PythonTestFailure)
 {
   raft::handle_t handle{};
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+// workers are [0, num_workers) and jobs are [num_workers, 2 * num_workers); every worker has an
+// edge to a job of a random permutation (so a complete assignment exists) and edges_per_worker
+// random jobs, the weights are integers in [1, 100]
+template <typename vertex_t, typename weight_t>
+void generate_bipartite_edgelist(size_t num_workers,
+                                 size_t edges_per_worker,
+                                 uint64_t seed,
+                                 std::vector<vertex_t>& h_srcs,
+                                 std::vector<vertex_t>& h_dsts,
+                                 std::vector<weight_t>& h_weights)
+{
+  std::mt19937_64 gen(seed);
+  std::vector<vertex_t> perm(num_workers);
+  std::iota(perm.begin(), perm.end(), vertex_t{0});
+  std::shuffle(perm.begin(), perm.end(), gen);
+  std::uniform_int_distribution<size_t> job_dist(0, num_workers - 1);
+  std::uniform_int_distribution<int> weight_dist(1, 100);
+
+  h_srcs.clear();
+  h_dsts.clear();
+  h_weights.clear();
+  for (size_t i = 0; i < num_workers; ++i) {
+    std::set<size_t> jobs{static_cast<size_t>(perm[i])};
+    for (size_t j = 0; j < edges_per_worker; ++j) {
+      jobs.insert(job_dist(gen));
+    }
+    for (auto job : jobs) {
+      h_srcs.push_back(static_cast<vertex_t>(i));
+      h_dsts.push_back(static_cast<vertex_t>(num_workers + job));
+      h_weights.push_back(static_cast<weight_t>(weight_dist(gen)));
+    }
+  }
+}
+
+// O(n^3) Hungarian algorithm with potentials on the dense cost matrix (missing edges cost more
+// than any complete assignment using the existing edges)
+template <typename vertex_t, typename weight_t>
+double auction_assignment_reference(size_t num_workers,
+                                    std::vector<vertex_t> const& h_srcs,
+                                    std::vector<vertex_t> const& h_dsts,
+                                    std::vector<weight_t> const& h_weights)
+{
+  auto n = num_workers;
+  std::vector<double> costs(n * n, 1e3 * (n + 1));
+  for (size_t i = 0; i < h_srcs.size(); ++i) {
+    costs[h_srcs[i] * n + (h_dsts[i] - n)] = static_cast<double>(h_weights[i]);
+  }
+
+  auto inf = std::numeric_limits<double>::max();
+  std::vector<double> u(n + 1, 0.0);
+  std::vector<double> v(n + 1, 0.0);
+  std::vector<size_t> p(n + 1, 0);
+  std::vector<size_t> way(n + 1, 0);
+  for (size_t i = 1; i <= n; ++i) {
+    p[0]    = i;
+    size_t j0{0};
+    std::vector<double> minv(n + 1, inf);
+    std::vector<bool> used(n + 1, false);
+    do {
+      used[j0] = true;
+      auto i0  = p[j0];
+      auto delta{inf};
+      size_t j1{0};
+      for (size_t j = 1; j <= n; ++j) {
+        if (!used[j]) {
+          auto cur = costs[(i0 - 1) * n + (j - 1)] - u[i0] - v[j];
+          if (cur < minv[j]) {
+            minv[j] = cur;
+            way[j]  = j0;
+          }
+          if (minv[j] < delta) {
+            delta = minv[j];
+            j1    = j;
+          }
+        }
+      }
+      for (size_t j = 0; j <= n; ++j) {
+        if (used[j]) {
+          u[p[j]] += delta;
+          v[j] -= delta;
+        } else {
+          minv[j] -= delta;
+        }
+      }
+      j0 = j1;
+    } while (p[j0] != 0);
+    do {
+      auto j1 = way[j0];
+      p[j0]   = p[j1];
+      j0      = j1;
+    } while (j0 != 0);
+  }
+
+  double total{0.0};
+  for (size_t j = 1; j <= n; ++j) {
+    total += costs[(p[j] - 1) * n + (j - 1)];
+  }
+  return total;
+}
+
+struct AuctionAssignment_Usecase {
+  size_t num_workers{0};
+  size_t edges_per_worker{0};
+  uint64_t seed{0};
+  bool check_correctness{true};
+};
+
+class Tests_MGAuctionAssignment : public ::testing::TestWithParam<AuctionAssignment_Usecase> {
+ public:
+  Tests_MGAuctionAssignment() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the total cost of the multi-GPU assignment to the optimal cost (the weights are
+  // integers, so the auction returns an optimal assignment)
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(AuctionAssignment_Usecase const& auction_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph (every GPU generates the same edge list and keeps a slice of it)
+
+    auto num_workers = static_cast<vertex_t>(auction_usecase.num_workers);
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    std::vector<weight_t> h_weights{};
+    generate_bipartite_edgelist(auction_usecase.num_workers,
+                                auction_usecase.edges_per_worker,
+                                auction_usecase.seed,
+                                h_srcs,
+                                h_dsts,
+                                h_weights);
+
+    std::vector<vertex_t> h_local_srcs{};
+    std::vector<vertex_t> h_local_dsts{};
+    std::vector<weight_t> h_local_weights{};
+    for (size_t i = comm_rank; i < h_srcs.size(); i += comm_size) {
+      h_local_srcs.push_back(h_srcs[i]);
+      h_local_dsts.push_back(h_dsts[i]);
+      h_local_weights.push_back(h_weights[i]);
+    }
+    std::vector<vertex_t> h_local_vertices{};
+    for (vertex_t v = comm_rank; v < 2 * num_workers; v += comm_size) {
+      h_local_vertices.push_back(v);
+    }
+
+    rmm::device_uvector<vertex_t> d_vertices(h_local_vertices.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_srcs(h_local_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dsts(h_local_dsts.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> d_weights(h_local_weights.size(), handle.get_stream());
+    raft::update_device(
+      d_vertices.data(), h_local_vertices.data(), h_local_vertices.size(), handle.get_stream());
+    raft::update_device(
+      d_srcs.data(), h_local_srcs.data(), h_local_srcs.size(), handle.get_stream());
+    raft::update_device(
+      d_dsts.data(), h_local_dsts.data(), h_local_dsts.size(), handle.get_stream());
+    raft::update_device(
+      d_weights.data(), h_local_weights.data(), h_local_weights.size(), handle.get_stream());
+
+    std::optional<rmm::device_uvector<weight_t>> d_optional_weights{std::move(d_weights)};
+    std::tie(d_srcs, d_dsts, d_optional_weights) = cugraph::detail::shuffle_edgelist_by_gpu_id(
+      handle, std::move(d_srcs), std::move(d_dsts), std::move(d_optional_weights));
+    d_vertices = cugraph::detail::shuffle_vertices_by_gpu_id(handle, std::move(d_vertices));
+
+    cugraph::graph_t<vertex_t, edge_t, weight_t, false, true> mg_graph(handle);
+    std::optional<rmm::device_uvector<vertex_t>> d_mg_renumber_map_labels{std::nullopt};
+    std::tie(mg_graph, d_mg_renumber_map_labels) =
+      cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, true>(
+        handle,
+        std::optional<rmm::device_uvector<vertex_t>>{std::move(d_vertices)},
+        std::move(d_srcs),
+        std::move(d_dsts),
+        std::move(d_optional_weights),
+        cugraph::graph_properties_t{false, false},
+        true);
+    auto mg_graph_view = mg_graph.view();
+
+    // the workers are the local vertices with (original) vertex IDs smaller than num_workers
+
+    std::vector<vertex_t> h_renumber_map_labels((*d_mg_renumber_map_labels).size());
+    raft::update_host(h_renumber_map_labels.data(),
+                      (*d_mg_renumber_map_labels).data(),
+                      (*d_mg_renumber_map_labels).size(),
+                      handle.get_stream());
+    handle.get_stream_view().synchronize();
+    std::vector<vertex_t> h_workers{};
+    for (size_t i = 0; i < h_renumber_map_labels.size(); ++i) {
+      if (h_renumber_map_labels[i] < num_workers) {
+        h_workers.push_back(mg_graph_view.get_local_vertex_first() + static_cast<vertex_t>(i));
+      }
+    }
+    rmm::device_uvector<vertex_t> d_workers(h_workers.size(), handle.get_stream());
+    raft::update_device(d_workers.data(), h_workers.data(), h_workers.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_assignments(h_workers.size(), handle.get_stream());
+
+    // 3. run MG auction assignment
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto total_cost = cugraph::auction_assignment(handle,
+                                                  mg_graph_view,
+                                                  d_workers.data(),
+                                                  static_cast<vertex_t>(d_workers.size()),
+                                                  d_assignments.data());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG auction_assignment took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. compare with the reference
+
+    if (auction_usecase.check_correctness) {
+      auto d_mg_aggregate_assignments =
+        cugraph::test::device_gatherv(handle, d_assignments.data(), d_assignments.size());
+
+      if (handle.get_comms().get_rank() == int{0}) {
+        std::vector<vertex_t> h_mg_aggregate_assignments(d_mg_aggregate_assignments.size());
+        raft::update_host(h_mg_aggregate_assignments.data(),
+                          d_mg_aggregate_assignments.data(),
+                          d_mg_aggregate_assignments.size(),
+                          handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        ASSERT_EQ(h_mg_aggregate_assignments.size(), static_cast<size_t>(num_workers));
+        ASSERT_TRUE(std::none_of(h_mg_aggregate_assignments.begin(),
+                                 h_mg_aggregate_assignments.end(),
+                                 [](auto job) {
+                                   return job == cugraph::invalid_vertex_id<vertex_t>::value;
+                                 }))
+          << "every worker should be assigned.";
+        std::sort(h_mg_aggregate_assignments.begin(), h_mg_aggregate_assignments.end());
+        ASSERT_TRUE(std::adjacent_find(h_mg_aggregate_assignments.begin(),
+                                       h_mg_aggregate_assignments.end()) ==
+                    h_mg_aggregate_assignments.end())
+          << "a job is assigned to more than one worker.";
+
+        auto reference_cost = auction_assignment_reference(
+          auction_usecase.num_workers, h_srcs, h_dsts, h_weights);
+        ASSERT_EQ(static_cast<double>(total_cost), reference_cost)
+          << "the total cost does not match with the reference value.";
+      }
+    }
+  }
+};
+
+TEST_P(Tests_MGAuctionAssignment, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_MGAuctionAssignment, CheckInt32Int64Float)
+{
+  run_current_test<int32_t, int64_t, float>(GetParam());
+}
+
+TEST_P(Tests_MGAuctionAssignment, CheckInt64Int64Double)
+{
+  run_current_test<int64_t, int64_t, double>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(simple_test,
+                         Tests_MGAuctionAssignment,
+                         ::testing::Values(AuctionAssignment_Usecase{64, 4, 1},
+                                           AuctionAssignment_Usecase{500, 8, 2}));
+
+INSTANTIATE_TEST_SUITE_P(benchmark_test,
+                         Tests_MGAuctionAssignment,
+                         ::testing::Values(AuctionAssignment_Usecase{1 << 20, 16, 0, false}));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
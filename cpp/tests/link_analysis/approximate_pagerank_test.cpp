@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+struct ApproximatePageRank_Usecase {
+  size_t num_personalization_vertices{1};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ApproximatePageRank
+  : public ::testing::TestWithParam<std::tuple<ApproximatePageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_ApproximatePageRank() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(ApproximatePageRank_Usecase const& pagerank_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, pagerank_usecase.test_weighted, false);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+
+    std::default_random_engine generator{};
+    std::uniform_int_distribution<vertex_t> vertex_distribution{0, num_vertices - 1};
+    std::uniform_real_distribution<double> value_distribution{0.0, 1.0};
+    std::vector<vertex_t> h_personalization_vertices(
+      std::min(pagerank_usecase.num_personalization_vertices, static_cast<size_t>(num_vertices)));
+    std::vector<vertex_t> h_candidates(num_vertices);
+    std::iota(h_candidates.begin(), h_candidates.end(), vertex_t{0});
+    std::shuffle(h_candidates.begin(), h_candidates.end(), generator);
+    std::copy(h_candidates.begin(),
+              h_candidates.begin() + h_personalization_vertices.size(),
+              h_personalization_vertices.begin());
+    std::vector<result_t> h_personalization_values(h_personalization_vertices.size());
+    std::for_each(h_personalization_values.begin(),
+                  h_personalization_values.end(),
+                  [&value_distribution, &generator](auto& val) {
+                    val = static_cast<result_t>(value_distribution(generator)) + result_t{0.1};
+                  });
+
+    rmm::device_uvector<vertex_t> d_personalization_vertices(h_personalization_vertices.size(),
+                                                             handle.get_stream());
+    rmm::device_uvector<result_t> d_personalization_values(h_personalization_values.size(),
+                                                           handle.get_stream());
+    raft::update_device(d_personalization_vertices.data(),
+                        h_personalization_vertices.data(),
+                        h_personalization_vertices.size(),
+                        handle.get_stream());
+    raft::update_device(d_personalization_values.data(),
+                        h_personalization_values.data(),
+                        h_personalization_values.size(),
+                        handle.get_stream());
+
+    auto d_out_weight_sums = graph_view.compute_out_weight_sums(handle);
+    std::vector<weight_t> h_out_weight_sums(d_out_weight_sums.size());
+    raft::update_host(h_out_weight_sums.data(),
+                      d_out_weight_sums.data(),
+                      d_out_weight_sums.size(),
+                      handle.get_stream());
+    handle.get_stream_view().synchronize();
+    auto total_weight =
+      std::accumulate(h_out_weight_sums.begin(), h_out_weight_sums.end(), double{0.0});
+
+    result_t constexpr alpha{0.85};
+    double constexpr residual_sum_bound{1e-3};
+    // bounds the sum of the residuals by residual_sum_bound
+    auto epsilon = static_cast<result_t>(residual_sum_bound / total_weight);
+
+    rmm::device_uvector<result_t> d_pageranks(num_vertices, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::approximate_personalized_pagerank(
+      handle,
+      graph_view,
+      std::optional<weight_t const*>{d_out_weight_sums.data()},
+      d_personalization_vertices.data(),
+      d_personalization_values.data(),
+      static_cast<vertex_t>(d_personalization_vertices.size()),
+      d_pageranks.data(),
+      alpha,
+      epsilon,
+      std::numeric_limits<size_t>::max(),
+      true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "approximate personalized PageRank took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (pagerank_usecase.check_correctness) {
+      auto [transposed_graph, d_transposed_renumber_map_labels] =
+        cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+          handle, input_usecase, pagerank_usecase.test_weighted, false);
+      auto transposed_graph_view = transposed_graph.view();
+
+      rmm::device_uvector<result_t> d_reference_pageranks(num_vertices, handle.get_stream());
+      cugraph::pagerank<vertex_t, edge_t, weight_t>(
+        handle,
+        transposed_graph_view,
+        std::nullopt,
+        std::optional<vertex_t const*>{d_personalization_vertices.data()},
+        std::optional<result_t const*>{d_personalization_values.data()},
+        std::optional<vertex_t>{static_cast<vertex_t>(d_personalization_vertices.size())},
+        d_reference_pageranks.data(),
+        alpha,
+        result_t{1e-6},
+        std::numeric_limits<size_t>::max(),
+        false,
+        false);
+
+      std::vector<result_t> h_cugraph_pageranks(num_vertices);
+      std::vector<result_t> h_reference_pageranks(num_vertices);
+      raft::update_host(
+        h_cugraph_pageranks.data(), d_pageranks.data(), d_pageranks.size(), handle.get_stream());
+      raft::update_host(h_reference_pageranks.data(),
+                        d_reference_pageranks.data(),
+                        d_reference_pageranks.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      // the reference values are accurate up to the power iteration tolerance
+      double constexpr reference_tolerance{1e-4};
+
+      double diff_sum{0.0};
+      for (vertex_t i = 0; i < num_vertices; ++i) {
+        ASSERT_TRUE(h_cugraph_pageranks[i] >= result_t{0.0})
+          << "approximate PageRank values should be non-negative.";
+        ASSERT_TRUE(h_cugraph_pageranks[i] <= h_reference_pageranks[i] + reference_tolerance)
+          << "approximate PageRank values should not exceed the PageRank values.";
+        diff_sum += std::abs(static_cast<double>(h_reference_pageranks[i]) -
+                             static_cast<double>(h_cugraph_pageranks[i]));
+      }
+      ASSERT_TRUE(diff_sum <= residual_sum_bound + reference_tolerance)
+        << "the sum of the approximation errors exceeds the residual bound.";
+    }
+  }
+};
+
+using Tests_ApproximatePageRank_File = Tests_ApproximatePageRank<cugraph::test::File_Usecase>;
+using Tests_ApproximatePageRank_Rmat = Tests_ApproximatePageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ApproximatePageRank_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ApproximatePageRank_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ApproximatePageRank_Rmat, CheckInt64Int64DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ApproximatePageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ApproximatePageRank_Usecase{1, false},
+                      ApproximatePageRank_Usecase{4, false},
+                      ApproximatePageRank_Usecase{4, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ApproximatePageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ApproximatePageRank_Usecase{1, false}, ApproximatePageRank_Usecase{8, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ApproximatePageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(ApproximatePageRank_Usecase{1, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+typedef struct CapturedIteration_Usecase_t {
+  size_t capture_interval{1};
+  bool test_weighted{false};
+} CapturedIteration_Usecase;
+
+template <typename input_usecase_t>
+class Tests_CapturedIteration
+  : public ::testing::TestWithParam<std::tuple<CapturedIteration_Usecase, input_usecase_t>> {
+ public:
+  Tests_CapturedIteration() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename T>
+  static void compare(std::vector<T> const& lhs, std::vector<T> const& rhs, char const* name)
+  {
+    ASSERT_EQ(lhs.size(), rhs.size());
+    auto threshold_ratio = 1e-3;
+    auto threshold_magnitude =
+      (1.0 / static_cast<T>(std::max(lhs.size(), size_t{1}))) * threshold_ratio;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      ASSERT_TRUE(std::abs(lhs[i] - rhs[i]) <=
+                  std::max(std::abs(lhs[i]) * threshold_ratio, threshold_magnitude))
+        << name << " values differ at vertex " << i << ".";
+    }
+  }
+
+  // PageRank and Katz Centrality with the iterations captured into a CUDA graph should converge
+  // to the same values as the regular iterations
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(CapturedIteration_Usecase const& capture_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    rmm::cuda_stream stream{};  // the legacy default stream can't be captured
+    raft::handle_t handle{};
+    handle.set_stream(stream.value());
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, capture_usecase.test_weighted, true);
+    auto graph_view = graph.view();
+
+    auto degrees   = graph_view.compute_in_degrees(handle);
+    auto h_degrees = cugraph::test::to_host(handle, degrees.data(), degrees.size());
+    auto max_it    = std::max_element(h_degrees.begin(), h_degrees.end());
+    result_t const katz_alpha =
+      result_t{1.0} / static_cast<result_t>((max_it != h_degrees.end() ? *max_it : 0) + 1);
+
+    auto run = [&](size_t capture_interval, char const* label) {
+      rmm::device_uvector<result_t> d_pageranks(graph_view.get_number_of_vertices(),
+                                                handle.get_stream());
+      rmm::device_uvector<result_t> d_katz_centralities(graph_view.get_number_of_vertices(),
+                                                        handle.get_stream());
+
+      HighResClock hr_clock{};
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_clock.start();
+      }
+
+      cugraph::pagerank<vertex_t, edge_t, weight_t, result_t, false>(handle,
+                                                                     graph_view,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     d_pageranks.data(),
+                                                                     result_t{0.85},
+                                                                     result_t{1e-6},
+                                                                     size_t{500},
+                                                                     false,
+                                                                     false,
+                                                                     capture_interval);
+      cugraph::katz_centrality(handle,
+                               graph_view,
+                               static_cast<result_t*>(nullptr),
+                               d_katz_centralities.data(),
+                               katz_alpha,
+                               result_t{1.0},
+                               result_t{1e-6},
+                               std::numeric_limits<size_t>::max(),
+                               false,
+                               true,
+                               false,
+                               capture_interval);
+
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        double elapsed_time{0.0};
+        hr_clock.stop(&elapsed_time);
+        std::cout << "PageRank and Katz Centrality (" << label << ") took "
+                  << elapsed_time * 1e-6 << " s.\n";
+      }
+
+      return std::make_tuple(
+        cugraph::test::to_host(handle, d_pageranks.data(), d_pageranks.size()),
+        cugraph::test::to_host(handle, d_katz_centralities.data(), d_katz_centralities.size()));
+    };
+
+    auto [h_pageranks, h_katz_centralities] = run(0, "regular");
+    auto [h_captured_pageranks, h_captured_katz_centralities] =
+      run(capture_usecase.capture_interval, "captured");
+
+    compare(h_pageranks, h_captured_pageranks, "PageRank");
+    compare(h_katz_centralities, h_captured_katz_centralities, "Katz Centrality");
+  }
+};
+
+using Tests_CapturedIteration_File = Tests_CapturedIteration<cugraph::test::File_Usecase>;
+using Tests_CapturedIteration_Rmat = Tests_CapturedIteration<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_CapturedIteration_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_CapturedIteration_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_CapturedIteration_Rmat, CheckInt64Int64FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_CapturedIteration_File,
+  ::testing::Combine(::testing::Values(CapturedIteration_Usecase{1, false},
+                                       CapturedIteration_Usecase{1, true},
+                                       CapturedIteration_Usecase{8, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_CapturedIteration_Rmat,
+  ::testing::Combine(
+    ::testing::Values(CapturedIteration_Usecase{1, false}, CapturedIteration_Usecase{8, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// the hub values of a single seed vector (h = (1 - teleport) * normalize(A A^T h) + teleport * s)
+template <typename result_t, typename vertex_t, typename edge_t>
+std::vector<result_t> personalized_hits_reference(edge_t const* h_offsets,
+                                                  vertex_t const* h_indices,
+                                                  vertex_t num_vertices,
+                                                  std::vector<vertex_t> const& seed_vertices,
+                                                  std::vector<result_t> const& seed_values,
+                                                  result_t teleport_probability,
+                                                  result_t epsilon,
+                                                  size_t max_iterations)
+{
+  std::vector<result_t> seeds(num_vertices, result_t{0.0});
+  auto seed_sum = std::accumulate(seed_values.begin(), seed_values.end(), result_t{0.0});
+  for (size_t i = 0; i < seed_vertices.size(); ++i) {
+    seeds[seed_vertices[i]] += seed_values[i] / seed_sum;
+  }
+
+  std::vector<result_t> hubs(seeds);
+  std::vector<result_t> authorities(num_vertices);
+  std::vector<result_t> new_hubs(num_vertices);
+  for (size_t iter = 0; iter < max_iterations; ++iter) {
+    std::fill(authorities.begin(), authorities.end(), result_t{0.0});
+    std::fill(new_hubs.begin(), new_hubs.end(), result_t{0.0});
+    for (vertex_t src = 0; src < num_vertices; ++src) {
+      for (auto i = h_offsets[src]; i < h_offsets[src + 1]; ++i) {
+        authorities[h_indices[i]] += hubs[src];
+      }
+    }
+    for (vertex_t src = 0; src < num_vertices; ++src) {
+      for (auto i = h_offsets[src]; i < h_offsets[src + 1]; ++i) {
+        new_hubs[src] += authorities[h_indices[i]];
+      }
+    }
+    auto hub_sum = std::accumulate(new_hubs.begin(), new_hubs.end(), result_t{0.0});
+    result_t diff_sum{0.0};
+    for (vertex_t v = 0; v < num_vertices; ++v) {
+      auto hub = (hub_sum > 0.0 ? (result_t{1.0} - teleport_probability) * new_hubs[v] / hub_sum
+                                : result_t{0.0}) +
+                 teleport_probability * seeds[v];
+      diff_sum += std::abs(hub - hubs[v]);
+      hubs[v] = hub;
+    }
+    if (diff_sum < epsilon) { break; }
+  }
+
+  return hubs;
+}
+
+struct HitsBatch_Usecase {
+  size_t num_seed_vectors{1};
+  size_t num_seeds_per_vector{1};
+  double teleport_probability{0.15};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_HitsBatch
+  : public ::testing::TestWithParam<std::tuple<HitsBatch_Usecase, input_usecase_t>> {
+ public:
+  Tests_HitsBatch() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(HitsBatch_Usecase const& hits_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, false, false);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+
+    std::default_random_engine generator{};
+    std::uniform_real_distribution<double> value_distribution{0.0, 1.0};
+    std::vector<vertex_t> h_candidates(num_vertices);
+    std::iota(h_candidates.begin(), h_candidates.end(), vertex_t{0});
+    auto num_seeds_per_vector =
+      std::min(hits_usecase.num_seeds_per_vector, static_cast<size_t>(num_vertices));
+    std::vector<size_t> h_seed_offsets(hits_usecase.num_seed_vectors + 1, size_t{0});
+    std::vector<vertex_t> h_seed_vertices{};
+    std::vector<weight_t> h_seed_values{};
+    for (size_t i = 0; i < hits_usecase.num_seed_vectors; ++i) {
+      std::shuffle(h_candidates.begin(), h_candidates.end(), generator);
+      for (size_t j = 0; j < num_seeds_per_vector; ++j) {
+        h_seed_vertices.push_back(h_candidates[j]);
+        h_seed_values.push_back(static_cast<weight_t>(value_distribution(generator)) +
+                                weight_t{0.1});
+      }
+      h_seed_offsets[i + 1] = h_seed_vertices.size();
+    }
+
+    rmm::device_uvector<size_t> d_seed_offsets(h_seed_offsets.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_seed_vertices(h_seed_vertices.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> d_seed_values(h_seed_values.size(), handle.get_stream());
+    raft::update_device(
+      d_seed_offsets.data(), h_seed_offsets.data(), h_seed_offsets.size(), handle.get_stream());
+    raft::update_device(
+      d_seed_vertices.data(), h_seed_vertices.data(), h_seed_vertices.size(), handle.get_stream());
+    raft::update_device(
+      d_seed_values.data(), h_seed_values.data(), h_seed_values.size(), handle.get_stream());
+
+    size_t constexpr maximum_iterations{500};
+    weight_t constexpr epsilon{1e-6};
+    auto teleport_probability = static_cast<weight_t>(hits_usecase.teleport_probability);
+
+    rmm::device_uvector<weight_t> d_hubs(num_vertices * hits_usecase.num_seed_vectors,
+                                         handle.get_stream());
+    rmm::device_uvector<weight_t> d_authorities(d_hubs.size(), handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [diff_sums, iteration_counts] =
+      cugraph::personalized_hits_batch(handle,
+                                       graph_view,
+                                       d_seed_offsets.data(),
+                                       d_seed_vertices.data(),
+                                       d_seed_values.data(),
+                                       hits_usecase.num_seed_vectors,
+                                       d_hubs.data(),
+                                       d_authorities.data(),
+                                       teleport_probability,
+                                       epsilon,
+                                       maximum_iterations,
+                                       true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "personalized HITS (batch) took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (hits_usecase.check_correctness) {
+      cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> unrenumbered_graph(handle);
+      std::tie(unrenumbered_graph, std::ignore) =
+        cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+          handle, input_usecase, false, false);
+      auto unrenumbered_graph_view = unrenumbered_graph.view();
+      auto offsets =
+        cugraph::test::to_host(handle,
+                               unrenumbered_graph_view.get_matrix_partition_view().get_offsets(),
+                               unrenumbered_graph_view.get_number_of_vertices() + 1);
+      auto indices =
+        cugraph::test::to_host(handle,
+                               unrenumbered_graph_view.get_matrix_partition_view().get_indices(),
+                               unrenumbered_graph_view.get_number_of_edges());
+
+      std::vector<weight_t> h_cugraph_hubs(d_hubs.size());
+      raft::update_host(h_cugraph_hubs.data(), d_hubs.data(), d_hubs.size(), handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      auto threshold_ratio     = 1e-3;
+      auto threshold_magnitude = (1.0 / static_cast<weight_t>(num_vertices)) * threshold_ratio;
+      auto nearly_equal        = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <=
+               std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+      };
+
+      for (size_t i = 0; i < hits_usecase.num_seed_vectors; ++i) {
+        ASSERT_TRUE(iteration_counts[i] < maximum_iterations)
+          << "personalized HITS failed to converge for seed vector " << i << ".";
+        auto reference_hubs = personalized_hits_reference(
+          offsets.data(),
+          indices.data(),
+          num_vertices,
+          std::vector<vertex_t>(h_seed_vertices.begin() + h_seed_offsets[i],
+                                h_seed_vertices.begin() + h_seed_offsets[i + 1]),
+          std::vector<weight_t>(h_seed_values.begin() + h_seed_offsets[i],
+                                h_seed_values.begin() + h_seed_offsets[i + 1]),
+          teleport_probability,
+          epsilon,
+          maximum_iterations);
+        ASSERT_TRUE(std::equal(reference_hubs.begin(),
+                               reference_hubs.end(),
+                               h_cugraph_hubs.begin() + i * num_vertices,
+                               nearly_equal))
+          << "hub values do not match with the reference values for seed vector " << i << ".";
+      }
+    }
+  }
+};
+
+using Tests_HitsBatch_File = Tests_HitsBatch<cugraph::test::File_Usecase>;
+using Tests_HitsBatch_Rmat = Tests_HitsBatch<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_HitsBatch_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_HitsBatch_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_HitsBatch_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_HitsBatch_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HitsBatch_Usecase{1, 1, 0.15},
+                      HitsBatch_Usecase{6, 4, 0.15},
+                      HitsBatch_Usecase{5, 2, 0.5}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_HitsBatch_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HitsBatch_Usecase{1, 1, 0.15}, HitsBatch_Usecase{9, 4, 0.15}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_HitsBatch_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(HitsBatch_Usecase{16, 1, 0.15, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+struct IncrementalPageRank_Usecase {
+  double deleted_edge_ratio{0.01};
+  size_t num_inserted_edges{16};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> build_graph(
+  raft::handle_t const& handle,
+  vertex_t num_vertices,
+  std::vector<vertex_t> const& h_srcs,
+  std::vector<vertex_t> const& h_dsts,
+  std::optional<std::vector<weight_t>> const& h_weights)
+{
+  rmm::device_uvector<vertex_t> d_vertices(num_vertices, handle.get_stream());
+  cugraph::detail::sequence_fill(
+    handle.get_stream_view(), d_vertices.data(), d_vertices.size(), vertex_t{0});
+  rmm::device_uvector<vertex_t> d_srcs(h_srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> d_dsts(h_dsts.size(), handle.get_stream());
+  raft::update_device(d_srcs.data(), h_srcs.data(), h_srcs.size(), handle.get_stream());
+  raft::update_device(d_dsts.data(), h_dsts.data(), h_dsts.size(), handle.get_stream());
+  std::optional<rmm::device_uvector<weight_t>> d_weights{std::nullopt};
+  if (h_weights) {
+    d_weights = rmm::device_uvector<weight_t>((*h_weights).size(), handle.get_stream());
+    raft::update_device(
+      (*d_weights).data(), (*h_weights).data(), (*h_weights).size(), handle.get_stream());
+  }
+
+  cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, store_transposed, false>(
+      handle,
+      std::optional<rmm::device_uvector<vertex_t>>{std::move(d_vertices)},
+      std::move(d_srcs),
+      std::move(d_dsts),
+      std::move(d_weights),
+      cugraph::graph_properties_t{false, false},
+      false);
+  return graph;
+}
+
+template <typename input_usecase_t>
+class Tests_IncrementalPageRank
+  : public ::testing::TestWithParam<std::tuple<IncrementalPageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_IncrementalPageRank() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(IncrementalPageRank_Usecase const& pagerank_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    // 1. create the edge lists before & after the changes
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, pagerank_usecase.test_weighted, false);
+    auto num_vertices = graph.get_number_of_vertices();
+
+    auto [d_srcs, d_dsts, d_weights] =
+      graph.decompress_to_edgelist(handle, std::nullopt, true);
+    std::vector<vertex_t> h_old_srcs(d_srcs.size());
+    std::vector<vertex_t> h_old_dsts(d_dsts.size());
+    auto h_old_weights =
+      d_weights ? std::make_optional<std::vector<weight_t>>((*d_weights).size()) : std::nullopt;
+    raft::update_host(h_old_srcs.data(), d_srcs.data(), d_srcs.size(), handle.get_stream());
+    raft::update_host(h_old_dsts.data(), d_dsts.data(), d_dsts.size(), handle.get_stream());
+    if (d_weights) {
+      raft::update_host(
+        (*h_old_weights).data(), (*d_weights).data(), (*d_weights).size(), handle.get_stream());
+    }
+    handle.get_stream_view().synchronize();
+
+    std::default_random_engine generator{};
+    std::uniform_real_distribution<double> ratio_distribution{0.0, 1.0};
+    std::uniform_int_distribution<vertex_t> vertex_distribution{0, num_vertices - 1};
+
+    std::vector<vertex_t> h_new_srcs{};
+    std::vector<vertex_t> h_new_dsts{};
+    auto h_new_weights =
+      h_old_weights ? std::make_optional<std::vector<weight_t>>() : std::nullopt;
+    std::vector<vertex_t> h_changed_srcs{};
+    std::vector<vertex_t> h_changed_dsts{};
+    std::vector<weight_t> h_changed_weight_deltas{};
+    std::set<std::pair<vertex_t, vertex_t>> edge_set{};
+    for (size_t i = 0; i < h_old_srcs.size(); ++i) {
+      auto w = h_old_weights ? (*h_old_weights)[i] : weight_t{1.0};
+      edge_set.insert(std::make_pair(h_old_srcs[i], h_old_dsts[i]));
+      if (ratio_distribution(generator) < pagerank_usecase.deleted_edge_ratio) {
+        h_changed_srcs.push_back(h_old_srcs[i]);
+        h_changed_dsts.push_back(h_old_dsts[i]);
+        h_changed_weight_deltas.push_back(-w);
+      } else {
+        h_new_srcs.push_back(h_old_srcs[i]);
+        h_new_dsts.push_back(h_old_dsts[i]);
+        if (h_new_weights) { (*h_new_weights).push_back(w); }
+      }
+    }
+    for (size_t i = 0; i < pagerank_usecase.num_inserted_edges; ++i) {
+      auto src = vertex_distribution(generator);
+      auto dst = vertex_distribution(generator);
+      if ((src == dst) || !edge_set.insert(std::make_pair(src, dst)).second) { continue; }
+      auto w = h_new_weights ? static_cast<weight_t>(ratio_distribution(generator)) + weight_t{0.1}
+                             : weight_t{1.0};
+      h_new_srcs.push_back(src);
+      h_new_dsts.push_back(dst);
+      if (h_new_weights) { (*h_new_weights).push_back(w); }
+      h_changed_srcs.push_back(src);
+      h_changed_dsts.push_back(dst);
+      h_changed_weight_deltas.push_back(w);
+    }
+
+    // 2. compute the PageRank values before the changes
+
+    result_t constexpr alpha{0.85};
+    result_t constexpr epsilon{1e-6};
+
+    rmm::device_uvector<result_t> d_pageranks(num_vertices, handle.get_stream());
+    {
+      auto old_graph = build_graph<vertex_t, edge_t, weight_t, true>(
+        handle, num_vertices, h_old_srcs, h_old_dsts, h_old_weights);
+      cugraph::pagerank<vertex_t, edge_t, weight_t>(handle,
+                                                    old_graph.view(),
+                                                    std::nullopt,
+                                                    std::nullopt,
+                                                    std::nullopt,
+                                                    std::nullopt,
+                                                    d_pageranks.data(),
+                                                    alpha,
+                                                    epsilon,
+                                                    std::numeric_limits<size_t>::max(),
+                                                    false,
+                                                    false);
+    }
+
+    // 3. update the PageRank values
+
+    auto new_graph = build_graph<vertex_t, edge_t, weight_t, false>(
+      handle, num_vertices, h_new_srcs, h_new_dsts, h_new_weights);
+    auto new_graph_view = new_graph.view();
+
+    rmm::device_uvector<vertex_t> d_changed_srcs(h_changed_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_changed_dsts(h_changed_dsts.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> d_changed_weight_deltas(h_changed_weight_deltas.size(),
+                                                          handle.get_stream());
+    raft::update_device(
+      d_changed_srcs.data(), h_changed_srcs.data(), h_changed_srcs.size(), handle.get_stream());
+    raft::update_device(
+      d_changed_dsts.data(), h_changed_dsts.data(), h_changed_dsts.size(), handle.get_stream());
+    raft::update_device(d_changed_weight_deltas.data(),
+                        h_changed_weight_deltas.data(),
+                        h_changed_weight_deltas.size(),
+                        handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::incremental_pagerank(handle,
+                                  new_graph_view,
+                                  std::nullopt,
+                                  d_changed_srcs.data(),
+                                  d_changed_dsts.data(),
+                                  d_changed_weight_deltas.data(),
+                                  static_cast<edge_t>(d_changed_srcs.size()),
+                                  d_pageranks.data(),
+                                  alpha,
+                                  epsilon,
+                                  std::numeric_limits<size_t>::max(),
+                                  true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "incremental PageRank took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. compare with the PageRank values computed from scratch
+
+    if (pagerank_usecase.check_correctness) {
+      auto new_transposed_graph = build_graph<vertex_t, edge_t, weight_t, true>(
+        handle, num_vertices, h_new_srcs, h_new_dsts, h_new_weights);
+
+      rmm::device_uvector<result_t> d_reference_pageranks(num_vertices, handle.get_stream());
+      cugraph::pagerank<vertex_t, edge_t, weight_t>(handle,
+                                                    new_transposed_graph.view(),
+                                                    std::nullopt,
+                                                    std::nullopt,
+                                                    std::nullopt,
+                                                    std::nullopt,
+                                                    d_reference_pageranks.data(),
+                                                    alpha,
+                                                    epsilon,
+                                                    std::numeric_limits<size_t>::max(),
+                                                    false,
+                                                    false);
+
+      std::vector<result_t> h_cugraph_pageranks(num_vertices);
+      std::vector<result_t> h_reference_pageranks(num_vertices);
+      raft::update_host(
+        h_cugraph_pageranks.data(), d_pageranks.data(), d_pageranks.size(), handle.get_stream());
+      raft::update_host(h_reference_pageranks.data(),
+                        d_reference_pageranks.data(),
+                        d_reference_pageranks.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      double diff_sum{0.0};
+      for (vertex_t i = 0; i < num_vertices; ++i) {
+        diff_sum += std::abs(static_cast<double>(h_reference_pageranks[i]) -
+                             static_cast<double>(h_cugraph_pageranks[i]));
+      }
+      ASSERT_TRUE(diff_sum < 5e-3)
+        << "incrementally updated PageRank values do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_IncrementalPageRank_File = Tests_IncrementalPageRank<cugraph::test::File_Usecase>;
+using Tests_IncrementalPageRank_Rmat = Tests_IncrementalPageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_IncrementalPageRank_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_IncrementalPageRank_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_IncrementalPageRank_Rmat, CheckInt64Int64DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_IncrementalPageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalPageRank_Usecase{0.01, 16, false},
+                      IncrementalPageRank_Usecase{0.05, 64, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_IncrementalPageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalPageRank_Usecase{0.01, 16, false},
+                      IncrementalPageRank_Usecase{0.01, 16, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_IncrementalPageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(IncrementalPageRank_Usecase{0.001, 1024, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/local_multi_gpu.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+typedef struct LocalMultiGPU_Usecase_t {
+  bool test_weighted{false};
+} LocalMultiGPU_Usecase;
+
+template <typename input_usecase_t>
+class Tests_LocalMultiGPU
+  : public ::testing::TestWithParam<std::tuple<LocalMultiGPU_Usecase, input_usecase_t>> {
+ public:
+  Tests_LocalMultiGPU() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // multi-GPU PageRank on the in-process communicators of every local GPU should return the same
+  // values as single-GPU PageRank
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(LocalMultiGPU_Usecase const& local_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    auto const alpha   = weight_t{0.85};
+    auto const epsilon = weight_t{1e-6};
+
+    // 1. single-GPU reference (not renumbered, the index is the vertex ID)
+
+    std::vector<weight_t> h_sg_pageranks{};
+    {
+      raft::handle_t handle{};
+
+      auto [sg_graph, d_sg_renumber_map_labels] =
+        cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+          handle, input_usecase, local_usecase.test_weighted, false);
+      auto sg_graph_view = sg_graph.view();
+
+      rmm::device_uvector<weight_t> d_sg_pageranks(sg_graph_view.get_number_of_vertices(),
+                                                   handle.get_stream());
+      cugraph::pagerank<vertex_t, edge_t, weight_t, weight_t, false>(handle,
+                                                                     sg_graph_view,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     d_sg_pageranks.data(),
+                                                                     alpha,
+                                                                     epsilon);
+      h_sg_pageranks =
+        cugraph::test::to_host(handle, d_sg_pageranks.data(), d_sg_pageranks.size());
+    }
+
+    // 2. multi-GPU PageRank on every local GPU
+
+    cugraph::local_multi_gpu_t local_multi_gpu{};
+
+    std::vector<size_t> num_mismatches(local_multi_gpu.get_size(), 0);
+    local_multi_gpu.run([&](raft::handle_t& handle, int rank) {
+      auto [mg_graph, d_mg_renumber_map_labels] =
+        cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, true>(
+          handle, input_usecase, local_usecase.test_weighted, true);
+      auto mg_graph_view = mg_graph.view();
+
+      rmm::device_uvector<weight_t> d_mg_pageranks(mg_graph_view.get_number_of_local_vertices(),
+                                                   handle.get_stream());
+      cugraph::pagerank<vertex_t, edge_t, weight_t, weight_t, true>(handle,
+                                                                    mg_graph_view,
+                                                                    std::nullopt,
+                                                                    std::nullopt,
+                                                                    std::nullopt,
+                                                                    std::nullopt,
+                                                                    d_mg_pageranks.data(),
+                                                                    alpha,
+                                                                    epsilon);
+
+      auto h_mg_pageranks =
+        cugraph::test::to_host(handle, d_mg_pageranks.data(), d_mg_pageranks.size());
+      auto h_mg_labels = cugraph::test::to_host(
+        handle, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+
+      auto threshold_ratio = 1e-3;
+      auto threshold_magnitude =
+        (1.0 / static_cast<weight_t>(h_sg_pageranks.size())) * threshold_ratio;
+      for (size_t i = 0; i < h_mg_pageranks.size(); ++i) {
+        auto sg_pagerank = h_sg_pageranks[h_mg_labels[i]];
+        if (std::abs(sg_pagerank - h_mg_pageranks[i]) >
+            std::max(std::abs(sg_pagerank) * threshold_ratio, threshold_magnitude)) {
+          ++num_mismatches[rank];
+        }
+      }
+    });
+
+    for (int i = 0; i < local_multi_gpu.get_size(); ++i) {
+      ASSERT_EQ(num_mismatches[i], size_t{0}) << "PageRank values differ in GPU " << i << ".";
+    }
+  }
+};
+
+using Tests_LocalMultiGPU_File = Tests_LocalMultiGPU<cugraph::test::File_Usecase>;
+using Tests_LocalMultiGPU_Rmat = Tests_LocalMultiGPU<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_LocalMultiGPU_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_LocalMultiGPU_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_LocalMultiGPU_File,
+  ::testing::Combine(::testing::Values(LocalMultiGPU_Usecase{false}, LocalMultiGPU_Usecase{true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_LocalMultiGPU_Rmat,
+  ::testing::Combine(
+    ::testing::Values(LocalMultiGPU_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+typedef struct MixedPrecision_Usecase_t {
+  bool test_weighted{false};
+} MixedPrecision_Usecase;
+
+template <typename input_usecase_t>
+class Tests_MixedPrecision
+  : public ::testing::TestWithParam<std::tuple<MixedPrecision_Usecase, input_usecase_t>> {
+ public:
+  Tests_MixedPrecision() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename T>
+  static void compare(std::vector<T> const& lhs, std::vector<T> const& rhs, char const* name)
+  {
+    ASSERT_EQ(lhs.size(), rhs.size());
+    auto threshold_ratio = 1e-4;
+    auto threshold_magnitude =
+      (1.0 / static_cast<T>(std::max(lhs.size(), size_t{1}))) * threshold_ratio;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      ASSERT_TRUE(std::abs(lhs[i] - rhs[i]) <=
+                  std::max(std::abs(lhs[i]) * threshold_ratio, threshold_magnitude))
+        << name << " values differ at vertex " << i << ".";
+    }
+  }
+
+  // double precision PageRank and Katz Centrality with the mixed precision iterations should
+  // converge to the same values as the double precision iterations
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(MixedPrecision_Usecase const& mixed_precision_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = double;
+    using result_t = double;
+
+    raft::handle_t handle{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, mixed_precision_usecase.test_weighted, true);
+    auto graph_view = graph.view();
+
+    auto degrees   = graph_view.compute_in_degrees(handle);
+    auto h_degrees = cugraph::test::to_host(handle, degrees.data(), degrees.size());
+    auto max_it    = std::max_element(h_degrees.begin(), h_degrees.end());
+    result_t const katz_alpha =
+      result_t{1.0} / static_cast<result_t>((max_it != h_degrees.end() ? *max_it : 0) + 1);
+
+    auto run = [&](bool mixed_precision, char const* label) {
+      rmm::device_uvector<result_t> d_pageranks(graph_view.get_number_of_vertices(),
+                                                handle.get_stream());
+      rmm::device_uvector<result_t> d_katz_centralities(graph_view.get_number_of_vertices(),
+                                                        handle.get_stream());
+
+      HighResClock hr_clock{};
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_clock.start();
+      }
+
+      cugraph::pagerank<vertex_t, edge_t, weight_t, result_t, false>(handle,
+                                                                     graph_view,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     d_pageranks.data(),
+                                                                     result_t{0.85},
+                                                                     result_t{1e-10},
+                                                                     size_t{500},
+                                                                     false,
+                                                                     false,
+                                                                     size_t{0},
+                                                                     mixed_precision);
+      cugraph::katz_centrality(handle,
+                               graph_view,
+                               static_cast<result_t*>(nullptr),
+                               d_katz_centralities.data(),
+                               katz_alpha,
+                               result_t{1.0},
+                               result_t{1e-10},
+                               std::numeric_limits<size_t>::max(),
+                               false,
+                               true,
+                               false,
+                               size_t{0},
+                               mixed_precision);
+
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        double elapsed_time{0.0};
+        hr_clock.stop(&elapsed_time);
+        std::cout << "PageRank and Katz Centrality (" << label << ") took "
+                  << elapsed_time * 1e-6 << " s.\n";
+      }
+
+      return std::make_tuple(
+        cugraph::test::to_host(handle, d_pageranks.data(), d_pageranks.size()),
+        cugraph::test::to_host(handle, d_katz_centralities.data(), d_katz_centralities.size()));
+    };
+
+    auto [h_pageranks, h_katz_centralities]             = run(false, "double");
+    auto [h_mixed_pageranks, h_mixed_katz_centralities] = run(true, "mixed");
+
+    compare(h_pageranks, h_mixed_pageranks, "PageRank");
+    compare(h_katz_centralities, h_mixed_katz_centralities, "Katz Centrality");
+  }
+};
+
+using Tests_MixedPrecision_File = Tests_MixedPrecision<cugraph::test::File_Usecase>;
+using Tests_MixedPrecision_Rmat = Tests_MixedPrecision<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MixedPrecision_File, CheckInt32Int32DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MixedPrecision_Rmat, CheckInt32Int32DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MixedPrecision_File,
+  ::testing::Combine(::testing::Values(MixedPrecision_Usecase{false}, MixedPrecision_Usecase{true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MixedPrecision_Rmat,
+  ::testing::Combine(
+    ::testing::Values(MixedPrecision_Usecase{false}, MixedPrecision_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
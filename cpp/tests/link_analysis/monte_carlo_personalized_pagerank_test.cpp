@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+struct MonteCarloPersonalizedPageRank_Usecase {
+  size_t num_sources{1};
+  size_t num_walks_per_source{10000};
+  size_t k{16};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MonteCarloPersonalizedPageRank
+  : public ::testing::TestWithParam<
+      std::tuple<MonteCarloPersonalizedPageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_MonteCarloPersonalizedPageRank() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(MonteCarloPersonalizedPageRank_Usecase const& ppr_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+
+    std::vector<vertex_t> h_sources(
+      std::min(ppr_usecase.num_sources, static_cast<size_t>(num_vertices)));
+    for (size_t i = 0; i < h_sources.size(); ++i) {
+      h_sources[i] = static_cast<vertex_t>((i * num_vertices) / h_sources.size());
+    }
+    rmm::device_uvector<vertex_t> d_sources(h_sources.size(), handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+
+    result_t constexpr alpha{0.85};
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [d_ret_sources, d_ret_vertices, d_ret_scores] =
+      cugraph::monte_carlo_personalized_pagerank(handle,
+                                                 graph_view,
+                                                 d_sources.data(),
+                                                 d_sources.size(),
+                                                 ppr_usecase.num_walks_per_source,
+                                                 ppr_usecase.k,
+                                                 alpha,
+                                                 std::numeric_limits<size_t>::max(),
+                                                 uint64_t{0},
+                                                 true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Monte Carlo personalized PageRank took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (ppr_usecase.check_correctness) {
+      auto h_ret_sources =
+        cugraph::test::to_host(handle, d_ret_sources.data(), d_ret_sources.size());
+      auto h_ret_vertices =
+        cugraph::test::to_host(handle, d_ret_vertices.data(), d_ret_vertices.size());
+      auto h_ret_scores = cugraph::test::to_host(handle, d_ret_scores.data(), d_ret_scores.size());
+
+      auto [transposed_graph, d_transposed_renumber_map_labels] =
+        cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+          handle, input_usecase, false, false);
+      auto transposed_graph_view = transposed_graph.view();
+
+      // the standard error of an estimate is bounded by (1 - alpha) * sqrt(E[walk length^2] /
+      // num_walks_per_source) <= sqrt(2 / num_walks_per_source) (E[walk length^2] = (1 + alpha) /
+      // (1 - alpha)^2), allow 4 standard errors
+      auto threshold =
+        4.0 * std::sqrt(2.0 / static_cast<double>(ppr_usecase.num_walks_per_source));
+
+      size_t i{0};
+      for (size_t j = 0; j < h_sources.size(); ++j) {
+        rmm::device_uvector<result_t> d_reference_pageranks(num_vertices, handle.get_stream());
+        result_t const personalization_value{1.0};
+        rmm::device_uvector<result_t> d_personalization_values(1, handle.get_stream());
+        raft::update_device(
+          d_personalization_values.data(), &personalization_value, 1, handle.get_stream());
+        cugraph::pagerank<vertex_t, edge_t, weight_t>(
+          handle,
+          transposed_graph_view,
+          std::nullopt,
+          std::optional<vertex_t const*>{d_sources.data() + j},
+          std::optional<result_t const*>{d_personalization_values.data()},
+          std::optional<vertex_t>{vertex_t{1}},
+          d_reference_pageranks.data(),
+          alpha,
+          result_t{1e-6},
+          std::numeric_limits<size_t>::max(),
+          false,
+          false);
+        auto h_reference_pageranks = cugraph::test::to_host(
+          handle, d_reference_pageranks.data(), d_reference_pageranks.size());
+
+        auto first = i;
+        while ((i < h_ret_sources.size()) && (h_ret_sources[i] == h_sources[j])) {
+          ASSERT_TRUE(i == first || h_ret_scores[i - 1] > h_ret_scores[i] ||
+                      (h_ret_scores[i - 1] == h_ret_scores[i] &&
+                       h_ret_vertices[i - 1] < h_ret_vertices[i]))
+            << "the estimates of a source are not sorted in descending score order.";
+          ASSERT_TRUE(std::abs(static_cast<double>(h_ret_scores[i]) -
+                               static_cast<double>(h_reference_pageranks[h_ret_vertices[i]])) <=
+                      threshold)
+            << "the estimated score of vertex " << h_ret_vertices[i] << " for source "
+            << h_sources[j] << " is " << h_ret_scores[i] << " but the reference score is "
+            << h_reference_pageranks[h_ret_vertices[i]] << ".";
+          ++i;
+        }
+        ASSERT_TRUE(i > first) << "no estimates are returned for source " << h_sources[j] << ".";
+        ASSERT_TRUE(i - first <= ppr_usecase.k) << "more than k estimates are returned.";
+      }
+      ASSERT_EQ(i, h_ret_sources.size()) << "the estimates are not grouped by source.";
+    }
+  }
+};
+
+using Tests_MonteCarloPersonalizedPageRank_File =
+  Tests_MonteCarloPersonalizedPageRank<cugraph::test::File_Usecase>;
+using Tests_MonteCarloPersonalizedPageRank_Rmat =
+  Tests_MonteCarloPersonalizedPageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MonteCarloPersonalizedPageRank_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MonteCarloPersonalizedPageRank_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MonteCarloPersonalizedPageRank_Rmat, CheckInt64Int64DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MonteCarloPersonalizedPageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MonteCarloPersonalizedPageRank_Usecase{1, 10000, 16},
+                      MonteCarloPersonalizedPageRank_Usecase{4, 10000, 8}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MonteCarloPersonalizedPageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MonteCarloPersonalizedPageRank_Usecase{8, 10000, 16}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MonteCarloPersonalizedPageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MonteCarloPersonalizedPageRank_Usecase{1024, 1000, 32, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
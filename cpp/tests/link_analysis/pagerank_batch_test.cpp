@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+struct PageRankBatch_Usecase {
+  size_t num_personalization_vectors{0};
+  double personalization_ratio{0.0};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_PageRankBatch
+  : public ::testing::TestWithParam<std::tuple<PageRankBatch_Usecase, input_usecase_t>> {
+ public:
+  Tests_PageRankBatch() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(PageRankBatch_Usecase const& pagerank_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, pagerank_usecase.test_weighted, true);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+
+    std::default_random_engine generator{};
+    std::uniform_real_distribution<double> distribution{0.0, 1.0};
+    std::vector<size_t> h_offsets{0};
+    std::vector<vertex_t> h_personalization_vertices{};
+    std::vector<result_t> h_personalization_values{};
+    for (size_t i = 0; i < pagerank_usecase.num_personalization_vectors; ++i) {
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        if (distribution(generator) < pagerank_usecase.personalization_ratio) {
+          h_personalization_vertices.push_back(v);
+          h_personalization_values.push_back(static_cast<result_t>(distribution(generator)));
+        }
+      }
+      if (h_personalization_vertices.size() == h_offsets.back()) {
+        h_personalization_vertices.push_back(static_cast<vertex_t>(i % num_vertices));
+        h_personalization_values.push_back(result_t{1.0});
+      }
+      h_offsets.push_back(h_personalization_vertices.size());
+    }
+
+    rmm::device_uvector<size_t> d_offsets(h_offsets.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_personalization_vertices(h_personalization_vertices.size(),
+                                                             handle.get_stream());
+    rmm::device_uvector<result_t> d_personalization_values(h_personalization_values.size(),
+                                                           handle.get_stream());
+    raft::update_device(d_offsets.data(), h_offsets.data(), h_offsets.size(), handle.get_stream());
+    raft::update_device(d_personalization_vertices.data(),
+                        h_personalization_vertices.data(),
+                        h_personalization_vertices.size(),
+                        handle.get_stream());
+    raft::update_device(d_personalization_values.data(),
+                        h_personalization_values.data(),
+                        h_personalization_values.size(),
+                        handle.get_stream());
+
+    result_t constexpr alpha{0.85};
+    result_t constexpr epsilon{1e-6};
+
+    rmm::device_uvector<result_t> d_pageranks(
+      num_vertices * pagerank_usecase.num_personalization_vectors, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::personalized_pagerank_batch(handle,
+                                         graph_view,
+                                         std::nullopt,
+                                         d_offsets.data(),
+                                         d_personalization_vertices.data(),
+                                         d_personalization_values.data(),
+                                         pagerank_usecase.num_personalization_vectors,
+                                         d_pageranks.data(),
+                                         alpha,
+                                         epsilon,
+                                         std::numeric_limits<size_t>::max(),
+                                         false,
+                                         true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "batched personalized PageRank took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (pagerank_usecase.check_correctness) {
+      std::vector<result_t> h_cugraph_pageranks(d_pageranks.size());
+      raft::update_host(
+        h_cugraph_pageranks.data(), d_pageranks.data(), d_pageranks.size(), handle.get_stream());
+
+      rmm::device_uvector<result_t> d_reference_pageranks(num_vertices, handle.get_stream());
+      std::vector<result_t> h_reference_pageranks(num_vertices);
+
+      auto threshold_ratio = 1e-3;
+      auto threshold_magnitude =
+        (1.0 / static_cast<result_t>(num_vertices)) *
+        threshold_ratio;  // skip comparison for low PageRank verties (lowly ranked vertices)
+      auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <
+               std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+      };
+
+      for (size_t i = 0; i < pagerank_usecase.num_personalization_vectors; ++i) {
+        cugraph::pagerank<vertex_t, edge_t, weight_t>(
+          handle,
+          graph_view,
+          std::nullopt,
+          std::optional<vertex_t const*>{d_personalization_vertices.data() + h_offsets[i]},
+          std::optional<result_t const*>{d_personalization_values.data() + h_offsets[i]},
+          std::optional<vertex_t>{static_cast<vertex_t>(h_offsets[i + 1] - h_offsets[i])},
+          d_reference_pageranks.data(),
+          alpha,
+          epsilon,
+          std::numeric_limits<size_t>::max(),
+          false,
+          false);
+        raft::update_host(h_reference_pageranks.data(),
+                          d_reference_pageranks.data(),
+                          d_reference_pageranks.size(),
+                          handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        ASSERT_TRUE(std::equal(h_reference_pageranks.begin(),
+                               h_reference_pageranks.end(),
+                               h_cugraph_pageranks.begin() + i * num_vertices,
+                               nearly_equal))
+          << "PageRank values of personalization vector " << i
+          << " do not match with the reference values.";
+      }
+    }
+  }
+};
+
+using Tests_PageRankBatch_File = Tests_PageRankBatch<cugraph::test::File_Usecase>;
+using Tests_PageRankBatch_Rmat = Tests_PageRankBatch<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_PageRankBatch_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_PageRankBatch_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_PageRankBatch_Rmat, CheckInt64Int64DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_PageRankBatch_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(PageRankBatch_Usecase{1, 0.1, false},
+                      PageRankBatch_Usecase{7, 0.02, false},
+                      PageRankBatch_Usecase{7, 0.02, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_PageRankBatch_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(PageRankBatch_Usecase{9, 0.01, false}, PageRankBatch_Usecase{9, 0.01, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_PageRankBatch_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(PageRankBatch_Usecase{64, 1e-5, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/sequence.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+struct Similarity_Usecase {
+  bool use_jaccard{true};
+  size_t k{10};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGSimilarity
+  : public ::testing::TestWithParam<std::tuple<Similarity_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGSimilarity() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  static auto run_similarity(
+    raft::handle_t const& handle,
+    cugraph::graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+    rmm::device_uvector<vertex_t> const& query_vertices,
+    Similarity_Usecase const& similarity_usecase)
+  {
+    return similarity_usecase.use_jaccard
+             ? cugraph::jaccard_top_k(handle,
+                                      graph_view,
+                                      query_vertices.data(),
+                                      query_vertices.size(),
+                                      similarity_usecase.k)
+             : cugraph::overlap_top_k(handle,
+                                      graph_view,
+                                      query_vertices.data(),
+                                      query_vertices.size(),
+                                      similarity_usecase.k);
+  }
+
+  // Compare the results of running similarity top-k on multiple GPUs to that of a single-GPU run
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(Similarity_Usecase const& similarity_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, false, true, true, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run MG similarity top-k (every local vertex is a query vertex)
+
+    rmm::device_uvector<vertex_t> d_mg_query_vertices(
+      mg_graph_view.get_number_of_local_vertices(), handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(),
+                     d_mg_query_vertices.begin(),
+                     d_mg_query_vertices.end(),
+                     mg_graph_view.get_local_vertex_first());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [d_mg_queries, d_mg_candidates, d_mg_scores] =
+      run_similarity(handle, mg_graph_view, d_mg_query_vertices, similarity_usecase);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG " << (similarity_usecase.use_jaccard ? "Jaccard" : "Overlap")
+                << " top-k took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. compare SG & MG results
+
+    if (similarity_usecase.check_correctness) {
+      // 4-1. aggregate MG results
+
+      auto d_mg_aggregate_renumber_map_labels = cugraph::test::device_gatherv(
+        handle, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+      auto d_mg_aggregate_queries =
+        cugraph::test::device_gatherv(handle, d_mg_queries.data(), d_mg_queries.size());
+      auto d_mg_aggregate_scores =
+        cugraph::test::device_gatherv(handle, d_mg_scores.data(), d_mg_scores.size());
+
+      if (handle.get_comms().get_rank() == int{0}) {
+        // 4-2. unrenumber MG results
+
+        cugraph::unrenumber_int_vertices<vertex_t, false>(
+          handle,
+          d_mg_aggregate_queries.data(),
+          d_mg_aggregate_queries.size(),
+          d_mg_aggregate_renumber_map_labels.data(),
+          std::vector<vertex_t>{mg_graph_view.get_number_of_vertices()});
+
+        // 4-3. create SG graph
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, false, false, true, true);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_EQ(mg_graph_view.get_number_of_vertices(), sg_graph_view.get_number_of_vertices());
+
+        // 4-4. run SG similarity top-k
+
+        rmm::device_uvector<vertex_t> d_sg_query_vertices(sg_graph_view.get_number_of_vertices(),
+                                                          handle.get_stream());
+        thrust::sequence(handle.get_thrust_policy(),
+                         d_sg_query_vertices.begin(),
+                         d_sg_query_vertices.end(),
+                         vertex_t{0});
+
+        auto [d_sg_queries, d_sg_candidates, d_sg_scores] =
+          run_similarity(handle, sg_graph_view, d_sg_query_vertices, similarity_usecase);
+
+        // 4-5. compare (candidate vertices with the same score can be ordered differently as
+        // vertex IDs are renumbered in multi-GPU, so the scores are compared per query vertex)
+
+        ASSERT_EQ(d_mg_aggregate_queries.size(), d_sg_queries.size());
+
+        std::vector<vertex_t> h_mg_aggregate_queries(d_mg_aggregate_queries.size());
+        std::vector<weight_t> h_mg_aggregate_scores(d_mg_aggregate_scores.size());
+        raft::update_host(h_mg_aggregate_queries.data(),
+                          d_mg_aggregate_queries.data(),
+                          d_mg_aggregate_queries.size(),
+                          handle.get_stream());
+        raft::update_host(h_mg_aggregate_scores.data(),
+                          d_mg_aggregate_scores.data(),
+                          d_mg_aggregate_scores.size(),
+                          handle.get_stream());
+
+        std::vector<vertex_t> h_sg_queries(d_sg_queries.size());
+        std::vector<weight_t> h_sg_scores(d_sg_scores.size());
+        raft::update_host(
+          h_sg_queries.data(), d_sg_queries.data(), d_sg_queries.size(), handle.get_stream());
+        raft::update_host(
+          h_sg_scores.data(), d_sg_scores.data(), d_sg_scores.size(), handle.get_stream());
+
+        handle.get_stream_view().synchronize();
+
+        std::vector<std::tuple<vertex_t, weight_t>> h_mg_aggregate_pairs(
+          h_mg_aggregate_queries.size());
+        std::vector<std::tuple<vertex_t, weight_t>> h_sg_pairs(h_sg_queries.size());
+        for (size_t i = 0; i < h_mg_aggregate_pairs.size(); ++i) {
+          h_mg_aggregate_pairs[i] =
+            std::make_tuple(h_mg_aggregate_queries[i], h_mg_aggregate_scores[i]);
+          h_sg_pairs[i] = std::make_tuple(h_sg_queries[i], h_sg_scores[i]);
+        }
+        std::sort(h_mg_aggregate_pairs.begin(), h_mg_aggregate_pairs.end());
+        std::sort(h_sg_pairs.begin(), h_sg_pairs.end());
+
+        auto threshold_ratio = 1e-4;
+        auto nearly_equal    = [threshold_ratio](auto lhs, auto rhs) {
+          return (std::get<0>(lhs) == std::get<0>(rhs)) &&
+                 (std::abs(std::get<1>(lhs) - std::get<1>(rhs)) <=
+                  std::max(std::get<1>(lhs), std::get<1>(rhs)) * threshold_ratio);
+        };
+        ASSERT_TRUE(std::equal(h_mg_aggregate_pairs.begin(),
+                               h_mg_aggregate_pairs.end(),
+                               h_sg_pairs.begin(),
+                               nearly_equal));
+      }
+    }
+  }
+};
+
+using Tests_MGSimilarity_File = Tests_MGSimilarity<cugraph::test::File_Usecase>;
+using Tests_MGSimilarity_Rmat = Tests_MGSimilarity<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGSimilarity_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGSimilarity_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGSimilarity_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGSimilarity_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGSimilarity_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(Similarity_Usecase{true, 5}, Similarity_Usecase{false, 5}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGSimilarity_Rmat,
+  ::testing::Combine(::testing::Values(Similarity_Usecase{true, 10}, Similarity_Usecase{false, 10}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGSimilarity_Rmat,
+  ::testing::Combine(
+    ::testing::Values(Similarity_Usecase{true, 10, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <tuple>
+#include <vector>
+
+// self-loops are ignored, this code assumes that the graph is symmetric, has no multi-edges, and
+// every vertex's neighbor list is sorted; returns the (query, candidate, score) triplets in the
+// cugraph::jaccard_top_k & cugraph::overlap_top_k output order.
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<std::tuple<vertex_t, vertex_t, weight_t>> similarity_top_k_reference(
+  edge_t const* offsets,
+  vertex_t const* indices,
+  vertex_t num_vertices,
+  std::vector<vertex_t> const& query_vertices,
+  size_t k,
+  bool use_jaccard)
+{
+  std::vector<std::vector<vertex_t>> adj_lists(num_vertices);
+  for (vertex_t i = 0; i < num_vertices; ++i) {
+    std::copy_if(indices + offsets[i],
+                 indices + offsets[i + 1],
+                 std::back_inserter(adj_lists[i]),
+                 [i](auto nbr) { return nbr != i; });
+  }
+
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> triplets{};
+  for (auto q : query_vertices) {
+    std::map<vertex_t, edge_t> intersections{};
+    for (auto w : adj_lists[q]) {
+      for (auto c : adj_lists[w]) {
+        if (c != q) { ++intersections[c]; }
+      }
+    }
+    std::vector<std::tuple<weight_t, vertex_t>> candidates{};
+    for (auto [c, intersection] : intersections) {
+      auto d0 = static_cast<edge_t>(adj_lists[q].size());
+      auto d1 = static_cast<edge_t>(adj_lists[c].size());
+      auto score =
+        use_jaccard
+          ? static_cast<weight_t>(intersection) / static_cast<weight_t>(d0 + d1 - intersection)
+          : static_cast<weight_t>(intersection) / static_cast<weight_t>(std::min(d0, d1));
+      candidates.push_back(std::make_tuple(-score, c));
+    }
+    std::sort(candidates.begin(), candidates.end());
+    for (size_t i = 0; i < std::min(k, candidates.size()); ++i) {
+      triplets.push_back(
+        std::make_tuple(q, std::get<1>(candidates[i]), -std::get<0>(candidates[i])));
+    }
+  }
+
+  return triplets;
+}
+
+struct Similarity_Usecase {
+  bool use_jaccard{true};
+  size_t k{10};
+  size_t query_vertex_stride{1};  // every query_vertex_stride'th vertex is a query vertex
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_Similarity
+  : public ::testing::TestWithParam<std::tuple<Similarity_Usecase, input_usecase_t>> {
+ public:
+  Tests_Similarity() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(Similarity_Usecase const& similarity_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false, true, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+    auto graph_view = graph.view();
+
+    std::vector<vertex_t> h_query_vertices{};
+    for (vertex_t v = 0; v < graph_view.get_number_of_vertices();
+         v += static_cast<vertex_t>(similarity_usecase.query_vertex_stride)) {
+      h_query_vertices.push_back(v);
+    }
+    rmm::device_uvector<vertex_t> d_query_vertices(h_query_vertices.size(), handle.get_stream());
+    raft::update_device(d_query_vertices.data(),
+                        h_query_vertices.data(),
+                        h_query_vertices.size(),
+                        handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [d_queries, d_candidates, d_scores] =
+      similarity_usecase.use_jaccard
+        ? cugraph::jaccard_top_k(handle,
+                                 graph_view,
+                                 d_query_vertices.data(),
+                                 d_query_vertices.size(),
+                                 similarity_usecase.k)
+        : cugraph::overlap_top_k(handle,
+                                 graph_view,
+                                 d_query_vertices.data(),
+                                 d_query_vertices.size(),
+                                 similarity_usecase.k);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << (similarity_usecase.use_jaccard ? "Jaccard" : "Overlap") << " top-k took "
+                << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (similarity_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        graph_view.get_number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+
+      std::vector<vertex_t> h_queries(d_queries.size());
+      std::vector<vertex_t> h_candidates(d_candidates.size());
+      std::vector<weight_t> h_scores(d_scores.size());
+      raft::update_host(h_queries.data(), d_queries.data(), d_queries.size(), handle.get_stream());
+      raft::update_host(
+        h_candidates.data(), d_candidates.data(), d_candidates.size(), handle.get_stream());
+      raft::update_host(h_scores.data(), d_scores.data(), d_scores.size(), handle.get_stream());
+
+      handle.get_stream_view().synchronize();
+
+      auto h_reference_triplets =
+        similarity_top_k_reference<vertex_t, edge_t, weight_t>(h_offsets.data(),
+                                                               h_indices.data(),
+                                                               graph_view.get_number_of_vertices(),
+                                                               h_query_vertices,
+                                                               similarity_usecase.k,
+                                                               similarity_usecase.use_jaccard);
+
+      ASSERT_EQ(h_reference_triplets.size(), h_queries.size())
+        << "the number of the returned pairs does not match with the reference value.";
+      auto threshold_ratio = 1e-4;
+      for (size_t i = 0; i < h_queries.size(); ++i) {
+        ASSERT_EQ(std::get<0>(h_reference_triplets[i]), h_queries[i])
+          << "query vertices do not match with the reference values.";
+        ASSERT_EQ(std::get<1>(h_reference_triplets[i]), h_candidates[i])
+          << "candidate vertices do not match with the reference values.";
+        ASSERT_NEAR(std::get<2>(h_reference_triplets[i]),
+                    h_scores[i],
+                    std::get<2>(h_reference_triplets[i]) * threshold_ratio)
+          << "similarity scores do not match with the reference values.";
+      }
+    }
+  }
+};
+
+using Tests_Similarity_File = Tests_Similarity<cugraph::test::File_Usecase>;
+using Tests_Similarity_Rmat = Tests_Similarity<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_Similarity_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_Similarity_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Similarity_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Similarity_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_Similarity_File,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(Similarity_Usecase{true, 5}, Similarity_Usecase{false, 5}),
+    testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_Similarity_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(Similarity_Usecase{true, 10, 3}, Similarity_Usecase{false, 10, 3}),
+    testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_Similarity_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    testing::Values(Similarity_Usecase{true, 10, 1024, false}),
+    testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
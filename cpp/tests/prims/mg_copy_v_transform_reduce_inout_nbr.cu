@@ -215,6 +215,7 @@ struct generate<std::tuple<Args...>> : public generate_impl<Args...> {
 struct Prims_Usecase {
   bool check_correctness{true};
   bool test_weighted{false};
+  bool split_hubs{false};
 };
 
 template <typename input_usecase_t>
@@ -272,6 +273,9 @@ class Tests_MG_CopyVTransformReduceInOutNbr
       std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
     }
 
+    // a small chunk size to split every vertex in the high degree segment
+    if (prims_usecase.split_hubs) { mg_graph.enable_hub_splitting(handle, edge_t{64}); }
+
     auto mg_graph_view = mg_graph.view();
 
     // 3. run MG transform reduce
@@ -356,6 +360,9 @@ class Tests_MG_CopyVTransformReduceInOutNbr
       std::tie(sg_graph, std::ignore) =
         cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
           handle, input_usecase, true, false);
+      // the SG reference results are computed with the tuned launch configurations (the MG
+      // results are computed with the default launch configurations)
+      sg_graph.enable_launch_tuning();
       auto sg_graph_view = sg_graph.view();
 
       auto sg_vertex_property_data = generate<result_t>::vertex_property(
@@ -484,7 +491,7 @@ INSTANTIATE_TEST_SUITE_P(
   file_test,
   Tests_MG_CopyVTransformReduceInOutNbr_File,
   ::testing::Combine(
-    ::testing::Values(Prims_Usecase{true}),
+    ::testing::Values(Prims_Usecase{true}, Prims_Usecase{true, false, true}),
     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
                       cugraph::test::File_Usecase("test/datasets/web-Google.mtx"),
                       cugraph::test::File_Usecase("test/datasets/ljournal-2008.mtx"),
@@ -493,7 +500,7 @@ INSTANTIATE_TEST_SUITE_P(
 INSTANTIATE_TEST_SUITE_P(
   rmat_small_test,
   Tests_MG_CopyVTransformReduceInOutNbr_Rmat,
-  ::testing::Combine(::testing::Values(Prims_Usecase{true}),
+  ::testing::Combine(::testing::Values(Prims_Usecase{true}, Prims_Usecase{true, false, true}),
                      ::testing::Values(cugraph::test::Rmat_Usecase(
                        10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
 
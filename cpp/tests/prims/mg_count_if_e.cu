@@ -250,6 +250,22 @@ class Tests_MG_TransformCountIfE
       std::cout << "MG count if e took " << elapsed_time * 1e-6 << " s.\n";
     }
 
+    // the frontier-restricted count over all the local vertices should visit every local edge
+
+    {
+      auto restricted_result = count_if_e(
+        handle,
+        mg_graph_view,
+        thrust::make_counting_iterator(mg_graph_view.get_local_vertex_first()),
+        thrust::make_counting_iterator(mg_graph_view.get_local_vertex_last()),
+        row_prop.device_view(),
+        col_prop.device_view(),
+        [] __device__(auto row, auto col, weight_t wt, auto row_property, auto col_property) {
+          return row_property < col_property;
+        });
+      ASSERT_TRUE(restricted_result == result);
+    }
+
     //// 4. compare SG & MG results
 
     if (prims_usecase.check_correctness) {
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/prims/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <cugraph/prims/count_if_e.cuh>
+#include <cugraph/prims/edge_mask.cuh>
+#include <cugraph/prims/edge_properties.cuh>
+#include <cugraph/prims/extract_if_e.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
+#include <cuco/detail/hash_functions.cuh>
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/equal.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+template <typename vertex_t>
+struct is_selected_edge_t {
+  int32_t num_edge_types{};
+
+  __device__ bool operator()(vertex_t row, vertex_t col) const
+  {
+    cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
+    return ((hash_func(row) ^ hash_func(col)) % num_edge_types) == 0;
+  }
+};
+
+struct EdgeMask_Usecase {
+  int32_t num_edge_types{4};  // roughly 1 / num_edge_types of the edges are kept
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MG_EdgeMask
+  : public ::testing::TestWithParam<std::tuple<EdgeMask_Usecase, input_usecase_t>> {
+ public:
+  Tests_MG_EdgeMask() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // push from every vertex and return the flags (1 if reached) of the local vertices
+  template <typename GraphViewType, typename EdgeOp>
+  static rmm::device_uvector<int32_t> push_from_all_vertices(raft::handle_t const& handle,
+                                                             GraphViewType const& graph_view,
+                                                             EdgeOp e_op)
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+
+    enum class Bucket { cur, next, num_buckets };
+    cugraph::VertexFrontier<vertex_t, void, true, static_cast<size_t>(Bucket::num_buckets)>
+      vertex_frontier(
+        handle, graph_view.get_local_vertex_first(), graph_view.get_local_vertex_last());
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+      .insert(thrust::make_counting_iterator(graph_view.get_local_vertex_first()),
+              thrust::make_counting_iterator(graph_view.get_local_vertex_last()));
+
+    rmm::device_uvector<int32_t> d_reached(graph_view.get_number_of_local_vertices(),
+                                           handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), d_reached.begin(), d_reached.end(), int32_t{0});
+
+    cugraph::update_frontier_v_push_if_out_nbr(
+      handle,
+      graph_view,
+      vertex_frontier,
+      static_cast<size_t>(Bucket::cur),
+      std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      e_op,
+      cugraph::reduce_op::any<vertex_t>(),
+      d_reached.data(),
+      d_reached.data(),
+      [] __device__(auto v, auto v_val, auto pushed_val) {
+        return thrust::optional<thrust::tuple<size_t, int32_t>>{
+          thrust::make_tuple(static_cast<size_t>(Bucket::next), int32_t{1})};
+      });
+
+    return d_reached;
+  }
+
+  // Compare the results of the primitives on a masked graph view to the results of the primitives
+  // filtering the same edges inside the edge operators on the unmasked view
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(EdgeMask_Usecase const& usecase, input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, true, true);
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. create the edge mask and the masked view
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    is_selected_edge_t<vertex_t> is_selected{usecase.num_edge_types};
+    cugraph::edge_mask_t<decltype(mg_graph_view)> edge_mask(handle, mg_graph_view);
+    cugraph::set_edge_mask_if_e(
+      handle,
+      mg_graph_view,
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+      cugraph::dummy_edge_properties_t<edge_t>{}.device_view(),
+      [is_selected] __device__(auto row, auto col, auto row_val, auto col_val) {
+        return is_selected(row, col);
+      },
+      edge_mask);
+    auto masked_graph_view = mg_graph_view;
+    masked_graph_view.attach_edge_mask(edge_mask.get_edge_mask_firsts());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG set_edge_mask_if_e took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (usecase.check_correctness) {
+      ASSERT_TRUE(masked_graph_view.has_edge_mask());
+      ASSERT_FALSE(mg_graph_view.has_edge_mask());
+
+      // 4. count_if_e & extract_if_e
+
+      auto num_selected_edges = cugraph::count_if_e(
+        handle,
+        mg_graph_view,
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        [is_selected] __device__(auto row, auto col, auto row_val, auto col_val) {
+          return is_selected(row, col);
+        });
+      auto num_valid_edges = cugraph::count_if_e(
+        handle,
+        masked_graph_view,
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        [] __device__(auto row, auto col, auto row_val, auto col_val) { return true; });
+      ASSERT_EQ(num_valid_edges, num_selected_edges)
+        << "count_if_e visits edges masked out by the edge mask.";
+
+      auto [rows, cols, weights] = cugraph::extract_if_e(
+        handle,
+        masked_graph_view,
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        [] __device__(auto row, auto col, auto row_val, auto col_val) { return true; });
+      auto num_extracted_edges = cugraph::host_scalar_allreduce(
+        comm, static_cast<edge_t>(rows.size()), raft::comms::op_t::SUM, handle.get_stream());
+      ASSERT_EQ(num_extracted_edges, num_selected_edges)
+        << "extract_if_e returns edges masked out by the edge mask.";
+
+      // 5. degrees (major & minor) and copy_v_transform_reduce_in|out_nbr
+
+      rmm::device_uvector<edge_t> d_reference_out_degrees(
+        mg_graph_view.get_number_of_local_vertices(), handle.get_stream());
+      cugraph::copy_v_transform_reduce_out_nbr(
+        handle,
+        mg_graph_view,
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        [is_selected] __device__(vertex_t row, vertex_t col, weight_t, auto, auto) {
+          return is_selected(row, col) ? edge_t{1} : edge_t{0};
+        },
+        edge_t{0},
+        d_reference_out_degrees.data());
+      rmm::device_uvector<edge_t> d_reference_in_degrees(
+        mg_graph_view.get_number_of_local_vertices(), handle.get_stream());
+      cugraph::copy_v_transform_reduce_in_nbr(
+        handle,
+        mg_graph_view,
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        [is_selected] __device__(vertex_t row, vertex_t col, weight_t, auto, auto) {
+          return is_selected(row, col) ? edge_t{1} : edge_t{0};
+        },
+        edge_t{0},
+        d_reference_in_degrees.data());
+
+      auto d_out_degrees = masked_graph_view.compute_out_degrees(handle);
+      auto d_in_degrees  = masked_graph_view.compute_in_degrees(handle);
+      ASSERT_TRUE(thrust::equal(handle.get_thrust_policy(),
+                                d_out_degrees.begin(),
+                                d_out_degrees.end(),
+                                d_reference_out_degrees.begin()))
+        << "compute_out_degrees counts edges masked out by the edge mask.";
+      ASSERT_TRUE(thrust::equal(handle.get_thrust_policy(),
+                                d_in_degrees.begin(),
+                                d_in_degrees.end(),
+                                d_reference_in_degrees.begin()))
+        << "compute_in_degrees counts edges masked out by the edge mask.";
+
+      // 6. update_frontier_v_push_if_out_nbr from every vertex
+
+      auto d_reference_reached = push_from_all_vertices(
+        handle, mg_graph_view, [is_selected] __device__(vertex_t src, vertex_t dst, auto, auto) {
+          return is_selected(src, dst) ? thrust::optional<vertex_t>{src} : thrust::nullopt;
+        });
+      auto d_reached = push_from_all_vertices(
+        handle, masked_graph_view, [] __device__(vertex_t src, vertex_t dst, auto, auto) {
+          return thrust::optional<vertex_t>{src};
+        });
+      ASSERT_TRUE(thrust::equal(handle.get_thrust_policy(),
+                                d_reached.begin(),
+                                d_reached.end(),
+                                d_reference_reached.begin()))
+        << "update_frontier_v_push_if_out_nbr pushes along edges masked out by the edge mask.";
+    }
+  }
+};
+
+using Tests_MG_EdgeMask_File = Tests_MG_EdgeMask<cugraph::test::File_Usecase>;
+using Tests_MG_EdgeMask_Rmat = Tests_MG_EdgeMask<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MG_EdgeMask_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MG_EdgeMask_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MG_EdgeMask_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MG_EdgeMask_File,
+  ::testing::Combine(::testing::Values(EdgeMask_Usecase{4}, EdgeMask_Usecase{1}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/web-Google.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MG_EdgeMask_Rmat,
+  ::testing::Combine(::testing::Values(EdgeMask_Usecase{4}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_large_test,
+  Tests_MG_EdgeMask_Rmat,
+  ::testing::Combine(::testing::Values(EdgeMask_Usecase{4, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
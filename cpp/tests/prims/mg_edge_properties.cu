@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/prims/edge_properties.cuh>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+#include <cugraph/prims/transform_reduce_e.cuh>
+#include <cugraph/prims/update_frontier_v_push_if_out_nbr.cuh>
+#include <cugraph/prims/vertex_frontier.cuh>
+
+#include <cuco/detail/hash_functions.cuh>
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reverse.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+template <typename vertex_t>
+struct edge_type_t {
+  int32_t num_edge_types{};
+
+  __device__ int32_t operator()(vertex_t row, vertex_t col) const
+  {
+    cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
+    return static_cast<int32_t>((hash_func(row) ^ hash_func(col)) % num_edge_types);
+  }
+};
+
+struct EdgeProperties_Usecase {
+  int32_t num_edge_types{4};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MG_EdgeProperties
+  : public ::testing::TestWithParam<std::tuple<EdgeProperties_Usecase, input_usecase_t>> {
+ public:
+  Tests_MG_EdgeProperties() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Fill per-edge types from an edge list and check that transform_reduce_e and
+  // update_frontier_v_push_if_out_nbr see the type of every edge
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(EdgeProperties_Usecase const& usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, true, true);
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. collect the local edges and assign edge types (the triplets are passed in an order
+    // different from the edge storage order)
+
+    edge_t num_local_edges{0};
+    for (size_t i = 0; i < mg_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      num_local_edges += mg_graph_view.get_matrix_partition_view(i).get_number_of_edges();
+    }
+    rmm::device_uvector<vertex_t> d_majors(num_local_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_minors(num_local_edges, handle.get_stream());
+    edge_t edge_offset{0};
+    for (size_t i = 0; i < mg_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      auto matrix_partition =
+        cugraph::matrix_partition_device_view_t<vertex_t, edge_t, weight_t, true>(
+          mg_graph_view.get_matrix_partition_view(i));
+      cugraph::detail::decompress_matrix_partition_to_edgelist(
+        handle,
+        matrix_partition,
+        d_majors.data() + edge_offset,
+        d_minors.data() + edge_offset,
+        std::optional<weight_t*>{std::nullopt},
+        mg_graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+      edge_offset += matrix_partition.get_number_of_edges();
+    }
+    thrust::reverse(handle.get_thrust_policy(), d_majors.begin(), d_majors.end());
+    thrust::reverse(handle.get_thrust_policy(), d_minors.begin(), d_minors.end());
+
+    rmm::device_uvector<int32_t> d_edge_types(num_local_edges, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      d_majors.begin(),
+                      d_majors.end(),
+                      d_minors.begin(),
+                      d_edge_types.begin(),
+                      edge_type_t<vertex_t>{usecase.num_edge_types});
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    cugraph::edge_properties_t<decltype(mg_graph_view), int32_t> edge_types(handle,
+                                                                             mg_graph_view);
+    cugraph::copy_edge_properties_from_edgelist(handle,
+                                                mg_graph_view,
+                                                d_majors.data(),
+                                                d_minors.data(),
+                                                d_edge_types.begin(),
+                                                d_majors.size(),
+                                                edge_types,
+                                                true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG copy_edge_properties_from_edgelist took " << elapsed_time * 1e-6
+                << " s.\n";
+    }
+
+    if (usecase.check_correctness) {
+      // 4. every edge sees its own type in transform_reduce_e
+
+      auto num_mismatches = cugraph::transform_reduce_e(
+        handle,
+        mg_graph_view,
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        edge_types.device_view(),
+        [edge_type = edge_type_t<vertex_t>{usecase.num_edge_types}] __device__(
+          auto row, auto col, weight_t w, auto row_val, auto col_val, int32_t type) {
+          return type != edge_type(row, col) ? edge_t{1} : edge_t{0};
+        },
+        edge_t{0});
+      ASSERT_EQ(num_mismatches, edge_t{0})
+        << "transform_reduce_e reads edge types different from the assigned ones.";
+
+      // 5. push along type 0 edges only from every vertex
+
+      enum class Bucket { cur, next, num_buckets };
+      cugraph::VertexFrontier<vertex_t, void, true, static_cast<size_t>(Bucket::num_buckets)>
+        vertex_frontier(handle,
+                        mg_graph_view.get_local_vertex_first(),
+                        mg_graph_view.get_local_vertex_last());
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+        .insert(thrust::make_counting_iterator(mg_graph_view.get_local_vertex_first()),
+                thrust::make_counting_iterator(mg_graph_view.get_local_vertex_last()));
+
+      rmm::device_uvector<int32_t> d_reached(mg_graph_view.get_number_of_local_vertices(),
+                                             handle.get_stream());
+      thrust::fill(handle.get_thrust_policy(), d_reached.begin(), d_reached.end(), int32_t{0});
+
+      cugraph::update_frontier_v_push_if_out_nbr(
+        handle,
+        mg_graph_view,
+        vertex_frontier,
+        static_cast<size_t>(Bucket::cur),
+        std::vector<size_t>{static_cast<size_t>(Bucket::next)},
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        edge_types.device_view(),
+        [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val, int32_t type) {
+          return type == 0 ? thrust::optional<vertex_t>{src} : thrust::nullopt;
+        },
+        cugraph::reduce_op::any<vertex_t>(),
+        d_reached.data(),
+        d_reached.data(),
+        [] __device__(auto v, auto v_val, auto pushed_val) {
+          return thrust::optional<thrust::tuple<size_t, int32_t>>{
+            thrust::make_tuple(static_cast<size_t>(Bucket::next), int32_t{1})};
+        });
+
+      // 6. compare with the destinations of the type 0 edges in the edge list
+
+      rmm::device_uvector<vertex_t> d_type0_minors(num_local_edges, handle.get_stream());
+      d_type0_minors.resize(
+        thrust::distance(d_type0_minors.begin(),
+                         thrust::copy_if(handle.get_thrust_policy(),
+                                         d_minors.begin(),
+                                         d_minors.end(),
+                                         d_edge_types.begin(),
+                                         d_type0_minors.begin(),
+                                         [] __device__(int32_t type) { return type == 0; })),
+        handle.get_stream());
+      auto d_all_type0_minors =
+        cugraph::test::device_gatherv(handle, d_type0_minors.data(), d_type0_minors.size());
+      auto d_all_reached =
+        cugraph::test::device_gatherv(handle, d_reached.data(), d_reached.size());
+
+      if (comm_rank == 0) {
+        thrust::sort(
+          handle.get_thrust_policy(), d_all_type0_minors.begin(), d_all_type0_minors.end());
+        auto num_reference_reached = static_cast<size_t>(thrust::distance(
+          d_all_type0_minors.begin(),
+          thrust::unique(
+            handle.get_thrust_policy(), d_all_type0_minors.begin(), d_all_type0_minors.end())));
+        auto num_reached = static_cast<size_t>(thrust::count(
+          handle.get_thrust_policy(), d_all_reached.begin(), d_all_reached.end(), int32_t{1}));
+        ASSERT_EQ(num_reached, num_reference_reached)
+          << "update_frontier_v_push_if_out_nbr does not filter edges by their types.";
+      }
+    }
+  }
+};
+
+using Tests_MG_EdgeProperties_File = Tests_MG_EdgeProperties<cugraph::test::File_Usecase>;
+using Tests_MG_EdgeProperties_Rmat = Tests_MG_EdgeProperties<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MG_EdgeProperties_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MG_EdgeProperties_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MG_EdgeProperties_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MG_EdgeProperties_File,
+  ::testing::Combine(::testing::Values(EdgeProperties_Usecase{4}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/web-Google.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MG_EdgeProperties_Rmat,
+  ::testing::Combine(::testing::Values(EdgeProperties_Usecase{4}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_large_test,
+  Tests_MG_EdgeProperties_Rmat,
+  ::testing::Combine(::testing::Values(EdgeProperties_Usecase{4, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
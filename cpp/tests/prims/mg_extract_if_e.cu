@@ -222,6 +222,44 @@ class Tests_MG_ExtractIfE
       std::cout << "MG extract_if_e took " << elapsed_time * 1e-6 << " s.\n";
     }
 
+    // 3-1. extract_if_e_to_graph should keep the same (local) edges
+
+    {
+      auto mg_subgraph = extract_if_e_to_graph(
+        handle,
+        mg_graph_view,
+        mg_src_properties.device_view(),
+        mg_dst_properties.device_view(),
+        [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) {
+          return src_val < dst_val;
+        });
+      auto mg_subgraph_view = mg_subgraph.view();
+      ASSERT_EQ(mg_subgraph_view.get_number_of_vertices(), mg_graph_view.get_number_of_vertices());
+      ASSERT_EQ(mg_subgraph_view.get_local_vertex_first(), mg_graph_view.get_local_vertex_first());
+
+      auto [mg_subgraph_srcs, mg_subgraph_dsts, mg_subgraph_weights] =
+        mg_subgraph.decompress_to_edgelist(handle, std::nullopt);
+      ASSERT_EQ(mg_subgraph_srcs.size(), mg_edgelist_srcs.size());
+
+      rmm::device_uvector<vertex_t> srcs(mg_edgelist_srcs.size(), handle.get_stream());
+      rmm::device_uvector<vertex_t> dsts(mg_edgelist_dsts.size(), handle.get_stream());
+      thrust::copy(
+        handle.get_thrust_policy(), mg_edgelist_srcs.begin(), mg_edgelist_srcs.end(), srcs.begin());
+      thrust::copy(
+        handle.get_thrust_policy(), mg_edgelist_dsts.begin(), mg_edgelist_dsts.end(), dsts.begin());
+      auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+      auto subgraph_edge_first = thrust::make_zip_iterator(
+        thrust::make_tuple(mg_subgraph_srcs.begin(), mg_subgraph_dsts.begin()));
+      thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + srcs.size());
+      thrust::sort(handle.get_thrust_policy(),
+                   subgraph_edge_first,
+                   subgraph_edge_first + mg_subgraph_srcs.size());
+      ASSERT_TRUE(thrust::equal(handle.get_thrust_policy(),
+                                edge_first,
+                                edge_first + srcs.size(),
+                                subgraph_edge_first));
+    }
+
     // 4. compare SG & MG results
 
     if (prims_usecase.check_correctness) {
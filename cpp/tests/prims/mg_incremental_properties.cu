@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/count_if_e.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <gtest/gtest.h>
+
+// vertex property values after each update step: 0) initial values, 1) a few values changed,
+// 2) all values changed, 3) no value changed
+template <typename vertex_t>
+struct value_op_t {
+  int32_t step{0};
+
+  __device__ int32_t operator()(vertex_t v) const
+  {
+    auto value = static_cast<int32_t>(v % vertex_t{1000}) * 2;
+    if ((step >= 1) && (v % vertex_t{97} == 0)) { value += 1; }
+    if (step >= 2) { value += 1000; }
+    return value;
+  }
+};
+
+struct IncrementalProperties_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MG_IncrementalProperties
+  : public ::testing::TestWithParam<std::tuple<IncrementalProperties_Usecase, input_usecase_t>> {
+ public:
+  Tests_MG_IncrementalProperties() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // after every sync(), the incremental row/col caches should match the caches filled by the full
+  // copy_to_adj_matrix_row/col
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(IncrementalProperties_Usecase const& incremental_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, true>(
+        handle, input_usecase, false, true);
+    auto mg_graph_view = mg_graph.view();
+    using graph_view_t = decltype(mg_graph_view);
+
+    cugraph::incremental_row_properties_t<graph_view_t, int32_t> incremental_row_values(
+      handle, mg_graph_view);
+    cugraph::incremental_col_properties_t<graph_view_t, int32_t> incremental_col_values(
+      handle, mg_graph_view);
+
+    rmm::device_uvector<int32_t> d_values(mg_graph_view.get_number_of_local_vertices(),
+                                          handle.get_stream());
+    for (int32_t step = 0; step < 4; ++step) {
+      thrust::transform(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(mg_graph_view.get_local_vertex_first()),
+                        thrust::make_counting_iterator(mg_graph_view.get_local_vertex_last()),
+                        d_values.begin(),
+                        value_op_t<vertex_t>{step});
+
+      incremental_row_values.sync(handle, mg_graph_view, d_values.begin());
+      incremental_col_values.sync(handle, mg_graph_view, d_values.begin());
+
+      if (incremental_usecase.check_correctness) {
+        cugraph::row_properties_t<graph_view_t, int32_t> row_values(handle, mg_graph_view);
+        cugraph::col_properties_t<graph_view_t, int32_t> col_values(handle, mg_graph_view);
+        copy_to_adj_matrix_row(handle, mg_graph_view, d_values.begin(), row_values);
+        copy_to_adj_matrix_col(handle, mg_graph_view, d_values.begin(), col_values);
+
+        // count the edges seeing a row or a col value other than the current vertex value
+        auto e_op = [step] __device__(
+                      auto row, auto col, weight_t w, auto row_value, auto col_value) {
+          return (row_value != value_op_t<vertex_t>{step}(row)) ||
+                 (col_value != value_op_t<vertex_t>{step}(col));
+        };
+        auto num_full_mismatches = count_if_e(
+          handle, mg_graph_view, row_values.device_view(), col_values.device_view(), e_op);
+        ASSERT_EQ(num_full_mismatches, edge_t{0}) << "step " << step << ".";
+        auto num_incremental_mismatches = count_if_e(handle,
+                                                     mg_graph_view,
+                                                     incremental_row_values.device_view(),
+                                                     incremental_col_values.device_view(),
+                                                     e_op);
+        ASSERT_EQ(num_incremental_mismatches, edge_t{0})
+          << "the incremental caches do not match the full copy after step " << step << ".";
+      }
+    }
+  }
+};
+
+using Tests_MG_IncrementalProperties_File =
+  Tests_MG_IncrementalProperties<cugraph::test::File_Usecase>;
+using Tests_MG_IncrementalProperties_Rmat =
+  Tests_MG_IncrementalProperties<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MG_IncrementalProperties_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MG_IncrementalProperties_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MG_IncrementalProperties_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MG_IncrementalProperties_Rmat, CheckInt64Int64FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, true>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MG_IncrementalProperties_File,
+  ::testing::Combine(
+    ::testing::Values(IncrementalProperties_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MG_IncrementalProperties_Rmat,
+  ::testing::Combine(::testing::Values(IncrementalProperties_Usecase{}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
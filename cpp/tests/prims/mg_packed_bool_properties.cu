@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/count_if_e.cuh>
+#include <cugraph/prims/row_col_properties.cuh>
+
+#include <cuco/detail/hash_functions.cuh>
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/transform.h>
+
+#include <gtest/gtest.h>
+
+template <typename vertex_t>
+struct flag_op_t {
+  int32_t mod{};
+
+  __device__ uint8_t operator()(vertex_t v) const
+  {
+    cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
+    return static_cast<uint8_t>((hash_func(v) % mod) == 0);
+  }
+};
+
+struct PackedBoolProperties_Usecase {
+  int32_t mod{3};  // roughly 1 / mod of the vertices are flagged
+};
+
+template <typename input_usecase_t>
+class Tests_MG_PackedBoolProperties
+  : public ::testing::TestWithParam<std::tuple<PackedBoolProperties_Usecase, input_usecase_t>> {
+ public:
+  Tests_MG_PackedBoolProperties() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // the packed (a bit per vertex) row/col flags should match the uint8_t row/col flags
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(PackedBoolProperties_Usecase const& packed_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, true>(
+        handle, input_usecase, false, true);
+    auto mg_graph_view = mg_graph.view();
+    using graph_view_t = decltype(mg_graph_view);
+
+    rmm::device_uvector<uint8_t> d_flags((*d_mg_renumber_map_labels).size(), handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      (*d_mg_renumber_map_labels).begin(),
+                      (*d_mg_renumber_map_labels).end(),
+                      d_flags.begin(),
+                      flag_op_t<vertex_t>{packed_usecase.mod});
+
+    cugraph::row_properties_t<graph_view_t, uint8_t> row_flags(handle, mg_graph_view);
+    cugraph::col_properties_t<graph_view_t, uint8_t> col_flags(handle, mg_graph_view);
+    copy_to_adj_matrix_row(handle, mg_graph_view, d_flags.begin(), row_flags);
+    copy_to_adj_matrix_col(handle, mg_graph_view, d_flags.begin(), col_flags);
+
+    cugraph::row_packed_bool_properties_t<graph_view_t> packed_row_flags(handle, mg_graph_view);
+    cugraph::col_packed_bool_properties_t<graph_view_t> packed_col_flags(handle, mg_graph_view);
+    copy_to_adj_matrix_row(handle, mg_graph_view, d_flags.begin(), packed_row_flags);
+    copy_to_adj_matrix_col(handle, mg_graph_view, d_flags.begin(), packed_col_flags);
+
+    auto e_op = [] __device__(auto row, auto col, weight_t w, auto row_flag, auto col_flag) {
+      return static_cast<bool>(row_flag) && !static_cast<bool>(col_flag);
+    };
+    auto expected = count_if_e(
+      handle, mg_graph_view, row_flags.device_view(), col_flags.device_view(), e_op);
+    auto result = count_if_e(
+      handle, mg_graph_view, packed_row_flags.device_view(), packed_col_flags.device_view(), e_op);
+    ASSERT_EQ(result, expected);
+
+    packed_row_flags.fill(true, handle.get_stream());
+    packed_col_flags.fill(false, handle.get_stream());
+    result = count_if_e(
+      handle, mg_graph_view, packed_row_flags.device_view(), packed_col_flags.device_view(), e_op);
+    ASSERT_EQ(result, mg_graph_view.get_number_of_edges());
+  }
+};
+
+using Tests_MG_PackedBoolProperties_File =
+  Tests_MG_PackedBoolProperties<cugraph::test::File_Usecase>;
+using Tests_MG_PackedBoolProperties_Rmat =
+  Tests_MG_PackedBoolProperties<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MG_PackedBoolProperties_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MG_PackedBoolProperties_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MG_PackedBoolProperties_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MG_PackedBoolProperties_Rmat, CheckInt64Int64FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, true>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MG_PackedBoolProperties_File,
+  ::testing::Combine(
+    ::testing::Values(PackedBoolProperties_Usecase{2}, PackedBoolProperties_Usecase{7}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MG_PackedBoolProperties_Rmat,
+  ::testing::Combine(::testing::Values(PackedBoolProperties_Usecase{3}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
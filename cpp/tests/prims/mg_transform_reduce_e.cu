@@ -29,6 +29,7 @@
 #include <cugraph/graph_view.hpp>
 #include <cugraph/matrix_partition_view.hpp>
 #include <cugraph/prims/copy_to_adj_matrix_row_col.cuh>
+#include <cugraph/prims/reduce_op.cuh>
 #include <cugraph/prims/row_col_properties.cuh>
 #include <cugraph/prims/transform_reduce_e.cuh>
 
@@ -41,6 +42,7 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <random>
 
 template <typename... Args>
@@ -297,6 +299,47 @@ class Tests_MG_TransformReduceE
       std::cout << "MG transform reduce took " << elapsed_time * 1e-6 << " s.\n";
     }
 
+    // multiple reductions in a single pass should match the reductions computed separately
+
+    {
+      auto [edge_count, min_vertex, max_vertex] = transform_multi_reduce_e(
+        handle,
+        mg_graph_view,
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        [] __device__(auto row, auto col, weight_t wt, auto, auto) {
+          return thrust::make_tuple(edge_t{1}, row < col ? row : col, row < col ? col : row);
+        },
+        thrust::make_tuple(
+          edge_t{0}, std::numeric_limits<vertex_t>::max(), std::numeric_limits<vertex_t>::lowest()),
+        cugraph::reduce_op::elementwise<cugraph::reduce_op::plus<edge_t>,
+                                        cugraph::reduce_op::min<vertex_t>,
+                                        cugraph::reduce_op::maximum<vertex_t>>{});
+      auto expected_min_vertex = transform_multi_reduce_e(
+        handle,
+        mg_graph_view,
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        [] __device__(auto row, auto col, weight_t wt, auto, auto) {
+          return row < col ? row : col;
+        },
+        std::numeric_limits<vertex_t>::max(),
+        cugraph::reduce_op::min<vertex_t>{});
+      auto expected_max_vertex = transform_multi_reduce_e(
+        handle,
+        mg_graph_view,
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        cugraph::dummy_properties_t<vertex_t>{}.device_view(),
+        [] __device__(auto row, auto col, weight_t wt, auto, auto) {
+          return row < col ? col : row;
+        },
+        std::numeric_limits<vertex_t>::lowest(),
+        cugraph::reduce_op::maximum<vertex_t>{});
+      ASSERT_EQ(edge_count, mg_graph_view.get_number_of_edges());
+      ASSERT_EQ(min_vertex, expected_min_vertex);
+      ASSERT_EQ(max_vertex, expected_max_vertex);
+    }
+
     //// 4. compare SG & MG results
 
     if (prims_usecase.check_correctness) {
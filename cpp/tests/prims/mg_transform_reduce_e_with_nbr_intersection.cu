@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/prims/transform_reduce_e_with_nbr_intersection.cuh>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+template <typename edge_t>
+struct intersection_size_t {
+  template <typename vertex_t>
+  __device__ edge_t operator()(
+    vertex_t u, vertex_t v, edge_t u_degree, edge_t v_degree, edge_t intersection_size) const
+  {
+    return intersection_size;
+  }
+};
+
+template <typename edge_t>
+struct union_size_t {
+  template <typename vertex_t>
+  __device__ edge_t operator()(
+    vertex_t u, vertex_t v, edge_t u_degree, edge_t v_degree, edge_t intersection_size) const
+  {
+    return u_degree + v_degree - intersection_size;
+  }
+};
+
+struct Prims_Usecase {
+  size_t batch_size{size_t{1} << 22};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MG_TransformReduceEWithNbrIntersection
+  : public ::testing::TestWithParam<std::tuple<Prims_Usecase, input_usecase_t>> {
+ public:
+  Tests_MG_TransformReduceEWithNbrIntersection() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the MG results to the SG results and the SG results to the host computed results
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(Prims_Usecase const& prims_usecase, input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, false, true);
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run MG transform_reduce_e_with_nbr_intersection
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto mg_intersection_size_sum =
+      cugraph::transform_reduce_e_with_nbr_intersection(handle,
+                                                        mg_graph_view,
+                                                        intersection_size_t<edge_t>{},
+                                                        edge_t{0},
+                                                        prims_usecase.batch_size);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG transform_reduce_e_with_nbr_intersection took " << elapsed_time * 1e-6
+                << " s.\n";
+    }
+
+    auto mg_union_size_sum = cugraph::transform_reduce_e_with_nbr_intersection(
+      handle, mg_graph_view, union_size_t<edge_t>{}, edge_t{0}, prims_usecase.batch_size);
+
+    // 4. compare SG & MG results
+
+    if (prims_usecase.check_correctness) {
+      cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+      std::tie(sg_graph, std::ignore) =
+        cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+          handle, input_usecase, false, false);
+      auto sg_graph_view = sg_graph.view();
+
+      auto sg_intersection_size_sum = cugraph::transform_reduce_e_with_nbr_intersection(
+        handle, sg_graph_view, intersection_size_t<edge_t>{}, edge_t{0});
+      auto sg_union_size_sum = cugraph::transform_reduce_e_with_nbr_intersection(
+        handle, sg_graph_view, union_size_t<edge_t>{}, edge_t{0});
+
+      ASSERT_EQ(mg_intersection_size_sum, sg_intersection_size_sum);
+      ASSERT_EQ(mg_union_size_sum, sg_union_size_sum);
+
+      auto [d_srcs, d_dsts, d_weights] =
+        sg_graph.decompress_to_edgelist(handle, std::nullopt, false);
+      auto h_srcs = cugraph::test::to_host(handle, d_srcs.data(), d_srcs.size());
+      auto h_dsts = cugraph::test::to_host(handle, d_dsts.data(), d_dsts.size());
+
+      std::vector<std::vector<vertex_t>> h_nbr_lists(sg_graph_view.get_number_of_vertices());
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        if (h_srcs[i] != h_dsts[i]) { h_nbr_lists[h_srcs[i]].push_back(h_dsts[i]); }
+      }
+      for (auto& nbrs : h_nbr_lists) {
+        std::sort(nbrs.begin(), nbrs.end());
+      }
+
+      edge_t h_intersection_size_sum{0};
+      edge_t h_union_size_sum{0};
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        if (h_srcs[i] == h_dsts[i]) { continue; }
+        auto const& u_nbrs = h_nbr_lists[h_srcs[i]];
+        auto const& v_nbrs = h_nbr_lists[h_dsts[i]];
+        std::vector<vertex_t> intersection{};
+        std::set_intersection(u_nbrs.begin(),
+                              u_nbrs.end(),
+                              v_nbrs.begin(),
+                              v_nbrs.end(),
+                              std::back_inserter(intersection));
+        auto intersection_size = static_cast<edge_t>(intersection.size());
+        h_intersection_size_sum += intersection_size;
+        h_union_size_sum += static_cast<edge_t>(u_nbrs.size() + v_nbrs.size()) - intersection_size;
+      }
+
+      ASSERT_EQ(sg_intersection_size_sum, h_intersection_size_sum);
+      ASSERT_EQ(sg_union_size_sum, h_union_size_sum);
+    }
+  }
+};
+
+using Tests_MG_TransformReduceEWithNbrIntersection_File =
+  Tests_MG_TransformReduceEWithNbrIntersection<cugraph::test::File_Usecase>;
+using Tests_MG_TransformReduceEWithNbrIntersection_Rmat =
+  Tests_MG_TransformReduceEWithNbrIntersection<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MG_TransformReduceEWithNbrIntersection_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MG_TransformReduceEWithNbrIntersection_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MG_TransformReduceEWithNbrIntersection_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MG_TransformReduceEWithNbrIntersection_File,
+  ::testing::Combine(
+    // small batches to exercise the batched fetch of the remote neighbor lists
+    ::testing::Values(Prims_Usecase{size_t{64}, true}, Prims_Usecase{size_t{1} << 22, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MG_TransformReduceEWithNbrIntersection_Rmat,
+  ::testing::Combine(::testing::Values(Prims_Usecase{size_t{1024}, true}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_large_test,
+  Tests_MG_TransformReduceEWithNbrIntersection_Rmat,
+  ::testing::Combine(::testing::Values(Prims_Usecase{size_t{1} << 22, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
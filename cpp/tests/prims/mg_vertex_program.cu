@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/prims/reduce_op.cuh>
+#include <cugraph/prims/vertex_program.cuh>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/equal.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/sequence.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <optional>
+
+// BFS as a vertex program (min reduction, push only)
+template <typename vertex_t>
+struct bfs_scatter_op_t {
+  template <typename weight_t>
+  __device__ thrust::optional<vertex_t> operator()(vertex_t src,
+                                                   vertex_t dst,
+                                                   weight_t w,
+                                                   vertex_t src_distance) const
+  {
+    return thrust::optional<vertex_t>{src_distance + 1};
+  }
+};
+
+template <typename vertex_t>
+struct bfs_apply_op_t {
+  __device__ thrust::optional<vertex_t> operator()(vertex_t v,
+                                                   vertex_t distance,
+                                                   vertex_t new_distance) const
+  {
+    return new_distance < distance ? thrust::optional<vertex_t>{new_distance} : thrust::nullopt;
+  }
+};
+
+// in-degree computation as a vertex program (plus reduction, push or pull)
+template <typename vertex_t, typename edge_t>
+struct in_degree_scatter_op_t {
+  template <typename weight_t>
+  __device__ thrust::optional<edge_t> operator()(vertex_t src,
+                                                 vertex_t dst,
+                                                 weight_t w,
+                                                 edge_t src_val) const
+  {
+    return thrust::optional<edge_t>{edge_t{1}};
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct in_degree_apply_op_t {
+  __device__ thrust::optional<edge_t> operator()(vertex_t v, edge_t val, edge_t count) const
+  {
+    return thrust::optional<edge_t>{val + count};
+  }
+};
+
+struct VertexProgram_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MG_VertexProgram
+  : public ::testing::TestWithParam<std::tuple<VertexProgram_Usecase, input_usecase_t>> {
+ public:
+  Tests_MG_VertexProgram() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of the vertex programs to the results of the library functions
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(VertexProgram_Usecase const& usecase, input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, false, true);
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run BFS as a vertex program
+
+    auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+    vertex_t source{0};
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    rmm::device_uvector<vertex_t> d_mg_distances(mg_graph_view.get_number_of_local_vertices(),
+                                                 handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(),
+                 d_mg_distances.begin(),
+                 d_mg_distances.end(),
+                 invalid_distance);
+    auto source_is_local = mg_graph_view.is_local_vertex_nocheck(source);
+    if (source_is_local) {
+      d_mg_distances.set_element_to_zero_async(source - mg_graph_view.get_local_vertex_first(),
+                                               handle.get_stream());
+    }
+    rmm::device_scalar<vertex_t> d_source(source, handle.get_stream());
+    cugraph::run_vertex_program(handle,
+                                mg_graph_view,
+                                d_mg_distances.begin(),
+                                d_source.data(),
+                                d_source.data() + (source_is_local ? 1 : 0),
+                                bfs_scatter_op_t<vertex_t>{},
+                                cugraph::reduce_op::min<vertex_t>{},
+                                bfs_apply_op_t<vertex_t>{});
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG vertex program BFS took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. run in-degree computation as a vertex program in the pull & push directions
+
+    rmm::device_uvector<edge_t> d_mg_pull_in_degrees(mg_graph_view.get_number_of_local_vertices(),
+                                                     handle.get_stream());
+    rmm::device_uvector<edge_t> d_mg_push_in_degrees(d_mg_pull_in_degrees.size(),
+                                                     handle.get_stream());
+    for (auto allow_pull : {true, false}) {
+      auto& d_in_degrees = allow_pull ? d_mg_pull_in_degrees : d_mg_push_in_degrees;
+      thrust::fill(handle.get_thrust_policy(), d_in_degrees.begin(), d_in_degrees.end(), edge_t{0});
+      auto num_supersteps = cugraph::run_vertex_program(
+        handle,
+        mg_graph_view,
+        d_in_degrees.begin(),
+        thrust::make_counting_iterator(mg_graph_view.get_local_vertex_first()),
+        thrust::make_counting_iterator(mg_graph_view.get_local_vertex_last()),
+        in_degree_scatter_op_t<vertex_t, edge_t>{},
+        cugraph::reduce_op::plus<edge_t>{},
+        in_degree_apply_op_t<vertex_t, edge_t>{},
+        size_t{1},
+        allow_pull);
+      ASSERT_EQ(num_supersteps, size_t{1});
+    }
+
+    // 5. compare the results
+
+    if (usecase.check_correctness) {
+      rmm::device_uvector<vertex_t> d_mg_bfs_distances(
+        mg_graph_view.get_number_of_local_vertices(), handle.get_stream());
+      rmm::device_uvector<vertex_t> d_mg_bfs_predecessors(
+        mg_graph_view.get_number_of_local_vertices(), handle.get_stream());
+      cugraph::bfs(handle,
+                   mg_graph_view,
+                   d_mg_bfs_distances.data(),
+                   d_mg_bfs_predecessors.data(),
+                   source_is_local ? d_source.data() : static_cast<vertex_t const*>(nullptr),
+                   source_is_local ? size_t{1} : size_t{0},
+                   false,
+                   std::numeric_limits<vertex_t>::max());
+      ASSERT_TRUE(thrust::equal(handle.get_thrust_policy(),
+                                d_mg_distances.begin(),
+                                d_mg_distances.end(),
+                                d_mg_bfs_distances.begin()))
+        << "BFS distances computed by the vertex program differ.";
+
+      auto d_mg_in_degrees = mg_graph_view.compute_in_degrees(handle);
+      ASSERT_TRUE(thrust::equal(handle.get_thrust_policy(),
+                                d_mg_pull_in_degrees.begin(),
+                                d_mg_pull_in_degrees.end(),
+                                d_mg_in_degrees.begin()))
+        << "In-degrees computed by the vertex program in the pull direction differ.";
+      ASSERT_TRUE(thrust::equal(handle.get_thrust_policy(),
+                                d_mg_push_in_degrees.begin(),
+                                d_mg_push_in_degrees.end(),
+                                d_mg_in_degrees.begin()))
+        << "In-degrees computed by the vertex program in the push direction differ.";
+    }
+  }
+};
+
+using Tests_MG_VertexProgram_File = Tests_MG_VertexProgram<cugraph::test::File_Usecase>;
+using Tests_MG_VertexProgram_Rmat = Tests_MG_VertexProgram<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MG_VertexProgram_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MG_VertexProgram_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MG_VertexProgram_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MG_VertexProgram_File,
+  ::testing::Combine(
+    ::testing::Values(VertexProgram_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MG_VertexProgram_Rmat,
+  ::testing::Combine(::testing::Values(VertexProgram_Usecase{true}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_large_test,
+  Tests_MG_VertexProgram_Rmat,
+  ::testing::Combine(::testing::Values(VertexProgram_Usecase{false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include "random_walks_utils.cuh"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+struct MGRandomWalks_Usecase {
+  int sampling_id{0};  // 0 == uniform, 1 == biased, 2 == node2vec
+  size_t num_paths_per_gpu{10};
+  size_t max_depth{10};
+  bool use_padding{false};
+  bool check_correctness{true};
+  bool use_alias_tables{false};
+};
+
+template <typename input_usecase_t>
+class Tests_MGRandomWalks
+  : public ::testing::TestWithParam<std::tuple<MGRandomWalks_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGRandomWalks() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Check that the paths generated on multiple GPUs are valid paths of the (single-GPU) graph
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MGRandomWalks_Usecase const& rw_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, true, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run MG random walks (starting vertices need not be local)
+
+    auto num_paths        = static_cast<edge_t>(rw_usecase.num_paths_per_gpu);
+    auto max_depth        = static_cast<edge_t>(rw_usecase.max_depth);
+    vertex_t num_vertices = mg_graph_view.get_number_of_vertices();
+
+    auto start_offset = static_cast<edge_t>(comm_rank) * num_paths;
+    rmm::device_uvector<vertex_t> d_start(num_paths, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator<edge_t>(start_offset),
+                      thrust::make_counting_iterator<edge_t>(start_offset + num_paths),
+                      d_start.begin(),
+                      [num_vertices] __device__(auto indx) {
+                        return static_cast<vertex_t>(indx % num_vertices);
+                      });
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [d_mg_coalesced_v, d_mg_coalesced_w, d_mg_sizes] = cugraph::random_walks(
+      handle,
+      mg_graph_view,
+      d_start.data(),
+      num_paths,
+      max_depth,
+      rw_usecase.use_padding,
+      std::make_unique<cugraph::sampling_params_t>(
+        rw_usecase.sampling_id, 4.0, 8.0, false, rw_usecase.use_alias_tables));
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG random walks took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (rw_usecase.use_padding) {
+      ASSERT_EQ(d_mg_coalesced_v.size(), static_cast<size_t>(num_paths * max_depth));
+      ASSERT_EQ(d_mg_sizes.size(), size_t{0});
+    } else {
+      ASSERT_EQ(d_mg_sizes.size(), static_cast<size_t>(num_paths));
+      ASSERT_EQ(d_mg_coalesced_v.size(),
+                static_cast<size_t>(thrust::reduce(
+                  handle.get_thrust_policy(), d_mg_sizes.begin(), d_mg_sizes.end(), edge_t{0})));
+      ASSERT_EQ(d_mg_coalesced_w.size(), d_mg_coalesced_v.size() - d_mg_sizes.size());
+    }
+
+    // 4. check the MG paths against the SG graph
+
+    if (rw_usecase.check_correctness) {
+      // 4-1. aggregate MG results
+
+      auto d_mg_aggregate_renumber_map_labels = cugraph::test::device_gatherv(
+        handle, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+      auto d_mg_aggregate_coalesced_v =
+        cugraph::test::device_gatherv(handle, d_mg_coalesced_v.data(), d_mg_coalesced_v.size());
+      auto d_mg_aggregate_coalesced_w =
+        cugraph::test::device_gatherv(handle, d_mg_coalesced_w.data(), d_mg_coalesced_w.size());
+      auto d_mg_aggregate_sizes =
+        cugraph::test::device_gatherv(handle, d_mg_sizes.data(), d_mg_sizes.size());
+
+      if (handle.get_comms().get_rank() == int{0}) {
+        // 4-2. unrenumber MG results (padding excluded)
+
+        if (rw_usecase.use_padding) {
+          thrust::transform(handle.get_thrust_policy(),
+                            d_mg_aggregate_coalesced_v.begin(),
+                            d_mg_aggregate_coalesced_v.end(),
+                            d_mg_aggregate_coalesced_v.begin(),
+                            [num_vertices,
+                             ptr_labels = d_mg_aggregate_renumber_map_labels.data()] __device__(
+                              auto v) { return v == num_vertices ? v : ptr_labels[v]; });
+        } else {
+          cugraph::unrenumber_int_vertices<vertex_t, false>(
+            handle,
+            d_mg_aggregate_coalesced_v.data(),
+            d_mg_aggregate_coalesced_v.size(),
+            d_mg_aggregate_renumber_map_labels.data(),
+            std::vector<vertex_t>{num_vertices});
+        }
+
+        // 4-3. create SG graph
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, true, false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_EQ(mg_graph_view.get_number_of_vertices(), sg_graph_view.get_number_of_vertices());
+
+        // 4-4. compare
+
+        bool test_all_paths =
+          cugraph::test::host_check_rw_paths(handle,
+                                             sg_graph_view,
+                                             d_mg_aggregate_coalesced_v,
+                                             d_mg_aggregate_coalesced_w,
+                                             d_mg_aggregate_sizes,
+                                             static_cast<edge_t>(num_paths * comm_size));
+
+        ASSERT_TRUE(test_all_paths);
+      }
+    }
+  }
+};
+
+using Tests_MGRandomWalks_File = Tests_MGRandomWalks<cugraph::test::File_Usecase>;
+using Tests_MGRandomWalks_Rmat = Tests_MGRandomWalks<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGRandomWalks_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGRandomWalks_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGRandomWalks_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGRandomWalks_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MGRandomWalks_Usecase{0, 10, 10, false},
+                      MGRandomWalks_Usecase{1, 10, 10, false},
+                      MGRandomWalks_Usecase{2, 10, 10, false},
+                      MGRandomWalks_Usecase{0, 10, 10, true},
+                      MGRandomWalks_Usecase{2, 10, 10, true},
+                      MGRandomWalks_Usecase{1, 10, 10, false, true, true},
+                      MGRandomWalks_Usecase{2, 10, 10, false, true, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGRandomWalks_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MGRandomWalks_Usecase{0, 100, 20, false},
+                      MGRandomWalks_Usecase{1, 100, 20, false},
+                      MGRandomWalks_Usecase{2, 100, 20, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGRandomWalks_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MGRandomWalks_Usecase{0, 1000000, 80, false, false},
+                      MGRandomWalks_Usecase{2, 1000000, 80, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// checks a hop of the sample against the (host) CSR: every sampled edge exists (as many times as
+// it is sampled), every frontier vertex has min(fanout, # selectable out-edges) sampled edges, and
+// no vertex outside the frontier appears as a source
+template <typename vertex_t, typename edge_t, typename weight_t>
+void check_sample_hop(std::vector<edge_t> const& h_offsets,
+                      std::vector<vertex_t> const& h_indices,
+                      std::optional<std::vector<weight_t>> const& h_weights,
+                      std::set<vertex_t> const& frontier,
+                      std::vector<vertex_t> const& h_srcs,
+                      std::vector<vertex_t> const& h_dsts,
+                      size_t fanout)
+{
+  std::map<std::pair<vertex_t, vertex_t>, size_t> sampled_counts{};
+  std::map<vertex_t, size_t> src_counts{};
+  for (size_t i = 0; i < h_srcs.size(); ++i) {
+    ASSERT_TRUE(frontier.find(h_srcs[i]) != frontier.end())
+      << "a sampled edge source is not in the frontier.";
+    ++sampled_counts[std::make_pair(h_srcs[i], h_dsts[i])];
+    ++src_counts[h_srcs[i]];
+  }
+
+  for (auto const& [edge, count] : sampled_counts) {
+    auto first = h_indices.begin() + h_offsets[edge.first];
+    auto last  = h_indices.begin() + h_offsets[edge.first + 1];
+    ASSERT_TRUE(static_cast<size_t>(std::count(first, last, edge.second)) >= count)
+      << "a sampled edge does not exist or is sampled more than once.";
+  }
+
+  for (auto v : frontier) {
+    size_t num_selectable{0};
+    for (auto j = h_offsets[v]; j < h_offsets[v + 1]; ++j) {
+      if (!h_weights || ((*h_weights)[j] > weight_t{0.0})) { ++num_selectable; }
+    }
+    auto it = src_counts.find(v);
+    ASSERT_EQ(it != src_counts.end() ? (*it).second : size_t{0}, std::min(fanout, num_selectable))
+      << "the number of sampled neighbors is not min(fanout, degree).";
+  }
+}
+
+struct SampleNeighbors_Usecase {
+  std::vector<size_t> fanouts{};
+  size_t num_seeds{0};
+  bool weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGSampleNeighbors
+  : public ::testing::TestWithParam<std::tuple<SampleNeighbors_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGSampleNeighbors() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Check the multi-GPU sample (unrenumbered) against the single-GPU graph
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SampleNeighbors_Usecase const& sample_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, sample_usecase.weighted, true);
+    auto mg_graph_view = mg_graph.view();
+
+    // seeds are evenly spaced (in the renumbered vertex ID space), each GPU passes its local ones
+
+    auto num_seeds = std::min(sample_usecase.num_seeds,
+                              static_cast<size_t>(mg_graph_view.get_number_of_vertices()));
+    std::vector<vertex_t> h_mg_seeds{};
+    for (size_t i = 0; i < num_seeds; ++i) {
+      auto v = static_cast<vertex_t>((i * mg_graph_view.get_number_of_vertices()) / num_seeds);
+      if (mg_graph_view.is_local_vertex_nocheck(v)) { h_mg_seeds.push_back(v); }
+    }
+    rmm::device_uvector<vertex_t> d_mg_seeds(h_mg_seeds.size(), handle.get_stream());
+    raft::update_device(
+      d_mg_seeds.data(), h_mg_seeds.data(), h_mg_seeds.size(), handle.get_stream());
+
+    // 3. run MG sample_neighbors
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto mg_hops = cugraph::sample_neighbors(handle,
+                                             mg_graph_view,
+                                             d_mg_seeds.data(),
+                                             d_mg_seeds.size(),
+                                             sample_usecase.fanouts,
+                                             sample_usecase.weighted,
+                                             uint64_t{0},
+                                             true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG sample_neighbors took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. check the MG sample
+
+    if (sample_usecase.check_correctness) {
+      ASSERT_EQ(mg_hops.size(), sample_usecase.fanouts.size());
+
+      // 4-1. aggregate and unrenumber MG results
+
+      auto d_mg_aggregate_renumber_map_labels = cugraph::test::device_gatherv(
+        handle, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+      auto d_mg_aggregate_seeds =
+        cugraph::test::device_gatherv(handle, d_mg_seeds.data(), d_mg_seeds.size());
+      std::vector<std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>>
+        d_mg_aggregate_hops{};
+      for (auto const& [d_mg_srcs, d_mg_dsts] : mg_hops) {
+        d_mg_aggregate_hops.push_back(std::make_tuple(
+          cugraph::test::device_gatherv(handle, d_mg_srcs.data(), d_mg_srcs.size()),
+          cugraph::test::device_gatherv(handle, d_mg_dsts.data(), d_mg_dsts.size())));
+      }
+
+      if (handle.get_comms().get_rank() == int{0}) {
+        std::vector<vertex_t> h_renumber_map_labels(d_mg_aggregate_renumber_map_labels.size());
+        raft::update_host(h_renumber_map_labels.data(),
+                          d_mg_aggregate_renumber_map_labels.data(),
+                          d_mg_aggregate_renumber_map_labels.size(),
+                          handle.get_stream());
+        std::vector<vertex_t> h_seeds(d_mg_aggregate_seeds.size());
+        raft::update_host(h_seeds.data(),
+                          d_mg_aggregate_seeds.data(),
+                          d_mg_aggregate_seeds.size(),
+                          handle.get_stream());
+        handle.get_stream_view().synchronize();
+        std::transform(h_seeds.begin(), h_seeds.end(), h_seeds.begin(), [&](auto v) {
+          return h_renumber_map_labels[v];
+        });
+
+        // 4-2. create SG graph
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, sample_usecase.weighted, false);
+        auto sg_graph_view = sg_graph.view();
+
+        std::vector<edge_t> h_offsets(sg_graph_view.get_number_of_vertices() + 1);
+        std::vector<vertex_t> h_indices(sg_graph_view.get_number_of_edges());
+        raft::update_host(h_offsets.data(),
+                          sg_graph_view.get_matrix_partition_view().get_offsets(),
+                          sg_graph_view.get_number_of_vertices() + 1,
+                          handle.get_stream());
+        raft::update_host(h_indices.data(),
+                          sg_graph_view.get_matrix_partition_view().get_indices(),
+                          sg_graph_view.get_number_of_edges(),
+                          handle.get_stream());
+        auto h_weights = sample_usecase.weighted ? std::make_optional<std::vector<weight_t>>(
+                                                     sg_graph_view.get_number_of_edges())
+                                                 : std::nullopt;
+        if (h_weights) {
+          raft::update_host((*h_weights).data(),
+                            *(sg_graph_view.get_matrix_partition_view().get_weights()),
+                            sg_graph_view.get_number_of_edges(),
+                            handle.get_stream());
+        }
+        handle.get_stream_view().synchronize();
+
+        // 4-3. check every hop against the SG graph
+
+        std::set<vertex_t> frontier(h_seeds.begin(), h_seeds.end());
+        for (size_t hop = 0; hop < d_mg_aggregate_hops.size(); ++hop) {
+          auto const& [d_srcs, d_dsts] = d_mg_aggregate_hops[hop];
+          std::vector<vertex_t> h_srcs(d_srcs.size());
+          std::vector<vertex_t> h_dsts(d_dsts.size());
+          raft::update_host(h_srcs.data(), d_srcs.data(), d_srcs.size(), handle.get_stream());
+          raft::update_host(h_dsts.data(), d_dsts.data(), d_dsts.size(), handle.get_stream());
+          handle.get_stream_view().synchronize();
+          std::transform(h_srcs.begin(), h_srcs.end(), h_srcs.begin(), [&](auto v) {
+            return h_renumber_map_labels[v];
+          });
+          std::transform(h_dsts.begin(), h_dsts.end(), h_dsts.begin(), [&](auto v) {
+            return h_renumber_map_labels[v];
+          });
+
+          check_sample_hop(h_offsets,
+                           h_indices,
+                           h_weights,
+                           frontier,
+                           h_srcs,
+                           h_dsts,
+                           sample_usecase.fanouts[hop]);
+          if (::testing::Test::HasFatalFailure()) { return; }
+
+          frontier = std::set<vertex_t>(h_dsts.begin(), h_dsts.end());
+        }
+      }
+    }
+  }
+};
+
+using Tests_MGSampleNeighbors_File = Tests_MGSampleNeighbors<cugraph::test::File_Usecase>;
+using Tests_MGSampleNeighbors_Rmat = Tests_MGSampleNeighbors<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGSampleNeighbors_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGSampleNeighbors_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGSampleNeighbors_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGSampleNeighbors_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGSampleNeighbors_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SampleNeighbors_Usecase{{10, 5}, 16, false},
+                      SampleNeighbors_Usecase{{10, 5}, 16, true},
+                      SampleNeighbors_Usecase{{2, 2, 2}, 64, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGSampleNeighbors_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SampleNeighbors_Usecase{{10, 5}, 64, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGSampleNeighbors_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(SampleNeighbors_Usecase{{25, 10}, 1024, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
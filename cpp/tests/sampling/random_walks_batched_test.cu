@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include "random_walks_utils.cuh"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+struct RandomWalksBatched_Usecase {
+  int sampling_id{0};  // 0 == uniform, 1 == biased, 2 == node2vec
+  size_t num_paths{100};
+  size_t max_depth{10};
+  size_t max_paths_per_batch{16};
+  bool use_padding{false};
+  bool overlap_output{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_RandomWalksBatched
+  : public ::testing::TestWithParam<std::tuple<RandomWalksBatched_Usecase, input_usecase_t>> {
+ public:
+  Tests_RandomWalksBatched() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(RandomWalksBatched_Usecase const& rw_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle(1);  // 1 internal stream, for the (overlapped) output
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+
+    auto graph_view = graph.view();
+
+    auto num_paths        = static_cast<edge_t>(rw_usecase.num_paths);
+    auto max_depth        = static_cast<edge_t>(rw_usecase.max_depth);
+    vertex_t num_vertices = graph_view.get_number_of_vertices();
+
+    rmm::device_uvector<vertex_t> d_start(num_paths, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator<edge_t>(0),
+                      thrust::make_counting_iterator<edge_t>(num_paths),
+                      d_start.begin(),
+                      [num_vertices] __device__(auto indx) {
+                        return static_cast<vertex_t>(indx % num_vertices);
+                      });
+
+    // the batches are checked on the fly, hence (at most) one batch is alive at any time:
+    //
+    edge_t next_path_first{0};
+    bool test_all_paths{true};
+
+    auto batch_op = [&](edge_t path_first,
+                        rmm::device_uvector<vertex_t>&& d_coalesced_v,
+                        rmm::device_uvector<weight_t>&& d_coalesced_w,
+                        rmm::device_uvector<edge_t>&& d_sizes,
+                        rmm::cuda_stream_view stream) {
+      auto batch_coalesced_v = std::move(d_coalesced_v);
+      auto batch_coalesced_w = std::move(d_coalesced_w);
+      auto batch_sizes       = std::move(d_sizes);
+      stream.synchronize();
+
+      EXPECT_EQ(path_first, next_path_first);
+      auto batch_num_paths = std::min(static_cast<edge_t>(rw_usecase.max_paths_per_batch),
+                                      num_paths - path_first);
+      next_path_first += batch_num_paths;
+
+      if (rw_usecase.use_padding) {
+        EXPECT_EQ(batch_coalesced_v.size(), static_cast<size_t>(batch_num_paths * max_depth));
+        EXPECT_EQ(batch_sizes.size(), size_t{0});
+      } else {
+        EXPECT_EQ(batch_sizes.size(), static_cast<size_t>(batch_num_paths));
+      }
+
+      if (rw_usecase.check_correctness) {
+        test_all_paths = test_all_paths && cugraph::test::host_check_rw_paths(handle,
+                                                                              graph_view,
+                                                                              batch_coalesced_v,
+                                                                              batch_coalesced_w,
+                                                                              batch_sizes,
+                                                                              batch_num_paths);
+      }
+    };
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::random_walks_batched(
+      handle,
+      graph_view,
+      d_start.data(),
+      num_paths,
+      max_depth,
+      rw_usecase.use_padding,
+      std::make_unique<cugraph::sampling_params_t>(rw_usecase.sampling_id, 4.0, 8.0, false),
+      static_cast<edge_t>(rw_usecase.max_paths_per_batch),
+      cugraph::random_walks_batch_op_t<vertex_t, weight_t, edge_t>{batch_op},
+      rw_usecase.overlap_output);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "batched random walks took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    ASSERT_EQ(next_path_first, num_paths);
+    ASSERT_TRUE(test_all_paths);
+  }
+};
+
+using Tests_RandomWalksBatched_File = Tests_RandomWalksBatched<cugraph::test::File_Usecase>;
+using Tests_RandomWalksBatched_Rmat = Tests_RandomWalksBatched<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_RandomWalksBatched_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_RandomWalksBatched_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_RandomWalksBatched_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_RandomWalksBatched_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(RandomWalksBatched_Usecase{0, 100, 10, 16, false, false},
+                      RandomWalksBatched_Usecase{1, 100, 10, 16, false, true},
+                      RandomWalksBatched_Usecase{2, 100, 10, 7, false, false},
+                      RandomWalksBatched_Usecase{0, 100, 10, 100, true, true},
+                      RandomWalksBatched_Usecase{2, 100, 10, 33, true, false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_RandomWalksBatched_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(RandomWalksBatched_Usecase{0, 1000, 20, 128, false, true},
+                      RandomWalksBatched_Usecase{1, 1000, 20, 128, false, false},
+                      RandomWalksBatched_Usecase{2, 1000, 20, 128, false, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_RandomWalksBatched_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(RandomWalksBatched_Usecase{0, 10000000, 80, 1000000, false, true, false},
+                      RandomWalksBatched_Usecase{2, 10000000, 80, 1000000, false, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
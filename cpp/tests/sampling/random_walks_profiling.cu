@@ -14,8 +14,9 @@
  * limitations under the License.
  */
 
-#include <utilities/base_fixture.hpp>  // cugraph::test::create_memory_resource()
+#include <utilities/cxxopts.hpp>
 #include <utilities/high_res_timer.hpp>
+#include <utilities/rmm_utilities.hpp>  // cugraph::test::create_memory_resource()
 #include <utilities/test_utilities.hpp>
 
 #include <cugraph/algorithms.hpp>
@@ -25,6 +26,7 @@
 #include <raft/random/rng.hpp>
 
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <cuda_profiler_api.h>
 #include <thrust/random.h>
@@ -33,6 +35,7 @@
 #include <iterator>
 #include <limits>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 
 /**
@@ -57,7 +60,7 @@ void fill_start(raft::handle_t const& handle,
 
 namespace impl_details = cugraph::detail;
 
-enum class traversal_id_t : int { HORIZONTAL = 0, VERTICAL };
+enum class traversal_id_t : int { HORIZONTAL = 0, VERTICAL, PERSISTENT };
 
 /**
  * @internal
@@ -68,7 +71,8 @@ template <typename graph_vt>
 void output_random_walks_time(graph_vt const& graph_view,
                               typename graph_vt::edge_type num_paths,
                               traversal_id_t trv_id,
-                              int sampling_id)
+                              int sampling_id,
+                              typename graph_vt::edge_type max_depth = 10)
 {
   using vertex_t = typename graph_vt::vertex_type;
   using edge_t   = typename graph_vt::edge_type;
@@ -85,15 +89,50 @@ void output_random_walks_time(graph_vt const& graph_view,
   //
   impl_details::device_const_vector_view<vertex_t, edge_t> d_start_view{d_start.data(), num_paths};
 
-  edge_t max_depth{10};
-
   weight_t p{4};
   weight_t q{8};
 
   HighResTimer hr_timer;
   std::string label{};
 
-  if (trv_id == traversal_id_t::HORIZONTAL) {
+  if (trv_id == traversal_id_t::PERSISTENT) {
+    auto time_persistent_walks = [&](auto const& selector) {
+      hr_timer.start(label);
+      cudaProfilerStart();
+
+      auto ret_tuple = impl_details::random_walks_impl<graph_vt,
+                                                       std::decay_t<decltype(selector)>,
+                                                       impl_details::persistent_traversal_t>(
+        handle,  // prevent clang-format to separate function name from its namespace
+        graph_view,
+        d_start_view,
+        max_depth,
+        selector);
+
+      cudaProfilerStop();
+      hr_timer.stop();
+    };
+
+    if (sampling_id == 0) {
+      label = std::string("RandomWalks; Persistent traversal; uniform sampling - ");
+      time_persistent_walks(
+        impl_details::uniform_selector_t<graph_vt, real_t>{handle, graph_view, real_t{0}});
+    } else if (sampling_id == 1) {
+      label = std::string("RandomWalks; Persistent traversal; biased sampling - ");
+      time_persistent_walks(
+        impl_details::biased_selector_t<graph_vt, real_t>{handle, graph_view, real_t{0}});
+    } else if (sampling_id == 2) {
+      label =
+        std::string("RandomWalks; Persistent traversal; node2vec sampling with alpha cache - ");
+      time_persistent_walks(impl_details::node2vec_selector_t<graph_vt, real_t>{
+        handle, graph_view, real_t{0}, p, q, num_paths});
+    } else {
+      label =
+        std::string("RandomWalks; Persistent traversal; node2vec sampling without alpha cache - ");
+      time_persistent_walks(
+        impl_details::node2vec_selector_t<graph_vt, real_t>{handle, graph_view, real_t{0}, p, q});
+    }
+  } else if (trv_id == traversal_id_t::HORIZONTAL) {
     if (sampling_id == 0) {
       label = std::string("RandomWalks; Horizontal traversal; uniform sampling - ");
       impl_details::uniform_selector_t<graph_vt, real_t> selector{handle, graph_view, real_t{0}};
@@ -250,7 +289,7 @@ void output_random_walks_time(graph_vt const& graph_view,
   try {
     auto runtime = hr_timer.get_average_runtime(label);
 
-    std::cout << "RW for num_paths: " << num_paths
+    std::cout << "RW for num_paths: " << num_paths << ", max_depth: " << max_depth
               << ", runtime [ms] / path: " << runtime / num_paths << ":\n";
 
   } catch (std::exception const& ex) {
@@ -306,9 +345,15 @@ struct RandomWalks_Usecase {
  * @param[in] configuration RandomWalks_Usecase instance containing the input
  * file to read for constructing the graph_t.
  * @param[in] trv_id traversal strategy.
+ * @param[in] sampling_id sampling strategy (0: uniform, 1: biased, 2 (3): node2vec with (without)
+ * alpha cache).
+ * @param[in] max_depth maximum length of each path.
  */
 template <typename vertex_t, typename edge_t, typename weight_t>
-void run(RandomWalks_Usecase const& configuration, traversal_id_t trv_id, int sampling_id)
+void run(RandomWalks_Usecase const& configuration,
+         traversal_id_t trv_id,
+         int sampling_id,
+         edge_t max_depth = 10)
 {
   raft::handle_t handle{};
 
@@ -323,7 +368,7 @@ void run(RandomWalks_Usecase const& configuration, traversal_id_t trv_id, int sa
   // configuration input instead of hardcoding here.
   std::vector<edge_t> v_np{1, 10, 100};
   for (auto&& num_paths : v_np) {
-    output_random_walks_time(graph_view, num_paths, trv_id, sampling_id);
+    output_random_walks_time(graph_view, num_paths, trv_id, sampling_id, max_depth);
   }
 }
 
@@ -334,7 +379,8 @@ void run(RandomWalks_Usecase const& configuration, traversal_id_t trv_id, int sa
  * resulting executable takes the following options: "rmm_mode" which can be one
  * of "binning", "cuda", "pool", or "managed.  "dataset" which is a path
  * relative to the env var RAPIDS_DATASET_ROOT_DIR to a input .mtx file to use
- * to populate the graph_t instance.
+ * to populate the graph_t instance. "long_max_depth" which is the maximum path
+ * length of the final (long walks) comparison of the traversal strategies.
  *
  * To use the default values of rmm_mode=pool and
  * dataset=test/datasets/karate.mtx:
@@ -358,9 +404,13 @@ int main(int argc, char** argv)
     "rmm_mode", "RMM allocation mode", cxxopts::value<std::string>()->default_value("pool"));
   options.add_options()(
     "dataset", "dataset", cxxopts::value<std::string>()->default_value("test/datasets/karate.mtx"));
+  options.add_options()("long_max_depth",
+                        "maximum path length for the long walks comparison",
+                        cxxopts::value<int32_t>()->default_value("1000"));
   auto const cmd_options = options.parse(argc, argv);
-  auto const rmm_mode    = cmd_options["rmm_mode"].as<std::string>();
-  auto const dataset     = cmd_options["dataset"].as<std::string>();
+  auto const rmm_mode       = cmd_options["rmm_mode"].as<std::string>();
+  auto const dataset        = cmd_options["dataset"].as<std::string>();
+  auto const long_max_depth = cmd_options["long_max_depth"].as<int32_t>();
 
   // Configure RMM
   auto resource = cugraph::test::create_memory_resource(rmm_mode);
@@ -393,6 +443,28 @@ int main(int argc, char** argv)
   run<int32_t, int32_t, float>(RandomWalks_Usecase(dataset, true), traversal_id_t::VERTICAL, 2);
   run<int32_t, int32_t, float>(RandomWalks_Usecase(dataset, true), traversal_id_t::VERTICAL, 3);
 
+  std::cout << "##### Persistent traversal strategy:\n";
+
+  std::cout << "### Uniform sampling strategy:\n";
+  run<int32_t, int32_t, float>(RandomWalks_Usecase(dataset, true), traversal_id_t::PERSISTENT, 0);
+
+  std::cout << "### Biased sampling strategy:\n";
+  run<int32_t, int32_t, float>(RandomWalks_Usecase(dataset, true), traversal_id_t::PERSISTENT, 1);
+
+  std::cout << "### Node2Vec sampling strategy:\n";
+  run<int32_t, int32_t, float>(RandomWalks_Usecase(dataset, true), traversal_id_t::PERSISTENT, 2);
+  run<int32_t, int32_t, float>(RandomWalks_Usecase(dataset, true), traversal_id_t::PERSISTENT, 3);
+
+  // few, long walks (where the per-step overhead of the vertical traversal and the load imbalance
+  // of the horizontal one are most visible):
+  //
+  std::cout << "##### Long walks (max_depth = " << long_max_depth << "), uniform sampling:\n";
+
+  for (auto trv_id :
+       {traversal_id_t::HORIZONTAL, traversal_id_t::VERTICAL, traversal_id_t::PERSISTENT}) {
+    run<int32_t, int32_t, float>(RandomWalks_Usecase(dataset, true), trv_id, 0, long_max_depth);
+  }
+
   // FIXME: consider returning non-zero for situations that warrant it (eg. if
   // the algo ran but the results are invalid, if a benchmark threshold is
   // exceeded, etc.)
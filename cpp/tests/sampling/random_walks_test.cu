@@ -36,6 +36,7 @@
 #include <limits>
 #include <numeric>
 #include <tuple>
+#include <type_traits>
 #include <utilities/high_res_timer.hpp>
 #include <vector>
 
@@ -58,7 +59,7 @@ void fill_start(raft::handle_t const& handle,
 
 namespace impl_details = cugraph::detail;
 
-enum class traversal_id_t : int { HORIZONTAL = 0, VERTICAL };
+enum class traversal_id_t : int { HORIZONTAL = 0, VERTICAL, PERSISTENT };
 
 struct RandomWalks_Usecase {
   std::string graph_file_full_path{};
@@ -184,6 +185,88 @@ class Tests_RandomWalks
 
         ASSERT_TRUE(test_all_paths);
       }
+
+      // counter-based random engine:
+      //
+      {
+        auto ret_tuple = cugraph::random_walks(
+          handle,
+          graph_view,
+          d_start_view.begin(),
+          num_paths,
+          max_depth,
+          false,
+          std::make_unique<cugraph::sampling_params_t>(
+            sampling_id, p, q, false, false, static_cast<int>(cugraph::rng_type_t::PHILOX)));
+
+        // check results:
+        //
+        bool test_all_paths = cugraph::test::host_check_rw_paths(handle,
+                                                                 graph_view,
+                                                                 std::get<0>(ret_tuple),
+                                                                 std::get<1>(ret_tuple),
+                                                                 std::get<2>(ret_tuple));
+
+        ASSERT_TRUE(test_all_paths);
+      }
+
+      // alias tables (biased and `node2vec` only):
+      //
+      if (sampling_id != 0) {
+        auto ret_tuple = cugraph::random_walks(
+          handle,
+          graph_view,
+          d_start_view.begin(),
+          num_paths,
+          max_depth,
+          false,
+          std::make_unique<cugraph::sampling_params_t>(sampling_id, p, q, false, true));
+
+        // check results:
+        //
+        bool test_all_paths = cugraph::test::host_check_rw_paths(handle,
+                                                                 graph_view,
+                                                                 std::get<0>(ret_tuple),
+                                                                 std::get<1>(ret_tuple),
+                                                                 std::get<2>(ret_tuple));
+
+        ASSERT_TRUE(test_all_paths);
+      }
+    } else if (trv_id == traversal_id_t::PERSISTENT) {  // needs to be force-called via detail
+      auto check_persistent_walks = [&](auto const& selector) {
+        auto ret_tuple = impl_details::random_walks_impl<graph_vt,
+                                                         std::decay_t<decltype(selector)>,
+                                                         impl_details::persistent_traversal_t>(
+          handle,  // required to prevent clang-format to separate functin name from its namespace
+          graph_view,
+          d_start_view,
+          max_depth,
+          selector);
+
+        // check results:
+        //
+        bool test_all_paths = cugraph::test::host_check_rw_paths(handle,
+                                                                 graph_view,
+                                                                 std::get<0>(ret_tuple),
+                                                                 std::get<1>(ret_tuple),
+                                                                 std::get<2>(ret_tuple));
+
+        if (!test_all_paths)
+          std::cout << "starting seed on failure: " << std::get<3>(ret_tuple) << '\n';
+
+        ASSERT_TRUE(test_all_paths);
+      };
+
+      if (sampling_id == 0) {
+        check_persistent_walks(
+          impl_details::uniform_selector_t<graph_vt, real_t>{handle, graph_view, real_t{0}});
+      } else if (sampling_id == 1) {
+        check_persistent_walks(
+          impl_details::biased_selector_t<graph_vt, real_t>{handle, graph_view, real_t{0}});
+      } else {
+        check_persistent_walks(impl_details::node2vec_selector_t<graph_vt, real_t>{
+          handle, graph_view, real_t{0}, p, q, num_paths});
+      }
     } else {  // VERTICAL: needs to be force-called via detail
       if (sampling_id == 0) {
         impl_details::uniform_selector_t<graph_vt, real_t> selector{handle, graph_view, real_t{0}};
@@ -271,7 +354,9 @@ TEST_P(Tests_RandomWalks, Initialize_i32_i32_f)
 INSTANTIATE_TEST_SUITE_P(
   simple_test,
   Tests_RandomWalks,
-  ::testing::Combine(::testing::Values(traversal_id_t::HORIZONTAL, traversal_id_t::VERTICAL),
+  ::testing::Combine(::testing::Values(traversal_id_t::HORIZONTAL,
+                                       traversal_id_t::VERTICAL,
+                                       traversal_id_t::PERSISTENT),
                      ::testing::Values(int{0}, int{1}, int{2}),
                      ::testing::Values(RandomWalks_Usecase("test/datasets/karate.mtx", true),
                                        RandomWalks_Usecase("test/datasets/web-Google.mtx", true),
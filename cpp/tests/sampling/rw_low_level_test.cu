@@ -505,6 +505,48 @@ TEST_F(RandomWalksPrimsTest, SimpleGraphRndGenColIndx)
   ASSERT_TRUE(all_indices_within_degs);
 }
 
+TEST(RandomWalksRng, PhiloxSequence)
+{
+  using namespace cugraph::detail;
+
+  using vertex_t = int32_t;
+  using edge_t   = vertex_t;
+  using real_t   = float;
+  using seed_t   = uint64_t;
+
+  using random_engine_t = philox_gen_t<vertex_t, edge_t, seed_t, real_t>;
+
+  raft::handle_t handle{};
+
+  size_t num_values = size_t{1} << 16;
+  seed_t seed       = 12345;
+
+  vector_test_t<real_t> d_random(num_values, handle.get_stream());
+  random_engine_t::generate_random(handle, d_random.data(), d_random.size(), seed);
+
+  std::vector<real_t> h_random(num_values);
+  raft::update_host(h_random.data(), d_random.data(), h_random.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  // the buffered values are the inline (counter-based) ones:
+  //
+  for (size_t i = 0; i < num_values; i += 997) {
+    EXPECT_EQ(h_random[i], random_engine_t::draw(seed, static_cast<uint64_t>(i)));
+  }
+
+  // in [0, 1), and (roughly) uniform:
+  //
+  EXPECT_TRUE(std::all_of(
+    h_random.begin(), h_random.end(), [](auto val) { return (val >= 0.0f) && (val < 1.0f); }));
+
+  double mean = std::accumulate(h_random.begin(), h_random.end(), double{0}) / num_values;
+  EXPECT_NEAR(mean, 0.5, 0.01);
+
+  // different seeds yield different sequences:
+  //
+  EXPECT_NE(random_engine_t::draw(seed, 0), random_engine_t::draw(seed + 1, 0));
+}
+
 TEST_F(RandomWalksPrimsTest, SimpleGraphUpdatePathSizes)
 {
   using namespace cugraph::detail;
@@ -1304,6 +1346,114 @@ TEST(BiasedRandomWalks, SelectorSmallGraph)
   EXPECT_EQ(v_next_v, h_next_v);
 }
 
+TEST(BiasedRandomWalks, AliasTableSmallGraph)
+{
+  raft::handle_t handle{};
+
+  using vertex_t = int32_t;
+  using edge_t   = vertex_t;
+  using weight_t = float;
+  using real_t   = weight_t;
+
+  edge_t num_edges      = 8;
+  vertex_t num_vertices = 6;
+
+  /*
+    0 --(.1)--> 1 --(1.1)--> 4
+   /|\       /\ |            |
+    |       /   |            |
+   (5.1) (3.1)(2.1)        (3.2)
+    |   /       |            |
+    | /        \|/          \|/
+    2 --(4.1)-->3 --(7.2)--> 5
+   */
+  std::vector<vertex_t> v_src{0, 1, 1, 2, 2, 2, 3, 4};
+  std::vector<vertex_t> v_dst{1, 3, 4, 0, 1, 3, 5, 5};
+  std::vector<weight_t> v_w{0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  auto graph = cugraph::test::make_graph(
+    handle, v_src, v_dst, std::optional<std::vector<weight_t>>{v_w}, num_vertices, num_edges);
+
+  auto graph_view = graph.view();
+
+  auto alias_table = cugraph::detail::build_alias_table(handle, graph_view);
+
+  ASSERT_EQ(alias_table.get_number_of_edges(), num_edges);
+
+  std::vector<edge_t> v_ro(num_vertices + 1);
+  std::vector<weight_t> v_csr_w(num_edges);
+  std::vector<weight_t> v_probs(num_edges);
+  std::vector<edge_t> v_aliases(num_edges);
+
+  raft::update_host(v_ro.data(),
+                    graph_view.get_matrix_partition_view().get_offsets(),
+                    v_ro.size(),
+                    handle.get_stream());
+  raft::update_host(v_csr_w.data(),
+                    *(graph_view.get_matrix_partition_view().get_weights()),
+                    v_csr_w.size(),
+                    handle.get_stream());
+  raft::update_host(v_probs.data(), alias_table.get_probs(), v_probs.size(), handle.get_stream());
+  raft::update_host(
+    v_aliases.data(), alias_table.get_aliases(), v_aliases.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  // the probability of each out-edge slot, as encoded by the table, must be (weight / sum(weights))
+  // of its row:
+  //
+  weight_t eps = 1.0e-5f;
+  for (vertex_t row = 0; row < num_vertices; ++row) {
+    auto first  = v_ro[row];
+    auto degree = v_ro[row + 1] - first;
+
+    weight_t sum_w = std::accumulate(
+      v_csr_w.begin() + first, v_csr_w.begin() + first + degree, weight_t{0});
+    std::vector<weight_t> slot_probs(degree, weight_t{0});
+    for (edge_t k = 0; k < degree; ++k) {
+      ASSERT_TRUE(v_aliases[first + k] >= 0 && v_aliases[first + k] < degree);
+
+      slot_probs[k] += v_probs[first + k] / degree;
+      slot_probs[v_aliases[first + k]] += (weight_t{1} - v_probs[first + k]) / degree;
+    }
+    for (edge_t k = 0; k < degree; ++k) {
+      EXPECT_NEAR(slot_probs[k], v_csr_w[first + k] / sum_w, eps);
+    }
+  }
+
+  // O(1) biased selection must return a neighbor of the source:
+  //
+  std::vector<real_t> v_rnd{0.0, 0.3, 1.0, 0.0, 0.6, 1.0, 0.0, 0.5, 0.99, 0.7, 0.2, 0.4};
+  std::vector<vertex_t> v_src_v{0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 4, 5};
+
+  vector_test_t<real_t> d_rnd(v_rnd.size(), handle.get_stream());
+  vector_test_t<vertex_t> d_src_v(v_src_v.size(), handle.get_stream());
+  vector_test_t<vertex_t> d_next_v(v_src_v.size(), handle.get_stream());
+
+  raft::update_device(d_rnd.data(), v_rnd.data(), d_rnd.size(), handle.get_stream());
+  raft::update_device(d_src_v.data(), v_src_v.data(), d_src_v.size(), handle.get_stream());
+
+  cugraph::detail::biased_selector_t selector{handle, graph_view, 0.0f, &alias_table};
+
+  next_biased(handle, d_src_v, d_rnd, d_next_v, selector);
+
+  std::vector<vertex_t> v_next_v(v_src_v.size());
+  raft::update_host(v_next_v.data(), d_next_v.data(), v_next_v.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  for (size_t i = 0; i < v_src_v.size(); ++i) {
+    auto src_v = v_src_v[i];
+    if (src_v == 5) {  // sink
+      EXPECT_EQ(v_next_v[i], src_v);
+    } else {
+      bool is_edge{false};
+      for (edge_t k = 0; k < num_edges; ++k) {
+        is_edge = is_edge || ((v_src[k] == src_v) && (v_dst[k] == v_next_v[i]));
+      }
+      EXPECT_TRUE(is_edge);
+    }
+  }
+}
+
 TEST(Node2VecRandomWalks, Node2VecSmallGraph)
 {
   namespace topo = cugraph::topology;
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// checks a hop of the sample against the (host) CSR: every sampled edge exists (as many times as
+// it is sampled), every frontier vertex has min(fanout, # selectable out-edges) sampled edges, and
+// no vertex outside the frontier appears as a source
+template <typename vertex_t, typename edge_t, typename weight_t>
+void check_sample_hop(std::vector<edge_t> const& h_offsets,
+                      std::vector<vertex_t> const& h_indices,
+                      std::optional<std::vector<weight_t>> const& h_weights,
+                      std::set<vertex_t> const& frontier,
+                      std::vector<vertex_t> const& h_srcs,
+                      std::vector<vertex_t> const& h_dsts,
+                      size_t fanout)
+{
+  std::map<std::pair<vertex_t, vertex_t>, size_t> sampled_counts{};
+  std::map<vertex_t, size_t> src_counts{};
+  for (size_t i = 0; i < h_srcs.size(); ++i) {
+    ASSERT_TRUE(frontier.find(h_srcs[i]) != frontier.end())
+      << "a sampled edge source is not in the frontier.";
+    ++sampled_counts[std::make_pair(h_srcs[i], h_dsts[i])];
+    ++src_counts[h_srcs[i]];
+  }
+
+  for (auto const& [edge, count] : sampled_counts) {
+    auto first = h_indices.begin() + h_offsets[edge.first];
+    auto last  = h_indices.begin() + h_offsets[edge.first + 1];
+    ASSERT_TRUE(static_cast<size_t>(std::count(first, last, edge.second)) >= count)
+      << "a sampled edge does not exist or is sampled more than once.";
+  }
+
+  for (auto v : frontier) {
+    size_t num_selectable{0};
+    for (auto j = h_offsets[v]; j < h_offsets[v + 1]; ++j) {
+      if (!h_weights || ((*h_weights)[j] > weight_t{0.0})) { ++num_selectable; }
+    }
+    auto it = src_counts.find(v);
+    ASSERT_EQ(it != src_counts.end() ? (*it).second : size_t{0}, std::min(fanout, num_selectable))
+      << "the number of sampled neighbors is not min(fanout, degree).";
+  }
+}
+
+struct SampleNeighbors_Usecase {
+  std::vector<size_t> fanouts{};
+  size_t num_seeds{0};
+  bool weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_SampleNeighbors
+  : public ::testing::TestWithParam<std::tuple<SampleNeighbors_Usecase, input_usecase_t>> {
+ public:
+  Tests_SampleNeighbors() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SampleNeighbors_Usecase const& sample_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, sample_usecase.weighted, false);
+    auto graph_view = graph.view();
+
+    auto num_seeds = std::min(sample_usecase.num_seeds,
+                              static_cast<size_t>(graph_view.get_number_of_vertices()));
+    std::vector<vertex_t> h_seeds(num_seeds);
+    for (size_t i = 0; i < num_seeds; ++i) {
+      h_seeds[i] = static_cast<vertex_t>((i * graph_view.get_number_of_vertices()) / num_seeds);
+    }
+    rmm::device_uvector<vertex_t> d_seeds(h_seeds.size(), handle.get_stream());
+    raft::update_device(d_seeds.data(), h_seeds.data(), h_seeds.size(), handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto hops = cugraph::sample_neighbors(handle,
+                                          graph_view,
+                                          d_seeds.data(),
+                                          d_seeds.size(),
+                                          sample_usecase.fanouts,
+                                          sample_usecase.weighted,
+                                          uint64_t{0},
+                                          true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "sample_neighbors took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (sample_usecase.check_correctness) {
+      ASSERT_EQ(hops.size(), sample_usecase.fanouts.size());
+
+      std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        graph_view.get_number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      auto h_weights = sample_usecase.weighted ? std::make_optional<std::vector<weight_t>>(
+                                                   graph_view.get_number_of_edges())
+                                               : std::nullopt;
+      if (h_weights) {
+        raft::update_host((*h_weights).data(),
+                          *(graph_view.get_matrix_partition_view().get_weights()),
+                          graph_view.get_number_of_edges(),
+                          handle.get_stream());
+      }
+      handle.get_stream_view().synchronize();
+
+      std::set<vertex_t> frontier(h_seeds.begin(), h_seeds.end());
+      for (size_t hop = 0; hop < hops.size(); ++hop) {
+        auto const& [d_srcs, d_dsts] = hops[hop];
+        ASSERT_EQ(d_srcs.size(), d_dsts.size());
+        std::vector<vertex_t> h_srcs(d_srcs.size());
+        std::vector<vertex_t> h_dsts(d_dsts.size());
+        raft::update_host(h_srcs.data(), d_srcs.data(), d_srcs.size(), handle.get_stream());
+        raft::update_host(h_dsts.data(), d_dsts.data(), d_dsts.size(), handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        check_sample_hop(h_offsets,
+                         h_indices,
+                         h_weights,
+                         frontier,
+                         h_srcs,
+                         h_dsts,
+                         sample_usecase.fanouts[hop]);
+        if (::testing::Test::HasFatalFailure()) { return; }
+
+        frontier = std::set<vertex_t>(h_dsts.begin(), h_dsts.end());
+      }
+    }
+  }
+};
+
+using Tests_SampleNeighbors_File = Tests_SampleNeighbors<cugraph::test::File_Usecase>;
+using Tests_SampleNeighbors_Rmat = Tests_SampleNeighbors<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_SampleNeighbors_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SampleNeighbors_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_SampleNeighbors_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_SampleNeighbors_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_SampleNeighbors_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SampleNeighbors_Usecase{{10, 5}, 16, false},
+                      SampleNeighbors_Usecase{{10, 5}, 16, true},
+                      SampleNeighbors_Usecase{{2, 2, 2}, 64, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_SampleNeighbors_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SampleNeighbors_Usecase{{10, 5}, 64, false},
+                      SampleNeighbors_Usecase{{10, 5}, 64, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_SampleNeighbors_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(SampleNeighbors_Usecase{{25, 10}, 1024, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
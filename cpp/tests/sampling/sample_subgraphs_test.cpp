@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct SampleSubgraphs_Usecase {
+  cugraph::subgraph_sampler_t sampler{cugraph::subgraph_sampler_t::node};
+  size_t num_subgraphs{0};
+  size_t sample_size{0};
+  size_t walk_length{2};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_SampleSubgraphs
+  : public ::testing::TestWithParam<std::tuple<SampleSubgraphs_Usecase, input_usecase_t>> {
+ public:
+  Tests_SampleSubgraphs() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SampleSubgraphs_Usecase const& sample_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [d_subgraph_vertex_offsets, d_subgraph_vertices, d_offsets, d_indices, d_weights] =
+      cugraph::sample_subgraphs(handle,
+                                graph_view,
+                                sample_usecase.sampler,
+                                sample_usecase.num_subgraphs,
+                                sample_usecase.sample_size,
+                                sample_usecase.walk_length,
+                                uint64_t{0});
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "sample_subgraphs took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (sample_usecase.check_correctness) {
+      ASSERT_EQ(d_subgraph_vertex_offsets.size(), sample_usecase.num_subgraphs + 1);
+      ASSERT_EQ(d_offsets.size(), d_subgraph_vertices.size() + 1);
+      ASSERT_TRUE(d_weights.has_value());
+      ASSERT_EQ((*d_weights).size(), d_indices.size());
+
+      auto h_subgraph_vertex_offsets = cugraph::test::to_host(
+        handle, d_subgraph_vertex_offsets.data(), d_subgraph_vertex_offsets.size());
+      auto h_subgraph_vertices =
+        cugraph::test::to_host(handle, d_subgraph_vertices.data(), d_subgraph_vertices.size());
+      auto h_offsets = cugraph::test::to_host(handle, d_offsets.data(), d_offsets.size());
+      auto h_indices = cugraph::test::to_host(handle, d_indices.data(), d_indices.size());
+      auto h_weights = cugraph::test::to_host(handle, (*d_weights).data(), (*d_weights).size());
+
+      auto h_graph_offsets = cugraph::test::to_host(
+        handle,
+        graph_view.get_matrix_partition_view().get_offsets(),
+        graph_view.get_number_of_vertices() + 1);
+      auto h_graph_indices =
+        cugraph::test::to_host(handle,
+                               graph_view.get_matrix_partition_view().get_indices(),
+                               graph_view.get_number_of_edges());
+      auto h_graph_weights =
+        cugraph::test::to_host(handle,
+                               *(graph_view.get_matrix_partition_view().get_weights()),
+                               graph_view.get_number_of_edges());
+
+      size_t max_subgraph_size = sample_usecase.sample_size;
+      if (sample_usecase.sampler == cugraph::subgraph_sampler_t::edge) {
+        max_subgraph_size *= 2;
+      } else if (sample_usecase.sampler == cugraph::subgraph_sampler_t::random_walk) {
+        max_subgraph_size *= sample_usecase.walk_length;
+      }
+
+      ASSERT_EQ(h_subgraph_vertex_offsets.front(), size_t{0});
+      ASSERT_EQ(h_subgraph_vertex_offsets.back(), h_subgraph_vertices.size());
+      ASSERT_EQ(h_offsets.front(), size_t{0});
+      ASSERT_EQ(h_offsets.back(), h_indices.size());
+      for (size_t i = 0; i < sample_usecase.num_subgraphs; ++i) {
+        auto first = h_subgraph_vertices.begin() + h_subgraph_vertex_offsets[i];
+        auto last  = h_subgraph_vertices.begin() + h_subgraph_vertex_offsets[i + 1];
+        auto size  = static_cast<size_t>(std::distance(first, last));
+        ASSERT_TRUE(size <= max_subgraph_size) << "a subgraph has more vertices than drawn.";
+        ASSERT_TRUE(sample_usecase.sample_size == 0 || size > 0) << "a subgraph is empty.";
+        ASSERT_TRUE(std::adjacent_find(first, last, [](auto lhs, auto rhs) {
+                      return lhs >= rhs;
+                    }) == last)
+          << "subgraph vertices are not sorted and unique.";
+
+        // the CSR rows of a subgraph should be the (relabeled) edges of the induced subgraph
+
+        for (size_t j = 0; j < size; ++j) {
+          auto v   = *(first + j);
+          auto row = h_subgraph_vertex_offsets[i] + j;
+          std::vector<std::tuple<vertex_t, weight_t>> h_expected{};
+          for (auto k = h_graph_offsets[v]; k < h_graph_offsets[v + 1]; ++k) {
+            auto it = std::lower_bound(first, last, h_graph_indices[k]);
+            if ((it != last) && (*it == h_graph_indices[k])) {
+              h_expected.push_back(std::make_tuple(static_cast<vertex_t>(std::distance(first, it)),
+                                                   h_graph_weights[k]));
+            }
+          }
+          std::vector<std::tuple<vertex_t, weight_t>> h_found{};
+          for (auto k = h_offsets[row]; k < h_offsets[row + 1]; ++k) {
+            h_found.push_back(std::make_tuple(h_indices[k], h_weights[k]));
+          }
+          std::sort(h_expected.begin(), h_expected.end());
+          std::sort(h_found.begin(), h_found.end());
+          ASSERT_TRUE(h_expected == h_found)
+            << "the sampled subgraph edges differ from the induced subgraph edges.";
+        }
+      }
+
+      // node & edge samples are deterministic for a given seed
+
+      if (sample_usecase.sampler != cugraph::subgraph_sampler_t::random_walk) {
+        auto d_subgraph_vertices1 =
+          std::get<1>(cugraph::sample_subgraphs(handle,
+                                                graph_view,
+                                                sample_usecase.sampler,
+                                                sample_usecase.num_subgraphs,
+                                                sample_usecase.sample_size,
+                                                sample_usecase.walk_length,
+                                                uint64_t{0}));
+        auto h_subgraph_vertices1 =
+          cugraph::test::to_host(handle, d_subgraph_vertices1.data(), d_subgraph_vertices1.size());
+        ASSERT_TRUE(h_subgraph_vertices == h_subgraph_vertices1)
+          << "sample_subgraphs returns different samples for the same seed.";
+      }
+    }
+  }
+};
+
+using Tests_SampleSubgraphs_File = Tests_SampleSubgraphs<cugraph::test::File_Usecase>;
+using Tests_SampleSubgraphs_Rmat = Tests_SampleSubgraphs<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_SampleSubgraphs_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SampleSubgraphs_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_SampleSubgraphs_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_SampleSubgraphs_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SampleSubgraphs_Usecase{cugraph::subgraph_sampler_t::node, 8, 16},
+                      SampleSubgraphs_Usecase{cugraph::subgraph_sampler_t::edge, 8, 16},
+                      SampleSubgraphs_Usecase{cugraph::subgraph_sampler_t::random_walk, 8, 4, 4}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_SampleSubgraphs_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SampleSubgraphs_Usecase{cugraph::subgraph_sampler_t::node, 16, 64},
+                      SampleSubgraphs_Usecase{cugraph::subgraph_sampler_t::edge, 16, 64},
+                      SampleSubgraphs_Usecase{cugraph::subgraph_sampler_t::random_walk, 16, 8, 8}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_SampleSubgraphs_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(
+      SampleSubgraphs_Usecase{cugraph::subgraph_sampler_t::random_walk, 256, 64, 8, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
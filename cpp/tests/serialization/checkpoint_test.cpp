@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/serialization/checkpoint.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+struct Checkpoint_Usecase {
+  size_t interval{1};
+};
+
+template <typename input_usecase_t>
+class Tests_Checkpoint
+  : public ::testing::TestWithParam<std::tuple<Checkpoint_Usecase, input_usecase_t>> {
+ public:
+  Tests_Checkpoint() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  static std::string checkpoint_path_prefix(std::string const& name)
+  {
+    return ::testing::TempDir() + "cugraph_checkpoint_test_" + name + "_" +
+           std::to_string(getpid());
+  }
+
+  static void remove_checkpoint_files(std::string const& path_prefix)
+  {
+    std::remove((path_prefix + ".0").c_str());
+    std::remove((path_prefix + ".0.tmp").c_str());
+  }
+
+  // PageRank interrupted (by max_iterations) and resumed from the last checkpoint should return the
+  // same scores as an uninterrupted run
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_pagerank_test(Checkpoint_Usecase const& checkpoint_usecase,
+                         input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, true, true);
+    auto graph_view = graph.view();
+
+    auto alpha   = weight_t{0.85};
+    auto epsilon = weight_t{1e-6};
+
+    rmm::device_uvector<weight_t> d_pageranks(graph_view.get_number_of_vertices(),
+                                              handle.get_stream());
+    cugraph::pagerank(handle,
+                      graph_view,
+                      std::nullopt,
+                      std::nullopt,
+                      std::nullopt,
+                      std::nullopt,
+                      d_pageranks.data(),
+                      alpha,
+                      epsilon);
+
+    cugraph::checkpoint_params_t checkpoint_params{
+      checkpoint_path_prefix("pagerank"), checkpoint_usecase.interval, false};
+    remove_checkpoint_files(checkpoint_params.path_prefix);
+
+    rmm::device_uvector<weight_t> d_resumed_pageranks(graph_view.get_number_of_vertices(),
+                                                      handle.get_stream());
+    EXPECT_THROW(cugraph::pagerank(handle,
+                                   graph_view,
+                                   std::nullopt,
+                                   std::nullopt,
+                                   std::nullopt,
+                                   std::nullopt,
+                                   d_resumed_pageranks.data(),
+                                   alpha,
+                                   epsilon,
+                                   checkpoint_params,
+                                   checkpoint_usecase.interval * 2),
+                 cugraph::logic_error);
+
+    checkpoint_params.resume = true;
+    cugraph::pagerank(handle,
+                      graph_view,
+                      std::nullopt,
+                      std::nullopt,
+                      std::nullopt,
+                      std::nullopt,
+                      d_resumed_pageranks.data(),
+                      alpha,
+                      epsilon,
+                      checkpoint_params);
+    remove_checkpoint_files(checkpoint_params.path_prefix);
+
+    auto h_pageranks = cugraph::test::to_host(handle, d_pageranks.data(), d_pageranks.size());
+    auto h_resumed_pageranks =
+      cugraph::test::to_host(handle, d_resumed_pageranks.data(), d_resumed_pageranks.size());
+
+    auto threshold_ratio = 1e-3;
+    auto threshold_magnitude =
+      (1.0 / static_cast<weight_t>(graph_view.get_number_of_vertices())) * threshold_ratio;
+    ASSERT_TRUE(std::equal(h_pageranks.begin(),
+                           h_pageranks.end(),
+                           h_resumed_pageranks.begin(),
+                           [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+                             return std::abs(lhs - rhs) <
+                                    std::max(std::max(lhs, rhs) * threshold_ratio,
+                                             threshold_magnitude);
+                           }))
+      << "PageRank values resumed from a checkpoint do not match the uninterrupted run.";
+  }
+
+  // Louvain resumed from the checkpoint of max_level levels should restore the same dendrogram and
+  // modularity, and resuming with a larger max_level should reach the modularity of an
+  // uninterrupted run
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_louvain_test(Checkpoint_Usecase const& checkpoint_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, true);
+    auto graph_view = graph.view();
+
+    auto [dendrogram, modularity] = cugraph::louvain(handle, graph_view);
+
+    cugraph::checkpoint_params_t checkpoint_params{
+      checkpoint_path_prefix("louvain"), checkpoint_usecase.interval, false};
+    remove_checkpoint_files(checkpoint_params.path_prefix);
+
+    auto interrupted_level = checkpoint_usecase.interval;
+    auto [interrupted_dendrogram, interrupted_modularity] =
+      cugraph::louvain(handle, graph_view, checkpoint_params, interrupted_level);
+
+    checkpoint_params.resume = true;
+    if (interrupted_dendrogram->num_levels() == interrupted_level) {
+      auto [restored_dendrogram, restored_modularity] =
+        cugraph::louvain(handle, graph_view, checkpoint_params, interrupted_level);
+      ASSERT_EQ(restored_dendrogram->num_levels(), interrupted_dendrogram->num_levels());
+      ASSERT_EQ(restored_dendrogram->get_level_offsets(),
+                interrupted_dendrogram->get_level_offsets());
+      ASSERT_EQ(restored_dendrogram->to_host(handle.get_stream_view()),
+                interrupted_dendrogram->to_host(handle.get_stream_view()))
+        << "Dendrogram restored from a checkpoint does not match the checkpointed run.";
+      ASSERT_EQ(restored_modularity, interrupted_modularity);
+    }
+
+    auto [resumed_dendrogram, resumed_modularity] =
+      cugraph::louvain(handle, graph_view, checkpoint_params);
+    remove_checkpoint_files(checkpoint_params.path_prefix);
+
+    ASSERT_EQ(resumed_dendrogram->num_levels(), dendrogram->num_levels());
+    ASSERT_NEAR(static_cast<float>(resumed_modularity), static_cast<float>(modularity), 1e-4)
+      << "Louvain modularity resumed from a checkpoint does not match the uninterrupted run.";
+  }
+
+  // weakly connected components resumed from the last checkpoint of a run should find the same
+  // components
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_weakly_connected_components_test(Checkpoint_Usecase const& checkpoint_usecase,
+                                            input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, true);
+    auto graph_view = graph.view();
+    ASSERT_TRUE(graph_view.is_symmetric())
+      << "Weakly connected components works only on undirected (symmetric) graphs.";
+
+    rmm::device_uvector<vertex_t> d_components(graph_view.get_number_of_vertices(),
+                                               handle.get_stream());
+    cugraph::weakly_connected_components(handle, graph_view, d_components.data());
+
+    cugraph::checkpoint_params_t checkpoint_params{
+      checkpoint_path_prefix("wcc"), checkpoint_usecase.interval, false};
+    remove_checkpoint_files(checkpoint_params.path_prefix);
+
+    rmm::device_uvector<vertex_t> d_resumed_components(graph_view.get_number_of_vertices(),
+                                                       handle.get_stream());
+    cugraph::weakly_connected_components(
+      handle, graph_view, d_resumed_components.data(), checkpoint_params);
+
+    checkpoint_params.resume = true;
+    cugraph::weakly_connected_components(
+      handle, graph_view, d_resumed_components.data(), checkpoint_params);
+    remove_checkpoint_files(checkpoint_params.path_prefix);
+
+    auto h_components = cugraph::test::to_host(handle, d_components.data(), d_components.size());
+    auto h_resumed_components =
+      cugraph::test::to_host(handle, d_resumed_components.data(), d_resumed_components.size());
+
+    // component IDs can differ, but the components should be the same
+    std::unordered_map<vertex_t, vertex_t> resumed_to_uninterrupted_map{};
+    std::unordered_map<vertex_t, vertex_t> uninterrupted_to_resumed_map{};
+    for (size_t i = 0; i < h_components.size(); ++i) {
+      auto uninterrupted_c =
+        resumed_to_uninterrupted_map.insert({h_resumed_components[i], h_components[i]})
+          .first->second;
+      auto resumed_c =
+        uninterrupted_to_resumed_map.insert({h_components[i], h_resumed_components[i]})
+          .first->second;
+      ASSERT_TRUE((uninterrupted_c == h_components[i]) && (resumed_c == h_resumed_components[i]))
+        << "Components resumed from a checkpoint do not match the uninterrupted run.";
+    }
+  }
+};
+
+using Tests_Checkpoint_File = Tests_Checkpoint<cugraph::test::File_Usecase>;
+using Tests_Checkpoint_Rmat = Tests_Checkpoint<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_Checkpoint_File, CheckPageRankInt32Int32Float)
+{
+  auto param = GetParam();
+  run_pagerank_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_Checkpoint_File, CheckLouvainInt32Int32Float)
+{
+  auto param = GetParam();
+  run_louvain_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_Checkpoint_File, CheckWeaklyConnectedComponentsInt32Int32Float)
+{
+  auto param = GetParam();
+  run_weakly_connected_components_test<int32_t, int32_t, float>(std::get<0>(param),
+                                                                std::get<1>(param));
+}
+
+TEST_P(Tests_Checkpoint_Rmat, CheckPageRankInt32Int32Float)
+{
+  auto param = GetParam();
+  run_pagerank_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Checkpoint_Rmat, CheckLouvainInt32Int32Float)
+{
+  auto param = GetParam();
+  run_louvain_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Checkpoint_Rmat, CheckWeaklyConnectedComponentsInt32Int32Float)
+{
+  auto param = GetParam();
+  run_weakly_connected_components_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_Checkpoint_File,
+  ::testing::Combine(::testing::Values(Checkpoint_Usecase{1}, Checkpoint_Usecase{2}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_Checkpoint_Rmat,
+  ::testing::Combine(
+    ::testing::Values(Checkpoint_Usecase{1}, Checkpoint_Usecase{3}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
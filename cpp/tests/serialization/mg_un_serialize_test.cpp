@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/serialization/serializer.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+struct MGSerialization_Usecase {
+  bool test_weighted{false};
+};
+
+template <typename input_usecase_t>
+class Tests_MGSerialization
+  : public ::testing::TestWithParam<std::tuple<MGSerialization_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGSerialization() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MGSerialization_Usecase const& serialization_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using namespace cugraph::serializer;
+
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, serialization_usecase.test_weighted, true);
+
+    // 3. serialize (per rank)
+
+    auto pair_sz      = serializer_t::get_device_graph_sz_bytes(mg_graph);
+    auto total_ser_sz = pair_sz.first + pair_sz.second;
+
+    // use the following buffer to simulate storing the serialized (local) partition and reloading
+    // it on the same rank:
+    //
+    rmm::device_uvector<serializer_t::byte_t> d_storage(0, handle.get_stream());
+
+    {
+      serializer_t ser(handle, total_ser_sz);
+      serializer_t::graph_meta_t<decltype(mg_graph)> graph_meta{};
+      ser.serialize(mg_graph, graph_meta);
+
+      pair_sz          = serializer_t::get_device_graph_sz_bytes(graph_meta);
+      auto post_ser_sz = pair_sz.first + pair_sz.second;
+
+      ASSERT_EQ(total_ser_sz, post_ser_sz);
+
+      d_storage.resize(total_ser_sz, handle.get_stream());
+      raft::copy(d_storage.data(), ser.get_storage(), total_ser_sz, handle.get_stream());
+    }
+
+    // 4. unserialize (per rank) and compare the local partitions
+
+    serializer_t ser(handle, d_storage.data());
+    auto mg_graph_copy = ser.unserialize<decltype(mg_graph)>(pair_sz.first, pair_sz.second);
+
+    ASSERT_EQ(mg_graph_copy.get_number_of_vertices(), mg_graph.get_number_of_vertices());
+    ASSERT_EQ(mg_graph_copy.get_number_of_edges(), mg_graph.get_number_of_edges());
+    ASSERT_EQ(mg_graph_copy.is_weighted(), mg_graph.is_weighted());
+
+    auto mg_graph_view      = mg_graph.view();
+    auto mg_graph_copy_view = mg_graph_copy.view();
+    ASSERT_EQ(mg_graph_copy_view.get_number_of_local_vertices(),
+              mg_graph_view.get_number_of_local_vertices());
+    ASSERT_EQ(mg_graph_copy_view.get_number_of_local_adj_matrix_partitions(),
+              mg_graph_view.get_number_of_local_adj_matrix_partitions());
+    for (size_t i = 0; i < mg_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      ASSERT_EQ(mg_graph_copy_view.get_number_of_local_adj_matrix_partition_edges(i),
+                mg_graph_view.get_number_of_local_adj_matrix_partition_edges(i));
+      ASSERT_TRUE(mg_graph_copy_view.get_local_adj_matrix_partition_segment_offsets(i) ==
+                  mg_graph_view.get_local_adj_matrix_partition_segment_offsets(i));
+    }
+
+    auto [d_rows, d_cols, d_weights] =
+      mg_graph.decompress_to_edgelist(handle, std::nullopt, false);
+    auto [d_copy_rows, d_copy_cols, d_copy_weights] =
+      mg_graph_copy.decompress_to_edgelist(handle, std::nullopt, false);
+
+    ASSERT_EQ(d_copy_rows.size(), d_rows.size());
+
+    std::vector<vertex_t> h_rows(d_rows.size());
+    std::vector<vertex_t> h_cols(d_cols.size());
+    std::vector<vertex_t> h_copy_rows(d_copy_rows.size());
+    std::vector<vertex_t> h_copy_cols(d_copy_cols.size());
+    raft::update_host(h_rows.data(), d_rows.data(), d_rows.size(), handle.get_stream());
+    raft::update_host(h_cols.data(), d_cols.data(), d_cols.size(), handle.get_stream());
+    raft::update_host(
+      h_copy_rows.data(), d_copy_rows.data(), d_copy_rows.size(), handle.get_stream());
+    raft::update_host(
+      h_copy_cols.data(), d_copy_cols.data(), d_copy_cols.size(), handle.get_stream());
+    std::vector<weight_t> h_weights(d_weights ? (*d_weights).size() : size_t{0});
+    std::vector<weight_t> h_copy_weights(d_copy_weights ? (*d_copy_weights).size() : size_t{0});
+    if (d_weights) {
+      raft::update_host(
+        h_weights.data(), (*d_weights).data(), (*d_weights).size(), handle.get_stream());
+    }
+    if (d_copy_weights) {
+      raft::update_host(h_copy_weights.data(),
+                        (*d_copy_weights).data(),
+                        (*d_copy_weights).size(),
+                        handle.get_stream());
+    }
+    handle.get_stream_view().synchronize();
+
+    // decompress_to_edgelist() visits edges in the storage order, so the outputs should coincide
+    // as is
+
+    ASSERT_TRUE(std::equal(h_rows.begin(), h_rows.end(), h_copy_rows.begin()));
+    ASSERT_TRUE(std::equal(h_cols.begin(), h_cols.end(), h_copy_cols.begin()));
+    ASSERT_TRUE(std::equal(h_weights.begin(), h_weights.end(), h_copy_weights.begin()));
+  }
+};
+
+using Tests_MGSerialization_File = Tests_MGSerialization<cugraph::test::File_Usecase>;
+using Tests_MGSerialization_Rmat = Tests_MGSerialization<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGSerialization_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGSerialization_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGSerialization_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGSerialization_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGSerialization_File,
+  ::testing::Combine(
+    ::testing::Values(MGSerialization_Usecase{false}, MGSerialization_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGSerialization_Rmat,
+  ::testing::Combine(
+    ::testing::Values(MGSerialization_Usecase{false}, MGSerialization_Usecase{true}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -24,6 +24,14 @@
 
 #include <cugraph/serialization/serializer.hpp>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
 TEST(SerializationTest, GraphSerUnser)
 {
   using namespace cugraph::serializer;
@@ -177,3 +185,112 @@ TEST(SerializationTest, UnweightedGraphDecoupledSerUnser)
     ASSERT_TRUE(pair.first);
   }
 }
+
+TEST(SerializationTest, GraphFileWriteRead)
+{
+  using namespace cugraph::serializer;
+
+  using vertex_t = int32_t;
+  using edge_t   = int64_t;
+  using weight_t = float;
+
+  raft::handle_t handle{};
+
+  edge_t num_edges      = 8;
+  vertex_t num_vertices = 6;
+
+  std::vector<vertex_t> v_src{0, 1, 1, 2, 2, 2, 3, 4};
+  std::vector<vertex_t> v_dst{1, 3, 4, 0, 1, 3, 5, 5};
+  std::vector<weight_t> v_w{0.1, 1.1, 2.1, 3.1, 4.1, 5.1, 6.1, 7.1};
+
+  auto graph = cugraph::test::make_graph(
+    handle, v_src, v_dst, std::optional<std::vector<weight_t>>{v_w}, num_vertices, num_edges);
+
+  std::string file_path =
+    ::testing::TempDir() + "cugraph_graph_file_test_" + std::to_string(getpid()) + ".bin";
+
+  serializer_t::write_graph_to_file(handle, graph, file_path);
+
+  auto graph_copy = serializer_t::read_graph_from_file<decltype(graph)>(handle, file_path);
+
+  auto pair = cugraph::test::compare_graphs(handle, graph, graph_copy);
+  if (pair.first == false) std::cerr << "Test failed with " << pair.second << ".\n";
+
+  // mismatching template parameters should be rejected
+  //
+  EXPECT_THROW(
+    (serializer_t::read_graph_from_file<cugraph::graph_t<int64_t, int64_t, float, false, false>>(
+      handle, file_path)),
+    cugraph::logic_error);
+
+  std::remove(file_path.c_str());
+
+  ASSERT_TRUE(pair.first);
+}
+
+TEST(SerializationTest, GraphHostAndFdSer)
+{
+  using namespace cugraph::serializer;
+
+  using vertex_t = int32_t;
+  using edge_t   = vertex_t;
+  using weight_t = double;
+
+  raft::handle_t handle{};
+
+  edge_t num_edges      = 8;
+  vertex_t num_vertices = 6;
+
+  std::vector<vertex_t> v_src{0, 1, 1, 2, 2, 2, 3, 4};
+  std::vector<vertex_t> v_dst{1, 3, 4, 0, 1, 3, 5, 5};
+  std::vector<weight_t> v_w{0.1, 1.1, 2.1, 3.1, 4.1, 5.1, 6.1, 7.1};
+
+  auto graph = cugraph::test::make_graph(
+    handle, v_src, v_dst, std::optional<std::vector<weight_t>>{v_w}, num_vertices, num_edges);
+
+  auto pair_sz      = serializer_t::get_device_graph_sz_bytes(graph);
+  auto total_ser_sz = pair_sz.first + pair_sz.second;
+
+  // serialize to host memory
+
+  std::vector<serializer_t::byte_t> h_storage(total_ser_sz);
+  {
+    serializer_t::graph_meta_t<decltype(graph)> graph_meta{};
+    serializer_t::serialize_to_host(handle, graph, h_storage.data(), graph_meta);
+    handle.get_stream_view().synchronize();
+  }
+
+  // serialize to a file descriptor (with a chunk size small enough to exercise pipelining)
+
+  std::vector<serializer_t::byte_t> h_fd_storage(total_ser_sz);
+  {
+    std::string file_path =
+      ::testing::TempDir() + "cugraph_graph_fd_test_" + std::to_string(getpid()) + ".bin";
+    auto fd = open(file_path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0600);
+    ASSERT_TRUE(fd != -1);
+    serializer_t::graph_meta_t<decltype(graph)> graph_meta{};
+    serializer_t::serialize_to_fd(handle, graph, fd, graph_meta, 16);
+    close(fd);
+
+    std::ifstream ifs(file_path, std::ios::binary);
+    ifs.read(reinterpret_cast<char*>(h_fd_storage.data()), h_fd_storage.size());
+    ASSERT_EQ(static_cast<size_t>(ifs.gcount()), total_ser_sz);
+    ASSERT_TRUE(ifs.peek() == std::ifstream::traits_type::eof());
+    ifs.close();
+    std::remove(file_path.c_str());
+  }
+
+  ASSERT_TRUE(std::equal(h_storage.begin(), h_storage.end(), h_fd_storage.begin()));
+
+  rmm::device_uvector<serializer_t::byte_t> d_storage(total_ser_sz, handle.get_stream());
+  raft::update_device(d_storage.data(), h_storage.data(), h_storage.size(), handle.get_stream());
+
+  serializer_t ser(handle, d_storage.data());
+
+  auto graph_copy = ser.unserialize<decltype(graph)>(pair_sz.first, pair_sz.second);
+
+  auto pair = cugraph::test::compare_graphs(handle, graph, graph_copy);
+  if (pair.first == false) std::cerr << "Test failed with " << pair.second << ".\n";
+
+  ASSERT_TRUE(pair.first);
+}
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+// self-loops are ignored; returns the (source, destination, weight) projected edges in the
+// cugraph::bipartite_projection_batched output order (for the top-k case, ties in weight are
+// broken by destination).
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<std::tuple<vertex_t, vertex_t, weight_t>> bipartite_projection_reference(
+  edge_t const* offsets,
+  vertex_t const* indices,
+  std::optional<weight_t const*> weights,
+  std::vector<vertex_t> const& projection_vertices,
+  std::optional<size_t> k)
+{
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges{};
+  for (auto a : projection_vertices) {
+    std::map<vertex_t, weight_t> projected_weights{};
+    for (auto i = offsets[a]; i < offsets[a + 1]; ++i) {
+      auto u = indices[i];
+      if (u == a) { continue; }
+      for (auto j = offsets[u]; j < offsets[u + 1]; ++j) {
+        auto b = indices[j];
+        if ((b != u) && (b != a)) {
+          projected_weights[b] += weights ? (*weights)[i] * (*weights)[j] : weight_t{1.0};
+        }
+      }
+    }
+    std::vector<std::tuple<vertex_t, vertex_t, weight_t>> a_edges{};
+    for (auto const& [b, w] : projected_weights) {
+      a_edges.push_back(std::make_tuple(a, b, w));
+    }
+    if (k) {
+      std::sort(a_edges.begin(), a_edges.end(), [](auto lhs, auto rhs) {
+        return std::get<2>(lhs) != std::get<2>(rhs) ? std::get<2>(lhs) > std::get<2>(rhs)
+                                                    : std::get<1>(lhs) < std::get<1>(rhs);
+      });
+      a_edges.resize(std::min(a_edges.size(), *k));
+    }
+    edges.insert(edges.end(), a_edges.begin(), a_edges.end());
+  }
+
+  return edges;
+}
+
+struct BipartiteProjection_Usecase {
+  size_t batch_memory_budget{std::numeric_limits<size_t>::max()};
+  std::optional<size_t> k{std::nullopt};
+  bool test_weighted{true};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_BipartiteProjection
+  : public ::testing::TestWithParam<std::tuple<BipartiteProjection_Usecase, input_usecase_t>> {
+ public:
+  Tests_BipartiteProjection() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(BipartiteProjection_Usecase const& projection_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, projection_usecase.test_weighted, false);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+    auto graph_view = graph.view();
+
+    std::vector<vertex_t> h_projection_vertices(graph_view.get_number_of_vertices());
+    std::iota(h_projection_vertices.begin(), h_projection_vertices.end(), vertex_t{0});
+    rmm::device_uvector<vertex_t> d_projection_vertices(h_projection_vertices.size(),
+                                                        handle.get_stream());
+    raft::update_device(d_projection_vertices.data(),
+                        h_projection_vertices.data(),
+                        h_projection_vertices.size(),
+                        handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    std::vector<weight_t> h_weights{};
+    size_t num_batches{0};
+    cugraph::bipartite_projection_batched(
+      handle,
+      graph_view,
+      d_projection_vertices.data(),
+      d_projection_vertices.size(),
+      projection_usecase.k,
+      projection_usecase.batch_memory_budget,
+      [&handle, &h_srcs, &h_dsts, &h_weights, &num_batches, &projection_usecase](
+        rmm::device_uvector<vertex_t>&& srcs,
+        rmm::device_uvector<vertex_t>&& dsts,
+        rmm::device_uvector<weight_t>&& weights) {
+        ++num_batches;
+        if (projection_usecase.check_correctness) {
+          auto old_size = h_srcs.size();
+          h_srcs.resize(old_size + srcs.size());
+          h_dsts.resize(old_size + dsts.size());
+          h_weights.resize(old_size + weights.size());
+          raft::update_host(
+            h_srcs.data() + old_size, srcs.data(), srcs.size(), handle.get_stream());
+          raft::update_host(
+            h_dsts.data() + old_size, dsts.data(), dsts.size(), handle.get_stream());
+          raft::update_host(
+            h_weights.data() + old_size, weights.data(), weights.size(), handle.get_stream());
+          handle.get_stream_view().synchronize();
+        }
+      });
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "bipartite_projection_batched (" << num_batches << " batches) took "
+                << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (projection_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      auto h_edge_weights = graph_view.is_weighted()
+                              ? std::make_optional<std::vector<weight_t>>(h_indices.size())
+                              : std::nullopt;
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        graph_view.get_number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      if (h_edge_weights) {
+        raft::update_host((*h_edge_weights).data(),
+                          *(graph_view.get_matrix_partition_view().get_weights()),
+                          graph_view.get_number_of_edges(),
+                          handle.get_stream());
+      }
+      handle.get_stream_view().synchronize();
+
+      auto h_reference_edges = bipartite_projection_reference(
+        h_offsets.data(),
+        h_indices.data(),
+        h_edge_weights ? std::optional<weight_t const*>{(*h_edge_weights).data()} : std::nullopt,
+        h_projection_vertices,
+        projection_usecase.k);
+
+      ASSERT_EQ(h_reference_edges.size(), h_srcs.size())
+        << "the number of projected edges does not match with the reference value.";
+
+      auto threshold_ratio     = weight_t{1e-4};
+      auto threshold_magnitude = std::numeric_limits<weight_t>::min();
+      auto nearly_equal        = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <=
+               std::max(std::max(std::abs(lhs), std::abs(rhs)) * threshold_ratio,
+                        threshold_magnitude);
+      };
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        auto [ref_src, ref_dst, ref_weight] = h_reference_edges[i];
+        ASSERT_EQ(h_srcs[i], ref_src) << "projected edge sources are not in order.";
+        ASSERT_TRUE(nearly_equal(h_weights[i], ref_weight))
+          << "projected edge weights do not match with the reference values.";
+        if (!projection_usecase.k) {  // in the top-k case, near ties can be ordered differently
+          ASSERT_EQ(h_dsts[i], ref_dst)
+            << "projected edge destinations do not match with the reference values.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_BipartiteProjection_File = Tests_BipartiteProjection<cugraph::test::File_Usecase>;
+using Tests_BipartiteProjection_Rmat = Tests_BipartiteProjection<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_BipartiteProjection_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_BipartiteProjection_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BipartiteProjection_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BipartiteProjection_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_BipartiteProjection_File,
+  ::testing::Combine(
+    // enable correctness checks (1 KB budget to project in many batches)
+    testing::Values(BipartiteProjection_Usecase{},
+                    BipartiteProjection_Usecase{1024},
+                    BipartiteProjection_Usecase{1024, 4},
+                    BipartiteProjection_Usecase{1024, std::nullopt, false}),
+    testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_BipartiteProjection_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(BipartiteProjection_Usecase{},
+                    BipartiteProjection_Usecase{1 << 16, 8},
+                    BipartiteProjection_Usecase{1 << 16, std::nullopt, false}),
+    testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_BipartiteProjection_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    testing::Values(BipartiteProjection_Usecase{size_t{1} << 30, 32, true, false}),
+    testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
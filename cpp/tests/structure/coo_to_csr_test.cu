@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/functions.hpp>
+#include <cugraph/legacy/graph.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+typedef struct CooToCsr_Usecase_t {
+  int32_t num_vertices{0};
+  int32_t num_edges{0};
+  bool sorted{false};  // generate the COO sorted by (src, dst)
+} CooToCsr_Usecase;
+
+class Tests_CooToCsr : public ::testing::TestWithParam<CooToCsr_Usecase> {
+ public:
+  Tests_CooToCsr() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // the CSR should be identical to the output of a stable sort by (src, dst), parallel edges keep
+  // their input order
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(CooToCsr_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    std::mt19937 gen(configuration.num_edges);
+    // few distinct vertices to create parallel edges and long neighbor lists
+    std::uniform_int_distribution<vertex_t> dist(0, configuration.num_vertices - 1);
+    std::vector<vertex_t> h_src(configuration.num_edges);
+    std::vector<vertex_t> h_dst(configuration.num_edges);
+    std::vector<weight_t> h_weights(configuration.num_edges);
+    for (int32_t i = 0; i < configuration.num_edges; ++i) {
+      h_src[i]     = (i % 4 == 0) ? vertex_t{0} : dist(gen);  // vertex 0 has a long list
+      h_dst[i]     = dist(gen);
+      h_weights[i] = static_cast<weight_t>(i);
+    }
+    h_src.back() = configuration.num_vertices - 1;
+
+    std::vector<edge_t> h_order(configuration.num_edges);
+    std::iota(h_order.begin(), h_order.end(), edge_t{0});
+    std::stable_sort(h_order.begin(), h_order.end(), [&](auto lhs, auto rhs) {
+      return std::make_tuple(h_src[lhs], h_dst[lhs]) < std::make_tuple(h_src[rhs], h_dst[rhs]);
+    });
+    if (configuration.sorted) {
+      std::vector<vertex_t> tmp_src(h_src.size());
+      std::vector<vertex_t> tmp_dst(h_dst.size());
+      for (size_t i = 0; i < h_order.size(); ++i) {
+        tmp_src[i]   = h_src[h_order[i]];
+        tmp_dst[i]   = h_dst[h_order[i]];
+        h_weights[i] = static_cast<weight_t>(h_order[i]);
+      }
+      h_src = std::move(tmp_src);
+      h_dst = std::move(tmp_dst);
+      std::iota(h_order.begin(), h_order.end(), edge_t{0});
+    }
+
+    std::vector<edge_t> h_reference_offsets(configuration.num_vertices + 1, edge_t{0});
+    for (auto v : h_src) {
+      ++h_reference_offsets[v + 1];
+    }
+    std::partial_sum(
+      h_reference_offsets.begin(), h_reference_offsets.end(), h_reference_offsets.begin());
+    std::vector<vertex_t> h_reference_indices(h_order.size());
+    std::vector<weight_t> h_reference_weights(h_order.size());
+    for (size_t i = 0; i < h_order.size(); ++i) {
+      h_reference_indices[i] = h_dst[h_order[i]];
+      h_reference_weights[i] = h_weights[h_order[i]];
+    }
+
+    auto d_src     = cugraph::test::to_device(handle, h_src);
+    auto d_dst     = cugraph::test::to_device(handle, h_dst);
+    auto d_weights = cugraph::test::to_device(handle, h_weights);
+
+    cugraph::legacy::GraphCOOView<vertex_t, edge_t, weight_t> coo_view(
+      d_src.data(),
+      d_dst.data(),
+      d_weights.data(),
+      configuration.num_vertices,
+      static_cast<edge_t>(configuration.num_edges));
+    auto csr      = cugraph::coo_to_csr(coo_view);
+    auto csr_view = csr->view();
+
+    ASSERT_EQ(csr_view.number_of_vertices, configuration.num_vertices);
+    ASSERT_EQ(csr_view.number_of_edges, static_cast<edge_t>(configuration.num_edges));
+
+    auto h_offsets = cugraph::test::to_host(handle, csr_view.offsets, h_reference_offsets.size());
+    auto h_indices = cugraph::test::to_host(handle, csr_view.indices, h_reference_indices.size());
+    auto h_csr_weights =
+      cugraph::test::to_host(handle, csr_view.edge_data, h_reference_weights.size());
+
+    ASSERT_TRUE(std::equal(h_offsets.begin(), h_offsets.end(), h_reference_offsets.begin()))
+      << "CSR offsets do not match with the reference values.";
+    ASSERT_TRUE(std::equal(h_indices.begin(), h_indices.end(), h_reference_indices.begin()))
+      << "CSR indices do not match with the reference values.";
+    ASSERT_TRUE(
+      std::equal(h_csr_weights.begin(), h_csr_weights.end(), h_reference_weights.begin()))
+      << "CSR weights do not match with the reference values.";
+
+    // the input COO is not modified
+
+    ASSERT_TRUE(std::equal(h_src.begin(),
+                           h_src.end(),
+                           cugraph::test::to_host(handle, d_src.data(), d_src.size()).begin()));
+    ASSERT_TRUE(std::equal(h_dst.begin(),
+                           h_dst.end(),
+                           cugraph::test::to_host(handle, d_dst.data(), d_dst.size()).begin()));
+  }
+};
+
+TEST_P(Tests_CooToCsr, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_CooToCsr, CheckInt64Int64Double)
+{
+  run_current_test<int64_t, int64_t, double>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(simple_test,
+                         Tests_CooToCsr,
+                         ::testing::Values(CooToCsr_Usecase{16, 256, false},
+                                           CooToCsr_Usecase{16, 256, true},
+                                           CooToCsr_Usecase{1024, 1 << 16, false},
+                                           CooToCsr_Usecase{1024, 1 << 16, true}));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+typedef struct CreateGraphFromEdgelistChunks_Usecase_t {
+  size_t num_chunks{1};
+  size_t edges_per_block{size_t{1} << 26};
+  bool test_weighted{false};
+  bool renumber{true};
+  bool check_correctness{true};
+} CreateGraphFromEdgelistChunks_Usecase;
+
+template <typename input_usecase_t>
+class Tests_CreateGraphFromEdgelistChunks
+  : public ::testing::TestWithParam<
+      std::tuple<CreateGraphFromEdgelistChunks_Usecase, input_usecase_t>> {
+ public:
+  Tests_CreateGraphFromEdgelistChunks() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(CreateGraphFromEdgelistChunks_Usecase const& chunks_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [d_rows, d_cols, d_weights, d_vertices, number_of_vertices, is_symmetric] =
+      input_usecase
+        .template construct_edgelist<vertex_t, edge_t, weight_t, store_transposed, false>(
+          handle, chunks_usecase.test_weighted);
+
+    std::vector<vertex_t> h_rows(d_rows.size());
+    std::vector<vertex_t> h_cols(h_rows.size());
+    auto h_weights =
+      d_weights ? std::make_optional<std::vector<weight_t>>(h_rows.size()) : std::nullopt;
+    raft::update_host(h_rows.data(), d_rows.data(), d_rows.size(), handle.get_stream());
+    raft::update_host(h_cols.data(), d_cols.data(), d_cols.size(), handle.get_stream());
+    if (h_weights) {
+      raft::update_host(
+        (*h_weights).data(), (*d_weights).data(), (*d_weights).size(), handle.get_stream());
+    }
+    handle.get_stream_view().synchronize();
+
+    // split the edge list into (roughly) equal size host chunks
+
+    std::vector<vertex_t const*> row_chunks(chunks_usecase.num_chunks);
+    std::vector<vertex_t const*> col_chunks(row_chunks.size());
+    auto weight_chunks = h_weights ? std::make_optional<std::vector<weight_t const*>>(
+                                       row_chunks.size(), nullptr)
+                                   : std::nullopt;
+    std::vector<edge_t> chunk_sizes(row_chunks.size());
+    auto approx_chunk_size = (h_rows.size() + row_chunks.size() - 1) / row_chunks.size();
+    for (size_t i = 0; i < row_chunks.size(); ++i) {
+      auto first     = std::min(approx_chunk_size * i, h_rows.size());
+      auto last      = std::min(first + approx_chunk_size, h_rows.size());
+      row_chunks[i]  = h_rows.data() + first;
+      col_chunks[i]  = h_cols.data() + first;
+      chunk_sizes[i] = static_cast<edge_t>(last - first);
+      if (weight_chunks) { (*weight_chunks)[i] = (*h_weights).data() + first; }
+    }
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::create_graph_from_edgelist_chunks<vertex_t, edge_t, weight_t, store_transposed>(
+        handle,
+        chunks_usecase.renumber
+          ? std::optional<rmm::device_uvector<vertex_t>>{std::move(d_vertices)}
+          : std::nullopt,
+        row_chunks,
+        col_chunks,
+        weight_chunks,
+        chunk_sizes,
+        cugraph::graph_properties_t{is_symmetric, false},
+        chunks_usecase.renumber,
+        chunks_usecase.edges_per_block,
+        true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "create_graph_from_edgelist_chunks took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (chunks_usecase.check_correctness) {
+      ASSERT_EQ(graph.get_number_of_edges(), static_cast<edge_t>(h_rows.size()));
+      if (!chunks_usecase.renumber) {
+        ASSERT_EQ(graph.get_number_of_vertices(),
+                  std::max(*std::max_element(h_rows.begin(), h_rows.end()),
+                           *std::max_element(h_cols.begin(), h_cols.end())) +
+                    1);
+      }
+
+      auto [d_graph_rows, d_graph_cols, d_graph_weights] =
+        graph.decompress_to_edgelist(handle, d_renumber_map_labels, false);
+
+      std::vector<vertex_t> h_graph_rows(d_graph_rows.size());
+      std::vector<vertex_t> h_graph_cols(h_graph_rows.size());
+      auto h_graph_weights =
+        d_graph_weights ? std::make_optional<std::vector<weight_t>>(h_graph_rows.size())
+                        : std::nullopt;
+      raft::update_host(
+        h_graph_rows.data(), d_graph_rows.data(), d_graph_rows.size(), handle.get_stream());
+      raft::update_host(
+        h_graph_cols.data(), d_graph_cols.data(), d_graph_cols.size(), handle.get_stream());
+      if (h_graph_weights) {
+        raft::update_host((*h_graph_weights).data(),
+                          (*d_graph_weights).data(),
+                          (*d_graph_weights).size(),
+                          handle.get_stream());
+      }
+      handle.get_stream_view().synchronize();
+
+      if (chunks_usecase.test_weighted) {
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> org_edges(h_rows.size());
+        for (size_t i = 0; i < org_edges.size(); ++i) {
+          org_edges[i] = std::make_tuple(h_rows[i], h_cols[i], (*h_weights)[i]);
+        }
+        std::sort(org_edges.begin(), org_edges.end());
+
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> graph_edges(h_graph_rows.size());
+        for (size_t i = 0; i < graph_edges.size(); ++i) {
+          graph_edges[i] =
+            std::make_tuple(h_graph_rows[i], h_graph_cols[i], (*h_graph_weights)[i]);
+        }
+        std::sort(graph_edges.begin(), graph_edges.end());
+
+        ASSERT_TRUE(std::equal(org_edges.begin(), org_edges.end(), graph_edges.begin()));
+      } else {
+        std::vector<std::tuple<vertex_t, vertex_t>> org_edges(h_rows.size());
+        for (size_t i = 0; i < org_edges.size(); ++i) {
+          org_edges[i] = std::make_tuple(h_rows[i], h_cols[i]);
+        }
+        std::sort(org_edges.begin(), org_edges.end());
+
+        std::vector<std::tuple<vertex_t, vertex_t>> graph_edges(h_graph_rows.size());
+        for (size_t i = 0; i < graph_edges.size(); ++i) {
+          graph_edges[i] = std::make_tuple(h_graph_rows[i], h_graph_cols[i]);
+        }
+        std::sort(graph_edges.begin(), graph_edges.end());
+
+        ASSERT_TRUE(std::equal(org_edges.begin(), org_edges.end(), graph_edges.begin()));
+      }
+    }
+  }
+};
+
+using Tests_CreateGraphFromEdgelistChunks_File =
+  Tests_CreateGraphFromEdgelistChunks<cugraph::test::File_Usecase>;
+using Tests_CreateGraphFromEdgelistChunks_Rmat =
+  Tests_CreateGraphFromEdgelistChunks<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_CreateGraphFromEdgelistChunks_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_CreateGraphFromEdgelistChunks_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_CreateGraphFromEdgelistChunks_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_CreateGraphFromEdgelistChunks_Rmat, CheckInt32Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_CreateGraphFromEdgelistChunks_Rmat, CheckInt64Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_CreateGraphFromEdgelistChunks_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(CreateGraphFromEdgelistChunks_Usecase{1, size_t{1} << 26, false, true},
+                      CreateGraphFromEdgelistChunks_Usecase{3, 100, true, true},
+                      CreateGraphFromEdgelistChunks_Usecase{4, 1000, false, false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_CreateGraphFromEdgelistChunks_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(CreateGraphFromEdgelistChunks_Usecase{1, size_t{1} << 26, true, true},
+                      CreateGraphFromEdgelistChunks_Usecase{5, 1024, false, true},
+                      CreateGraphFromEdgelistChunks_Usecase{5, 1024, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_CreateGraphFromEdgelistChunks_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(
+      CreateGraphFromEdgelistChunks_Usecase{8, size_t{1} << 24, false, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
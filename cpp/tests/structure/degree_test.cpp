@@ -141,6 +141,51 @@ class Tests_Degree : public ::testing::TestWithParam<Degree_Usecase> {
                            h_reference_out_degrees.end(),
                            h_cugraph_out_degrees.begin()))
       << "Out-degree values do not match with the reference values.";
+
+    // the degree cache returns the same values, computed once and shared by the views
+
+    ASSERT_FALSE(graph_view.get_cached_in_degrees(handle).has_value())
+      << "Views of a graph without the degree cache should not return cached degrees.";
+
+    graph.enable_degree_cache();
+    auto cached_graph_view = graph.view();
+    auto cached_in_degrees = cached_graph_view.get_cached_in_degrees(handle);
+    ASSERT_TRUE(cached_in_degrees.has_value());
+    ASSERT_TRUE(graph.view().get_cached_in_degrees(handle) == cached_in_degrees)
+      << "Views of the same graph should share the cached in-degrees.";
+    auto cached_out_degrees = cached_graph_view.get_cached_out_degrees(handle);
+    ASSERT_TRUE(cached_out_degrees.has_value());
+
+    std::vector<edge_t> h_cached_in_degrees(graph_view.get_number_of_vertices());
+    std::vector<edge_t> h_cached_out_degrees(graph_view.get_number_of_vertices());
+
+    raft::update_host(h_cached_in_degrees.data(),
+                      *cached_in_degrees,
+                      h_cached_in_degrees.size(),
+                      handle.get_stream());
+    raft::update_host(h_cached_out_degrees.data(),
+                      *cached_out_degrees,
+                      h_cached_out_degrees.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(std::equal(
+      h_reference_in_degrees.begin(), h_reference_in_degrees.end(), h_cached_in_degrees.begin()))
+      << "Cached in-degree values do not match with the reference values.";
+    ASSERT_TRUE(std::equal(
+      h_reference_out_degrees.begin(), h_reference_out_degrees.end(), h_cached_out_degrees.begin()))
+      << "Cached out-degree values do not match with the reference values.";
+
+    auto reference_max_out_degree =
+      h_reference_out_degrees.size() > 0
+        ? *std::max_element(h_reference_out_degrees.begin(), h_reference_out_degrees.end())
+        : edge_t{0};
+    ASSERT_EQ(*(cached_graph_view.get_cached_max_out_degree(handle)), reference_max_out_degree)
+      << "Cached maximum out-degree does not match with the reference value.";
+
+    graph.disable_degree_cache();
+    ASSERT_FALSE(graph.view().get_cached_in_degrees(handle).has_value())
+      << "Views obtained after disable_degree_cache() should not return cached degrees.";
   }
 };
 
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+typedef struct DynamicGraph_Usecase_t {
+  bool test_weighted{false};
+  bool check_correctness{true};
+} DynamicGraph_Usecase;
+
+template <typename input_usecase_t>
+class Tests_DynamicGraph
+  : public ::testing::TestWithParam<std::tuple<DynamicGraph_Usecase, input_usecase_t>> {
+ public:
+  Tests_DynamicGraph() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> to_sorted_host_edges(
+    raft::handle_t const& handle,
+    rmm::device_uvector<vertex_t> const& d_rows,
+    rmm::device_uvector<vertex_t> const& d_cols,
+    std::optional<rmm::device_uvector<weight_t>> const& d_weights)
+  {
+    std::vector<vertex_t> h_rows(d_rows.size());
+    std::vector<vertex_t> h_cols(h_rows.size());
+    std::vector<weight_t> h_weights(d_weights ? h_rows.size() : size_t{0});
+    raft::update_host(h_rows.data(), d_rows.data(), d_rows.size(), handle.get_stream());
+    raft::update_host(h_cols.data(), d_cols.data(), d_cols.size(), handle.get_stream());
+    if (d_weights) {
+      raft::update_host(
+        h_weights.data(), (*d_weights).data(), (*d_weights).size(), handle.get_stream());
+    }
+    handle.get_stream_view().synchronize();
+
+    std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges(h_rows.size());
+    for (size_t i = 0; i < edges.size(); ++i) {
+      edges[i] =
+        std::make_tuple(h_rows[i], h_cols[i], d_weights ? h_weights[i] : weight_t{1.0});
+    }
+    std::sort(edges.begin(), edges.end());
+
+    return edges;
+  }
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(DynamicGraph_Usecase const& dynamic_graph_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, dynamic_graph_usecase.test_weighted, renumber);
+    auto number_of_edges = graph.get_number_of_edges();
+
+    // 1. select the edges to delete (this selection is invariant under reversing an edge, so the
+    // graph remains symmetric if the input graph is symmetric)
+
+    auto [d_org_rows, d_org_cols, d_org_weights] =
+      graph.decompress_to_edgelist(handle, std::nullopt, false);
+    auto org_edges = to_sorted_host_edges<vertex_t, edge_t, weight_t>(
+      handle, d_org_rows, d_org_cols, d_org_weights);
+
+    auto is_deleted = [](auto e) { return (std::get<0>(e) + std::get<1>(e)) % 7 == 0; };
+    std::vector<std::tuple<vertex_t, vertex_t, weight_t>> deleted_edges{};
+    std::vector<std::tuple<vertex_t, vertex_t, weight_t>> remaining_edges{};
+    std::partition_copy(org_edges.begin(),
+                        org_edges.end(),
+                        std::back_inserter(deleted_edges),
+                        std::back_inserter(remaining_edges),
+                        is_deleted);
+
+    std::vector<vertex_t> h_deleted_rows(deleted_edges.size());
+    std::vector<vertex_t> h_deleted_cols(h_deleted_rows.size());
+    std::vector<weight_t> h_deleted_weights(h_deleted_rows.size());
+    for (size_t i = 0; i < deleted_edges.size(); ++i) {
+      std::tie(h_deleted_rows[i], h_deleted_cols[i], h_deleted_weights[i]) = deleted_edges[i];
+    }
+    rmm::device_uvector<vertex_t> d_deleted_rows(h_deleted_rows.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_deleted_cols(d_deleted_rows.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> d_deleted_weights(d_deleted_rows.size(), handle.get_stream());
+    raft::update_device(
+      d_deleted_rows.data(), h_deleted_rows.data(), h_deleted_rows.size(), handle.get_stream());
+    raft::update_device(
+      d_deleted_cols.data(), h_deleted_cols.data(), h_deleted_cols.size(), handle.get_stream());
+    raft::update_device(d_deleted_weights.data(),
+                        h_deleted_weights.data(),
+                        h_deleted_weights.size(),
+                        handle.get_stream());
+
+    // 2. delete the edges
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    graph.delete_edges(
+      handle, d_deleted_rows.data(), d_deleted_cols.data(), d_deleted_rows.size());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "delete_edges took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (deleted_edges.size() > 0) { ASSERT_TRUE(graph.has_deleted_edges()); }
+
+    if (dynamic_graph_usecase.check_correctness) {
+      auto [d_rows, d_cols, d_weights] = graph.decompress_to_edgelist(handle, std::nullopt, false);
+      auto edges =
+        to_sorted_host_edges<vertex_t, edge_t, weight_t>(handle, d_rows, d_cols, d_weights);
+      ASSERT_EQ(edges.size(), remaining_edges.size());
+      ASSERT_TRUE(std::equal(edges.begin(), edges.end(), remaining_edges.begin()));
+
+      // the prims skip the deleted edges
+
+      auto d_out_degrees = graph.view().compute_out_degrees(handle);
+      std::vector<edge_t> h_out_degrees(d_out_degrees.size());
+      raft::update_host(
+        h_out_degrees.data(), d_out_degrees.data(), d_out_degrees.size(), handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      std::vector<edge_t> h_reference_out_degrees(graph.get_number_of_vertices(), edge_t{0});
+      for (auto e : remaining_edges) {
+        ++h_reference_out_degrees[std::get<0>(e)];
+      }
+      ASSERT_TRUE(std::equal(
+        h_out_degrees.begin(), h_out_degrees.end(), h_reference_out_degrees.begin()));
+    }
+
+    // 3. re-insert the deleted edges
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    graph.insert_edges(handle,
+                       d_deleted_rows.data(),
+                       d_deleted_cols.data(),
+                       dynamic_graph_usecase.test_weighted
+                         ? std::optional<weight_t const*>{d_deleted_weights.data()}
+                         : std::nullopt,
+                       d_deleted_rows.size());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "insert_edges took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    ASSERT_FALSE(graph.has_deleted_edges());
+    ASSERT_EQ(graph.get_number_of_edges(), number_of_edges);
+
+    if (dynamic_graph_usecase.check_correctness) {
+      auto [d_rows, d_cols, d_weights] = graph.decompress_to_edgelist(handle, std::nullopt, false);
+      auto edges =
+        to_sorted_host_edges<vertex_t, edge_t, weight_t>(handle, d_rows, d_cols, d_weights);
+      ASSERT_EQ(edges.size(), org_edges.size());
+      ASSERT_TRUE(std::equal(edges.begin(), edges.end(), org_edges.begin()));
+    }
+
+    // 4. delete again and reclaim the storage
+
+    graph.delete_edges(
+      handle, d_deleted_rows.data(), d_deleted_cols.data(), d_deleted_rows.size());
+    graph.compact_edges(handle);
+
+    ASSERT_FALSE(graph.has_deleted_edges());
+    ASSERT_EQ(graph.get_number_of_edges(), static_cast<edge_t>(remaining_edges.size()));
+  }
+};
+
+using Tests_DynamicGraph_File = Tests_DynamicGraph<cugraph::test::File_Usecase>;
+using Tests_DynamicGraph_Rmat = Tests_DynamicGraph<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_DynamicGraph_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_DynamicGraph_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_DynamicGraph_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_DynamicGraph_Rmat, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_DynamicGraph_Rmat, CheckInt64Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_DynamicGraph_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(DynamicGraph_Usecase{false}, DynamicGraph_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_DynamicGraph_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(DynamicGraph_Usecase{false}, DynamicGraph_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_DynamicGraph_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(DynamicGraph_Usecase{false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
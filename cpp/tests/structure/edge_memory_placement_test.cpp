@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+typedef struct EdgeMemoryPlacement_Usecase_t {
+  cugraph::edge_memory_placement_t placement{cugraph::edge_memory_placement_t::managed};
+  int32_t tile_size{1 << 24};
+  bool test_weighted{false};
+} EdgeMemoryPlacement_Usecase;
+
+template <typename input_usecase_t>
+class Tests_EdgeMemoryPlacement
+  : public ::testing::TestWithParam<std::tuple<EdgeMemoryPlacement_Usecase, input_usecase_t>> {
+ public:
+  Tests_EdgeMemoryPlacement() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // PageRank (copy_v_transform_reduce_in_nbr) results should not depend on the edge placement
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(EdgeMemoryPlacement_Usecase const& placement_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    if (placement_usecase.placement == cugraph::edge_memory_placement_t::managed) {
+      int device{0};
+      int concurrent_managed_access{0};
+      CUDA_TRY(cudaGetDevice(&device));
+      CUDA_TRY(cudaDeviceGetAttribute(
+        &concurrent_managed_access, cudaDevAttrConcurrentManagedAccess, device));
+      if (concurrent_managed_access == 0) {
+        GTEST_SKIP() << "Concurrent managed access is not supported.";
+      }
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, placement_usecase.test_weighted, true);
+    auto memory_size = graph.get_memory_size();
+
+    auto run_pagerank = [&]() {
+      auto graph_view = graph.view();
+      rmm::device_uvector<weight_t> d_pageranks(graph_view.get_number_of_vertices(),
+                                                handle.get_stream());
+      cugraph::pagerank<vertex_t, edge_t, weight_t, weight_t, false>(handle,
+                                                                     graph_view,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     std::nullopt,
+                                                                     d_pageranks.data(),
+                                                                     weight_t{0.85},
+                                                                     weight_t{1e-6});
+      return cugraph::test::to_host(handle, d_pageranks.data(), d_pageranks.size());
+    };
+
+    auto h_device_pageranks = run_pagerank();
+
+    graph.set_edge_memory_placement(
+      handle, placement_usecase.placement, static_cast<edge_t>(placement_usecase.tile_size));
+    ASSERT_EQ(graph.get_edge_memory_placement(), placement_usecase.placement);
+    ASSERT_EQ(graph.get_memory_size(), memory_size);
+    ASSERT_EQ(graph.view().get_edge_tile_size().has_value(),
+              placement_usecase.placement == cugraph::edge_memory_placement_t::managed);
+
+    auto h_placed_pageranks = run_pagerank();
+
+    ASSERT_EQ(h_device_pageranks.size(), h_placed_pageranks.size());
+    auto threshold_ratio = 1e-3;
+    auto threshold_magnitude =
+      (1.0 / static_cast<weight_t>(h_device_pageranks.size())) * threshold_ratio;
+    for (size_t i = 0; i < h_device_pageranks.size(); ++i) {
+      ASSERT_TRUE(std::abs(h_device_pageranks[i] - h_placed_pageranks[i]) <=
+                  std::max(std::abs(h_device_pageranks[i]) * threshold_ratio,
+                           threshold_magnitude))
+        << "PageRank values differ at vertex " << i << ".";
+    }
+
+    // back to the device memory
+    graph.set_edge_memory_placement(handle, cugraph::edge_memory_placement_t::device);
+    ASSERT_EQ(graph.get_edge_memory_placement(), cugraph::edge_memory_placement_t::device);
+    ASSERT_FALSE(graph.view().get_edge_tile_size().has_value());
+  }
+};
+
+using Tests_EdgeMemoryPlacement_File = Tests_EdgeMemoryPlacement<cugraph::test::File_Usecase>;
+using Tests_EdgeMemoryPlacement_Rmat = Tests_EdgeMemoryPlacement<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_EdgeMemoryPlacement_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_EdgeMemoryPlacement_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_EdgeMemoryPlacement_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_EdgeMemoryPlacement_File,
+  ::testing::Combine(
+    // small tiles to exercise the tiled sweeps
+    ::testing::Values(
+      EdgeMemoryPlacement_Usecase{cugraph::edge_memory_placement_t::managed, 64, false},
+      EdgeMemoryPlacement_Usecase{cugraph::edge_memory_placement_t::managed, 64, true},
+      EdgeMemoryPlacement_Usecase{cugraph::edge_memory_placement_t::pinned_host, 64, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_EdgeMemoryPlacement_Rmat,
+  ::testing::Combine(
+    ::testing::Values(
+      EdgeMemoryPlacement_Usecase{cugraph::edge_memory_placement_t::managed, 1024, false},
+      EdgeMemoryPlacement_Usecase{cugraph::edge_memory_placement_t::managed, 1 << 24, true},
+      EdgeMemoryPlacement_Usecase{cugraph::edge_memory_placement_t::pinned_host, 1024, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
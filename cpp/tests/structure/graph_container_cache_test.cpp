@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/utilities/cython.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace {
+
+void populate_test_graph_container(raft::handle_t& handle,
+                                   cugraph::cython::graph_container_t& graph_container,
+                                   rmm::device_uvector<int32_t>& d_srcs,
+                                   rmm::device_uvector<int32_t>& d_dsts,
+                                   rmm::device_uvector<float>& d_weights,
+                                   size_t num_vertices)
+{
+  cugraph::cython::populate_graph_container(graph_container,
+                                            handle,
+                                            d_srcs.data(),
+                                            d_dsts.data(),
+                                            d_weights.data(),
+                                            nullptr,
+                                            nullptr,
+                                            0,
+                                            cugraph::cython::numberTypeEnum::int32Type,
+                                            cugraph::cython::numberTypeEnum::int32Type,
+                                            cugraph::cython::numberTypeEnum::floatType,
+                                            d_srcs.size(),
+                                            num_vertices,
+                                            d_srcs.size(),
+                                            true,
+                                            false,
+                                            true,
+                                            false);
+}
+
+std::vector<float> run_pagerank(raft::handle_t const& handle,
+                                cugraph::cython::graph_container_t const& graph_container,
+                                size_t num_vertices)
+{
+  rmm::device_uvector<float> d_pageranks(num_vertices, handle.get_stream());
+  cugraph::cython::call_pagerank<int32_t, float>(handle,
+                                                 graph_container,
+                                                 nullptr,
+                                                 d_pageranks.data(),
+                                                 int32_t{0},
+                                                 nullptr,
+                                                 nullptr,
+                                                 0.85,
+                                                 1e-6,
+                                                 int64_t{100},
+                                                 false);
+  return cugraph::test::to_host(handle, d_pageranks.data(), d_pageranks.size());
+}
+
+bool nearly_equal(std::vector<float> const& lhs, std::vector<float> const& rhs)
+{
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](auto l, auto r) {
+    return std::fabs(l - r) < 1e-5;
+  });
+}
+
+}  // namespace
+
+// Every wrapper call creates its own handle (as the Python wrappers do); a graph_t cached in the
+// container should stay usable after the handle of the call that built it is destroyed.
+TEST(graph_container_cache, wrapper_calls_with_different_handles)
+{
+  size_t constexpr num_vertices{6};
+  std::vector<int32_t> h_srcs{0, 1, 1, 2, 2, 2, 3, 4};
+  std::vector<int32_t> h_dsts{1, 3, 4, 0, 1, 3, 5, 5};
+  std::vector<float> h_weights{0.1, 2.1, 1.1, 5.1, 3.1, 4.1, 7.2, 3.2};
+
+  raft::handle_t handle{};
+  auto d_srcs    = cugraph::test::to_device(handle, h_srcs);
+  auto d_dsts    = cugraph::test::to_device(handle, h_dsts);
+  auto d_weights = cugraph::test::to_device(handle, h_weights);
+
+  // reference, a graph_t is built for the call (no persistent graph handle)
+
+  cugraph::cython::graph_container_t reference_container{};
+  populate_test_graph_container(
+    handle, reference_container, d_srcs, d_dsts, d_weights, num_vertices);
+  auto h_reference_pageranks = run_pagerank(handle, reference_container, num_vertices);
+  ASSERT_TRUE(reference_container.graph_cache.empty());
+
+  // cached graph_t, built with the persistent graph handle
+
+  cugraph::cython::graph_container_t graph_container{};
+  populate_test_graph_container(handle, graph_container, d_srcs, d_dsts, d_weights, num_vertices);
+  cugraph::cython::set_graph_container_handle(graph_container,
+                                              std::make_shared<raft::handle_t>());
+
+  std::shared_ptr<void> cached_graph{};
+  {
+    auto first_handle = std::make_unique<raft::handle_t>();
+    auto h_pageranks  = run_pagerank(*first_handle, graph_container, num_vertices);
+    ASSERT_TRUE(nearly_equal(h_pageranks, h_reference_pageranks))
+      << "PageRank values on the first handle do not match with the reference values.";
+    ASSERT_EQ(graph_container.graph_cache.size(), size_t{1});
+    cached_graph = graph_container.graph_cache.begin()->second.graph;
+  }
+  {
+    auto second_handle = std::make_unique<raft::handle_t>();
+    auto h_pageranks   = run_pagerank(*second_handle, graph_container, num_vertices);
+    ASSERT_TRUE(nearly_equal(h_pageranks, h_reference_pageranks))
+      << "PageRank values on the second handle do not match with the reference values.";
+    ASSERT_EQ(graph_container.graph_cache.size(), size_t{1});
+    ASSERT_EQ(graph_container.graph_cache.begin()->second.graph, cached_graph)
+      << "the cached graph_t should be reused.";
+  }
+
+  // the cached graph_t is rebuilt once the primitive data (and data_version) change
+
+  auto d_other_weights =
+    cugraph::test::to_device(handle, std::vector<float>(h_weights.size(), 1.0));
+  graph_container.weights = d_other_weights.data();
+  ++graph_container.data_version;
+  run_pagerank(handle, graph_container, num_vertices);
+  ASSERT_NE(graph_container.graph_cache.begin()->second.graph, cached_graph)
+    << "the cached graph_t should be rebuilt once the primitive data changes.";
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph_readers.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct GraphReaders_Usecase {
+  std::string graph_file_path{};
+  size_t chunk_size{size_t{1} << 26};
+};
+
+class Tests_GraphReaders : public ::testing::TestWithParam<GraphReaders_Usecase> {
+ public:
+  Tests_GraphReaders() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename weight_t>
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> to_sorted_host_edges(
+    raft::handle_t const& handle,
+    rmm::device_uvector<vertex_t> const& d_srcs,
+    rmm::device_uvector<vertex_t> const& d_dsts,
+    rmm::device_uvector<weight_t> const& d_weights)
+  {
+    auto h_srcs    = cugraph::test::to_host(handle, d_srcs.data(), d_srcs.size());
+    auto h_dsts    = cugraph::test::to_host(handle, d_dsts.data(), d_dsts.size());
+    auto h_weights = cugraph::test::to_host(handle, d_weights.data(), d_weights.size());
+    std::vector<std::tuple<vertex_t, vertex_t, weight_t>> h_edges(h_srcs.size());
+    for (size_t i = 0; i < h_edges.size(); ++i) {
+      h_edges[i] = std::make_tuple(h_srcs[i], h_dsts[i], h_weights[i]);
+    }
+    std::sort(h_edges.begin(), h_edges.end());
+    return h_edges;
+  }
+
+  // the GPU parsed edge lists should match the edge list read by the host (test) reader
+  template <typename vertex_t, typename weight_t>
+  void run_current_test(GraphReaders_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    auto graph_file_full_path =
+      cugraph::test::get_rapids_dataset_root_dir() + "/" + configuration.graph_file_path;
+
+    auto [d_ref_srcs, d_ref_dsts, d_ref_weights, d_ref_vertices, ref_num_vertices, ref_symmetric] =
+      cugraph::test::read_edgelist_from_matrix_market_file<vertex_t, weight_t, false, false>(
+        handle, graph_file_full_path, true);
+    auto h_ref_edges = to_sorted_host_edges(handle, d_ref_srcs, d_ref_dsts, *d_ref_weights);
+
+    // 1. Matrix Market
+
+    auto [d_srcs, d_dsts, d_weights, num_vertices, is_symmetric] =
+      cugraph::read_matrix_market_edgelist<vertex_t, weight_t, false>(
+        handle, graph_file_full_path, true, configuration.chunk_size);
+    ASSERT_EQ(num_vertices, ref_num_vertices);
+    ASSERT_EQ(is_symmetric, ref_symmetric);
+    ASSERT_TRUE(d_weights.has_value());
+
+    auto h_edges = to_sorted_host_edges(handle, d_srcs, d_dsts, *d_weights);
+    ASSERT_EQ(h_edges.size(), h_ref_edges.size());
+    for (size_t i = 0; i < h_edges.size(); ++i) {
+      ASSERT_EQ(std::get<0>(h_edges[i]), std::get<0>(h_ref_edges[i]));
+      ASSERT_EQ(std::get<1>(h_edges[i]), std::get<1>(h_ref_edges[i]));
+      ASSERT_NEAR(std::get<2>(h_edges[i]),
+                  std::get<2>(h_ref_edges[i]),
+                  std::abs(std::get<2>(h_ref_edges[i])) * weight_t{1e-6});
+    }
+
+    // 2. delimited (with a header line, comment lines, and CRLF line endings)
+
+    auto csv_file_path = ::testing::TempDir() + "graph_readers_test.csv";
+    {
+      std::ofstream csv_file(csv_file_path, std::ios::binary);
+      csv_file << "src,dst,weight\r\n";
+      csv_file << std::setprecision(std::numeric_limits<weight_t>::max_digits10);
+      for (size_t i = 0; i < h_ref_edges.size(); ++i) {
+        if (i % 100 == 0) { csv_file << "# comment\r\n"; }
+        csv_file << std::get<0>(h_ref_edges[i]) << "," << std::get<1>(h_ref_edges[i]) << ","
+                 << std::get<2>(h_ref_edges[i]) << "\r\n";
+      }
+    }
+
+    auto [d_csv_srcs, d_csv_dsts, d_csv_weights, csv_num_vertices] =
+      cugraph::read_delimited_edgelist<vertex_t, weight_t, false>(
+        handle, csv_file_path, true, ',', size_t{1}, configuration.chunk_size);
+    std::remove(csv_file_path.c_str());
+
+    vertex_t max_vertex{-1};
+    for (auto const& e : h_ref_edges) {
+      max_vertex = std::max(max_vertex, std::max(std::get<0>(e), std::get<1>(e)));
+    }
+    ASSERT_EQ(csv_num_vertices, max_vertex + 1);
+    ASSERT_TRUE(d_csv_weights.has_value());
+
+    auto h_csv_edges = to_sorted_host_edges(handle, d_csv_srcs, d_csv_dsts, *d_csv_weights);
+    ASSERT_EQ(h_csv_edges.size(), h_ref_edges.size());
+    for (size_t i = 0; i < h_csv_edges.size(); ++i) {
+      ASSERT_EQ(std::get<0>(h_csv_edges[i]), std::get<0>(h_ref_edges[i]));
+      ASSERT_EQ(std::get<1>(h_csv_edges[i]), std::get<1>(h_ref_edges[i]));
+      ASSERT_NEAR(std::get<2>(h_csv_edges[i]),
+                  std::get<2>(h_ref_edges[i]),
+                  std::abs(std::get<2>(h_ref_edges[i])) * weight_t{1e-6});
+    }
+  }
+};
+
+TEST_P(Tests_GraphReaders, CheckInt32Float)
+{
+  run_current_test<int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_GraphReaders, CheckInt64Double)
+{
+  run_current_test<int64_t, double>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_GraphReaders,
+  ::testing::Values(
+    // small chunks to exercise the lines spanning multiple chunks
+    GraphReaders_Usecase{"test/datasets/karate.mtx", size_t{16}},
+    GraphReaders_Usecase{"test/datasets/karate.mtx", size_t{1} << 26},
+    GraphReaders_Usecase{"test/datasets/dolphins.mtx", size_t{256}},
+    GraphReaders_Usecase{"test/datasets/netscience.mtx", size_t{1024}},
+    GraphReaders_Usecase{"test/datasets/netscience.mtx", size_t{1} << 26}));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+template <typename vertex_t, typename edge_t>
+std::vector<vertex_t> log2_degree_histogram_reference(std::vector<edge_t> const& degrees)
+{
+  std::vector<vertex_t> histogram{vertex_t{0}};
+  for (auto d : degrees) {
+    size_t bin{0};
+    while ((edge_t{1} << bin) <= d) {
+      ++bin;
+    }
+    if (bin >= histogram.size()) { histogram.resize(bin + 1, vertex_t{0}); }
+    ++histogram[bin];
+  }
+  while ((histogram.size() > 1) && (histogram.back() == vertex_t{0})) {
+    histogram.pop_back();
+  }
+  return histogram;
+}
+
+struct GraphSummary_Usecase {
+  bool test_weighted{false};
+};
+
+template <typename input_usecase_t>
+class Tests_GraphSummary
+  : public ::testing::TestWithParam<std::tuple<GraphSummary_Usecase, input_usecase_t>> {
+ public:
+  Tests_GraphSummary() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // the single pass summary should match the separate counting & degree functions
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(GraphSummary_Usecase const& summary_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, summary_usecase.test_weighted, true);
+    auto graph_view = graph.view();
+
+    auto summary = cugraph::graph_summary(handle, graph_view);
+
+    ASSERT_EQ(summary.number_of_vertices, graph_view.get_number_of_vertices());
+    ASSERT_EQ(summary.number_of_edges, graph_view.get_number_of_edges());
+    ASSERT_EQ(summary.number_of_self_loops, graph_view.count_self_loops(handle));
+    ASSERT_EQ(summary.number_of_multi_edges, graph_view.count_multi_edges(handle));
+
+    auto d_out_degrees = graph_view.compute_out_degrees(handle);
+    auto d_in_degrees  = graph_view.compute_in_degrees(handle);
+    auto h_out_degrees = cugraph::test::to_host(handle, d_out_degrees.data(), d_out_degrees.size());
+    auto h_in_degrees  = cugraph::test::to_host(handle, d_in_degrees.data(), d_in_degrees.size());
+
+    if (h_out_degrees.size() > 0) {
+      ASSERT_EQ(summary.min_out_degree,
+                *std::min_element(h_out_degrees.begin(), h_out_degrees.end()));
+      ASSERT_EQ(summary.max_out_degree,
+                *std::max_element(h_out_degrees.begin(), h_out_degrees.end()));
+      ASSERT_EQ(summary.min_in_degree, *std::min_element(h_in_degrees.begin(), h_in_degrees.end()));
+      ASSERT_EQ(summary.max_in_degree, *std::max_element(h_in_degrees.begin(), h_in_degrees.end()));
+    }
+    ASSERT_TRUE(summary.out_degree_histogram ==
+                (log2_degree_histogram_reference<vertex_t, edge_t>(h_out_degrees)));
+    ASSERT_TRUE(summary.in_degree_histogram ==
+                (log2_degree_histogram_reference<vertex_t, edge_t>(h_in_degrees)));
+
+    ASSERT_EQ(summary.weight_sum.has_value(), graph_view.is_weighted());
+    if (graph_view.is_weighted()) {
+      auto d_weights = std::get<2>(graph.decompress_to_edgelist(handle, std::nullopt, false));
+      auto h_weights = cugraph::test::to_host(handle, (*d_weights).data(), (*d_weights).size());
+      if (h_weights.size() > 0) {
+        ASSERT_EQ(*(summary.min_weight), *std::min_element(h_weights.begin(), h_weights.end()));
+        ASSERT_EQ(*(summary.max_weight), *std::max_element(h_weights.begin(), h_weights.end()));
+      }
+      double h_weight_sum{0.0};
+      for (auto w : h_weights) {
+        h_weight_sum += w;
+      }
+      ASSERT_NEAR(static_cast<double>(*(summary.weight_sum)),
+                  h_weight_sum,
+                  std::abs(h_weight_sum) * weight_t{1e-4});
+    }
+  }
+};
+
+using Tests_GraphSummary_File = Tests_GraphSummary<cugraph::test::File_Usecase>;
+using Tests_GraphSummary_Rmat = Tests_GraphSummary<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_GraphSummary_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphSummary_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphSummary_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphSummary_Rmat, CheckInt64Int64FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, true>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_GraphSummary_File,
+  ::testing::Combine(
+    ::testing::Values(GraphSummary_Usecase{false}, GraphSummary_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/webbase-1M.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_GraphSummary_Rmat,
+  ::testing::Combine(
+    ::testing::Values(GraphSummary_Usecase{false}, GraphSummary_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -28,6 +28,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <numeric>
 #include <tuple>
@@ -204,6 +205,107 @@ class Tests_Graph : public ::testing::TestWithParam<Graph_Usecase> {
           << " do not match with the reference values.";
       }
     }
+
+    // construct from already sorted compressed sparse arrays (this skips the neighbor list sort)
+
+    {
+      auto d_offsets = cugraph::test::to_device(handle, h_cugraph_offsets);
+      auto d_indices = cugraph::test::to_device(handle, h_cugraph_indices);
+      auto d_csr_weights =
+        h_cugraph_weights
+          ? std::make_optional<rmm::device_uvector<weight_t>>(
+              cugraph::test::to_device(handle, *h_cugraph_weights))
+          : std::nullopt;
+      auto csr_graph = cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle,
+        std::move(d_offsets),
+        std::move(d_indices),
+        std::move(d_csr_weights),
+        cugraph::graph_meta_t<vertex_t, edge_t, false>{
+          number_of_vertices, cugraph::graph_properties_t{is_symmetric, false}, std::nullopt},
+        true);
+      auto csr_graph_view = csr_graph.view();
+
+      auto h_csr_indices = cugraph::test::to_host(
+        handle,
+        csr_graph_view.get_matrix_partition_view().get_indices(),
+        csr_graph_view.get_number_of_edges());
+      ASSERT_TRUE(std::equal(h_csr_indices.begin(), h_csr_indices.end(), h_cugraph_indices.begin()))
+        << "Graph constructed from sorted compressed sparse arrays does not preserve the input.";
+      if (h_cugraph_weights) {
+        auto h_csr_weights = cugraph::test::to_host(
+          handle,
+          *(csr_graph_view.get_matrix_partition_view().get_weights()),
+          csr_graph_view.get_number_of_edges());
+        ASSERT_TRUE(
+          std::equal(h_csr_weights.begin(), h_csr_weights.end(), (*h_cugraph_weights).begin()))
+          << "Graph constructed from sorted compressed sparse arrays does not preserve the input.";
+      }
+
+      std::vector<edge_t> h_degrees(number_of_vertices);
+      std::adjacent_difference(
+        h_cugraph_offsets.begin() + 1, h_cugraph_offsets.end(), h_degrees.begin());
+      ASSERT_EQ(
+        csr_graph_view.get_local_adj_matrix_partition_segment_offsets(0).has_value(),
+        std::is_sorted(h_degrees.begin(), h_degrees.end(), std::greater<edge_t>{}));
+    }
+
+    // renumber the vertices by degree on the host, the segment offsets should be computed
+
+    {
+      std::vector<vertex_t> h_new_to_old(number_of_vertices);
+      std::iota(h_new_to_old.begin(), h_new_to_old.end(), vertex_t{0});
+      std::stable_sort(h_new_to_old.begin(), h_new_to_old.end(), [&](auto lhs, auto rhs) {
+        return (h_cugraph_offsets[lhs + 1] - h_cugraph_offsets[lhs]) >
+               (h_cugraph_offsets[rhs + 1] - h_cugraph_offsets[rhs]);
+      });
+      std::vector<vertex_t> h_old_to_new(number_of_vertices);
+      for (vertex_t i = 0; i < number_of_vertices; ++i) {
+        h_old_to_new[h_new_to_old[i]] = i;
+      }
+      std::vector<edge_t> h_offsets(number_of_vertices + 1, edge_t{0});
+      std::vector<vertex_t> h_indices(number_of_edges);
+      for (vertex_t i = 0; i < number_of_vertices; ++i) {
+        auto old_v = h_new_to_old[i];
+        auto first = h_cugraph_offsets[old_v];
+        auto last  = h_cugraph_offsets[old_v + 1];
+        std::transform(h_cugraph_indices.begin() + first,
+                       h_cugraph_indices.begin() + last,
+                       h_indices.begin() + h_offsets[i],
+                       [&h_old_to_new](auto v) { return h_old_to_new[v]; });
+        h_offsets[i + 1] = h_offsets[i] + (last - first);
+      }
+
+      auto renumbered_graph = cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle,
+        cugraph::test::to_device(handle, h_offsets),
+        cugraph::test::to_device(handle, h_indices),
+        std::nullopt,
+        cugraph::graph_meta_t<vertex_t, edge_t, false>{
+          number_of_vertices, cugraph::graph_properties_t{is_symmetric, false}, std::nullopt},
+        true);
+      auto renumbered_graph_view = renumbered_graph.view();
+
+      auto segment_offsets =
+        renumbered_graph_view.get_local_adj_matrix_partition_segment_offsets(0);
+      ASSERT_TRUE(segment_offsets.has_value());
+      ASSERT_EQ((*segment_offsets).size(),
+                cugraph::detail::num_sparse_segments_per_vertex_partition + 1);
+      ASSERT_EQ((*segment_offsets).front(), vertex_t{0});
+      ASSERT_EQ((*segment_offsets).back(), number_of_vertices);
+      ASSERT_TRUE(std::is_sorted((*segment_offsets).begin(), (*segment_offsets).end()));
+
+      auto h_renumbered_indices = cugraph::test::to_host(
+        handle,
+        renumbered_graph_view.get_matrix_partition_view().get_indices(),
+        renumbered_graph_view.get_number_of_edges());
+      for (vertex_t i = 0; i < number_of_vertices; ++i) {
+        std::sort(h_indices.begin() + h_offsets[i], h_indices.begin() + h_offsets[i + 1]);
+      }
+      ASSERT_TRUE(
+        std::equal(h_renumbered_indices.begin(), h_renumbered_indices.end(), h_indices.begin()))
+        << "Neighbor lists of the renumbered graph are not sorted.";
+    }
   }
 };
 
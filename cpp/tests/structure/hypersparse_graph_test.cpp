@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct HypersparseGraph_Usecase {
+  bool test_weighted{false};
+};
+
+template <typename input_usecase_t>
+class Tests_HypersparseGraph
+  : public ::testing::TestWithParam<std::tuple<HypersparseGraph_Usecase, input_usecase_t>> {
+ public:
+  Tests_HypersparseGraph() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // a graph storing the offsets of the non-zero degree vertices only (DCSR) should return the same
+  // degrees, BFS & SSSP results as the graph storing the offsets of every vertex (CSR)
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(HypersparseGraph_Usecase const& hypersparse_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    auto [d_src_v, d_dst_v, d_weights_v, d_vertices_v, num_vertices, is_symmetric] =
+      input_usecase.template construct_edgelist<vertex_t, edge_t, weight_t, false, false>(
+        handle, hypersparse_usecase.test_weighted);
+
+    cugraph::edgelist_t<vertex_t, edge_t, weight_t> edgelist{
+      d_src_v.data(),
+      d_dst_v.data(),
+      d_weights_v ? std::optional<weight_t const*>{(*d_weights_v).data()} : std::nullopt,
+      static_cast<edge_t>(d_src_v.size())};
+
+    auto csr_graph = cugraph::graph_t<vertex_t, edge_t, weight_t, false, false>(
+      handle,
+      edgelist,
+      cugraph::graph_meta_t<vertex_t, edge_t, false>{
+        num_vertices, cugraph::graph_properties_t{is_symmetric, false}, std::nullopt},
+      true);
+    auto dcsr_graph = cugraph::graph_t<vertex_t, edge_t, weight_t, false, false>(
+      handle,
+      edgelist,
+      cugraph::graph_meta_t<vertex_t, edge_t, false>{
+        num_vertices, cugraph::graph_properties_t{is_symmetric, false}, std::nullopt, true},
+      true);
+    auto csr_graph_view  = csr_graph.view();
+    auto dcsr_graph_view = dcsr_graph.view();
+
+    ASSERT_FALSE(csr_graph.use_dcs());
+    ASSERT_TRUE(dcsr_graph.use_dcs());
+
+    auto dcs_nzd_vertex_count =
+      *(dcsr_graph_view.get_matrix_partition_view().get_dcs_nzd_vertex_count());
+    ASSERT_EQ(dcsr_graph.get_memory_size() + static_cast<size_t>(num_vertices) * sizeof(edge_t),
+              csr_graph.get_memory_size() +
+                static_cast<size_t>(dcs_nzd_vertex_count) * (sizeof(edge_t) + sizeof(vertex_t)))
+      << "The hypersparse graph should store the offsets of the non-zero degree vertices only.";
+
+    auto d_csr_out_degrees  = csr_graph_view.compute_out_degrees(handle);
+    auto d_dcsr_out_degrees = dcsr_graph_view.compute_out_degrees(handle);
+    auto h_csr_out_degrees =
+      cugraph::test::to_host(handle, d_csr_out_degrees.data(), d_csr_out_degrees.size());
+    auto h_dcsr_out_degrees =
+      cugraph::test::to_host(handle, d_dcsr_out_degrees.data(), d_dcsr_out_degrees.size());
+    ASSERT_TRUE(h_csr_out_degrees == h_dcsr_out_degrees) << "Out-degrees do not match.";
+
+    auto d_csr_in_degrees  = csr_graph_view.compute_in_degrees(handle);
+    auto d_dcsr_in_degrees = dcsr_graph_view.compute_in_degrees(handle);
+    auto h_csr_in_degrees =
+      cugraph::test::to_host(handle, d_csr_in_degrees.data(), d_csr_in_degrees.size());
+    auto h_dcsr_in_degrees =
+      cugraph::test::to_host(handle, d_dcsr_in_degrees.data(), d_dcsr_in_degrees.size());
+    ASSERT_TRUE(h_csr_in_degrees == h_dcsr_in_degrees) << "In-degrees do not match.";
+
+    vertex_t source = h_csr_out_degrees.size() > 0
+                        ? static_cast<vertex_t>(std::distance(
+                            h_csr_out_degrees.begin(),
+                            std::max_element(h_csr_out_degrees.begin(), h_csr_out_degrees.end())))
+                        : vertex_t{0};
+
+    auto run_traversals = [&handle, source](auto const& graph_view) {
+      rmm::device_uvector<vertex_t> d_bfs_distances(graph_view.get_number_of_vertices(),
+                                                    handle.get_stream());
+      rmm::device_uvector<weight_t> d_sssp_distances(graph_view.get_number_of_vertices(),
+                                                     handle.get_stream());
+      rmm::device_scalar<vertex_t> const d_source(source, handle.get_stream());
+
+      cugraph::bfs(handle,
+                   graph_view,
+                   d_bfs_distances.data(),
+                   static_cast<vertex_t*>(nullptr),
+                   d_source.data(),
+                   size_t{1},
+                   graph_view.is_symmetric(),
+                   std::numeric_limits<vertex_t>::max());
+      cugraph::sssp(handle,
+                    graph_view,
+                    d_sssp_distances.data(),
+                    static_cast<vertex_t*>(nullptr),
+                    source,
+                    std::numeric_limits<weight_t>::max());
+
+      return std::make_tuple(
+        cugraph::test::to_host(handle, d_bfs_distances.data(), d_bfs_distances.size()),
+        cugraph::test::to_host(handle, d_sssp_distances.data(), d_sssp_distances.size()));
+    };
+
+    auto [h_csr_bfs_distances, h_csr_sssp_distances]   = run_traversals(csr_graph_view);
+    auto [h_dcsr_bfs_distances, h_dcsr_sssp_distances] = run_traversals(dcsr_graph_view);
+
+    ASSERT_TRUE(h_csr_bfs_distances == h_dcsr_bfs_distances) << "BFS distances do not match.";
+
+    auto threshold_ratio = weight_t{1e-4};
+    ASSERT_TRUE(std::equal(h_csr_sssp_distances.begin(),
+                           h_csr_sssp_distances.end(),
+                           h_dcsr_sssp_distances.begin(),
+                           [threshold_ratio](auto lhs, auto rhs) {
+                             return lhs == rhs ||
+                                    std::abs(lhs - rhs) <= std::abs(lhs) * threshold_ratio;
+                           }))
+      << "SSSP distances do not match.";
+  }
+};
+
+using Tests_HypersparseGraph_File = Tests_HypersparseGraph<cugraph::test::File_Usecase>;
+using Tests_HypersparseGraph_Rmat = Tests_HypersparseGraph<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_HypersparseGraph_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_HypersparseGraph_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_HypersparseGraph_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_HypersparseGraph_File,
+  ::testing::Combine(::testing::Values(HypersparseGraph_Usecase{false},
+                                       HypersparseGraph_Usecase{true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_HypersparseGraph_Rmat,
+  // a low edge factor leaves most vertices isolated
+  ::testing::Combine(
+    ::testing::Values(HypersparseGraph_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(16, 1, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
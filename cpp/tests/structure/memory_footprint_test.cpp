@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/memory_estimates.hpp>
+
+#include <raft/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+
+typedef struct MemoryFootprint_Usecase_t {
+  bool test_weighted{false};
+} MemoryFootprint_Usecase;
+
+template <typename input_usecase_t>
+class Tests_MemoryFootprint
+  : public ::testing::TestWithParam<std::tuple<MemoryFootprint_Usecase, input_usecase_t>> {
+ public:
+  Tests_MemoryFootprint() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(MemoryFootprint_Usecase const& memory_footprint_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, memory_footprint_usecase.test_weighted, true);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = static_cast<size_t>(graph_view.get_number_of_vertices());
+    auto const num_edges    = static_cast<size_t>(graph_view.get_number_of_edges());
+
+    auto footprint = graph.get_memory_footprint();
+    ASSERT_EQ(footprint.offsets, (num_vertices + 1) * sizeof(edge_t));
+    ASSERT_EQ(footprint.indices, num_edges * sizeof(vertex_t));
+    ASSERT_EQ(footprint.weights, graph.is_weighted() ? num_edges * sizeof(weight_t) : size_t{0});
+    ASSERT_EQ(footprint.adjacency_total(), graph.get_memory_size());
+    ASSERT_EQ(footprint.device_total(), graph.get_memory_size());
+    ASSERT_EQ(footprint.degree_cache, size_t{0});
+    ASSERT_EQ(footprint.reversed_graph, size_t{0});
+
+    // the graph size estimate is exact in single-GPU
+    ASSERT_EQ((cugraph::estimate_graph_memory_size<vertex_t, edge_t, weight_t>(
+                graph_view.get_number_of_vertices(),
+                graph_view.get_number_of_edges(),
+                graph.is_weighted())),
+              graph.get_memory_size());
+
+    // the cached quantities are accounted
+
+    graph.enable_degree_cache();
+    graph_view = graph.view();
+    ASSERT_TRUE(graph_view.get_cached_out_degrees(handle).has_value());
+    footprint = graph.get_memory_footprint();
+    ASSERT_EQ(footprint.degree_cache, num_vertices * sizeof(edge_t));
+
+    graph.add_reversed_graph(handle);
+    footprint = graph.get_memory_footprint();
+    ASSERT_EQ(footprint.reversed_graph, graph.get_reversed_graph_memory_size());
+    ASSERT_EQ(footprint.device_total(),
+              graph.get_memory_size() + graph.get_reversed_graph_memory_size() +
+                num_vertices * sizeof(edge_t));
+    graph.remove_reversed_graph();
+    graph.disable_degree_cache();
+
+    // the working memory estimates cover at least the per-vertex buffers of the algorithms
+
+    graph_view = graph.view();
+    if constexpr (store_transposed) {
+      auto pagerank_size = cugraph::estimate_pagerank_memory_size<float>(graph_view);
+      ASSERT_GE(pagerank_size, 2 * num_vertices * sizeof(float));
+      ASSERT_LE(cugraph::estimate_pagerank_memory_size<float>(graph_view, true), pagerank_size);
+    } else {
+      auto bfs_size = cugraph::estimate_bfs_memory_size(graph_view);
+      ASSERT_GE(bfs_size, 2 * num_vertices * sizeof(vertex_t));
+      ASSERT_GE(cugraph::estimate_bfs_memory_size(graph_view, true), bfs_size);
+      if (graph_view.is_symmetric()) {
+        ASSERT_GE(cugraph::estimate_louvain_memory_size(graph_view),
+                  num_edges * (2 * sizeof(vertex_t) + sizeof(weight_t)));
+      }
+    }
+  }
+};
+
+using Tests_MemoryFootprint_File = Tests_MemoryFootprint<cugraph::test::File_Usecase>;
+using Tests_MemoryFootprint_Rmat = Tests_MemoryFootprint<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MemoryFootprint_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MemoryFootprint_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MemoryFootprint_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MemoryFootprint_Rmat, CheckInt64Int64FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, true>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MemoryFootprint_File,
+  ::testing::Combine(
+    ::testing::Values(MemoryFootprint_Usecase{false}, MemoryFootprint_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MemoryFootprint_Rmat,
+  ::testing::Combine(
+    ::testing::Values(MemoryFootprint_Usecase{false}, MemoryFootprint_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
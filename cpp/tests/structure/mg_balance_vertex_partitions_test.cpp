@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+struct BalanceVertexPartitions_Usecase {
+  double edge_balance_ratio{1.0};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGBalanceVertexPartitions
+  : public ::testing::TestWithParam<std::tuple<BalanceVertexPartitions_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGBalanceVertexPartitions() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // (external vertex ID, out-degree, in-degree) triplets (gathered to GPU 0 and sorted by the
+  // external vertex IDs)
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  std::tuple<std::vector<vertex_t>, std::vector<edge_t>, std::vector<edge_t>> gather_degrees(
+    raft::handle_t const& handle,
+    cugraph::graph_view_t<vertex_t, edge_t, weight_t, store_transposed, true> const& graph_view,
+    rmm::device_uvector<vertex_t> const& renumber_map_labels)
+  {
+    auto d_out_degrees = graph_view.compute_out_degrees(handle);
+    auto d_in_degrees  = graph_view.compute_in_degrees(handle);
+
+    auto d_labels = cugraph::test::device_gatherv(
+      handle, renumber_map_labels.data(), renumber_map_labels.size());
+    d_out_degrees =
+      cugraph::test::device_gatherv(handle, d_out_degrees.data(), d_out_degrees.size());
+    d_in_degrees = cugraph::test::device_gatherv(handle, d_in_degrees.data(), d_in_degrees.size());
+
+    std::vector<vertex_t> h_labels(d_labels.size());
+    std::vector<edge_t> h_out_degrees(d_out_degrees.size());
+    std::vector<edge_t> h_in_degrees(d_in_degrees.size());
+    raft::update_host(h_labels.data(), d_labels.data(), d_labels.size(), handle.get_stream());
+    raft::update_host(
+      h_out_degrees.data(), d_out_degrees.data(), d_out_degrees.size(), handle.get_stream());
+    raft::update_host(
+      h_in_degrees.data(), d_in_degrees.data(), d_in_degrees.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    std::vector<size_t> indices(h_labels.size());
+    std::iota(indices.begin(), indices.end(), size_t{0});
+    std::sort(indices.begin(), indices.end(), [&h_labels](auto lhs, auto rhs) {
+      return h_labels[lhs] < h_labels[rhs];
+    });
+
+    std::vector<vertex_t> sorted_labels(indices.size());
+    std::vector<edge_t> sorted_out_degrees(indices.size());
+    std::vector<edge_t> sorted_in_degrees(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+      sorted_labels[i]      = h_labels[indices[i]];
+      sorted_out_degrees[i] = h_out_degrees[indices[i]];
+      sorted_in_degrees[i]  = h_in_degrees[indices[i]];
+    }
+
+    return std::make_tuple(
+      std::move(sorted_labels), std::move(sorted_out_degrees), std::move(sorted_in_degrees));
+  }
+
+  // Compare the vertex degrees (keyed by the external vertex IDs) before and after re-partitioning
+  // and check that the local vertices remain sorted by degree.
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(BalanceVertexPartitions_Usecase const& balance_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, true>(
+        handle, input_usecase, true, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    auto number_of_vertices = mg_graph_view.get_number_of_vertices();
+    auto number_of_edges    = mg_graph_view.get_number_of_edges();
+
+    std::vector<vertex_t> h_labels{};
+    std::vector<edge_t> h_out_degrees{};
+    std::vector<edge_t> h_in_degrees{};
+    if (balance_usecase.check_correctness) {
+      std::tie(h_labels, h_out_degrees, h_in_degrees) =
+        gather_degrees(handle, mg_graph_view, *d_mg_renumber_map_labels);
+    }
+
+    auto count_local_edges = [](auto const& graph_view) {
+      edge_t count{0};
+      for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+        count += graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+      }
+      return count;
+    };
+    auto number_of_local_edges = count_local_edges(mg_graph_view);
+
+    // 3. re-partition the graph
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    std::tie(mg_graph, *d_mg_renumber_map_labels) = cugraph::balance_vertex_partitions(
+      handle,
+      mg_graph_view,
+      std::move(*d_mg_renumber_map_labels),
+      balance_usecase.edge_balance_ratio,
+      true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG balance_vertex_partitions took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto balanced_graph_view = mg_graph.view();
+
+    if (cugraph::test::g_perf) {
+      std::cout << "GPU " << comm_rank << ": # local edges " << number_of_local_edges
+                << " (before) " << count_local_edges(balanced_graph_view) << " (after).\n";
+    }
+
+    // 4. compare
+
+    if (balance_usecase.check_correctness) {
+      ASSERT_EQ(balanced_graph_view.get_number_of_vertices(), number_of_vertices);
+      ASSERT_EQ(balanced_graph_view.get_number_of_edges(), number_of_edges);
+      ASSERT_EQ((*d_mg_renumber_map_labels).size(),
+                static_cast<size_t>(balanced_graph_view.get_number_of_local_vertices()));
+
+      auto d_local_degrees = store_transposed ? balanced_graph_view.compute_in_degrees(handle)
+                                              : balanced_graph_view.compute_out_degrees(handle);
+      std::vector<edge_t> h_local_degrees(d_local_degrees.size());
+      raft::update_host(h_local_degrees.data(),
+                        d_local_degrees.data(),
+                        d_local_degrees.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+      ASSERT_TRUE(
+        std::is_sorted(h_local_degrees.begin(), h_local_degrees.end(), std::greater<edge_t>{}))
+        << "balance_vertex_partitions should keep the local vertices sorted by degree.";
+
+      auto [h_balanced_labels, h_balanced_out_degrees, h_balanced_in_degrees] =
+        gather_degrees(handle, balanced_graph_view, *d_mg_renumber_map_labels);
+
+      if (comm_rank == 0) {
+        ASSERT_TRUE(std::equal(h_labels.begin(), h_labels.end(), h_balanced_labels.begin()))
+          << "balance_vertex_partitions should preserve the vertex set.";
+        ASSERT_TRUE(
+          std::equal(h_out_degrees.begin(), h_out_degrees.end(), h_balanced_out_degrees.begin()))
+          << "balance_vertex_partitions should preserve the vertex out-degrees.";
+        ASSERT_TRUE(
+          std::equal(h_in_degrees.begin(), h_in_degrees.end(), h_balanced_in_degrees.begin()))
+          << "balance_vertex_partitions should preserve the vertex in-degrees.";
+      }
+    }
+  }
+};
+
+using Tests_MGBalanceVertexPartitions_File =
+  Tests_MGBalanceVertexPartitions<cugraph::test::File_Usecase>;
+using Tests_MGBalanceVertexPartitions_Rmat =
+  Tests_MGBalanceVertexPartitions<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGBalanceVertexPartitions_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGBalanceVertexPartitions_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGBalanceVertexPartitions_Rmat, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGBalanceVertexPartitions_Rmat, CheckInt64Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGBalanceVertexPartitions_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BalanceVertexPartitions_Usecase{1.0}, BalanceVertexPartitions_Usecase{0.5}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/webbase-1M.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGBalanceVertexPartitions_Rmat,
+  ::testing::Combine(
+    ::testing::Values(BalanceVertexPartitions_Usecase{1.0}, BalanceVertexPartitions_Usecase{0.0}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGBalanceVertexPartitions_Rmat,
+  ::testing::Combine(
+    ::testing::Values(BalanceVertexPartitions_Usecase{1.0, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
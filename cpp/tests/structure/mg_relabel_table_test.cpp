@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/relabel_table.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+struct RelabelTable_Usecase {
+  size_t num_label_pairs_per_gpu{1024};
+  size_t num_labels_per_gpu{4096};
+  size_t num_label_arrays{2};
+  size_t chunk_size{1000};
+  bool skip_missing_labels{false};
+  bool check_correctness{true};
+};
+
+class Tests_MGRelabelTable : public ::testing::TestWithParam<RelabelTable_Usecase> {
+ public:
+  Tests_MGRelabelTable() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of relabel_table_t (device and chunked host arrays) to that of relabel.
+  template <typename vertex_t>
+  void run_current_test(RelabelTable_Usecase const& usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. generate (old label, new label) pairs (old labels are distributed round-robin, not by
+    // hash) and the labels to relabel
+
+    auto num_old_labels = static_cast<vertex_t>(usecase.num_label_pairs_per_gpu * comm_size);
+
+    std::vector<vertex_t> h_old_labels(usecase.num_label_pairs_per_gpu);
+    std::vector<vertex_t> h_new_labels(h_old_labels.size());
+    for (size_t i = 0; i < h_old_labels.size(); ++i) {
+      h_old_labels[i] = static_cast<vertex_t>(i * comm_size + comm_rank);
+      h_new_labels[i] = num_old_labels - h_old_labels[i] - 1;
+    }
+
+    rmm::device_uvector<vertex_t> d_old_labels(h_old_labels.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_new_labels(h_new_labels.size(), handle.get_stream());
+    raft::update_device(
+      d_old_labels.data(), h_old_labels.data(), h_old_labels.size(), handle.get_stream());
+    raft::update_device(
+      d_new_labels.data(), h_new_labels.data(), h_new_labels.size(), handle.get_stream());
+
+    // 3. build the relabel table
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    cugraph::relabel_table_t<vertex_t, true> relabel_table(
+      handle,
+      std::make_tuple(d_old_labels.data(), d_new_labels.data()),
+      static_cast<vertex_t>(d_old_labels.size()),
+      true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG relabel_table_t construction took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. relabel a few label arrays with the same table
+
+    std::mt19937 gen(comm_rank);
+    // labels in [num_old_labels, num_old_labels * 2) are missing in the table
+    std::uniform_int_distribution<vertex_t> distribution(
+      vertex_t{0},
+      usecase.skip_missing_labels ? num_old_labels * 2 - 1 : num_old_labels - 1);
+
+    for (size_t i = 0; i < usecase.num_label_arrays; ++i) {
+      std::vector<vertex_t> h_labels(usecase.num_labels_per_gpu);
+      std::generate(
+        h_labels.begin(), h_labels.end(), [&distribution, &gen]() { return distribution(gen); });
+
+      rmm::device_uvector<vertex_t> d_labels(h_labels.size(), handle.get_stream());
+      raft::update_device(d_labels.data(), h_labels.data(), h_labels.size(), handle.get_stream());
+
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        handle.get_comms().barrier();
+        hr_clock.start();
+      }
+
+      relabel_table.relabel(
+        handle, d_labels.data(), d_labels.size(), usecase.skip_missing_labels, true);
+
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        handle.get_comms().barrier();
+        double elapsed_time{0.0};
+        hr_clock.stop(&elapsed_time);
+        std::cout << "MG relabel_table_t::relabel took " << elapsed_time * 1e-6 << " s.\n";
+      }
+
+      std::vector<vertex_t> h_chunked_labels(h_labels);
+      relabel_table.relabel_chunked(handle,
+                                    h_chunked_labels.data(),
+                                    h_chunked_labels.size(),
+                                    usecase.chunk_size,
+                                    usecase.skip_missing_labels,
+                                    true);
+
+      // 5. compare
+
+      if (usecase.check_correctness) {
+        rmm::device_uvector<vertex_t> d_reference_labels(h_labels.size(), handle.get_stream());
+        raft::update_device(
+          d_reference_labels.data(), h_labels.data(), h_labels.size(), handle.get_stream());
+        cugraph::relabel<vertex_t, true>(
+          handle,
+          std::make_tuple(d_old_labels.data(), d_new_labels.data()),
+          static_cast<vertex_t>(d_old_labels.size()),
+          d_reference_labels.data(),
+          static_cast<vertex_t>(d_reference_labels.size()),
+          usecase.skip_missing_labels,
+          true);
+
+        std::vector<vertex_t> h_reference_labels(d_reference_labels.size());
+        raft::update_host(h_reference_labels.data(),
+                          d_reference_labels.data(),
+                          d_reference_labels.size(),
+                          handle.get_stream());
+        std::vector<vertex_t> h_relabeled_labels(d_labels.size());
+        raft::update_host(
+          h_relabeled_labels.data(), d_labels.data(), d_labels.size(), handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        ASSERT_TRUE(std::equal(
+          h_reference_labels.begin(), h_reference_labels.end(), h_relabeled_labels.begin()))
+          << "relabel_table_t::relabel does not match with relabel.";
+        ASSERT_TRUE(std::equal(
+          h_reference_labels.begin(), h_reference_labels.end(), h_chunked_labels.begin()))
+          << "relabel_table_t::relabel_chunked does not match with relabel.";
+      }
+    }
+  }
+};
+
+TEST_P(Tests_MGRelabelTable, CheckInt32) { run_current_test<int32_t>(GetParam()); }
+
+TEST_P(Tests_MGRelabelTable, CheckInt64) { run_current_test<int64_t>(GetParam()); }
+
+INSTANTIATE_TEST_SUITE_P(small_tests,
+                         Tests_MGRelabelTable,
+                         ::testing::Values(RelabelTable_Usecase{1024, 4096, 2, 1000, false},
+                                           RelabelTable_Usecase{1024, 4096, 2, 1000, true},
+                                           RelabelTable_Usecase{1024, 0, 1, 1000, false}));
+
+INSTANTIATE_TEST_SUITE_P(benchmark_test,
+                         Tests_MGRelabelTable,
+                         ::testing::Values(RelabelTable_Usecase{
+                           1 << 20, 1 << 24, 4, 1 << 22, false, false}));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
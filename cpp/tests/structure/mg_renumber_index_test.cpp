@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/renumber_index.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+struct RenumberIndex_Usecase {
+  size_t batch_size{1024};
+  size_t num_batches{2};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGRenumberIndex
+  : public ::testing::TestWithParam<std::tuple<RenumberIndex_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGRenumberIndex() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of renumber_index_t lookups to that of unrenumber_int_vertices and check
+  // that renumbering the unrenumbered vertices recovers the input vertices.
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(RenumberIndex_Usecase const& renumber_index_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. build the renumber index
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    cugraph::renumber_index_t<vertex_t, true> renumber_index(
+      handle, (*d_mg_renumber_map_labels).data(), mg_graph_view.get_vertex_partition_lasts(), true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG renumber_index_t construction took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    ASSERT_EQ(renumber_index.get_number_of_vertices(), mg_graph_view.get_number_of_vertices());
+    ASSERT_EQ(renumber_index.get_local_vertex_first(), mg_graph_view.get_local_vertex_first());
+    ASSERT_EQ(renumber_index.get_local_vertex_last(), mg_graph_view.get_local_vertex_last());
+
+    // 4. look up a few batches with the same index
+
+    std::mt19937 gen(comm_rank);
+    std::uniform_int_distribution<vertex_t> distribution(
+      vertex_t{0}, mg_graph_view.get_number_of_vertices() - 1);
+
+    for (size_t i = 0; i < renumber_index_usecase.num_batches; ++i) {
+      std::vector<vertex_t> h_int_vertices(renumber_index_usecase.batch_size);
+      for (size_t j = 0; j < h_int_vertices.size(); ++j) {
+        h_int_vertices[j] =
+          (j % 64 == 0) ? cugraph::invalid_vertex_id<vertex_t>::value : distribution(gen);
+      }
+
+      rmm::device_uvector<vertex_t> d_vertices(h_int_vertices.size(), handle.get_stream());
+      raft::update_device(
+        d_vertices.data(), h_int_vertices.data(), h_int_vertices.size(), handle.get_stream());
+
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        handle.get_comms().barrier();
+        hr_clock.start();
+      }
+
+      renumber_index.unrenumber(handle, d_vertices.data(), d_vertices.size());
+
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        handle.get_comms().barrier();
+        double elapsed_time{0.0};
+        hr_clock.stop(&elapsed_time);
+        std::cout << "MG renumber_index_t::unrenumber took " << elapsed_time * 1e-6 << " s.\n";
+      }
+
+      std::vector<vertex_t> h_ext_vertices(d_vertices.size());
+      raft::update_host(
+        h_ext_vertices.data(), d_vertices.data(), d_vertices.size(), handle.get_stream());
+
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        handle.get_comms().barrier();
+        hr_clock.start();
+      }
+
+      renumber_index.renumber(handle, d_vertices.data(), d_vertices.size());
+
+      if (cugraph::test::g_perf) {
+        CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        handle.get_comms().barrier();
+        double elapsed_time{0.0};
+        hr_clock.stop(&elapsed_time);
+        std::cout << "MG renumber_index_t::renumber took " << elapsed_time * 1e-6 << " s.\n";
+      }
+
+      // 5. compare
+
+      if (renumber_index_usecase.check_correctness) {
+        rmm::device_uvector<vertex_t> d_reference_ext_vertices(h_int_vertices.size(),
+                                                               handle.get_stream());
+        raft::update_device(d_reference_ext_vertices.data(),
+                            h_int_vertices.data(),
+                            h_int_vertices.size(),
+                            handle.get_stream());
+        cugraph::unrenumber_int_vertices<vertex_t, true>(
+          handle,
+          d_reference_ext_vertices.data(),
+          d_reference_ext_vertices.size(),
+          (*d_mg_renumber_map_labels).data(),
+          mg_graph_view.get_vertex_partition_lasts());
+
+        std::vector<vertex_t> h_reference_ext_vertices(d_reference_ext_vertices.size());
+        raft::update_host(h_reference_ext_vertices.data(),
+                          d_reference_ext_vertices.data(),
+                          d_reference_ext_vertices.size(),
+                          handle.get_stream());
+
+        std::vector<vertex_t> h_renumbered_vertices(d_vertices.size());
+        raft::update_host(
+          h_renumbered_vertices.data(), d_vertices.data(), d_vertices.size(), handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        ASSERT_TRUE(std::equal(
+          h_reference_ext_vertices.begin(), h_reference_ext_vertices.end(), h_ext_vertices.begin()))
+          << "renumber_index_t::unrenumber does not match with unrenumber_int_vertices.";
+        ASSERT_TRUE(
+          std::equal(h_int_vertices.begin(), h_int_vertices.end(), h_renumbered_vertices.begin()))
+          << "renumber_index_t::renumber does not recover the internal vertex IDs.";
+      }
+    }
+  }
+};
+
+using Tests_MGRenumberIndex_File = Tests_MGRenumberIndex<cugraph::test::File_Usecase>;
+using Tests_MGRenumberIndex_Rmat = Tests_MGRenumberIndex<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGRenumberIndex_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGRenumberIndex_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGRenumberIndex_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGRenumberIndex_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(RenumberIndex_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/webbase-1M.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGRenumberIndex_Rmat,
+  ::testing::Combine(::testing::Values(RenumberIndex_Usecase{}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGRenumberIndex_Rmat,
+  ::testing::Combine(::testing::Values(RenumberIndex_Usecase{1 << 20, 4, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
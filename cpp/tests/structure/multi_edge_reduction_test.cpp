@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+struct MultiEdgeReduction_Usecase {
+  cugraph::multi_edge_reduction_t multi_edge_reduction{cugraph::multi_edge_reduction_t::sum};
+  bool test_weighted{true};
+  std::string graph_file_path{};
+};
+
+class Tests_MultiEdgeReduction : public ::testing::TestWithParam<MultiEdgeReduction_Usecase> {
+ public:
+  Tests_MultiEdgeReduction() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // every input edge is repeated 1-3 times with different weights, the graph constructed with
+  // parallel edge collapsing should match the input edges reduced on the host
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MultiEdgeReduction_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    auto graph_file_full_path =
+      cugraph::test::get_rapids_dataset_root_dir() + "/" + configuration.graph_file_path;
+
+    auto [d_srcs, d_dsts, d_weights, d_vertices, num_vertices, is_symmetric] =
+      cugraph::test::read_edgelist_from_matrix_market_file<vertex_t, weight_t, false, false>(
+        handle, graph_file_full_path, configuration.test_weighted);
+
+    auto h_srcs = cugraph::test::to_host(handle, d_srcs.data(), d_srcs.size());
+    auto h_dsts = cugraph::test::to_host(handle, d_dsts.data(), d_dsts.size());
+    auto h_weights =
+      d_weights ? cugraph::test::to_host(handle, (*d_weights).data(), (*d_weights).size())
+                : std::vector<weight_t>(h_srcs.size(), weight_t{1.0});
+
+    std::vector<vertex_t> h_multi_srcs{};
+    std::vector<vertex_t> h_multi_dsts{};
+    std::vector<weight_t> h_multi_weights{};
+    std::map<std::tuple<vertex_t, vertex_t>, weight_t> h_reference_edges{};
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      auto multiplicity = static_cast<int>(i % 3) + 1;
+      for (int j = 0; j < multiplicity; ++j) {
+        auto w = h_weights[i] * static_cast<weight_t>(j + 1);
+        h_multi_srcs.push_back(h_srcs[i]);
+        h_multi_dsts.push_back(h_dsts[i]);
+        h_multi_weights.push_back(w);
+        auto key = std::make_tuple(h_srcs[i], h_dsts[i]);
+        auto it  = h_reference_edges.find(key);
+        if (it == h_reference_edges.end()) {
+          h_reference_edges.insert({key, w});
+        } else if (configuration.multi_edge_reduction == cugraph::multi_edge_reduction_t::sum) {
+          it->second += w;
+        } else if (configuration.multi_edge_reduction == cugraph::multi_edge_reduction_t::min) {
+          it->second = std::min(it->second, w);
+        } else {
+          it->second = std::max(it->second, w);
+        }
+      }
+    }
+    // interleave the parallel edges with the other edges
+    std::reverse(h_multi_srcs.begin() + h_multi_srcs.size() / 2, h_multi_srcs.end());
+    std::reverse(h_multi_dsts.begin() + h_multi_dsts.size() / 2, h_multi_dsts.end());
+    std::reverse(h_multi_weights.begin() + h_multi_weights.size() / 2, h_multi_weights.end());
+
+    rmm::device_uvector<vertex_t> d_multi_srcs(h_multi_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_multi_dsts(h_multi_dsts.size(), handle.get_stream());
+    auto d_multi_weights =
+      configuration.test_weighted
+        ? std::make_optional<rmm::device_uvector<weight_t>>(h_multi_weights.size(),
+                                                            handle.get_stream())
+        : std::nullopt;
+    raft::update_device(
+      d_multi_srcs.data(), h_multi_srcs.data(), h_multi_srcs.size(), handle.get_stream());
+    raft::update_device(
+      d_multi_dsts.data(), h_multi_dsts.data(), h_multi_dsts.size(), handle.get_stream());
+    if (d_multi_weights) {
+      raft::update_device((*d_multi_weights).data(),
+                          h_multi_weights.data(),
+                          h_multi_weights.size(),
+                          handle.get_stream());
+    }
+
+    cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) =
+      cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+        handle,
+        std::make_optional(std::move(d_vertices)),
+        std::move(d_multi_srcs),
+        std::move(d_multi_dsts),
+        std::move(d_multi_weights),
+        cugraph::graph_properties_t{false, true},  // the edge multiplicities are asymmetric
+        false,
+        configuration.multi_edge_reduction,
+        true);
+
+    ASSERT_FALSE(graph.is_multigraph());
+    ASSERT_EQ(graph.get_number_of_edges(), static_cast<edge_t>(h_reference_edges.size()));
+
+    auto [d_result_srcs, d_result_dsts, d_result_weights] =
+      graph.decompress_to_edgelist(handle, std::nullopt, false);
+    ASSERT_EQ(d_result_weights.has_value(), configuration.test_weighted);
+
+    auto h_result_srcs =
+      cugraph::test::to_host(handle, d_result_srcs.data(), d_result_srcs.size());
+    auto h_result_dsts =
+      cugraph::test::to_host(handle, d_result_dsts.data(), d_result_dsts.size());
+    auto h_result_weights =
+      d_result_weights
+        ? cugraph::test::to_host(handle, (*d_result_weights).data(), (*d_result_weights).size())
+        : std::vector<weight_t>(h_result_srcs.size(), weight_t{0.0});
+
+    ASSERT_EQ(h_result_srcs.size(), h_reference_edges.size());
+    std::map<std::tuple<vertex_t, vertex_t>, weight_t> h_result_edges{};
+    for (size_t i = 0; i < h_result_srcs.size(); ++i) {
+      auto key = std::make_tuple(h_result_srcs[i], h_result_dsts[i]);
+      ASSERT_TRUE(h_result_edges.insert({key, h_result_weights[i]}).second)
+        << "parallel edges remain after collapsing.";
+    }
+    for (auto const& [key, w] : h_reference_edges) {
+      auto it = h_result_edges.find(key);
+      ASSERT_TRUE(it != h_result_edges.end());
+      if (configuration.test_weighted) {
+        ASSERT_NEAR(it->second, w, std::abs(w) * weight_t{1e-4});
+      }
+    }
+  }
+};
+
+TEST_P(Tests_MultiEdgeReduction, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_MultiEdgeReduction, CheckInt32Int64Double)
+{
+  run_current_test<int32_t, int64_t, double>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_MultiEdgeReduction,
+  ::testing::Values(
+    MultiEdgeReduction_Usecase{
+      cugraph::multi_edge_reduction_t::sum, true, "test/datasets/karate.mtx"},
+    MultiEdgeReduction_Usecase{
+      cugraph::multi_edge_reduction_t::min, true, "test/datasets/karate.mtx"},
+    MultiEdgeReduction_Usecase{
+      cugraph::multi_edge_reduction_t::max, true, "test/datasets/karate.mtx"},
+    MultiEdgeReduction_Usecase{
+      cugraph::multi_edge_reduction_t::sum, false, "test/datasets/karate.mtx"},
+    MultiEdgeReduction_Usecase{
+      cugraph::multi_edge_reduction_t::sum, true, "test/datasets/dolphins.mtx"},
+    MultiEdgeReduction_Usecase{
+      cugraph::multi_edge_reduction_t::max, true, "test/datasets/netscience.mtx"},
+    MultiEdgeReduction_Usecase{
+      cugraph::multi_edge_reduction_t::min, false, "test/datasets/netscience.mtx"}));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+struct PackedMinors_Usecase {
+  bool test_weighted{false};
+};
+
+template <typename input_usecase_t>
+class Tests_PackedMinors
+  : public ::testing::TestWithParam<std::tuple<PackedMinors_Usecase, input_usecase_t>> {
+ public:
+  Tests_PackedMinors() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // a graph with bit-packed minors should return the same edges, BFS & SSSP results as the graph
+  // before packing, and unpacking should restore the original storage
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(PackedMinors_Usecase const& packed_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, packed_usecase.test_weighted, true);
+    auto memory_size = graph.get_memory_size();
+
+    auto run_queries = [&handle, &graph = graph]() {
+      auto graph_view = graph.view();
+
+      auto [d_rows, d_cols, d_weights] = graph.decompress_to_edgelist(handle, std::nullopt, false);
+      auto h_cols = cugraph::test::to_host(handle, d_cols.data(), d_cols.size());
+
+      rmm::device_uvector<vertex_t> d_bfs_distances(graph_view.get_number_of_vertices(),
+                                                    handle.get_stream());
+      rmm::device_uvector<weight_t> d_sssp_distances(graph_view.get_number_of_vertices(),
+                                                     handle.get_stream());
+      rmm::device_scalar<vertex_t> const d_source(vertex_t{0}, handle.get_stream());
+
+      cugraph::bfs(handle,
+                   graph_view,
+                   d_bfs_distances.data(),
+                   static_cast<vertex_t*>(nullptr),
+                   d_source.data(),
+                   size_t{1},
+                   graph_view.is_symmetric(),
+                   std::numeric_limits<vertex_t>::max());
+      cugraph::sssp(handle,
+                    graph_view,
+                    d_sssp_distances.data(),
+                    static_cast<vertex_t*>(nullptr),
+                    vertex_t{0},
+                    std::numeric_limits<weight_t>::max());
+
+      return std::make_tuple(
+        std::move(h_cols),
+        cugraph::test::to_host(handle, d_bfs_distances.data(), d_bfs_distances.size()),
+        cugraph::test::to_host(handle, d_sssp_distances.data(), d_sssp_distances.size()));
+    };
+
+    auto [h_cols, h_bfs_distances, h_sssp_distances] = run_queries();
+
+    graph.pack_minors(handle);
+    ASSERT_TRUE(graph.has_packed_minors());
+    ASSERT_TRUE(graph.view().get_matrix_partition_view().get_indices() == nullptr ||
+                graph.get_number_of_edges() == 0);
+
+    auto [h_packed_cols, h_packed_bfs_distances, h_packed_sssp_distances] = run_queries();
+
+    ASSERT_TRUE(h_cols == h_packed_cols) << "Decompressed minors do not match.";
+    ASSERT_TRUE(h_bfs_distances == h_packed_bfs_distances) << "BFS distances do not match.";
+    auto threshold_ratio = weight_t{1e-4};
+    ASSERT_TRUE(std::equal(h_sssp_distances.begin(),
+                           h_sssp_distances.end(),
+                           h_packed_sssp_distances.begin(),
+                           [threshold_ratio](auto lhs, auto rhs) {
+                             return lhs == rhs ||
+                                    std::abs(lhs - rhs) <= std::abs(lhs) * threshold_ratio;
+                           }))
+      << "SSSP distances do not match.";
+
+    graph.unpack_minors(handle);
+    ASSERT_FALSE(graph.has_packed_minors());
+    ASSERT_EQ(graph.get_memory_size(), memory_size);
+
+    auto [h_unpacked_cols, h_unpacked_bfs_distances, h_unpacked_sssp_distances] = run_queries();
+    ASSERT_TRUE(h_cols == h_unpacked_cols) << "Unpacked minors do not match.";
+  }
+};
+
+using Tests_PackedMinors_File = Tests_PackedMinors<cugraph::test::File_Usecase>;
+using Tests_PackedMinors_Rmat = Tests_PackedMinors<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_PackedMinors_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_PackedMinors_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_PackedMinors_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_PackedMinors_File,
+  ::testing::Combine(
+    ::testing::Values(PackedMinors_Usecase{false}, PackedMinors_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_PackedMinors_Rmat,
+  ::testing::Combine(
+    ::testing::Values(PackedMinors_Usecase{false}, PackedMinors_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -32,14 +32,17 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
 #include <limits>
 #include <numeric>
+#include <optional>
 #include <random>
 #include <vector>
 
 struct Renumbering_Usecase {
   bool check_correctness{true};
+  cugraph::renumber_order_t order{cugraph::renumber_order_t::degree};
 };
 
 template <typename input_usecase_t>
@@ -87,9 +90,35 @@ class Tests_Renumbering
       hr_clock.start();
     }
 
-    std::tie(renumber_map_labels_v, std::ignore) =
-      cugraph::renumber_edgelist<vertex_t, edge_t, false>(
-        handle, std::nullopt, src_v.begin(), dst_v.begin(), src_v.size());
+    // order the vertices in the reverse order of their IDs inside each segment for vertex_key
+    std::optional<rmm::device_uvector<vertex_t>> vertices{std::nullopt};
+    std::optional<rmm::device_uvector<vertex_t>> vertex_order_keys{std::nullopt};
+    if (renumbering_usecase.order == cugraph::renumber_order_t::vertex_key) {
+      std::vector<vertex_t> h_vertices(number_of_vertices);
+      std::vector<vertex_t> h_vertex_order_keys(h_vertices.size());
+      std::iota(h_vertices.begin(), h_vertices.end(), vertex_t{0});
+      std::reverse_copy(h_vertices.begin(), h_vertices.end(), h_vertex_order_keys.begin());
+      vertices = rmm::device_uvector<vertex_t>(h_vertices.size(), handle.get_stream_view());
+      vertex_order_keys =
+        rmm::device_uvector<vertex_t>(h_vertex_order_keys.size(), handle.get_stream_view());
+      raft::update_device(
+        (*vertices).data(), h_vertices.data(), h_vertices.size(), handle.get_stream());
+      raft::update_device((*vertex_order_keys).data(),
+                          h_vertex_order_keys.data(),
+                          h_vertex_order_keys.size(),
+                          handle.get_stream());
+    }
+
+    cugraph::renumber_meta_t<vertex_t, edge_t, false> meta{};
+    std::tie(renumber_map_labels_v, meta) = cugraph::renumber_edgelist<vertex_t, edge_t, false>(
+      handle,
+      std::move(vertices),
+      src_v.begin(),
+      dst_v.begin(),
+      src_v.size(),
+      renumbering_usecase.order,
+      vertex_order_keys ? std::make_optional<vertex_t const*>((*vertex_order_keys).data())
+                        : std::nullopt);
 
     if (cugraph::test::g_perf) {
       CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -118,8 +147,30 @@ class Tests_Renumbering
       raft::update_host(h_final_src_v.data(), src_v.data(), src_v.size(), handle.get_stream());
       raft::update_host(h_final_dst_v.data(), dst_v.data(), dst_v.size(), handle.get_stream());
 
-      EXPECT_EQ(h_original_src_v, h_original_src_v);
-      EXPECT_EQ(h_original_dst_v, h_original_dst_v);
+      EXPECT_EQ(h_original_src_v, h_final_src_v);
+      EXPECT_EQ(h_original_dst_v, h_final_dst_v);
+
+      if (renumbering_usecase.order != cugraph::renumber_order_t::degree) {
+        std::vector<vertex_t> h_renumber_map_labels(renumber_map_labels_v.size());
+        raft::update_host(h_renumber_map_labels.data(),
+                          renumber_map_labels_v.data(),
+                          renumber_map_labels_v.size(),
+                          handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        // label: increasing IDs, vertex_key: decreasing IDs (increasing keys) inside each segment
+        for (size_t i = 0; i < meta.segment_offsets.size() - 1; ++i) {
+          auto first = h_renumber_map_labels.begin() + meta.segment_offsets[i];
+          auto last  = h_renumber_map_labels.begin() + meta.segment_offsets[i + 1];
+          if (renumbering_usecase.order == cugraph::renumber_order_t::label) {
+            ASSERT_TRUE(std::is_sorted(first, last))
+              << "Vertices are not in the label order inside a degree segment.";
+          } else {
+            ASSERT_TRUE(std::is_sorted(first, last, std::greater<vertex_t>{}))
+              << "Vertices are not in the vertex key order inside a degree segment.";
+          }
+        }
+      }
     }
   }
 };
@@ -157,7 +208,9 @@ INSTANTIATE_TEST_SUITE_P(
   Tests_Renumbering_Rmat,
   ::testing::Combine(
     // enable correctness checks
-    ::testing::Values(Renumbering_Usecase{}),
+    ::testing::Values(Renumbering_Usecase{},
+                      Renumbering_Usecase{true, cugraph::renumber_order_t::label},
+                      Renumbering_Usecase{true, cugraph::renumber_order_t::vertex_key}),
     ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
 
 INSTANTIATE_TEST_SUITE_P(
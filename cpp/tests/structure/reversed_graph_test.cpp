@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governin_from_mtxg permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+typedef struct ReversedGraph_Usecase_t {
+  bool test_weighted{false};
+  bool check_correctness{true};
+} ReversedGraph_Usecase;
+
+template <typename input_usecase_t>
+class Tests_ReversedGraph
+  : public ::testing::TestWithParam<std::tuple<ReversedGraph_Usecase, input_usecase_t>> {
+ public:
+  Tests_ReversedGraph() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> to_sorted_host_edges(
+    raft::handle_t const& handle,
+    rmm::device_uvector<vertex_t> const& d_rows,
+    rmm::device_uvector<vertex_t> const& d_cols,
+    std::optional<rmm::device_uvector<weight_t>> const& d_weights,
+    bool flip)
+  {
+    std::vector<vertex_t> h_rows(d_rows.size());
+    std::vector<vertex_t> h_cols(h_rows.size());
+    std::vector<weight_t> h_weights(d_weights ? h_rows.size() : size_t{0});
+    raft::update_host(h_rows.data(), d_rows.data(), d_rows.size(), handle.get_stream());
+    raft::update_host(h_cols.data(), d_cols.data(), d_cols.size(), handle.get_stream());
+    if (d_weights) {
+      raft::update_host(
+        h_weights.data(), (*d_weights).data(), (*d_weights).size(), handle.get_stream());
+    }
+    handle.get_stream_view().synchronize();
+
+    std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges(h_rows.size());
+    for (size_t i = 0; i < edges.size(); ++i) {
+      edges[i] = std::make_tuple(flip ? h_cols[i] : h_rows[i],
+                                 flip ? h_rows[i] : h_cols[i],
+                                 d_weights ? h_weights[i] : weight_t{1.0});
+    }
+    std::sort(edges.begin(), edges.end());
+
+    return edges;
+  }
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(ReversedGraph_Usecase const& reversed_graph_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, reversed_graph_usecase.test_weighted, renumber);
+    auto graph_view = graph.view();
+
+    ASSERT_FALSE(graph.has_reversed_graph());
+    ASSERT_EQ(graph.get_reversed_graph_memory_size(), size_t{0});
+    ASSERT_EQ(graph_view.has_reversed_view(), graph_view.is_symmetric());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto reversed_graph = cugraph::create_reversed_graph(handle, graph_view);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "create_reversed_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    ASSERT_EQ(reversed_graph.get_number_of_vertices(), graph_view.get_number_of_vertices());
+    ASSERT_EQ(reversed_graph.get_number_of_edges(), graph_view.get_number_of_edges());
+    ASSERT_EQ(reversed_graph.is_weighted(), graph_view.is_weighted());
+
+    if (reversed_graph_usecase.check_correctness) {
+      auto [d_org_rows, d_org_cols, d_org_weights] =
+        graph.decompress_to_edgelist(handle, d_renumber_map_labels, false);
+      auto [d_reversed_rows, d_reversed_cols, d_reversed_weights] =
+        reversed_graph.decompress_to_edgelist(handle, d_renumber_map_labels, false);
+
+      auto org_edges = to_sorted_host_edges<vertex_t, edge_t, weight_t>(
+        handle, d_org_rows, d_org_cols, d_org_weights, false);
+      auto reversed_edges = to_sorted_host_edges<vertex_t, edge_t, weight_t>(
+        handle, d_reversed_rows, d_reversed_cols, d_reversed_weights, true);
+
+      ASSERT_EQ(org_edges.size(), reversed_edges.size());
+      ASSERT_TRUE(std::equal(org_edges.begin(), org_edges.end(), reversed_edges.begin()));
+    }
+
+    // cache the reversed graph in graph
+
+    graph.add_reversed_graph(handle);
+    graph_view = graph.view();
+
+    ASSERT_TRUE(graph_view.has_reversed_view());
+    if (graph_view.is_symmetric()) {
+      ASSERT_FALSE(graph.has_reversed_graph());
+      ASSERT_EQ(graph.get_reversed_graph_memory_size(), size_t{0});
+    } else {
+      ASSERT_TRUE(graph.has_reversed_graph());
+      ASSERT_EQ(graph.get_reversed_graph_memory_size(), reversed_graph.get_memory_size());
+
+      auto reversed_graph_view = graph_view.get_reversed_view();
+      ASSERT_EQ(reversed_graph_view.get_number_of_edges(), graph_view.get_number_of_edges());
+      ASSERT_FALSE(reversed_graph_view.has_reversed_view());
+    }
+
+    graph.remove_reversed_graph();
+    ASSERT_FALSE(graph.has_reversed_graph());
+    ASSERT_EQ(graph.get_reversed_graph_memory_size(), size_t{0});
+    ASSERT_EQ(graph.view().has_reversed_view(), graph_view.is_symmetric());
+  }
+};
+
+using Tests_ReversedGraph_File = Tests_ReversedGraph<cugraph::test::File_Usecase>;
+using Tests_ReversedGraph_Rmat = Tests_ReversedGraph<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ReversedGraph_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ReversedGraph_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ReversedGraph_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ReversedGraph_Rmat, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ReversedGraph_Rmat, CheckInt64Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ReversedGraph_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ReversedGraph_Usecase{false}, ReversedGraph_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ReversedGraph_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ReversedGraph_Usecase{false}, ReversedGraph_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ReversedGraph_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(ReversedGraph_Usecase{false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+
+#include <cugraph/partition_manager.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <vector>
+
+struct TopologyAwareRanks_Usecase {
+  std::vector<int64_t> node_ids{};  // node ID of every (old) rank
+  int row_size{1};
+  cugraph::partition_2d::intra_node_subcomm_t intra_node_subcomm{
+    cugraph::partition_2d::intra_node_subcomm_t::row};
+  // sub-communicators spanning two nodes (a node straddles sub-communicators if its number of ranks
+  // is not a multiple of the sub-communicator size)
+  size_t num_straddling_subcomms{0};
+};
+
+class Tests_TopologyAwareRanks : public ::testing::TestWithParam<TopologyAwareRanks_Usecase> {
+ public:
+  Tests_TopologyAwareRanks() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  void run_current_test(TopologyAwareRanks_Usecase const& configuration)
+  {
+    using cugraph::partition_2d::intra_node_subcomm_t;
+
+    auto const comm_size = static_cast<int>(configuration.node_ids.size());
+    auto const row_size  = configuration.row_size;
+
+    auto new_ranks = cugraph::partition_2d::detail::compute_topology_aware_ranks(
+      configuration.node_ids, row_size, configuration.intra_node_subcomm);
+
+    // the new ranks should be a permutation of the old ranks
+
+    ASSERT_EQ(new_ranks.size(), configuration.node_ids.size());
+    auto sorted_new_ranks = new_ranks;
+    std::sort(sorted_new_ranks.begin(), sorted_new_ranks.end());
+    std::vector<int> identity(comm_size);
+    std::iota(identity.begin(), identity.end(), int{0});
+    ASSERT_EQ(sorted_new_ranks, identity) << "the new ranks are not a permutation.";
+
+    // the members of a kept sub-communicator (new rank / row_size for the row sub-communicators,
+    // new rank % row_size for the column sub-communicators) should share a node
+
+    auto const num_subcomms = configuration.intra_node_subcomm == intra_node_subcomm_t::row
+                                ? comm_size / row_size
+                                : row_size;
+    std::vector<std::set<int64_t>> subcomm_node_ids(num_subcomms);
+    for (int old_rank = 0; old_rank < comm_size; ++old_rank) {
+      auto subcomm = configuration.intra_node_subcomm == intra_node_subcomm_t::row
+                       ? new_ranks[old_rank] / row_size
+                       : new_ranks[old_rank] % row_size;
+      subcomm_node_ids[subcomm].insert(configuration.node_ids[old_rank]);
+    }
+    size_t num_straddling_subcomms{0};
+    for (int i = 0; i < num_subcomms; ++i) {
+      ASSERT_LE(subcomm_node_ids[i].size(), size_t{2})
+        << "sub-communicator " << i << " spans more than two nodes.";
+      if (subcomm_node_ids[i].size() > 1) { ++num_straddling_subcomms; }
+    }
+    ASSERT_EQ(num_straddling_subcomms, configuration.num_straddling_subcomms);
+
+    // the identity if the ranks are already grouped by node (in the row mode)
+
+    if ((configuration.intra_node_subcomm == intra_node_subcomm_t::row) &&
+        std::is_sorted(configuration.node_ids.begin(), configuration.node_ids.end())) {
+      ASSERT_EQ(new_ranks, identity);
+    }
+  }
+};
+
+TEST_P(Tests_TopologyAwareRanks, CheckRanks) { run_current_test(GetParam()); }
+
+using cugraph::partition_2d::intra_node_subcomm_t;
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_TopologyAwareRanks,
+  ::testing::Values(
+    // two nodes of four ranks, interleaved
+    TopologyAwareRanks_Usecase{{0, 1, 0, 1, 0, 1, 0, 1}, 4, intra_node_subcomm_t::row, 0},
+    TopologyAwareRanks_Usecase{{0, 1, 0, 1, 0, 1, 0, 1}, 2, intra_node_subcomm_t::col, 0},
+    // four nodes of two ranks
+    TopologyAwareRanks_Usecase{{0, 1, 2, 3, 0, 1, 2, 3}, 4, intra_node_subcomm_t::col, 0},
+    // already grouped by node (re-ranked only to keep the column sub-communicators in a node)
+    TopologyAwareRanks_Usecase{{0, 0, 0, 0, 1, 1, 1, 1}, 4, intra_node_subcomm_t::row, 0},
+    TopologyAwareRanks_Usecase{{0, 0, 0, 0, 1, 1, 1, 1}, 2, intra_node_subcomm_t::col, 0},
+    // a node of three ranks and a node of five ranks (not multiples of the sub-communicator size)
+    TopologyAwareRanks_Usecase{{7, 3, 3, 7, 3, 3, 7, 3}, 4, intra_node_subcomm_t::row, 1},
+    TopologyAwareRanks_Usecase{{7, 3, 3, 7, 3, 3, 7, 3}, 2, intra_node_subcomm_t::col, 1},
+    // a single node
+    TopologyAwareRanks_Usecase{{5, 5, 5, 5, 5, 5}, 3, intra_node_subcomm_t::col, 0}));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
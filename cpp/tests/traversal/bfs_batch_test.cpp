@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+struct BFS_Batch_Usecase {
+  size_t n_sources{64};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_BFS_Batch
+  : public ::testing::TestWithParam<std::tuple<BFS_Batch_Usecase, input_usecase_t>> {
+ public:
+  Tests_BFS_Batch() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(BFS_Batch_Usecase const& bfs_batch_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+    auto graph_view = graph.view();
+
+    auto n_sources = std::min(bfs_batch_usecase.n_sources,
+                              static_cast<size_t>(graph_view.get_number_of_vertices()));
+    std::vector<vertex_t> h_sources(n_sources);
+    std::iota(h_sources.begin(), h_sources.end(), vertex_t{0});
+    rmm::device_uvector<vertex_t> d_sources(n_sources, handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+
+    rmm::device_uvector<vertex_t> d_distances(
+      n_sources * static_cast<size_t>(graph_view.get_number_of_vertices()), handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::bfs_batch(handle, graph_view, d_distances.data(), d_sources.data(), n_sources);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "BFS batch (" << n_sources << " sources) took " << elapsed_time * 1e-6
+                << " s.\n";
+    }
+
+    if (bfs_batch_usecase.check_correctness) {
+      std::vector<vertex_t> h_cugraph_distances(d_distances.size());
+      raft::update_host(
+        h_cugraph_distances.data(), d_distances.data(), d_distances.size(), handle.get_stream());
+
+      rmm::device_uvector<vertex_t> d_reference_distances(graph_view.get_number_of_vertices(),
+                                                          handle.get_stream());
+      std::vector<vertex_t> h_reference_distances(graph_view.get_number_of_vertices());
+      for (size_t i = 0; i < n_sources; ++i) {
+        cugraph::bfs(handle,
+                     graph_view,
+                     d_reference_distances.data(),
+                     static_cast<vertex_t*>(nullptr),
+                     d_sources.data() + i,
+                     size_t{1});
+        raft::update_host(h_reference_distances.data(),
+                          d_reference_distances.data(),
+                          d_reference_distances.size(),
+                          handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        auto first = h_cugraph_distances.begin() + i * graph_view.get_number_of_vertices();
+        ASSERT_TRUE(
+          std::equal(h_reference_distances.begin(), h_reference_distances.end(), first))
+          << "distances from source " << h_sources[i] << " do not match with the reference values.";
+      }
+    }
+  }
+};
+
+using Tests_BFS_Batch_File = Tests_BFS_Batch<cugraph::test::File_Usecase>;
+using Tests_BFS_Batch_Rmat = Tests_BFS_Batch<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_BFS_Batch_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_BFS_Batch_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BFS_Batch_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_BFS_Batch_File,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(BFS_Batch_Usecase{1}, cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(BFS_Batch_Usecase{64},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(BFS_Batch_Usecase{17},
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx")),
+    std::make_tuple(BFS_Batch_Usecase{64},
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_BFS_Batch_Rmat,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(BFS_Batch_Usecase{64},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false)),
+    std::make_tuple(BFS_Batch_Usecase{40},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_BFS_Batch_Rmat,
+  ::testing::Values(
+    // disable correctness checks for large graphs
+    std::make_pair(BFS_Batch_Usecase{64, false},
+                   cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+struct ConcurrentTraversal_Usecase {
+  size_t num_queries{8};
+};
+
+template <typename input_usecase_t>
+class Tests_ConcurrentTraversal
+  : public ::testing::TestWithParam<std::tuple<ConcurrentTraversal_Usecase, input_usecase_t>> {
+ public:
+  Tests_ConcurrentTraversal() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // BFS & SSSP queries run concurrently from multiple host threads on the streams of light handles
+  // sharing one graph should return the same results as the queries run one by one
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(ConcurrentTraversal_Usecase const& concurrent_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle(static_cast<int>(concurrent_usecase.num_queries));
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, true);
+    auto graph_view = graph.view();
+
+    auto num_queries = concurrent_usecase.num_queries;
+    std::vector<vertex_t> sources(num_queries);
+    for (size_t i = 0; i < num_queries; ++i) {
+      sources[i] = static_cast<vertex_t>((i * 7) % graph_view.get_number_of_vertices());
+    }
+
+    auto run_query = [&graph_view, &sources](raft::handle_t const& query_handle, size_t i) {
+      rmm::device_uvector<vertex_t> d_bfs_distances(graph_view.get_number_of_vertices(),
+                                                    query_handle.get_stream());
+      rmm::device_uvector<weight_t> d_sssp_distances(graph_view.get_number_of_vertices(),
+                                                     query_handle.get_stream());
+      rmm::device_scalar<vertex_t> const d_source(sources[i], query_handle.get_stream());
+
+      cugraph::bfs(query_handle,
+                   graph_view,
+                   d_bfs_distances.data(),
+                   static_cast<vertex_t*>(nullptr),
+                   d_source.data(),
+                   size_t{1},
+                   false,
+                   std::numeric_limits<vertex_t>::max());
+      cugraph::sssp(query_handle,
+                    graph_view,
+                    d_sssp_distances.data(),
+                    static_cast<vertex_t*>(nullptr),
+                    sources[i],
+                    std::numeric_limits<weight_t>::max());
+
+      return std::make_tuple(
+        cugraph::test::to_host(query_handle, d_bfs_distances.data(), d_bfs_distances.size()),
+        cugraph::test::to_host(query_handle, d_sssp_distances.data(), d_sssp_distances.size()));
+    };
+
+    std::vector<std::vector<vertex_t>> h_sequential_bfs_distances(num_queries);
+    std::vector<std::vector<weight_t>> h_sequential_sssp_distances(num_queries);
+    for (size_t i = 0; i < num_queries; ++i) {
+      std::tie(h_sequential_bfs_distances[i], h_sequential_sssp_distances[i]) =
+        run_query(handle, i);
+    }
+
+    std::vector<std::vector<vertex_t>> h_concurrent_bfs_distances(num_queries);
+    std::vector<std::vector<weight_t>> h_concurrent_sssp_distances(num_queries);
+    std::vector<std::thread> threads{};
+    threads.reserve(num_queries);
+    for (size_t i = 0; i < num_queries; ++i) {
+      threads.emplace_back([&, i]() {
+        raft::handle_t light_handle(handle, static_cast<int>(i));
+        std::tie(h_concurrent_bfs_distances[i], h_concurrent_sssp_distances[i]) =
+          run_query(light_handle, i);
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    for (size_t i = 0; i < num_queries; ++i) {
+      ASSERT_TRUE(std::equal(h_sequential_bfs_distances[i].begin(),
+                             h_sequential_bfs_distances[i].end(),
+                             h_concurrent_bfs_distances[i].begin()))
+        << "BFS distances differ for query " << i << ".";
+
+      auto threshold_ratio = weight_t{1e-4};
+      ASSERT_TRUE(std::equal(h_sequential_sssp_distances[i].begin(),
+                             h_sequential_sssp_distances[i].end(),
+                             h_concurrent_sssp_distances[i].begin(),
+                             [threshold_ratio](auto lhs, auto rhs) {
+                               return lhs == rhs ||
+                                      std::abs(lhs - rhs) <= std::abs(lhs) * threshold_ratio;
+                             }))
+        << "SSSP distances differ for query " << i << ".";
+    }
+  }
+};
+
+using Tests_ConcurrentTraversal_File = Tests_ConcurrentTraversal<cugraph::test::File_Usecase>;
+using Tests_ConcurrentTraversal_Rmat = Tests_ConcurrentTraversal<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ConcurrentTraversal_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ConcurrentTraversal_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ConcurrentTraversal_File,
+  ::testing::Combine(
+    ::testing::Values(ConcurrentTraversal_Usecase{4}, ConcurrentTraversal_Usecase{16}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ConcurrentTraversal_Rmat,
+  ::testing::Combine(
+    ::testing::Values(ConcurrentTraversal_Usecase{8}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <vector>
+
+template <typename vertex_t, typename edge_t>
+vertex_t eccentricity_reference(edge_t const* offsets,
+                                vertex_t const* indices,
+                                vertex_t num_vertices,
+                                vertex_t source,
+                                std::vector<vertex_t>& distances)
+{
+  std::fill(distances.begin(), distances.end(), std::numeric_limits<vertex_t>::max());
+  std::queue<vertex_t> queue{};
+  distances[source] = vertex_t{0};
+  queue.push(source);
+  vertex_t eccentricity{0};
+  while (!queue.empty()) {
+    auto v = queue.front();
+    queue.pop();
+    eccentricity = std::max(eccentricity, distances[v]);
+    for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+      auto nbr = indices[i];
+      if (distances[nbr] == std::numeric_limits<vertex_t>::max()) {
+        distances[nbr] = distances[v] + 1;
+        queue.push(nbr);
+      }
+    }
+  }
+  return eccentricity;
+}
+
+struct Diameter_Usecase {
+  size_t max_traversals{std::numeric_limits<size_t>::max()};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_Diameter
+  : public ::testing::TestWithParam<std::tuple<Diameter_Usecase, input_usecase_t>> {
+ public:
+  Tests_Diameter() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // the bounds should hold the exact diameter of the component of the maximum degree vertex (and
+  // be tight without a traversal limit) and the eccentricities should match the reference values
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(Diameter_Usecase const& diameter_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = graph_view.get_number_of_vertices();
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [lower, upper] = cugraph::approximate_diameter(
+      handle, graph_view, std::optional<vertex_t>{std::nullopt}, diameter_usecase.max_traversals);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "approximate_diameter took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (diameter_usecase.check_correctness) {
+      std::vector<vertex_t> h_vertices(num_vertices);
+      std::iota(h_vertices.begin(), h_vertices.end(), vertex_t{0});
+      rmm::device_uvector<vertex_t> d_vertices(h_vertices.size(), handle.get_stream());
+      raft::update_device(
+        d_vertices.data(), h_vertices.data(), h_vertices.size(), handle.get_stream());
+      auto d_eccentricities =
+        cugraph::eccentricity(handle, graph_view, d_vertices.data(), d_vertices.size());
+
+      std::vector<edge_t> h_offsets(num_vertices + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        num_vertices + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      auto h_eccentricities =
+        cugraph::test::to_host(handle, d_eccentricities.data(), d_eccentricities.size());
+
+      vertex_t start_vertex{0};
+      for (vertex_t v = 1; v < num_vertices; ++v) {
+        auto degree              = h_offsets[v + 1] - h_offsets[v];
+        auto start_vertex_degree = h_offsets[start_vertex + 1] - h_offsets[start_vertex];
+        if (degree > start_vertex_degree) { start_vertex = v; }
+      }
+      std::vector<vertex_t> h_start_distances(num_vertices);
+      eccentricity_reference(
+        h_offsets.data(), h_indices.data(), num_vertices, start_vertex, h_start_distances);
+
+      std::vector<vertex_t> h_distances(num_vertices);
+      vertex_t h_diameter{0};
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        auto h_eccentricity =
+          eccentricity_reference(h_offsets.data(), h_indices.data(), num_vertices, v, h_distances);
+        ASSERT_EQ(h_eccentricities[v], h_eccentricity)
+          << "eccentricity does not match with the reference value.";
+        if (h_start_distances[v] != std::numeric_limits<vertex_t>::max()) {
+          h_diameter = std::max(h_diameter, h_eccentricity);
+        }
+      }
+
+      ASSERT_TRUE((lower <= h_diameter) && (h_diameter <= upper))
+        << "the bounds [" << lower << ", " << upper << "] do not hold the diameter " << h_diameter
+        << ".";
+      if (diameter_usecase.max_traversals == std::numeric_limits<size_t>::max()) {
+        ASSERT_EQ(lower, upper) << "the bounds should be tight without a traversal limit.";
+      }
+    }
+  }
+};
+
+using Tests_Diameter_File = Tests_Diameter<cugraph::test::File_Usecase>;
+using Tests_Diameter_Rmat = Tests_Diameter<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_Diameter_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_Diameter_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Diameter_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_Diameter_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(Diameter_Usecase{}, Diameter_Usecase{4}, Diameter_Usecase{16}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_Diameter_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(Diameter_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_Diameter_Rmat,
+  ::testing::Combine(
+    // disable correctness checks
+    ::testing::Values(Diameter_Usecase{100, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -177,6 +177,37 @@ class Tests_ExtractBfsPaths
       ASSERT_TRUE(
         std::equal(h_reference_paths.begin(), h_reference_paths.end(), h_cugraph_paths.begin()))
         << "extracted paths do not match with the reference values.";
+
+      // the compressed paths should match the dense paths without the padding
+
+      auto [d_path_offsets, d_compressed_paths] =
+        cugraph::extract_bfs_paths_compressed(handle,
+                                              graph_view,
+                                              d_distances.data(),
+                                              d_predecessors.data(),
+                                              d_destinations.data(),
+                                              d_destinations.size());
+
+      std::vector<size_t> h_path_offsets(d_path_offsets.size());
+      std::vector<vertex_t> h_compressed_paths(d_compressed_paths.size());
+      raft::update_host(
+        h_path_offsets.data(), d_path_offsets.data(), d_path_offsets.size(), handle.get_stream());
+      raft::update_host(h_compressed_paths.data(),
+                        d_compressed_paths.data(),
+                        d_compressed_paths.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      ASSERT_EQ(h_path_offsets.size(), h_destinations.size() + 1);
+      ASSERT_EQ(h_path_offsets.back(), h_compressed_paths.size());
+      for (size_t i = 0; i < h_destinations.size(); ++i) {
+        auto first = h_reference_paths.begin() + max_path_length * i;
+        auto last  = std::find(first, first + max_path_length, invalid_vertex);
+        ASSERT_EQ(h_path_offsets[i + 1] - h_path_offsets[i],
+                  static_cast<size_t>(std::distance(first, last)));
+        ASSERT_TRUE(std::equal(first, last, h_compressed_paths.begin() + h_path_offsets[i]))
+          << "compressed paths do not match with the reference values.";
+      }
     }
   }
 };
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+struct KHopNbrs_Usecase {
+  size_t n_queries{4};
+  size_t n_seeds_per_query{2};
+  size_t k{2};
+  std::optional<size_t> hop_limit{std::nullopt};  // same limit for every hop
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_KHopNbrs
+  : public ::testing::TestWithParam<std::tuple<KHopNbrs_Usecase, input_usecase_t>> {
+ public:
+  Tests_KHopNbrs() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(KHopNbrs_Usecase const& k_hop_nbrs_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = static_cast<size_t>(graph_view.get_number_of_vertices());
+
+    // the seeds of the queries are spread over the vertex ID range
+    auto n_queries = k_hop_nbrs_usecase.n_queries;
+    auto n_seeds   = n_queries * k_hop_nbrs_usecase.n_seeds_per_query;
+    std::vector<vertex_t> h_seeds(n_seeds);
+    std::vector<size_t> h_seed_query_indices(n_seeds);
+    for (size_t i = 0; i < n_seeds; ++i) {
+      h_seeds[i]              = static_cast<vertex_t>((i * 7919) % num_vertices);
+      h_seed_query_indices[i] = i % n_queries;
+    }
+    rmm::device_uvector<vertex_t> d_seeds(n_seeds, handle.get_stream());
+    rmm::device_uvector<size_t> d_seed_query_indices(n_seeds, handle.get_stream());
+    raft::update_device(d_seeds.data(), h_seeds.data(), h_seeds.size(), handle.get_stream());
+    raft::update_device(d_seed_query_indices.data(),
+                        h_seed_query_indices.data(),
+                        h_seed_query_indices.size(),
+                        handle.get_stream());
+
+    auto hop_limits = k_hop_nbrs_usecase.hop_limit
+                        ? std::make_optional<std::vector<size_t>>(k_hop_nbrs_usecase.k,
+                                                                  *(k_hop_nbrs_usecase.hop_limit))
+                        : std::nullopt;
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [d_offsets, d_vertices, d_hops] = cugraph::k_hop_nbrs(handle,
+                                                               graph_view,
+                                                               d_seeds.data(),
+                                                               d_seed_query_indices.data(),
+                                                               n_seeds,
+                                                               n_queries,
+                                                               k_hop_nbrs_usecase.k,
+                                                               hop_limits,
+                                                               true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "k-hop neighbors (" << n_queries << " queries) took " << elapsed_time * 1e-6
+                << " s.\n";
+    }
+
+    if (k_hop_nbrs_usecase.check_correctness) {
+      std::vector<size_t> h_offsets(d_offsets.size());
+      std::vector<vertex_t> h_vertices(d_vertices.size());
+      std::vector<vertex_t> h_hops(d_hops.size());
+      raft::update_host(h_offsets.data(), d_offsets.data(), d_offsets.size(), handle.get_stream());
+      raft::update_host(
+        h_vertices.data(), d_vertices.data(), d_vertices.size(), handle.get_stream());
+      raft::update_host(h_hops.data(), d_hops.data(), d_hops.size(), handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      ASSERT_EQ(h_offsets.size(), n_queries + 1);
+      ASSERT_EQ(h_offsets.back(), h_vertices.size());
+
+      rmm::device_uvector<vertex_t> d_query_seeds(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_reference_distances(num_vertices, handle.get_stream());
+      std::vector<vertex_t> h_reference_distances(num_vertices);
+      for (size_t q = 0; q < n_queries; ++q) {
+        std::vector<vertex_t> h_query_seeds{};
+        for (size_t i = 0; i < n_seeds; ++i) {
+          if (h_seed_query_indices[i] == q) { h_query_seeds.push_back(h_seeds[i]); }
+        }
+        std::sort(h_query_seeds.begin(), h_query_seeds.end());
+        h_query_seeds.erase(std::unique(h_query_seeds.begin(), h_query_seeds.end()),
+                            h_query_seeds.end());
+        d_query_seeds.resize(h_query_seeds.size(), handle.get_stream());
+        raft::update_device(
+          d_query_seeds.data(), h_query_seeds.data(), h_query_seeds.size(), handle.get_stream());
+
+        cugraph::bfs(handle,
+                     graph_view,
+                     d_reference_distances.data(),
+                     static_cast<vertex_t*>(nullptr),
+                     d_query_seeds.data(),
+                     d_query_seeds.size(),
+                     false,
+                     static_cast<vertex_t>(k_hop_nbrs_usecase.k));
+        raft::update_host(h_reference_distances.data(),
+                          d_reference_distances.data(),
+                          d_reference_distances.size(),
+                          handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        ASSERT_TRUE(std::is_sorted(h_vertices.begin() + h_offsets[q],
+                                   h_vertices.begin() + h_offsets[q + 1]));
+        if (hop_limits) {
+          // a reached vertex is at least as far as the BFS distance and no hop exceeds the limit
+          std::vector<size_t> hop_counts(k_hop_nbrs_usecase.k + 1, size_t{0});
+          for (size_t i = h_offsets[q]; i < h_offsets[q + 1]; ++i) {
+            ASSERT_TRUE(h_hops[i] >= h_reference_distances[h_vertices[i]]);
+            ++hop_counts[h_hops[i]];
+          }
+          for (size_t h = 1; h <= k_hop_nbrs_usecase.k; ++h) {
+            ASSERT_TRUE(hop_counts[h] <= *(k_hop_nbrs_usecase.hop_limit));
+          }
+        } else {
+          std::vector<vertex_t> h_reference_vertices{};
+          std::vector<vertex_t> h_reference_hops{};
+          for (size_t v = 0; v < num_vertices; ++v) {
+            if (h_reference_distances[v] <= static_cast<vertex_t>(k_hop_nbrs_usecase.k)) {
+              h_reference_vertices.push_back(static_cast<vertex_t>(v));
+              h_reference_hops.push_back(h_reference_distances[v]);
+            }
+          }
+          ASSERT_TRUE(std::equal(h_reference_vertices.begin(),
+                                 h_reference_vertices.end(),
+                                 h_vertices.begin() + h_offsets[q],
+                                 h_vertices.begin() + h_offsets[q + 1]))
+            << "reached vertices of query " << q << " do not match with the reference values.";
+          ASSERT_TRUE(std::equal(h_reference_hops.begin(),
+                                 h_reference_hops.end(),
+                                 h_hops.begin() + h_offsets[q],
+                                 h_hops.begin() + h_offsets[q + 1]))
+            << "hop counts of query " << q << " do not match with the reference values.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_KHopNbrs_File = Tests_KHopNbrs<cugraph::test::File_Usecase>;
+using Tests_KHopNbrs_Rmat = Tests_KHopNbrs<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_KHopNbrs_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_KHopNbrs_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_KHopNbrs_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_KHopNbrs_File,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(KHopNbrs_Usecase{1, 1, 1},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(KHopNbrs_Usecase{4, 2, 2},
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx")),
+    std::make_tuple(KHopNbrs_Usecase{8, 3, 3},
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx")),
+    std::make_tuple(KHopNbrs_Usecase{8, 3, 3, size_t{5}},
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_KHopNbrs_Rmat,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(KHopNbrs_Usecase{16, 2, 2},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false)),
+    std::make_tuple(KHopNbrs_Usecase{16, 2, 2, size_t{32}},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_KHopNbrs_Rmat,
+  ::testing::Values(
+    // disable correctness checks for large graphs
+    std::make_pair(KHopNbrs_Usecase{64, 1, 2, std::nullopt, false},
+                   cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -152,8 +152,8 @@ class Tests_SSSP : public ::testing::TestWithParam<SSSP_Usecase> {
 
   static std::vector<double> SSSP_time;
 
-  // MaxVType:        Data type of vertices id (signed int-32)
-  // MaxEType:        Data type of edges id (signed int-32)
+  // MaxVType:        Data type of vertices id (signed int-32 / int-64)
+  // MaxEType:        Data type of edges id (same as MaxVType)
   // DistType:        Data type of weights (float / double)
   // DoRandomWeights: SSSP Implementation requires weights to operate,
   //                    if true: generate random weights before calling
@@ -184,8 +184,8 @@ class Tests_SSSP : public ::testing::TestWithParam<SSSP_Usecase> {
     // src = static_cast<MaxVType>(param.src_);
 
     // Input
-    ASSERT_TRUE(typeid(MaxVType) == typeid(int));  // We don't have support for other types yet
-    ASSERT_TRUE(typeid(MaxEType) == typeid(int));  // We don't have support for other types yet
+    ASSERT_TRUE((typeid(MaxVType) == typeid(int32_t)) || (typeid(MaxVType) == typeid(int64_t)));
+    ASSERT_TRUE(typeid(MaxEType) == typeid(MaxVType));
     ASSERT_TRUE((typeid(DistType) == typeid(float)) || (typeid(DistType) == typeid(double)));
     if (param.type_ == RMAT) {
       // This is size_t due to grmat_gen which should be fixed there
@@ -421,6 +421,15 @@ TEST_P(Tests_SSSP, CheckFP64_RANDOM_DIST_PREDS)
   run_current_test<int, int, double, true, true, true>(GetParam());
 }
 
+TEST_P(Tests_SSSP, CheckInt64FP32_RANDOM_DIST_PREDS)
+{
+  run_current_test<int64_t, int64_t, float, true, true, true>(GetParam());
+}
+TEST_P(Tests_SSSP, CheckInt64FP64_NO_RANDOM_DIST_PREDS)
+{
+  run_current_test<int64_t, int64_t, double, false, true, true>(GetParam());
+}
+
 // --gtest_filter=*simple_test*
 
 INSTANTIATE_TEST_SUITE_P(simple_test,
@@ -40,6 +40,8 @@
 struct BFS_Usecase {
   size_t source{0};
   bool check_correctness{true};
+  bool direction_optimizing{false};
+  bool compress_shuffles{false};
 };
 
 template <typename input_usecase_t>
@@ -125,8 +127,10 @@ class Tests_MGBFS : public ::testing::TestWithParam<std::tuple<BFS_Usecase, inpu
                  d_mg_predecessors.data(),
                  d_mg_source ? (*d_mg_source).data() : static_cast<vertex_t const*>(nullptr),
                  d_mg_source ? size_t{1} : size_t{0},
+                 bfs_usecase.direction_optimizing,
+                 std::numeric_limits<vertex_t>::max(),
                  false,
-                 std::numeric_limits<vertex_t>::max());
+                 bfs_usecase.compress_shuffles);
 
     if (cugraph::test::g_perf) {
       CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -307,6 +311,12 @@ INSTANTIATE_TEST_SUITE_P(rmat_small_test,
                          ::testing::Values(
                            // enable correctness checks
                            std::make_tuple(BFS_Usecase{0},
+                                           cugraph::test::Rmat_Usecase(
+                                             10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true)),
+                           std::make_tuple(BFS_Usecase{0, true, true},
+                                           cugraph::test::Rmat_Usecase(
+                                             10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true)),
+                           std::make_tuple(BFS_Usecase{0, true, false, true},
                                            cugraph::test::Rmat_Usecase(
                                              10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
 
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/sequence.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+struct TwoHopNeighbors_Usecase {
+  size_t batch_memory_budget{std::numeric_limits<size_t>::max()};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGTwoHopNeighbors
+  : public ::testing::TestWithParam<std::tuple<TwoHopNeighbors_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGTwoHopNeighbors() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // runs get_two_hop_neighbors_batched from every local vertex and concatenates the batches
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  static std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+  run_two_hop_neighbors(
+    raft::handle_t const& handle,
+    cugraph::graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+    TwoHopNeighbors_Usecase const& two_hop_usecase)
+  {
+    rmm::device_uvector<vertex_t> d_start_vertices(graph_view.get_number_of_local_vertices(),
+                                                   handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(),
+                     d_start_vertices.begin(),
+                     d_start_vertices.end(),
+                     graph_view.get_local_vertex_first());
+
+    rmm::device_uvector<vertex_t> d_srcs(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dsts(0, handle.get_stream());
+    cugraph::get_two_hop_neighbors_batched(
+      handle,
+      graph_view,
+      d_start_vertices.data(),
+      d_start_vertices.size(),
+      two_hop_usecase.batch_memory_budget,
+      [&handle, &d_srcs, &d_dsts, &two_hop_usecase](rmm::device_uvector<vertex_t>&& srcs,
+                                                    rmm::device_uvector<vertex_t>&& dsts) {
+        if (two_hop_usecase.check_correctness) {
+          auto old_size = d_srcs.size();
+          d_srcs.resize(old_size + srcs.size(), handle.get_stream());
+          d_dsts.resize(old_size + dsts.size(), handle.get_stream());
+          thrust::copy(
+            handle.get_thrust_policy(), srcs.begin(), srcs.end(), d_srcs.begin() + old_size);
+          thrust::copy(
+            handle.get_thrust_policy(), dsts.begin(), dsts.end(), d_dsts.begin() + old_size);
+        }
+      });
+
+    return std::make_tuple(std::move(d_srcs), std::move(d_dsts));
+  }
+
+  // Compare the results of running 2-hop neighbor enumeration on multiple GPUs to that of a
+  // single-GPU run
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(TwoHopNeighbors_Usecase const& two_hop_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, false, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run MG 2-hop neighbor enumeration
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [d_mg_srcs, d_mg_dsts] = run_two_hop_neighbors(handle, mg_graph_view, two_hop_usecase);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG get_two_hop_neighbors_batched took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. compare SG & MG results
+
+    if (two_hop_usecase.check_correctness) {
+      // 4-1. aggregate MG results
+
+      auto d_mg_aggregate_renumber_map_labels = cugraph::test::device_gatherv(
+        handle, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+      auto d_mg_aggregate_srcs =
+        cugraph::test::device_gatherv(handle, d_mg_srcs.data(), d_mg_srcs.size());
+      auto d_mg_aggregate_dsts =
+        cugraph::test::device_gatherv(handle, d_mg_dsts.data(), d_mg_dsts.size());
+
+      if (handle.get_comms().get_rank() == int{0}) {
+        // 4-2. unrenumber MG results
+
+        cugraph::unrenumber_int_vertices<vertex_t, false>(
+          handle,
+          d_mg_aggregate_srcs.data(),
+          d_mg_aggregate_srcs.size(),
+          d_mg_aggregate_renumber_map_labels.data(),
+          std::vector<vertex_t>{mg_graph_view.get_number_of_vertices()});
+        cugraph::unrenumber_int_vertices<vertex_t, false>(
+          handle,
+          d_mg_aggregate_dsts.data(),
+          d_mg_aggregate_dsts.size(),
+          d_mg_aggregate_renumber_map_labels.data(),
+          std::vector<vertex_t>{mg_graph_view.get_number_of_vertices()});
+
+        // 4-3. create SG graph
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, false, false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_EQ(mg_graph_view.get_number_of_vertices(), sg_graph_view.get_number_of_vertices());
+
+        // 4-4. run SG 2-hop neighbor enumeration
+
+        auto [d_sg_srcs, d_sg_dsts] = run_two_hop_neighbors(handle, sg_graph_view, two_hop_usecase);
+
+        // 4-5. compare
+
+        ASSERT_EQ(d_mg_aggregate_srcs.size(), d_sg_srcs.size());
+
+        std::vector<vertex_t> h_mg_aggregate_srcs(d_mg_aggregate_srcs.size());
+        std::vector<vertex_t> h_mg_aggregate_dsts(d_mg_aggregate_dsts.size());
+        raft::update_host(h_mg_aggregate_srcs.data(),
+                          d_mg_aggregate_srcs.data(),
+                          d_mg_aggregate_srcs.size(),
+                          handle.get_stream());
+        raft::update_host(h_mg_aggregate_dsts.data(),
+                          d_mg_aggregate_dsts.data(),
+                          d_mg_aggregate_dsts.size(),
+                          handle.get_stream());
+
+        std::vector<vertex_t> h_sg_srcs(d_sg_srcs.size());
+        std::vector<vertex_t> h_sg_dsts(d_sg_dsts.size());
+        raft::update_host(
+          h_sg_srcs.data(), d_sg_srcs.data(), d_sg_srcs.size(), handle.get_stream());
+        raft::update_host(
+          h_sg_dsts.data(), d_sg_dsts.data(), d_sg_dsts.size(), handle.get_stream());
+
+        handle.get_stream_view().synchronize();
+
+        std::vector<std::tuple<vertex_t, vertex_t>> h_mg_aggregate_pairs(
+          h_mg_aggregate_srcs.size());
+        std::vector<std::tuple<vertex_t, vertex_t>> h_sg_pairs(h_sg_srcs.size());
+        for (size_t i = 0; i < h_mg_aggregate_pairs.size(); ++i) {
+          h_mg_aggregate_pairs[i] =
+            std::make_tuple(h_mg_aggregate_srcs[i], h_mg_aggregate_dsts[i]);
+          h_sg_pairs[i] = std::make_tuple(h_sg_srcs[i], h_sg_dsts[i]);
+        }
+        std::sort(h_mg_aggregate_pairs.begin(), h_mg_aggregate_pairs.end());
+        std::sort(h_sg_pairs.begin(), h_sg_pairs.end());
+
+        ASSERT_TRUE(std::equal(
+          h_mg_aggregate_pairs.begin(), h_mg_aggregate_pairs.end(), h_sg_pairs.begin()));
+      }
+    }
+  }
+};
+
+using Tests_MGTwoHopNeighbors_File = Tests_MGTwoHopNeighbors<cugraph::test::File_Usecase>;
+using Tests_MGTwoHopNeighbors_Rmat = Tests_MGTwoHopNeighbors<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGTwoHopNeighbors_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGTwoHopNeighbors_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGTwoHopNeighbors_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGTwoHopNeighbors_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGTwoHopNeighbors_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(TwoHopNeighbors_Usecase{}, TwoHopNeighbors_Usecase{1024}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGTwoHopNeighbors_Rmat,
+  ::testing::Combine(::testing::Values(TwoHopNeighbors_Usecase{1 << 16}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                                         10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true),
+                                       cugraph::test::Rmat_Usecase(
+                                         10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGTwoHopNeighbors_Rmat,
+  ::testing::Combine(
+    ::testing::Values(TwoHopNeighbors_Usecase{size_t{1} << 30, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
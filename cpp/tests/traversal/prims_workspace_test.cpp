@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/prims_workspace.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+struct PrimsWorkspace_Usecase {
+  size_t source{0};
+};
+
+template <typename input_usecase_t>
+class Tests_PrimsWorkspace
+  : public ::testing::TestWithParam<std::tuple<PrimsWorkspace_Usecase, input_usecase_t>> {
+ public:
+  Tests_PrimsWorkspace() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // BFS & SSSP results should not depend on where the prims allocate their temporary buffers
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(PrimsWorkspace_Usecase const& workspace_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    // the workspace is a no-op on top of a user set resource, use the plain CUDA resource
+    rmm::mr::cuda_memory_resource cuda_mr{};
+    auto old_mr = rmm::mr::set_current_device_resource(&cuda_mr);
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, true);
+    auto graph_view = graph.view();
+    auto source     = static_cast<vertex_t>(workspace_usecase.source %
+                                        static_cast<size_t>(graph_view.get_number_of_vertices()));
+
+    auto run_queries = [&]() {
+      rmm::device_uvector<vertex_t> d_bfs_distances(graph_view.get_number_of_vertices(),
+                                                    handle.get_stream());
+      rmm::device_uvector<weight_t> d_sssp_distances(graph_view.get_number_of_vertices(),
+                                                     handle.get_stream());
+      rmm::device_scalar<vertex_t> const d_source(source, handle.get_stream());
+
+      cugraph::bfs(handle,
+                   graph_view,
+                   d_bfs_distances.data(),
+                   static_cast<vertex_t*>(nullptr),
+                   d_source.data(),
+                   size_t{1},
+                   false,
+                   std::numeric_limits<vertex_t>::max());
+      cugraph::sssp(handle,
+                    graph_view,
+                    d_sssp_distances.data(),
+                    static_cast<vertex_t*>(nullptr),
+                    source,
+                    std::numeric_limits<weight_t>::max());
+
+      return std::make_tuple(
+        cugraph::test::to_host(handle, d_bfs_distances.data(), d_bfs_distances.size()),
+        cugraph::test::to_host(handle, d_sssp_distances.data(), d_sssp_distances.size()));
+    };
+
+    auto [h_bfs_distances, h_sssp_distances] = run_queries();
+
+    std::vector<vertex_t> h_workspace_bfs_distances{};
+    std::vector<weight_t> h_workspace_sssp_distances{};
+    {
+      cugraph::scoped_prims_workspace_t workspace{};
+      ASSERT_TRUE(workspace.is_active());
+      {
+        cugraph::scoped_prims_workspace_t nested_workspace{};
+        ASSERT_FALSE(nested_workspace.is_active());  // the outermost workspace is used
+      }
+      std::tie(h_workspace_bfs_distances, h_workspace_sssp_distances) = run_queries();
+      ASSERT_GT(workspace.get_pool_size(), size_t{0});
+    }
+
+    rmm::mr::set_current_device_resource(old_mr);
+
+    ASSERT_TRUE(std::equal(
+      h_bfs_distances.begin(), h_bfs_distances.end(), h_workspace_bfs_distances.begin()))
+      << "BFS distances differ with the prims workspace.";
+
+    auto threshold_ratio = weight_t{1e-4};
+    ASSERT_TRUE(std::equal(h_sssp_distances.begin(),
+                           h_sssp_distances.end(),
+                           h_workspace_sssp_distances.begin(),
+                           [threshold_ratio](auto lhs, auto rhs) {
+                             return lhs == rhs ||
+                                    std::abs(lhs - rhs) <= std::abs(lhs) * threshold_ratio;
+                           }))
+      << "SSSP distances differ with the prims workspace.";
+  }
+};
+
+using Tests_PrimsWorkspace_File = Tests_PrimsWorkspace<cugraph::test::File_Usecase>;
+using Tests_PrimsWorkspace_Rmat = Tests_PrimsWorkspace<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_PrimsWorkspace_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_PrimsWorkspace_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_PrimsWorkspace_File,
+  ::testing::Combine(::testing::Values(PrimsWorkspace_Usecase{0}, PrimsWorkspace_Usecase{5}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_PrimsWorkspace_Rmat,
+  ::testing::Combine(
+    ::testing::Values(PrimsWorkspace_Usecase{0}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+struct SSSP_Batch_Usecase {
+  size_t n_sources{8};
+  size_t n_targets{0};  // 0 to compute the distances to every vertex
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_SSSP_Batch
+  : public ::testing::TestWithParam<std::tuple<SSSP_Batch_Usecase, input_usecase_t>> {
+ public:
+  Tests_SSSP_Batch() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SSSP_Batch_Usecase const& sssp_batch_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, renumber);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = static_cast<size_t>(graph_view.get_number_of_vertices());
+
+    auto n_sources = std::min(sssp_batch_usecase.n_sources, num_vertices);
+    std::vector<vertex_t> h_sources(n_sources);
+    std::iota(h_sources.begin(), h_sources.end(), vertex_t{0});
+    rmm::device_uvector<vertex_t> d_sources(n_sources, handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+
+    // the targets are spread over the vertex ID range
+    auto n_targets = std::min(sssp_batch_usecase.n_targets, num_vertices);
+    std::vector<vertex_t> h_targets(n_targets);
+    for (size_t i = 0; i < n_targets; ++i) {
+      h_targets[i] = static_cast<vertex_t>((num_vertices - 1) - i * (num_vertices / n_targets));
+    }
+    rmm::device_uvector<vertex_t> d_targets(n_targets, handle.get_stream());
+    raft::update_device(d_targets.data(), h_targets.data(), h_targets.size(), handle.get_stream());
+
+    rmm::device_uvector<weight_t> d_distances(n_sources * num_vertices, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_predecessors(n_sources * num_vertices, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::sssp_batch(handle,
+                        graph_view,
+                        d_distances.data(),
+                        d_predecessors.data(),
+                        d_sources.data(),
+                        n_sources,
+                        n_targets > 0 ? d_targets.data() : static_cast<vertex_t const*>(nullptr),
+                        n_targets);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "SSSP batch (" << n_sources << " sources, " << n_targets << " targets) took "
+                << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (sssp_batch_usecase.check_correctness) {
+      std::vector<weight_t> h_cugraph_distances(d_distances.size());
+      std::vector<vertex_t> h_cugraph_predecessors(d_predecessors.size());
+      raft::update_host(
+        h_cugraph_distances.data(), d_distances.data(), d_distances.size(), handle.get_stream());
+      raft::update_host(h_cugraph_predecessors.data(),
+                        d_predecessors.data(),
+                        d_predecessors.size(),
+                        handle.get_stream());
+
+      rmm::device_uvector<weight_t> d_reference_distances(num_vertices, handle.get_stream());
+      std::vector<weight_t> h_reference_distances(num_vertices);
+      for (size_t i = 0; i < n_sources; ++i) {
+        cugraph::sssp(handle,
+                      graph_view,
+                      d_reference_distances.data(),
+                      static_cast<vertex_t*>(nullptr),
+                      h_sources[i]);
+        raft::update_host(h_reference_distances.data(),
+                          d_reference_distances.data(),
+                          d_reference_distances.size(),
+                          handle.get_stream());
+        handle.get_stream_view().synchronize();
+
+        auto first        = h_cugraph_distances.begin() + i * num_vertices;
+        auto nearly_equal = [](auto lhs, auto rhs) {
+          return (lhs == rhs) ||
+                 (std::fabs(lhs - rhs) <= std::max(std::fabs(lhs), std::fabs(rhs)) * 1e-5);
+        };
+        if (n_targets == 0) {
+          ASSERT_TRUE(std::equal(
+            h_reference_distances.begin(), h_reference_distances.end(), first, nearly_equal))
+            << "distances from source " << h_sources[i]
+            << " do not match with the reference values.";
+          // a vertex has a predecessor if and only if it is reachable (and is not the source)
+          for (size_t j = 0; j < num_vertices; ++j) {
+            auto reachable = (h_reference_distances[j] != std::numeric_limits<weight_t>::max()) &&
+                             (static_cast<vertex_t>(j) != h_sources[i]);
+            ASSERT_EQ(h_cugraph_predecessors[i * num_vertices + j] !=
+                        cugraph::invalid_vertex_id<vertex_t>::value,
+                      reachable)
+              << "invalid predecessor of vertex " << j << " from source " << h_sources[i] << ".";
+          }
+        } else {
+          for (auto t : h_targets) {
+            ASSERT_TRUE(nearly_equal(h_reference_distances[t], *(first + t)))
+              << "distance from source " << h_sources[i] << " to target " << t
+              << " does not match with the reference value.";
+          }
+        }
+      }
+    }
+  }
+};
+
+using Tests_SSSP_Batch_File = Tests_SSSP_Batch<cugraph::test::File_Usecase>;
+using Tests_SSSP_Batch_Rmat = Tests_SSSP_Batch<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_SSSP_Batch_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SSSP_Batch_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_SSSP_Batch_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_SSSP_Batch_File,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(SSSP_Batch_Usecase{1, 0},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(SSSP_Batch_Usecase{7, 0},
+                    cugraph::test::File_Usecase("test/datasets/dblp.mtx")),
+    std::make_tuple(SSSP_Batch_Usecase{8, 4},
+                    cugraph::test::File_Usecase("test/datasets/dblp.mtx")),
+    std::make_tuple(SSSP_Batch_Usecase{5, 1},
+                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_SSSP_Batch_Rmat,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(SSSP_Batch_Usecase{6, 0},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false)),
+    std::make_tuple(SSSP_Batch_Usecase{9, 3},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_SSSP_Batch_Rmat,
+  ::testing::Values(
+    // disable correctness checks for large graphs
+    std::make_pair(SSSP_Batch_Usecase{16, 0, false},
+                   cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
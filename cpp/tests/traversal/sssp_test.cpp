@@ -337,4 +337,81 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(SSSP_Usecase{0, false},
                     cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
 
+// vertex 4 is first inserted to the far bucket (by the heavy edge from the source) and then relaxed
+// into a delta bucket (by the light path 0 -> 1 -> 2 -> 3 -> 4) and settled, its stale far bucket
+// entry should be dropped once the far bucket is split. The light edges among vertices 5-20 (not
+// reachable from the source) set delta (~1.17) so the heavy edge weight is beyond the last delta
+// bucket.
+TEST(sssp_far_bucket, stale_entry)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  raft::handle_t handle{};
+
+  vertex_t constexpr num_vertices{21};
+  std::vector<vertex_t> h_srcs{0, 0, 1, 2, 3};
+  std::vector<vertex_t> h_dsts{4, 1, 2, 3, 4};
+  std::vector<weight_t> h_weights{100.0, 1.0, 1.0, 1.0, 1.0};
+  for (vertex_t i = 5; i < num_vertices; ++i) {
+    for (vertex_t j = 5; j < num_vertices; ++j) {
+      if (i != j) {
+        h_srcs.push_back(i);
+        h_dsts.push_back(j);
+        h_weights.push_back(0.001);
+      }
+    }
+  }
+
+  rmm::device_uvector<vertex_t> d_vertices(num_vertices, handle.get_stream());
+  cugraph::test::populate_vertex_ids(handle, d_vertices, vertex_t{0});
+  auto d_srcs    = cugraph::test::to_device(handle, h_srcs);
+  auto d_dsts    = cugraph::test::to_device(handle, h_dsts);
+  auto d_weights = std::make_optional(cugraph::test::to_device(handle, h_weights));
+
+  cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+      handle,
+      std::make_optional(std::move(d_vertices)),
+      std::move(d_srcs),
+      std::move(d_dsts),
+      std::move(d_weights),
+      cugraph::graph_properties_t{false, false},
+      false);
+  auto graph_view = graph.view();
+
+  rmm::device_uvector<weight_t> d_distances(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_predecessors(num_vertices, handle.get_stream());
+  cugraph::sssp(handle,
+                graph_view,
+                d_distances.data(),
+                d_predecessors.data(),
+                vertex_t{0},
+                std::numeric_limits<weight_t>::max(),
+                false);
+
+  auto h_distances = cugraph::test::to_host(handle, d_distances.data(), d_distances.size());
+  auto h_predecessors =
+    cugraph::test::to_host(handle, d_predecessors.data(), d_predecessors.size());
+
+  std::vector<weight_t> h_reference_distances(num_vertices, std::numeric_limits<weight_t>::max());
+  std::vector<vertex_t> h_reference_predecessors(num_vertices,
+                                                 cugraph::invalid_vertex_id<vertex_t>::value);
+  for (vertex_t i = 0; i < 5; ++i) {
+    h_reference_distances[i] = static_cast<weight_t>(i);
+    if (i > 0) { h_reference_predecessors[i] = i - 1; }
+  }
+
+  ASSERT_TRUE(std::equal(h_reference_distances.begin(),
+                         h_reference_distances.end(),
+                         h_distances.begin(),
+                         [](auto lhs, auto rhs) { return std::fabs(lhs - rhs) < 1e-4; }))
+    << "distances do not match with the reference values.";
+  ASSERT_TRUE(std::equal(
+    h_reference_predecessors.begin(), h_reference_predecessors.end(), h_predecessors.begin()))
+    << "predecessors do not match with the reference values.";
+}
+
 CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/decompress_matrix_partition.cuh>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/matrix_partition_device_view.cuh>
+#include <cugraph/prims/edge_properties.cuh>
+#include <cugraph/prims/temporal_edge_properties.cuh>
+
+#include <cuco/detail/hash_functions.cuh>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/transform.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <vector>
+
+template <typename vertex_t>
+struct edge_time_t {
+  int64_t max_time{};
+
+  __host__ __device__ int64_t operator()(vertex_t row, vertex_t col) const
+  {
+    cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
+    return static_cast<int64_t>((hash_func(row) ^ (hash_func(col) * 31)) % max_time);
+  }
+};
+
+struct TemporalTraversal_Usecase {
+  size_t source{0};
+  int64_t max_time{100};
+  int64_t window_first{20};
+  int64_t window_last{80};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_TemporalTraversal
+  : public ::testing::TestWithParam<std::tuple<TemporalTraversal_Usecase, input_usecase_t>> {
+ public:
+  Tests_TemporalTraversal() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // the windowed BFS distances and the earliest arrival times should match the reference values
+  // computed on the host (by filtering every edge)
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(TemporalTraversal_Usecase const& temporal_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = graph_view.get_number_of_vertices();
+    auto const num_edges    = graph_view.get_number_of_edges();
+    ASSERT_TRUE(static_cast<vertex_t>(temporal_usecase.source) >= 0 &&
+                static_cast<vertex_t>(temporal_usecase.source) < num_vertices)
+      << "Invalid starting source.";
+    auto source = static_cast<vertex_t>(temporal_usecase.source);
+
+    // 1. assign time stamps to the edges
+
+    auto matrix_partition =
+      cugraph::matrix_partition_device_view_t<vertex_t, edge_t, weight_t, false>(
+        graph_view.get_matrix_partition_view());
+    rmm::device_uvector<vertex_t> d_majors(num_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_minors(num_edges, handle.get_stream());
+    cugraph::detail::decompress_matrix_partition_to_edgelist(
+      handle,
+      matrix_partition,
+      d_majors.data(),
+      d_minors.data(),
+      std::optional<weight_t*>{std::nullopt},
+      graph_view.get_local_adj_matrix_partition_segment_offsets(0));
+    rmm::device_uvector<int64_t> d_times(num_edges, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      d_majors.begin(),
+                      d_majors.end(),
+                      d_minors.begin(),
+                      d_times.begin(),
+                      edge_time_t<vertex_t>{temporal_usecase.max_time});
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::edge_properties_t<decltype(graph_view), int64_t> edge_times(handle, graph_view);
+    cugraph::copy_edge_properties_from_edgelist(handle,
+                                                graph_view,
+                                                d_majors.data(),
+                                                d_minors.data(),
+                                                d_times.begin(),
+                                                d_majors.size(),
+                                                edge_times);
+    cugraph::temporal_edge_properties_t<decltype(graph_view), int64_t> temporal_edge_times(
+      handle, graph_view, std::move(edge_times));
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "temporal_edge_properties_t construction took " << elapsed_time * 1e-6
+                << " s.\n";
+    }
+
+    // 2. run the temporal traversals
+
+    rmm::device_uvector<vertex_t> d_distances(num_vertices, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_bfs_predecessors(num_vertices, handle.get_stream());
+    rmm::device_uvector<int64_t> d_arrival_times(num_vertices, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_arrival_predecessors(num_vertices, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    cugraph::temporal_bfs(handle,
+                          graph_view,
+                          temporal_edge_times,
+                          d_distances.data(),
+                          d_bfs_predecessors.data(),
+                          source,
+                          temporal_usecase.window_first,
+                          temporal_usecase.window_last);
+    cugraph::earliest_arrival_paths(handle,
+                                    graph_view,
+                                    temporal_edge_times,
+                                    d_arrival_times.data(),
+                                    d_arrival_predecessors.data(),
+                                    source,
+                                    temporal_usecase.window_first,
+                                    temporal_usecase.window_last);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "temporal_bfs & earliest_arrival_paths took " << elapsed_time * 1e-6
+                << " s.\n";
+    }
+
+    if (temporal_usecase.check_correctness) {
+      auto h_majors = cugraph::test::to_host(handle, d_majors.data(), d_majors.size());
+      auto h_minors = cugraph::test::to_host(handle, d_minors.data(), d_minors.size());
+      auto h_times  = cugraph::test::to_host(handle, d_times.data(), d_times.size());
+
+      auto in_window = [&temporal_usecase](int64_t t) {
+        return t >= temporal_usecase.window_first && t < temporal_usecase.window_last;
+      };
+
+      // windowed BFS reference
+
+      std::vector<std::vector<vertex_t>> h_nbrs(num_vertices);
+      for (size_t i = 0; i < h_majors.size(); ++i) {
+        if (in_window(h_times[i])) { h_nbrs[h_majors[i]].push_back(h_minors[i]); }
+      }
+      std::vector<vertex_t> h_reference_distances(num_vertices,
+                                                  std::numeric_limits<vertex_t>::max());
+      std::queue<vertex_t> queue{};
+      h_reference_distances[source] = vertex_t{0};
+      queue.push(source);
+      while (!queue.empty()) {
+        auto v = queue.front();
+        queue.pop();
+        for (auto nbr : h_nbrs[v]) {
+          if (h_reference_distances[nbr] == std::numeric_limits<vertex_t>::max()) {
+            h_reference_distances[nbr] = h_reference_distances[v] + 1;
+            queue.push(nbr);
+          }
+        }
+      }
+
+      auto h_distances = cugraph::test::to_host(handle, d_distances.data(), d_distances.size());
+      auto h_bfs_predecessors =
+        cugraph::test::to_host(handle, d_bfs_predecessors.data(), d_bfs_predecessors.size());
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        ASSERT_EQ(h_distances[v], h_reference_distances[v])
+          << "temporal BFS distances do not match with the reference values.";
+        if ((v != source) && (h_distances[v] != std::numeric_limits<vertex_t>::max())) {
+          auto pred = h_bfs_predecessors[v];
+          ASSERT_EQ(h_reference_distances[pred] + 1, h_reference_distances[v])
+            << "temporal BFS predecessor is not one hop closer to the source.";
+          ASSERT_TRUE(std::find(h_nbrs[pred].begin(), h_nbrs[pred].end(), v) !=
+                      h_nbrs[pred].end())
+            << "temporal BFS predecessor is not connected with an edge in the window.";
+        }
+      }
+
+      // earliest arrival reference (relax every edge until no arrival time improves)
+
+      std::vector<int64_t> h_reference_arrival_times(num_vertices,
+                                                     std::numeric_limits<int64_t>::max());
+      h_reference_arrival_times[source] = temporal_usecase.window_first;
+      bool improved{true};
+      while (improved) {
+        improved = false;
+        for (size_t i = 0; i < h_majors.size(); ++i) {
+          auto t = h_times[i];
+          if (t < h_reference_arrival_times[h_majors[i]] || t >= temporal_usecase.window_last) {
+            continue;
+          }
+          if (t < h_reference_arrival_times[h_minors[i]]) {
+            h_reference_arrival_times[h_minors[i]] = t;
+            improved                               = true;
+          }
+        }
+      }
+
+      auto h_arrival_times =
+        cugraph::test::to_host(handle, d_arrival_times.data(), d_arrival_times.size());
+      auto h_arrival_predecessors = cugraph::test::to_host(
+        handle, d_arrival_predecessors.data(), d_arrival_predecessors.size());
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        ASSERT_EQ(h_arrival_times[v], h_reference_arrival_times[v])
+          << "earliest arrival times do not match with the reference values.";
+        if (h_arrival_predecessors[v] != cugraph::invalid_vertex_id<vertex_t>::value) {
+          auto pred = h_arrival_predecessors[v];
+          bool found{false};
+          for (size_t i = 0; i < h_majors.size(); ++i) {
+            found = found || ((h_majors[i] == pred) && (h_minors[i] == v) &&
+                              (h_times[i] == h_arrival_times[v]));
+          }
+          ASSERT_TRUE(found && (h_arrival_times[pred] <= h_arrival_times[v]))
+            << "earliest arrival predecessor does not reach the vertex at its arrival time.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_TemporalTraversal_File = Tests_TemporalTraversal<cugraph::test::File_Usecase>;
+using Tests_TemporalTraversal_Rmat = Tests_TemporalTraversal<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_TemporalTraversal_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_TemporalTraversal_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_TemporalTraversal_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_TemporalTraversal_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(TemporalTraversal_Usecase{0, 100, 20, 80},
+                      TemporalTraversal_Usecase{0, 100, 0, 100},
+                      TemporalTraversal_Usecase{0, 100, 50, 50}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_TemporalTraversal_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(TemporalTraversal_Usecase{0, 1000, 100, 900}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_large_test,
+  Tests_TemporalTraversal_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(TemporalTraversal_Usecase{0, 1000, 100, 900, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+// computes the Kahn levels (invalid_vertex_id<vertex_t>::value for the vertices not in any level)
+template <typename vertex_t, typename edge_t>
+std::vector<vertex_t> topological_levels_reference(edge_t const* offsets,
+                                                   vertex_t const* indices,
+                                                   vertex_t num_vertices)
+{
+  std::vector<edge_t> in_degrees(num_vertices, edge_t{0});
+  for (edge_t i = 0; i < offsets[num_vertices]; ++i) {
+    ++in_degrees[indices[i]];
+  }
+  std::vector<vertex_t> levels(num_vertices, cugraph::invalid_vertex_id<vertex_t>::value);
+  std::queue<vertex_t> queue{};
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    if (in_degrees[v] == edge_t{0}) {
+      levels[v] = vertex_t{0};
+      queue.push(v);
+    }
+  }
+  while (!queue.empty()) {
+    auto v = queue.front();
+    queue.pop();
+    for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+      auto nbr = indices[i];
+      if (--in_degrees[nbr] == edge_t{0}) {
+        levels[nbr] = levels[v] + 1;
+        queue.push(nbr);
+      }
+    }
+  }
+  return levels;
+}
+
+// computes the shortest (or longest) path distances in a DAG whose edges go from smaller to larger
+// vertex IDs (so the vertex IDs are a topological order)
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<weight_t> dag_paths_reference(edge_t const* offsets,
+                                          vertex_t const* indices,
+                                          weight_t const* weights,
+                                          vertex_t num_vertices,
+                                          vertex_t source,
+                                          bool longest)
+{
+  auto constexpr unreached = std::numeric_limits<weight_t>::max();
+  std::vector<weight_t> distances(num_vertices, unreached);
+  distances[source] = weight_t{0.0};
+  for (vertex_t v = source; v < num_vertices; ++v) {
+    if (distances[v] == unreached) { continue; }
+    for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+      auto nbr          = indices[i];
+      auto new_distance = distances[v] + weights[i];
+      if ((distances[nbr] == unreached) ||
+          (longest ? (new_distance > distances[nbr]) : (new_distance < distances[nbr]))) {
+        distances[nbr] = new_distance;
+      }
+    }
+  }
+  return distances;
+}
+
+struct TopologicalSort_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_TopologicalSort
+  : public ::testing::TestWithParam<std::tuple<TopologicalSort_Usecase, input_usecase_t>> {
+ public:
+  Tests_TopologicalSort() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // orients every edge of the input graph from the smaller to the larger vertex ID (and negates
+  // every third edge weight) to build a DAG, the levels and the DAG path distances should match the
+  // reference values, and the input graph (symmetric) should be reported to have a cycle
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(TopologicalSort_Usecase const& topological_sort_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+    auto graph_view = graph.view();
+
+    auto const num_vertices = graph_view.get_number_of_vertices();
+
+    auto [d_srcs, d_dsts, d_weights] = graph.decompress_to_edgelist(handle, std::nullopt, false);
+    auto h_srcs    = cugraph::test::to_host(handle, d_srcs.data(), d_srcs.size());
+    auto h_dsts    = cugraph::test::to_host(handle, d_dsts.data(), d_dsts.size());
+    auto h_weights = cugraph::test::to_host(handle, (*d_weights).data(), (*d_weights).size());
+
+    std::vector<vertex_t> h_dag_srcs{};
+    std::vector<vertex_t> h_dag_dsts{};
+    std::vector<weight_t> h_dag_weights{};
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      if (h_srcs[i] < h_dsts[i]) {
+        h_dag_srcs.push_back(h_srcs[i]);
+        h_dag_dsts.push_back(h_dsts[i]);
+        h_dag_weights.push_back(i % 3 == 0 ? -h_weights[i] : h_weights[i]);
+      }
+    }
+
+    rmm::device_uvector<vertex_t> d_vertices(num_vertices, handle.get_stream());
+    cugraph::detail::sequence_fill(
+      handle.get_stream_view(), d_vertices.data(), d_vertices.size(), vertex_t{0});
+    rmm::device_uvector<vertex_t> d_dag_srcs(h_dag_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dag_dsts(h_dag_dsts.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> d_dag_weights(h_dag_weights.size(), handle.get_stream());
+    raft::update_device(
+      d_dag_srcs.data(), h_dag_srcs.data(), h_dag_srcs.size(), handle.get_stream());
+    raft::update_device(
+      d_dag_dsts.data(), h_dag_dsts.data(), h_dag_dsts.size(), handle.get_stream());
+    raft::update_device(
+      d_dag_weights.data(), h_dag_weights.data(), h_dag_weights.size(), handle.get_stream());
+
+    cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> dag(handle);
+    std::tie(dag, std::ignore) =
+      cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+        handle,
+        std::optional<rmm::device_uvector<vertex_t>>{std::move(d_vertices)},
+        std::move(d_dag_srcs),
+        std::move(d_dag_dsts),
+        std::optional<rmm::device_uvector<weight_t>>{std::move(d_dag_weights)},
+        cugraph::graph_properties_t{false, false},
+        false);
+    auto dag_view = dag.view();
+
+    rmm::device_uvector<vertex_t> d_levels(num_vertices, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [num_levels, is_acyclic] = cugraph::topological_sort(handle, dag_view, d_levels.data());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "topological_sort took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (topological_sort_usecase.check_correctness) {
+      ASSERT_TRUE(is_acyclic) << "a DAG is reported to have a cycle.";
+
+      std::vector<edge_t> h_offsets(num_vertices + 1);
+      std::vector<vertex_t> h_indices(dag_view.get_number_of_edges());
+      std::vector<weight_t> h_edge_weights(dag_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        dag_view.get_matrix_partition_view().get_offsets(),
+                        num_vertices + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        dag_view.get_matrix_partition_view().get_indices(),
+                        dag_view.get_number_of_edges(),
+                        handle.get_stream());
+      raft::update_host(h_edge_weights.data(),
+                        *(dag_view.get_matrix_partition_view().get_weights()),
+                        dag_view.get_number_of_edges(),
+                        handle.get_stream());
+
+      auto h_levels = cugraph::test::to_host(handle, d_levels.data(), d_levels.size());
+      auto h_reference_levels =
+        topological_levels_reference(h_offsets.data(), h_indices.data(), num_vertices);
+      ASSERT_TRUE(std::equal(h_levels.begin(), h_levels.end(), h_reference_levels.begin()))
+        << "levels do not match with the reference values.";
+      ASSERT_EQ(num_levels,
+                num_vertices > 0
+                  ? *std::max_element(h_reference_levels.begin(), h_reference_levels.end()) + 1
+                  : vertex_t{0});
+
+      if (graph_view.get_number_of_edges() > 0) {
+        ASSERT_FALSE(std::get<1>(cugraph::topological_sort(handle, graph_view, d_levels.data())))
+          << "a cycle is not detected.";
+      }
+
+      rmm::device_uvector<weight_t> d_distances(num_vertices, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_predecessors(num_vertices, handle.get_stream());
+      for (auto longest : {false, true}) {
+        vertex_t source{0};
+        cugraph::dag_shortest_paths(
+          handle, dag_view, d_distances.data(), d_predecessors.data(), source, longest);
+
+        auto h_distances = cugraph::test::to_host(handle, d_distances.data(), d_distances.size());
+        auto h_predecessors =
+          cugraph::test::to_host(handle, d_predecessors.data(), d_predecessors.size());
+        auto h_reference_distances = dag_paths_reference(h_offsets.data(),
+                                                         h_indices.data(),
+                                                         h_edge_weights.data(),
+                                                         num_vertices,
+                                                         source,
+                                                         longest);
+
+        auto threshold_magnitude = weight_t{1e-4} * static_cast<weight_t>(num_vertices);
+        for (vertex_t v = 0; v < num_vertices; ++v) {
+          ASSERT_TRUE(h_distances[v] == h_reference_distances[v] ||
+                      std::abs(h_distances[v] - h_reference_distances[v]) <= threshold_magnitude)
+            << "distances do not match with the reference values.";
+          if (h_reference_distances[v] == std::numeric_limits<weight_t>::max() || v == source) {
+            ASSERT_EQ(h_predecessors[v], cugraph::invalid_vertex_id<vertex_t>::value);
+          } else {
+            auto pred = h_predecessors[v];
+            ASSERT_TRUE(pred >= 0 && pred < v) << "invalid predecessor.";
+            auto it = std::find(h_indices.begin() + h_offsets[pred],
+                                h_indices.begin() + h_offsets[pred + 1],
+                                v);
+            ASSERT_TRUE(it != h_indices.begin() + h_offsets[pred + 1])
+              << "the predecessor is not an in-neighbor.";
+          }
+        }
+      }
+    }
+  }
+};
+
+using Tests_TopologicalSort_File = Tests_TopologicalSort<cugraph::test::File_Usecase>;
+using Tests_TopologicalSort_Rmat = Tests_TopologicalSort<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_TopologicalSort_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_TopologicalSort_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_TopologicalSort_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_TopologicalSort_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(TopologicalSort_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_TopologicalSort_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(TopologicalSort_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_large_test,
+  Tests_TopologicalSort_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(TopologicalSort_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
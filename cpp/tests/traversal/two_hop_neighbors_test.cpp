@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+// self-loops are ignored; returns the deduplicated (start vertex, 2-hop neighbor) pairs in the
+// cugraph::get_two_hop_neighbors_batched output order.
+template <typename vertex_t, typename edge_t>
+std::vector<std::tuple<vertex_t, vertex_t>> two_hop_neighbors_reference(
+  edge_t const* offsets, vertex_t const* indices, std::vector<vertex_t> const& start_vertices)
+{
+  std::vector<std::tuple<vertex_t, vertex_t>> pairs{};
+  for (auto u : start_vertices) {
+    std::vector<vertex_t> nbrs{};
+    for (auto i = offsets[u]; i < offsets[u + 1]; ++i) {
+      auto w = indices[i];
+      if (w == u) { continue; }
+      for (auto j = offsets[w]; j < offsets[w + 1]; ++j) {
+        auto v = indices[j];
+        if ((v != w) && (v != u)) { nbrs.push_back(v); }
+      }
+    }
+    std::sort(nbrs.begin(), nbrs.end());
+    nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+    for (auto v : nbrs) {
+      pairs.push_back(std::make_tuple(u, v));
+    }
+  }
+
+  return pairs;
+}
+
+struct TwoHopNeighbors_Usecase {
+  size_t batch_memory_budget{std::numeric_limits<size_t>::max()};
+  size_t start_vertex_stride{1};  // every start_vertex_stride'th vertex is a start vertex
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_TwoHopNeighbors
+  : public ::testing::TestWithParam<std::tuple<TwoHopNeighbors_Usecase, input_usecase_t>> {
+ public:
+  Tests_TwoHopNeighbors() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(TwoHopNeighbors_Usecase const& two_hop_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+    auto graph_view = graph.view();
+
+    std::vector<vertex_t> h_start_vertices{};
+    for (vertex_t v = 0; v < graph_view.get_number_of_vertices();
+         v += static_cast<vertex_t>(two_hop_usecase.start_vertex_stride)) {
+      h_start_vertices.push_back(v);
+    }
+    rmm::device_uvector<vertex_t> d_start_vertices(h_start_vertices.size(), handle.get_stream());
+    raft::update_device(d_start_vertices.data(),
+                        h_start_vertices.data(),
+                        h_start_vertices.size(),
+                        handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    size_t num_batches{0};
+    cugraph::get_two_hop_neighbors_batched(
+      handle,
+      graph_view,
+      d_start_vertices.data(),
+      d_start_vertices.size(),
+      two_hop_usecase.batch_memory_budget,
+      [&handle, &h_srcs, &h_dsts, &num_batches, &two_hop_usecase](
+        rmm::device_uvector<vertex_t>&& srcs, rmm::device_uvector<vertex_t>&& dsts) {
+        ++num_batches;
+        if (two_hop_usecase.check_correctness) {
+          auto old_size = h_srcs.size();
+          h_srcs.resize(old_size + srcs.size());
+          h_dsts.resize(old_size + dsts.size());
+          raft::update_host(
+            h_srcs.data() + old_size, srcs.data(), srcs.size(), handle.get_stream());
+          raft::update_host(
+            h_dsts.data() + old_size, dsts.data(), dsts.size(), handle.get_stream());
+          handle.get_stream_view().synchronize();
+        }
+      });
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "get_two_hop_neighbors_batched (" << num_batches << " batches) took "
+                << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (two_hop_usecase.check_correctness) {
+      std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        graph_view.get_number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      auto h_reference_pairs =
+        two_hop_neighbors_reference(h_offsets.data(), h_indices.data(), h_start_vertices);
+
+      std::vector<std::tuple<vertex_t, vertex_t>> h_cugraph_pairs(h_srcs.size());
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        h_cugraph_pairs[i] = std::make_tuple(h_srcs[i], h_dsts[i]);
+      }
+
+      ASSERT_EQ(h_reference_pairs.size(), h_cugraph_pairs.size())
+        << "the number of 2-hop neighbor pairs does not match with the reference value.";
+      ASSERT_TRUE(
+        std::equal(h_reference_pairs.begin(), h_reference_pairs.end(), h_cugraph_pairs.begin()))
+        << "2-hop neighbor pairs do not match with the reference values (or are not in order).";
+    }
+  }
+};
+
+using Tests_TwoHopNeighbors_File = Tests_TwoHopNeighbors<cugraph::test::File_Usecase>;
+using Tests_TwoHopNeighbors_Rmat = Tests_TwoHopNeighbors<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_TwoHopNeighbors_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_TwoHopNeighbors_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_TwoHopNeighbors_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_TwoHopNeighbors_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_TwoHopNeighbors_File,
+  ::testing::Combine(
+    // enable correctness checks (1 KB budget to enumerate in many batches)
+    testing::Values(TwoHopNeighbors_Usecase{}, TwoHopNeighbors_Usecase{1024}),
+    testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_TwoHopNeighbors_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    testing::Values(TwoHopNeighbors_Usecase{}, TwoHopNeighbors_Usecase{1 << 16, 3}),
+    testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false),
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_TwoHopNeighbors_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    testing::Values(TwoHopNeighbors_Usecase{size_t{1} << 30, 1024, false}),
+    testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+struct MinimumSpanningForest_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGMinimumSpanningForest
+  : public ::testing::TestWithParam<std::tuple<MinimumSpanningForest_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGMinimumSpanningForest() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of running minimum spanning forest on multiple GPUs to that of a
+  // single-GPU run (the forests can differ with ties in edge weights as the tie breaking depends on
+  // the renumbered vertex IDs, so the numbers of edges and the total weights are compared)
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MinimumSpanningForest_Usecase const& msf_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) {
+      --row_comm_size;
+    }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        handle, input_usecase, true, true);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run MG minimum spanning forest
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [d_mg_forest_srcs, d_mg_forest_dsts, d_mg_forest_weights] =
+      cugraph::minimum_spanning_forest(handle, mg_graph_view);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle.get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG minimum_spanning_forest took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. compare SG & MG results
+
+    if (msf_usecase.check_correctness) {
+      // 4-1. aggregate MG results
+
+      auto d_mg_aggregate_forest_weights = cugraph::test::device_gatherv(
+        handle, d_mg_forest_weights.data(), d_mg_forest_weights.size());
+
+      if (handle.get_comms().get_rank() == int{0}) {
+        // 4-2. create SG graph
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, true, false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_TRUE(mg_graph_view.get_number_of_vertices() ==
+                    sg_graph_view.get_number_of_vertices());
+
+        // 4-3. run SG minimum spanning forest
+
+        auto [d_sg_forest_srcs, d_sg_forest_dsts, d_sg_forest_weights] =
+          cugraph::minimum_spanning_forest(handle, sg_graph_view);
+
+        // 4-4. compare
+
+        std::vector<weight_t> h_mg_aggregate_forest_weights(d_mg_aggregate_forest_weights.size());
+        raft::update_host(h_mg_aggregate_forest_weights.data(),
+                          d_mg_aggregate_forest_weights.data(),
+                          d_mg_aggregate_forest_weights.size(),
+                          handle.get_stream());
+
+        std::vector<weight_t> h_sg_forest_weights(d_sg_forest_weights.size());
+        raft::update_host(h_sg_forest_weights.data(),
+                          d_sg_forest_weights.data(),
+                          d_sg_forest_weights.size(),
+                          handle.get_stream());
+
+        handle.get_stream_view().synchronize();
+
+        ASSERT_EQ(h_mg_aggregate_forest_weights.size(), h_sg_forest_weights.size())
+          << "the number of forest edges does not match with the SG value.";
+
+        std::sort(h_mg_aggregate_forest_weights.begin(), h_mg_aggregate_forest_weights.end());
+        std::sort(h_sg_forest_weights.begin(), h_sg_forest_weights.end());
+        auto mg_total_weight = std::accumulate(
+          h_mg_aggregate_forest_weights.begin(), h_mg_aggregate_forest_weights.end(), double{0.0});
+        auto sg_total_weight =
+          std::accumulate(h_sg_forest_weights.begin(), h_sg_forest_weights.end(), double{0.0});
+
+        auto threshold_ratio     = 1e-4;
+        auto threshold_magnitude = 1e-6;
+        ASSERT_TRUE(std::abs(mg_total_weight - sg_total_weight) <
+                    std::max(std::max(mg_total_weight, sg_total_weight) * threshold_ratio,
+                             threshold_magnitude))
+          << "the forest weight does not match with the SG value.";
+      }
+    }
+  }
+};
+
+using Tests_MGMinimumSpanningForest_File =
+  Tests_MGMinimumSpanningForest<cugraph::test::File_Usecase>;
+using Tests_MGMinimumSpanningForest_Rmat =
+  Tests_MGMinimumSpanningForest<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGMinimumSpanningForest_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGMinimumSpanningForest_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGMinimumSpanningForest_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGMinimumSpanningForest_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGMinimumSpanningForest_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MinimumSpanningForest_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(rmat_small_test,
+                         Tests_MGMinimumSpanningForest_Rmat,
+                         ::testing::Values(
+                           // enable correctness checks
+                           std::make_tuple(MinimumSpanningForest_Usecase{},
+                                           cugraph::test::Rmat_Usecase(
+                                             10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGMinimumSpanningForest_Rmat,
+  ::testing::Values(
+    // disable correctness checks
+    std::make_tuple(
+      MinimumSpanningForest_Usecase{false},
+      cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
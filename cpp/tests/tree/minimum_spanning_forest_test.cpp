@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+// Kruskal's algorithm, ties in edge weights are broken by the endpoint IDs
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<std::tuple<vertex_t, vertex_t, weight_t>> minimum_spanning_forest_reference(
+  edge_t const* offsets, vertex_t const* indices, weight_t const* weights, vertex_t num_vertices)
+{
+  std::vector<std::tuple<weight_t, vertex_t, vertex_t>> edges{};
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+      if (v < indices[i]) { edges.push_back(std::make_tuple(weights[i], v, indices[i])); }
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+
+  std::vector<vertex_t> parents(num_vertices);
+  std::iota(parents.begin(), parents.end(), vertex_t{0});
+  auto find = [&parents](vertex_t v) {
+    while (parents[v] != v) {
+      parents[v] = parents[parents[v]];
+      v          = parents[v];
+    }
+    return v;
+  };
+
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> forest{};
+  for (auto [w, src, dst] : edges) {
+    auto src_root = find(src);
+    auto dst_root = find(dst);
+    if (src_root != dst_root) {
+      parents[std::max(src_root, dst_root)] = std::min(src_root, dst_root);
+      forest.push_back(std::make_tuple(src, dst, w));
+    }
+  }
+  std::sort(forest.begin(), forest.end());
+
+  return forest;
+}
+
+struct MinimumSpanningForest_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MinimumSpanningForest
+  : public ::testing::TestWithParam<std::tuple<MinimumSpanningForest_Usecase, input_usecase_t>> {
+ public:
+  Tests_MinimumSpanningForest() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MinimumSpanningForest_Usecase const& msf_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+    auto graph_view = graph.view();
+
+    ASSERT_TRUE(graph_view.is_symmetric())
+      << "Minimum spanning forest works only on undirected (symmetric) graphs.";
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [d_forest_srcs, d_forest_dsts, d_forest_weights] =
+      cugraph::minimum_spanning_forest(handle, graph_view);
+
+    if (cugraph::test::g_perf) {
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "minimum_spanning_forest took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (msf_usecase.check_correctness) {
+      auto const num_vertices = graph_view.get_number_of_vertices();
+
+      std::vector<edge_t> h_offsets(num_vertices + 1);
+      std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+      std::vector<weight_t> h_weights(graph_view.get_number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.get_matrix_partition_view().get_offsets(),
+                        num_vertices + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.get_matrix_partition_view().get_indices(),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+      raft::update_host(h_weights.data(),
+                        *(graph_view.get_matrix_partition_view().get_weights()),
+                        graph_view.get_number_of_edges(),
+                        handle.get_stream());
+
+      std::vector<vertex_t> h_forest_srcs(d_forest_srcs.size());
+      std::vector<vertex_t> h_forest_dsts(d_forest_dsts.size());
+      std::vector<weight_t> h_forest_weights(d_forest_weights.size());
+      raft::update_host(
+        h_forest_srcs.data(), d_forest_srcs.data(), d_forest_srcs.size(), handle.get_stream());
+      raft::update_host(
+        h_forest_dsts.data(), d_forest_dsts.data(), d_forest_dsts.size(), handle.get_stream());
+      raft::update_host(h_forest_weights.data(),
+                        d_forest_weights.data(),
+                        d_forest_weights.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      std::vector<std::tuple<vertex_t, vertex_t, weight_t>> h_cugraph_forest(h_forest_srcs.size());
+      for (size_t i = 0; i < h_cugraph_forest.size(); ++i) {
+        h_cugraph_forest[i] =
+          std::make_tuple(h_forest_srcs[i], h_forest_dsts[i], h_forest_weights[i]);
+      }
+      std::sort(h_cugraph_forest.begin(), h_cugraph_forest.end());
+
+      auto h_reference_forest = minimum_spanning_forest_reference(
+        h_offsets.data(), h_indices.data(), h_weights.data(), num_vertices);
+
+      ASSERT_EQ(h_cugraph_forest.size(), h_reference_forest.size())
+        << "the number of forest edges does not match with the reference value.";
+      ASSERT_TRUE(
+        std::equal(h_reference_forest.begin(), h_reference_forest.end(), h_cugraph_forest.begin()))
+        << "forest edges do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_MinimumSpanningForest_File = Tests_MinimumSpanningForest<cugraph::test::File_Usecase>;
+using Tests_MinimumSpanningForest_Rmat = Tests_MinimumSpanningForest<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MinimumSpanningForest_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MinimumSpanningForest_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MinimumSpanningForest_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MinimumSpanningForest_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MinimumSpanningForest_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MinimumSpanningForest_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MinimumSpanningForest_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MinimumSpanningForest_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MinimumSpanningForest_Rmat,
+  ::testing::Combine(
+    // disable correctness checks
+    ::testing::Values(MinimumSpanningForest_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
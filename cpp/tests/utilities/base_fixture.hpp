@@ -18,15 +18,11 @@
 
 #include <cugraph/utilities/error.hpp>
 #include <utilities/cxxopts.hpp>
+#include <utilities/rmm_utilities.hpp>
 #include <utilities/test_graphs.hpp>
 
 #include <rmm/exec_policy.hpp>
-#include <rmm/mr/device/binning_memory_resource.hpp>
-#include <rmm/mr/device/cuda_memory_resource.hpp>
-#include <rmm/mr/device/managed_memory_resource.hpp>
-#include <rmm/mr/device/owning_wrapper.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
-#include <rmm/mr/device/pool_memory_resource.hpp>
 
 #include <gtest/gtest.h>
 
@@ -60,49 +56,6 @@ class BaseFixture : public ::testing::Test {
   rmm::mr::device_memory_resource* mr() { return _mr; }
 };
 
-/// MR factory functions
-inline auto make_cuda() { return std::make_shared<rmm::mr::cuda_memory_resource>(); }
-
-inline auto make_managed() { return std::make_shared<rmm::mr::managed_memory_resource>(); }
-
-inline auto make_pool()
-{
-  return rmm::mr::make_owning_wrapper<rmm::mr::pool_memory_resource>(make_cuda());
-}
-
-inline auto make_binning()
-{
-  auto pool = make_pool();
-  // Add a fixed_size_memory_resource for bins of size 256, 512, 1024, 2048 and 4096KiB
-  // Larger allocations will use the pool resource
-  auto mr = rmm::mr::make_owning_wrapper<rmm::mr::binning_memory_resource>(pool, 18, 22);
-  return mr;
-}
-
-/**
- * @brief Creates a memory resource for the unit test environment given the name of the allocation
- * mode.
- *
- * The returned resource instance must be kept alive for the duration of the tests. Attaching the
- * resource to a TestEnvironment causes issues since the environment objects are not destroyed until
- * after the runtime is shutdown.
- *
- * @throw cugraph::logic_error if the `allocation_mode` is unsupported.
- *
- * @param allocation_mode String identifies which resource type.
- *        Accepted types are "pool", "cuda", and "managed" only.
- * @return Memory resource instance
- */
-inline std::shared_ptr<rmm::mr::device_memory_resource> create_memory_resource(
-  std::string const& allocation_mode)
-{
-  if (allocation_mode == "binning") return make_binning();
-  if (allocation_mode == "cuda") return make_cuda();
-  if (allocation_mode == "pool") return make_pool();
-  if (allocation_mode == "managed") return make_managed();
-  CUGRAPH_FAIL("Invalid RMM allocation mode");
-}
-
 // these variables are updated by command line arguments
 static bool g_perf{false};
 static std::optional<size_t> g_rmat_scale{std::nullopt};
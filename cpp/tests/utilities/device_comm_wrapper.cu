@@ -60,6 +60,10 @@ template rmm::device_uvector<int64_t> device_gatherv(raft::handle_t const& handl
                                                      int64_t const* d_input,
                                                      size_t size);
 
+template rmm::device_uvector<size_t> device_gatherv(raft::handle_t const& handle,
+                                                    size_t const* d_input,
+                                                    size_t size);
+
 template rmm::device_uvector<float> device_gatherv(raft::handle_t const& handle,
                                                    float const* d_input,
                                                    size_t size);
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/high_res_clock.h>
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/detail/graph_utils.cuh>
+#include <cugraph/utilities/collect_comm.cuh>
+
+#include <cuco/detail/hash_functions.cuh>
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reverse.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+template <typename vertex_t>
+struct map_value_t {
+  __device__ vertex_t operator()(vertex_t v) const { return v * 2 + 1; }
+};
+
+template <typename vertex_t>
+struct random_key_t {
+  vertex_t num_vertices{};
+  size_t seed{};
+
+  __device__ vertex_t operator()(size_t i) const
+  {
+    cuco::detail::MurmurHash3_32<size_t> hash_func{};
+    return static_cast<vertex_t>(hash_func(i + seed) % static_cast<uint32_t>(num_vertices));
+  }
+};
+
+struct CollectValues_Usecase {
+  size_t scale{0};  // 2^scale vertices in total
+  size_t num_collect_keys_per_gpu{0};
+  bool sorted_map_keys{true};
+  bool check_correctness{true};
+};
+
+class Tests_MGCollectValues : public ::testing::TestWithParam<CollectValues_Usecase> {
+ public:
+  Tests_MGCollectValues() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare (and time) the hash and binary search strategies of collect_values_for_keys and
+  // collect_values_for_unique_keys
+  template <typename vertex_t>
+  void run_current_test(CollectValues_Usecase const& configuration)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto key_to_gpu_id_op = cugraph::detail::compute_gpu_id_from_vertex_t<vertex_t>{comm_size};
+
+    // 2. create the map (the vertices owned by this GPU) and the keys to collect
+
+    auto num_vertices = static_cast<vertex_t>(size_t{1} << configuration.scale);
+
+    rmm::device_uvector<vertex_t> map_keys(num_vertices, handle.get_stream());
+    map_keys.resize(
+      thrust::distance(map_keys.begin(),
+                       thrust::copy_if(handle.get_thrust_policy(),
+                                       thrust::make_counting_iterator(vertex_t{0}),
+                                       thrust::make_counting_iterator(num_vertices),
+                                       map_keys.begin(),
+                                       [comm_rank, key_to_gpu_id_op] __device__(auto v) {
+                                         return key_to_gpu_id_op(v) == comm_rank;
+                                       })),
+      handle.get_stream());
+    if (!configuration.sorted_map_keys) {
+      thrust::reverse(handle.get_thrust_policy(), map_keys.begin(), map_keys.end());
+    }
+    rmm::device_uvector<vertex_t> map_values(map_keys.size(), handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      map_keys.begin(),
+                      map_keys.end(),
+                      map_values.begin(),
+                      map_value_t<vertex_t>{});
+
+    rmm::device_uvector<vertex_t> collect_keys(configuration.num_collect_keys_per_gpu,
+                                               handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(collect_keys.size()),
+      collect_keys.begin(),
+      random_key_t<vertex_t>{num_vertices,
+                             static_cast<size_t>(comm_rank) * collect_keys.size()});
+    rmm::device_uvector<vertex_t> collect_unique_keys(collect_keys.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 collect_keys.begin(),
+                 collect_keys.end(),
+                 collect_unique_keys.begin());
+    thrust::sort(
+      handle.get_thrust_policy(), collect_unique_keys.begin(), collect_unique_keys.end());
+    collect_unique_keys.resize(thrust::distance(collect_unique_keys.begin(),
+                                                thrust::unique(handle.get_thrust_policy(),
+                                                               collect_unique_keys.begin(),
+                                                               collect_unique_keys.end())),
+                               handle.get_stream());
+
+    // 3. collect the values with every strategy
+
+    std::vector<std::tuple<cugraph::collect_values_policy_t, std::string>> policies{
+      {cugraph::collect_values_policy_t::hash, "hash"},
+      {cugraph::collect_values_policy_t::binary_search, "binary search"},
+      {cugraph::collect_values_policy_t::automatic, "automatic"}};
+
+    for (auto const& [policy, policy_name] : policies) {
+      for (bool unique : {false, true}) {
+        auto& keys = unique ? collect_unique_keys : collect_keys;
+
+        if (cugraph::test::g_perf) {
+          CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+          handle.get_comms().barrier();
+          hr_clock.start();
+        }
+
+        auto values = unique ? cugraph::collect_values_for_unique_keys(comm,
+                                                                        map_keys.begin(),
+                                                                        map_keys.end(),
+                                                                        map_values.begin(),
+                                                                        keys.begin(),
+                                                                        keys.end(),
+                                                                        key_to_gpu_id_op,
+                                                                        handle.get_stream(),
+                                                                        policy)
+                             : cugraph::collect_values_for_keys(comm,
+                                                                map_keys.begin(),
+                                                                map_keys.end(),
+                                                                map_values.begin(),
+                                                                keys.begin(),
+                                                                keys.end(),
+                                                                key_to_gpu_id_op,
+                                                                handle.get_stream(),
+                                                                policy);
+
+        if (cugraph::test::g_perf) {
+          CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+          handle.get_comms().barrier();
+          double elapsed_time{0.0};
+          hr_clock.stop(&elapsed_time);
+          std::cout << (unique ? "collect_values_for_unique_keys" : "collect_values_for_keys")
+                    << " (" << policy_name << ") took " << elapsed_time * 1e-6 << " s.\n";
+        }
+
+        if (configuration.check_correctness) {
+          ASSERT_EQ(values.size(), keys.size());
+          auto pair_first =
+            thrust::make_zip_iterator(thrust::make_tuple(keys.begin(), values.begin()));
+          auto num_mismatches =
+            thrust::count_if(handle.get_thrust_policy(),
+                             pair_first,
+                             pair_first + keys.size(),
+                             [] __device__(auto pair) {
+                               return map_value_t<vertex_t>{}(thrust::get<0>(pair)) !=
+                                      thrust::get<1>(pair);
+                             });
+          ASSERT_EQ(num_mismatches, 0) << "Collected values do not match the map values ("
+                                       << policy_name << ").";
+        }
+      }
+    }
+  }
+};
+
+TEST_P(Tests_MGCollectValues, CheckInt32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t>(param);
+}
+
+TEST_P(Tests_MGCollectValues, CheckInt64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t>(param);
+}
+
+INSTANTIATE_TEST_SUITE_P(small_test,
+                         Tests_MGCollectValues,
+                         ::testing::Values(CollectValues_Usecase{10, 16, true},
+                                           CollectValues_Usecase{10, 4096, true},
+                                           CollectValues_Usecase{10, 16, false},
+                                           CollectValues_Usecase{10, 4096, false}));
+
+INSTANTIATE_TEST_SUITE_P(benchmark_test, /* the few keys vs. the many keys per GPU */
+                         Tests_MGCollectValues,
+                         ::testing::Values(CollectValues_Usecase{24, 1024, true, false},
+                                           CollectValues_Usecase{24, 1 << 22, true, false},
+                                           CollectValues_Usecase{24, 1024, false, false},
+                                           CollectValues_Usecase{24, 1 << 22, false, false}));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+
+#include <cugraph/utilities/host_scalar_comm.cuh>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+class Tests_MGHostScalarComm : public ::testing::Test {
+ public:
+  Tests_MGHostScalarComm() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() { raft::comms::initialize_mpi_comms(&handle_, MPI_COMM_WORLD); }
+  virtual void TearDown() {}
+
+  // the first and the last ranks (so a non-zero root if there is more than one GPU)
+  std::vector<int> roots() const
+  {
+    auto const comm_size = handle_.get_comms().get_size();
+    return comm_size > 1 ? std::vector<int>{0, comm_size - 1} : std::vector<int>{0};
+  }
+
+  raft::handle_t handle_{};
+};
+
+TEST_F(Tests_MGHostScalarComm, Scatter)
+{
+  auto& comm           = handle_.get_comms();
+  auto const comm_size = comm.get_size();
+  auto const comm_rank = comm.get_rank();
+
+  for (auto root : roots()) {
+    // rank i receives inputs[i], the inputs are valid only in root
+    std::vector<int32_t> inputs(comm_size, int32_t{-1});
+    if (comm_rank == root) {
+      for (int i = 0; i < comm_size; ++i) {
+        inputs[i] = i * 10 + root;
+      }
+    }
+    auto output = cugraph::host_scalar_scatter(comm, inputs.data(), root, handle_.get_stream());
+    ASSERT_EQ(output, comm_rank * 10 + root) << "root " << root << ".";
+
+    std::vector<double> double_inputs(comm_size, -1.0);
+    if (comm_rank == root) {
+      for (int i = 0; i < comm_size; ++i) {
+        double_inputs[i] = i + 0.5;
+      }
+    }
+    auto double_output =
+      cugraph::host_scalar_scatter(comm, double_inputs.data(), root, handle_.get_stream());
+    ASSERT_EQ(double_output, comm_rank + 0.5) << "root " << root << ".";
+  }
+}
+
+TEST_F(Tests_MGHostScalarComm, Allgather)
+{
+  auto& comm           = handle_.get_comms();
+  auto const comm_size = comm.get_size();
+  auto const comm_rank = comm.get_rank();
+
+  for (size_t count : {size_t{1}, size_t{3}}) {
+    std::vector<int64_t> inputs(count);
+    for (size_t j = 0; j < count; ++j) {
+      inputs[j] = comm_rank * 100 + static_cast<int64_t>(j);
+    }
+    auto outputs = cugraph::host_allgather(comm, inputs, handle_.get_stream());
+
+    // the concatenation of the inputs in the rank order
+    ASSERT_EQ(outputs.size(), static_cast<size_t>(comm_size) * count);
+    for (int r = 0; r < comm_size; ++r) {
+      for (size_t j = 0; j < count; ++j) {
+        ASSERT_EQ(outputs[r * count + j], r * 100 + static_cast<int64_t>(j))
+          << "rank " << r << ", element " << j << ".";
+      }
+    }
+  }
+
+  auto empty_outputs = cugraph::host_allgather(comm, std::vector<float>{}, handle_.get_stream());
+  ASSERT_TRUE(empty_outputs.empty());
+}
+
+TEST_F(Tests_MGHostScalarComm, Bcast)
+{
+  auto& comm           = handle_.get_comms();
+  auto const comm_rank = comm.get_rank();
+
+  for (auto root : roots()) {
+    std::vector<int32_t> root_values{root, root + 1, root + 2, root + 3};
+
+    // values are broadcast in place, the root's values are left untouched
+    auto values = comm_rank == root ? root_values : std::vector<int32_t>(root_values.size(), -1);
+    cugraph::host_bcast(comm, values.data(), values.size(), root, handle_.get_stream());
+    ASSERT_EQ(values, root_values) << "root " << root << ".";
+
+    std::vector<double> empty_values{};
+    cugraph::host_bcast(
+      comm, empty_values.data(), empty_values.size(), root, handle_.get_stream());
+    ASSERT_TRUE(empty_values.empty());
+  }
+}
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
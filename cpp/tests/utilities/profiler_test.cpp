@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/profiler.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <optional>
+
+TEST(Profiler, DisabledRecordsNothing)
+{
+  auto& profiler = cugraph::profiler_t::get();
+  profiler.enable(false);
+  profiler.reset();
+
+  raft::handle_t handle{};
+  {
+    cugraph::scoped_phase_t phase("phase", handle.get_stream_view());
+    cugraph::profiler_add_counter("counter", 1);
+  }
+
+  ASSERT_TRUE(profiler.get_phase_stats().empty());
+  ASSERT_TRUE(profiler.get_counters().empty());
+}
+
+TEST(Profiler, NvtxOnlyRecordsNothing)
+{
+  auto& profiler = cugraph::profiler_t::get();
+  profiler.enable(false);
+  profiler.enable_nvtx(true);
+  profiler.reset();
+
+  raft::handle_t handle{};
+  {
+    cugraph::scoped_phase_t phase("phase", handle.get_stream_view());
+    cugraph::nvtx_range_t range("range", 3);
+    cugraph::profiler_add_counter("counter", 1);
+  }
+  profiler.enable_nvtx(false);
+
+  ASSERT_TRUE(profiler.get_phase_stats().empty());
+  ASSERT_TRUE(profiler.get_counters().empty());
+}
+
+TEST(Profiler, NestedPhasesAndCounters)
+{
+  auto& profiler = cugraph::profiler_t::get();
+  profiler.enable(true);
+  profiler.reset();
+
+  raft::handle_t handle{};
+  for (int i = 0; i < 3; ++i) {
+    cugraph::scoped_phase_t outer("outer", handle.get_stream_view());
+    cugraph::profiler_add_counter("iterations", 1);
+    {
+      cugraph::scoped_phase_t inner("inner", handle.get_stream_view());
+      cugraph::profiler_add_counter("bytes", 8);
+    }
+  }
+
+  auto phase_stats = profiler.get_phase_stats();
+  auto counters    = profiler.get_counters();
+  profiler.enable(false);
+
+  ASSERT_EQ(phase_stats.size(), size_t{2});
+  ASSERT_EQ(phase_stats["outer"].num_calls, size_t{3});
+  ASSERT_EQ(phase_stats["outer/inner"].num_calls, size_t{3});
+  ASSERT_GE(phase_stats["outer"].total_elapsed_ms, phase_stats["outer/inner"].total_elapsed_ms);
+  ASSERT_EQ(counters["outer/iterations"], int64_t{3});
+  ASSERT_EQ(counters["outer/inner/bytes"], int64_t{24});
+}
+
+TEST(Profiler, AlgorithmPhases)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  auto& profiler = cugraph::profiler_t::get();
+  profiler.enable(true);
+  profiler.reset();
+
+  raft::handle_t handle{};
+  cugraph::test::File_Usecase input_usecase("test/datasets/karate.mtx");
+
+  {
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, true, false);
+    auto graph_view = graph.view();
+
+    rmm::device_uvector<weight_t> d_pageranks(graph_view.get_number_of_vertices(),
+                                              handle.get_stream());
+    cugraph::pagerank<vertex_t, edge_t, weight_t>(handle,
+                                                  graph_view,
+                                                  std::nullopt,
+                                                  std::nullopt,
+                                                  std::nullopt,
+                                                  std::nullopt,
+                                                  d_pageranks.data(),
+                                                  weight_t{0.85},
+                                                  weight_t{1e-6},
+                                                  std::numeric_limits<size_t>::max(),
+                                                  false);
+  }
+
+  {
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+    auto graph_view = graph.view();
+
+    rmm::device_uvector<vertex_t> d_clustering(graph_view.get_number_of_vertices(),
+                                               handle.get_stream());
+    cugraph::louvain(handle, graph_view, d_clustering.data());
+  }
+
+  auto phase_stats = profiler.get_phase_stats();
+  auto counters    = profiler.get_counters();
+  profiler.enable(false);
+
+  ASSERT_EQ(phase_stats["pagerank"].num_calls, size_t{1});
+  ASSERT_GT(counters["pagerank/iterations"], int64_t{0});
+  ASSERT_EQ(phase_stats["louvain"].num_calls, size_t{1});
+  ASSERT_GT(phase_stats["louvain/update_clustering"].num_calls, size_t{0});
+  ASSERT_GT(counters["louvain/update_clustering/local_moving_iterations"], int64_t{0});
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
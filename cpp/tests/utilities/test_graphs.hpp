@@ -107,8 +107,9 @@ class Rmat_Usecase : public detail::TranslateGraph_Usecase {
                uint64_t seed,
                bool undirected,
                bool scramble_vertex_ids,
-               size_t base_vertex_id  = 0,
-               bool multi_gpu_usecase = false)
+               size_t base_vertex_id       = 0,
+               bool multi_gpu_usecase      = false,
+               bool partitioned_generation = false)
     : detail::TranslateGraph_Usecase(base_vertex_id),
       scale_(scale),
       edge_factor_(edge_factor),
@@ -118,7 +119,8 @@ class Rmat_Usecase : public detail::TranslateGraph_Usecase {
       seed_(seed),
       undirected_(undirected),
       scramble_vertex_ids_(scramble_vertex_ids),
-      multi_gpu_usecase_(multi_gpu_usecase)
+      multi_gpu_usecase_(multi_gpu_usecase),
+      partitioned_generation_(partitioned_generation)
   {
   }
 
@@ -191,71 +193,100 @@ class Rmat_Usecase : public detail::TranslateGraph_Usecase {
     auto weights_v = test_weighted
                        ? std::make_optional<rmm::device_uvector<weight_t>>(0, handle.get_stream())
                        : std::nullopt;
-    for (size_t i = 0; i < partition_ids.size(); ++i) {
-      auto id = partition_ids[i];
-
-      rmm::device_uvector<vertex_t> tmp_src_v(0, handle.get_stream());
-      rmm::device_uvector<vertex_t> tmp_dst_v(0, handle.get_stream());
-      std::tie(i == 0 ? src_v : tmp_src_v, i == 0 ? dst_v : tmp_dst_v) =
-        cugraph::generate_rmat_edgelist<vertex_t>(handle,
-                                                  scale_,
-                                                  partition_edge_counts[i],
-                                                  a_,
-                                                  b_,
-                                                  c_,
-                                                  seed_ + id,
-                                                  undirected_ ? true : false);
-
-      std::optional<rmm::device_uvector<weight_t>> tmp_weights_v{std::nullopt};
-      if (weights_v) {
-        if (i == 0) {
-          weights_v->resize(src_v.size(), handle.get_stream());
-        } else {
-          tmp_weights_v = std::make_optional<rmm::device_uvector<weight_t>>(tmp_src_v.size(),
-                                                                            handle.get_stream());
-        }
-
-        cugraph::detail::uniform_random_fill(handle.get_stream_view(),
-                                             i == 0 ? weights_v->data() : tmp_weights_v->data(),
-                                             i == 0 ? weights_v->size() : tmp_weights_v->size(),
-                                             weight_t{0.0},
-                                             weight_t{1.0},
-                                             seed_ + num_partitions + id);
+    // generate the edges directly on the GPUs that own them (no edge shuffle); the aggregate edge
+    // list is the one generated with seed_ on a single GPU, edge weights are not supported as the
+    // two directions of an undirected edge could get different random weights on different GPUs
+    auto partitioned_generation = partitioned_generation_ && multi_gpu_usecase_ && !test_weighted &&
+                                  (detail::TranslateGraph_Usecase::base_vertex_id_ == 0);
+    if (partitioned_generation) {
+      if constexpr (multi_gpu) {
+        std::tie(src_v, dst_v) =
+          cugraph::generate_partitioned_rmat_edgelist<vertex_t>(handle,
+                                                                scale_,
+                                                                number_of_edges,
+                                                                a_,
+                                                                b_,
+                                                                c_,
+                                                                seed_,
+                                                                undirected_,
+                                                                false,
+                                                                undirected_,
+                                                                store_transposed);
+      } else {
+        std::tie(src_v, dst_v) = cugraph::generate_rmat_edgelist<vertex_t>(
+          handle, scale_, number_of_edges, a_, b_, c_, seed_, undirected_);
+        if (undirected_)
+          std::tie(src_v, dst_v, weights_v) =
+            cugraph::symmetrize_edgelist_from_triangular<vertex_t, weight_t>(
+              handle, std::move(src_v), std::move(dst_v), std::move(weights_v), true);
       }
-
-      if (i > 0) {
-        auto start_offset = src_v.size();
-        src_v.resize(start_offset + tmp_src_v.size(), handle.get_stream());
-        dst_v.resize(start_offset + tmp_dst_v.size(), handle.get_stream());
-        raft::copy(
-          src_v.begin() + start_offset, tmp_src_v.begin(), tmp_src_v.size(), handle.get_stream());
-        raft::copy(
-          dst_v.begin() + start_offset, tmp_dst_v.begin(), tmp_dst_v.size(), handle.get_stream());
-
+    } else {
+      for (size_t i = 0; i < partition_ids.size(); ++i) {
+        auto id = partition_ids[i];
+
+        rmm::device_uvector<vertex_t> tmp_src_v(0, handle.get_stream());
+        rmm::device_uvector<vertex_t> tmp_dst_v(0, handle.get_stream());
+        std::tie(i == 0 ? src_v : tmp_src_v, i == 0 ? dst_v : tmp_dst_v) =
+          cugraph::generate_rmat_edgelist<vertex_t>(handle,
+                                                    scale_,
+                                                    partition_edge_counts[i],
+                                                    a_,
+                                                    b_,
+                                                    c_,
+                                                    seed_ + id,
+                                                    undirected_ ? true : false);
+
+        std::optional<rmm::device_uvector<weight_t>> tmp_weights_v{std::nullopt};
         if (weights_v) {
-          weights_v->resize(start_offset + tmp_weights_v->size(), handle.get_stream());
-          raft::copy(weights_v->begin() + start_offset,
-                     tmp_weights_v->begin(),
-                     tmp_weights_v->size(),
-                     handle.get_stream());
+          if (i == 0) {
+            weights_v->resize(src_v.size(), handle.get_stream());
+          } else {
+            tmp_weights_v = std::make_optional<rmm::device_uvector<weight_t>>(tmp_src_v.size(),
+                                                                              handle.get_stream());
+          }
+
+          cugraph::detail::uniform_random_fill(handle.get_stream_view(),
+                                               i == 0 ? weights_v->data() : tmp_weights_v->data(),
+                                               i == 0 ? weights_v->size() : tmp_weights_v->size(),
+                                               weight_t{0.0},
+                                               weight_t{1.0},
+                                               seed_ + num_partitions + id);
+        }
+
+        if (i > 0) {
+          auto start_offset = src_v.size();
+          src_v.resize(start_offset + tmp_src_v.size(), handle.get_stream());
+          dst_v.resize(start_offset + tmp_dst_v.size(), handle.get_stream());
+          raft::copy(
+            src_v.begin() + start_offset, tmp_src_v.begin(), tmp_src_v.size(), handle.get_stream());
+          raft::copy(
+            dst_v.begin() + start_offset, tmp_dst_v.begin(), tmp_dst_v.size(), handle.get_stream());
+
+          if (weights_v) {
+            weights_v->resize(start_offset + tmp_weights_v->size(), handle.get_stream());
+            raft::copy(weights_v->begin() + start_offset,
+                       tmp_weights_v->begin(),
+                       tmp_weights_v->size(),
+                       handle.get_stream());
+          }
         }
       }
-    }
 
-    translate(handle, src_v, dst_v);
+      translate(handle, src_v, dst_v);
 
-    if (undirected_)
-      std::tie(src_v, dst_v, weights_v) =
-        cugraph::symmetrize_edgelist_from_triangular<vertex_t, weight_t>(
-          handle, std::move(src_v), std::move(dst_v), std::move(weights_v));
+      if (undirected_)
+        std::tie(src_v, dst_v, weights_v) =
+          cugraph::symmetrize_edgelist_from_triangular<vertex_t, weight_t>(
+            handle, std::move(src_v), std::move(dst_v), std::move(weights_v));
 
-    if (multi_gpu) {
-      std::tie(store_transposed ? dst_v : src_v, store_transposed ? src_v : dst_v, weights_v) =
-        cugraph::detail::shuffle_edgelist_by_gpu_id(
-          handle,
-          store_transposed ? std::move(dst_v) : std::move(src_v),
-          store_transposed ? std::move(src_v) : std::move(dst_v),
-          std::move(weights_v));
+      if (multi_gpu) {
+        std::tie(store_transposed ? dst_v : src_v, store_transposed ? src_v : dst_v, weights_v) =
+          cugraph::detail::shuffle_edgelist_by_gpu_id(
+            handle,
+            store_transposed ? std::move(dst_v) : std::move(src_v),
+            store_transposed ? std::move(src_v) : std::move(dst_v),
+            std::move(weights_v));
+      }
     }
 
     rmm::device_uvector<vertex_t> vertices_v(0, handle.get_stream());
@@ -298,6 +329,7 @@ class Rmat_Usecase : public detail::TranslateGraph_Usecase {
   bool undirected_{};
   bool scramble_vertex_ids_{};
   bool multi_gpu_usecase_{};
+  bool partitioned_generation_{};
 };
 
 class PathGraph_Usecase {
@@ -356,6 +356,14 @@ std::vector<T> to_host(raft::handle_t const& handle, T const* data, L size)
   return h_data;
 }
 
+template <typename T>
+rmm::device_uvector<T> to_device(raft::handle_t const& handle, std::vector<T> const& h_data)
+{
+  rmm::device_uvector<T> d_data(h_data.size(), handle.get_stream());
+  raft::update_device(d_data.data(), h_data.data(), h_data.size(), handle.get_stream());
+  return d_data;
+}
+
 template <typename T, typename L>
 std::vector<T> random_vector(L size, unsigned seed = 0)
 {
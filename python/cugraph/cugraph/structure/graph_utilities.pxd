@@ -17,7 +17,7 @@
 # cython: language_level = 3
 
 from libcpp cimport bool
-from libcpp.memory cimport unique_ptr
+from libcpp.memory cimport shared_ptr, unique_ptr
 from libcpp.utility cimport pair
 from libcpp.vector cimport vector
 
@@ -58,6 +58,13 @@ cdef extern from "cugraph/utilities/cython.hpp" namespace "cugraph::cython":
         bool transposed,
         bool multi_gpu) except +
 
+    cdef void release_graph_container_cache(
+        graph_container_t &graph_container) except +
+
+    cdef void set_graph_container_handle(
+        graph_container_t &graph_container,
+        shared_ptr[handle_t] handle) except +
+
     ctypedef enum graphTypeEnum:
         LegacyCSR "cugraph::cython::graphTypeEnum::LegacyCSR"
         LegacyCSC "cugraph::cython::graphTypeEnum::LegacyCSC"